@@ -2,12 +2,25 @@
 #include <client/test/requests.hpp>
 
 #include <userver/chaotic/openapi/parameters_write.hpp>
-#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/http/common_headers.hpp>
 
 namespace clients::test {
 
 namespace openapi = USERVER_NAMESPACE::chaotic::openapi;
 
+namespace {
+
+// Writes the body straight into JSON via SAX, without building a DOM first
+template <typename Body>
+std::string ToJsonString(const Body& body) {
+    USERVER_NAMESPACE::formats::json::StringBuilder sw;
+    WriteToStream(body, sw);
+    return sw.GetString();
+}
+
+}  // namespace
+
 namespace testme_post {
 
 static constexpr openapi::Name knumber = "number";
@@ -17,8 +30,9 @@ void SerializeRequest(const Request& request, USERVER_NAMESPACE::clients::http::
 
     WriteParameter<openapi::TrivialParameter<openapi::In::kQuery, knumber, int>>(request.number, sink);
 
-    // http_request.data(ToJsonString(request.body));
-    http_request.data(ToString(USERVER_NAMESPACE::formats::json::ValueBuilder(request.body).ExtractValue()));
+    http_request.data(ToJsonString(request.body));
+
+    sink.Flush();
 }
 
 }  // namespace testme_post
@@ -575,10 +575,16 @@ class CppStructField:
 
     def cpp_field_parse_type(self) -> str:
         type_ = self.schema.parser_type('TODO', self.name.title())
-        if self.required or self._default() is not None:
-            return type_
-        else:
+        if self.is_parsed_as_optional():
             return f'std::optional<{type_}>'
+        else:
+            return type_
+
+    def is_parsed_as_optional(self) -> bool:
+        return not self.required and self._default() is None
+
+    def is_required_in_json(self) -> bool:
+        return self.required and self._default() is None
 
 
 @dataclasses.dataclass
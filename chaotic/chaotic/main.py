@@ -77,6 +77,11 @@ def parse_args() -> argparse.Namespace:
         action='store_true',
         help='Generate JSON serializers for generated types',
     )
+    parser.add_argument(
+        '--generate-sax-parsers',
+        action='store_true',
+        help='Generate SAX JSON parsers for generated types',
+    )
 
     parser.add_argument(
         '-o',
@@ -270,6 +275,7 @@ def main() -> None:
         clang_format_bin=args.clang_format,
         parse_extra_formats=args.parse_extra_formats,
         generate_serializer=args.generate_serializers,
+        generate_sax_parser=args.generate_sax_parsers,
     ).render(types)
     for output in outputs:
         if output.filepath_wo_ext.startswith('/'):
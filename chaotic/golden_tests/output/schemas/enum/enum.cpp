@@ -58,6 +58,15 @@ Serialize(const ns::Enum::Foo& value, USERVER_NAMESPACE::formats::serialize::To<
     return USERVER_NAMESPACE::formats::json::ValueBuilder(ToString(value)).ExtractValue();
 }
 
+void WriteToStream(const ns::Enum::Foo& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    const auto result = kns__Enum__Foo_Mapping.TryFindByFirst(value);
+    if (result.has_value()) {
+        sw.WriteString(*result);
+        return;
+    }
+    throw std::runtime_error("Bad enum value");
+}
+
 USERVER_NAMESPACE::formats::json::Value
 Serialize([[maybe_unused]] const ns::Enum& value, USERVER_NAMESPACE::formats::serialize::To<USERVER_NAMESPACE::formats::json::Value>) {
     USERVER_NAMESPACE::formats::json::ValueBuilder vb = USERVER_NAMESPACE::formats::common::Type::kObject;
@@ -69,6 +78,15 @@ Serialize([[maybe_unused]] const ns::Enum& value, USERVER_NAMESPACE::formats::se
     return vb.ExtractValue();
 }
 
+void WriteToStream([[maybe_unused]] const ns::Enum& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+    if (value.foo) {
+        sw.Key("foo");
+        WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<ns::Enum::Foo>{*value.foo}, sw);
+    }
+}
+
 std::string ToString(ns::Enum::Foo value) {
     const auto result = kns__Enum__Foo_Mapping.TryFindByFirst(value);
     if (result.has_value()) {
@@ -51,9 +51,13 @@ Enum::Foo Parse(std::string_view value, USERVER_NAMESPACE::formats::parse::To<ns
 USERVER_NAMESPACE::formats::json::Value
 Serialize(const ns::Enum::Foo& value, USERVER_NAMESPACE::formats::serialize::To<USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::Enum::Foo& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 USERVER_NAMESPACE::formats::json::Value
 Serialize(const ns::Enum& value, USERVER_NAMESPACE::formats::serialize::To<USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::Enum& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 std::string ToString(ns::Enum::Foo value);
 
 }  // namespace ns
@@ -38,14 +38,17 @@ UserType Parse(const Value& value, formats::parse::To<Array<ItemType, UserType,
 template <typename Value, typename ItemType, typename... Validators>
 std::vector<formats::common::ParseType<Value, ItemType>>
 Parse(const Value& value, formats::parse::To<Array<ItemType, std::vector<formats::common::ParseType<Value, ItemType>>, Validators...>>) {
+    // The vector has as many items as the array, so there is no need to parse
+    // the items of a too long array to reject it
+    const auto size = value.GetSize();
+    chaotic::ValidateSize<Validators...>(size, value);
+
     std::vector<formats::common::ParseType<Value, ItemType>> arr;
-    arr.reserve(value.GetSize());
+    arr.reserve(size);
     for (const auto& item : value) {
         arr.emplace_back(item.template As<ItemType>());
     }
 
-    chaotic::Validate<Validators...>(arr, value);
-
     return arr;
 }
 
@@ -58,6 +61,14 @@ Value Serialize(const Array<ItemType, UserType, Validators...>& ps, formats::ser
     return vb.ExtractValue();
 }
 
+template <typename ItemType, typename UserType, typename... Validators, typename StringBuilder>
+void WriteToStream(const Array<ItemType, UserType, Validators...>& ps, StringBuilder& sw) {
+    typename StringBuilder::ArrayGuard guard{sw};
+    for (const auto& item : ps.value) {
+        WriteToStream(ItemType{item}, sw);
+    }
+}
+
 }  // namespace chaotic
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,327 @@
+#pragma once
+
+/// @file userver/chaotic/sax_parser.hpp
+/// @brief SAX parsers for the chaotic types
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <userver/chaotic/array.hpp>
+#include <userver/chaotic/primitive.hpp>
+#include <userver/chaotic/with_type.hpp>
+#include <userver/formats/common/meta.hpp>
+#include <userver/formats/json/parser/parser.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace chaotic::sax {
+
+namespace impl {
+
+template <typename T, typename = void>
+struct ParserSelector;
+
+}  // namespace impl
+
+/// Parser for the chaotic type `T`, e.g. `Parser<Primitive<int, Minimum<kMin>>>`
+template <typename T>
+using Parser = typename impl::ParserSelector<T>::Type;
+
+/// Parses the whole subtree into formats::json::Value and converts it to `T`,
+/// used for the types without a dedicated SAX parser (oneOf, $ref, ...)
+template <typename T>
+class DomParser final : public formats::json::parser::Subscriber<formats::json::Value> {
+public:
+    using ResultType = formats::common::ParseType<formats::json::Value, T>;
+
+    DomParser() { parser_.Subscribe(*this); }
+
+    void Reset() { parser_.Reset(); }
+
+    void Subscribe(formats::json::parser::Subscriber<ResultType>& subscriber) { subscriber_ = &subscriber; }
+
+    auto& GetParser() { return parser_.GetParser(); }
+
+private:
+    void OnSend(formats::json::Value&& value) override {
+        auto result = value.As<T>();
+        if (subscriber_) subscriber_->OnSend(std::move(result));
+    }
+
+    formats::json::parser::JsonValueParser parser_;
+    formats::json::parser::Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+/// Runs the validators on the result of `Subparser`
+template <typename Subparser, typename... Validators>
+class ValidatingParser final : public formats::json::parser::Subscriber<typename Subparser::ResultType> {
+public:
+    using ResultType = typename Subparser::ResultType;
+
+    ValidatingParser() { subparser_.Subscribe(*this); }
+
+    void Reset() { subparser_.Reset(); }
+
+    void Subscribe(formats::json::parser::Subscriber<ResultType>& subscriber) { subscriber_ = &subscriber; }
+
+    auto& GetParser() { return subparser_.GetParser(); }
+
+private:
+    void OnSend(ResultType&& value) override {
+        chaotic::impl::RunValidators<Validators...>(value);
+        if (subscriber_) subscriber_->OnSend(std::move(value));
+    }
+
+    Subparser subparser_;
+    formats::json::parser::Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+/// Converts the string with `FromString(std::string_view, To<T>)`, used for
+/// string enums
+template <typename T>
+class StringEnumParser final : public formats::json::parser::Subscriber<std::string> {
+public:
+    using ResultType = T;
+
+    StringEnumParser() { subparser_.Subscribe(*this); }
+
+    void Reset() { subparser_.Reset(); }
+
+    void Subscribe(formats::json::parser::Subscriber<ResultType>& subscriber) { subscriber_ = &subscriber; }
+
+    auto& GetParser() { return subparser_.GetParser(); }
+
+private:
+    void OnSend(std::string&& value) override {
+        auto result = FromString(std::string_view{value}, formats::parse::To<T>{});
+        if (subscriber_) subscriber_->OnSend(std::move(result));
+    }
+
+    formats::json::parser::StringParser subparser_;
+    formats::json::parser::Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+/// Owns the parser of a generated struct created by `MakeSaxParser(To<T>)`
+template <typename T>
+class StructParser final {
+public:
+    using ResultType = T;
+
+    StructParser() : parser_(MakeSaxParser(formats::parse::To<T>{})) {}
+
+    void Reset() { parser_->Reset(); }
+
+    void Subscribe(formats::json::parser::Subscriber<ResultType>& subscriber) { parser_->Subscribe(subscriber); }
+
+    auto& GetParser() { return parser_->GetParser(); }
+
+private:
+    std::unique_ptr<formats::json::parser::TypedParser<T>> parser_;
+};
+
+/// chaotic::Array parser, the items are parsed with `Parser<ItemType>`
+template <typename ItemType, typename UserType, typename... Validators>
+class ArrayParser final : public formats::json::parser::Subscriber<UserType> {
+public:
+    using ResultType = UserType;
+
+    ArrayParser() { array_parser_.Subscribe(*this); }
+
+    void Reset() { array_parser_.Reset(); }
+
+    void Subscribe(formats::json::parser::Subscriber<ResultType>& subscriber) { subscriber_ = &subscriber; }
+
+    auto& GetParser() { return array_parser_.GetParser(); }
+
+private:
+    using ItemParser = Parser<ItemType>;
+
+    void OnSend(UserType&& value) override {
+        chaotic::impl::RunValidators<Validators...>(value);
+        if (subscriber_) subscriber_->OnSend(std::move(value));
+    }
+
+    ItemParser item_parser_;
+    formats::json::parser::ArrayParser<typename ItemParser::ResultType, ItemParser, UserType> array_parser_{
+        item_parser_};
+    formats::json::parser::Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+/// chaotic::WithType parser, converts the result of `Parser<RawType>`
+template <typename RawType, typename UserType>
+class WithTypeParser final : public formats::json::parser::Subscriber<typename Parser<RawType>::ResultType> {
+public:
+    using ResultType = UserType;
+
+    WithTypeParser() { subparser_.Subscribe(*this); }
+
+    void Reset() { subparser_.Reset(); }
+
+    void Subscribe(formats::json::parser::Subscriber<ResultType>& subscriber) { subscriber_ = &subscriber; }
+
+    auto& GetParser() { return subparser_.GetParser(); }
+
+private:
+    using RawResultType = typename Parser<RawType>::ResultType;
+
+    void OnSend(RawResultType&& value) override {
+        auto result = Convert(value, convert::To<UserType>{});
+        if (subscriber_) subscriber_->OnSend(std::move(result));
+    }
+
+    Parser<RawType> subparser_;
+    formats::json::parser::Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+/// Parses `null` into std::nullopt and anything else with `Subparser`
+template <typename Subparser>
+class OptionalParser final : public formats::json::parser::TypedParser<std::optional<typename Subparser::ResultType>>,
+                             public formats::json::parser::Subscriber<typename Subparser::ResultType> {
+public:
+    using ValueType = typename Subparser::ResultType;
+
+    OptionalParser() { subparser_.Subscribe(*this); }
+
+    void Reset() override {}
+
+private:
+    void Null() override { this->SetResult(std::nullopt); }
+    void Bool(bool value) override { PushSubparser().Bool(value); }
+    void Int64(std::int64_t value) override { PushSubparser().Int64(value); }
+    void Uint64(std::uint64_t value) override { PushSubparser().Uint64(value); }
+    void Double(double value) override { PushSubparser().Double(value); }
+    void String(std::string_view value) override { PushSubparser().String(value); }
+    void StartObject() override { PushSubparser().StartObject(); }
+    void StartArray() override { PushSubparser().StartArray(); }
+
+    formats::json::parser::BaseParser& PushSubparser() {
+        subparser_.Reset();
+        this->parser_state_->PushParser(subparser_.GetParser());
+        return subparser_.GetParser();
+    }
+
+    // The subparser has already popped itself, `this` is on the top
+    void OnSend(ValueType&& value) override { this->SetResult(std::optional<ValueType>{std::move(value)}); }
+
+    std::string Expected() const override { return "nullable value"; }
+    std::string GetPathItem() const override { return {}; }
+
+    Subparser subparser_;
+};
+
+/// Stores the result into a struct field and marks the field as present
+template <typename T, typename Field = T>
+class FieldSink final : public formats::json::parser::Subscriber<T> {
+public:
+    FieldSink(Field& field, bool& is_set) : field_(field), is_set_(is_set) {}
+
+    void OnSend(T&& value) override {
+        field_ = std::move(value);
+        is_set_ = true;
+    }
+
+private:
+    Field& field_;
+    bool& is_set_;
+};
+
+/// @brief Parses the JSON document into the generated type `T` without
+/// building an intermediate formats::json::Value.
+///
+/// Available for the types generated with `--generate-sax-parsers`.
+template <typename T>
+T ParseJsonString(std::string_view json) {
+    const auto parser = MakeSaxParser(formats::parse::To<T>{});
+    return formats::json::parser::impl::ParseSingle(*parser, json);
+}
+
+namespace impl {
+
+template <typename T>
+using MakeSaxParserResult = decltype(MakeSaxParser(formats::parse::To<T>{}));
+
+template <typename T>
+using FromStringResult = decltype(FromString(std::string_view{}, formats::parse::To<T>{}));
+
+template <typename T>
+using InsertResult = decltype(std::declval<T&>().insert(std::declval<typename T::value_type&&>()));
+
+template <typename T>
+struct RawParserSelector {
+    using Type = std::conditional_t<
+        meta::kIsDetected<MakeSaxParserResult, T>,
+        StructParser<T>,
+        std::conditional_t<meta::kIsDetected<FromStringResult, T>, StringEnumParser<T>, DomParser<T>>>;
+};
+
+template <>
+struct RawParserSelector<bool> {
+    using Type = formats::json::parser::BoolParser;
+};
+
+template <>
+struct RawParserSelector<std::int32_t> {
+    using Type = formats::json::parser::Int32Parser;
+};
+
+template <>
+struct RawParserSelector<std::int64_t> {
+    using Type = formats::json::parser::Int64Parser;
+};
+
+template <>
+struct RawParserSelector<double> {
+    using Type = formats::json::parser::DoubleParser;
+};
+
+template <>
+struct RawParserSelector<float> {
+    using Type = formats::json::parser::FloatParser;
+};
+
+template <>
+struct RawParserSelector<std::string> {
+    using Type = formats::json::parser::StringParser;
+};
+
+template <>
+struct RawParserSelector<formats::json::Value> {
+    using Type = formats::json::parser::JsonValueParser;
+};
+
+template <typename T, typename>
+struct ParserSelector {
+    using Type = DomParser<T>;
+};
+
+template <typename RawType, typename... Validators>
+struct ParserSelector<Primitive<RawType, Validators...>> {
+    using RawParser = typename RawParserSelector<RawType>::Type;
+    using Type = std::conditional_t<sizeof...(Validators) == 0, RawParser, ValidatingParser<RawParser, Validators...>>;
+};
+
+template <typename ItemType, typename UserType, typename... Validators>
+struct ParserSelector<
+    Array<ItemType, UserType, Validators...>,
+    std::enable_if_t<meta::kIsVector<UserType> || meta::kIsDetected<InsertResult, UserType>>> {
+    using Type = ArrayParser<ItemType, UserType, Validators...>;
+};
+
+template <typename RawType, typename UserType>
+struct ParserSelector<WithType<RawType, UserType>> {
+    using Type = WithTypeParser<RawType, UserType>;
+};
+
+}  // namespace impl
+
+}  // namespace chaotic::sax
+
+USERVER_NAMESPACE_END
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 #include <fmt/format.h>
 
@@ -59,8 +62,12 @@ template <std::int64_t Value>
 struct MinItems final {
     template <typename T>
     static void Validate(const T& value) {
-        if (value.size() < Value) {
-            throw std::runtime_error(fmt::format("Too short array, minimum length={}, given={}", Value, value.size()));
+        ValidateSize(value.size());
+    }
+
+    static void ValidateSize(std::size_t size) {
+        if (size < Value) {
+            throw std::runtime_error(fmt::format("Too short array, minimum length={}, given={}", Value, size));
         }
     }
 };
@@ -69,16 +76,21 @@ template <std::int64_t Value>
 struct MaxItems final {
     template <typename T>
     static void Validate(const T& value) {
-        if (value.size() > Value) {
-            throw std::runtime_error(fmt::format("Too long array, maximum length={}, given={}", Value, value.size()));
+        ValidateSize(value.size());
+    }
+
+    static void ValidateSize(std::size_t size) {
+        if (size > Value) {
+            throw std::runtime_error(fmt::format("Too long array, maximum length={}, given={}", Value, size));
         }
     }
 };
 
 template <std::int64_t Value>
 struct MinLength final {
-    static void Validate(std::string_view value) {
-        auto length = utils::text::utf8::GetCodePointsCount(value);
+    static void Validate(std::string_view value) { ValidateLength(utils::text::utf8::GetCodePointsCount(value)); }
+
+    static void ValidateLength(std::size_t length) {
         if (length < Value) {
             throw std::runtime_error(fmt::format("Too short string, minimum length={}, given={}", Value, length));
         }
@@ -87,18 +99,61 @@ struct MinLength final {
 
 template <std::int64_t Value>
 struct MaxLength final {
-    static void Validate(std::string_view value) {
-        auto length = utils::text::utf8::GetCodePointsCount(value);
+    static void Validate(std::string_view value) { ValidateLength(utils::text::utf8::GetCodePointsCount(value)); }
+
+    static void ValidateLength(std::size_t length) {
         if (length > Value) {
             throw std::runtime_error(fmt::format("Too long string, maximum length={}, given={}", Value, length));
         }
     }
 };
 
+namespace impl {
+
+template <typename Validator, typename = void>
+inline constexpr bool kIsLengthValidator = false;
+
+template <typename Validator>
+inline constexpr bool
+    kIsLengthValidator<Validator, std::void_t<decltype(Validator::ValidateLength(std::size_t{}))>> = true;
+
+template <typename Validator, typename Obj>
+void RunValidator(const Obj& obj, std::size_t length) {
+    if constexpr (kIsLengthValidator<Validator>) {
+        Validator::ValidateLength(length);
+    } else {
+        Validator::Validate(obj);
+    }
+}
+
+/// Runs the validators on the parsed value, the UTF-8 code points of a string
+/// are counted once for both MinLength and MaxLength
+template <typename... Validators, typename Obj>
+void RunValidators(const Obj& obj) {
+    if constexpr ((kIsLengthValidator<Validators> || ...)) {
+        const auto length = utils::text::utf8::GetCodePointsCount(obj);
+        (impl::RunValidator<Validators>(obj, length), ...);
+    } else {
+        (Validators::Validate(obj), ...);
+    }
+}
+
+}  // namespace impl
+
 template <typename... Validators, typename Obj, typename Value>
 void Validate(const Obj& obj, const Value& value) {
     try {
-        (Validators::Validate(obj), ...);
+        impl::RunValidators<Validators...>(obj);
+    } catch (const std::exception& e) {
+        chaotic::ThrowForValue(e.what(), value);
+    }
+}
+
+/// Runs the MinItems and MaxItems validators before the array items are parsed
+template <typename... Validators, typename Value>
+void ValidateSize(std::size_t size, const Value& value) {
+    try {
+        (Validators::ValidateSize(size), ...);
     } catch (const std::exception& e) {
         chaotic::ThrowForValue(e.what(), value);
     }
@@ -2,6 +2,7 @@
 
 #include <stdexcept>
 #include <string>
+#include <string_view>
 
 #include <userver/utils/regex.hpp>
 
@@ -11,9 +12,10 @@ namespace chaotic {
 
 template <const std::string_view& Regex>
 struct Pattern final {
+    // Compiled once on startup rather than on each validation
     static const utils::regex kRegex;
 
-    static void Validate(const std::string& value) {
+    static void Validate(std::string_view value) {
         if (!utils::regex_search(value, kRegex)) throw std::runtime_error("doesn't match regex");
     }
 };
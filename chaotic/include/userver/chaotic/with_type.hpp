@@ -32,6 +32,11 @@ Value Serialize(const WithType<RawType, UserType>& ps, formats::serialize::To<Va
         .ExtractValue();
 }
 
+template <typename RawType, typename UserType, typename StringBuilder>
+void WriteToStream(const WithType<RawType, UserType>& ps, StringBuilder& sw) {
+    WriteToStream(RawType{Convert(ps.value, convert::To<std::decay_t<decltype(RawType::value)>>())}, sw);
+}
+
 }  // namespace chaotic
 
 USERVER_NAMESPACE_END
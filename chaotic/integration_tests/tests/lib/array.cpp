@@ -44,6 +44,18 @@ TEST(Array, OfIntWithValidators) {
     );
 }
 
+TEST(Array, TooLongArrayItemsAreNotParsed) {
+    using Arr = chaotic::Array<int, std::vector<int>, chaotic::MaxItems<2>>;
+
+    // The size error is reported rather than the error of an item
+    const auto kJson = formats::json::MakeArray(1, 2, "three");
+    UEXPECT_THROW_MSG(
+        kJson.As<Arr>(),
+        chaotic::Error<formats::json::Value>,
+        "Error at path '/': Too long array, maximum length=2, given=3"
+    );
+}
+
 TEST(Array, OfIntWithValidatorsSerializer) {
     const auto kJson = formats::json::MakeArray("foo", "bar");
     using Arr = chaotic::Array<std::string, std::vector<std::string>, chaotic::MinItems<2>>;
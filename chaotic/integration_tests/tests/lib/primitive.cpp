@@ -118,6 +118,15 @@ TEST(Primitive, StringMinMaxLength) {
         chaotic::Error<formats::json::Value>,
         "Error at path '6': Too long string, maximum length=5, given=6"
     );
+
+    // The length is in code points
+    const auto kUtf8Json = formats::json::MakeObject("2", "\u0444\u0444", "6", "\u0444\u0444\u0444\u0444\u0444\u0444");
+    EXPECT_EQ(kUtf8Json["2"].As<Str>(), "\u0444\u0444");
+    UEXPECT_THROW_MSG(
+        kUtf8Json["6"].As<Str>(),
+        chaotic::Error<formats::json::Value>,
+        "Error at path '6': Too long string, maximum length=5, given=6"
+    );
 }
 
 static constexpr std::string_view kPattern = "fo.*";
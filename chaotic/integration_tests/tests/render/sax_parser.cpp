@@ -0,0 +1,92 @@
+#include <userver/utest/assert_macros.hpp>
+
+#include <userver/chaotic/sax_parser.hpp>
+#include <userver/formats/json/parser/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+
+#include <schemas/array.hpp>
+#include <schemas/int_minmax.hpp>
+#include <schemas/object_extra.hpp>
+#include <schemas/object_single_field.hpp>
+#include <schemas/one_of.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename T>
+void CheckSameAsDom(std::string_view json_string) {
+    EXPECT_EQ(chaotic::sax::ParseJsonString<T>(json_string), formats::json::FromString(json_string).As<T>())
+        << json_string;
+}
+
+}  // namespace
+
+TEST(SaxParser, Object) {
+    CheckSameAsDom<ns::ObjectTypes>(
+        R"({"boolean": true, "integer": 1, "number": 1.5, "string": "s", "object": {}, "array": [1, 2],)"
+        R"( "int-enum": 2, "string-enum": "bar"})"
+    );
+    CheckSameAsDom<ns::ObjectTypes>(
+        R"({"boolean": false, "integer": 1, "number": 1, "string": "", "object": {}, "array": []})"
+    );
+    CheckSameAsDom<ns::ObjectWithRef>(R"({"integer": 3, "object": {"int3": 1}})");
+    CheckSameAsDom<ns::ObjectWithRef>(R"({"object": {"int3": 1, "int": 5, "integer": null}})");
+    CheckSameAsDom<ns::ObjectWithSet>(R"({"set": [1, 2, 1]})");
+    CheckSameAsDom<ns::ArrayStruct>(R"({"array": ["a", "b"]})");
+}
+
+TEST(SaxParser, AdditionalProperties) {
+    CheckSameAsDom<ns::ObjectWithAdditionalPropertiesInt>(R"({"one": 5, "two": 2, "three": 3})");
+    CheckSameAsDom<ns::ObjectWithAdditionalProperties>(R"({"foo": "x", "a": {"bar": "y"}})");
+    CheckSameAsDom<ns::ObjectWithAdditionalPropertiesTrue>(R"({"one": 5, "two": [2], "three": {"x": 3}})");
+    CheckSameAsDom<ns::ObjectExtra>(R"({"a": {"b": {"c": {}}}})");
+}
+
+TEST(SaxParser, DomFallback) {
+    CheckSameAsDom<ns::ObjectOneOfWithDiscriminator>(R"({"oneof": {"type": "ObjectFoo", "foo": 1}})");
+    CheckSameAsDom<ns::ObjectOneOfWithDiscriminator>(R"({"oneof": {"type": "ObjectBar", "bar": "str"}})");
+}
+
+TEST(SaxParser, Errors) {
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseJsonString<ns::IntegerObject>(R"({"foo": 1})"),
+        formats::json::parser::ParseError,
+        "path 'foo': Invalid value, exclusive minimum=1, given=1"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseJsonString<ns::IntegerObject>(R"({"bar": "longlonglong"})"),
+        formats::json::parser::ParseError,
+        "path 'bar': Too long string, maximum length=5, given=12"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseJsonString<ns::IntegerObject>(R"({"zoo": [1]})"),
+        formats::json::parser::ParseError,
+        "path 'zoo': Too short array, minimum length=2, given=1"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseJsonString<ns::IntegerObject>(R"({"zoo": [1, "2"]})"),
+        formats::json::parser::ParseError,
+        "[1]': integer was expected, but string found"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseJsonString<ns::ObjectWithRef>(R"({"object": {}})"),
+        formats::json::parser::ParseError,
+        "path 'object': Field 'int3' is missing"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseJsonString<ns::IntegerObject>(R"({"unknown": 1})"),
+        formats::json::parser::ParseError,
+        "Unknown property 'unknown'"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseJsonString<ns::ObjectTypes>(
+            R"({"boolean": true, "integer": 1, "number": 1, "string": "", "object": {}, "array": [],)"
+            R"( "string-enum": "zoo"})"
+        ),
+        formats::json::parser::ParseError,
+        "path 'string-enum': Invalid enum value (zoo)"
+    );
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,66 @@
+#include <userver/utest/assert_macros.hpp>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/serialize/variant.hpp>
+
+#include <schemas/all_of.hpp>
+#include <schemas/array.hpp>
+#include <schemas/object_extra.hpp>
+#include <schemas/object_single_field.hpp>
+#include <schemas/one_of.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename T>
+void CheckWriteToStream(std::string_view json_string) {
+    const auto obj = formats::json::FromString(json_string).As<T>();
+
+    formats::json::StringBuilder sw;
+    WriteToStream(obj, sw);
+    EXPECT_EQ(formats::json::FromString(sw.GetString()), formats::json::ValueBuilder{obj}.ExtractValue())
+        << json_string;
+}
+
+}  // namespace
+
+TEST(WriteToStream, Object) {
+    CheckWriteToStream<ns::ObjectTypes>(
+        R"({"boolean": true, "integer": 1, "number": 1.5, "string": "s", "object": {}, "array": [1, 2],)"
+        R"( "int-enum": 2, "string-enum": "bar"})"
+    );
+    CheckWriteToStream<ns::ObjectWithRef>(R"({"integer": 3, "object": {"int3": 1}})");
+    CheckWriteToStream<ns::ArrayStruct>(R"({"array": ["a", "b"]})");
+}
+
+TEST(WriteToStream, AdditionalProperties) {
+    CheckWriteToStream<ns::ObjectWithAdditionalPropertiesInt>(R"({"one": 5, "two": 2, "three": 3})");
+    CheckWriteToStream<ns::ObjectWithAdditionalProperties>(R"({"foo": "x", "a": {"bar": "y"}})");
+    CheckWriteToStream<ns::ObjectWithAdditionalPropertiesTrue>(R"({"one": 5, "two": [2], "three": {"x": 3}})");
+    CheckWriteToStream<ns::ObjectExtra>(R"({"a": {"b": {"c": {}}}})");
+}
+
+TEST(WriteToStream, OneOf) {
+    CheckWriteToStream<ns::ObjectOneOfWithDiscriminator>(R"({"oneof": {"type": "ObjectFoo", "foo": 1}})");
+    CheckWriteToStream<ns::ObjectOneOfWithDiscriminator>(R"({"oneof": {"type": "ObjectBar", "bar": "str"}})");
+    CheckWriteToStream<ns::OneOf>(R"(true)");
+    CheckWriteToStream<ns::OneOf>(R"(1.5)");
+}
+
+TEST(WriteToStream, AllOf) { CheckWriteToStream<ns::AllOf>(R"({"foo": 1, "bar": 2, "extra": "x"})"); }
+
+TEST(WriteToStream, PropertiesOverrideExtra) {
+    ns::ObjectWithAdditionalPropertiesInt obj;
+    obj.one = 5;
+    obj.extra["one"] = 10;
+    obj.extra["two"] = 2;
+
+    formats::json::StringBuilder sw;
+    WriteToStream(obj, sw);
+    EXPECT_EQ(formats::json::FromString(sw.GetString()), formats::json::FromString(R"({"one": 5, "two": 2})"));
+}
+
+USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/datetime/from_string_saturating.hpp>
+#include <userver/utils/datetime/rfc3339.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -16,6 +17,11 @@ constexpr std::string_view kZeroTimePoint = "1970-01-01T00:00:00";
 }
 
 TimePointTz Convert(const std::string& str, chaotic::convert::To<TimePointTz>) {
+    std::chrono::minutes offset{};
+    if (const auto tp = utils::datetime::ParseRfc3339(str, offset)) {
+        return TimePointTz{*tp, offset};
+    }
+
     auto s = str;
     auto tp = utils::datetime::FromStringSaturating(s, utils::datetime::kRfc3339Format);
 
@@ -27,6 +33,12 @@ TimePointTz Convert(const std::string& str, chaotic::convert::To<TimePointTz>) {
 
 std::string Convert(const TimePointTz& tp, chaotic::convert::To<std::string>) {
     auto offset = tp.GetTzOffset();
+    if (offset % std::chrono::minutes{1} == std::chrono::seconds{0}) {
+        utils::datetime::Rfc3339Buffer buffer;
+        return std::string{utils::datetime::FormatRfc3339(
+            tp.GetTimePoint(), std::chrono::duration_cast<std::chrono::minutes>(offset), buffer
+        )};
+    }
     return cctz::format(utils::datetime::kRfc3339Format, tp.GetTimePoint(), cctz::fixed_time_zone(offset));
 }
 
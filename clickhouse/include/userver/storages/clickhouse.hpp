@@ -4,6 +4,7 @@
 /// This file is mainly for documentation purposes and inclusion of all headers
 /// that are required for working with ClickHouse µserver component.
 
+#include <userver/storages/clickhouse/batch_inserter.hpp>
 #include <userver/storages/clickhouse/cluster.hpp>
 #include <userver/storages/clickhouse/component.hpp>
 #include <userver/storages/clickhouse/execution_result.hpp>
@@ -0,0 +1,266 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/batch_inserter.hpp
+/// @brief @copybrief storages::clickhouse::BatchInserter
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/async.hpp>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/fwd.hpp>
+#include <userver/storages/clickhouse/impl/insertion_request.hpp>
+#include <userver/storages/clickhouse/io/impl/validate.hpp>
+#include <userver/storages/clickhouse/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+/// Settings of storages::clickhouse::BatchInserter
+struct BatchInserterSettings final {
+    /// Number of buffered rows that triggers an INSERT
+    std::size_t max_batch_rows{100'000};
+
+    /// Buffered rows are inserted at least this often
+    std::chrono::milliseconds flush_interval{1000};
+
+    /// Limit for the rows that are either buffered or being inserted, the
+    /// insertion waits for the room when the limit is reached
+    std::size_t max_pending_rows{1'000'000};
+
+    /// How long the insertion waits for the room before giving up
+    std::chrono::milliseconds wait_timeout{1000};
+
+    /// Command control for the INSERT statements
+    OptionalCommandControl command_control{};
+};
+
+/// Exception that is thrown by storages::clickhouse::BatchInserter::Insert
+/// if there is no room for the row within the wait timeout
+class BatchInserterOverflowError : public std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+namespace impl {
+
+template <typename MappedType>
+struct ColumnContainers;
+
+template <typename... Columns>
+struct ColumnContainers<std::tuple<Columns...>> final {
+    using type = std::tuple<typename Columns::container_type...>;
+};
+
+}  // namespace impl
+
+// clang-format off
+
+/// @brief Buffers rows for a single table and inserts them in big batches.
+///
+/// Rows inserted from any number of coroutines are accumulated column-wise,
+/// and the whole buffer is inserted with a single INSERT once it reaches
+/// `max_batch_rows` or every `flush_interval`, which avoids creating lots of
+/// tiny parts on the server. Batches are inserted one at a time by a
+/// background task. Compression of the data is configured for the whole
+/// cluster by the `compression` option of components::ClickHouse.
+///
+/// Insert waits while `max_pending_rows` rows are buffered or being inserted,
+/// and throws storages::clickhouse::BatchInserterOverflowError if the room
+/// doesn't appear within `wait_timeout`.
+///
+/// A batch that failed to be inserted by the background task is logged and
+/// dropped. The remaining rows are inserted on destruction.
+///
+/// `Row` is expected to be a clickhouse-mapped type, see @ref clickhouse_io
+/// for better understanding of its requirements.
+
+// clang-format on
+template <typename Row>
+class BatchInserter final {
+public:
+    /// @param cluster cluster to insert into
+    /// @param table_name table to insert into
+    /// @param column_names names of columns of the table
+    /// @param settings flush and backpressure settings
+    BatchInserter(
+        ClusterPtr cluster,
+        std::string table_name,
+        std::vector<std::string> column_names,
+        BatchInserterSettings settings
+    );
+
+    BatchInserter(const BatchInserter&) = delete;
+    BatchInserter& operator=(const BatchInserter&) = delete;
+
+    /// Inserts the remaining rows
+    ~BatchInserter();
+
+    /// Buffers the row, waiting for the room if needed
+    /// @throws storages::clickhouse::BatchInserterOverflowError
+    void Insert(Row row);
+
+    /// Inserts the buffered rows right away, the rows are dropped if the
+    /// insertion fails
+    void Flush();
+
+private:
+    using MappedType = typename io::CppToClickhouse<Row>::mapped_type;
+    using Columns = typename impl::ColumnContainers<MappedType>::type;
+
+    void RunFlusher();
+    void ReleaseRows(std::size_t rows);
+
+    const ClusterPtr cluster_;
+    const std::string table_name_;
+    const std::vector<std::string> column_names_;
+    const std::vector<std::string_view> column_name_views_;
+    const BatchInserterSettings settings_;
+
+    engine::Mutex mutex_;
+    // Notifies the flusher about a full batch or a stop
+    engine::ConditionVariable batch_cv_;
+    // Notifies the inserters about the freed room
+    engine::ConditionVariable room_cv_;
+    Columns buffer_;
+    std::size_t buffered_rows_{0};
+    std::size_t pending_rows_{0};
+    bool stopped_{false};
+
+    // Batches are inserted one at a time
+    engine::Mutex flush_mutex_;
+
+    // This should be the last member
+    engine::TaskWithResult<void> flusher_;
+};
+
+template <typename Row>
+BatchInserter<Row>::BatchInserter(
+    ClusterPtr cluster,
+    std::string table_name,
+    std::vector<std::string> column_names,
+    BatchInserterSettings settings
+)
+    : cluster_{std::move(cluster)},
+      table_name_{std::move(table_name)},
+      column_names_{std::move(column_names)},
+      column_name_views_{column_names_.begin(), column_names_.end()},
+      settings_{settings} {
+    io::impl::ValidateRowsMapping<Row>();
+    io::impl::ValidateColumnsCount<Row>(column_names_.size());
+    UINVARIANT(cluster_, "Cluster is required");
+    UINVARIANT(settings_.max_batch_rows > 0, "max_batch_rows should be positive");
+
+    flusher_ = USERVER_NAMESPACE::utils::CriticalAsync("clickhouse_batch_inserter", [this] { RunFlusher(); });
+}
+
+template <typename Row>
+BatchInserter<Row>::~BatchInserter() {
+    {
+        const std::lock_guard lock{mutex_};
+        stopped_ = true;
+    }
+    batch_cv_.NotifyAll();
+    flusher_.Wait();
+
+    try {
+        Flush();
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "Failed to insert the remaining rows into '" << table_name_ << "': " << ex;
+    }
+}
+
+template <typename Row>
+void BatchInserter<Row>::Insert(Row row) {
+    std::unique_lock lock{mutex_};
+    const auto has_room =
+        room_cv_.WaitFor(lock, settings_.wait_timeout, [this] { return pending_rows_ < settings_.max_pending_rows; });
+    if (!has_room) {
+        throw BatchInserterOverflowError{"Too many rows are pending insertion into '" + table_name_ + "'"};
+    }
+
+    boost::pfr::for_each_field(row, [this](auto& field, auto index) {
+        auto& column = std::get<decltype(index)::value>(buffer_);
+        using ColumnValue = typename std::decay_t<decltype(column)>::value_type;
+        static_assert(std::is_same_v<std::decay_t<decltype(field)>, ColumnValue>);
+        column.push_back(std::move(field));
+    });
+    ++pending_rows_;
+
+    if (++buffered_rows_ >= settings_.max_batch_rows) {
+        lock.unlock();
+        batch_cv_.NotifyOne();
+    }
+}
+
+template <typename Row>
+void BatchInserter<Row>::Flush() {
+    const std::lock_guard flush_lock{flush_mutex_};
+
+    Columns batch;
+    std::size_t rows = 0;
+    {
+        const std::lock_guard lock{mutex_};
+        std::swap(batch, buffer_);
+        rows = std::exchange(buffered_rows_, 0);
+    }
+    if (rows == 0) return;
+
+    try {
+        const auto request =
+            impl::InsertionRequest::CreateFromColumns<MappedType>(table_name_, column_name_views_, batch);
+        cluster_->DoInsert(settings_.command_control, request);
+    } catch (const std::exception&) {
+        ReleaseRows(rows);
+        throw;
+    }
+    ReleaseRows(rows);
+}
+
+template <typename Row>
+void BatchInserter<Row>::RunFlusher() {
+    while (!engine::current_task::ShouldCancel()) {
+        {
+            std::unique_lock lock{mutex_};
+            [[maybe_unused]] const auto batch_is_full = batch_cv_.WaitFor(lock, settings_.flush_interval, [this] {
+                return stopped_ || buffered_rows_ >= settings_.max_batch_rows;
+            });
+            if (stopped_) return;
+        }
+
+        try {
+            Flush();
+        } catch (const std::exception& ex) {
+            LOG_ERROR() << "Failed to insert a batch into '" << table_name_ << "', the rows are dropped: " << ex;
+        }
+    }
+}
+
+template <typename Row>
+void BatchInserter<Row>::ReleaseRows(std::size_t rows) {
+    {
+        const std::lock_guard lock{mutex_};
+        pending_rows_ -= rows;
+    }
+    room_cv_.NotifyAll();
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
@@ -24,6 +24,9 @@ namespace storages::clickhouse {
 
 class ExecutionResult;
 
+template <typename Row>
+class BatchInserter;
+
 namespace impl {
 struct ClickhouseSettings;
 }
@@ -61,6 +64,33 @@ public:
     template <typename... Args>
     ExecutionResult Execute(OptionalCommandControl, const Query& query, const Args&... args) const;
 
+    /// @brief Execute a statement at some host of the cluster
+    /// with args as query parameters, passing the result to `callback`
+    /// block by block as it is received.
+    ///
+    /// Only a single block of the result is kept in memory at a time, and the
+    /// processing of a block overlaps with the network reads of the next ones,
+    /// which suits huge analytical queries. Every block is an ExecutionResult
+    /// that could be converted with `As`, `AsRows` or `AsContainer`.
+    /// @note The execution timeout covers the whole query, including the time
+    /// spent in the callback.
+    /// @note An exception thrown from the callback cancels the query, the
+    /// connection is dropped and the exception is rethrown.
+    template <typename... Args>
+    void ExecuteStreaming(const Query& query, const BlockCallback& callback, const Args&... args) const;
+
+    /// @brief Execute a statement with specified command control settings
+    /// at some host of the cluster with args as query parameters, passing the
+    /// result to `callback` block by block as it is received.
+    /// See the overload above for details.
+    template <typename... Args>
+    void ExecuteStreaming(
+        OptionalCommandControl,
+        const Query& query,
+        const BlockCallback& callback,
+        const Args&... args
+    ) const;
+
     /// @brief Insert data at some host of the cluster;
     /// `T` is expected to be a struct of vectors of same length.
     /// @param table_name table to insert into
@@ -132,10 +162,15 @@ public:
     };
 
 private:
+    template <typename Row>
+    friend class BatchInserter;
+
     void DoInsert(OptionalCommandControl, const impl::InsertionRequest& request) const;
 
     ExecutionResult DoExecute(OptionalCommandControl, const Query& query) const;
 
+    void DoExecuteStreaming(OptionalCommandControl, const Query& query, const BlockCallback& callback) const;
+
     const impl::Pool& GetPool() const;
 
     std::vector<impl::Pool> pools_;
@@ -194,6 +229,22 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc, const Query
     return DoExecute(optional_cc, formatted_query);
 }
 
+template <typename... Args>
+void Cluster::ExecuteStreaming(const Query& query, const BlockCallback& callback, const Args&... args) const {
+    ExecuteStreaming(OptionalCommandControl{}, query, callback, args...);
+}
+
+template <typename... Args>
+void Cluster::ExecuteStreaming(
+    OptionalCommandControl optional_cc,
+    const Query& query,
+    const BlockCallback& callback,
+    const Args&... args
+) const {
+    const auto formatted_query = query.WithArgs(args...);
+    DoExecuteStreaming(optional_cc, formatted_query, callback);
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
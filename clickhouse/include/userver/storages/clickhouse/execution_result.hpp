@@ -3,8 +3,10 @@
 /// @file userver/storages/clickhouse/execution_result.hpp
 /// @brief Result accessor.
 
+#include <functional>
 #include <memory>
 #include <type_traits>
+#include <utility>
 
 #include <boost/pfr/core.hpp>
 
@@ -46,7 +48,15 @@ public:
     template <typename T>
     T As() &&;
 
+    /// Converts underlying block to strongly-typed struct of vectors, that may
+    /// contain views (e.g. io::columns::StringViewColumn) into the block, valid
+    /// while this ExecutionResult is alive.
+    /// See @ref clickhouse_io for better understanding of `T`'s requirements.
+    template <typename T>
+    T As() const&;
+
     /// Converts underlying block to iterable of strongly-typed struct.
+    /// Views in the rows are valid while the iterable is alive.
     /// See @ref clickhouse_io for better understanding of `T`'s requirements.
     template <typename T>
     auto AsRows() &&;
@@ -61,8 +71,21 @@ private:
     impl::BlockWrapperPtr block_;
 };
 
+/// Callback for storages::clickhouse::Cluster ExecuteStreaming methods, is
+/// called for every non-empty block of the result as soon as it arrives.
+using BlockCallback = std::function<void(ExecutionResult&& block)>;
+
 template <typename T>
 T ExecutionResult::As() && {
+    static_assert(
+        !io::impl::kHasViewColumns<T>,
+        "Views would outlive the result, map an lvalue ExecutionResult instead"
+    );
+    return std::as_const(*this).As<T>();
+}
+
+template <typename T>
+T ExecutionResult::As() const& {
     UASSERT(block_);
     T result{};
     io::impl::ValidateColumnsMapping(result);
@@ -89,6 +112,7 @@ template <typename Container>
 Container ExecutionResult::AsContainer() && {
     UASSERT(block_);
     using Row = typename Container::value_type;
+    static_assert(!io::impl::kHasViewColumns<Row>, "Views would outlive the result, use AsRows instead");
 
     Container result;
     if constexpr (io::traits::kIsReservable<Container>) {
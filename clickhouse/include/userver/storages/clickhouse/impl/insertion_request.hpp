@@ -3,6 +3,8 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include <userver/utils/assert.hpp>
@@ -36,6 +38,13 @@ public:
         const Container& data
     );
 
+    template <typename MappedType, typename Columns>
+    static InsertionRequest CreateFromColumns(
+        const std::string& table_name,
+        const std::vector<std::string_view>& column_names,
+        const Columns& columns
+    );
+
     const std::string& GetTableName() const;
 
     const impl::BlockWrapper& GetBlock() const;
@@ -86,6 +95,17 @@ private:
         const Container& data_;
     };
 
+    template <typename MappedType, typename Columns, size_t... Indices>
+    void AppendColumns(const Columns& columns, std::index_sequence<Indices...>) {
+        (io::columns::AppendWrappedColumn(
+             *block_,
+             std::tuple_element_t<Indices, MappedType>::Serialize(std::get<Indices>(columns)),
+             column_names_[Indices],
+             Indices
+         ),
+         ...);
+    }
+
     const std::string& table_name_;
     const std::vector<std::string_view>& column_names_;
 
@@ -132,6 +152,21 @@ InsertionRequest InsertionRequest::CreateFromRows(
     return request;
 }
 
+template <typename MappedType, typename Columns>
+InsertionRequest InsertionRequest::CreateFromColumns(
+    const std::string& table_name,
+    const std::vector<std::string_view>& column_names,
+    const Columns& columns
+) {
+    constexpr auto kColumnsCount = std::tuple_size_v<MappedType>;
+    static_assert(std::tuple_size_v<Columns> == kColumnsCount);
+    UINVARIANT(column_names.size() == kColumnsCount, "Columns count mismatch");
+
+    InsertionRequest request{table_name, column_names};
+    request.AppendColumns<MappedType>(columns, std::make_index_sequence<kColumnsCount>{});
+    return request;
+}
+
 }  // namespace storages::clickhouse::impl
 
 USERVER_NAMESPACE_END
@@ -29,6 +29,8 @@ public:
 
     ExecutionResult Execute(OptionalCommandControl, const Query& query) const;
 
+    void ExecuteStreaming(OptionalCommandControl, const Query& query, const BlockCallback& callback) const;
+
     void Insert(OptionalCommandControl, const InsertionRequest& request) const;
 
     void WriteStatistics(USERVER_NAMESPACE::utils::statistics::Writer& writer) const;
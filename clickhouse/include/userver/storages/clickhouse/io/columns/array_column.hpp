@@ -29,6 +29,8 @@ public:
     using cpp_type = std::vector<typename T::cpp_type>;
     using container_type = std::vector<cpp_type>;
 
+    static constexpr bool kIsView = kIsViewColumn<T>;
+
     ArrayColumn(ColumnRef column);
 
     class ArrayDataHolder final {
@@ -127,9 +129,14 @@ ColumnRef ArrayColumn<T>::Serialize(const container_type& from) {
 template <typename T>
 typename ArrayColumn<T>::cpp_type ArrayColumn<T>::RetrieveElement(const ColumnRef& ref, std::size_t ind) {
     auto array_item = ExtractArrayItem(ref, ind);
-    T typed_column(array_item);
 
     cpp_type result;
+    if constexpr (kHasBulkDeserialization<T>) {
+        T::DeserializeInto(array_item, result);
+        return result;
+    }
+
+    T typed_column(array_item);
     result.reserve(GetColumnSize(array_item));
     for (auto it = typed_column.begin(); it != typed_column.end(); ++it) {
         result.push_back(std::move(*it));
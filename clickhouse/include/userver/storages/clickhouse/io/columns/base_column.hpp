@@ -3,6 +3,11 @@
 /// @file userver/storages/clickhouse/io/columns/base_column.hpp
 /// @brief @copybrief storages::clickhouse::io::columns::ClickhouseColumn
 
+#include <type_traits>
+#include <utility>
+
+#include <userver/utils/meta_light.hpp>
+
 #include <userver/storages/clickhouse/io/columns/column_iterator.hpp>
 #include <userver/storages/clickhouse/io/columns/column_wrapper.hpp>
 
@@ -22,6 +27,11 @@ namespace storages::clickhouse::io::columns {
 /// - `static ColumnRef Serialize(const container_type&)` - constructs a column from C++ container,
 /// - `cpp_type ColumnIterator<YourColumnType>::DataHolder::Get()`
 ///
+/// Optionally a column may implement
+/// `static void DeserializeInto(const ColumnRef&, container_type&)`, that appends all the
+/// values of the column at once instead of iterating over them, and declare
+/// `static constexpr bool kIsView = true` if its values reference the data of the column.
+///
 /// see implementation of any of the existing columns for better understanding.
 // clang-format on
 template <typename ColumnType>
@@ -41,6 +51,34 @@ private:
     ColumnRef column_;
 };
 
+namespace impl {
+
+template <typename ColumnType>
+using ViewFlag = decltype(ColumnType::kIsView);
+
+template <typename ColumnType>
+using BulkDeserialization = decltype(ColumnType::DeserializeInto(
+    std::declval<const ColumnRef&>(),
+    std::declval<typename ColumnType::container_type&>()
+));
+
+}  // namespace impl
+
+/// Whether the values of the column reference the data of the column, and thus
+/// are only valid while the result they were mapped from is alive
+template <typename ColumnType>
+inline constexpr bool kIsViewColumn = [] {
+    if constexpr (meta::kIsDetected<impl::ViewFlag, ColumnType>) {
+        return ColumnType::kIsView;
+    } else {
+        return false;
+    }
+}();
+
+/// Whether the column supports deserialization of all its values at once
+template <typename ColumnType>
+inline constexpr bool kHasBulkDeserialization = meta::kIsDetected<impl::BulkDeserialization, ColumnType>;
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
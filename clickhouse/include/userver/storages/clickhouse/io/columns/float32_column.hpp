@@ -19,6 +19,8 @@ public:
     Float32Column(ColumnRef column);
 
     static ColumnRef Serialize(const container_type& from);
+
+    static void DeserializeInto(const ColumnRef& from, container_type& to);
 };
 
 }  // namespace storages::clickhouse::io::columns
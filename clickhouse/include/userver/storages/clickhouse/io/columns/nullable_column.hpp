@@ -33,6 +33,8 @@ public:
     using cpp_type = std::optional<typename T::cpp_type>;
     using container_type = std::vector<cpp_type>;
 
+    static constexpr bool kIsView = kIsViewColumn<T>;
+
     class NullableDataHolder final {
     public:
         NullableDataHolder() = default;
@@ -5,6 +5,7 @@
 /// @ingroup userver_clickhouse_types
 
 #include <string>
+#include <string_view>
 
 #include <userver/storages/clickhouse/io/columns/column_includes.hpp>
 
@@ -23,6 +24,23 @@ public:
     static ColumnRef Serialize(const container_type& from);
 };
 
+/// @brief Represents ClickHouse String column, that is read without copying.
+///
+/// The values reference the data of the result and are only valid while it
+/// is alive, so it could only be mapped from an lvalue ExecutionResult or
+/// iterated over with `AsRows`.
+class StringViewColumn final : public ClickhouseColumn<StringViewColumn> {
+public:
+    using cpp_type = std::string_view;
+    using container_type = std::vector<cpp_type>;
+
+    static constexpr bool kIsView = true;
+
+    StringViewColumn(ColumnRef column);
+
+    static ColumnRef Serialize(const container_type& from);
+};
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
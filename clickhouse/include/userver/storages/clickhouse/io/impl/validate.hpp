@@ -63,6 +63,15 @@ inline constexpr auto kCppTypeColumnsCount = boost::pfr::tuple_size_v<T>;
 template <typename T>
 inline constexpr auto kClickhouseTypeColumnsCount = std::tuple_size_v<MappedType<T>>;
 
+template <typename T>
+struct HasViewColumns;
+
+template <typename... Columns>
+struct HasViewColumns<std::tuple<Columns...>> : std::bool_constant<(columns::kIsViewColumn<Columns> || ...)> {};
+
+template <typename T>
+inline constexpr bool kHasViewColumns = HasViewColumns<MappedType<T>>::value;
+
 template <typename T>
 constexpr void CommonValidateMapping() {
     static_assert(traits::kIsMappedToClickhouse<T>, "not mapped to clickhouse");
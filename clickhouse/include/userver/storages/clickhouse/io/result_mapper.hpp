@@ -29,9 +29,13 @@ public:
         using ColumnType = std::tuple_element_t<Index, MappedType>;
         static_assert(std::is_same_v<Field, typename ColumnType::container_type>);
 
-        auto column = ColumnType{io::columns::GetWrappedColumn(block_, i)};
-        field.reserve(column.Size());
-        for (auto& it : column) field.push_back(std::move(it));
+        if constexpr (io::columns::kHasBulkDeserialization<ColumnType>) {
+            ColumnType::DeserializeInto(io::columns::GetWrappedColumn(block_, i), field);
+        } else {
+            auto column = ColumnType{io::columns::GetWrappedColumn(block_, i)};
+            field.reserve(column.Size());
+            for (auto& it : column) field.push_back(std::move(it));
+        }
     }
 
 private:
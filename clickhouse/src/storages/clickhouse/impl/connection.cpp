@@ -100,6 +100,33 @@ ExecutionResult Connection::Execute(OptionalCommandControl optional_cc, const Qu
     return ExecutionResult{BlockWrapperPtr{result_ptr.release()}};
 }
 
+void Connection::ExecuteStreaming(
+    OptionalCommandControl optional_cc,
+    const Query& query,
+    const BlockCallback& callback
+) {
+    clickhouse_cpp::Query native_query{query.QueryText()};
+    native_query.OnDataCancelable([]([[maybe_unused]] const auto& block) {
+        // we must return 'true' if we don't want to cancel query
+        return !engine::current_task::ShouldCancel();
+    });
+
+    auto& span = tracing::Span::CurrentSpan();
+    auto scope = span.CreateScopeTime(scopes::kExec);
+
+    native_query.OnData([&callback, &scope](const NativeBlock& data) {
+        scope.Reset(scopes::kExec);
+        // The header block and the trailing ones carry no rows
+        if (data.GetRowCount() == 0) return;
+
+        // Columns are shared, not copied
+        auto block_ptr = std::make_unique<BlockWrapper>(NativeBlock{data});
+        callback(ExecutionResult{BlockWrapperPtr{block_ptr.release()}});
+    });
+
+    DoExecute(optional_cc, native_query);
+}
+
 void Connection::Insert(OptionalCommandControl optional_cc, const InsertionRequest& request) {
     const auto& block = request.GetBlock();
 
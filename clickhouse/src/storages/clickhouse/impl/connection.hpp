@@ -27,6 +27,8 @@ public:
 
     ExecutionResult Execute(OptionalCommandControl, const Query&);
 
+    void ExecuteStreaming(OptionalCommandControl, const Query&, const BlockCallback&);
+
     void Insert(OptionalCommandControl, const InsertionRequest&);
 
     void Ping();
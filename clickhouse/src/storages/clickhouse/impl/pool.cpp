@@ -43,6 +43,17 @@ ExecutionResult Pool::Execute(OptionalCommandControl optional_cc, const Query& q
     return conn_ptr->Execute(optional_cc, query);
 }
 
+void Pool::ExecuteStreaming(OptionalCommandControl optional_cc, const Query& query, const BlockCallback& callback)
+    const {
+    auto conn_ptr = impl_->Acquire();
+
+    auto span = PrepareExecutionSpan(impl::scopes::kQuery, impl_->GetHostName());
+    query.FillSpanTags(span);
+
+    const auto timer = impl_->GetExecuteTimer();
+    conn_ptr->ExecuteStreaming(optional_cc, query, callback);
+}
+
 void Pool::Insert(OptionalCommandControl optional_cc, const InsertionRequest& request) const {
     auto conn_ptr = impl_->Acquire();
 
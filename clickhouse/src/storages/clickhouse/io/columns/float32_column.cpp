@@ -22,6 +22,10 @@ ColumnRef Float32Column::Serialize(const container_type& from) {
     return impl::NumericColumn<Float32Column>::Serialize(from);
 }
 
+void Float32Column::DeserializeInto(const ColumnRef& from, container_type& to) {
+    impl::NumericColumn<Float32Column>::DeserializeInto(from, to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -22,6 +22,10 @@ ColumnRef Float64Column::Serialize(const container_type& from) {
     return impl::NumericColumn<Float64Column>::Serialize(from);
 }
 
+void Float64Column::DeserializeInto(const ColumnRef& from, container_type& to) {
+    impl::NumericColumn<Float64Column>::DeserializeInto(from, to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -17,9 +17,21 @@ template <typename ColumnType>
 struct NumericColumn final {
     using value_type = typename ColumnType::cpp_type;
     using container_type = typename ColumnType::container_type;
+    using NativeType = clickhouse::impl::clickhouse_cpp::ColumnVector<value_type>;
 
     static clickhouse::impl::clickhouse_cpp::ColumnRef Serialize(const container_type& from) {
-        return std::make_shared<clickhouse::impl::clickhouse_cpp::ColumnVector<value_type>>(from);
+        return std::make_shared<NativeType>(from);
+    }
+
+    // The values are stored contiguously, so they are copied at once instead
+    // of an element-wise iteration
+    static void DeserializeInto(const clickhouse::impl::clickhouse_cpp::ColumnRef& from, container_type& to) {
+        const auto typed = GetTypedColumn<ColumnType, NativeType>(from);
+        const auto size = typed->Size();
+        if (size == 0) return;
+
+        const value_type* data = &typed->At(0);
+        to.insert(to.end(), data, data + size);
     }
 };
 
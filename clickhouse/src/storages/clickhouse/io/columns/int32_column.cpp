@@ -21,6 +21,10 @@ ColumnRef Int32Column::Serialize(const container_type& from) {
     return impl::NumericColumn<Int32Column>::Serialize(from);
 }
 
+void Int32Column::DeserializeInto(const ColumnRef& from, container_type& to) {
+    impl::NumericColumn<Int32Column>::DeserializeInto(from, to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
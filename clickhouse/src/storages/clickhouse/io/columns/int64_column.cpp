@@ -21,6 +21,10 @@ ColumnRef Int64Column::Serialize(const container_type& from) {
     return impl::NumericColumn<Int64Column>::Serialize(from);
 }
 
+void Int64Column::DeserializeInto(const ColumnRef& from, container_type& to) {
+    impl::NumericColumn<Int64Column>::DeserializeInto(from, to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
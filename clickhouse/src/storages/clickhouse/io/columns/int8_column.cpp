@@ -19,6 +19,10 @@ Int8Column::cpp_type ColumnIterator<Int8Column>::DataHolder::Get() const {
 
 ColumnRef Int8Column::Serialize(const container_type& from) { return impl::NumericColumn<Int8Column>::Serialize(from); }
 
+void Int8Column::DeserializeInto(const ColumnRef& from, container_type& to) {
+    impl::NumericColumn<Int8Column>::DeserializeInto(from, to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -24,6 +24,22 @@ ColumnRef StringColumn::Serialize(const container_type& from) {
     return std::make_shared<clickhouse::impl::clickhouse_cpp::ColumnString>(from);
 }
 
+StringViewColumn::StringViewColumn(ColumnRef column)
+    : ClickhouseColumn{impl::GetTypedColumn<StringViewColumn, NativeType>(column)} {}
+
+template <>
+StringViewColumn::cpp_type ColumnIterator<StringViewColumn>::DataHolder::Get() const {
+    return impl::NativeGetAt<NativeType>(column_, ind_);
+}
+
+ColumnRef StringViewColumn::Serialize(const container_type& from) {
+    auto column = std::make_shared<NativeType>();
+    for (const auto value : from) {
+        column->Append(value);
+    }
+    return column;
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -22,6 +22,10 @@ ColumnRef UInt16Column::Serialize(const container_type& from) {
     return impl::NumericColumn<UInt16Column>::Serialize(from);
 }
 
+void UInt16Column::DeserializeInto(const ColumnRef& from, container_type& to) {
+    impl::NumericColumn<UInt16Column>::DeserializeInto(from, to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -22,6 +22,10 @@ ColumnRef UInt32Column::Serialize(const container_type& from) {
     return impl::NumericColumn<UInt32Column>::Serialize(from);
 }
 
+void UInt32Column::DeserializeInto(const ColumnRef& from, container_type& to) {
+    impl::NumericColumn<UInt32Column>::DeserializeInto(from, to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -22,6 +22,10 @@ ColumnRef UInt64Column::Serialize(const container_type& from) {
     return impl::NumericColumn<UInt64Column>::Serialize(from);
 }
 
+void UInt64Column::DeserializeInto(const ColumnRef& from, container_type& to) {
+    impl::NumericColumn<UInt64Column>::DeserializeInto(from, to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
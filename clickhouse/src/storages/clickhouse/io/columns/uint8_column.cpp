@@ -21,6 +21,10 @@ ColumnRef UInt8Column::Serialize(const container_type& from) {
     return impl::NumericColumn<UInt8Column>::Serialize(from);
 }
 
+void UInt8Column::DeserializeInto(const ColumnRef& from, container_type& to) {
+    impl::NumericColumn<UInt8Column>::DeserializeInto(from, to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
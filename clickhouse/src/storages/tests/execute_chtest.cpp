@@ -50,6 +50,34 @@ struct CppToClickhouse<RowData> final {
 }  // namespace storages::clickhouse::io
 /// [Sample CppToClickhouse specialization]
 
+namespace {
+
+struct ViewData final {
+    std::vector<uint64_t> numbers;
+    std::vector<std::string_view> strings;
+};
+
+struct ViewRowData final {
+    uint64_t number;
+    std::string_view string;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<ViewData> final {
+    using mapped_type = std::tuple<columns::UInt64Column, columns::StringViewColumn>;
+};
+
+template <>
+struct CppToClickhouse<ViewRowData> final {
+    using mapped_type = std::tuple<columns::UInt64Column, columns::StringViewColumn>;
+};
+
+}  // namespace storages::clickhouse::io
+
 UTEST(Execute, MappingWorks) {
     ClusterWrapper cluster{};
 
@@ -72,6 +100,64 @@ UTEST(Execute, MappingWorks) {
     EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
 }
 
+UTEST(Execute, ViewMappingWorks) {
+    ClusterWrapper cluster{};
+    const storages::clickhouse::Query q{"SELECT c.number, toString(c.number) FROM numbers(0, 10000) c"};
+
+    // Views are valid while the result is alive
+    const auto result = cluster->Execute(q);
+    const auto as_columns = result.As<ViewData>();
+    ASSERT_EQ(as_columns.numbers.size(), 10000);
+    EXPECT_EQ(as_columns.numbers[5001], 5001);
+    EXPECT_EQ(as_columns.strings[5001], "5001");
+
+    uint64_t sum = 0;
+    for (const auto& row : cluster->Execute(q).AsRows<ViewRowData>()) {
+        EXPECT_EQ(row.string, std::to_string(row.number));
+        sum += row.number;
+    }
+    EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
+}
+
+UTEST(Execute, StreamingWorks) {
+    ClusterWrapper cluster{};
+
+    // Small blocks, so that the result is split into many of them
+    const storages::clickhouse::Query q{
+        "SELECT c.number, randomString(10), c.number as t, NOW64(9) "
+        "FROM numbers(0, 10000) c "
+        "SETTINGS max_block_size = 1000"};
+
+    size_t blocks = 0;
+    size_t rows = 0;
+    uint64_t sum = 0;
+    cluster->ExecuteStreaming(q, [&](storages::clickhouse::ExecutionResult&& block) {
+        ++blocks;
+        rows += block.GetRowsCount();
+        for (auto&& data : std::move(block).AsRows<RowData>()) {
+            sum += data.number;
+        }
+    });
+
+    EXPECT_GT(blocks, 1);
+    EXPECT_EQ(rows, 10000);
+    EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
+}
+
+UTEST(Execute, StreamingRethrows) {
+    ClusterWrapper cluster{};
+
+    EXPECT_THROW(
+        cluster->ExecuteStreaming(
+            common_query, [](storages::clickhouse::ExecutionResult&&) { throw std::runtime_error{"stop"}; }
+        ),
+        std::runtime_error
+    );
+
+    // The cluster is still usable
+    EXPECT_EQ(cluster->Execute(common_query).GetRowsCount(), 10000);
+}
+
 namespace {
 namespace io = storages::clickhouse::io;
 
@@ -1,7 +1,10 @@
 #include <userver/utest/utest.hpp>
 
+#include <userver/engine/get_all.hpp>
+#include <userver/storages/clickhouse/batch_inserter.hpp>
 #include <userver/storages/clickhouse/cluster.hpp>
 #include <userver/storages/clickhouse/query.hpp>
+#include <userver/utils/async.hpp>
 
 #include "utils_test.hpp"
 
@@ -27,6 +30,11 @@ struct SomeDataRow final {
     }
 };
 
+struct CountAndSum final {
+    std::vector<uint64_t> counts;
+    std::vector<uint64_t> sums;
+};
+
 struct SomeDataRowWithSleep final {
     uint64_t uint64{};
     std::string str;
@@ -53,6 +61,11 @@ struct CppToClickhouse<SomeDataRow> {
         std::tuple<columns::UInt64Column, columns::StringColumn, columns::UInt64Column, columns::DateTime64ColumnNano>;
 };
 
+template <>
+struct CppToClickhouse<CountAndSum> {
+    using mapped_type = std::tuple<columns::UInt64Column, columns::UInt64Column>;
+};
+
 template <>
 struct CppToClickhouse<SomeDataRowWithSleep> {
     using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn, columns::UInt8Column>;
@@ -137,6 +150,67 @@ UTEST(Insert, AsRowsWorks) {
     EXPECT_EQ(result[1], data[1]);
 }
 
+UTEST(Insert, BatchInserterWorks) {
+    ClusterWrapper cluster{};
+    cluster->Execute(
+        "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table (id UInt64, value "
+        "String, count UInt64, tp DateTime64(9))"
+    );
+
+    constexpr std::size_t kTasks = 8;
+    constexpr std::size_t kRowsPerTask = 1000;
+    {
+        storages::clickhouse::BatchInserterSettings settings;
+        settings.max_batch_rows = 3000;
+        settings.flush_interval = std::chrono::milliseconds{50};
+        // Non-owning, the cluster outlives the inserter
+        const storages::clickhouse::ClusterPtr cluster_ptr{&*cluster, [](auto*) {}};
+        storages::clickhouse::BatchInserter<SomeDataRow> inserter{
+            cluster_ptr, "tmp_table", {"id", "value", "count", "tp"}, settings};
+
+        std::vector<engine::TaskWithResult<void>> tasks;
+        for (std::size_t i = 0; i < kTasks; ++i) {
+            tasks.push_back(utils::Async("insert", [&inserter, i] {
+                for (std::size_t j = 0; j < kRowsPerTask; ++j) {
+                    inserter.Insert({i * kRowsPerTask + j, "value", j, std::chrono::system_clock::now()});
+                }
+            }));
+        }
+        engine::GetAll(tasks);
+    }
+
+    const auto result = cluster->Execute("SELECT count(), sum(id) FROM tmp_table").As<CountAndSum>();
+    ASSERT_EQ(result.counts.size(), 1);
+    EXPECT_EQ(result.counts[0], kTasks * kRowsPerTask);
+    EXPECT_EQ(result.sums[0], kTasks * kRowsPerTask * (kTasks * kRowsPerTask - 1) / 2);
+}
+
+UTEST(Insert, BatchInserterBackpressure) {
+    ClusterWrapper cluster{};
+    cluster->Execute(
+        "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table (id UInt64, value "
+        "String, count UInt64, tp DateTime64(9))"
+    );
+
+    storages::clickhouse::BatchInserterSettings settings;
+    settings.max_batch_rows = 1000;
+    settings.flush_interval = std::chrono::hours{1};
+    settings.max_pending_rows = 10;
+    settings.wait_timeout = std::chrono::milliseconds{10};
+    const storages::clickhouse::ClusterPtr cluster_ptr{&*cluster, [](auto*) {}};
+    storages::clickhouse::BatchInserter<SomeDataRow> inserter{
+        cluster_ptr, "tmp_table", {"id", "value", "count", "tp"}, settings};
+
+    const auto now = std::chrono::system_clock::now();
+    for (std::uint64_t i = 0; i < 10; ++i) {
+        inserter.Insert({i, "value", i, now});
+    }
+    EXPECT_THROW(inserter.Insert({10, "value", 10, now}), storages::clickhouse::BatchInserterOverflowError);
+
+    inserter.Flush();
+    EXPECT_NO_THROW(inserter.Insert({10, "value", 10, now}));
+}
+
 UTEST(Query, AvoidUnexpectedCancellation) {
     ClusterWrapper cluster{};
     cluster->Execute(
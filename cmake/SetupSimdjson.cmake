@@ -0,0 +1,33 @@
+option(USERVER_DOWNLOAD_PACKAGE_SIMDJSON "Download and setup simdjson if no simdjson of matching version was found" ${USERVER_DOWNLOAD_PACKAGES})
+
+set(USERVER_SIMDJSON_VERSION 3.10.1)
+
+if (NOT USERVER_FORCE_DOWNLOAD_PACKAGES)
+  if (USERVER_DOWNLOAD_PACKAGE_SIMDJSON)
+    find_package(simdjson ${USERVER_SIMDJSON_VERSION} QUIET)
+  else()
+    find_package(simdjson ${USERVER_SIMDJSON_VERSION} REQUIRED)
+  endif()
+
+  if (simdjson_FOUND)
+    return()
+  endif()
+endif()
+
+include(DownloadUsingCPM)
+CPMAddPackage(
+  NAME simdjson
+  VERSION ${USERVER_SIMDJSON_VERSION}
+  GITHUB_REPOSITORY simdjson/simdjson
+  OPTIONS
+  "SIMDJSON_DEVELOPER_MODE OFF"
+  "BUILD_SHARED_LIBS OFF"
+)
+
+set(simdjson_FOUND TRUE)
+set(simdjson_VERSION ${USERVER_SIMDJSON_VERSION})
+write_package_stub(simdjson)
+
+if(NOT TARGET simdjson::simdjson)
+  add_library(simdjson::simdjson ALIAS simdjson)
+endif()
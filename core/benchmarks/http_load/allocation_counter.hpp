@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::bench {
+
+/// Number of the global operator new calls made by all the threads of the
+/// process, both by the server and by the load generator
+std::uint64_t GetAllocationsCount() noexcept;
+
+}  // namespace server::bench
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,40 @@
+#include "handlers.hpp"
+
+#include <userver/engine/deadline.hpp>
+#include <userver/server/http/http_response_body_stream.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::bench {
+
+formats::json::Value EchoJsonHandler::HandleRequestJsonThrow(
+    const http::HttpRequest& /*request*/,
+    const formats::json::Value& request_json,
+    request::RequestContext& /*context*/
+) const {
+    return request_json;
+}
+
+// Used if USERVER_HANDLER_STREAM_API_ENABLED is off
+std::string StreamHandler::HandleRequestThrow(
+    const http::HttpRequest& /*request*/,
+    request::RequestContext& /*context*/
+) const {
+    return std::string(kStreamChunksCount * kStreamChunkSize, 'x');
+}
+
+void StreamHandler::HandleStreamRequest(
+    http::HttpRequest& /*request*/,
+    request::RequestContext& /*context*/,
+    http::ResponseBodyStream& stream
+) const {
+    stream.SetStatusCode(http::HttpStatus::kOk);
+    stream.SetEndOfHeaders();
+    for (std::size_t i = 0; i < kStreamChunksCount; ++i) {
+        stream.PushBodyChunk(std::string(kStreamChunkSize, 'x'), engine::Deadline{});
+    }
+}
+
+}  // namespace server::bench
+
+USERVER_NAMESPACE_END
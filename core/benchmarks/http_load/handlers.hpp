@@ -0,0 +1,47 @@
+#pragma once
+
+#include <string>
+
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/handlers/http_handler_json_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::bench {
+
+/// Responds with the request JSON
+class EchoJsonHandler final : public handlers::HttpHandlerJsonBase {
+public:
+    static constexpr std::string_view kName = "handler-echo-json";
+
+    using HttpHandlerJsonBase::HttpHandlerJsonBase;
+
+    formats::json::Value HandleRequestJsonThrow(
+        const http::HttpRequest& request,
+        const formats::json::Value& request_json,
+        request::RequestContext& context
+    ) const override;
+};
+
+/// Streams the response body in kStreamChunksCount chunks
+class StreamHandler final : public handlers::HttpHandlerBase {
+public:
+    static constexpr std::string_view kName = "handler-stream";
+
+    static constexpr std::size_t kStreamChunksCount = 16;
+    static constexpr std::size_t kStreamChunkSize = 256;
+
+    using HttpHandlerBase::HttpHandlerBase;
+
+    std::string HandleRequestThrow(const http::HttpRequest& request, request::RequestContext& context) const override;
+
+    void HandleStreamRequest(
+        http::HttpRequest& request,
+        request::RequestContext& context,
+        http::ResponseBodyStream& stream
+    ) const override;
+};
+
+}  // namespace server::bench
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,145 @@
+// End-to-end throughput benchmark of the HTTP server: runs the server with
+// a few handlers and loads it with pipelined requests from the same process.
+//
+// Example: userver-core-http-load-benchmark --connections 32 --duration 5s
+
+#include <iostream>
+
+#include <boost/program_options.hpp>
+#include <fmt/format.h>
+
+#include <userver/components/minimal_server_component_list.hpp>
+#include <userver/components/run.hpp>
+#include <userver/server/handlers/ping.hpp>
+#include <userver/utils/impl/static_registration.hpp>
+
+#include "handlers.hpp"
+#include "load_generator.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::bench {
+
+namespace {
+
+constexpr std::string_view kStaticConfig = R"(
+components_manager:
+  default_task_processor: main-task-processor
+  event_thread_pool:
+    threads: {event_threads}
+  task_processors:
+    main-task-processor:
+      worker_threads: {server_threads}
+    load-task-processor:
+      thread_name: load-worker
+      worker_threads: {load_threads}
+    fs-task-processor:
+      worker_threads: 1
+  components:
+    logging:
+      fs-task-processor: fs-task-processor
+      loggers:
+        default:
+          file_path: '@null'
+          level: error
+    dynamic-config:
+      defaults:
+        USERVER_HANDLER_STREAM_API_ENABLED: true
+    server:
+      listener:
+        port: {port}
+        task_processor: main-task-processor
+    handler-ping:
+      path: /ping
+      method: GET
+      task_processor: main-task-processor
+      throttling_enabled: false
+    handler-echo-json:
+      path: /echo-json
+      method: POST
+      task_processor: main-task-processor
+      throttling_enabled: false
+    handler-stream:
+      path: /stream
+      method: GET
+      task_processor: main-task-processor
+      throttling_enabled: false
+      response-body-stream: true
+    load-generator:
+      task_processor: load-task-processor
+      port: {port}
+      connections: {connections}
+      pipeline-depth: {pipeline_depth}
+      warmup: {warmup}
+      duration: {duration}
+      scenarios: [{scenarios}]
+)";
+
+}  // namespace
+
+}  // namespace server::bench
+
+USERVER_NAMESPACE_END
+
+int main(int argc, char** argv) {
+    namespace po = boost::program_options;
+    namespace bench = USERVER_NAMESPACE::server::bench;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help,h", "produce this help message")
+        ("port", po::value<std::uint16_t>()->default_value(8098), "server port")
+        ("server-threads", po::value<std::size_t>()->default_value(4), "server task processor threads")
+        ("load-threads", po::value<std::size_t>()->default_value(2), "load generator task processor threads")
+        ("event-threads", po::value<std::size_t>()->default_value(2), "ev threads shared by both")
+        ("connections", po::value<std::size_t>()->default_value(64), "connections to the server")
+        ("pipeline-depth", po::value<std::size_t>()->default_value(16), "requests in flight per connection")
+        ("warmup", po::value<std::string>()->default_value("2s"), "time before the measurement")
+        ("duration", po::value<std::string>()->default_value("10s"), "measurement time for each scenario")
+        ("scenarios", po::value<std::string>()->default_value("ping, echo-json, stream"), "scenarios to run")
+    ;
+    // clang-format on
+
+    po::variables_map vm;
+    try {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        po::notify(vm);
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << '\n';
+        return 1;
+    }
+    if (vm.count("help")) {
+        std::cerr << desc << '\n';
+        return 0;
+    }
+
+    const auto config = fmt::format(
+        bench::kStaticConfig,
+        fmt::arg("port", vm["port"].as<std::uint16_t>()),
+        fmt::arg("server_threads", vm["server-threads"].as<std::size_t>()),
+        fmt::arg("load_threads", vm["load-threads"].as<std::size_t>()),
+        fmt::arg("event_threads", vm["event-threads"].as<std::size_t>()),
+        fmt::arg("connections", vm["connections"].as<std::size_t>()),
+        fmt::arg("pipeline_depth", vm["pipeline-depth"].as<std::size_t>()),
+        fmt::arg("warmup", vm["warmup"].as<std::string>()),
+        fmt::arg("duration", vm["duration"].as<std::string>()),
+        fmt::arg("scenarios", vm["scenarios"].as<std::string>())
+    );
+
+    USERVER_NAMESPACE::utils::impl::FinishStaticRegistration();
+
+    const auto component_list = USERVER_NAMESPACE::components::MinimalServerComponentList()
+                                    .Append<USERVER_NAMESPACE::server::handlers::Ping>()
+                                    .Append<bench::EchoJsonHandler>()
+                                    .Append<bench::StreamHandler>()
+                                    .Append<bench::LoadGenerator>();
+
+    try {
+        USERVER_NAMESPACE::components::Run(USERVER_NAMESPACE::components::InMemoryConfig{config}, component_list);
+    } catch (const std::exception& ex) {
+        std::cerr << "Failed to run the benchmark: " << ex.what() << '\n';
+        return 1;
+    }
+    return bench::LoadGenerator::IsSucceeded() ? 0 : 1;
+}
@@ -0,0 +1,374 @@
+#include "load_generator.hpp"
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/run.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include "allocation_counter.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::bench {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Microseconds, exact up to 2ms and with 100us buckets up to 100ms
+using LatencyPercentile = utils::statistics::Percentile<2000, std::uint32_t, 980, 100>;
+
+constexpr std::chrono::seconds kIoTimeout{10};
+constexpr std::chrono::seconds kServerStartTimeout{30};
+constexpr std::size_t kInitialBufferSize = 64 * 1024;
+
+constexpr std::string_view kJsonBody =
+    R"({"id":12345,"name":"benchmark","tags":["a","b","c"],"nested":{"enabled":true,"ratio":0.5}})";
+
+std::atomic<bool> is_succeeded{true};
+
+std::string MakeRequest(std::string_view scenario) {
+    if (scenario == "ping") {
+        return "GET /ping HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    } else if (scenario == "echo-json") {
+        return fmt::format(
+            "POST /echo-json HTTP/1.1\r\nHost: localhost\r\nContent-Type: application/json\r\n"
+            "Content-Length: {}\r\n\r\n{}",
+            kJsonBody.size(),
+            kJsonBody
+        );
+    } else if (scenario == "stream") {
+        return "GET /stream HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    }
+    throw std::runtime_error(fmt::format("Unknown load-generator scenario '{}'", scenario));
+}
+
+std::size_t ParseSize(std::string_view value, int base) {
+    std::size_t result = 0;
+    if (value.empty()) throw std::runtime_error("Empty size in the HTTP response");
+    for (const char c : value) {
+        int digit = 0;
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
+        } else if (base == 16 && c >= 'a' && c <= 'f') {
+            digit = c - 'a' + 10;
+        } else if (base == 16 && c >= 'A' && c <= 'F') {
+            digit = c - 'A' + 10;
+        } else {
+            throw std::runtime_error(fmt::format("Invalid size '{}' in the HTTP response", value));
+        }
+        result = result * base + digit;
+    }
+    return result;
+}
+
+// Returns the size of the chunked body at the beginning of data, 0 if it is
+// not received completely yet
+std::size_t GetChunkedBodySize(std::string_view data) {
+    std::size_t pos = 0;
+    while (true) {
+        const auto line_end = data.find("\r\n", pos);
+        if (line_end == std::string_view::npos) return 0;
+
+        auto size_str = data.substr(pos, line_end - pos);
+        size_str = size_str.substr(0, size_str.find(';'));
+        const auto chunk_size = ParseSize(size_str, 16);
+
+        // The chunk data and its CRLF, or the empty trailer of the last chunk
+        pos = line_end + 2 + chunk_size + 2;
+        if (pos > data.size()) return 0;
+        if (chunk_size == 0) return pos;
+    }
+}
+
+// Returns the size of the HTTP response at the beginning of data, 0 if it is
+// not received completely yet
+std::size_t GetResponseSize(std::string_view data) {
+    const auto headers_end = data.find("\r\n\r\n");
+    if (headers_end == std::string_view::npos) return 0;
+
+    const auto status_line = data.substr(0, data.find("\r\n"));
+    if (status_line.substr(0, 13) != "HTTP/1.1 200 ") {
+        throw std::runtime_error(fmt::format("Unexpected HTTP response '{}'", status_line));
+    }
+
+    const auto body_begin = headers_end + 4;
+    auto pos = status_line.size() + 2;
+    while (pos < headers_end) {
+        const auto line_end = data.find("\r\n", pos);
+        const auto line = data.substr(pos, line_end - pos);
+        pos = line_end + 2;
+
+        const auto colon = line.find(':');
+        if (colon == std::string_view::npos) continue;
+        const auto name = line.substr(0, colon);
+        auto value = line.substr(colon + 1);
+        value.remove_prefix(std::min(value.find_first_not_of(' '), value.size()));
+
+        if (utils::StrIcaseEqual{}(name, "Content-Length")) {
+            const auto size = body_begin + ParseSize(value, 10);
+            return size <= data.size() ? size : 0;
+        }
+        if (utils::StrIcaseEqual{}(name, "Transfer-Encoding") && utils::StrIcaseEqual{}(value, "chunked")) {
+            const auto body_size = GetChunkedBodySize(data.substr(body_begin));
+            return body_size == 0 ? 0 : body_begin + body_size;
+        }
+    }
+    return body_begin;
+}
+
+struct ConnectionStats final {
+    std::uint64_t requests{0};
+    LatencyPercentile latencies;
+};
+
+engine::io::Sockaddr MakeServerAddress(std::uint16_t port) {
+    auto address = engine::io::Sockaddr::MakeIPv4LoopbackAddress();
+    address.SetPort(port);
+    return address;
+}
+
+engine::io::Socket Connect(const engine::io::Sockaddr& address) {
+    engine::io::Socket socket{address.Domain(), engine::io::SocketType::kStream};
+    socket.Connect(address, engine::Deadline::FromDuration(kIoTimeout));
+    socket.SetOption(IPPROTO_TCP, TCP_NODELAY, 1);
+    return socket;
+}
+
+void WaitForServer(const engine::io::Sockaddr& address) {
+    const auto deadline = engine::Deadline::FromDuration(kServerStartTimeout);
+    while (true) {
+        try {
+            Connect(address).Close();
+            return;
+        } catch (const std::exception&) {
+            if (deadline.IsReached()) throw;
+        }
+        engine::SleepFor(std::chrono::milliseconds{10});
+    }
+}
+
+// Keeps `depth` requests in flight until `stop_at`, then waits for the
+// remaining responses. Does not allocate after the start.
+void RunConnection(
+    const engine::io::Sockaddr& address,
+    const std::string& request,
+    std::size_t depth,
+    Clock::time_point measure_from,
+    Clock::time_point stop_at,
+    ConnectionStats& stats
+) {
+    auto socket = Connect(address);
+
+    std::string requests_batch;
+    requests_batch.reserve(request.size() * depth);
+    for (std::size_t i = 0; i < depth; ++i) requests_batch += request;
+
+    // Send times of the requests in flight, the oldest one is at `oldest`
+    std::vector<Clock::time_point> sent_at(depth);
+    std::size_t oldest = 0;
+    std::size_t in_flight = 0;
+
+    const auto send = [&](std::size_t count) {
+        const auto now = Clock::now();
+        for (std::size_t i = 0; i < count; ++i) {
+            sent_at[(oldest + in_flight + i) % depth] = now;
+        }
+        in_flight += count;
+
+        const auto size = count * request.size();
+        const auto sent = socket.SendAll(requests_batch.data(), size, engine::Deadline::FromDuration(kIoTimeout));
+        if (sent != size) throw std::runtime_error("Failed to send the requests");
+    };
+
+    std::vector<char> buffer(kInitialBufferSize);
+    std::size_t filled = 0;
+
+    send(depth);
+    while (in_flight != 0) {
+        if (filled == buffer.size()) buffer.resize(buffer.size() * 2);
+        const auto received =
+            socket.RecvSome(buffer.data() + filled, buffer.size() - filled, engine::Deadline::FromDuration(kIoTimeout));
+        if (received == 0) throw std::runtime_error("The server has closed the connection");
+        filled += received;
+
+        const auto now = Clock::now();
+        std::size_t parsed = 0;
+        std::size_t completed = 0;
+        while (in_flight != 0) {
+            const auto size = GetResponseSize({buffer.data() + parsed, filled - parsed});
+            if (size == 0) break;
+            parsed += size;
+
+            if (now >= measure_from && now < stop_at) {
+                const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(now - sent_at[oldest]);
+                stats.latencies.Account(latency.count());
+                ++stats.requests;
+            }
+            oldest = (oldest + 1) % depth;
+            --in_flight;
+            ++completed;
+        }
+
+        std::memmove(buffer.data(), buffer.data() + parsed, filled - parsed);
+        filled -= parsed;
+        if (completed != 0 && now < stop_at) send(completed);
+    }
+}
+
+}  // namespace
+
+LoadGenerator::LoadGenerator(const components::ComponentConfig& config, const components::ComponentContext& context)
+    : ComponentBase(config, context),
+      task_processor_(context.GetTaskProcessor(config["task_processor"].As<std::string>())),
+      port_(config["port"].As<std::uint16_t>()),
+      connections_(config["connections"].As<std::size_t>(64)),
+      pipeline_depth_(config["pipeline-depth"].As<std::size_t>(16)),
+      warmup_(config["warmup"].As<std::chrono::milliseconds>(std::chrono::seconds{2})),
+      duration_(config["duration"].As<std::chrono::milliseconds>(std::chrono::seconds{10})) {
+    UINVARIANT(connections_ > 0 && pipeline_depth_ > 0, "connections and pipeline-depth should be positive");
+    for (const auto& name : config["scenarios"].As<std::vector<std::string>>()) {
+        scenarios_.push_back({name, MakeRequest(name)});
+    }
+}
+
+LoadGenerator::~LoadGenerator() {
+    if (task_.IsValid()) task_.SyncCancel();
+}
+
+bool LoadGenerator::IsSucceeded() noexcept { return is_succeeded.load(); }
+
+void LoadGenerator::OnAllComponentsLoaded() {
+    task_ = engine::CriticalAsyncNoSpan(task_processor_, [this] {
+        try {
+            Run();
+        } catch (const std::exception& e) {
+            LOG_ERROR() << "Load generation failed: " << e;
+            fmt::print(stderr, "Load generation failed: {}\n", e.what());
+            is_succeeded = false;
+        }
+        components::RequestStop();
+    });
+}
+
+void LoadGenerator::Run() const {
+    WaitForServer(MakeServerAddress(port_));
+
+    fmt::print(
+        "connections={} pipeline-depth={} warmup={}ms duration={}ms\n",
+        connections_,
+        pipeline_depth_,
+        warmup_.count(),
+        duration_.count()
+    );
+    for (const auto& scenario : scenarios_) {
+        RunScenario(scenario);
+    }
+}
+
+void LoadGenerator::RunScenario(const Scenario& scenario) const {
+    const auto address = MakeServerAddress(port_);
+    const auto measure_from = Clock::now() + warmup_;
+    const auto stop_at = measure_from + duration_;
+
+    std::vector<ConnectionStats> stats(connections_);
+    auto tasks = utils::GenerateFixedArray(connections_, [&](std::size_t i) {
+        return engine::AsyncNoSpan(task_processor_, [&, i] {
+            RunConnection(address, scenario.request, pipeline_depth_, measure_from, stop_at, stats[i]);
+        });
+    });
+
+    engine::SleepUntil(measure_from);
+    const auto allocations_before = GetAllocationsCount();
+    engine::SleepUntil(stop_at);
+    const auto allocations = GetAllocationsCount() - allocations_before;
+    engine::GetAll(tasks);
+
+    std::uint64_t requests = 0;
+    LatencyPercentile latencies;
+    for (const auto& connection_stats : stats) {
+        requests += connection_stats.requests;
+        latencies.Add(connection_stats.latencies);
+    }
+    if (requests == 0) throw std::runtime_error(fmt::format("No responses in the '{}' scenario", scenario.name));
+
+    const auto seconds = std::chrono::duration<double>(duration_).count();
+    fmt::print(
+        "{}: rps={:.0f} p50={}us p90={}us p99={}us p99.9={}us allocs_per_request={:.1f}\n",
+        scenario.name,
+        static_cast<double>(requests) / seconds,
+        latencies.GetPercentile(50),
+        latencies.GetPercentile(90),
+        latencies.GetPercentile(99),
+        latencies.GetPercentile(99.9),
+        static_cast<double>(allocations) / static_cast<double>(requests)
+    );
+    std::fflush(stdout);
+}
+
+yaml_config::Schema LoadGenerator::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<components::ComponentBase>(R"(
+type: object
+description: pipelined HTTP/1.1 load generator for the in-process server
+additionalProperties: false
+properties:
+    task_processor:
+        type: string
+        description: task processor to run the load generation on
+    port:
+        type: integer
+        description: port of the server listener
+    connections:
+        type: integer
+        description: number of the connections to open
+        defaultDescription: 64
+        minimum: 1
+    pipeline-depth:
+        type: integer
+        description: number of the requests in flight on each connection
+        defaultDescription: 16
+        minimum: 1
+    warmup:
+        type: string
+        description: time to load the server before accounting the responses
+        defaultDescription: 2s
+    duration:
+        type: string
+        description: time to account the responses for
+        defaultDescription: 10s
+    scenarios:
+        type: array
+        description: scenarios to run one after another
+        items:
+            type: string
+            description: scenario name
+            enum:
+              - ping
+              - echo-json
+              - stream
+)");
+}
+
+}  // namespace server::bench
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <userver/components/component_base.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/yaml_config/schema.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+class TaskProcessor;
+}
+
+namespace server::bench {
+
+/// @brief Drives the in-process server with pipelined HTTP/1.1 requests
+/// once all the components are loaded, prints the results to stdout and
+/// stops the service.
+///
+/// Each scenario runs for `warmup` and then for `duration`, only the
+/// responses received during the latter are accounted.
+class LoadGenerator final : public components::ComponentBase {
+public:
+    static constexpr std::string_view kName = "load-generator";
+
+    LoadGenerator(const components::ComponentConfig& config, const components::ComponentContext& context);
+    ~LoadGenerator() override;
+
+    /// @returns false if some of the requests have failed
+    static bool IsSucceeded() noexcept;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    struct Scenario {
+        std::string name;
+        std::string request;
+    };
+
+    void OnAllComponentsLoaded() override;
+
+    void Run() const;
+    void RunScenario(const Scenario& scenario) const;
+
+    engine::TaskProcessor& task_processor_;
+    const std::uint16_t port_;
+    const std::size_t connections_;
+    const std::size_t pipeline_depth_;
+    const std::chrono::milliseconds warmup_;
+    const std::chrono::milliseconds duration_;
+    std::vector<Scenario> scenarios_;
+    engine::TaskWithResult<void> task_;
+};
+
+}  // namespace server::bench
+
+template <>
+inline constexpr bool components::kHasValidate<server::bench::LoadGenerator> = true;
+
+USERVER_NAMESPACE_END
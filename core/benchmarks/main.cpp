@@ -3,12 +3,16 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/impl/static_registration.hpp>
 
+#include <utils/gbench_perf_counters.hpp>
+
 int main(int argc, char** argv) {
     USERVER_NAMESPACE::utils::impl::FinishStaticRegistration();
 
     const USERVER_NAMESPACE::logging::DefaultLoggerLevelScope level_scope{USERVER_NAMESPACE::logging::Level::kError};
 
+    const bool perf_counters_enabled = gbench_perf_counters::ConsumeFlag(argc, argv);
+
     ::benchmark::Initialize(&argc, argv);
     if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
-    ::benchmark::RunSpecifiedBenchmarks();
+    gbench_perf_counters::RunSpecifiedBenchmarks(perf_counters_enabled);
 }
@@ -4,6 +4,9 @@
 /// @brief @copybrief baggage::Baggage
 
 #include <algorithm>  // TODO: remove
+#include <initializer_list>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -22,6 +25,26 @@ using BaggageProperties = std::vector<std::pair<std::string, std::optional<std::
 class Baggage;
 class BaggageEntryProperty;
 
+/// @brief Prebuilt set of the keys that are allowed in the Baggage header.
+///
+/// Copies share the same set, so it is built once per config update instead
+/// of being copied to each request's baggage::Baggage.
+class AllowedKeys final {
+public:
+    AllowedKeys();
+    AllowedKeys(std::unordered_set<std::string> keys);
+    AllowedKeys(std::initializer_list<std::string> keys);
+
+    /// @brief Checks the key without allocating
+    bool Contains(std::string_view key) const noexcept;
+
+    std::unordered_set<std::string> GetKeys() const;
+
+private:
+    struct Impl;
+    std::shared_ptr<const Impl> impl_;
+};
+
 /// @brief Baggage base exception
 class BaggageException : public std::runtime_error {
 public:
@@ -32,6 +55,7 @@ public:
 /// Keys shouldn't contain '=', ';' and ','. Values shouldn't contains
 /// ',' and ';'
 class BaggageEntryProperty {
+    friend class Baggage;
     friend class BaggageEntry;
 
 public:
@@ -82,13 +106,18 @@ private:
 /// https://w3c.github.io/baggage/
 ///
 /// @see baggage::BaggageManagerComponent
+///
+/// The header is parsed on the first access to its entries or to ToString().
+/// The resulting header is kept, so the outgoing requests reuse it as is
+/// until the baggage is changed.
 class Baggage {
 public:
-    Baggage(std::string header, std::unordered_set<std::string> allowed_keys);
+    Baggage(std::string header, AllowedKeys allowed_keys);
     Baggage(const Baggage&) noexcept;
     Baggage(Baggage&&) noexcept;
 
-    std::string ToString() const;
+    /// @return the header with the allowed entries only
+    const std::string& ToString() const;
 
     /// @return vector of entries
     const std::vector<BaggageEntry>& GetEntries() const;
@@ -112,6 +141,9 @@ public:
     /// @brief get baggage allowed keys
     std::unordered_set<std::string> GetAllowedKeys() const;
 
+    /// @brief get baggage allowed keys without copying them
+    const AllowedKeys& GetPrebuiltAllowedKeys() const noexcept;
+
 protected:
     /// @brief parsers
     /// @returns std::nullopt If key, value or properties
@@ -121,26 +153,41 @@ protected:
     static std::optional<BaggageEntryProperty> TryMakeBaggageEntryProperty(std::string_view property);
 
 private:
+    std::optional<BaggageEntry> DoTryMakeBaggageEntry(std::string_view entry) const;
+
+    /// @brief Parse header_value_ once
+    void EnsureParsed() const;
+
     /// @brief Parse baggage_header and fill entries_
-    void FillEntries();
+    void FillEntries() const;
 
     /// @brief Create result_header
-    void CreateResultHeader();
+    void CreateResultHeader() const;
+
+    /// @brief Copy of the other baggage's entries pointing to header_value_,
+    /// the other baggage's header was at old_header_data
+    std::vector<BaggageEntry>
+    RebaseEntries(const std::vector<BaggageEntry>& other_entries, const char* old_header_data) const;
 
-    std::string header_value_;
-    std::unordered_set<std::string> allowed_keys_;
-    std::vector<BaggageEntry> entries_;
+    AllowedKeys allowed_keys_;
+    mutable std::once_flag parse_once_;
+
+    mutable std::string header_value_;
+    mutable std::vector<BaggageEntry> entries_;
 
     // result header after parsing entities.
     // empty string if is_valid_header == true
-    std::string result_header_;
+    mutable std::string result_header_;
 
     // true if requested header == header for sending
-    bool is_valid_header_ = true;
+    mutable bool is_valid_header_ = true;
+
+    // set under parse_once_, read only with an exclusive access
+    mutable bool is_parsed_ = false;
 };
 
 /// @brief Parsing function
-std::optional<Baggage> TryMakeBaggage(std::string header, std::unordered_set<std::string> allowed_keys);
+std::optional<Baggage> TryMakeBaggage(std::string header, AllowedKeys allowed_keys);
 
 template <typename T>
 bool HasInvalidSymbols(const T& obj) {
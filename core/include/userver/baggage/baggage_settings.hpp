@@ -1,8 +1,6 @@
 #pragma once
 
-#include <string>
-#include <unordered_set>
-
+#include <userver/baggage/baggage.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/formats/json_fwd.hpp>
 
@@ -11,7 +9,7 @@ USERVER_NAMESPACE_BEGIN
 namespace baggage {
 
 struct BaggageSettings final {
-    std::unordered_set<std::string> allowed_keys;
+    AllowedKeys allowed_keys;
 };
 
 BaggageSettings Parse(const formats::json::Value& value, formats::parse::To<BaggageSettings>);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -72,6 +73,8 @@ struct Config final {
     bool is_strong_period{};
     std::optional<std::uint64_t> failed_updates_before_expiration;
     bool is_safe_data_lifetime{};
+    bool estimate_memory_usage{};
+    std::size_t update_db_connections{};
 
     FirstUpdateMode first_update_mode{};
     FirstUpdateType first_update_type{};
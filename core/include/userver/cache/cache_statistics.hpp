@@ -37,6 +37,8 @@ struct Statistics final {
     UpdateStatistics full_update;
     UpdateStatistics incremental_update;
     std::atomic<std::size_t> documents_current_count{0};
+    // Zero if the memory usage is not estimated
+    std::atomic<std::size_t> memory_usage_bytes{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats);
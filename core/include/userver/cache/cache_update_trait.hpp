@@ -3,7 +3,9 @@
 /// @file userver/cache/cache_update_trait.hpp
 /// @brief @copybrief cache::CacheUpdateTrait
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include <userver/cache/cache_statistics.hpp>
@@ -152,6 +154,9 @@ private:
 
     virtual void ReadAndSet(dump::Reader& reader);
 
+    // Returns std::nullopt if the data type does not support the estimation
+    virtual std::optional<std::size_t> EstimateMemoryUsage() const;
+
     class Impl;
     std::unique_ptr<Impl> impl_;
 };
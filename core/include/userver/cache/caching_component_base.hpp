@@ -3,7 +3,9 @@
 /// @file userver/cache/caching_component_base.hpp
 /// @brief @copybrief components::CachingComponentBase
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -11,6 +13,7 @@
 
 #include <userver/cache/cache_update_trait.hpp>
 #include <userver/cache/exceptions.hpp>
+#include <userver/cache/memory_usage.hpp>
 #include <userver/compiler/demangle.hpp>
 #include <userver/components/component_base.hpp>
 #include <userver/components/component_fwd.hpp>
@@ -73,6 +76,8 @@ namespace components {
 /// has-pre-assign-check | enables the check before changing the value in the cache, by default it is the check that the new value is not empty | false
 /// alert-on-failing-to-update-times | fire an alert if the cache update failed specified amount of times in a row. If zero - alerts are disabled. Value from dynamic config takes priority over static | 0
 /// safe-data-lifetime | enables awaiting data destructors in the component's destructor. Can be set to `false` if the stored data does not refer to the component and its dependencies. | true
+/// estimate-memory-usage | estimate the memory usage of the data after each update that changed it, see @ref cache_memory_usage "below" | false
+/// update-db-connections | the number of database connections used by an update, limited by components::CacheUpdateScheduler | 0
 /// dump.* | Manages cache behavior after dump load | -
 /// dump.first-update-mode | Behavior of update after successful load from dump. See info on modes below | skip
 /// dump.first-update-type | Update type after successful load from dump (`full`, `incremental` or `incremental-then-async-full`) | full
@@ -101,6 +106,31 @@ namespace components {
 ///
 /// full-update-interval = (size-of-database * 20% / removal-rate) = 400s
 ///
+/// ### Cheap incremental updates
+///
+/// An incremental update usually copies the current data and patches the copy,
+/// which takes O(size) time and memory for each update. With
+/// utils::PersistentHashMap as the data (or as its biggest member) the copy is
+/// O(1) and each change costs O(log(size)), the snapshots share the unchanged
+/// entries:
+///
+/// @code
+/// auto data = *GetUnsafe();  // O(1)
+/// for (auto& [key, value] : changes) data.insert_or_assign(std::move(key), std::move(value));
+/// Set(std::move(data));
+/// @endcode
+///
+/// @anchor cache_memory_usage
+/// ### Memory usage of the data
+///
+/// With `estimate-memory-usage: true` the deep memory footprint of the data is
+/// estimated by cache::MemoryEstimator after each update that changed the data
+/// and is reported in the `memory-usage-bytes` metric of the cache. The type
+/// of the data should satisfy cache::kIsMemoryEstimable, otherwise the option
+/// is ignored with a warning in the logs. The estimation runs in the update
+/// task and walks the whole data, so enable it with care for the caches with
+/// frequent incremental updates of big data.
+///
 /// ### Dealing with nullptr data in CachingComponentBase
 ///
 /// The cache can become `nullptr` through multiple ways:
@@ -223,6 +253,8 @@ private:
     void GetAndWrite(dump::Writer& writer) const final;
     void ReadAndSet(dump::Reader& reader) final;
 
+    std::optional<std::size_t> EstimateMemoryUsage() const final;
+
     std::shared_ptr<const T> TransformNewValue(std::unique_ptr<const T> new_value);
 
     rcu::Variable<std::shared_ptr<const T>> cache_;
@@ -335,6 +367,16 @@ void CachingComponentBase<T>::ReadAndSet(dump::Reader& reader) {
     Set(std::move(data));
 }
 
+template <typename T>
+std::optional<std::size_t> CachingComponentBase<T>::EstimateMemoryUsage() const {
+    if constexpr (cache::kIsMemoryEstimable<T>) {
+        const auto contents = GetUnsafe();
+        return contents ? cache::EstimateMemoryUsage(*contents) : 0;
+    } else {
+        return std::nullopt;
+    }
+}
+
 template <typename T>
 void CachingComponentBase<T>::WriteContents(dump::Writer& writer, const T& contents) const {
     if constexpr (dump::kIsDumpable<T>) {
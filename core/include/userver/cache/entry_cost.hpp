@@ -0,0 +1,31 @@
+#pragma once
+
+/// @file userver/cache/entry_cost.hpp
+/// @brief @copybrief cache::EntryCost
+
+#include <cstddef>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @brief Memory cost of a cache entry in bytes, used by the caches with
+/// the `max-bytes` budget, see cache::NWayLRU::UpdateWayMaxBytes.
+///
+/// The default accounts only for the sizes of the types. Specialize it for
+/// the values that own dynamic memory:
+///
+/// @snippet cache/nway_lru_cache_test.cpp Sample EntryCost
+///
+/// The cost must stay the same for the same entry, it is computed again when
+/// the entry is removed.
+template <typename Key, typename Value>
+struct EntryCost final {
+    std::size_t operator()(const Key& /*key*/, const Value& /*value*/) const noexcept {
+        return sizeof(Key) + sizeof(Value);
+    }
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
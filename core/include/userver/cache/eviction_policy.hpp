@@ -0,0 +1,35 @@
+#pragma once
+
+/// @file userver/cache/eviction_policy.hpp
+/// @brief @copybrief cache::EvictionPolicy
+
+#include <string_view>
+
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// Eviction policy of the cache::NWayLRU ways
+enum class EvictionPolicy {
+    /// Exact LRU, each hit moves the entry to the head of the LRU list, so
+    /// the hits on a way are serialized by its mutex
+    kLru,
+    /// CLOCK approximation of LRU, a hit only marks the entry as referenced,
+    /// so the hits on a way take a shared lock and do not wait for each other
+    kClock,
+    /// W-TinyLFU, admits the new entries to the main part of the way only if
+    /// they are requested more frequently than the entries they evict, which
+    /// keeps the keys that are requested once (e.g. by scans) from flushing
+    /// the popular ones
+    kTinyLfu,
+};
+
+EvictionPolicy Parse(const yaml_config::YamlConfig& value, formats::parse::To<EvictionPolicy>);
+
+std::string_view ToString(EvictionPolicy eviction_policy);
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
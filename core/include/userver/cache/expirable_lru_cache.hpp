@@ -7,6 +7,7 @@
 #include <chrono>
 #include <optional>
 
+#include <userver/cache/entry_cost.hpp>
 #include <userver/cache/lru_cache_config.hpp>
 #include <userver/cache/lru_cache_statistics.hpp>
 #include <userver/cache/nway_lru_cache.hpp>
@@ -47,6 +48,13 @@ impl::ExpirableValue<Value> Read(dump::Reader& reader, dump::To<impl::ExpirableV
 
 }  // namespace impl
 
+template <typename Key, typename Value>
+struct EntryCost<Key, impl::ExpirableValue<Value>> final {
+    std::size_t operator()(const Key& key, const impl::ExpirableValue<Value>& value) const {
+        return EntryCost<Key, Value>{}(key, value.value) + sizeof(value.update_time);
+    }
+};
+
 /// @ingroup userver_containers
 /// @brief Class for expirable LRU cache. Use cache::LruMap for not expirable
 /// LRU Cache.
@@ -69,12 +77,29 @@ public:
     /// see the cache::NWayLRU::NWayLRU constructor.
     ExpirableLruCache(size_t ways, size_t way_size, const Hash& hash = Hash(), const Equal& equal = Equal());
 
+    /// For the description of `eviction_policy`,
+    /// see the cache::NWayLRU::NWayLRU constructor.
+    ExpirableLruCache(
+        size_t ways,
+        size_t way_size,
+        EvictionPolicy eviction_policy,
+        const Hash& hash = Hash(),
+        const Equal& equal = Equal()
+    );
+
     ~ExpirableLruCache();
 
     /// For the description of `way_size`,
     /// see the cache::NWayLRU::NWayLRU constructor.
     void SetWaySize(size_t way_size);
 
+    /// For the description of `way_max_bytes`,
+    /// see cache::NWayLRU::UpdateWayMaxBytes.
+    void SetWayMaxBytes(size_t way_max_bytes);
+
+    /// @returns 0 if the cache is not bounded by bytes
+    size_t GetWayMaxBytes() const noexcept;
+
     std::chrono::milliseconds GetMaxLifetime() const noexcept;
 
     void SetMaxLifetime(std::chrono::milliseconds max_lifetime);
@@ -128,6 +153,10 @@ public:
 
     size_t GetSizeApproximate() const;
 
+    /// @returns the sum of cache::EntryCost of the entries, or 0 if the cache
+    /// is not bounded by bytes
+    size_t GetBytesApproximate() const;
+
     /// Clear cache
     void Invalidate();
 
@@ -156,6 +185,7 @@ private:
         const;
 
     cache::NWayLRU<Key, impl::ExpirableValue<Value>, Hash, Equal> lru_;
+    std::atomic<size_t> way_max_bytes_{0};
     std::atomic<std::chrono::milliseconds> max_lifetime_{std::chrono::milliseconds(0)};
     std::atomic<BackgroundUpdateMode> background_update_mode_{BackgroundUpdateMode::kDisabled};
     impl::ExpirableLruCacheStatistics stats_;
@@ -170,7 +200,17 @@ ExpirableLruCache<Key, Value, Hash, Equal>::ExpirableLruCache(
     const Hash& hash,
     const Equal& equal
 )
-    : lru_(ways, way_size, hash, equal), mutex_set_{ways, way_size, hash, equal} {}
+    : ExpirableLruCache(ways, way_size, EvictionPolicy::kLru, hash, equal) {}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+ExpirableLruCache<Key, Value, Hash, Equal>::ExpirableLruCache(
+    size_t ways,
+    size_t way_size,
+    EvictionPolicy eviction_policy,
+    const Hash& hash,
+    const Equal& equal
+)
+    : lru_(ways, way_size, eviction_policy, hash, equal), mutex_set_{ways, way_size, hash, equal} {}
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 ExpirableLruCache<Key, Value, Hash, Equal>::~ExpirableLruCache() {
@@ -182,6 +222,17 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetWaySize(size_t way_size) {
     lru_.UpdateWaySize(way_size);
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetWayMaxBytes(size_t way_max_bytes) {
+    lru_.UpdateWayMaxBytes(way_max_bytes);
+    way_max_bytes_ = way_max_bytes;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetWayMaxBytes() const noexcept {
+    return way_max_bytes_.load();
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 std::chrono::milliseconds ExpirableLruCache<Key, Value, Hash, Equal>::GetMaxLifetime() const noexcept {
     return max_lifetime_.load();
@@ -323,6 +374,11 @@ size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetSizeApproximate() const {
     return lru_.GetSize();
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetBytesApproximate() const {
+    return lru_.GetBytes();
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::Invalidate() {
     lru_.Invalidate();
@@ -440,7 +496,9 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetDumper(std::shared_ptr<dump:
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 void DumpMetric(utils::statistics::Writer& writer, const ExpirableLruCache<Key, Value, Hash, Equal>& cache) {
-    writer["current-documents-count"] = cache.GetSizeApproximate();
+    std::optional<std::size_t> bytes;
+    if (cache.GetWayMaxBytes()) bytes = cache.GetBytesApproximate();
+    writer = impl::ExpirableLruCacheSize{cache.GetSizeApproximate(), bytes};
     writer = cache.GetStatistics();
 }
 
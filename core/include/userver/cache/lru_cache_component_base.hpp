@@ -57,7 +57,9 @@ yaml_config::Schema GetLruCacheComponentBaseSchema();
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// size | max amount of items to store in cache | --
+/// max-bytes | max sum of cache::EntryCost of the items, requires `eviction-policy: lru` (0 is unlimited) | 0
 /// ways | number of ways for associative cache | --
+/// eviction-policy | `lru`, `clock` or `tiny-lfu`, see cache::EvictionPolicy | lru
 /// lifetime | TTL for cache entries (0 is unlimited) | 0
 /// background-update | enables asynchronous updates for expiring values | false
 /// config-settings | enables dynamic reconfiguration with CacheConfigSet | true
@@ -127,7 +129,13 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
     : ComponentBase(config, context),
       name_(components::GetCurrentComponentName(config)),
       static_config_(config),
-      cache_(std::make_shared<Cache>(static_config_.ways, static_config_.GetWaySize())) {
+      cache_(std::make_shared<Cache>(
+          static_config_.ways,
+          static_config_.GetWaySize(),
+          static_config_.eviction_policy
+      )) {
+    cache_->SetWayMaxBytes(static_config_.config.GetWayMaxBytes(static_config_.ways));
+
     if (impl::IsDumpSupportEnabled(config)) {
         dumper_ = std::make_shared<dump::Dumper>(config, context, static_cast<dump::DumpableEntity&>(*this));
         cache_->SetDumper(dumper_);
@@ -198,6 +206,11 @@ void LruCacheComponent<Key, Value, Hash, Equal>::OnConfigUpdate(const dynamic_co
 template <typename Key, typename Value, typename Hash, typename Equal>
 void LruCacheComponent<Key, Value, Hash, Equal>::UpdateConfig(const LruCacheConfig& config) {
     cache_->SetWaySize(config.GetWaySize(static_config_.ways));
+    if (static_config_.eviction_policy == EvictionPolicy::kLru) {
+        cache_->SetWayMaxBytes(config.GetWayMaxBytes(static_config_.ways));
+    } else if (config.max_bytes) {
+        LOG_WARNING() << "max-bytes of LRU cache " << name_ << " is ignored, it requires eviction-policy 'lru'";
+    }
     cache_->SetMaxLifetime(config.lifetime);
     cache_->SetBackgroundUpdate(config.background_update);
 }
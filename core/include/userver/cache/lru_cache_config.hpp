@@ -5,6 +5,7 @@
 #include <optional>
 #include <unordered_map>
 
+#include <userver/cache/eviction_policy.hpp>
 #include <userver/components/component_fwd.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/formats/json_fwd.hpp>
@@ -27,7 +28,12 @@ struct LruCacheConfig final {
 
     std::size_t GetWaySize(std::size_t ways) const;
 
+    /// @returns 0 if the cache is not bounded by bytes
+    std::size_t GetWayMaxBytes(std::size_t ways) const;
+
     std::size_t size;
+    /// Bound on the sum of cache::EntryCost of the entries, 0 is unlimited
+    std::size_t max_bytes;
     std::chrono::milliseconds lifetime;
     BackgroundUpdateMode background_update;
 };
@@ -42,6 +48,7 @@ struct LruCacheConfigStatic final {
 
     LruCacheConfig config;
     std::size_t ways;
+    EvictionPolicy eviction_policy;
     bool use_dynamic_config;
 };
 
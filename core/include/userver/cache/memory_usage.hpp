@@ -0,0 +1,263 @@
+#pragma once
+
+/// @file userver/cache/memory_usage.hpp
+/// @brief @copybrief cache::MemoryEstimator
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <userver/utils/meta_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+class MemoryEstimator;
+
+namespace impl {
+
+template <typename T>
+using EstimateDynamicMemoryResult =
+    decltype(EstimateDynamicMemory(std::declval<MemoryEstimator&>(), std::declval<const T&>()));
+
+// Approximate bookkeeping of the standard library per container node
+inline constexpr std::size_t kTreeNodeOverhead = 4 * sizeof(void*);
+inline constexpr std::size_t kHashNodeOverhead = 2 * sizeof(void*);
+inline constexpr std::size_t kSharedControlBlockSize = 2 * sizeof(void*);
+
+}  // namespace impl
+
+/// @brief Check if the memory usage of `T` can be estimated: `T` is trivially
+/// copyable or there is an `EstimateDynamicMemory` overload for it
+template <typename T>
+inline constexpr bool kIsMemoryEstimable =
+    std::is_trivially_copyable_v<T> ||
+    std::is_same_v<meta::DetectedType<impl::EstimateDynamicMemoryResult, T>, std::size_t>;
+
+/// @ingroup userver_caches
+///
+/// @brief Estimates the deep memory footprint of a value, e.g. of the data of
+/// a components::CachingComponentBase.
+///
+/// Works with the types that are trivially copyable and with the types that
+/// have an `EstimateDynamicMemory` overload found by ADL, similar to
+/// `dump::Write` and `dump::Read`. The overloads for the standard containers,
+/// strings, smart pointers, `std::optional`, `std::variant`, `std::pair` and
+/// `std::tuple` are provided. An overload returns the number of bytes owned by
+/// the value outside of its `sizeof`:
+///
+/// @snippet cache/memory_usage_test.cpp Sample EstimateDynamicMemory
+///
+/// The result is an estimation: the allocator overhead is not accounted and
+/// the node sizes of the standard containers are approximate. Objects owned
+/// through `std::shared_ptr` are accounted only once per estimation.
+class MemoryEstimator final {
+public:
+    /// @returns the number of bytes owned by the `value` outside of
+    /// `sizeof(value)`
+    template <typename T>
+    std::size_t EstimateDynamic(const T& value) {
+        static_assert(kIsMemoryEstimable<T>, "Provide an EstimateDynamicMemory overload for the type");
+        if constexpr (meta::kIsDetected<impl::EstimateDynamicMemoryResult, T>) {
+            return EstimateDynamicMemory(*this, value);
+        } else {
+            return 0;
+        }
+    }
+
+    /// @returns the number of bytes used by the `value`, including
+    /// `sizeof(value)`
+    template <typename T>
+    std::size_t Estimate(const T& value) {
+        return sizeof(T) + EstimateDynamic(value);
+    }
+
+    /// @returns true if the shared object was not accounted by the estimator yet
+    bool IsFirstVisit(const void* object) { return visited_.insert(object).second; }
+
+private:
+    std::unordered_set<const void*> visited_;
+};
+
+/// @brief Estimates the deep memory footprint of the `value`
+/// @see cache::MemoryEstimator
+template <typename T>
+std::size_t EstimateMemoryUsage(const T& value) {
+    MemoryEstimator estimator;
+    return estimator.Estimate(value);
+}
+
+namespace impl {
+
+template <typename Range>
+std::size_t EstimateElementsDynamic(MemoryEstimator& estimator, const Range& range) {
+    using Value = typename Range::value_type;
+    std::size_t result = 0;
+    if constexpr (!std::is_trivially_copyable_v<Value>) {
+        for (const auto& item : range) result += estimator.EstimateDynamic(static_cast<const Value&>(item));
+    }
+    return result;
+}
+
+template <typename Range>
+std::size_t EstimateNodes(MemoryEstimator& estimator, const Range& range, std::size_t node_overhead) {
+    return range.size() * (node_overhead + sizeof(typename Range::value_type)) +
+           EstimateElementsDynamic(estimator, range);
+}
+
+}  // namespace impl
+
+/// @brief `std::basic_string` memory usage support
+template <typename Char, typename Traits, typename Alloc>
+std::size_t EstimateDynamicMemory(MemoryEstimator&, const std::basic_string<Char, Traits, Alloc>& value) {
+    const auto* data = reinterpret_cast<const char*>(value.data());
+    const auto* self = reinterpret_cast<const char*>(&value);
+    // Short strings are stored inside the object
+    if (data >= self && data < self + sizeof(value)) return 0;
+    return (value.capacity() + 1) * sizeof(Char);
+}
+
+/// @brief `std::vector` memory usage support
+template <typename T, typename Alloc>
+std::enable_if_t<kIsMemoryEstimable<T>, std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::vector<T, Alloc>& value) {
+    if constexpr (std::is_same_v<T, bool>) {
+        return value.capacity() / 8;
+    } else {
+        return value.capacity() * sizeof(T) + impl::EstimateElementsDynamic(estimator, value);
+    }
+}
+
+/// @brief `std::array` memory usage support
+template <typename T, std::size_t N>
+std::enable_if_t<kIsMemoryEstimable<T>, std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::array<T, N>& value) {
+    return impl::EstimateElementsDynamic(estimator, value);
+}
+
+/// @brief `std::map` and `std::multimap` memory usage support
+/// @{
+template <typename Key, typename Value, typename Compare, typename Alloc>
+std::enable_if_t<kIsMemoryEstimable<Key> && kIsMemoryEstimable<Value>, std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::map<Key, Value, Compare, Alloc>& value) {
+    return impl::EstimateNodes(estimator, value, impl::kTreeNodeOverhead);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+std::enable_if_t<kIsMemoryEstimable<Key> && kIsMemoryEstimable<Value>, std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::multimap<Key, Value, Compare, Alloc>& value) {
+    return impl::EstimateNodes(estimator, value, impl::kTreeNodeOverhead);
+}
+/// @}
+
+/// @brief `std::set` and `std::multiset` memory usage support
+/// @{
+template <typename T, typename Compare, typename Alloc>
+std::enable_if_t<kIsMemoryEstimable<T>, std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::set<T, Compare, Alloc>& value) {
+    return impl::EstimateNodes(estimator, value, impl::kTreeNodeOverhead);
+}
+
+template <typename T, typename Compare, typename Alloc>
+std::enable_if_t<kIsMemoryEstimable<T>, std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::multiset<T, Compare, Alloc>& value) {
+    return impl::EstimateNodes(estimator, value, impl::kTreeNodeOverhead);
+}
+/// @}
+
+/// @brief `std::unordered_map` and `std::unordered_multimap` memory usage
+/// support
+/// @{
+template <typename Key, typename Value, typename Hash, typename Equal, typename Alloc>
+std::enable_if_t<kIsMemoryEstimable<Key> && kIsMemoryEstimable<Value>, std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::unordered_map<Key, Value, Hash, Equal, Alloc>& value) {
+    return value.bucket_count() * sizeof(void*) + impl::EstimateNodes(estimator, value, impl::kHashNodeOverhead);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal, typename Alloc>
+std::enable_if_t<kIsMemoryEstimable<Key> && kIsMemoryEstimable<Value>, std::size_t> EstimateDynamicMemory(
+    MemoryEstimator& estimator,
+    const std::unordered_multimap<Key, Value, Hash, Equal, Alloc>& value
+) {
+    return value.bucket_count() * sizeof(void*) + impl::EstimateNodes(estimator, value, impl::kHashNodeOverhead);
+}
+/// @}
+
+/// @brief `std::unordered_set` and `std::unordered_multiset` memory usage
+/// support
+/// @{
+template <typename T, typename Hash, typename Equal, typename Alloc>
+std::enable_if_t<kIsMemoryEstimable<T>, std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::unordered_set<T, Hash, Equal, Alloc>& value) {
+    return value.bucket_count() * sizeof(void*) + impl::EstimateNodes(estimator, value, impl::kHashNodeOverhead);
+}
+
+template <typename T, typename Hash, typename Equal, typename Alloc>
+std::enable_if_t<kIsMemoryEstimable<T>, std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::unordered_multiset<T, Hash, Equal, Alloc>& value) {
+    return value.bucket_count() * sizeof(void*) + impl::EstimateNodes(estimator, value, impl::kHashNodeOverhead);
+}
+/// @}
+
+/// @brief `std::pair` memory usage support
+template <typename First, typename Second>
+std::enable_if_t<kIsMemoryEstimable<First> && kIsMemoryEstimable<Second>, std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::pair<First, Second>& value) {
+    return estimator.EstimateDynamic(value.first) + estimator.EstimateDynamic(value.second);
+}
+
+/// @brief `std::tuple` memory usage support
+template <typename... Args>
+std::enable_if_t<(kIsMemoryEstimable<Args> && ...), std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::tuple<Args...>& value) {
+    return std::apply(
+        [&estimator](const auto&... items) { return (estimator.EstimateDynamic(items) + ... + std::size_t{0}); }, value
+    );
+}
+
+/// @brief `std::optional` memory usage support
+template <typename T>
+std::enable_if_t<kIsMemoryEstimable<T>, std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::optional<T>& value) {
+    return value ? estimator.EstimateDynamic(*value) : 0;
+}
+
+/// @brief `std::variant` memory usage support
+template <typename... Args>
+std::enable_if_t<(kIsMemoryEstimable<Args> && ...), std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::variant<Args...>& value) {
+    if (value.valueless_by_exception()) return 0;
+    return std::visit([&estimator](const auto& item) { return estimator.EstimateDynamic(item); }, value);
+}
+
+/// @brief `std::unique_ptr` memory usage support
+template <typename T>
+std::enable_if_t<kIsMemoryEstimable<T>, std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::unique_ptr<T>& value) {
+    return value ? estimator.Estimate(*value) : 0;
+}
+
+/// @brief `std::shared_ptr` memory usage support, the pointee is accounted
+/// only for its first owner
+template <typename T>
+std::enable_if_t<kIsMemoryEstimable<T>, std::size_t>
+EstimateDynamicMemory(MemoryEstimator& estimator, const std::shared_ptr<T>& value) {
+    if (!value || !estimator.IsFirstVisit(value.get())) return 0;
+    return impl::kSharedControlBlockSize + estimator.Estimate(*value);
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -1,21 +1,45 @@
 #pragma once
 
 #include <functional>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
 #include <boost/container_hash/hash.hpp>
 
+#include <userver/cache/entry_cost.hpp>
+#include <userver/cache/eviction_policy.hpp>
+#include <userver/cache/impl/clock.hpp>
+#include <userver/cache/impl/tiny_lfu.hpp>
 #include <userver/cache/lru_map.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/dump/operations.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/shared_mutex.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace cache {
 
 /// @ingroup userver_containers
+///
+/// @brief N-way associative cache, each way is a separate LRU map with its own
+/// mutex.
+///
+/// With the default EvictionPolicy::kLru each hit reorders the LRU list of
+/// the way under its mutex, so the hits on the same hot keys do not scale with
+/// the number of cores. EvictionPolicy::kClock only marks the entry on a hit
+/// and takes the way lock in shared mode for that. EvictionPolicy::kTinyLfu
+/// gives a better hit rate for the traffic with scans or many rare keys.
+/// See cache::EvictionPolicy for details.
+///
+/// With EvictionPolicy::kLru the ways may also be bounded by the total
+/// cache::EntryCost of their entries, see UpdateWayMaxBytes.
 template <typename T, typename U, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>>
 class NWayLRU final {
 public:
@@ -34,6 +58,16 @@ public:
     /// The maximum total number of elements is `ways * way_size`.
     NWayLRU(size_t ways, size_t way_size, const Hash& hash = Hash(), const Equal& equal = Equal());
 
+    /// @param eviction_policy with EvictionPolicy::kClock the hits on a way
+    /// do not wait for each other, which helps with hot keys on many cores.
+    NWayLRU(
+        size_t ways,
+        size_t way_size,
+        EvictionPolicy eviction_policy,
+        const Hash& hash = Hash(),
+        const Equal& equal = Equal()
+    );
+
     void Put(const T& key, U value);
 
     template <typename Validator>
@@ -59,6 +93,16 @@ public:
     /// see the cache::NWayLRU::NWayLRU constructor.
     void UpdateWaySize(size_t way_size);
 
+    /// Bounds the sum of cache::EntryCost of the entries in each way, the least
+    /// recently used entries are evicted to fit. The most recently put entry is
+    /// kept even if it does not fit alone. Setting 0 removes the bound.
+    /// @throws std::logic_error if the eviction policy is not EvictionPolicy::kLru
+    void UpdateWayMaxBytes(size_t way_max_bytes);
+
+    /// @returns the sum of cache::EntryCost of all the entries, or 0 if the ways
+    /// are not bounded by bytes
+    size_t GetBytes() const;
+
     void Write(dump::Writer& writer) const;
     void Read(dump::Reader& reader);
 
@@ -67,141 +111,339 @@ public:
     void SetDumper(std::shared_ptr<dump::Dumper> dumper);
 
 private:
+    template <typename Cache, typename Mutex, typename ReadLock>
     struct Way {
-        Way(Way&& other) noexcept : cache(std::move(other.cache)) {}
+        using ReadLockType = ReadLock;
+
+        Way(Way&& other) noexcept
+            : cache(std::move(other.cache)), bytes(other.bytes), max_bytes(other.max_bytes) {}
 
         // max_size is not used, will be reset by Resize() in NWayLRU::NWayLRU
         Way(const Hash& hash, const Equal& equal) : cache(1, hash, equal) {}
 
-        mutable engine::Mutex mutex;
-        LruMap<T, U, Hash, Equal> cache;
+        mutable Mutex mutex;
+        Cache cache;
+        // Only tracked if max_bytes != 0
+        size_t bytes{0};
+        size_t max_bytes{0};
     };
 
-    Way& GetWay(const T& key);
+    // Hits modify the LRU list, so they take the unique lock
+    using LruWay = Way<LruMap<T, U, Hash, Equal>, engine::Mutex, std::unique_lock<engine::Mutex>>;
+    using ClockWay =
+        Way<impl::ClockBase<T, U, Hash, Equal>, engine::SharedMutex, std::shared_lock<engine::SharedMutex>>;
+    using TinyLfuWay = Way<impl::TinyLfuBase<T, U, Hash, Equal>, engine::Mutex, std::unique_lock<engine::Mutex>>;
+
+    template <typename Ways>
+    static Ways MakeWays(size_t ways, size_t way_size, const Hash& hash, const Equal& equal);
+
+    template <typename Ways>
+    auto& GetWay(Ways& ways, const T& key) const;
+
+    template <typename SomeWay>
+    static void EraseFromWay(SomeWay& way, const T& key);
+
+    static void PutLimitedByBytes(LruWay& way, const T& key, U&& value);
+    static void ShrinkToMaxBytes(LruWay& way);
+    static void EvictLeastUsed(LruWay& way);
+    static size_t CountBytes(const LruWay& way);
 
     void NotifyDumper();
 
-    std::vector<Way> caches_;
+    std::variant<std::vector<LruWay>, std::vector<ClockWay>, std::vector<TinyLfuWay>> caches_;
     Hash hash_fn_;
     std::shared_ptr<dump::Dumper> dumper_{nullptr};
 };
 
 template <typename T, typename U, typename Hash, typename Eq>
 NWayLRU<T, U, Hash, Eq>::NWayLRU(size_t ways, size_t way_size, const Hash& hash, const Eq& equal)
+    : NWayLRU(ways, way_size, EvictionPolicy::kLru, hash, equal) {}
+
+template <typename T, typename U, typename Hash, typename Eq>
+NWayLRU<T, U, Hash, Eq>::NWayLRU(
+    size_t ways,
+    size_t way_size,
+    EvictionPolicy eviction_policy,
+    const Hash& hash,
+    const Eq& equal
+)
     : caches_(), hash_fn_(hash) {
-    caches_.reserve(ways);
-    for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal);
     if (ways == 0) throw std::logic_error("Ways must be positive");
 
-    for (auto& way : caches_) way.cache.SetMaxSize(way_size);
+    switch (eviction_policy) {
+        case EvictionPolicy::kLru:
+            caches_ = MakeWays<std::vector<LruWay>>(ways, way_size, hash, equal);
+            break;
+        case EvictionPolicy::kClock:
+            caches_ = MakeWays<std::vector<ClockWay>>(ways, way_size, hash, equal);
+            break;
+        case EvictionPolicy::kTinyLfu:
+            caches_ = MakeWays<std::vector<TinyLfuWay>>(ways, way_size, hash, equal);
+            break;
+    }
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Put(const T& key, U value) {
-    auto& way = GetWay(key);
-    {
-        std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.Put(key, std::move(value));
-    }
+    std::visit(
+        [&](auto& ways) {
+            auto& way = GetWay(ways, key);
+            std::unique_lock lock(way.mutex);
+            if constexpr (std::is_same_v<std::decay_t<decltype(way)>, LruWay>) {
+                if (way.max_bytes) {
+                    PutLimitedByBytes(way, key, std::move(value));
+                    return;
+                }
+            }
+            way.cache.Put(key, std::move(value));
+        },
+        caches_
+    );
     NotifyDumper();
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 template <typename Validator>
 std::optional<U> NWayLRU<T, U, Hash, Eq>::Get(const T& key, Validator validator) {
-    auto& way = GetWay(key);
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    auto* value = way.cache.Get(key);
-
-    if (value) {
-        if (validator(*value)) return *value;
-        way.cache.Erase(key);
-    }
-
-    return std::nullopt;
+    return std::visit(
+        [&](auto& ways) -> std::optional<U> {
+            auto& way = GetWay(ways, key);
+            {
+                typename std::decay_t<decltype(way)>::ReadLockType lock(way.mutex);
+                const auto* value = way.cache.Get(key);
+                if (!value) return std::nullopt;
+                if (validator(*value)) return *value;
+            }
+
+            // The value might have been replaced while the lock was released
+            std::unique_lock lock(way.mutex);
+            const auto* value = way.cache.Get(key);
+            if (value && !validator(*value)) EraseFromWay(way, key);
+            return std::nullopt;
+        },
+        caches_
+    );
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
-    auto& way = GetWay(key);
-    {
-        std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.Erase(key);
-    }
+    std::visit(
+        [&](auto& ways) {
+            auto& way = GetWay(ways, key);
+            std::unique_lock lock(way.mutex);
+            EraseFromWay(way, key);
+        },
+        caches_
+    );
     NotifyDumper();
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 U NWayLRU<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
-    auto& way = GetWay(key);
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    return way.cache.GetOr(key, default_value);
+    return std::visit(
+        [&](auto& ways) -> U {
+            auto& way = GetWay(ways, key);
+            typename std::decay_t<decltype(way)>::ReadLockType lock(way.mutex);
+            const auto* value = way.cache.Get(key);
+            return value ? *value : default_value;
+        },
+        caches_
+    );
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Invalidate() {
-    for (auto& way : caches_) {
-        std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.Clear();
-    }
+    std::visit(
+        [](auto& ways) {
+            for (auto& way : ways) {
+                std::unique_lock lock(way.mutex);
+                way.cache.Clear();
+                way.bytes = 0;
+            }
+        },
+        caches_
+    );
     NotifyDumper();
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 template <typename Function>
 void NWayLRU<T, U, Hash, Eq>::VisitAll(Function func) const {
-    for (const auto& way : caches_) {
-        std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.VisitAll(func);
-    }
+    std::visit(
+        [&func](const auto& ways) {
+            for (const auto& way : ways) {
+                typename std::decay_t<decltype(way)>::ReadLockType lock(way.mutex);
+                way.cache.VisitAll(func);
+            }
+        },
+        caches_
+    );
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 size_t NWayLRU<T, U, Hash, Eq>::GetSize() const {
-    size_t size{0};
-    for (const auto& way : caches_) {
-        std::unique_lock<engine::Mutex> lock(way.mutex);
-        size += way.cache.GetSize();
-    }
-    return size;
+    return std::visit(
+        [](const auto& ways) {
+            size_t size{0};
+            for (const auto& way : ways) {
+                typename std::decay_t<decltype(way)>::ReadLockType lock(way.mutex);
+                size += way.cache.GetSize();
+            }
+            return size;
+        },
+        caches_
+    );
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
-    for (auto& way : caches_) {
-        std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.SetMaxSize(way_size);
-    }
+    std::visit(
+        [way_size](auto& ways) {
+            for (auto& way : ways) {
+                std::unique_lock lock(way.mutex);
+                const bool evicts = way.cache.GetSize() > way_size;
+                way.cache.SetMaxSize(way_size);
+                if constexpr (std::is_same_v<std::decay_t<decltype(way)>, LruWay>) {
+                    if (way.max_bytes && evicts) way.bytes = CountBytes(way);
+                }
+            }
+        },
+        caches_
+    );
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::UpdateWayMaxBytes(size_t way_max_bytes) {
+    std::visit(
+        [way_max_bytes](auto& ways) {
+            if constexpr (!std::is_same_v<typename std::decay_t<decltype(ways)>::value_type, LruWay>) {
+                if (way_max_bytes) throw std::logic_error("Bounding the ways by bytes requires EvictionPolicy::kLru");
+            } else {
+                for (auto& way : ways) {
+                    std::unique_lock lock(way.mutex);
+                    if (!way_max_bytes) {
+                        way.bytes = 0;
+                    } else if (!way.max_bytes) {
+                        way.bytes = CountBytes(way);
+                    }
+                    way.max_bytes = way_max_bytes;
+                    if (way_max_bytes) ShrinkToMaxBytes(way);
+                }
+            }
+        },
+        caches_
+    );
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+size_t NWayLRU<T, U, Hash, Eq>::GetBytes() const {
+    return std::visit(
+        [](const auto& ways) {
+            size_t bytes{0};
+            for (const auto& way : ways) {
+                typename std::decay_t<decltype(way)>::ReadLockType lock(way.mutex);
+                bytes += way.bytes;
+            }
+            return bytes;
+        },
+        caches_
+    );
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Ways>
+Ways NWayLRU<T, U, Hash, Eq>::MakeWays(size_t ways, size_t way_size, const Hash& hash, const Eq& equal) {
+    Ways result;
+    result.reserve(ways);
+    for (size_t i = 0; i < ways; ++i) result.emplace_back(hash, equal);
+
+    for (auto& way : result) way.cache.SetMaxSize(way_size);
+    return result;
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
-typename NWayLRU<T, U, Hash, Eq>::Way& NWayLRU<T, U, Hash, Eq>::GetWay(const T& key) {
+template <typename Ways>
+auto& NWayLRU<T, U, Hash, Eq>::GetWay(Ways& ways, const T& key) const {
     /// It is needed to twist hash because there is hash map in LruMap. Otherwise
     /// nodes will fall into one bucket. According to
     /// https://www.boost.org/doc/libs/1_83_0/libs/container_hash/doc/html/hash.html#notes_hash_combine
     /// hash_combine can be treated as hash itself
     auto seed = hash_fn_(key);
     boost::hash_combine(seed, 0);
-    auto n = seed % caches_.size();
-    return caches_[n];
+    auto n = seed % ways.size();
+    return ways[n];
 }
 
-template <typename T, typename U, typename Hash, typename Equal>
-void NWayLRU<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
-    writer.Write(caches_.size());
-
-    for (const Way& way : caches_) {
-        std::unique_lock<engine::Mutex> lock(way.mutex);
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename SomeWay>
+void NWayLRU<T, U, Hash, Eq>::EraseFromWay(SomeWay& way, const T& key) {
+    if constexpr (std::is_same_v<SomeWay, LruWay>) {
+        if (way.max_bytes) {
+            const auto* value = way.cache.Get(key);
+            if (!value) return;
+            way.bytes -= EntryCost<T, U>{}(key, *value);
+        }
+    }
+    way.cache.Erase(key);
+}
 
-        writer.Write(way.cache.GetSize());
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::PutLimitedByBytes(LruWay& way, const T& key, U&& value) {
+    const auto cost = EntryCost<T, U>{}(key, value);
+    if (const auto* old_value = way.cache.Get(key)) {
+        way.bytes -= EntryCost<T, U>{}(key, *old_value);
+    } else if (way.cache.GetSize() >= way.cache.GetCapacity()) {
+        // Otherwise LruMap::Put would evict an entry without accounting for it
+        EvictLeastUsed(way);
+    }
+    way.cache.Put(key, std::move(value));
+    way.bytes += cost;
+    ShrinkToMaxBytes(way);
+}
 
-        way.cache.VisitAll([&writer](const T& key, const U& value) {
-            writer.Write(key);
-            writer.Write(value);
-        });
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::ShrinkToMaxBytes(LruWay& way) {
+    while (way.bytes > way.max_bytes && way.cache.GetSize() > 1) {
+        EvictLeastUsed(way);
     }
 }
 
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::EvictLeastUsed(LruWay& way) {
+    const auto* key = way.cache.GetLeastUsedKey();
+    UASSERT(key);
+    way.bytes -= EntryCost<T, U>{}(*key, *way.cache.GetLeastUsed());
+    way.cache.Erase(*key);
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+size_t NWayLRU<T, U, Hash, Eq>::CountBytes(const LruWay& way) {
+    size_t bytes{0};
+    way.cache.VisitAll([&bytes](const T& key, const U& value) { bytes += EntryCost<T, U>{}(key, value); });
+    return bytes;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayLRU<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
+    std::visit(
+        [&writer](const auto& ways) {
+            writer.Write(ways.size());
+
+            for (const auto& way : ways) {
+                typename std::decay_t<decltype(way)>::ReadLockType lock(way.mutex);
+
+                writer.Write(way.cache.GetSize());
+
+                way.cache.VisitAll([&writer](const T& key, const U& value) {
+                    writer.Write(key);
+                    writer.Write(value);
+                });
+            }
+        },
+        caches_
+    );
+}
+
 template <typename T, typename U, typename Hash, typename Equal>
 void NWayLRU<T, U, Hash, Equal>::Read(dump::Reader& reader) {
     Invalidate();
@@ -0,0 +1,91 @@
+#pragma once
+
+/// @file userver/cache/update_scheduler.hpp
+/// @brief @copybrief components::CacheUpdateScheduler
+
+#include <memory>
+
+#include <userver/components/component_base.hpp>
+#include <userver/components/component_fwd.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+class UpdateScheduler;
+}  // namespace cache::impl
+
+namespace components {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that coordinates the periodic updates of all the caches
+/// to avoid synchronized bursts of updates.
+///
+/// Without the component each cache updates on its own schedule, and caches
+/// with equal update intervals that were started together tend to update
+/// at the same moments. If the component is present in the service config,
+/// every cache inherited from cache::CacheUpdateTrait:
+/// - shifts the first periodic update by a fraction of its update interval,
+///   the phases of the caches are spread uniformly;
+/// - waits for a permission from the scheduler before each update. At most
+///   `max-concurrent-updates` updates run at once, and the updates hold at
+///   most `max-db-connections` database connections in total, according to
+///   the `update-db-connections` static option of the caches. The most stale
+///   caches, relative to their update intervals, are updated first.
+///
+/// Updates requested by testsuite are not limited.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// max-concurrent-updates | the maximum number of cache updates running at once, 0 for no limit | 0
+/// max-db-connections | the maximum total `update-db-connections` of the running updates, 0 for no limit | 0
+/// spread-phases | whether to spread the phases of the periodic updates | true
+///
+/// ## Config example:
+///
+/// @code
+/// cache-update-scheduler:
+///     max-concurrent-updates: 4
+///     max-db-connections: 8
+/// @endcode
+///
+/// ## Statistics
+///
+/// `cache-update-scheduler.running-updates`, `waiting-updates` and
+/// `db-connections-in-use` show the current state. The `updates`,
+/// `delayed-updates` and `wait-time-ms` counters and the `update-phase`
+/// of each cache are reported with the `cache_name` label.
+
+// clang-format on
+class CacheUpdateScheduler final : public ComponentBase {
+public:
+    /// @ingroup userver_component_names
+    /// @brief The default name of components::CacheUpdateScheduler
+    static constexpr std::string_view kName = "cache-update-scheduler";
+
+    CacheUpdateScheduler(const ComponentConfig& config, const ComponentContext& context);
+
+    ~CacheUpdateScheduler() override;
+
+    /// @cond
+    // For internal use only
+    cache::impl::UpdateScheduler& GetScheduler() noexcept;
+    /// @endcond
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    std::unique_ptr<cache::impl::UpdateScheduler> scheduler_;
+    utils::statistics::Entry statistics_holder_;
+};
+
+template <>
+inline constexpr bool kHasValidate<CacheUpdateScheduler> = true;
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
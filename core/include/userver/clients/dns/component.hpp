@@ -33,6 +33,7 @@ namespace clients::dns {
 /// cache-size-per-way | size of each way of network cache | 256
 /// cache-max-reply-ttl | TTL limit for network replies caching | 5m
 /// cache-failure-ttl | TTL for network failures caching | 5s
+/// cache-refresh-ahead | cached replies are refreshed in background this long before their TTL expires, network-timeout is used if greater | 0
 ///
 /// ## Static configuration example:
 ///
@@ -56,6 +57,7 @@ private:
 
     Resolver resolver_;
     utils::statistics::Entry statistics_holder_;
+    utils::statistics::Entry timings_statistics_holder_;
 };
 
 }  // namespace clients::dns
@@ -39,6 +39,11 @@ struct ResolverConfig {
 
     /// Network cache failure TTL
     std::chrono::milliseconds cache_failure_ttl{std::chrono::seconds{5}};
+
+    /// Cached replies are refreshed in background when their TTL is about to
+    /// expire within this interval, while the cached reply is still returned.
+    /// network_timeout is used if it is greater.
+    std::chrono::milliseconds cache_refresh_ahead{0};
 };
 
 }  // namespace clients::dns
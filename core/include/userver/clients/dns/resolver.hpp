@@ -10,6 +10,7 @@
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/relaxed_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -53,6 +54,10 @@ public:
     /// Returns lookup source counters.
     const LookupSourceCounters& GetLookupSourceCounters() const;
 
+    /// Returns timings of the network lookups in milliseconds, both the
+    /// foreground and the background ones.
+    const utils::statistics::Histogram& GetNetworkLookupTimings() const;
+
     /// Forces the reload of lookup table file. Waits until the reload is done.
     void ReloadHosts();
 
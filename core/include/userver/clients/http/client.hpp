@@ -42,6 +42,7 @@ class ThreadPool;
 namespace clients::http {
 namespace impl {
 class EasyWrapper;
+class RequestCoalescer;
 }  // namespace impl
 
 struct TestsuiteConfig;
@@ -102,6 +103,10 @@ public:
 
     // For internal use only.
     void SetConfig(const impl::Config&);
+
+    // Returns nullptr if the concurrency limiter is disabled.
+    // For internal use only.
+    const congestion_control::ClientLimiters* GetConcurrencyLimiters() const;
     /// @endcond
 
     /// @brief Sets User-Agent headers for all the requests or removes that
@@ -173,6 +178,10 @@ private:
     clients::dns::Resolver* resolver_{nullptr};
     utils::NotNull<const tracing::TracingManagerBase*> tracing_manager_;
     impl::PluginPipeline plugin_pipeline_;
+
+    std::unique_ptr<congestion_control::ClientLimiters> concurrency_limiters_;
+    std::unique_ptr<impl::RequestCoalescer> request_coalescer_;
+    const std::optional<Http2Settings> http2_settings_;
 };
 
 }  // namespace clients::http
@@ -48,6 +48,19 @@ namespace components {
 /// set-deadline-propagation-header | whether to set http::common::kXYaTaxiClientTimeoutMs request header, see @ref scripts/docs/en/userver/deadline_propagation.md | true
 /// plugins | Plugin names to apply. A plugin component is called "http-client-plugin-" plus the plugin name. | []
 /// cancellation-policy | Cancellation policy for new requests. | cancel
+/// concurrency-limiter | per-destination adaptive concurrency limit, see congestion_control::ClientLimiter; requests above the limit fail immediately with clients::http::NetworkProblemException | disabled
+/// concurrency-limiter.initial-limit | limit that is used before any latency is measured | 20
+/// concurrency-limiter.min-limit | the limit is never decreased below this value | 1
+/// concurrency-limiter.max-limit | the limit is never increased above this value | 1000
+/// concurrency-limiter.smoothing | part of the new estimate applied to the limit on each request | 0.2
+/// concurrency-limiter.rtt-tolerance | latency increase relative to the long-term latency that is not treated as queueing | 1.5
+/// concurrency-limiter.long-window | number of requests in the long-term latency moving average | 600
+/// concurrency-limiter.queue-size | number of requests allowed to queue at the destination | 4
+/// http2 | multiplexed HTTP/2 connections to the destinations, a few connections per host replace a connection per concurrent request; the version set via clients::http::Request::http_version takes precedence | disabled
+/// http2.destinations | URL prefixes of the destinations that are talked HTTP/2 to, e.g. `http://my-service.internal`; all the destinations if empty | []
+/// http2.max-concurrent-streams | maximal number of the concurrent streams of a connection | 100
+/// http2.max-host-connections | maximal number of connections to a single host, for all the destinations; unlimited if 0 | 0
+/// http2.fallback | `http1.1` to negotiate HTTP/2 with ALPN or `Upgrade: h2c` and talk HTTP/1.1 to the servers that refuse it, `none` to use h2c with prior knowledge | http1.1
 ///
 /// ## Static configuration example:
 ///
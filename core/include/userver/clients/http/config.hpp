@@ -1,8 +1,11 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 #include <string>
+#include <vector>
 
+#include <userver/congestion_control/client_limiter.hpp>
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/formats/json_fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
@@ -26,6 +29,31 @@ enum class CancellationPolicy {
 
 CancellationPolicy Parse(yaml_config::YamlConfig value, formats::parse::To<CancellationPolicy>);
 
+/// What to do with the HTTP/2 destinations that do not support HTTP/2
+enum class Http2Fallback {
+    /// HTTP/2 is negotiated with ALPN for https:// and with
+    /// `Upgrade: h2c` for http://, HTTP/1.1 is used if the server refuses
+    kHttp11,
+    /// h2c with prior knowledge for http://, requests to the servers without
+    /// HTTP/2 support fail
+    kNone,
+};
+
+Http2Fallback Parse(yaml_config::YamlConfig value, formats::parse::To<Http2Fallback>);
+
+struct Http2Settings final {
+    /// URL prefixes of the destinations that are talked HTTP/2 to, e.g.
+    /// `http://my-service.internal`. All the destinations if empty.
+    std::vector<std::string> destinations{};
+    /// Maximal number of the concurrent streams of a connection
+    std::size_t max_concurrent_streams{100};
+    /// Maximal number of connections to a single host, unlimited if 0
+    std::size_t max_host_connections{0};
+    Http2Fallback fallback{Http2Fallback::kHttp11};
+};
+
+Http2Settings Parse(const yaml_config::YamlConfig& value, formats::parse::To<Http2Settings>);
+
 // Static config
 struct ClientSettings final {
     std::string thread_name_prefix{};
@@ -33,6 +61,11 @@ struct ClientSettings final {
     DeadlinePropagationConfig deadline_propagation{};
     const tracing::TracingManagerBase* tracing_manager{nullptr};
     CancellationPolicy cancellation_policy{CancellationPolicy::kCancel};
+    /// Per-destination adaptive concurrency limit, disabled if not set
+    std::optional<congestion_control::ClientLimiterConfig> concurrency_limiter{};
+    /// Multiplexed HTTP/2 connections, HTTP/2 is used only if the server
+    /// selects it via ALPN if not set
+    std::optional<Http2Settings> http2{};
 };
 
 ClientSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientSettings>);
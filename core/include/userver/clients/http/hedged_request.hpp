@@ -0,0 +1,74 @@
+#pragma once
+
+/// @file userver/clients/http/hedged_request.hpp
+/// @brief Hedged HTTP requests with the delay that follows the latencies of
+/// the destination.
+///
+/// Example:
+/// @code
+/// utils::hedging::AdaptiveHedgingSet hedgings{settings};
+/// ...
+/// auto response = clients::http::HedgeRequest(
+///     [&] { return http_client.CreateRequest().get(url).retry(1).timeout(timeout).async_perform(); },
+///     hedgings.GetHedging("my-service"), hedging_settings);
+/// @endcode
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include <userver/clients/http/response.hpp>
+#include <userver/clients/http/response_future.hpp>
+#include <userver/utils/adaptive_hedging.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace impl {
+
+/// 5xx and 429 are worth a hedge, other replies are final
+struct IsHedgingFinalResponse {
+    bool operator()(const std::shared_ptr<Response>& response) const {
+        const auto code = static_cast<int>(response->status_code());
+        return code < 500 && code != 429;
+    }
+};
+
+using HedgedRequestStrategy = utils::hedging::impl::AdaptiveRequestStrategy<ResponseFuture, IsHedgingFinalResponse>;
+
+}  // namespace impl
+
+/// @brief Performs the request created by `gen_request`, sends hedges after
+/// the percentile-based delay of `hedging` and within its budget.
+///
+/// The requests should be created with `retry(1)`, the retries are done by
+/// the hedging. Responses with 5xx and 429 codes start the next attempt.
+/// @returns the first final response, the last one if all the attempts have
+/// failed, or std::nullopt if none of them has got a response
+template <typename GenF>
+std::optional<std::shared_ptr<Response>>
+HedgeRequest(GenF&& gen_request, utils::hedging::AdaptiveHedging& hedging, utils::hedging::HedgingSettings settings) {
+    return utils::hedging::HedgeRequest(
+        impl::HedgedRequestStrategy(std::forward<GenF>(gen_request), hedging),
+        hedging.MakeSettings(std::move(settings))
+    );
+}
+
+/// @brief Asynchronous version of clients::http::HedgeRequest, `hedging`
+/// should outlive the returned future.
+template <typename GenF>
+auto HedgeRequestAsync(
+    GenF&& gen_request,
+    utils::hedging::AdaptiveHedging& hedging,
+    utils::hedging::HedgingSettings settings
+) {
+    return utils::hedging::HedgeRequestAsync(
+        impl::HedgedRequestStrategy(std::forward<GenF>(gen_request), hedging),
+        hedging.MakeSettings(std::move(settings))
+    );
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
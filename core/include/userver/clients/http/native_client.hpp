@@ -0,0 +1,180 @@
+#pragma once
+
+/// @file userver/clients/http/native_client.hpp
+/// @brief @copybrief clients::http::NativeClient
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/clients/dns/resolver_fwd.hpp>
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// Settings of the clients::http::NativeClient
+struct NativeClientSettings final {
+    /// Max count of idle keep-alive connections to keep per host
+    std::size_t max_idle_connections_per_host{16};
+
+    /// Idle connections that were not used for longer are not reused
+    std::chrono::milliseconds idle_timeout{std::chrono::seconds{30}};
+
+    /// Max size of the response headers and body
+    std::size_t max_response_size{64 * 1024 * 1024};
+
+    /// Resolver to use for hostnames, getaddrinfo on the fs_task_processor is
+    /// used if not set
+    clients::dns::Resolver* resolver{nullptr};
+
+    /// Task processor for blocking getaddrinfo calls, the current one is used
+    /// if not set which is only acceptable for numeric hosts
+    engine::TaskProcessor* fs_task_processor{nullptr};
+
+    /// Enables TCP keep-alive probes with this interval on the connections,
+    /// so that the idle ones are kept alive by NATs and balancers and the
+    /// broken ones are detected by the kernel. Disabled if zero.
+    std::chrono::seconds keepalive_probe_interval{0};
+
+    /// Resume the TLS sessions of the previous connections to the same host to
+    /// skip the full handshake
+    bool tls_session_resumption{true};
+
+    /// Send GET and HEAD requests without a body as TLS 1.3 0-RTT data on the
+    /// new connections if the resumed session allows it. The server must be
+    /// ready for the replays of such requests. Requires tls_session_resumption.
+    bool tls_early_data{false};
+};
+
+/// Statistics of a single destination of the clients::http::NativeClient
+struct NativeClientStatistics final {
+    /// Requests that were performed over a pooled connection
+    std::uint64_t pool_hits{0};
+    /// Requests that had to establish a new connection
+    std::uint64_t pool_misses{0};
+    /// Pooled connections that turned out to be closed by the peer
+    std::uint64_t stale_connections{0};
+    /// Connections established by NativeClient::Warmup()
+    std::uint64_t warmed_up_connections{0};
+    /// Current count of the idle connections in the pool
+    std::size_t idle_connections{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const NativeClientStatistics& stats);
+
+class NativeClient;
+
+/// @brief HTTP/1.1 request that is performed by clients::http::NativeClient.
+///
+/// Mirrors the most used part of the clients::http::Request builder API.
+class NativeRequest final {
+public:
+    /// Specifies method
+    NativeRequest& method(HttpMethod method);
+    /// GET request with url
+    NativeRequest& get(const std::string& url);
+    /// HEAD request with url
+    NativeRequest& head(const std::string& url);
+    /// POST request with url and data
+    NativeRequest& post(const std::string& url, std::string data = {});
+    /// PUT request with url and data
+    NativeRequest& put(const std::string& url, std::string data = {});
+    /// PATCH request with url and data
+    NativeRequest& patch(const std::string& url, std::string data = {});
+    /// DELETE request with url
+    NativeRequest& delete_method(const std::string& url);
+
+    /// Set url for request
+    NativeRequest& url(const std::string& url);
+    /// Data for POST request
+    NativeRequest& data(std::string data);
+    /// Add headers for request as map
+    NativeRequest& headers(const Headers& headers);
+    /// Add headers for request as list
+    NativeRequest& headers(const std::initializer_list<std::pair<std::string_view, std::string_view>>& headers);
+    /// Set timeout in ms for the whole request including the retries
+    NativeRequest& timeout(long timeout_ms);
+    NativeRequest& timeout(std::chrono::milliseconds timeout_ms) { return timeout(timeout_ms.count()); }
+    /// Set number of attempts, network errors lead to retries if on_fails
+    NativeRequest& retry(short retries = 3, bool on_fails = true);
+
+    /// @brief Performs the request in the current task.
+    /// @throws clients::http::BaseException descendants on errors, HTTP error
+    /// statuses are not reported as exceptions, see Response::raise_for_status()
+    std::shared_ptr<Response> perform();
+
+private:
+    friend class NativeClient;
+
+    struct ClientImpl;
+
+    explicit NativeRequest(ClientImpl& client);
+
+    ClientImpl& client_;
+    HttpMethod method_{HttpMethod::kGet};
+    std::string url_;
+    std::string data_;
+    Headers headers_;
+    std::chrono::milliseconds timeout_{std::chrono::seconds{5}};
+    short retries_{1};
+    bool retry_on_fails_{false};
+};
+
+/// @ingroup userver_clients
+///
+/// @brief HTTP/1.1 client that works directly over engine::io::Socket and
+/// engine::io::TlsWrapper, without curl.
+///
+/// Keeps its own pool of keep-alive connections per scheme, host and port.
+/// Aimed at the service-to-service calls with plain requests and responses:
+/// there are no redirects, proxies, compression and streaming. Use
+/// clients::http::Client if any of those are needed.
+///
+/// The client must outlive the requests created by it.
+class NativeClient final {
+public:
+    explicit NativeClient(NativeClientSettings settings = {});
+    ~NativeClient();
+
+    NativeClient(const NativeClient&) = delete;
+    NativeClient& operator=(const NativeClient&) = delete;
+
+    /// Returns a new request builder
+    NativeRequest CreateRequest();
+
+    /// @brief Establishes connections (including the TLS handshake) to the
+    /// scheme, host and port of the url concurrently, until there are
+    /// `connections` idle ones in the pool.
+    ///
+    /// Call it at startup and after the destination changes its addresses
+    /// (after ResetConnections()) to avoid handshakes on the requests path.
+    /// Failures to connect are logged and are not reported as exceptions.
+    /// @returns count of the newly established connections
+    std::size_t Warmup(const std::string& url, std::size_t connections, engine::Deadline deadline);
+
+    /// Drops all the idle connections
+    void ResetConnections();
+
+    /// Returns statistics of the destination of the url
+    NativeClientStatistics GetDestinationStatistics(const std::string& url) const;
+
+    /// Writes statistics of all the destinations with the `http_destination`
+    /// label and the TLS handshake statistics
+    friend void DumpMetric(utils::statistics::Writer& writer, const NativeClient& client);
+
+private:
+    std::unique_ptr<NativeRequest::ClientImpl> impl_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
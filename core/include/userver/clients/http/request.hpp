@@ -20,6 +20,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace congestion_control {
+class ClientLimiters;
+}  // namespace congestion_control
+
 namespace tracing {
 class TracingManagerBase;
 }  // namespace tracing
@@ -32,12 +36,14 @@ class StreamedResponse;
 class ConnectTo;
 class Form;
 struct DeadlinePropagationConfig;
+struct Http2Settings;
 class RequestStats;
 class DestinationStatistics;
 struct TestsuiteConfig;
 
 namespace impl {
 class EasyWrapper;
+class RequestCoalescer;
 }  // namespace impl
 
 /// HTTP request method
@@ -264,8 +270,33 @@ public:
 
     // Set deadline propagation settings. For internal use only.
     void SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config) &;
+
+    // Set the coalescer of the client. For internal use only.
+    void SetRequestCoalescer(impl::RequestCoalescer& coalescer) &;
+
+    // Set the per-destination concurrency limiters of the client. For internal
+    // use only.
+    void SetConcurrencyLimiters(congestion_control::ClientLimiters& limiters) &;
+
+    // Set the HTTP/2 settings of the client. For internal use only.
+    void SetHttp2Settings(const Http2Settings& settings) &;
     /// @endcond
 
+    /// @brief Coalesce the request with the concurrent requests of the same
+    /// client that have the same key: only one of them is actually performed,
+    /// all the waiters get the same exception or a copy of the same Response.
+    /// Each waiter owns its copy and may modify it, the copying costs a body
+    /// allocation per joined waiter.
+    ///
+    /// The key must identify everything that affects the response, e.g. the
+    /// method, the url and the significant headers. Only use it for idempotent
+    /// requests. Timeouts, retries and the cancellation policy of the request
+    /// that started the performing apply to all the waiters; cancellation of
+    /// a waiter does not cancel the shared request. An empty key disables the
+    /// coalescing. Streamed responses are never coalesced.
+    Request& coalesce(std::string key) &;
+    Request coalesce(std::string key) &&;
+
     /// Disable auto-decoding of received replies.
     /// Useful to proxy replies 'as is'.
     Request& DisableReplyDecoding() &;
@@ -49,6 +49,15 @@ public:
     engine::impl::ContextAccessor* TryGetContextAccessor() noexcept;
 
     ResponseFuture(engine::Future<std::shared_ptr<Response>>&& future, std::shared_ptr<RequestState> request);
+
+    // The future is for a response of a coalesced request that is performed by
+    // another RequestState, see Request::coalesce()
+    struct CoalescedTag {};
+    ResponseFuture(
+        CoalescedTag,
+        engine::Future<std::shared_ptr<Response>>&& future,
+        std::shared_ptr<RequestState> request
+    );
     /// @endcond
 
 private:
@@ -58,6 +67,7 @@ private:
     engine::Deadline deadline_;
     std::shared_ptr<RequestState> request_state_;
     bool was_deadline_propagated_{false};
+    bool is_coalesced_{false};
     CancellationPolicy cancellation_policy_;
 };
 
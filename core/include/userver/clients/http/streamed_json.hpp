@@ -0,0 +1,64 @@
+#pragma once
+
+/// @file userver/clients/http/streamed_json.hpp
+/// @brief @copybrief clients::http::ParseStreamedJson
+
+#include <string>
+
+#include <userver/clients/http/error.hpp>
+#include <userver/clients/http/streamed_response.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/formats/json/parser/parser_state.hpp>
+#include <userver/formats/json/parser/typed_parser.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// @brief Parses the body of the streamed response with the typed SAX
+/// parser as the body chunks arrive, without buffering the whole body and
+/// building a DOM.
+///
+/// The status code and headers should be checked before the call if the body
+/// of the error responses differs.
+/// @throws formats::json::parser::ParseError on the malformed body
+/// @throws clients::http::BaseException descendants on the request errors
+///
+/// ## Example usage:
+/// @code
+/// auto response = http_client.CreateRequest()
+///                     .get(url)
+///                     .async_perform_stream_body(
+///                         concurrent::StringStreamQueue::Create());
+/// formats::json::parser::Int64Parser int_parser;
+/// formats::json::parser::ArrayParser<std::int64_t,
+///                                    formats::json::parser::Int64Parser>
+///     parser{int_parser};
+/// const auto values = clients::http::ParseStreamedJson(response, parser,
+///                                                      deadline);
+/// @endcode
+template <typename Parser>
+typename Parser::ResultType ParseStreamedJson(StreamedResponse& response, Parser& parser, engine::Deadline deadline) {
+    using ResultType = typename Parser::ResultType;
+    ResultType result{};
+
+    parser.Reset();
+    formats::json::parser::SubscriberSink<ResultType> sink(result);
+    parser.Subscribe(sink);
+
+    formats::json::parser::ParserState state;
+    state.PushParser(parser);
+    state.ProcessChunkedInput([&response, deadline](std::string& chunk) {
+        if (response.ReadChunk(chunk, deadline)) return true;
+        if (deadline.IsReached()) {
+            throw TimeoutException("Timeout while reading the streamed response body", {});
+        }
+        return false;
+    });
+
+    return result;
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -31,6 +31,7 @@ namespace impl {
 enum class ComponentLifetimeStage;
 class ComponentInfo;
 class ComponentContextImpl;
+struct ComponentsLoadReport;
 
 using ComponentFactory =
     std::function<std::unique_ptr<components::RawComponentBase>(const components::ComponentContext&)>;
@@ -186,6 +187,8 @@ private:
 
     void CancelComponentsLoad();
 
+    impl::ComponentsLoadReport MakeLoadReport() const;
+
     [[noreturn]] void ThrowNonRegisteredComponent(std::string_view name, std::string_view type) const;
     [[noreturn]] void
     ThrowComponentTypeMismatch(std::string_view name, std::string_view type, RawComponentBase* component) const;
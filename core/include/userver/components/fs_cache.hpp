@@ -23,6 +23,9 @@ namespace components {
 /// dir               | directory to cache files from                        | /var/www
 /// update-period     | Update period (0 - fill the cache only at startup)   | 0
 /// fs-task-processor | task processor to do filesystem operations           | fs-task-processor
+/// max-in-memory-file-size | larger files are kept open instead of being read into memory, e.g. to be sent with sendfile(2) by server::handlers::HttpHandlerStatic | unlimited
+/// precompress      | content codings (`gzip`, `zstd`) to compress the in-memory files with once per file version, see server::handlers::HttpHandlerStatic | []
+/// precompress-min-size | smaller files are not precompressed | 1024
 
 // clang-format on
 
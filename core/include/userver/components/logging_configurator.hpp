@@ -13,6 +13,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging {
 struct DynamicDebugConfig;
+struct LogSamplingConfig;
 }
 
 namespace components {
@@ -28,6 +29,7 @@ namespace components {
 ///
 /// ## LoggingConfigurator Dynamic config
 /// * @ref USERVER_LOG_DYNAMIC_DEBUG
+/// * @ref USERVER_LOG_SAMPLING
 /// * @ref USERVER_NO_LOG_SPANS
 ///
 /// ## Static options:
@@ -58,6 +60,7 @@ private:
 
     concurrent::AsyncEventSubscriberScope config_subscription_;
     rcu::Variable<logging::DynamicDebugConfig> dynamic_debug_;
+    rcu::Variable<logging::LogSamplingConfig> log_sampling_;
 };
 
 /// }@
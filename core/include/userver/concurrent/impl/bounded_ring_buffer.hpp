@@ -0,0 +1,202 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+/// @brief Fixed-capacity lock-free MPMC ring buffer (Dmitry Vyukov's design).
+///
+/// Each cell carries a sequence number that tells producers and consumers
+/// whether the cell is free for the current lap, so a push or a pop costs
+/// a single CAS on the shared position in the uncontended case. The buffer is
+/// FIFO with respect to the order in which the positions were claimed.
+///
+/// Only the non-blocking operations are provided, see concurrent::GenericQueue
+/// with QueueMaxSizeMode::kFixedCapacity for the coroutine-aware wrapper.
+template <typename T>
+class BoundedRingBuffer final {
+    // A claimed cell must be published, otherwise the ring stalls forever
+    static_assert(
+        std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+        "BoundedRingBuffer requires nothrow-movable elements"
+    );
+
+public:
+    /// @param capacity is rounded up to a power of 2 (and to at least 2)
+    explicit BoundedRingBuffer(std::size_t capacity)
+        : mask_(RoundUpCapacity(capacity) - 1), cells_(std::make_unique<Cell[]>(mask_ + 1)) {
+        for (std::size_t i = 0; i <= mask_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~BoundedRingBuffer() {
+        T value;
+        while (TryPop(value)) {
+        }
+    }
+
+    BoundedRingBuffer(BoundedRingBuffer&&) = delete;
+    BoundedRingBuffer& operator=(BoundedRingBuffer&&) = delete;
+
+    std::size_t GetCapacity() const noexcept { return mask_ + 1; }
+
+    std::size_t GetSizeApproximate() const noexcept {
+        const auto dequeue_pos = dequeue_pos_->load(std::memory_order_relaxed);
+        const auto enqueue_pos = enqueue_pos_->load(std::memory_order_relaxed);
+        return enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0;
+    }
+
+    /// Leaves the `value` unmodified if the buffer is full
+    [[nodiscard]] bool TryPush(T&& value) noexcept {
+        auto pos = enqueue_pos_->load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[pos & mask_];
+            const auto diff = Distance(cell.sequence.load(std::memory_order_acquire), pos);
+            if (diff == 0) {
+                if (enqueue_pos_->compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.Construct(std::move(value));
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // The cell still holds the value from the previous lap
+                return false;
+            } else {
+                pos = enqueue_pos_->load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    [[nodiscard]] bool TryPop(T& value) noexcept {
+        auto pos = dequeue_pos_->load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[pos & mask_];
+            const auto diff = Distance(cell.sequence.load(std::memory_order_acquire), pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_->compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.Extract(value);
+                    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // The cell is not published yet
+                return false;
+            } else {
+                pos = dequeue_pos_->load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Pushes a prefix of `[first, first + count)` claiming all the cells with
+    /// a single CAS. The pushed elements are moved out.
+    /// @returns the length of the pushed prefix
+    template <typename Iterator>
+    [[nodiscard]] std::size_t TryPushMany(Iterator first, std::size_t count) noexcept {
+        if (count == 0) return 0;
+
+        auto pos = enqueue_pos_->load(std::memory_order_relaxed);
+        while (true) {
+            // A free cell of the current lap can only be taken by the owner of
+            // its position, so the cells stay free until the CAS below
+            std::size_t free_count = 0;
+            while (free_count < count &&
+                   Distance(cells_[(pos + free_count) & mask_].sequence.load(std::memory_order_acquire),
+                            pos + free_count) == 0) {
+                ++free_count;
+            }
+            if (free_count == 0) {
+                const auto diff = Distance(cells_[pos & mask_].sequence.load(std::memory_order_acquire), pos);
+                if (diff < 0) return 0;
+                pos = enqueue_pos_->load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (enqueue_pos_->compare_exchange_weak(pos, pos + free_count, std::memory_order_relaxed)) {
+                for (std::size_t i = 0; i < free_count; ++i, ++first) {
+                    Cell& cell = cells_[(pos + i) & mask_];
+                    cell.Construct(std::move(*first));
+                    cell.sequence.store(pos + i + 1, std::memory_order_release);
+                }
+                return free_count;
+            }
+        }
+    }
+
+    /// Pops up to `count` elements into `[first, first + count)` claiming all
+    /// the cells with a single CAS.
+    /// @returns the number of popped elements
+    template <typename Iterator>
+    [[nodiscard]] std::size_t TryPopMany(Iterator first, std::size_t count) noexcept {
+        if (count == 0) return 0;
+
+        auto pos = dequeue_pos_->load(std::memory_order_relaxed);
+        while (true) {
+            std::size_t ready_count = 0;
+            while (ready_count < count &&
+                   Distance(cells_[(pos + ready_count) & mask_].sequence.load(std::memory_order_acquire),
+                            pos + ready_count + 1) == 0) {
+                ++ready_count;
+            }
+            if (ready_count == 0) {
+                const auto diff = Distance(cells_[pos & mask_].sequence.load(std::memory_order_acquire), pos + 1);
+                if (diff < 0) return 0;
+                pos = dequeue_pos_->load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (dequeue_pos_->compare_exchange_weak(pos, pos + ready_count, std::memory_order_relaxed)) {
+                for (std::size_t i = 0; i < ready_count; ++i, ++first) {
+                    Cell& cell = cells_[(pos + i) & mask_];
+                    cell.Extract(*first);
+                    cell.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+                }
+                return ready_count;
+            }
+        }
+    }
+
+private:
+    struct Cell final {
+        void Construct(T&& value) noexcept { ::new (static_cast<void*>(&storage)) T(std::move(value)); }
+
+        void Extract(T& value) noexcept {
+            T* const stored = std::launder(reinterpret_cast<T*>(&storage));
+            value = std::move(*stored);
+            stored->~T();
+        }
+
+        std::atomic<std::size_t> sequence{0};
+        std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+    };
+
+    static std::ptrdiff_t Distance(std::size_t sequence, std::size_t pos) noexcept {
+        return static_cast<std::ptrdiff_t>(sequence - pos);
+    }
+
+    static std::size_t RoundUpCapacity(std::size_t capacity) {
+        UINVARIANT(capacity <= std::numeric_limits<std::size_t>::max() / 4, "Ring buffer capacity is too big");
+        std::size_t result = 2;
+        while (result < capacity) result *= 2;
+        return result;
+    }
+
+    const std::size_t mask_;
+    const std::unique_ptr<Cell[]> cells_;
+    InterferenceShield<std::atomic<std::size_t>> enqueue_pos_{0};
+    InterferenceShield<std::atomic<std::size_t>> dequeue_pos_{0};
+};
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
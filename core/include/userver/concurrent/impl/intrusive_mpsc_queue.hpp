@@ -105,6 +105,11 @@ public:
 
     void Push(T& node) noexcept { impl_.Push(IntrusiveMpscQueueImpl::NodeRef{&node}); }
 
+    // See IntrusiveMpscQueueImpl::GetBackAndPush
+    T* GetBackAndPush(T& node) noexcept {
+        return static_cast<T*>(impl_.GetBackAndPush(IntrusiveMpscQueueImpl::NodeRef{&node}));
+    }
+
     T* TryPopBlocking() noexcept { return static_cast<T*>(impl_.TryPopBlocking()); }
 
     T* TryPopWeak() noexcept { return static_cast<T*>(impl_.TryPopWeak()); }
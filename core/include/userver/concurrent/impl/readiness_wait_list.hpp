@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include <userver/engine/impl/context_accessor.hpp>
+#include <userver/engine/impl/wait_list_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+/// @brief Lets engine::WaitAny wait for a queue to become ready for a pop.
+///
+/// Only the engine::WaitAny callers are stored here. A wakeup does not consume
+/// an element, so all of them are woken up on each notification. Notifying is
+/// a single atomic load if nobody waits.
+class ReadinessWaitList final : public engine::impl::ContextAccessor {
+public:
+    /// Should return `true` if a pop will not block, i.e. there are elements in
+    /// the queue or all the producers are dead.
+    using IsReadyFunc = bool (*)(const void* queue) noexcept;
+
+    ReadinessWaitList(IsReadyFunc is_ready, const void* queue) noexcept;
+
+    ReadinessWaitList(ReadinessWaitList&&) = delete;
+    ReadinessWaitList& operator=(ReadinessWaitList&&) = delete;
+    ~ReadinessWaitList();
+
+    /// Must be called after each state change that may make the queue ready.
+    void NotifyAll();
+
+    bool IsReady() const noexcept override;
+    engine::impl::EarlyWakeup TryAppendWaiter(engine::impl::TaskContext& waiter) override;
+    void RemoveWaiter(engine::impl::TaskContext& waiter) noexcept override;
+    void AfterWait() noexcept override;
+    void RethrowErrorResult() const override;
+
+private:
+    const IsReadyFunc is_ready_;
+    const void* const queue_;
+    std::atomic<std::size_t> waiters_count_{0};
+    engine::impl::FastPimplWaitList waiters_;
+};
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
@@ -52,6 +52,13 @@ public:
     /// unexpectedly not being visible to `IsFree`.
     StripedReadIndicatorLock Lock() noexcept;
 
+    /// @brief Same as `Lock`, for the users that cannot keep the lock object
+    /// around, e.g. shared mutexes. Must be paired with `UnlockManually`.
+    void LockManually() noexcept { DoLock(); }
+
+    /// @brief Drops a lock taken by `LockManually`.
+    void UnlockManually() noexcept { DoUnlock(); }
+
     /// @returns `true` if there are no locks held on the `StripedReadIndicator`.
     /// @note `IsFree` should only be called after direct access to this
     /// StripedReadIndicator is closed for readers. Locks acquired during
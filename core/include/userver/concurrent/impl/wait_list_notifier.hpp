@@ -0,0 +1,51 @@
+#pragma once
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/impl/wait_list_fwd.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+/// @brief Parks coroutines until an operation on a lock-free structure
+/// succeeds.
+///
+/// The operation is retried under the wait list lock before going to sleep,
+/// so a notification issued after the state change that lets the operation
+/// succeed is never lost. Notifying is a single atomic load if nobody waits,
+/// and may be done from non-coroutine threads.
+class WaitListNotifier final {
+public:
+    WaitListNotifier() noexcept;
+
+    WaitListNotifier(WaitListNotifier&&) = delete;
+    WaitListNotifier& operator=(WaitListNotifier&&) = delete;
+    ~WaitListNotifier();
+
+    /// Calls `try_action` until it returns `true`, sleeping between the
+    /// attempts. `try_action` must not throw.
+    /// @returns `false` on timeout or task cancellation
+    template <typename Action>
+    [[nodiscard]] bool WaitUntil(engine::Deadline deadline, Action&& try_action) {
+        if (try_action()) return true;
+        return WaitUntilSlowPath(deadline, try_action);
+    }
+
+    /// Wakes up a single waiter, if any
+    void NotifyOne();
+
+    /// Wakes up all the waiters
+    void NotifyAll();
+
+private:
+    class WaitStrategy;
+
+    bool WaitUntilSlowPath(engine::Deadline deadline, utils::function_ref<bool()> try_action);
+
+    engine::impl::FastPimplWaitList waiters_;
+};
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 #include <memory>
 
 #include <userver/concurrent/impl/intrusive_mpsc_queue.hpp>
+#include <userver/concurrent/impl/readiness_wait_list.hpp>
 #include <userver/concurrent/impl/semaphore_capacity_control.hpp>
 #include <userver/concurrent/queue_helpers.hpp>
 #include <userver/engine/deadline.hpp>
@@ -126,6 +127,13 @@ private:
     void MarkConsumerIsDead();
     void MarkProducerIsDead();
 
+    engine::impl::ContextAccessor* GetConsumerContextAccessor() noexcept { return &readiness_; }
+
+    static bool IsReadyForPop(const void* queue) noexcept {
+        const auto& self = *static_cast<const MpscQueue*>(queue);
+        return self.size_ != 0 || self.NoMoreProducers();
+    }
+
     bool NoMoreProducers() const { return producer_is_created_ && producers_count_ == 0; }
     bool NoMoreConsumers() const { return consumer_is_created_and_dead_; }
 
@@ -138,6 +146,7 @@ private:
     std::atomic<bool> producer_is_created_{false};
     std::atomic<size_t> producers_count_{0};
     std::atomic<size_t> size_{0};
+    impl::ReadinessWaitList readiness_{&IsReadyForPop, this};
 };
 
 template <typename T>
@@ -210,6 +219,7 @@ bool MpscQueue<T>::DoPush(ProducerToken& /*unused*/, T&& value) {
 
     ++size_;
     nonempty_event_.Send();
+    readiness_.NotifyAll();
 
     return true;
 }
@@ -263,6 +273,7 @@ template <typename T>
 void MpscQueue<T>::MarkProducerIsDead() {
     if (--producers_count_ == 0) {
         nonempty_event_.Send();
+        readiness_.NotifyAll();
     }
 }
 
@@ -4,12 +4,14 @@
 /// @brief @copybrief concurrent::MutexSet
 
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <string>
-#include <unordered_set>
+#include <unordered_map>
 #include <utility>
 
 #include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utils/cached_hash.hpp>
@@ -21,17 +23,159 @@ namespace concurrent {
 
 namespace impl {
 
+enum class LockMode { kExclusive, kShared };
+
 template <typename T, typename Equal>
 struct MutexDatum final {
-    explicit MutexDatum(size_t way_size, const Equal& equal = Equal{}) : set(way_size, {}, equal) {}
+    struct LockState final {
+        bool is_locked{false};
+        std::size_t readers{0};
+        std::size_t waiters{0};
+        std::size_t waiting_writers{0};
+    };
+
+    using Map = std::unordered_map<T, LockState, std::hash<T>, Equal>;
+
+    explicit MutexDatum(size_t way_size, const Equal& equal = Equal{}) : states(way_size, {}, equal) {}
 
-    ~MutexDatum() { UASSERT_MSG(set.empty(), "MutexDatum is destroyed while someone is holding the lock"); }
+    ~MutexDatum() { UASSERT_MSG(states.empty(), "MutexDatum is destroyed while someone is holding the lock"); }
+
+    bool Lock(const T& key, LockMode mode, engine::Deadline deadline);
+    bool TryLock(const T& key, LockMode mode);
+    void Unlock(const T& key, LockMode mode);
 
     engine::Mutex mutex;
     engine::ConditionVariable cv;
-    std::unordered_set<T, std::hash<T>, Equal> set;
+    Map states;
+
+    // A node of an unlocked key is kept to avoid an allocation on the next
+    // lock of an uncontended key
+    typename Map::node_type spare_node;
+
+private:
+    LockState& GetState(const T& key);
+    void EraseIfUnused(typename Map::iterator it, typename Map::node_type& erased_node);
 };
 
+template <typename T, typename Equal>
+bool TryAcquire(typename MutexDatum<T, Equal>::LockState& state, LockMode mode, bool is_waiting) {
+    if (state.is_locked) return false;
+    if (mode == LockMode::kExclusive) {
+        if (state.readers != 0) return false;
+        state.is_locked = true;
+    } else {
+        // Writers are preferred, otherwise a stream of readers starves them
+        if (state.waiting_writers != 0) return false;
+        ++state.readers;
+    }
+
+    if (is_waiting) {
+        --state.waiters;
+        if (mode == LockMode::kExclusive) --state.waiting_writers;
+    }
+    return true;
+}
+
+template <typename T, typename Equal>
+bool MutexDatum<T, Equal>::Lock(const T& key, LockMode mode, engine::Deadline deadline) {
+    std::unique_lock lock(mutex);
+    // The entry is not erased while there are waiters, so the reference
+    // stays valid through the waits
+    auto& state = GetState(key);
+    if (TryAcquire<T, Equal>(state, mode, false)) return true;
+
+    ++state.waiters;
+    if (mode == LockMode::kExclusive) ++state.waiting_writers;
+
+    if (cv.WaitUntil(lock, deadline, [&state, mode] { return TryAcquire<T, Equal>(state, mode, true); })) {
+        return true;
+    }
+
+    --state.waiters;
+    const bool unblocks_readers = mode == LockMode::kExclusive && --state.waiting_writers == 0;
+
+    typename Map::node_type erased_node;
+    EraseIfUnused(states.find(key), erased_node);
+    lock.unlock();
+
+    if (unblocks_readers) cv.NotifyAll();
+    return false;
+}
+
+template <typename T, typename Equal>
+bool MutexDatum<T, Equal>::TryLock(const T& key, LockMode mode) {
+    std::unique_lock lock(mutex);
+    auto& state = GetState(key);
+    if (TryAcquire<T, Equal>(state, mode, false)) return true;
+
+    typename Map::node_type erased_node;
+    EraseIfUnused(states.find(key), erased_node);
+    return false;
+}
+
+template <typename T, typename Equal>
+void MutexDatum<T, Equal>::Unlock(const T& key, LockMode mode) {
+    // Forcing the destructor of the node to run outside of the critical section
+    typename Map::node_type erased_node;
+
+    std::unique_lock lock(mutex);
+    const auto it = states.find(key);
+    UASSERT(it != states.end());
+    auto& state = it->second;
+
+    if (mode == LockMode::kExclusive) {
+        UASSERT(state.is_locked);
+        state.is_locked = false;
+    } else {
+        UASSERT(state.readers != 0);
+        --state.readers;
+    }
+
+    // Only the waiters of this key may proceed, so the uncontended unlock
+    // does not wake up the waiters of the other keys of the way
+    const bool should_notify = state.waiters != 0 && state.readers == 0;
+    EraseIfUnused(it, erased_node);
+    lock.unlock();
+
+    // We must wakeup all the waiters, because otherwise we can wake up the wrong
+    // one and loose the wakeup:
+    //
+    // Task #1 waits for mutex A, task #2 waits for mutex B
+    // Task #3
+    //  * unlocks mutex A
+    //  * does NotifyOne
+    //  * wakeups thread #2
+    //  * mutex B is still locked, task #2 goes to sleep
+    //  * we lost the wakeup :(
+    //
+    // Notifying outside of the critical section saves the woken up waiters
+    // from blocking on the mutex right away.
+    if (should_notify) cv.NotifyAll();
+}
+
+template <typename T, typename Equal>
+typename MutexDatum<T, Equal>::LockState& MutexDatum<T, Equal>::GetState(const T& key) {
+    if (spare_node.empty()) return states.try_emplace(key).first->second;
+
+    spare_node.key() = key;
+    spare_node.mapped() = LockState{};
+    auto result = states.insert(std::move(spare_node));
+    spare_node = std::move(result.node);
+    return result.position->second;
+}
+
+template <typename T, typename Equal>
+void MutexDatum<T, Equal>::EraseIfUnused(typename Map::iterator it, typename Map::node_type& erased_node) {
+    const auto& state = it->second;
+    if (state.is_locked || state.readers != 0 || state.waiters != 0) return;
+
+    if (spare_node.empty()) {
+        spare_node = states.extract(it);
+    } else {
+        erased_node = states.extract(it);
+    }
+}
+
 }  // namespace impl
 
 /// Mutex-like object associated with the key of a MutexSet. It provides the
@@ -64,8 +208,51 @@ public:
     bool try_lock_until(std::chrono::time_point<Clock, Duration>);
 
 private:
-    bool TryFinishLocking();
+    MutexDatum& md_;
+    const HashAndKey key_;
+};
+
+/// Shared-mutex-like object associated with the key of a SharedMutexSet. It
+/// provides the same interface as engine::SharedMutex, you may use it with
+/// std::unique_lock, std::shared_lock, etc.
+///
+/// Writers are preferred: while a writer waits for the key, new readers wait
+/// too.
+/// @note can be used only from coroutines.
+template <typename Key, typename Equal>
+class SharedItemMutex final {
+public:
+    using HashAndKey = utils::CachedHash<Key>;
+
+    using MutexDatum = impl::MutexDatum<HashAndKey, utils::CachedHashKeyEqual<Equal>>;
+
+    SharedItemMutex(MutexDatum& md, HashAndKey&& key);
 
+    void lock();
+
+    void unlock();
+
+    bool try_lock();
+
+    template <typename Rep, typename Period>
+    bool try_lock_for(std::chrono::duration<Rep, Period>);
+
+    template <typename Clock, typename Duration>
+    bool try_lock_until(std::chrono::time_point<Clock, Duration>);
+
+    void lock_shared();
+
+    void unlock_shared();
+
+    bool try_lock_shared();
+
+    template <typename Rep, typename Period>
+    bool try_lock_shared_for(std::chrono::duration<Rep, Period>);
+
+    template <typename Clock, typename Duration>
+    bool try_lock_shared_until(std::chrono::time_point<Clock, Duration>);
+
+private:
     MutexDatum& md_;
     const HashAndKey key_;
 };
@@ -78,8 +265,14 @@ private:
 /// multiple keys when the key set is not known at compile time and may change
 /// in runtime.
 ///
+/// Locking of a key that is not locked by anyone does not allocate after the
+/// warm-up, and unlocking of a key without waiters does not wake up the
+/// waiters of the other keys.
+///
 /// Example:
 /// @snippet src/concurrent/mutex_set_test.cpp  Sample mutex set usage
+///
+/// @see concurrent::SharedMutexSet for the reader/writer locks
 template <typename Key = std::string, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
 class MutexSet final : Hash {
 public:
@@ -95,20 +288,66 @@ private:
     utils::FixedArray<MutexDatum> mutex_data_;
 };
 
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief A dynamic set of reader/writer mutexes, works like
+/// concurrent::MutexSet
+template <typename Key = std::string, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+class SharedMutexSet final : Hash {
+public:
+    explicit SharedMutexSet(
+        size_t ways = 1,
+        size_t way_size = 1,
+        const Hash& hash = Hash{},
+        const Equal& equal = Equal{}
+    );
+
+    /// Get the shared-mutex-like object for a key. Coroutine-safe.
+    /// @note the returned object holds a reference to SharedMutexSet, so make
+    ///       sure that SharedMutexSet is alive while you're working with
+    ///       SharedItemMutex.
+    SharedItemMutex<Key, Equal> GetMutexForKey(Key key);
+
+private:
+    using MutexDatum = typename SharedItemMutex<Key, Equal>::MutexDatum;
+    utils::FixedArray<MutexDatum> mutex_data_;
+};
+
+namespace impl {
+
+template <typename Hash, typename Key, typename MutexDatum>
+std::pair<MutexDatum&, utils::CachedHash<Key>>
+GetWayAndKey(const Hash& hash, utils::FixedArray<MutexDatum>& mutex_data, Key key) {
+    const auto hash_value = hash(key);
+    const auto size = mutex_data.size();
+
+    // Compilers optimize a % b and a / b to a single div operation
+    const auto way = hash_value % size;
+    const auto new_hash = hash_value / size;
+
+    return {mutex_data[way], {new_hash, std::move(key)}};
+}
+
+}  // namespace impl
+
 template <typename Key, typename Hash, typename Equal>
 MutexSet<Key, Hash, Equal>::MutexSet(size_t ways, size_t way_size, const Hash& hash, const Equal& equal)
     : Hash(hash), mutex_data_(ways, way_size, utils::CachedHashKeyEqual<Equal>{equal}) {}
 
 template <typename Key, typename Hash, typename Equal>
 ItemMutex<Key, Equal> MutexSet<Key, Hash, Equal>::GetMutexForKey(Key key) {
-    const auto hash_value = Hash::operator()(key);
-    const auto size = mutex_data_.size();
+    auto [md, hash_and_key] = impl::GetWayAndKey(static_cast<const Hash&>(*this), mutex_data_, std::move(key));
+    return ItemMutex<Key, Equal>(md, std::move(hash_and_key));
+}
 
-    // Compilers optimize a % b and a / b to a single div operation
-    const auto way = hash_value % size;
-    const auto new_hash = hash_value / size;
+template <typename Key, typename Hash, typename Equal>
+SharedMutexSet<Key, Hash, Equal>::SharedMutexSet(size_t ways, size_t way_size, const Hash& hash, const Equal& equal)
+    : Hash(hash), mutex_data_(ways, way_size, utils::CachedHashKeyEqual<Equal>{equal}) {}
 
-    return ItemMutex<Key, Equal>(mutex_data_[way], {new_hash, std::move(key)});
+template <typename Key, typename Hash, typename Equal>
+SharedItemMutex<Key, Equal> SharedMutexSet<Key, Hash, Equal>::GetMutexForKey(Key key) {
+    auto [md, hash_and_key] = impl::GetWayAndKey(static_cast<const Hash&>(*this), mutex_data_, std::move(key));
+    return SharedItemMutex<Key, Equal>(md, std::move(hash_and_key));
 }
 
 template <typename Key, typename Equal>
@@ -117,59 +356,91 @@ ItemMutex<Key, Equal>::ItemMutex(MutexDatum& md, HashAndKey&& key) : md_(md), ke
 template <typename Key, typename Equal>
 void ItemMutex<Key, Equal>::lock() {
     engine::TaskCancellationBlocker blocker;
-    std::unique_lock<engine::Mutex> lock(md_.mutex);
-
-    [[maybe_unused]] auto is_locked = md_.cv.Wait(lock, [this] { return TryFinishLocking(); });
+    [[maybe_unused]] auto is_locked = md_.Lock(key_, impl::LockMode::kExclusive, {});
     UASSERT(is_locked);
 }
 
 template <typename Key, typename Equal>
 void ItemMutex<Key, Equal>::unlock() {
-    std::unique_lock lock(md_.mutex);
+    md_.Unlock(key_, impl::LockMode::kExclusive);
+}
 
-    // Forcing the destructor of the node to run outside of the critical section
-    [[maybe_unused]] auto node = md_.set.extract(key_);
+template <typename Key, typename Equal>
+bool ItemMutex<Key, Equal>::try_lock() {
+    return md_.TryLock(key_, impl::LockMode::kExclusive);
+}
 
-    // We must wakeup all the waiters, because otherwise we can wake up the wrong
-    // one and loose the wakeup:
-    //
-    // Task #1 waits for mutex A, task #2 waits for mutex B
-    // Task #3
-    //  * unlocks mutex A
-    //  * does NotifyOne
-    //  * wakeups thread #2
-    //  * mutex B is still locked, task #2 goes to sleep
-    //  * we lost the wakeup :(
-    md_.cv.NotifyAll();
+template <typename Key, typename Equal>
+template <typename Rep, typename Period>
+bool ItemMutex<Key, Equal>::try_lock_for(std::chrono::duration<Rep, Period> duration) {
+    return md_.Lock(key_, impl::LockMode::kExclusive, engine::Deadline::FromDuration(duration));
+}
 
-    lock.unlock();
+template <typename Key, typename Equal>
+template <typename Clock, typename Duration>
+bool ItemMutex<Key, Equal>::try_lock_until(std::chrono::time_point<Clock, Duration> time_point) {
+    return md_.Lock(key_, impl::LockMode::kExclusive, engine::Deadline::FromTimePoint(time_point));
+}
 
-    // Destructor of node is run here
+template <typename Key, typename Equal>
+SharedItemMutex<Key, Equal>::SharedItemMutex(MutexDatum& md, HashAndKey&& key) : md_(md), key_(std::move(key)) {}
+
+template <typename Key, typename Equal>
+void SharedItemMutex<Key, Equal>::lock() {
+    engine::TaskCancellationBlocker blocker;
+    [[maybe_unused]] auto is_locked = md_.Lock(key_, impl::LockMode::kExclusive, {});
+    UASSERT(is_locked);
 }
 
 template <typename Key, typename Equal>
-bool ItemMutex<Key, Equal>::try_lock() {
-    std::unique_lock<engine::Mutex> lock(md_.mutex);
-    return TryFinishLocking();
+void SharedItemMutex<Key, Equal>::unlock() {
+    md_.Unlock(key_, impl::LockMode::kExclusive);
+}
+
+template <typename Key, typename Equal>
+bool SharedItemMutex<Key, Equal>::try_lock() {
+    return md_.TryLock(key_, impl::LockMode::kExclusive);
 }
 
 template <typename Key, typename Equal>
 template <typename Rep, typename Period>
-bool ItemMutex<Key, Equal>::try_lock_for(std::chrono::duration<Rep, Period> duration) {
-    std::unique_lock<engine::Mutex> lock(md_.mutex);
-    return md_.cv.WaitFor(lock, duration, [this] { return TryFinishLocking(); });
+bool SharedItemMutex<Key, Equal>::try_lock_for(std::chrono::duration<Rep, Period> duration) {
+    return md_.Lock(key_, impl::LockMode::kExclusive, engine::Deadline::FromDuration(duration));
 }
 
 template <typename Key, typename Equal>
 template <typename Clock, typename Duration>
-bool ItemMutex<Key, Equal>::try_lock_until(std::chrono::time_point<Clock, Duration> time_point) {
-    std::unique_lock<engine::Mutex> lock(md_.mutex);
-    return md_.cv.WaitUntil(lock, time_point, [this] { return TryFinishLocking(); });
+bool SharedItemMutex<Key, Equal>::try_lock_until(std::chrono::time_point<Clock, Duration> time_point) {
+    return md_.Lock(key_, impl::LockMode::kExclusive, engine::Deadline::FromTimePoint(time_point));
+}
+
+template <typename Key, typename Equal>
+void SharedItemMutex<Key, Equal>::lock_shared() {
+    engine::TaskCancellationBlocker blocker;
+    [[maybe_unused]] auto is_locked = md_.Lock(key_, impl::LockMode::kShared, {});
+    UASSERT(is_locked);
 }
 
 template <typename Key, typename Equal>
-bool ItemMutex<Key, Equal>::TryFinishLocking() {
-    return md_.set.insert(key_).second;
+void SharedItemMutex<Key, Equal>::unlock_shared() {
+    md_.Unlock(key_, impl::LockMode::kShared);
+}
+
+template <typename Key, typename Equal>
+bool SharedItemMutex<Key, Equal>::try_lock_shared() {
+    return md_.TryLock(key_, impl::LockMode::kShared);
+}
+
+template <typename Key, typename Equal>
+template <typename Rep, typename Period>
+bool SharedItemMutex<Key, Equal>::try_lock_shared_for(std::chrono::duration<Rep, Period> duration) {
+    return md_.Lock(key_, impl::LockMode::kShared, engine::Deadline::FromDuration(duration));
+}
+
+template <typename Key, typename Equal>
+template <typename Clock, typename Duration>
+bool SharedItemMutex<Key, Equal>::try_lock_shared_until(std::chrono::time_point<Clock, Duration> time_point) {
+    return md_.Lock(key_, impl::LockMode::kShared, engine::Deadline::FromTimePoint(time_point));
 }
 
 }  // namespace concurrent
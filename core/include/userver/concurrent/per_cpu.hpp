@@ -0,0 +1,138 @@
+#pragma once
+
+/// @file userver/concurrent/per_cpu.hpp
+/// @brief @copybrief concurrent::PerCpu
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <userver/utils/fast_pimpl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+/// The way concurrent::PerCpu combines the values
+enum class PerCpuOp {
+    kSum,  ///< sum of the values, wraps around on overflow
+    kMin,  ///< minimum of the values
+    kMax,  ///< maximum of the values
+};
+
+namespace impl {
+
+/// Type-erased storage of concurrent::PerCpu, the values are encoded so that
+/// the order of `std::intptr_t` matches the order of the original values.
+class PerCpuWords final {
+public:
+    explicit PerCpuWords(std::intptr_t identity);
+    ~PerCpuWords();
+
+    PerCpuWords(PerCpuWords&&) = delete;
+    PerCpuWords& operator=(PerCpuWords&&) = delete;
+
+    void Add(std::intptr_t value) noexcept;
+    void UpdateMin(std::intptr_t value) noexcept;
+    void UpdateMax(std::intptr_t value) noexcept;
+
+    std::intptr_t ReadSum() const noexcept;
+    std::intptr_t ReadMin() const noexcept;
+    std::intptr_t ReadMax() const noexcept;
+
+    void Reset() noexcept;
+
+private:
+    struct Impl;
+    utils::FastPimpl<Impl, 32, 8> impl_;
+};
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief A contention-free per-CPU accumulator of integral values, with
+/// memory consumption and read performance traded for write performance.
+///
+/// Works like concurrent::StripedCounter, but also supports combining the
+/// values with a minimum or a maximum. Update does not write to the cache
+/// lines shared with other CPUs, the per-CPU values are combined only on Read,
+/// e.g. when the metrics are collected.
+///
+/// @note Depending on the underlying platform is implemented either via a
+/// single atomic variable, or via rseq-based per-CPU values.
+template <typename T, PerCpuOp Op = PerCpuOp::kSum>
+class PerCpu final {
+    static_assert(
+        std::is_integral_v<T> && !std::is_same_v<T, bool>,
+        "only integral value types are supported in concurrent::PerCpu"
+    );
+    static_assert(sizeof(T) <= sizeof(std::intptr_t), "T does not fit in a per-CPU word");
+
+public:
+    /// @brief Constructs an accumulator with no values, Read returns 0 for
+    /// PerCpuOp::kSum, and the max or the min value of `T` for PerCpuOp::kMin
+    /// or PerCpuOp::kMax respectively.
+    PerCpu() : words_(Encode(kIdentity)) {}
+
+    /// @brief Accounts the value, the update is done with a relaxed memory
+    /// order.
+    void Update(T value) noexcept {
+        if constexpr (Op == PerCpuOp::kSum) {
+            words_.Add(Encode(value));
+        } else if constexpr (Op == PerCpuOp::kMin) {
+            words_.UpdateMin(Encode(value));
+        } else {
+            words_.UpdateMax(Encode(value));
+        }
+    }
+
+    /// @brief Combines the per-CPU values, read is approx. `nproc` times slower
+    /// than Update.
+    T Read() const noexcept {
+        if constexpr (Op == PerCpuOp::kSum) {
+            return Decode(words_.ReadSum());
+        } else if constexpr (Op == PerCpuOp::kMin) {
+            return Decode(words_.ReadMin());
+        } else {
+            return Decode(words_.ReadMax());
+        }
+    }
+
+    /// @brief Drops the accounted values.
+    /// @note Not atomic with respect to concurrent Update calls.
+    void Reset() noexcept { words_.Reset(); }
+
+private:
+    static constexpr T kIdentity = Op == PerCpuOp::kSum   ? T{0}
+                                   : Op == PerCpuOp::kMin ? std::numeric_limits<T>::max()
+                                                          : std::numeric_limits<T>::min();
+
+    // Flipping the sign bit keeps the order of unsigned values that do not fit
+    // into std::intptr_t. Sums are not affected, as they wrap around anyway.
+    static constexpr bool kFlipSignBit =
+        Op != PerCpuOp::kSum && std::is_unsigned_v<T> && sizeof(T) == sizeof(std::intptr_t);
+    static constexpr auto kSignBit = std::uintptr_t{1} << (sizeof(std::uintptr_t) * 8 - 1);
+
+    static std::intptr_t Encode(T value) noexcept {
+        if constexpr (kFlipSignBit) {
+            return static_cast<std::intptr_t>(static_cast<std::uintptr_t>(value) ^ kSignBit);
+        } else {
+            return static_cast<std::intptr_t>(value);
+        }
+    }
+
+    static T Decode(std::intptr_t word) noexcept {
+        if constexpr (kFlipSignBit) {
+            return static_cast<T>(static_cast<std::uintptr_t>(word) ^ kSignBit);
+        } else {
+            return static_cast<T>(word);
+        }
+    }
+
+    impl::PerCpuWords words_;
+};
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
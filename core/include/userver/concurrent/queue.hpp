@@ -9,7 +9,10 @@
 
 #include <moodycamel/concurrentqueue.h>
 
+#include <userver/concurrent/impl/bounded_ring_buffer.hpp>
+#include <userver/concurrent/impl/readiness_wait_list.hpp>
 #include <userver/concurrent/impl/semaphore_capacity_control.hpp>
+#include <userver/concurrent/impl/wait_list_notifier.hpp>
 #include <userver/concurrent/queue_helpers.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/semaphore.hpp>
@@ -17,6 +20,7 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/atomic.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -33,6 +37,13 @@ enum class QueueMaxSizeMode {
     /// Supports dynamically changing max size; supports awaiting non-fullness
     /// in producers. Slightly slower than @ref kNone.
     kDynamicSync,
+
+    /// The max size is fixed on creation and is rounded up to a power of 2.
+    /// Elements are stored in a preallocated lock-free ring buffer, which
+    /// makes the queue FIFO even with multiple producers and avoids counting
+    /// the capacity separately from the storage. Supports awaiting
+    /// non-fullness in producers. `GetElementSize` is ignored.
+    kFixedCapacity,
 };
 
 /// @brief The default queue policy for @ref GenericQueue.
@@ -99,6 +110,13 @@ struct ContainerQueuePolicy : public DefaultQueuePolicy {
     static constexpr bool kIsMultipleConsumer{MultipleConsumer};
 };
 
+template <bool MultipleProducer, bool MultipleConsumer>
+struct FixedCapacityQueuePolicy : public DefaultQueuePolicy {
+    static constexpr bool kIsMultipleProducer{MultipleProducer};
+    static constexpr bool kIsMultipleConsumer{MultipleConsumer};
+    static constexpr auto kMaxSizeMode = QueueMaxSizeMode::kFixedCapacity;
+};
+
 }  // namespace impl
 
 /// @brief Queue with single and multi producer/consumer options.
@@ -110,6 +128,7 @@ struct ContainerQueuePolicy : public DefaultQueuePolicy {
 ///
 /// * concurrent::NonFifoMpmcQueue
 /// * concurrent::NonFifoMpscQueue
+/// * concurrent::BoundedMpmcQueue
 /// * concurrent::SpmcQueue
 /// * concurrent::SpscQueue
 /// * concurrent::UnboundedNonFifoMpscQueue
@@ -131,16 +150,22 @@ class GenericQueue final : public std::enable_shared_from_this<GenericQueue<T, Q
     );
 
     static constexpr QueueMaxSizeMode kMaxSizeMode = QueuePolicy::kMaxSizeMode;
+    static constexpr bool kIsFixedCapacity = kMaxSizeMode == QueueMaxSizeMode::kFixedCapacity;
+
+    // The ring buffer is shared by all the producers and consumers
+    static constexpr bool kUsesMoodycamelTokens = QueuePolicy::kIsMultipleProducer && !kIsFixedCapacity;
+
+    using Storage = std::conditional_t<kIsFixedCapacity, impl::BoundedRingBuffer<T>, moodycamel::ConcurrentQueue<T>>;
 
-    using ProducerToken =
-        std::conditional_t<QueuePolicy::kIsMultipleProducer, moodycamel::ProducerToken, impl::NoToken>;
-    using ConsumerToken =
-        std::conditional_t<QueuePolicy::kIsMultipleProducer, moodycamel::ConsumerToken, impl::NoToken>;
+    using ProducerToken = std::conditional_t<kUsesMoodycamelTokens, moodycamel::ProducerToken, impl::NoToken>;
+    using ConsumerToken = std::conditional_t<kUsesMoodycamelTokens, moodycamel::ConsumerToken, impl::NoToken>;
     using MultiProducerToken = impl::MultiToken;
     using MultiConsumerToken = std::conditional_t<QueuePolicy::kIsMultipleProducer, impl::MultiToken, impl::NoToken>;
 
-    using SingleProducerToken =
-        std::conditional_t<!QueuePolicy::kIsMultipleProducer, moodycamel::ProducerToken, impl::NoToken>;
+    using SingleProducerToken = std::conditional_t<
+        !QueuePolicy::kIsMultipleProducer && !kIsFixedCapacity,
+        moodycamel::ProducerToken,
+        impl::NoToken>;
 
     friend class Producer<GenericQueue, ProducerToken, EmplaceEnabler>;
     friend class Producer<GenericQueue, MultiProducerToken, EmplaceEnabler>;
@@ -160,7 +185,7 @@ public:
     /// @cond
     // For internal use only
     explicit GenericQueue(std::size_t max_size, EmplaceEnabler /*unused*/)
-        : queue_(),
+        : queue_(MakeStorage(max_size)),
           single_producer_token_(queue_),
           producer_side_(*this, std::min(max_size, kUnbounded)),
           consumer_side_(*this) {}
@@ -258,22 +283,39 @@ private:
     class SingleProducerSide;
     class MultiProducerSide;
     class NoMaxSizeProducerSide;
+    class FixedCapacityProducerSide;
     class SingleConsumerSide;
     class MultiConsumerSide;
+    class FixedCapacityConsumerSide;
 
     /// Proxy-class makes synchronization of Push operations in multi or single
     /// producer cases
     using ProducerSide = std::conditional_t<
         kMaxSizeMode == QueueMaxSizeMode::kNone,
         NoMaxSizeProducerSide,
-        std::conditional_t<  //
-            QueuePolicy::kIsMultipleProducer,
-            MultiProducerSide,
-            SingleProducerSide>>;
+        std::conditional_t<
+            kIsFixedCapacity,
+            FixedCapacityProducerSide,
+            std::conditional_t<  //
+                QueuePolicy::kIsMultipleProducer,
+                MultiProducerSide,
+                SingleProducerSide>>>;
 
     /// Proxy-class makes synchronization of Pop operations in multi or single
     /// consumer cases
-    using ConsumerSide = std::conditional_t<QueuePolicy::kIsMultipleConsumer, MultiConsumerSide, SingleConsumerSide>;
+    using ConsumerSide = std::conditional_t<
+        kIsFixedCapacity,
+        FixedCapacityConsumerSide,
+        std::conditional_t<QueuePolicy::kIsMultipleConsumer, MultiConsumerSide, SingleConsumerSide>>;
+
+    static Storage MakeStorage(std::size_t max_size) {
+        if constexpr (kIsFixedCapacity) {
+            UINVARIANT(max_size < kUnbounded, "A queue with QueueMaxSizeMode::kFixedCapacity requires a max size");
+            return Storage(max_size);
+        } else {
+            return Storage();
+        }
+    }
 
     template <typename Token>
     [[nodiscard]] bool Push(Token& token, T&& value, engine::Deadline deadline) {
@@ -299,6 +341,51 @@ private:
         return consumer_side_.PopNoblock(token, value);
     }
 
+    template <typename Token>
+    [[nodiscard]] std::size_t PushMany(Token& token, utils::span<T> values, engine::Deadline deadline) {
+        if constexpr (kIsFixedCapacity) {
+            return producer_side_.PushMany(values, deadline);
+        } else {
+            std::size_t pushed = 0;
+            while (pushed < values.size() && Push(token, std::move(values[pushed]), deadline)) ++pushed;
+            return pushed;
+        }
+    }
+
+    template <typename Token>
+    [[nodiscard]] std::size_t PushManyNoblock(Token& token, utils::span<T> values) {
+        if constexpr (kIsFixedCapacity) {
+            return producer_side_.PushManyNoblock(values);
+        } else {
+            std::size_t pushed = 0;
+            while (pushed < values.size() && PushNoblock(token, std::move(values[pushed]))) ++pushed;
+            return pushed;
+        }
+    }
+
+    template <typename Token>
+    [[nodiscard]] std::size_t PopMany(Token& token, utils::span<T> values, engine::Deadline deadline) {
+        if constexpr (kIsFixedCapacity) {
+            return consumer_side_.PopMany(values, deadline);
+        } else {
+            if (values.empty() || !Pop(token, values[0], deadline)) return 0;
+            std::size_t popped = 1;
+            while (popped < values.size() && PopNoblock(token, values[popped])) ++popped;
+            return popped;
+        }
+    }
+
+    template <typename Token>
+    [[nodiscard]] std::size_t PopManyNoblock(Token& token, utils::span<T> values) {
+        if constexpr (kIsFixedCapacity) {
+            return consumer_side_.PopManyNoblock(values);
+        } else {
+            std::size_t popped = 0;
+            while (popped < values.size() && PopNoblock(token, values[popped])) ++popped;
+            return popped;
+        }
+    }
+
     void PrepareProducer() {
         std::size_t old_producers_count{};
         utils::AtomicUpdate(producers_count_, [&](auto old_value) {
@@ -340,9 +427,17 @@ private:
         });
         if (new_producers_count == kCreatedAndDead) {
             consumer_side_.StopBlockingOnPop();
+            readiness_.NotifyAll();
         }
     }
 
+    engine::impl::ContextAccessor* GetConsumerContextAccessor() noexcept { return &readiness_; }
+
+    static bool IsReadyForPop(const void* queue) noexcept {
+        const auto& self = *static_cast<const GenericQueue*>(queue);
+        return self.consumer_side_.GetElementCount() != 0 || self.NoMoreProducers();
+    }
+
 public:  // TODO
     /// @cond
     bool NoMoreConsumers() const { return consumers_count_ == kCreatedAndDead; }
@@ -366,6 +461,7 @@ private:
         }
 
         consumer_side_.OnElementPushed();
+        readiness_.NotifyAll();
     }
 
     template <typename Token>
@@ -392,7 +488,7 @@ private:
         return false;
     }
 
-    moodycamel::ConcurrentQueue<T> queue_{1};
+    Storage queue_;
     std::atomic<std::size_t> consumers_count_{0};
     std::atomic<std::size_t> producers_count_{0};
 
@@ -400,6 +496,7 @@ private:
 
     ProducerSide producer_side_;
     ConsumerSide consumer_side_;
+    impl::ReadinessWaitList readiness_{&IsReadyForPop, this};
 
     static constexpr std::size_t kCreatedAndDead = std::numeric_limits<std::size_t>::max();
     static constexpr std::size_t kSemaphoreUnlockValue = std::numeric_limits<std::size_t>::max() / 2;
@@ -556,6 +653,88 @@ private:
     GenericQueue& queue_;
 };
 
+template <typename T, typename QueuePolicy>
+class GenericQueue<T, QueuePolicy>::FixedCapacityProducerSide final {
+public:
+    FixedCapacityProducerSide(GenericQueue& queue, std::size_t /*capacity*/) : queue_(queue) {}
+
+    // Blocks if there is a consumer to Pop the current value and task
+    // shouldn't cancel and queue if full
+    template <typename Token>
+    [[nodiscard]] bool Push(Token& /*token*/, T&& value, engine::Deadline deadline, std::size_t /*value_size*/) {
+        bool pushed = false;
+        // Consumers are notified outside of the wait, because the attempts
+        // are made under the wait list lock
+        [[maybe_unused]] const bool success = non_full_.WaitUntil(deadline, [&] {
+            if (queue_.NoMoreConsumers()) return true;
+            pushed = queue_.queue_.TryPush(std::move(value));
+            return pushed;
+        });
+
+        if (pushed) queue_.consumer_side_.OnElementsPushed(1);
+        return pushed;
+    }
+
+    template <typename Token>
+    [[nodiscard]] bool PushNoblock(Token& /*token*/, T&& value, std::size_t /*value_size*/) {
+        if (queue_.NoMoreConsumers() || !queue_.queue_.TryPush(std::move(value))) return false;
+        queue_.consumer_side_.OnElementsPushed(1);
+        return true;
+    }
+
+    [[nodiscard]] std::size_t PushMany(utils::span<T> values, engine::Deadline deadline) {
+        std::size_t pushed = 0;
+        while (pushed < values.size()) {
+            std::size_t batch_size = 0;
+            [[maybe_unused]] const bool success = non_full_.WaitUntil(deadline, [&] {
+                if (queue_.NoMoreConsumers()) return true;
+                batch_size = queue_.queue_.TryPushMany(values.begin() + pushed, values.size() - pushed);
+                return batch_size != 0;
+            });
+            if (batch_size == 0) break;
+
+            // Let the consumers proceed before waiting for more space
+            queue_.consumer_side_.OnElementsPushed(batch_size);
+            pushed += batch_size;
+        }
+        return pushed;
+    }
+
+    [[nodiscard]] std::size_t PushManyNoblock(utils::span<T> values) {
+        if (queue_.NoMoreConsumers()) return 0;
+
+        const auto pushed = queue_.queue_.TryPushMany(values.begin(), values.size());
+        if (pushed != 0) queue_.consumer_side_.OnElementsPushed(pushed);
+        return pushed;
+    }
+
+    void OnElementsPopped(std::size_t count) {
+        if (count == 1) {
+            non_full_.NotifyOne();
+        } else {
+            non_full_.NotifyAll();
+        }
+    }
+
+    void StopBlockingOnPush() { non_full_.NotifyAll(); }
+
+    void ResumeBlockingOnPush() {}
+
+    void SetSoftMaxSize(std::size_t new_capacity) {
+        UINVARIANT(
+            new_capacity == GetSoftMaxSize(), "Cannot change max size of a queue with QueueMaxSizeMode::kFixedCapacity"
+        );
+    }
+
+    std::size_t GetSoftMaxSize() const noexcept { return queue_.queue_.GetCapacity(); }
+
+    std::size_t GetSizeApproximate() const noexcept { return queue_.queue_.GetSizeApproximate(); }
+
+private:
+    GenericQueue& queue_;
+    impl::WaitListNotifier non_full_;
+};
+
 template <typename T, typename QueuePolicy>
 class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
 public:
@@ -674,6 +853,86 @@ private:
     concurrent::impl::SemaphoreCapacityControl element_count_control_;
 };
 
+template <typename T, typename QueuePolicy>
+class GenericQueue<T, QueuePolicy>::FixedCapacityConsumerSide final {
+public:
+    explicit FixedCapacityConsumerSide(GenericQueue& queue) : queue_(queue) {}
+
+    // Blocks only if queue is empty
+    template <typename Token>
+    [[nodiscard]] bool Pop(Token& /*token*/, T& value, engine::Deadline deadline) {
+        bool popped = false;
+        // Producers are notified outside of the wait, because the attempts
+        // are made under the wait list lock
+        [[maybe_unused]] const bool success = non_empty_.WaitUntil(deadline, [&] {
+            popped = queue_.queue_.TryPop(value);
+            if (popped) return true;
+            if (queue_.NoMoreProducers()) {
+                // Producer might have pushed something in queue between .pop()
+                // and !producer_is_created_and_dead_ check. Check twice to avoid
+                // TOCTOU.
+                popped = queue_.queue_.TryPop(value);
+                return true;
+            }
+            return false;
+        });
+
+        if (popped) queue_.producer_side_.OnElementsPopped(1);
+        return popped;
+    }
+
+    template <typename Token>
+    [[nodiscard]] bool PopNoblock(Token& /*token*/, T& value) {
+        if (!queue_.queue_.TryPop(value)) return false;
+        queue_.producer_side_.OnElementsPopped(1);
+        return true;
+    }
+
+    [[nodiscard]] std::size_t PopMany(utils::span<T> values, engine::Deadline deadline) {
+        if (values.empty()) return 0;
+
+        std::size_t popped = 0;
+        [[maybe_unused]] const bool success = non_empty_.WaitUntil(deadline, [&] {
+            popped = queue_.queue_.TryPopMany(values.begin(), values.size());
+            if (popped != 0) return true;
+            if (queue_.NoMoreProducers()) {
+                // Same TOCTOU as in Pop
+                popped = queue_.queue_.TryPopMany(values.begin(), values.size());
+                return true;
+            }
+            return false;
+        });
+
+        if (popped != 0) queue_.producer_side_.OnElementsPopped(popped);
+        return popped;
+    }
+
+    [[nodiscard]] std::size_t PopManyNoblock(utils::span<T> values) {
+        const auto popped = queue_.queue_.TryPopMany(values.begin(), values.size());
+        if (popped != 0) queue_.producer_side_.OnElementsPopped(popped);
+        return popped;
+    }
+
+    void OnElementsPushed(std::size_t count) {
+        if (count == 1) {
+            non_empty_.NotifyOne();
+        } else {
+            non_empty_.NotifyAll();
+        }
+        queue_.readiness_.NotifyAll();
+    }
+
+    void StopBlockingOnPop() { non_empty_.NotifyAll(); }
+
+    void ResumeBlockingOnPop() {}
+
+    std::size_t GetElementCount() const { return queue_.queue_.GetSizeApproximate(); }
+
+private:
+    GenericQueue& queue_;
+    impl::WaitListNotifier non_empty_;
+};
+
 /// @ingroup userver_concurrency
 ///
 /// @brief Non FIFO multiple producers multiple consumers queue.
@@ -700,6 +959,25 @@ using NonFifoMpmcQueue = GenericQueue<T, impl::SimpleQueuePolicy<true, true>>;
 template <typename T>
 using NonFifoMpscQueue = GenericQueue<T, impl::SimpleQueuePolicy<true, false>>;
 
+/// @ingroup userver_concurrency
+///
+/// @brief FIFO multiple producers multiple consumers queue with a fixed max
+/// size.
+///
+/// Elements are stored in a preallocated lock-free ring buffer, the max size
+/// passed to `Create` is required and is rounded up to a power of 2. Unlike
+/// concurrent::NonFifoMpmcQueue, the elements are delivered in the order in
+/// which the pushes took place, and no separate capacity accounting is done,
+/// which makes the queue faster under contention. The elements must be
+/// nothrow-movable.
+///
+/// Producer::PushMany and Consumer::PopMany transfer a batch of elements with
+/// a single atomic operation on the ring.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using BoundedMpmcQueue = GenericQueue<T, impl::FixedCapacityQueuePolicy<true, true>>;
+
 /// @ingroup userver_concurrency
 ///
 /// @brief Single producer multiple consumers queue.
@@ -3,8 +3,10 @@
 #include <memory>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/impl/context_accessor.hpp>
 #include <userver/engine/task/current_task.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -69,6 +71,26 @@ public:
         return queue_->PushNoblock(token_, std::move(value));
     }
 
+    /// Push elements into queue in order. May wait asynchronously if the queue
+    /// is full. Pushed elements are moved out, the rest are left unmodified.
+    /// @returns the number of pushed elements, less than `values.size()` if
+    /// the deadline expired, the task was canceled or all the consumers died.
+    /// @note Queues with QueueMaxSizeMode::kFixedCapacity push the whole
+    /// available space at once, other queues push the elements one by one.
+    [[nodiscard]] std::size_t PushMany(utils::span<ValueType> values, engine::Deadline deadline = {}) const {
+        UASSERT_MSG(queue_, "Trying to use a moved-from queue Producer");
+        UASSERT_MSG(engine::current_task::IsTaskProcessorThread(), "Use PushManyNoblock for non-coroutine producers");
+        return queue_->PushMany(token_, values, deadline);
+    }
+
+    /// Try to push elements into queue without blocking. May be used in
+    /// non-coroutine environment.
+    /// @returns the number of pushed elements, pushed elements are moved out.
+    [[nodiscard]] std::size_t PushManyNoblock(utils::span<ValueType> values) const {
+        UASSERT_MSG(queue_, "Trying to use a moved-from queue Producer");
+        return queue_->PushManyNoblock(token_, values);
+    }
+
     void Reset() && noexcept {
         if (queue_) queue_->MarkProducerIsDead();
         queue_.reset();
@@ -138,6 +160,25 @@ public:
         return queue_->PopNoblock(token_, value);
     }
 
+    /// Pop up to `values.size()` elements from queue. May wait asynchronously
+    /// for the first element if the queue is empty, but the producer is alive.
+    /// @returns the number of popped elements, stored at the beginning of
+    /// `values`. `0` is returned on timeout, on task cancellation, or if the
+    /// queue is empty and the producer is no longer alive.
+    [[nodiscard]] std::size_t PopMany(utils::span<ValueType> values, engine::Deadline deadline = {}) const {
+        UASSERT_MSG(queue_, "Trying to use a moved-from queue Consumer");
+        UASSERT_MSG(engine::current_task::IsTaskProcessorThread(), "Use PopManyNoblock for non-coroutine consumers");
+        return queue_->PopMany(token_, values, deadline);
+    }
+
+    /// Try to pop up to `values.size()` elements from queue without blocking.
+    /// May be used in non-coroutine environment.
+    /// @returns the number of popped elements.
+    [[nodiscard]] std::size_t PopManyNoblock(utils::span<ValueType> values) const {
+        UASSERT_MSG(queue_, "Trying to use a moved-from queue Consumer");
+        return queue_->PopManyNoblock(token_, values);
+    }
+
     void Reset() && {
         if (queue_) queue_->MarkConsumerIsDead();
         queue_.reset();
@@ -151,6 +192,11 @@ public:
     // For internal use only
     Consumer(std::shared_ptr<QueueType> queue, EmplaceEnablerType /*unused*/)
         : queue_(std::move(queue)), token_(queue_->queue_) {}
+
+    // For engine::WaitAny, the consumer is ready if Pop would not wait
+    engine::impl::ContextAccessor* TryGetContextAccessor() noexcept {
+        return queue_ ? queue_->GetConsumerContextAccessor() : nullptr;
+    }
     /// @endcond
 
 private:
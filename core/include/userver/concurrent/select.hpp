@@ -0,0 +1,68 @@
+#pragma once
+
+/// @file userver/concurrent/select.hpp
+/// @brief @copybrief concurrent::SelectUntil
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/wait_any.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+/// @ingroup userver_concurrency
+///
+/// @brief Waits until one of the queue consumers, events, tasks or futures
+/// becomes ready, with a single wait list registration for all of them.
+///
+/// A queue `Consumer` is ready when `Pop` would not wait: there are elements
+/// in the queue, or all the producers are dead. An engine::SingleConsumerEvent
+/// is ready when it is signaled, the signal is not reset by `SelectUntil`.
+///
+/// Unlike engine::WaitAnyUntil, a wakeup that became stale, e.g. because
+/// another consumer of a multi-consumer queue took the element first, does not
+/// end the wait. For multi-consumer queues, still be prepared for
+/// `PopNoblock` to fail after `SelectUntil`.
+///
+/// @code
+/// while (const auto ready = concurrent::SelectUntil(deadline, consumer, stop_event)) {
+///     if (*ready == 1) break;  // stop_event is signaled
+///
+///     Request request;
+///     if (!consumer.Pop(request, deadline)) break;  // the producers are dead
+///     Handle(std::move(request));
+/// }
+/// @endcode
+///
+/// @returns the index of a ready waitable, or `std::nullopt` on timeout, on
+/// task cancellation, or if none of the waitables are valid
+template <typename... Waitables>
+std::optional<std::size_t> SelectUntil(engine::Deadline deadline, Waitables&... waitables) {
+    if (!(... || (waitables.TryGetContextAccessor() != nullptr))) return std::nullopt;
+
+    while (true) {
+        if (const auto ready = engine::WaitAnyUntil(deadline, waitables...)) return ready;
+        if (deadline.IsReached() || engine::current_task::ShouldCancel()) return std::nullopt;
+    }
+}
+
+/// @overload
+template <typename... Waitables>
+std::optional<std::size_t> Select(Waitables&... waitables) {
+    return concurrent::SelectUntil(engine::Deadline{}, waitables...);
+}
+
+/// @overload
+template <typename... Waitables, typename Rep, typename Period>
+std::optional<std::size_t> SelectFor(std::chrono::duration<Rep, Period> timeout, Waitables&... waitables) {
+    return concurrent::SelectUntil(engine::Deadline::FromDuration(timeout), waitables...);
+}
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
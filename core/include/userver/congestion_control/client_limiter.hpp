@@ -0,0 +1,150 @@
+#pragma once
+
+/// @file userver/congestion_control/client_limiter.hpp
+/// @brief @copybrief congestion_control::ClientLimiter
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control {
+
+/// Static configuration of congestion_control::ClientLimiter
+struct ClientLimiterConfig final {
+    /// Limit that is used before any latency is measured
+    std::size_t initial_limit{20};
+    /// The limit is never decreased below this value
+    std::size_t min_limit{1};
+    /// The limit is never increased above this value
+    std::size_t max_limit{1000};
+    /// Part of the new estimate applied to the limit on each sample, (0, 1]
+    double smoothing{0.2};
+    /// Latency increase relative to the long-term latency that is not treated
+    /// as queueing at the destination, >= 1
+    double rtt_tolerance{1.5};
+    /// Number of samples in the long-term latency moving average
+    std::size_t long_window{600};
+    /// Number of requests allowed to queue at the destination, the limit grows
+    /// by this value while the latency is stable
+    std::size_t queue_size{4};
+};
+
+ClientLimiterConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientLimiterConfig>);
+
+/// @brief Adaptive concurrency limiter for outbound calls to a single
+/// destination.
+///
+/// The limit follows the latency gradient: while the latency of the calls
+/// stays close to the long-term average the limit grows, when the calls start
+/// to queue at the destination and the latency grows the limit shrinks
+/// proportionally. Calls failed because of the destination overload
+/// (timeouts, network errors) shrink the limit multiplicatively.
+///
+/// Acquiring above the limit fails immediately, so that the caller may
+/// fail fast instead of piling up requests to an overloaded destination.
+///
+/// Thread safe, tokens may be released from any thread, including the
+/// non-coroutine ones.
+class ClientLimiter final {
+public:
+    /// @brief Holds a slot of the limit while the call is in flight
+    ///
+    /// Destroying the token without reporting the outcome releases the slot
+    /// without updating the limit, that suits cancelled calls.
+    class Token final {
+    public:
+        Token(Token&& other) noexcept;
+        Token& operator=(Token&& other) noexcept;
+        ~Token();
+
+        /// The call has completed, its latency is used to update the limit
+        void OnSuccess() noexcept;
+
+        /// The call has failed because the destination is overloaded or
+        /// unreachable, the limit is decreased
+        void OnDropped() noexcept;
+
+    private:
+        friend class ClientLimiter;
+
+        explicit Token(ClientLimiter& limiter) noexcept;
+
+        void Release(bool dropped) noexcept;
+
+        ClientLimiter* limiter_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    explicit ClientLimiter(const ClientLimiterConfig& config);
+
+    /// @returns the token if the current limit allows one more call, or an
+    /// empty optional if the call should be rejected
+    std::optional<Token> TryAcquire();
+
+    /// @returns the current concurrency limit
+    std::size_t GetLimit() const noexcept;
+
+    /// @returns the number of calls in flight
+    std::size_t GetInflight() const noexcept;
+
+    /// @returns the number of calls rejected because of the limit
+    std::uint64_t GetRejected() const noexcept;
+
+private:
+    void Release(std::chrono::steady_clock::duration latency, bool dropped) noexcept;
+
+    const ClientLimiterConfig config_;
+    std::atomic<std::size_t> limit_;
+    std::atomic<std::size_t> inflight_{0};
+    std::atomic<std::uint64_t> rejected_{0};
+
+    // std::mutex, because tokens are also released from the ev-threads
+    std::mutex mutex_;
+    double estimated_limit_;
+    double long_latency_us_{0};
+    std::size_t samples_{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const ClientLimiter& limiter);
+
+/// @brief Set of congestion_control::ClientLimiter, one for each destination
+///
+/// Limiters are created on the first use of a destination and live as long as
+/// the set.
+class ClientLimiters final {
+public:
+    explicit ClientLimiters(const ClientLimiterConfig& config);
+
+    ClientLimiters(const ClientLimiters&) = delete;
+    ClientLimiters& operator=(const ClientLimiters&) = delete;
+
+    ~ClientLimiters();
+
+    /// @returns the limiter for the destination, the reference is valid for
+    /// the lifetime of `this`
+    ClientLimiter& GetLimiter(std::string_view destination);
+
+    /// Writes the statistics of each limiter with the `destination` label
+    friend void DumpMetric(utils::statistics::Writer& writer, const ClientLimiters& limiters);
+
+private:
+    const ClientLimiterConfig config_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::unique_ptr<ClientLimiter>> limiters_;
+};
+
+}  // namespace congestion_control
+
+USERVER_NAMESPACE_END
@@ -31,6 +31,12 @@ namespace congestion_control {
 /// min-cpu | force fake-mode if the current cpu number is less than the specified value | 1
 /// only-rtc | if set to true and hostinfo::IsInRtc() returns false then forces the fake-mode | true
 /// status-code | HTTP status code for ratelimited responses | 429
+/// controller | load controller, `rps` limits by the task processor overload events, `codel` limits by the standing task queue wait time | rps
+/// codel.target | acceptable minimal task queue wait time over an epoch (1s) | 5ms
+/// codel.interval-epochs | number of epochs the queue wait time should stay above the target to apply the limit | 1
+/// codel.min-limit | minimal RPS limit | 10
+/// codel.deactivate-delta | the limit grows by this value per epoch and is removed if the RPS is less than the limit by this value | 10
+/// codel.min-qps | minimal RPS to activate the limit | 10
 ///
 /// ## Static configuration example:
 ///
@@ -63,7 +69,7 @@ private:
     void ExtendWriter(utils::statistics::Writer& writer);
 
     struct Impl;
-    utils::FastPimpl<Impl, 704, 16> pimpl_;
+    utils::FastPimpl<Impl, 712, 16> pimpl_;
 };
 
 }  // namespace congestion_control
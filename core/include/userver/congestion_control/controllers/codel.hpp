@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+#include <userver/congestion_control/controllers/v2.hpp>
+#include <userver/congestion_control/limiter.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+struct CodelStats {
+    std::atomic<std::int64_t> min_queue_wait_us{0};
+    std::atomic<std::int64_t> dropping_epochs{0};
+    std::atomic<std::int64_t> control_count{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const CodelStats& stats);
+
+/// @brief Controller that limits the load by the task queue delay, following
+/// the CoDel (Controlled Delay) active queue management.
+///
+/// The minimal queue wait time over an epoch is the standing queue that the
+/// bursts do not explain. While it stays below the target, no limit is
+/// applied. Once it stays above the target for `interval-epochs` the
+/// controller limits the load, the limit is decreased by the CoDel control law
+/// `limit = load / sqrt(count)`, where `count` is the number of epochs spent
+/// above the target. When the queue drains below the target the limit grows
+/// additively and is removed once the load does not reach it.
+class CodelController final : public Controller {
+public:
+    struct StaticConfig {
+        bool fake_mode{false};
+        bool enabled{true};
+
+        /// Acceptable standing queue wait time
+        std::chrono::microseconds target{std::chrono::milliseconds{5}};
+        /// Number of epochs the queue wait time should stay above the target
+        /// before the limit is applied
+        std::size_t interval_epochs{1};
+        /// The limit is never decreased below this value
+        std::size_t min_limit{10};
+        /// The limit is removed if the load is less than the limit by at
+        /// least this value, also the limit growth per epoch
+        std::size_t safe_delta_limit{10};
+        /// Epochs with less requests are not used to activate the limit
+        std::size_t min_qps{10};
+    };
+
+    CodelController(
+        const std::string& name,
+        v2::Sensor& sensor,
+        Limiter& limiter,
+        Stats& stats,
+        CodelStats& codel_stats,
+        const StaticConfig& config
+    );
+
+    Limit Update(const Sensor::Data& current) override;
+
+private:
+    void EnterDropping(std::size_t current_load);
+
+    const StaticConfig config_;
+    CodelStats& codel_stats_;
+
+    std::optional<std::size_t> current_limit_;
+    bool dropping_{false};
+    std::size_t epochs_above_target_{0};
+    std::size_t epochs_since_dropping_{0};
+    std::size_t count_{0};
+    std::size_t base_limit_{0};
+};
+
+CodelController::StaticConfig
+Parse(const yaml_config::YamlConfig& value, formats::parse::To<CodelController::StaticConfig>);
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
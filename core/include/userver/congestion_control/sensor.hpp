@@ -40,6 +40,10 @@ public:
 
         std::size_t current_load{0};
 
+        /// Minimal task queue wait time over the epoch, filled only by the
+        /// sensors of the task processor queue
+        std::chrono::microseconds min_queue_wait_time{0};
+
         double GetRate() const { return static_cast<double>(timeouts) / (total ? total : 1); }
 
         std::string ToLogString() const;
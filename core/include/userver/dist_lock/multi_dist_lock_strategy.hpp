@@ -0,0 +1,62 @@
+#pragma once
+
+/// @file userver/dist_lock/multi_dist_lock_strategy.hpp
+/// @brief @copybrief dist_lock::MultiDistLockStrategyBase
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+
+/// @brief Number issued with every acquisition of a distributed lock.
+///
+/// Tokens of a lock grow monotonically: a lock acquired by another owner gets
+/// a greater token, a prolonged lock keeps its token. Storages protected by
+/// the lock may reject writes with tokens lower than the greatest one seen.
+using FencingToken = std::int64_t;
+
+/// @ingroup userver_base_classes userver_concurrency
+///
+/// @brief Interface for distributed lock strategies that acquire and prolong
+/// many locks with a single call
+///
+/// @see dist_lock::MultiDistLocker
+class MultiDistLockStrategyBase {
+public:
+    virtual ~MultiDistLockStrategyBase() = default;
+
+    /// Acquires the free locks and prolongs the locks already held by
+    /// `locker_id`.
+    ///
+    /// @param lock_ttl The duration for which the locks must be held.
+    /// @param locker_id Globally unique ID of the locking entity.
+    /// @param lock_names Unique names of the locks.
+    /// @returns for every lock of `lock_names` its fencing token if the lock is
+    /// held by `locker_id` after the call, std::nullopt if it is busy.
+    /// @throws anything when the locking fails as a whole, the locks that were
+    /// held stay held until their ttl expires.
+    virtual std::vector<std::optional<FencingToken>> AcquireMany(
+        std::chrono::milliseconds lock_ttl,
+        const std::string& locker_id,
+        utils::span<const std::string> lock_names
+    ) = 0;
+
+    /// Releases the locks held by `locker_id`.
+    ///
+    /// @param locker_id Globally unique ID of the locking entity, must be the
+    /// same as in AcquireMany().
+    /// @param lock_names Unique names of the locks to release.
+    /// @note Exceptions are ignored.
+    virtual void ReleaseMany(const std::string& locker_id, utils::span<const std::string> lock_names) = 0;
+};
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,122 @@
+#pragma once
+
+/// @file userver/dist_lock/multi_dist_locker.hpp
+/// @brief @copybrief dist_lock::MultiDistLocker
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/dist_lock/dist_lock_settings.hpp>
+#include <userver/dist_lock/multi_dist_lock_strategy.hpp>
+#include <userver/dist_lock/statistics.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+
+/// @ingroup userver_concurrency
+///
+/// @brief A primitive that perpetually acquires and prolongs a set of
+/// distributed locks with a single strategy call per iteration.
+///
+/// Unlike dist_lock::DistLockedWorker it does not run any payload, users check
+/// the lease of a lock with GetLease() before doing the work protected by it
+/// and pass the fencing token of the lease to the protected storage.
+///
+/// A lease is valid until `lock_ttl - forced_stop_margin` after the start of
+/// the strategy call that has acquired or prolonged it.
+class MultiDistLocker final {
+public:
+    /// A held lock
+    struct Lease {
+        FencingToken fencing_token{};
+        std::chrono::steady_clock::time_point valid_until;
+    };
+
+    /// Creates a MultiDistLocker.
+    /// @param name name of the locker, used as a prefix of the locker id
+    /// @param lock_names names of the locks to acquire, duplicates are ignored
+    /// @param strategy distributed locking strategy
+    /// @param settings distributed lock settings
+    /// @param task_processor TaskProcessor for running the locking task,
+    /// using current TaskProcessor if `nullptr`
+    MultiDistLocker(
+        std::string name,
+        std::vector<std::string> lock_names,
+        std::shared_ptr<MultiDistLockStrategyBase> strategy,
+        const DistLockSettings& settings = {},
+        engine::TaskProcessor* task_processor = nullptr
+    );
+
+    ~MultiDistLocker();
+
+    /// Name of the locker.
+    const std::string& Name() const;
+
+    /// Retrieves settings in a thread-safe way.
+    DistLockSettings GetSettings() const;
+
+    /// Update settings in a thread-safe way.
+    void UpdateSettings(const DistLockSettings&);
+
+    /// Starts acquiring the locks.
+    void Start();
+
+    /// Stops acquiring the locks and releases the held ones. No lease is valid
+    /// after Stop() returns.
+    void Stop();
+
+    /// @returns whether the locker is started.
+    bool IsRunning() const;
+
+    /// @returns the lease of the lock if it is held and has not expired yet.
+    std::optional<Lease> GetLease(std::string_view lock_name) const;
+
+    /// @returns names of the locks with valid leases.
+    std::vector<std::string> GetOwnedLocks() const;
+
+    /// Returns lock acquisition statistics, successes and failures are counted
+    /// per lock.
+    const Statistics& GetStatistics() const;
+
+private:
+    using Leases = std::vector<std::optional<Lease>>;
+
+    engine::TaskProcessor& GetTaskProcessor() const noexcept;
+    void Run();
+    void UpdateLeases(
+        const std::vector<std::optional<FencingToken>>& tokens,
+        std::chrono::steady_clock::time_point valid_until
+    );
+    void ReleaseAll() noexcept;
+
+    const std::string name_;
+    const std::string id_;
+    const std::vector<std::string> lock_names_;
+    const std::shared_ptr<MultiDistLockStrategyBase> strategy_;
+
+    mutable engine::Mutex settings_mutex_;
+    DistLockSettings settings_;
+
+    rcu::Variable<Leases> leases_;
+    Statistics stats_;
+
+    mutable engine::Mutex locker_task_mutex_;
+    engine::TaskWithResult<void> locker_task_;
+
+    engine::TaskProcessor* const task_processor_;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const MultiDistLocker& locker);
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,226 @@
+#pragma once
+
+/// @file userver/dump/blocks.hpp
+/// @brief Parallel block-wise serialization of large containers for dumps
+///
+/// @ingroup userver_dump_read_write
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <string>
+#include <utility>
+
+#include <userver/compression/zstd.hpp>
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// Options for dump::WriteBlocks and dump::ReadBlocks
+struct BlocksOptions final {
+    /// The number of container elements in a block
+    std::size_t block_size{1 << 16};
+
+    /// The maximum number of blocks that are (de)serialized concurrently,
+    /// limits the memory used for the buffered blocks
+    std::size_t max_parallel_blocks{8};
+
+    /// zstd compression level of the blocks
+    int compression_level{compression::zstd::kDefaultLevel};
+};
+
+namespace impl {
+
+/// A `Writer` that appends to a string buffer
+class BufferWriter final : public Writer {
+public:
+    BufferWriter() = default;
+
+    void Finish() override {}
+
+    std::string Extract() && { return std::move(data_); }
+
+private:
+    void WriteRaw(std::string_view data) override;
+
+    std::string data_;
+};
+
+/// A `Reader` that reads from a string buffer
+class BufferReader final : public Reader {
+public:
+    explicit BufferReader(std::string data) : data_(std::move(data)) {}
+
+    void Finish() override;
+
+private:
+    std::string_view ReadRaw(std::size_t max_size) override;
+
+    void BackUp(std::size_t size) override;
+
+    std::string data_;
+    std::size_t pos_{0};
+};
+
+struct Block final {
+    std::size_t element_count{0};
+    std::size_t raw_size{0};
+    std::string compressed;
+};
+
+Block CompressBlock(std::size_t element_count, std::string raw, int level);
+
+std::string DecompressBlock(const Block& block);
+
+void WriteBlock(Writer& writer, const Block& block);
+
+Block ReadBlock(Reader& reader, std::size_t elements_left);
+
+template <typename T>
+using MergeResult = decltype(std::declval<T&>().merge(std::declval<T&>()));
+
+template <typename T>
+void MergeInto(T& result, T&& part) {
+    if constexpr (meta::kIsDetected<MergeResult, T>) {
+        // Splices the nodes without reallocating the elements
+        result.merge(part);
+    } else if constexpr (meta::kIsPushBackable<T>) {
+        result.insert(result.end(), std::make_move_iterator(part.begin()), std::make_move_iterator(part.end()));
+    } else {
+        for (auto& item : part) {
+            dump::Insert(result, std::move(item));
+        }
+    }
+}
+
+inline std::size_t GetMaxParallelBlocks(const BlocksOptions& options) noexcept {
+    return std::max(options.max_parallel_blocks, std::size_t{1});
+}
+
+}  // namespace impl
+
+/// @brief Writes a container as independent zstd-compressed blocks of
+/// elements, serializing and compressing up to
+/// `BlocksOptions::max_parallel_blocks` blocks concurrently
+///
+/// The blocks are written to `writer` in order as soon as they are ready, so
+/// the memory overhead is bounded by the in-flight blocks. Each block carries
+/// a checksum of its contents that is verified by dump::ReadBlocks.
+///
+/// Intended for overriding `CachingComponentBase::WriteContents` of caches with
+/// millions of elements:
+/// @code
+/// void WriteContents(dump::Writer& writer, const Map& contents) const override {
+///     dump::WriteBlocks(writer, contents);
+/// }
+/// @endcode
+///
+/// @note Must be called from a coroutine, the blocks are processed by
+/// utils::Async tasks on the current task processor.
+/// @throws `Error` and any user-thrown `std::exception`
+template <typename T>
+void WriteBlocks(Writer& writer, const T& container, const BlocksOptions& options = {}) {
+    static_assert(kIsContainer<T> && kIsWritable<meta::RangeValueType<T>>);
+
+    const auto block_size = std::max(options.block_size, std::size_t{1});
+    const auto max_parallel_blocks = impl::GetMaxParallelBlocks(options);
+    const auto level = options.compression_level;
+
+    std::size_t elements_left = std::size(container);
+    writer.Write(elements_left);
+
+    std::deque<engine::TaskWithResult<impl::Block>> in_flight;
+    auto it = std::begin(container);
+
+    while (elements_left != 0 || !in_flight.empty()) {
+        while (elements_left != 0 && in_flight.size() < max_parallel_blocks) {
+            const auto count = std::min(block_size, elements_left);
+            const auto begin = it;
+            std::advance(it, count);
+            elements_left -= count;
+
+            in_flight.push_back(utils::Async("dump-write-block", [begin, count, level] {
+                impl::BufferWriter block_writer;
+                auto block_it = begin;
+                for (std::size_t i = 0; i < count; ++i, ++block_it) {
+                    // explicit cast for vector<bool> shenanigans
+                    block_writer.Write(static_cast<const meta::RangeValueType<T>&>(*block_it));
+                }
+                return impl::CompressBlock(count, std::move(block_writer).Extract(), level);
+            }));
+        }
+
+        impl::WriteBlock(writer, in_flight.front().Get());
+        in_flight.pop_front();
+    }
+}
+
+/// @brief Reads a container written by dump::WriteBlocks, decompressing and
+/// deserializing up to `BlocksOptions::max_parallel_blocks` blocks
+/// concurrently
+///
+/// The parsed blocks are merged into the result in order. Node-based
+/// containers are merged by splicing the nodes.
+///
+/// @code
+/// std::unique_ptr<const Map> ReadContents(dump::Reader& reader) const override {
+///     return std::make_unique<const Map>(dump::ReadBlocks<Map>(reader));
+/// }
+/// @endcode
+///
+/// @note Must be called from a coroutine, the blocks are processed by
+/// utils::Async tasks on the current task processor.
+/// @throws `Error` on a checksum mismatch, and any user-thrown
+/// `std::exception`
+template <typename T>
+T ReadBlocks(Reader& reader, const BlocksOptions& options = {}) {
+    static_assert(kIsContainer<T> && kIsReadable<meta::RangeValueType<T>>);
+
+    const auto max_parallel_blocks = impl::GetMaxParallelBlocks(options);
+    const auto size = reader.Read<std::size_t>();
+    std::size_t elements_left = size;
+
+    T result{};
+    if constexpr (meta::kIsReservable<T>) {
+        result.reserve(size);
+    }
+
+    std::deque<engine::TaskWithResult<T>> in_flight;
+
+    while (elements_left != 0 || !in_flight.empty()) {
+        while (elements_left != 0 && in_flight.size() < max_parallel_blocks) {
+            auto block = impl::ReadBlock(reader, elements_left);
+            elements_left -= block.element_count;
+
+            in_flight.push_back(utils::Async("dump-read-block", [block = std::move(block)] {
+                impl::BufferReader block_reader(impl::DecompressBlock(block));
+                T part{};
+                if constexpr (meta::kIsReservable<T>) {
+                    part.reserve(block.element_count);
+                }
+                for (std::size_t i = 0; i < block.element_count; ++i) {
+                    dump::Insert(part, block_reader.Read<meta::RangeValueType<T>>());
+                }
+                block_reader.Finish();
+                return part;
+            }));
+        }
+
+        impl::MergeInto(result, in_flight.front().Get());
+        in_flight.pop_front();
+    }
+
+    return result;
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
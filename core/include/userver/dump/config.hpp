@@ -42,6 +42,7 @@ struct Config final {
     std::optional<std::chrono::milliseconds> max_dump_age;
     bool max_dump_age_set;
     bool dump_is_encrypted;
+    bool dump_is_memory_mapped;
 
     bool static_dumps_enabled;
     std::chrono::milliseconds static_min_dump_interval;
@@ -85,6 +85,7 @@ enum class UpdateType {
 /// `min-interval` | `string` (duration) | `WriteDumpAsync` calls performed in a fast succession are ignored | `0s`
 /// `fs-task-processor` | `string` | `TaskProcessor` for blocking disk IO | `fs-task-processor`
 /// `encrypted` | `boolean` | Whether to encrypt the dump | `false`
+/// `memory-mapped` | `boolean` | Whether to `mmap` the dump on read instead of reading it, see dump::FlatImage | `false`
 ///
 /// ## Sample usage
 /// @snippet core/src/dump/dumper_test.cpp  Sample Dumper usage
@@ -0,0 +1,169 @@
+#pragma once
+
+/// @file userver/dump/flat_image.hpp
+/// @brief @copybrief dump::FlatImage
+///
+/// @ingroup userver_dump_read_write
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <userver/dump/operations.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief A string stored inside of a dump::FlatImage
+/// @details Holds an offset instead of a pointer, so the string remains valid
+/// wherever the image is placed in memory.
+struct FlatString final {
+    std::uint64_t offset{0};
+    std::uint64_t size{0};
+};
+
+/// @brief An array of trivially copyable `T` stored inside of a
+/// dump::FlatImage
+template <typename T>
+struct FlatArray final {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    std::uint64_t offset{0};
+    std::uint64_t size{0};
+};
+
+/// @brief An immutable relocatable blob of flat arrays and offset-based
+/// strings, with a trivially copyable `Root` struct as the entry point
+///
+/// A cache whose data type is (or wraps) a `FlatImage` is restored from a dump
+/// without parsing: the image is written to the dump as-is, and with the
+/// `dump.memory-mapped` static option the reader publishes the `mmap`-ed dump
+/// file directly. Otherwise the image is read with a single copy.
+///
+/// The image is built with dump::FlatImageBuilder. `Root` and the array
+/// elements must be trivially copyable and must not contain pointers, use
+/// dump::FlatString and dump::FlatArray to refer to other data in the image.
+/// The layout uses the native endianness, bump `format-version` of the dump
+/// when changing `Root` or the element types.
+///
+/// The data is mapped without copying only when the image starts at an
+/// aligned offset in the dump file, which holds when the image is the first
+/// thing written to the dump. Otherwise it is copied into an aligned buffer.
+///
+/// ## Example usage
+/// @snippet core/src/dump/flat_image_test.cpp  Sample FlatImage usage
+class FlatImage final {
+public:
+    /// The alignment of the image start, the maximum supported alignment of
+    /// `Root` and of the array elements
+    static constexpr std::size_t kAlignment = alignof(std::max_align_t);
+
+    /// Creates an empty image without a root
+    FlatImage() = default;
+
+    /// @brief Adopts the image bytes, e.g. returned by `ReadPinnedUnsafe`
+    /// @throws `Error` if `bytes` do not contain a valid image
+    explicit FlatImage(PinnedBytes bytes);
+
+    /// @returns the bytes of the whole image
+    std::string_view GetBytes() const noexcept { return bytes_.data; }
+
+    /// @brief Returns the root struct passed to `FlatImageBuilder::Build`
+    /// @throws `Error` if the image has no root of a matching size
+    template <typename Root>
+    const Root& GetRoot() const;
+
+    /// @throws `Error` if `str` points outside of the image
+    std::string_view GetString(FlatString str) const;
+
+    /// @throws `Error` if `array` points outside of the image
+    template <typename T>
+    utils::span<const T> GetArray(FlatArray<T> array) const;
+
+private:
+    const char* GetChecked(std::uint64_t offset, std::uint64_t size, std::size_t alignment) const;
+
+    PinnedBytes bytes_;
+    std::uint64_t root_offset_{0};
+    std::uint64_t root_size_{0};
+};
+
+/// @brief Builds a dump::FlatImage
+///
+/// Appends data to a single growing buffer that is then adopted by the image
+/// without copying.
+class FlatImageBuilder final {
+public:
+    FlatImageBuilder();
+
+    /// @brief Reserves the space for `size` bytes of data to avoid reallocation
+    void Reserve(std::size_t size);
+
+    FlatString AddString(std::string_view str);
+
+    template <typename T>
+    FlatArray<T> AddArray(utils::span<const T> array);
+
+    template <typename T>
+    FlatArray<T> AddArray(const std::vector<T>& array) {
+        return AddArray(utils::span<const T>{array});
+    }
+
+    /// @brief Stores `root` and finalizes the image
+    /// @note The builder must not be used after this call
+    template <typename Root>
+    FlatImage Build(const Root& root) &&;
+
+private:
+    std::uint64_t Append(std::string_view bytes, std::size_t alignment);
+
+    FlatImage Finish(std::string_view root_bytes, std::size_t root_alignment);
+
+    std::vector<std::max_align_t> storage_;
+    std::size_t size_{0};
+};
+
+void Write(Writer& writer, const FlatImage& image);
+
+FlatImage Read(Reader& reader, To<FlatImage>);
+
+template <typename Root>
+const Root& FlatImage::GetRoot() const {
+    static_assert(std::is_trivially_copyable_v<Root>);
+    static_assert(alignof(Root) <= kAlignment);
+    if (root_size_ != sizeof(Root)) {
+        throw Error("FlatImage root size does not match the requested type");
+    }
+    return *reinterpret_cast<const Root*>(GetChecked(root_offset_, sizeof(Root), alignof(Root)));
+}
+
+template <typename T>
+utils::span<const T> FlatImage::GetArray(FlatArray<T> array) const {
+    static_assert(alignof(T) <= kAlignment);
+    const auto* data = reinterpret_cast<const T*>(GetChecked(array.offset, array.size * sizeof(T), alignof(T)));
+    return {data, static_cast<std::size_t>(array.size)};
+}
+
+template <typename T>
+FlatArray<T> FlatImageBuilder::AddArray(utils::span<const T> array) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    static_assert(alignof(T) <= FlatImage::kAlignment);
+    const std::string_view bytes{reinterpret_cast<const char*>(array.data()), array.size() * sizeof(T)};
+    return {Append(bytes, alignof(T)), array.size()};
+}
+
+template <typename Root>
+FlatImage FlatImageBuilder::Build(const Root& root) && {
+    static_assert(std::is_trivially_copyable_v<Root>);
+    static_assert(alignof(Root) <= FlatImage::kAlignment);
+    return Finish(std::string_view{reinterpret_cast<const char*>(&root), sizeof(Root)}, alignof(Root));
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
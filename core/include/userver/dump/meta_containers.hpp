@@ -13,6 +13,11 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace utils {
+template <typename Key, typename Value, typename Hash, typename Equal>
+class PersistentHashMap;
+}  // namespace utils
+
 namespace dump {
 
 /// @{
@@ -41,6 +46,11 @@ template <typename T, typename Hash, typename Eq, typename Alloc>
 void Insert(std::unordered_set<T, Hash, Eq, Alloc>& cont, T&& elem) {
     cont.insert(std::forward<T>(elem));
 }
+
+template <typename K, typename V, typename Hash, typename Eq>
+void Insert(utils::PersistentHashMap<K, V, Hash, Eq>& cont, std::pair<K, V>&& elem) {
+    cont.insert_or_assign(std::move(elem.first), std::move(elem.second));
+}
 /// @}
 
 namespace impl {
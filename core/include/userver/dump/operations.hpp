@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -44,6 +45,14 @@ protected:
     friend void WriteStringViewUnsafe(Writer& writer, std::string_view value);
 };
 
+/// @brief Bytes returned by `ReadPinnedUnsafe`
+/// @details `data` stays valid for as long as any copy of `owner` is alive,
+/// regardless of further operations on the `Reader`.
+struct PinnedBytes final {
+    std::string_view data;
+    std::shared_ptr<const void> owner;
+};
+
 /// A general interface for binary data input
 class Reader {
 public:
@@ -75,8 +84,17 @@ protected:
     /// the behavior is undefined.
     virtual void BackUp(std::size_t size);
 
+    /// @brief Reads exactly `size` bytes into a buffer that may outlive
+    /// the `Reader`
+    /// @details The default implementation copies the data into a new buffer
+    /// aligned to `alignof(std::max_align_t)`. Readers that are backed by
+    /// long-lived memory, e.g. a memory-mapped file, may return it directly.
+    /// @throws `Error` on read operation failure or on end-of-file
+    virtual PinnedBytes ReadPinned(std::size_t size);
+
     friend std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t size);
     friend void BackUpReadUnsafe(Reader& reader, std::size_t size);
+    friend PinnedBytes ReadPinnedUnsafe(Reader& reader, std::size_t size);
 };
 
 namespace impl {
@@ -13,6 +13,10 @@ namespace dump {
 
 using SecretKey = utils::NonLoggable<class SecretKeyTag, std::string>;
 
+/// @brief A handle to an encrypted dump file
+///
+/// The data is split into chunks that are encrypted with AES-GCM by
+/// utils::Async tasks in parallel, must be used from a coroutine.
 class EncryptedWriter final : public Writer {
 public:
     /// @brief Creates a new dump file and opens it
@@ -32,9 +36,13 @@ private:
     void WriteRaw(std::string_view data) override;
 
     struct Impl;
-    utils::FastPimpl<Impl, 632, 8> impl_;
+    utils::FastPimpl<Impl, 240, 8> impl_;
 };
 
+/// @brief A handle to an encrypted dump file
+///
+/// Decrypts several chunks ahead in utils::Async tasks, must be used from a
+/// coroutine. Also reads the dumps encrypted as a single AES-GCM stream.
 class EncryptedReader final : public Reader {
 public:
     /// @brief Opens an existing dump file
@@ -51,7 +59,7 @@ private:
     void BackUp(std::size_t size) override;
 
     struct Impl;
-    utils::FastPimpl<Impl, 600, 8> impl_;
+    utils::FastPimpl<Impl, 288, 8> impl_;
 };
 
 class EncryptedOperationsFactory final : public OperationsFactory {
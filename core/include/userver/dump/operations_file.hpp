@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
 
 #include <boost/filesystem/operations.hpp>
 
@@ -53,9 +54,39 @@ private:
     std::string curr_chunk_;
 };
 
+/// @brief A handle to a memory-mapped dump file
+/// @details The file is mapped read-only on construction. `ReadPinnedUnsafe`
+/// returns views into the mapping without copying, and the mapping is kept
+/// alive until the last `PinnedBytes::owner` is gone, even after the dump
+/// file has been removed from disk.
+class MappedFileReader final : public Reader {
+public:
+    /// @brief Opens and maps an existing dump file
+    /// @throws `Error` on a filesystem error
+    explicit MappedFileReader(std::string path);
+
+    ~MappedFileReader() override;
+
+    void Finish() override;
+
+private:
+    struct Mapping;
+
+    std::string_view ReadRaw(std::size_t max_size) override;
+
+    void BackUp(std::size_t size) override;
+
+    PinnedBytes ReadPinned(std::size_t size) override;
+
+    std::string path_;
+    std::shared_ptr<const Mapping> mapping_;
+    std::string_view data_;
+    std::size_t position_{0};
+};
+
 class FileOperationsFactory final : public OperationsFactory {
 public:
-    explicit FileOperationsFactory(boost::filesystem::perms perms);
+    explicit FileOperationsFactory(boost::filesystem::perms perms, bool memory_mapped = false);
 
     std::unique_ptr<Reader> CreateReader(std::string full_path) override;
 
@@ -63,6 +94,7 @@ public:
 
 private:
     const boost::filesystem::perms perms_;
+    const bool memory_mapped_;
 };
 
 }  // namespace dump
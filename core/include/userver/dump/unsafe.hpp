@@ -36,6 +36,13 @@ std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t max_size);
 /// then the behavior is undefined.
 void BackUpReadUnsafe(Reader& reader, std::size_t size);
 
+/// @brief Reads a non-size-prefixed chunk of exactly `size` bytes
+/// @details Unlike other `Read*Unsafe` functions, the returned data is not
+/// invalidated by further `Read` operations and stays valid for as long as
+/// `PinnedBytes::owner` is alive. A reader over a memory-mapped dump returns
+/// the mapped memory without copying.
+PinnedBytes ReadPinnedUnsafe(Reader& reader, std::size_t size);
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
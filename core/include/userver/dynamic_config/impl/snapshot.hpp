@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <typeindex>
@@ -54,6 +55,10 @@ public:
 
     SnapshotData(const SnapshotData& defaults, const std::vector<KeyValue>& overrides);
 
+    // Parses only the configs which docs differ in `docs_map` and
+    // `previous_docs_map`, the rest of the configs are shared with `previous`
+    SnapshotData(const DocsMap& docs_map, const DocsMap& previous_docs_map, const SnapshotData& previous);
+
     SnapshotData(SnapshotData&&) noexcept = default;
     SnapshotData& operator=(SnapshotData&&) noexcept = default;
 
@@ -68,10 +73,15 @@ public:
 
     bool IsEmpty() const noexcept;
 
+    // Returns true if both snapshots share the same parsed config, i.e. the
+    // config has not been changed between the snapshots
+    bool IsSameValue(ConfigId id, const SnapshotData& other) const noexcept;
+
 private:
     const std::any& DoGet(ConfigId id) const;
 
-    std::vector<std::any> user_configs_;
+    // Unchanged configs are shared between the consecutive snapshots
+    std::vector<std::shared_ptr<const std::any>> user_configs_;
 };
 
 class StorageData;
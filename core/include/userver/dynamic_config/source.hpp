@@ -10,6 +10,7 @@
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/meta.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -177,7 +178,9 @@ public:
     /// @note Сallbacks occur only if one of the passed config is changed. This is
     /// true under any components::DynamicConfigClientUpdater options.
     ///
-    /// @warning To use this function, configs must have the `operator==`.
+    /// A config is considered unchanged without any comparisons if it has not
+    /// been parsed again, i.e. if its JSON value has not changed. Otherwise the
+    /// values are compared using `operator==`, if the config type has one.
     ///
     /// @param obj the subscriber, which is the owner of the listener method, and
     /// is also used as the unique identifier of the subscription
@@ -216,10 +219,21 @@ private:
         UASSERT(!current.GetData().IsEmpty());
         UASSERT(!previous.GetData().IsEmpty());
 
-        const bool is_equal = (true && ... && (previous[keys] == current[keys]));
+        const bool is_equal = (true && ... && IsEqual(previous, current, keys));
         return !is_equal;
     }
 
+    template <typename VariableType>
+    static bool IsEqual(const Snapshot& previous, const Snapshot& current, const Key<VariableType>& key) {
+        if (previous.GetData().IsSameValue(impl::ConfigIdGetter::Get(key), current.GetData())) return true;
+
+        if constexpr (meta::kIsEqualityComparable<VariableType>) {
+            return previous[key] == current[key];
+        } else {
+            return false;
+        }
+    }
+
     concurrent::AsyncEventSubscriberScope
     DoUpdateAndListen(concurrent::FunctionId id, std::string_view name, SnapshotEventSource::Function&& func);
 
@@ -3,7 +3,11 @@
 /// @file userver/engine/async.hpp
 /// @brief TaskWithResult creation helpers
 
+#include <cstddef>
+#include <vector>
+
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/impl/task_batch_scope.hpp>
 #include <userver/engine/impl/task_context_factory.hpp>
 #include <userver/engine/task/shared_task_with_result.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -152,6 +156,36 @@ template <typename Function, typename... Args>
     );
 }
 
+/// @brief Runs `count` asynchronous function calls `f(index)` using specified
+/// task processor, where `index` is in [0, count)
+///
+/// Unlike engine::AsyncNoSpan in a loop, pushes all the tasks into the task
+/// processor queue with a single operation and a bounded number of worker
+/// wakeups. `f` is copied into each of the tasks.
+///
+/// @returns tasks in the order of their indices
+template <typename Function>
+[[nodiscard]] auto AsyncBatchNoSpan(TaskProcessor& task_processor, std::size_t count, const Function& f) {
+    using TaskType = decltype(AsyncNoSpan(task_processor, f, std::size_t{}));
+
+    std::vector<TaskType> tasks;
+    tasks.reserve(count);
+
+    // Destroyed before `tasks` on exception, so the already created tasks
+    // are scheduled and could be cancelled and awaited
+    impl::TaskBatchScope batch{task_processor, count};
+    for (std::size_t i = 0; i < count; ++i) {
+        tasks.push_back(AsyncNoSpan(task_processor, f, i));
+    }
+    return tasks;
+}
+
+/// @overload
+template <typename Function>
+[[nodiscard]] auto AsyncBatchNoSpan(std::size_t count, const Function& f) {
+    return AsyncBatchNoSpan(current_task::GetTaskProcessor(), count, f);
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
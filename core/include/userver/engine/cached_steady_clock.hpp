@@ -0,0 +1,42 @@
+#pragma once
+
+/// @file userver/engine/cached_steady_clock.hpp
+/// @brief @copybrief engine::CachedSteadyClock
+
+#include <chrono>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @brief Steady clock that returns the time of its first reading since the
+/// current task was last resumed, cached per engine worker thread
+///
+/// The TaskProcessor invalidates the cached time every time it resumes a task,
+/// the first reading after that takes std::chrono::steady_clock::now() and
+/// the next ones are thread-local loads. So the time does not advance while
+/// the task runs without suspensions and always lags behind
+/// std::chrono::steady_clock. Tasks that do not read the clock do not pay for
+/// it. Outside of the engine worker threads the clock is
+/// std::chrono::steady_clock itself.
+///
+/// The clock is opt-in and suits places that tolerate such a lag: deadline
+/// checks that may report false-negatives, coarse metrics and timings that
+/// start right after the task has been resumed.
+///
+/// Time points are the std::chrono::steady_clock ones and may be mixed with
+/// them.
+struct CachedSteadyClock final {
+    using duration = std::chrono::steady_clock::duration;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::steady_clock::time_point;
+
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -32,6 +32,11 @@ public:
     /// never report false-positives.
     bool IsSurelyReachedApprox() const noexcept;
 
+    /// Returns whether the deadline is reached according to
+    /// engine::CachedSteadyClock. Will report false-negatives, will never report
+    /// false-positives. Cheaper than IsSurelyReachedApprox.
+    bool IsSurelyReachedCached() const noexcept;
+
     /// Returns the duration of time left before the reachable deadline
     Duration TimeLeft() const noexcept;
 
@@ -40,6 +45,12 @@ public:
     /// @see utils::datetime::SteadyCoarseClock
     Duration TimeLeftApprox() const noexcept;
 
+    /// Returns the duration of time left before the reachable deadline
+    /// according to engine::CachedSteadyClock. Never underestimates the time
+    /// left, may overestimate it by the time passed since the current task was
+    /// resumed.
+    Duration TimeLeftCached() const noexcept;
+
     /// Converts duration to a Deadline
     template <typename Rep, typename Period>
     static Deadline FromDuration(const std::chrono::duration<Rep, Period>& incoming_duration) noexcept {
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+class TaskContext;
+
+// While alive, collects the tasks scheduled to `task_processor` from the
+// current coroutine and pushes them into the task queue at once on
+// destruction. Tasks scheduled to other task processors are not affected.
+//
+// There must be no context switches within the lifetime of the scope.
+class TaskBatchScope final {
+public:
+    TaskBatchScope(TaskProcessor& task_processor, std::size_t expected_size);
+
+    TaskBatchScope(TaskBatchScope&&) = delete;
+    TaskBatchScope& operator=(TaskBatchScope&&) = delete;
+
+    ~TaskBatchScope();
+
+    // Returns false if there is no suitable active scope and the context
+    // should be scheduled right away
+    static bool TryAdd(TaskProcessor& task_processor, TaskContext* context);
+
+private:
+    TaskProcessor& task_processor_;
+    TaskBatchScope* const previous_;
+    std::vector<TaskContext*> contexts_;
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
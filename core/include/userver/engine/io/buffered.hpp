@@ -4,7 +4,9 @@
 /// @brief Buffered I/O wrappers
 
 #include <functional>
+#include <optional>
 #include <string>
+#include <string_view>
 
 #include <userver/compiler/select.hpp>
 #include <userver/engine/deadline.hpp>
@@ -55,9 +57,27 @@ public:
     /// @note Does not return line terminators.
     std::string ReadLine(Deadline deadline = {});
 
-    /// Reads the stream until the specified character of EOF is encountered.
+    /// @brief Reads the stream until the specified character is encountered.
+    /// @note Returns the terminator as a part of the result.
+    /// @throws TerminatorNotFoundException if EOF is encountered first, the data
+    /// stays in the buffer
     std::string ReadUntil(char terminator, Deadline deadline = {});
 
+    /// @brief Same as ReadUntil(char, Deadline), but returns a view into the
+    /// buffer instead of a copy.
+    /// @warning The view is invalidated by the next call to any method of the
+    /// reader.
+    std::string_view ReadViewUntil(char terminator, Deadline deadline = {});
+
+    /// @brief Reads a frame prefixed by its size as a 32-bit big-endian integer.
+    /// @returns a view into the buffer without the prefix, or `std::nullopt` on
+    /// EOF before the frame
+    /// @throws IoException if the size exceeds `max_frame_size` or on EOF
+    /// in the middle of the frame
+    /// @warning The view is invalidated by the next call to any method of the
+    /// reader.
+    std::optional<std::string_view> ReadFrameView(std::size_t max_frame_size, Deadline deadline = {});
+
     /// @brief Reads the stream until the predicate returns `true`.
     /// @param pred predicate that will be called for each byte read and EOF.
     std::string ReadUntil(utils::function_ref<bool(int) const> pred, Deadline deadline = {});
@@ -74,6 +94,14 @@ public:
 private:
     size_t FillBuffer(Deadline deadline);
 
+    // Returns the count of the bytes up to and including the first one
+    // found by `find`, or std::nullopt on EOF before that
+    std::optional<size_t>
+    ScanUntil(utils::function_ref<const char*(const char*, size_t) const> find, Deadline deadline);
+
+    // Returns false on EOF before `num_bytes` are buffered
+    bool FillAtLeast(size_t num_bytes, Deadline deadline);
+
     ReadableBasePtr source_;
 
     constexpr static std::size_t kBufferSize = compiler::SelectSize()  //
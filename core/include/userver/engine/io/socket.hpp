@@ -41,6 +41,18 @@ public:
         Sockaddr src_addr;
     };
 
+    /// @brief A datagram for the batched I/O, see RecvSomeFromBatch() and
+    /// SendAllToBatch().
+    struct Datagram {
+        /// Datagram contents
+        void* data{nullptr};
+        /// Size of the datagram, or the buffer capacity before receiving
+        size_t len{0};
+        /// Source address of a received datagram or destination address of the
+        /// one being sent
+        Sockaddr addr;
+    };
+
     /// Constructs an invalid socket.
     Socket() = default;
 
@@ -112,6 +124,16 @@ public:
     /// @note Can return less than len if socket is closed by peer.
     [[nodiscard]] size_t SendAll(const void* buf, size_t len, Deadline deadline);
 
+    /// @brief Sends `len` bytes of the file `file_fd` starting at `offset`.
+    ///
+    /// On Linux the data goes from the page cache to the socket with
+    /// sendfile(2) and never gets copied to the userspace. The file offset of
+    /// `file_fd` is not changed, so a single descriptor may be shared by
+    /// concurrent senders.
+    /// @note Can return less than len if socket is closed by peer or if the
+    /// file is shorter than `offset + len`.
+    [[nodiscard]] size_t SendFile(int file_fd, std::size_t offset, std::size_t len, Deadline deadline);
+
     /// @brief Accepts a connection from a listening socket.
     /// @see engine::io::Listen
     [[nodiscard]] Socket Accept(Deadline);
@@ -129,6 +151,24 @@ public:
     /// @note Not for SocketType::kStream connections, see `man sendto`.
     [[nodiscard]] size_t SendAllTo(const Sockaddr& dest_addr, const void* buf, size_t len, Deadline deadline);
 
+    /// @brief Receives at least one datagram, and as many of the already
+    /// available ones as fit into `datagrams`, using a minimal number of
+    /// syscalls (recvmmsg on Linux).
+    /// @returns the number of received datagrams, their `len` and `addr` are
+    /// updated accordingly.
+    /// @note Datagrams larger than their buffers are truncated.
+    /// @note Not for SocketType::kStream connections.
+    [[nodiscard]] size_t RecvSomeFromBatch(Datagram* datagrams, size_t count, Deadline deadline);
+
+    /// @brief Sends all `datagrams` to their addresses using a minimal number of
+    /// syscalls (sendmmsg on Linux).
+    /// @returns the number of sent datagrams.
+    /// @note Combine with the UDP_SEGMENT socket option (GSO) to let the kernel
+    /// split large buffers into datagrams of the same size.
+    /// @note Sockaddr domain must match the socket's domain.
+    /// @note Not for SocketType::kStream connections.
+    [[nodiscard]] size_t SendAllToBatch(const Datagram* datagrams, size_t count, Deadline deadline);
+
     /// File descriptor corresponding to this socket.
     int Fd() const;
 
@@ -0,0 +1,121 @@
+#pragma once
+
+/// @file userver/engine/io/tls_session.hpp
+/// @brief TLS session resumption helpers for engine::io::TlsWrapper
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+
+class TlsWrapper;
+
+/// Handshake statistics of the TLS connections that share the session state
+struct TlsHandshakeStatistics final {
+    /// Handshakes that have established a new session
+    utils::statistics::RateCounter full;
+    /// Handshakes that have resumed a previous session
+    utils::statistics::RateCounter resumed;
+    /// Client handshakes with 0-RTT data that was accepted by the server
+    utils::statistics::RateCounter early_data_accepted;
+    /// Client handshakes with 0-RTT data that was rejected by the server and
+    /// had to be sent again
+    utils::statistics::RateCounter early_data_rejected;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const TlsHandshakeStatistics& stats);
+
+/// @brief Keys to encrypt and decrypt the TLS session tickets issued by
+/// engine::io::TlsWrapper::StartTlsServer.
+///
+/// Connections that share the keys can resume the sessions established by each
+/// other, including the connections to the other processes with the same keys.
+///
+/// The first key encrypts the new tickets, the other ones are only used to
+/// decrypt the tickets issued before a rotation. A ticket decrypted with a
+/// non-first key is renewed by the server.
+///
+/// Thread safe. Must outlive the TLS connections that use it.
+class TlsSessionTicketKeys final {
+public:
+    /// Size of a key: 16 bytes of the key name, 32 bytes of the HMAC-SHA256
+    /// secret and 32 bytes of the AES-256 key
+    static constexpr std::size_t kKeySize = 80;
+
+    /// Creates the keys with a single random key
+    TlsSessionTicketKeys();
+    ~TlsSessionTicketKeys();
+
+    TlsSessionTicketKeys(const TlsSessionTicketKeys&) = delete;
+    TlsSessionTicketKeys& operator=(const TlsSessionTicketKeys&) = delete;
+
+    /// @brief Replaces all the keys, the first one encrypts the new tickets.
+    /// @throws TlsException if the list is empty or some key is not kKeySize
+    /// bytes long
+    void SetKeys(const std::vector<std::string>& keys);
+
+    /// Generates a new random key for the new tickets and keeps the current
+    /// first key for decryption of the previously issued tickets.
+    void Rotate();
+
+    /// Returns the statistics of the server handshakes that use the keys
+    const TlsHandshakeStatistics& GetStatistics() const noexcept;
+
+    /// @cond
+    struct Impl;
+    /// @endcond
+
+private:
+    friend class TlsWrapper;
+
+    std::unique_ptr<Impl> impl_;
+};
+
+/// @brief Cache of the TLS sessions for engine::io::TlsWrapper::StartTlsClient,
+/// keyed by the server name.
+///
+/// A session is stored once the server issues a ticket and is used by the next
+/// connection to the same server name to skip the full handshake.
+///
+/// Thread safe. Must outlive the TLS connections that use it.
+class TlsClientSessionCache final {
+public:
+    static constexpr std::size_t kDefaultMaxSize = 1024;
+
+    /// Creates the cache that keeps sessions of at most `max_size` most
+    /// recently used server names
+    explicit TlsClientSessionCache(std::size_t max_size = kDefaultMaxSize);
+    ~TlsClientSessionCache();
+
+    TlsClientSessionCache(const TlsClientSessionCache&) = delete;
+    TlsClientSessionCache& operator=(const TlsClientSessionCache&) = delete;
+
+    /// Returns the count of the server names with a cached session
+    std::size_t GetSize() const;
+
+    /// Drops all the cached sessions
+    void Clear();
+
+    /// Returns the statistics of the client handshakes that use the cache
+    const TlsHandshakeStatistics& GetStatistics() const noexcept;
+
+    /// @cond
+    struct Impl;
+    /// @endcond
+
+private:
+    friend class TlsWrapper;
+
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 /// @brief TLS socket wrappers
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <userver/crypto/certificate.hpp>
@@ -11,6 +12,7 @@
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/io/common.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/engine/io/tls_session.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -26,8 +28,44 @@ namespace engine::io {
 /// @snippet src/engine/io/tls_wrapper_test.cpp TLS wrapper usage
 class [[nodiscard]] TlsWrapper final : public RwBase {
 public:
+    /// @brief Kernel TLS (kTLS) offload mode.
+    ///
+    /// With kEnabled the session keys are handed to the kernel after the
+    /// handshake if OpenSSL is built with kTLS support, the kernel has the `tls`
+    /// module loaded and the negotiated cipher is supported by it. Otherwise the
+    /// encryption silently stays in userspace.
+    ///
+    /// Once the send direction is offloaded, SendAll() writes to the socket
+    /// directly and SendFile() becomes available.
+    enum class KernelOffload {
+        kDisabled,
+        kEnabled,
+    };
+
     /// Starts a TLS client on an opened socket
-    static TlsWrapper StartTlsClient(Socket&& socket, const std::string& server_name, Deadline deadline);
+    static TlsWrapper StartTlsClient(
+        Socket&& socket,
+        const std::string& server_name,
+        Deadline deadline,
+        KernelOffload kernel_offload = KernelOffload::kDisabled
+    );
+
+    /// @brief Starts a TLS client on an opened socket, resuming the session
+    /// from the `session_cache` entry of the `server_name` if possible.
+    ///
+    /// If `early_data` is not empty and the cached session allows it, the data
+    /// is sent as TLS 1.3 0-RTT data during the handshake. The server may reject
+    /// it, in which case the data has to be sent again, see
+    /// IsEarlyDataAccepted(). The early data may be replayed by an attacker, so
+    /// only idempotent requests should be sent that way.
+    static TlsWrapper StartTlsClient(
+        Socket&& socket,
+        const std::string& server_name,
+        TlsClientSessionCache& session_cache,
+        Deadline deadline,
+        std::string_view early_data = {},
+        KernelOffload kernel_offload = KernelOffload::kDisabled
+    );
 
     /// Starts a TLS client with client cert on an opened socket
     static TlsWrapper StartTlsClient(
@@ -36,16 +74,23 @@ public:
         const crypto::Certificate& cert,
         const crypto::PrivateKey& key,
         Deadline deadline,
-        const std::vector<crypto::Certificate>& extra_cert_authorities = {}
+        const std::vector<crypto::Certificate>& extra_cert_authorities = {},
+        KernelOffload kernel_offload = KernelOffload::kDisabled
     );
 
-    /// Starts a TLS server on an opened socket
+    /// @brief Starts a TLS server on an opened socket
+    ///
+    /// If `session_ticket_keys` are set, the issued session tickets are
+    /// encrypted with them and the sessions of other connections with the same
+    /// keys are resumed. The 0-RTT data is never accepted by the server.
     static TlsWrapper StartTlsServer(
         Socket&& socket,
         const crypto::CertificatesChain& cert_chain,
         const crypto::PrivateKey& key,
         Deadline deadline,
-        const std::vector<crypto::Certificate>& extra_cert_authorities = {}
+        const std::vector<crypto::Certificate>& extra_cert_authorities = {},
+        KernelOffload kernel_offload = KernelOffload::kDisabled,
+        TlsSessionTicketKeys* session_ticket_keys = nullptr
     );
 
     ~TlsWrapper() override;
@@ -78,9 +123,28 @@ public:
     /// @note Can return less than len if socket is closed by peer.
     [[nodiscard]] size_t SendAll(const void* buf, size_t len, Deadline deadline);
 
+    /// Whether the handshake has resumed a previous session.
+    bool IsSessionReused() const;
+
+    /// Whether the early data passed to StartTlsClient() was accepted by the
+    /// server and must not be sent again.
+    bool IsEarlyDataAccepted() const;
+
+    /// Whether the encryption of the sent data is done by the kernel.
+    bool IsSendOffloadedToKernel() const;
+
+    /// @brief Sends `len` bytes of the file `file_fd` starting at `offset`
+    /// with sendfile(2), the data is encrypted by the kernel.
+    /// @throws TlsException if IsSendOffloadedToKernel() is false
+    /// @note Can return less than len if socket is closed by peer or if the
+    /// file is shorter than `offset + len`.
+    [[nodiscard]] size_t SendFile(int file_fd, std::size_t offset, std::size_t len, Deadline deadline);
+
     /// @brief Finishes TLS session and returns the socket.
     /// @warning Wrapper becomes invalid on entry and can only be used to retry
     ///   socket extraction if interrupted.
+    /// @warning The socket is not usable for plaintext I/O if kernel TLS
+    ///   offload was in effect.
     [[nodiscard]] Socket StopTls(Deadline deadline);
 
     /// @brief Receives at least one byte from the socket.
@@ -113,7 +177,7 @@ private:
 
     class Impl;
     class ReadContextAccessor;
-    constexpr static size_t kSize = 336;
+    constexpr static size_t kSize = 344;
     constexpr static size_t kAlignment = 8;
     utils::FastPimpl<Impl, kSize, kAlignment> impl_;
 };
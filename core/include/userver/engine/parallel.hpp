@@ -0,0 +1,181 @@
+#pragma once
+
+/// @file userver/engine/parallel.hpp
+/// @brief Parallel algorithms over random-access ranges on the current
+/// engine::TaskProcessor
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief Parallel algorithms that split the work into coroutine tasks
+///
+/// The range is split into chunks, and the chunks are processed by a tree of
+/// tasks on the current engine::TaskProcessor, so the idle workers steal them
+/// from the task queue. The caller processes a chunk itself while waiting.
+///
+/// If a function throws, or the caller is cancelled, the tasks that have not
+/// started yet are cancelled and the exception is rethrown to the caller
+/// after all the started chunks are finished. The functions must be safe to
+/// call concurrently.
+///
+/// @warning Each chunk occupies a task processor worker until it is
+/// processed, do not run long CPU-bound algorithms on the main task processor.
+namespace engine::parallel {
+
+/// Settings of the engine::parallel algorithms
+struct Settings {
+    /// Minimal number of elements processed by a single task. By default the
+    /// range is split into a few chunks per task processor worker, which
+    /// works well for cheap uniform functions.
+    std::size_t grain_size{0};
+};
+
+namespace impl {
+
+std::size_t GetChunkCount(std::size_t size, const Settings& settings);
+
+/// Invokes `chunk_func` for each of the chunk indices in [0, chunk_count) in
+/// parallel, the first chunk is processed by the caller
+void RunChunks(std::size_t chunk_count, utils::function_ref<void(std::size_t)> chunk_func);
+
+/// The offset of the chunk in a range of `size` elements
+inline std::size_t GetChunkBegin(std::size_t chunk_index, std::size_t chunk_count, std::size_t size) noexcept {
+    return chunk_index * size / chunk_count;
+}
+
+template <typename RandomIt>
+using Difference = typename std::iterator_traits<RandomIt>::difference_type;
+
+template <typename RandomIt>
+inline constexpr bool kIsRandomAccess = std::is_base_of_v<
+    std::random_access_iterator_tag,
+    typename std::iterator_traits<RandomIt>::iterator_category>;
+
+// Invokes `chunk_func(begin_offset, end_offset)` for each chunk in parallel
+template <typename RandomIt, typename ChunkFunction>
+void ForEachChunk(RandomIt first, RandomIt last, const Settings& settings, const ChunkFunction& chunk_func) {
+    static_assert(kIsRandomAccess<RandomIt>, "engine::parallel algorithms require random-access iterators");
+
+    const auto size = static_cast<std::size_t>(last - first);
+    if (size == 0) return;
+
+    const auto chunk_count = impl::GetChunkCount(size, settings);
+    impl::RunChunks(chunk_count, [&](std::size_t chunk_index) {
+        const auto begin = impl::GetChunkBegin(chunk_index, chunk_count, size);
+        const auto end = impl::GetChunkBegin(chunk_index + 1, chunk_count, size);
+        chunk_func(begin, end);
+    });
+}
+
+}  // namespace impl
+
+/// @brief Invokes `func` for each element of `[first, last)` in parallel
+template <typename RandomIt, typename Function>
+void ForEach(RandomIt first, RandomIt last, const Function& func, const Settings& settings = {}) {
+    impl::ForEachChunk(first, last, settings, [&](std::size_t begin, std::size_t end) {
+        std::for_each(
+            first + static_cast<impl::Difference<RandomIt>>(begin),
+            first + static_cast<impl::Difference<RandomIt>>(end),
+            func
+        );
+    });
+}
+
+/// @brief Stores `func(element)` for each element of `[first, last)` into
+/// the range starting at `d_first` in parallel
+/// @returns the iterator past the last stored element
+template <typename RandomIt, typename OutputRandomIt, typename Function>
+OutputRandomIt Transform(
+    RandomIt first,
+    RandomIt last,
+    OutputRandomIt d_first,
+    const Function& func,
+    const Settings& settings = {}
+) {
+    static_assert(impl::kIsRandomAccess<OutputRandomIt>, "engine::parallel::Transform requires a random-access output");
+
+    impl::ForEachChunk(first, last, settings, [&](std::size_t begin, std::size_t end) {
+        std::transform(
+            first + static_cast<impl::Difference<RandomIt>>(begin),
+            first + static_cast<impl::Difference<RandomIt>>(end),
+            d_first + static_cast<impl::Difference<OutputRandomIt>>(begin),
+            func
+        );
+    });
+    return d_first + static_cast<impl::Difference<OutputRandomIt>>(last - first);
+}
+
+/// @brief Combines `init` and the elements of `[first, last)` with `op` in
+/// parallel
+///
+/// `op` must be associative, the elements are combined in the order of the
+/// range, so the operation is not required to be commutative.
+template <typename RandomIt, typename T, typename BinaryOp = std::plus<>>
+T Reduce(RandomIt first, RandomIt last, T init, const BinaryOp& op = {}, const Settings& settings = {}) {
+    static_assert(impl::kIsRandomAccess<RandomIt>, "engine::parallel algorithms require random-access iterators");
+
+    const auto size = static_cast<std::size_t>(last - first);
+    if (size == 0) return init;
+
+    const auto chunk_count = impl::GetChunkCount(size, settings);
+    std::vector<std::optional<T>> partials(chunk_count);
+    impl::RunChunks(chunk_count, [&](std::size_t chunk_index) {
+        auto it = first + static_cast<impl::Difference<RandomIt>>(impl::GetChunkBegin(chunk_index, chunk_count, size));
+        const auto chunk_last =
+            first + static_cast<impl::Difference<RandomIt>>(impl::GetChunkBegin(chunk_index + 1, chunk_count, size));
+
+        T partial(*it);
+        for (++it; it != chunk_last; ++it) partial = op(std::move(partial), *it);
+        partials[chunk_index].emplace(std::move(partial));
+    });
+
+    for (auto& partial : partials) init = op(std::move(init), std::move(*partial));
+    return init;
+}
+
+/// @brief Sorts `[first, last)` in parallel, the sort is not stable
+///
+/// The chunks are sorted with `std::sort` and then merged pairwise with
+/// `std::inplace_merge`, so a temporary buffer may be allocated.
+template <typename RandomIt, typename Compare = std::less<>>
+void Sort(RandomIt first, RandomIt last, const Compare& comp = {}, const Settings& settings = {}) {
+    static_assert(impl::kIsRandomAccess<RandomIt>, "engine::parallel algorithms require random-access iterators");
+
+    const auto size = static_cast<std::size_t>(last - first);
+    if (size == 0) return;
+
+    const auto chunk_count = impl::GetChunkCount(size, settings);
+    const auto chunk_begin = [&](std::size_t chunk_index) {
+        return first + static_cast<impl::Difference<RandomIt>>(
+                           impl::GetChunkBegin(std::min(chunk_index, chunk_count), chunk_count, size)
+                       );
+    };
+
+    impl::RunChunks(chunk_count, [&](std::size_t chunk_index) {
+        std::sort(chunk_begin(chunk_index), chunk_begin(chunk_index + 1), comp);
+    });
+
+    // Each round merges the pairs of adjacent sorted runs of `width` chunks
+    for (std::size_t width = 1; width < chunk_count; width *= 2) {
+        const auto pair_count = (chunk_count + 2 * width - 1) / (2 * width);
+        impl::RunChunks(pair_count, [&](std::size_t pair_index) {
+            const auto left = pair_index * 2 * width;
+            if (left + width >= chunk_count) return;
+            std::inplace_merge(chunk_begin(left), chunk_begin(left + width), chunk_begin(left + 2 * width), comp);
+        });
+    }
+}
+
+}  // namespace engine::parallel
+
+USERVER_NAMESPACE_END
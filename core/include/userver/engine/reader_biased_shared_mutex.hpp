@@ -0,0 +1,142 @@
+#pragma once
+
+/// @file userver/engine/reader_biased_shared_mutex.hpp
+/// @brief @copybrief engine::ReaderBiasedSharedMutex
+
+#include <atomic>
+#include <chrono>
+
+#include <userver/concurrent/impl/striped_read_indicator.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief std::shared_mutex replacement for asynchronous tasks with the shared
+/// locks that scale with the number of cores.
+///
+/// Ignores task cancellations (succeeds even if the current task is cancelled).
+///
+/// engine::SharedMutex counts the readers in a single atomic, so the readers on
+/// different cores contend for its cache line. Here a shared lock only touches
+/// a per-CPU stripe of a concurrent::impl::StripedReadIndicator, while there is
+/// no writer. A unique lock blocks the new readers and waits for the stripes to
+/// drain, so the writes are more expensive than with engine::SharedMutex.
+///
+/// Takes `16 * N_CORES` bytes for the stripes, use it for the hot mutexes with
+/// rare writes that are shared between many tasks.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+class ReaderBiasedSharedMutex final {
+public:
+    ReaderBiasedSharedMutex();
+    ~ReaderBiasedSharedMutex();
+
+    ReaderBiasedSharedMutex(const ReaderBiasedSharedMutex&) = delete;
+    ReaderBiasedSharedMutex(ReaderBiasedSharedMutex&&) = delete;
+    ReaderBiasedSharedMutex& operator=(const ReaderBiasedSharedMutex&) = delete;
+    ReaderBiasedSharedMutex& operator=(ReaderBiasedSharedMutex&&) = delete;
+
+    /// Locks the mutex for unique ownership. Blocks current coroutine if the
+    /// mutex is locked by another coroutine for reading or writing.
+    ///
+    /// @note The method waits for the mutex even if the current task is
+    /// cancelled.
+    void lock();
+
+    /// Unlocks the mutex for unique ownership. Before calling this method the
+    /// the mutex should be locked for unique ownership by current coroutine.
+    void unlock();
+
+    /// Tries to lock the mutex for unique ownership without blocking the
+    /// coroutine, returns true if succeeded.
+    [[nodiscard]] bool try_lock();
+
+    /// Tries to lock the mutex for unique ownership in specified duration.
+    ///
+    /// @returns true if the locking succeeded
+    template <typename Rep, typename Period>
+    [[nodiscard]] bool try_lock_for(const std::chrono::duration<Rep, Period>&);
+
+    /// Tries to lock the mutex for unique ownership till specified time point.
+    ///
+    /// @returns true if the locking succeeded
+    template <typename Clock, typename Duration>
+    [[nodiscard]] bool try_lock_until(const std::chrono::time_point<Clock, Duration>&);
+
+    /// @overload
+    [[nodiscard]] bool try_lock_until(Deadline deadline);
+
+    /// Locks the mutex for shared ownership. Blocks current coroutine if the
+    /// mutex is locked by another coroutine for writing.
+    ///
+    /// @note The method waits for the mutex even if the current task is
+    /// cancelled.
+    void lock_shared();
+
+    /// Unlocks the mutex for shared ownership. Before calling this method the
+    /// mutex should be locked for shared ownership by current coroutine.
+    void unlock_shared();
+
+    /// Tries to lock the mutex for shared ownership without blocking the
+    /// coroutine, returns true if succeeded.
+    [[nodiscard]] bool try_lock_shared();
+
+    /// Tries to lock the mutex for shared ownership in specified duration.
+    ///
+    /// @returns true if the locking succeeded
+    template <typename Rep, typename Period>
+    [[nodiscard]] bool try_lock_shared_for(const std::chrono::duration<Rep, Period>&);
+
+    /// Tries to lock the mutex for shared ownership till specified time point.
+    ///
+    /// @returns true if the locking succeeded
+    template <typename Clock, typename Duration>
+    [[nodiscard]] bool try_lock_shared_until(const std::chrono::time_point<Clock, Duration>&);
+
+    /// @overload
+    [[nodiscard]] bool try_lock_shared_until(Deadline deadline);
+
+private:
+    bool TryLockSharedFast() noexcept;
+
+    bool WaitForReaders(Deadline deadline);
+
+    concurrent::impl::StripedReadIndicator readers_;
+
+    /* Set by the writer holding writer_mutex_. New readers do not stay on the
+     * fast path while it is set, the leaving readers wake up the writer.
+     */
+    std::atomic<bool> writer_active_{false};
+    Mutex writer_mutex_;
+    SingleConsumerEvent readers_left_;
+};
+
+template <typename Rep, typename Period>
+bool ReaderBiasedSharedMutex::try_lock_for(const std::chrono::duration<Rep, Period>& duration) {
+    return try_lock_until(Deadline::FromDuration(duration));
+}
+
+template <typename Rep, typename Period>
+bool ReaderBiasedSharedMutex::try_lock_shared_for(const std::chrono::duration<Rep, Period>& duration) {
+    return try_lock_shared_until(Deadline::FromDuration(duration));
+}
+
+template <typename Clock, typename Duration>
+bool ReaderBiasedSharedMutex::try_lock_until(const std::chrono::time_point<Clock, Duration>& until) {
+    return try_lock_until(Deadline::FromTimePoint(until));
+}
+
+template <typename Clock, typename Duration>
+bool ReaderBiasedSharedMutex::try_lock_shared_until(const std::chrono::time_point<Clock, Duration>& until) {
+    return try_lock_shared_until(Deadline::FromTimePoint(until));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
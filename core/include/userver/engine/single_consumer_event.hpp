@@ -7,6 +7,7 @@
 #include <chrono>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/impl/context_accessor.hpp>
 #include <userver/engine/impl/wait_list_fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -16,7 +17,9 @@ namespace engine {
 /// @ingroup userver_concurrency
 ///
 /// @brief A multiple-producers, single-consumer event
-class SingleConsumerEvent final {
+///
+/// Compatible with engine::WaitAny and friends, which do not reset the signal.
+class SingleConsumerEvent final : private impl::ContextAccessor {
 public:
     struct NoAutoReset final {};
 
@@ -96,11 +99,21 @@ public:
     void Send();
 
     /// Returns `true` iff already signaled. Never resets the signal.
-    [[nodiscard]] bool IsReady() const noexcept;
+    [[nodiscard]] bool IsReady() const noexcept override;
+
+    /// @cond
+    // For internal use only.
+    impl::ContextAccessor* TryGetContextAccessor() noexcept { return this; }
+    /// @endcond
 
 private:
     class EventWaitStrategy;
 
+    impl::EarlyWakeup TryAppendWaiter(impl::TaskContext& waiter) override;
+    void RemoveWaiter(impl::TaskContext& waiter) noexcept override;
+    void RethrowErrorResult() const override;
+    void AfterWait() noexcept override;
+
     bool GetIsSignaled() noexcept;
 
     void CheckIsAutoResetForWaitPredicate();
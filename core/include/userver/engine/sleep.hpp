@@ -15,6 +15,13 @@ namespace engine {
 /// other tasks to execute
 void Yield();
 
+/// @brief Yields only if the current task has been running without a context
+/// switch for longer than the `time-slice` of its task processor
+///
+/// Cheap enough to be called from tight CPU-bound loops, e.g. on each
+/// processed element. Does nothing if `time-slice` is not configured.
+void MaybeYield();
+
 /// @cond
 /// Recursion stoppers/specializations
 void InterruptibleSleepUntil(Deadline);
@@ -13,6 +13,11 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine::io {
+class PipeReader;
+class PipeWriter;
+}  // namespace engine::io
+
 namespace engine::subprocess {
 
 class ChildProcessImpl;
@@ -63,8 +68,21 @@ public:
     /// Send a signal to the child process.
     void SendSignal(int signum);
 
+    /// Returns the writing end of the pipe connected to stdin of the child
+    /// process if ExecOptions::stdin_pipe was set, `nullptr` otherwise. Close it
+    /// to signal the end of input.
+    io::PipeWriter* GetStdin() noexcept;
+
+    /// Returns the reading end of the pipe connected to stdout of the child
+    /// process if ExecOptions::stdout_pipe was set, `nullptr` otherwise.
+    io::PipeReader* GetStdout() noexcept;
+
+    /// Returns the reading end of the pipe connected to stderr of the child
+    /// process if ExecOptions::stderr_pipe was set, `nullptr` otherwise.
+    io::PipeReader* GetStderr() noexcept;
+
 private:
-    static constexpr std::size_t kImplSize = compiler::SelectSize().For64Bit(24).For32Bit(12);
+    static constexpr std::size_t kImplSize = compiler::SelectSize().For64Bit(32).For32Bit(16);
     static constexpr std::size_t kImplAlignment = alignof(void*);
     utils::FastPimpl<ChildProcessImpl, kImplSize, kImplAlignment> impl_;
 };
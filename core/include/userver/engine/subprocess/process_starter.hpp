@@ -40,14 +40,26 @@ struct ExecOptions final {
     /// If `true`, and `executable_path` contains `/`, `executable_path` is treated as absolute
     /// path or a relative path.
     bool use_path{false};
+    /// If `true`, stdin of the child process is connected to a pipe, see
+    /// ChildProcess::GetStdin()
+    bool stdin_pipe{false};
+    /// If `true`, stdout of the child process is connected to a pipe, see
+    /// ChildProcess::GetStdout(). Can not be used together with `stdout_file`
+    bool stdout_pipe{false};
+    /// If `true`, stderr of the child process is connected to a pipe, see
+    /// ChildProcess::GetStderr(). Can not be used together with `stderr_file`
+    bool stderr_pipe{false};
 };
 
 /// @ingroup userver_clients
 ///
 /// @brief Creates a new OS subprocess and executes a command in it.
+///
+/// The subprocess is spawned with vfork() + execve(), so the spawning time
+/// does not depend on the memory size of the service.
 class ProcessStarter {
 public:
-    /// @param task_processor will be used for executing asynchronous fork + exec.
+    /// @param task_processor will be used for executing asynchronous vfork + exec.
     /// `main-task-processor is OK for this purpose.
     explicit ProcessStarter(TaskProcessor& task_processor);
 
@@ -58,7 +70,8 @@ public:
     /// @param args exact args passed to the executable
     /// @param options @ref ExecOptions settings
     /// @throws std::runtime_error if `use_path` is `true`, `executable_path` contains `/`
-    /// and PATH not in environment variables
+    /// and PATH not in environment variables, or if both a file and a pipe are
+    /// requested for the same output stream
     ChildProcess
     Exec(const std::string& executable_path, const std::vector<std::string>& args, ExecOptions&& options = {});
 
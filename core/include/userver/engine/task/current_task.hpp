@@ -3,8 +3,10 @@
 /// @file userver/engine/task/current_task.hpp
 /// @brief Utility functions that query and operate on the current task
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
 
@@ -16,6 +18,20 @@ class ThreadControl;
 
 namespace engine {
 
+/// @brief The time a task has spent in each of its states since it was
+/// scheduled for the first time, see engine::current_task::GetTimings()
+struct TaskTimings final {
+    /// Waiting in the task processor queue for a worker thread
+    std::chrono::nanoseconds queue_wait{0};
+
+    /// Running on a worker thread. That is CPU time, unless the OS preempts
+    /// the worker or the task makes a blocking call
+    std::chrono::nanoseconds running{0};
+
+    /// Suspended on I/O, timers, synchronization primitives and other tasks
+    std::chrono::nanoseconds suspended{0};
+};
+
 /// @brief Namespace with functions to work with current task from within it
 namespace current_task {
 
@@ -29,6 +45,13 @@ TaskProcessor& GetTaskProcessor();
 /// Returns task coroutine stack size
 std::size_t GetStackSize();
 
+/// @brief Returns the time the current task has spent in the queue, running
+/// and suspended so far, including the current run
+///
+/// @returns std::nullopt outside of a task or if the task processor is not
+/// configured with `task-timings: true`
+std::optional<TaskTimings> GetTimings() noexcept;
+
 /// @cond
 // Returns ev thread handle, internal use only
 ev::ThreadControl& GetEventThread();
@@ -41,6 +64,9 @@ namespace impl {
 // For internal use only.
 std::uint64_t GetCreatedTaskCount(TaskProcessor&);
 
+// For internal use only.
+std::size_t GetWorkerCount(TaskProcessor&);
+
 }  // namespace impl
 
 }  // namespace engine
@@ -19,6 +19,10 @@ namespace engine {
 /// These are like engine::TaskLocalVariable, but the variable instances are
 /// inherited by child tasks created via utils::Async.
 ///
+/// A child task shares the variable instances with its parent, spawning it
+/// costs the same regardless of the number of the variables. A task that sets
+/// or erases a variable gets its own copy of the pointers to the instances.
+///
 /// The order of destruction of task-inherited variables is unspecified.
 template <typename T>
 class TaskInheritedVariable final {
@@ -13,9 +13,16 @@ struct TaskProcessorConfig;
 
 class SingleThreadedTaskProcessorsPool final {
 public:
+    struct PinEvThreads {};
+    static constexpr PinEvThreads kPinEvThreads{};
+
     // Do NOT use directly! Use components::SingleThreadedTaskProcessors or for
     // tests and benchmarks use SingleThreadedTaskProcessorsPool::MakeForTests()
     explicit SingleThreadedTaskProcessorsPool(const engine::TaskProcessorConfig& config_base);
+
+    // Binds the i-th task processor to the (i % ev_threads)-th ev thread, so
+    // that the tasks of a processor never touch other ev threads.
+    SingleThreadedTaskProcessorsPool(const engine::TaskProcessorConfig& config_base, PinEvThreads);
     ~SingleThreadedTaskProcessorsPool();
 
     size_t GetSize() const noexcept { return processors_.size(); }
@@ -25,6 +32,8 @@ public:
     static SingleThreadedTaskProcessorsPool MakeForTests(std::size_t worker_threads);
 
 private:
+    SingleThreadedTaskProcessorsPool(const engine::TaskProcessorConfig& config_base, bool pin_ev_threads);
+
     std::vector<std::unique_ptr<engine::TaskProcessor>> processors_;
 };
 
@@ -3,6 +3,9 @@
 /// @file userver/fs/fs_cache_client.hpp
 /// @brief @copybref fs::FsCacheClient
 
+#include <string>
+#include <vector>
+
 #include <userver/engine/io/sys_linux/inotify.hpp>
 #include <userver/fs/read.hpp>
 #include <userver/rcu/rcu_map.hpp>
@@ -12,18 +15,40 @@ USERVER_NAMESPACE_BEGIN
 
 namespace fs {
 
+/// @brief Settings of the precompressed variants of the files cached by
+/// fs::FsCacheClient, see FileInfoWithData::precompressed
+struct FsCachePrecompressSettings {
+    /// Content codings to compress the files with, `gzip` and `zstd` are
+    /// supported
+    std::vector<std::string> encodings;
+    /// Smaller files are not worth compressing
+    std::size_t min_size{1024};
+};
+
 /// @ingroup userver_clients
 ///
 /// @brief Class client for storing files in memory
 /// Usually retrieved from `components::FsCache`
 class FsCacheClient final {
 public:
+    using PrecompressSettings = FsCachePrecompressSettings;
+
     /// @brief Fills the cache and starts periodic update
     /// @param dir directory to cache files from
     /// @param update_period time (0 - fill the cache only at startup), not used
     /// in Linux
     /// @param tp task processor to do filesystem operations
-    FsCacheClient(std::string_view dir, std::chrono::milliseconds update_period, engine::TaskProcessor& tp);
+    /// @param max_in_memory_file_size larger files are kept open instead of
+    /// being read into memory, see FileInfoWithData::file
+    /// @param precompress the in-memory files are compressed once per file
+    /// version on `tp`
+    FsCacheClient(
+        std::string_view dir,
+        std::chrono::milliseconds update_period,
+        engine::TaskProcessor& tp,
+        std::size_t max_in_memory_file_size = kUnlimitedInMemoryFileSize,
+        PrecompressSettings precompress = {}
+    );
 
     /// @brief get file from memory
     /// @param path to file
@@ -35,12 +60,14 @@ public:
     void UpdateCache();
 
 private:
+    void PrecompressBlocking(FileInfoWithData& info) const;
+
 #ifdef __linux__
     void InotifyWork();
 
     void HandleDelete(const std::string& path);
 
-    static void HandleDeleteDirectory(engine::io::sys_linux::Inotify& inotify, const std::string& path);
+    void HandleDeleteDirectory(engine::io::sys_linux::Inotify& inotify, const std::string& path);
 
     void HandleCreate(const std::string& path);
 
@@ -52,6 +79,8 @@ private:
     const std::string dir_;
     const std::chrono::milliseconds update_period_;
     engine::TaskProcessor& tp_;
+    const std::size_t max_in_memory_file_size_;
+    const PrecompressSettings precompress_;
 #ifndef __linux__
     utils::PeriodicTask cache_updater_;
 #endif
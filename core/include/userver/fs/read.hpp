@@ -3,11 +3,15 @@
 /// @file userver/fs/read.hpp
 /// @brief functions for asynchronous file read operations
 
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/utils/flags.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,12 +19,29 @@ USERVER_NAMESPACE_BEGIN
 /// @brief filesystem support
 namespace fs {
 
+/// @brief `data` of a file compressed with a content coding
+struct PrecompressedData {
+    /// Content coding, e.g. "gzip"
+    std::string encoding;
+    std::string data;
+};
+
 /// @brief Struct file with load data
 struct FileInfoWithData {
     std::string data;
     std::string extension;
+    /// Open file to send the contents from, set instead of `data` for the files
+    /// that are too large to be kept in memory
+    std::shared_ptr<const blocking::FileDescriptor> file;
+    /// Size of the file contents
+    std::size_t size{0};
+    /// Compressed variants of `data`, filled by fs::FsCacheClient if requested
+    std::vector<PrecompressedData> precompressed;
 };
 
+/// Do not limit the size of the files read into memory
+inline constexpr std::size_t kUnlimitedInMemoryFileSize = std::numeric_limits<std::size_t>::max();
+
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
 using FileInfoWithDataMap = std::unordered_map<std::string, FileInfoWithDataConstPtr>;
 
@@ -41,13 +62,29 @@ std::string GetLexicallyRelative(std::string_view path, std::string_view dir);
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path to directory to traverse recursively
 /// @param flags settings read files
+/// @param max_in_memory_file_size files larger than that are kept open
+/// instead of being read into memory, see FileInfoWithData::file
 /// @returns map with relative to `path` filepaths and file info
 /// @throws std::runtime_error if read fails for any reason (e.g. no such file,
 /// read error, etc.),
 FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     engine::TaskProcessor& async_tp,
     const std::string& path,
-    utils::Flags<SettingsReadFile> flags = {SettingsReadFile::kSkipHidden}
+    utils::Flags<SettingsReadFile> flags = {SettingsReadFile::kSkipHidden},
+    std::size_t max_in_memory_file_size = kUnlimitedInMemoryFileSize
+);
+
+/// @brief Reads file info asynchronously
+/// @param async_tp TaskProcessor for synchronous waiting
+/// @param path file to open
+/// @param max_in_memory_file_size a larger file is kept open instead of being
+/// read into memory, see FileInfoWithData::file
+/// @throws std::runtime_error if read fails for any reason (e.g. no such file,
+/// read error, etc.),
+FileInfoWithData ReadFileInfoWithData(
+    engine::TaskProcessor& async_tp,
+    const std::string& path,
+    std::size_t max_in_memory_file_size = kUnlimitedInMemoryFileSize
 );
 
 /// @brief Reads file contents asynchronously
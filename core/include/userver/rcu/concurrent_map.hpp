@@ -0,0 +1,535 @@
+#pragma once
+
+/// @file userver/rcu/concurrent_map.hpp
+/// @brief @copybrief rcu::ConcurrentMap
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/concurrent/impl/asymmetric_fence.hpp>
+#include <userver/concurrent/impl/striped_read_indicator.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace rcu {
+
+namespace impl {
+
+// Keys are distributed between the writer locks by their hash
+inline constexpr std::size_t kConcurrentMapStripeCount = 16;
+
+// Leaves room for the concurrent inserts from all the stripes above the load
+// factor limit
+inline constexpr std::size_t kConcurrentMapMinCapacity = 64;
+
+// Removed nodes are freed once per this many removals
+inline constexpr std::size_t kConcurrentMapRetireBatchSize = 64;
+
+template <typename Key, typename Value>
+struct ConcurrentMapNode final {
+    std::size_t hash;
+    Key key;
+    std::shared_ptr<Value> value;
+};
+
+template <typename Node>
+struct ConcurrentMapTable final {
+    explicit ConcurrentMapTable(std::size_t capacity)
+        : mask(capacity - 1), slots(std::make_unique<std::atomic<Node*>[]>(capacity)) {
+        UASSERT(capacity != 0 && (capacity & mask) == 0);
+        for (std::size_t i = 0; i < capacity; ++i) {
+            slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t Capacity() const noexcept { return mask + 1; }
+
+    // Inserts stop well before the table is full, so probing always finds
+    // an empty slot
+    bool IsOverloaded(std::size_t extra) const noexcept {
+        return (used.load() + extra) * 4 > Capacity() * 3 - kConcurrentMapStripeCount * 4;
+    }
+
+    const std::size_t mask;
+    const std::unique_ptr<std::atomic<Node*>[]> slots;
+    // Slots that are not empty, including tombstones
+    std::atomic<std::size_t> used{0};
+};
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief Concurrent hash map with lock-free reads and per-key updates
+///
+/// Unlike rcu::RcuMap, which copies the whole map on every keyset change,
+/// modifies a single slot of an open-addressing table on insert or erase, so
+/// it is suitable for maps with frequent keyset changes.
+///
+/// - Reads (`Get`) don't take any locks: a reader registers in the current
+///   reclamation epoch, which costs about the same as an rcu::Variable read,
+///   and probes the table.
+/// - Writers take one of the `MutexType` locks from `RcuMapTraits`, selected by
+///   the key hash, so writes of different keys mostly proceed in parallel.
+///   With the default engine::Mutex, waiting writers don't block OS threads.
+/// - The table grows when it is 3/4 full. Growing takes all the writer locks
+///   and copies the node pointers, not the keys and values.
+/// - Removed entries are freed in batches once no readers may still see them.
+///
+/// Values are stored in `shared_ptr`s, like in rcu::RcuMap. No synchronization
+/// is provided for value access, it must be implemented by Value when
+/// necessary. `RcuMapTraits::DeleterType` is ignored, removed entries are
+/// destroyed by the writers.
+///
+/// ## Example usage:
+///
+/// @snippet rcu/concurrent_map_test.cpp  Sample rcu::ConcurrentMap usage
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename Key, typename Value, typename RcuMapTraits = DefaultRcuMapTraits<Key>>
+class ConcurrentMap final {
+    static_assert(
+        std::is_base_of_v<impl::ShouldInheritFromDefaultRcuMapTraits, RcuMapTraits>,
+        "RcuMapTraits should inherit from rcu::DefaultRcuMapTraits"
+    );
+
+public:
+    static_assert(!std::is_reference_v<Key>);
+    static_assert(!std::is_reference_v<Value>);
+    static_assert(!std::is_const_v<Key>);
+
+    using Hash = typename RcuMapTraits::Hash;
+    using KeyEqual = typename RcuMapTraits::KeyEqual;
+    using MutexType = typename RcuMapTraits::MutexType;
+    using ValuePtr = std::shared_ptr<Value>;
+    using ConstValuePtr = std::shared_ptr<const Value>;
+    using Snapshot = std::unordered_map<Key, ConstValuePtr, Hash, KeyEqual>;
+    using InsertReturnType = typename RcuMap<Key, Value, RcuMapTraits>::InsertReturnType;
+
+    ConcurrentMap();
+    ~ConcurrentMap();
+
+    ConcurrentMap(const ConcurrentMap&) = delete;
+    ConcurrentMap(ConcurrentMap&&) = delete;
+    ConcurrentMap& operator=(const ConcurrentMap&) = delete;
+    ConcurrentMap& operator=(ConcurrentMap&&) = delete;
+
+    /// Returns an estimated size of the map at some point in time
+    std::size_t SizeApprox() const noexcept;
+
+    /// @brief Returns a readonly value pointer by its key or an empty pointer
+    ConstValuePtr Get(const Key&) const;
+
+    /// @brief Returns a modifiable value pointer by key or an empty pointer
+    ValuePtr Get(const Key&);
+
+    /// @brief Inserts a new element into the container if there is no element
+    /// with the key in the container.
+    /// Returns a pair consisting of a pointer to the inserted element, or the
+    /// already-existing element if no insertion happened, and a bool denoting
+    /// whether the insertion took place.
+    InsertReturnType Insert(const Key& key, ValuePtr value);
+
+    /// @brief Inserts a new element into the container constructed in-place with
+    /// the given args if there is no element with the key in the container.
+    /// @note The value may be constructed even if no insertion happened.
+    template <typename... Args>
+    InsertReturnType Emplace(const Key& key, Args&&... args);
+
+    /// @brief Same as `Emplace`, but the value is only constructed if
+    /// the insertion takes place.
+    template <typename... Args>
+    InsertReturnType TryEmplace(const Key& key, Args&&... args);
+
+    /// @brief If a key equivalent to `key` already exists in the container,
+    /// replaces the associated value. Otherwise, inserts a new pair into the map.
+    void InsertOrAssign(const Key& key, ValuePtr value);
+
+    /// @brief Removes a key from the map
+    /// @returns whether the key was present
+    bool Erase(const Key&);
+
+    /// @brief Removes a key from the map returning its value
+    /// @returns a value if the key was present, empty pointer otherwise
+    ValuePtr Pop(const Key&);
+
+    /// Resets the map to an empty state
+    void Clear();
+
+    /// @brief Returns a readonly copy of the map
+    /// @note Concurrent changes may or may not be visible in the snapshot.
+    Snapshot GetSnapshot() const;
+
+    /// @brief Frees the removed entries that are no longer visible to readers
+    /// @note Removed entries are also freed by the writers in batches, calling
+    /// `Cleanup` is only required to free memory after a burst of writes.
+    void Cleanup();
+
+private:
+    using Node = impl::ConcurrentMapNode<Key, Value>;
+    using Table = impl::ConcurrentMapTable<Node>;
+    using StripeLock = std::unique_lock<MutexType>;
+
+    static inline char tombstone_tag_{};
+
+    static Node* Tombstone() noexcept { return reinterpret_cast<Node*>(&tombstone_tag_); }
+
+    static bool IsNode(const Node* node) noexcept { return node != nullptr && node != Tombstone(); }
+
+    struct FindResult final {
+        std::atomic<Node*>* slot{nullptr};
+        Node* node{nullptr};
+        // The first empty slot in the probe sequence if the key is not found
+        std::size_t empty_index{0};
+    };
+
+    FindResult Find(const Table& table, const Key& key, std::size_t hash) const;
+
+    template <typename ValueFactory>
+    InsertReturnType DoInsert(const Key& key, ValueFactory&& factory, bool assign);
+
+    ValuePtr DoErase(const Key& key);
+
+    MutexType& GetStripe(std::size_t hash) { return stripes_[hash % impl::kConcurrentMapStripeCount]; }
+
+    // Replaces the table with a fresh copy of 'table', dropping the tombstones.
+    // Takes all the stripe locks.
+    void Rehash(const Table* table);
+
+    concurrent::impl::StripedReadIndicatorLock LockEpoch() const noexcept;
+
+    void Retire(Node* node);
+    void Retire(Table* table);
+    void TryAdvanceEpoch(std::unique_lock<MutexType>& lock) noexcept;
+    static void Dispose(std::vector<Node*>& nodes, std::vector<Table*>& tables) noexcept;
+
+    std::array<MutexType, impl::kConcurrentMapStripeCount> stripes_;
+    std::atomic<Table*> table_;
+    std::atomic<std::size_t> size_{0};
+
+    // Epoch-based reclamation, see rcu::ReclamationMode::kEpoch
+    std::atomic<std::uint64_t> epoch_{0};
+    mutable concurrent::impl::StripedReadIndicator readers_[impl::kEpochCount];
+    // Covers the retired lists
+    MutexType retire_mutex_;
+    std::vector<Node*> retired_nodes_[impl::kEpochCount];
+    std::vector<Table*> retired_tables_[impl::kEpochCount];
+    std::size_t retired_since_advance_{0};
+};
+
+template <typename K, typename V, typename Traits>
+ConcurrentMap<K, V, Traits>::ConcurrentMap() : table_(new Table(impl::kConcurrentMapMinCapacity)) {}
+
+template <typename K, typename V, typename Traits>
+ConcurrentMap<K, V, Traits>::~ConcurrentMap() {
+    for (std::size_t i = 0; i < impl::kEpochCount; ++i) {
+        UASSERT_MSG(readers_[i].IsFree(), "ConcurrentMap is destroyed while being used");
+        Dispose(retired_nodes_[i], retired_tables_[i]);
+    }
+
+    std::unique_ptr<Table> table(table_.load());
+    for (std::size_t i = 0; i < table->Capacity(); ++i) {
+        auto* node = table->slots[i].load();
+        if (IsNode(node)) delete node;
+    }
+}
+
+template <typename K, typename V, typename Traits>
+std::size_t ConcurrentMap<K, V, Traits>::SizeApprox() const noexcept {
+    return size_.load(std::memory_order_relaxed);
+}
+
+template <typename K, typename V, typename Traits>
+auto ConcurrentMap<K, V, Traits>::Get(const K& key) const -> ConstValuePtr {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    return const_cast<ConcurrentMap<K, V, Traits>*>(this)->Get(key);
+}
+
+template <typename K, typename V, typename Traits>
+auto ConcurrentMap<K, V, Traits>::Get(const K& key) -> ValuePtr {
+    const auto hash = Hash{}(key);
+    const auto lock = LockEpoch();
+    const auto* table = table_.load(std::memory_order_seq_cst);
+    const auto result = Find(*table, key, hash);
+    return result.node ? result.node->value : nullptr;
+}
+
+template <typename K, typename V, typename Traits>
+auto ConcurrentMap<K, V, Traits>::Insert(const K& key, ValuePtr value) -> InsertReturnType {
+    return DoInsert(key, [&] { return std::move(value); }, /*assign=*/false);
+}
+
+template <typename K, typename V, typename Traits>
+template <typename... Args>
+auto ConcurrentMap<K, V, Traits>::Emplace(const K& key, Args&&... args) -> InsertReturnType {
+    InsertReturnType result{Get(key), false};
+    if (result.value) return result;
+
+    return Insert(key, std::make_shared<V>(std::forward<Args>(args)...));
+}
+
+template <typename K, typename V, typename Traits>
+template <typename... Args>
+auto ConcurrentMap<K, V, Traits>::TryEmplace(const K& key, Args&&... args) -> InsertReturnType {
+    InsertReturnType result{Get(key), false};
+    if (result.value) return result;
+
+    return DoInsert(
+        key, [&] { return std::make_shared<V>(std::forward<Args>(args)...); }, /*assign=*/false
+    );
+}
+
+template <typename K, typename V, typename Traits>
+void ConcurrentMap<K, V, Traits>::InsertOrAssign(const K& key, ValuePtr value) {
+    DoInsert(key, [&] { return std::move(value); }, /*assign=*/true);
+}
+
+template <typename K, typename V, typename Traits>
+bool ConcurrentMap<K, V, Traits>::Erase(const K& key) {
+    return DoErase(key) != nullptr;
+}
+
+template <typename K, typename V, typename Traits>
+auto ConcurrentMap<K, V, Traits>::Pop(const K& key) -> ValuePtr {
+    return DoErase(key);
+}
+
+template <typename K, typename V, typename Traits>
+void ConcurrentMap<K, V, Traits>::Clear() {
+    std::array<StripeLock, impl::kConcurrentMapStripeCount> locks;
+    for (std::size_t i = 0; i < locks.size(); ++i) {
+        locks[i] = StripeLock(stripes_[i]);
+    }
+
+    auto new_table = std::make_unique<Table>(impl::kConcurrentMapMinCapacity);
+    auto* old_table = table_.load();
+    table_.store(new_table.release(), std::memory_order_seq_cst);
+    size_.store(0);
+
+    for (std::size_t i = 0; i < old_table->Capacity(); ++i) {
+        auto* node = old_table->slots[i].load();
+        if (IsNode(node)) Retire(node);
+    }
+    Retire(old_table);
+}
+
+template <typename K, typename V, typename Traits>
+auto ConcurrentMap<K, V, Traits>::GetSnapshot() const -> Snapshot {
+    Snapshot result;
+    const auto lock = LockEpoch();
+    const auto* table = table_.load(std::memory_order_seq_cst);
+    result.reserve(SizeApprox());
+    for (std::size_t i = 0; i < table->Capacity(); ++i) {
+        const auto* node = table->slots[i].load(std::memory_order_acquire);
+        if (IsNode(node)) result.emplace(node->key, node->value);
+    }
+    return result;
+}
+
+template <typename K, typename V, typename Traits>
+void ConcurrentMap<K, V, Traits>::Cleanup() {
+    std::unique_lock lock(retire_mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) return;
+
+    // The nodes retired in the current epoch are freed after two epoch advances
+    TryAdvanceEpoch(lock);
+    TryAdvanceEpoch(lock);
+}
+
+template <typename K, typename V, typename Traits>
+auto ConcurrentMap<K, V, Traits>::Find(const Table& table, const K& key, std::size_t hash) const -> FindResult {
+    for (std::size_t i = 0; i <= table.mask; ++i) {
+        const auto index = (hash + i) & table.mask;
+        auto& slot = table.slots[index];
+        auto* node = slot.load(std::memory_order_acquire);
+
+        if (node == nullptr) return {nullptr, nullptr, index};
+        if (node != Tombstone() && node->hash == hash && KeyEqual{}(node->key, key)) {
+            return {&slot, node, 0};
+        }
+    }
+
+    UINVARIANT(false, "ConcurrentMap table has no empty slots");
+}
+
+template <typename K, typename V, typename Traits>
+template <typename ValueFactory>
+auto ConcurrentMap<K, V, Traits>::DoInsert(const K& key, ValueFactory&& factory, bool assign) -> InsertReturnType {
+    const auto hash = Hash{}(key);
+    StripeLock lock(GetStripe(hash));
+
+    while (true) {
+        // The table can only be replaced by a writer holding all the stripe locks
+        auto* table = table_.load();
+        const auto found = Find(*table, key, hash);
+
+        if (found.node) {
+            if (!assign) return {found.node->value, false};
+
+            // Nodes of this key are only changed under our stripe lock
+            auto* new_node = new Node{hash, key, factory()};
+            found.slot->store(new_node, std::memory_order_seq_cst);
+            Retire(found.node);
+            return {new_node->value, true};
+        }
+
+        if (table->IsOverloaded(1)) {
+            lock.unlock();
+            Rehash(table);
+            lock.lock();
+            continue;
+        }
+
+        auto node = std::make_unique<Node>(Node{hash, key, factory()});
+        ValuePtr value = node->value;
+
+        // Writers of other stripes may occupy the empty slots concurrently.
+        // They insert other keys, so it's enough to take the next empty slot.
+        for (std::size_t i = 0;; ++i) {
+            UINVARIANT(i <= table->mask, "ConcurrentMap table has no empty slots");
+            auto& slot = table->slots[(found.empty_index + i) & table->mask];
+            Node* expected = nullptr;
+            if (slot.compare_exchange_strong(expected, node.get(), std::memory_order_seq_cst)) {
+                break;
+            }
+        }
+        node.release();
+        table->used.fetch_add(1);
+        size_.fetch_add(1, std::memory_order_relaxed);
+        return {std::move(value), true};
+    }
+}
+
+template <typename K, typename V, typename Traits>
+auto ConcurrentMap<K, V, Traits>::DoErase(const K& key) -> ValuePtr {
+    if (!Get(key)) return nullptr;
+
+    const auto hash = Hash{}(key);
+    StripeLock lock(GetStripe(hash));
+
+    auto* table = table_.load();
+    const auto found = Find(*table, key, hash);
+    if (!found.node) return nullptr;
+
+    found.slot->store(Tombstone(), std::memory_order_seq_cst);
+    size_.fetch_sub(1, std::memory_order_relaxed);
+
+    ValuePtr value = found.node->value;
+    Retire(found.node);
+    return value;
+}
+
+template <typename K, typename V, typename Traits>
+void ConcurrentMap<K, V, Traits>::Rehash(const Table* table) {
+    std::array<StripeLock, impl::kConcurrentMapStripeCount> locks;
+    for (std::size_t i = 0; i < locks.size(); ++i) {
+        locks[i] = StripeLock(stripes_[i]);
+    }
+
+    auto* old_table = table_.load();
+    // Someone has already rehashed the table
+    if (old_table != table) return;
+
+    std::size_t live_count = 0;
+    for (std::size_t i = 0; i < old_table->Capacity(); ++i) {
+        if (IsNode(old_table->slots[i].load())) ++live_count;
+    }
+
+    // Keep the load factor of the new table below 1/2, so that it is not
+    // overloaded right away
+    std::size_t capacity = impl::kConcurrentMapMinCapacity;
+    while (capacity < (live_count + impl::kConcurrentMapStripeCount) * 2) capacity *= 2;
+
+    auto new_table = std::make_unique<Table>(capacity);
+    for (std::size_t i = 0; i < old_table->Capacity(); ++i) {
+        auto* node = old_table->slots[i].load();
+        if (!IsNode(node)) continue;
+
+        for (std::size_t j = node->hash;; ++j) {
+            auto& slot = new_table->slots[j & new_table->mask];
+            if (slot.load(std::memory_order_relaxed) == nullptr) {
+                slot.store(node, std::memory_order_relaxed);
+                break;
+            }
+        }
+    }
+    new_table->used.store(live_count);
+
+    // The nodes are now shared by both tables, only the old table is retired
+    table_.store(new_table.release(), std::memory_order_seq_cst);
+    Retire(old_table);
+}
+
+template <typename K, typename V, typename Traits>
+concurrent::impl::StripedReadIndicatorLock ConcurrentMap<K, V, Traits>::LockEpoch() const noexcept {
+    auto epoch = epoch_.load();
+
+    while (true) {
+        auto lock = readers_[epoch % impl::kEpochCount].Lock();
+
+        // Pairs with AsymmetricThreadFenceHeavy in TryAdvanceEpoch, see
+        // rcu::ReadablePtr for details.
+        concurrent::impl::AsymmetricThreadFenceLight();
+
+        const auto new_epoch = epoch_.load(std::memory_order_seq_cst);
+        if (new_epoch == epoch) return lock;
+        epoch = new_epoch;
+    }
+}
+
+template <typename K, typename V, typename Traits>
+void ConcurrentMap<K, V, Traits>::Retire(Node* node) {
+    std::unique_lock lock(retire_mutex_);
+    retired_nodes_[epoch_.load() % impl::kEpochCount].push_back(node);
+    if (++retired_since_advance_ >= impl::kConcurrentMapRetireBatchSize) {
+        TryAdvanceEpoch(lock);
+    }
+}
+
+template <typename K, typename V, typename Traits>
+void ConcurrentMap<K, V, Traits>::Retire(Table* table) {
+    std::unique_lock lock(retire_mutex_);
+    retired_tables_[epoch_.load() % impl::kEpochCount].push_back(table);
+    TryAdvanceEpoch(lock);
+}
+
+// Same scheme as in rcu::Variable with rcu::ReclamationMode::kEpoch: objects
+// retired in epoch E may only be seen by readers registered in epochs E-1
+// and E, so once readers of E-1 have left, the epoch may advance to E+1, and
+// the objects retired in E-1 are freed.
+template <typename K, typename V, typename Traits>
+void ConcurrentMap<K, V, Traits>::TryAdvanceEpoch(std::unique_lock<MutexType>& lock) noexcept {
+    UASSERT(lock.owns_lock());
+    retired_since_advance_ = 0;
+
+    const auto epoch = epoch_.load();
+    const auto previous = (epoch + impl::kEpochCount - 1) % impl::kEpochCount;
+
+    concurrent::impl::AsymmetricThreadFenceHeavy();
+    if (!readers_[previous].IsFree()) return;
+
+    Dispose(retired_nodes_[previous], retired_tables_[previous]);
+    epoch_.store(epoch + 1, std::memory_order_seq_cst);
+}
+
+template <typename K, typename V, typename Traits>
+void ConcurrentMap<K, V, Traits>::Dispose(std::vector<Node*>& nodes, std::vector<Table*>& tables) noexcept {
+    for (auto* node : nodes) delete node;
+    nodes.clear();
+    for (auto* table : tables) delete table;
+    tables.clear();
+}
+
+}  // namespace rcu
+
+USERVER_NAMESPACE_END
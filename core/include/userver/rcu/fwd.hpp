@@ -9,6 +9,7 @@ namespace rcu {
 
 struct DefaultRcuTraits;
 struct SyncRcuTraits;
+struct EpochRcuTraits;
 struct BlockingRcuTraits;
 
 template <typename Key>
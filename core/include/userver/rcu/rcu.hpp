@@ -3,10 +3,14 @@
 /// @file userver/rcu/rcu.hpp
 /// @brief @copybrief rcu::Variable
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <mutex>
 #include <optional>
+#include <type_traits>
 #include <utility>
 
 #include <userver/concurrent/impl/asymmetric_fence.hpp>
@@ -88,6 +92,24 @@ private:
     SnapshotRecord<T>* head_{nullptr};
 };
 
+// Retired snapshots are freed two epochs after the one they were retired in,
+// so three epochs are in use at any moment.
+inline constexpr std::size_t kEpochCount = 3;
+
+// An epoch advance requires an expensive AsymmetricThreadFenceHeavy,
+// so writers try to advance the epoch once per this many retired snapshots.
+inline constexpr std::size_t kEpochRetireBatchSize = 8;
+
+template <typename T>
+struct EpochState final {
+    std::atomic<std::uint64_t> epoch{0};
+    mutable concurrent::impl::StripedReadIndicator readers[kEpochCount];
+    SnapshotRecordRetiredList<T> retired[kEpochCount];
+    std::size_t retired_since_advance{0};
+};
+
+struct NoEpochState final {};
+
 }  // namespace impl
 
 /// @brief A handle to the retired object version, which an RCU deleter should
@@ -159,6 +181,25 @@ private:
     utils::impl::WaitTokenStorage wait_token_storage_;
 };
 
+/// @brief Selects how rcu::Variable finds out that a retired value is no
+/// longer read.
+/// @see rcu::DefaultRcuTraits
+enum class ReclamationMode {
+    /// Each value has its own read indicator. Writers check the indicators of
+    /// all the retired values on each write, so the write cost grows with
+    /// the number of values held by readers. Retired values are freed as soon
+    /// as the last reader is gone.
+    kPerValue,
+
+    /// Readers register in the current global epoch. Writers retire values
+    /// into the current epoch and, once per a batch of retired values, advance
+    /// the epoch if the readers of the previous one are gone, freeing the
+    /// values retired two epochs ago. The write cost does not depend on the
+    /// number of retired values, but a long-living reader delays the freeing
+    /// of all the values retired after it has started.
+    kEpoch,
+};
+
 /// @brief Default RCU traits. Deletes garbage asynchronously.
 /// Designed for storing data of multi-megabyte or multi-gigabyte caches.
 /// @note Allows reads from any kind of thread.
@@ -175,6 +216,10 @@ struct DefaultRcuTraits {
     /// 1. should contain `void Delete(SnapshotHandle<T>) noexcept`;
     /// 2. force synchronous cleanup of remaining handles on destruction.
     using DeleterType = AsyncDeleter;
+
+    /// `kReclamationMode` selects how readers are tracked, see
+    /// rcu::ReclamationMode.
+    static constexpr ReclamationMode kReclamationMode = ReclamationMode::kPerValue;
 };
 
 /// @brief Deletes garbage synchronously.
@@ -186,6 +231,17 @@ struct SyncRcuTraits : public DefaultRcuTraits {
     using DeleterType = SyncDeleter;
 };
 
+/// @brief Deletes garbage synchronously in batches, tracking readers by
+/// epochs.
+/// Designed for small, frequently updated values with many concurrent readers
+/// and writers.
+/// @note Allows reads from any kind of thread.
+/// Only allows writes from coroutine threads.
+/// @see rcu::ReclamationMode::kEpoch
+struct EpochRcuTraits : public SyncRcuTraits {
+    static constexpr ReclamationMode kReclamationMode = ReclamationMode::kEpoch;
+};
+
 /// @brief Rcu traits for using outside of coroutines.
 /// @note Allows reads from any kind of thread.
 /// Only allows writes from NON-coroutine threads.
@@ -206,6 +262,39 @@ template <typename T, typename RcuTraits>
 class [[nodiscard]] ReadablePtr final {
 public:
     explicit ReadablePtr(const Variable<T, RcuTraits>& ptr) {
+        if constexpr (Variable<T, RcuTraits>::kEpochReclamation) {
+            LockEpoch(ptr);
+        } else {
+            LockRecord(ptr);
+        }
+    }
+
+    ReadablePtr(ReadablePtr&& other) noexcept = default;
+    ReadablePtr& operator=(ReadablePtr&& other) noexcept = default;
+    ReadablePtr(const ReadablePtr& other) = default;
+    ReadablePtr& operator=(const ReadablePtr& other) = default;
+    ~ReadablePtr() = default;
+
+    const T* Get() const& {
+        UASSERT(ptr_);
+        return ptr_;
+    }
+
+    const T* Get() && { return GetOnRvalue(); }
+
+    const T* operator->() const& { return Get(); }
+    const T* operator->() && { return GetOnRvalue(); }
+
+    const T& operator*() const& { return *Get(); }
+    const T& operator*() && { return *GetOnRvalue(); }
+
+private:
+    const T* GetOnRvalue() {
+        static_assert(!sizeof(T), "Don't use temporary ReadablePtr, store it to a variable");
+        std::abort();
+    }
+
+    void LockRecord(const Variable<T, RcuTraits>& ptr) {
         auto* record = ptr.current_.load();
 
         while (true) {
@@ -247,29 +336,27 @@ public:
         ptr_ = &*record->data;
     }
 
-    ReadablePtr(ReadablePtr&& other) noexcept = default;
-    ReadablePtr& operator=(ReadablePtr&& other) noexcept = default;
-    ReadablePtr(const ReadablePtr& other) = default;
-    ReadablePtr& operator=(const ReadablePtr& other) = default;
-    ~ReadablePtr() = default;
+    void LockEpoch(const Variable<T, RcuTraits>& ptr) {
+        auto& epochs = ptr.epochs_;
+        auto epoch = epochs.epoch.load();
 
-    const T* Get() const& {
-        UASSERT(ptr_);
-        return ptr_;
-    }
-
-    const T* Get() && { return GetOnRvalue(); }
+        while (true) {
+            lock_ = epochs.readers[epoch % impl::kEpochCount].Lock();
 
-    const T* operator->() const& { return Get(); }
-    const T* operator->() && { return GetOnRvalue(); }
+            // Pairs with AsymmetricThreadFenceHeavy in TryAdvanceEpoch, the same
+            // way as in LockRecord.
+            concurrent::impl::AsymmetricThreadFenceLight();
 
-    const T& operator*() const& { return *Get(); }
-    const T& operator*() && { return *GetOnRvalue(); }
+            // The epoch could have advanced before the lock became visible. Then
+            // the writer may have missed the lock, so register in the new epoch.
+            const auto new_epoch = epochs.epoch.load(std::memory_order_seq_cst);
+            if (new_epoch == epoch) break;
+            epoch = new_epoch;
+        }
 
-private:
-    const T* GetOnRvalue() {
-        static_assert(!sizeof(T), "Don't use temporary ReadablePtr, store it to a variable");
-        std::abort();
+        // Values that are current after the registration are not freed until
+        // the registration is dropped.
+        ptr_ = &*ptr.current_.load(std::memory_order_seq_cst)->data;
     }
 
     const T* ptr_;
@@ -357,7 +444,8 @@ private:
 /// changes to it, and commits the result to update current variable value (does
 /// Read-Copy-Update). Old version of the value is not freed on update, it will
 /// be eventually freed when a subsequent writer identifies that nobody works
-/// with this version.
+/// with this version. How the writers find that out is selected by
+/// rcu::ReclamationMode in `RcuTraits`, see rcu::EpochRcuTraits.
 ///
 /// @note There is no way to create a "null" `Variable`.
 ///
@@ -380,6 +468,8 @@ public:
     using MutexType = typename RcuTraits::MutexType;
     using DeleterType = typename RcuTraits::DeleterType;
 
+    static constexpr bool kEpochReclamation = RcuTraits::kReclamationMode == ReclamationMode::kEpoch;
+
     /// @brief Create a new `Variable` with an in-place constructed initial value.
     /// @param initial_value_args arguments passed to the constructor of the
     /// initial value
@@ -406,6 +496,16 @@ public:
                 delete &record;
             }
         );
+
+        if constexpr (kEpochReclamation) {
+            for (std::size_t i = 0; i < impl::kEpochCount; ++i) {
+                UASSERT_MSG(epochs_.readers[i].IsFree(), "RCU variable is destroyed while being used");
+                epochs_.retired[i].RemoveAndDisposeIf(
+                    [](impl::SnapshotRecord<T>&) { return true; },
+                    [](impl::SnapshotRecord<T>& record) { delete &record; }
+                );
+            }
+        }
     }
 
     /// Obtain a smart pointer which can be used to read the current value.
@@ -445,7 +545,15 @@ public:
             // in the process.
             return;
         }
-        ScanRetiredList(lock);
+
+        if constexpr (kEpochReclamation) {
+            // The snapshots retired in the current epoch are freed after two
+            // epoch advances.
+            TryAdvanceEpoch(lock);
+            TryAdvanceEpoch(lock);
+        } else {
+            ScanRetiredList(lock);
+        }
     }
 
 private:
@@ -460,8 +568,15 @@ private:
         current_.store(&new_snapshot, std::memory_order_seq_cst);
 
         UASSERT(old_snapshot);
-        retired_list_.Push(*old_snapshot);
-        ScanRetiredList(lock);
+        if constexpr (kEpochReclamation) {
+            epochs_.retired[epochs_.epoch.load() % impl::kEpochCount].Push(*old_snapshot);
+            if (++epochs_.retired_since_advance >= impl::kEpochRetireBatchSize) {
+                TryAdvanceEpoch(lock);
+            }
+        } else {
+            retired_list_.Push(*old_snapshot);
+            ScanRetiredList(lock);
+        }
     }
 
     template <typename... Args>
@@ -492,6 +607,34 @@ private:
         );
     }
 
+    // Snapshots retired in epoch E may only be held by readers registered in
+    // epochs E-1 and E, because readers of older epochs must have left before
+    // the epoch could advance to E. So once readers of E-1 have left, the epoch
+    // may advance to E+1, and the snapshots retired in E-1 are free.
+    void TryAdvanceEpoch(std::unique_lock<MutexType>& lock) noexcept {
+        UASSERT(lock.owns_lock());
+        epochs_.retired_since_advance = 0;
+        if (std::all_of(std::begin(epochs_.retired), std::end(epochs_.retired), [](const auto& list) {
+                return list.IsEmpty();
+            })) {
+            return;
+        }
+
+        const auto epoch = epochs_.epoch.load();
+        const auto previous = (epoch + impl::kEpochCount - 1) % impl::kEpochCount;
+
+        concurrent::impl::AsymmetricThreadFenceHeavy();
+        if (!epochs_.readers[previous].IsFree()) return;
+
+        // Nobody will retire into 'previous' until the next advance, and
+        // new readers won't register there, because it is not the current epoch.
+        epochs_.retired[previous].RemoveAndDisposeIf(
+            [](impl::SnapshotRecord<T>&) { return true; },
+            [&](impl::SnapshotRecord<T>& record) { DeleteSnapshot(record); }
+        );
+        epochs_.epoch.store(epoch + 1, std::memory_order_seq_cst);
+    }
+
     void DeleteSnapshot(impl::SnapshotRecord<T>& record) noexcept {
         static_assert(
             noexcept(deleter_.Delete(SnapshotHandle<T>{record, free_list_})), "DeleterType::Delete must be noexcept"
@@ -509,6 +652,9 @@ private:
     // Must be placed after 'free_list_' and 'deleter_' so that if
     // the initialization of current_ throws, it can be disposed properly.
     std::atomic<impl::SnapshotRecord<T>*> current_;
+    // Only used with ReclamationMode::kEpoch. Covered by 'mutex_', except for
+    // the reads of 'epoch' and the reader registrations.
+    std::conditional_t<kEpochReclamation, impl::EpochState<T>, impl::NoEpochState> epochs_;
 };
 
 }  // namespace rcu
@@ -6,6 +6,7 @@
 #include <memory>
 
 #include <userver/components/component_base.hpp>
+#include <userver/concurrent/async_event_source.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/server/server.hpp>
 #include <userver/utils/statistics/entry.hpp>
@@ -66,6 +67,7 @@ namespace components {
 /// tls.cert | path to TLS server certificate or certificate chain | -
 /// tls.private-key | path to TLS server certificate private key | -
 /// tls.private-key-passphrase-name | passphrase name located in secdist's "passphrases" section | -
+/// tls.kernel-offload | hand the encryption to the kernel TLS (kTLS) after the handshake, so that static files are sent with sendfile(2); requires OpenSSL with kTLS support and the `tls` kernel module | false
 /// handler-defaults.max_url_size | max path/URL size or empty to not limit | 8192
 /// handler-defaults.max_request_size | max size of the whole request | 1024 * 1024
 /// handler-defaults.max_headers_size | max request headers size | 65536
@@ -73,17 +75,35 @@ namespace components {
 /// handler-defaults.set_tracing_headers | whether to set http tracing headers (X-YaTraceId, X-YaSpanId, X-RequestId) | true
 /// handler-defaults.deadline_propagation_enabled | when `false`, disables HTTP handler deadline propagation | true
 /// handler-defaults.deadline_expired_status_code | the HTTP status code to return if the request deadline expires | 498
+/// accept-shedding.mode | what to do with new connections while the listener task processor is overloaded: 'none', 'pause' to stop accepting and shrink the listen backlog to accept-shedding.overload-backlog, 'reset' to accept and reset them, 'defer-tls' to postpone TLS handshakes for up to accept-shedding.max-tls-defer | none
+/// accept-shedding.overload-percent | percent of tasks that waited in queue longer than `sensor_wait_queue_time_limit` of the task processor, to consider it overloaded | 5
+/// accept-shedding.check-interval | how often the overload state is refreshed | 100ms
+/// accept-shedding.overload-backlog | listen backlog to use while accepting is paused | 16
+/// accept-shedding.max-tls-defer | max time to postpone a TLS handshake for | 1s
 /// connection.in_buffer_size | size of the buffer to preallocate for request receive: bigger values use more RAM and less CPU | 32 * 1024
 /// connection.requests_queue_size_threshold | drop requests from handlers that allow throttling if there's more pending requests than allowed by this value | 100
+/// connection.max_pipelined_requests_in_flight | max number of pipelined requests of a connection that are handled concurrently; the connection stops reading new requests until the responses are sent, responses that are ready in order are sent with a single write | 1
 /// connection.keepalive_timeout | timeout in seconds to drop connection if there's not data received from it | 600
 /// connection.stream_close_check_delay | delay in microseconds of the start of stream close check routine; do not set if not sure what it is doing | 20ms
 /// connection.http-version | the HTTP protocol version | '1.1'
 /// connection.http2-session.max_concurrent_streams | max number of concurrent open streams | 100
 /// connection.http2-session.max_frame_size | max size of the HTTP/2.0 frame | 16384
 /// connection.http2-session.initial_window_size | the initial window size of the server | 65536
+/// connection.http2-session.connection_window_size | the flow-control window of the whole connection; raise it together with initial_window_size for large responses over high latency links | 65535
+/// connection.http2-session.rfc9218_priorities | prioritize streams by the RFC 9218 'priority' header and PRIORITY_UPDATE frames instead of the deprecated RFC 7540 priorities; requires nghttp2 1.49+ | false
 /// shards | how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing | -
+/// thread-per-core | run each shard with its connections and requests on a dedicated single-threaded task processor bound to its own ev thread; handlers that use the listener `task_processor` never migrate between threads | false
 /// middleware-pipeline-builder | name of a component to build a server-wide middleware pipeline | default-server-middleware-pipeline-builder
 ///
+/// ## TLS session resumption
+///
+/// TLS sessions are resumed with the session tickets. The tickets are encrypted
+/// with a random key generated at startup, unless there is a secdist
+/// "tls_session_ticket_keys" entry with a list of base64 encoded 80 byte keys.
+/// The first key encrypts the new tickets, the other ones are accepted until
+/// they are removed from the list, so that the keys could be rotated by
+/// the secdist updates across all the instances of the service.
+///
 /// @see @ref scripts/docs/en/userver/http_server.md
 
 // clang-format on
@@ -113,9 +133,12 @@ public:
 private:
     void WriteStatistics(utils::statistics::Writer& writer);
 
+    void OnSecdistUpdate(const storages::secdist::SecdistConfig& secdist);
+
     std::unique_ptr<server::Server> server_;
     utils::statistics::Entry server_statistics_holder_;
     utils::statistics::Entry handler_statistics_holder_;
+    concurrent::AsyncEventSubscriberScope secdist_subscription_;
 };
 
 template <>
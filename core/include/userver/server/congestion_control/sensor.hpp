@@ -36,6 +36,27 @@ private:
     std::uint64_t last_requests_{0};
 };
 
+/// @brief Sensor of the task processor queue wait time for the
+/// congestion_control::v2::CodelController.
+///
+/// Reports the requests rate as the current load and the minimal queue wait
+/// time of the sampled tasks since the previous fetch.
+class QueueWaitSensor final : public USERVER_NAMESPACE::congestion_control::v2::Sensor {
+public:
+    explicit QueueWaitSensor(engine::TaskProcessor& tp);
+
+    Data GetCurrent() override;
+
+    void RegisterRequestsSource(RequestsSource& source);
+
+private:
+    engine::TaskProcessor& tp_;
+    rcu::Variable<std::vector<RequestsSource*>> requests_sources_;
+
+    std::chrono::steady_clock::time_point last_fetch_tp_;
+    std::uint64_t last_requests_{0};
+};
+
 }  // namespace server::congestion_control
 
 USERVER_NAMESPACE_END
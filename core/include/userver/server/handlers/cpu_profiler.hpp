@@ -0,0 +1,73 @@
+#pragma once
+
+/// @file userver/server/handlers/cpu_profiler.hpp
+/// @brief @copybrief server::handlers::CpuProfiler
+
+#include <cstddef>
+
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/utils/periodic_task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that controls the in-process sampling CPU profiler.
+///
+/// While enabled, the threads that consume CPU are interrupted by SIGPROF
+/// `sampling-frequency` times per second of CPU time. Each sample records the
+/// stack of the thread, the name of the task processor and the name of the
+/// current tracing::Span. The samples are aggregated in memory into folded
+/// stacks, ready for the flamegraph tools.
+///
+/// The profiler is process-wide. The component is not a part of the
+/// components::CommonServerComponentList() and should be added explicitly.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// sampling-frequency | samples per second of CPU time consumed by the process | 100
+/// max-samples | samples buffered between the aggregations done once a second, the rest are dropped | 5000
+///
+/// ## Static configuration example:
+///
+/// @snippet components/common_server_component_list_test.cpp  Sample handler cpu profiler component config
+///
+/// ## Schema
+/// Set an URL path argument `command` to one of the following values:
+/// * `start` - to reset the collected profile and start profiling
+/// * `stop` - to stop profiling, the collected profile is kept
+/// * `dump` - to get the profile collected since the `start` in the folded
+///   stacks format: `task_processor;span;root_function;...;leaf_function count`
+
+// clang-format on
+
+class CpuProfiler final : public HttpHandlerBase {
+public:
+    CpuProfiler(const components::ComponentConfig&, const components::ComponentContext&);
+    ~CpuProfiler() override;
+
+    /// @ingroup userver_component_names
+    /// @brief The default name of server::handlers::CpuProfiler
+    static constexpr std::string_view kName = "handler-cpu-profiler";
+
+    std::string HandleRequestThrow(const http::HttpRequest&, request::RequestContext&) const override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    const std::size_t sampling_frequency_;
+    const std::size_t max_samples_;
+    utils::PeriodicTask collect_task_;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::CpuProfiler> = true;
+
+USERVER_NAMESPACE_END
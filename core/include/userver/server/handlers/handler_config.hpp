@@ -38,9 +38,11 @@ struct HandlerConfig {
     UrlTrailingSlashOption url_trailing_slash{UrlTrailingSlashOption::kDefault};
     std::optional<size_t> max_requests_in_flight;
     std::optional<size_t> max_requests_per_second;
+    std::optional<size_t> max_rate_limited_clients;
     bool decompress_request{true};
     bool throttling_enabled{true};
     bool response_body_stream{false};
+    bool request_body_stream{false};
     std::optional<bool> set_response_server_hostname;
     bool set_tracing_headers{true};
     bool deadline_propagation_enabled{true};
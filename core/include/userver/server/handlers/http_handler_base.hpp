@@ -26,6 +26,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::middlewares {
 class HttpMiddlewareBase;
+class FlatPipeline;
 class HandlerAdapter;
 class Auth;
 }  // namespace server::middlewares
@@ -213,7 +214,7 @@ private:
     bool set_response_server_hostname_;
     bool is_body_streamed_;
 
-    std::unique_ptr<middlewares::HttpMiddlewareBase> first_middleware_;
+    std::unique_ptr<middlewares::FlatPipeline> middlewares_pipeline_;
 };
 
 }  // namespace server::handlers
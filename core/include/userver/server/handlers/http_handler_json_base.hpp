@@ -3,6 +3,7 @@
 /// @file userver/server/handlers/http_handler_json_base.hpp
 /// @brief @copybrief server::handlers::HttpHandlerJsonBase
 
+#include <userver/formats/json/lazy_value.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -16,6 +17,19 @@ namespace server::handlers {
 /// @brief Convenient base for handlers that accept requests with body in
 /// JSON format and respond with body in JSON format.
 ///
+/// ## Static options:
+/// Inherits all the options from server::handlers::HttpHandlerBase and adds the
+/// following ones:
+///
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// lazy-request-json | index the body with formats::json::FromStringLazy() and pass it to HandleRequestLazyJsonThrow() instead of parsing it fully | false
+///
+/// With `lazy-request-json` only the structure of the body is checked before
+/// the handler is called and only the accessed values are parsed, that is much
+/// cheaper for the handlers that read a few members of a big body. Malformed
+/// values that are accessed by the handler are reported as the invalid body.
+///
 /// ## Example usage:
 ///
 /// @snippet samples/config_service/config_service.cpp Config service sample - component
@@ -38,6 +52,18 @@ public:
         request::RequestContext& context
     ) const = 0;
 
+    /// @brief Called instead of HandleRequestJsonThrow() if the
+    /// `lazy-request-json` static option is enabled.
+    ///
+    /// The default implementation parses the whole body and calls
+    /// HandleRequestJsonThrow(). To implement both of them once write the
+    /// handling as a function template over the JSON value type.
+    virtual formats::json::Value HandleRequestLazyJsonThrow(
+        const http::HttpRequest& request,
+        const formats::json::LazyValue& request_json,
+        request::RequestContext& context
+    ) const;
+
     static yaml_config::Schema GetStaticConfigSchema();
 
 protected:
@@ -45,6 +71,10 @@ protected:
     /// nullptr otherwise.
     static const formats::json::Value* GetRequestJson(const request::RequestContext& context);
 
+    /// @returns A pointer to lazy json request if `lazy-request-json` is
+    /// enabled and the request was indexed successfully or nullptr otherwise.
+    static const formats::json::LazyValue* GetRequestLazyJson(const request::RequestContext& context);
+
     /// @returns a pointer to json response if it was returned successfully by
     /// `HandleRequestJsonThrow()` or nullptr otherwise.
     static const formats::json::Value* GetResponseJson(const request::RequestContext& context);
@@ -53,6 +83,8 @@ protected:
 
 private:
     FormattedErrorData GetFormattedExternalErrorBody(const CustomHandlerException& exc) const final;
+
+    const bool lazy_request_json_;
 };
 
 }  // namespace server::handlers
@@ -19,6 +19,15 @@ namespace server::handlers {
 /// @brief Handler that returns HTTP 200 if file exist
 /// and returns file data with mapped content/type
 ///
+/// Files that exceed the `max-in-memory-file-size` option of the
+/// components::FsCache are not kept in memory and are sent with
+/// engine::io::Socket::SendFile.
+///
+/// If the `precompress` option of the components::FsCache is set, the client
+/// gets the precompressed variant of the file for the content coding it
+/// prefers in `Accept-Encoding`. Such responses are not compressed again by
+/// server::middlewares::ResponseCompression.
+///
 /// ## HttpHandlerStatic Dynamic config
 /// * @ref USERVER_FILES_CONTENT_TYPE_MAP
 ///
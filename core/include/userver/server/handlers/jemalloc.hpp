@@ -31,6 +31,10 @@ namespace server::handlers {
 /// * `bg_threads_set_max` - to set maximum number of background threads
 /// * `bg_threads_enable` - to start background threads
 /// * `bg_threads_disable` - to *synchronously* stop background threads
+/// * `arenas` - to get memory stats of the default arena and of the arenas of
+///   the task processors with `jemalloc-arena: true`
+/// * `span_heap` - to get live sampled allocations since `enable` grouped by
+///   the tracing::Span names, requires jemalloc 5.3+
 
 // clang-format on
 
@@ -44,6 +48,8 @@ public:
         kBgThreadsSetMax,
         kBgThreadsEnable,
         kBgThreadsDisable,
+        kArenas,
+        kSpanHeap,
     };
     static std::optional<Command> GetCommandFromString(std::string_view str);
     static std::string ListCommands();
@@ -28,6 +28,8 @@ class HttpHandlerBase;
 /// Server parts of the HTTP protocol implementation.
 namespace server::http {
 
+class RequestBodyStream;
+
 /// @brief HTTP Request data.
 /// @note do not create HttpRequest by hand in tests,
 ///       use HttpRequestBuilder instead.
@@ -210,6 +212,19 @@ public:
     /// @return moved out HTTP body. `this` is modified.
     std::string ExtractRequestBody();
 
+    /// @brief Returns the HTTP body as a stream of chunks.
+    ///
+    /// For handlers with `request-body-stream: true` in the static config the
+    /// body of an HTTP/1.1 request is not buffered: RequestBody() is empty and
+    /// the chunks arrive while the handler runs. Otherwise the stream yields the
+    /// moved out RequestBody() as a single chunk.
+    RequestBodyStream& GetRequestBodyStream();
+
+    /// @return true if the body arrives via GetRequestBodyStream() while the
+    /// handler runs. Such a body is neither decompressed, nor parsed for the
+    /// arguments or multipart/form-data.
+    bool IsRequestBodyStreamed() const;
+
     /// @cond
     void SetRequestBody(std::string body);
     void ParseArgsFromBody();
@@ -288,7 +303,7 @@ private:
     friend class HttpRequestHandler;
 
     struct Impl;
-    utils::FastPimpl<Impl, 1648, 16> pimpl_;
+    utils::FastPimpl<Impl, 1696, 16> pimpl_;
 };
 
 }  // namespace server::http
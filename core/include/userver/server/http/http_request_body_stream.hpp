@@ -0,0 +1,59 @@
+#pragma once
+
+/// @file userver/server/http/http_request_body_stream.hpp
+/// @brief @copybrief server::http::RequestBodyStream
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief Chunks of the HTTP request body, see
+/// server::http::HttpRequest::GetRequestBodyStream().
+///
+/// For handlers with `request-body-stream: true` in the static config the body
+/// of an HTTP/1.1 request is yielded as it arrives from the client. The
+/// connection stops reading from the socket while the handler lags behind, so
+/// the memory consumed by an upload does not depend on its size.
+///
+/// Not thread safe.
+class RequestBodyStream final {
+public:
+    RequestBodyStream(RequestBodyStream&&) noexcept;
+    ~RequestBodyStream();
+
+    /// @brief Waits for the next chunk of the body.
+    /// @returns `false` if the whole body has been read
+    /// @throws handlers::RequestParseError if the client has not sent the
+    /// whole body
+    /// @throws engine::WaitInterruptedException if the task was cancelled
+    bool ReadChunk(std::string& chunk);
+
+    /// @returns the count of the body bytes read so far
+    std::size_t GetReadSize() const noexcept;
+
+    /// @cond
+    using Queue = concurrent::StringStreamQueue;
+
+    // The chunks arrive via the queue, an empty chunk marks the end of the body
+    explicit RequestBodyStream(Queue::Consumer&& consumer);
+
+    // The body was received whole
+    explicit RequestBodyStream(std::string&& body);
+    /// @endcond
+
+private:
+    std::optional<Queue::Consumer> consumer_;
+    std::string body_;
+    std::size_t read_size_{0};
+    bool is_finished_{false};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <memory>
 
 #include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -57,6 +58,9 @@ public:
 
     HttpRequestBuilder& SetHttpHandlerStatistics(handlers::HttpRequestStatistics& stats);
 
+    // HTTP/1.1 only, the body chunks arrive while the handler runs
+    HttpRequestBuilder& SetRequestBodyStream(RequestBodyStream::Queue::Consumer&& consumer);
+
     // TODO: remove?
     HttpRequestBuilder& SetStreamProducer(impl::Http2StreamEventProducer&& producer);
 
@@ -4,6 +4,7 @@
 /// @brief @copybrief server::http::HttpResponse
 
 #include <chrono>
+#include <memory>
 #include <string>
 #include <variant>
 
@@ -20,6 +21,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace fs::blocking {
+class FileDescriptor;
+}  // namespace fs::blocking
+
 namespace server::http {
 
 // RFC 9110 states that in case of missing Content-Type it may be assumed to be
@@ -34,6 +39,8 @@ class Http2ResponseWriter;
 
 namespace impl {
 
+class BodyStreamCompressor;
+
 void OutputHeader(USERVER_NAMESPACE::http::headers::HeadersString& header, std::string_view key, std::string_view val);
 
 }  // namespace impl
@@ -139,13 +146,29 @@ public:
     using Queue = concurrent::StringStreamQueue;
     using Producer = std::variant<std::monostate, Queue::Producer, impl::Http2StreamEventProducer>;
 
+    /// @brief Sets the response body to the first `size` bytes of `file`,
+    /// overrides the data set by SetData().
+    ///
+    /// Over plain HTTP/1 connections the contents go from the page cache
+    /// directly to the socket (see engine::io::Socket::SendFile) and never get
+    /// copied into the process memory. TLS and HTTP/2 connections read the file
+    /// while sending the response.
+    void SetFileBody(std::shared_ptr<const fs::blocking::FileDescriptor> file, std::size_t size);
+
     void SetStreamBody();
     bool IsBodyStreamed() const override;
     // Can be called only once
     Producer GetBodyProducer();
 
+    /// @cond
+    // Compresses the chunks pushed via ResponseBodyStream, must be set before
+    // the stream is created
+    void SetBodyStreamCompressor(std::unique_ptr<impl::BodyStreamCompressor> compressor);
+    /// @endcond
+
 private:
     friend class Http2ResponseWriter;
+    friend class ResponseBodyStream;
 
     // Returns total size of the response
     std::size_t SetBodyStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
@@ -153,6 +176,12 @@ private:
     // Returns total size of the response
     std::size_t SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
 
+    // Returns the number of bytes sent
+    std::size_t SendFileBody(engine::io::RwBase& socket);
+
+    // Reads the whole file body into memory
+    std::string ReadFileBody() const;
+
     const HttpRequest& request_;
     HttpStatus status_ = HttpStatus::kOk;
     HeadersMap headers_;
@@ -162,6 +191,9 @@ private:
     std::optional<Queue::Consumer> body_stream_;
     Producer body_stream_producer_;
     bool is_stream_body_{false};
+    std::unique_ptr<impl::BodyStreamCompressor> body_stream_compressor_;
+    std::shared_ptr<const fs::blocking::FileDescriptor> file_body_;
+    std::size_t file_body_size_{0};
 };
 
 void SetThrottleReason(http::HttpResponse& http_response, std::string log_reason, std::string http_header_reason);
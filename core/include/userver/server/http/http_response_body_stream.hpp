@@ -15,7 +15,7 @@ namespace server::http {
 
 class ResponseBodyStream final {
 public:
-    ResponseBodyStream(ResponseBodyStream&&) = default;
+    ResponseBodyStream(ResponseBodyStream&&) noexcept;
     ~ResponseBodyStream();
 
     // Send a chunk of response data. It may NOT generate
@@ -37,9 +37,13 @@ private:
 
     ResponseBodyStream(HttpResponse::Producer&& queue_producer, HttpResponse& http_response);
 
+    // Pushes the chunk as is, without compression
+    bool DoPushBodyChunk(std::string&& chunk, engine::Deadline deadline);
+
     bool headers_ended_{false};
     HttpResponse::Producer queue_producer_;
     HttpResponse& http_response_;
+    std::unique_ptr<impl::BodyStreamCompressor> compressor_;
 };
 
 }  // namespace server::http
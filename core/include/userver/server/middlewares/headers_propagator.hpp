@@ -1,5 +1,6 @@
 #pragma once
 
+#include <userver/http/predefined_header.hpp>
 #include <userver/server/middlewares/http_middleware_base.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -14,6 +15,8 @@ private:
     void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
 
     std::vector<std::string> headers_;
+    // Point to headers_, with the hashes computed once
+    std::vector<USERVER_NAMESPACE::http::headers::PredefinedHeader> prehashed_headers_;
 };
 
 class HeadersPropagatorFactory final : public HttpMiddlewareFactoryBase {
@@ -7,6 +7,7 @@
 
 #include <userver/components/component_base.hpp>
 #include <userver/server/http/http_request.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/yaml_config/schema.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
@@ -25,6 +26,8 @@ class HttpHandlerBase;
 /// HTTP server middlewares
 namespace middlewares {
 
+class FlatPipeline;
+
 /// @ingroup userver_middlewares userver_base_classes
 ///
 /// @brief Base class for a http middleware
@@ -38,12 +41,21 @@ protected:
     virtual void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const = 0;
 
     /// @brief The method to invoke the next middleware in a pipeline
-    void Next(http::HttpRequest& request, request::RequestContext& context) const;
+    void Next(http::HttpRequest& request, request::RequestContext& context) const {
+        UASSERT(next_);
+        next_->HandleRequest(request, context);
+    }
+
+    /// @brief Override this method to return `true` if, with the settings of the
+    /// handler, the middleware does nothing but calls Next(). Such middlewares
+    /// are excluded from the pipeline when it is built.
+    virtual bool IsNoop() const { return false; }
 
 private:
-    friend class handlers::HttpHandlerBase;
+    friend class FlatPipeline;
 
-    std::unique_ptr<HttpMiddlewareBase> next_{nullptr};
+    // Owned by the pipeline of the handler
+    const HttpMiddlewareBase* next_{nullptr};
 };
 
 /// @ingroup userver_middlewares userver_base_classes
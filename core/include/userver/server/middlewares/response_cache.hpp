@@ -0,0 +1,128 @@
+#pragma once
+
+/// @file userver/server/middlewares/response_cache.hpp
+/// @brief @copybrief server::middlewares::ResponseCacheFactory
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+class ResponseCacheStorage;
+
+/// Settings of the response cache for a single handler
+struct ResponseCacheSettings final {
+    /// For how long the response is served from the cache, 0 disables caching
+    std::chrono::milliseconds ttl{0};
+    /// Request headers that the response depends on, they become a part of the
+    /// key along with the method, the path and the query
+    std::vector<std::string> vary_headers;
+};
+
+ResponseCacheSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ResponseCacheSettings>);
+
+class ResponseCache final : public HttpMiddlewareBase {
+public:
+    ResponseCache(const handlers::HttpHandlerBase&, ResponseCacheStorage& storage, ResponseCacheSettings settings);
+
+private:
+    void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
+
+    bool IsNoop() const override;
+
+    std::string MakeKey(const http::HttpRequest& request) const;
+
+    ResponseCacheStorage& storage_;
+    const ResponseCacheSettings settings_;
+};
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Factory for the middleware that serves the repeated `GET` and `HEAD`
+/// requests from a cache of the handler responses.
+///
+/// The key of an entry consists of the method, the path and the query of the
+/// request, the `Accept-Encoding` header and the headers from the
+/// `vary-headers` option of the handler. An entry keeps the status, the headers
+/// and the body of a response with the 200 status code, so if the middleware
+/// is placed before server::middlewares::ResponseCompressionFactory in the
+/// pipeline, the already compressed bodies are cached.
+///
+/// Every cached response gets an `ETag` header, unless the handler has set one.
+/// Requests with a matching `If-None-Match` header are answered with
+/// `304 Not Modified` and an empty body.
+///
+/// Stream'ed responses, responses with cookies, with the `no-store` or
+/// `private` directives in `Cache-Control`, and the bodies greater than
+/// `max-body-size` are not cached. The memory consumed by the entries of all
+/// the handlers is bounded by `max-bytes`, the least recently used entries are
+/// evicted first.
+///
+/// The middleware is not a part of the default pipeline, append it via the
+/// `append` option of server::middlewares::PipelineBuilder and enable it for a
+/// handler by setting the `ttl`:
+///
+/// @code{.yaml}
+/// handler-menu:
+///     path: /v1/menu
+///     method: GET
+///     task_processor: main-task-processor
+///     middlewares:
+///         response-cache:
+///             ttl: 10s
+///             vary-headers:
+///               - Accept-Language
+/// @endcode
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// max-bytes | memory budget of the cached responses of all the handlers, in bytes | 67108864
+/// ways | number of the independently locked shards of the cache | 16
+/// max-body-size | maximal size of the body to cache, in bytes | 1048576
+///
+/// ## Handler options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// ttl | for how long the response is served from the cache, the middleware is a no-op for the handler if not set | 0
+/// vary-headers | request headers that the response depends on | []
+
+// clang-format on
+class ResponseCacheFactory final : public HttpMiddlewareFactoryBase {
+public:
+    static constexpr std::string_view kName = "response-cache";
+
+    ResponseCacheFactory(const components::ComponentConfig&, const components::ComponentContext&);
+    ~ResponseCacheFactory() override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    yaml_config::Schema GetMiddlewareConfigSchema() const override;
+
+    std::unique_ptr<HttpMiddlewareBase>
+    Create(const handlers::HttpHandlerBase&, yaml_config::YamlConfig middleware_config) const override;
+
+    const std::unique_ptr<ResponseCacheStorage> storage_;
+};
+
+}  // namespace server::middlewares
+
+template <>
+inline constexpr bool components::kHasValidate<server::middlewares::ResponseCacheFactory> = true;
+
+template <>
+inline constexpr auto components::kConfigFileMode<server::middlewares::ResponseCacheFactory> =
+    ConfigFileMode::kNotRequired;
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,106 @@
+#pragma once
+
+/// @file userver/server/middlewares/response_compression.hpp
+/// @brief @copybrief server::middlewares::ResponseCompressionFactory
+
+#include <cstddef>
+#include <vector>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+/// Content codings of the responses
+enum class ResponseEncoding {
+    kGzip,
+    kZstd,
+};
+
+ResponseEncoding Parse(const yaml_config::YamlConfig& value, formats::parse::To<ResponseEncoding>);
+
+struct ResponseCompressionSettings final {
+    /// Codings in the order of preference, used if the client accepts several
+    /// codings with the same quality
+    std::vector<ResponseEncoding> encodings{ResponseEncoding::kZstd, ResponseEncoding::kGzip};
+    /// Smaller bodies are not worth compressing
+    std::size_t min_size{1024};
+    /// Greater bodies take too much CPU time to compress
+    std::size_t max_size{8 * 1024 * 1024};
+    int gzip_level{6};
+    int zstd_level{3};
+    bool compress_streams{true};
+};
+
+ResponseCompressionSettings
+Parse(const yaml_config::YamlConfig& value, formats::parse::To<ResponseCompressionSettings>);
+
+class ResponseCompression final : public HttpMiddlewareBase {
+public:
+    ResponseCompression(const handlers::HttpHandlerBase&, const ResponseCompressionSettings& settings);
+
+private:
+    void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
+
+    void CompressBody(http::HttpResponse& response, ResponseEncoding encoding) const;
+
+    const ResponseCompressionSettings& settings_;
+};
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Factory for the middleware that compresses the HTTP responses with a
+/// content coding from the `Accept-Encoding` request header.
+///
+/// The bodies of the regular responses are compressed after the handler,
+/// the bodies of the stream'ed responses are compressed chunk by chunk, every
+/// chunk is flushed to the client right away. The compression contexts are
+/// reused by each worker thread.
+///
+/// Responses that already have the `Content-Encoding` header, responses to
+/// `HEAD` requests and the bodies out of [min-size, max-size] are not
+/// compressed.
+///
+/// The middleware is not a part of the default pipeline, append it via the
+/// `append` option of server::middlewares::PipelineBuilder.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// encodings | content codings in the order of preference, `zstd` and `gzip` are supported | [zstd, gzip]
+/// min-size | minimal size of the body to compress, in bytes | 1024
+/// max-size | maximal size of the body to compress, in bytes; limits the CPU time spent on a single response | 8388608
+/// gzip-level | gzip compression level | 6
+/// zstd-level | zstd compression level | 3
+/// compress-streams | whether to compress the stream'ed responses | true
+
+// clang-format on
+class ResponseCompressionFactory final : public HttpMiddlewareFactoryBase {
+public:
+    static constexpr std::string_view kName = "response-compression";
+
+    ResponseCompressionFactory(const components::ComponentConfig&, const components::ComponentContext&);
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    std::unique_ptr<HttpMiddlewareBase>
+    Create(const handlers::HttpHandlerBase&, yaml_config::YamlConfig middleware_config) const override;
+
+    const ResponseCompressionSettings settings_;
+};
+
+}  // namespace server::middlewares
+
+template <>
+inline constexpr bool components::kHasValidate<server::middlewares::ResponseCompressionFactory> = true;
+
+template <>
+inline constexpr auto components::kConfigFileMode<server::middlewares::ResponseCompressionFactory> =
+    ConfigFileMode::kNotRequired;
+
+USERVER_NAMESPACE_END
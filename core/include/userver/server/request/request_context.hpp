@@ -8,6 +8,7 @@
 #include <type_traits>
 
 #include <userver/utils/any_movable.hpp>
+#include <userver/utils/arena.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -104,6 +105,15 @@ public:
     /// @brief Erase data with specified name.
     void EraseData(std::string_view name);
 
+    /// @brief Arena for request-scoped allocations, e.g. via
+    /// utils::ArenaAllocator. All of its memory is released at once together
+    /// with the RequestContext, after the request processing is finished.
+    ///
+    /// Data stored in the RequestContext may safely refer to the arena memory.
+    /// The arena itself moves with the RequestContext, so allocators referring
+    /// to it should not be used after the RequestContext move.
+    utils::Arena& GetArena();
+
     // TODO : TAXICOMMON-8252
     impl::InternalRequestContext& GetInternalContext();
 
@@ -119,7 +129,7 @@ private:
     void EraseAnyData(std::string_view name);
 
     class Impl;
-    static constexpr std::size_t kPimplSize = 112;
+    static constexpr std::size_t kPimplSize = 152;
     utils::FastPimpl<Impl, kPimplSize, alignof(void*)> impl_;
 };
 
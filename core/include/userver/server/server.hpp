@@ -57,6 +57,10 @@ public:
 
     void Stop();
 
+    /// Replaces the TLS session ticket keys of the listeners with the ones
+    /// from the secdist 'tls_session_ticket_keys' entry, if it is not empty
+    void UpdateTlsSessionTicketKeys(const storages::secdist::SecdistConfig& secdist);
+
     RequestsView& GetRequestsView();
 
     void SetLimit(std::optional<size_t> new_limit) override;
@@ -5,6 +5,8 @@
 
 #include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
 
 #include <userver/engine/io/socket.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -48,6 +50,7 @@ class WebSocketConnectionImpl;
 struct Config final {
     unsigned max_remote_payload = 65536;
     unsigned fragment_size = 65536;  // 0 - do not fragment
+    bool permessage_deflate = false;
 };
 
 Config Parse(const yaml_config::YamlConfig&, formats::parse::To<Config>);
@@ -59,6 +62,32 @@ struct Statistics final {
     std::atomic<int64_t> bytes_recv{0};
 };
 
+/// @brief Data message that is serialized into a WebSocket frame once and
+/// can be sent to any number of connections without copying.
+///
+/// Copying a PreparedMessage does not copy the frame, so it is cheap to
+/// capture it into the tasks that send it to the connections. The message is
+/// sent as a single frame regardless of the `fragment-size` option.
+class PreparedMessage final {
+public:
+    /// @param data message payload
+    /// @param is_text whether the message is sent as a text or a binary one
+    /// @param compress also prepare a frame compressed with the
+    /// permessage-deflate extension, it is sent to the connections that have
+    /// negotiated the extension
+    PreparedMessage(std::string_view data, bool is_text, bool compress = false);
+
+    /// @returns size of the message payload
+    std::size_t GetSize() const noexcept { return size_; }
+
+private:
+    friend class WebSocketConnectionImpl;
+
+    std::shared_ptr<const std::string> frame_;
+    std::shared_ptr<const std::string> compressed_frame_;
+    std::size_t size_{0};
+};
+
 /// @brief Main class for Websocket connection
 class WebSocketConnection {
 public:
@@ -97,6 +126,12 @@ public:
     virtual void Send(const Message& message) = 0;
     virtual void SendText(std::string_view message) = 0;
 
+    /// @brief Send a message that is serialized once for many connections,
+    /// e.g. to broadcast it.
+    /// @throws engine::io::IoException in case of socket errors
+    /// @note Has the same thread-safety guarantees as Send().
+    virtual void SendPrepared(const PreparedMessage& message) = 0;
+
     template <typename ContiguousContainer>
     void SendBinary(const ContiguousContainer& message) {
         static_assert(
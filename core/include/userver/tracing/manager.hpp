@@ -3,8 +3,11 @@
 /// @file userver/tracing/manager.hpp
 /// @brief @copybrief tracing::TracingManagerBase
 
+#include <memory>
+
 #include <userver/clients/http/plugin.hpp>
 #include <userver/clients/http/response.hpp>
+#include <userver/tracing/sampler.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/span_builder.hpp>
 #include <userver/utils/flags.hpp>
@@ -40,6 +43,10 @@ public:
 
     /// Fill response with tracing information
     virtual void FillResponseWithTracingContext(const Span& span, server::http::HttpResponse& response) const = 0;
+
+    /// Sampler for the spans of the incoming requests, all the spans are
+    /// logged if it returns nullptr
+    virtual const Sampler* GetSampler() const { return nullptr; }
 };
 
 // clang-format off
@@ -90,6 +97,13 @@ public:
     GenericTracingManager(utils::Flags<Format> in_request_response, utils::Flags<Format> new_request)
         : in_request_response_{in_request_response}, new_request_{new_request} {}
 
+    GenericTracingManager(
+        utils::Flags<Format> in_request_response,
+        utils::Flags<Format> new_request,
+        std::shared_ptr<const Sampler> sampler
+    )
+        : in_request_response_{in_request_response}, new_request_{new_request}, sampler_{std::move(sampler)} {}
+
     bool TryFillSpanBuilderFromRequest(const server::http::HttpRequest& request, SpanBuilder& span_builder)
         const override;
 
@@ -97,9 +111,12 @@ public:
 
     void FillResponseWithTracingContext(const Span& span, server::http::HttpResponse& response) const override;
 
+    const Sampler* GetSampler() const override { return sampler_.get(); }
+
 private:
     const utils::Flags<Format> in_request_response_;
     const utils::Flags<Format> new_request_;
+    const std::shared_ptr<const Sampler> sampler_;
 };
 
 }  // namespace tracing
@@ -47,6 +47,16 @@ public:
 /// component-name | name of the component, that implements TracingManagerComponentBase | <use tracing::GenericTracingManager with below settings>
 /// incoming-format | Array of incoming tracing formats supported by tracing::FormatFromString | ['opentelemetry', 'taxi']
 /// new-requests-format | Send tracing data in those formats supported by tracing::FormatFromString | ['opentelemetry', 'taxi']
+/// sampling | sampling of the spans of the incoming requests, see below; used only with tracing::GenericTracingManager | <all the spans are logged>
+/// sampling.sampled-traces-percent | percent of the traces that have all the spans logged, selected by trace id the same way as in @ref USERVER_LOG_SAMPLING | 100
+/// sampling.per-endpoint-rps | additionally log all the spans of up to this many requests per second of each handler, 0 to disable | 0
+/// sampling.tail.enabled | keep the spans of the rest of the requests in memory and log them only if the request failed or was slow, otherwise the spans are dropped | false
+/// sampling.tail.latency-threshold | requests that take at least this long are logged | 1s
+/// sampling.tail.max-spans | max number of spans kept for a single request | 256
+///
+/// Sampling applies only to spans, log records written within the dropped spans
+/// are still written. Custom samplers could be provided by overriding
+/// tracing::TracingManagerBase::GetSampler().
 ///
 // clang-format on
 class DefaultTracingManagerLocator final : public components::ComponentBase {
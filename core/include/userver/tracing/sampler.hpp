@@ -0,0 +1,67 @@
+#pragma once
+
+/// @file userver/tracing/sampler.hpp
+/// @brief @copybrief tracing::Sampler
+
+#include <chrono>
+#include <cstddef>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+class Span;
+
+/// @brief What to do with the spans of a request
+enum class SamplingDecision {
+    /// All the spans of the request are logged
+    kRecord,
+
+    /// None of the spans of the request are logged, tags and log records of
+    /// such spans cost almost nothing
+    kDrop,
+
+    /// The spans are kept in memory until the request span finishes and are
+    /// logged only if the request was slow or failed, see
+    /// tracing::TailSamplingSettings
+    kDefer,
+};
+
+/// @brief Settings for the requests with tracing::SamplingDecision::kDefer
+struct TailSamplingSettings final {
+    /// The spans of the requests that take at least this long are logged
+    std::chrono::milliseconds latency_threshold{1000};
+
+    /// Limits the memory of the deferred spans, the spans of a request over the
+    /// limit are never logged
+    std::size_t max_spans{256};
+};
+
+/// @ingroup userver_base_classes
+///
+/// @brief Base class for deciding which incoming requests have their spans
+/// logged.
+///
+/// The sampler is provided by tracing::TracingManagerBase::GetSampler() and is
+/// called for each incoming request right after its span is created. The
+/// decision is inherited by all the child spans of the request span. The
+/// deferred requests are logged if any of their spans has the
+/// tracing::kErrorFlag tag or if they took longer than
+/// tracing::TailSamplingSettings::latency_threshold.
+///
+/// @see tracing::DefaultTracingManagerLocator for the built-in sampler.
+class Sampler {
+public:
+    virtual ~Sampler();
+
+    /// @return what to do with the spans of the request started by `span`,
+    /// may be called concurrently
+    virtual SamplingDecision Sample(const Span& span) const = 0;
+
+    /// @return settings for the requests with tracing::SamplingDecision::kDefer
+    virtual TailSamplingSettings GetTailSamplingSettings() const;
+};
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -18,6 +18,8 @@ USERVER_NAMESPACE_BEGIN
 namespace tracing {
 
 class SpanBuilder;
+enum class SamplingDecision;
+struct TailSamplingSettings;
 
 /// @brief Measures the execution time of the current code block, links it with
 /// the parent tracing::Spans and stores that info in the log.
@@ -213,6 +215,9 @@ public:
     const std::string& GetSpanId() const;
     const std::string& GetParentId() const;
 
+    /// @returns the name the span was created with
+    const std::string& GetName() const;
+
     /// @returns true if this span would be logged with the current local and
     /// global log levels to the default logger.
     bool ShouldLogDefault() const noexcept;
@@ -236,6 +241,10 @@ public:
 
     // For internal use only.
     void LogTo(logging::impl::TagWriter writer) const&;
+
+    // For internal use only. Applies to the span and to its children created
+    // after the call.
+    void SetSampling(SamplingDecision decision, const TailSamplingSettings& tail_settings, utils::impl::InternalTag);
     /// @endcond
 
 private:
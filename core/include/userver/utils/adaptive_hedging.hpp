@@ -0,0 +1,218 @@
+#pragma once
+
+/// @file userver/utils/adaptive_hedging.hpp
+/// @brief @copybrief utils::hedging::AdaptiveHedging
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/hedged_request.hpp>
+#include <userver/utils/retry_budget.hpp>
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+class Writer;
+}  // namespace utils::statistics
+
+namespace utils::hedging {
+
+struct AdaptiveHedgingSettings final {
+    /// The hedge is sent if the first attempt takes longer than this
+    /// percentile of the recent latencies of the destination
+    double percentile{95};
+    /// Delay used while the destination has too few latency samples
+    std::chrono::milliseconds default_delay{HedgingSettings{}.hedging_delay};
+    std::chrono::milliseconds min_delay{1};
+    std::chrono::milliseconds max_delay{1000};
+    /// Minimal number of the recent latency samples to trust the percentile
+    std::size_t min_samples{100};
+    /// Each reply adds `token_ratio` tokens, each hedge takes one token, hedges
+    /// are sent while more than a half of `max_tokens` are left. The default
+    /// limits the hedges to ~10% of the requests.
+    RetryBudgetSettings budget{};
+};
+
+AdaptiveHedgingSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<AdaptiveHedgingSettings>);
+
+/// @brief Hedging delay and hedges budget of a single destination.
+///
+/// The delay follows the configured percentile of the latencies for the last
+/// minute, the hedges are limited with utils::RetryBudget, so a degraded
+/// destination does not receive a multiple of its usual load.
+///
+/// Thread-safe.
+class AdaptiveHedging final {
+public:
+    explicit AdaptiveHedging(const AdaptiveHedgingSettings& settings = {});
+
+    /// Call after a successful attempt with its latency
+    void AccountReply(std::chrono::milliseconds latency) noexcept;
+
+    /// @brief Call before sending a hedge (but not before the initial request).
+    /// @returns whether the budget allows the hedge, the budget is spent on
+    /// success
+    bool TryStartHedge() noexcept;
+
+    /// @returns the current hedging delay of the destination
+    std::chrono::milliseconds GetHedgingDelay() const noexcept;
+
+    /// @returns `settings` with the current hedging delay of the destination
+    HedgingSettings MakeSettings(HedgingSettings settings) const noexcept;
+
+private:
+    friend void DumpMetric(statistics::Writer& writer, const AdaptiveHedging& hedging);
+
+    using Percentile = statistics::Percentile<2048, unsigned int, 120>;
+    using Latencies = statistics::RecentPeriod<Percentile, Percentile>;
+
+    void UpdateHedgingDelay() const noexcept;
+
+    const AdaptiveHedgingSettings settings_;
+    Latencies latencies_;
+    RetryBudget budget_;
+
+    // The percentile is costly to compute, it is updated once a second
+    mutable std::atomic<std::chrono::milliseconds> hedging_delay_;
+    mutable std::atomic<std::chrono::steady_clock::rep> next_update_{0};
+    std::atomic<std::uint64_t> hedges_{0};
+    std::atomic<std::uint64_t> hedges_throttled_{0};
+};
+
+/// @brief Set of utils::hedging::AdaptiveHedging, one for each destination
+///
+/// Trackers are created on the first use of a destination and live as long as
+/// the set.
+class AdaptiveHedgingSet final {
+public:
+    explicit AdaptiveHedgingSet(const AdaptiveHedgingSettings& settings);
+
+    AdaptiveHedgingSet(const AdaptiveHedgingSet&) = delete;
+    AdaptiveHedgingSet& operator=(const AdaptiveHedgingSet&) = delete;
+
+    ~AdaptiveHedgingSet();
+
+    /// @returns the tracker for the destination, the reference is valid for
+    /// the lifetime of `this`
+    AdaptiveHedging& GetHedging(std::string_view destination);
+
+    /// Writes the statistics of each tracker with the `destination` label
+    friend void DumpMetric(statistics::Writer& writer, const AdaptiveHedgingSet& set);
+
+private:
+    const AdaptiveHedgingSettings settings_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::unique_ptr<AdaptiveHedging>> trackers_;
+};
+
+namespace impl {
+
+template <typename Future>
+struct TimedAttempt {
+    Future future;
+    std::chrono::steady_clock::time_point start;
+
+    engine::impl::ContextAccessor* TryGetContextAccessor() { return future.TryGetContextAccessor(); }
+};
+
+struct AnyReplyIsOk {
+    template <typename Reply>
+    bool operator()(const Reply&) const noexcept {
+        return true;
+    }
+};
+
+/// RequestStrategy for the futures with `Get()`, that feeds the latencies and
+/// the hedges to utils::hedging::AdaptiveHedging. A reply rejected by
+/// `IsOk` is kept in case the other attempts fail too.
+template <typename Future, typename IsOk = AnyReplyIsOk>
+class AdaptiveRequestStrategy {
+public:
+    using ReplyType = std::decay_t<decltype(std::declval<Future&>().Get())>;
+    using GenF = std::function<Future()>;
+
+    AdaptiveRequestStrategy(GenF gen_callback, AdaptiveHedging& hedging, IsOk is_ok = {})
+        : gen_callback_(std::move(gen_callback)), hedging_(hedging), is_ok_(std::move(is_ok)) {}
+
+    AdaptiveRequestStrategy(AdaptiveRequestStrategy&& other) noexcept = default;
+
+    /// @{
+    /// Methods needed by HedgingStrategy
+    std::optional<TimedAttempt<Future>> Create(std::size_t attempt) {
+        if (attempt > 0 && !hedging_.TryStartHedge()) return std::nullopt;
+        return TimedAttempt<Future>{gen_callback_(), std::chrono::steady_clock::now()};
+    }
+
+    std::optional<std::chrono::milliseconds> ProcessReply(TimedAttempt<Future>&& attempt) {
+        try {
+            reply_ = attempt.future.Get();
+        } catch (const std::exception&) {
+            // Other attempts are still in flight, the next one is started right
+            // away if the attempts and the budget are left
+            return std::chrono::milliseconds{0};
+        }
+        if (!is_ok_(*reply_)) return std::chrono::milliseconds{0};
+
+        hedging_.AccountReply(
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - attempt.start)
+        );
+        return std::nullopt;
+    }
+
+    std::optional<ReplyType> ExtractReply() { return std::move(reply_); }
+
+    void Finish(TimedAttempt<Future>&&) {}
+    /// @}
+
+private:
+    GenF gen_callback_;
+    AdaptiveHedging& hedging_;
+    IsOk is_ok_;
+    std::optional<ReplyType> reply_;
+};
+
+}  // namespace impl
+
+/// @brief Performs the request produced by `gen_callback`, sends hedges after
+/// the current delay of `hedging` and within its budget.
+///
+/// `settings.hedging_delay` is replaced with the adaptive one.
+/// @returns the first successful reply or std::nullopt if all the attempts
+/// failed or timed out
+template <typename GenF>
+auto HedgeRequestAdaptive(GenF&& gen_callback, AdaptiveHedging& hedging, HedgingSettings settings) {
+    using Future = std::invoke_result_t<GenF&>;
+    return hedging::HedgeRequest(
+        impl::AdaptiveRequestStrategy<Future>(std::forward<GenF>(gen_callback), hedging),
+        hedging.MakeSettings(std::move(settings))
+    );
+}
+
+/// @brief Asynchronous version of utils::hedging::HedgeRequestAdaptive,
+/// `hedging` should outlive the returned future.
+template <typename GenF>
+auto HedgeRequestAdaptiveAsync(GenF&& gen_callback, AdaptiveHedging& hedging, HedgingSettings settings) {
+    using Future = std::invoke_result_t<GenF&>;
+    return hedging::HedgeRequestAsync(
+        impl::AdaptiveRequestStrategy<Future>(std::forward<GenF>(gen_callback), hedging),
+        hedging.MakeSettings(std::move(settings))
+    );
+}
+
+}  // namespace utils::hedging
+
+USERVER_NAMESPACE_END
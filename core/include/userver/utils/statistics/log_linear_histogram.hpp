@@ -0,0 +1,74 @@
+#pragma once
+
+/// @file userver/utils/statistics/log_linear_histogram.hpp
+/// @brief @copybrief utils::statistics::LogLinearHistogram
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/histogram_view.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief A histogram with log-linear (HDR-style) buckets, which have a
+/// constant relative error over a wide range of values.
+///
+/// Each power of two starting from `lowest_bound` is split into `sub_buckets`
+/// equal buckets, so the bucket bounds are
+/// `lowest_bound * 2^k * (1 + j / sub_buckets)`. A value is reported with a
+/// relative error of at most `1 / sub_buckets`. Values up to `lowest_bound`
+/// fall into the first bucket, values greater than
+/// `lowest_bound * 2^powers_of_two` fall into the "infinity" bucket.
+///
+/// Account finds the bucket in O(1) regardless of the bucket count.
+///
+/// The metric is read and serialized as a regular histogram, see
+/// utils::statistics::Histogram for the semantics. Histograms with the same
+/// parameters have the same bounds, so they can be summed across threads,
+/// components and hosts with utils::statistics::HistogramAggregator.
+///
+/// For example, `LogLinearHistogram{1, 12, 4}` covers latencies up to 4096ms
+/// with 49 buckets and at most 25% error, which fits in the Solomon limit of 50
+/// buckets.
+class LogLinearHistogram final {
+public:
+    LogLinearHistogram(double lowest_bound, std::size_t powers_of_two, std::size_t sub_buckets);
+
+    LogLinearHistogram(LogLinearHistogram&&) noexcept;
+    LogLinearHistogram& operator=(LogLinearHistogram&&) noexcept;
+    ~LogLinearHistogram();
+
+    /// Atomically increment the bucket corresponding to the given value.
+    void Account(double value, std::uint64_t count = 1) noexcept;
+
+    /// Atomically reset all counters to zero.
+    friend void ResetMetric(LogLinearHistogram& histogram) noexcept;
+
+    /// Allows reading the histogram.
+    HistogramView GetView() const& noexcept;
+
+    /// @cond
+    // Store LogLinearHistogram in a variable before taking a view on it.
+    HistogramView GetView() && noexcept = delete;
+    /// @endcond
+
+private:
+    std::size_t FindBucketIndex(double value) const noexcept;
+
+    double lowest_bound_;
+    std::size_t powers_of_two_;
+    std::size_t sub_buckets_;
+    std::size_t bucket_count_;
+    std::unique_ptr<impl::histogram::Bucket[]> buckets_;
+};
+
+/// Metric serialization support for LogLinearHistogram.
+void DumpMetric(Writer& writer, const LogLinearHistogram& histogram);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
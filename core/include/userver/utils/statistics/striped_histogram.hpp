@@ -0,0 +1,64 @@
+#pragma once
+
+/// @file userver/utils/statistics/striped_histogram.hpp
+/// @brief @copybrief utils::statistics::StripedHistogram
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <userver/utils/span.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/histogram_aggregator.hpp>
+#include <userver/utils/statistics/striped_rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief A histogram with per-CPU buckets, trades memory consumption and read
+/// performance for contention-free writes.
+///
+/// Has the same semantics and serialization as utils::statistics::Histogram.
+///
+/// Differences from utils::statistics::Histogram:
+///
+/// 1. Each bucket takes `8 * N_CORES` memory, like
+///    utils::statistics::StripedRateCounter
+/// 2. Reading sums up the per-CPU counters of each bucket, so use GetSnapshot()
+///    once per read
+///
+/// Use StripedHistogram instead of Histogram sparingly, in places where a lot
+/// of threads are supposed to be hammering on the same metric.
+class StripedHistogram final {
+public:
+    /// Sets upper bounds for each non-"infinite" bucket. The lowest bound is
+    /// always 0.
+    explicit StripedHistogram(utils::span<const double> upper_bounds);
+
+    StripedHistogram(const StripedHistogram&) = delete;
+    StripedHistogram& operator=(const StripedHistogram&) = delete;
+    ~StripedHistogram();
+
+    /// Increment the bucket corresponding to the given value.
+    void Account(double value, std::uint64_t count = 1) noexcept;
+
+    /// Sums up the per-CPU counters into a readable histogram.
+    HistogramAggregator GetSnapshot() const;
+
+    /// Reset all counters to zero, not atomic with respect to concurrent
+    /// Account calls.
+    friend void ResetMetric(StripedHistogram& histogram) noexcept;
+
+private:
+    std::vector<double> upper_bounds_;
+    // The last one is the "infinity" bucket
+    std::unique_ptr<StripedRateCounter[]> buckets_;
+};
+
+/// Metric serialization support for StripedHistogram.
+void DumpMetric(Writer& writer, const StripedHistogram& histogram);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,104 @@
+#pragma once
+
+/// @file userver/utils/statistics/striped_min_max_avg.hpp
+/// @brief @copybrief utils::statistics::StripedMinMaxAvg
+
+#include <cstdint>
+#include <type_traits>
+
+#include <userver/concurrent/per_cpu.hpp>
+#include <userver/concurrent/striped_counter.hpp>
+#include <userver/formats/json/inline.hpp>
+#include <userver/formats/serialize/to.hpp>
+#include <userver/utils/statistics/min_max_avg.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief Concurrent calculation of minimum, maximum and average over series
+/// of values with per-CPU minimum, maximum, sum and count.
+///
+/// Differences from utils::statistics::MinMaxAvg:
+///
+/// 1. Minimum, maximum, sum and count take `8 * N_CORES` memory each, like
+///    utils::statistics::StripedRateCounter
+/// 2. Account does not write to the cache lines shared with other CPUs
+/// 3. The sum does not overflow for `ValueType` narrower than `std::intptr_t`
+/// 4. The class is not copyable, use GetCurrent() to read the values
+template <typename ValueType, typename AverageType = ValueType>
+class StripedMinMaxAvg final {
+    static_assert(
+        std::is_integral_v<ValueType> && !std::is_same_v<ValueType, bool>,
+        "only integral value types are supported in StripedMinMaxAvg"
+    );
+    static_assert(sizeof(ValueType) <= sizeof(std::uintptr_t), "ValueType does not fit in the striped counter");
+    static_assert(
+        std::is_same_v<AverageType, ValueType> || std::is_floating_point_v<AverageType>,
+        "StripedMinMaxAvg average type must either be equal to value type or "
+        "be a floating point type"
+    );
+
+public:
+    using Current = typename MinMaxAvg<ValueType, AverageType>::Current;
+
+    StripedMinMaxAvg() = default;
+
+    Current GetCurrent() const {
+        const auto count = static_cast<SumType>(count_.NonNegativeRead());
+        if (count == 0) return Current{0, 0, AverageType{0}};
+
+        const auto sum = static_cast<SumType>(sum_.Read());
+        Current current{minimum_.Read(), maximum_.Read(), AverageType{0}};
+        if constexpr (std::is_floating_point_v<AverageType>) {
+            current.average = static_cast<AverageType>(sum) / static_cast<AverageType>(count);
+        } else {
+            current.average = static_cast<AverageType>(sum / count);
+        }
+        return current;
+    }
+
+    void Account(ValueType value) noexcept {
+        minimum_.Update(value);
+        maximum_.Update(value);
+        sum_.Add(static_cast<std::uintptr_t>(static_cast<SumType>(value)));
+        count_.Add(1);
+    }
+
+    /// Not atomic with respect to concurrent Account calls.
+    void Reset() noexcept {
+        minimum_.Reset();
+        maximum_.Reset();
+        sum_.Subtract(sum_.Read());
+        count_.Subtract(count_.Read());
+    }
+
+    bool IsEmpty() const noexcept { return count_.NonNegativeRead() == 0; }
+
+private:
+    using SumType = std::conditional_t<std::is_signed_v<ValueType>, std::intptr_t, std::uintptr_t>;
+
+    USERVER_NAMESPACE::concurrent::PerCpu<ValueType, USERVER_NAMESPACE::concurrent::PerCpuOp::kMin> minimum_;
+    USERVER_NAMESPACE::concurrent::PerCpu<ValueType, USERVER_NAMESPACE::concurrent::PerCpuOp::kMax> maximum_;
+    USERVER_NAMESPACE::concurrent::StripedCounter sum_;
+    USERVER_NAMESPACE::concurrent::StripedCounter count_;
+};
+
+template <typename ValueType, typename AverageType>
+auto Serialize(const StripedMinMaxAvg<ValueType, AverageType>& mma, formats::serialize::To<formats::json::Value>) {
+    const auto current = mma.GetCurrent();
+    return formats::json::MakeObject("min", current.minimum, "max", current.maximum, "avg", current.average);
+}
+
+template <typename ValueType, typename AverageType>
+void DumpMetric(Writer& writer, const StripedMinMaxAvg<ValueType, AverageType>& value) {
+    const auto current = value.GetCurrent();
+    writer["min"] = current.minimum;
+    writer["max"] = current.maximum;
+    writer["avg"] = current.average;
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/http/url.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,8 +19,33 @@ namespace {
 const int kEntitiesLimit = 64;
 const int kHeaderLengthLimit = 8192;
 
+std::string_view Rebase(std::string_view view, const char* old_data, const std::string& new_string) {
+    return std::string_view{new_string}.substr(view.data() - old_data, view.size());
+}
+
 }  // namespace
 
+struct AllowedKeys::Impl final {
+    utils::impl::TransparentSet<std::string> keys;
+};
+
+AllowedKeys::AllowedKeys() : AllowedKeys(std::unordered_set<std::string>{}) {}
+
+AllowedKeys::AllowedKeys(std::unordered_set<std::string> keys) {
+    auto impl = std::make_shared<Impl>();
+    for (auto& key : keys) impl->keys.insert(std::move(key));
+    impl_ = std::move(impl);
+}
+
+AllowedKeys::AllowedKeys(std::initializer_list<std::string> keys)
+    : AllowedKeys(std::unordered_set<std::string>(keys)) {}
+
+bool AllowedKeys::Contains(std::string_view key) const noexcept {
+    return utils::impl::FindTransparent(impl_->keys, key) != impl_->keys.end();
+}
+
+std::unordered_set<std::string> AllowedKeys::GetKeys() const { return {impl_->keys.begin(), impl_->keys.end()}; }
+
 BaggageEntryProperty::BaggageEntryProperty(std::string_view key, std::optional<std::string_view> value)
     : key_(std::move(key)), value_(std::move(value)) {}
 
@@ -78,16 +104,21 @@ const BaggageEntryProperty& BaggageEntry::GetProperty(const std::string& key) co
     throw BaggageException("Entry doesn't contain selected property");
 }
 
-std::string Baggage::ToString() const {
+const std::string& Baggage::ToString() const {
+    EnsureParsed();
     if (is_valid_header_) {
         return header_value_;
     }
     return result_header_;
 }
 
-const std::vector<BaggageEntry>& Baggage::GetEntries() const { return entries_; }
+const std::vector<BaggageEntry>& Baggage::GetEntries() const {
+    EnsureParsed();
+    return entries_;
+}
 
 bool Baggage::HasEntry(const std::string& key) const {
+    EnsureParsed();
     for (const auto& entry : entries_) {
         if (entry.key_ == http::UrlEncode(key)) {
             return true;
@@ -97,6 +128,7 @@ bool Baggage::HasEntry(const std::string& key) const {
 }
 
 const BaggageEntry& Baggage::GetEntry(const std::string& key) const {
+    EnsureParsed();
     for (const auto& entry : entries_) {
         if (entry.key_ == http::UrlEncode(key)) {
             return entry;
@@ -105,50 +137,38 @@ const BaggageEntry& Baggage::GetEntry(const std::string& key) const {
     throw BaggageException("Baggage doesn't contain selected entry");
 }
 
-Baggage::Baggage(std::string header, std::unordered_set<std::string> allowed_keys)
-    : header_value_(std::move(header)), allowed_keys_(std::move(allowed_keys)) {
-    header_value_.erase(
-        std::remove_if(header_value_.begin(), header_value_.end(), [](unsigned char x) { return std::isspace(x); }),
-        header_value_.end()
-    );
-
-    FillEntries();
-
-    // if header contains invalid symbols, we should fill result_header_
-    if (!is_valid_header_) {
-        CreateResultHeader();
-    }
-}
+Baggage::Baggage(std::string header, AllowedKeys allowed_keys)
+    : allowed_keys_(std::move(allowed_keys)), header_value_(std::move(header)) {}
 
+// The other baggage may be in use by other tasks, so it is parsed under its
+// once_flag before copying
 Baggage::Baggage(const Baggage& baggage_copy) noexcept : allowed_keys_(baggage_copy.allowed_keys_) {
-    if (baggage_copy.is_valid_header_) {
-        header_value_ = baggage_copy.header_value_;
-    } else {
-        header_value_ = baggage_copy.result_header_;
-    }
-    FillEntries();
-
-    // if header contains invalid symbols, we should fill result_header_
-    if (!is_valid_header_) {
-        CreateResultHeader();
-    }
+    baggage_copy.EnsureParsed();
+    header_value_ = baggage_copy.header_value_;
+    entries_ = RebaseEntries(baggage_copy.entries_, baggage_copy.header_value_.data());
+    result_header_ = baggage_copy.result_header_;
+    is_valid_header_ = baggage_copy.is_valid_header_;
+    std::call_once(parse_once_, [this] { is_parsed_ = true; });
 }
 
-Baggage::Baggage(Baggage&& baggage_copy) noexcept : allowed_keys_(std::move(baggage_copy.allowed_keys_)) {
-    if (baggage_copy.is_valid_header_) {
-        header_value_ = std::move(baggage_copy.header_value_);
-    } else {
-        header_value_ = std::move(baggage_copy.result_header_);
-    }
-    FillEntries();
+// The moved-from baggage is not shared, so a not yet parsed header stays so
+Baggage::Baggage(Baggage&& baggage_copy) noexcept : allowed_keys_(baggage_copy.allowed_keys_) {
+    const char* old_header_data = baggage_copy.header_value_.data();
+    header_value_ = std::move(baggage_copy.header_value_);
+    if (!baggage_copy.is_parsed_) return;
 
-    // if header contains invalid symbols, we should fill result_header_
-    if (!is_valid_header_) {
-        CreateResultHeader();
+    if (old_header_data == header_value_.data()) {
+        entries_ = std::move(baggage_copy.entries_);
+    } else {
+        entries_ = RebaseEntries(baggage_copy.entries_, old_header_data);
     }
+    result_header_ = std::move(baggage_copy.result_header_);
+    is_valid_header_ = baggage_copy.is_valid_header_;
+    std::call_once(parse_once_, [this] { is_parsed_ = true; });
 }
 
 void Baggage::AddEntry(std::string key, std::string value, BaggageProperties properties) {
+    EnsureParsed();
     auto encoded_key = http::UrlEncode(key);
     auto encoded_value = http::UrlEncode(value);
     if (!IsValidEntry(key)) {
@@ -202,11 +222,51 @@ void Baggage::AddEntry(std::string key, std::string value, BaggageProperties pro
     }
 }
 
-bool Baggage::IsValidEntry(const std::string& key) const { return allowed_keys_.count(key); }
+bool Baggage::IsValidEntry(const std::string& key) const { return allowed_keys_.Contains(key); }
+
+std::unordered_set<std::string> Baggage::GetAllowedKeys() const { return allowed_keys_.GetKeys(); }
+
+const AllowedKeys& Baggage::GetPrebuiltAllowedKeys() const noexcept { return allowed_keys_; }
 
-std::unordered_set<std::string> Baggage::GetAllowedKeys() const { return allowed_keys_; }
+void Baggage::EnsureParsed() const {
+    std::call_once(parse_once_, [this] {
+        header_value_.erase(
+            std::remove_if(header_value_.begin(), header_value_.end(), [](unsigned char x) { return std::isspace(x); }),
+            header_value_.end()
+        );
 
-void Baggage::CreateResultHeader() {
+        FillEntries();
+
+        // if header contains invalid symbols, we should fill result_header_
+        if (!is_valid_header_) {
+            CreateResultHeader();
+        }
+        is_parsed_ = true;
+    });
+}
+
+std::vector<BaggageEntry>
+Baggage::RebaseEntries(const std::vector<BaggageEntry>& other_entries, const char* old_header_data) const {
+    std::vector<BaggageEntry> entries;
+    entries.reserve(other_entries.size());
+    for (const auto& entry : other_entries) {
+        std::vector<BaggageEntryProperty> properties;
+        properties.reserve(entry.properties_.size());
+        for (const auto& property : entry.properties_) {
+            std::optional<std::string_view> value;
+            if (property.value_) value = Rebase(*property.value_, old_header_data, header_value_);
+            properties.emplace_back(Rebase(property.key_, old_header_data, header_value_), value);
+        }
+        entries.emplace_back(
+            Rebase(entry.key_, old_header_data, header_value_),
+            Rebase(entry.value_, old_header_data, header_value_),
+            std::move(properties)
+        );
+    }
+    return entries;
+}
+
+void Baggage::CreateResultHeader() const {
     result_header_.reserve(header_value_.size());
     for (size_t i = 0; i < entries_.size(); i++) {
         if (i != 0) {
@@ -216,7 +276,7 @@ void Baggage::CreateResultHeader() {
     }
 }
 
-void Baggage::FillEntries() {
+void Baggage::FillEntries() const {
     entries_.reserve(kEntitiesLimit);
     for (size_t header_pos = 0; header_pos != std::string::npos && entries_.size() < kEntitiesLimit;) {
         std::string_view entry{header_value_};
@@ -226,7 +286,7 @@ void Baggage::FillEntries() {
             entry.remove_suffix(header_value_.size() - header_pos);
         }
         if (!entry.empty()) {
-            auto parsed_entry = TryMakeBaggageEntry(entry);
+            auto parsed_entry = DoTryMakeBaggageEntry(entry);
             if (parsed_entry) {
                 entries_.emplace_back(std::move(*parsed_entry));
             } else {
@@ -240,6 +300,10 @@ void Baggage::FillEntries() {
 }
 
 std::optional<BaggageEntry> Baggage::TryMakeBaggageEntry(std::string_view entry) {
+    return DoTryMakeBaggageEntry(entry);
+}
+
+std::optional<BaggageEntry> Baggage::DoTryMakeBaggageEntry(std::string_view entry) const {
     if (entry.find(',') != std::string_view::npos) {
         LOG_LIMITED_WARNING() << "Entry contains invalid symbol: ','";
         return std::nullopt;
@@ -257,7 +321,10 @@ std::optional<BaggageEntry> Baggage::TryMakeBaggageEntry(std::string_view entry)
         return std::nullopt;
     }
     key.remove_suffix(entry.size() - entry_delimiter);
-    if (!allowed_keys_.count(http::parser::UrlDecode(key))) {
+    const bool is_allowed_key = key.find_first_of("%+") == std::string_view::npos
+                                    ? allowed_keys_.Contains(key)
+                                    : allowed_keys_.Contains(http::parser::UrlDecode(key));
+    if (!is_allowed_key) {
         LOG_LIMITED_WARNING() << fmt::format("Key {} is not available", key);
         return std::nullopt;
     }
@@ -344,13 +411,13 @@ std::optional<BaggageEntryProperty> Baggage::TryMakeBaggageEntryProperty(std::st
     return std::make_optional<BaggageEntryProperty>({key, std::make_optional<std::string_view>(std::move(value))});
 }
 
-std::optional<Baggage> TryMakeBaggage(std::string header, std::unordered_set<std::string> allowed_keys) {
+std::optional<Baggage> TryMakeBaggage(std::string header, AllowedKeys allowed_keys) {
     if (header.size() > kHeaderLengthLimit) {
         LOG_LIMITED_WARNING() << fmt::format("Exceeded the limit of header length: {}", kHeaderLengthLimit);
         return std::nullopt;
     }
 
-    return std::make_optional<Baggage>({std::move(header), std::move(allowed_keys)});
+    return std::optional<Baggage>{std::in_place, std::move(header), std::move(allowed_keys)};
 }
 
 }  // namespace baggage
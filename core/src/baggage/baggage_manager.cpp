@@ -13,10 +13,9 @@ namespace baggage {
 
 namespace {
 
-std::unordered_set<std::string>
-ChooseCurrentAllowedKeys(const Baggage* current_baggage, const dynamic_config::Source& config_source) {
+AllowedKeys ChooseCurrentAllowedKeys(const Baggage* current_baggage, const dynamic_config::Source& config_source) {
     if (current_baggage != nullptr) {
-        return current_baggage->GetAllowedKeys();
+        return current_baggage->GetPrebuiltAllowedKeys();
     }
     const auto snapshot = config_source.GetSnapshot();
     const auto& baggage_settings = snapshot[kBaggageSettings];
@@ -234,6 +234,30 @@ UTEST(Parse, BaggageHeader) {
     ASSERT_EQ(baggage_with_spaces->ToString(), "");
 }
 
+// Copies and moves keep the parsed entries pointing to their own header,
+// including the short headers in the small string buffer
+UTEST(Baggage, CopyAndMove) {
+    for (std::string header : {"key1=v", "key1=value1;property1,key6=value6,key2=value2;PropertyKey2=PropertyValue2"}) {
+        auto baggage = baggage::TryMakeBaggage(header, kAllowedKeys);
+        ASSERT_TRUE(baggage);
+        const auto expected_header = baggage->ToString();
+        const auto expected_entries = PrintBaggage(*baggage);
+
+        const baggage::Baggage copy{*baggage};
+        baggage::Baggage moved{std::move(*baggage)};
+        baggage.reset();
+        EXPECT_EQ(copy.ToString(), expected_header);
+        EXPECT_EQ(PrintBaggage(copy), expected_entries);
+        EXPECT_EQ(moved.ToString(), expected_header);
+        EXPECT_EQ(PrintBaggage(moved), expected_entries);
+
+        baggage::Baggage not_parsed{header, kAllowedKeys};
+        baggage::Baggage lazy_moved{std::move(not_parsed)};
+        EXPECT_EQ(lazy_moved.ToString(), expected_header);
+        EXPECT_EQ(PrintBaggage(lazy_moved), expected_entries);
+    }
+}
+
 class UTestBaggage : public baggage::Baggage {
 public:
     UTestBaggage(const std::unordered_set<std::string>& allowed_keys) : baggage::Baggage("", allowed_keys) {}
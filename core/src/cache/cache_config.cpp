@@ -46,6 +46,9 @@ constexpr std::string_view kFirstUpdateType = "first-update-type";
 constexpr std::string_view kAlertOnFailingToUpdateTimes = "alert-on-failing-to-update-times";
 
 constexpr std::string_view kSafeDataLifetime = "safe-data-lifetime";
+constexpr std::string_view kEstimateMemoryUsage = "estimate-memory-usage";
+
+constexpr std::string_view kUpdateDbConnections = "update-db-connections";
 
 constexpr auto kDefaultCleanupInterval = std::chrono::seconds{10};
 
@@ -138,6 +141,8 @@ Config::Config(const yaml_config::YamlConfig& config, const std::optional<dump::
       is_strong_period(config[kIsStrongPeriod].As<bool>(false)),
       failed_updates_before_expiration(config[kFailedUpdatesBeforeExpiration].As<std::optional<std::uint64_t>>()),
       is_safe_data_lifetime(config[kSafeDataLifetime].As<bool>(true)),
+      estimate_memory_usage(config[kEstimateMemoryUsage].As<bool>(false)),
+      update_db_connections(config[kUpdateDbConnections].As<std::size_t>(0)),
       first_update_mode(config[dump::kDump][kFirstUpdateMode].As<FirstUpdateMode>(FirstUpdateMode::kSkip)),
       first_update_type(config[dump::kDump][kFirstUpdateType].As<FirstUpdateType>(FirstUpdateType::kFull)),
       update_interval(config[kUpdateInterval].As<std::chrono::milliseconds>(0)),
@@ -1,6 +1,7 @@
 #include <cache/cache_dependencies.hpp>
 
 #include <userver/alerts/component.hpp>
+#include <userver/cache/update_scheduler.hpp>
 #include <userver/components/component.hpp>
 #include <userver/components/dump_configurator.hpp>
 #include <userver/components/statistics_storage.hpp>
@@ -32,6 +33,11 @@ FindDynamicConfig(const components::ComponentContext& context, const Config& sta
                : std::nullopt;
 }
 
+impl::UpdateScheduler* FindUpdateScheduler(const components::ComponentContext& context) {
+    auto* const scheduler = context.FindComponentOptional<components::CacheUpdateScheduler>();
+    return scheduler ? &scheduler->GetScheduler() : nullptr;
+}
+
 }  // namespace
 
 CacheDependencies
@@ -51,6 +57,7 @@ CacheDependencies::Make(const components::ComponentConfig& config, const compone
         dump_config ? dump::CreateOperationsFactory(*dump_config, context) : nullptr,
         dump_config ? &context.GetTaskProcessor(dump_config->fs_task_processor) : nullptr,
         context.FindComponent<components::TestsuiteSupport>().GetDumpControl(),
+        FindUpdateScheduler(context),
     };
 }
 
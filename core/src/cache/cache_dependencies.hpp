@@ -19,6 +19,10 @@ USERVER_NAMESPACE_BEGIN
 
 namespace cache {
 
+namespace impl {
+class UpdateScheduler;
+}  // namespace impl
+
 struct CacheDependencies final {
     std::string name;
     Config config;
@@ -31,6 +35,7 @@ struct CacheDependencies final {
     std::unique_ptr<dump::OperationsFactory> dump_rw_factory;
     engine::TaskProcessor* fs_task_processor;
     testsuite::DumpControl& dump_control;
+    impl::UpdateScheduler* update_scheduler;
 
     static CacheDependencies
     Make(const components::ComponentConfig& config, const components::ComponentContext& context);
@@ -14,6 +14,7 @@ constexpr const char* kStatisticsNameFull = "full";
 constexpr const char* kStatisticsNameIncremental = "incremental";
 constexpr const char* kStatisticsNameAny = "any";
 constexpr const char* kStatisticsNameCurrentDocumentsCount = "current-documents-count";
+constexpr const char* kStatisticsNameMemoryUsage = "memory-usage-bytes";
 
 template <typename Clock, typename Duration>
 std::int64_t TimeStampToMillisecondsFromNow(std::chrono::time_point<Clock, Duration> time) {
@@ -86,6 +87,10 @@ void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats) {
     writer[cache::kStatisticsNameAny] = any;
 
     writer[cache::kStatisticsNameCurrentDocumentsCount] = stats.documents_current_count;
+
+    if (const auto memory_usage = stats.memory_usage_bytes.load()) {
+        writer[cache::kStatisticsNameMemoryUsage] = memory_usage;
+    }
 }
 
 }  // namespace impl
@@ -55,6 +55,8 @@ void CacheUpdateTrait::GetAndWrite(dump::Writer&) const { dump::ThrowDumpUnimple
 
 void CacheUpdateTrait::ReadAndSet(dump::Reader&) { dump::ThrowDumpUnimplemented(Name()); }
 
+std::optional<std::size_t> CacheUpdateTrait::EstimateMemoryUsage() const { return std::nullopt; }
+
 }  // namespace cache
 
 USERVER_NAMESPACE_END
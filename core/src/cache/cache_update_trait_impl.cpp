@@ -1,5 +1,7 @@
 #include <cache/cache_update_trait_impl.hpp>
 
+#include <limits>
+
 #include <fmt/format.h>
 
 #include <userver/components/component.hpp>
@@ -17,6 +19,7 @@
 #include <userver/utils/rand.hpp>
 
 #include <cache/cache_dependencies.hpp>
+#include <cache/update_scheduler.hpp>
 #include <dump/dump_locator.hpp>
 #include <userver/dump/factory.hpp>
 #include <userver/testsuite/testsuite_support.hpp>
@@ -111,9 +114,15 @@ CacheUpdateTrait::Impl::Impl(CacheDependencies&& dependencies, CacheUpdateTrait&
       name_(std::move(dependencies.name)),
       update_task_name_("update-task/" + name_),
       task_processor_(dependencies.task_processor),
+      update_scheduler_(dependencies.update_scheduler),
       periodic_update_enabled_(dependencies.cache_control.IsPeriodicUpdateEnabled(static_config_, name_)),
       periodic_task_flags_{utils::PeriodicTask::Flags::kChaotic},
       dumpable_(customized_trait_) {
+    if (update_scheduler_ && periodic_update_enabled_) {
+        update_phase_ = update_scheduler_->RegisterCache(name_);
+        update_phase_pending_ = update_phase_ > 0;
+    }
+
     if (dependencies.dump_config) {
         dumper_.emplace(
             *dependencies.dump_config,
@@ -225,7 +234,10 @@ void CacheUpdateTrait::Impl::StartPeriodicUpdates(utils::Flags<CacheUpdateTrait:
         }
 
         if (periodic_update_enabled_) {
-            update_task_.Start(update_task_name_, GetPeriodicTaskSettings(*config), [this] { DoPeriodicUpdate(); });
+            update_task_.Start(update_task_name_, GetPeriodicTaskSettings(*config), [this] {
+                ApplyUpdatePhase();
+                DoPeriodicUpdate();
+            });
 
             utils::PeriodicTask::Settings cleanup_settings(config->cleanup_interval);
             cleanup_settings.span_level = logging::Level::kNone;
@@ -330,6 +342,12 @@ void CacheUpdateTrait::Impl::DoPeriodicUpdate() {
     }
 
     const auto update_type = NextUpdateType(*config);
+
+    std::optional<impl::UpdateScheduler::Permit> permit;
+    if (update_scheduler_) {
+        permit.emplace(update_scheduler_->Acquire(name_, GetStaleness(*config), config->update_db_connections));
+    }
+
     try {
         DoUpdate(update_type, *config);
         // Note: "on update success" logic goes inside DoUpdate
@@ -340,6 +358,21 @@ void CacheUpdateTrait::Impl::DoPeriodicUpdate() {
     }
 }
 
+void CacheUpdateTrait::Impl::ApplyUpdatePhase() {
+    if (update_phase_pending_.exchange(false)) {
+        const auto config = GetConfig();
+        update_task_.SetSettings(GetPeriodicTaskSettings(*config));
+    }
+}
+
+double CacheUpdateTrait::Impl::GetStaleness(const Config& config) const {
+    if (last_update_ == dump::TimePoint{} || config.update_interval.count() <= 0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    const auto since_last_update = utils::datetime::Now() - last_update_;
+    return std::chrono::duration<double>(since_last_update) / std::chrono::duration<double>(config.update_interval);
+}
+
 void CacheUpdateTrait::Impl::OnUpdateFailure(const Config& config) {
     OnUpdateSkipped();
 
@@ -423,11 +456,26 @@ void CacheUpdateTrait::Impl::DoUpdate(UpdateType update_type, const Config& conf
 
     last_update_ = now;
     alerts_storage_.StopAlertNow("cache_update_error");
+    const bool cache_modified = cache_modified_.exchange(false);
     if (dumper_) {
         dumper_->OnUpdateCompleted(
-            now, cache_modified_.exchange(false) ? dump::UpdateType::kModified : dump::UpdateType::kAlreadyUpToDate
+            now, cache_modified ? dump::UpdateType::kModified : dump::UpdateType::kAlreadyUpToDate
         );
     }
+    if (cache_modified && static_config_.estimate_memory_usage) {
+        UpdateMemoryUsageStatistic();
+    }
+}
+
+void CacheUpdateTrait::Impl::UpdateMemoryUsageStatistic() {
+    const auto memory_usage = customized_trait_.EstimateMemoryUsage();
+    if (!memory_usage) {
+        LOG_LIMITED_WARNING() << "Cache " << name_
+                              << " has estimate-memory-usage enabled, but its data type does not support "
+                                 "cache::MemoryEstimator";
+        return;
+    }
+    statistics_.memory_usage_bytes = *memory_usage;
 }
 
 void CacheUpdateTrait::Impl::CheckUpdateState(impl::UpdateState update_state, std::string_view update_type_str) {
@@ -458,6 +506,9 @@ utils::PeriodicTask::Settings CacheUpdateTrait::Impl::GetPeriodicTaskSettings(co
     utils::PeriodicTask::Settings settings{config.update_interval, config.update_jitter, periodic_task_flags_};
     settings.exception_period = config.exception_interval;
     settings.task_processor = &task_processor_;
+    if (update_phase_pending_) {
+        settings.period += std::chrono::duration_cast<std::chrono::milliseconds>(config.update_interval * update_phase_);
+    }
     return settings;
 }
 
@@ -32,6 +32,10 @@ namespace cache {
 struct CacheDependencies;
 class CacheUpdateTrait;
 
+namespace impl {
+class UpdateScheduler;
+}  // namespace impl
+
 class CacheUpdateTrait::Impl final {
 public:
     explicit Impl(CacheDependencies&& dependencies, CacheUpdateTrait& self);
@@ -87,6 +91,12 @@ private:
 
     void DoPeriodicUpdate();
 
+    // Restores the regular update period after the first periodic update,
+    // which is shifted by the phase from the UpdateScheduler
+    void ApplyUpdatePhase();
+
+    double GetStaleness(const Config& config) const;
+
     void OnUpdateFailure(const Config& config);
 
     void OnUpdateSkipped();
@@ -95,6 +105,8 @@ private:
     void DoUpdate(UpdateType type, const Config& config);
     void CheckUpdateState(impl::UpdateState update_state, std::string_view update_type_str);
 
+    void UpdateMemoryUsageStatistic();
+
     utils::PeriodicTask::Settings GetPeriodicTaskSettings(const Config& config);
 
     void OnConfigUpdate(const dynamic_config::Snapshot& config);
@@ -113,7 +125,10 @@ private:
     const std::string name_;
     const std::string update_task_name_;
     engine::TaskProcessor& task_processor_;
+    impl::UpdateScheduler* const update_scheduler_;
     const bool periodic_update_enabled_;
+    double update_phase_{0};
+    std::atomic<bool> update_phase_pending_{false};
     std::atomic<bool> is_running_{false};
     bool first_update_attempted_{false};
     std::atomic<bool> cache_modified_{false};
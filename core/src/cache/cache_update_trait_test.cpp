@@ -29,6 +29,7 @@
 #include <userver/testsuite/dump_control.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/enumerate.hpp>
+#include <userver/utils/statistics/testing.hpp>
 #include <userver/utils/underlying_value.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
@@ -1118,4 +1119,61 @@ UTEST(CacheUpdateTrait, FinishWithError) {
     );
 }
 
+namespace {
+
+constexpr std::size_t kDummyMemoryUsage = 4242;
+
+class MemoryUsageCache final : public cache::CacheMockBase {
+public:
+    static constexpr std::string_view kName = "memory-usage-cache";
+
+    MemoryUsageCache(const yaml_config::YamlConfig& config, cache::MockEnvironment& environment)
+        : CacheMockBase(kName, config, environment) {
+        StartPeriodicUpdates();
+    }
+
+    ~MemoryUsageCache() override { StopPeriodicUpdates(); }
+
+private:
+    void Update(
+        cache::UpdateType /*type*/,
+        const std::chrono::system_clock::time_point& /*last_update*/,
+        const std::chrono::system_clock::time_point& /*now*/,
+        cache::UpdateStatisticsScope& stats_scope
+    ) override {
+        OnCacheModified();
+        stats_scope.Finish(kDummyDocumentsCount);
+    }
+
+    std::optional<std::size_t> EstimateMemoryUsage() const override { return kDummyMemoryUsage; }
+};
+
+std::optional<utils::statistics::MetricValue> GetMemoryUsageMetric(cache::MockEnvironment& environment) {
+    const utils::statistics::Snapshot snapshot{environment.statistics_storage, "cache"};
+    return snapshot.SingleMetricOptional("memory-usage-bytes", {{"cache_name", std::string{MemoryUsageCache::kName}}});
+}
+
+}  // namespace
+
+UTEST(CacheUpdateTrait, MemoryUsage) {
+    const yaml_config::YamlConfig config{
+        formats::yaml::FromString(kFakeCacheConfig + "estimate-memory-usage: true\n"), {}};
+    cache::MockEnvironment environment;
+
+    const MemoryUsageCache test_cache(config, environment);
+
+    const auto metric = GetMemoryUsageMetric(environment);
+    ASSERT_TRUE(metric);
+    EXPECT_EQ(metric->AsInt(), static_cast<std::int64_t>(kDummyMemoryUsage));
+}
+
+UTEST(CacheUpdateTrait, MemoryUsageDisabled) {
+    const yaml_config::YamlConfig config{formats::yaml::FromString(kFakeCacheConfig), {}};
+    cache::MockEnvironment environment;
+
+    const MemoryUsageCache test_cache(config, environment);
+
+    EXPECT_FALSE(GetMemoryUsageMetric(environment));
+}
+
 USERVER_NAMESPACE_END
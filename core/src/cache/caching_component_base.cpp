@@ -92,6 +92,19 @@ properties:
             Can be set to `false` if the stored data does not refer to the component
             and its dependencies.
         defaultDescription: true
+    estimate-memory-usage:
+        type: boolean
+        description: |
+            estimate the memory usage of the cached data after each update
+            that changed it and report it in the memory-usage-bytes metric
+        defaultDescription: false
+    update-db-connections:
+        type: integer
+        description: |
+            the number of database connections used by an update, limited
+            by the max-db-connections option of cache-update-scheduler
+        defaultDescription: 0
+        minimum: 0
     dump:
         type: object
         description: Manages cache behavior after dump load
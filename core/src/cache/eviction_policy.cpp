@@ -0,0 +1,31 @@
+#include <userver/cache/eviction_policy.hpp>
+
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace {
+
+constexpr utils::TrivialBiMap kEvictionPolicyMap([](auto selector) {
+    return selector()
+        .Case(EvictionPolicy::kLru, "lru")
+        .Case(EvictionPolicy::kClock, "clock")
+        .Case(EvictionPolicy::kTinyLfu, "tiny-lfu");
+});
+
+}  // namespace
+
+EvictionPolicy Parse(const yaml_config::YamlConfig& value, formats::parse::To<EvictionPolicy>) {
+    return utils::ParseFromValueString(value, kEvictionPolicyMap);
+}
+
+std::string_view ToString(EvictionPolicy eviction_policy) {
+    return utils::impl::EnumToStringView(eviction_policy, kEvictionPolicyMap);
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
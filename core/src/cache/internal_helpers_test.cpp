@@ -32,6 +32,7 @@ MakeDependencies(std::string_view name, const yaml_config::YamlConfig& config, M
         dump_config ? dump::CreateDefaultOperationsFactory(*dump_config) : nullptr,
         &engine::current_task::GetTaskProcessor(),
         environment.dump_control,
+        /*update_scheduler=*/nullptr,
     };
 }
 
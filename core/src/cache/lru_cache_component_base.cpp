@@ -52,9 +52,21 @@ properties:
     size:
         type: integer
         description: max amount of items to store in cache
+    max-bytes:
+        type: integer
+        description: max sum of cache::EntryCost of the items, requires `eviction-policy` lru (0 is unlimited)
+        defaultDescription: 0
     ways:
         type: integer
         description: number of ways for associative cache
+    eviction-policy:
+        type: string
+        description: eviction policy of the ways, `clock` lets the hits on a way run in parallel, `tiny-lfu` protects the popular entries from scans
+        defaultDescription: lru
+        enum:
+          - lru
+          - clock
+          - tiny-lfu
     lifetime:
         type: string
         description: TTL for cache entries (0 is unlimited)
@@ -14,7 +14,9 @@ namespace cache {
 namespace {
 
 constexpr std::string_view kWays = "ways";
+constexpr std::string_view kEvictionPolicy = "eviction-policy";
 constexpr std::string_view kSize = "size";
+constexpr std::string_view kMaxBytes = "max-bytes";
 constexpr std::string_view kLifetime = "lifetime";
 constexpr std::string_view kBackgroundUpdate = "background-update";
 constexpr std::string_view kLifetimeMs = "lifetime-ms";
@@ -25,6 +27,7 @@ using dump::impl::ParseMs;
 
 LruCacheConfig::LruCacheConfig(const yaml_config::YamlConfig& config)
     : size(config[kSize].As<std::size_t>()),
+      max_bytes(config[kMaxBytes].As<std::size_t>(0)),
       lifetime(config[kLifetime].As<std::chrono::milliseconds>(0)),
       background_update(
           config[kBackgroundUpdate].As<bool>(false) ? BackgroundUpdateMode::kEnabled : BackgroundUpdateMode::kDisabled
@@ -37,6 +40,7 @@ LruCacheConfig::LruCacheConfig(const components::ComponentConfig& config)
 
 LruCacheConfig::LruCacheConfig(const formats::json::Value& value)
     : size(value[kSize].As<std::size_t>()),
+      max_bytes(value[kMaxBytes].As<std::size_t>(0)),
       lifetime(ParseMs(value[kLifetimeMs])),
       background_update(
           value[kBackgroundUpdate].As<bool>(false) ? BackgroundUpdateMode::kEnabled : BackgroundUpdateMode::kDisabled
@@ -49,6 +53,12 @@ std::size_t LruCacheConfig::GetWaySize(std::size_t ways) const {
     return way_size == 0 ? 1 : way_size;
 }
 
+std::size_t LruCacheConfig::GetWayMaxBytes(std::size_t ways) const {
+    if (max_bytes == 0) return 0;
+    const auto way_max_bytes = max_bytes / ways;
+    return way_max_bytes == 0 ? 1 : way_max_bytes;
+}
+
 LruCacheConfig Parse(const formats::json::Value& value, formats::parse::To<LruCacheConfig>) {
     return LruCacheConfig{value};
 }
@@ -56,8 +66,12 @@ LruCacheConfig Parse(const formats::json::Value& value, formats::parse::To<LruCa
 LruCacheConfigStatic::LruCacheConfigStatic(const yaml_config::YamlConfig& config)
     : config(config),
       ways(config[kWays].As<std::size_t>()),
+      eviction_policy(config[kEvictionPolicy].As<EvictionPolicy>(EvictionPolicy::kLru)),
       use_dynamic_config(config["config-settings"].As<bool>(true)) {
     if (ways <= 0) throw std::runtime_error("cache-ways is non-positive");
+    if (this->config.max_bytes != 0 && eviction_policy != EvictionPolicy::kLru) {
+        throw std::runtime_error("cache max-bytes requires eviction-policy 'lru'");
+    }
 }
 
 LruCacheConfigStatic::LruCacheConfigStatic(const components::ComponentConfig& config)
@@ -0,0 +1,105 @@
+#include <userver/cache/memory_usage.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+/// [Sample EstimateDynamicMemory]
+struct Document {
+    std::string name;
+    std::vector<std::string> tags;
+};
+
+std::size_t EstimateDynamicMemory(cache::MemoryEstimator& estimator, const Document& document) {
+    return estimator.EstimateDynamic(document.name) + estimator.EstimateDynamic(document.tags);
+}
+/// [Sample EstimateDynamicMemory]
+
+struct NotEstimable {
+    std::string value;
+};
+
+const std::string kLongString(100, 'a');
+
+}  // namespace
+
+static_assert(cache::kIsMemoryEstimable<int>);
+static_assert(cache::kIsMemoryEstimable<std::string>);
+static_assert(cache::kIsMemoryEstimable<Document>);
+static_assert(cache::kIsMemoryEstimable<std::unordered_map<std::string, std::vector<Document>>>);
+static_assert(cache::kIsMemoryEstimable<std::shared_ptr<const Document>>);
+static_assert(!cache::kIsMemoryEstimable<NotEstimable>);
+static_assert(!cache::kIsMemoryEstimable<std::vector<NotEstimable>>);
+static_assert(!cache::kIsMemoryEstimable<std::map<int, std::optional<NotEstimable>>>);
+
+TEST(MemoryUsage, Trivial) {
+    EXPECT_EQ(cache::EstimateMemoryUsage(42), sizeof(int));
+    EXPECT_EQ(cache::EstimateMemoryUsage(std::pair<int, double>{}), sizeof(std::pair<int, double>));
+}
+
+TEST(MemoryUsage, String) {
+    EXPECT_EQ(cache::EstimateMemoryUsage(std::string{"short"}), sizeof(std::string));
+
+    const auto long_string = kLongString;
+    EXPECT_EQ(cache::EstimateMemoryUsage(long_string), sizeof(std::string) + long_string.capacity() + 1);
+}
+
+TEST(MemoryUsage, Vector) {
+    std::vector<int> ints;
+    ints.reserve(100);
+    ints.push_back(1);
+    EXPECT_EQ(cache::EstimateMemoryUsage(ints), sizeof(ints) + 100 * sizeof(int));
+
+    std::vector<std::string> strings(2, kLongString);
+    strings.shrink_to_fit();
+    EXPECT_EQ(
+        cache::EstimateMemoryUsage(strings), sizeof(strings) + 2 * (sizeof(std::string) + kLongString.capacity() + 1)
+    );
+}
+
+TEST(MemoryUsage, Nodes) {
+    const std::map<int, std::string> map{{1, kLongString}, {2, "short"}};
+    const auto map_usage = cache::EstimateMemoryUsage(map);
+    EXPECT_GT(map_usage, sizeof(map) + 2 * sizeof(std::pair<const int, std::string>) + kLongString.size());
+
+    std::unordered_map<int, int> hash_map;
+    const auto empty_usage = cache::EstimateMemoryUsage(hash_map);
+    for (int i = 0; i < 1000; ++i) hash_map.emplace(i, i);
+    EXPECT_GT(cache::EstimateMemoryUsage(hash_map), empty_usage + 1000 * sizeof(std::pair<const int, int>));
+}
+
+TEST(MemoryUsage, Wrappers) {
+    const std::optional<std::string> empty;
+    EXPECT_EQ(cache::EstimateMemoryUsage(empty), sizeof(empty));
+
+    const std::optional<std::string> optional = kLongString;
+    EXPECT_EQ(cache::EstimateMemoryUsage(optional), sizeof(optional) + kLongString.capacity() + 1);
+
+    const std::variant<int, std::string> variant = kLongString;
+    EXPECT_EQ(cache::EstimateMemoryUsage(variant), sizeof(variant) + kLongString.capacity() + 1);
+
+    const auto unique = std::make_unique<std::string>(kLongString);
+    EXPECT_EQ(cache::EstimateMemoryUsage(unique), sizeof(unique) + sizeof(std::string) + kLongString.capacity() + 1);
+}
+
+TEST(MemoryUsage, SharedAccountedOnce) {
+    const auto document = std::make_shared<const Document>(Document{kLongString, {kLongString}});
+    const std::vector<std::shared_ptr<const Document>> one{document};
+    const std::vector<std::shared_ptr<const Document>> many(10, document);
+
+    const auto one_usage = cache::EstimateMemoryUsage(one);
+    EXPECT_GT(one_usage, sizeof(Document) + 2 * kLongString.size());
+    EXPECT_EQ(cache::EstimateMemoryUsage(many), one_usage + 9 * sizeof(document));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,39 @@
+#include <userver/cache/nway_lru_cache.hpp>
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/run_standalone.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWays = 16;
+constexpr std::size_t kWaySize = 1024;
+// All the hits go to a few hot keys, as with a popular item of a real cache
+constexpr std::uint64_t kHotKeys = 8;
+
+template <cache::EvictionPolicy Policy>
+void NWayLruHotHits(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        cache::NWayLRU<std::uint64_t, std::uint64_t> cache{kWays, kWaySize, Policy};
+        for (std::uint64_t key = 0; key < kWays * kWaySize; ++key) cache.Put(key, key);
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            std::uint64_t key = 0;
+            for ([[maybe_unused]] auto _ : range) {
+                benchmark::DoNotOptimize(cache.Get(key++ % kHotKeys));
+            }
+        });
+    });
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(NWayLruHotHits, cache::EvictionPolicy::kLru)->RangeMultiplier(2)->Range(1, 32);
+BENCHMARK_TEMPLATE(NWayLruHotHits, cache::EvictionPolicy::kClock)->RangeMultiplier(2)->Range(1, 32);
+
+USERVER_NAMESPACE_END
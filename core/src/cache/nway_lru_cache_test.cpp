@@ -1,11 +1,36 @@
 #include <userver/utest/utest.hpp>
 
+#include <string>
+#include <vector>
+
 #include <userver/cache/nway_lru_cache.hpp>
+#include <userver/engine/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 using Cache = cache::NWayLRU<int, int>;
 
+namespace {
+
+struct Document {
+    std::string payload;
+};
+
+}  // namespace
+
+/// [Sample EntryCost]
+namespace cache {
+
+template <>
+struct EntryCost<int, Document> final {
+    std::size_t operator()(int /*key*/, const Document& document) const noexcept {
+        return sizeof(int) + sizeof(Document) + document.payload.size();
+    }
+};
+
+}  // namespace cache
+/// [Sample EntryCost]
+
 UTEST(NWayLRU, Ctr) {
     UEXPECT_NO_THROW(Cache(1, 10));
     UEXPECT_NO_THROW(Cache(10, 10));
@@ -54,6 +79,126 @@ UTEST(NWayLRU, SetMultipleWays) {
     EXPECT_EQ(1, cache.Get(1));
 }
 
+UTEST(NWayLRU, ClockEviction) {
+    Cache cache(1, 2, cache::EvictionPolicy::kClock);
+    cache.Put(1, 1);
+    cache.Put(2, 2);
+    EXPECT_EQ(1, cache.Get(1));
+
+    // 2 was not referenced since the insertion
+    cache.Put(3, 3);
+    EXPECT_EQ(2, cache.GetSize());
+    EXPECT_EQ(1, cache.Get(1));
+    EXPECT_EQ(3, cache.Get(3));
+    EXPECT_FALSE(cache.Get(2).has_value());
+
+    EXPECT_FALSE(cache.Get(1, [](int) { return false; }).has_value());
+    EXPECT_EQ(1, cache.GetSize());
+    EXPECT_EQ(42, cache.GetOr(1, 42));
+
+    cache.UpdateWaySize(1);
+    EXPECT_EQ(1, cache.GetSize());
+    cache.Invalidate();
+    EXPECT_EQ(0, cache.GetSize());
+}
+
+UTEST(NWayLRU, TinyLfu) {
+    Cache cache(2, 100, cache::EvictionPolicy::kTinyLfu);
+    for (int i = 0; i < 1000; ++i) {
+        cache.Put(i, i);
+        if (i % 2 == 0) {
+            EXPECT_EQ(i, cache.Get(i));
+        }
+    }
+    EXPECT_LE(cache.GetSize(), 200);
+    EXPECT_EQ(999, cache.Get(999));
+
+    EXPECT_FALSE(cache.Get(999, [](int) { return false; }).has_value());
+    EXPECT_FALSE(cache.Get(999).has_value());
+    cache.InvalidateByKey(998);
+    EXPECT_FALSE(cache.Get(998).has_value());
+}
+
+UTEST_MT(NWayLRU, ClockConcurrentHits, 4) {
+    Cache cache(2, 100, cache::EvictionPolicy::kClock);
+    for (int i = 0; i < 100; ++i) cache.Put(i, i);
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (int task = 0; task < 4; ++task) {
+        tasks.push_back(engine::AsyncNoSpan([&cache, task] {
+            for (int i = 0; i < 10000; ++i) {
+                const int key = (i * 7 + task) % 150;
+                if (const auto value = cache.Get(key)) {
+                    EXPECT_EQ(key, *value);
+                } else if (i % 10 == task) {
+                    cache.Put(key, key);
+                }
+            }
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    EXPECT_LE(cache.GetSize(), 200);
+}
+
+UTEST(NWayLRU, MaxBytes) {
+    const auto cost = [](std::size_t payload_size) { return sizeof(int) + sizeof(Document) + payload_size; };
+    cache::NWayLRU<int, Document> cache(1, 100);
+    cache.Put(1, {std::string(100, 'a')});
+    EXPECT_EQ(cache.GetBytes(), 0);
+
+    cache.UpdateWayMaxBytes(cost(100) * 3);
+    EXPECT_EQ(cache.GetBytes(), cost(100));
+    cache.Put(2, {std::string(100, 'b')});
+    cache.Put(3, {std::string(100, 'c')});
+    EXPECT_EQ(cache.GetBytes(), cost(100) * 3);
+
+    // 1 is the least recently used one
+    cache.Put(4, {std::string(100, 'd')});
+    EXPECT_EQ(cache.GetSize(), 3);
+    EXPECT_EQ(cache.GetBytes(), cost(100) * 3);
+    EXPECT_FALSE(cache.Get(1).has_value());
+
+    // Replacing 2 with a bigger value evicts 3
+    ASSERT_TRUE(cache.Get(4).has_value());
+    cache.Put(2, {std::string(200, 'b')});
+    EXPECT_EQ(cache.GetSize(), 2);
+    EXPECT_EQ(cache.GetBytes(), cost(100) + cost(200));
+    EXPECT_FALSE(cache.Get(3).has_value());
+
+    // Too big entry is kept alone
+    cache.Put(5, {std::string(1000, 'e')});
+    EXPECT_EQ(cache.GetSize(), 1);
+    EXPECT_EQ(cache.GetBytes(), cost(1000));
+
+    cache.Put(6, {std::string(10, 'f')});
+    cache.InvalidateByKey(5);
+    EXPECT_EQ(cache.GetBytes(), cost(10));
+    EXPECT_FALSE(cache.Get(6, [](const Document&) { return false; }).has_value());
+    EXPECT_EQ(cache.GetBytes(), 0);
+
+    // The count bound still works
+    cache.UpdateWayMaxBytes(cost(10) * 100);
+    cache.UpdateWaySize(2);
+    for (int i = 0; i < 10; ++i) cache.Put(i, {std::string(10, 'g')});
+    EXPECT_EQ(cache.GetSize(), 2);
+    EXPECT_EQ(cache.GetBytes(), cost(10) * 2);
+
+    cache.Invalidate();
+    EXPECT_EQ(cache.GetBytes(), 0);
+
+    cache.Put(1, {std::string(10, 'h')});
+    cache.UpdateWayMaxBytes(0);
+    EXPECT_EQ(cache.GetBytes(), 0);
+    EXPECT_EQ(cache.GetSize(), 1);
+}
+
+UTEST(NWayLRU, MaxBytesRequiresLru) {
+    Cache cache(1, 10, cache::EvictionPolicy::kClock);
+    UEXPECT_THROW(cache.UpdateWayMaxBytes(100), std::logic_error);
+    UEXPECT_NO_THROW(cache.UpdateWayMaxBytes(0));
+}
+
 UTEST(NWayLRU, HashCombine) {
     for (const auto seed : std::vector<std::size_t>{0, 1, 7, 42, 100, 1000}) {
         /// @note: checking for seed used in way selection to not be equal after
@@ -0,0 +1,169 @@
+#include <cache/update_scheduler.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <utility>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+namespace {
+
+// The fractional parts of k * kGoldenRatioConjugate are spread uniformly in
+// [0, 1) for any number of caches
+constexpr double kGoldenRatioConjugate = 0.6180339887498949;
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer, const UpdateSchedulerCacheStatistics& stats) {
+    writer["updates"] = stats.updates;
+    writer["delayed-updates"] = stats.delayed_updates;
+    writer["wait-time-ms"] = stats.wait_time_ms;
+    writer["update-phase"] = stats.update_phase;
+}
+
+UpdateScheduler::Permit::Permit(UpdateScheduler& scheduler, std::size_t db_connections) noexcept
+    : scheduler_(&scheduler), db_connections_(db_connections) {}
+
+UpdateScheduler::Permit::Permit(Permit&& other) noexcept
+    : scheduler_(std::exchange(other.scheduler_, nullptr)), db_connections_(other.db_connections_) {}
+
+UpdateScheduler::Permit& UpdateScheduler::Permit::operator=(Permit&& other) noexcept {
+    if (this != &other) {
+        Permit old(std::move(*this));
+        scheduler_ = std::exchange(other.scheduler_, nullptr);
+        db_connections_ = other.db_connections_;
+    }
+    return *this;
+}
+
+UpdateScheduler::Permit::~Permit() {
+    if (scheduler_) scheduler_->Release(db_connections_);
+}
+
+UpdateScheduler::UpdateScheduler(Settings settings) : settings_(settings) {}
+
+double UpdateScheduler::RegisterCache(const std::string& name) {
+    const std::lock_guard lock(mutex_);
+
+    double phase = 0;
+    if (settings_.spread_phases) {
+        double integral_part{};
+        phase = std::modf(static_cast<double>(registered_caches_) * kGoldenRatioConjugate, &integral_part);
+    }
+    ++registered_caches_;
+
+    caches_[name].update_phase = phase;
+    return phase;
+}
+
+UpdateScheduler::Permit
+UpdateScheduler::Acquire(const std::string& name, double staleness, std::size_t db_connections) {
+    if (settings_.max_db_connections != 0) {
+        // Otherwise the update would never fit
+        db_connections = std::min(db_connections, settings_.max_db_connections);
+    }
+
+    std::unique_lock lock(mutex_);
+    const auto id = next_waiter_id_++;
+    waiters_.push_back({id, staleness, db_connections});
+
+    const auto wait_start = std::chrono::steady_clock::now();
+    const bool started_immediately = CanStart(id);
+    const bool started = started_immediately || cv_.Wait(lock, [&] { return CanStart(id); });
+
+    waiters_.erase(std::find_if(waiters_.begin(), waiters_.end(), [id](const Waiter& waiter) {
+        return waiter.id == id;
+    }));
+
+    if (!started) {
+        // Lower priority updates may have waited for this one
+        cv_.NotifyAll();
+        throw engine::WaitInterruptedException(engine::current_task::CancellationReason());
+    }
+
+    ++running_updates_;
+    db_connections_in_use_ += db_connections;
+
+    auto& stats = caches_[name];
+    stats.updates += utils::statistics::Rate{1};
+    if (!started_immediately) {
+        stats.delayed_updates += utils::statistics::Rate{1};
+        const auto wait_time = std::chrono::steady_clock::now() - wait_start;
+        stats.wait_time_ms +=
+            utils::statistics::Rate{static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(wait_time).count()
+            )};
+    }
+
+    // Lower priority updates may fit into the remaining budgets
+    if (!waiters_.empty()) cv_.NotifyAll();
+
+    return Permit(*this, db_connections);
+}
+
+void UpdateScheduler::WriteStatistics(utils::statistics::Writer& writer) const {
+    const std::lock_guard lock(mutex_);
+
+    writer["running-updates"] = running_updates_;
+    writer["waiting-updates"] = waiters_.size();
+    writer["db-connections-in-use"] = db_connections_in_use_;
+
+    for (const auto& [name, stats] : caches_) {
+        writer.ValueWithLabels(stats, {"cache_name", name});
+    }
+}
+
+bool UpdateScheduler::HasPriority(const Waiter& lhs, const Waiter& rhs) noexcept {
+    if (lhs.staleness != rhs.staleness) return lhs.staleness > rhs.staleness;
+    return lhs.id < rhs.id;
+}
+
+bool UpdateScheduler::FitsDbBudget(std::size_t db_connections) const noexcept {
+    return settings_.max_db_connections == 0 ||
+           db_connections_in_use_ + db_connections <= settings_.max_db_connections;
+}
+
+bool UpdateScheduler::CanStart(std::uint64_t id) const {
+    if (settings_.max_concurrent_updates != 0 && running_updates_ >= settings_.max_concurrent_updates) {
+        return false;
+    }
+
+    const auto self = std::find_if(waiters_.begin(), waiters_.end(), [id](const Waiter& waiter) {
+        return waiter.id == id;
+    });
+    UASSERT(self != waiters_.end());
+    if (!FitsDbBudget(self->db_connections)) return false;
+
+    for (const auto& other : waiters_) {
+        if (other.id == id || !HasPriority(other, *self)) continue;
+
+        // A more stale cache that fits goes first. A more stale cache that
+        // does not fit reserves the database connections, so that it is not
+        // starved by the smaller updates.
+        if (FitsDbBudget(other.db_connections) || (self->db_connections != 0 && other.db_connections != 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void UpdateScheduler::Release(std::size_t db_connections) noexcept {
+    {
+        const std::lock_guard lock(mutex_);
+        UASSERT(running_updates_ != 0 && db_connections_in_use_ >= db_connections);
+        --running_updates_;
+        db_connections_in_use_ -= db_connections;
+    }
+    cv_.NotifyAll();
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/utils/statistics/rate.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+struct UpdateSchedulerCacheStatistics final {
+    utils::statistics::Rate updates;
+    utils::statistics::Rate delayed_updates;
+    utils::statistics::Rate wait_time_ms;
+    double update_phase{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const UpdateSchedulerCacheStatistics& stats);
+
+/// Admits cache updates within the global budgets, see
+/// components::CacheUpdateScheduler
+class UpdateScheduler final {
+public:
+    struct Settings final {
+        // 0 means no limit
+        std::size_t max_concurrent_updates{0};
+        // 0 means no limit
+        std::size_t max_db_connections{0};
+        bool spread_phases{true};
+    };
+
+    /// Holds a share of the budgets while an update is running
+    class Permit final {
+    public:
+        Permit() = default;
+        Permit(Permit&&) noexcept;
+        Permit& operator=(Permit&&) noexcept;
+        ~Permit();
+
+    private:
+        friend class UpdateScheduler;
+
+        Permit(UpdateScheduler& scheduler, std::size_t db_connections) noexcept;
+
+        UpdateScheduler* scheduler_{nullptr};
+        std::size_t db_connections_{0};
+    };
+
+    explicit UpdateScheduler(Settings settings);
+
+    UpdateScheduler(UpdateScheduler&&) = delete;
+    UpdateScheduler& operator=(UpdateScheduler&&) = delete;
+
+    /// @brief Registers a cache and returns the phase of its periodic updates
+    /// as a fraction of its update interval, in `[0, 1)`
+    /// @details The phases of the consecutively registered caches are spread
+    /// uniformly by the golden ratio sequence.
+    double RegisterCache(const std::string& name);
+
+    /// @brief Waits until the update of the cache fits into the budgets
+    /// @param staleness the time since the last update of the cache divided by
+    /// its update interval, the most stale caches are updated first
+    /// @param db_connections the number of database connections used by
+    /// the update, clamped to the budget
+    /// @throws engine::WaitInterruptedException on task cancellation
+    Permit Acquire(const std::string& name, double staleness, std::size_t db_connections);
+
+    void WriteStatistics(utils::statistics::Writer& writer) const;
+
+private:
+    struct Waiter final {
+        std::uint64_t id{0};
+        double staleness{0};
+        std::size_t db_connections{0};
+    };
+
+    static bool HasPriority(const Waiter& lhs, const Waiter& rhs) noexcept;
+
+    bool FitsDbBudget(std::size_t db_connections) const noexcept;
+
+    bool CanStart(std::uint64_t id) const;
+
+    void Release(std::size_t db_connections) noexcept;
+
+    const Settings settings_;
+
+    mutable engine::Mutex mutex_;
+    engine::ConditionVariable cv_;
+    std::vector<Waiter> waiters_;
+    std::uint64_t next_waiter_id_{0};
+    std::size_t running_updates_{0};
+    std::size_t db_connections_in_use_{0};
+    std::size_t registered_caches_{0};
+    std::unordered_map<std::string, UpdateSchedulerCacheStatistics> caches_;
+};
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,57 @@
+#include <userver/cache/update_scheduler.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <cache/update_scheduler.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+CacheUpdateScheduler::CacheUpdateScheduler(const ComponentConfig& config, const ComponentContext& context)
+    : ComponentBase(config, context),
+      scheduler_(std::make_unique<cache::impl::UpdateScheduler>(cache::impl::UpdateScheduler::Settings{
+          config["max-concurrent-updates"].As<std::size_t>(0),
+          config["max-db-connections"].As<std::size_t>(0),
+          config["spread-phases"].As<bool>(true),
+      })) {
+    statistics_holder_ = context.FindComponent<components::StatisticsStorage>().GetStorage().RegisterWriter(
+        "cache-update-scheduler",
+        [this](utils::statistics::Writer& writer) { scheduler_->WriteStatistics(writer); }
+    );
+}
+
+CacheUpdateScheduler::~CacheUpdateScheduler() { statistics_holder_.Unregister(); }
+
+cache::impl::UpdateScheduler& CacheUpdateScheduler::GetScheduler() noexcept { return *scheduler_; }
+
+yaml_config::Schema CacheUpdateScheduler::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<ComponentBase>(R"(
+type: object
+description: Component that coordinates the periodic updates of all the caches
+additionalProperties: false
+properties:
+    max-concurrent-updates:
+        type: integer
+        description: the maximum number of cache updates running at once, 0 for no limit
+        defaultDescription: 0
+        minimum: 0
+    max-db-connections:
+        type: integer
+        description: |
+            the maximum total update-db-connections of the running updates,
+            0 for no limit
+        defaultDescription: 0
+        minimum: 0
+    spread-phases:
+        type: boolean
+        description: whether to spread the phases of the periodic updates
+        defaultDescription: true
+)");
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,157 @@
+#include <cache/update_scheduler.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using cache::impl::UpdateScheduler;
+
+utils::statistics::Snapshot GetStatistics(const UpdateScheduler& scheduler) {
+    utils::statistics::Storage storage;
+    const auto holder = storage.RegisterWriter("scheduler", [&](utils::statistics::Writer& writer) {
+        scheduler.WriteStatistics(writer);
+    });
+    return utils::statistics::Snapshot{storage, "scheduler"};
+}
+
+// Yields until the scheduler reports the expected number of waiters
+void WaitForWaiters(const UpdateScheduler& scheduler, std::int64_t count) {
+    while (GetStatistics(scheduler).SingleMetric("waiting-updates").AsInt() != count) {
+        engine::Yield();
+    }
+}
+
+}  // namespace
+
+UTEST(CacheUpdateScheduler, SpreadPhases) {
+    UpdateScheduler scheduler{{}};
+
+    std::vector<double> phases;
+    for (int i = 0; i < 5; ++i) {
+        phases.push_back(scheduler.RegisterCache("cache-" + std::to_string(i)));
+    }
+
+    EXPECT_EQ(phases[0], 0);
+    for (std::size_t i = 1; i < phases.size(); ++i) {
+        EXPECT_GT(phases[i], 0);
+        EXPECT_LT(phases[i], 1);
+        for (std::size_t j = 0; j < i; ++j) {
+            EXPECT_GT(std::abs(phases[i] - phases[j]), 0.1);
+        }
+    }
+
+    UpdateScheduler no_spread{{0, 0, /*spread_phases=*/false}};
+    EXPECT_EQ(no_spread.RegisterCache("a"), 0);
+    EXPECT_EQ(no_spread.RegisterCache("b"), 0);
+}
+
+UTEST_MT(CacheUpdateScheduler, ConcurrencyLimit, 4) {
+    UpdateScheduler scheduler{{/*max_concurrent_updates=*/2}};
+    std::atomic<int> running{0};
+    std::atomic<int> max_running{0};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (int i = 0; i < 8; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&, i] {
+            const auto permit = scheduler.Acquire("cache-" + std::to_string(i), 1.0, 0);
+            const auto now_running = ++running;
+            int expected = max_running.load();
+            while (expected < now_running && !max_running.compare_exchange_weak(expected, now_running)) {
+            }
+            engine::SleepFor(std::chrono::milliseconds{1});
+            --running;
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    EXPECT_LE(max_running, 2);
+}
+
+UTEST(CacheUpdateScheduler, StalestFirst) {
+    UpdateScheduler scheduler{{/*max_concurrent_updates=*/1}};
+    auto permit = scheduler.Acquire("running", 1.0, 0);
+
+    engine::Mutex order_mutex;
+    std::vector<std::string> order;
+    const auto update = [&](std::string name, double staleness) {
+        return engine::AsyncNoSpan([&, name = std::move(name), staleness] {
+            const auto permit = scheduler.Acquire(name, staleness, 0);
+            const std::lock_guard lock(order_mutex);
+            order.push_back(name);
+        });
+    };
+
+    auto fresh = update("fresh", 1.5);
+    WaitForWaiters(scheduler, 1);
+    auto stale = update("stale", 10.0);
+    WaitForWaiters(scheduler, 2);
+
+    permit = {};
+    fresh.Get();
+    stale.Get();
+
+    EXPECT_EQ(order, (std::vector<std::string>{"stale", "fresh"}));
+
+    const auto statistics = GetStatistics(scheduler);
+    EXPECT_EQ(statistics.SingleMetric("updates", {{"cache_name", "stale"}}).AsRate(), utils::statistics::Rate{1});
+    EXPECT_EQ(
+        statistics.SingleMetric("delayed-updates", {{"cache_name", "stale"}}).AsRate(), utils::statistics::Rate{1}
+    );
+    EXPECT_EQ(
+        statistics.SingleMetric("delayed-updates", {{"cache_name", "running"}}).AsRate(), utils::statistics::Rate{0}
+    );
+    EXPECT_EQ(statistics.SingleMetric("running-updates").AsInt(), 0);
+}
+
+UTEST(CacheUpdateScheduler, DbConnectionsBudget) {
+    UpdateScheduler scheduler{{/*max_concurrent_updates=*/0, /*max_db_connections=*/3}};
+    auto db_permit = scheduler.Acquire("db", 1.0, 2);
+
+    // Needs more connections than available, waits
+    auto big = engine::AsyncNoSpan([&] { const auto permit = scheduler.Acquire("big", 5.0, 2); });
+    WaitForWaiters(scheduler, 1);
+
+    // Less stale and needs connections, waits for 'big'
+    auto small = engine::AsyncNoSpan([&] { const auto permit = scheduler.Acquire("small", 1.0, 1); });
+    WaitForWaiters(scheduler, 2);
+
+    // Does not need connections, runs right away
+    UEXPECT_NO_THROW(scheduler.Acquire("no-db", 1.0, 0));
+
+    // More than the budget, clamped to the budget
+    auto huge = engine::AsyncNoSpan([&] { const auto permit = scheduler.Acquire("huge", 1.0, 100); });
+    WaitForWaiters(scheduler, 3);
+
+    db_permit = {};
+    big.Get();
+    small.Get();
+    huge.Get();
+}
+
+UTEST(CacheUpdateScheduler, Cancellation) {
+    UpdateScheduler scheduler{{/*max_concurrent_updates=*/1}};
+    const auto permit = scheduler.Acquire("running", 1.0, 0);
+
+    auto waiting = engine::AsyncNoSpan([&] { const auto permit = scheduler.Acquire("waiting", 1.0, 0); });
+    WaitForWaiters(scheduler, 1);
+
+    waiting.RequestCancel();
+    UEXPECT_THROW(waiting.Get(), engine::WaitInterruptedException);
+    WaitForWaiters(scheduler, 0);
+}
+
+USERVER_NAMESPACE_END
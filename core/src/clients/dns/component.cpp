@@ -23,11 +23,13 @@ ResolverConfig ParseResolverConfig(const components::ComponentConfig& component_
     config.network_custom_servers =
         component_config["network-custom-servers"].As<std::vector<std::string>>(config.network_custom_servers);
     config.cache_ways = component_config["cache-ways"].As<size_t>(config.cache_ways);
-    config.cache_size_per_way = component_config["cache_size_per_way"].As<size_t>(config.cache_size_per_way);
+    config.cache_size_per_way = component_config["cache-size-per-way"].As<size_t>(config.cache_size_per_way);
     config.cache_max_reply_ttl =
-        component_config["cache_max_reply_ttl"].As<std::chrono::milliseconds>(config.cache_max_reply_ttl);
+        component_config["cache-max-reply-ttl"].As<std::chrono::milliseconds>(config.cache_max_reply_ttl);
     config.cache_failure_ttl =
-        component_config["cache_failure_ttl"].As<std::chrono::milliseconds>(config.cache_failure_ttl);
+        component_config["cache-failure-ttl"].As<std::chrono::milliseconds>(config.cache_failure_ttl);
+    config.cache_refresh_ahead =
+        component_config["cache-refresh-ahead"].As<std::chrono::milliseconds>(config.cache_refresh_ahead);
     return config;
 }
 
@@ -38,6 +40,9 @@ Component::Component(const components::ComponentConfig& config, const components
       resolver_{context.GetTaskProcessor(config["fs-task-processor"].As<std::string>()), ParseResolverConfig(config)} {
     auto& storage = context.FindComponent<components::StatisticsStorage>().GetStorage();
     statistics_holder_ = storage.RegisterWriter(config.Name() + ".replies", [this](auto& writer) { Write(writer); });
+    timings_statistics_holder_ = storage.RegisterWriter(config.Name() + ".network-lookup-timings", [this](auto& writer) {
+        writer = GetResolver().GetNetworkLookupTimings().GetView();
+    });
 }
 
 clients::dns::Resolver& Component::GetResolver() { return resolver_; }
@@ -100,6 +105,12 @@ properties:
         type: string
         description: TTL for network failures caching
         defaultDescription: 5s
+    cache-refresh-ahead:
+        type: string
+        description: |
+            cached replies are refreshed in background this long before their
+            TTL expires, network-timeout is used if greater
+        defaultDescription: 0s
 )");
 }
 
@@ -2,6 +2,7 @@
 
 #include <arpa/inet.h>
 #include <netinet/in.h>
+#include <algorithm>
 #include <cctype>
 #include <chrono>
 #include <string_view>
@@ -102,6 +103,9 @@ bool IsInDomain(std::string_view name, std::string_view domain) {
     return tld == domain;
 }
 
+// Milliseconds
+constexpr double kNetworkLookupTimingsBounds[] = {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000};
+
 const AddrVector& LocalhostAddrs() {
     static const AddrVector kLocalhostAddrs = {
         engine::io::Sockaddr::MakeLoopbackAddress(),
@@ -133,6 +137,7 @@ public:
     ~Impl();
 
     const LookupSourceCounters& GetLookupSourceCounters() const;
+    const utils::statistics::Histogram& GetNetworkLookupTimings() const;
 
     void ReloadHosts();
     void FlushNetworkCache();
@@ -143,6 +148,7 @@ public:
 
     auto GetUpdateMutex(const std::string& name);
     void AccountNetUpdateFailure();
+    void AccountNetworkLookupTiming(std::chrono::steady_clock::time_point start);
 
     template <typename Mutex>
     AddrVector
@@ -164,6 +170,7 @@ private:
         Mutex&& mutex,
         engine::Future<NetResolver::Response>&& future,
         const std::string& name,
+        std::chrono::steady_clock::time_point start,
         FailureMode failure_mode
     );
 
@@ -172,11 +179,13 @@ private:
         std::unique_lock<Mutex>& lock,
         engine::Future<NetResolver::Response>&& future,
         const std::string& name,
+        std::chrono::steady_clock::time_point start,
         AddrVector* addrs,
         FailureMode failure_mode
     );
 
     LookupSourceCounters source_counters_;
+    utils::statistics::Histogram network_lookup_timings_{kNetworkLookupTimingsBounds};
     FileResolver file_resolver_;
     NetResolver net_resolver_;
     const std::chrono::milliseconds net_cache_update_margin_;
@@ -190,7 +199,7 @@ private:
 Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor, const ResolverConfig& config)
     : file_resolver_{fs_task_processor, config.file_path, config.file_update_interval},
       net_resolver_{fs_task_processor, config.network_timeout, config.network_attempts, config.network_custom_servers},
-      net_cache_update_margin_{config.network_timeout},
+      net_cache_update_margin_{std::max(config.network_timeout, config.cache_refresh_ahead)},
       net_cache_max_reply_ttl_{config.cache_max_reply_ttl},
       net_cache_failure_ttl_{config.cache_failure_ttl},
       net_cache_{config.cache_ways, config.cache_size_per_way},
@@ -200,6 +209,8 @@ Resolver::Impl::~Impl() { wait_token_storage_.WaitForAllTokens(); }
 
 const Resolver::LookupSourceCounters& Resolver::Impl::GetLookupSourceCounters() const { return source_counters_; }
 
+const utils::statistics::Histogram& Resolver::Impl::GetNetworkLookupTimings() const { return network_lookup_timings_; }
+
 void Resolver::Impl::ReloadHosts() { file_resolver_.ReloadHosts(); }
 
 void Resolver::Impl::FlushNetworkCache() { net_cache_.Invalidate(); }
@@ -249,6 +260,12 @@ auto Resolver::Impl::GetUpdateMutex(const std::string& name) { return net_cache_
 
 void Resolver::Impl::AccountNetUpdateFailure() { ++source_counters_.network_failure; }
 
+void Resolver::Impl::AccountNetworkLookupTiming(std::chrono::steady_clock::time_point start) {
+    network_lookup_timings_.Account(
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count()
+    );
+}
+
 template <typename Mutex>
 AddrVector Resolver::Impl::DoForegroundQuery(
     std::unique_lock<Mutex>& lock,
@@ -260,11 +277,12 @@ AddrVector Resolver::Impl::DoForegroundQuery(
     UASSERT(lock.mutex() == &mutex);
 
     LOG_TRACE() << "Resolving '" << name << "' in foreground";
+    const auto start = std::chrono::steady_clock::now();
     auto future = net_resolver_.Resolve(name);
     auto future_status = future.wait_until(deadline);
     if (future_status != engine::FutureStatus::kReady) {
         LOG_TRACE() << "Sending query for '" << name << "' to background";
-        MoveQueryToBackground(lock, std::forward<Mutex>(mutex), std::move(future), name, FailureMode::kCache);
+        MoveQueryToBackground(lock, std::forward<Mutex>(mutex), std::move(future), name, start, FailureMode::kCache);
         // not updating counters here as the request lives on in the background
         if (future_status == engine::FutureStatus::kTimeout) {
             throw NotResolvedException{"Resolving '" + name + "' timed out"};
@@ -272,7 +290,7 @@ AddrVector Resolver::Impl::DoForegroundQuery(
         throw NotResolvedException{"Resolving '" + name + "' interrupted"};
     }
     AddrVector addrs;
-    FinishNetUpdate(lock, std::move(future), name, &addrs, FailureMode::kCache);
+    FinishNetUpdate(lock, std::move(future), name, start, &addrs, FailureMode::kCache);
     return addrs;
 }
 
@@ -284,8 +302,9 @@ void Resolver::Impl::StartBackgroundQuery(std::unique_lock<Mutex>& lock, Mutex&&
         return;
     }
     LOG_TRACE() << "Updating record for '" << name << "' in background";
+    const auto start = std::chrono::steady_clock::now();
     auto future = net_resolver_.Resolve(name);
-    MoveQueryToBackground(lock, std::forward<Mutex>(mutex), std::move(future), name, FailureMode::kIgnore);
+    MoveQueryToBackground(lock, std::forward<Mutex>(mutex), std::move(future), name, start, FailureMode::kIgnore);
 }
 
 template <typename Mutex>
@@ -294,14 +313,15 @@ void Resolver::Impl::MoveQueryToBackground(
     Mutex&& mutex,
     engine::Future<NetResolver::Response>&& future,
     const std::string& name,
+    std::chrono::steady_clock::time_point start,
     FailureMode failure_mode
 ) {
     UASSERT(lock);
     UASSERT(lock.mutex() == &mutex);
     engine::CriticalAsyncNoSpan(
-        [token = wait_token_storage_.GetToken(), this, name, failure_mode](auto&& mutex, auto&& future) {
+        [token = wait_token_storage_.GetToken(), this, name, start, failure_mode](auto&& mutex, auto&& future) {
             std::unique_lock lock{mutex, std::adopt_lock};
-            this->FinishNetUpdate(lock, std::forward<decltype(future)>(future), name, nullptr, failure_mode);
+            this->FinishNetUpdate(lock, std::forward<decltype(future)>(future), name, start, nullptr, failure_mode);
         },
         std::forward<Mutex>(mutex),
         std::move(future)
@@ -320,6 +340,7 @@ void Resolver::Impl::FinishNetUpdate(
     std::unique_lock<Mutex>& lock,
     engine::Future<NetResolver::Response>&& future,
     const std::string& name,
+    std::chrono::steady_clock::time_point start,
     AddrVector* addrs,
     FailureMode failure_mode
 ) {
@@ -327,7 +348,9 @@ void Resolver::Impl::FinishNetUpdate(
     NetResolver::Response response;
     try {
         response = future.get();
+        AccountNetworkLookupTiming(start);
     } catch (const ResolverException& ex) {
+        AccountNetworkLookupTiming(start);
         LOG_LIMITED_ERROR() << "Resolving of '" << name << "' failed: " << ex;
         if (failure_mode == FailureMode::kCache) {
             LOG_TRACE() << "Caching failure for '" << name << '\'';
@@ -421,6 +444,10 @@ const Resolver::LookupSourceCounters& Resolver::GetLookupSourceCounters() const
     return impl_->GetLookupSourceCounters();
 }
 
+const utils::statistics::Histogram& Resolver::GetNetworkLookupTimings() const {
+    return impl_->GetNetworkLookupTimings();
+}
+
 void Resolver::ReloadHosts() { impl_->ReloadHosts(); }
 
 void Resolver::FlushNetworkCache() { impl_->FlushNetworkCache(); }
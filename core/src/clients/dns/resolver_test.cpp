@@ -59,7 +59,11 @@ constexpr auto kNetV6String{"2a02:6b8:a::a"};
 struct MockedResolver {
     using ServerMock = utest::DnsServerMock;
 
-    MockedResolver(size_t cache_max_ttl, size_t cache_size_per_way)
+    MockedResolver(
+        size_t cache_max_ttl,
+        size_t cache_size_per_way,
+        std::chrono::milliseconds cache_refresh_ahead = std::chrono::milliseconds{0}
+    )
         : hosts_file{[] {
               auto file = fs::blocking::TempFile::Create();
               fs::blocking::RewriteFileContents(file.GetPath(), kTestHosts);
@@ -85,6 +89,7 @@ struct MockedResolver {
                        config.cache_max_reply_ttl = std::chrono::seconds{cache_max_ttl};
                        config.cache_failure_ttl = std::chrono::seconds{cache_max_ttl}, config.cache_ways = 1;
                        config.cache_size_per_way = cache_size_per_way;
+                       config.cache_refresh_ahead = cache_refresh_ahead;
                        config.network_custom_servers = {server_mock.GetServerAddress()};
                        return config;
                    }()} {}
@@ -349,6 +354,27 @@ UTEST(Resolver, CacheStale) {
     EXPECT_EQ(counters.network_failure, 0);
 }
 
+UTEST(Resolver, CacheRefreshAhead) {
+    const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    // every cache hit is within the refresh interval
+    MockedResolver resolver{1000, 1, std::chrono::seconds{2000}};
+
+    EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline), (Expected{kNetV6String, kNetV4String}));
+    EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline), (Expected{kNetV6String, kNetV4String}));
+
+    const auto& counters = resolver->GetLookupSourceCounters();
+    while (counters.network < 2 && !test_deadline.IsReached()) {
+        engine::SleepFor(std::chrono::milliseconds{10});
+    }
+
+    EXPECT_EQ(counters.cached, 1);
+    EXPECT_EQ(counters.cached_stale, 0);
+    EXPECT_EQ(counters.network, 2);
+    EXPECT_EQ(counters.network_failure, 0);
+    EXPECT_EQ(resolver->GetNetworkLookupTimings().GetView().GetTotalCount(), 2);
+}
+
 UTEST(Resolver, CacheFailures) {
     const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
 
@@ -15,6 +15,7 @@
 
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/request_coalescer.hpp>
 #include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <curl-ev/multi.hpp>
@@ -53,7 +54,14 @@ Client::Client(
       user_agent_(utils::GetUserverIdentifier()),
       connect_rate_limiter_(std::make_shared<curl::ConnectRateLimiter>()),
       tracing_manager_(GetTracingManager(settings)),
-      plugin_pipeline_(std::move(plugin_pipeline)) {
+      plugin_pipeline_(std::move(plugin_pipeline)),
+      concurrency_limiters_(
+          settings.concurrency_limiter
+              ? std::make_unique<congestion_control::ClientLimiters>(*settings.concurrency_limiter)
+              : nullptr
+      ),
+      request_coalescer_(std::make_unique<impl::RequestCoalescer>()),
+      http2_settings_(std::move(settings.http2)) {
     const auto io_threads = settings.io_threads;
     const auto& thread_name_prefix = settings.thread_name_prefix;
 
@@ -75,6 +83,14 @@ Client::Client(
         }
     }).Get();
 
+    if (http2_settings_) {
+        SetMultiplexingEnabled(true);
+        for (auto& multi : multis_) {
+            multi->SetMaxConcurrentStreams(ClampToLong(http2_settings_->max_concurrent_streams));
+        }
+        if (http2_settings_->max_host_connections) SetMaxHostConnections(http2_settings_->max_host_connections);
+    }
+
     easy_reinit_task_.Start("http_easy_reinit", utils::PeriodicTask::Settings(kEasyReinitPeriod), [this] {
         ReinitEasy();
     });
@@ -84,6 +100,7 @@ Client::Client(
 
 Client::~Client() {
     easy_reinit_task_.Stop();
+    request_coalescer_->CancelAndWait();
 
     // We have to destroy *this only when all the requests are finished, because
     // otherwise `multis_` and `thread_pool_` are destroyed and pending requests
@@ -160,6 +177,13 @@ Request Client::CreateRequest() {
     }
     request.SetDeadlinePropagationConfig(deadline_propagation_config_);
     request.SetCancellationPolicy(cancellation_policy_);
+    request.SetRequestCoalescer(*request_coalescer_);
+    if (concurrency_limiters_) {
+        request.SetConcurrencyLimiters(*concurrency_limiters_);
+    }
+    if (http2_settings_) {
+        request.SetHttp2Settings(*http2_settings_);
+    }
 
     return request;
 }
@@ -217,6 +241,10 @@ PoolStatistics Client::GetPoolStatistics() const {
     return stats;
 }
 
+const congestion_control::ClientLimiters* Client::GetConcurrencyLimiters() const {
+    return concurrency_limiters_.get();
+}
+
 void Client::SetDestinationMetricsAutoMaxSize(size_t max_size) { destination_statistics_->SetAutoMaxSize(max_size); }
 
 const DestinationStatistics& Client::GetDestinationStatistics() const { return *destination_statistics_; }
@@ -11,6 +11,7 @@
 #include <engine/task/task_processor.hpp>
 #include <userver/clients/dns/resolver.hpp>
 #include <userver/clients/http/connect_to.hpp>
+#include <userver/clients/http/streamed_json.hpp>
 #include <userver/clients/http/streamed_response.hpp>
 #include <userver/concurrent/queue.hpp>
 #include <userver/crypto/certificate.hpp>
@@ -19,10 +20,12 @@
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/fs/blocking/temp_file.hpp>
+#include <userver/formats/json/parser/parser.hpp>
 #include <userver/fs/blocking/write.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/http_version.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/tracing/manager.hpp>
 #include <userver/tracing/tracing.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/userver_info.hpp>
@@ -732,6 +735,150 @@ UTEST(HttpClient, CancelRetries) {
            "cancellation";
 }
 
+UTEST(HttpClient, Coalesce) {
+    constexpr std::size_t kRequestsCount = 5;
+    std::atomic<unsigned> server_requests{0};
+    auto callback = [&server_requests](const HttpRequest&) {
+        const auto request_number = ++server_requests;
+        engine::InterruptibleSleepFor(std::chrono::milliseconds{100});
+        const auto body = std::to_string(request_number);
+        return HttpResponse{
+            "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" +
+                body,
+            HttpResponse::kWriteAndClose};
+    };
+
+    const utest::SimpleServer http_server{callback};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    const auto make_request = [&] {
+        return http_client_ptr->CreateRequest()
+            .get(http_server.GetBaseUrl())
+            .retry(1)
+            .timeout(kTimeout)
+            .coalesce("GET /")
+            .async_perform();
+    };
+
+    std::vector<clients::http::ResponseFuture> futures;
+    for (std::size_t i = 0; i < kRequestsCount; ++i) futures.push_back(make_request());
+
+    std::vector<std::shared_ptr<clients::http::Response>> responses;
+    for (auto& future : futures) {
+        auto response = future.Get();
+        EXPECT_EQ(response->status_code(), 200);
+        EXPECT_EQ(response->body(), "1");
+        responses.push_back(std::move(response));
+    }
+    EXPECT_EQ(server_requests, 1);
+
+    // each waiter owns its response
+    responses.front()->sink_string() = "modified";
+    for (std::size_t i = 1; i < responses.size(); ++i) {
+        EXPECT_NE(responses[i], responses.front());
+        EXPECT_EQ(responses[i]->body(), "1");
+    }
+
+    // completed requests are not reused
+    EXPECT_EQ(make_request().Get()->body(), "2");
+    EXPECT_EQ(server_requests, 2);
+}
+
+UTEST(HttpClient, ConcurrencyLimit) {
+    const utest::SimpleServer http_server{[](const HttpRequest&) {
+        engine::InterruptibleSleepFor(std::chrono::milliseconds{100});
+        return HttpResponse{
+            "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 0\r\n\r\n", HttpResponse::kWriteAndClose};
+    }};
+
+    const tracing::GenericTracingManager tracing_manager{tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+    clients::http::ClientSettings settings;
+    settings.io_threads = 1;
+    settings.tracing_manager = &tracing_manager;
+    settings.concurrency_limiter.emplace();
+    settings.concurrency_limiter->initial_limit = 1;
+    clients::http::Client http_client{
+        std::move(settings),
+        engine::current_task::GetTaskProcessor(),
+        std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+    const auto make_request = [&] {
+        return http_client.CreateRequest().get(http_server.GetBaseUrl()).retry(1).timeout(kTimeout);
+    };
+
+    auto in_flight = make_request().async_perform();
+    // The request above holds the only slot of the destination limit
+    UEXPECT_THROW(make_request().perform(), clients::http::NetworkProblemException);
+    EXPECT_EQ(in_flight.Get()->status_code(), 200);
+
+    EXPECT_EQ(make_request().perform()->status_code(), 200);
+}
+
+UTEST(HttpClient, Http2Fallback) {
+    std::vector<std::string> requests;
+    const utest::SimpleServer http_server{[&requests](const HttpRequest& request) {
+        requests.push_back(request);
+        return HttpResponse{
+            "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 0\r\n\r\n", HttpResponse::kWriteAndClose};
+    }};
+
+    const tracing::GenericTracingManager tracing_manager{tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+    clients::http::ClientSettings settings;
+    settings.io_threads = 1;
+    settings.tracing_manager = &tracing_manager;
+    settings.http2.emplace();
+    settings.http2->destinations = {http_server.GetBaseUrl() + "/h2"};
+    clients::http::Client http_client{
+        std::move(settings),
+        engine::current_task::GetTaskProcessor(),
+        std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+    const auto perform = [&](const std::string& path) {
+        return http_client.CreateRequest().get(http_server.GetBaseUrl() + path).retry(1).timeout(kTimeout).perform();
+    };
+
+    // The HTTP/1.1 server ignores the upgrade
+    EXPECT_EQ(perform("/h2")->status_code(), 200);
+    EXPECT_EQ(perform("/other")->status_code(), 200);
+
+    ASSERT_EQ(requests.size(), 2);
+    EXPECT_NE(requests[0].find("Upgrade: h2c"), std::string::npos) << requests[0];
+    EXPECT_EQ(requests[1].find("Upgrade: h2c"), std::string::npos) << requests[1];
+}
+
+UTEST(HttpClient, StreamedJson) {
+    std::string body = "[";
+    constexpr std::int64_t kValuesCount = 10000;
+    for (std::int64_t i = 0; i < kValuesCount; ++i) {
+        if (i != 0) body += ',';
+        body += std::to_string(i);
+    }
+    body += "]";
+
+    const utest::SimpleServer http_server{[&body](const HttpRequest&) {
+        return HttpResponse{
+            "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" +
+                body,
+            HttpResponse::kWriteAndClose};
+    }};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    auto response = http_client_ptr->CreateRequest()
+                        .get(http_server.GetBaseUrl())
+                        .retry(1)
+                        .timeout(kTimeout)
+                        .async_perform_stream_body(concurrent::StringStreamQueue::Create());
+    ASSERT_EQ(response.StatusCode(), clients::http::Status::kOk);
+
+    formats::json::parser::Int64Parser int_parser;
+    formats::json::parser::ArrayParser<std::int64_t, formats::json::parser::Int64Parser> parser{int_parser};
+    const auto values =
+        clients::http::ParseStreamedJson(response, parser, engine::Deadline::FromDuration(utest::kMaxTestWaitTime));
+
+    ASSERT_EQ(values.size(), kValuesCount);
+    for (std::int64_t i = 0; i < kValuesCount; ++i) EXPECT_EQ(values[i], i);
+}
+
 UTEST(HttpClient, PostShutdownWithPendingRequest) {
     const utest::SimpleServer http_server{&sleep_callback};
     auto http_client_ptr = utest::CreateHttpClient();
@@ -156,6 +156,9 @@ void HttpClient::WriteStatistics(utils::statistics::Writer& writer) {
         DumpMetric(writer, http_client_.GetPoolStatistics());
     }
     DumpMetric(writer, http_client_.GetDestinationStatistics());
+    if (const auto* limiters = http_client_.GetConcurrencyLimiters()) {
+        writer["concurrency-limiter"] = *limiters;
+    }
 }
 
 yaml_config::Schema HttpClient::GetStaticConfigSchema() {
@@ -231,6 +234,82 @@ properties:
         enum:
           - cancel
           - ignore
+    concurrency-limiter:
+        type: object
+        description: |
+            Per-destination adaptive concurrency limit based on the latency
+            gradient. Requests above the limit fail immediately without
+            being sent. Disabled if not set.
+        additionalProperties: false
+        properties:
+            initial-limit:
+                type: integer
+                description: limit that is used before any latency is measured
+                defaultDescription: 20
+                minimum: 1
+            min-limit:
+                type: integer
+                description: the limit is never decreased below this value
+                defaultDescription: 1
+                minimum: 1
+            max-limit:
+                type: integer
+                description: the limit is never increased above this value
+                defaultDescription: 1000
+                minimum: 1
+            smoothing:
+                type: number
+                description: part of the new estimate applied to the limit on each request, (0, 1]
+                defaultDescription: 0.2
+            rtt-tolerance:
+                type: number
+                description: latency increase relative to the long-term latency that is not treated as queueing, >= 1
+                defaultDescription: 1.5
+            long-window:
+                type: integer
+                description: number of requests in the long-term latency moving average
+                defaultDescription: 600
+                minimum: 1
+            queue-size:
+                type: integer
+                description: number of requests allowed to queue at the destination
+                defaultDescription: 4
+                minimum: 0
+    http2:
+        type: object
+        description: |
+            Multiplexed HTTP/2 connections to the destinations. The version
+            set for a request explicitly takes precedence. Disabled if not set.
+        additionalProperties: false
+        properties:
+            destinations:
+                type: array
+                description: URL prefixes of the destinations that are talked HTTP/2 to, all the destinations if empty
+                defaultDescription: '[]'
+                items:
+                    type: string
+                    description: URL prefix, e.g. http://my-service.internal
+            max-concurrent-streams:
+                type: integer
+                description: maximal number of the concurrent streams of a connection
+                defaultDescription: 100
+                minimum: 1
+            max-host-connections:
+                type: integer
+                description: maximal number of connections to a single host, for all the destinations; unlimited if 0
+                defaultDescription: 0
+                minimum: 0
+            fallback:
+                type: string
+                description: |
+                    http1.1 - negotiate HTTP/2 with ALPN or Upgrade: h2c and
+                    talk HTTP/1.1 to the servers that refuse it;
+                    none - h2c with prior knowledge, requests to the servers
+                    without HTTP/2 support fail
+                defaultDescription: http1.1
+                enum:
+                  - http1.1
+                  - none
 )");
 }
 
@@ -1,5 +1,6 @@
 #include <userver/clients/http/config.hpp>
 
+#include <stdexcept>
 #include <string_view>
 
 #include <userver/dynamic_config/value.hpp>
@@ -47,11 +48,33 @@ CancellationPolicy Parse(yaml_config::YamlConfig value, formats::parse::To<Cance
     throw std::runtime_error("Invalid CancellationPolicy value: " + str);
 }
 
+Http2Fallback Parse(yaml_config::YamlConfig value, formats::parse::To<Http2Fallback>) {
+    auto str = value.As<std::string>();
+    if (str == "http1.1") return Http2Fallback::kHttp11;
+    if (str == "none") return Http2Fallback::kNone;
+    throw std::runtime_error("Invalid Http2Fallback value: " + str);
+}
+
+Http2Settings Parse(const yaml_config::YamlConfig& value, formats::parse::To<Http2Settings>) {
+    Http2Settings result;
+    result.destinations = value["destinations"].As<std::vector<std::string>>(result.destinations);
+    result.max_concurrent_streams = value["max-concurrent-streams"].As<std::size_t>(result.max_concurrent_streams);
+    result.max_host_connections = value["max-host-connections"].As<std::size_t>(result.max_host_connections);
+    result.fallback = value["fallback"].As<Http2Fallback>(result.fallback);
+    if (result.max_concurrent_streams == 0) {
+        throw std::runtime_error("Invalid max-concurrent-streams in '" + value.GetPath() + "': 0");
+    }
+    return result;
+}
+
 ClientSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientSettings>) {
     ClientSettings result;
     result.thread_name_prefix = value["thread-name-prefix"].As<std::string>(result.thread_name_prefix);
     result.io_threads = value["threads"].As<size_t>(result.io_threads);
     result.deadline_propagation = ParseDeadlinePropagationConfig(value);
+    result.concurrency_limiter =
+        value["concurrency-limiter"].As<std::optional<congestion_control::ClientLimiterConfig>>();
+    result.http2 = value["http2"].As<std::optional<Http2Settings>>();
     return result;
 }
 
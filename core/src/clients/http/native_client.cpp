@@ -0,0 +1,619 @@
+#include <userver/clients/http/native_client.hpp>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include <algorithm>
+#include <charconv>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+#include <llhttp.h>
+
+#include <userver/clients/dns/resolver.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/io/tls_session.hpp>
+#include <userver/engine/io/tls_wrapper.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/net/blocking/get_addr_info.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+constexpr std::string_view kHttpScheme = "http://";
+constexpr std::string_view kHttpsScheme = "https://";
+constexpr std::size_t kReadBufferSize = 16 * 1024;
+
+struct Target final {
+    bool is_tls{false};
+    std::string host;
+    std::uint16_t port{0};
+    // origin-form of the request target, i.e. path and query
+    std::string request_target;
+    std::string host_header;
+    std::string pool_key;
+};
+
+[[noreturn]] void ThrowBadUrl(std::string_view url, std::string_view reason, const LocalStats& stats) {
+    throw BadArgumentException(std::make_error_code(std::errc::invalid_argument), reason, url, stats);
+}
+
+Target ParseTarget(std::string_view url, const LocalStats& stats) {
+    Target target;
+    std::string_view rest = url;
+    if (utils::text::StartsWith(rest, kHttpScheme)) {
+        rest.remove_prefix(kHttpScheme.size());
+        target.port = 80;
+    } else if (utils::text::StartsWith(rest, kHttpsScheme)) {
+        rest.remove_prefix(kHttpsScheme.size());
+        target.is_tls = true;
+        target.port = 443;
+    } else {
+        ThrowBadUrl(url, "Unsupported URL scheme", stats);
+    }
+
+    const auto path_pos = rest.find_first_of("/?#");
+    const auto authority = rest.substr(0, path_pos);
+    if (authority.empty() || authority.find('@') != std::string_view::npos) {
+        ThrowBadUrl(url, "Unsupported URL authority", stats);
+    }
+
+    std::string_view request_target = path_pos == std::string_view::npos ? "" : rest.substr(path_pos);
+    request_target = request_target.substr(0, request_target.find('#'));
+    if (request_target.empty() || request_target.front() != '/') target.request_target = "/";
+    target.request_target.append(request_target);
+
+    std::string_view host = authority;
+    std::string_view port;
+    if (authority.front() == '[') {
+        const auto bracket_pos = authority.find(']');
+        if (bracket_pos == std::string_view::npos) ThrowBadUrl(url, "Malformed IPv6 address", stats);
+        host = authority.substr(1, bracket_pos - 1);
+        const auto after_host = authority.substr(bracket_pos + 1);
+        if (!after_host.empty()) {
+            if (after_host.front() != ':') ThrowBadUrl(url, "Malformed URL authority", stats);
+            port = after_host.substr(1);
+        }
+    } else if (const auto colon_pos = authority.rfind(':'); colon_pos != std::string_view::npos) {
+        host = authority.substr(0, colon_pos);
+        port = authority.substr(colon_pos + 1);
+    }
+
+    if (!port.empty()) {
+        const auto [ptr, ec] = std::from_chars(port.data(), port.data() + port.size(), target.port);
+        if (ec != std::errc{} || ptr != port.data() + port.size() || target.port == 0) {
+            ThrowBadUrl(url, "Invalid port", stats);
+        }
+    }
+    if (host.empty()) ThrowBadUrl(url, "Empty host", stats);
+
+    target.host = std::string{host};
+    target.host_header = std::string{authority};
+    target.pool_key = fmt::format("{}{}", target.is_tls ? kHttpsScheme : kHttpScheme, authority);
+    return target;
+}
+
+bool IsBodyExpected(HttpMethod method) {
+    return method == HttpMethod::kPost || method == HttpMethod::kPut || method == HttpMethod::kPatch;
+}
+
+// Early data may be replayed, so only the requests without side effects go
+bool IsEarlyDataAllowed(HttpMethod method) { return method == HttpMethod::kGet || method == HttpMethod::kHead; }
+
+// Collects an HTTP/1.1 response into clients::http::Response
+class ResponseParser final {
+public:
+    ResponseParser(Response& response, bool is_head_request, std::size_t max_size)
+        : response_(response), is_head_request_(is_head_request), max_size_(max_size) {
+        llhttp_init(&parser_, HTTP_RESPONSE, &kSettings);
+        parser_.data = this;
+    }
+
+    // Returns true once the whole response is parsed
+    bool Feed(std::string_view data) {
+        const auto err = llhttp_execute(&parser_, data.data(), data.size());
+        if (err == HPE_PAUSED) return true;
+        CheckError(err);
+        return false;
+    }
+
+    // Returns true if the response is complete after the peer closed the
+    // connection, i.e. the body was delimited by the connection close
+    bool FeedEof() {
+        const auto err = llhttp_finish(&parser_);
+        if (err == HPE_PAUSED) return true;
+        CheckError(err);
+        return is_complete_;
+    }
+
+    bool IsKeepAlive() const { return is_complete_ && llhttp_should_keep_alive(&parser_); }
+
+private:
+    void CheckError(llhttp_errno_t err) const {
+        if (err == HPE_OK) return;
+        if (err == HPE_USER) {
+            throw TechnicalError(
+                std::make_error_code(std::errc::message_size), "Response is too large", "", LocalStats{}
+            );
+        }
+        throw TechnicalError(
+            std::make_error_code(std::errc::protocol_error),
+            fmt::format("Malformed response: {}", llhttp_get_error_reason(&parser_)),
+            "",
+            LocalStats{}
+        );
+    }
+
+    static ResponseParser& Self(llhttp_t* parser) {
+        UASSERT(parser->data);
+        return *static_cast<ResponseParser*>(parser->data);
+    }
+
+    bool Account(std::size_t size) {
+        size_ += size;
+        return size_ <= max_size_;
+    }
+
+    void FlushHeader() {
+        if (header_field_.empty()) return;
+        response_.headers().InsertOrAppend(std::move(header_field_), std::move(header_value_));
+        header_field_.clear();
+        header_value_.clear();
+    }
+
+    static int OnHeaderField(llhttp_t* parser, const char* data, std::size_t size) {
+        auto& self = Self(parser);
+        if (!self.Account(size)) return -1;
+        if (self.is_header_value_) {
+            self.FlushHeader();
+            self.is_header_value_ = false;
+        }
+        self.header_field_.append(data, size);
+        return 0;
+    }
+
+    static int OnHeaderValue(llhttp_t* parser, const char* data, std::size_t size) {
+        auto& self = Self(parser);
+        if (!self.Account(size)) return -1;
+        self.is_header_value_ = true;
+        self.header_value_.append(data, size);
+        return 0;
+    }
+
+    static int OnHeadersComplete(llhttp_t* parser) {
+        auto& self = Self(parser);
+        self.FlushHeader();
+        self.is_header_value_ = false;
+        self.response_.SetStatusCode(static_cast<Status>(parser->status_code));
+        // 1 tells llhttp that there is no body
+        return self.is_head_request_ ? 1 : 0;
+    }
+
+    static int OnBody(llhttp_t* parser, const char* data, std::size_t size) {
+        auto& self = Self(parser);
+        if (!self.Account(size)) return -1;
+        self.response_.sink_string().append(data, size);
+        return 0;
+    }
+
+    static int OnMessageComplete(llhttp_t* parser) {
+        auto& self = Self(parser);
+        if (parser->status_code >= 100 && parser->status_code < 200) {
+            // informational response, the final one follows
+            self.response_.headers().clear();
+            return 0;
+        }
+        self.is_complete_ = true;
+        // do not parse anything that follows the response
+        return HPE_PAUSED;
+    }
+
+    static const llhttp_settings_t kSettings;
+
+    Response& response_;
+    const bool is_head_request_;
+    const std::size_t max_size_;
+
+    llhttp_t parser_{};
+    std::size_t size_{0};
+    std::string header_field_;
+    std::string header_value_;
+    bool is_header_value_{false};
+    bool is_complete_{false};
+};
+
+const llhttp_settings_t ResponseParser::kSettings = []() {
+    llhttp_settings_t settings{};
+    llhttp_settings_init(&settings);
+    settings.on_header_field = &ResponseParser::OnHeaderField;
+    settings.on_header_value = &ResponseParser::OnHeaderValue;
+    settings.on_headers_complete = &ResponseParser::OnHeadersComplete;
+    settings.on_body = &ResponseParser::OnBody;
+    settings.on_message_complete = &ResponseParser::OnMessageComplete;
+    return settings;
+}();
+
+// The request failed on a reused keep-alive connection before any byte of the
+// response was received, most probably the server has closed it already
+class StaleConnectionError final : public std::exception {};
+
+}  // namespace
+
+struct NativeRequest::ClientImpl final {
+    struct IdleConnection final {
+        std::unique_ptr<engine::io::RwBase> socket;
+        std::chrono::steady_clock::time_point idle_since;
+    };
+
+    explicit ClientImpl(NativeClientSettings settings) : settings(settings) {}
+
+    struct Destination final {
+        std::vector<IdleConnection> idle;
+        NativeClientStatistics stats;
+    };
+
+    std::unique_ptr<engine::io::RwBase> TryTakeIdle(const std::string& pool_key) {
+        const auto now = std::chrono::steady_clock::now();
+        std::unique_ptr<engine::io::RwBase> result;
+        {
+            const std::lock_guard lock{mutex};
+            auto& destination = destinations[pool_key];
+
+            auto& connections = destination.idle;
+            // the most recently used connection is the least likely to be closed
+            while (!connections.empty() && !result) {
+                auto connection = std::move(connections.back());
+                connections.pop_back();
+                if (now - connection.idle_since < settings.idle_timeout) result = std::move(connection.socket);
+            }
+            ++(result ? destination.stats.pool_hits : destination.stats.pool_misses);
+        }
+        return result;
+    }
+
+    void ReturnIdle(const std::string& pool_key, std::unique_ptr<engine::io::RwBase> socket) {
+        const std::lock_guard lock{mutex};
+        auto& connections = destinations[pool_key].idle;
+        if (connections.size() >= settings.max_idle_connections_per_host) {
+            connections.erase(connections.begin());
+        }
+        connections.push_back({std::move(socket), std::chrono::steady_clock::now()});
+    }
+
+    void AccountStale(const std::string& pool_key) {
+        const std::lock_guard lock{mutex};
+        ++destinations[pool_key].stats.stale_connections;
+    }
+
+    void AccountWarmedUp(const std::string& pool_key, std::size_t connections) {
+        const std::lock_guard lock{mutex};
+        destinations[pool_key].stats.warmed_up_connections += connections;
+    }
+
+    std::size_t GetIdleCount(const std::string& pool_key) {
+        const std::lock_guard lock{mutex};
+        const auto it = destinations.find(pool_key);
+        return it == destinations.end() ? 0 : it->second.idle.size();
+    }
+
+    std::vector<engine::io::Sockaddr> Resolve(const Target& target, engine::Deadline deadline) {
+        if (settings.resolver) {
+            auto addrs = settings.resolver->Resolve(target.host, deadline);
+            for (auto& addr : addrs) addr.SetPort(target.port);
+            return {addrs.begin(), addrs.end()};
+        }
+
+        const auto port = std::to_string(target.port);
+        if (!settings.fs_task_processor) return net::blocking::GetAddrInfo(target.host, port.c_str());
+        return engine::AsyncNoSpan(*settings.fs_task_processor, [&target, &port] {
+                   return net::blocking::GetAddrInfo(target.host, port.c_str());
+               }).Get();
+    }
+
+    // Sends the `early_data` during the TLS handshake if possible,
+    // `is_early_data_accepted` is set if it must not be sent again
+    std::unique_ptr<engine::io::RwBase> Connect(
+        const Target& target,
+        engine::Deadline deadline,
+        LocalStats& stats,
+        std::string_view early_data = {},
+        bool* is_early_data_accepted = nullptr
+    ) {
+        const auto start = std::chrono::steady_clock::now();
+        const auto addrs = Resolve(target, deadline);
+
+        std::exception_ptr last_error;
+        for (const auto& addr : addrs) {
+            try {
+                engine::io::Socket socket{addr.Domain(), engine::io::SocketType::kStream};
+                ++stats.open_socket_count;
+                socket.SetOption(IPPROTO_TCP, TCP_NODELAY, 1);
+                if (const auto interval = settings.keepalive_probe_interval.count(); interval > 0) {
+                    socket.SetOption(SOL_SOCKET, SO_KEEPALIVE, 1);
+                    socket.SetOption(IPPROTO_TCP, TCP_KEEPIDLE, interval);
+                    socket.SetOption(IPPROTO_TCP, TCP_KEEPINTVL, interval);
+                }
+                socket.Connect(addr, deadline);
+                stats.time_to_connect = std::chrono::steady_clock::now() - start;
+
+                if (!target.is_tls) return std::make_unique<engine::io::Socket>(std::move(socket));
+                if (!settings.tls_session_resumption) {
+                    return std::make_unique<engine::io::TlsWrapper>(
+                        engine::io::TlsWrapper::StartTlsClient(std::move(socket), target.host, deadline)
+                    );
+                }
+
+                auto tls = engine::io::TlsWrapper::StartTlsClient(
+                    std::move(socket), target.host, tls_sessions, deadline, early_data
+                );
+                if (is_early_data_accepted) *is_early_data_accepted = tls.IsEarlyDataAccepted();
+                return std::make_unique<engine::io::TlsWrapper>(std::move(tls));
+            } catch (const engine::io::IoInterrupted&) {
+                throw;
+            } catch (const std::exception& ex) {
+                LOG_DEBUG() << "Failed to connect to " << addr << ": " << ex;
+                last_error = std::current_exception();
+            }
+        }
+
+        if (last_error) std::rethrow_exception(last_error);
+        throw DNSProblemException(
+            std::make_error_code(std::errc::host_unreachable), "Host is not resolved", target.host, stats
+        );
+    }
+
+    const NativeClientSettings settings;
+    engine::io::TlsClientSessionCache tls_sessions;
+
+    engine::Mutex mutex;
+    std::unordered_map<std::string, Destination> destinations;
+};
+
+NativeRequest::NativeRequest(ClientImpl& client) : client_(client) {}
+
+NativeRequest& NativeRequest::method(HttpMethod method) {
+    method_ = method;
+    return *this;
+}
+
+NativeRequest& NativeRequest::get(const std::string& url) { return method(HttpMethod::kGet).url(url); }
+
+NativeRequest& NativeRequest::head(const std::string& url) { return method(HttpMethod::kHead).url(url); }
+
+NativeRequest& NativeRequest::post(const std::string& url, std::string data) {
+    return method(HttpMethod::kPost).url(url).data(std::move(data));
+}
+
+NativeRequest& NativeRequest::put(const std::string& url, std::string data) {
+    return method(HttpMethod::kPut).url(url).data(std::move(data));
+}
+
+NativeRequest& NativeRequest::patch(const std::string& url, std::string data) {
+    return method(HttpMethod::kPatch).url(url).data(std::move(data));
+}
+
+NativeRequest& NativeRequest::delete_method(const std::string& url) { return method(HttpMethod::kDelete).url(url); }
+
+NativeRequest& NativeRequest::url(const std::string& url) {
+    url_ = url;
+    return *this;
+}
+
+NativeRequest& NativeRequest::data(std::string data) {
+    data_ = std::move(data);
+    return *this;
+}
+
+NativeRequest& NativeRequest::headers(const Headers& headers) {
+    for (const auto& [name, value] : headers) headers_.insert_or_assign(name, value);
+    return *this;
+}
+
+NativeRequest& NativeRequest::headers(
+    const std::initializer_list<std::pair<std::string_view, std::string_view>>& headers
+) {
+    for (const auto& [name, value] : headers) headers_.insert_or_assign(std::string{name}, std::string{value});
+    return *this;
+}
+
+NativeRequest& NativeRequest::timeout(long timeout_ms) {
+    timeout_ = std::chrono::milliseconds{timeout_ms};
+    return *this;
+}
+
+NativeRequest& NativeRequest::retry(short retries, bool on_fails) {
+    UINVARIANT(retries >= 1, "Retries count must be positive");
+    retries_ = retries;
+    retry_on_fails_ = on_fails;
+    return *this;
+}
+
+std::shared_ptr<Response> NativeRequest::perform() {
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = engine::Deadline::FromDuration(timeout_);
+    LocalStats stats;
+    const auto target = ParseTarget(url_, stats);
+
+    std::string head;
+    head.append(ToStringView(method_)).append(" ").append(target.request_target).append(" HTTP/1.1\r\n");
+    if (headers_.find(USERVER_NAMESPACE::http::headers::kHost) == headers_.end()) {
+        head.append("Host: ").append(target.host_header).append("\r\n");
+    }
+    for (const auto& [name, value] : headers_) {
+        head.append(name).append(": ").append(value).append("\r\n");
+    }
+    if ((!data_.empty() || IsBodyExpected(method_)) &&
+        headers_.find(USERVER_NAMESPACE::http::headers::kContentLength) == headers_.end()) {
+        head.append("Content-Length: ").append(std::to_string(data_.size())).append("\r\n");
+    }
+    head.append("\r\n");
+
+    std::array<char, kReadBufferSize> buffer{};
+    for (short attempt = 0;; ++attempt) {
+        stats.retries_count = attempt;
+        auto response = std::make_shared<Response>();
+        std::unique_ptr<engine::io::RwBase> socket;
+        try {
+            socket = client_.TryTakeIdle(target.pool_key);
+            const bool is_reused = !!socket;
+            bool is_sent = false;
+            if (!socket) {
+                const bool use_early_data =
+                    client_.settings.tls_early_data && IsEarlyDataAllowed(method_) && data_.empty();
+                socket = client_.Connect(
+                    target, deadline, stats, use_early_data ? std::string_view{head} : std::string_view{}, &is_sent
+                );
+            }
+
+            // the early data has no body
+            auto sent = head.size();
+            if (!is_sent) sent = socket->WriteAll({{head.data(), head.size()}, {data_.data(), data_.size()}}, deadline);
+            if (sent != head.size() + data_.size()) {
+                if (is_reused) throw StaleConnectionError{};
+                throw engine::io::IoSystemError(
+                    std::make_error_code(std::errc::connection_reset), "Connection closed while sending the request"
+                );
+            }
+
+            ResponseParser parser{*response, method_ == HttpMethod::kHead, client_.settings.max_response_size};
+            bool is_received = false;
+            bool is_complete = false;
+            while (!is_complete) {
+                const auto len = socket->ReadSome(buffer.data(), buffer.size(), deadline);
+                if (len == 0) {
+                    if (!is_received && is_reused) throw StaleConnectionError{};
+                    is_complete = parser.FeedEof();
+                    if (!is_complete) {
+                        throw engine::io::IoSystemError(
+                            std::make_error_code(std::errc::connection_reset),
+                            "Connection closed before the response was received"
+                        );
+                    }
+                    break;
+                }
+                is_received = true;
+                is_complete = parser.Feed({buffer.data(), len});
+            }
+
+            if (parser.IsKeepAlive()) client_.ReturnIdle(target.pool_key, std::move(socket));
+
+            stats.time_to_process = std::chrono::steady_clock::now() - start;
+            response->SetStats(stats);
+            return response;
+        } catch (const StaleConnectionError&) {
+            // does not count as an attempt
+            --attempt;
+            client_.AccountStale(target.pool_key);
+        } catch (const engine::io::IoTimeout&) {
+            stats.time_to_process = std::chrono::steady_clock::now() - start;
+            throw TimeoutException(fmt::format("Timeout while performing request to {}", url_), stats);
+        } catch (const engine::io::IoCancelled&) {
+            stats.time_to_process = std::chrono::steady_clock::now() - start;
+            throw CancelException(fmt::format("Request to {} was cancelled", url_), stats, ErrorKind::kCancel);
+        } catch (const engine::io::IoException& ex) {
+            stats.time_to_process = std::chrono::steady_clock::now() - start;
+            const auto* system_error = dynamic_cast<const engine::io::IoSystemError*>(&ex);
+            const auto code =
+                system_error ? system_error->Code() : std::make_error_code(std::errc::connection_aborted);
+            if (!retry_on_fails_ || attempt + 1 >= retries_ || deadline.IsReached()) {
+                throw NetworkProblemException(code, ex.what(), url_, stats);
+            }
+            LOG_INFO() << "Retrying request to " << url_ << " after a network error: " << ex;
+        }
+    }
+}
+
+NativeClient::NativeClient(NativeClientSettings settings)
+    : impl_(std::make_unique<NativeRequest::ClientImpl>(settings)) {}
+
+NativeClient::~NativeClient() = default;
+
+NativeRequest NativeClient::CreateRequest() { return NativeRequest{*impl_}; }
+
+std::size_t NativeClient::Warmup(const std::string& url, std::size_t connections, engine::Deadline deadline) {
+    const auto target = ParseTarget(url, LocalStats{});
+    connections = std::min(connections, impl_->settings.max_idle_connections_per_host);
+    const auto idle_count = impl_->GetIdleCount(target.pool_key);
+    if (idle_count >= connections) return 0;
+
+    std::vector<engine::TaskWithResult<std::unique_ptr<engine::io::RwBase>>> tasks;
+    tasks.reserve(connections - idle_count);
+    for (std::size_t i = idle_count; i < connections; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([this, &target, deadline] {
+            LocalStats stats;
+            return impl_->Connect(target, deadline, stats);
+        }));
+    }
+
+    std::size_t established = 0;
+    for (auto& task : tasks) {
+        try {
+            impl_->ReturnIdle(target.pool_key, task.Get());
+            ++established;
+        } catch (const std::exception& ex) {
+            LOG_WARNING() << "Failed to warm up a connection to " << target.pool_key << ": " << ex;
+        }
+    }
+    impl_->AccountWarmedUp(target.pool_key, established);
+    return established;
+}
+
+void NativeClient::ResetConnections() {
+    const std::lock_guard lock{impl_->mutex};
+    for (auto& [pool_key, destination] : impl_->destinations) destination.idle.clear();
+}
+
+NativeClientStatistics NativeClient::GetDestinationStatistics(const std::string& url) const {
+    const auto target = ParseTarget(url, LocalStats{});
+    const std::lock_guard lock{impl_->mutex};
+    const auto it = impl_->destinations.find(target.pool_key);
+    if (it == impl_->destinations.end()) return {};
+
+    auto stats = it->second.stats;
+    stats.idle_connections = it->second.idle.size();
+    return stats;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const NativeClient& client) {
+    std::vector<std::pair<std::string, NativeClientStatistics>> snapshot;
+    {
+        const std::lock_guard lock{client.impl_->mutex};
+        snapshot.reserve(client.impl_->destinations.size());
+        for (const auto& [pool_key, destination] : client.impl_->destinations) {
+            auto& [key, stats] = snapshot.emplace_back(pool_key, destination.stats);
+            stats.idle_connections = destination.idle.size();
+        }
+    }
+
+    for (const auto& [pool_key, stats] : snapshot) {
+        writer.ValueWithLabels(stats, {"http_destination", pool_key});
+    }
+    writer["tls"] = client.impl_->tls_sessions.GetStatistics();
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const NativeClientStatistics& stats) {
+    writer["pool"]["hits"] = stats.pool_hits;
+    writer["pool"]["misses"] = stats.pool_misses;
+    writer["pool"]["stale"] = stats.stale_connections;
+    writer["pool"]["idle"] = stats.idle_connections;
+    writer["warmed-up"] = stats.warmed_up_connections;
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
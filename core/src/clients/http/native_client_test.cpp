@@ -0,0 +1,102 @@
+#include <userver/clients/http/native_client.hpp>
+
+#include <userver/http/predefined_header.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+constexpr USERVER_NAMESPACE::http::headers::PredefinedHeader kTestHeader{"X-Test"};
+
+HttpResponse EchoKeepAliveCallback(const HttpRequest& request) {
+    const auto headers_end = request.find("\r\n\r\n");
+    if (headers_end == std::string::npos) return {{}, HttpResponse::kTryReadMore};
+
+    const auto length_pos = request.find("Content-Length: ");
+    std::size_t length = 0;
+    if (length_pos != std::string::npos && length_pos < headers_end) {
+        length = std::stoul(request.substr(length_pos + 16));
+    }
+    if (request.size() < headers_end + 4 + length) return {{}, HttpResponse::kTryReadMore};
+
+    const auto payload = request.substr(headers_end + 4, length);
+    return {
+        "HTTP/1.1 200 OK\r\nX-Test: a\r\nX-Test: b\r\nContent-Length: " + std::to_string(payload.size()) +
+            "\r\n\r\n" + payload,
+        HttpResponse::kWriteAndContinue};
+}
+
+HttpResponse CloseDelimitedCallback(const HttpRequest& request) {
+    if (request.find("\r\n\r\n") == std::string::npos) return {{}, HttpResponse::kTryReadMore};
+    return {"HTTP/1.1 100 Continue\r\n\r\nHTTP/1.1 404 Not Found\r\nConnection: close\r\n\r\nnot found",
+            HttpResponse::kWriteAndClose};
+}
+
+}  // namespace
+
+UTEST(NativeHttpClient, KeepAlive) {
+    const utest::SimpleServer http_server{&EchoKeepAliveCallback};
+    clients::http::NativeClient client;
+
+    for (int i = 0; i < 3; ++i) {
+        const auto data = "request #" + std::to_string(i);
+        const auto response = client.CreateRequest().post(http_server.GetBaseUrl() + "/echo?a=b", data).perform();
+        EXPECT_EQ(response->status_code(), clients::http::Status::kOk);
+        EXPECT_EQ(response->body(), data);
+        EXPECT_EQ(response->headers()[kTestHeader], "a,b");
+    }
+    EXPECT_EQ(http_server.GetConnectionsOpenedCount(), 1);
+
+    client.ResetConnections();
+    const auto response = client.CreateRequest().get(http_server.GetBaseUrl()).perform();
+    EXPECT_EQ(response->status_code(), clients::http::Status::kOk);
+    EXPECT_EQ(http_server.GetConnectionsOpenedCount(), 2);
+}
+
+UTEST(NativeHttpClient, Warmup) {
+    const utest::SimpleServer http_server{&EchoKeepAliveCallback};
+    clients::http::NativeClient client;
+    const auto url = http_server.GetBaseUrl();
+    const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    EXPECT_EQ(client.Warmup(url, 3, deadline), 3);
+    EXPECT_EQ(client.Warmup(url, 3, deadline), 0);
+
+    for (int i = 0; i < 3; ++i) {
+        const auto response = client.CreateRequest().get(url).perform();
+        EXPECT_EQ(response->status_code(), clients::http::Status::kOk);
+    }
+    EXPECT_EQ(http_server.GetConnectionsOpenedCount(), 3);
+
+    const auto stats = client.GetDestinationStatistics(url + "/some/path");
+    EXPECT_EQ(stats.pool_hits, 3);
+    EXPECT_EQ(stats.pool_misses, 0);
+    EXPECT_EQ(stats.warmed_up_connections, 3);
+    EXPECT_EQ(stats.idle_connections, 3);
+}
+
+UTEST(NativeHttpClient, CloseDelimitedBody) {
+    const utest::SimpleServer http_server{&CloseDelimitedCallback};
+    clients::http::NativeClient client;
+
+    for (int i = 0; i < 2; ++i) {
+        const auto response = client.CreateRequest().get(http_server.GetBaseUrl() + "/missing").perform();
+        EXPECT_EQ(response->status_code(), clients::http::Status::kNotFound);
+        EXPECT_EQ(response->body(), "not found");
+    }
+    EXPECT_EQ(http_server.GetConnectionsOpenedCount(), 2);
+}
+
+UTEST(NativeHttpClient, BadUrl) {
+    clients::http::NativeClient client;
+    UEXPECT_THROW(client.CreateRequest().get("ftp://localhost/").perform(), clients::http::BadArgumentException);
+    UEXPECT_THROW(client.CreateRequest().get("http://localhost:0/").perform(), clients::http::BadArgumentException);
+    UEXPECT_THROW(client.CreateRequest().get("http://[::1/").perform(), clients::http::BadArgumentException);
+}
+
+USERVER_NAMESPACE_END
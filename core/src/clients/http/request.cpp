@@ -24,6 +24,7 @@
 
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/request_coalescer.hpp>
 #include <clients/http/request_state.hpp>
 #include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
@@ -225,6 +226,14 @@ Request::Request(
 }
 
 ResponseFuture Request::async_perform(utils::impl::SourceLocation location) {
+    auto* coalescer = pimpl_->GetRequestCoalescer();
+    if (coalescer && !pimpl_->GetCoalesceKey().empty()) {
+        auto future = coalescer->Join(pimpl_->GetCoalesceKey(), [this, &location] {
+            return ResponseFuture{pimpl_->async_perform(location), pimpl_};
+        });
+        return ResponseFuture{ResponseFuture::CoalescedTag{}, std::move(future), pimpl_};
+    }
+
     ResponseFuture future{pimpl_->async_perform(location), pimpl_};
     return future;
 }
@@ -531,12 +540,26 @@ void Request::SetTestsuiteConfig(const std::shared_ptr<const TestsuiteConfig>& c
     pimpl_->SetTestsuiteConfig(config);
 }
 
+void Request::SetRequestCoalescer(impl::RequestCoalescer& coalescer) & { pimpl_->SetRequestCoalescer(coalescer); }
+
+void Request::SetConcurrencyLimiters(congestion_control::ClientLimiters& limiters) & {
+    pimpl_->SetConcurrencyLimiters(limiters);
+}
+
+void Request::SetHttp2Settings(const Http2Settings& settings) & { pimpl_->SetHttp2Settings(settings); }
+
 void Request::SetAllowedUrlsExtra(const std::vector<std::string>& urls) & { pimpl_->SetAllowedUrlsExtra(urls); }
 
 void Request::SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config) & {
     pimpl_->SetDeadlinePropagationConfig(deadline_propagation_config);
 }
 
+Request& Request::coalesce(std::string key) & {
+    pimpl_->SetCoalesceKey(std::move(key));
+    return *this;
+}
+Request Request::coalesce(std::string key) && { return std::move(this->coalesce(std::move(key))); }
+
 Request& Request::DisableReplyDecoding() & {
     pimpl_->DisableReplyDecoding();
     return *this;
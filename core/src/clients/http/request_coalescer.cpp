@@ -0,0 +1,84 @@
+#include <clients/http/request_coalescer.hpp>
+
+#include <memory>
+#include <optional>
+
+#include <userver/engine/async.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::impl {
+
+RequestCoalescer::~RequestCoalescer() { CancelAndWait(); }
+
+engine::Future<RequestCoalescer::ResponsePtr> RequestCoalescer::Join(
+    const std::string& key,
+    utils::function_ref<ResponseFuture()> start
+) {
+    engine::Promise<ResponsePtr> promise;
+    auto future = promise.get_future();
+    {
+        const std::lock_guard lock{mutex_};
+        auto [it, inserted] = in_flight_.try_emplace(key);
+        it->second.push_back(std::move(promise));
+        if (!inserted) {
+            LOG_TRACE() << "Joined the in-flight request with coalescing key " << key;
+            return future;
+        }
+    }
+
+    std::optional<ResponseFuture> leader;
+    try {
+        leader.emplace(start());
+    } catch (const std::exception&) {
+        const auto exception = std::current_exception();
+        for (auto& waiter : ExtractWaiters(key)) waiter.set_exception(exception);
+        return future;
+    }
+
+    // Critical, otherwise the waiters would get the cancellation on overload
+    tasks_.Detach(engine::CriticalAsyncNoSpan([this, key, leader = std::move(*leader)]() mutable {
+        ResponsePtr response;
+        std::exception_ptr exception;
+        try {
+            response = leader.Get();
+        } catch (const std::exception&) {
+            exception = std::current_exception();
+        }
+        // the request may be reused by its owner as soon as the waiters are
+        // notified, so it must not be cancelled after that
+        leader.Detach();
+
+        auto waiters = ExtractWaiters(key);
+        UASSERT(!waiters.empty());
+        if (exception) {
+            for (auto& waiter : waiters) waiter.set_exception(exception);
+            return;
+        }
+
+        // The response is mutable, so the joined waiters get their own copies.
+        // The first waiter started the request and owns the original.
+        for (std::size_t i = 1; i < waiters.size(); ++i) {
+            waiters[i].set_value(std::make_shared<Response>(*response));
+        }
+        waiters.front().set_value(std::move(response));
+    }));
+    return future;
+}
+
+void RequestCoalescer::CancelAndWait() noexcept { tasks_.CancelAndWait(); }
+
+RequestCoalescer::Waiters RequestCoalescer::ExtractWaiters(const std::string& key) {
+    const std::lock_guard lock{mutex_};
+    const auto it = in_flight_.find(key);
+    UASSERT(it != in_flight_.end());
+    auto waiters = std::move(it->second);
+    in_flight_.erase(it);
+    return waiters;
+}
+
+}  // namespace clients::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/clients/http/response.hpp>
+#include <userver/clients/http/response_future.hpp>
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::impl {
+
+// Shares a single in-flight request between the concurrent requests with the
+// same coalescing key, see Request::coalesce().
+class RequestCoalescer final {
+public:
+    using ResponsePtr = std::shared_ptr<Response>;
+
+    RequestCoalescer() = default;
+
+    RequestCoalescer(const RequestCoalescer&) = delete;
+    RequestCoalescer& operator=(const RequestCoalescer&) = delete;
+
+    ~RequestCoalescer();
+
+    // Returns a future for the result of the in-flight request with the key,
+    // calls `start` to perform a new request if there is none.
+    engine::Future<ResponsePtr> Join(const std::string& key, utils::function_ref<ResponseFuture()> start);
+
+    // Cancels the in-flight requests, the waiters get the cancellation errors
+    void CancelAndWait() noexcept;
+
+private:
+    using Waiters = std::vector<engine::Promise<ResponsePtr>>;
+
+    Waiters ExtractWaiters(const std::string& key);
+
+    engine::Mutex mutex_;
+    std::unordered_map<std::string, Waiters> in_flight_;
+
+    // Must be the last member, it waits for the tasks that use the above ones
+    concurrent::BackgroundTaskStorageCore tasks_;
+};
+
+}  // namespace clients::http::impl
+
+USERVER_NAMESPACE_END
@@ -105,7 +105,7 @@ char* rfind_not_space(char* ptr, size_t size) {
 void SetBaggageHeader(curl::easy& e) {
     const auto* baggage = baggage::kInheritedBaggage.GetOptional();
     if (baggage != nullptr) {
-        LOG_DEBUG() << fmt::format("Send baggage: {}", baggage->ToString());
+        LOG_DEBUG() << "Send baggage: " << baggage->ToString();
         e.add_header(
             USERVER_NAMESPACE::http::headers::kXBaggage,
             baggage->ToString(),
@@ -200,6 +200,14 @@ void ModernClientKeyCertImpl(Easy& easy, crypto::PrivateKey&& pkey, crypto::Cert
     easy.set_ssl_key_type("PEM");
 }
 
+// "scheme://host:port" part of the URL, requests to it share the concurrency
+// limit
+std::string_view ExtractDestination(std::string_view url) {
+    const auto schema_pos = url.find("://");
+    const auto host_pos = (schema_pos == std::string_view::npos) ? 0 : schema_pos + 3;
+    return url.substr(0, url.find_first_of("/?#", host_pos));
+}
+
 }  // namespace
 
 RequestState::RequestState(
@@ -323,7 +331,10 @@ void RequestState::client_key_cert(crypto::PrivateKey pkey, crypto::Certificate
     }
 }
 
-void RequestState::http_version(curl::easy::http_version_t version) { easy().set_http_version(version); }
+void RequestState::http_version(curl::easy::http_version_t version) {
+    easy().set_http_version(version);
+    is_http_version_set_ = true;
+}
 
 void RequestState::set_timeout(long timeout_ms) {
     original_timeout_ = std::chrono::milliseconds{timeout_ms};
@@ -456,8 +467,13 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
     }
 
     holder->AccountResponse(err);
+    holder->ReleaseConcurrencyToken(err, status_code);
     const auto sockets = easy.get_num_connects();
-    holder->WithRequestStats([sockets](RequestStats& stats) { stats.AccountOpenSockets(sockets); });
+    const bool is_http2 = easy.get_http_version() == curl::easy::http_version_2_0;
+    holder->WithRequestStats([sockets, is_http2](RequestStats& stats) {
+        stats.AccountOpenSockets(sockets);
+        if (is_http2) stats.AccountHttp2(sockets);
+    });
 
     span.AddTag(tracing::kAttempts, holder->retry_.current);
     if (holder->deadline_propagation_config_.update_header) {
@@ -652,10 +668,11 @@ engine::Future<std::shared_ptr<Response>> RequestState::async_perform(utils::imp
 
     // set place for response body
     easy().set_sink(&response_->sink_string());
+    ApplyHttp2Settings();
 
     auto future = std::get_if<FullBufferedData>(&data_)->promise_.get_future();
 
-    if (UpdateTimeoutFromDeadlineAndCheck()) {
+    if (UpdateTimeoutFromDeadlineAndCheck() && AcquireConcurrencyToken()) {
         perform_request([holder = shared_from_this()](std::error_code err) mutable {
             RequestState::on_retry(std::move(holder), err);
         });
@@ -678,10 +695,11 @@ RequestState::async_perform_stream(const std::shared_ptr<Queue>& queue, utils::i
     easy().set_write_data(this);
     // Force no retries
     retry_.retries = 1;
+    ApplyHttp2Settings();
 
     auto future = std::get_if<StreamData>(&data_)->headers_promise.get_future();
 
-    if (UpdateTimeoutFromDeadlineAndCheck()) {
+    if (UpdateTimeoutFromDeadlineAndCheck() && AcquireConcurrencyToken()) {
         perform_request([holder = shared_from_this()](std::error_code err) mutable {
             RequestState::on_completed(std::move(holder), err);
         });
@@ -708,11 +726,13 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
                 easy().async_perform(std::move(handler));
             } catch (const clients::dns::ResolverException& ex) {
                 // TODO: should retry - TAXICOMMON-4932
+                concurrency_token_.reset();
                 auto* buffered_data = std::get_if<FullBufferedData>(&data_);
                 if (buffered_data) {
                     buffered_data->promise_.set_exception(std::current_exception());
                 }
             } catch (const BaseException& ex) {
+                concurrency_token_.reset();
                 auto* buffered_data = std::get_if<FullBufferedData>(&data_);
                 if (buffered_data) {
                     buffered_data->promise_.set_exception(std::current_exception());
@@ -800,6 +820,74 @@ void RequestState::HandleDeadlineAlreadyPassed() {
     std::visit(visitor, data_);
 }
 
+bool RequestState::AcquireConcurrencyToken() {
+    concurrency_token_.reset();
+    if (!concurrency_limiters_) return true;
+
+    auto& limiter = concurrency_limiters_->GetLimiter(ExtractDestination(easy().get_original_url()));
+    concurrency_token_ = limiter.TryAcquire();
+    if (concurrency_token_) return true;
+
+    auto& span = span_storage_->Get();
+    span.AddTag(tracing::kAttempts, retry_.current - 1);
+    span.AddTag(tracing::kErrorFlag, true);
+    span.AddTag("concurrency_limited", 1);
+
+    const std::error_code err{curl::errc::RateLimitErrorCode::kConcurrencyLimit};
+    auto exc = http::PrepareException(err, GetLoggedOriginalUrl(), easy().get_local_stats());
+
+    const utils::Overloaded visitor{
+        [&exc](FullBufferedData& buffered_data) {
+            auto promise = std::move(buffered_data.promise_);
+            // The task will wake up and may reuse RequestState.
+            promise.set_exception(std::move(exc));
+        },
+        [&exc](StreamData& stream_data) {
+            if (!stream_data.headers_promise_set.exchange(true)) {
+                auto promise = std::move(stream_data.headers_promise);
+                // The task will wake up and may reuse RequestState.
+                promise.set_exception(std::move(exc));
+            }
+        }};
+    std::visit(visitor, data_);
+    return false;
+}
+
+void RequestState::ApplyHttp2Settings() {
+    // The version set by the user takes precedence
+    if (!http2_settings_ || is_http_version_set_) return;
+
+    const std::string_view url = easy().get_original_url();
+    const auto& destinations = http2_settings_->destinations;
+    const auto is_http2_destination = [url](const std::string& prefix) { return utils::text::StartsWith(url, prefix); };
+    if (!destinations.empty() && std::none_of(destinations.begin(), destinations.end(), is_http2_destination)) return;
+
+    easy().set_http_version(
+        http2_settings_->fallback == Http2Fallback::kNone ? curl::easy::http_version_2_prior_knowledge
+                                                          : curl::easy::http_version_2_0
+    );
+    // Wait for the multiplexed connection that is being established instead of
+    // opening a new one
+    easy().set_pipewait(true);
+}
+
+void RequestState::ReleaseConcurrencyToken(std::error_code err, Status status_code) {
+    if (!concurrency_token_) return;
+    auto token = std::move(*concurrency_token_);
+    concurrency_token_.reset();
+
+    // Cancellations and our own deadline say nothing about the destination,
+    // the token is released without updating the limit
+    if (is_cancelled_ || deadline_expired_) return;
+
+    if (err || status_code == Status::kTooManyRequests || status_code == Status::kServiceUnavailable ||
+        status_code == Status::kGatewayTimeout) {
+        token.OnDropped();
+    } else {
+        token.OnSuccess();
+    }
+}
+
 void RequestState::CheckResponseDeadline(std::error_code& err, Status status_code) {
     const std::chrono::microseconds attempt_time{easy().get_total_time_usec()};
 
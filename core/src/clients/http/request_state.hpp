@@ -14,6 +14,7 @@
 #include <userver/clients/http/plugin.hpp>
 #include <userver/clients/http/response_future.hpp>
 #include <userver/concurrent/queue.hpp>
+#include <userver/congestion_control/client_limiter.hpp>
 #include <userver/crypto/certificate.hpp>
 #include <userver/crypto/private_key.hpp>
 #include <userver/engine/deadline.hpp>
@@ -39,6 +40,10 @@ namespace clients::http {
 class StreamedResponse;
 class ConnectTo;
 
+namespace impl {
+class RequestCoalescer;
+}  // namespace impl
+
 class RequestState : public std::enable_shared_from_this<RequestState> {
 public:
     RequestState(
@@ -123,6 +128,16 @@ public:
 
     void SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config);
 
+    void SetRequestCoalescer(impl::RequestCoalescer& coalescer) { coalescer_ = &coalescer; }
+    impl::RequestCoalescer* GetRequestCoalescer() const { return coalescer_; }
+
+    void SetCoalesceKey(std::string key) { coalesce_key_ = std::move(key); }
+    const std::string& GetCoalesceKey() const { return coalesce_key_; }
+
+    void SetConcurrencyLimiters(congestion_control::ClientLimiters& limiters) { concurrency_limiters_ = &limiters; }
+
+    void SetHttp2Settings(const Http2Settings& settings) { http2_settings_ = &settings; }
+
     curl::easy& easy() { return easy_.Easy(); }
     const curl::easy& easy() const { return easy_.Easy(); }
     std::shared_ptr<Response> response() const { return response_; }
@@ -158,6 +173,14 @@ private:
     [[nodiscard]] bool UpdateTimeoutFromDeadlineAndCheck(std::chrono::milliseconds backoff = {});
     void UpdateTimeoutHeader();
     void HandleDeadlineAlreadyPassed();
+    /// takes a slot of the destination concurrency limit, fails the request if
+    /// the limit is reached
+    [[nodiscard]] bool AcquireConcurrencyToken();
+    /// switches the requests to the HTTP/2 destinations to the multiplexed
+    /// connections
+    void ApplyHttp2Settings();
+    /// reports the outcome of the request to the destination concurrency limit
+    void ReleaseConcurrencyToken(std::error_code err, Status status_code);
     void CheckResponseDeadline(std::error_code& err, Status status_code);
     bool IsDeadlineExpiredResponse(Status status_code);
     bool ShouldRetryResponse();
@@ -231,6 +254,12 @@ private:
 
     clients::dns::Resolver* resolver_{nullptr};
     std::string proxy_url_;
+    impl::RequestCoalescer* coalescer_{nullptr};
+    std::string coalesce_key_;
+    congestion_control::ClientLimiters* concurrency_limiters_{nullptr};
+    const Http2Settings* http2_settings_{nullptr};
+    bool is_http_version_set_{false};
+    std::optional<congestion_control::ClientLimiter::Token> concurrency_token_;
     impl::PluginPipeline& plugin_pipeline_;
 
     struct StreamData {
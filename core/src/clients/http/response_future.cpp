@@ -52,10 +52,21 @@ ResponseFuture::ResponseFuture(
     }
 }
 
+ResponseFuture::ResponseFuture(
+    CoalescedTag,
+    engine::Future<std::shared_ptr<Response>>&& future,
+    std::shared_ptr<RequestState> request_state
+)
+    : ResponseFuture(std::move(future), std::move(request_state)) {
+    is_coalesced_ = true;
+}
+
 ResponseFuture::ResponseFuture(ResponseFuture&& other) noexcept : cancellation_policy_(other.cancellation_policy_) {
     std::swap(future_, other.future_);
     std::swap(deadline_, other.deadline_);
     std::swap(request_state_, other.request_state_);
+    std::swap(was_deadline_propagated_, other.was_deadline_propagated_);
+    std::swap(is_coalesced_, other.is_coalesced_);
 }
 
 ResponseFuture& ResponseFuture::operator=(ResponseFuture&& other) noexcept {
@@ -65,6 +76,7 @@ ResponseFuture& ResponseFuture::operator=(ResponseFuture&& other) noexcept {
     deadline_ = other.deadline_;
     request_state_ = std::move(other.request_state_);
     was_deadline_propagated_ = other.was_deadline_propagated_;
+    is_coalesced_ = other.is_coalesced_;
     cancellation_policy_ = other.cancellation_policy_;
     return *this;
 }
@@ -83,7 +95,8 @@ void ResponseFuture::CancelOrDetach() {
 }
 
 void ResponseFuture::Cancel() {
-    if (request_state_) {
+    // the coalesced request is shared with other waiters, it is not cancelled
+    if (request_state_ && !is_coalesced_) {
         request_state_->Cancel();
     }
     Detach();
@@ -97,7 +110,7 @@ void ResponseFuture::Detach() {
 std::future_status ResponseFuture::Wait() {
     switch (future_.wait_until(deadline_)) {
         case engine::FutureStatus::kCancelled: {
-            const auto stats = request_state_->easy().get_local_stats();
+            const auto stats = is_coalesced_ ? LocalStats{} : request_state_->easy().get_local_stats();
 
             // request_ has armed timers to retry the request. Stopping those ASAP.
             CancelOrDetach();
@@ -72,6 +72,12 @@ void RequestStats::AccountOpenSockets(size_t sockets) noexcept {
     stats_->socket_open_ += utils::statistics::Rate{sockets};
 }
 
+void RequestStats::AccountHttp2(size_t sockets) noexcept {
+    UASSERT(stats_);
+    ++stats_->http2_requests_;
+    stats_->http2_socket_open_ += utils::statistics::Rate{sockets};
+}
+
 void RequestStats::AccountTimeoutUpdatedByDeadline() noexcept {
     UASSERT(stats_);
     ++stats_->timeout_updated_by_deadline_;
@@ -168,6 +174,10 @@ void DumpMetric(utils::statistics::Writer& writer, const DestinationStatisticsVi
     writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
 
     writer["sockets"]["open"] = stats.multi.socket_open;
+
+    // requests / sockets-open is the mean number of streams per connection
+    writer["http2"]["requests"] = stats.http2_requests;
+    writer["http2"]["sockets-open"] = stats.http2_socket_open;
 }
 
 void DumpMetric(utils::statistics::Writer& writer, const InstanceStatistics& stats) {
@@ -200,6 +210,8 @@ InstanceStatistics::InstanceStatistics(const Statistics& other)
       last_time_to_start_us(other.last_time_to_start_us_.load()),
       timings_percentile(other.timings_percentile_.GetStatsForPeriod()),
       retries(other.retries_.Load()),
+      http2_requests(other.http2_requests_.Load()),
+      http2_socket_open(other.http2_socket_open_.Load()),
       timeout_updated_by_deadline(other.timeout_updated_by_deadline_.Load()),
       cancelled_by_deadline(other.cancelled_by_deadline_.Load()),
       reply_status(other.reply_status_) {
@@ -231,6 +243,8 @@ InstanceStatistics& InstanceStatistics::operator+=(const InstanceStatistics& sta
         error_count[i] += stat.error_count[i];
     }
     retries += stat.retries;
+    http2_requests += stat.http2_requests;
+    http2_socket_open += stat.http2_socket_open;
 
     timeout_updated_by_deadline += stat.timeout_updated_by_deadline;
     cancelled_by_deadline += stat.cancelled_by_deadline;
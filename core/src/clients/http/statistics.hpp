@@ -38,6 +38,10 @@ public:
 
     void AccountOpenSockets(size_t sockets) noexcept;
 
+    /// Accounts a request multiplexed over HTTP/2, `sockets` are the
+    /// connections opened by it
+    void AccountHttp2(size_t sockets) noexcept;
+
     void AccountTimeoutUpdatedByDeadline() noexcept;
     void AccountCancelledByDeadline() noexcept;
 
@@ -103,6 +107,8 @@ private:
     std::array<utils::statistics::RateCounter, kErrorGroupCount> error_count_;
     utils::statistics::RateCounter retries_;
     utils::statistics::RateCounter socket_open_{0};
+    utils::statistics::RateCounter http2_requests_;
+    utils::statistics::RateCounter http2_socket_open_;
     utils::statistics::RateCounter timeout_updated_by_deadline_;
     utils::statistics::RateCounter cancelled_by_deadline_;
     utils::statistics::HttpCodes reply_status_;
@@ -129,6 +135,8 @@ struct InstanceStatistics {
     Percentile timings_percentile;
     std::array<utils::statistics::Rate, Statistics::kErrorGroupCount> error_count;
     utils::statistics::Rate retries{0};
+    utils::statistics::Rate http2_requests;
+    utils::statistics::Rate http2_socket_open;
 
     utils::statistics::Rate timeout_updated_by_deadline;
     utils::statistics::Rate cancelled_by_deadline;
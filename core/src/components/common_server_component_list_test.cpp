@@ -9,6 +9,7 @@
 #include <userver/fs/blocking/write.hpp>           // for fs::blocking::RewriteFileContents
 #include <userver/internal/net/net_listener.hpp>
 #include <userver/logging/impl/mem_logger.hpp>
+#include <userver/server/handlers/cpu_profiler.hpp>
 #include <userver/server/handlers/ping.hpp>
 #include <userver/utest/utest.hpp>
 
@@ -200,6 +201,15 @@ components_manager:
         method: POST
         task_processor: monitor-task-processor
 # /// [Sample handler jemalloc component config]
+# /// [Sample handler cpu profiler component config]
+# yaml
+    handler-cpu-profiler:
+        path: /service/cpu-profiler/{command}
+        method: POST
+        task_processor: monitor-task-processor
+        sampling-frequency: 100
+        max-samples: 5000
+# /// [Sample handler cpu profiler component config]
 # /// [Sample handler dns client control component config]
 # yaml
     handler-dns-client-control:
@@ -286,6 +296,7 @@ TEST_F(CommonServerComponentList, Smoke) {
         components::CommonComponentList()
             .AppendComponentList(components::CommonServerComponentList())
             .Append<server::handlers::Ping>()
+            .Append<server::handlers::CpuProfiler>()
     );
 }
 
@@ -312,6 +323,7 @@ TEST_F(CommonServerComponentList, Logger) {
         components::CommonComponentList()
             .AppendComponentList(components::CommonServerComponentList())
             .Append<server::handlers::Ping>()
+            .Append<server::handlers::CpuProfiler>()
     );
 
     logging::SetDefaultLoggerLevel(logging::Level::kInfo);
@@ -344,6 +356,7 @@ TEST_F(CommonServerComponentList, TraceLogging) {
         components::CommonComponentList()
             .AppendComponentList(components::CommonServerComponentList())
             .Append<server::handlers::Ping>()
+            .Append<server::handlers::CpuProfiler>()
     );
 }
 
@@ -367,6 +380,7 @@ TEST_F(CommonServerComponentList, NullLogging) {
         components::CommonComponentList()
             .AppendComponentList(components::CommonServerComponentList())
             .Append<server::handlers::Ping>()
+            .Append<server::handlers::CpuProfiler>()
     );
 }
 
@@ -388,7 +402,8 @@ TEST_F(CommonServerComponentList, BlockingDefaultLogger) {
     const components::InMemoryConfig config{std::string{kStaticConfig} + GetConfigVarsPath()};
     const auto component_list = components::CommonComponentList()
                                     .AppendComponentList(components::CommonServerComponentList())
-                                    .Append<server::handlers::Ping>();
+                                    .Append<server::handlers::Ping>()
+                                    .Append<server::handlers::CpuProfiler>();
     UEXPECT_THROW_MSG(components::RunOnce(config, component_list), std::exception, "efault logger");
 }
 
@@ -1,6 +1,7 @@
 #include <userver/components/component_context.hpp>
 
 #include <components/component_context_impl.hpp>
+#include <components/impl/components_load_report.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -42,6 +43,8 @@ const Manager& ComponentContext::GetManager() const { return impl_->GetManager()
 
 void ComponentContext::CancelComponentsLoad() { impl_->CancelComponentsLoad(); }
 
+impl::ComponentsLoadReport ComponentContext::MakeLoadReport() const { return impl_->MakeLoadReport(); }
+
 bool ComponentContext::Contains(std::string_view name) const noexcept { return impl_->Contains(name); }
 
 void ComponentContext::ThrowNonRegisteredComponent(std::string_view name, std::string_view type) const {
@@ -158,6 +158,16 @@ std::string ComponentInfo::GetDependencies() const {
     return fmt::format(R"("{}" -> "{}" )", name_, fmt::join(it_depends_on_, delimiter));
 }
 
+void ComponentInfo::SetConstructionTime(ConstructionTime time) {
+    std::lock_guard lock{mutex_};
+    construction_time_ = time;
+}
+
+std::optional<ConstructionTime> ComponentInfo::GetConstructionTime() const {
+    std::lock_guard lock{mutex_};
+    return construction_time_;
+}
+
 bool ComponentInfo::HasComponent() const {
     std::lock_guard lock{mutex_};
     return !!component_;
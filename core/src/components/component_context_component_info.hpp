@@ -1,7 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 
@@ -22,6 +24,11 @@ public:
     explicit StageSwitchingCancelledException(const std::string& message);
 };
 
+struct ConstructionTime final {
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point finish;
+};
+
 class ComponentInfo final {
 public:
     explicit ComponentInfo(std::string name);
@@ -91,6 +98,9 @@ public:
 
     std::string GetDependencies() const;
 
+    void SetConstructionTime(ConstructionTime time);
+    std::optional<ConstructionTime> GetConstructionTime() const;
+
 private:
     bool HasComponent() const;
     std::unique_ptr<RawComponentBase> ExtractComponent();
@@ -104,6 +114,7 @@ private:
     std::set<ComponentNameFromInfo> depends_on_it_;
     ComponentLifetimeStage stage_ = ComponentLifetimeStage::kNull;
     bool stage_switching_cancelled_{false};
+    std::optional<ConstructionTime> construction_time_;
     std::atomic<bool> on_loading_cancelled_called_{false};
 };
 
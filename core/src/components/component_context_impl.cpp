@@ -114,7 +114,10 @@ ComponentContextImpl::AddComponent(std::string_view name, const ComponentFactory
     if (component_info.GetComponent())
         throw std::runtime_error("trying to add component " + std::string{name} + " multiple times");
 
+    const auto construction_start = std::chrono::steady_clock::now();
     component_info.SetComponent(factory(context));
+    component_info.SetConstructionTime({construction_start, std::chrono::steady_clock::now()});
+
     auto* component = component_info.GetComponent();
     if (component) {
         // Call the following command on logs to get the component dependencies:
@@ -195,6 +198,45 @@ void ComponentContextImpl::CancelComponentsLoad() {
     }
 }
 
+ComponentsLoadReport ComponentContextImpl::MakeLoadReport() const {
+    const auto make_stats = [](impl::ComponentNameFromInfo name, std::chrono::steady_clock::duration duration) {
+        return ComponentLoadStats{
+            std::string{name.StringViewName()},
+            std::chrono::duration_cast<std::chrono::milliseconds>(duration),
+        };
+    };
+
+    ComponentsLoadReport report;
+    report.components.reserve(components_.size());
+
+    std::optional<impl::ComponentNameFromInfo> last_constructed;
+    std::chrono::steady_clock::time_point last_finish{};
+    for (const auto& [name, component_info] : components_) {
+        const auto time = component_info.GetConstructionTime();
+        if (!time) continue;  // 'load-enabled: false'
+
+        report.components.push_back(make_stats(name, GetOwnConstructionTime(component_info).duration));
+        if (!last_constructed || time->finish > last_finish) {
+            last_constructed = name;
+            last_finish = time->finish;
+        }
+    }
+    std::sort(report.components.begin(), report.components.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.own_duration > rhs.own_duration;
+    });
+
+    // Walks back from the last constructed component through the dependencies
+    // that each component on the path has waited for the longest
+    for (auto current = last_constructed; current && report.critical_path.size() < components_.size();) {
+        const auto own_time = GetOwnConstructionTime(components_.at(*current));
+        report.critical_path.push_back(make_stats(*current, own_time.duration));
+        current = own_time.blocked_by;
+    }
+    std::reverse(report.critical_path.begin(), report.critical_path.end());
+
+    return report;
+}
+
 bool ComponentContextImpl::IsAnyComponentInFatalState() const {
 #ifndef NDEBUG
     {
@@ -415,6 +457,25 @@ void ComponentContextImpl::ProcessAllComponentLifetimeStageSwitchings(ComponentL
         );
 }
 
+ComponentContextImpl::OwnConstructionTime ComponentContextImpl::GetOwnConstructionTime(
+    const impl::ComponentInfo& component_info
+) const {
+    const auto time = component_info.GetConstructionTime();
+    UASSERT(time);
+
+    auto ready_time = time->start;
+    OwnConstructionTime result;
+    component_info.ForEachItDependsOn([&](impl::ComponentNameFromInfo dependency) {
+        const auto dependency_time = components_.at(dependency).GetConstructionTime();
+        if (dependency_time && dependency_time->finish > ready_time) {
+            ready_time = dependency_time->finish;
+            result.blocked_by = dependency;
+        }
+    });
+    result.duration = time->finish - ready_time;
+    return result;
+}
+
 RawComponentBase* ComponentContextImpl::DoFindComponent(std::string_view name) {
     auto& component_info = components_.at(impl::ComponentNameFromInfo{name});
     AddDependency(component_info.Name());
@@ -3,6 +3,8 @@
 #include <userver/components/component_context.hpp>
 
 #include <atomic>
+#include <chrono>
+#include <optional>
 #include <set>
 #include <stdexcept>
 #include <unordered_map>
@@ -18,6 +20,7 @@
 
 #include <components/component_context_component_info.hpp>
 #include <components/impl/component_name_from_info.hpp>
+#include <components/impl/components_load_report.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -43,6 +46,9 @@ public:
 
     void CancelComponentsLoad();
 
+    // Should be called only after all the constructors have completed
+    ComponentsLoadReport MakeLoadReport() const;
+
     bool IsAnyComponentInFatalState() const;
 
     bool HasDependencyOn(std::string_view component_name, std::string_view dependency) const;
@@ -120,6 +126,13 @@ private:
 
     void AddDependency(impl::ComponentNameFromInfo name);
 
+    struct OwnConstructionTime {
+        std::chrono::steady_clock::duration duration{};
+        std::optional<impl::ComponentNameFromInfo> blocked_by;
+    };
+
+    OwnConstructionTime GetOwnConstructionTime(const impl::ComponentInfo& component_info) const;
+
     bool FindDependencyPathDfs(
         impl::ComponentNameFromInfo current,
         impl::ComponentNameFromInfo target,
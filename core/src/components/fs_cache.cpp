@@ -1,3 +1,6 @@
+#include <string>
+#include <vector>
+
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/components/fs_cache.hpp>
@@ -7,6 +10,17 @@ USERVER_NAMESPACE_BEGIN
 
 namespace components {
 
+namespace {
+
+fs::FsCacheClient::PrecompressSettings ParsePrecompressSettings(const ComponentConfig& config) {
+    fs::FsCacheClient::PrecompressSettings settings;
+    settings.encodings = config["precompress"].As<std::vector<std::string>>(settings.encodings);
+    settings.min_size = config["precompress-min-size"].As<std::size_t>(settings.min_size);
+    return settings;
+}
+
+}  // namespace
+
 const FsCache::Client& FsCache::GetClient() const { return client_; }
 
 FsCache::FsCache(const components::ComponentConfig& config, const components::ComponentContext& context)
@@ -14,7 +28,9 @@ FsCache::FsCache(const components::ComponentConfig& config, const components::Co
       client_(
           config["dir"].As<std::string>("/var/www"),
           config["update-period"].As<std::chrono::milliseconds>(0),
-          context.GetTaskProcessor(config["fs-task-processor"].As<std::string>("fs-task-processor"))
+          context.GetTaskProcessor(config["fs-task-processor"].As<std::string>("fs-task-processor")),
+          config["max-in-memory-file-size"].As<std::size_t>(fs::kUnlimitedInMemoryFileSize),
+          ParsePrecompressSettings(config)
       ) {}
 
 yaml_config::Schema FsCache::GetStaticConfigSchema() {
@@ -36,6 +52,29 @@ properties:
         type: string
         description: task processor to do filesystem operations
         defaultDescription: fs-task-processor
+    max-in-memory-file-size:
+        type: integer
+        description: |
+            larger files are kept open instead of being read into memory
+        defaultDescription: unlimited
+        minimum: 0
+    precompress:
+        type: array
+        description: |
+            content codings to compress the in-memory files with once per file
+            version, for server::handlers::HttpHandlerStatic
+        defaultDescription: '[]'
+        items:
+            type: string
+            description: content coding
+            enum:
+              - gzip
+              - zstd
+    precompress-min-size:
+        type: integer
+        description: smaller files are not precompressed
+        defaultDescription: 1024
+        minimum: 0
 )");
 }
 
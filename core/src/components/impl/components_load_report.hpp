@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+struct ComponentLoadStats final {
+    std::string name;
+
+    // Time spent in the constructor after all the dependencies of the
+    // component have been constructed
+    std::chrono::milliseconds own_duration{0};
+};
+
+struct ComponentsLoadReport final {
+    // Sorted by `own_duration` in descending order
+    std::vector<ComponentLoadStats> components;
+
+    // The chain of components that determines the total construction time,
+    // from the first constructed component to the last one
+    std::vector<ComponentLoadStats> critical_path;
+};
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <logging/dynamic_debug.hpp>
 #include <logging/dynamic_debug_config.hpp>
+#include <logging/log_sampling_config.hpp>
 #include <tracing/no_log_spans.hpp>
 #include <userver/components/component.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
@@ -38,18 +39,30 @@ const dynamic_config::Key<logging::DynamicDebugConfig> kDynamicDebugConfig{
   }
 )"}};
 
+const dynamic_config::Key<logging::LogSamplingConfig> kLogSamplingConfig{
+    "USERVER_LOG_SAMPLING",
+    dynamic_config::DefaultAsJsonString{R"(
+  {
+    "enabled": false
+  }
+)"}};
+
 }  // namespace
 
 LoggingConfigurator::LoggingConfigurator(const ComponentConfig& config, const ComponentContext& context) {
     logging::impl::SetLogLimitedEnable(config["limited-logging-enable"].As<bool>());
     logging::impl::SetLogLimitedInterval(config["limited-logging-interval"].As<std::chrono::milliseconds>());
+    logging::impl::SetTraceSampledInHook(&logging::IsCurrentTraceSampledIn);
 
     config_subscription_ = context.FindComponent<components::DynamicConfig>().GetSource().UpdateAndListen(
         this, kName, &LoggingConfigurator::OnConfigUpdate
     );
 }
 
-LoggingConfigurator::~LoggingConfigurator() { config_subscription_.Unsubscribe(); }
+LoggingConfigurator::~LoggingConfigurator() {
+    config_subscription_.Unsubscribe();
+    logging::impl::DisableLogSampling();
+}
 
 void LoggingConfigurator::OnConfigUpdate(const dynamic_config::Snapshot& config) {
     (void)this;  // silence clang-tidy
@@ -88,6 +101,25 @@ void LoggingConfigurator::OnConfigUpdate(const dynamic_config::Snapshot& config)
     } catch (const std::exception& e) {
         LOG_ERROR() << "Failed to set dynamic debug logs from config: " << e;
     }
+
+    try {
+        const auto& sampling = config[kLogSamplingConfig];
+        auto old_sampling = log_sampling_.Read();
+        if (!(*old_sampling == sampling)) {
+            auto lock = log_sampling_.StartWrite();
+            *lock = sampling;
+
+            if (sampling.enabled) {
+                logging::impl::EnableLogSampling(sampling.settings);
+            } else {
+                logging::impl::DisableLogSampling();
+            }
+
+            lock.Commit();
+        }
+    } catch (const std::exception& e) {
+        LOG_ERROR() << "Failed to set log sampling from config: " << e;
+    }
 }
 
 yaml_config::Schema LoggingConfigurator::GetStaticConfigSchema() {
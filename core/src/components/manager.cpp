@@ -1,5 +1,6 @@
 #include <components/manager.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <future>
 #include <set>
@@ -23,6 +24,7 @@
 #include <userver/os_signals/component.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/distances.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -64,29 +66,71 @@ std::optional<size_t> GuessCpuLimit(const std::string& tp_name) {
     return {};
 }
 
+constexpr std::size_t kSlowestComponentsToLog = 10;
+
+std::string FormatComponentsLoadStats(
+    utils::span<const components::impl::ComponentLoadStats> stats,
+    std::string_view separator
+) {
+    std::string result;
+    for (const auto& item : stats) {
+        if (!result.empty()) result += separator;
+        result += fmt::format("{} ({}ms)", item.name, item.own_duration.count());
+    }
+    return result;
+}
+
+void LogComponentsLoadReport(const components::impl::ComponentsLoadReport& report) {
+    std::chrono::milliseconds critical_path_duration{0};
+    for (const auto& item : report.critical_path) critical_path_duration += item.own_duration;
+
+    // The startup can only be sped up by the components on the critical path,
+    // the rest of the constructors run in parallel with them
+    LOG_INFO() << "Components construction critical path (" << critical_path_duration.count()
+               << "ms): " << FormatComponentsLoadStats(report.critical_path, " -> ");
+
+    const auto slowest_count = std::min(report.components.size(), kSlowestComponentsToLog);
+    LOG_INFO() << "Slowest components constructors: "
+               << FormatComponentsLoadStats({report.components.data(), slowest_count}, ", ");
+}
+
 void ValidateConfigs(
     const components::ComponentList& component_list,
     const components::ComponentConfigMap& component_config_map,
     components::ValidationMode validation_condition
 ) {
-    std::string validation_errors;
-
+    // Schemas of the components are built and checked independently, so the
+    // validation runs in parallel. Errors are reported in the order of the
+    // components in the list.
+    std::vector<engine::TaskWithResult<std::string>> tasks;
     for (const auto& adder : component_list) {
         const auto it = component_config_map.find(adder->GetComponentName());
         UINVARIANT(
             it != component_config_map.cend(),
             fmt::format("Component-config map does not have name of component '{}'", adder->GetComponentName())
         );
-        try {
-            adder->ValidateStaticConfig(it->second, validation_condition);
-        } catch (const std::exception& exception) {
-            auto component_name = adder->GetComponentName();
-            validation_errors += fmt::format("\n\t{}: {}", component_name, exception.what());
-            if (adder->GetStaticConfigSchema() == components::RawComponentBase::GetStaticConfigSchema()) {
-                validation_errors +=
-                    ". Please define GetStaticConfigSchema for this component to be able to configure it";
+
+        auto task_name = "boot/validate/" + adder->GetComponentName();
+        tasks.push_back(utils::CriticalAsync(
+            std::move(task_name),
+            [&adder = *adder, &config = it->second, validation_condition]() -> std::string {
+                try {
+                    adder.ValidateStaticConfig(config, validation_condition);
+                    return {};
+                } catch (const std::exception& exception) {
+                    auto error = fmt::format("\n\t{}: {}", adder.GetComponentName(), exception.what());
+                    if (adder.GetStaticConfigSchema() == components::RawComponentBase::GetStaticConfigSchema()) {
+                        error += ". Please define GetStaticConfigSchema for this component to be able to configure it";
+                    }
+                    return error;
+                }
             }
-        }
+        ));
+    }
+
+    std::string validation_errors;
+    for (auto& task : tasks) {
+        validation_errors += task.Get();
     }
 
     if (!validation_errors.empty()) {
@@ -231,6 +275,8 @@ std::chrono::steady_clock::time_point Manager::GetStartTime() const { return sta
 
 std::chrono::milliseconds Manager::GetLoadDuration() const { return load_duration_; }
 
+const impl::ComponentsLoadReport& Manager::GetComponentsLoadReport() const { return components_load_report_; }
+
 void Manager::CreateComponentContext(const ComponentList& component_list) {
     std::set<std::string> loading_component_names;
     for (const auto& adder : component_list) {
@@ -359,6 +405,9 @@ void Manager::AddComponents(const ComponentList& component_list) {
                   "have completed. Preparing to run OnAllComponentsLoaded "
                   "for each component.";
 
+    components_load_report_ = component_context_.MakeLoadReport();
+    LogComponentsLoadReport(components_load_report_);
+
     try {
         component_context_.OnAllComponentsLoaded();
     } catch (const std::exception& ex) {
@@ -14,6 +14,8 @@
 #include <userver/components/raw_component_base.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 
+#include <components/impl/components_load_report.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
@@ -48,6 +50,8 @@ public:
 
     std::chrono::milliseconds GetLoadDuration() const;
 
+    const impl::ComponentsLoadReport& GetComponentsLoadReport() const;
+
 private:
     class TaskProcessorsStorage final {
     public:
@@ -102,6 +106,7 @@ private:
     engine::TaskProcessor* default_task_processor_{nullptr};
     const std::chrono::steady_clock::time_point start_time_;
     std::chrono::milliseconds load_duration_{0};
+    impl::ComponentsLoadReport components_load_report_;
 
     os_signals::ProcessorComponent* signal_processor_{nullptr};
 };
@@ -61,8 +61,10 @@ ManagerConfig ParseFromAny(
         config_vars = builder.ExtractValue();
     }
 
-    auto config =
-        yaml_config::YamlConfig(config_yaml, std::move(config_vars), yaml_config::YamlConfig::Mode::kEnvAndFileAllowed);
+    // Components read their configs many times, apply the substitutions once
+    const auto config =
+        yaml_config::YamlConfig(config_yaml, std::move(config_vars), yaml_config::YamlConfig::Mode::kEnvAndFileAllowed)
+            .Resolve();
     config.CheckObject();
     for (const auto& [key, value] : Items(config)) {
         if (key != kManagerConfigField && key != kConfigVarsField) {
@@ -111,6 +113,16 @@ properties:
                     lead to inaccuracy in coro pool size estimation.
                     local_cache_size=0 disables local cache.
                 defaultDescription: 8
+            idle_release_threshold:
+                type: integer
+                description: |
+                    When the pool holds at least this many idle coroutines,
+                    stacks of the coroutines returned to it are released to
+                    the OS via madvise(MADV_DONTNEED), except for the topmost
+                    16KiB. This lowers RSS after load spikes and deep
+                    recursions at the cost of page faults on reuse.
+                    Unset disables the release.
+                minimum: 0
     event_thread_pool:
         type: object
         description: event thread pool options
@@ -121,6 +133,41 @@ properties:
                 description: >
                     number of threads to process low level IO system calls
                     (number of ev loops to start in libev)
+            ev_backend:
+                type: string
+                description: |
+                    libev backend for the ev loops.
+                    `auto` lets libev choose the best backend for the platform.
+                    `epoll` forces epoll.
+                    `io_uring` uses io_uring for readiness notifications,
+                    batching watcher updates into submission queue entries
+                    instead of separate epoll_ctl calls; falls back to `auto`
+                    if the libev build or the kernel does not support it.
+                defaultDescription: auto
+                enum:
+                  - auto
+                  - epoll
+                  - io_uring
+            ev_thread_selection:
+                type: string
+                description: |
+                    How ev threads are chosen for new sockets and timers.
+                    `round-robin` hands them out one by one.
+                    `least-loaded` picks the less busy of two ev threads by
+                    CPU load and by the number of active IO watchers, so that
+                    long-lived busy connections do not pile up on one thread.
+                defaultDescription: round-robin
+                enum:
+                  - round-robin
+                  - least-loaded
+            coarse_timers_resolution:
+                type: string
+                description: |
+                    Enables a per ev thread hierarchical timer wheel with the
+                    given tick (e.g. `1ms`) for task deadlines and sleeps.
+                    Arming and rearming such timers does not wake up the
+                    ev loop, at the cost of firing up to two ticks late.
+                    Unset keeps the libev timers.
     components:
         type: object
         description: 'dictionary of "component name": "options"'
@@ -162,6 +209,14 @@ properties:
                         tunes the number of spin-wait iterations in case of
                         an empty task queue before threads go to sleep
                     defaultDescription: 10000
+                lock-spinning-iterations:
+                    type: integer
+                    description: |
+                        the number of spin-wait iterations of engine::Mutex,
+                        engine::SharedMutex and engine::Semaphore before the
+                        task is parked; 0 parks the task right away
+                    defaultDescription: 0
+                    minimum: 0
                 task-processor-queue:
                     type: string
                     description: |
@@ -173,6 +228,82 @@ properties:
                     enum:
                       - global-task-queue
                       - work-stealing-task-queue
+                critical-tasks-priority:
+                    type: string
+                    description: |
+                        Dequeue order of critical tasks (request handlers,
+                        connections, engine::CriticalAsync) relative to other
+                        tasks in `global-task-queue`.
+                        `none` runs all the tasks in FIFO order.
+                        `strict` runs other tasks only if there are no queued
+                        critical tasks, which may starve background work.
+                        `weighted` runs an other task after at most
+                        `critical-tasks-weight` critical tasks in a row.
+                    defaultDescription: none
+                    enum:
+                      - none
+                      - strict
+                      - weighted
+                critical-tasks-weight:
+                    type: integer
+                    description: |
+                        max number of critical tasks to run in a row before
+                        running an other task, for `weighted` priority
+                    defaultDescription: 8
+                    minimum: 1
+                cpu-set:
+                    type: string
+                    description: |
+                        CPUs to run the task processor threads on, in the
+                        Linux cpulist format, e.g. `0-3,8-11`.
+                        Empty means no restriction. All the CPUs must be
+                        allowed for the process, otherwise the service fails
+                        to start. Not supported on macOS.
+                    defaultDescription: ''
+                numa-node:
+                    type: integer
+                    description: |
+                        NUMA node to run the task processor threads on.
+                        Thread-local caches and coroutine stacks first touched
+                        by the workers are then allocated on that node.
+                        If `cpu-set` is also set, only the CPUs of `cpu-set`
+                        that belong to the node are used.
+                    minimum: 0
+                cpu-affinity:
+                    type: string
+                    description: |
+                        How the task processor threads are pinned to the CPUs
+                        from `cpu-set`/`numa-node`.
+                        `shared` allows every thread to run on any of them.
+                        `per-worker` pins each thread to a single CPU in a
+                        round-robin manner.
+                    defaultDescription: shared
+                    enum:
+                      - shared
+                      - per-worker
+                time-slice:
+                    type: string
+                    description: |
+                        CPU time budget of a task between context switches,
+                        e.g. `2ms`. When set, engine::MaybeYield() yields once
+                        the budget is exhausted, and the runs that exceeded it
+                        are reported in the `time-slice-overruns` metrics,
+                        grouped by the current span name.
+                        Unset disables the accounting.
+                task-timings:
+                    type: boolean
+                    description: |
+                        account the time each task spends in the queue, running
+                        and suspended, see engine::current_task::GetTimings().
+                        Adds a few clock reads per context switch
+                    defaultDescription: false
+                jemalloc-arena:
+                    type: boolean
+                    description: |
+                        bind the worker threads to a dedicated jemalloc arena.
+                        The arena memory is reported in the `jemalloc-arena`
+                        metrics of the task processor. Ignored without jemalloc
+                    defaultDescription: false
                 task-trace:
                     type: object
                     description: .
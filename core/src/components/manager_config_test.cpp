@@ -27,6 +27,9 @@ components_manager:
   event_thread_pool:
     threads: $event_threads
     threads#fallback: 2
+    ev_backend: io_uring
+    ev_thread_selection: least-loaded
+    coarse_timers_resolution: 2ms
   task_processors:
     bg-task-processor:
       thread_name: bg-worker
@@ -213,6 +216,10 @@ TEST(ManagerConfig, Basic) {
     EXPECT_EQ(mc.coro_pool.initial_size, 5000) << "#fallback does not work";
     EXPECT_FALSE(mc.mlock_debug_info) << "#env does not work with missing substitution vars";
     EXPECT_EQ(mc.coro_pool.stack_size, 1024) << "#env does not work";
+    EXPECT_EQ(mc.event_thread_pool.threads, 3);
+    EXPECT_EQ(mc.event_thread_pool.ev_backend, engine::ev::EvBackend::kIoUring);
+    EXPECT_EQ(mc.event_thread_pool.ev_thread_selection, engine::ev::EvThreadSelection::kLeastLoaded);
+    EXPECT_EQ(mc.event_thread_pool.coarse_timers_resolution, std::chrono::milliseconds{2});
 
     EXPECT_EQ(mc.task_processors.size(), 5);
 
@@ -8,6 +8,7 @@
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/logging/component.hpp>
+#include <utils/jemalloc.hpp>
 
 #include <components/manager.hpp>
 
@@ -47,6 +48,17 @@ void DumpMetric(utils::statistics::Writer& writer, const engine::TaskProcessor&
     }
 
     writer["worker-threads"] = task_processor.GetWorkerCount();
+
+    if (task_processor.GetTimeSlice().count() > 0) {
+        writer["time-slice-overruns"] = task_processor.GetTimeSliceStats();
+    }
+
+    if (const auto arena = task_processor.GetJemallocArena()) {
+        utils::jemalloc::ArenaStats arena_stats;
+        if (!utils::jemalloc::GetArenaStats(*arena, arena_stats)) {
+            writer["jemalloc-arena"] = arena_stats;
+        }
+    }
 }
 
 }  // namespace engine
@@ -90,7 +102,7 @@ void ManagerControllerComponent::WriteStatistics(utils::statistics::Writer& writ
 
     // ev-threads
     const auto& pools_ptr = components_manager_.GetTaskProcessorPools();
-    writer["ev-threads"]["cpu-load-percent"] = pools_ptr->EventThreadPool();
+    writer["ev-threads"] = pools_ptr->EventThreadPool();
 
     // coroutines
     if (auto coro_pool = writer["coro-pool"]) {
@@ -112,6 +124,13 @@ void ManagerControllerComponent::WriteStatistics(utils::statistics::Writer& writ
                                    .count();
     writer["load-ms"] =
         std::chrono::duration_cast<std::chrono::milliseconds>(components_manager_.GetLoadDuration()).count();
+
+    // the per-component construction times are logged on start
+    std::chrono::milliseconds critical_path_duration{0};
+    for (const auto& item : components_manager_.GetComponentsLoadReport().critical_path) {
+        critical_path_duration += item.own_duration;
+    }
+    writer["load-critical-path-ms"] = critical_path_duration.count();
 }
 
 void ManagerControllerComponent::OnConfigUpdate(const dynamic_config::Snapshot& cfg) {
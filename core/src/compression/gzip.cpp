@@ -1,16 +1,95 @@
 #include <compression/gzip.hpp>
 
+#include <stdexcept>
+
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
+#include <fmt/format.h>
+#include <zlib.h>
+
+#include <userver/compression/impl/context_pool.hpp>
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::gzip {
 
+namespace impl {
+
+class CompressionContext final {
+public:
+    CompressionContext() {
+        // 15 is the default window size, +16 makes zlib write the gzip
+        // header and trailer instead of the zlib ones
+        CheckError(deflateInit2(&stream_, kDefaultLevel, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY));
+    }
+
+    CompressionContext(const CompressionContext&) = delete;
+    CompressionContext& operator=(const CompressionContext&) = delete;
+
+    ~CompressionContext() { deflateEnd(&stream_); }
+
+    // Drops the state of the previous use
+    z_stream& Reset(int level) {
+        CheckError(deflateReset(&stream_));
+        if (level != level_) {
+            CheckError(deflateParams(&stream_, level, Z_DEFAULT_STRATEGY));
+            level_ = level;
+        }
+        return stream_;
+    }
+
+    z_stream& Get() noexcept { return stream_; }
+
+    static void CheckError(int ret) {
+        if (ret != Z_OK && ret != Z_BUF_ERROR) {
+            throw std::runtime_error(fmt::format("Compression failed: zlib error {}", ret));
+        }
+    }
+
+private:
+    z_stream stream_{};
+    int level_{kDefaultLevel};
+};
+
+}  // namespace impl
+
 namespace {
+
 constexpr auto kDecompressBufferSize = 1024;
+constexpr std::size_t kCompressBufferSize = 16 * 1024;
+
+using ContextPool = compression::impl::ContextPool<impl::CompressionContext>;
+
+// Runs deflate() until the whole input is consumed and the output for the
+// `flush` mode is written
+std::string CompressStream(impl::CompressionContext& context, std::string_view input, int flush) {
+    auto& stream = context.Get();
+    // zlib does not modify the input
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = static_cast<uInt>(input.size());
+
+    std::string compressed;
+    while (true) {
+        const auto offset = compressed.size();
+        compressed.resize(offset + kCompressBufferSize);
+        stream.next_out = reinterpret_cast<Bytef*>(compressed.data() + offset);
+        stream.avail_out = static_cast<uInt>(kCompressBufferSize);
+
+        const auto ret = deflate(&stream, flush);
+        if (ret != Z_STREAM_END) impl::CompressionContext::CheckError(ret);
+        compressed.resize(compressed.size() - stream.avail_out);
+
+        // The output is complete if deflate() had some space left
+        if (ret == Z_STREAM_END || (stream.avail_out != 0 && flush != Z_FINISH)) break;
+    }
+
+    return compressed;
 }
 
+}  // namespace
+
 std::string Decompress(std::string_view compressed, size_t max_size) {
     std::string decompressed;
 
@@ -41,6 +120,38 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
     return decompressed;
 }
 
+std::string Compress(std::string_view data, int level) {
+    auto context = ContextPool::Pop();
+    context->Reset(level);
+    auto compressed = CompressStream(*context, data, Z_FINISH);
+    ContextPool::Push(std::move(context));
+    return compressed;
+}
+
+StreamCompressor::StreamCompressor(int level) : context_(ContextPool::Pop()) { context_->Reset(level); }
+
+StreamCompressor::StreamCompressor(StreamCompressor&&) noexcept = default;
+
+StreamCompressor& StreamCompressor::operator=(StreamCompressor&& other) noexcept {
+    ContextPool::Push(std::move(context_));
+    context_ = std::move(other.context_);
+    return *this;
+}
+
+StreamCompressor::~StreamCompressor() { ContextPool::Push(std::move(context_)); }
+
+std::string StreamCompressor::Compress(std::string_view chunk) {
+    UINVARIANT(context_, "Compress() is called after Finish()");
+    return CompressStream(*context_, chunk, Z_SYNC_FLUSH);
+}
+
+std::string StreamCompressor::Finish() {
+    UINVARIANT(context_, "Finish() is called twice");
+    auto compressed = CompressStream(*context_, {}, Z_FINISH);
+    ContextPool::Push(std::move(context_));
+    return compressed;
+}
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
@@ -8,10 +10,44 @@ USERVER_NAMESPACE_BEGIN
 
 namespace compression::gzip {
 
+namespace impl {
+class CompressionContext;
+}  // namespace impl
+
+/// Default compression level of zlib
+inline constexpr int kDefaultLevel = 6;
+
 /// Decompresses the string.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string. The compression context is reused by the calls from
+/// the same thread.
+std::string Compress(std::string_view data, int level = kDefaultLevel);
+
+/// @brief Compresses a stream of chunks into a single gzip member.
+///
+/// Output of each Compress() call is flushed, so the receiver may decompress
+/// the data received so far without waiting for the rest of the stream.
+class StreamCompressor final {
+public:
+    explicit StreamCompressor(int level = kDefaultLevel);
+
+    StreamCompressor(StreamCompressor&&) noexcept;
+    StreamCompressor& operator=(StreamCompressor&&) noexcept;
+    ~StreamCompressor();
+
+    /// @returns the compressed data of the chunk
+    std::string Compress(std::string_view chunk);
+
+    /// Ends the gzip member, no more chunks are accepted.
+    /// @returns the rest of the compressed data
+    std::string Finish();
+
+private:
+    std::unique_ptr<impl::CompressionContext> context_;
+};
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
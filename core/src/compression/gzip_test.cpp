@@ -28,4 +28,32 @@ TEST(Gzip, TestOverflow) {
     EXPECT_THROW(compression::gzip::Decompress(compressed, big_msg.size() / 2), compression::TooBigError);
 }
 
+TEST(Gzip, Compress) {
+    const std::string str(16'000, 'a');
+
+    for (const int level : {1, compression::gzip::kDefaultLevel, 9}) {
+        const auto compressed = compression::gzip::Compress(str, level);
+        EXPECT_LT(compressed.size(), str.size());
+        EXPECT_EQ(compression::gzip::Decompress(compressed, str.size()), str);
+    }
+}
+
+TEST(Gzip, StreamCompress) {
+    std::string expected;
+    std::string compressed;
+
+    compression::gzip::StreamCompressor compressor;
+    for (int i = 0; i < 100; ++i) {
+        const auto chunk = "chunk #" + std::to_string(i) + '\n';
+        expected += chunk;
+
+        const auto compressed_chunk = compressor.Compress(chunk);
+        EXPECT_FALSE(compressed_chunk.empty()) << "Chunks are expected to be flushed";
+        compressed += compressed_chunk;
+    }
+    compressed += compressor.Finish();
+
+    EXPECT_EQ(compression::gzip::Decompress(compressed, expected.size()), expected);
+}
+
 USERVER_NAMESPACE_END
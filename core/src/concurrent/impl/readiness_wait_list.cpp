@@ -0,0 +1,54 @@
+#include <userver/concurrent/impl/readiness_wait_list.hpp>
+
+#include <engine/impl/wait_list.hpp>
+#include <engine/task/task_context.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+ReadinessWaitList::ReadinessWaitList(IsReadyFunc is_ready, const void* queue) noexcept
+    : is_ready_(is_ready), queue_(queue) {}
+
+ReadinessWaitList::~ReadinessWaitList() = default;
+
+void ReadinessWaitList::NotifyAll() {
+    // The state change of the queue is an atomic read-modify-write, so either
+    // the waiter observes it, or we observe the waiter (as in Semaphore).
+    if (waiters_count_.load() == 0) return;
+
+    engine::impl::WaitList::Lock lock{*waiters_};
+    waiters_->WakeupAll(lock);
+}
+
+bool ReadinessWaitList::IsReady() const noexcept { return is_ready_(queue_); }
+
+engine::impl::EarlyWakeup ReadinessWaitList::TryAppendWaiter(engine::impl::TaskContext& waiter) {
+    ++waiters_count_;
+
+    engine::impl::WaitList::Lock lock{*waiters_};
+    // A race is not possible here, because check + Append is performed under
+    // WaitList::Lock, and notification also takes WaitList::Lock.
+    if (IsReady()) {
+        --waiters_count_;
+        return engine::impl::EarlyWakeup{true};
+    }
+    waiters_->Append(lock, &waiter);
+    return engine::impl::EarlyWakeup{false};
+}
+
+void ReadinessWaitList::RemoveWaiter(engine::impl::TaskContext& waiter) noexcept {
+    {
+        engine::impl::WaitList::Lock lock{*waiters_};
+        waiters_->Remove(lock, waiter);
+    }
+    --waiters_count_;
+}
+
+void ReadinessWaitList::AfterWait() noexcept {}
+
+void ReadinessWaitList::RethrowErrorResult() const {}
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
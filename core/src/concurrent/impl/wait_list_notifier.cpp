@@ -0,0 +1,91 @@
+#include <userver/concurrent/impl/wait_list_notifier.hpp>
+
+#include <atomic>
+
+#include <engine/impl/wait_list.hpp>
+#include <engine/task/task_context.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+class WaitListNotifier::WaitStrategy final : public engine::impl::WaitStrategy {
+public:
+    WaitStrategy(
+        engine::impl::TaskContext& current,
+        engine::impl::WaitList& waiters,
+        utils::function_ref<bool()> try_action
+    ) noexcept
+        : current_(current), waiters_(waiters), waiter_token_(waiters), try_action_(try_action) {
+        // Pairs with the fence in Notify*: either the waiter observes the state
+        // change, or the notifier observes the waiter.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    engine::impl::EarlyWakeup SetupWakeups() override {
+        engine::impl::WaitList::Lock lock(waiters_);
+        // A race is not possible here, because try + Append is performed under
+        // WaitList::Lock, and notification also takes WaitList::Lock.
+        if (try_action_()) {
+            succeeded_ = true;
+            return engine::impl::EarlyWakeup{true};
+        }
+        waiters_.Append(lock, &current_);
+        return engine::impl::EarlyWakeup{false};
+    }
+
+    void DisableWakeups() noexcept override {
+        engine::impl::WaitList::Lock lock(waiters_);
+        waiters_.Remove(lock, current_);
+    }
+
+    bool HasSucceeded() const noexcept { return succeeded_; }
+
+private:
+    engine::impl::TaskContext& current_;
+    engine::impl::WaitList& waiters_;
+    const engine::impl::WaitList::WaitersScopeCounter waiter_token_;
+    const utils::function_ref<bool()> try_action_;
+    bool succeeded_{false};
+};
+
+WaitListNotifier::WaitListNotifier() noexcept = default;
+
+WaitListNotifier::~WaitListNotifier() = default;
+
+void WaitListNotifier::NotifyOne() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters_->GetCountOfSleepies()) {
+        engine::impl::WaitList::Lock lock{*waiters_};
+        waiters_->WakeupOne(lock);
+    }
+}
+
+void WaitListNotifier::NotifyAll() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters_->GetCountOfSleepies()) {
+        engine::impl::WaitList::Lock lock{*waiters_};
+        waiters_->WakeupAll(lock);
+    }
+}
+
+bool WaitListNotifier::WaitUntilSlowPath(engine::Deadline deadline, utils::function_ref<bool()> try_action) {
+    auto& current = engine::current_task::GetCurrentTaskContext();
+    WaitStrategy wait_strategy{current, *waiters_, try_action};
+
+    while (true) {
+        const auto wakeup_source = current.Sleep(wait_strategy, deadline);
+        if (wait_strategy.HasSucceeded()) return true;
+
+        if (!engine::impl::HasWaitSucceeded(wakeup_source)) {
+            // The wakeup might have been meant for us, pass it on to avoid
+            // leaving another waiter asleep next to a ready state.
+            NotifyOne();
+            return false;
+        }
+    }
+}
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
@@ -129,6 +129,10 @@ BENCHMARK_TEMPLATE(QueueProduce, concurrent::impl::UnfairUnboundedNonFifoMpmcQue
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 4}, {kUnbounded, kUnbounded}});
 
+BENCHMARK_TEMPLATE(QueueProduce, concurrent::BoundedMpmcQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {1, 4}, {128, 512}});
+
 BENCHMARK_TEMPLATE(QueueConsume, concurrent::NonFifoMpmcQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 1}, {128, 512}});
@@ -141,6 +145,10 @@ BENCHMARK_TEMPLATE(QueueConsume, concurrent::impl::UnfairUnboundedNonFifoMpmcQue
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 1}, {kUnbounded, kUnbounded}});
 
+BENCHMARK_TEMPLATE(QueueConsume, concurrent::BoundedMpmcQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {1, 1}, {128, 512}});
+
 BENCHMARK_TEMPLATE(QueueProduce, concurrent::NonFifoMpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 1}, {kUnbounded, kUnbounded}});
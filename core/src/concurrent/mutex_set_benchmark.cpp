@@ -2,6 +2,7 @@
 
 #include <array>
 #include <atomic>
+#include <shared_mutex>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -174,6 +175,67 @@ void mutex_set_8ways_lock_unlock_contention(benchmark::State& state) {
 BENCHMARK_TEMPLATE(mutex_set_8ways_lock_unlock_contention, int)->RangeMultiplier(2)->Range(1, 8);
 BENCHMARK_TEMPLATE(mutex_set_8ways_lock_unlock_contention, std::string)->RangeMultiplier(2)->Range(1, 8);
 
+template <typename MutexSetType, bool IsShared>
+void RunKeyCardinalityBenchmark(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        const std::size_t keys_count = state.range(1);
+        MutexSetType ms(8, 16);
+
+        const auto do_work = [&](std::size_t& key) {
+            key = (key + 7919) % keys_count;
+            auto mutex = ms.GetMutexForKey(key);
+            if constexpr (IsShared) {
+                std::shared_lock lock(mutex);
+                benchmark::DoNotOptimize(lock);
+            } else {
+                std::unique_lock lock(mutex);
+                benchmark::DoNotOptimize(lock);
+            }
+        };
+
+        const std::size_t concurrent_jobs = state.range(0);
+        std::atomic<bool> keep_running{true};
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve(concurrent_jobs);
+
+        for (std::size_t thread_id = 1; thread_id < concurrent_jobs; ++thread_id) {
+            tasks.push_back(engine::AsyncNoSpan([&, thread_id] {
+                std::size_t key = thread_id;
+                while (keep_running) {
+                    do_work(key);
+                }
+            }));
+        }
+
+        std::size_t key = 0;
+        for ([[maybe_unused]] auto _ : state) {
+            do_work(key);
+        }
+
+        keep_running = false;
+
+        for (auto& task : tasks) {
+            task.Get();
+        }
+    });
+}
+
+void mutex_set_key_cardinality(benchmark::State& state) {
+    RunKeyCardinalityBenchmark<concurrent::MutexSet<std::size_t>, false>(state);
+}
+
+void shared_mutex_set_key_cardinality_exclusive(benchmark::State& state) {
+    RunKeyCardinalityBenchmark<concurrent::SharedMutexSet<std::size_t>, false>(state);
+}
+
+void shared_mutex_set_key_cardinality_shared(benchmark::State& state) {
+    RunKeyCardinalityBenchmark<concurrent::SharedMutexSet<std::size_t>, true>(state);
+}
+
+BENCHMARK(mutex_set_key_cardinality)->ArgsProduct({{1, 2, 4, 8}, {1, 16, 1024, 65536}});
+BENCHMARK(shared_mutex_set_key_cardinality_exclusive)->ArgsProduct({{1, 2, 4, 8}, {1, 16, 1024, 65536}});
+BENCHMARK(shared_mutex_set_key_cardinality_shared)->ArgsProduct({{1, 2, 4, 8}, {1, 16, 1024, 65536}});
+
 }  // namespace
 
 USERVER_NAMESPACE_END
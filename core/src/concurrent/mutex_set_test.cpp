@@ -1,5 +1,9 @@
 #include <userver/utest/utest.hpp>
 
+#include <numeric>
+#include <shared_mutex>
+#include <vector>
+
 #include <userver/concurrent/mutex_set.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/utils/async.hpp>
@@ -145,4 +149,114 @@ UTEST_MT(MutexSet, HighContention, 4) {
     }
 }
 
+UTEST(MutexSet, TryLockForTimeoutKeepsOtherWaiters) {
+    concurrent::MutexSet ms;
+    auto m1 = ms.GetMutexForKey("123");
+    auto m2 = ms.GetMutexForKey("123");
+    ASSERT_TRUE(m1.try_lock());
+
+    auto waiter = engine::AsyncNoSpan([&m2] {
+        m2.lock();
+        m2.unlock();
+    });
+    EXPECT_FALSE(ms.GetMutexForKey("123").try_lock_for(std::chrono::milliseconds{10}));
+
+    m1.unlock();
+    UEXPECT_NO_THROW(waiter.Get());
+    EXPECT_TRUE(m1.try_lock());
+    m1.unlock();
+}
+
+UTEST(SharedMutexSet, SharedLock) {
+    concurrent::SharedMutexSet ms;
+    auto m1 = ms.GetMutexForKey("123");
+    auto m2 = ms.GetMutexForKey("123");
+
+    std::shared_lock lock1(m1);
+    std::shared_lock lock2(m2);
+    EXPECT_FALSE(m1.try_lock());
+    EXPECT_TRUE(ms.GetMutexForKey("1234").try_lock());
+    ms.GetMutexForKey("1234").unlock();
+}
+
+UTEST(SharedMutexSet, ExclusiveLock) {
+    concurrent::SharedMutexSet ms;
+    auto m1 = ms.GetMutexForKey("123");
+    auto m2 = ms.GetMutexForKey("123");
+
+    {
+        std::unique_lock lock(m1);
+        EXPECT_FALSE(m2.try_lock_shared());
+        EXPECT_FALSE(m2.try_lock_shared_for(std::chrono::milliseconds{10}));
+    }
+
+    EXPECT_TRUE(m2.try_lock_shared());
+    m2.unlock_shared();
+}
+
+UTEST_MT(SharedMutexSet, WritersArePreferred, 2) {
+    concurrent::SharedMutexSet ms;
+    auto reader = ms.GetMutexForKey("123");
+    auto writer = ms.GetMutexForKey("123");
+
+    reader.lock_shared();
+    auto writer_task = engine::AsyncNoSpan([&writer] { std::unique_lock lock(writer); });
+    engine::SleepFor(std::chrono::milliseconds{10});
+
+    // The writer waits, so the new readers wait too
+    EXPECT_FALSE(ms.GetMutexForKey("123").try_lock_shared());
+
+    reader.unlock_shared();
+    UEXPECT_NO_THROW(writer_task.Get());
+    EXPECT_TRUE(reader.try_lock_shared());
+    reader.unlock_shared();
+}
+
+UTEST(SharedMutexSet, WriterTimeoutUnblocksReaders) {
+    concurrent::SharedMutexSet ms;
+    auto reader = ms.GetMutexForKey("123");
+
+    reader.lock_shared();
+    auto second_reader = engine::AsyncNoSpan([&ms] {
+        engine::SleepFor(std::chrono::milliseconds{5});
+        auto mutex = ms.GetMutexForKey("123");
+        std::shared_lock lock(mutex);
+    });
+    EXPECT_FALSE(ms.GetMutexForKey("123").try_lock_for(std::chrono::milliseconds{20}));
+
+    UEXPECT_NO_THROW(second_reader.Get());
+    reader.unlock_shared();
+}
+
+UTEST_MT(SharedMutexSet, HighContention, 4) {
+    constexpr std::size_t kKeysCount = 16;
+    constexpr std::size_t kIterations = 1000;
+    const auto concurrent_jobs = GetThreadCount();
+    concurrent::SharedMutexSet<int> ms(4);
+    std::vector<int> values(kKeysCount, 0);
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(concurrent_jobs);
+    for (std::size_t thread_no = 0; thread_no < concurrent_jobs; ++thread_no) {
+        tasks.push_back(engine::AsyncNoSpan([&, thread_no] {
+            for (std::size_t i = 0; i < kIterations; ++i) {
+                const auto key = static_cast<int>((i + thread_no) % kKeysCount);
+                auto mutex = ms.GetMutexForKey(key);
+                if (i % 4 == 0) {
+                    std::unique_lock lock(mutex);
+                    ++values[key];
+                } else {
+                    std::shared_lock lock(mutex);
+                    EXPECT_GE(values[key], 0);
+                }
+            }
+        }));
+    }
+
+    for (auto& task : tasks) {
+        UEXPECT_NO_THROW(task.Get());
+    }
+    EXPECT_EQ(std::accumulate(values.begin(), values.end(), std::size_t{0}), concurrent_jobs * kIterations / 4);
+}
+
 USERVER_NAMESPACE_END
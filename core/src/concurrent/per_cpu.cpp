@@ -0,0 +1,154 @@
+#include <userver/concurrent/per_cpu.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+#include <concurrent/impl/rseq.hpp>
+#include <concurrent/impl/striped_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+namespace {
+
+template <typename Better>
+void AtomicUpdate(std::atomic<std::intptr_t>& target, std::intptr_t value, Better better) noexcept {
+    auto current = target.load(std::memory_order_relaxed);
+    while (better(value, current)) {
+        if (target.compare_exchange_weak(current, value, std::memory_order_relaxed)) break;
+    }
+}
+
+const auto kIsLess = [](std::intptr_t lhs, std::intptr_t rhs) { return lhs < rhs; };
+const auto kIsGreater = [](std::intptr_t lhs, std::intptr_t rhs) { return lhs > rhs; };
+
+#ifdef USERVER_IMPL_HAS_RSEQ
+
+const auto kWrappingSum = [](std::intptr_t lhs, std::intptr_t rhs) {
+    // Unsigned wrapping is perfectly defined
+    return static_cast<std::intptr_t>(static_cast<std::uintptr_t>(lhs) + static_cast<std::uintptr_t>(rhs));
+};
+
+template <typename Better>
+void RseqUpdate(
+    StripedArray& words,
+    std::atomic<std::intptr_t>& fallback,
+    std::intptr_t value,
+    Better better
+) noexcept {
+    while (true) {
+        const auto cpu_id = rseq_cpu_start();
+        if (!IsCpuIdValid(cpu_id)) break;
+
+        auto& word = words[cpu_id];
+        const auto current = __atomic_load_n(&word, __ATOMIC_RELAXED);
+        if (!better(value, current)) return;
+
+        const auto ret = rseq_load_cbne_store__ptr(RSEQ_MO_RELAXED, RSEQ_PERCPU_CPU_ID, &word, current, value, cpu_id);
+        if (rseq_likely(ret == 0)) return;
+        // Another task on the same CPU has changed the value first, retry
+        if (ret > 0) continue;
+        break;
+    }
+
+    AtomicUpdate(fallback, value, better);
+}
+
+template <typename Combine>
+std::intptr_t Fold(const StripedArray& words, const std::atomic<std::intptr_t>& fallback, Combine combine) noexcept {
+    auto result = fallback.load(std::memory_order_acquire);
+    for (const auto& word : words.Elements()) {
+        // Ideally this should be a std::atomic_ref, of course
+        result = combine(result, __atomic_load_n(&word, __ATOMIC_ACQUIRE));
+    }
+    return result;
+}
+
+#endif
+
+}  // namespace
+
+#ifdef USERVER_IMPL_HAS_RSEQ
+
+struct PerCpuWords::Impl final {
+    explicit Impl(std::intptr_t identity) : identity(identity), fallback(identity) {
+        for (auto& word : words.Elements()) word = identity;
+    }
+
+    // Note that the per-CPU words are not atomic, see StripedCounter for the
+    // details. rseq unavailability is handled with the atomic fallback.
+    const std::intptr_t identity;
+    StripedArray words;
+    std::atomic<std::intptr_t> fallback;
+};
+
+void PerCpuWords::Add(std::intptr_t value) noexcept {
+    const auto cpu_id = rseq_cpu_start();
+    if (!IsCpuIdValid(cpu_id)) {
+        impl_->fallback.fetch_add(value, std::memory_order_relaxed);
+        return;
+    }
+
+    const auto ret =
+        rseq_load_add_store__ptr(RSEQ_MO_RELAXED, RSEQ_PERCPU_CPU_ID, &impl_->words[cpu_id], value, cpu_id);
+    if (rseq_likely(!ret)) return;
+
+    impl_->fallback.fetch_add(value, std::memory_order_relaxed);
+}
+
+void PerCpuWords::UpdateMin(std::intptr_t value) noexcept { RseqUpdate(impl_->words, impl_->fallback, value, kIsLess); }
+
+void PerCpuWords::UpdateMax(std::intptr_t value) noexcept {
+    RseqUpdate(impl_->words, impl_->fallback, value, kIsGreater);
+}
+
+std::intptr_t PerCpuWords::ReadSum() const noexcept { return Fold(impl_->words, impl_->fallback, kWrappingSum); }
+
+std::intptr_t PerCpuWords::ReadMin() const noexcept {
+    return Fold(impl_->words, impl_->fallback, [](std::intptr_t lhs, std::intptr_t rhs) { return std::min(lhs, rhs); });
+}
+
+std::intptr_t PerCpuWords::ReadMax() const noexcept {
+    return Fold(impl_->words, impl_->fallback, [](std::intptr_t lhs, std::intptr_t rhs) { return std::max(lhs, rhs); });
+}
+
+void PerCpuWords::Reset() noexcept {
+    for (auto& word : impl_->words.Elements()) {
+        __atomic_store_n(&word, impl_->identity, __ATOMIC_RELAXED);
+    }
+    impl_->fallback.store(impl_->identity, std::memory_order_relaxed);
+}
+
+#else
+
+struct PerCpuWords::Impl final {
+    explicit Impl(std::intptr_t identity) : identity(identity), value(identity) {}
+
+    const std::intptr_t identity;
+    std::atomic<std::intptr_t> value;
+};
+
+void PerCpuWords::Add(std::intptr_t value) noexcept { impl_->value.fetch_add(value, std::memory_order_relaxed); }
+
+void PerCpuWords::UpdateMin(std::intptr_t value) noexcept { AtomicUpdate(impl_->value, value, kIsLess); }
+
+void PerCpuWords::UpdateMax(std::intptr_t value) noexcept { AtomicUpdate(impl_->value, value, kIsGreater); }
+
+std::intptr_t PerCpuWords::ReadSum() const noexcept { return impl_->value.load(std::memory_order_acquire); }
+
+std::intptr_t PerCpuWords::ReadMin() const noexcept { return impl_->value.load(std::memory_order_acquire); }
+
+std::intptr_t PerCpuWords::ReadMax() const noexcept { return impl_->value.load(std::memory_order_acquire); }
+
+void PerCpuWords::Reset() noexcept { impl_->value.store(impl_->identity, std::memory_order_relaxed); }
+
+#endif
+
+PerCpuWords::PerCpuWords(std::intptr_t identity) : impl_(identity) {}
+
+PerCpuWords::~PerCpuWords() = default;
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,107 @@
+#include <userver/concurrent/per_cpu.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kThreads = 32;
+
+}  // namespace
+
+TEST(PerCpu, Sum) {
+    concurrent::PerCpu<std::int64_t> sum;
+    EXPECT_EQ(sum.Read(), 0);
+
+    sum.Update(5);
+    sum.Update(-7);
+    EXPECT_EQ(sum.Read(), -2);
+
+    sum.Reset();
+    EXPECT_EQ(sum.Read(), 0);
+}
+
+TEST(PerCpu, Min) {
+    concurrent::PerCpu<int, concurrent::PerCpuOp::kMin> min;
+    EXPECT_EQ(min.Read(), std::numeric_limits<int>::max());
+
+    min.Update(3);
+    min.Update(-4);
+    min.Update(10);
+    EXPECT_EQ(min.Read(), -4);
+
+    min.Reset();
+    EXPECT_EQ(min.Read(), std::numeric_limits<int>::max());
+}
+
+TEST(PerCpu, Max) {
+    concurrent::PerCpu<std::int16_t, concurrent::PerCpuOp::kMax> max;
+    EXPECT_EQ(max.Read(), std::numeric_limits<std::int16_t>::min());
+
+    max.Update(3);
+    max.Update(-4);
+    EXPECT_EQ(max.Read(), 3);
+}
+
+TEST(PerCpu, WideUnsigned) {
+    constexpr auto kBig = std::numeric_limits<std::uint64_t>::max() - 1;
+
+    concurrent::PerCpu<std::uint64_t, concurrent::PerCpuOp::kMax> max;
+    max.Update(1);
+    max.Update(kBig);
+    EXPECT_EQ(max.Read(), kBig);
+
+    concurrent::PerCpu<std::uint64_t, concurrent::PerCpuOp::kMin> min;
+    min.Update(kBig);
+    min.Update(1);
+    EXPECT_EQ(min.Read(), 1);
+
+    concurrent::PerCpu<std::uint64_t> sum;
+    sum.Update(kBig);
+    sum.Update(3);
+    EXPECT_EQ(sum.Read(), 1);
+}
+
+UTEST_MT(PerCpu, Stress, kThreads + 1) {
+    const auto test_deadline = engine::Deadline::FromDuration(std::chrono::milliseconds{100});
+    std::atomic<bool> keep_running{true};
+    concurrent::PerCpu<std::uint64_t> sum;
+    concurrent::PerCpu<std::int64_t, concurrent::PerCpuOp::kMin> min;
+    concurrent::PerCpu<std::int64_t, concurrent::PerCpuOp::kMax> max;
+
+    auto tasks = utils::GenerateFixedArray(kThreads, [&](std::size_t index) {
+        return engine::AsyncNoSpan([&, index] {
+            const auto value = static_cast<std::int64_t>(index);
+            std::uint64_t local_counter = 0;
+            while (keep_running.load(std::memory_order_acquire)) {
+                sum.Update(1);
+                min.Update(-value);
+                max.Update(value);
+                ++local_counter;
+            }
+            return local_counter;
+        });
+    });
+
+    engine::SleepUntil(test_deadline);
+    keep_running = false;
+    std::uint64_t total_count = 0;
+    for (auto& task : tasks) {
+        UEXPECT_NO_THROW(total_count += task.Get());
+    }
+
+    EXPECT_EQ(sum.Read(), total_count);
+    EXPECT_EQ(min.Read(), -static_cast<std::int64_t>(kThreads - 1));
+    EXPECT_EQ(max.Read(), static_cast<std::int64_t>(kThreads - 1));
+}
+
+USERVER_NAMESPACE_END
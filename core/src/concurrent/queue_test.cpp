@@ -1,5 +1,6 @@
 #include <userver/concurrent/queue.hpp>
 
+#include <numeric>
 #include <optional>
 #include <unordered_set>
 
@@ -400,4 +401,167 @@ TYPED_UTEST_MT(MpMcQueueFixture, MultiConsumerToken, kProducersCount + kConsumer
     EXPECT_EQ(total.size(), kProducersCount * kMessageCount) << "Likely missing messages";
 }
 
+UTEST(BoundedMpmcQueue, CapacityIsRoundedUp) {
+    auto queue = concurrent::BoundedMpmcQueue<int>::Create(10);
+    auto producer = queue->GetProducer();
+    auto consumer = queue->GetConsumer();
+
+    EXPECT_EQ(queue->GetSoftMaxSize(), 16);
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_TRUE(producer.PushNoblock(int{i}));
+    }
+    EXPECT_FALSE(producer.PushNoblock(16));
+    EXPECT_EQ(queue->GetSizeApproximate(), 16);
+
+    int value{};
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_TRUE(consumer.PopNoblock(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(consumer.PopNoblock(value));
+}
+
+UTEST(BoundedMpmcQueue, PushWaitsForNonFullness) {
+    auto queue = concurrent::BoundedMpmcQueue<int>::Create(2);
+    auto producer = queue->GetProducer();
+    auto consumer = queue->GetConsumer();
+
+    EXPECT_TRUE(producer.Push(0));
+    EXPECT_TRUE(producer.Push(1));
+    EXPECT_FALSE(producer.Push(2, engine::Deadline::FromDuration(std::chrono::milliseconds{10})));
+
+    auto task = utils::Async("producer", [&producer] { return producer.Push(2); });
+    engine::Yield();
+
+    int value{};
+    EXPECT_TRUE(consumer.Pop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(task.Get());
+
+    EXPECT_TRUE(consumer.Pop(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(consumer.Pop(value));
+    EXPECT_EQ(value, 2);
+}
+
+UTEST(BoundedMpmcQueue, PushManyPopMany) {
+    auto queue = concurrent::BoundedMpmcQueue<std::unique_ptr<int>>::Create(4);
+    auto producer = queue->GetProducer();
+    auto consumer = queue->GetConsumer();
+
+    std::vector<std::unique_ptr<int>> values;
+    for (int i = 0; i < 6; ++i) values.push_back(std::make_unique<int>(i));
+
+    EXPECT_EQ(producer.PushManyNoblock(values), 4);
+    EXPECT_FALSE(values[0]);
+    ASSERT_TRUE(values[4]);
+
+    std::vector<std::unique_ptr<int>> popped(3);
+    ASSERT_EQ(consumer.PopMany(popped), 3);
+    for (int i = 0; i < 3; ++i) EXPECT_EQ(*popped[i], i);
+
+    EXPECT_EQ(producer.PushMany(utils::span<std::unique_ptr<int>>{values}.subspan(4)), 2);
+
+    popped.resize(8);
+    ASSERT_EQ(consumer.PopManyNoblock(popped), 3);
+    for (int i = 0; i < 3; ++i) EXPECT_EQ(*popped[i], i + 3);
+}
+
+UTEST(BoundedMpmcQueue, ConsumerIsDead) {
+    auto queue = concurrent::BoundedMpmcQueue<int>::Create(1);
+    auto producer = queue->GetProducer();
+
+    EXPECT_TRUE(producer.Push(0));
+    EXPECT_TRUE(producer.Push(1));
+
+    auto task = utils::Async("producer", [&producer] { return producer.Push(2); });
+    engine::Yield();
+
+    (void)(queue->GetConsumer());
+    EXPECT_FALSE(task.Get());
+    EXPECT_FALSE(producer.Push(3));
+}
+
+UTEST(BoundedMpmcQueue, ProducerIsDead) {
+    auto queue = concurrent::BoundedMpmcQueue<int>::Create(4);
+    auto consumer = queue->GetConsumer();
+
+    {
+        auto producer = queue->GetProducer();
+        EXPECT_TRUE(producer.Push(0));
+    }
+
+    std::vector<int> values(4);
+    EXPECT_EQ(consumer.PopMany(values), 1);
+    EXPECT_EQ(consumer.PopMany(values), 0);
+}
+
+UTEST_MT(BoundedMpmcQueue, Mpmc, kProducersCount + kConsumersCount) {
+    auto queue = concurrent::BoundedMpmcQueue<std::size_t>::Create(16);
+    std::vector<concurrent::BoundedMpmcQueue<std::size_t>::Producer> producers;
+    producers.reserve(kProducersCount);
+    for (std::size_t i = 0; i < kProducersCount; ++i) {
+        producers.emplace_back(queue->GetProducer());
+    }
+
+    std::vector<engine::TaskWithResult<void>> producers_tasks;
+    producers_tasks.reserve(kProducersCount);
+    for (std::size_t i = 0; i < kProducersCount; ++i) {
+        if (i % 2 == 0) {
+            producers_tasks.push_back(GetProducerTask(producers[i], i));
+            continue;
+        }
+        producers_tasks.push_back(utils::Async("batch_producer", [&producer = producers[i], i] {
+            std::vector<std::size_t> messages(kMessageCount);
+            std::iota(messages.begin(), messages.end(), i * kMessageCount);
+            ASSERT_EQ(producer.PushMany(messages), kMessageCount);
+        }));
+    }
+
+    std::vector<concurrent::BoundedMpmcQueue<std::size_t>::Consumer> consumers;
+    consumers.reserve(kConsumersCount);
+    for (std::size_t i = 0; i < kConsumersCount; ++i) {
+        consumers.emplace_back(queue->GetConsumer());
+    }
+
+    std::vector<int> consumed_messages(kMessageCount * kProducersCount, 0);
+    engine::Mutex mutex;
+
+    std::vector<engine::TaskWithResult<void>> consumers_tasks;
+    consumers_tasks.reserve(kConsumersCount);
+    for (std::size_t i = 0; i < kConsumersCount; ++i) {
+        consumers_tasks.push_back(utils::Async("consumer", [&consumer = consumers[i], &consumed_messages, &mutex] {
+            std::vector<std::size_t> values(5);
+            while (const auto count = consumer.PopMany(values)) {
+                const std::lock_guard lock(mutex);
+                for (std::size_t j = 0; j < count; ++j) ++consumed_messages[values[j]];
+            }
+        }));
+    }
+
+    for (auto& task : producers_tasks) {
+        task.Get();
+    }
+    producers.clear();
+
+    for (auto& task : consumers_tasks) {
+        task.Get();
+    }
+
+    ASSERT_TRUE(std::all_of(consumed_messages.begin(), consumed_messages.end(), [](int item) { return item == 1; }));
+}
+
+UTEST(NonFifoMpmcQueue, PushManyPopMany) {
+    auto queue = concurrent::NonFifoMpmcQueue<int>::Create(3);
+    auto producer = queue->GetProducer();
+    auto consumer = queue->GetConsumer();
+
+    std::vector<int> values{0, 1, 2, 3};
+    EXPECT_EQ(producer.PushManyNoblock(values), 3);
+
+    std::vector<int> popped(8);
+    ASSERT_EQ(consumer.PopMany(popped), 3);
+    for (int i = 0; i < 3; ++i) EXPECT_EQ(popped[i], i);
+}
+
 USERVER_NAMESPACE_END
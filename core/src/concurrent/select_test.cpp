@@ -0,0 +1,102 @@
+#include <userver/concurrent/select.hpp>
+
+#include <userver/concurrent/mpsc_queue.hpp>
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::milliseconds kSmallTimeout{10};
+
+}  // namespace
+
+UTEST(Select, ReadyConsumer) {
+    auto first_queue = concurrent::SpscQueue<int>::Create();
+    auto second_queue = concurrent::MpscQueue<int>::Create();
+    auto first_consumer = first_queue->GetConsumer();
+    auto second_consumer = second_queue->GetConsumer();
+    auto first_producer = first_queue->GetProducer();
+    auto second_producer = second_queue->GetProducer();
+
+    ASSERT_TRUE(second_producer.Push(1));
+    EXPECT_EQ(concurrent::Select(first_consumer, second_consumer), 1);
+
+    int value{};
+    ASSERT_TRUE(second_consumer.PopNoblock(value));
+    EXPECT_EQ(value, 1);
+
+    ASSERT_TRUE(first_producer.Push(2));
+    EXPECT_EQ(concurrent::Select(first_consumer, second_consumer), 0);
+}
+
+UTEST_MT(Select, WaitsForPush, 2) {
+    auto first_queue = concurrent::NonFifoMpmcQueue<int>::Create();
+    auto second_queue = concurrent::BoundedMpmcQueue<int>::Create(4);
+    auto first_consumer = first_queue->GetConsumer();
+    auto second_consumer = second_queue->GetConsumer();
+    auto first_producer = first_queue->GetProducer();
+    auto second_producer = second_queue->GetProducer();
+
+    auto task = utils::Async("producer", [&second_producer] {
+        engine::SleepFor(kSmallTimeout);
+        ASSERT_TRUE(second_producer.Push(1));
+    });
+
+    EXPECT_EQ(concurrent::Select(first_consumer, second_consumer), 1);
+
+    int value{};
+    EXPECT_TRUE(second_consumer.PopNoblock(value));
+    EXPECT_EQ(value, 1);
+    task.Get();
+}
+
+UTEST(Select, Event) {
+    auto queue = concurrent::SpscQueue<int>::Create();
+    auto consumer = queue->GetConsumer();
+    auto producer = queue->GetProducer();
+    engine::SingleConsumerEvent event;
+
+    auto task = utils::Async("sender", [&event] { event.Send(); });
+
+    EXPECT_EQ(concurrent::Select(consumer, event), 1);
+    // Select does not reset the signal
+    EXPECT_TRUE(event.WaitForEventFor(std::chrono::seconds{0}));
+    task.Get();
+}
+
+UTEST(Select, ProducersAreDead) {
+    auto queue = concurrent::SpmcQueue<int>::Create();
+    auto consumer = queue->GetConsumer();
+    engine::SingleConsumerEvent event;
+
+    (void)queue->GetProducer();
+
+    EXPECT_EQ(concurrent::Select(event, consumer), 1);
+    int value{};
+    EXPECT_FALSE(consumer.Pop(value));
+}
+
+UTEST(Select, Timeout) {
+    auto queue = concurrent::MpscQueue<int>::Create();
+    auto consumer = queue->GetConsumer();
+    auto producer = queue->GetProducer();
+    engine::SingleConsumerEvent event;
+
+    EXPECT_EQ(concurrent::SelectFor(kSmallTimeout, consumer, event), std::nullopt);
+}
+
+UTEST(Select, Cancellation) {
+    auto queue = concurrent::MpscQueue<int>::Create();
+    auto consumer = queue->GetConsumer();
+    auto producer = queue->GetProducer();
+
+    engine::current_task::GetCancellationToken().RequestCancel();
+    EXPECT_EQ(concurrent::Select(consumer), std::nullopt);
+}
+
+USERVER_NAMESPACE_END
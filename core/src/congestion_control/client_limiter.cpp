@@ -0,0 +1,178 @@
+#include <userver/congestion_control/client_limiter.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control {
+
+namespace {
+
+// Bounds of the latency gradient. The limit is never decreased more than
+// twice on a single sample, and never grows faster than the queue_size.
+constexpr double kMinGradient = 0.5;
+constexpr double kMaxGradient = 1.0;
+
+// Multiplicative decrease on the calls failed because of the overload
+constexpr double kDropBackoffRatio = 0.9;
+
+}  // namespace
+
+ClientLimiterConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientLimiterConfig>) {
+    ClientLimiterConfig result;
+    result.initial_limit = value["initial-limit"].As<std::size_t>(result.initial_limit);
+    result.min_limit = value["min-limit"].As<std::size_t>(result.min_limit);
+    result.max_limit = value["max-limit"].As<std::size_t>(result.max_limit);
+    result.smoothing = value["smoothing"].As<double>(result.smoothing);
+    result.rtt_tolerance = value["rtt-tolerance"].As<double>(result.rtt_tolerance);
+    result.long_window = value["long-window"].As<std::size_t>(result.long_window);
+    result.queue_size = value["queue-size"].As<std::size_t>(result.queue_size);
+
+    if (result.min_limit == 0 || result.min_limit > result.initial_limit || result.initial_limit > result.max_limit) {
+        throw std::runtime_error(fmt::format(
+            "Invalid concurrency limits in '{}': 0 < min-limit ({}) <= initial-limit ({}) <= max-limit ({}) is "
+            "expected",
+            value.GetPath(),
+            result.min_limit,
+            result.initial_limit,
+            result.max_limit
+        ));
+    }
+    if (result.smoothing <= 0 || result.smoothing > 1 || result.rtt_tolerance < 1 || result.long_window == 0) {
+        throw std::runtime_error(fmt::format(
+            "Invalid concurrency limiter settings in '{}': 0 < smoothing <= 1, rtt-tolerance >= 1 and "
+            "long-window > 0 are expected",
+            value.GetPath()
+        ));
+    }
+    return result;
+}
+
+ClientLimiter::Token::Token(ClientLimiter& limiter) noexcept
+    : limiter_(&limiter), start_(utils::datetime::SteadyNow()) {}
+
+ClientLimiter::Token::Token(Token&& other) noexcept
+    : limiter_(std::exchange(other.limiter_, nullptr)), start_(other.start_) {}
+
+ClientLimiter::Token& ClientLimiter::Token::operator=(Token&& other) noexcept {
+    if (this != &other) {
+        if (limiter_) --limiter_->inflight_;
+        limiter_ = std::exchange(other.limiter_, nullptr);
+        start_ = other.start_;
+    }
+    return *this;
+}
+
+ClientLimiter::Token::~Token() {
+    if (limiter_) --limiter_->inflight_;
+}
+
+void ClientLimiter::Token::OnSuccess() noexcept { Release(false); }
+
+void ClientLimiter::Token::OnDropped() noexcept { Release(true); }
+
+void ClientLimiter::Token::Release(bool dropped) noexcept {
+    UASSERT_MSG(limiter_, "The outcome of the call is reported twice");
+    if (!limiter_) return;
+    std::exchange(limiter_, nullptr)->Release(utils::datetime::SteadyNow() - start_, dropped);
+}
+
+ClientLimiter::ClientLimiter(const ClientLimiterConfig& config)
+    : config_(config),
+      limit_(config.initial_limit),
+      estimated_limit_(static_cast<double>(config.initial_limit)) {}
+
+std::optional<ClientLimiter::Token> ClientLimiter::TryAcquire() {
+    auto inflight = inflight_.load();
+    do {
+        if (inflight >= limit_.load()) {
+            ++rejected_;
+            return std::nullopt;
+        }
+    } while (!inflight_.compare_exchange_weak(inflight, inflight + 1));
+    return Token{*this};
+}
+
+std::size_t ClientLimiter::GetLimit() const noexcept { return limit_.load(); }
+
+std::size_t ClientLimiter::GetInflight() const noexcept { return inflight_.load(); }
+
+std::uint64_t ClientLimiter::GetRejected() const noexcept { return rejected_.load(); }
+
+void ClientLimiter::Release(std::chrono::steady_clock::duration latency, bool dropped) noexcept {
+    // The call is still accounted as in-flight to detect that the limit is not
+    // reached by the callers
+    const auto inflight = inflight_.load();
+
+    {
+        const std::lock_guard lock{mutex_};
+        auto new_limit = estimated_limit_;
+
+        if (dropped) {
+            new_limit *= kDropBackoffRatio;
+        } else {
+            const auto latency_us = std::max(
+                static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(latency).count()), 1.0
+            );
+
+            // Plain average during the warmup, exponential moving average later
+            if (samples_ < config_.long_window) ++samples_;
+            long_latency_us_ += (latency_us - long_latency_us_) / static_cast<double>(samples_);
+
+            // Do not grow the limit if the callers do not use it, otherwise the
+            // limit grows infinitely on a low load
+            const bool is_app_limited = static_cast<double>(inflight) * 2 < estimated_limit_;
+            const auto gradient =
+                std::clamp(config_.rtt_tolerance * long_latency_us_ / latency_us, kMinGradient, kMaxGradient);
+            if (!is_app_limited || gradient < kMaxGradient) {
+                new_limit = estimated_limit_ * gradient + static_cast<double>(config_.queue_size);
+            }
+        }
+
+        new_limit = estimated_limit_ * (1 - config_.smoothing) + new_limit * config_.smoothing;
+        estimated_limit_ = std::clamp(
+            new_limit, static_cast<double>(config_.min_limit), static_cast<double>(config_.max_limit)
+        );
+        limit_.store(static_cast<std::size_t>(std::lround(estimated_limit_)));
+    }
+
+    --inflight_;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const ClientLimiter& limiter) {
+    writer["limit"] = limiter.GetLimit();
+    writer["inflight"] = limiter.GetInflight();
+    writer["rejected"] = limiter.GetRejected();
+}
+
+ClientLimiters::ClientLimiters(const ClientLimiterConfig& config) : config_(config) {}
+
+ClientLimiters::~ClientLimiters() = default;
+
+ClientLimiter& ClientLimiters::GetLimiter(std::string_view destination) {
+    const std::lock_guard lock{mutex_};
+    auto& limiter = limiters_[std::string{destination}];
+    if (!limiter) limiter = std::make_unique<ClientLimiter>(config_);
+    return *limiter;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const ClientLimiters& limiters) {
+    const std::lock_guard lock{limiters.mutex_};
+    for (const auto& [destination, limiter] : limiters.limiters_) {
+        writer.ValueWithLabels(*limiter, {"destination", destination});
+    }
+}
+
+}  // namespace congestion_control
+
+USERVER_NAMESPACE_END
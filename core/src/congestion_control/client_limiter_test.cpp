@@ -0,0 +1,126 @@
+#include <userver/congestion_control/client_limiter.hpp>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class ClientLimiterTest : public ::testing::Test {
+protected:
+    void SetUp() override { utils::datetime::MockNowSet(utils::datetime::Now()); }
+    void TearDown() override { utils::datetime::MockNowUnset(); }
+
+    // Completes a call that took `latency`, keeps `inflight` calls running
+    static void MakeCall(
+        congestion_control::ClientLimiter& limiter,
+        std::chrono::milliseconds latency,
+        std::size_t inflight = 0
+    ) {
+        std::vector<congestion_control::ClientLimiter::Token> running;
+        for (std::size_t i = 0; i < inflight; ++i) {
+            running.push_back(*limiter.TryAcquire());
+        }
+
+        auto token = limiter.TryAcquire();
+        ASSERT_TRUE(token);
+        utils::datetime::MockSleep(latency);
+        token->OnSuccess();
+    }
+};
+
+}  // namespace
+
+TEST_F(ClientLimiterTest, FailFast) {
+    congestion_control::ClientLimiterConfig config;
+    config.initial_limit = 2;
+    congestion_control::ClientLimiter limiter{config};
+
+    auto first = limiter.TryAcquire();
+    auto second = limiter.TryAcquire();
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_EQ(limiter.GetInflight(), 2);
+
+    EXPECT_FALSE(limiter.TryAcquire());
+    EXPECT_EQ(limiter.GetRejected(), 1);
+
+    // Releasing without the outcome does not change the limit
+    first.reset();
+    EXPECT_EQ(limiter.GetInflight(), 1);
+    EXPECT_EQ(limiter.GetLimit(), 2);
+    EXPECT_TRUE(limiter.TryAcquire());
+}
+
+TEST_F(ClientLimiterTest, GrowsOnStableLatency) {
+    congestion_control::ClientLimiterConfig config;
+    config.initial_limit = 4;
+    config.smoothing = 0.5;
+    congestion_control::ClientLimiter limiter{config};
+
+    for (int i = 0; i < 10; ++i) {
+        MakeCall(limiter, std::chrono::milliseconds{10}, limiter.GetLimit() - 1);
+    }
+    EXPECT_GT(limiter.GetLimit(), 4);
+    EXPECT_EQ(limiter.GetInflight(), 0);
+}
+
+TEST_F(ClientLimiterTest, NoGrowthOnLowLoad) {
+    congestion_control::ClientLimiterConfig config;
+    config.initial_limit = 10;
+    congestion_control::ClientLimiter limiter{config};
+
+    for (int i = 0; i < 20; ++i) {
+        MakeCall(limiter, std::chrono::milliseconds{10});
+    }
+    EXPECT_EQ(limiter.GetLimit(), 10);
+}
+
+TEST_F(ClientLimiterTest, ShrinksOnLatencyGrowth) {
+    congestion_control::ClientLimiterConfig config;
+    config.initial_limit = 10;
+    congestion_control::ClientLimiter limiter{config};
+
+    for (int i = 0; i < 20; ++i) {
+        MakeCall(limiter, std::chrono::milliseconds{10});
+    }
+    for (int i = 0; i < 10; ++i) {
+        MakeCall(limiter, std::chrono::milliseconds{100});
+    }
+    EXPECT_LT(limiter.GetLimit(), 10);
+    EXPECT_GE(limiter.GetLimit(), config.min_limit);
+}
+
+TEST_F(ClientLimiterTest, ShrinksOnDrops) {
+    congestion_control::ClientLimiterConfig config;
+    config.initial_limit = 10;
+    config.min_limit = 2;
+    congestion_control::ClientLimiter limiter{config};
+
+    for (int i = 0; i < 100; ++i) {
+        auto token = limiter.TryAcquire();
+        ASSERT_TRUE(token);
+        token->OnDropped();
+    }
+    EXPECT_EQ(limiter.GetLimit(), 2);
+    EXPECT_EQ(limiter.GetInflight(), 0);
+}
+
+TEST_F(ClientLimiterTest, PerDestination) {
+    congestion_control::ClientLimiterConfig config;
+    config.initial_limit = 1;
+    congestion_control::ClientLimiters limiters{config};
+
+    auto first = limiters.GetLimiter("first").TryAcquire();
+    ASSERT_TRUE(first);
+    EXPECT_FALSE(limiters.GetLimiter("first").TryAcquire());
+    EXPECT_TRUE(limiters.GetLimiter("second").TryAcquire());
+    EXPECT_EQ(&limiters.GetLimiter("first"), &limiters.GetLimiter("first"));
+}
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <congestion_control/watchdog.hpp>
 #include <userver/congestion_control/config.hpp>
+#include <userver/congestion_control/controllers/codel.hpp>
 #include <userver/server/congestion_control/sensor.hpp>
 
 #include <userver/components/component.hpp>
@@ -22,6 +23,7 @@ namespace congestion_control {
 namespace {
 
 const auto kServerControllerName = "server-main-tp-cc";
+const auto kServerCodelControllerName = "server-main-tp-codel-cc";
 
 void FormatStats(const Controller& c, size_t activated_factor, utils::statistics::Writer& writer) {
     writer["is-enabled"] = c.IsEnabled() ? 1 : 0;
@@ -48,6 +50,24 @@ void FormatStats(const Controller& c, size_t activated_factor, utils::statistics
     writer["current-state"] = stats.current_state;
 }
 
+// Queue delay driven controller, replaces the RPS one if enabled
+struct CodelControl {
+    CodelControl(
+        engine::TaskProcessor& tp,
+        server::Server& server,
+        server::congestion_control::Limiter& limiter,
+        const v2::CodelController::StaticConfig& config
+    )
+        : sensor(tp), controller(kServerCodelControllerName, sensor, limiter, stats, codel_stats, config) {
+        sensor.RegisterRequestsSource(server);
+    }
+
+    server::congestion_control::QueueWaitSensor sensor;
+    v2::Stats stats;
+    v2::CodelStats codel_stats;
+    v2::CodelController controller;
+};
+
 }  // namespace
 
 struct Component::Impl {
@@ -60,6 +80,7 @@ struct Component::Impl {
     std::atomic<bool> fake_mode;
     std::atomic<bool> force_disabled{false};
     std::atomic<size_t> last_activate_factor{1};
+    std::unique_ptr<CodelControl> codel;
 
     // These subscriptions and tasks must be the last fields!
     Watchdog wd;
@@ -112,7 +133,19 @@ Component::Component(const components::ComponentConfig& config, const components
                          "is enforced";
     }
 
-    pimpl_->wd.Register({pimpl_->server_sensor, pimpl_->server_limiter, pimpl_->server_controller});
+    const auto controller = config["controller"].As<std::string>("rps");
+    if (controller == "codel") {
+        auto codel_config = config["codel"].As<v2::CodelController::StaticConfig>(v2::CodelController::StaticConfig{});
+        codel_config.fake_mode = pimpl_->fake_mode;
+        pimpl_->codel = std::make_unique<CodelControl>(
+            engine::current_task::GetTaskProcessor(), pimpl_->server, pimpl_->server_limiter, codel_config
+        );
+        pimpl_->codel->controller.Start();
+    } else if (controller == "rps") {
+        pimpl_->wd.Register({pimpl_->server_sensor, pimpl_->server_limiter, pimpl_->server_controller});
+    } else {
+        throw std::runtime_error(fmt::format("Unknown congestion control controller '{}'", controller));
+    }
 
     pimpl_->config_subscription = pimpl_->dynamic_config.UpdateAndListen(this, kName, &Component::OnConfigUpdate);
 
@@ -138,6 +171,7 @@ void Component::OnConfigUpdate(const dynamic_config::Snapshot& cfg) {
         enabled = false;
     }
     pimpl_->server_controller.SetEnabled(enabled);
+    if (pimpl_->codel) pimpl_->codel->controller.SetEnabled(enabled);
 }
 
 void Component::OnAllComponentsLoaded() {
@@ -152,10 +186,19 @@ void Component::OnAllComponentsLoaded() {
     }
 }
 
-void Component::OnAllComponentsAreStopping() { pimpl_->wd.Stop(); }
+void Component::OnAllComponentsAreStopping() {
+    if (pimpl_->codel) pimpl_->codel->controller.Stop();
+    pimpl_->wd.Stop();
+}
 
 void Component::ExtendWriter(utils::statistics::Writer& writer) {
-    if (!pimpl_->force_disabled) {
+    if (pimpl_->force_disabled) return;
+
+    if (pimpl_->codel) {
+        auto codel = writer["codel"];
+        DumpMetric(codel, pimpl_->codel->stats);
+        DumpMetric(codel, pimpl_->codel->codel_stats);
+    } else {
         auto rps = writer["rps"];
         FormatStats(pimpl_->server_controller, pimpl_->last_activate_factor, rps);
     }
@@ -187,6 +230,38 @@ properties:
         type: integer
         description: HTTP status code for ratelimited responses
         defaultDescription: 429
+    controller:
+        type: string
+        description: load controller, 'rps' limits by the task processor overload events, 'codel' limits by the standing task queue wait time
+        defaultDescription: rps
+        enum:
+          - rps
+          - codel
+    codel:
+        type: object
+        description: settings of the 'codel' controller
+        additionalProperties: false
+        properties:
+            target:
+                type: string
+                description: acceptable minimal task queue wait time over an epoch (1s)
+                defaultDescription: 5ms
+            interval-epochs:
+                type: integer
+                description: number of epochs the queue wait time should stay above the target to apply the limit
+                defaultDescription: 1
+            min-limit:
+                type: integer
+                description: minimal RPS limit
+                defaultDescription: 10
+            deactivate-delta:
+                type: integer
+                description: the limit grows by this value per epoch and is removed if the RPS is less than the limit by this value
+                defaultDescription: 10
+            min-qps:
+                type: integer
+                description: minimal RPS to activate the limit
+                defaultDescription: 10
 )");
 }
 
@@ -0,0 +1,124 @@
+#include <userver/congestion_control/controllers/codel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+namespace {
+// An overload that returns within this number of epochs after the previous
+// one resumes the control law instead of starting from the current load
+constexpr std::size_t kRecentDroppingEpochs = 16;
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer, const CodelStats& stats) {
+    writer["min-queue-wait-us"] = stats.min_queue_wait_us;
+    writer["dropping-epochs"] = stats.dropping_epochs;
+    writer["control-count"] = stats.control_count;
+}
+
+CodelController::CodelController(
+    const std::string& name,
+    v2::Sensor& sensor,
+    Limiter& limiter,
+    Stats& stats,
+    CodelStats& codel_stats,
+    const StaticConfig& config
+)
+    : Controller(name, sensor, limiter, stats, {config.fake_mode, config.enabled}),
+      config_(config),
+      codel_stats_(codel_stats) {}
+
+Limit CodelController::Update(const Sensor::Data& current) {
+    codel_stats_.min_queue_wait_us = current.min_queue_wait_time.count();
+
+    const bool above_target = current.min_queue_wait_time > config_.target;
+    epochs_above_target_ = above_target ? epochs_above_target_ + 1 : 0;
+
+    LOG_DEBUG() << "CC codel:"
+                << " sensor=(" << current.ToLogString() << ") dropping=" << dropping_ << " count=" << count_
+                << " epochs_above_target=" << epochs_above_target_;
+
+    if (dropping_) {
+        if (above_target) {
+            ++count_;
+        } else {
+            dropping_ = false;
+            epochs_since_dropping_ = 0;
+        }
+    } else if (epochs_above_target_ >= config_.interval_epochs && (current.total >= config_.min_qps || current_limit_)) {
+        // With too little QPS the queue is not made by the requests, limiting
+        // them would not help
+        EnterDropping(current.current_load);
+    } else {
+        ++epochs_since_dropping_;
+        if (current_limit_) {
+            if (*current_limit_ > current.current_load + config_.safe_delta_limit) {
+                LOG_ERROR() << GetName() << " Congestion Control is deactivated";
+                current_limit_.reset();
+            } else {
+                *current_limit_ += config_.safe_delta_limit;
+            }
+        }
+    }
+
+    if (dropping_) {
+        ++codel_stats_.dropping_epochs;
+        current_limit_ = static_cast<std::size_t>(static_cast<double>(base_limit_) / std::sqrt(count_));
+    }
+    if (current_limit_ && *current_limit_ < config_.min_limit) {
+        current_limit_ = config_.min_limit;
+    }
+    codel_stats_.control_count = count_;
+
+    return {current_limit_, current.current_load};
+}
+
+void CodelController::EnterDropping(std::size_t current_load) {
+    dropping_ = true;
+    if (current_limit_ && epochs_since_dropping_ < kRecentDroppingEpochs && count_ > 2) {
+        // Like in CoDel, the queue has not drained for long, so the previous
+        // drop rate is close to the right one
+        count_ -= 2;
+    } else {
+        if (!current_limit_) {
+            LOG_ERROR() << GetName() << " Congestion Control is activated";
+        }
+        count_ = 1;
+        base_limit_ = current_limit_ ? std::min(*current_limit_, current_load) : current_load;
+    }
+}
+
+CodelController::StaticConfig
+Parse(const yaml_config::YamlConfig& value, formats::parse::To<CodelController::StaticConfig>) {
+    CodelController::StaticConfig config;
+    config.fake_mode = value["fake-mode"].As<bool>(config.fake_mode);
+    config.enabled = value["enabled"].As<bool>(config.enabled);
+    config.target = value["target"].As<std::chrono::milliseconds>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(config.target)
+    );
+    config.interval_epochs = value["interval-epochs"].As<std::size_t>(config.interval_epochs);
+    config.min_limit = value["min-limit"].As<std::size_t>(config.min_limit);
+    config.safe_delta_limit = value["deactivate-delta"].As<std::size_t>(config.safe_delta_limit);
+    config.min_qps = value["min-qps"].As<std::size_t>(config.min_qps);
+
+    if (config.target.count() <= 0 || config.interval_epochs == 0) {
+        throw std::runtime_error(fmt::format(
+            "Invalid CoDel settings in '{}': target > 0 and interval-epochs > 0 are expected", value.GetPath()
+        ));
+    }
+    return config;
+}
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+
+#include <userver/congestion_control/controllers/codel.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class FakeSensor final : public congestion_control::v2::Sensor {
+    Data GetCurrent() override { return {}; }
+};
+
+class FakeLimiter final : public congestion_control::Limiter {
+    void SetLimit(const congestion_control::Limit&) override {}
+};
+
+// Epochs of the simulation: the load is below the capacity, then a spike of
+// kSpikeLoad, then the normal load again
+constexpr std::size_t kEpochs = 600;
+constexpr std::size_t kSpikeBegin = 100;
+constexpr std::size_t kSpikeEnd = 300;
+
+constexpr double kCapacity = 1000;
+constexpr double kNormalLoad = 800;
+constexpr double kSpikeLoad = 2000;
+
+struct SimulationResult {
+    double avg_queue_wait_ms{0};
+    double rejected_percent{0};
+    double max_queue_wait_ms{0};
+};
+
+// Fluid model of a task processor queue: the queue accumulates the admitted
+// requests above the capacity, the minimal wait time of an epoch is the
+// minimal queue length over it divided by the capacity
+SimulationResult Simulate(bool with_controller) {
+    FakeSensor sensor;
+    FakeLimiter limiter;
+    congestion_control::v2::Stats stats;
+    congestion_control::v2::CodelStats codel_stats;
+    congestion_control::v2::CodelController controller("simulation", sensor, limiter, stats, codel_stats, {});
+
+    std::optional<std::size_t> limit;
+    double queue = 0;
+    double total_wait_ms = 0;
+    double max_wait_ms = 0;
+    double rejected = 0;
+    double arrived = 0;
+
+    for (std::size_t epoch = 0; epoch < kEpochs; ++epoch) {
+        const double load = (epoch >= kSpikeBegin && epoch < kSpikeEnd) ? kSpikeLoad : kNormalLoad;
+        const double admitted = limit ? std::min(load, static_cast<double>(*limit)) : load;
+        arrived += load;
+        rejected += load - admitted;
+
+        const double previous_queue = queue;
+        queue = std::max(0.0, queue + admitted - kCapacity);
+
+        const double wait_ms = queue / kCapacity * 1000;
+        total_wait_ms += wait_ms;
+        max_wait_ms = std::max(max_wait_ms, wait_ms);
+
+        congestion_control::v2::Sensor::Data data;
+        data.total = static_cast<std::size_t>(admitted);
+        data.current_load = static_cast<std::size_t>(admitted);
+        data.min_queue_wait_time = std::chrono::microseconds{
+            static_cast<std::int64_t>(std::min(previous_queue, queue) / kCapacity * 1'000'000)};
+        if (with_controller) limit = controller.Update(data).load_limit;
+    }
+
+    return {total_wait_ms / kEpochs, rejected * 100 / arrived, max_wait_ms};
+}
+
+}  // namespace
+
+void congestion_control_codel_simulation(benchmark::State& state) {
+    const bool with_controller = state.range(0) != 0;
+
+    SimulationResult result;
+    for ([[maybe_unused]] auto _ : state) {
+        result = Simulate(with_controller);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.counters["avg_queue_wait_ms"] = result.avg_queue_wait_ms;
+    state.counters["max_queue_wait_ms"] = result.max_queue_wait_ms;
+    state.counters["rejected_percent"] = result.rejected_percent;
+}
+BENCHMARK(congestion_control_codel_simulation)->Arg(0)->Arg(1);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,160 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/congestion_control/controllers/codel.hpp>
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class FakeSensor : public congestion_control::v2::Sensor {
+    Data GetCurrent() override { return {}; }
+};
+
+class FakeLimiter : public congestion_control::Limiter {
+    void SetLimit(const congestion_control::Limit&) override {}
+};
+
+congestion_control::v2::Stats stats;
+congestion_control::v2::CodelStats codel_stats;
+FakeSensor sensor;
+FakeLimiter limiter;
+
+congestion_control::v2::Sensor::Data MakeData(std::size_t load, std::chrono::microseconds min_queue_wait_time) {
+    congestion_control::v2::Sensor::Data data;
+    data.total = load;
+    data.current_load = load;
+    data.min_queue_wait_time = min_queue_wait_time;
+    return data;
+}
+
+}  // namespace
+
+TEST(CCCodel, NoQueue) {
+    congestion_control::v2::CodelController controller("test", sensor, limiter, stats, codel_stats, {});
+
+    for (size_t i = 0; i < 100; i++) {
+        auto limit = controller.Update(MakeData(1000, std::chrono::milliseconds{1}));
+        EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+    }
+}
+
+TEST(CCCodel, Bursts) {
+    congestion_control::v2::CodelController::StaticConfig config;
+    config.interval_epochs = 3;
+    congestion_control::v2::CodelController controller("test", sensor, limiter, stats, codel_stats, config);
+
+    // Short bursts drain within the interval and are not limited
+    for (size_t i = 0; i < 100; i++) {
+        const auto wait = i % 3 == 2 ? std::chrono::microseconds{0} : std::chrono::milliseconds{100};
+        auto limit = controller.Update(MakeData(1000, wait));
+        EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+    }
+}
+
+TEST(CCCodel, SmallRps) {
+    congestion_control::v2::CodelController controller("test", sensor, limiter, stats, codel_stats, {});
+
+    for (size_t i = 0; i < 100; i++) {
+        auto limit = controller.Update(MakeData(1, std::chrono::milliseconds{100}));
+        EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+    }
+}
+
+TEST(CCCodel, StandingQueue) {
+    congestion_control::v2::CodelController controller("test", sensor, limiter, stats, codel_stats, {});
+
+    auto limit = controller.Update(MakeData(1000, std::chrono::milliseconds{100}));
+    ASSERT_TRUE(limit.load_limit);
+    EXPECT_EQ(*limit.load_limit, 1000);
+
+    // The limit is decreased faster the longer the queue stands
+    std::size_t previous_limit = *limit.load_limit;
+    std::size_t previous_decrease = 0;
+    for (size_t i = 0; i < 5; i++) {
+        limit = controller.Update(MakeData(previous_limit, std::chrono::milliseconds{100}));
+        ASSERT_TRUE(limit.load_limit);
+        EXPECT_LT(*limit.load_limit, previous_limit) << i;
+
+        const auto decrease = 1000 - *limit.load_limit;
+        EXPECT_GT(decrease, previous_decrease) << i;
+        previous_decrease = decrease;
+        previous_limit = *limit.load_limit;
+    }
+    EXPECT_EQ(codel_stats.control_count.load(), 6);
+}
+
+TEST(CCCodel, MinLimit) {
+    congestion_control::v2::CodelController::StaticConfig config;
+    config.min_limit = 100;
+    congestion_control::v2::CodelController controller("test", sensor, limiter, stats, codel_stats, config);
+
+    congestion_control::Limit limit;
+    for (size_t i = 0; i < 1000; i++) {
+        limit = controller.Update(MakeData(1000, std::chrono::milliseconds{100}));
+    }
+    EXPECT_EQ(limit.load_limit, 100);
+}
+
+TEST(CCCodel, Recovery) {
+    congestion_control::v2::CodelController controller("test", sensor, limiter, stats, codel_stats, {});
+
+    congestion_control::Limit limit;
+    for (size_t i = 0; i < 4; i++) {
+        limit = controller.Update(MakeData(1000, std::chrono::milliseconds{100}));
+    }
+    ASSERT_TRUE(limit.load_limit);
+    const auto overloaded_limit = *limit.load_limit;
+
+    // The queue has drained, the limit is kept for an epoch and then grows
+    // while the load reaches it
+    limit = controller.Update(MakeData(overloaded_limit, std::chrono::microseconds{0}));
+    EXPECT_EQ(limit.load_limit, overloaded_limit);
+    limit = controller.Update(MakeData(overloaded_limit, std::chrono::microseconds{0}));
+    ASSERT_TRUE(limit.load_limit);
+    EXPECT_GT(*limit.load_limit, overloaded_limit);
+
+    // The load does not reach the limit anymore, the limit is removed
+    limit = controller.Update(MakeData(overloaded_limit / 2, std::chrono::microseconds{0}));
+    EXPECT_EQ(limit.load_limit, std::nullopt);
+}
+
+TEST(CCCodel, ResumesControlLaw) {
+    congestion_control::v2::CodelController controller("test", sensor, limiter, stats, codel_stats, {});
+
+    for (size_t i = 0; i < 10; i++) {
+        controller.Update(MakeData(1000, std::chrono::milliseconds{100}));
+    }
+    ASSERT_EQ(codel_stats.control_count.load(), 10);
+
+    auto limit = controller.Update(MakeData(400, std::chrono::microseconds{0}));
+    ASSERT_TRUE(limit.load_limit);
+
+    // The queue returns shortly, the control law continues from where it has
+    // stopped instead of starting from the current load
+    controller.Update(MakeData(*limit.load_limit, std::chrono::milliseconds{100}));
+    EXPECT_EQ(codel_stats.control_count.load(), 8);
+}
+
+TEST(CCCodel, ParseConfig) {
+    const auto parse = [](const std::string& yaml) {
+        return yaml_config::YamlConfig(formats::yaml::FromString(yaml), {})
+            .As<congestion_control::v2::CodelController::StaticConfig>();
+    };
+
+    const auto config = parse(R"(
+target: 10ms
+interval-epochs: 2
+min-limit: 5
+)");
+
+    EXPECT_EQ(config.target, std::chrono::milliseconds{10});
+    EXPECT_EQ(config.interval_epochs, 2);
+    EXPECT_EQ(config.min_limit, 5);
+    EXPECT_EQ(config.min_qps, 10);
+
+    EXPECT_ANY_THROW(parse("interval-epochs: 0"));
+}
+
+USERVER_NAMESPACE_END
@@ -17,7 +17,14 @@ double Sensor::Data::GetLoadPercent() const {
 namespace v2 {
 
 std::string Sensor::Data::ToLogString() const {
-    return fmt::format("events={}/{} timings_avg={}ms current_load={}", timeouts, total, timings_avg_ms, current_load);
+    return fmt::format(
+        "events={}/{} timings_avg={}ms current_load={} min_queue_wait={}us",
+        timeouts,
+        total,
+        timings_avg_ms,
+        current_load,
+        min_queue_wait_time.count()
+    );
 }
 
 }  // namespace v2
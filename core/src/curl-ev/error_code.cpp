@@ -141,6 +141,8 @@ public:
                 return "hit global opensocket rate limit";
             case RateLimitErrorCode::kPerHostSocketLimit:
                 return "hit per-host opensocket rate limit";
+            case RateLimitErrorCode::kConcurrencyLimit:
+                return "hit per-destination concurrency limit";
         }
 
         return "Unknown rate-limit error";
@@ -36,6 +36,8 @@ const char* GetSetterName(native::CURLMoption option) {
             return "SetMultiplexingEnabled";
         case native::CURLMOPT_MAX_HOST_CONNECTIONS:
             return "SetMaxHostConnections";
+        case native::CURLMOPT_MAX_CONCURRENT_STREAMS:
+            return "SetMaxConcurrentStreams";
         case native::CURLMOPT_MAXCONNECTS:
             return "SetConnectionCacheSize";
         default:
@@ -135,10 +137,16 @@ void multi::UnbindEasySocket(native::curl_socket_t s) {
 
 void multi::CheckRateLimit(const char* url_str, std::error_code& ec) { connect_rate_limiter_->Check(url_str, ec); }
 
-void multi::SetMultiplexingEnabled(bool value) { SetOptionAsync(native::CURLMOPT_PIPELINING, value ? 1 : 0); }
+// CURLPIPE_HTTP1 is not supported by cURL anymore, the only working mode is
+// HTTP/2 multiplexing
+void multi::SetMultiplexingEnabled(bool value) {
+    SetOptionAsync(native::CURLMOPT_PIPELINING, value ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING);
+}
 
 void multi::SetMaxHostConnections(long value) { SetOptionAsync(native::CURLMOPT_MAX_HOST_CONNECTIONS, value); }
 
+void multi::SetMaxConcurrentStreams(long value) { SetOptionAsync(native::CURLMOPT_MAX_CONCURRENT_STREAMS, value); }
+
 void multi::SetConnectionCacheSize(long value) { SetOptionAsync(native::CURLMOPT_MAXCONNECTS, value); }
 
 void multi::add_handle(native::CURL* native_easy) {
@@ -55,6 +55,7 @@ public:
 
     void SetMultiplexingEnabled(bool);
     void SetMaxHostConnections(long);
+    void SetMaxConcurrentStreams(long);
     void SetConnectionCacheSize(long);
 
 private:
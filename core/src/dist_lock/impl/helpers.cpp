@@ -1,9 +1,14 @@
 #include <dist_lock/impl/helpers.hpp>
 
+#include <atomic>
+#include <cstdint>
+
+#include <fmt/compile.h>
 #include <fmt/format.h>
 
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/utils/rand.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -36,6 +41,11 @@ bool GetTask(
     return false;
 }
 
+std::string MakeLockerId(std::string_view name) {
+    static std::atomic<std::uint32_t> idx = utils::Rand();
+    return fmt::format(FMT_COMPILE("{}-{:x}"), name, idx++);
+}
+
 std::string LockerName(std::string_view lock_name) { return fmt::format("locker-{}", lock_name); }
 
 std::string WatchdogName(std::string_view lock_name) { return fmt::format("watchdog-{}", lock_name); }
@@ -16,6 +16,8 @@ bool GetTask(
     std::exception_ptr* exception_ptr = nullptr
 );
 
+std::string MakeLockerId(std::string_view name);
+
 std::string LockerName(std::string_view lock_name);
 
 std::string WatchdogName(std::string_view lock_name);
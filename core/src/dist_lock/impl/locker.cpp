@@ -1,9 +1,7 @@
 #include <dist_lock/impl/locker.hpp>
 
-#include <atomic>
 #include <stdexcept>
 
-#include <fmt/compile.h>
 #include <fmt/format.h>
 
 #include <userver/engine/exception.hpp>
@@ -15,7 +13,6 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/datetime.hpp>
-#include <userver/utils/rand.hpp>
 
 #include <dist_lock/impl/helpers.hpp>
 
@@ -28,11 +25,6 @@ class WorkerFuncFailedException : public std::runtime_error {
     using std::runtime_error::runtime_error;
 };
 
-std::string MakeLockerId(const std::string& name) {
-    static std::atomic<uint32_t> idx = utils::Rand();
-    return fmt::format(FMT_COMPILE("{}-{:x}"), name, idx++);
-}
-
 }  // namespace
 
 class Locker::LockGuard {
@@ -0,0 +1,201 @@
+#include <userver/dist_lock/multi_dist_locker.hpp>
+
+#include <algorithm>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <dist_lock/impl/helpers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+
+namespace {
+
+std::vector<std::string> SortedUnique(std::vector<std::string> lock_names) {
+    std::sort(lock_names.begin(), lock_names.end());
+    lock_names.erase(std::unique(lock_names.begin(), lock_names.end()), lock_names.end());
+    return lock_names;
+}
+
+}  // namespace
+
+MultiDistLocker::MultiDistLocker(
+    std::string name,
+    std::vector<std::string> lock_names,
+    std::shared_ptr<MultiDistLockStrategyBase> strategy,
+    const DistLockSettings& settings,
+    engine::TaskProcessor* task_processor
+)
+    : name_(std::move(name)),
+      id_(impl::MakeLockerId(name_)),
+      lock_names_(SortedUnique(std::move(lock_names))),
+      strategy_(std::move(strategy)),
+      settings_(settings),
+      leases_(lock_names_.size()),
+      task_processor_(task_processor) {
+    UASSERT(strategy_);
+}
+
+MultiDistLocker::~MultiDistLocker() {
+    UASSERT_MSG(!IsRunning(), "Stop() was not called");
+    UASSERT(!locker_task_.IsValid());
+}
+
+const std::string& MultiDistLocker::Name() const { return name_; }
+
+DistLockSettings MultiDistLocker::GetSettings() const {
+    std::lock_guard<engine::Mutex> lock(settings_mutex_);
+    return settings_;
+}
+
+void MultiDistLocker::UpdateSettings(const DistLockSettings& settings) {
+    std::lock_guard<engine::Mutex> lock(settings_mutex_);
+    settings_ = settings;
+}
+
+engine::TaskProcessor& MultiDistLocker::GetTaskProcessor() const noexcept {
+    return task_processor_ ? *task_processor_ : engine::current_task::GetTaskProcessor();
+}
+
+void MultiDistLocker::Start() {
+    LOG_INFO() << "Starting MultiDistLocker " << Name() << " for " << lock_names_.size() << " locks";
+
+    std::lock_guard<engine::Mutex> lock(locker_task_mutex_);
+    UINVARIANT(!locker_task_.IsValid(), "MultiDistLocker is already started");
+    locker_task_ = utils::CriticalAsync(GetTaskProcessor(), impl::LockerName(Name()), [this] { Run(); });
+
+    LOG_INFO() << "Started MultiDistLocker " << Name();
+}
+
+void MultiDistLocker::Stop() {
+    LOG_INFO() << "Stopping MultiDistLocker " << Name();
+
+    std::lock_guard<engine::Mutex> lock(locker_task_mutex_);
+    if (locker_task_.IsValid()) locker_task_.RequestCancel();
+    impl::GetTask(locker_task_, impl::LockerName(Name()), "cancel and wait in MultiDistLocker::Stop()");
+
+    LOG_INFO() << "Stopped MultiDistLocker " << Name();
+}
+
+bool MultiDistLocker::IsRunning() const {
+    std::lock_guard<engine::Mutex> lock(locker_task_mutex_);
+    return locker_task_.IsValid();
+}
+
+std::optional<MultiDistLocker::Lease> MultiDistLocker::GetLease(std::string_view lock_name) const {
+    const auto it = std::lower_bound(lock_names_.begin(), lock_names_.end(), lock_name);
+    if (it == lock_names_.end() || *it != lock_name) return std::nullopt;
+
+    const auto leases = leases_.Read();
+    const auto& lease = (*leases)[it - lock_names_.begin()];
+    if (!lease || lease->valid_until <= utils::datetime::SteadyNow()) return std::nullopt;
+    return lease;
+}
+
+std::vector<std::string> MultiDistLocker::GetOwnedLocks() const {
+    const auto now = utils::datetime::SteadyNow();
+    const auto leases = leases_.Read();
+
+    std::vector<std::string> result;
+    for (std::size_t i = 0; i < lock_names_.size(); ++i) {
+        const auto& lease = (*leases)[i];
+        if (lease && lease->valid_until > now) result.push_back(lock_names_[i]);
+    }
+    return result;
+}
+
+const Statistics& MultiDistLocker::GetStatistics() const { return stats_; }
+
+void MultiDistLocker::Run() {
+    while (!engine::current_task::ShouldCancel()) {
+        const auto settings = GetSettings();
+        const auto attempt_start = utils::datetime::SteadyNow();
+        bool all_held = false;
+
+        try {
+            const auto tokens = strategy_->AcquireMany(settings.lock_ttl, id_, lock_names_);
+            UINVARIANT(tokens.size() == lock_names_.size(), "Strategy returned a wrong number of fencing tokens");
+            UpdateLeases(tokens, attempt_start + settings.lock_ttl - settings.forced_stop_margin);
+            all_held = std::all_of(tokens.begin(), tokens.end(), [](const auto& token) { return token.has_value(); });
+        } catch (const std::exception& ex) {
+            // Leases are kept, they expire on their own if the storage is unreachable
+            stats_.lock_failures += lock_names_.size();
+            LOG_WARNING() << "Locks acquisition failed: " << ex;
+        }
+
+        if (engine::current_task::ShouldCancel()) break;
+        engine::InterruptibleSleepFor(
+            all_held ? settings.prolong_interval : std::min(settings.acquire_interval, settings.prolong_interval)
+        );
+    }
+
+    ReleaseAll();
+}
+
+void MultiDistLocker::UpdateLeases(
+    const std::vector<std::optional<FencingToken>>& tokens,
+    std::chrono::steady_clock::time_point valid_until
+) {
+    const auto now = utils::datetime::SteadyNow();
+    auto leases = leases_.StartWrite();
+
+    std::size_t successes = 0;
+    for (std::size_t i = 0; i < tokens.size(); ++i) {
+        auto& lease = (*leases)[i];
+        const bool was_held = lease && lease->valid_until > now;
+
+        if (tokens[i]) {
+            ++successes;
+            if (was_held && lease->fencing_token != *tokens[i]) {
+                LOG_ERROR() << "Lock '" << lock_names_[i] << "' was reacquired by someone else while we're "
+                            << "assuming we're holding it, fencing token " << lease->fencing_token << " -> "
+                            << *tokens[i] << ". It may be a brain split in DB backend.";
+                stats_.brain_splits++;
+            }
+            lease = Lease{*tokens[i], valid_until};
+        } else {
+            if (was_held) {
+                LOG_ERROR() << "Lock '" << lock_names_[i] << "' was acquired by someone else while we're "
+                            << "assuming we're holding it. It may be a brain split in DB backend.";
+                stats_.brain_splits++;
+            }
+            lease.reset();
+        }
+    }
+    leases.Commit();
+
+    stats_.lock_successes += successes;
+    stats_.lock_failures += tokens.size() - successes;
+}
+
+void MultiDistLocker::ReleaseAll() noexcept {
+    engine::TaskCancellationBlocker cancel_blocker;
+    leases_.Assign(Leases(lock_names_.size()));
+    try {
+        strategy_->ReleaseMany(id_, lock_names_);
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to release locks on stop: " << ex;
+    }
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const MultiDistLocker& locker) {
+    const auto& stats = locker.GetStatistics();
+
+    writer["running"] = locker.IsRunning() ? 1 : 0;
+    writer["locked"] = locker.GetOwnedLocks().size();
+
+    writer["successes"] = stats.lock_successes.Load();
+    writer["failures"] = stats.lock_failures.Load();
+    writer["brain-splits"] = stats.brain_splits.Load();
+}
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,190 @@
+#include <userver/utest/utest.hpp>
+
+#include <unordered_map>
+
+#include <userver/concurrent/variable.hpp>
+#include <userver/dist_lock/multi_dist_lock_strategy.hpp>
+#include <userver/dist_lock/multi_dist_locker.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::milliseconds kAttemptInterval{10};
+constexpr std::chrono::milliseconds kLockTtl{100};
+
+const std::string kLockerName = "test";
+
+dist_lock::DistLockSettings MakeSettings() {
+    return {kAttemptInterval, kAttemptInterval, kLockTtl, kAttemptInterval, kAttemptInterval};
+}
+
+class MockMultiDistLockStrategy final : public dist_lock::MultiDistLockStrategyBase {
+public:
+    ~MockMultiDistLockStrategy() override { EXPECT_TRUE(GetOwners().empty()); }
+
+    std::vector<std::optional<dist_lock::FencingToken>> AcquireMany(
+        std::chrono::milliseconds,
+        const std::string& locker_id,
+        utils::span<const std::string> lock_names
+    ) override {
+        calls_++;
+        if (!allowed_) throw std::runtime_error("not allowed");
+
+        auto locks = locks_.Lock();
+        std::vector<std::optional<dist_lock::FencingToken>> result;
+        for (const auto& name : lock_names) {
+            auto& lock = (*locks)[name];
+            if (lock.owner.empty()) {
+                lock.owner = locker_id;
+                ++lock.token;
+            }
+            result.push_back(lock.owner == locker_id ? std::make_optional(lock.token) : std::nullopt);
+        }
+        return result;
+    }
+
+    void ReleaseMany(const std::string& locker_id, utils::span<const std::string> lock_names) override {
+        auto locks = locks_.Lock();
+        for (const auto& name : lock_names) {
+            auto& lock = (*locks)[name];
+            if (lock.owner == locker_id) lock.owner.clear();
+        }
+    }
+
+    void SetOwner(const std::string& name, const std::string& owner) {
+        auto locks = locks_.Lock();
+        auto& lock = (*locks)[name];
+        lock.owner = owner;
+        ++lock.token;
+    }
+
+    std::unordered_map<std::string, std::string> GetOwners() const {
+        auto locks = locks_.Lock();
+        std::unordered_map<std::string, std::string> result;
+        for (const auto& [name, lock] : *locks) {
+            if (!lock.owner.empty()) result.emplace(name, lock.owner);
+        }
+        return result;
+    }
+
+    void Allow(bool allowed) { allowed_ = allowed; }
+
+    std::size_t GetCallsCount() const { return calls_; }
+
+private:
+    struct Lock {
+        std::string owner;
+        dist_lock::FencingToken token{0};
+    };
+
+    mutable concurrent::Variable<std::unordered_map<std::string, Lock>> locks_;
+    std::atomic<bool> allowed_{true};
+    std::atomic<std::size_t> calls_{0};
+};
+
+template <typename Predicate>
+bool WaitFor(Predicate predicate) {
+    const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    while (!predicate()) {
+        if (deadline.IsReached()) return false;
+        engine::SleepFor(kAttemptInterval);
+    }
+    return true;
+}
+
+}  // namespace
+
+UTEST_MT(MultiDistLocker, AcquireAndRelease, 2) {
+    auto strategy = std::make_shared<MockMultiDistLockStrategy>();
+    dist_lock::MultiDistLocker locker(kLockerName, {"c", "a", "b", "a"}, strategy, MakeSettings());
+    EXPECT_FALSE(locker.GetLease("a"));
+
+    locker.Start();
+    ASSERT_TRUE(WaitFor([&] { return locker.GetOwnedLocks().size() == 3; }));
+    EXPECT_EQ(locker.GetOwnedLocks(), (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(strategy->GetOwners().size(), 3);
+
+    const auto lease = locker.GetLease("b");
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(lease->fencing_token, 1);
+    EXPECT_GT(lease->valid_until, utils::datetime::SteadyNow());
+    EXPECT_FALSE(locker.GetLease("unknown"));
+
+    // Prolongation keeps the fencing token
+    const auto calls = strategy->GetCallsCount();
+    ASSERT_TRUE(WaitFor([&] { return strategy->GetCallsCount() > calls + 1; }));
+    EXPECT_EQ(locker.GetLease("b")->fencing_token, 1);
+
+    locker.Stop();
+    EXPECT_TRUE(locker.GetOwnedLocks().empty());
+    EXPECT_TRUE(strategy->GetOwners().empty());
+    EXPECT_EQ(locker.GetStatistics().brain_splits.Load(), 0);
+}
+
+UTEST_MT(MultiDistLocker, LockedByOther, 2) {
+    auto strategy = std::make_shared<MockMultiDistLockStrategy>();
+    strategy->SetOwner("b", "other");
+
+    dist_lock::MultiDistLocker locker(kLockerName, {"a", "b"}, strategy, MakeSettings());
+    locker.Start();
+    ASSERT_TRUE(WaitFor([&] { return locker.GetLease("a").has_value(); }));
+    EXPECT_FALSE(locker.GetLease("b"));
+
+    strategy->SetOwner("b", "");
+    ASSERT_TRUE(WaitFor([&] { return locker.GetLease("b").has_value(); }));
+    EXPECT_GT(locker.GetLease("b")->fencing_token, 1);
+
+    locker.Stop();
+}
+
+UTEST_MT(MultiDistLocker, FencingTokenGrows, 2) {
+    auto strategy = std::make_shared<MockMultiDistLockStrategy>();
+
+    dist_lock::MultiDistLocker first(kLockerName, {"a"}, strategy, MakeSettings());
+    first.Start();
+    ASSERT_TRUE(WaitFor([&] { return first.GetLease("a").has_value(); }));
+    const auto first_token = first.GetLease("a")->fencing_token;
+    first.Stop();
+
+    dist_lock::MultiDistLocker second(kLockerName, {"a"}, strategy, MakeSettings());
+    second.Start();
+    ASSERT_TRUE(WaitFor([&] { return second.GetLease("a").has_value(); }));
+    EXPECT_GT(second.GetLease("a")->fencing_token, first_token);
+    second.Stop();
+}
+
+UTEST_MT(MultiDistLocker, LeaseExpires, 2) {
+    auto strategy = std::make_shared<MockMultiDistLockStrategy>();
+    dist_lock::MultiDistLocker locker(kLockerName, {"a", "b"}, strategy, MakeSettings());
+
+    locker.Start();
+    ASSERT_TRUE(WaitFor([&] { return locker.GetOwnedLocks().size() == 2; }));
+
+    strategy->Allow(false);
+    ASSERT_TRUE(WaitFor([&] { return locker.GetOwnedLocks().empty(); }));
+    EXPECT_GT(locker.GetStatistics().lock_failures.Load(), 0);
+
+    strategy->Allow(true);
+    ASSERT_TRUE(WaitFor([&] { return locker.GetOwnedLocks().size() == 2; }));
+    locker.Stop();
+}
+
+UTEST_MT(MultiDistLocker, BrainSplit, 2) {
+    auto strategy = std::make_shared<MockMultiDistLockStrategy>();
+    dist_lock::MultiDistLocker locker(kLockerName, {"a"}, strategy, MakeSettings());
+
+    locker.Start();
+    ASSERT_TRUE(WaitFor([&] { return locker.GetLease("a").has_value(); }));
+
+    strategy->SetOwner("a", "other");
+    ASSERT_TRUE(WaitFor([&] { return !locker.GetLease("a"); }));
+    EXPECT_EQ(locker.GetStatistics().brain_splits.Load(), 1);
+
+    locker.Stop();
+    strategy->SetOwner("a", "");
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,80 @@
+#include <userver/dump/blocks.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/compression/error.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump::impl {
+
+void BufferWriter::WriteRaw(std::string_view data) { data_.append(data); }
+
+std::string_view BufferReader::ReadRaw(std::size_t max_size) {
+    UASSERT(pos_ <= data_.size());
+    const auto result = std::string_view{data_}.substr(pos_, max_size);
+    pos_ += result.size();
+    return result;
+}
+
+void BufferReader::BackUp(std::size_t size) {
+    UASSERT_MSG(size <= pos_, "Trying to BackUp more bytes than returned by the last ReadRaw");
+    pos_ -= size;
+}
+
+void BufferReader::Finish() {
+    if (pos_ != data_.size()) {
+        throw Error(fmt::format(
+            "Unexpected extra data at the end of a dump block: block-size={}, position={}", data_.size(), pos_
+        ));
+    }
+}
+
+Block CompressBlock(std::size_t element_count, std::string raw, int level) {
+    const auto raw_size = raw.size();
+    // The zstd frame checksum makes the blocks verifiable independently
+    return {element_count, raw_size, compression::zstd::CompressWithChecksum(raw, level)};
+}
+
+std::string DecompressBlock(const Block& block) {
+    std::string raw;
+    try {
+        raw = compression::zstd::Decompress(block.compressed, block.raw_size);
+    } catch (const compression::DecompressionError& ex) {
+        throw Error(fmt::format("Failed to decompress a dump block: {}", ex.what()));
+    }
+
+    if (raw.size() != block.raw_size) {
+        throw Error(fmt::format(
+            "Unexpected size of a decompressed dump block: expected={}, actual={}", block.raw_size, raw.size()
+        ));
+    }
+    return raw;
+}
+
+void WriteBlock(Writer& writer, const Block& block) {
+    writer.Write(block.element_count);
+    writer.Write(block.raw_size);
+    writer.Write(block.compressed);
+}
+
+Block ReadBlock(Reader& reader, std::size_t elements_left) {
+    Block block;
+    block.element_count = reader.Read<std::size_t>();
+    if (block.element_count == 0 || block.element_count > elements_left) {
+        throw Error(fmt::format(
+            "Unexpected element count of a dump block: block-elements={}, elements-left={}",
+            block.element_count,
+            elements_left
+        ));
+    }
+    block.raw_size = reader.Read<std::size_t>();
+    block.compressed = reader.Read<std::string>();
+    return block;
+}
+
+}  // namespace dump::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,87 @@
+#include <userver/dump/blocks.hpp>
+
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/dump/operations_mock.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr dump::BlocksOptions kSmallBlocks{/*block_size=*/100, /*max_parallel_blocks=*/4};
+
+template <typename T>
+std::string WriteBlocksToBinary(const T& value, const dump::BlocksOptions& options = kSmallBlocks) {
+    dump::MockWriter writer;
+    dump::WriteBlocks(writer, value, options);
+    writer.Finish();
+    return std::move(writer).Extract();
+}
+
+template <typename T>
+T ReadBlocksFromBinary(std::string data, const dump::BlocksOptions& options = kSmallBlocks) {
+    dump::MockReader reader(std::move(data));
+    auto value = dump::ReadBlocks<T>(reader, options);
+    reader.Finish();
+    return value;
+}
+
+template <typename T>
+void TestBlocksWriteReadCycle(const T& original, const dump::BlocksOptions& options = kSmallBlocks) {
+    EXPECT_EQ(ReadBlocksFromBinary<T>(WriteBlocksToBinary(original, options), options), original);
+}
+
+std::unordered_map<int, std::string> MakeMap(int size) {
+    std::unordered_map<int, std::string> result;
+    for (int i = 0; i < size; ++i) {
+        result.emplace(i, "value-" + std::to_string(i));
+    }
+    return result;
+}
+
+}  // namespace
+
+UTEST_MT(DumpBlocks, UnorderedMap, 4) {
+    TestBlocksWriteReadCycle(MakeMap(10'000));
+    TestBlocksWriteReadCycle(MakeMap(1));
+    TestBlocksWriteReadCycle(MakeMap(0));
+}
+
+UTEST_MT(DumpBlocks, Containers, 4) {
+    std::vector<int> vector(1'234);
+    for (std::size_t i = 0; i < vector.size(); ++i) vector[i] = static_cast<int>(i * 7);
+    TestBlocksWriteReadCycle(vector);
+
+    TestBlocksWriteReadCycle(std::vector<bool>{true, false, true});
+    TestBlocksWriteReadCycle(std::set<std::string>{"a", "b", "c"}, {/*block_size=*/1});
+    TestBlocksWriteReadCycle(std::map<int, int>{{1, 2}, {3, 4}, {5, 6}}, {/*block_size=*/2});
+}
+
+UTEST(DumpBlocks, DefaultOptions) { TestBlocksWriteReadCycle(MakeMap(1'000), {}); }
+
+UTEST(DumpBlocks, Compressed) {
+    const std::vector<std::string> value(1'000, std::string(100, 'a'));
+    const auto binary = WriteBlocksToBinary(value);
+    EXPECT_LT(binary.size(), value.size() * value.front().size() / 10);
+}
+
+UTEST(DumpBlocks, Corrupted) {
+    auto binary = WriteBlocksToBinary(MakeMap(1'000));
+    binary.back() ^= 1;  // the checksum of the last block
+    using Map = std::unordered_map<int, std::string>;
+    UEXPECT_THROW(ReadBlocksFromBinary<Map>(binary), dump::Error);
+}
+
+UTEST(DumpBlocks, Truncated) {
+    auto binary = WriteBlocksToBinary(MakeMap(1'000));
+    binary.resize(binary.size() - 1);
+    using Map = std::unordered_map<int, std::string>;
+    UEXPECT_THROW(ReadBlocksFromBinary<Map>(binary), dump::Error);
+}
+
+USERVER_NAMESPACE_END
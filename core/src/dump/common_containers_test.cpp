@@ -9,6 +9,7 @@
 
 #include <userver/dump/test_helpers.hpp>
 #include <userver/utest/utest.hpp>
+#include <userver/utils/persistent_hash_map.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -84,6 +85,12 @@ TEST(DumpCommonContainers, UnorderedMap) {
     TestWriteReadCycle(std::unordered_map<bool, bool>{});
 }
 
+TEST(DumpCommonContainers, PersistentHashMap) {
+    TestWriteReadCycle(utils::PersistentHashMap<int, std::string>{{1, "a"}, {2, "b"}});
+    TestWriteReadCycle(utils::PersistentHashMap<std::string, int>{{"a", 1}, {"b", 2}});
+    TestWriteReadCycle(utils::PersistentHashMap<bool, bool>{});
+}
+
 TEST(DumpCommonContainers, Set) {
     TestWriteReadCycle(std::set<int>{1, 2, 5});
     TestWriteReadCycle(std::set<std::string>{"a", "b", "bb"});
@@ -564,6 +564,10 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            memory-mapped:
+                type: boolean
+                description: Whether to mmap the dump on read instead of reading it
+                defaultDescription: false
 )");
 }
 
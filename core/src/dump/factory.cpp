@@ -30,13 +30,13 @@ CreateOperationsFactory(const Config& config, const components::ComponentContext
         auto secret_key = secdist.Get<dump::Secdist>().GetSecretKey(config.name);
         return std::make_unique<dump::EncryptedOperationsFactory>(std::move(secret_key), dump_perms);
     } else {
-        return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+        return std::make_unique<dump::FileOperationsFactory>(dump_perms, config.dump_is_memory_mapped);
     }
 }
 
 std::unique_ptr<dump::OperationsFactory> CreateDefaultOperationsFactory(const Config& config) {
     auto dump_perms = GetPerms(config);
-    return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+    return std::make_unique<dump::FileOperationsFactory>(dump_perms, config.dump_is_memory_mapped);
 }
 
 }  // namespace dump
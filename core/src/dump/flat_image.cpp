@@ -0,0 +1,143 @@
+#include <userver/dump/flat_image.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <fmt/format.h>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace {
+
+constexpr std::uint64_t kImageMagic = 0x31474d4954414c46;  // "FLATIMG1"
+
+// Written via WriteStringViewUnsafe in chunks, so that FileWriter could yield
+constexpr std::size_t kWriteChunkSize{1 << 20};
+
+struct ImageHeader final {
+    std::uint64_t magic;
+    std::uint64_t root_offset;
+    std::uint64_t root_size;
+    std::uint64_t reserved;
+};
+
+static_assert(sizeof(ImageHeader) % FlatImage::kAlignment == 0);
+
+bool IsAligned(const void* ptr, std::size_t alignment) noexcept {
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+std::size_t AlignUp(std::size_t value, std::size_t alignment) noexcept {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+FlatImage::FlatImage(PinnedBytes bytes) : bytes_(std::move(bytes)) {
+    if (bytes_.data.size() < sizeof(ImageHeader) || !IsAligned(bytes_.data.data(), kAlignment)) {
+        throw Error(fmt::format("FlatImage is too small or misaligned: size={}", bytes_.data.size()));
+    }
+
+    ImageHeader header{};
+    std::memcpy(&header, bytes_.data.data(), sizeof(header));
+    if (header.magic != kImageMagic) {
+        throw Error("FlatImage has an unexpected magic, the dump is corrupted");
+    }
+    root_offset_ = header.root_offset;
+    root_size_ = header.root_size;
+    GetChecked(root_offset_, root_size_, 1);
+}
+
+std::string_view FlatImage::GetString(FlatString str) const {
+    return {GetChecked(str.offset, str.size, 1), static_cast<std::size_t>(str.size)};
+}
+
+const char* FlatImage::GetChecked(std::uint64_t offset, std::uint64_t size, std::size_t alignment) const {
+    const auto image_size = bytes_.data.size();
+    if (offset > image_size || size > image_size - offset || offset % alignment != 0) {
+        throw Error(fmt::format(
+            "FlatImage reference is out of bounds: offset={}, size={}, image-size={}", offset, size, image_size
+        ));
+    }
+    return bytes_.data.data() + offset;
+}
+
+FlatImageBuilder::FlatImageBuilder() {
+    const ImageHeader header{kImageMagic, 0, 0, 0};
+    Append(std::string_view{reinterpret_cast<const char*>(&header), sizeof(header)}, FlatImage::kAlignment);
+}
+
+void FlatImageBuilder::Reserve(std::size_t size) {
+    storage_.reserve(AlignUp(size_ + size, sizeof(std::max_align_t)) / sizeof(std::max_align_t));
+}
+
+FlatString FlatImageBuilder::AddString(std::string_view str) { return {Append(str, 1), str.size()}; }
+
+std::uint64_t FlatImageBuilder::Append(std::string_view bytes, std::size_t alignment) {
+    UASSERT(alignment <= FlatImage::kAlignment);
+    const auto offset = AlignUp(size_, alignment);
+    const auto new_size = offset + bytes.size();
+
+    const auto required_units = AlignUp(new_size, sizeof(std::max_align_t)) / sizeof(std::max_align_t);
+    if (required_units > storage_.size()) {
+        // Amortized growth, the new units are zeroed so the padding is deterministic
+        storage_.resize(std::max(required_units, storage_.size() * 2));
+    }
+
+    if (!bytes.empty()) {
+        std::memcpy(reinterpret_cast<char*>(storage_.data()) + offset, bytes.data(), bytes.size());
+    }
+    size_ = new_size;
+    return offset;
+}
+
+FlatImage FlatImageBuilder::Finish(std::string_view root_bytes, std::size_t root_alignment) {
+    const auto root_offset = Append(root_bytes, root_alignment);
+
+    auto* const data = reinterpret_cast<char*>(storage_.data());
+    const ImageHeader header{kImageMagic, root_offset, root_bytes.size(), 0};
+    std::memcpy(data, &header, sizeof(header));
+
+    auto storage = std::make_shared<std::vector<std::max_align_t>>(std::move(storage_));
+    return FlatImage{PinnedBytes{std::string_view{data, size_}, std::move(storage)}};
+}
+
+void Write(Writer& writer, const FlatImage& image) {
+    const auto bytes = image.GetBytes();
+    // The size is written with a fixed width and padded, so that the image
+    // stays aligned if it starts at an aligned position of the dump
+    impl::WriteTrivial(writer, std::uint64_t{bytes.size()});
+    impl::WriteTrivial(writer, std::uint64_t{0});
+
+    for (std::size_t position = 0; position < bytes.size(); position += kWriteChunkSize) {
+        WriteStringViewUnsafe(writer, bytes.substr(position, kWriteChunkSize));
+    }
+}
+
+FlatImage Read(Reader& reader, To<FlatImage>) {
+    const auto size = impl::ReadTrivial<std::uint64_t>(reader);
+    impl::ReadTrivial<std::uint64_t>(reader);
+    if (size == 0) return {};
+
+    auto bytes = ReadPinnedUnsafe(reader, size);
+    if (!IsAligned(bytes.data.data(), FlatImage::kAlignment)) {
+        // The image did not start at an aligned position of a memory-mapped dump
+        auto storage = std::make_shared<std::vector<std::max_align_t>>(
+            AlignUp(size, sizeof(std::max_align_t)) / sizeof(std::max_align_t)
+        );
+        auto* const data = reinterpret_cast<char*>(storage->data());
+        std::memcpy(data, bytes.data.data(), size);
+        bytes = PinnedBytes{std::string_view{data, size}, std::move(storage)};
+    }
+    return FlatImage{std::move(bytes)};
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,125 @@
+#include <userver/dump/flat_image.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/test_helpers.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+/// [Sample FlatImage usage]
+struct UserEntry final {
+    std::uint64_t id;
+    dump::FlatString name;
+};
+
+struct UsersRoot final {
+    dump::FlatArray<UserEntry> users;  // sorted by id
+};
+
+dump::FlatImage BuildUsers(std::vector<std::pair<std::uint64_t, std::string>> users) {
+    std::sort(users.begin(), users.end());
+
+    dump::FlatImageBuilder builder;
+    std::vector<UserEntry> entries;
+    entries.reserve(users.size());
+    for (const auto& [id, name] : users) {
+        entries.push_back({id, builder.AddString(name)});
+    }
+    const auto users_array = builder.AddArray(entries);
+    return std::move(builder).Build(UsersRoot{users_array});
+}
+
+std::optional<std::string_view> FindUserName(const dump::FlatImage& image, std::uint64_t id) {
+    const auto users = image.GetArray(image.GetRoot<UsersRoot>().users);
+    const auto* it =
+        std::lower_bound(users.begin(), users.end(), id, [](const UserEntry& entry, std::uint64_t id) {
+            return entry.id < id;
+        });
+    if (it == users.end() || it->id != id) return std::nullopt;
+    return image.GetString(it->name);
+}
+/// [Sample FlatImage usage]
+
+}  // namespace
+
+TEST(DumpFlatImage, BuildAndLookup) {
+    const auto image = BuildUsers({{3, "three"}, {1, "one"}, {2, ""}});
+
+    EXPECT_EQ(FindUserName(image, 1), "one");
+    EXPECT_EQ(FindUserName(image, 2), "");
+    EXPECT_EQ(FindUserName(image, 3), "three");
+    EXPECT_EQ(FindUserName(image, 4), std::nullopt);
+}
+
+TEST(DumpFlatImage, EmptyImage) {
+    const dump::FlatImage image;
+    EXPECT_TRUE(image.GetBytes().empty());
+    UEXPECT_THROW(image.GetRoot<UsersRoot>(), dump::Error);
+
+    const auto restored = dump::FromBinary<dump::FlatImage>(dump::ToBinary(image));
+    EXPECT_TRUE(restored.GetBytes().empty());
+}
+
+TEST(DumpFlatImage, WrongRootType) {
+    const auto image = BuildUsers({{1, "one"}});
+    UEXPECT_THROW(image.GetRoot<UserEntry>(), dump::Error);
+}
+
+TEST(DumpFlatImage, OutOfBounds) {
+    const auto image = BuildUsers({{1, "one"}});
+    UEXPECT_THROW(image.GetString({image.GetBytes().size(), 1}), dump::Error);
+    UEXPECT_THROW(image.GetArray(dump::FlatArray<UserEntry>{0, image.GetBytes().size()}), dump::Error);
+}
+
+TEST(DumpFlatImage, CorruptedImage) {
+    const auto image = BuildUsers({{1, "one"}});
+    auto binary = dump::ToBinary(image);
+    binary[sizeof(std::uint64_t) * 2] ^= 1;  // the image magic
+    UEXPECT_THROW(dump::FromBinary<dump::FlatImage>(binary), dump::Error);
+}
+
+TEST(DumpFlatImage, Binary) {
+    const auto image = BuildUsers({{1, "one"}, {2, "two"}});
+    const auto restored = dump::FromBinary<dump::FlatImage>(dump::ToBinary(image));
+
+    EXPECT_EQ(restored.GetBytes(), image.GetBytes());
+    EXPECT_EQ(FindUserName(restored, 2), "two");
+}
+
+UTEST(DumpFlatImage, MappedFile) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/dump";
+
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    dump::FileWriter writer(path, boost::filesystem::perms::owner_read, scope_time);
+    writer.Write(BuildUsers({{1, std::string(100, 'a')}, {2, "two"}}));
+    writer.Finish();
+
+    dump::FlatImage image;
+    {
+        dump::MappedFileReader reader(path);
+        image = reader.Read<dump::FlatImage>();
+        reader.Finish();
+    }
+
+    // The image starts at an aligned offset, so it points into the mapping
+    const auto* mapping_start = image.GetBytes().data() - 2 * sizeof(std::uint64_t);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapping_start) % sysconf(_SC_PAGESIZE), 0);
+    EXPECT_EQ(FindUserName(image, 1), std::string(100, 'a'));
+    EXPECT_EQ(FindUserName(image, 2), "two");
+}
+
+USERVER_NAMESPACE_END
@@ -1,16 +1,50 @@
 #include <userver/dump/operations.hpp>
 
+#include <cstddef>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <fmt/format.h>
+
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace dump {
 
+namespace {
+// Limits the size of intermediate buffers of readers
+constexpr std::size_t kMaxPinnedChunkSize{1 << 20};
+}  // namespace
+
 void Reader::BackUp(std::size_t /*size*/) {
     UASSERT_MSG(false, "BackUp operation is not implemented");
     throw Error("BackUp operation is not implemented");
 }
 
+PinnedBytes Reader::ReadPinned(std::size_t size) {
+    using Storage = std::vector<std::max_align_t>;
+    auto storage = std::make_shared<Storage>((size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t));
+    auto* const data = reinterpret_cast<char*>(storage->data());
+
+    std::size_t bytes_read = 0;
+    while (bytes_read != size) {
+        const auto chunk = ReadRaw(std::min(size - bytes_read, kMaxPinnedChunkSize));
+        if (chunk.empty()) {
+            throw Error(fmt::format(
+                "Unexpected end-of-file while trying to read from the dump "
+                "file: requested-size={}",
+                size
+            ));
+        }
+        std::memcpy(data + bytes_read, chunk.data(), chunk.size());
+        bytes_read += chunk.size();
+    }
+
+    return {std::string_view{data, size}, std::move(storage)};
+}
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
@@ -1,16 +1,27 @@
 #include <userver/dump/operations_encrypted.hpp>
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+
 #include <fmt/format.h>
+#include <openssl/evp.h>
 #include <boost/filesystem/operations.hpp>
 
 #include <cryptopp/files.h>
 #include <cryptopp/gcm.h>
 #include <cryptopp/modes.h>
-#include <cryptopp/osrng.h>
 
+#include <crypto/helpers.hpp>
+#include <userver/crypto/openssl.hpp>
 #include <userver/crypto/random.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/fs/blocking/c_file.hpp>
 #include <userver/fs/blocking/write.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,26 +29,141 @@ USERVER_NAMESPACE_BEGIN
 namespace dump {
 
 namespace {
+
 constexpr std::size_t kCheckTimeAfterBytes{16 * 1024};
+
+/* The dump is split into chunks that are encrypted by AES-GCM independently:
+ *
+ *   magic | base nonce | chunk 0 | chunk 1 | ... | final chunk
+ *   chunk = plaintext size (4 bytes, big-endian) | flags (1 byte) | ciphertext | tag
+ *
+ * The nonce of the i-th chunk is the base nonce xor i, the size and the flags
+ * are authenticated as the additional data. So the chunks may neither be
+ * reordered nor dropped, and the dump must end with the final chunk.
+ */
+constexpr std::string_view kChunkedMagic{"\0udgcm01", 8};
+constexpr std::size_t kNonceSize = 12;
+constexpr std::size_t kTagSize = 16;
+constexpr std::size_t kChunkHeaderSize = 5;
+constexpr std::size_t kChunkSize = 1 << 20;
+constexpr std::size_t kMaxParallelChunks = 8;
+constexpr std::uint8_t kFinalChunkFlag = 1;
+
+using Nonce = std::array<unsigned char, kNonceSize>;
+using ChunkHeader = std::array<unsigned char, kChunkHeaderSize>;
+
+ChunkHeader MakeChunkHeader(std::size_t size, bool is_final) {
+    UASSERT(size <= kChunkSize);
+    return {
+        static_cast<unsigned char>(size >> 24),
+        static_cast<unsigned char>(size >> 16),
+        static_cast<unsigned char>(size >> 8),
+        static_cast<unsigned char>(size),
+        static_cast<unsigned char>(is_final ? kFinalChunkFlag : 0),
+    };
 }
 
-using Encryption = ::CryptoPP::GCM<::CryptoPP::AES>::Encryption;
-using Decryption = ::CryptoPP::GCM<::CryptoPP::AES>::Decryption;
+std::size_t GetChunkSize(const ChunkHeader& header) {
+    return (std::size_t{header[0]} << 24) | (std::size_t{header[1]} << 16) | (std::size_t{header[2]} << 8) |
+           std::size_t{header[3]};
+}
 
-using IV = utils::NonLoggable<class IvTag, std::string>;
+bool IsFinalChunk(const ChunkHeader& header) { return header[4] & kFinalChunkFlag; }
 
-struct EncryptedWriter::Impl {
-    std::string filename;
-    Encryption encryption;
-    std::unique_ptr<::CryptoPP::AuthenticatedEncryptionFilter> filter;
-    utils::StreamingCpuRelax cpu_relax_;
+Nonce MakeChunkNonce(const Nonce& base_nonce, std::uint64_t index) {
+    auto nonce = base_nonce;
+    for (std::size_t i = 0; i < sizeof(index); ++i) {
+        nonce[kNonceSize - 1 - i] ^= static_cast<unsigned char>(index >> (8 * i));
+    }
+    return nonce;
+}
 
-    Impl(std::string&& filename, tracing::ScopeTime* scope)
-        : filename(std::move(filename)), cpu_relax_(kCheckTimeAfterBytes, scope) {}
+const EVP_CIPHER* GetCipher(const SecretKey& secret_key) {
+    switch (secret_key.GetUnderlying().size()) {
+        case 16:
+            return EVP_aes_128_gcm();
+        case 24:
+            return EVP_aes_192_gcm();
+        case 32:
+            return EVP_aes_256_gcm();
+        default:
+            throw Error(fmt::format(
+                "Unexpected size of the dump secret key: {}, expected 16, 24 or 32 bytes",
+                secret_key.GetUnderlying().size()
+            ));
+    }
+}
 
-    std::string GetTempFilename() const { return filename + ".tmp"; }
+/// Key material of a dump, shared by the chunk tasks
+struct ChunkCipher final {
+    const EVP_CIPHER* cipher;
+    SecretKey key;
+    Nonce base_nonce;
 };
 
+struct CipherCtxDeleter final {
+    void operator()(EVP_CIPHER_CTX* ctx) const noexcept { EVP_CIPHER_CTX_free(ctx); }
+};
+
+using CipherCtx = std::unique_ptr<EVP_CIPHER_CTX, CipherCtxDeleter>;
+
+CipherCtx MakeCipherCtx() {
+    CipherCtx ctx{EVP_CIPHER_CTX_new()};
+    if (!ctx) throw Error(crypto::FormatSslError("Failed to encrypt a dump chunk: EVP_CIPHER_CTX_new"));
+    return ctx;
+}
+
+const unsigned char* AsBytes(std::string_view data) { return reinterpret_cast<const unsigned char*>(data.data()); }
+
+unsigned char* AsBytes(std::string& data) { return reinterpret_cast<unsigned char*>(data.data()); }
+
+// OpenSSL picks the AES-NI/VAES implementation of GCM at runtime
+std::string EncryptChunk(const ChunkCipher& cipher, std::uint64_t index, std::string_view data, bool is_final) {
+    const auto header = MakeChunkHeader(data.size(), is_final);
+    const auto nonce = MakeChunkNonce(cipher.base_nonce, index);
+
+    std::string result(kChunkHeaderSize + data.size() + kTagSize, '\0');
+    std::memcpy(result.data(), header.data(), header.size());
+    auto* const out = AsBytes(result) + kChunkHeaderSize;
+
+    const auto ctx = MakeCipherCtx();
+    int len = 0;
+    if (EVP_EncryptInit_ex(ctx.get(), cipher.cipher, nullptr, AsBytes(cipher.key.GetUnderlying()), nonce.data()) != 1 ||
+        EVP_EncryptUpdate(ctx.get(), nullptr, &len, header.data(), static_cast<int>(header.size())) != 1 ||
+        EVP_EncryptUpdate(ctx.get(), out, &len, AsBytes(data), static_cast<int>(data.size())) != 1 ||
+        EVP_EncryptFinal_ex(ctx.get(), out + len, &len) != 1 ||
+        EVP_CIPHER_CTX_ctrl(ctx.get(), EVP_CTRL_GCM_GET_TAG, kTagSize, out + data.size()) != 1) {
+        throw Error(crypto::FormatSslError("Failed to encrypt a dump chunk"));
+    }
+    return result;
+}
+
+std::string DecryptChunk(const ChunkCipher& cipher, std::uint64_t index, const ChunkHeader& header, std::string chunk) {
+    UASSERT(chunk.size() == GetChunkSize(header) + kTagSize);
+    const auto nonce = MakeChunkNonce(cipher.base_nonce, index);
+    const auto size = GetChunkSize(header);
+    auto* const data = AsBytes(chunk);
+
+    const auto ctx = MakeCipherCtx();
+    int len = 0;
+    if (EVP_DecryptInit_ex(ctx.get(), cipher.cipher, nullptr, AsBytes(cipher.key.GetUnderlying()), nonce.data()) != 1 ||
+        EVP_DecryptUpdate(ctx.get(), nullptr, &len, header.data(), static_cast<int>(header.size())) != 1 ||
+        EVP_DecryptUpdate(ctx.get(), data, &len, data, static_cast<int>(size)) != 1 ||
+        EVP_CIPHER_CTX_ctrl(ctx.get(), EVP_CTRL_GCM_SET_TAG, kTagSize, data + size) != 1) {
+        throw Error(crypto::FormatSslError("Failed to decrypt a dump chunk"));
+    }
+    if (EVP_DecryptFinal_ex(ctx.get(), data + len, &len) != 1) {
+        throw Error(fmt::format("Failed to authenticate the chunk #{} of an encrypted dump", index));
+    }
+
+    chunk.resize(size);
+    return chunk;
+}
+
+using Decryption = ::CryptoPP::GCM<::CryptoPP::AES>::Decryption;
+
+using IV = utils::NonLoggable<class IvTag, std::string>;
+
 constexpr std::size_t kIvSize = ::CryptoPP::AES::BLOCKSIZE;
 
 constexpr std::size_t kMinPumpSize = 32768;
@@ -47,132 +173,343 @@ inline const unsigned char* GetBytes(const T& data) {
     return reinterpret_cast<const unsigned char*>(data.GetUnderlying().data());
 }
 
+/// Reads the dumps written as a single CryptoPP AES-GCM stream
+class StreamReader final {
+public:
+    StreamReader(const std::string& filename, const SecretKey& secret_key);
+
+    std::string_view ReadRaw(std::size_t max_size);
+
+    void BackUp(std::size_t size);
+
+    void Finish(const std::string& filename);
+
+private:
+    Decryption decryption_;
+    std::unique_ptr<::CryptoPP::FileSource> file_;
+
+    std::size_t next_skip_{0};  // how many bytes in `raw_` should be skipped
+    std::string raw_;
+};
+
+StreamReader::StreamReader(const std::string& filename, const SecretKey& secret_key) {
+    constexpr bool kPumpAll = false;
+
+    IV iv;
+    file_ = std::make_unique<::CryptoPP::FileSource>(
+        filename.c_str(), kPumpAll, new ::CryptoPP::StringSink(iv.GetUnderlying())
+    );
+
+    auto& file = *file_;
+
+    file.Pump(kIvSize);
+    if (iv.size() != kIvSize) {
+        throw Error(fmt::format(
+            "Unexpected end-of-file while trying to read IV from encrypted dump "
+            "file \"{}\": requested-size={}",
+            filename,
+            kIvSize
+        ));
+    }
+    file.Detach();
+
+    decryption_.SetKeyWithIV(GetBytes(secret_key), secret_key.size(), GetBytes(iv), kIvSize);
+
+    file.Attach(new ::CryptoPP::AuthenticatedDecryptionFilter(decryption_, new ::CryptoPP::StringSink(raw_)));
+}
+
+std::string_view StreamReader::ReadRaw(std::size_t max_size) {
+    UASSERT(raw_.size() >= next_skip_);
+
+    if (raw_.size() - next_skip_ >= max_size) {
+        // There are enough bytes in `raw_`, just return it
+        auto skip = next_skip_;
+        next_skip_ += max_size;
+        return {raw_.data() + skip, max_size};
+    }
+
+    // Not enough bytes in `raw_`, move it and read the rest (or until EOF)
+
+    if (next_skip_) {
+        // Remove previously read data chunk
+        raw_.erase(0, next_skip_);
+    }
+
+    // If raw doesn't contain enough bytes, read it
+    while (raw_.size() < max_size) {
+        auto pump_size = std::max(max_size, kMinPumpSize);
+        file_->Pump(pump_size);
+        if (file_->GetStream()->eof()) {
+            file_->PumpAll();
+            break;
+        }
+    }
+
+    const auto result_size = std::min(raw_.size(), max_size);
+    next_skip_ = result_size;
+    return {raw_.data(), result_size};
+}
+
+void StreamReader::BackUp(std::size_t size) {
+    UASSERT_MSG(size <= next_skip_, "Trying to BackUp more bytes than returned by the last ReadRaw");
+    next_skip_ -= size;
+}
+
+void StreamReader::Finish(const std::string& filename) {
+    if (file_->GetStream()->eof()) return;
+
+    raw_.clear();
+    file_->Pump(1);
+    if (raw_.empty() && file_->GetStream()->eof()) return;
+
+    throw Error(fmt::format("Unexpected extra data at the end of encrypted dump file \"{}\"", filename));
+}
+
+}  // namespace
+
+struct EncryptedWriter::Impl {
+    std::string filename;
+    fs::blocking::CFile file;
+    ChunkCipher cipher;
+    std::uint64_t next_chunk_index{0};
+    std::string buffer;
+    utils::StreamingCpuRelax cpu_relax_;
+    // Declared last, the tasks refer to `cipher`
+    std::deque<engine::TaskWithResult<std::string>> in_flight;
+
+    Impl(std::string&& filename, const SecretKey& secret_key, tracing::ScopeTime* scope)
+        : filename(std::move(filename)),
+          cipher{GetCipher(secret_key), secret_key, {}},
+          cpu_relax_(kCheckTimeAfterBytes, scope) {}
+
+    std::string GetTempFilename() const { return filename + ".tmp"; }
+
+    void StartChunk(bool is_final) {
+        in_flight.push_back(utils::Async(
+            "dump-encrypt-chunk",
+            [this, index = next_chunk_index++, data = std::move(buffer), is_final] {
+                return EncryptChunk(cipher, index, data, is_final);
+            }
+        ));
+        buffer = {};
+    }
+
+    void WriteReadyChunk() {
+        const auto chunk = in_flight.front().Get();
+        in_flight.pop_front();
+        file.Write(chunk);
+    }
+};
+
 EncryptedWriter::EncryptedWriter(
     std::string filename,
     const SecretKey& secret_key,
     boost::filesystem::perms perms,
     tracing::ScopeTime& scope
 )
-    : impl_(std::move(filename), &scope) {
-    IV iv{crypto::GenerateRandomBlock(kIvSize)};
-    impl_->encryption.SetKeyWithIV(GetBytes(secret_key), secret_key.GetUnderlying().size(), GetBytes(iv), iv.size());
-
-    // Create empty file with the passed perms and reopen it
-    // because CryptoPP is not able to pass perms
-    const auto& temp_filename = impl_->GetTempFilename();
-    fs::blocking::RewriteFileContents(temp_filename, "");
-    auto sink = std::make_unique<::CryptoPP::FileSink>(temp_filename.c_str());
-    fs::blocking::Chmod(temp_filename, perms);
+    : impl_(std::move(filename), secret_key, &scope) {
+    crypto::Openssl::Init();
 
-    // 1. IV
-    sink->Put(reinterpret_cast<unsigned char*>(iv.GetUnderlying().data()), iv.size());
+    const auto nonce = crypto::GenerateRandomBlock(kNonceSize);
+    std::memcpy(impl_->cipher.base_nonce.data(), nonce.data(), kNonceSize);
 
-    impl_->filter = std::make_unique<::CryptoPP::AuthenticatedEncryptionFilter>(impl_->encryption, sink.release());
+    const auto& temp_filename = impl_->GetTempFilename();
+    try {
+        impl_->file = fs::blocking::CFile{
+            temp_filename,
+            {fs::blocking::OpenFlag::kWrite,
+             fs::blocking::OpenFlag::kCreateIfNotExists,
+             fs::blocking::OpenFlag::kTruncate},
+            perms | boost::filesystem::perms::owner_write};
+        fs::blocking::Chmod(temp_filename, perms);
+
+        impl_->file.Write(kChunkedMagic);
+        impl_->file.Write(nonce);
+    } catch (const std::exception& ex) {
+        throw Error(fmt::format("Failed to open the dump file for write \"{}\": {}", temp_filename, ex.what()));
+    }
+    impl_->buffer.reserve(kChunkSize);
 }
 
 EncryptedWriter::~EncryptedWriter() = default;
 
 void EncryptedWriter::WriteRaw(std::string_view data) {
-    // 2. Data
-    impl_->filter->Put(reinterpret_cast<const unsigned char*>(data.data()), data.size());
-    impl_->cpu_relax_.Relax(data.size());
+    auto& impl = *impl_;
+    impl.cpu_relax_.Relax(data.size());
+
+    while (!data.empty()) {
+        const auto part = data.substr(0, kChunkSize - impl.buffer.size());
+        impl.buffer.append(part);
+        data.remove_prefix(part.size());
+        if (impl.buffer.size() < kChunkSize) break;
+
+        // The final chunk is started by Finish, even if it is empty
+        if (impl.in_flight.size() == kMaxParallelChunks) impl.WriteReadyChunk();
+        impl.StartChunk(false);
+        impl.buffer.reserve(kChunkSize);
+    }
 }
 
 void EncryptedWriter::Finish() {
-    const bool hard_flush = true;
-    impl_->filter->MessageEnd();
-    impl_->filter->Flush(hard_flush);
+    auto& impl = *impl_;
+    impl.StartChunk(true);
+    while (!impl.in_flight.empty()) impl.WriteReadyChunk();
 
-    fs::blocking::Rename(impl_->GetTempFilename(), impl_->filename);
+    impl.file.Flush();
+    std::move(impl.file).Close();
+    fs::blocking::Rename(impl.GetTempFilename(), impl.filename);
 }
 
 struct EncryptedReader::Impl {
     std::string filename;
-    Decryption decryption;
-    std::unique_ptr<::CryptoPP::FileSource> file;
 
-    size_t next_skip{0};  // how many bytes in `raw` should be skipped
+    // Either the chunked format...
+    fs::blocking::CFile file;
+    ChunkCipher cipher;
+    std::uint64_t next_chunk_index{0};
+    bool final_chunk_read{false};
+    std::size_t next_skip{0};  // how many bytes in `raw` should be skipped
     std::string raw;
-};
+    // Declared after `cipher`, the tasks refer to it
+    std::deque<engine::TaskWithResult<std::string>> in_flight;
 
-EncryptedReader::EncryptedReader(std::string filename, const SecretKey& secret_key) {
-    impl_->filename = filename;
+    // ...or the legacy single stream
+    std::unique_ptr<StreamReader> stream;
 
-    constexpr bool kPumpAll = false;
+    Impl(std::string&& filename, const SecretKey& secret_key)
+        : filename(std::move(filename)), cipher{GetCipher(secret_key), secret_key, {}} {}
 
-    IV iv;
-    impl_->file = std::make_unique<::CryptoPP::FileSource>(
-        impl_->filename.c_str(), kPumpAll, new ::CryptoPP::StringSink(iv.GetUnderlying())
-    );
+    std::size_t ReadFile(void* buffer, std::size_t size) {
+        try {
+            return file.Read(static_cast<char*>(buffer), size);
+        } catch (const std::exception& ex) {
+            throw Error(fmt::format("Failed to read from the dump file \"{}\": {}", filename, ex.what()));
+        }
+    }
 
-    auto& file = *impl_->file;
+    void ReadFileExactly(void* buffer, std::size_t size) {
+        if (ReadFile(buffer, size) != size) {
+            throw Error(fmt::format(
+                "Unexpected end-of-file while trying to read from encrypted dump file \"{}\": requested-size={}",
+                filename,
+                size
+            ));
+        }
+    }
 
-    file.Pump(kIvSize);
-    if (iv.size() != kIvSize) {
-        throw Error(fmt::format(
-            "Unexpected end-of-file while trying to read IV from encrypted dump "
-            "file \"{}\": requested-size={}",
-            impl_->filename,
-            kIvSize
+    void StartChunk() {
+        ChunkHeader header{};
+        ReadFileExactly(header.data(), header.size());
+        const auto size = GetChunkSize(header);
+        if (size > kChunkSize) {
+            throw Error(fmt::format("Unexpected chunk size in encrypted dump file \"{}\": {}", filename, size));
+        }
+
+        std::string chunk(size + kTagSize, '\0');
+        ReadFileExactly(chunk.data(), chunk.size());
+        final_chunk_read = IsFinalChunk(header);
+
+        in_flight.push_back(utils::Async(
+            "dump-decrypt-chunk",
+            [this, index = next_chunk_index++, header, chunk = std::move(chunk)]() mutable {
+                return DecryptChunk(cipher, index, header, std::move(chunk));
+            }
         ));
     }
-    file.Detach();
 
-    impl_->decryption.SetKeyWithIV(GetBytes(secret_key), secret_key.size(), GetBytes(iv), kIvSize);
+    bool HasMoreChunks() const { return !final_chunk_read || !in_flight.empty(); }
 
-    file.Attach(new ::CryptoPP::AuthenticatedDecryptionFilter(impl_->decryption, new ::CryptoPP::StringSink(impl_->raw))
-    );
-}
+    std::string NextChunk() {
+        UASSERT(HasMoreChunks());
+        while (!final_chunk_read && in_flight.size() < kMaxParallelChunks) StartChunk();
 
-EncryptedReader::~EncryptedReader() = default;
+        auto chunk = in_flight.front().Get();
+        in_flight.pop_front();
+        return chunk;
+    }
+};
 
-std::string_view EncryptedReader::ReadRaw(std::size_t max_size) {
-    auto& raw = impl_->raw;
+EncryptedReader::EncryptedReader(std::string filename, const SecretKey& secret_key)
+    : impl_(std::move(filename), secret_key) {
+    crypto::Openssl::Init();
 
-    UASSERT(raw.size() >= impl_->next_skip);
+    try {
+        impl_->file = fs::blocking::CFile{impl_->filename, fs::blocking::OpenFlag::kRead};
+    } catch (const std::exception& ex) {
+        throw Error(fmt::format(
+            "Failed to open the dump file for reading \"{}\". Reason: {}", impl_->filename, ex.what()
+        ));
+    }
 
-    if (raw.size() - impl_->next_skip >= max_size) {
-        // There are enough bytes in `raw`, just return it
-        auto skip = impl_->next_skip;
-        impl_->next_skip += max_size;
-        return {impl_->raw.data() + skip, max_size};
+    std::array<char, kChunkedMagic.size()> magic{};
+    const auto magic_size = impl_->ReadFile(magic.data(), magic.size());
+    if (std::string_view{magic.data(), magic_size} != kChunkedMagic) {
+        // A random IV of an old dump does not start with the magic, in practice
+        std::move(impl_->file).Close();
+        impl_->stream = std::make_unique<StreamReader>(impl_->filename, secret_key);
+        return;
     }
 
-    // Not enough bytes in `raw`, move it and read the rest (or until EOF)
+    impl_->ReadFileExactly(impl_->cipher.base_nonce.data(), kNonceSize);
+}
 
-    if (impl_->next_skip) {
-        // Remove previously read data chunk
-        raw.erase(0, impl_->next_skip);
-    }
+EncryptedReader::~EncryptedReader() = default;
 
-    // If raw doesn't contain enough bytes, read it
-    while (impl_->raw.size() < max_size) {
-        auto pump_size = std::max(max_size, kMinPumpSize);
-        impl_->file->Pump(pump_size);
-        if (impl_->file->GetStream()->eof()) {
-            impl_->file->PumpAll();
-            break;
+std::string_view EncryptedReader::ReadRaw(std::size_t max_size) {
+    auto& impl = *impl_;
+    if (impl.stream) return impl.stream->ReadRaw(max_size);
+
+    UASSERT(impl.raw.size() >= impl.next_skip);
+    if (impl.raw.size() - impl.next_skip < max_size) {
+        // Not enough bytes in `raw`, drop the consumed ones and decrypt the next chunks
+        impl.raw.erase(0, impl.next_skip);
+        impl.next_skip = 0;
+
+        while (impl.raw.size() < max_size && impl.HasMoreChunks()) {
+            auto chunk = impl.NextChunk();
+            if (impl.raw.empty()) {
+                impl.raw = std::move(chunk);
+            } else {
+                impl.raw += chunk;
+            }
         }
     }
 
-    const auto result_size = std::min(impl_->raw.size(), max_size);
-    impl_->next_skip = result_size;
-    return {impl_->raw.data(), result_size};
+    const auto result = std::string_view{impl.raw}.substr(impl.next_skip, max_size);
+    impl.next_skip += result.size();
+    return result;
 }
 
 void EncryptedReader::BackUp(std::size_t size) {
+    if (impl_->stream) {
+        impl_->stream->BackUp(size);
+        return;
+    }
+
     UASSERT_MSG(size <= impl_->next_skip, "Trying to BackUp more bytes than returned by the last ReadRaw");
     impl_->next_skip -= size;
 }
 
 void EncryptedReader::Finish() {
-    if (impl_->file->GetStream()->eof()) return;
+    auto& impl = *impl_;
+    if (impl.stream) {
+        impl.stream->Finish(impl.filename);
+        return;
+    }
 
-    impl_->raw.clear();
-    impl_->file->Pump(1);
-    if (impl_->raw.empty() && impl_->file->GetStream()->eof()) return;
+    bool has_extra_data = impl.next_skip != impl.raw.size();
+    while (!has_extra_data && impl.HasMoreChunks()) {
+        has_extra_data = !impl.NextChunk().empty();
+    }
+    if (!has_extra_data) {
+        char extra_byte = 0;
+        has_extra_data = impl.ReadFile(&extra_byte, 1) != 0;
+    }
+    if (has_extra_data) {
+        throw Error(fmt::format("Unexpected extra data at the end of encrypted dump file \"{}\"", impl.filename));
+    }
 
-    throw Error(fmt::format("Unexpected extra data at the end of encrypted dump file \"{}\"", impl_->filename));
+    std::move(impl.file).Close();
 }
 
 EncryptedOperationsFactory::EncryptedOperationsFactory(SecretKey&& secret_key, boost::filesystem::perms perms)
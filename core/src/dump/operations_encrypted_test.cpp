@@ -2,17 +2,40 @@
 
 #include <boost/filesystem/operations.hpp>
 
+#include <cryptopp/files.h>
+#include <cryptopp/gcm.h>
+
+#include <userver/crypto/random.hpp>
 #include <userver/dump/common.hpp>
 #include <userver/dump/operations_encrypted.hpp>
+#include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/tracing/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace {
+
 const dump::SecretKey kTestKey{"12345678901234567890123456789012"};
+
+void WriteStrings(const std::string& path, std::size_t count, std::size_t size) {
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    dump::EncryptedWriter writer(path, kTestKey, boost::filesystem::perms::owner_read, scope_time);
+    for (std::size_t i = 0; i < count; ++i) writer.Write(std::string(size, static_cast<char>('a' + i % 26)));
+    writer.Finish();
 }
 
+void ReadStrings(const std::string& path, std::size_t count, std::size_t size) {
+    dump::EncryptedReader reader(path, kTestKey);
+    for (std::size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(reader.Read<std::string>(), std::string(size, static_cast<char>('a' + i % 26)));
+    }
+    reader.Finish();
+}
+
+}  // namespace
+
 UTEST(DumpEncFile, Smoke) {
     const auto dir = fs::blocking::TempDirectory::Create();
     const auto path = dir.GetPath() + "/file";
@@ -24,7 +47,7 @@ UTEST(DumpEncFile, Smoke) {
     UEXPECT_NO_THROW(w.Finish());
 
     auto size = boost::filesystem::file_size(path);
-    EXPECT_EQ(size, 33);
+    EXPECT_EQ(size, 42);
 
     dump::EncryptedReader r(path, kTestKey);
     EXPECT_EQ(r.Read<int32_t>(), 1);
@@ -45,7 +68,7 @@ UTEST(DumpEncFile, UnreadData) {
     UEXPECT_NO_THROW(w.Finish());
 
     auto size = boost::filesystem::file_size(path);
-    EXPECT_EQ(size, 33);
+    EXPECT_EQ(size, 42);
 
     dump::EncryptedReader r(path, kTestKey);
 
@@ -63,7 +86,7 @@ UTEST(DumpEncFile, Long) {
     UEXPECT_NO_THROW(w.Finish());
 
     auto size = boost::filesystem::file_size(path);
-    EXPECT_EQ(size, 416);
+    EXPECT_EQ(size, 425);
 
     dump::EncryptedReader r(path, kTestKey);
     for (int i = 0; i < 256; i++) EXPECT_EQ(r.Read<int32_t>(), i);
@@ -99,4 +122,75 @@ UTEST(DumpEncFile, ReadBackUp) {
     UEXPECT_NO_THROW(reader.Finish());
 }
 
+UTEST_MT(DumpEncFile, ManyChunks, 4) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+
+    // ~10 chunks, the strings cross the chunk boundaries
+    constexpr std::size_t kCount = 1000;
+    constexpr std::size_t kSize = 10'007;
+    WriteStrings(path, kCount, kSize);
+    UEXPECT_NO_THROW(ReadStrings(path, kCount, kSize));
+}
+
+UTEST(DumpEncFile, Tampered) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+    constexpr std::size_t kCount = 300;
+    constexpr std::size_t kSize = 10'000;
+    WriteStrings(path, kCount, kSize);
+    const auto contents = fs::blocking::ReadFileContents(path);
+
+    const auto check_broken = [&](const std::string& broken_contents) {
+        boost::filesystem::remove(path);
+        fs::blocking::RewriteFileContents(path, broken_contents);
+        UEXPECT_THROW(ReadStrings(path, kCount, kSize), dump::Error);
+    };
+
+    auto flipped = contents;
+    flipped[flipped.size() / 2] ^= 1;
+    check_broken(flipped);
+
+    // magic + nonce, then the full chunks of 1MiB with a header and a tag
+    constexpr std::size_t kFullChunkSize = 5 + (1 << 20) + 16;
+    check_broken(contents.substr(0, 20 + 2 * kFullChunkSize));
+    check_broken(contents.substr(0, 20 + kFullChunkSize + 100));
+
+    check_broken(contents + '\0');
+}
+
+UTEST(DumpEncFile, WrongKey) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+    WriteStrings(path, 1, 10);
+
+    const dump::SecretKey other_key{"abcdefghijabcdefghijabcdefghijab"};
+    UEXPECT_THROW(dump::EncryptedReader(path, other_key).Read<std::string>(), dump::Error);
+}
+
+UTEST(DumpEncFile, StreamFormat) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+
+    // The dumps written before the chunked format are still readable
+    const auto iv = crypto::GenerateRandomBlock(::CryptoPP::AES::BLOCKSIZE);
+    const auto* const key = reinterpret_cast<const unsigned char*>(kTestKey.GetUnderlying().data());
+    ::CryptoPP::GCM<::CryptoPP::AES>::Encryption encryption;
+    encryption.SetKeyWithIV(
+        key, kTestKey.GetUnderlying().size(), reinterpret_cast<const unsigned char*>(iv.data()), iv.size()
+    );
+    std::string encrypted;
+    ::CryptoPP::StringSource(
+        "\x01\x05hello",
+        true,
+        new ::CryptoPP::AuthenticatedEncryptionFilter(encryption, new ::CryptoPP::StringSink(encrypted))
+    );
+    fs::blocking::RewriteFileContents(path, iv + encrypted);
+
+    dump::EncryptedReader reader(path, kTestKey);
+    EXPECT_EQ(reader.Read<int32_t>(), 1);
+    EXPECT_EQ(reader.Read<std::string>(), "hello");
+    UEXPECT_NO_THROW(reader.Finish());
+}
+
 USERVER_NAMESPACE_END
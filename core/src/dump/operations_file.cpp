@@ -1,13 +1,19 @@
 #include <userver/dump/operations_file.hpp>
 
 #include <algorithm>
+#include <cerrno>
 #include <cstdio>
 #include <stdexcept>
+#include <system_error>
 #include <utility>
 
+#include <sys/mman.h>
+
 #include <fmt/format.h>
 
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/numeric_cast.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -121,9 +127,80 @@ void FileReader::Finish() {
     }
 }
 
-FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms) : perms_(perms) {}
+struct MappedFileReader::Mapping final {
+    Mapping(void* address, std::size_t size) noexcept : address(address), size(size) {}
+
+    Mapping(const Mapping&) = delete;
+    Mapping& operator=(const Mapping&) = delete;
+
+    ~Mapping() { ::munmap(address, size); }
+
+    void* const address;
+    const std::size_t size;
+};
+
+MappedFileReader::MappedFileReader(std::string path) : path_(std::move(path)) {
+    try {
+        const auto fd = fs::blocking::FileDescriptor::Open(path_, fs::blocking::OpenFlag::kRead);
+        const auto size = fd.GetSize();
+        // mmap does not accept empty ranges, an empty dump needs no mapping
+        if (size == 0) return;
+
+        void* const address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd.GetNative(), 0);
+        if (address == MAP_FAILED) {
+            throw std::system_error(errno, std::generic_category(), "mmap");
+        }
+        mapping_ = std::make_shared<const Mapping>(address, size);
+    } catch (const std::exception& ex) {
+        throw Error(fmt::format("Failed to map the dump file for reading \"{}\". Reason: {}", path_, ex.what()));
+    }
+    data_ = std::string_view{static_cast<const char*>(mapping_->address), mapping_->size};
+}
+
+MappedFileReader::~MappedFileReader() = default;
+
+std::string_view MappedFileReader::ReadRaw(std::size_t max_size) {
+    const auto result = data_.substr(position_, max_size);
+    position_ += result.size();
+    return result;
+}
+
+void MappedFileReader::BackUp(std::size_t size) {
+    UASSERT(size <= position_);
+    position_ -= size;
+}
+
+PinnedBytes MappedFileReader::ReadPinned(std::size_t size) {
+    if (size > data_.size() - position_) {
+        throw Error(fmt::format(
+            "Unexpected end-of-file while trying to read from the dump "
+            "file: requested-size={}",
+            size
+        ));
+    }
+    return {ReadRaw(size), mapping_};
+}
+
+void MappedFileReader::Finish() {
+    if (position_ != data_.size()) {
+        throw Error(fmt::format(
+            "Unexpected extra data at the end of the dump file \"{}\": "
+            "file-size={}, position={}, unread-size={}",
+            path_,
+            data_.size(),
+            position_,
+            data_.size() - position_
+        ));
+    }
+}
+
+FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms, bool memory_mapped)
+    : perms_(perms), memory_mapped_(memory_mapped) {}
 
 std::unique_ptr<Reader> FileOperationsFactory::CreateReader(std::string full_path) {
+    if (memory_mapped_) {
+        return std::make_unique<MappedFileReader>(std::move(full_path));
+    }
     return std::make_unique<FileReader>(std::move(full_path));
 }
 
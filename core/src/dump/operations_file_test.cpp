@@ -1,5 +1,8 @@
 #include <userver/dump/operations_file.hpp>
 
+#include <cstddef>
+#include <cstdint>
+
 #include <userver/dump/unsafe.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/temp_directory.hpp>
@@ -129,4 +132,70 @@ TEST(DumpOperationsFile, ReadBackUp) {
     UEXPECT_NO_THROW(reader.Finish());
 }
 
+UTEST(DumpOperationsFile, MappedWriteReadRaw) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = DumpFilePath(dir);
+
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    dump::FileWriter writer(path, boost::filesystem::perms::owner_read, scope_time);
+    WriteStringViewUnsafe(writer, "abcdefg");
+    writer.Finish();
+
+    dump::MappedFileReader reader(path);
+    EXPECT_EQ(dump::ReadUnsafeAtMost(reader, 3), "abc");
+    dump::BackUpReadUnsafe(reader, 1);
+    EXPECT_EQ(ReadStringViewUnsafe(reader, 2), "cd");
+
+    auto pinned = dump::ReadPinnedUnsafe(reader, 3);
+    reader.Finish();
+    EXPECT_EQ(pinned.data, "efg");
+    EXPECT_NE(pinned.owner, nullptr);
+}
+
+TEST(DumpOperationsFile, MappedPinnedOutlivesReaderAndFile) {
+    auto file = fs::blocking::TempFile::Create();
+    fs::blocking::RewriteFileContents(file.GetPath(), "abcdefg");
+
+    dump::PinnedBytes pinned;
+    {
+        dump::MappedFileReader reader(file.GetPath());
+        pinned = dump::ReadPinnedUnsafe(reader, 7);
+        reader.Finish();
+    }
+    std::move(file).Remove();
+
+    EXPECT_EQ(pinned.data, "abcdefg");
+}
+
+TEST(DumpOperationsFile, MappedEmptyDump) {
+    const auto file = fs::blocking::TempFile::Create();
+
+    dump::MappedFileReader reader(file.GetPath());
+    EXPECT_EQ(dump::ReadPinnedUnsafe(reader, 0).data, "");
+    UEXPECT_NO_THROW(reader.Finish());
+}
+
+TEST(DumpOperationsFile, MappedUnderread) {
+    const auto file = fs::blocking::TempFile::Create();
+    fs::blocking::RewriteFileContents(file.GetPath(), std::string(10, 'a'));
+
+    dump::MappedFileReader reader(file.GetPath());
+    UEXPECT_THROW(dump::ReadPinnedUnsafe(reader, 11), dump::Error);
+    EXPECT_EQ(ReadStringViewUnsafe(reader, 9), std::string(9, 'a'));
+    UEXPECT_THROW(reader.Finish(), dump::Error);
+}
+
+TEST(DumpOperationsFile, PinnedCopyIsAligned) {
+    const auto file = fs::blocking::TempFile::Create();
+    fs::blocking::RewriteFileContents(file.GetPath(), "abcdefg");
+
+    dump::FileReader reader(file.GetPath());
+    EXPECT_EQ(ReadStringViewUnsafe(reader, 1), "a");
+    const auto pinned = dump::ReadPinnedUnsafe(reader, 6);
+    reader.Finish();
+
+    EXPECT_EQ(pinned.data, "bcdefg");
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pinned.data.data()) % alignof(std::max_align_t), 0);
+}
+
 USERVER_NAMESPACE_END
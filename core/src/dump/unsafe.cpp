@@ -38,6 +38,12 @@ std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t max_size) {
 
 void BackUpReadUnsafe(Reader& reader, std::size_t size) { reader.BackUp(size); }
 
+PinnedBytes ReadPinnedUnsafe(Reader& reader, std::size_t size) {
+    auto result = reader.ReadPinned(size);
+    UASSERT(result.data.size() == size);
+    return result;
+}
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
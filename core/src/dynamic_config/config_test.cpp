@@ -462,6 +462,47 @@ UTEST(DynamicConfigSubscription, Snippet) {
     EXPECT_EQ(subscriber.GetFooInterestingEventCounter(), 1);
 }
 
+struct NonComparableConfig final {
+    int value;
+};
+
+const dynamic_config::Key kNonComparableConfig{dynamic_config::ConstantConfig{}, NonComparableConfig{0}};
+
+UTEST(DynamicConfig, SubscriptionWithoutEqualityOperator) {
+    dynamic_config::StorageMock storage{{kNonComparableConfig, NonComparableConfig{1}}, {kIntConfig, 1}};
+    auto source = storage.GetSource();
+    Subscriber subscriber;
+
+    auto scope = source.UpdateAndListen(&subscriber, "", &Subscriber::OnConfigUpdate, kNonComparableConfig);
+    EXPECT_EQ(subscriber.GetCounter(), 1);
+
+    // The parsed config is shared with the previous snapshot
+    storage.Extend({{kIntConfig, 2}});
+    EXPECT_EQ(subscriber.GetCounter(), 1);
+
+    // Without operator== any new value is considered a change
+    storage.Extend({{kNonComparableConfig, NonComparableConfig{1}}});
+    EXPECT_EQ(subscriber.GetCounter(), 2);
+}
+
+UTEST(DynamicConfig, SnapshotDataParsesOnlyChangedDocs) {
+    const auto docs_map = dynamic_config::impl::MakeDefaultDocsMap();
+    const dynamic_config::impl::SnapshotData initial{docs_map, {}};
+    const auto id = dynamic_config::impl::ConfigIdGetter::Get(kSampleStructConfig);
+
+    const dynamic_config::impl::SnapshotData same{docs_map, docs_map, initial};
+    EXPECT_TRUE(same.IsSameValue(id, initial));
+
+    auto changed_docs_map = docs_map;
+    changed_docs_map.Set(
+        "SAMPLE_STRUCT_CONFIG", formats::json::FromString(R"({"is_foo_enabled": true, "bar_period_ms": 1})")
+    );
+    const dynamic_config::impl::SnapshotData changed{changed_docs_map, docs_map, initial};
+    EXPECT_FALSE(changed.IsSameValue(id, initial));
+    EXPECT_TRUE(changed.Get<SampleStructConfig>(id).is_foo_enabled);
+    EXPECT_EQ(changed.Get<SampleStructConfig>(id).bar_period, 1ms);
+}
+
 const dynamic_config::Key<formats::json::Value> kJsonConfig{dynamic_config::ConstantConfig{}, {}};
 
 UTEST(DynamicConfig, JsonConfig) {
@@ -34,6 +34,26 @@ bool IsValidJson(std::string_view json_string) {
     }
 }
 
+std::shared_ptr<const std::any> ParseVariable(const VariableMetadata& metadata, const DocsMap& docs_map) {
+    try {
+        return std::make_shared<const std::any>(metadata.factory(docs_map));
+    } catch (const std::exception& ex) {
+        throw ConfigParseError(
+            fmt::format("{} while parsing dynamic config values. {}", compiler::GetTypeName(typeid(ex)), ex.what())
+        );
+    }
+}
+
+// Only the configs of a single doc are reused, parsers of the whole DocsMap
+// may read any docs
+bool IsDocUnchanged(const VariableMetadata& metadata, const DocsMap& docs_map, const DocsMap& previous_docs_map) {
+    const auto& name = metadata.name;
+    if (name.empty() || !docs_map.Has(name) || !previous_docs_map.Has(name)) return false;
+    // The unchanged docs of incremental updates share the JSON values, so the
+    // comparison is cheap for them
+    return docs_map.Get(name) == previous_docs_map.Get(name);
+}
+
 }  // namespace
 
 [[noreturn]] void WrapGetError(const std::exception& ex, std::type_index type) {
@@ -112,22 +132,16 @@ SnapshotData::SnapshotData(const std::vector<KeyValue>& config_variables) {
     user_configs_.resize(Registry().size());
 
     for (const auto& config_variable : config_variables) {
-        user_configs_[config_variable.GetId()] = config_variable.GetValue();
+        user_configs_[config_variable.GetId()] = std::make_shared<const std::any>(config_variable.GetValue());
     }
 }
 
 SnapshotData::SnapshotData(const DocsMap& defaults, const std::vector<KeyValue>& overrides) : SnapshotData(overrides) {
     utils::StreamingCpuRelax relax(1, nullptr);
     for (const auto [id, metadata] : utils::enumerate(Registry())) {
-        if (!user_configs_[id].has_value()) {
+        if (!user_configs_[id]) {
             relax.Relax(1);
-            try {
-                user_configs_[id] = metadata.factory(defaults);
-            } catch (const std::exception& ex) {
-                throw ConfigParseError(fmt::format(
-                    "{} while parsing dynamic config values. {}", compiler::GetTypeName(typeid(ex)), ex.what()
-                ));
-            }
+            user_configs_[id] = ParseVariable(metadata, defaults);
         }
     }
 }
@@ -137,20 +151,41 @@ SnapshotData::SnapshotData(const SnapshotData& defaults, const std::vector<KeyVa
     if (defaults.IsEmpty()) return;
 
     for (const auto [id, factory] : utils::enumerate(Registry())) {
-        if (user_configs_[id].has_value()) continue;
+        if (user_configs_[id]) continue;
         user_configs_[id] = defaults.user_configs_[id];
     }
 }
 
+SnapshotData::SnapshotData(const DocsMap& docs_map, const DocsMap& previous_docs_map, const SnapshotData& previous) {
+    utils::impl::AssertStaticRegistrationFinished();
+    const auto& registry = Registry();
+    user_configs_.resize(registry.size());
+
+    utils::StreamingCpuRelax relax(1, nullptr);
+    for (const auto [id, metadata] : utils::enumerate(registry)) {
+        if (!previous.IsEmpty() && IsDocUnchanged(metadata, docs_map, previous_docs_map)) {
+            user_configs_[id] = previous.user_configs_[id];
+            continue;
+        }
+        relax.Relax(1);
+        user_configs_[id] = ParseVariable(metadata, docs_map);
+    }
+}
+
 bool SnapshotData::IsEmpty() const noexcept { return user_configs_.empty(); }
 
+bool SnapshotData::IsSameValue(ConfigId id, const SnapshotData& other) const noexcept {
+    if (id >= user_configs_.size() || id >= other.user_configs_.size()) return false;
+    return user_configs_[id] && user_configs_[id] == other.user_configs_[id];
+}
+
 const std::any& SnapshotData::DoGet(ConfigId id) const {
     UASSERT_MSG(id < user_configs_.size(), "SnapshotData is in an empty state.");
     const auto& config = user_configs_[id];
-    if (!config.has_value()) {
+    if (!config) {
         throw std::logic_error("This type is not registered as config");
     }
-    return config;
+    return *config;
 }
 
 }  // namespace dynamic_config::impl
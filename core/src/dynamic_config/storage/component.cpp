@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <mutex>
 #include <string>
 #include <unordered_set>
 
@@ -86,6 +87,9 @@ private:
     engine::TaskProcessor* fs_task_processor_;
 
     dynamic_config::impl::StorageData cache_;
+    // Docs of the current config, only the changed docs are parsed on update
+    dynamic_config::DocsMap current_docs_map_;
+    engine::Mutex set_config_mutex_;
     std::string fs_loading_error_msg_;
     dynamic_config::DocsMap fallback_config_;
 
@@ -177,7 +181,8 @@ void DynamicConfig::Impl::NotifyLoadingFailed(std::string_view updater, std::str
 
 dynamic_config::impl::SnapshotData DynamicConfig::Impl::ParseConfig(const dynamic_config::DocsMap& value) {
     try {
-        dynamic_config::impl::SnapshotData config(value, {});
+        const auto previous_config = cache_.Read();
+        dynamic_config::impl::SnapshotData config(value, current_docs_map_, *previous_config);
         stats_.was_last_parse_successful = true;
         alert_storage_.StopAlertNow("config_parse_error");
         return config;
@@ -192,6 +197,7 @@ dynamic_config::impl::SnapshotData DynamicConfig::Impl::ParseConfig(const dynami
 }
 
 void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
+    const std::lock_guard lock(set_config_mutex_);
     auto config = ParseConfig(value);
 
     if (!value.GetConfigsExpectedToBeUsed(utils::impl::InternalTag{}).empty()) {
@@ -207,6 +213,7 @@ void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
         loaded_cv_.NotifyAll();
     };
     cache_.Update(std::move(config), std::move(after_assign_hook));
+    current_docs_map_ = value;
 }
 
 void DynamicConfig::Impl::SetConfig(std::string_view updater, dynamic_config::DocsMap&& value) {
@@ -0,0 +1,39 @@
+#include <userver/engine/cached_steady_clock.hpp>
+
+#include <userver/compiler/thread_local.hpp>
+
+#include <engine/impl/cached_steady_clock.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+// Default value means that the thread is not an engine worker
+compiler::ThreadLocal cached_steady_now = [] { return CachedSteadyClock::time_point{}; };
+
+// The task was resumed, and the clock was not read since then
+constexpr auto kStale = CachedSteadyClock::time_point::min();
+
+}  // namespace
+
+CachedSteadyClock::time_point CachedSteadyClock::now() noexcept {
+    auto cached = cached_steady_now.Use();
+    if (*cached == time_point{}) return std::chrono::steady_clock::now();
+    if (*cached == kStale) *cached = std::chrono::steady_clock::now();
+    return *cached;
+}
+
+namespace impl {
+
+void InvalidateCachedSteadyClock() noexcept {
+    auto cached = cached_steady_now.Use();
+    *cached = kStale;
+}
+
+}  // namespace impl
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
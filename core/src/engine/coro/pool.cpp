@@ -1,11 +1,15 @@
 #include <engine/coro/pool.hpp>
 
+#include <sys/mman.h>
+
 #include <algorithm>  // for std::max/std::min
+#include <cstdint>
 #include <iterator>
 #include <optional>
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/strerror.hpp>
 
 #include <utils/sys_info.hpp>
 
@@ -13,6 +17,14 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+namespace {
+
+// An idle coroutine is suspended in the executor loop, which has its frames
+// and the control block at the top of the stack. Those are kept intact.
+constexpr std::size_t kStackResidentSize = 16 * 1024;
+
+}  // namespace
+
 Pool::Pool(PoolConfig config, Executor executor)
     : config_(FixupConfig(std::move(config))),
       executor_(executor),
@@ -65,6 +77,7 @@ typename Pool::CoroutinePtr Pool::GetCoroutine() {
 
 void Pool::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
     if (config_.local_cache_size == 0) {
+        MaybeReleaseStackMemory(&coroutine_ptr.Get(), &coroutine_ptr.Get() + 1);
         const bool ok =
             // We only ever return coroutines into our 'working set'.
             used_coroutines_.enqueue(GetUsedPoolToken<moodycamel::ProducerToken>(), std::move(coroutine_ptr.Get()));
@@ -101,6 +114,9 @@ void Pool::ClearLocalCache() {
         return_to_pool_from_local_cache_num =
             std::min(config_.max_size - current_idle_coroutines_num, local_coro_buffer_.size());
 
+        MaybeReleaseStackMemory(
+            local_coro_buffer_.begin(), local_coro_buffer_.begin() + return_to_pool_from_local_cache_num
+        );
         const bool ok = used_coroutines_.enqueue_bulk(
             GetUsedPoolToken<moodycamel::ProducerToken>(),
             std::make_move_iterator(local_coro_buffer_.begin()),
@@ -168,6 +184,7 @@ void Pool::DepopulateLocalCache() {
         return_to_pool_from_local_cache_num =
             std::min(config_.max_size - current_idle_coroutines_num, local_coroutine_move_size_);
 
+        MaybeReleaseStackMemory(local_coro_buffer_.end() - return_to_pool_from_local_cache_num, local_coro_buffer_.end());
         const bool ok = used_coroutines_.enqueue_bulk(
             GetUsedPoolToken<moodycamel::ProducerToken>(),
             std::make_move_iterator(local_coro_buffer_.end() - return_to_pool_from_local_cache_num),
@@ -184,6 +201,33 @@ void Pool::DepopulateLocalCache() {
     local_coro_buffer_.erase(local_coro_buffer_.end() - local_coroutine_move_size_, local_coro_buffer_.end());
 }
 
+template <typename Iterator>
+void Pool::MaybeReleaseStackMemory(Iterator begin, Iterator end) const noexcept {
+    if (!config_.idle_release_threshold || idle_coroutines_num_.load() < *config_.idle_release_threshold) {
+        return;
+    }
+    for (auto it = begin; it != end; ++it) {
+        ReleaseStackMemory(*it);
+    }
+}
+
+void Pool::ReleaseStackMemory(const Coroutine& coroutine) const noexcept {
+    if (config_.stack_size <= kStackResidentSize) return;
+
+    const auto page_size = utils::sys_info::GetPageSize();
+    // Stack is growing downwards, the control block is at its top
+    const auto stack_top =
+        (reinterpret_cast<std::uintptr_t>(GetCoroCbPtr(coroutine)) + page_size - 1) & ~(page_size - 1);
+    const auto release_size = (config_.stack_size - kStackResidentSize) & ~(page_size - 1);
+    // NOLINTNEXTLINE(performance-no-int-to-ptr)
+    auto* const stack_bottom = reinterpret_cast<void*>(stack_top - config_.stack_size);
+
+    // The memory stays mapped, pages are zero-filled on the next touch
+    if (::madvise(stack_bottom, release_size, MADV_DONTNEED) == -1) {
+        LOG_LIMITED_WARNING() << "Failed to release coroutine stack memory: " << utils::strerror(errno);
+    }
+}
+
 std::size_t Pool::GetStackSize() const { return config_.stack_size; }
 
 PoolConfig Pool::FixupConfig(PoolConfig&& config) {
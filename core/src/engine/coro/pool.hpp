@@ -44,6 +44,10 @@ private:
     bool TryPopulateLocalCache();
     void DepopulateLocalCache();
 
+    template <typename Iterator>
+    void MaybeReleaseStackMemory(Iterator begin, Iterator end) const noexcept;
+    void ReleaseStackMemory(const Coroutine& coroutine) const noexcept;
+
     template <typename Token>
     Token& GetUsedPoolToken();
 
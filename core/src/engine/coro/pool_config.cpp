@@ -10,6 +10,7 @@ PoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PoolCo
     config.max_size = value["max_size"].As<size_t>(config.max_size);
     config.stack_size = value["stack_size"].As<size_t>(config.stack_size);
     config.local_cache_size = value["local_cache_size"].As<size_t>(config.local_cache_size);
+    config.idle_release_threshold = value["idle_release_threshold"].As<std::optional<size_t>>();
     return config;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 
 #include <userver/formats/yaml.hpp>
@@ -14,6 +15,9 @@ struct PoolConfig {
     std::size_t max_size = 4000;
     std::size_t stack_size = 256 * 1024ULL;
     std::size_t local_cache_size = 8;
+    // Once the shared pool holds more idle coroutines than this, stack memory
+    // of coroutines returned to it is released to the OS.
+    std::optional<std::size_t> idle_release_threshold;
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PoolConfig>);
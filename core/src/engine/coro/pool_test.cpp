@@ -0,0 +1,64 @@
+#include <engine/coro/pool.hpp>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include <utils/sys_info.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kTouchedStackSize = 64 * 1024;
+
+std::atomic<char*> deep_stack_address{nullptr};
+
+void TouchStackExecutor(engine::coro::Pool::TaskPipe& task_pipe) {
+    for ([[maybe_unused]] auto* task : task_pipe) {
+        volatile char buffer[kTouchedStackSize];
+        for (std::size_t i = 0; i < kTouchedStackSize; ++i) buffer[i] = 1;
+        deep_stack_address = const_cast<char*>(&buffer[0]);
+    }
+}
+
+bool IsPageResident(const char* address) {
+    const auto page_size = utils::sys_info::GetPageSize();
+    // NOLINTNEXTLINE(performance-no-int-to-ptr)
+    auto* page = reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(address) & ~(page_size - 1));
+    unsigned char vec = 0;
+    EXPECT_EQ(::mincore(page, page_size, &vec), 0);
+    return vec & 1;
+}
+
+bool IsDeepStackResidentAfterReturn(engine::coro::PoolConfig config) {
+    config.initial_size = 1;
+    config.max_size = 10;
+    config.local_cache_size = 0;
+    engine::coro::Pool pool{config, &TouchStackExecutor};
+
+    auto coroutine = pool.GetCoroutine();
+    coroutine.Get()(nullptr);
+    EXPECT_NE(deep_stack_address.load(), nullptr);
+    EXPECT_TRUE(IsPageResident(deep_stack_address));
+
+    std::move(coroutine).ReturnToPool();
+    return IsPageResident(deep_stack_address);
+}
+
+}  // namespace
+
+TEST(CoroPool, KeepsIdleStacksByDefault) { EXPECT_TRUE(IsDeepStackResidentAfterReturn({})); }
+
+TEST(CoroPool, ReleasesIdleStacks) {
+    engine::coro::PoolConfig config;
+    config.idle_release_threshold = 0;
+    EXPECT_FALSE(IsDeepStackResidentAfterReturn(config));
+}
+
+USERVER_NAMESPACE_END
@@ -42,6 +42,10 @@ private:
 
 std::size_t GetCurrentTaskStackUsageBytes() noexcept;
 
+// Returns the pointer to the coroutine control block, which resides at the
+// very top of the coroutine stack
+const void* GetCoroCbPtr(const boost::coroutines2::coroutine<impl::TaskContext*>::push_type& coro) noexcept;
+
 }  // namespace engine::coro
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/engine/deadline.hpp>
 
+#include <userver/engine/cached_steady_clock.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/datetime/steady_coarse_clock.hpp>
@@ -24,6 +25,13 @@ bool Deadline::IsSurelyReachedApprox() const noexcept {
     return value_.time_since_epoch() <= CoarseClock::now().time_since_epoch() - CoarseClock::resolution();
 }
 
+bool Deadline::IsSurelyReachedCached() const noexcept {
+    if (!IsReachable()) return false;
+    if (value_ == kPassed) return true;
+
+    return value_ <= CachedSteadyClock::now();
+}
+
 Deadline::Duration Deadline::TimeLeft() const noexcept {
     UASSERT(IsReachable());
     if (value_ == kPassed) return Duration::zero();
@@ -37,6 +45,13 @@ Deadline::Duration Deadline::TimeLeftApprox() const noexcept {
     return value_.time_since_epoch() - CoarseClock::now().time_since_epoch();
 }
 
+Deadline::Duration Deadline::TimeLeftCached() const noexcept {
+    UASSERT(IsReachable());
+    if (value_ == kPassed) return Duration::min();
+
+    return value_ - CachedSteadyClock::now();
+}
+
 void Deadline::OnDurationOverflow(std::chrono::duration<double> incoming_duration) {
     LOG_TRACE() << "Adding duration " << incoming_duration.count()
                 << "s would have overflown deadline, so we replace it with "
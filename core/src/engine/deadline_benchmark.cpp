@@ -2,7 +2,10 @@
 
 #include <chrono>
 
+#include <userver/engine/cached_steady_clock.hpp>
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
 
 #include <utils/gbench_auxilary.hpp>
 
@@ -25,6 +28,17 @@ void deadline_is_reached(benchmark::State& state, std::chrono::nanoseconds durat
     }
 }
 
+template <typename Check>
+void deadline_check_in_task(benchmark::State& state, Check check) {
+    engine::RunStandalone([&] {
+        const auto deadline = engine::Deadline::FromDuration(std::chrono::seconds{100});
+        for ([[maybe_unused]] auto _ : state) {
+            bool is_reached = check(deadline);
+            benchmark::DoNotOptimize(is_reached);
+        }
+    });
+}
+
 void deadline_1us_interval_construction(benchmark::State& state) {
     deadline_from_duration(state, std::chrono::microseconds{1});
 }
@@ -43,6 +57,38 @@ void deadline_20ms_interval_reached(benchmark::State& state) {
 
 void deadline_100s_interval_reached(benchmark::State& state) { deadline_is_reached(state, std::chrono::seconds{100}); }
 
+void deadline_reached_in_task(benchmark::State& state) {
+    deadline_check_in_task(state, [](const engine::Deadline& deadline) { return deadline.IsReached(); });
+}
+
+void deadline_surely_reached_approx_in_task(benchmark::State& state) {
+    deadline_check_in_task(state, [](const engine::Deadline& deadline) { return deadline.IsSurelyReachedApprox(); });
+}
+
+void deadline_surely_reached_cached_in_task(benchmark::State& state) {
+    deadline_check_in_task(state, [](const engine::Deadline& deadline) { return deadline.IsSurelyReachedCached(); });
+}
+
+// A resume invalidates engine::CachedSteadyClock, the first reading after it
+// takes the time
+void task_resume(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        for ([[maybe_unused]] auto _ : state) {
+            engine::Yield();
+        }
+    });
+}
+
+void task_resume_and_cached_clock_read(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        for ([[maybe_unused]] auto _ : state) {
+            engine::Yield();
+            auto now = engine::CachedSteadyClock::now();
+            benchmark::DoNotOptimize(now);
+        }
+    });
+}
+
 }  // namespace
 
 BENCHMARK(deadline_1us_interval_construction);
@@ -52,4 +98,11 @@ BENCHMARK(deadline_1us_interval_reached);
 BENCHMARK(deadline_20ms_interval_reached);
 BENCHMARK(deadline_100s_interval_reached);
 
+BENCHMARK(deadline_reached_in_task);
+BENCHMARK(deadline_surely_reached_approx_in_task);
+BENCHMARK(deadline_surely_reached_cached_in_task);
+
+BENCHMARK(task_resume);
+BENCHMARK(task_resume_and_cached_clock_read);
+
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <userver/engine/deadline.hpp>
 
+#include <userver/engine/cached_steady_clock.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/utest/utest.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -29,6 +31,25 @@ TEST(Deadline, Overflow) {
     EXPECT_FALSE(engine::Deadline::FromDuration(very_large_duration).IsReachable());
 }
 
+UTEST(Deadline, Cached) {
+    EXPECT_FALSE(engine::Deadline{}.IsSurelyReachedCached());
+    EXPECT_TRUE(engine::Deadline::Passed().IsSurelyReachedCached());
+
+    const auto deadline = engine::Deadline::FromDuration(std::chrono::milliseconds{1});
+    const auto time_left_cached = deadline.TimeLeftCached();
+    EXPECT_GE(time_left_cached, deadline.TimeLeft());
+    while (!deadline.IsReached()) {
+    }
+
+    // The clock is not updated until the task is resumed
+    EXPECT_FALSE(deadline.IsSurelyReachedCached());
+    EXPECT_LE(engine::CachedSteadyClock::now(), std::chrono::steady_clock::now());
+
+    engine::Yield();
+    EXPECT_TRUE(deadline.IsSurelyReachedCached());
+    EXPECT_LE(deadline.TimeLeftCached(), engine::Deadline::Duration::zero());
+}
+
 // In Release mode the overflow will cause UB.
 #ifndef NDEBUG
 TEST(DeadlineDeathTest, Overflow) {
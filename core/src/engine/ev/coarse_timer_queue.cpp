@@ -0,0 +1,82 @@
+#include <engine/ev/coarse_timer_queue.hpp>
+
+#include <engine/ev/thread.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+CoarseTimerQueue::CoarseTimerQueue(Thread& thread, std::chrono::microseconds resolution)
+    : thread_(thread), wheel_(resolution, TimerWheel::Clock::now()) {
+    using LibEvDuration = std::chrono::duration<double>;
+    const auto tick = std::chrono::duration_cast<LibEvDuration>(resolution);
+
+    ticker_.data = this;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    ev_timer_init(&ticker_, OnTick, 0.0, tick.count());
+}
+
+CoarseTimerQueue::~CoarseTimerQueue() {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    UASSERT(!ev_is_active(&ticker_));
+    UASSERT_MSG(wheel_.IsEmpty(), "Some timers were not cancelled before the ev thread stop");
+}
+
+void CoarseTimerQueue::Cancel(Node& node) noexcept {
+    std::lock_guard lock(mutex_);
+    wheel_.Cancel(node);
+}
+
+void CoarseTimerQueue::ScheduleLocked(Node& node, Deadline deadline) noexcept {
+    UASSERT(deadline.IsReachable());
+    wheel_.Schedule(node, TimerWheel::Clock::now() + deadline.TimeLeft());
+
+    // Enqueueing under the lock, so concurrent enqueues are impossible
+    if (!is_ticker_requested_) {
+        is_ticker_requested_ = true;
+        if (PrepareEnqueue()) {
+            thread_.RunInEvLoopAsync(*this);
+        }
+    }
+}
+
+void CoarseTimerQueue::StopInEvThread() noexcept {
+    UASSERT(thread_.IsInEvThread());
+    ev_timer_stop(thread_.GetEvLoop(), &ticker_);
+}
+
+void CoarseTimerQueue::DoPerformAndRelease() {
+    // May be invoked synchronously from ScheduleLocked(), so the lock is not
+    // taken here. A spurious start stops at the first empty tick.
+    UASSERT(thread_.IsInEvThread());
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    if (!ev_is_active(&ticker_)) {
+        ev_now_update(thread_.GetEvLoop());
+        ev_timer_again(thread_.GetEvLoop(), &ticker_);
+    }
+}
+
+void CoarseTimerQueue::OnTick(struct ev_loop*, ev_timer* w, int) noexcept {
+    auto* self = static_cast<CoarseTimerQueue*>(w->data);
+    UASSERT(self != nullptr);
+    self->DoOnTick();
+}
+
+void CoarseTimerQueue::DoOnTick() noexcept {
+    bool is_empty = false;
+    {
+        std::lock_guard lock(mutex_);
+        wheel_.Advance(TimerWheel::Clock::now());
+        is_empty = wheel_.IsEmpty();
+        if (is_empty) is_ticker_requested_ = false;
+    }
+
+    // A concurrent Schedule() after the unlock enqueues a start that is
+    // processed after this stop.
+    if (is_empty) StopInEvThread();
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
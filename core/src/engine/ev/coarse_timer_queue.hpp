@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+
+#include <ev.h>
+
+#include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/timer_wheel.hpp>
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+class Thread;
+
+// Thread-safe TimerWheel driven by a periodic timer of an ev::Thread.
+//
+// Unlike ev_timer, scheduling and rescheduling do not require a round trip to
+// the ev thread: the ev loop is woken up only to start the periodic timer
+// when the queue becomes non-empty, and the timer stops itself once the queue
+// drains.
+//
+// Node callbacks are invoked on the ev thread with the queue lock held, so
+// they must be short and must not call into the same queue.
+class CoarseTimerQueue final : public MultiShotAsyncPayload<CoarseTimerQueue> {
+public:
+    using Node = TimerWheel::Node;
+
+    CoarseTimerQueue(Thread& thread, std::chrono::microseconds resolution);
+
+    CoarseTimerQueue(const CoarseTimerQueue&) = delete;
+    CoarseTimerQueue& operator=(const CoarseTimerQueue&) = delete;
+
+    ~CoarseTimerQueue();
+
+    /// Schedules or reschedules the node. `update()` is invoked under the queue
+    /// lock so that the data used by the node callback can be safely modified.
+    template <typename Update>
+    void Schedule(Node& node, Deadline deadline, Update&& update);
+
+    /// After return the node callback is not running and won't be invoked.
+    void Cancel(Node& node) noexcept;
+
+    // Must be called in the ev thread on ev loop stop
+    void StopInEvThread() noexcept;
+
+    void DoPerformAndRelease();
+
+private:
+    void ScheduleLocked(Node& node, Deadline deadline) noexcept;
+
+    static void OnTick(struct ev_loop*, ev_timer* w, int) noexcept;
+    void DoOnTick() noexcept;
+
+    Thread& thread_;
+    std::mutex mutex_;
+    TimerWheel wheel_;
+    bool is_ticker_requested_{false};
+    ev_timer ticker_{};
+};
+
+template <typename Update>
+void CoarseTimerQueue::Schedule(Node& node, Deadline deadline, Update&& update) {
+    std::lock_guard lock(mutex_);
+    update();
+    ScheduleLocked(node, deadline);
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
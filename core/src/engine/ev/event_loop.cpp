@@ -35,6 +35,29 @@ void AcquireEvDefaultLoop() {
     LOG_DEBUG() << "Acquire ev_default_loop for thread_name=" << utils::GetCurrentThreadName();
 }
 
+unsigned int GetEvFlags(EvBackend ev_backend) {
+    switch (ev_backend) {
+        case EvBackend::kAuto:
+            return EVFLAG_AUTO;
+        case EvBackend::kEpoll:
+            return EVBACKEND_EPOLL;
+        case EvBackend::kIoUring:
+#ifdef EVBACKEND_IOURING
+            if (ev_supported_backends() & EVBACKEND_IOURING) {
+                return EVBACKEND_IOURING;
+            }
+#endif
+            LOG_WARNING() << "io_uring ev backend is not supported by libev, falling back to the default one";
+            return EVFLAG_AUTO;
+    }
+
+    UINVARIANT(false, "Invalid ev backend: " + std::to_string(static_cast<int>(ev_backend)));
+}
+
+struct ev_loop* CreateEvLoop(EventLoop::EvLoopType ev_loop_mode, unsigned int flags) {
+    return (ev_loop_mode == EventLoop::EvLoopType::kDefaultLoop) ? ev_default_loop(flags) : ev_loop_new(flags);
+}
+
 void ReleaseEvDefaultLoop() {
     LOG_DEBUG() << "Release ev_default_loop";
     GetEvDefaultLoopFlag().clear();
@@ -42,9 +65,9 @@ void ReleaseEvDefaultLoop() {
 
 }  // namespace
 
-EventLoop::EventLoop(EvLoopType ev_loop_mode) : ev_loop_mode_(ev_loop_mode) {
+EventLoop::EventLoop(EvLoopType ev_loop_mode, EvBackend ev_backend) : ev_loop_mode_(ev_loop_mode) {
     if (ev_loop_mode_ == EvLoopType::kDefaultLoop) AcquireEvDefaultLoop();
-    Start();
+    Start(ev_backend);
 }
 
 EventLoop::~EventLoop() {
@@ -77,8 +100,15 @@ bool EventLoop::DebugIsSameOsThread() noexcept {
     return true;
 }
 
-void EventLoop::Start() {
-    loop_ = ((ev_loop_mode_ == EvLoopType::kDefaultLoop) ? ev_default_loop(EVFLAG_AUTO) : ev_loop_new(EVFLAG_AUTO));
+void EventLoop::Start(EvBackend ev_backend) {
+    const auto flags = GetEvFlags(ev_backend);
+    loop_ = CreateEvLoop(ev_loop_mode_, flags);
+    if (!loop_ && flags != EVFLAG_AUTO) {
+        // e.g. io_uring is compiled into libev, but is disabled in the kernel
+        LOG_WARNING() << "Failed to initialize the requested ev backend (flags=" << flags
+                      << "), falling back to the default one";
+        loop_ = CreateEvLoop(ev_loop_mode_, EVFLAG_AUTO);
+    }
 
     UASSERT(loop_);
 #ifdef EV_HAS_IO_PESSIMISTIC_REMOVE
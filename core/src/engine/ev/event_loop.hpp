@@ -5,6 +5,7 @@
 #include <ev.h>
 
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/thread_pool_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -17,7 +18,7 @@ public:
         kDefaultLoop,
     };
 
-    explicit EventLoop(EvLoopType ev_loop_mode);
+    explicit EventLoop(EvLoopType ev_loop_mode, EvBackend ev_backend = EvBackend::kAuto);
 
     ~EventLoop();
 
@@ -34,7 +35,7 @@ public:
 private:
     void AssertSameOsThread() noexcept;
 
-    void Start();
+    void Start(EvBackend ev_backend);
 
     static void ChildWatcher(struct ev_loop*, ev_child* w, int) noexcept;
     static void ChildWatcherImpl(ev_child* w);
@@ -10,6 +10,7 @@
 #include <userver/utils/datetime/steady_coarse_clock.hpp>
 #include <userver/utils/thread_name.hpp>
 
+#include <engine/ev/coarse_timer_queue.hpp>
 #include <utils/check_syscall.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
@@ -25,15 +26,27 @@ const auto kDeferredInterval = kMinDurationToDefer - utils::datetime::SteadyCoar
 // Check the time at least twice per collect interval
 const auto kCpuStatsThrottle = static_cast<std::size_t>(kCpuStatsCollectInterval / kDeferredInterval / 2);
 
-}  // namespace
-
-Thread::Thread(const std::string& thread_name) : Thread(thread_name, EventLoop::EvLoopType::kNewLoop) {}
+constexpr double kBatchSizeBounds[] = {1, 2, 4, 8, 16, 32, 64, 128, 256};
+constexpr double kBatchLatencyUsBounds[] = {10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000};
 
-Thread::Thread(const std::string& thread_name, UseDefaultEvLoop)
-    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop) {}
+}  // namespace
 
-Thread::Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type)
-    : event_loop_(ev_loop_type), name_{thread_name}, cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle} {
+Thread::Thread(const std::string& thread_name, const ThreadPoolConfig& config)
+    : Thread(thread_name, EventLoop::EvLoopType::kNewLoop, config) {}
+
+Thread::Thread(const std::string& thread_name, UseDefaultEvLoop, const ThreadPoolConfig& config)
+    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop, config) {}
+
+Thread::Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type, const ThreadPoolConfig& config)
+    : event_loop_(ev_loop_type, config.ev_backend),
+      coarse_timer_queue_(
+          config.coarse_timers_resolution ? std::make_unique<CoarseTimerQueue>(*this, *config.coarse_timers_resolution)
+                                          : nullptr
+      ),
+      name_{thread_name},
+      cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle},
+      batch_sizes_{kBatchSizeBounds},
+      batch_latencies_{kBatchLatencyUsBounds} {
     UASSERT_MSG(kDeferredInterval > std::chrono::milliseconds{4}, "Timer events would happen too often");
     Start();
 }
@@ -44,6 +57,8 @@ void Thread::RunInEvLoopAsync(AsyncPayloadBase& payload) noexcept {
     RegisterInEvLoop(payload);
 
     if (!IsInEvThread()) {
+        // libev coalesces the sends until the watcher is invoked, so there is a
+        // single wakeup of the ev loop per batch of payloads
         ev_async_send(GetEvLoop(), &watch_update_);
     }
 }
@@ -74,7 +89,12 @@ void Thread::RegisterInEvLoop(AsyncPayloadBase& payload) {
         return;
     }
 
-    func_queue_.Push(payload);
+    if (!func_queue_.GetBackAndPush(payload)) {
+        // The payload starts a new batch. If the ev thread manages to process it
+        // before the store, the start is attributed to the next batch, which
+        // is fine for statistics.
+        batch_start_.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    }
 }
 
 bool Thread::IsInEvThread() const { return (std::this_thread::get_id() == thread_.get_id()); }
@@ -137,6 +157,7 @@ void Thread::RunEvLoop() {
     ev_async_stop(GetEvLoop(), &watch_update_);
     ev_async_stop(GetEvLoop(), &watch_break_);
     ev_timer_stop(GetEvLoop(), &defer_timer_);
+    if (coarse_timer_queue_) coarse_timer_queue_->StopInEvThread();
 }
 
 void Thread::UpdateLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
@@ -152,7 +173,19 @@ void Thread::UpdateTimersWatcher(struct ev_loop* loop, ev_timer*, int) noexcept
 }
 
 void Thread::UpdateLoopWatcherImpl() {
-    while (AsyncPayloadBase* payload = func_queue_.TryPopBlocking()) {
+    AsyncPayloadBase* payload = func_queue_.TryPopBlocking();
+    if (!payload) return;
+
+    const auto batch_start = batch_start_.exchange(0, std::memory_order_relaxed);
+    if (batch_start != 0) {
+        const auto latency = std::chrono::steady_clock::now().time_since_epoch() -
+                             std::chrono::steady_clock::duration{batch_start};
+        batch_latencies_.Account(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+    }
+
+    std::size_t batch_size = 0;
+    for (; payload; payload = func_queue_.TryPopBlocking()) {
+        ++batch_size;
         LOG_TRACE() << "Thread::UpdateLoopWatcherImpl(), " << compiler::GetTypeName(typeid(*payload));
         try {
             payload->PerformAndRelease();
@@ -160,6 +193,7 @@ void Thread::UpdateLoopWatcherImpl() {
             LOG_WARNING() << "exception in async thread func: " << ex;
         }
     }
+    batch_sizes_.Account(batch_size);
 }
 
 void Thread::BreakLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
@@ -12,7 +12,9 @@
 
 #include <engine/ev/async_payload_base.hpp>
 #include <engine/ev/event_loop.hpp>
+#include <engine/ev/thread_pool_config.hpp>
 #include <userver/concurrent/impl/intrusive_mpsc_queue.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -22,13 +24,15 @@ namespace engine::ev {
 // Avoid ev_async_send on timers that have bigger timeouts
 inline constexpr std::chrono::microseconds kMinDurationToDefer{19500};
 
+class CoarseTimerQueue;
+
 class Thread final {
 public:
     struct UseDefaultEvLoop {};
     static constexpr UseDefaultEvLoop kUseDefaultEvLoop{};
 
-    explicit Thread(const std::string& thread_name);
-    Thread(const std::string& thread_name, UseDefaultEvLoop);
+    explicit Thread(const std::string& thread_name, const ThreadPoolConfig& config = {});
+    Thread(const std::string& thread_name, UseDefaultEvLoop, const ThreadPoolConfig& config = {});
 
     ~Thread();
 
@@ -45,11 +49,31 @@ public:
 
     bool IsInEvThread() const;
 
+    // Returns nullptr if coarse timers are disabled for this thread
+    CoarseTimerQueue* GetCoarseTimerQueue() const noexcept { return coarse_timer_queue_.get(); }
+
     std::uint8_t GetCurrentLoadPercent() const;
+
+    // Number of payloads processed per ev loop wakeup
+    const utils::statistics::Histogram& GetSubmissionBatchSizes() const noexcept { return batch_sizes_; }
+
+    // Time in microseconds from the first payload of a batch being queued to
+    // the start of the batch processing
+    const utils::statistics::Histogram& GetSubmissionLatencies() const noexcept { return batch_latencies_; }
+
+    // Number of started ev_io watchers, i.e. sockets and pipes waiting for IO
+    std::size_t GetActiveIoWatchersCount() const noexcept {
+        return active_io_watchers_.load(std::memory_order_relaxed);
+    }
+
+    // Must be called from the ev thread only
+    void OnIoWatcherStarted() noexcept { active_io_watchers_.fetch_add(1, std::memory_order_relaxed); }
+    void OnIoWatcherStopped() noexcept { active_io_watchers_.fetch_sub(1, std::memory_order_relaxed); }
+
     const std::string& GetName() const;
 
 private:
-    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type);
+    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type, const ThreadPoolConfig& config);
 
     void RegisterInEvLoop(AsyncPayloadBase& payload);
 
@@ -81,8 +105,17 @@ private:
     ev_async watch_update_{};
     ev_async watch_break_{};
 
+    std::unique_ptr<CoarseTimerQueue> coarse_timer_queue_;
+
     const std::string name_;
     utils::statistics::ThreadCpuStatsStorage cpu_stats_storage_;
+    std::atomic<std::size_t> active_io_watchers_{0};
+
+    // steady_clock ticks of the first payload pushed into an empty func_queue_,
+    // zero if not set
+    std::atomic<std::chrono::steady_clock::rep> batch_start_{0};
+    utils::statistics::Histogram batch_sizes_;
+    utils::statistics::Histogram batch_latencies_;
     bool is_running_{false};
 };
 
@@ -59,16 +59,19 @@ void ThreadControlBase::DoSend(ev_async& w) noexcept { ev_async_send(GetEvLoop()
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void ThreadControlBase::DoStart(ev_io& w) noexcept {
     UASSERT(IsInEvThread());
+    if (!ev_is_active(&w)) thread_.OnIoWatcherStarted();
     ev_io_start(GetEvLoop(), &w);
 }
 
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void ThreadControlBase::DoStop(ev_io& w) noexcept {
     UASSERT(IsInEvThread());
+    if (ev_is_active(&w)) thread_.OnIoWatcherStopped();
     ev_io_stop(GetEvLoop(), &w);
 }
 
-TimerThreadControl::TimerThreadControl(Thread& thread) noexcept : ThreadControlBase{thread} {}
+TimerThreadControl::TimerThreadControl(Thread& thread) noexcept
+    : ThreadControlBase{thread}, coarse_timer_queue_{thread.GetCoarseTimerQueue()} {}
 
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void TimerThreadControl::Start(ev_timer& w) noexcept { DoStart(w); }
@@ -112,6 +112,7 @@ private:
 }  // namespace impl
 
 class Thread;
+class CoarseTimerQueue;
 
 class ThreadControlBase {
 public:
@@ -214,6 +215,12 @@ public:
     void Start(ev_timer& w) noexcept;
     void Stop(ev_timer& w) noexcept;
     void Again(ev_timer& w) noexcept;
+
+    /// Returns nullptr if coarse timers are disabled for the thread
+    CoarseTimerQueue* GetCoarseTimerQueue() const noexcept { return coarse_timer_queue_; }
+
+private:
+    CoarseTimerQueue* coarse_timer_queue_;
 };
 
 class ThreadControl final : public ThreadControlBase {
@@ -3,6 +3,7 @@
 #include <fmt/format.h>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
 
 #include "thread.hpp"
 #include "thread_control.hpp"
@@ -11,16 +12,26 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+namespace {
+
+// CPU load is sampled rarely, so close values are treated as equal and the
+// number of active watchers decides
+constexpr int kLoadPercentHysteresis = 10;
+
+}  // namespace
+
 ThreadPool::ThreadPool(ThreadPoolConfig config) : ThreadPool(std::move(config), false) {}
 
 ThreadPool::ThreadPool(ThreadPoolConfig config, UseDefaultEvLoop)
     : ThreadPool(std::move(config), !config.ev_default_loop_disabled) {}
 
-ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop) : use_ev_default_loop_(use_ev_default_loop) {
+ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop)
+    : use_ev_default_loop_(use_ev_default_loop), selection_(config.ev_thread_selection) {
     threads_ = utils::GenerateFixedArray(config.threads, [&](std::size_t index) {
         const auto thread_name = fmt::format("{}_{}", config.thread_name, index);
-        return (use_ev_default_loop && index == 0) ? Thread(thread_name, Thread::kUseDefaultEvLoop)
-                                                   : Thread(thread_name);
+        return (use_ev_default_loop && index == 0)
+                   ? Thread(thread_name, Thread::kUseDefaultEvLoop, config)
+                   : Thread(thread_name, config);
     });
 
     default_controls_.controls = utils::GenerateFixedArray(threads_.size(), [this](std::size_t index) {
@@ -42,9 +53,21 @@ ThreadPool::~ThreadPool() {
 
 std::size_t ThreadPool::GetSize() const { return threads_.size(); }
 
-ThreadControl& ThreadPool::NextThread() { return default_controls_.Next(); }
+ThreadControl& ThreadPool::NextThread() { return default_controls_.controls[NextIndex(default_controls_.next_idx)]; }
+
+TimerThreadControl& ThreadPool::NextTimerThread() {
+    return timer_controls_.controls[NextIndex(timer_controls_.next_idx)];
+}
+
+ThreadControl& ThreadPool::GetThread(std::size_t index) {
+    UASSERT(index < default_controls_.controls.size());
+    return default_controls_.controls[index];
+}
 
-TimerThreadControl& ThreadPool::NextTimerThread() { return timer_controls_.Next(); }
+TimerThreadControl& ThreadPool::GetTimerThread(std::size_t index) {
+    UASSERT(index < timer_controls_.controls.size());
+    return timer_controls_.controls[index];
+}
 
 ThreadControl& ThreadPool::GetEvDefaultLoopThread() {
     UINVARIANT(!default_controls_.Empty() && use_ev_default_loop_, "no ev_default_loop in current thread_pool");
@@ -53,10 +76,35 @@ ThreadControl& ThreadPool::GetEvDefaultLoopThread() {
 
 void ThreadPool::WriteStats(utils::statistics::Writer& writer) const {
     for (auto& thread : threads_) {
-        writer.ValueWithLabels(thread.GetCurrentLoadPercent(), {{"ev_thread_name", thread.GetName()}});
+        const utils::statistics::LabelView label{"ev_thread_name", thread.GetName()};
+        writer["cpu-load-percent"].ValueWithLabels(thread.GetCurrentLoadPercent(), label);
+        writer["active-io-watchers"].ValueWithLabels(thread.GetActiveIoWatchersCount(), label);
+        writer["submission-batch-size"].ValueWithLabels(thread.GetSubmissionBatchSizes().GetView(), label);
+        writer["submission-latency-us"].ValueWithLabels(thread.GetSubmissionLatencies().GetView(), label);
     }
 }
 
+std::size_t ThreadPool::NextIndex(std::atomic<std::size_t>& next_idx) const noexcept {
+    const auto size = threads_.size();
+    UASSERT(size != 0);
+    // just ignore next_idx overflow
+    const auto candidate = next_idx++ % size;
+    if (selection_ == EvThreadSelection::kRoundRobin || size == 1) return candidate;
+
+    // "Power of two choices": a random second candidate avoids herding onto the
+    // single least loaded thread between the load samples
+    const auto other = utils::RandRange(size);
+    return IsLessLoaded(threads_[other], threads_[candidate]) ? other : candidate;
+}
+
+bool ThreadPool::IsLessLoaded(const Thread& lhs, const Thread& rhs) const noexcept {
+    const int lhs_load = lhs.GetCurrentLoadPercent();
+    const int rhs_load = rhs.GetCurrentLoadPercent();
+    if (lhs_load + kLoadPercentHysteresis < rhs_load) return true;
+    if (rhs_load + kLoadPercentHysteresis < lhs_load) return false;
+    return lhs.GetActiveIoWatchersCount() < rhs.GetActiveIoWatchersCount();
+}
+
 }  // namespace engine::ev
 
 USERVER_NAMESPACE_END
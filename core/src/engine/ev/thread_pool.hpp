@@ -26,10 +26,20 @@ public:
 
     std::size_t GetSize() const;
 
+    // Returns the ev thread for a new watcher. With
+    // EvThreadSelection::kLeastLoaded picks the less loaded of the round-robin
+    // candidate and a random one: by CPU load if they differ noticeably, by the
+    // number of active IO watchers otherwise.
     ThreadControl& NextThread();
 
     TimerThreadControl& NextTimerThread();
 
+    // Returns the control of a specific thread, `index` must be less than
+    // GetSize()
+    ThreadControl& GetThread(std::size_t index);
+
+    TimerThreadControl& GetTimerThread(std::size_t index);
+
     ThreadControl& GetEvDefaultLoopThread();
 
     friend void DumpMetric(utils::statistics::Writer& writer, const ThreadPool& self) { self.WriteStats(writer); }
@@ -39,17 +49,14 @@ private:
 
     void WriteStats(utils::statistics::Writer& writer) const;
 
+    std::size_t NextIndex(std::atomic<std::size_t>& next_idx) const noexcept;
+    bool IsLessLoaded(const Thread& lhs, const Thread& rhs) const noexcept;
+
     template <typename Control>
     struct BunchOfControls final {
         utils::FixedArray<Control> controls;
         std::atomic<std::size_t> next_idx{0};
 
-        Control& Next() noexcept {
-            UASSERT(!controls.empty());
-            // just ignore next_idx overflow
-            return controls[next_idx++ % controls.size()];
-        }
-
         bool Empty() const noexcept { return controls.empty(); }
     };
 
@@ -59,6 +66,7 @@ private:
     utils::FixedArray<Thread> threads_;
 
     const bool use_ev_default_loop_;
+    const EvThreadSelection selection_;
 };
 
 }  // namespace engine::ev
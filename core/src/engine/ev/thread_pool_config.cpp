@@ -1,13 +1,44 @@
 #include "thread_pool_config.hpp"
 
+#include <stdexcept>
+
+#include <userver/utils/trivial_map.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+EvBackend Parse(const yaml_config::YamlConfig& value, formats::parse::To<EvBackend>) {
+    static constexpr utils::TrivialBiMap kMap([](auto selector) {
+        return selector()
+            .Case(EvBackend::kAuto, "auto")
+            .Case(EvBackend::kEpoll, "epoll")
+            .Case(EvBackend::kIoUring, "io_uring");
+    });
+
+    return utils::ParseFromValueString(value, kMap);
+}
+
+EvThreadSelection Parse(const yaml_config::YamlConfig& value, formats::parse::To<EvThreadSelection>) {
+    static constexpr utils::TrivialBiMap kMap([](auto selector) {
+        return selector()
+            .Case(EvThreadSelection::kRoundRobin, "round-robin")
+            .Case(EvThreadSelection::kLeastLoaded, "least-loaded");
+    });
+
+    return utils::ParseFromValueString(value, kMap);
+}
+
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>) {
     ThreadPoolConfig config;
     config.threads = value["threads"].As<std::size_t>(config.threads);
     config.thread_name = value["thread_name"].As<std::string>(config.thread_name);
+    config.ev_backend = value["ev_backend"].As<EvBackend>(config.ev_backend);
+    config.ev_thread_selection = value["ev_thread_selection"].As<EvThreadSelection>(config.ev_thread_selection);
+    config.coarse_timers_resolution = value["coarse_timers_resolution"].As<std::optional<std::chrono::milliseconds>>();
+    if (config.coarse_timers_resolution && config.coarse_timers_resolution->count() <= 0) {
+        throw std::runtime_error("coarse_timers_resolution should be positive");
+    }
     return config;
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
 #include <string>
 
 #include <userver/formats/yaml.hpp>
@@ -9,10 +11,32 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+/// libev backend to use for the ev loops of a thread pool
+enum class EvBackend {
+    kAuto,     ///< let libev choose the best available backend (epoll on Linux)
+    kEpoll,    ///< force epoll
+    kIoUring,  ///< use io_uring for readiness polling, falls back to kAuto if unsupported
+};
+
+EvBackend Parse(const yaml_config::YamlConfig& value, formats::parse::To<EvBackend>);
+
+/// How ev threads are chosen for new sockets and timers
+enum class EvThreadSelection {
+    kRoundRobin,   ///< hand out ev threads one by one
+    kLeastLoaded,  ///< pick the less busy of two ev threads, see ThreadPool::NextThread()
+};
+
+EvThreadSelection Parse(const yaml_config::YamlConfig& value, formats::parse::To<EvThreadSelection>);
+
 struct ThreadPoolConfig {
     std::size_t threads = 2;
     std::string thread_name = "event-worker";
     bool ev_default_loop_disabled = false;
+    EvBackend ev_backend = EvBackend::kAuto;
+    EvThreadSelection ev_thread_selection = EvThreadSelection::kRoundRobin;
+    /// Tick of the timer wheel for task deadlines and sleeps, libev timers are
+    /// used if not set
+    std::optional<std::chrono::milliseconds> coarse_timers_resolution;
 };
 
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>);
@@ -0,0 +1,98 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <algorithm>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+TimerWheel::TimerWheel(Clock::duration resolution, Clock::time_point now) : resolution_(resolution), start_(now) {
+    UINVARIANT(resolution_.count() > 0, "TimerWheel resolution should be positive");
+}
+
+TimerWheel::~TimerWheel() = default;
+
+void TimerWheel::Schedule(Node& node, Clock::time_point expiry) noexcept {
+    Cancel(node);
+
+    // Expired nodes of the current tick were already reported, so the node
+    // could fire at the next tick at the earliest.
+    node.expiry_tick_ = std::max(ToTick(expiry, /*round_up=*/true), current_tick_ + 1);
+    Insert(node);
+    ++size_;
+}
+
+void TimerWheel::Cancel(Node& node) noexcept {
+    if (!node.IsScheduled()) return;
+
+    UASSERT(size_ > 0);
+    node.hook_.unlink();
+    --size_;
+}
+
+void TimerWheel::Advance(Clock::time_point now) noexcept {
+    const auto target_tick = ToTick(now, /*round_up=*/false);
+
+    while (current_tick_ < target_tick) {
+        if (IsEmpty()) {
+            // Nothing to cascade or to fire, fast-forward
+            current_tick_ = target_tick;
+            return;
+        }
+
+        ++current_tick_;
+        if ((current_tick_ & kSlotMask) == 0) {
+            for (std::size_t level = 1; level < kLevels; ++level) {
+                Cascade(level);
+                if (((current_tick_ >> (kSlotBits * level)) & kSlotMask) != 0) break;
+            }
+        }
+
+        auto& expired = slots_[0][current_tick_ & kSlotMask];
+        while (!expired.empty()) {
+            auto& node = expired.front();
+            expired.pop_front();
+            --size_;
+            UASSERT(node.expiry_tick_ == current_tick_);
+            node.callback_(node);
+        }
+    }
+}
+
+std::uint64_t TimerWheel::ToTick(Clock::time_point time_point, bool round_up) const noexcept {
+    if (time_point <= start_) return 0;
+
+    const auto since_start = time_point - start_;
+    auto ticks = static_cast<std::uint64_t>(since_start / resolution_);
+    if (round_up && since_start % resolution_ != Clock::duration::zero()) ++ticks;
+    return ticks;
+}
+
+void TimerWheel::Insert(Node& node) noexcept {
+    UASSERT(node.expiry_tick_ >= current_tick_);
+
+    // Nodes beyond the wheel horizon are parked at the last slot of the top
+    // level and are re-inserted with their real expiry on cascade.
+    const auto delta = std::min(node.expiry_tick_ - current_tick_, kMaxDelta);
+    const auto slot_tick = current_tick_ + delta;
+
+    std::size_t level = 0;
+    while (level + 1 < kLevels && (delta >> (kSlotBits * (level + 1))) != 0) ++level;
+
+    slots_[level][(slot_tick >> (kSlotBits * level)) & kSlotMask].push_back(node);
+}
+
+void TimerWheel::Cascade(std::size_t level) noexcept {
+    List nodes;
+    nodes.splice(nodes.end(), slots_[level][(current_tick_ >> (kSlotBits * level)) & kSlotMask]);
+
+    while (!nodes.empty()) {
+        auto& node = nodes.front();
+        nodes.pop_front();
+        Insert(node);
+    }
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+#include <boost/intrusive/list.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+// Hierarchical timing wheel with a fixed tick resolution.
+//
+// Scheduling and cancellation are O(1). Expired nodes are never reported
+// before their expiry time, but may be reported late by up to two ticks plus
+// the interval between Advance() calls.
+// Not thread-safe.
+class TimerWheel final {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    class Node final {
+    public:
+        // Called from Advance() for an expired node, the node is already unlinked
+        // and may be scheduled again from within the callback.
+        using Callback = void (*)(Node&) noexcept;
+
+        explicit Node(Callback callback) noexcept : callback_(callback) {}
+
+        Node(const Node&) = delete;
+        Node& operator=(const Node&) = delete;
+
+        // The node must be cancelled or expired before destruction
+        ~Node() { UASSERT(!IsScheduled()); }
+
+        bool IsScheduled() const noexcept { return hook_.is_linked(); }
+
+        // User data, not used by the TimerWheel
+        void* data{nullptr};
+
+    private:
+        friend class TimerWheel;
+
+        using Hook = boost::intrusive::list_member_hook<boost::intrusive::link_mode<boost::intrusive::auto_unlink>>;
+
+        Hook hook_;
+        std::uint64_t expiry_tick_{0};
+        Callback callback_;
+    };
+
+    TimerWheel(Clock::duration resolution, Clock::time_point now);
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    ~TimerWheel();
+
+    // Reschedules the node if it is already scheduled.
+    void Schedule(Node& node, Clock::time_point expiry) noexcept;
+
+    // Does nothing if the node is not scheduled.
+    void Cancel(Node& node) noexcept;
+
+    // Invokes callbacks of all the nodes that have expired by `now`.
+    void Advance(Clock::time_point now) noexcept;
+
+    bool IsEmpty() const noexcept { return size_ == 0; }
+
+    std::size_t GetSize() const noexcept { return size_; }
+
+    Clock::duration GetResolution() const noexcept { return resolution_; }
+
+private:
+    static constexpr std::size_t kLevels = 4;
+    static constexpr std::size_t kSlotBits = 6;
+    static constexpr std::size_t kSlots = std::size_t{1} << kSlotBits;
+    static constexpr std::uint64_t kSlotMask = kSlots - 1;
+    static constexpr std::uint64_t kMaxDelta = (std::uint64_t{1} << (kSlotBits * kLevels)) - 1;
+
+    using List = boost::intrusive::list<
+        Node,
+        boost::intrusive::member_hook<Node, Node::Hook, &Node::hook_>,
+        boost::intrusive::constant_time_size<false>>;
+
+    std::uint64_t ToTick(Clock::time_point time_point, bool round_up) const noexcept;
+    void Insert(Node& node) noexcept;
+    void Cascade(std::size_t level) noexcept;
+
+    const Clock::duration resolution_;
+    const Clock::time_point start_;
+    std::uint64_t current_tick_{0};
+    std::size_t size_{0};
+    std::array<std::array<List, kSlots>, kLevels> slots_;
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
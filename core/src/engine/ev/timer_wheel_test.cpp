@@ -0,0 +1,111 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <deque>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::ev::TimerWheel;
+using std::chrono::milliseconds;
+
+std::vector<const TimerWheel::Node*> expired;
+
+void OnExpired(TimerWheel::Node& node) noexcept { expired.push_back(&node); }
+
+struct TimerWheelTest : public ::testing::Test {
+    void SetUp() override { expired.clear(); }
+
+    const TimerWheel::Clock::time_point start{TimerWheel::Clock::now()};
+    TimerWheel wheel{milliseconds{1}, start};
+};
+
+}  // namespace
+
+TEST_F(TimerWheelTest, NeverFiresEarly) {
+    TimerWheel::Node node{&OnExpired};
+    wheel.Schedule(node, start + milliseconds{10} + std::chrono::microseconds{1});
+    EXPECT_TRUE(node.IsScheduled());
+    EXPECT_EQ(wheel.GetSize(), 1);
+
+    wheel.Advance(start + milliseconds{10});
+    EXPECT_TRUE(expired.empty());
+
+    wheel.Advance(start + milliseconds{11});
+    ASSERT_EQ(expired.size(), 1);
+    EXPECT_EQ(expired[0], &node);
+    EXPECT_FALSE(node.IsScheduled());
+    EXPECT_TRUE(wheel.IsEmpty());
+}
+
+TEST_F(TimerWheelTest, PastExpiryFiresOnNextTick) {
+    wheel.Advance(start + milliseconds{5});
+
+    TimerWheel::Node node{&OnExpired};
+    wheel.Schedule(node, start);
+    wheel.Advance(start + milliseconds{5});
+    EXPECT_TRUE(expired.empty());
+
+    wheel.Advance(start + milliseconds{6});
+    EXPECT_EQ(expired.size(), 1);
+}
+
+TEST_F(TimerWheelTest, CancelAndReschedule) {
+    TimerWheel::Node first{&OnExpired};
+    TimerWheel::Node second{&OnExpired};
+    wheel.Schedule(first, start + milliseconds{3});
+    wheel.Schedule(second, start + milliseconds{3});
+
+    wheel.Cancel(first);
+    wheel.Cancel(first);
+    EXPECT_FALSE(first.IsScheduled());
+    EXPECT_EQ(wheel.GetSize(), 1);
+
+    wheel.Schedule(second, start + milliseconds{100});
+    EXPECT_EQ(wheel.GetSize(), 1);
+
+    wheel.Advance(start + milliseconds{99});
+    EXPECT_TRUE(expired.empty());
+
+    wheel.Advance(start + milliseconds{100});
+    ASSERT_EQ(expired.size(), 1);
+    EXPECT_EQ(expired[0], &second);
+}
+
+TEST_F(TimerWheelTest, CascadesInOrder) {
+    // Cover all the levels and the parking beyond the wheel horizon
+    const std::vector<milliseconds> timeouts{
+        milliseconds{1},
+        milliseconds{63},
+        milliseconds{64},
+        milliseconds{65},
+        milliseconds{4095},
+        milliseconds{4097},
+        milliseconds{300'000},
+        milliseconds{16'777'300},
+        milliseconds{20'000'000},
+    };
+
+    std::deque<TimerWheel::Node> nodes;
+    for (std::size_t i = 0; i < timeouts.size(); ++i) {
+        nodes.emplace_back(&OnExpired);
+    }
+    for (std::size_t i = 0; i < timeouts.size(); ++i) {
+        wheel.Schedule(nodes[i], start + timeouts[i]);
+    }
+
+    for (std::size_t i = 0; i < timeouts.size(); ++i) {
+        wheel.Advance(start + timeouts[i] - milliseconds{1});
+        EXPECT_EQ(expired.size(), i) << "timeout " << timeouts[i].count();
+
+        wheel.Advance(start + timeouts[i]);
+        ASSERT_EQ(expired.size(), i + 1) << "timeout " << timeouts[i].count();
+        EXPECT_EQ(expired[i], &nodes[i]);
+    }
+    EXPECT_TRUE(wheel.IsEmpty());
+}
+
+USERVER_NAMESPACE_END
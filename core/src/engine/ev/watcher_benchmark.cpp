@@ -6,6 +6,7 @@
 #include <userver/engine/task/task.hpp>
 #include <userver/utils/fixed_array.hpp>
 #include <utils/check_syscall.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
 
 #include "watcher.hpp"
 
@@ -70,4 +71,24 @@ void watcher_async_start_multiple(benchmark::State& state) {
 }
 BENCHMARK(watcher_async_start_multiple);
 
+// Many coroutines arm watchers of a single ev thread at the same time, their
+// submissions are processed in batches
+void watcher_async_start_concurrent(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&]() {
+        const auto& ev_thread = engine::current_task::GetEventThread();
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            Pipe pipe;
+            ev::Watcher<ev_io> watcher{ev_thread, &pipe};
+            watcher.Init(NoInvokeCallback, pipe.GetIn(), EV_READ);
+
+            for ([[maybe_unused]] auto _ : range) {
+                watcher.StartAsync();
+                watcher.Stop();
+            }
+        });
+    });
+}
+BENCHMARK(watcher_async_start_concurrent)->RangeMultiplier(2)->Range(1, 8);
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,13 @@
+#pragma once
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// Makes engine::CachedSteadyClock of the current thread take the time anew on
+/// the next reading, called by the task processor before resuming a task
+void InvalidateCachedSteadyClock() noexcept;
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
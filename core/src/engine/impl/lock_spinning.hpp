@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+#include <compiler/relax_cpu.hpp>
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+// Spin phase of the spin-then-park locking. Retries `try_lock` up to the task
+// processor `lock-spinning-iterations` times while `should_spin` holds, so
+// that short critical sections do not cost a context switch and an ev wakeup.
+//
+// `should_spin` is expected to return false once there are parked waiters:
+// spinning under heavy contention only burns CPU and lets the spinner
+// overtake the waiters.
+template <typename TryLock, typename ShouldSpin>
+bool SpinTryLock(TaskContext& current, Deadline deadline, TryLock try_lock, ShouldSpin should_spin) {
+    if (deadline == Deadline::Passed()) return false;
+
+    const auto iterations = current.GetTaskProcessor().GetLockSpinningIterations();
+    compiler::RelaxCpu relax;
+    for (std::size_t i = 0; i < iterations && should_spin(); ++i) {
+        relax();
+        if (try_lock()) return true;
+    }
+    return false;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
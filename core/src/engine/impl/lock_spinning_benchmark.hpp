@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+// Runs `payload` on a task processor with `worker_threads` workers and the
+// given `lock-spinning-iterations`
+template <typename Func>
+void RunWithLockSpinning(std::size_t worker_threads, std::size_t spinning_iterations, Func payload) {
+    engine::RunStandalone([&] {
+        engine::TaskProcessorConfig config;
+        config.name = "lock-spinning-benchmark";
+        config.thread_name = "bench-worker";
+        config.worker_threads = worker_threads;
+        config.lock_spinning_iterations = spinning_iterations;
+        engine::TaskProcessor task_processor{config, engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+        engine::AsyncNoSpan(task_processor, payload).Get();
+    });
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
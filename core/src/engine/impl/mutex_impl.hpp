@@ -6,6 +6,7 @@
 
 #include <userver/utils/assert.hpp>
 
+#include <engine/impl/lock_spinning.hpp>
 #include <engine/impl/wait_list.hpp>
 #include <engine/impl/wait_list_light.hpp>
 #include <engine/task/task_context.hpp>
@@ -130,6 +131,18 @@ bool MutexImpl<Waiters>::LockFastPath(TaskContext& current) noexcept {
 
 template <class Waiters>
 bool MutexImpl<Waiters>::LockSlowPath(TaskContext& current, Deadline deadline) {
+    const auto try_lock = [this, &current] { return LockFastPath(current); };
+    const auto no_sleepers = [this] {
+        if constexpr (std::is_same_v<Waiters, WaitList>) {
+            return lock_waiters_.GetCountOfSleepies() == 0;
+        } else {
+            return true;
+        }
+    };
+    if (SpinTryLock(current, deadline, try_lock, no_sleepers)) {
+        return true;
+    }
+
     const engine::TaskCancellationBlocker block_cancels;
     MutexWaitStrategy wait_manager{*this, current};
     while (true) {
@@ -1,10 +1,9 @@
 #include <userver/engine/impl/task_local_storage.hpp>
 
 #include <fmt/format.h>
-#include <boost/intrusive/list.hpp>
 #include <boost/intrusive/list_hook.hpp>
 #include <boost/intrusive/slist.hpp>
-#include <boost/range/adaptor/reversed.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include <engine/task/task_context.hpp>
 #include <userver/compiler/demangle.hpp>
@@ -47,13 +46,56 @@ using NormalDataList = boost::intrusive::slist<
     boost::intrusive::linear<true>,
     boost::intrusive::cache_last<false>>;
 
-using InheritedDataList = boost::intrusive::list<
-    DataPtr,
-    boost::intrusive::member_hook<DataPtr, ListHook, &DataPtr::list_hook>,
-    boost::intrusive::constant_time_size<false>>;
-
 }  // namespace
 
+// An immutable set of the inherited variables. A task shares it with all its
+// children, so that spawning a child costs a single reference increment. The
+// set is copied once a task with a shared set modifies an inherited variable.
+class InheritedSnapshot final {
+public:
+    InheritedSnapshot() : data_(std::make_unique<InheritedDataBase*[]>(variable_count)) {}
+
+    InheritedSnapshot(const InheritedSnapshot& other) : InheritedSnapshot() {
+        for (Key key = 0; key < variable_count; ++key) {
+            if (auto* const node = other.data_[key]) {
+                node->AddRef();
+                data_[key] = node;
+            }
+        }
+    }
+
+    InheritedSnapshot& operator=(const InheritedSnapshot&) = delete;
+
+    ~InheritedSnapshot() {
+        for (Key key = 0; key < variable_count; ++key) {
+            if (auto* const node = data_[key]) node->DeleteSelf();
+        }
+    }
+
+    InheritedDataBase* Get(Key key) const noexcept { return data_[key]; }
+
+    // Takes ownership of the node, does not delete the old data, if any.
+    // Only allowed for the snapshot that is not shared.
+    void Set(Key key, InheritedDataBase* node) noexcept {
+        UASSERT(!IsShared());
+        data_[key] = node;
+    }
+
+    bool IsShared() const noexcept { return ref_counter_.load(std::memory_order_acquire) != 1; }
+
+    friend void intrusive_ptr_add_ref(InheritedSnapshot* snapshot) noexcept {
+        snapshot->ref_counter_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    friend void intrusive_ptr_release(InheritedSnapshot* snapshot) noexcept {
+        if (snapshot->ref_counter_.fetch_sub(1, std::memory_order_acq_rel) == 1) delete snapshot;
+    }
+
+private:
+    std::atomic<std::size_t> ref_counter_{0};
+    const std::unique_ptr<InheritedDataBase*[]> data_;
+};
+
 DataBase::DataBase(Deleter deleter) : deleter_(deleter) {}
 
 void DataBase::DeleteSelf() noexcept { deleter_(*this); }
@@ -69,11 +111,12 @@ void ReportVariableNotSet(const std::type_info& type) {
 }
 
 struct Storage::Impl final {
+    // Only the normal variables, the inherited ones are in the snapshot
     std::unique_ptr<DataPtr[]> data;
     NormalDataList normal_data_storage;
-    InheritedDataList inherited_data_storage;
+    boost::intrusive_ptr<InheritedSnapshot> inherited;
 
-    void DoSetGeneric(Key key, DataBase& node);
+    InheritedSnapshot& GetMutableInherited();
 };
 
 Storage::Storage() { utils::impl::AssertStaticRegistrationFinished(); }
@@ -91,101 +134,83 @@ Storage::~Storage() {
         impl_->normal_data_storage.pop_front_and_dispose(disposer);
     }
 
-    while (!impl_->inherited_data_storage.empty()) {
-        impl_->inherited_data_storage.pop_front_and_dispose(disposer);
-    }
+    impl_->inherited.reset();
 }
 
 void Storage::InheritFrom(Storage& other) {
     UASSERT(impl_->normal_data_storage.empty());
-    UASSERT(impl_->inherited_data_storage.empty());
-
-    if (!other.impl_->inherited_data_storage.empty() && !impl_->data) {
-        impl_->data = std::make_unique<DataPtr[]>(variable_count);
-    }
+    UASSERT(!impl_->inherited);
 
-    for (DataPtr& their_ptr : other.impl_->inherited_data_storage | boost::adaptors::reversed) {
-        UASSERT(their_ptr.ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-        auto& node = static_cast<InheritedDataBase&>(*their_ptr.ptr);
-
-        InheritNode(node);
-    }
+    impl_->inherited = other.impl_->inherited;
 }
 
 void Storage::InheritNodeIfExists(Storage& other, Key key) {
     UASSERT(key < variable_count);
 
     // we want to stop asap if there is nothing to copy
-    if (!other.impl_->data) {
+    if (!other.impl_->inherited) {
         return;
     }
-    auto& their_ptr = other.impl_->data[key];
-    if (!their_ptr.ptr) {
+    auto* const node = other.impl_->inherited->Get(key);
+    if (!node) {
         return;
     }
 
-    if (!impl_->data) {
-        impl_->data = std::make_unique<DataPtr[]>(variable_count);
-    }
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-    auto& node = static_cast<InheritedDataBase&>(*their_ptr.ptr);
-
-    InheritNode(node);
-}
-
-void Storage::InheritNode(InheritedDataBase& node) {
-    UASSERT(node.GetKey() < variable_count);
-
-    auto& our_ptr = impl_->data[node.GetKey()];
-    UASSERT(!our_ptr.ptr);
-    our_ptr.ptr = &node;
-    impl_->inherited_data_storage.push_front(our_ptr);
-    node.AddRef();
+    auto& inherited = impl_->GetMutableInherited();
+    UASSERT(!inherited.Get(key));
+    node->AddRef();
+    inherited.Set(key, node);
 }
 
 void Storage::InitializeFrom(Storage&& other) noexcept {
     UASSERT(impl_->normal_data_storage.empty());
-    UASSERT(impl_->inherited_data_storage.empty());
+    UASSERT(!impl_->inherited);
     impl_ = std::move(other.impl_);
 }
 
-DataBase* Storage::GetGeneric(Key key) noexcept {
+DataBase* Storage::GetGeneric(Key key, VariableKind kind) noexcept {
     UASSERT(key < variable_count);
+    if (kind == VariableKind::kInherited) {
+        return impl_->inherited ? impl_->inherited->Get(key) : nullptr;
+    }
     if (!impl_->data) return nullptr;
     return impl_->data[key].ptr;
 }
 
-void Storage::Impl::DoSetGeneric(Key key, DataBase& node) {
-    UASSERT(key < variable_count);
-    if (!data) data = std::make_unique<DataPtr[]>(variable_count);
-    data[key].ptr = &node;
+InheritedSnapshot& Storage::Impl::GetMutableInherited() {
+    if (!inherited) {
+        inherited = new InheritedSnapshot();
+    } else if (inherited->IsShared()) {
+        // Copy-on-write, the parent and the siblings keep seeing the old values
+        inherited = new InheritedSnapshot(*inherited);
+    }
+    return *inherited;
 }
 
 void Storage::SetGeneric(Key key, NormalDataBase& node, bool has_existing_variable) {
-    impl_->DoSetGeneric(key, node);
+    UASSERT(key < variable_count);
+    if (!impl_->data) impl_->data = std::make_unique<DataPtr[]>(variable_count);
+    impl_->data[key].ptr = &node;
     if (!has_existing_variable) {
         impl_->normal_data_storage.push_front(impl_->data[key]);
     }
 }
 
-void Storage::SetGeneric(Key key, InheritedDataBase& node, bool has_existing_variable) {
-    impl_->DoSetGeneric(key, node);
-    if (!has_existing_variable) {
-        impl_->inherited_data_storage.push_front(impl_->data[key]);
-    }
+void Storage::SetGeneric(Key key, InheritedDataBase& node, bool /*has_existing_variable*/) {
+    UASSERT(key < variable_count);
+    auto& inherited = impl_->GetMutableInherited();
+    // The old data, if any, is released by the caller
+    inherited.Set(key, &node);
 }
 
-void Storage::EraseInherited(Key key) noexcept {
+void Storage::EraseInherited(Key key) {
     UASSERT(key < variable_count);
-    if (!impl_->data) return;
+    if (!impl_->inherited) return;
 
-    auto& data_ptr = impl_->data[key];
-    auto* const data = data_ptr.ptr;
+    auto* const data = impl_->inherited->Get(key);
     if (!data) return;
 
-    data_ptr.ptr = nullptr;
-    impl_->inherited_data_storage.erase(InheritedDataList::s_iterator_to(data_ptr));
+    impl_->GetMutableInherited().Set(key, nullptr);
     data->DeleteSelf();
 }
 
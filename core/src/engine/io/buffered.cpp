@@ -1,6 +1,8 @@
 #include <userver/engine/io/buffered.hpp>
 
-#include <boost/algorithm/string/trim.hpp>
+#include <cstring>
+
+#include <fmt/format.h>
 
 #include <engine/io/impl/buffer.hpp>
 #include <userver/engine/io/exception.hpp>
@@ -9,6 +11,17 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::io {
 
+namespace {
+
+constexpr std::size_t kFrameSizePrefix = 4;
+
+// memchr is vectorized by the libc, unlike a byte-by-byte predicate call
+const char* FindChar(const char* data, std::size_t size, char c) {
+    return static_cast<const char*>(std::memchr(data, c, size));
+}
+
+}  // namespace
+
 TerminatorNotFoundException::TerminatorNotFoundException()
     : IoException("EOF encountered before terminator could be found") {}
 
@@ -35,27 +48,68 @@ std::string BufferedReader::ReadSome(size_t max_bytes, Deadline deadline) {
 }
 
 std::string BufferedReader::ReadAll(size_t num_bytes, Deadline deadline) {
-    if (buffer_->AvailableReadBytes() < num_bytes) {
-        buffer_->Reserve(num_bytes - buffer_->AvailableReadBytes());
-        while (buffer_->AvailableReadBytes() < num_bytes) {
-            if (!FillBuffer(deadline)) break;
-        }
-    }
+    FillAtLeast(num_bytes, deadline);
     std::string result(buffer_->ReadPtr(), std::min(num_bytes, buffer_->AvailableReadBytes()));
     buffer_->ReportRead(result.size());
     return result;
 }
 
 std::string BufferedReader::ReadLine(Deadline deadline) {
-    static const auto kPred = [](int c) { return c == '\n' || c == '\r' || c == EOF; };
-    while (kPred(Peek(deadline))) Getc(deadline);
-    auto result = ReadUntil(kPred, deadline);
-    boost::algorithm::trim_right_if(result, kPred);
+    for (int c = Peek(deadline); c == '\n' || c == '\r'; c = Peek(deadline)) {
+        buffer_->ReportRead(1);
+    }
+
+    const auto size = ScanUntil(
+        [](const char* data, size_t size) {
+            const auto* const lf = FindChar(data, size, '\n');
+            const auto* const cr = FindChar(data, lf ? lf - data : size, '\r');
+            return cr ? cr : lf;
+        },
+        deadline
+    );
+    // The last line may lack the terminator
+    const auto line_size = size ? *size - 1 : buffer_->AvailableReadBytes();
+    std::string result(buffer_->ReadPtr(), line_size);
+    buffer_->ReportRead(size.value_or(line_size));
     return result;
 }
 
 std::string BufferedReader::ReadUntil(char terminator, Deadline deadline) {
-    return ReadUntil([terminator](int c) { return c == terminator; }, deadline);
+    return std::string{ReadViewUntil(terminator, deadline)};
+}
+
+std::string_view BufferedReader::ReadViewUntil(char terminator, Deadline deadline) {
+    const auto size = ScanUntil(
+        [terminator](const char* data, size_t size) { return FindChar(data, size, terminator); }, deadline
+    );
+    if (!size) throw TerminatorNotFoundException();
+
+    // Consuming the whole buffer only moves the pointers, the data stays
+    // in place till the next fill
+    const std::string_view result{buffer_->ReadPtr(), *size};
+    buffer_->ReportRead(*size);
+    return result;
+}
+
+std::optional<std::string_view> BufferedReader::ReadFrameView(std::size_t max_frame_size, Deadline deadline) {
+    if (!FillAtLeast(kFrameSizePrefix, deadline)) {
+        if (!buffer_->AvailableReadBytes()) return std::nullopt;
+        throw IoException("EOF encountered in the middle of a frame size");
+    }
+
+    const auto* const prefix = reinterpret_cast<const unsigned char*>(buffer_->ReadPtr());
+    const std::size_t frame_size = (std::size_t{prefix[0]} << 24) | (std::size_t{prefix[1]} << 16) |
+                                   (std::size_t{prefix[2]} << 8) | std::size_t{prefix[3]};
+    if (frame_size > max_frame_size) {
+        throw IoException(fmt::format("Frame size {} exceeds the limit of {} bytes", frame_size, max_frame_size));
+    }
+    if (!FillAtLeast(kFrameSizePrefix + frame_size, deadline)) {
+        throw IoException("EOF encountered in the middle of a frame");
+    }
+
+    const std::string_view result{buffer_->ReadPtr() + kFrameSizePrefix, frame_size};
+    buffer_->ReportRead(kFrameSizePrefix + frame_size);
+    return result;
 }
 
 std::string BufferedReader::ReadUntil(utils::function_ref<bool(int) const> pred, Deadline deadline) {
@@ -114,6 +168,34 @@ void BufferedReader::Discard(size_t num_bytes, Deadline deadline) {
     }
 }
 
+std::optional<size_t>
+BufferedReader::ScanUntil(utils::function_ref<const char*(const char*, size_t) const> find, Deadline deadline) {
+    // The scanned bytes are not scanned again after the buffer is filled
+    size_t search_pos = 0;
+    while (true) {
+        const auto available = buffer_->AvailableReadBytes();
+        if (search_pos < available) {
+            const auto* const read_ptr = buffer_->ReadPtr();
+            const auto* const found = find(read_ptr + search_pos, available - search_pos);
+            if (found) return found - read_ptr + 1;
+            search_pos = available;
+        }
+
+        buffer_->Reserve(1);
+        if (!FillBuffer(deadline)) return std::nullopt;
+    }
+}
+
+bool BufferedReader::FillAtLeast(size_t num_bytes, Deadline deadline) {
+    if (buffer_->AvailableReadBytes() >= num_bytes) return true;
+
+    buffer_->Reserve(num_bytes - buffer_->AvailableReadBytes());
+    while (buffer_->AvailableReadBytes() < num_bytes) {
+        if (!FillBuffer(deadline)) return false;
+    }
+    return true;
+}
+
 size_t BufferedReader::FillBuffer(Deadline deadline) {
     try {
         auto read_bytes = source_->ReadSome(buffer_->WritePtr(), buffer_->AvailableWriteBytes(), deadline);
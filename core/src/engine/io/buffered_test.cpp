@@ -88,6 +88,48 @@ TEST(BufferedReader, ReadUntilChar) {
     EXPECT_EQ("b,", reader.ReadUntil(','));
 }
 
+TEST(BufferedReader, ReadViewUntil) {
+    auto mock_ptr = std::make_shared<ReadableMock>();
+    BufferedReader reader(mock_ptr, 16);
+
+    const std::string long_line(1000, 'x');
+    mock_ptr->Feed("a;" + long_line + ";b");
+    EXPECT_EQ("a;", reader.ReadViewUntil(';'));
+    EXPECT_EQ(long_line + ';', reader.ReadViewUntil(';'));
+    UEXPECT_THROW(reader.ReadViewUntil(';'), engine::io::TerminatorNotFoundException);
+    EXPECT_EQ("b", reader.ReadAll(1));
+}
+
+TEST(BufferedReader, ReadLineSmallBuffer) {
+    auto mock_ptr = std::make_shared<ReadableMock>();
+    BufferedReader reader(mock_ptr, 16);
+
+    const std::string long_line(100, 'x');
+    mock_ptr->Feed(long_line + "\r\n" + long_line + "\n\n" + "last");
+    EXPECT_EQ(long_line, reader.ReadLine());
+    EXPECT_EQ(long_line, reader.ReadLine());
+    EXPECT_EQ("last", reader.ReadLine());
+    EXPECT_EQ("", reader.ReadLine());
+}
+
+TEST(BufferedReader, ReadFrameView) {
+    auto mock_ptr = std::make_shared<ReadableMock>();
+    BufferedReader reader(mock_ptr, 16);
+
+    const std::string long_frame(300, 'x');
+    mock_ptr->Feed(std::string{"\0\0\0\3abc", 7});
+    mock_ptr->Feed(std::string{"\0\0\1\x2c", 4} + long_frame);
+    mock_ptr->Feed(std::string{"\0\0\0\0", 4});
+    EXPECT_EQ("abc", reader.ReadFrameView(1024));
+    EXPECT_EQ(long_frame, reader.ReadFrameView(1024));
+    EXPECT_EQ("", reader.ReadFrameView(1024));
+    EXPECT_EQ(std::nullopt, reader.ReadFrameView(1024));
+
+    mock_ptr->Feed(std::string{"\0\0\0\5abc", 7});
+    UEXPECT_THROW(reader.ReadFrameView(4), engine::io::IoException);
+    UEXPECT_THROW(reader.ReadFrameView(1024), engine::io::IoException);
+}
+
 TEST(BufferedReader, GetPeek) {
     auto mock_ptr = std::make_shared<ReadableMock>();
     BufferedReader reader(mock_ptr);
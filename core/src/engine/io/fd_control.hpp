@@ -99,6 +99,19 @@ public:
         const Context&... context
     );
 
+    // Same as PerformIo, but `io_func(fd, offset, len)` transfers the data
+    // located at `offset` of some other file instead of a memory buffer
+    template <typename IoFunc, typename... Context>
+    size_t PerformIoAtOffset(
+        SingleUserGuard& guard,
+        IoFunc&& io_func,
+        std::size_t offset,
+        std::size_t len,
+        TransferMode mode,
+        Deadline deadline,
+        const Context&... context
+    );
+
     engine::impl::ContextAccessor* TryGetContextAccessor() noexcept { return poller_.TryGetContextAccessor(); }
 
 private:
@@ -273,6 +286,33 @@ size_t Direction::PerformIo(
     return pos - begin;
 }
 
+template <typename IoFunc, typename... Context>
+size_t Direction::PerformIoAtOffset(
+    SingleUserGuard&,
+    IoFunc&& io_func,
+    std::size_t offset,
+    std::size_t len,
+    TransferMode mode,
+    Deadline deadline,
+    const Context&... context
+) {
+    std::size_t processed_bytes = 0;
+
+    while (processed_bytes < len) {
+        auto chunk_size = io_func(Fd(), offset + processed_bytes, len - processed_bytes);
+
+        if (chunk_size > 0) {
+            processed_bytes += chunk_size;
+            if (mode == TransferMode::kOnce) {
+                break;
+            }
+        } else if (!chunk_size || TryHandleError(errno, processed_bytes, mode, deadline, context...) == ErrorMode::kFatal) {
+            break;
+        }
+    }
+    return processed_bytes;
+}
+
 }  // namespace engine::io::impl
 
 USERVER_NAMESPACE_END
@@ -54,8 +54,14 @@ size_t Buffer::AvailableWriteBytes() const { return write_ptr_ ? data_.data() +
 void Buffer::Reserve(size_t num_bytes) {
     if (num_bytes + AvailableReadBytes() > data_.size()) {
         Reallocate(num_bytes + AvailableReadBytes());
+        return;
     }
-    if (num_bytes > AvailableReadBytes() + AvailableWriteBytes()) Rebase();
+
+    // A cheap move of a small tail is better than reading in small pieces
+    // into the end of the buffer
+    const auto quarter = data_.size() / 4;
+    const bool is_tail_small = AvailableWriteBytes() < quarter && AvailableReadBytes() < quarter;
+    if (read_ptr_ != data_.data() && (num_bytes > AvailableWriteBytes() || is_tail_small)) Rebase();
 }
 
 char* Buffer::WritePtr() { return write_ptr_; }
@@ -68,7 +74,8 @@ void Buffer::ReportWritten(size_t num_bytes) {
 void Buffer::Reallocate(size_t size_request) {
     UASSERT(size_request > data_.size());
 
-    std::vector<char> tmp(RoundedSize(size_request));
+    // Grow geometrically, so that a long message is not copied on every fill
+    std::vector<char> tmp(RoundedSize(std::max(size_request, data_.size() * 2)));
     tmp.swap(data_);  // does not invalidate ptrs
     Rebase();
 }
@@ -1,10 +1,15 @@
 #include <userver/engine/io/socket.hpp>
 
 #include <fcntl.h>
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
 #include <sys/socket.h>
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <array>
 #include <cerrno>
 #include <string>
 #include <vector>
@@ -117,6 +122,83 @@ private:
     const Sockaddr& dest_addr_;
 };
 
+// Each syscall handles at most this amount of datagrams to keep the temporary
+// buffers on stack
+constexpr std::size_t kMaxDatagramsPerSyscall = 64;
+
+// Offsets and lengths pass through Direction::PerformIoAtOffset in datagrams
+class RecvFromBatchWrapper {
+public:
+    explicit RecvFromBatchWrapper(Socket::Datagram* datagrams) : datagrams_(datagrams) {}
+
+    [[nodiscard]] ssize_t operator()(int fd, std::size_t first, std::size_t count) const {
+        auto* datagrams = datagrams_ + first;
+#ifdef __linux__
+        count = std::min(count, kMaxDatagramsPerSyscall);
+        std::array<struct mmsghdr, kMaxDatagramsPerSyscall> messages{};
+        std::array<struct iovec, kMaxDatagramsPerSyscall> iovs{};
+        for (std::size_t i = 0; i < count; ++i) {
+            iovs[i].iov_base = datagrams[i].data;
+            iovs[i].iov_len = datagrams[i].len;
+            messages[i].msg_hdr.msg_name = datagrams[i].addr.Data();
+            messages[i].msg_hdr.msg_namelen = datagrams[i].addr.Capacity();
+            messages[i].msg_hdr.msg_iov = &iovs[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const auto ret = ::recvmmsg(fd, messages.data(), count, 0, nullptr);
+        for (int i = 0; i < ret; ++i) {
+            datagrams[i].len = messages[i].msg_len;
+        }
+        return ret;
+#else
+        // MAC_COMPAT: no recvmmsg, one datagram per syscall
+        UASSERT(count > 0);
+        socklen_t addrlen = datagrams->addr.Capacity();
+        const auto ret = ::recvfrom(fd, datagrams->data, datagrams->len, 0, datagrams->addr.Data(), &addrlen);
+        if (ret == -1) return -1;
+        datagrams->len = ret;
+        return 1;
+#endif
+    }
+
+private:
+    Socket::Datagram* datagrams_;
+};
+
+class SendToBatchWrapper {
+public:
+    explicit SendToBatchWrapper(const Socket::Datagram* datagrams) : datagrams_(datagrams) {}
+
+    [[nodiscard]] ssize_t operator()(int fd, std::size_t first, std::size_t count) const {
+        const auto* datagrams = datagrams_ + first;
+#ifdef __linux__
+        count = std::min(count, kMaxDatagramsPerSyscall);
+        std::array<struct mmsghdr, kMaxDatagramsPerSyscall> messages{};
+        std::array<struct iovec, kMaxDatagramsPerSyscall> iovs{};
+        for (std::size_t i = 0; i < count; ++i) {
+            iovs[i].iov_base = datagrams[i].data;
+            iovs[i].iov_len = datagrams[i].len;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            messages[i].msg_hdr.msg_name = const_cast<struct sockaddr*>(datagrams[i].addr.Data());
+            messages[i].msg_hdr.msg_namelen = datagrams[i].addr.Size();
+            messages[i].msg_hdr.msg_iov = &iovs[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        return ::sendmmsg(fd, messages.data(), count, MSG_NOSIGNAL);
+#else
+        // MAC_COMPAT: no sendmmsg, one datagram per syscall
+        UASSERT(count > 0);
+        const auto ret = SendToWrapper{datagrams->addr}(fd, datagrams->data, datagrams->len);
+        return ret == -1 ? -1 : 1;
+#endif
+    }
+
+private:
+    const Socket::Datagram* datagrams_;
+};
+
 void FillIoSendData(const IoData* data, struct iovec* dst, std::size_t count) {
     UASSERT(data);
     UASSERT(count > 0);
@@ -338,6 +420,96 @@ size_t Socket::SendAll(const void* buf, size_t len, Deadline deadline) {
     );
 }
 
+size_t Socket::SendFile(int file_fd, std::size_t offset, std::size_t len, Deadline deadline) {
+    if (!IsValid()) {
+        throw IoException("Attempt to SendFile to closed socket");
+    }
+#ifdef __linux__
+    auto& dir = fd_control_->Write();
+    dir.ResetReady();
+    impl::Direction::SingleUserGuard guard(dir);
+    return dir.PerformIoAtOffset(
+        guard,
+        [file_fd](int fd, std::size_t file_offset, std::size_t count) {
+            auto sendfile_offset = static_cast<off_t>(file_offset);
+            return ::sendfile(fd, file_fd, &sendfile_offset, count);
+        },
+        offset,
+        len,
+        impl::TransferMode::kWhole,
+        deadline,
+        "SendFile to ",
+        peername_
+    );
+#else
+    // MAC_COMPAT: sendfile has a different signature, copy through a buffer
+    constexpr std::size_t kBufferSize = 64 * 1024;
+    std::vector<char> buffer(std::min(len, kBufferSize));
+    std::size_t sent_bytes = 0;
+    while (sent_bytes < len) {
+        const auto read_bytes = utils::CheckSyscallCustomException<IoSystemError>(
+            ::pread(file_fd, buffer.data(), std::min(len - sent_bytes, buffer.size()), offset + sent_bytes),
+            "reading from fd={} for SendFile",
+            file_fd
+        );
+        if (read_bytes == 0) break;
+        const auto chunk_sent = SendAll(buffer.data(), read_bytes, deadline);
+        sent_bytes += chunk_sent;
+        if (chunk_sent != static_cast<std::size_t>(read_bytes)) break;
+    }
+    return sent_bytes;
+#endif
+}
+
+size_t Socket::RecvSomeFromBatch(Datagram* datagrams, size_t count, Deadline deadline) {
+    if (!IsValid()) {
+        throw IoException("Attempt to RecvSomeFromBatch via closed socket");
+    }
+    if (count == 0) return 0;
+
+    auto& dir = fd_control_->Read();
+    dir.ResetReady();
+    impl::Direction::SingleUserGuard guard(dir);
+    return dir.PerformIoAtOffset(
+        guard,
+        RecvFromBatchWrapper{datagrams},
+        0,
+        count,
+        impl::TransferMode::kOnce,
+        deadline,
+        "RecvSomeFromBatch"
+    );
+}
+
+size_t Socket::SendAllToBatch(const Datagram* datagrams, size_t count, Deadline deadline) {
+    if (!IsValid()) {
+        throw IoException("Attempt to SendAllToBatch to closed socket");
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (datagrams[i].addr.Domain() != domain_) {
+            throw AddrException(fmt::format(
+                "Socket address domain ({}) does not match address domain ({})",
+                static_cast<int>(domain_),
+                static_cast<int>(datagrams[i].addr.Domain())
+            ));
+        }
+    }
+    if (count == 0) return 0;
+
+    auto& dir = fd_control_->Write();
+    dir.ResetReady();
+    impl::Direction::SingleUserGuard guard(dir);
+    return dir.PerformIoAtOffset(
+        guard,
+        SendToBatchWrapper{datagrams},
+        0,
+        count,
+        impl::TransferMode::kWhole,
+        deadline,
+        "SendAllToBatch"
+    );
+}
+
 Socket::RecvFromResult Socket::RecvSomeFrom(void* buf, size_t len, Deadline deadline) {
     if (!IsValid()) {
         throw IoException("Attempt to RecvSomeFrom via closed socket");
@@ -18,6 +18,9 @@
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/wait_any.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/internal/net/net_listener.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -193,6 +196,36 @@ UTEST(Socket, SendAllVector) {
     EXPECT_EQ(bytes_sent, bytes_read);
 }
 
+UTEST(Socket, SendFile) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    // Larger than the socket buffers, so that the sender has to wait
+    std::string contents(4 * 1024 * 1024, '\0');
+    for (std::size_t i = 0; i < contents.size(); ++i) {
+        contents[i] = static_cast<char>('a' + i % 26);
+    }
+    const auto file = fs::blocking::TempFile::Create();
+    fs::blocking::RewriteFileContents(file.GetPath(), contents);
+    const auto fd = fs::blocking::FileDescriptor::Open(file.GetPath(), fs::blocking::OpenFlag::kRead);
+
+    TcpListener listener;
+    auto sockets = listener.MakeSocketPair(deadline);
+
+    constexpr std::size_t kOffset = 3;
+    const std::size_t len = contents.size() - kOffset;
+    auto listen_task = engine::AsyncNoSpan([&sockets, &deadline, len] {
+        std::string received(len, '\0');
+        EXPECT_EQ(sockets.first.RecvAll(received.data(), received.size(), deadline), len);
+        return received;
+    });
+
+    EXPECT_EQ(sockets.second.SendFile(fd.GetNative(), kOffset, len, deadline), len);
+    EXPECT_EQ(listen_task.Get(), contents.substr(kOffset));
+
+    // Past the end of file
+    EXPECT_EQ(sockets.second.SendFile(fd.GetNative(), contents.size(), 10, deadline), 0);
+}
+
 UTEST(Socket, WaitAnyRead) {
     const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
     TcpListener listener;
@@ -434,6 +467,42 @@ UTEST(Socket, DgramUnbound) {
     listen_task.Get();
 }
 
+UTEST(Socket, DgramBatch) {
+    const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    UdpListener listener;
+    engine::io::Socket client{listener.addr.Domain(), UdpListener::kType};
+
+    std::array<std::string, 3> payloads{"first", "second", "third"};
+    std::array<io::Socket::Datagram, 3> to_send{};
+    for (std::size_t i = 0; i < payloads.size(); ++i) {
+        to_send[i].data = payloads[i].data();
+        to_send[i].len = payloads[i].size();
+        to_send[i].addr = listener.addr;
+    }
+    EXPECT_EQ(3, client.SendAllToBatch(to_send.data(), to_send.size(), test_deadline));
+    const auto client_addr = client.Getsockname();
+
+    std::array<std::array<char, 16>, 4> buffers{};
+    std::array<io::Socket::Datagram, 4> received{};
+    for (std::size_t i = 0; i < buffers.size(); ++i) {
+        received[i].data = buffers[i].data();
+        received[i].len = buffers[i].size();
+    }
+
+    std::size_t received_count = 0;
+    while (received_count < payloads.size()) {
+        received_count += listener.socket.RecvSomeFromBatch(
+            received.data() + received_count, received.size() - received_count, test_deadline
+        );
+    }
+    EXPECT_EQ(received_count, payloads.size());
+    for (std::size_t i = 0; i < payloads.size(); ++i) {
+        EXPECT_EQ(payloads[i], std::string_view(buffers[i].data(), received[i].len));
+        EXPECT_EQ(fmt::to_string(client_addr), fmt::to_string(received[i].addr));
+    }
+}
+
 UTEST_MT(Socket, ConcurrentReadWriteUdp, 2) {
     const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
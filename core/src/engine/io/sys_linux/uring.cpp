@@ -0,0 +1,409 @@
+#include <engine/io/sys_linux/uring.hpp>
+
+#ifdef USERVER_IMPL_HAS_URING
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/single_use_event.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/thread_name.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::sys_linux {
+
+namespace {
+
+constexpr unsigned kQueueEntries = 256;
+
+// `user_data` of the no-op entry that stops the completion thread
+constexpr std::uint64_t kStopUserData = 0;
+
+// Read and write lengths are 32-bit in io_uring
+constexpr std::size_t kMaxChunkSize = 1 << 30;
+
+constexpr std::size_t kInitialReadSize = 16 * 1024;
+
+constexpr std::array kRequiredOps{
+    IORING_OP_NOP,
+    IORING_OP_OPENAT,
+    IORING_OP_READ,
+    IORING_OP_WRITE,
+    IORING_OP_FSYNC,
+    IORING_OP_CLOSE,
+};
+
+int SysSetup(unsigned entries, io_uring_params& params) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+}
+
+int SysEnter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+int SysRegister(int ring_fd, unsigned opcode, void* arg, unsigned nr_args) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+[[noreturn]] void ThrowSystemError(int code, std::string_view what) {
+    throw std::system_error(code, std::generic_category(), std::string{what});
+}
+
+// Converts the `res` of a completion into the result or an exception
+int CheckResult(int res, std::string_view what) {
+    if (res < 0) ThrowSystemError(-res, what);
+    return res;
+}
+
+class Mapping final {
+public:
+    Mapping() = default;
+
+    Mapping(int ring_fd, std::size_t size, off_t offset) : size_(size) {
+        data_ = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+        if (data_ == MAP_FAILED) {
+            data_ = nullptr;
+            ThrowSystemError(errno, "mapping io_uring queues");
+        }
+    }
+
+    Mapping(Mapping&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+    Mapping& operator=(Mapping&& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        return *this;
+    }
+
+    ~Mapping() {
+        if (data_) ::munmap(data_, size_);
+    }
+
+    template <typename T>
+    T* At(std::uint32_t offset) const noexcept {
+        return reinterpret_cast<T*>(static_cast<char*>(data_) + offset);
+    }
+
+private:
+    void* data_{nullptr};
+    std::size_t size_{0};
+};
+
+struct Operation final {
+    engine::SingleUseEvent event;
+    int result{0};
+};
+
+}  // namespace
+
+struct Uring::Impl final {
+    Impl();
+    ~Impl();
+
+    void CheckSupportedOps() const;
+    void ReapCompletions() noexcept;
+
+    // Must be called with `submit_mutex` locked. Returns false if the entry was
+    // not submitted.
+    bool PushAndSubmit(utils::function_ref<void(io_uring_sqe&)> prepare, std::uint64_t user_data) noexcept;
+
+    int ring_fd{-1};
+    Mapping sq_ring;
+    Mapping cq_ring;
+    Mapping sqes_mapping;
+
+    const unsigned* sq_head{nullptr};
+    unsigned* sq_tail{nullptr};
+    unsigned sq_mask{0};
+    unsigned* sq_array{nullptr};
+    io_uring_sqe* sqes{nullptr};
+
+    unsigned* cq_head{nullptr};
+    const unsigned* cq_tail{nullptr};
+    unsigned cq_mask{0};
+    const io_uring_cqe* cqes{nullptr};
+
+    std::mutex submit_mutex;
+
+    // Limits the operations in flight, so that the completion queue never
+    // overflows
+    engine::Semaphore in_flight{kQueueEntries};
+
+    std::thread completion_thread;
+};
+
+Uring::Impl::Impl() {
+    io_uring_params params{};
+    ring_fd = SysSetup(kQueueEntries, params);
+    if (ring_fd < 0) ThrowSystemError(errno, "io_uring_setup");
+
+    try {
+        CheckSupportedOps();
+
+        const auto sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        const auto cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const Mapping* cq_mapping = &cq_ring;
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+            sq_ring = Mapping(ring_fd, std::max(sq_size, cq_size), IORING_OFF_SQ_RING);
+            cq_mapping = &sq_ring;
+        } else {
+            sq_ring = Mapping(ring_fd, sq_size, IORING_OFF_SQ_RING);
+            cq_ring = Mapping(ring_fd, cq_size, IORING_OFF_CQ_RING);
+        }
+        sqes_mapping = Mapping(ring_fd, params.sq_entries * sizeof(io_uring_sqe), IORING_OFF_SQES);
+
+        sq_head = sq_ring.At<unsigned>(params.sq_off.head);
+        sq_tail = sq_ring.At<unsigned>(params.sq_off.tail);
+        sq_mask = *sq_ring.At<unsigned>(params.sq_off.ring_mask);
+        sq_array = sq_ring.At<unsigned>(params.sq_off.array);
+        sqes = sqes_mapping.At<io_uring_sqe>(0);
+
+        cq_head = cq_mapping->At<unsigned>(params.cq_off.head);
+        cq_tail = cq_mapping->At<unsigned>(params.cq_off.tail);
+        cq_mask = *cq_mapping->At<unsigned>(params.cq_off.ring_mask);
+        cqes = cq_mapping->At<io_uring_cqe>(params.cq_off.cqes);
+
+        UINVARIANT(params.cq_entries >= kQueueEntries, "io_uring completion queue is too small");
+
+        completion_thread = std::thread([this] { ReapCompletions(); });
+    } catch (const std::exception&) {
+        ::close(ring_fd);
+        throw;
+    }
+}
+
+Uring::Impl::~Impl() {
+    bool submitted = false;
+    {
+        const std::lock_guard lock{submit_mutex};
+        submitted = PushAndSubmit([](io_uring_sqe& sqe) { sqe.opcode = IORING_OP_NOP; }, kStopUserData);
+    }
+    if (!submitted) {
+        // The ring is leaked together with the thread that uses it
+        LOG_ERROR() << "Failed to stop the io_uring completion thread, errno " << errno;
+        completion_thread.detach();
+        return;
+    }
+    completion_thread.join();
+
+    sqes_mapping = {};
+    cq_ring = {};
+    sq_ring = {};
+    ::close(ring_fd);
+}
+
+void Uring::Impl::CheckSupportedOps() const {
+    constexpr unsigned kProbeOps = 256;
+    const std::size_t probe_size = sizeof(io_uring_probe) + kProbeOps * sizeof(io_uring_probe_op);
+    const std::unique_ptr<io_uring_probe, decltype(&std::free)> probe{
+        static_cast<io_uring_probe*>(std::calloc(1, probe_size)), &std::free};
+    if (!probe) throw std::bad_alloc{};
+
+    if (SysRegister(ring_fd, IORING_REGISTER_PROBE, probe.get(), kProbeOps) < 0) {
+        ThrowSystemError(errno, "probing io_uring operations");
+    }
+    for (const auto op : kRequiredOps) {
+        if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+            throw std::runtime_error(fmt::format("io_uring operation {} is not supported", static_cast<int>(op)));
+        }
+    }
+}
+
+bool Uring::Impl::PushAndSubmit(utils::function_ref<void(io_uring_sqe&)> prepare, std::uint64_t user_data) noexcept {
+    // Without SQPOLL the kernel consumes the entries only inside
+    // io_uring_enter, so the queue is empty here
+    const auto tail = *sq_tail;
+    UASSERT(tail == __atomic_load_n(sq_head, __ATOMIC_ACQUIRE));
+
+    const auto index = tail & sq_mask;
+    auto& sqe = sqes[index];
+    std::memset(&sqe, 0, sizeof(sqe));
+    prepare(sqe);
+    sqe.user_data = user_data;
+    sq_array[index] = index;
+    __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+    while (true) {
+        const auto submitted = SysEnter(ring_fd, 1, 0, 0);
+        if (submitted == 1) return true;
+        if (submitted < 0 && (errno == EINTR || errno == EAGAIN || errno == EBUSY)) continue;
+
+        // Take the entry back, otherwise it would be submitted by the next call
+        __atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+        return false;
+    }
+}
+
+void Uring::Impl::ReapCompletions() noexcept {
+    utils::SetCurrentThreadName("io-uring");
+
+    while (true) {
+        if (SysEnter(ring_fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR) {
+            UASSERT_MSG(false, fmt::format("io_uring_enter failed with errno {}", errno));
+        }
+
+        bool should_stop = false;
+        auto head = *cq_head;
+        const auto tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head) {
+            const auto& cqe = cqes[head & cq_mask];
+            if (cqe.user_data == kStopUserData) {
+                should_stop = true;
+                continue;
+            }
+
+            // The waiter may destroy the operation right after the wakeup
+            auto& operation = *reinterpret_cast<Operation*>(cqe.user_data);
+            operation.result = cqe.res;
+            operation.event.Send();
+        }
+        __atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+
+        if (should_stop) return;
+    }
+}
+
+Uring* Uring::GetInstanceOrNull() noexcept {
+    static const std::unique_ptr<Uring> instance = []() -> std::unique_ptr<Uring> {
+        try {
+            return std::unique_ptr<Uring>{new Uring()};
+        } catch (const std::exception& ex) {
+            LOG_INFO() << "io_uring is not available, file operations fall back to the blocking task processor: "
+                       << ex;
+            return nullptr;
+        }
+    }();
+    return instance.get();
+}
+
+Uring::Uring() : impl_(std::make_unique<Impl>()) {}
+
+Uring::~Uring() = default;
+
+int Uring::Submit(utils::function_ref<void(io_uring_sqe&)> prepare) {
+    const std::shared_lock in_flight_lock{impl_->in_flight};
+
+    Operation operation;
+    {
+        const std::lock_guard lock{impl_->submit_mutex};
+        if (!impl_->PushAndSubmit(prepare, reinterpret_cast<std::uintptr_t>(&operation))) {
+            ThrowSystemError(errno, "io_uring_enter");
+        }
+    }
+
+    // The kernel uses the buffers of the operation until it completes
+    operation.event.WaitNonCancellable();
+    return operation.result;
+}
+
+int Uring::OpenAt(const std::string& path, int flags, ::mode_t mode) {
+    const auto res = Submit([&](io_uring_sqe& sqe) {
+        sqe.opcode = IORING_OP_OPENAT;
+        sqe.fd = AT_FDCWD;
+        sqe.addr = reinterpret_cast<std::uintptr_t>(path.c_str());
+        sqe.len = mode;
+        sqe.open_flags = static_cast<std::uint32_t>(flags | O_CLOEXEC);
+    });
+    return CheckResult(res, fmt::format("opening file '{}'", path));
+}
+
+std::size_t Uring::Read(int fd, char* buffer, std::size_t size, std::uint64_t offset) {
+    const auto res = Submit([&](io_uring_sqe& sqe) {
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<std::uintptr_t>(buffer);
+        sqe.len = static_cast<std::uint32_t>(std::min(size, kMaxChunkSize));
+        sqe.off = offset;
+    });
+    return static_cast<std::size_t>(CheckResult(res, "reading file"));
+}
+
+std::size_t Uring::Write(int fd, const char* buffer, std::size_t size, std::uint64_t offset) {
+    const auto res = Submit([&](io_uring_sqe& sqe) {
+        sqe.opcode = IORING_OP_WRITE;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<std::uintptr_t>(buffer);
+        sqe.len = static_cast<std::uint32_t>(std::min(size, kMaxChunkSize));
+        sqe.off = offset;
+    });
+    return static_cast<std::size_t>(CheckResult(res, "writing file"));
+}
+
+void Uring::FSync(int fd) {
+    const auto res = Submit([&](io_uring_sqe& sqe) {
+        sqe.opcode = IORING_OP_FSYNC;
+        sqe.fd = fd;
+    });
+    CheckResult(res, "calling fsync");
+}
+
+void Uring::Close(int fd) {
+    const auto res = Submit([&](io_uring_sqe& sqe) {
+        sqe.opcode = IORING_OP_CLOSE;
+        sqe.fd = fd;
+    });
+    CheckResult(res, "calling close");
+}
+
+std::string Uring::ReadFileContents(const std::string& path) {
+    const int fd = OpenAt(path, O_RDONLY, 0);
+    utils::FastScopeGuard close_guard{[fd]() noexcept { ::close(fd); }};
+
+    std::string result;
+    std::size_t size = 0;
+    while (true) {
+        if (size == result.size()) result.resize(std::max(result.size() * 2, kInitialReadSize));
+        const auto bytes_read = Read(fd, result.data() + size, result.size() - size, size);
+        if (bytes_read == 0) break;
+        size += bytes_read;
+    }
+    result.resize(size);
+
+    close_guard.Release();
+    Close(fd);
+    return result;
+}
+
+void Uring::RewriteFileContents(const std::string& path, std::string_view contents, ::mode_t mode) {
+    const int fd = OpenAt(path, O_WRONLY | O_CREAT | O_TRUNC, mode);
+    utils::FastScopeGuard close_guard{[fd]() noexcept { ::close(fd); }};
+
+    std::size_t offset = 0;
+    while (offset < contents.size()) {
+        const auto bytes_written = Write(fd, contents.data() + offset, contents.size() - offset, offset);
+        if (bytes_written == 0) ThrowSystemError(EIO, fmt::format("writing file '{}'", path));
+        offset += bytes_written;
+    }
+
+    close_guard.Release();
+    Close(fd);
+}
+
+}  // namespace engine::io::sys_linux
+
+USERVER_NAMESPACE_END
+
+#endif  // USERVER_IMPL_HAS_URING
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <sys/types.h>
+
+#include <userver/utils/function_ref.hpp>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define USERVER_IMPL_HAS_URING 1
+struct io_uring_sqe;
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::sys_linux {
+
+#ifdef USERVER_IMPL_HAS_URING
+
+/// @brief Process-wide io_uring instance for the file operations
+///
+/// The operations are submitted by the calling coroutine, the completions are
+/// reaped by a dedicated thread that wakes up the waiting coroutines, so a
+/// file operation neither blocks a task processor worker nor requires a
+/// thread of the fs-task-processor.
+///
+/// The operations wait for the completion ignoring the task cancellations, as
+/// the kernel keeps using the passed buffers until then. The errors are
+/// reported as std::system_error.
+class Uring final {
+public:
+    /// Returns nullptr if io_uring or one of the required operations is not
+    /// supported by the kernel, or is forbidden (e.g. by seccomp)
+    static Uring* GetInstanceOrNull() noexcept;
+
+    Uring(const Uring&) = delete;
+    Uring& operator=(const Uring&) = delete;
+    ~Uring();
+
+    /// @returns the new file descriptor
+    int OpenAt(const std::string& path, int flags, ::mode_t mode);
+
+    /// @returns the number of bytes read, 0 on end of file
+    std::size_t Read(int fd, char* buffer, std::size_t size, std::uint64_t offset);
+
+    /// @returns the number of bytes written
+    std::size_t Write(int fd, const char* buffer, std::size_t size, std::uint64_t offset);
+
+    void FSync(int fd);
+
+    void Close(int fd);
+
+    /// Helpers that perform the whole operation through the ring
+    /// @{
+    std::string ReadFileContents(const std::string& path);
+    void RewriteFileContents(const std::string& path, std::string_view contents, ::mode_t mode);
+    /// @}
+
+private:
+    struct Impl;
+
+    // Throws if io_uring is not available
+    Uring();
+
+    // Fills the submission queue entry via `prepare`, submits it and waits for
+    // the completion. Returns the `res` field of the completion queue entry.
+    int Submit(utils::function_ref<void(io_uring_sqe&)> prepare);
+
+    std::unique_ptr<Impl> impl_;
+};
+
+#endif  // USERVER_IMPL_HAS_URING
+
+}  // namespace engine::io::sys_linux
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,107 @@
+#include <engine/io/sys_linux/uring.hpp>
+
+#ifdef USERVER_IMPL_HAS_URING
+
+#include <sys/stat.h>
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr ::mode_t kMode = S_IRUSR | S_IWUSR;
+
+std::string MakeContents(std::size_t size) {
+    std::string contents(size, '\0');
+    for (std::size_t i = 0; i < size; ++i) contents[i] = static_cast<char>('a' + i % 26);
+    return contents;
+}
+
+}  // namespace
+
+UTEST(Uring, ReadWrite) {
+    auto* uring_ptr = engine::io::sys_linux::Uring::GetInstanceOrNull();
+    if (!uring_ptr) GTEST_SKIP() << "io_uring is not available";
+    auto& uring = *uring_ptr;
+
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+
+    for (const std::size_t size : {0, 1, 100'000, 3'000'000}) {
+        const auto contents = MakeContents(size);
+        uring.RewriteFileContents(path, contents, kMode);
+        EXPECT_EQ(fs::blocking::ReadFileContents(path), contents);
+        EXPECT_EQ(uring.ReadFileContents(path), contents);
+    }
+
+    fs::blocking::RewriteFileContents(path, "short");
+    EXPECT_EQ(uring.ReadFileContents(path), "short");
+}
+
+UTEST(Uring, Errors) {
+    auto* uring_ptr = engine::io::sys_linux::Uring::GetInstanceOrNull();
+    if (!uring_ptr) GTEST_SKIP() << "io_uring is not available";
+    auto& uring = *uring_ptr;
+
+    const auto dir = fs::blocking::TempDirectory::Create();
+    try {
+        uring.ReadFileContents(dir.GetPath() + "/missing");
+        FAIL() << "ReadFileContents of a missing file has not thrown";
+    } catch (const std::system_error& ex) {
+        EXPECT_EQ(ex.code().value(), ENOENT);
+    }
+
+    UEXPECT_THROW(uring.RewriteFileContents(dir.GetPath() + "/missing/file", "", kMode), std::system_error);
+    UEXPECT_THROW(uring.FSync(-1), std::system_error);
+}
+
+UTEST(Uring, CancelledTaskCompletesOperation) {
+    auto* uring_ptr = engine::io::sys_linux::Uring::GetInstanceOrNull();
+    if (!uring_ptr) GTEST_SKIP() << "io_uring is not available";
+    auto& uring = *uring_ptr;
+
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+    const auto contents = MakeContents(1'000'000);
+
+    engine::current_task::GetCancellationToken().RequestCancel();
+    uring.RewriteFileContents(path, contents, kMode);
+    EXPECT_EQ(uring.ReadFileContents(path), contents);
+}
+
+UTEST_MT(Uring, Concurrent, 4) {
+    auto* uring_ptr = engine::io::sys_linux::Uring::GetInstanceOrNull();
+    if (!uring_ptr) GTEST_SKIP() << "io_uring is not available";
+    auto& uring = *uring_ptr;
+
+    // More tasks than the ring entries, to exercise the in-flight limit
+    constexpr std::size_t kTasks = 1000;
+    const auto dir = fs::blocking::TempDirectory::Create();
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kTasks);
+    for (std::size_t i = 0; i < kTasks; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&uring, &dir, i] {
+            const auto path = dir.GetPath() + "/file" + std::to_string(i % 10);
+            const auto contents = std::to_string(i);
+            uring.RewriteFileContents(path, contents, kMode);
+            uring.ReadFileContents(path);
+        }));
+    }
+    for (auto& task : tasks) UEXPECT_NO_THROW(task.Get());
+}
+
+USERVER_NAMESPACE_END
+
+#endif  // USERVER_IMPL_HAS_URING
@@ -0,0 +1,309 @@
+#include <userver/engine/io/tls_session.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+#include <fmt/format.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#endif
+
+#include <userver/crypto/openssl.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <crypto/helpers.hpp>
+#include <engine/io/tls_session_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+namespace {
+
+#if OPENSSL_VERSION_NUMBER < 0x010100000L
+int SSL_SESSION_up_ref(SSL_SESSION* session) {
+    return CRYPTO_add(&session->references, 1, CRYPTO_LOCK_SSL_SESSION) > 1 ? 1 : 0;
+}
+#endif
+
+// Sessions are resumable only by the servers with the same context
+constexpr std::string_view kSessionIdContext = "userver";
+
+// The previous key is kept to decrypt the tickets issued before the rotation
+constexpr std::size_t kMaxKeysAfterRotation = 2;
+
+void FillRandom(unsigned char* data, std::size_t size) {
+    if (1 != RAND_bytes(data, static_cast<int>(size))) {
+        throw TlsException(crypto::FormatSslError("Failed to generate a session ticket key: RAND_bytes"));
+    }
+}
+
+impl::TlsSessionTicketKey MakeRandomKey() {
+    crypto::Openssl::Init();
+
+    impl::TlsSessionTicketKey key;
+    FillRandom(key.name.data(), key.name.size());
+    FillRandom(key.hmac_secret.data(), key.hmac_secret.size());
+    FillRandom(key.aes_key.data(), key.aes_key.size());
+    return key;
+}
+
+impl::TlsSessionTicketKey ParseKey(std::string_view data) {
+    if (data.size() != TlsSessionTicketKeys::kKeySize) {
+        throw TlsException(fmt::format(
+            "Session ticket key must be {} bytes long, got {} bytes", TlsSessionTicketKeys::kKeySize, data.size()
+        ));
+    }
+
+    impl::TlsSessionTicketKey key;
+    const auto* pos = data.data();
+    std::memcpy(key.name.data(), pos, key.name.size());
+    pos += key.name.size();
+    std::memcpy(key.hmac_secret.data(), pos, key.hmac_secret.size());
+    pos += key.hmac_secret.size();
+    std::memcpy(key.aes_key.data(), pos, key.aes_key.size());
+    return key;
+}
+
+bool IsTls13([[maybe_unused]] const SSL* ssl) noexcept {
+#if OPENSSL_VERSION_NUMBER >= 0x010101000L
+    return SSL_version(ssl) == TLS1_3_VERSION;
+#else
+    return false;
+#endif
+}
+
+// Returns 1 if the ticket is encrypted or decrypted with the current key, 2 if
+// it is decrypted and must be renewed, 0 if the key of the ticket is unknown
+// and a full handshake is required, -1 on errors
+template <typename MacInit>
+int HandleTicketKey(
+    SSL* ssl,
+    unsigned char* key_name,
+    unsigned char* iv,
+    EVP_CIPHER_CTX* cipher_ctx,
+    int enc,
+    MacInit mac_init
+) noexcept {
+    auto* keys = static_cast<TlsSessionTicketKeys::Impl*>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl)));
+    UASSERT(keys);
+
+    try {
+        const auto list = keys->keys.Read();
+        UASSERT(!list->empty());
+
+        if (enc) {
+            const auto& key = list->front();
+            if (1 != RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc()))) return -1;
+            std::memcpy(key_name, key.name.data(), key.name.size());
+            if (1 != EVP_EncryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, key.aes_key.data(), iv)) return -1;
+            return mac_init(key) ? 1 : -1;
+        }
+
+        const auto it = std::find_if(list->begin(), list->end(), [key_name](const impl::TlsSessionTicketKey& key) {
+            return 0 == std::memcmp(key.name.data(), key_name, key.name.size());
+        });
+        if (it == list->end()) return 0;
+        if (1 != EVP_DecryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, it->aes_key.data(), iv)) return -1;
+        if (!mac_init(*it)) return -1;
+        // TLS 1.3 clients use a ticket only once, so it is renewed on every resumption
+        return it == list->begin() && !IsTls13(ssl) ? 1 : 2;
+    } catch (const std::exception& ex) {
+        LOG_LIMITED_ERROR() << "Failed to process a TLS session ticket: " << ex;
+        return -1;
+    }
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+int TicketKeyCallback(
+    SSL* ssl,
+    unsigned char* key_name,
+    unsigned char* iv,
+    EVP_CIPHER_CTX* cipher_ctx,
+    EVP_MAC_CTX* mac_ctx,
+    int enc
+) noexcept {
+    return HandleTicketKey(ssl, key_name, iv, cipher_ctx, enc, [mac_ctx](const impl::TlsSessionTicketKey& key) {
+        char digest[] = "SHA256";
+        const OSSL_PARAM params[] = {
+            OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest, 0),
+            OSSL_PARAM_construct_end(),
+        };
+        return 1 == EVP_MAC_init(mac_ctx, key.hmac_secret.data(), key.hmac_secret.size(), params);
+    });
+}
+#else
+int TicketKeyCallback(
+    SSL* ssl,
+    unsigned char* key_name,
+    unsigned char* iv,
+    EVP_CIPHER_CTX* cipher_ctx,
+    HMAC_CTX* hmac_ctx,
+    int enc
+) noexcept {
+    return HandleTicketKey(ssl, key_name, iv, cipher_ctx, enc, [hmac_ctx](const impl::TlsSessionTicketKey& key) {
+        return 1 == HMAC_Init_ex(hmac_ctx, key.hmac_secret.data(), key.hmac_secret.size(), EVP_sha256(), nullptr);
+    });
+}
+#endif
+
+int NewClientSessionCallback(SSL* ssl, SSL_SESSION* session) noexcept {
+    auto* context = static_cast<impl::TlsClientSessionContext*>(SSL_get_app_data(ssl));
+    if (!context) return 0;
+#if OPENSSL_VERSION_NUMBER >= 0x010101000L
+    if (!SSL_SESSION_is_resumable(session)) return 0;
+#endif
+
+    try {
+        context->cache.Store(context->server_name, session);
+    } catch (const std::exception& ex) {
+        LOG_LIMITED_WARNING() << "Failed to cache a TLS session: " << ex;
+    }
+    // the cache holds its own reference
+    return 0;
+}
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer, const TlsHandshakeStatistics& stats) {
+    const auto full = stats.full.Load().value;
+    const auto resumed = stats.resumed.Load().value;
+
+    writer["handshakes"]["full"] = stats.full;
+    writer["handshakes"]["resumed"] = stats.resumed;
+    writer["resumption-percent"] = full + resumed ? resumed * 100.0 / (full + resumed) : 0.0;
+    writer["early-data"]["accepted"] = stats.early_data_accepted;
+    writer["early-data"]["rejected"] = stats.early_data_rejected;
+}
+
+TlsSessionTicketKeys::TlsSessionTicketKeys()
+    : impl_(std::make_unique<Impl>(impl::TlsSessionTicketKeyList{MakeRandomKey()})) {}
+
+TlsSessionTicketKeys::~TlsSessionTicketKeys() = default;
+
+void TlsSessionTicketKeys::SetKeys(const std::vector<std::string>& keys) {
+    if (keys.empty()) throw TlsException("At least one session ticket key is required");
+
+    impl::TlsSessionTicketKeyList list;
+    list.reserve(keys.size());
+    for (const auto& key : keys) list.push_back(ParseKey(key));
+    impl_->keys.Assign(std::move(list));
+}
+
+void TlsSessionTicketKeys::Rotate() {
+    auto new_key = MakeRandomKey();
+    auto keys = impl_->keys.StartWrite();
+    keys->insert(keys->begin(), new_key);
+    if (keys->size() > kMaxKeysAfterRotation) keys->resize(kMaxKeysAfterRotation);
+    keys.Commit();
+}
+
+const TlsHandshakeStatistics& TlsSessionTicketKeys::GetStatistics() const noexcept { return impl_->stats; }
+
+impl::SslSession TlsClientSessionCache::Impl::Find(const std::string& server_name) {
+    auto locked = sessions.Lock();
+    auto* session = locked->Get(server_name);
+    return session ? *session : nullptr;
+}
+
+void TlsClientSessionCache::Impl::Store(const std::string& server_name, SSL_SESSION* session) {
+    SSL_SESSION_up_ref(session);
+    impl::SslSession ptr{session, impl::SslSessionDeleter{}};
+
+    auto locked = sessions.Lock();
+    locked->Put(server_name, std::move(ptr));
+}
+
+void TlsClientSessionCache::Impl::Erase(const std::string& server_name) {
+    auto locked = sessions.Lock();
+    locked->Erase(server_name);
+}
+
+TlsClientSessionCache::TlsClientSessionCache(std::size_t max_size) : impl_(std::make_unique<Impl>(max_size)) {}
+
+TlsClientSessionCache::~TlsClientSessionCache() = default;
+
+std::size_t TlsClientSessionCache::GetSize() const {
+    const auto locked = impl_->sessions.Lock();
+    return locked->GetSize();
+}
+
+void TlsClientSessionCache::Clear() {
+    auto locked = impl_->sessions.Lock();
+    locked->Clear();
+}
+
+const TlsHandshakeStatistics& TlsClientSessionCache::GetStatistics() const noexcept { return impl_->stats; }
+
+namespace impl {
+
+void SetUpSessionTickets(SSL_CTX* ctx, TlsSessionTicketKeys::Impl& keys) {
+    SSL_CTX_set_app_data(ctx, &keys);
+
+    // The context is created per connection, its own cache would never be hit
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+    if (1 != SSL_CTX_set_session_id_context(
+                 ctx, reinterpret_cast<const unsigned char*>(kSessionIdContext.data()), kSessionIdContext.size()
+             )) {
+        throw TlsException(crypto::FormatSslError("Failed to set up server TLS wrapper: SSL_CTX_set_session_id_context")
+        );
+    }
+
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+    const auto ret = SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx, &TicketKeyCallback);
+#else
+    // cast in openssl macro expansion
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    const auto ret = SSL_CTX_set_tlsext_ticket_key_cb(ctx, &TicketKeyCallback);
+#endif
+    if (1 != ret) {
+        throw TlsException(crypto::FormatSslError("Failed to set up server TLS wrapper: session ticket key callback"));
+    }
+
+#if OPENSSL_VERSION_NUMBER >= 0x010101000L
+    // Every resumption renews the ticket, there is no need in more of them
+    SSL_CTX_set_num_tickets(ctx, 1);
+#endif
+}
+
+void SetUpClientSessionCache(SSL_CTX* ctx) {
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(ctx, &NewClientSessionCallback);
+}
+
+void AttachClientSession(SSL* ssl, TlsClientSessionContext& context) {
+    SSL_set_app_data(ssl, &context);
+
+    const auto session = context.cache.Find(context.server_name);
+    if (session && 1 != SSL_set_session(ssl, session.get())) {
+        LOG_LIMITED_WARNING() << crypto::FormatSslError("Failed to resume a TLS session: SSL_set_session");
+    }
+}
+
+bool IsEarlyDataAccepted([[maybe_unused]] const SSL* ssl) noexcept {
+#if OPENSSL_VERSION_NUMBER >= 0x010101000L
+    return SSL_get_early_data_status(ssl) == SSL_EARLY_DATA_ACCEPTED;
+#else
+    return false;
+#endif
+}
+
+void AccountHandshake(const SSL* ssl, TlsHandshakeStatistics& stats, bool is_early_data_sent) noexcept {
+    ++(SSL_session_reused(ssl) ? stats.resumed : stats.full);
+    if (is_early_data_sent) {
+        ++(IsEarlyDataAccepted(ssl) ? stats.early_data_accepted : stats.early_data_rejected);
+    }
+}
+
+}  // namespace impl
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <openssl/ssl.h>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/io/tls_session.hpp>
+#include <userver/rcu/rcu.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+
+namespace impl {
+
+struct TlsSessionTicketKey final {
+    std::array<unsigned char, 16> name{};
+    std::array<unsigned char, 32> hmac_secret{};
+    std::array<unsigned char, 32> aes_key{};
+};
+
+using TlsSessionTicketKeyList = std::vector<TlsSessionTicketKey>;
+
+struct SslSessionDeleter final {
+    void operator()(SSL_SESSION* session) const noexcept { SSL_SESSION_free(session); }
+};
+using SslSession = std::shared_ptr<SSL_SESSION>;
+
+}  // namespace impl
+
+struct TlsSessionTicketKeys::Impl final {
+    explicit Impl(impl::TlsSessionTicketKeyList initial_keys) : keys(std::move(initial_keys)) {}
+
+    rcu::Variable<impl::TlsSessionTicketKeyList> keys;
+    TlsHandshakeStatistics stats;
+};
+
+struct TlsClientSessionCache::Impl final {
+    explicit Impl(std::size_t max_size) : sessions(max_size) {}
+
+    impl::SslSession Find(const std::string& server_name);
+
+    // Keeps its own reference to the session
+    void Store(const std::string& server_name, SSL_SESSION* session);
+
+    void Erase(const std::string& server_name);
+
+    concurrent::Variable<cache::LruMap<std::string, impl::SslSession>, std::mutex> sessions;
+    TlsHandshakeStatistics stats;
+};
+
+namespace impl {
+
+// Lives on the heap, so that the SSL new session callback could find it after
+// the TlsWrapper is moved
+struct TlsClientSessionContext final {
+    TlsClientSessionCache::Impl& cache;
+    const std::string server_name;
+};
+
+// Makes the server issue the session tickets encrypted by the shared keys
+void SetUpSessionTickets(SSL_CTX* ctx, TlsSessionTicketKeys::Impl& keys);
+
+// Makes the client store the sessions issued by the server in the cache
+void SetUpClientSessionCache(SSL_CTX* ctx);
+
+// Binds the connection to the cache and offers the cached session, if any
+void AttachClientSession(SSL* ssl, TlsClientSessionContext& context);
+
+bool IsEarlyDataAccepted(const SSL* ssl) noexcept;
+
+// Accounts a completed handshake
+void AccountHandshake(const SSL* ssl, TlsHandshakeStatistics& stats, bool is_early_data_sent) noexcept;
+
+}  // namespace impl
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
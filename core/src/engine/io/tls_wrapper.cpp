@@ -1,6 +1,7 @@
 #include <userver/engine/io/tls_wrapper.hpp>
 
 #include <boost/stacktrace/stacktrace.hpp>
+#include <cerrno>
 #include <exception>
 #include <memory>
 
@@ -10,11 +11,13 @@
 
 #include <userver/crypto/openssl.hpp>
 #include <userver/engine/io/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
 #include <crypto/helpers.hpp>
 #include <engine/io/fd_control.hpp>
+#include <engine/io/tls_session_impl.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -60,15 +63,77 @@ struct SocketBioData {
     Socket socket;
     Deadline current_deadline;
     std::exception_ptr last_exception;
+
+    // Regular OpenSSL socket BIO over the same fd, only set when the kernel TLS
+    // offload is requested. OpenSSL hands the session keys to the kernel
+    // through it, and the offloaded directions have to use it for the I/O of
+    // TLS control records.
+    Bio kernel_bio;
+    bool kernel_ctrl_msg_pending{false};
 };
 
+// BIO_ctrl commands used by OpenSSL 3 to set up and query the kernel TLS, some
+// of them are not exported in public headers
+constexpr int kBioCtrlSetKtls = 72;
+constexpr int kBioCtrlGetKtlsSend = 73;
+constexpr int kBioCtrlSetKtlsTxSendCtrlMsg = 74;
+constexpr int kBioCtrlClearKtlsTxCtrlMsg = 75;
+constexpr int kBioCtrlGetKtlsRecv = 76;
+
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+constexpr auto kKernelOffloadOption = SSL_OP_ENABLE_KTLS;
+#else
+constexpr decltype(SSL_OP_ALL) kKernelOffloadOption = 0;
+#endif
+
+bool IsKernelSendEnabled(const SocketBioData& bio_data) noexcept {
+    return bio_data.kernel_bio && BIO_ctrl(bio_data.kernel_bio.get(), kBioCtrlGetKtlsSend, 0, nullptr) > 0;
+}
+
+bool IsKernelRecvEnabled(const SocketBioData& bio_data) noexcept {
+    return bio_data.kernel_bio && BIO_ctrl(bio_data.kernel_bio.get(), kBioCtrlGetKtlsRecv, 0, nullptr) > 0;
+}
+
+// The kernel BIO knows nothing about the coroutine engine, so we wait for the
+// socket readiness ourselves
+template <typename BioIoFunc, typename Buffer>
+size_t KernelBioIo(SocketBioData& bio_data, BioIoFunc&& io_func, Buffer data, size_t len, bool is_read) {
+    auto* bio = bio_data.kernel_bio.get();
+    UASSERT(bio);
+    while (true) {
+        size_t transferred = 0;
+        if (1 == io_func(bio, data, len, &transferred)) return transferred;
+
+        if (!BIO_should_retry(bio)) {
+            if (is_read && BIO_eof(bio)) return 0;
+            throw IoSystemError(errno, "TlsWrapper")
+                << "Kernel TLS " << (is_read ? "recv" : "send") << " failed, fd=" << bio_data.socket.Fd();
+        }
+
+        const bool is_ready = is_read ? bio_data.socket.WaitReadable(bio_data.current_deadline)
+                                      : bio_data.socket.WaitWriteable(bio_data.current_deadline);
+        if (!is_ready) {
+            if (current_task::ShouldCancel()) {
+                throw IoCancelled() << "Kernel TLS " << (is_read ? "recv" : "send");
+            }
+            throw IoTimeout() << "Kernel TLS " << (is_read ? "recv" : "send");
+        }
+    }
+}
+
 int SocketBioWriteEx(BIO* bio, const char* data, size_t len, size_t* bytes_written) noexcept {
     auto* bio_data = static_cast<SocketBioData*>(BIO_get_data(bio));
     UASSERT(bio_data);
     UASSERT(bytes_written);
 
     try {
-        *bytes_written = bio_data->socket.SendAll(data, len, bio_data->current_deadline);
+        if (bio_data->kernel_ctrl_msg_pending) {
+            // TLS alerts and handshake messages must be sent with a cmsg
+            *bytes_written = KernelBioIo(*bio_data, &BIO_write_ex, data, len, /*is_read=*/false);
+        } else {
+            // with the kernel TLS send offload the plaintext goes to the socket as is
+            *bytes_written = bio_data->socket.SendAll(data, len, bio_data->current_deadline);
+        }
         BIO_clear_retry_flags(bio);
         if (bio_data->last_exception) bio_data->last_exception = {};
         if (*bytes_written) return 1;  // success
@@ -88,7 +153,11 @@ int SocketBioReadEx(BIO* bio, char* data, size_t len, size_t* bytes_read) noexce
     UASSERT(bytes_read);
 
     try {
-        *bytes_read = bio_data->socket.RecvSome(data, len, bio_data->current_deadline);
+        if (IsKernelRecvEnabled(*bio_data)) {
+            *bytes_read = KernelBioIo(*bio_data, &BIO_read_ex, data, len, /*is_read=*/true);
+        } else {
+            *bytes_read = bio_data->socket.RecvSome(data, len, bio_data->current_deadline);
+        }
         BIO_clear_retry_flags(bio);
         if (bio_data->last_exception) bio_data->last_exception = {};
         if (*bytes_read) return 1;  // success
@@ -101,12 +170,32 @@ int SocketBioReadEx(BIO* bio, char* data, size_t len, size_t* bytes_read) noexce
     return 0;
 }
 
-long SocketBioControl(BIO*, int cmd, long, void*) noexcept {
-    if (cmd == BIO_CTRL_FLUSH) {
-        // ignore for Socket
-        return 1;
+long SocketBioControl(BIO* bio, int cmd, long num, void* ptr) noexcept {
+    switch (cmd) {
+        case BIO_CTRL_FLUSH:
+            // ignore for Socket
+            return 1;
+
+        case kBioCtrlSetKtls:
+        case kBioCtrlGetKtlsSend:
+        case kBioCtrlGetKtlsRecv:
+        case kBioCtrlSetKtlsTxSendCtrlMsg:
+        case kBioCtrlClearKtlsTxCtrlMsg: {
+            auto* bio_data = static_cast<SocketBioData*>(BIO_get_data(bio));
+            UASSERT(bio_data);
+            if (!bio_data->kernel_bio) return 0;
+
+            if (cmd == kBioCtrlSetKtlsTxSendCtrlMsg) {
+                bio_data->kernel_ctrl_msg_pending = true;
+            } else if (cmd == kBioCtrlClearKtlsTxCtrlMsg) {
+                bio_data->kernel_ctrl_msg_pending = false;
+            }
+            return BIO_ctrl(bio_data->kernel_bio.get(), cmd, num, ptr);
+        }
+
+        default:
+            return 0;
     }
-    return 0;
 }
 
 #if OPENSSL_VERSION_NUMBER >= 0x010100000L
@@ -190,7 +279,7 @@ int SSL_write_ex(SSL* ssl, const void* data, size_t len, size_t* bytes_written)
 }
 #endif
 
-SslCtx MakeSslCtx() {
+SslCtx MakeSslCtx(TlsWrapper::KernelOffload kernel_offload) {
     crypto::Openssl::Init();
 
     SslCtx ssl_ctx{SSL_CTX_new(SSLv23_method())};
@@ -215,6 +304,14 @@ SslCtx MakeSslCtx() {
         LOG_LIMITED_WARNING() << crypto::FormatSslError("Failed create an SSL context: SSL_CTX_set_default_verify_paths"
         );
     }
+
+    if (kernel_offload == TlsWrapper::KernelOffload::kEnabled) {
+        if (kKernelOffloadOption) {
+            SSL_CTX_set_options(ssl_ctx.get(), kKernelOffloadOption);
+        } else {
+            LOG_LIMITED_WARNING() << "Kernel TLS offload is requested, but OpenSSL is built without it";
+        }
+    }
     return ssl_ctx;
 }
 
@@ -276,6 +373,7 @@ public:
 
     Impl(Impl&& other) noexcept
         : bio_data(std::move(other.bio_data)),
+          client_session(std::move(other.client_session)),
           ssl(std::move(other.ssl)),
           read_accessor(*this),
           is_in_shutdown(other.is_in_shutdown) {
@@ -285,6 +383,13 @@ public:
     }
 
     void SetUp(SslCtx&& ssl_ctx) {
+        if (SSL_CTX_get_options(ssl_ctx.get()) & kKernelOffloadOption) {
+            bio_data.kernel_bio.reset(BIO_new_socket(bio_data.socket.Fd(), BIO_NOCLOSE));
+            if (!bio_data.kernel_bio) {
+                throw TlsException(crypto::FormatSslError("Failed to set up TLS wrapper: BIO_new_socket"));
+            }
+        }
+
         Bio socket_bio{BIO_new(GetSocketBioMethod())};
         if (!socket_bio) {
             throw TlsException(crypto::FormatSslError("Failed to set up TLS wrapper: BIO_new"));
@@ -304,7 +409,8 @@ public:
         [[maybe_unused]] const auto* disowned_bio = socket_bio.release();
     }
 
-    void ClientConnect(const std::string& server_name, Deadline deadline) {
+    // Returns whether the early data was sent
+    bool ClientConnect(const std::string& server_name, Deadline deadline, std::string_view early_data = {}) {
         if (!server_name.empty()) {
             // cast in openssl1.0 macro expansion
             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
@@ -317,6 +423,8 @@ public:
 
         bio_data.current_deadline = deadline;
 
+        const bool is_early_data_sent = !early_data.empty() && WriteEarlyData(early_data);
+
         auto ret = SSL_connect(ssl.get());
         if (1 != ret) {
             if (bio_data.last_exception) {
@@ -327,6 +435,35 @@ public:
                 fmt::format("Failed to set up client TLS wrapper ({})", SSL_get_error(ssl.get(), ret))
             ));
         }
+        return is_early_data_sent;
+    }
+
+    // Returns false if the session does not allow the early data
+    bool WriteEarlyData([[maybe_unused]] std::string_view data) {
+#if OPENSSL_VERSION_NUMBER >= 0x010101000L
+        const auto* session = SSL_get0_session(ssl.get());
+        if (!session || !SSL_SESSION_is_resumable(session) || SSL_SESSION_get_max_early_data(session) < data.size()) {
+            return false;
+        }
+
+        while (!data.empty()) {
+            std::size_t written = 0;
+            const auto ret = SSL_write_early_data(ssl.get(), data.data(), data.size(), &written);
+            if (1 != ret) {
+                if (bio_data.last_exception) {
+                    std::rethrow_exception(bio_data.last_exception);
+                }
+
+                throw TlsException(crypto::FormatSslError(
+                    fmt::format("Failed to send TLS early data ({})", SSL_get_error(ssl.get(), ret))
+                ));
+            }
+            data.remove_prefix(written);
+        }
+        return true;
+#else
+        return false;
+#endif
     }
 
     template <typename SslIoFunc>
@@ -410,6 +547,8 @@ public:
     }
 
     SocketBioData bio_data;
+    // must outlive the ssl
+    std::unique_ptr<impl::TlsClientSessionContext> client_session;
     Ssl ssl;
     ReadContextAccessor read_accessor;
     bool is_in_shutdown{false};
@@ -453,8 +592,13 @@ engine::impl::ContextAccessor& TlsWrapper::ReadContextAccessor::GetSocketContext
 
 TlsWrapper::TlsWrapper(Socket&& socket) : impl_(std::move(socket)) { SetupContextAccessors(); }
 
-TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket, const std::string& server_name, Deadline deadline) {
-    auto ssl_ctx = MakeSslCtx();
+TlsWrapper TlsWrapper::StartTlsClient(
+    Socket&& socket,
+    const std::string& server_name,
+    Deadline deadline,
+    KernelOffload kernel_offload
+) {
+    auto ssl_ctx = MakeSslCtx(kernel_offload);
     SetServerName(ssl_ctx, server_name);
 
     TlsWrapper wrapper{std::move(socket)};
@@ -463,15 +607,40 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket, const std::string& server
     return wrapper;
 }
 
+TlsWrapper TlsWrapper::StartTlsClient(
+    Socket&& socket,
+    const std::string& server_name,
+    TlsClientSessionCache& session_cache,
+    Deadline deadline,
+    std::string_view early_data,
+    KernelOffload kernel_offload
+) {
+    auto ssl_ctx = MakeSslCtx(kernel_offload);
+    SetServerName(ssl_ctx, server_name);
+    impl::SetUpClientSessionCache(ssl_ctx.get());
+
+    auto& cache = *session_cache.impl_;
+    TlsWrapper wrapper{std::move(socket)};
+    wrapper.impl_->SetUp(std::move(ssl_ctx));
+    wrapper.impl_->client_session =
+        std::make_unique<impl::TlsClientSessionContext>(impl::TlsClientSessionContext{cache, server_name});
+    impl::AttachClientSession(wrapper.impl_->ssl.get(), *wrapper.impl_->client_session);
+
+    const bool is_early_data_sent = wrapper.impl_->ClientConnect(server_name, deadline, early_data);
+    impl::AccountHandshake(wrapper.impl_->ssl.get(), cache.stats, is_early_data_sent);
+    return wrapper;
+}
+
 TlsWrapper TlsWrapper::StartTlsClient(
     Socket&& socket,
     const std::string& server_name,
     const crypto::Certificate& cert,
     const crypto::PrivateKey& key,
     Deadline deadline,
-    const std::vector<crypto::Certificate>& extra_cert_authorities
+    const std::vector<crypto::Certificate>& extra_cert_authorities,
+    KernelOffload kernel_offload
 ) {
-    auto ssl_ctx = MakeSslCtx();
+    auto ssl_ctx = MakeSslCtx(kernel_offload);
     SetServerName(ssl_ctx, server_name);
 
     if (!extra_cert_authorities.empty()) {
@@ -501,9 +670,12 @@ TlsWrapper TlsWrapper::StartTlsServer(
     const crypto::CertificatesChain& cert_chain,
     const crypto::PrivateKey& key,
     Deadline deadline,
-    const std::vector<crypto::Certificate>& extra_cert_authorities
+    const std::vector<crypto::Certificate>& extra_cert_authorities,
+    KernelOffload kernel_offload,
+    TlsSessionTicketKeys* session_ticket_keys
 ) {
-    auto ssl_ctx = MakeSslCtx();
+    auto ssl_ctx = MakeSslCtx(kernel_offload);
+    if (session_ticket_keys) impl::SetUpSessionTickets(ssl_ctx.get(), *session_ticket_keys->impl_);
 
     if (!extra_cert_authorities.empty()) {
         AddCertAuthorities(ssl_ctx, extra_cert_authorities);
@@ -558,6 +730,9 @@ TlsWrapper TlsWrapper::StartTlsServer(
     }
 
     UASSERT(wrapper.impl_->ssl);
+    if (session_ticket_keys) {
+        impl::AccountHandshake(wrapper.impl_->ssl.get(), session_ticket_keys->impl_->stats, false);
+    }
     return wrapper;
 }
 
@@ -611,6 +786,10 @@ size_t TlsWrapper::RecvAll(void* buf, size_t len, Deadline deadline) {
 
 size_t TlsWrapper::SendAll(const void* buf, size_t len, Deadline deadline) {
     impl_->CheckAlive();
+    if (IsKernelSendEnabled(impl_->bio_data)) {
+        // the kernel encrypts the data, no need to go through the SSL_write
+        return impl_->bio_data.socket.SendAll(buf, len, deadline);
+    }
     return impl_->PerformSslIo(
         &SSL_write_ex,
         const_cast<void*>(buf),  // NOLINT(cppcoreguidelines-pro-type-const-cast)
@@ -665,6 +844,20 @@ size_t TlsWrapper::SendAll(const void* buf, size_t len, Deadline deadline) {
     return sent_bytes;
 }
 
+bool TlsWrapper::IsSessionReused() const { return impl_->ssl && SSL_session_reused(impl_->ssl.get()); }
+
+bool TlsWrapper::IsEarlyDataAccepted() const { return impl_->ssl && impl::IsEarlyDataAccepted(impl_->ssl.get()); }
+
+bool TlsWrapper::IsSendOffloadedToKernel() const { return IsValid() && IsKernelSendEnabled(impl_->bio_data); }
+
+size_t TlsWrapper::SendFile(int file_fd, std::size_t offset, std::size_t len, Deadline deadline) {
+    impl_->CheckAlive();
+    if (!IsKernelSendEnabled(impl_->bio_data)) {
+        throw TlsException("SendFile requires the kernel TLS send offload");
+    }
+    return impl_->bio_data.socket.SendFile(file_fd, offset, len, deadline);
+}
+
 Socket TlsWrapper::StopTls(Deadline deadline) {
     if (impl_->ssl) {
         impl_->is_in_shutdown = true;
@@ -9,6 +9,7 @@
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/engine/io/tls_session.hpp>
 #include <userver/engine/io/tls_wrapper.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
@@ -376,6 +377,108 @@ UTEST_MT(TlsWrapper, Smoke, 2) {
     server_task.Get();
 }
 
+UTEST_MT(TlsWrapper, KernelOffload, 2) {
+    const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    TcpListener tcp_listener;
+    auto [server, client] = tcp_listener.MakeSocketPair(test_deadline);
+
+    // Works the same way regardless of whether the kernel TLS is available
+    const std::string payload(100'000, 'x');
+    auto server_task = engine::AsyncNoSpan(
+        [test_deadline, &payload](auto&& server) {
+            auto tls_server = io::TlsWrapper::StartTlsServer(
+                std::forward<decltype(server)>(server),
+                crypto::LoadCertficatesChainFromString(cert),
+                crypto::PrivateKey::LoadFromString(key),
+                test_deadline,
+                {},
+                io::TlsWrapper::KernelOffload::kEnabled
+            );
+            EXPECT_EQ(payload.size(), tls_server.SendAll(payload.data(), payload.size(), test_deadline));
+            char c = 0;
+            EXPECT_EQ(1, tls_server.RecvSome(&c, 1, test_deadline));
+            EXPECT_EQ('2', c);
+        },
+        std::move(server)
+    );
+
+    auto tls_client = io::TlsWrapper::StartTlsClient(
+        std::move(client), {}, test_deadline, io::TlsWrapper::KernelOffload::kEnabled
+    );
+    std::string received(payload.size(), '\0');
+    EXPECT_EQ(payload.size(), tls_client.RecvAll(received.data(), received.size(), test_deadline));
+    EXPECT_EQ(payload, received);
+    EXPECT_EQ(1, tls_client.SendAll("2", 1, test_deadline));
+
+    if (!tls_client.IsSendOffloadedToKernel()) {
+        UEXPECT_THROW([[maybe_unused]] auto sent = tls_client.SendFile(0, 0, 1, test_deadline), io::TlsException);
+    }
+
+    server_task.Get();
+}
+
+UTEST_MT(TlsWrapper, SessionResumption, 2) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    io::TlsSessionTicketKeys ticket_keys;
+    io::TlsClientSessionCache session_cache;
+    TcpListener tcp_listener;
+
+    const auto connect = [&] {
+        auto [server, client] = tcp_listener.MakeSocketPair(deadline);
+        auto server_task = engine::AsyncNoSpan(
+            [deadline, &ticket_keys](auto&& server) {
+                auto tls_server = io::TlsWrapper::StartTlsServer(
+                    std::forward<decltype(server)>(server),
+                    crypto::LoadCertficatesChainFromString(cert),
+                    crypto::PrivateKey::LoadFromString(key),
+                    deadline,
+                    {},
+                    io::TlsWrapper::KernelOffload::kDisabled,
+                    &ticket_keys
+                );
+                EXPECT_EQ(1, tls_server.SendAll("1", 1, deadline));
+                return tls_server.IsSessionReused();
+            },
+            std::move(server)
+        );
+
+        auto tls_client = io::TlsWrapper::StartTlsClient(std::move(client), {}, session_cache, deadline, "GET");
+        // The server does not accept 0-RTT data, so it is never sent
+        EXPECT_FALSE(tls_client.IsEarlyDataAccepted());
+
+        // TLS 1.3 session tickets arrive after the handshake
+        char c = 0;
+        EXPECT_EQ(1, tls_client.RecvSome(&c, 1, deadline));
+        EXPECT_EQ(server_task.Get(), tls_client.IsSessionReused());
+        return tls_client.IsSessionReused();
+    };
+
+    EXPECT_FALSE(connect());
+    EXPECT_EQ(1, session_cache.GetSize());
+    EXPECT_TRUE(connect());
+
+    // the tickets of the previous key are still accepted
+    ticket_keys.Rotate();
+    EXPECT_TRUE(connect());
+
+    ticket_keys.SetKeys({std::string(io::TlsSessionTicketKeys::kKeySize, 'k')});
+    EXPECT_FALSE(connect());
+    EXPECT_TRUE(connect());
+
+    UEXPECT_THROW(ticket_keys.SetKeys({"short"}), io::TlsException);
+    UEXPECT_THROW(ticket_keys.SetKeys({}), io::TlsException);
+
+    const auto& server_stats = ticket_keys.GetStatistics();
+    EXPECT_EQ(2, server_stats.full.Load().value);
+    EXPECT_EQ(3, server_stats.resumed.Load().value);
+
+    const auto& client_stats = session_cache.GetStatistics();
+    EXPECT_EQ(2, client_stats.full.Load().value);
+    EXPECT_EQ(3, client_stats.resumed.Load().value);
+    EXPECT_EQ(0, client_stats.early_data_accepted.Load().value + client_stats.early_data_rejected.Load().value);
+}
+
 UTEST_MT(TlsWrapper, DocTest, 2) {
     static constexpr std::string_view kData = "hello world";
     const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
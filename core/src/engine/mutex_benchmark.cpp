@@ -6,6 +6,7 @@
 #include <thread>
 #include <vector>
 
+#include <engine/impl/lock_spinning_benchmark.hpp>
 #include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/mutex.hpp>
@@ -121,6 +122,35 @@ void generic_contention_with_payload(benchmark::State& state) {
         benchmark::Counter(total_lock_unlock_count / state.range(0), benchmark::Counter::kIsRate);
 }
 
+// range(0) - threads, range(1) - critical section length,
+// range(2) - lock-spinning-iterations
+template <typename Mutex>
+void generic_spin_contention(benchmark::State& state) {
+    std::atomic<std::uint64_t> lock_unlock_count{0};
+    concurrent::impl::InterferenceShield<Mutex> m;
+    const auto critical_section_length = state.range(1);
+
+    RunParallelBenchmark(state, [&](auto& range) {
+        std::uint64_t local_lock_unlock_count = 0;
+
+        for ([[maybe_unused]] auto _ : range) {
+            m->lock();
+            for (std::int64_t i = 0; i < critical_section_length; ++i) {
+                benchmark::DoNotOptimize(utils::Rand());
+            }
+            m->unlock();
+            ++local_lock_unlock_count;
+        }
+
+        lock_unlock_count += local_lock_unlock_count;
+    });
+
+    const auto total_lock_unlock_count = static_cast<double>(lock_unlock_count.load());
+    state.counters["locks"] = benchmark::Counter(total_lock_unlock_count, benchmark::Counter::kIsRate);
+    state.counters["locks-per-thread"] =
+        benchmark::Counter(total_lock_unlock_count / state.range(0), benchmark::Counter::kIsRate);
+}
+
 //////// Benchmarks
 
 // Note: We intentionally do not run std::* benchmarks from RunStandalone to
@@ -169,6 +199,14 @@ void single_waiting_task_mutex_contention_with_payload(benchmark::State& state)
     });
 }
 
+void mutex_coro_spin_contention(benchmark::State& state) {
+    engine::impl::RunWithLockSpinning(state.range(0), state.range(2), [&] {
+        generic_spin_contention<engine::Mutex>(state);
+    });
+}
+
+void mutex_std_spin_contention(benchmark::State& state) { generic_spin_contention<std::mutex>(state); }
+
 }  // namespace
 
 BENCHMARK(mutex_coro_lock);
@@ -187,4 +225,7 @@ BENCHMARK(mutex_coro_contention_with_payload)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(mutex_std_contention_with_payload)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(single_waiting_task_mutex_contention_with_payload)->Range(1, 2);
 
+BENCHMARK(mutex_coro_spin_contention)->Ranges({{2, 8}, {0, 64}, {0, 1024}});
+BENCHMARK(mutex_std_spin_contention)->Ranges({{2, 8}, {0, 64}, {0, 0}});
+
 USERVER_NAMESPACE_END
@@ -1,7 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/reader_biased_shared_mutex.hpp>
 #include <userver/engine/shared_mutex.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/single_waiting_task_mutex.hpp>
@@ -144,6 +147,38 @@ TYPED_UTEST_P_MT(Mutex, NotifyAndDeadlineRace, 2) {
     }
 }
 
+template <typename MutexType>
+void TestLockSpinning() {
+    engine::TaskProcessorConfig config;
+    config.name = "lock-spinning";
+    config.worker_threads = kThreads;
+    config.lock_spinning_iterations = 1000;
+    engine::TaskProcessor task_processor{config, engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+    constexpr std::size_t kIterations = 10000;
+    MutexType mutex;
+    std::size_t counter = 0;
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i < kThreads; ++i) {
+        tasks.push_back(engine::AsyncNoSpan(task_processor, [&] {
+            for (std::size_t j = 0; j < kIterations; ++j) {
+                const std::lock_guard lock(mutex);
+                ++counter;
+            }
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    EXPECT_EQ(counter, kThreads * kIterations);
+}
+
+UTEST(Mutex, LockSpinning) {
+    TestLockSpinning<engine::Mutex>();
+    TestLockSpinning<engine::SharedMutex>();
+    TestLockSpinning<engine::ReaderBiasedSharedMutex>();
+}
+
 UTEST(Mutex, SampleMutex) {
     /// [Sample engine::Mutex usage]
     engine::Mutex mutex;
@@ -171,6 +206,7 @@ REGISTER_TYPED_UTEST_SUITE_P(
 
 INSTANTIATE_TYPED_UTEST_SUITE_P(EngineMutex, Mutex, engine::Mutex);
 INSTANTIATE_TYPED_UTEST_SUITE_P(EngineSharedMutex, Mutex, engine::SharedMutex);
+INSTANTIATE_TYPED_UTEST_SUITE_P(EngineReaderBiasedSharedMutex, Mutex, engine::ReaderBiasedSharedMutex);
 INSTANTIATE_TYPED_UTEST_SUITE_P(EngineSingleWaitingTaskMutex, Mutex, engine::SingleWaitingTaskMutex);
 
 USERVER_NAMESPACE_END
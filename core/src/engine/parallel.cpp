@@ -0,0 +1,66 @@
+#include <userver/engine/parallel.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::parallel::impl {
+
+namespace {
+
+// A few chunks per worker smooth out the uneven per-element costs, while
+// keeping the per-task overhead negligible
+constexpr std::size_t kChunksPerWorker = 4;
+
+void RunChunkRange(std::size_t begin, std::size_t end, utils::function_ref<void(std::size_t)> chunk_func) {
+    UASSERT(begin < end);
+
+    // Forks the right halves, so that the idle workers steal large pieces of
+    // work first, and the caller keeps splitting the left half
+    std::vector<engine::TaskWithResult<void>> forks;
+    while (end - begin > 1) {
+        const auto middle = begin + (end - begin) / 2;
+        forks.push_back(engine::AsyncNoSpan([middle, end, chunk_func] { RunChunkRange(middle, end, chunk_func); }));
+        end = middle;
+    }
+
+    chunk_func(begin);
+
+    // On an exception or on cancellation the remaining forks are cancelled
+    // and awaited in the destructor of `forks`, so `chunk_func` outlives them
+    engine::GetAll(forks);
+}
+
+}  // namespace
+
+std::size_t GetChunkCount(std::size_t size, const Settings& settings) {
+    UASSERT(size != 0);
+
+    std::size_t chunk_count = 0;
+    if (settings.grain_size != 0) {
+        chunk_count = (size + settings.grain_size - 1) / settings.grain_size;
+    } else {
+        const auto worker_count = engine::impl::GetWorkerCount(engine::current_task::GetTaskProcessor());
+        chunk_count = std::max(worker_count, std::size_t{1}) * kChunksPerWorker;
+    }
+    return std::clamp(chunk_count, std::size_t{1}, size);
+}
+
+void RunChunks(std::size_t chunk_count, utils::function_ref<void(std::size_t)> chunk_func) {
+    if (chunk_count == 0) return;
+    if (chunk_count == 1) {
+        chunk_func(0);
+        return;
+    }
+    RunChunkRange(0, chunk_count, chunk_func);
+}
+
+}  // namespace engine::parallel::impl
+
+USERVER_NAMESPACE_END
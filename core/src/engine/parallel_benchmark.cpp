@@ -0,0 +1,97 @@
+#include <userver/engine/parallel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/run_standalone.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWorkerThreads = 4;
+
+std::vector<double> MakeValues(std::size_t size) {
+    std::vector<double> values(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        values[i] = static_cast<double>((i * 7'919) % size);
+    }
+    return values;
+}
+
+double Work(double value) { return std::sqrt(value) * std::log1p(value); }
+
+void parallel_transform(benchmark::State& state) {
+    engine::RunStandalone(kWorkerThreads, [&] {
+        const auto values = MakeValues(state.range(0));
+        std::vector<double> result(values.size());
+        for ([[maybe_unused]] auto _ : state) {
+            engine::parallel::Transform(values.begin(), values.end(), result.begin(), Work);
+            benchmark::DoNotOptimize(result.data());
+        }
+    });
+}
+
+void sequential_transform(benchmark::State& state) {
+    const auto values = MakeValues(state.range(0));
+    std::vector<double> result(values.size());
+    for ([[maybe_unused]] auto _ : state) {
+        std::transform(values.begin(), values.end(), result.begin(), Work);
+        benchmark::DoNotOptimize(result.data());
+    }
+}
+
+void parallel_reduce(benchmark::State& state) {
+    engine::RunStandalone(kWorkerThreads, [&] {
+        const auto values = MakeValues(state.range(0));
+        for ([[maybe_unused]] auto _ : state) {
+            benchmark::DoNotOptimize(engine::parallel::Reduce(values.begin(), values.end(), 0.0));
+        }
+    });
+}
+
+void sequential_reduce(benchmark::State& state) {
+    const auto values = MakeValues(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(std::reduce(values.begin(), values.end(), 0.0));
+    }
+}
+
+void parallel_sort(benchmark::State& state) {
+    engine::RunStandalone(kWorkerThreads, [&] {
+        const auto values = MakeValues(state.range(0));
+        for ([[maybe_unused]] auto _ : state) {
+            state.PauseTiming();
+            auto copy = values;
+            state.ResumeTiming();
+            engine::parallel::Sort(copy.begin(), copy.end());
+            benchmark::DoNotOptimize(copy.data());
+        }
+    });
+}
+
+void sequential_sort(benchmark::State& state) {
+    const auto values = MakeValues(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        state.PauseTiming();
+        auto copy = values;
+        state.ResumeTiming();
+        std::sort(copy.begin(), copy.end());
+        benchmark::DoNotOptimize(copy.data());
+    }
+}
+
+}  // namespace
+
+BENCHMARK(parallel_transform)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(sequential_transform)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(parallel_reduce)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(sequential_reduce)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(parallel_sort)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(sequential_sort)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,131 @@
+#include <userver/engine/parallel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kSize = 10'007;
+
+std::vector<int> MakeShuffled() {
+    std::vector<int> values(kSize);
+    for (std::size_t i = 0; i < kSize; ++i) {
+        values[i] = static_cast<int>((i * 7'919) % kSize);
+    }
+    return values;
+}
+
+}  // namespace
+
+UTEST_MT(Parallel, ForEach, 4) {
+    std::vector<int> values(kSize, 1);
+    engine::parallel::ForEach(values.begin(), values.end(), [](int& value) { value *= 2; });
+    EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0), 2 * static_cast<int>(kSize));
+}
+
+UTEST_MT(Parallel, ForEachGrainSize, 4) {
+    std::atomic<std::size_t> calls{0};
+    std::vector<int> values(kSize);
+    engine::parallel::ForEach(
+        values.begin(), values.end(), [&calls](int&) { ++calls; }, engine::parallel::Settings{1}
+    );
+    EXPECT_EQ(calls, kSize);
+}
+
+UTEST_MT(Parallel, Transform, 4) {
+    const auto values = MakeShuffled();
+    std::vector<std::string> result(values.size());
+    const auto end = engine::parallel::Transform(values.begin(), values.end(), result.begin(), [](int value) {
+        return std::to_string(value);
+    });
+
+    EXPECT_EQ(end, result.end());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(result[i], std::to_string(values[i]));
+    }
+}
+
+UTEST_MT(Parallel, Reduce, 4) {
+    const auto values = MakeShuffled();
+    EXPECT_EQ(
+        engine::parallel::Reduce(values.begin(), values.end(), std::int64_t{5}),
+        std::accumulate(values.begin(), values.end(), std::int64_t{5})
+    );
+
+    const std::vector<int> empty;
+    EXPECT_EQ(engine::parallel::Reduce(empty.begin(), empty.end(), 42), 42);
+}
+
+UTEST_MT(Parallel, ReduceKeepsOrder, 4) {
+    std::vector<std::string> values(kSize);
+    for (std::size_t i = 0; i < kSize; ++i) values[i] = std::string(1, static_cast<char>('a' + i % 26));
+
+    const auto expected = std::accumulate(values.begin(), values.end(), std::string{">"});
+    EXPECT_EQ(
+        engine::parallel::Reduce(
+            values.begin(), values.end(), std::string{">"}, std::plus<>{}, engine::parallel::Settings{100}
+        ),
+        expected
+    );
+}
+
+UTEST_MT(Parallel, Sort, 4) {
+    for (const auto grain_size : std::initializer_list<std::size_t>{0, 1, 3, 1000, kSize}) {
+        auto values = MakeShuffled();
+        engine::parallel::Sort(values.begin(), values.end(), std::greater<>{}, engine::parallel::Settings{grain_size});
+        EXPECT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<>{})) << grain_size;
+        EXPECT_EQ(values.front(), static_cast<int>(kSize - 1));
+    }
+}
+
+UTEST_MT(Parallel, Exception, 4) {
+    std::vector<int> values(kSize);
+    std::iota(values.begin(), values.end(), 0);
+    UEXPECT_THROW_MSG(
+        engine::parallel::ForEach(
+            values.begin(),
+            values.end(),
+            [](int value) {
+                if (value == static_cast<int>(kSize / 2)) throw std::runtime_error("test");
+            }
+        ),
+        std::runtime_error,
+        "test"
+    );
+}
+
+UTEST_MT(Parallel, Cancellation, 4) {
+    std::vector<int> values(kSize);
+    std::atomic<std::size_t> calls{0};
+
+    engine::current_task::GetCancellationToken().RequestCancel();
+    UEXPECT_THROW(
+        engine::parallel::ForEach(
+            values.begin(),
+            values.end(),
+            [&calls](int) {
+                ++calls;
+                engine::SleepFor(std::chrono::milliseconds{1});
+            },
+            engine::parallel::Settings{1}
+        ),
+        engine::WaitInterruptedException
+    );
+    EXPECT_LT(calls, kSize);
+}
+
+USERVER_NAMESPACE_END
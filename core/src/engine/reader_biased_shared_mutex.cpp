@@ -0,0 +1,103 @@
+#include <userver/engine/reader_biased_shared_mutex.hpp>
+
+#include <mutex>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+ReaderBiasedSharedMutex::ReaderBiasedSharedMutex() = default;
+
+ReaderBiasedSharedMutex::~ReaderBiasedSharedMutex() = default;
+
+void ReaderBiasedSharedMutex::lock() {
+    const auto ok = try_lock_until(Deadline{});
+    UASSERT(ok);
+}
+
+void ReaderBiasedSharedMutex::unlock() {
+    writer_active_.store(false, std::memory_order_release);
+    writer_mutex_.unlock();
+}
+
+bool ReaderBiasedSharedMutex::try_lock() {
+    if (!writer_mutex_.try_lock()) return false;
+    if (WaitForReaders(Deadline::Passed())) return true;
+    unlock();
+    return false;
+}
+
+bool ReaderBiasedSharedMutex::try_lock_until(Deadline deadline) {
+    if (!writer_mutex_.try_lock_until(deadline)) return false;
+    if (WaitForReaders(deadline)) return true;
+    unlock();
+    return false;
+}
+
+void ReaderBiasedSharedMutex::lock_shared() {
+    if (TryLockSharedFast()) return;
+
+    // No writer is active while we hold the writer_mutex_, the next one is
+    // going to see our lock
+    const std::lock_guard lock(writer_mutex_);
+    readers_.LockManually();
+}
+
+void ReaderBiasedSharedMutex::unlock_shared() {
+    readers_.UnlockManually();
+
+    // Pairs with the fence in WaitForReaders: either the writer sees that
+    // we are gone, or we see the writer and wake it up
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (writer_active_.load(std::memory_order_relaxed)) readers_left_.Send();
+}
+
+bool ReaderBiasedSharedMutex::try_lock_shared() {
+    if (TryLockSharedFast()) return true;
+    if (!writer_mutex_.try_lock()) return false;
+
+    readers_.LockManually();
+    writer_mutex_.unlock();
+    return true;
+}
+
+bool ReaderBiasedSharedMutex::try_lock_shared_until(Deadline deadline) {
+    if (TryLockSharedFast()) return true;
+    if (!writer_mutex_.try_lock_until(deadline)) return false;
+
+    readers_.LockManually();
+    writer_mutex_.unlock();
+    return true;
+}
+
+bool ReaderBiasedSharedMutex::TryLockSharedFast() noexcept {
+    if (writer_active_.load(std::memory_order_relaxed)) return false;
+
+    readers_.LockManually();
+    // Pairs with the fence in WaitForReaders: either the writer sees our lock,
+    // or we see the writer and step back
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!writer_active_.load(std::memory_order_acquire)) return true;
+
+    unlock_shared();
+    return false;
+}
+
+bool ReaderBiasedSharedMutex::WaitForReaders(Deadline deadline) {
+    writer_active_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    TaskCancellationBlocker blocker;
+    while (!readers_.IsFree()) {
+        // A signal from the previous writer's readers is a spurious wakeup
+        if (!readers_left_.WaitForEventUntil(deadline)) return readers_.IsFree();
+    }
+    return true;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
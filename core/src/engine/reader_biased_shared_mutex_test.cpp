@@ -0,0 +1,87 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <shared_mutex>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/reader_biased_shared_mutex.hpp>
+#include <userver/engine/sleep.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(ReaderBiasedSharedMutex, SharedLockParallel) {
+    engine::ReaderBiasedSharedMutex mutex;
+
+    std::shared_lock first(mutex);
+    auto second = engine::AsyncNoSpan([&mutex] { return !!std::shared_lock(mutex, std::try_to_lock); });
+    EXPECT_TRUE(second.Get());
+}
+
+UTEST(ReaderBiasedSharedMutex, WriterWaitsForReaders) {
+    engine::ReaderBiasedSharedMutex mutex;
+
+    std::shared_lock lock(mutex);
+    auto writer = engine::AsyncNoSpan([&mutex] { const std::unique_lock lock(mutex); });
+
+    writer.WaitFor(std::chrono::milliseconds(50));
+    EXPECT_FALSE(writer.IsFinished());
+
+    lock.unlock();
+    UEXPECT_NO_THROW(writer.Get());
+}
+
+UTEST(ReaderBiasedSharedMutex, ReadersWaitForWriter) {
+    engine::ReaderBiasedSharedMutex mutex;
+
+    std::unique_lock lock(mutex);
+    EXPECT_FALSE(engine::AsyncNoSpan([&mutex] { return !!std::shared_lock(mutex, std::try_to_lock); }).Get());
+    EXPECT_FALSE(engine::AsyncNoSpan([&mutex] {
+                     return !!std::shared_lock(mutex, std::chrono::milliseconds(10));
+                 }).Get());
+
+    auto reader = engine::AsyncNoSpan([&mutex] { const std::shared_lock lock(mutex); });
+    reader.WaitFor(std::chrono::milliseconds(50));
+    EXPECT_FALSE(reader.IsFinished());
+
+    lock.unlock();
+    UEXPECT_NO_THROW(reader.Get());
+}
+
+UTEST(ReaderBiasedSharedMutex, TryLockTimesOutOnReaders) {
+    engine::ReaderBiasedSharedMutex mutex;
+
+    std::shared_lock lock(mutex);
+    EXPECT_FALSE(engine::AsyncNoSpan([&mutex] { return mutex.try_lock_for(std::chrono::milliseconds(10)); }).Get());
+
+    // The failed writer must not keep the new readers away
+    EXPECT_TRUE(engine::AsyncNoSpan([&mutex] { return !!std::shared_lock(mutex, std::try_to_lock); }).Get());
+}
+
+UTEST_MT(ReaderBiasedSharedMutex, Consistency, 4) {
+    constexpr std::size_t kReaders = 3;
+    engine::ReaderBiasedSharedMutex mutex;
+    std::uint64_t first = 0;
+    std::uint64_t second = 0;
+    std::atomic<bool> keep_running{true};
+
+    std::vector<engine::TaskWithResult<void>> readers;
+    for (std::size_t i = 0; i < kReaders; ++i) {
+        readers.push_back(engine::AsyncNoSpan([&] {
+            while (keep_running) {
+                const std::shared_lock lock(mutex);
+                ASSERT_EQ(first, second);
+            }
+        }));
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        const std::unique_lock lock(mutex);
+        ++first;
+        ++second;
+    }
+    keep_running = false;
+    for (auto& reader : readers) reader.Get();
+}
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <engine/impl/lock_spinning.hpp>
 #include <engine/impl/wait_list.hpp>
 #include <engine/task/task_context.hpp>
 
@@ -150,6 +151,17 @@ bool CancellableSemaphore::LockSlowPath(Deadline deadline, const Counter count)
     UASSERT(count > 0);
 
     auto& current = current_task::GetCurrentTaskContext();
+
+    auto spin_status = TryLockStatus::kTransientFailure;
+    const auto try_lock = [this, count, &spin_status] {
+        spin_status = DoTryLock(count);
+        return spin_status != TryLockStatus::kTransientFailure;
+    };
+    const auto no_sleepers = [this] { return lock_waiters_->GetCountOfSleepies() == 0; };
+    if (impl::SpinTryLock(current, deadline, try_lock, no_sleepers)) {
+        return spin_status == TryLockStatus::kSuccess;
+    }
+
     SemaphoreWaitStrategy wait_strategy{current, *this, count};
 
     while (true) {
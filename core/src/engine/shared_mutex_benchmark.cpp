@@ -1,16 +1,24 @@
 #include <benchmark/benchmark.h>
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+
+#include <engine/impl/lock_spinning_benchmark.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/reader_biased_shared_mutex.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/shared_mutex.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+template <typename SharedMutex>
 void shared_mutex_benchmark(benchmark::State& state) {
     engine::RunStandalone(state.range(0), [&] {
         int variable = 0;
-        engine::SharedMutex mutex;
+        SharedMutex mutex;
 
         auto initial_lock_holder = engine::AsyncNoSpan([&] {
             // ensure the locks are actually needed
@@ -26,6 +34,46 @@ void shared_mutex_benchmark(benchmark::State& state) {
         });
     });
 }
-BENCHMARK(shared_mutex_benchmark)->DenseRange(1, 6);
+// The readers on 64 threads bounce the cache line of a shared reader counter
+BENCHMARK_TEMPLATE(shared_mutex_benchmark, engine::SharedMutex)->DenseRange(1, 6)->Arg(64);
+BENCHMARK_TEMPLATE(shared_mutex_benchmark, engine::ReaderBiasedSharedMutex)->DenseRange(1, 6)->Arg(64);
+
+// range(0) - threads, range(1) - critical section length,
+// range(2) - lock-spinning-iterations; every 8th lock is a writer one
+template <typename SharedMutex>
+void shared_mutex_spin_contention(benchmark::State& state) {
+    engine::impl::RunWithLockSpinning(state.range(0), state.range(2), [&] {
+        std::atomic<std::uint64_t> lock_count{0};
+        SharedMutex mutex;
+        std::uint64_t variable = 0;
+        const auto critical_section_length = state.range(1);
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            std::uint64_t local_lock_count = 0;
+
+            for ([[maybe_unused]] auto _ : range) {
+                if (++local_lock_count % 8 == 0) {
+                    const std::unique_lock lock(mutex);
+                    for (std::int64_t i = 0; i < critical_section_length; ++i) {
+                        benchmark::DoNotOptimize(++variable);
+                    }
+                } else {
+                    const std::shared_lock lock(mutex);
+                    for (std::int64_t i = 0; i < critical_section_length; ++i) {
+                        benchmark::DoNotOptimize(variable);
+                    }
+                }
+            }
+
+            lock_count += local_lock_count;
+        });
+
+        state.counters["locks"] =
+            benchmark::Counter(static_cast<double>(lock_count.load()), benchmark::Counter::kIsRate);
+    });
+}
+BENCHMARK_TEMPLATE(shared_mutex_spin_contention, engine::SharedMutex)->Ranges({{2, 8}, {0, 64}, {0, 1024}});
+BENCHMARK_TEMPLATE(shared_mutex_spin_contention, engine::ReaderBiasedSharedMutex)
+    ->Ranges({{2, 8}, {0, 64}, {0, 1024}});
 
 USERVER_NAMESPACE_END
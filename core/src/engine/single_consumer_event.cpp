@@ -65,6 +65,16 @@ void SingleConsumerEvent::Send() { waiters_->SetSignalAndWakeupOne(); }
 
 bool SingleConsumerEvent::IsReady() const noexcept { return waiters_->IsSignaled(); }
 
+impl::EarlyWakeup SingleConsumerEvent::TryAppendWaiter(impl::TaskContext& waiter) {
+    return impl::EarlyWakeup{waiters_->GetSignalOrAppend(&waiter)};
+}
+
+void SingleConsumerEvent::RemoveWaiter(impl::TaskContext& waiter) noexcept { waiters_->Remove(waiter); }
+
+void SingleConsumerEvent::RethrowErrorResult() const {}
+
+void SingleConsumerEvent::AfterWait() noexcept {}
+
 bool SingleConsumerEvent::GetIsSignaled() noexcept {
     if (is_auto_reset_) {
         return waiters_->GetAndResetSignal();
@@ -38,6 +38,10 @@ void SleepUntil(Deadline deadline) {
 
 void Yield() { SleepUntil(Deadline::Passed()); }
 
+void MaybeYield() {
+    if (current_task::GetCurrentTaskContext().IsTimeSliceExhausted()) Yield();
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
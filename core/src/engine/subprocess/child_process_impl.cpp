@@ -14,6 +14,13 @@ namespace engine::subprocess {
 ChildProcessImpl::ChildProcessImpl(int pid, Future<ChildProcessStatus>&& status_future)
     : pid_(pid), status_future_(std::move(status_future)) {}
 
+ChildProcessImpl::ChildProcessImpl(
+    int pid,
+    Future<ChildProcessStatus>&& status_future,
+    std::unique_ptr<ChildProcessPipes> pipes
+)
+    : pid_(pid), status_future_(std::move(status_future)), pipes_(std::move(pipes)) {}
+
 void ChildProcessImpl::WaitNonCancellable() {
     TaskCancellationBlocker cancel_blocker;
     const auto status = status_future_.wait();
@@ -32,6 +39,18 @@ ChildProcessStatus ChildProcessImpl::Get() {
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void ChildProcessImpl::SendSignal(int signum) { utils::CheckSyscall(kill(pid_, signum), "kill, pid={}", pid_); }
 
+io::PipeWriter* ChildProcessImpl::GetStdin() noexcept {
+    return pipes_ && pipes_->stdin_pipe ? &*pipes_->stdin_pipe : nullptr;
+}
+
+io::PipeReader* ChildProcessImpl::GetStdout() noexcept {
+    return pipes_ && pipes_->stdout_pipe ? &*pipes_->stdout_pipe : nullptr;
+}
+
+io::PipeReader* ChildProcessImpl::GetStderr() noexcept {
+    return pipes_ && pipes_->stderr_pipe ? &*pipes_->stderr_pipe : nullptr;
+}
+
 }  // namespace engine::subprocess
 
 USERVER_NAMESPACE_END
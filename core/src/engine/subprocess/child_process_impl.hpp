@@ -1,19 +1,31 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
+#include <optional>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/subprocess/child_process_status.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::subprocess {
 
+/// Parent ends of the pipes connected to the standard streams of a child
+struct ChildProcessPipes final {
+    std::optional<io::PipeWriter> stdin_pipe;
+    std::optional<io::PipeReader> stdout_pipe;
+    std::optional<io::PipeReader> stderr_pipe;
+};
+
 class ChildProcessImpl {
 public:
     ChildProcessImpl(int pid, Future<ChildProcessStatus>&& status_future);
 
+    ChildProcessImpl(int pid, Future<ChildProcessStatus>&& status_future, std::unique_ptr<ChildProcessPipes> pipes);
+
     int GetPid() const { return pid_; }
 
     void WaitNonCancellable();
@@ -24,9 +36,15 @@ public:
 
     void SendSignal(int signum);
 
+    io::PipeWriter* GetStdin() noexcept;
+    io::PipeReader* GetStdout() noexcept;
+    io::PipeReader* GetStderr() noexcept;
+
 private:
     int pid_;
     Future<ChildProcessStatus> status_future_;
+    // Allocated only if some of the pipes were requested
+    std::unique_ptr<ChildProcessPipes> pipes_;
 };
 
 }  // namespace engine::subprocess
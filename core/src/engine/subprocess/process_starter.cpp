@@ -1,13 +1,16 @@
 #include <userver/engine/subprocess/process_starter.hpp>
 
+#include <fcntl.h>
+#include <pthread.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
+#include <array>
 #include <csignal>
-#include <cstdio>
-#include <cstring>
-#include <iostream>
+#include <cstdlib>
+#include <memory>
+#include <string_view>
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
@@ -19,69 +22,194 @@
 #include <engine/subprocess/child_process_impl.hpp>
 #include <engine/task/task_processor.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <utils/check_syscall.hpp>
 
-extern char** environ;
-
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::subprocess {
 namespace {
 
-void DoExec(
+// The same default as in execvp()
+constexpr std::string_view kDefaultPath = "/bin:/usr/bin";
+
+constexpr std::size_t kStdioFdsCount = 3;
+
+// Everything the child needs is prepared by the parent, the child only does
+// async-signal-safe syscalls as it shares the memory with the parent after
+// vfork()
+struct ExecData final {
+    std::vector<std::string> executable_candidates;
+    std::vector<char*> argv;
+    std::vector<std::string> envp_buf;
+    std::vector<char*> envp;
+    const char* stdout_file{nullptr};
+    const char* stderr_file{nullptr};
+    // Child ends of the pipes to become stdin, stdout and stderr
+    std::array<int, kStdioFdsCount> stdio_fds{io::kInvalidFd, io::kInvalidFd, io::kInvalidFd};
+    sigset_t parent_sigmask{};
+};
+
+// Paths that execvp() would try for `executable_path`, resolved with the PATH
+// of the child environment
+std::vector<std::string> MakeExecutableCandidates(
     const std::string& executable_path,
-    const std::vector<std::string>& args,
     const EnvironmentVariables& env,
-    const std::optional<std::string>& stdout_file,
-    const std::optional<std::string>& stderr_file,
     bool use_path
 ) {
-    if (stdout_file) {
-        if (!std::freopen(stdout_file->c_str(), "a", stdout)) {
-            utils::CheckSyscall(-1, "freopen stdout to {}", *stdout_file);
-        }
-    }
-    if (stderr_file) {
-        if (!std::freopen(stderr_file->c_str(), "a", stderr)) {
-            utils::CheckSyscall(-1, "freopen stderr to {}", *stdout_file);
-        }
+    if (!use_path || executable_path.find('/') != std::string::npos) return {executable_path};
+
+    const auto* path = env.GetValueOptional("PATH");
+    std::string_view dirs = path ? std::string_view{*path} : kDefaultPath;
+
+    std::vector<std::string> candidates;
+    while (true) {
+        const auto pos = dirs.find(':');
+        const auto dir = dirs.substr(0, pos);
+        // An empty entry means the current directory
+        candidates.push_back(dir.empty() ? executable_path : utils::StrCat(dir, "/", executable_path));
+        if (pos == std::string_view::npos) break;
+        dirs.remove_prefix(pos + 1);
     }
-    std::vector<char*> argv_ptrs;
-    std::vector<std::string> envp_buf;
-    std::vector<char*> envp_ptrs;
-    argv_ptrs.reserve(args.size() + 2);
-    envp_buf.reserve(env.size());
-    envp_ptrs.reserve(env.size() + 1);
+    return candidates;
+}
+
+void FillArgsAndEnv(
+    ExecData& data,
+    const std::string& executable_path,
+    const std::vector<std::string>& args,
+    const EnvironmentVariables& env
+) {
+    data.argv.reserve(args.size() + 2);
+    data.envp_buf.reserve(env.size());
+    data.envp.reserve(env.size() + 1);
 
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-    argv_ptrs.push_back(const_cast<char*>(executable_path.c_str()));
+    data.argv.push_back(const_cast<char*>(executable_path.c_str()));
     for (const auto& arg : args) {
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-        argv_ptrs.push_back(const_cast<char*>(arg.c_str()));
+        data.argv.push_back(const_cast<char*>(arg.c_str()));
     }
-    argv_ptrs.push_back(nullptr);
+    data.argv.push_back(nullptr);
 
     for (const auto& [key, value] : env) {
-        envp_buf.emplace_back(utils::StrCat(key, "=", value));
+        data.envp_buf.emplace_back(utils::StrCat(key, "=", value));
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-        envp_ptrs.push_back(const_cast<char*>(envp_buf.back().c_str()));
+        data.envp.push_back(const_cast<char*>(data.envp_buf.back().c_str()));
     }
-    envp_ptrs.push_back(nullptr);
+    data.envp.push_back(nullptr);
+}
 
-    environ = envp_ptrs.data();  // The variable is assigned to the environment to
-                                 // use the execv, execvp functions
+// Pipe ends are created non-blocking, the child gets a blocking one. The
+// descriptor keeps O_CLOEXEC, only its duplicate survives the exec
+template <typename PipeEnd>
+void ReleaseToChild(PipeEnd& pipe_end, int& child_fd) {
+    child_fd = pipe_end.Release();
+    const auto flags = utils::CheckSyscall(::fcntl(child_fd, F_GETFL), "getting pipe flags");
+    utils::CheckSyscall(::fcntl(child_fd, F_SETFL, flags & ~O_NONBLOCK), "clearing O_NONBLOCK of a pipe");
+}
 
-    if (!use_path) {
-        utils::CheckSyscall(execv(executable_path.c_str(), argv_ptrs.data()), "execv");
-    } else {
-        utils::CheckSyscall(execvp(executable_path.c_str(), argv_ptrs.data()), "execvp");
+std::unique_ptr<ChildProcessPipes> MakePipes(const ExecOptions& options, ExecData& data) {
+    if (!options.stdin_pipe && !options.stdout_pipe && !options.stderr_pipe) return nullptr;
+
+    auto pipes = std::make_unique<ChildProcessPipes>();
+    if (options.stdin_pipe) {
+        io::Pipe pipe;
+        ReleaseToChild(pipe.reader, data.stdio_fds[STDIN_FILENO]);
+        pipes->stdin_pipe.emplace(std::move(pipe.writer));
+    }
+    if (options.stdout_pipe) {
+        io::Pipe pipe;
+        ReleaseToChild(pipe.writer, data.stdio_fds[STDOUT_FILENO]);
+        pipes->stdout_pipe.emplace(std::move(pipe.reader));
+    }
+    if (options.stderr_pipe) {
+        io::Pipe pipe;
+        ReleaseToChild(pipe.writer, data.stdio_fds[STDERR_FILENO]);
+        pipes->stderr_pipe.emplace(std::move(pipe.reader));
+    }
+    return pipes;
+}
+
+void CloseChildFds(ExecData& data) noexcept {
+    for (auto& fd : data.stdio_fds) {
+        if (fd != io::kInvalidFd) ::close(fd);
+        fd = io::kInvalidFd;
     }
 }
 
+void WriteChildError(std::string_view message) noexcept {
+    [[maybe_unused]] const auto res = ::write(STDERR_FILENO, message.data(), message.size());
+}
+
+bool RedirectToFile(const char* path, int target_fd) noexcept {
+    const int fd = ::open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0666);
+    return fd != -1 && ::dup2(fd, target_fd) != -1;
+}
+
+// Runs in the child, must not return, allocate, or modify the parent memory
+[[noreturn]] void DoExec(const ExecData& data) noexcept {
+    // Handlers of the parent must not run in the child while the memory is
+    // shared, the signals are blocked until the handlers are reset
+    for (int signum = 1; signum < NSIG; ++signum) {
+        struct sigaction action {};
+        if (::sigaction(signum, nullptr, &action) == 0 && action.sa_handler != SIG_IGN) {
+            action.sa_handler = SIG_DFL;
+            ::sigaction(signum, &action, nullptr);
+        }
+    }
+
+    for (std::size_t i = 0; i < kStdioFdsCount; ++i) {
+        if (data.stdio_fds[i] != io::kInvalidFd && ::dup2(data.stdio_fds[i], static_cast<int>(i)) == -1) {
+            WriteChildError("Cannot execute child: dup2 failed\n");
+            std::abort();
+        }
+    }
+    if (data.stdout_file && !RedirectToFile(data.stdout_file, STDOUT_FILENO)) {
+        WriteChildError("Cannot execute child: failed to redirect stdout\n");
+        std::abort();
+    }
+    if (data.stderr_file && !RedirectToFile(data.stderr_file, STDERR_FILENO)) {
+        WriteChildError("Cannot execute child: failed to redirect stderr\n");
+        std::abort();
+    }
+
+    ::sigprocmask(SIG_SETMASK, &data.parent_sigmask, nullptr);
+
+    for (const auto& candidate : data.executable_candidates) {
+        ::execve(candidate.c_str(), data.argv.data(), data.envp.data());
+    }
+    // on success execve does not return
+    WriteChildError("Cannot execute child: execve failed\n");
+    std::abort();
+}
+
+// Returns the pid of the child or -1
+int Spawn(ExecData& data) {
+    sigset_t all_signals;
+    ::sigfillset(&all_signals);
+    utils::CheckSyscall(::pthread_sigmask(SIG_SETMASK, &all_signals, &data.parent_sigmask), "blocking signals");
+
+    // The parent is suspended until the child calls execve() or exits, so
+    // `data` is alive while the child uses it
+#ifdef __linux__
+    const auto pid = ::vfork();
+#else
+    const auto pid = ::fork();
+#endif
+    if (pid == 0) DoExec(data);
+
+    const auto fork_errno = errno;
+    ::pthread_sigmask(SIG_SETMASK, &data.parent_sigmask, nullptr);
+    errno = fork_errno;
+    return pid;
+}
+
 EnvironmentVariables ApplyEnvironmentUpdate(
     std::optional<EnvironmentVariables>&& env,
     std::optional<EnvironmentVariablesUpdate>&& env_update
@@ -117,8 +245,23 @@ ProcessStarter::Exec(const std::string& executable_path, const std::vector<std::
         );
     }
 
+    if ((options.stdout_file && options.stdout_pipe) || (options.stderr_file && options.stderr_pipe)) {
+        throw std::runtime_error("Both a file and a pipe are requested for an output of the child process");
+    }
+
     tracing::Span span("ProcessStarter::Exec");
     span.AddTag("executable_path", executable_path);
+
+    ExecData data;
+    data.executable_candidates = MakeExecutableCandidates(executable_path, env, options.use_path);
+    FillArgsAndEnv(data, executable_path, args, env);
+    if (options.stdout_file) data.stdout_file = options.stdout_file->c_str();
+    if (options.stderr_file) data.stderr_file = options.stderr_file->c_str();
+
+    // Child ends of the pipes are not needed in the parent after the spawn
+    utils::FastScopeGuard close_child_fds([&data]() noexcept { CloseChildFds(data); });
+    auto pipes = MakePipes(options, data);
+
     Promise<ChildProcess> promise;
     auto future = promise.get_future();
 
@@ -127,41 +270,37 @@ ProcessStarter::Exec(const std::string& executable_path, const std::vector<std::
                               return key_value.first + '=' + key_value.second;
                           });
         LOG_DEBUG() << fmt::format(
-            "do fork() + {}(), executable_path={}, args=[\'{}\'], env=[]",
-            options.use_path ? "execv" : "execvp",
+            "do vfork() + execve(), executable_path={}, args=[\'{}\'], env=[{}]",
+            executable_path,
             fmt::join(args, "' '"),
             fmt::join(keys, ", ")
         );
 
-        const auto pid = utils::CheckSyscall(fork(), "fork");
-        if (pid) {
-            // in parent thread
-            span.AddTag("child-process-pid", pid);
-            LOG_DEBUG() << "Started child process with pid=" << pid;
-            Promise<ChildProcessStatus> exec_result_promise;
-            auto res = ChildProcessMapSet(pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
-            if (res.second) {
-                promise.set_value(ChildProcess{ChildProcessImpl{pid, res.first->status_promise.get_future()}});
-            } else {
-                const auto msg = fmt::format("process with pid={} already exists in child_process_map", pid);
-                LOG_ERROR() << msg << ", send SIGKILL";
-                ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
-                promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
-            }
-        } else {
-            // in child thread
+        // The child is spawned from the ev thread, so that the status is not
+        // reaped before the pid gets into the ChildProcessMap
+        const auto pid = Spawn(data);
+        if (pid == -1) {
             try {
-                try {
-                    DoExec(executable_path, args, env, options.stdout_file, options.stderr_file, options.use_path);
-                } catch (const std::exception& ex) {
-                    std::cerr << "Cannot execute child: " << ex.what();
-                }
-            } catch (...) {
-                // must not do anything in a child
-                std::abort();
+                utils::CheckSyscall(pid, "vfork");
+            } catch (const std::exception&) {
+                promise.set_exception(std::current_exception());
             }
-            // on success execve or execvp does not return
-            std::abort();
+            return;
+        }
+
+        span.AddTag("child-process-pid", pid);
+        LOG_DEBUG() << "Started child process with pid=" << pid;
+        Promise<ChildProcessStatus> exec_result_promise;
+        auto res = ChildProcessMapSet(pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
+        if (res.second) {
+            promise.set_value(
+                ChildProcess{ChildProcessImpl{pid, res.first->status_promise.get_future(), std::move(pipes)}}
+            );
+        } else {
+            const auto msg = fmt::format("process with pid={} already exists in child_process_map", pid);
+            LOG_ERROR() << msg << ", send SIGKILL";
+            ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
+            promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
         }
     });
 
@@ -3,6 +3,7 @@
 #include <sys/param.h>
 #include <unistd.h>
 
+#include <array>
 #include <chrono>
 #include <string>
 #include <thread>
@@ -23,6 +24,8 @@
 
 #include <engine/ev/thread_control.hpp>
 #include <engine/ev/thread_pool.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/subprocess/child_process.hpp>
 #include <userver/engine/subprocess/process_starter.hpp>
 #include <userver/engine/task/task.hpp>
@@ -79,6 +82,13 @@ GetEnvironmentInsideExec(engine::subprocess::ProcessStarter& starter, const std:
     return data;
 }
 
+std::string ReadToEnd(engine::io::PipeReader& reader) {
+    std::string result;
+    std::array<char, 1024> buf{};
+    while (const auto size = reader.ReadSome(buf.data(), buf.size(), {})) result.append(buf.data(), size);
+    return result;
+}
+
 }  // namespace
 
 UTEST(Subprocess, ExecvExecvFailure) {
@@ -148,6 +158,52 @@ UTEST(Subprocess, ExecvpVulnerability) {
     );
 }
 
+UTEST(Subprocess, Pipes) {
+    engine::subprocess::ProcessStarter starter(engine::current_task::GetTaskProcessor());
+
+    engine::subprocess::ExecOptions options{};
+    options.stdin_pipe = true;
+    options.stdout_pipe = true;
+    options.stderr_pipe = true;
+
+    auto process = starter.Exec("/bin/sh", {"-c", "cat; echo error >&2; exit 3"}, std::move(options));
+    ASSERT_TRUE(process.GetStdin());
+    ASSERT_TRUE(process.GetStdout());
+    ASSERT_TRUE(process.GetStderr());
+
+    const std::string input(100'000, 'x');
+    auto writer = engine::AsyncNoSpan([&] {
+        EXPECT_EQ(process.GetStdin()->WriteAll(input.data(), input.size(), {}), input.size());
+        process.GetStdin()->Close();
+    });
+    EXPECT_EQ(ReadToEnd(*process.GetStdout()), input);
+    writer.Get();
+    EXPECT_EQ(ReadToEnd(*process.GetStderr()), "error\n");
+
+    const auto status = process.Get();
+    ASSERT_TRUE(status.IsExited());
+    EXPECT_EQ(3, status.GetExitCode());
+}
+
+UTEST(Subprocess, NoPipesByDefault) {
+    engine::subprocess::ProcessStarter starter(engine::current_task::GetTaskProcessor());
+    auto process = starter.Exec(kTestProgram, {"-n", "1"});
+    EXPECT_FALSE(process.GetStdin());
+    EXPECT_FALSE(process.GetStdout());
+    EXPECT_FALSE(process.GetStderr());
+    EXPECT_EQ(0, process.Get().GetExitCode());
+}
+
+UTEST(Subprocess, FileAndPipe) {
+    engine::subprocess::ProcessStarter starter(engine::current_task::GetTaskProcessor());
+
+    engine::subprocess::ExecOptions options{};
+    options.stdout_file = "/dev/null";
+    options.stdout_pipe = true;
+
+    UEXPECT_THROW((void)starter.Exec(kTestProgram, {"-n", "1"}, std::move(options)), std::runtime_error);
+}
+
 UTEST(Subprocess, CheckLogClosesFds) {
     auto file = fs::blocking::TempFile::Create("/tmp", kLogFilePart);
     auto logger = logging::MakeFileLogger("to_file", file.GetPath(), logging::Format::kTskv);
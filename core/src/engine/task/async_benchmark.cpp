@@ -1,11 +1,14 @@
 #include <benchmark/benchmark.h>
 
 #include <array>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/impl/task_local_storage.hpp>
 #include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/inherited_variable.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/fixed_array.hpp>
 
@@ -15,6 +18,8 @@ namespace {
 
 using WrappedSpanCall = utils::impl::WrappedCallImplType<decltype(utils::impl::SpanLazyPrvalue("")), void (*)()>;
 
+std::array<engine::TaskInheritedVariable<std::string>, 8> kInheritedVariables;
+
 }
 
 // Note: We intentionally do not run this benchmark from RunStandalone to avoid
@@ -42,6 +47,36 @@ void async_comparisons_coro(benchmark::State& state) {
 }
 BENCHMARK(async_comparisons_coro)->RangeMultiplier(2)->Range(1, 32);
 
+void async_comparisons_coro_batch(benchmark::State& state) {
+    constexpr std::size_t kBatchSize = 64;
+    engine::RunStandalone(state.range(0), [&] {
+        for ([[maybe_unused]] auto _ : state) {
+            for (auto& task : engine::AsyncBatchNoSpan(kBatchSize, [](std::size_t) {})) {
+                task.Wait();
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * kBatchSize);
+    });
+}
+BENCHMARK(async_comparisons_coro_batch)->RangeMultiplier(2)->Range(1, 32);
+
+void async_comparisons_coro_loop(benchmark::State& state) {
+    constexpr std::size_t kBatchSize = 64;
+    engine::RunStandalone(state.range(0), [&] {
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve(kBatchSize);
+        for ([[maybe_unused]] auto _ : state) {
+            for (std::size_t i = 0; i < kBatchSize; ++i) {
+                tasks.push_back(engine::AsyncNoSpan([] {}));
+            }
+            for (auto& task : tasks) task.Wait();
+            tasks.clear();
+        }
+        state.SetItemsProcessed(state.iterations() * kBatchSize);
+    });
+}
+BENCHMARK(async_comparisons_coro_loop)->RangeMultiplier(2)->Range(1, 32);
+
 void wrap_call_single(benchmark::State& state) {
     engine::RunStandalone([&] {
         for ([[maybe_unused]] auto _ : state) {
@@ -95,4 +130,27 @@ void async_comparisons_coro_spanned(benchmark::State& state) {
 }
 BENCHMARK(async_comparisons_coro_spanned)->RangeMultiplier(2)->Range(1, 32);
 
+// A fan-out of utils::Async subtasks from a task with state.range(0)
+// task-inherited variables set
+void async_fan_out_inherited(benchmark::State& state) {
+    constexpr std::size_t kFanOut = 200;
+    engine::RunStandalone([&] {
+        for (std::int64_t i = 0; i < state.range(0); ++i) {
+            kInheritedVariables[i].Set(std::string(32, 'x'));
+        }
+
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve(kFanOut);
+        for ([[maybe_unused]] auto _ : state) {
+            for (std::size_t i = 0; i < kFanOut; ++i) {
+                tasks.push_back(utils::Async("", [] {}));
+            }
+            for (auto& task : tasks) task.Wait();
+            tasks.clear();
+        }
+        state.SetItemsProcessed(state.iterations() * kFanOut);
+    });
+}
+BENCHMARK(async_fan_out_inherited)->Arg(0)->Arg(1)->Arg(kInheritedVariables.size());
+
 USERVER_NAMESPACE_END
@@ -274,6 +274,46 @@ UTEST(Async, FromNonWorkerThread) {
     task.Wait();
 }
 
+UTEST(Async, Batch) {
+    auto tasks = engine::AsyncBatchNoSpan(5, [](std::size_t index) { return index * 10; });
+    ASSERT_EQ(tasks.size(), 5);
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        EXPECT_EQ(tasks[i].Get(), i * 10);
+    }
+
+    EXPECT_TRUE(engine::AsyncBatchNoSpan(0, [](std::size_t) {}).empty());
+}
+
+UTEST_MT(Async, BatchMultipleThreads, 4) {
+    std::atomic<std::size_t> sum{0};
+    auto tasks = engine::AsyncBatchNoSpan(
+        engine::current_task::GetTaskProcessor(), 100, [&sum](std::size_t index) { sum += index; }
+    );
+    for (auto& task : tasks) task.Get();
+    EXPECT_EQ(sum.load(), 99 * 100 / 2);
+}
+
+UTEST_MT(Async, BatchOwnedByHandles, 4) {
+    for (int i = 0; i < 100; ++i) {
+        auto tasks = engine::AsyncBatchNoSpan(10, [](std::size_t index) {
+            engine::Yield();
+            return index;
+        });
+        // The queue drops its references once the tasks finish, the handles
+        // must still keep the contexts alive
+        for (auto& task : tasks) task.Wait();
+        engine::Yield();
+        for (std::size_t index = 0; index < tasks.size(); ++index) {
+            EXPECT_EQ(tasks[index].Get(), index);
+        }
+    }
+
+    // Dropped without waiting
+    for (int i = 0; i < 100; ++i) {
+        [[maybe_unused]] auto tasks = engine::AsyncBatchNoSpan(10, [](std::size_t) { engine::Yield(); });
+    }
+}
+
 UTEST_MT(Async, CancelNotifyRace, 4) {
     // Stable reproduction of the race was achieved after ~10 seconds
     // (around 10'000'000 iterations) under Asan + Release + LTO.
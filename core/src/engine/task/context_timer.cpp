@@ -3,6 +3,7 @@
 #include <chrono>
 
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/coarse_timer_queue.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
@@ -59,18 +60,24 @@ private:
     void StopTimerInEvThread() noexcept;
 
     static void OnTimer(struct ev_loop*, ev_timer* w, int) noexcept;
+    static void OnCoarseTimer(ev::CoarseTimerQueue::Node& node) noexcept;
     static void InvokeTimerFunction(const Params& params, TaskContext& context);
     void DoOnTimer();
 
     boost::intrusive_ptr<TaskContext> context_;
     ev::TimerThreadControl* thread_control_ = nullptr;
+    // If set, the timer lives in the coarse timer queue and params_ are
+    // guarded by the queue lock, otherwise params_ are owned by the ev thread
+    ev::CoarseTimerQueue* coarse_timer_queue_ = nullptr;
     Params params_;
     ev_timer timer_{};
+    ev::CoarseTimerQueue::Node coarse_node_{&OnCoarseTimer};
     ev::DataPipeToEv<Params> params_pipe_to_ev_;
 };
 
 ContextTimer::Impl::Impl() {
     timer_.data = this;
+    coarse_node_.data = this;
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
     ev_init(&timer_, OnTimer);
 }
@@ -91,6 +98,7 @@ void ContextTimer::Impl::Start(
     UASSERT(!thread_control_);
     context_ = std::move(context);
     thread_control_ = &thread_control;
+    coarse_timer_queue_ = thread_control.GetCoarseTimerQueue();
 
     Restart(std::move(params));
 }
@@ -99,10 +107,17 @@ void ContextTimer::Impl::Restart(Params params) {
     UASSERT(WasStarted());
     UASSERT(params.deadline.IsReachable());
     if (params.deadline.IsReached()) {
+        if (coarse_timer_queue_) coarse_timer_queue_->Cancel(coarse_node_);
         InvokeTimerFunction(params, *context_);
         return;
     }
 
+    if (coarse_timer_queue_) {
+        const auto deadline = params.deadline;
+        coarse_timer_queue_->Schedule(coarse_node_, deadline, [&] { params_ = std::move(params); });
+        return;
+    }
+
     params_pipe_to_ev_.Push(std::move(params));
     if (PrepareEnqueue()) {
         thread_control_->RunPayloadInEvLoopDeferred(GetTimerArmer(), params.deadline);
@@ -112,6 +127,14 @@ void ContextTimer::Impl::Restart(Params params) {
 void ContextTimer::Impl::Finalize() {
     if (!WasStarted()) return;
 
+    if (coarse_timer_queue_) {
+        // The callback is not running after Cancel() and never will be
+        coarse_timer_queue_->Cancel(coarse_node_);
+        const auto context = std::move(context_);
+        // ContextTimer may be destroyed after the `context` release
+        return;
+    }
+
     // We cannot use *this as payload here, because with MultiShotAsyncPayload,
     // two ev runs with the same data can happen. The first run would drop
     // 'context_', potentially destroying *this. The second run would
@@ -181,6 +204,19 @@ void ContextTimer::Impl::OnTimer(struct ev_loop*, ev_timer* w, int) noexcept {
     ev_timer->DoOnTimer();
 }
 
+void ContextTimer::Impl::OnCoarseTimer(ev::CoarseTimerQueue::Node& node) noexcept {
+    UASSERT(!engine::current_task::IsTaskProcessorThread());
+
+    auto* self = static_cast<Impl*>(node.data);
+    UASSERT(self != nullptr);
+    try {
+        // called in event loop under the queue lock
+        InvokeTimerFunction(self->params_, *self->context_);
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "exception in ContextTimer::Impl::OnCoarseTimer(): " << ex;
+    }
+}
+
 void ContextTimer::Impl::DoOnTimer() {
     UASSERT(!engine::current_task::IsTaskProcessorThread());
 
@@ -147,6 +147,33 @@ UTEST(TaskInheritedVariable, SameObjectIsInherited) {
     utils::Async("subtask", [&] { EXPECT_EQ(&kStringVariable.Get(), kParentVariablePtr); }).Get();
 }
 
+UTEST(TaskInheritedVariable, IndependenceOfSiblings) {
+    kStringVariable.Set("shared");
+    kStringVariable2.Set("parent");
+    const auto* const shared_ptr = &kStringVariable.Get();
+
+    const auto check_sibling = [&](std::string_view value) {
+        return utils::Async("subtask", [&, value] {
+            kStringVariable2.Emplace(value);
+            kStringVariable3.Emplace(value);
+            EXPECT_EQ(kStringVariable2.Get(), value);
+            EXPECT_EQ(kStringVariable3.Get(), value);
+            // Untouched variables are still shared after the copy-on-write
+            EXPECT_EQ(&kStringVariable.Get(), shared_ptr);
+
+            utils::Async("grandchild", [value] { EXPECT_EQ(kStringVariable2.Get(), value); }).Get();
+        });
+    };
+
+    auto first = check_sibling("first");
+    auto second = check_sibling("second");
+    first.Get();
+    second.Get();
+
+    EXPECT_EQ(kStringVariable2.Get(), "parent");
+    EXPECT_FALSE(kStringVariable3.GetOptional());
+}
+
 UTEST_MT(TaskInheritedVariable, VariablesAfterParentTaskDeath, 4) {
     using Event = engine::SingleConsumerEvent;
     Event assigned_a{Event::NoAutoReset{}};
@@ -1,6 +1,7 @@
 #include <userver/components/single_threaded_task_processors.hpp>
 
 #include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_pools.hpp>
 #include <userver/engine/task/task.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,8 +16,21 @@ std::shared_ptr<engine::impl::TaskProcessorPools> GetCurrentEvPool() {
 
 }  // namespace
 
-SingleThreadedTaskProcessorsPool::SingleThreadedTaskProcessorsPool(const engine::TaskProcessorConfig& config_base) {
+SingleThreadedTaskProcessorsPool::SingleThreadedTaskProcessorsPool(const engine::TaskProcessorConfig& config_base)
+    : SingleThreadedTaskProcessorsPool(config_base, false) {}
+
+SingleThreadedTaskProcessorsPool::SingleThreadedTaskProcessorsPool(
+    const engine::TaskProcessorConfig& config_base,
+    PinEvThreads
+)
+    : SingleThreadedTaskProcessorsPool(config_base, true) {}
+
+SingleThreadedTaskProcessorsPool::SingleThreadedTaskProcessorsPool(
+    const engine::TaskProcessorConfig& config_base,
+    bool pin_ev_threads
+) {
     auto libev_pool = GetCurrentEvPool();
+    const auto ev_threads = libev_pool->EventThreadPool().GetSize();
     const auto task_processors_count = config_base.worker_threads;
 
     auto config = config_base;
@@ -30,11 +44,25 @@ SingleThreadedTaskProcessorsPool::SingleThreadedTaskProcessorsPool(const engine:
     }
     config.thread_name += '-';
 
+    // Every processor has a single worker, so per-worker affinity is applied
+    // across the processors
+    std::vector<std::size_t> per_processor_cpus;
+    if (config.cpu_affinity == CpuAffinity::kPerWorker) {
+        per_processor_cpus = GetWorkerCpuSet(config);
+        config.numa_node.reset();
+    }
+
     processors_.reserve(task_processors_count);
     for (size_t i = 0; i < task_processors_count; ++i) {
         auto proc_config = config;
         proc_config.name += std::to_string(i);
         proc_config.thread_name += std::to_string(i);
+        if (!per_processor_cpus.empty()) {
+            proc_config.cpu_set = {per_processor_cpus[i % per_processor_cpus.size()]};
+        }
+        if (pin_ev_threads) {
+            proc_config.ev_thread_index = i % ev_threads;
+        }
         processors_.push_back(std::make_unique<engine::TaskProcessor>(std::move(proc_config), libev_pool));
     }
 }
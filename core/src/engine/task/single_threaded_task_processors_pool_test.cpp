@@ -1,6 +1,9 @@
 #include <userver/components/single_threaded_task_processors.hpp>
 
+#include <engine/ev/thread_control.hpp>
 #include <engine/task/task_processor_config.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/current_task.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/strong_typedef.hpp>
 
@@ -30,6 +33,10 @@ FourThreadIds GetArrayOfThreadIds(Pool& pool) {
     }};
 }
 
+const engine::ev::ThreadControl* GetEventThread(engine::TaskProcessor& tp) {
+    return utils::Async(tp, "test", [] { return &engine::current_task::GetEventThread(); }).Get();
+}
+
 std::ostream& operator<<(std::ostream& os, FourThreadIds v) {
     return os << '[' << v[0] << ',' << v[1] << ',' << v[2] << ',' << v[3] << ']';
 }
@@ -59,4 +66,29 @@ UTEST_MT(SingleThreadedTaskprocessor, ConstructionWithoutComponentSystem, 2) {
     }
 }
 
+TEST(SingleThreadedTaskprocessor, PinnedEvThreads) {
+    engine::TaskProcessorPoolsConfig pools_config;
+    pools_config.ev_threads_num = 2;
+
+    engine::RunStandalone(1, pools_config, [] {
+        engine::TaskProcessorConfig config;
+        config.name = "test";
+        config.worker_threads = 4;
+
+        Pool pool{config, Pool::kPinEvThreads};
+        ASSERT_EQ(pool.GetSize(), 4);
+
+        const auto* ev_thread_0 = GetEventThread(pool.At(0));
+        const auto* ev_thread_1 = GetEventThread(pool.At(1));
+        EXPECT_NE(ev_thread_0, ev_thread_1);
+
+        for (unsigned i = 0; i < 4; ++i) {
+            EXPECT_EQ(GetEventThread(pool.At(0)), ev_thread_0);
+            EXPECT_EQ(GetEventThread(pool.At(1)), ev_thread_1);
+            EXPECT_EQ(GetEventThread(pool.At(2)), ev_thread_0);
+            EXPECT_EQ(GetEventThread(pool.At(3)), ev_thread_1);
+        }
+    });
+}
+
 USERVER_NAMESPACE_END
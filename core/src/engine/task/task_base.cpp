@@ -151,7 +151,12 @@ TaskProcessor& GetTaskProcessor() { return GetCurrentTaskContext().GetTaskProces
 
 std::size_t GetStackSize() { return GetTaskProcessor().GetTaskProcessorPools()->GetCoroPool().GetStackSize(); }
 
-ev::ThreadControl& GetEventThread() { return GetTaskProcessor().EventThreadPool().NextThread(); }
+ev::ThreadControl& GetEventThread() { return GetTaskProcessor().NextEventThread(); }
+
+std::optional<TaskTimings> GetTimings() noexcept {
+    const auto* const context = GetCurrentTaskContextUnchecked();
+    return context ? context->GetTimings() : std::nullopt;
+}
 
 }  // namespace current_task
 
@@ -161,6 +166,8 @@ std::uint64_t GetCreatedTaskCount(TaskProcessor& task_processor) {
     return task_processor.GetTaskCounter().GetCreatedTasks().value;
 }
 
+std::size_t GetWorkerCount(TaskProcessor& task_processor) { return task_processor.GetWorkerCount(); }
+
 }  // namespace impl
 
 }  // namespace engine
@@ -0,0 +1,46 @@
+#include <userver/engine/impl/task_batch_scope.hpp>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/span.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+// There are no context switches within the scope lifetime,
+// so it does not need to be protected via compiler::ThreadLocal
+thread_local TaskBatchScope* current_batch = nullptr;
+}  // namespace
+
+TaskBatchScope::TaskBatchScope(TaskProcessor& task_processor, std::size_t expected_size)
+    : task_processor_(task_processor), previous_(current_batch) {
+    contexts_.reserve(expected_size);
+    current_batch = this;
+}
+
+TaskBatchScope::~TaskBatchScope() {
+    UASSERT_MSG(current_batch == this, "TaskBatchScope was used across context switches");
+    current_batch = previous_;
+    if (!contexts_.empty()) {
+        task_processor_.ScheduleBatch(utils::span<TaskContext*>(contexts_));
+    }
+}
+
+bool TaskBatchScope::TryAdd(TaskProcessor& task_processor, TaskContext* context) {
+    auto* batch = current_batch;
+    if (!batch || &batch->task_processor_ != &task_processor) return false;
+
+    // The queue adopts the contexts on pop, so it must own a reference
+    // just like TaskQueue::Push does
+    intrusive_ptr_add_ref(context);
+    batch->contexts_.push_back(context);
+    return true;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
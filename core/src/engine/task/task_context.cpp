@@ -17,6 +17,7 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/stacktrace_cache.hpp>
+#include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/underlying_value.hpp>
 
@@ -314,13 +315,16 @@ TaskContext::WakeupSource TaskContext::Sleep(WaitStrategy& wait_strategy, Deadli
     yield_reason_ = YieldReason::kTaskWaiting;
     UASSERT(task_pipe_);
     TraceStateTransition(Task::State::kSuspended);
+    AccountTimeSlice();
     ProfilerStopExecution();
+    AccountTimings(Task::State::kSuspended);
 
     auto& task_pipe_ref = *task_pipe_;
     TsanAcquireBarrier();
     [[maybe_unused]] TaskContext* context = task_pipe_ref().get();
     TsanReleaseBarrier();
 
+    AccountTimings(Task::State::kRunning);
     ProfilerStartExecution();
     TraceStateTransition(Task::State::kRunning);
     UASSERT(context == this);
@@ -340,7 +344,7 @@ void TaskContext::ArmDeadlineTimer(Deadline deadline, SleepState::Epoch sleep_ep
         deadline_timer_.RestartWakeup(deadline, sleep_epoch);
     } else {
         deadline_timer_.StartWakeup(
-            boost::intrusive_ptr{this}, task_processor_.EventThreadPool().NextTimerThread(), deadline, sleep_epoch
+            boost::intrusive_ptr{this}, task_processor_.NextTimerThread(), deadline, sleep_epoch
         );
     }
 }
@@ -354,7 +358,7 @@ void TaskContext::ArmCancellationTimer() {
         deadline_timer_.RestartCancel(cancel_deadline_);
     } else {
         deadline_timer_.StartCancel(
-            boost::intrusive_ptr{this}, task_processor_.EventThreadPool().NextTimerThread(), cancel_deadline_
+            boost::intrusive_ptr{this}, task_processor_.NextTimerThread(), cancel_deadline_
         );
     }
 }
@@ -461,6 +465,7 @@ void TaskContext::CoroFunc(TaskPipe& task_pipe) {
         context->yield_reason_ = YieldReason::kNone;
         context->task_pipe_ = &task_pipe;
 
+        context->AccountTimings(Task::State::kRunning);
         context->ProfilerStartExecution();
 
         // We only let tasks ran with CriticalAsync enter function body, others
@@ -483,6 +488,7 @@ void TaskContext::CoroFunc(TaskPipe& task_pipe) {
 
                     context->TraceStateTransition(Task::State::kRunning);
                     context->payload_->Perform();
+                    context->AccountTimeSlice();
                 }
                 context->yield_reason_ = YieldReason::kTaskComplete;
             } catch (const CoroUnwinder&) {
@@ -497,6 +503,7 @@ void TaskContext::CoroFunc(TaskPipe& task_pipe) {
         }
 
         context->ProfilerStopExecution();
+        context->AccountTimings(Task::State::kCompleted);
 
         context->task_pipe_ = nullptr;
         context->TsanAcquireBarrier();
@@ -573,17 +580,37 @@ void TaskContext::Schedule() {
     UASSERT(state_ != Task::State::kQueued);
     SetState(Task::State::kQueued);
     TraceStateTransition(Task::State::kQueued);
+    AccountTimings(Task::State::kQueued);
     task_processor_.Schedule(this);
     // NOTE: may be executed at this point
 }
 
 void TaskContext::ProfilerStartExecution() {
     auto threshold_us = task_processor_.GetProfilerThreshold();
-    if (threshold_us.count() > 0) {
-        execute_started_ = std::chrono::steady_clock::now();
-    } else {
-        execute_started_ = {};
-    }
+    const bool has_time_slice = task_processor_.GetTimeSlice().count() > 0;
+    const auto now =
+        (threshold_us.count() > 0 || has_time_slice) ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+
+    execute_started_ = (threshold_us.count() > 0) ? now : std::chrono::steady_clock::time_point{};
+    time_slice_started_ = has_time_slice ? now : std::chrono::steady_clock::time_point{};
+}
+
+bool TaskContext::IsTimeSliceExhausted() const noexcept {
+    const auto time_slice = task_processor_.GetTimeSlice();
+    return time_slice.count() > 0 && time_slice_started_ != std::chrono::steady_clock::time_point{} &&
+           std::chrono::steady_clock::now() - time_slice_started_ >= time_slice;
+}
+
+void TaskContext::AccountTimeSlice() {
+    const auto time_slice = task_processor_.GetTimeSlice();
+    if (time_slice.count() <= 0 || time_slice_started_ == std::chrono::steady_clock::time_point{}) return;
+
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - time_slice_started_);
+    if (duration < time_slice) return;
+
+    const auto* span = tracing::Span::CurrentSpanUnchecked();
+    task_processor_.GetTimeSliceStats().Account(span ? std::string_view{span->GetName()} : std::string_view{}, duration);
 }
 
 void TaskContext::ProfilerStopExecution() {
@@ -610,6 +637,39 @@ void TaskContext::ProfilerStopExecution() {
     }
 }
 
+std::optional<TaskTimings> TaskContext::GetTimings() const noexcept {
+    UASSERT(IsCurrent());
+    if (!task_processor_.ShouldAccountTaskTimings()) return std::nullopt;
+
+    auto timings = timings_;
+    timings.running += std::chrono::steady_clock::now() - timings_state_since_;
+    return timings;
+}
+
+void TaskContext::AccountTimings(Task::State new_state) noexcept {
+    if (!task_processor_.ShouldAccountTaskTimings()) return;
+
+    // Called by the task itself while it is running, and by the one who
+    // schedules it after the task has switched out, so no races here
+    const auto now = std::chrono::steady_clock::now();
+    const auto elapsed = timings_state_since_ == std::chrono::steady_clock::time_point{}
+                             ? std::chrono::steady_clock::duration::zero()
+                             : now - timings_state_since_;
+    timings_state_since_ = now;
+
+    switch (new_state) {
+        case Task::State::kQueued:
+            timings_.suspended += elapsed;
+            break;
+        case Task::State::kRunning:
+            timings_.queue_wait += elapsed;
+            break;
+        default:
+            timings_.running += elapsed;
+            break;
+    }
+}
+
 void TaskContext::TraceStateTransition(Task::State state) {
     if (trace_csw_left_ == 0) return;
     --trace_csw_left_;
@@ -23,6 +23,7 @@
 #include <userver/engine/impl/task_local_storage.hpp>
 #include <userver/engine/impl/wait_list_fwd.hpp>
 #include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/current_task.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/flags.hpp>
@@ -101,6 +102,9 @@ public:
     // exceeding these limits causes task to become cancelled
     bool IsCritical() const;
 
+    // whether task was created with Task::Importance::kCritical
+    bool WasStartedAsCritical() const;
+
     // whether task is allowed to be awaited from multiple coroutines
     // simultaneously
     bool IsSharedWaitAllowed() const;
@@ -125,6 +129,10 @@ public:
 
     bool IsCancelRequested() const noexcept { return cancellation_reason_ != TaskCancellationReason::kNone; }
 
+    // Whether the task has been running without a context switch for longer
+    // than the time slice of its task processor
+    bool IsTimeSliceExhausted() const noexcept;
+
     bool IsCancellable() const noexcept;
     // returns previous value
     bool SetCancellable(bool);
@@ -159,6 +167,8 @@ public:
 
     void SetQueueWaitTimepoint(std::chrono::steady_clock::time_point tp) { task_queue_wait_timepoint_ = tp; }
 
+    std::optional<TaskTimings> GetTimings() const noexcept;
+
     void SetCancelDeadline(Deadline deadline);
 
     bool HasLocalStorage() const noexcept;
@@ -189,7 +199,6 @@ private:
 
     static WakeupSource GetPrimaryWakeupSource(SleepState::Flags sleep_flags);
 
-    bool WasStartedAsCritical() const;
     void SetState(Task::State);
 
     void Schedule();
@@ -197,6 +206,8 @@ private:
 
     void ProfilerStartExecution();
     void ProfilerStopExecution();
+    void AccountTimeSlice();
+    void AccountTimings(Task::State new_state) noexcept;
 
     void TraceStateTransition(Task::State state);
 
@@ -225,7 +236,11 @@ private:
     // {} if not defined
     std::chrono::steady_clock::time_point task_queue_wait_timepoint_;
     std::chrono::steady_clock::time_point execute_started_;
+    std::chrono::steady_clock::time_point time_slice_started_;
     std::chrono::steady_clock::time_point last_state_change_timepoint_;
+    // Since the last AccountTimings()
+    std::chrono::steady_clock::time_point timings_state_since_;
+    TaskTimings timings_;
 
     std::size_t trace_csw_left_;
 
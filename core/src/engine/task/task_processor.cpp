@@ -4,8 +4,11 @@
 #include <csignal>
 
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 
 #include <concurrent/impl/latch.hpp>
+#include <userver/engine/cached_steady_clock.hpp>
+#include <userver/engine/impl/task_batch_scope.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/static_registration.hpp>
@@ -13,8 +16,10 @@
 #include <userver/utils/rand.hpp>
 #include <userver/utils/thread_name.hpp>
 #include <userver/utils/threads.hpp>
+#include <utils/jemalloc.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
+#include <engine/impl/cached_steady_clock.hpp>
 #include <engine/task/counted_coroutine_ptr.hpp>
 #include <engine/task/task_context.hpp>
 #include <engine/task/task_processor_pools.hpp>
@@ -93,17 +98,36 @@ auto MakeTaskQueue(TaskProcessorConfig config) {
     UINVARIANT(false, "Unexpected value of TaskQueueType enum");
 }
 
+std::optional<unsigned> MakeJemallocArena(const TaskProcessorConfig& config) {
+    if (!config.jemalloc_arena) return std::nullopt;
+
+    unsigned arena = 0;
+    if (const auto ec = utils::jemalloc::CreateArena(config.name, arena)) {
+        LOG_WARNING() << "Failed to create a jemalloc arena for task processor " << config.name << ": "
+                      << ec.message();
+        return std::nullopt;
+    }
+    return arena;
+}
+
 }  // namespace
 
 TaskProcessor::TaskProcessor(TaskProcessorConfig config, std::shared_ptr<impl::TaskProcessorPools> pools)
     : task_queue_(MakeTaskQueue(config)),
       task_counter_(config.worker_threads),
       config_(std::move(config)),
+      worker_cpus_(GetWorkerCpuSet(config_)),
+      jemalloc_arena_(MakeJemallocArena(config_)),
       pools_(std::move(pools)) {
     utils::impl::FinishStaticRegistration();
+    UINVARIANT(
+        !config_.ev_thread_index || *config_.ev_thread_index < EventThreadPool().GetSize(),
+        "ev_thread_index is out of the ev thread pool range"
+    );
     try {
         LOG_INFO() << "creating task_processor " << Name() << " "
-                   << "worker_threads=" << config_.worker_threads << " thread_name=" << config_.thread_name;
+                   << "worker_threads=" << config_.worker_threads << " thread_name=" << config_.thread_name
+                   << " cpu_set=[" << fmt::format("{}", fmt::join(worker_cpus_, ",")) << "]";
         concurrent::impl::Latch workers_left{static_cast<std::ptrdiff_t>(config_.worker_threads)};
         workers_.reserve(config_.worker_threads);
         for (std::size_t i = 0; i < config_.worker_threads; ++i) {
@@ -165,13 +189,32 @@ void TaskProcessor::Schedule(impl::TaskContext* context) {
 
     SetTaskQueueWaitTimepoint(context);
 
+    if (impl::TaskBatchScope::TryAdd(*this, context)) return;
+
     std::visit([&context](auto&& arg) { return arg.Push(context); }, task_queue_);
 }
 
+void TaskProcessor::ScheduleBatch(utils::span<impl::TaskContext*> contexts) {
+    // Contexts are owned by the queue from now on
+    std::visit([contexts](auto&& arg) { return arg.PushBulk(contexts); }, task_queue_);
+}
+
 void TaskProcessor::Adopt(impl::TaskContext& context) { detached_contexts_->Add(context); }
 
 ev::ThreadPool& TaskProcessor::EventThreadPool() { return pools_->EventThreadPool(); }
 
+ev::ThreadControl& TaskProcessor::NextEventThread() {
+    auto& ev_pool = EventThreadPool();
+    if (config_.ev_thread_index) return ev_pool.GetThread(*config_.ev_thread_index);
+    return ev_pool.NextThread();
+}
+
+ev::TimerThreadControl& TaskProcessor::NextTimerThread() {
+    auto& ev_pool = EventThreadPool();
+    if (config_.ev_thread_index) return ev_pool.GetTimerThread(*config_.ev_thread_index);
+    return ev_pool.NextTimerThread();
+}
+
 impl::CountedCoroutinePtr TaskProcessor::GetCoroutine() { return {pools_->GetCoroPool().GetCoroutine(), *this}; }
 
 std::size_t TaskProcessor::GetTaskQueueSize() const {
@@ -273,6 +316,31 @@ void RegisterThreadStartedHook(std::function<void()> func) {
 }
 
 void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
+    // Pin the thread before allocating anything thread-local, so that the
+    // first-touch memory policy places worker caches on the right NUMA node.
+    // The CPUs were validated by GetWorkerCpuSet, the affinity may only fail
+    // to apply if the allowed CPUs of the process change meanwhile.
+    if (!worker_cpus_.empty()) {
+        try {
+            switch (config_.cpu_affinity) {
+                case CpuAffinity::kShared:
+                    utils::SetCurrentThreadCpuAffinity(worker_cpus_);
+                    break;
+                case CpuAffinity::kPerWorker:
+                    utils::SetCurrentThreadCpuAffinity({worker_cpus_[index % worker_cpus_.size()]});
+                    break;
+            }
+        } catch (const std::exception& e) {
+            LOG_ERROR() << "Failed to pin a worker of " << Name() << " to its CPUs: " << e;
+        }
+    }
+
+    if (jemalloc_arena_) {
+        if (const auto ec = utils::jemalloc::BindCurrentThreadToArena(*jemalloc_arena_)) {
+            LOG_WARNING() << "Failed to bind a worker of " << Name() << " to the jemalloc arena: " << ec.message();
+        }
+    }
+
     switch (config_.os_scheduling) {
         case OsScheduling::kNormal:
             break;
@@ -304,6 +372,7 @@ void TaskProcessor::ProcessTasks() noexcept {
         auto context = std::visit([](auto&& arg) { return arg.PopBlocking(); }, task_queue_);
         if (!context) break;
 
+        impl::InvalidateCachedSteadyClock();
         CheckWaitTime(*context);
 
         bool has_failed = false;
@@ -327,17 +396,26 @@ void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
     const auto [action, max_wait_time] = GetOverloadActionAndValue(action_bit_and_max_task_queue_wait_time_);
     const auto sensor_wait_time = sensor_task_queue_wait_time_.load();
 
-    if (max_wait_time.count() == 0 && sensor_wait_time.count() == 0) {
+    const bool has_limits = max_wait_time.count() != 0 || sensor_wait_time.count() != 0;
+    const bool is_sampled = is_queue_wait_time_sampled_.load(std::memory_order_relaxed);
+
+    if (!has_limits && !is_sampled) {
         SetTaskQueueWaitTimeOverloaded(false);
         return;
     }
 
     const auto wait_timepoint = context.GetQueueWaitTimepoint();
     if (wait_timepoint != std::chrono::steady_clock::time_point()) {
-        const auto wait_time = std::chrono::steady_clock::now() - wait_timepoint;
+        const auto wait_time = CachedSteadyClock::now() - wait_timepoint;
         const auto wait_time_us = std::chrono::duration_cast<std::chrono::microseconds>(wait_time);
         LOG_TRACE() << "queue wait time = " << wait_time_us.count() << "us";
 
+        if (is_sampled) AccountQueueWaitTime(wait_time_us);
+        if (!has_limits) {
+            SetTaskQueueWaitTimeOverloaded(false);
+            return;
+        }
+
         SetTaskQueueWaitTimeOverloaded(max_wait_time.count() && wait_time >= max_wait_time);
 
         if (sensor_wait_time.count() && wait_time >= sensor_wait_time) {
@@ -356,6 +434,24 @@ void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
     }
 }
 
+std::optional<std::chrono::microseconds> TaskProcessor::CollectMinQueueWaitTime() noexcept {
+    if (!is_queue_wait_time_sampled_.exchange(true)) return std::nullopt;
+
+    const auto min_wait_time_us =
+        min_queue_wait_time_us_.exchange(std::numeric_limits<std::int64_t>::max(), std::memory_order_relaxed);
+    if (min_wait_time_us == std::numeric_limits<std::int64_t>::max()) return std::nullopt;
+    return std::chrono::microseconds{min_wait_time_us};
+}
+
+void TaskProcessor::AccountQueueWaitTime(std::chrono::microseconds wait_time) noexcept {
+    const auto wait_time_us = wait_time.count();
+    auto current = min_queue_wait_time_us_.load(std::memory_order_relaxed);
+    // The check helps to reduce contention, the minimum changes rarely.
+    while (wait_time_us < current &&
+           !min_queue_wait_time_us_.compare_exchange_weak(current, wait_time_us, std::memory_order_relaxed)) {
+    }
+}
+
 void TaskProcessor::SetTaskQueueWaitTimeOverloaded(bool new_value) noexcept {
     auto& atomic = overloaded_cache_->overloaded_by_wait_time;
     // The check helps to reduce contention.
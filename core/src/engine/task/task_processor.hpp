@@ -3,7 +3,9 @@
 #include <atomic>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <variant>
 #include <vector>
@@ -13,10 +15,12 @@
 #include <engine/task/task_counter.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <engine/task/task_queue.hpp>
+#include <engine/task/time_slice_stats.hpp>
 #include <engine/task/work_stealing_queue/task_queue.hpp>
 #include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 #include <userver/logging/logger.hpp>
+#include <userver/utils/span.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -31,6 +35,8 @@ class CountedCoroutinePtr;
 
 namespace ev {
 class ThreadPool;
+class ThreadControl;
+class TimerThreadControl;
 }  // namespace ev
 
 class TaskProcessor final {
@@ -42,16 +48,28 @@ public:
 
     void Schedule(impl::TaskContext*);
 
+    // Pushes the contexts already prepared by Schedule() with a single queue
+    // operation, see impl::TaskBatchScope
+    void ScheduleBatch(utils::span<impl::TaskContext*> contexts);
+
     void Adopt(impl::TaskContext& context);
 
     impl::CountedCoroutinePtr GetCoroutine();
 
     ev::ThreadPool& EventThreadPool();
 
+    // Round-robin over the ev pool, unless the task processor is bound to a
+    // single ev thread
+    ev::ThreadControl& NextEventThread();
+
+    ev::TimerThreadControl& NextTimerThread();
+
     std::shared_ptr<impl::TaskProcessorPools> GetTaskProcessorPools() { return pools_; }
 
     const std::string& Name() const { return config_.name; }
 
+    const TaskProcessorConfig& GetConfig() const noexcept { return config_; }
+
     impl::TaskCounter& GetTaskCounter() noexcept { return task_counter_; }
 
     const impl::TaskCounter& GetTaskCounter() const { return task_counter_; }
@@ -64,6 +82,19 @@ public:
 
     std::chrono::microseconds GetProfilerThreshold() const;
 
+    std::size_t GetLockSpinningIterations() const noexcept { return config_.lock_spinning_iterations; }
+
+    std::chrono::microseconds GetTimeSlice() const noexcept { return config_.time_slice; }
+
+    bool ShouldAccountTaskTimings() const noexcept { return config_.task_timings; }
+
+    // The jemalloc arena of the worker threads, if any
+    std::optional<unsigned> GetJemallocArena() const noexcept { return jemalloc_arena_; }
+
+    impl::TimeSliceStats& GetTimeSliceStats() noexcept { return time_slice_stats_; }
+
+    const impl::TimeSliceStats& GetTimeSliceStats() const noexcept { return time_slice_stats_; }
+
     bool ShouldProfilerForceStacktrace() const;
 
     std::size_t GetTaskTraceMaxCswForNewTask() const;
@@ -76,6 +107,11 @@ public:
 
     std::vector<std::uint8_t> CollectCurrentLoadPct() const;
 
+    // Minimal sampled task queue wait time since the previous call, or
+    // std::nullopt if no task was sampled. Sampling is enabled by the first
+    // call and is done even if the queue wait time limits are not set.
+    std::optional<std::chrono::microseconds> CollectMinQueueWaitTime() noexcept;
+
 private:
     // Contains queue size cache when overloaded by length, 0 otherwise.
     using OverloadByLength = std::size_t;
@@ -97,6 +133,8 @@ private:
 
     void SetTaskQueueWaitTimeOverloaded(bool new_value) noexcept;
 
+    void AccountQueueWaitTime(std::chrono::microseconds wait_time) noexcept;
+
     void HandleOverload(impl::TaskContext& context, TaskProcessorSettings::OverloadAction);
 
     OverloadByLength GetOverloadByLength(std::size_t max_queue_length) noexcept;
@@ -109,8 +147,11 @@ private:
     concurrent::impl::InterferenceShield<OverloadedCache> overloaded_cache_;
     std::variant<TaskQueue, WorkStealingTaskQueue> task_queue_;
     impl::TaskCounter task_counter_;
+    impl::TimeSliceStats time_slice_stats_;
 
     const TaskProcessorConfig config_;
+    const std::vector<std::size_t> worker_cpus_;
+    const std::optional<unsigned> jemalloc_arena_;
     const std::shared_ptr<impl::TaskProcessorPools> pools_;
     std::vector<std::thread> workers_;
     logging::LoggerPtr task_trace_logger_{nullptr};
@@ -121,6 +162,9 @@ private:
     std::atomic<std::chrono::microseconds> action_bit_and_max_task_queue_wait_time_{{}};
     std::atomic<std::int64_t> action_bit_and_max_task_queue_wait_length_{0};
 
+    std::atomic<bool> is_queue_wait_time_sampled_{false};
+    std::atomic<std::int64_t> min_queue_wait_time_us_{std::numeric_limits<std::int64_t>::max()};
+
     std::atomic<bool> profiler_force_stacktrace_{false};
     std::atomic<bool> is_shutting_down_{false};
     std::atomic<bool> task_trace_logger_set_{false};
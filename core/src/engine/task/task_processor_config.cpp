@@ -1,11 +1,20 @@
 #include <engine/task/task_processor_config.hpp>
 
+#include <algorithm>
+#include <charconv>
 #include <cstdint>
+#include <iterator>
+#include <system_error>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
 
 #include <userver/formats/json/value.hpp>
+#include <userver/fs/blocking/read.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/text_light.hpp>
+#include <userver/utils/threads.hpp>
 #include <userver/utils/trivial_map.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
@@ -32,6 +41,23 @@ std::string GenerateWorkerThreadName(std::string_view tp_name) {
     ));
 }
 
+std::string_view TrimSpaces(std::string_view value) {
+    constexpr std::string_view kSpaces = " \t\n";
+    const auto first = value.find_first_not_of(kSpaces);
+    if (first == std::string_view::npos) return {};
+    return value.substr(first, value.find_last_not_of(kSpaces) - first + 1);
+}
+
+std::size_t ParseCpuIndex(std::string_view value, std::string_view cpu_list) {
+    value = TrimSpaces(value);
+    std::size_t result = 0;
+    const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), result);
+    if (value.empty() || ec != std::errc{} || ptr != value.data() + value.size()) {
+        throw std::runtime_error(fmt::format("Invalid CPU index '{}' in cpu list '{}'", value, cpu_list));
+    }
+    return result;
+}
+
 }  // namespace
 
 OsScheduling Parse(const yaml_config::YamlConfig& value, formats::parse::To<OsScheduling>) {
@@ -55,6 +81,25 @@ TaskQueueType Parse(const yaml_config::YamlConfig& value, formats::parse::To<Tas
     return utils::ParseFromValueString(value, kMap);
 }
 
+CriticalTasksPriority Parse(const yaml_config::YamlConfig& value, formats::parse::To<CriticalTasksPriority>) {
+    static constexpr utils::TrivialBiMap kMap([](auto selector) {
+        return selector()
+            .Case(CriticalTasksPriority::kNone, "none")
+            .Case(CriticalTasksPriority::kStrict, "strict")
+            .Case(CriticalTasksPriority::kWeighted, "weighted");
+    });
+
+    return utils::ParseFromValueString(value, kMap);
+}
+
+CpuAffinity Parse(const yaml_config::YamlConfig& value, formats::parse::To<CpuAffinity>) {
+    static constexpr utils::TrivialBiMap kMap([](auto selector) {
+        return selector().Case(CpuAffinity::kShared, "shared").Case(CpuAffinity::kPerWorker, "per-worker");
+    });
+
+    return utils::ParseFromValueString(value, kMap);
+}
+
 TaskProcessorConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<TaskProcessorConfig>) {
     TaskProcessorConfig config;
     config.should_guess_cpu_limit = value["guess-cpu-limit"].As<bool>(config.should_guess_cpu_limit);
@@ -62,7 +107,21 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value, formats::parse::
     config.thread_name = value["thread_name"].As<std::string>({});
     config.os_scheduling = value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
     config.spinning_iterations = value["spinning-iterations"].As<int>(config.spinning_iterations);
+    config.lock_spinning_iterations =
+        value["lock-spinning-iterations"].As<std::size_t>(config.lock_spinning_iterations);
     config.task_processor_queue = value["task-processor-queue"].As<TaskQueueType>(config.task_processor_queue);
+    config.critical_tasks_priority =
+        value["critical-tasks-priority"].As<CriticalTasksPriority>(config.critical_tasks_priority);
+    config.critical_tasks_weight = value["critical-tasks-weight"].As<std::size_t>(config.critical_tasks_weight);
+    config.time_slice = value["time-slice"].As<std::chrono::milliseconds>(std::chrono::milliseconds{0});
+    config.task_timings = value["task-timings"].As<bool>(config.task_timings);
+    config.jemalloc_arena = value["jemalloc-arena"].As<bool>(config.jemalloc_arena);
+    if (config.critical_tasks_weight == 0) {
+        throw std::runtime_error("critical-tasks-weight must be greater than 0");
+    }
+    config.cpu_set = ParseCpuList(value["cpu-set"].As<std::string>({}));
+    config.numa_node = value["numa-node"].As<std::optional<std::size_t>>();
+    config.cpu_affinity = value["cpu-affinity"].As<CpuAffinity>(config.cpu_affinity);
 
     const auto task_trace = value["task-trace"];
     if (!task_trace.IsMissing()) {
@@ -74,6 +133,90 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value, formats::parse::
     return config;
 }
 
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list) {
+    std::vector<std::size_t> result;
+    if (TrimSpaces(cpu_list).empty()) return result;
+
+    std::string_view rest = cpu_list;
+    while (!rest.empty()) {
+        const auto comma_pos = rest.find(',');
+        const auto range = rest.substr(0, comma_pos);
+        rest = (comma_pos == std::string_view::npos) ? std::string_view{} : rest.substr(comma_pos + 1);
+
+        const auto dash_pos = range.find('-');
+        if (dash_pos == std::string_view::npos) {
+            result.push_back(ParseCpuIndex(range, cpu_list));
+            continue;
+        }
+
+        const auto first = ParseCpuIndex(range.substr(0, dash_pos), cpu_list);
+        const auto last = ParseCpuIndex(range.substr(dash_pos + 1), cpu_list);
+        if (first > last) {
+            throw std::runtime_error(fmt::format("Invalid CPU range '{}' in cpu list '{}'", range, cpu_list));
+        }
+        for (auto cpu = first; cpu <= last; ++cpu) result.push_back(cpu);
+    }
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+namespace {
+
+std::vector<std::size_t> SelectWorkerCpus(const TaskProcessorConfig& config) {
+    if (!config.numa_node) return config.cpu_set;
+
+    const auto path = fmt::format("/sys/devices/system/node/node{}/cpulist", *config.numa_node);
+    auto node_cpus = ParseCpuList(fs::blocking::ReadFileContents(path));
+    if (config.cpu_set.empty()) return node_cpus;
+
+    std::vector<std::size_t> result;
+    std::set_intersection(
+        node_cpus.begin(),
+        node_cpus.end(),
+        config.cpu_set.begin(),
+        config.cpu_set.end(),
+        std::back_inserter(result)
+    );
+    if (result.empty()) {
+        throw std::runtime_error(fmt::format(
+            "cpu-set of task processor '{}' has no CPUs on NUMA node {}", config.name, *config.numa_node
+        ));
+    }
+    return result;
+}
+
+}  // namespace
+
+std::vector<std::size_t> GetWorkerCpuSet(const TaskProcessorConfig& config) {
+    auto cpus = SelectWorkerCpus(config);
+    if (cpus.empty()) return cpus;
+
+    // The workers inherit the affinity of the thread that starts them
+    std::vector<std::size_t> allowed_cpus;
+    try {
+        allowed_cpus = utils::GetCurrentThreadCpuAffinity();
+    } catch (const std::system_error& e) {
+        throw std::runtime_error(fmt::format(
+            "cpu-set and numa-node of task processor '{}' can not be applied: {}", config.name, e.what()
+        ));
+    }
+
+    std::vector<std::size_t> disallowed_cpus;
+    std::set_difference(
+        cpus.begin(), cpus.end(), allowed_cpus.begin(), allowed_cpus.end(), std::back_inserter(disallowed_cpus)
+    );
+    if (!disallowed_cpus.empty()) {
+        throw std::runtime_error(fmt::format(
+            "cpu-set of task processor '{}' has CPUs [{}] that the process is not allowed to run on",
+            config.name,
+            fmt::join(disallowed_cpus, ",")
+        ));
+    }
+    return cpus;
+}
+
 void TaskProcessorConfig::SetName(const std::string& new_name) {
     name = new_name;
     if (thread_name.empty()) {
@@ -3,7 +3,10 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/formats/json_fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
@@ -20,10 +23,27 @@ enum class OsScheduling {
 
 enum class TaskQueueType { kGlobalTaskQueue, kWorkStealingTaskQueue };
 
+/// Dequeue order of critical tasks (handlers, connections, etc.) relative to
+/// normal tasks (e.g. utils::Async) in the global task queue
+enum class CriticalTasksPriority {
+    kNone,      ///< single FIFO for all tasks
+    kStrict,    ///< normal tasks run only if there are no queued critical tasks
+    kWeighted,  ///< a normal task runs after at most `critical_tasks_weight` critical ones
+};
+
+enum class CpuAffinity {
+    kShared,     ///< every worker may run on any CPU of the set
+    kPerWorker,  ///< worker N is pinned to the N-th CPU of the set (round-robin)
+};
+
 OsScheduling Parse(const yaml_config::YamlConfig& value, formats::parse::To<OsScheduling>);
 
 TaskQueueType Parse(const yaml_config::YamlConfig& value, formats::parse::To<TaskQueueType>);
 
+CriticalTasksPriority Parse(const yaml_config::YamlConfig& value, formats::parse::To<CriticalTasksPriority>);
+
+CpuAffinity Parse(const yaml_config::YamlConfig& value, formats::parse::To<CpuAffinity>);
+
 struct TaskProcessorConfig {
     std::string name;
 
@@ -32,7 +52,33 @@ struct TaskProcessorConfig {
     std::string thread_name;
     OsScheduling os_scheduling{OsScheduling::kNormal};
     int spinning_iterations{1000};
+    // Spin-wait iterations of engine::Mutex, engine::SharedMutex and
+    // engine::Semaphore before parking the task, 0 parks right away
+    std::size_t lock_spinning_iterations{0};
     TaskQueueType task_processor_queue{TaskQueueType::kGlobalTaskQueue};
+    CriticalTasksPriority critical_tasks_priority{CriticalTasksPriority::kNone};
+    std::size_t critical_tasks_weight{8};
+
+    // Zero disables the time slice accounting and engine::MaybeYield()
+    std::chrono::microseconds time_slice{0};
+
+    // Accounting of the time the tasks spend queued, running and suspended,
+    // see engine::current_task::GetTimings()
+    bool task_timings{false};
+
+    // Dedicated jemalloc arena for the worker threads, so that the allocations
+    // of different task processors do not contend and are accounted apart
+    bool jemalloc_arena{false};
+
+    // Empty set and no NUMA node means no pinning
+    std::vector<std::size_t> cpu_set;
+    std::optional<std::size_t> numa_node;
+    CpuAffinity cpu_affinity{CpuAffinity::kShared};
+
+    // If set, all the ev watchers and timers of the tasks are bound to the
+    // ev thread with this index instead of being spread over the ev pool.
+    // Not read from the static config, see SingleThreadedTaskProcessorsPool.
+    std::optional<std::size_t> ev_thread_index;
 
     std::size_t task_trace_every{1000};
     std::size_t task_trace_max_csw{0};
@@ -43,6 +89,18 @@ struct TaskProcessorConfig {
 
 TaskProcessorConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<TaskProcessorConfig>);
 
+/// Parses a Linux cpulist string, e.g. "0-3,8,10-11"
+/// @throws std::runtime_error on invalid input
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list);
+
+/// Returns the CPUs the task processor workers should be limited to, taking
+/// both `cpu_set` and `numa_node` into account. Reads sysfs if `numa_node` is
+/// set, so must be called at startup only.
+/// @returns empty vector if no pinning is required
+/// @throws std::runtime_error if the CPUs can not be used by the workers of
+/// the current process or if the platform does not support the pinning
+std::vector<std::size_t> GetWorkerCpuSet(const TaskProcessorConfig& config);
+
 struct TaskProcessorSettings {
     std::size_t wait_queue_length_limit{0};
     std::chrono::microseconds wait_queue_time_limit{0};
@@ -0,0 +1,75 @@
+#include <engine/task/task_processor_config.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/utils/threads.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+engine::TaskProcessorConfig ParseConfig(const std::string& yaml) {
+    return yaml_config::YamlConfig(formats::yaml::FromString(yaml), {}).As<engine::TaskProcessorConfig>();
+}
+
+}  // namespace
+
+TEST(TaskProcessorConfig, ParseCpuList) {
+    using Cpus = std::vector<std::size_t>;
+
+    EXPECT_EQ(engine::ParseCpuList(""), Cpus{});
+    EXPECT_EQ(engine::ParseCpuList("3"), Cpus{3});
+    EXPECT_EQ(engine::ParseCpuList("0-3"), (Cpus{0, 1, 2, 3}));
+    EXPECT_EQ(engine::ParseCpuList("0-1,8,10-11\n"), (Cpus{0, 1, 8, 10, 11}));
+    EXPECT_EQ(engine::ParseCpuList("4, 2,2-3"), (Cpus{2, 3, 4}));
+
+    EXPECT_THROW(engine::ParseCpuList("3-1"), std::runtime_error);
+    EXPECT_THROW(engine::ParseCpuList("1,,2"), std::runtime_error);
+    EXPECT_THROW(engine::ParseCpuList("a-b"), std::runtime_error);
+    EXPECT_THROW(engine::ParseCpuList("-1"), std::runtime_error);
+}
+
+TEST(TaskProcessorConfig, CpuAffinity) {
+    const auto config = ParseConfig(R"(
+worker_threads: 4
+cpu-set: 0-1,4
+cpu-affinity: per-worker
+)");
+
+    EXPECT_EQ(config.cpu_set, (std::vector<std::size_t>{0, 1, 4}));
+    EXPECT_EQ(config.cpu_affinity, engine::CpuAffinity::kPerWorker);
+    EXPECT_FALSE(config.numa_node);
+}
+
+#ifdef __linux__
+TEST(TaskProcessorConfig, WorkerCpuSet) {
+    const auto allowed_cpus = utils::GetCurrentThreadCpuAffinity();
+    ASSERT_FALSE(allowed_cpus.empty());
+
+    engine::TaskProcessorConfig config;
+    config.cpu_set = {allowed_cpus.front()};
+    EXPECT_EQ(engine::GetWorkerCpuSet(config), config.cpu_set);
+
+    // Reported as a config error instead of failing in the worker threads
+    config.cpu_set = {allowed_cpus.front(), allowed_cpus.back() + 1};
+    EXPECT_THROW(engine::GetWorkerCpuSet(config), std::runtime_error);
+}
+#endif
+
+TEST(TaskProcessorConfig, NoCpuAffinityByDefault) {
+    const auto config = ParseConfig("worker_threads: 4");
+
+    EXPECT_TRUE(config.cpu_set.empty());
+    EXPECT_FALSE(config.numa_node);
+    EXPECT_EQ(config.cpu_affinity, engine::CpuAffinity::kShared);
+    EXPECT_TRUE(engine::GetWorkerCpuSet(config).empty());
+}
+
+TEST(TaskProcessorConfig, TimeSlice) {
+    EXPECT_EQ(ParseConfig("worker_threads: 4").time_slice, std::chrono::microseconds{0});
+    EXPECT_EQ(ParseConfig("time-slice: 5ms").time_slice, std::chrono::milliseconds{5});
+}
+
+USERVER_NAMESPACE_END
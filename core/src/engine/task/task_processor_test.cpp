@@ -10,6 +10,52 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+// Returns the order in which normal ('n') and critical ('c') tasks were
+// dequeued by a single-threaded task processor
+std::string GetDequeueOrder(engine::CriticalTasksPriority priority) {
+    engine::TaskProcessorConfig config;
+    config.name = "priority-task-processor";
+    config.thread_name = "prio-worker";
+    config.worker_threads = 1;
+    config.critical_tasks_priority = priority;
+    config.critical_tasks_weight = 2;
+    engine::TaskProcessor task_processor{config, engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+    // Occupy the only worker, so that all the tasks below get queued
+    std::atomic<bool> started{false};
+    std::atomic<bool> release{false};
+    auto blocker = engine::AsyncNoSpan(task_processor, [&started, &release] {
+        started = true;
+        while (!release) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    while (!started) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Only touched from the single worker thread
+    std::string order;
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (int i = 0; i < 3; ++i) {
+        tasks.push_back(engine::AsyncNoSpan(task_processor, [&order] { order += 'n'; }));
+    }
+    for (int i = 0; i < 3; ++i) {
+        tasks.push_back(engine::CriticalAsyncNoSpan(task_processor, [&order] { order += 'c'; }));
+    }
+
+    release = true;
+    blocker.Get();
+    for (auto& task : tasks) {
+        task.Get();
+    }
+    return order;
+}
+
+}  // namespace
+
 UTEST(TaskProcessor, Overload) {
     engine::TaskProcessorSettings settings;
     settings.overload_action = engine::TaskProcessorSettings::OverloadAction::kCancel;
@@ -74,4 +120,72 @@ UTEST_MT(TaskProcessor, MetricsAliveAndRunning, 2) {
     EXPECT_EQ(task_counter.GetRunningTasks(), 1);
 }
 
+UTEST(TaskProcessor, CriticalTasksPriority) {
+    EXPECT_EQ(GetDequeueOrder(engine::CriticalTasksPriority::kNone), "nnnccc");
+    EXPECT_EQ(GetDequeueOrder(engine::CriticalTasksPriority::kStrict), "cccnnn");
+    EXPECT_EQ(GetDequeueOrder(engine::CriticalTasksPriority::kWeighted), "ccncnn");
+}
+
+UTEST(TaskProcessor, MaybeYieldOnExhaustedTimeSlice) {
+    engine::TaskProcessorConfig config;
+    config.name = "time-slice-task-processor";
+    config.thread_name = "slice-worker";
+    config.worker_threads = 1;
+    config.time_slice = std::chrono::milliseconds{1};
+    engine::TaskProcessor task_processor{config, engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+    std::atomic<bool> other_ran{false};
+    auto busy = engine::AsyncNoSpan(task_processor, [&other_ran] {
+        // The slice has just started, no yield is expected
+        engine::MaybeYield();
+
+        auto other = engine::AsyncNoSpan([&other_ran] { other_ran = true; });
+        const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+        while (!other_ran && !deadline.IsReached()) {
+            engine::MaybeYield();
+        }
+        other.Get();
+    });
+
+    busy.Get();
+    EXPECT_TRUE(other_ran);
+}
+
+UTEST(TaskProcessor, TaskTimings) {
+    // Not configured for the default task processor
+    EXPECT_FALSE(engine::current_task::GetTimings());
+
+    engine::TaskProcessorConfig config;
+    config.name = "timings-task-processor";
+    config.thread_name = "timings-worker";
+    config.worker_threads = 1;
+    config.task_timings = true;
+    engine::TaskProcessor task_processor{config, engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+    constexpr auto kDuration = std::chrono::milliseconds{20};
+    const auto busy_wait = [kDuration] {
+        const auto start = std::chrono::steady_clock::now();
+        while (std::chrono::steady_clock::now() - start < kDuration) {
+        }
+    };
+
+    // Occupies the only worker, so the task below waits in the queue
+    auto blocker = engine::AsyncNoSpan(task_processor, busy_wait);
+    auto task = engine::AsyncNoSpan(task_processor, [&busy_wait, kDuration] {
+        const auto before = engine::current_task::GetTimings();
+        EXPECT_TRUE(before);
+        engine::SleepFor(kDuration);
+        busy_wait();
+        return std::make_pair(*before, *engine::current_task::GetTimings());
+    });
+
+    const auto [before, after] = task.Get();
+    blocker.Get();
+    EXPECT_EQ(before.suspended, std::chrono::nanoseconds::zero());
+    EXPECT_GE(after.running - before.running, kDuration);
+    EXPECT_GE(after.suspended, kDuration);
+    // Somewhat less than the whole busy wait of the blocker
+    EXPECT_GE(after.queue_wait, kDuration / 2);
+}
+
 USERVER_NAMESPACE_END
@@ -8,10 +8,16 @@ namespace engine {
 
 namespace {
 constexpr std::size_t kSemaphoreInitialCount = 0;
-}
+
+// It is only used in worker threads outside of any coroutine,
+// so it does not need to be protected via compiler::ThreadLocal
+thread_local std::size_t critical_tasks_in_row = 0;
+}  // namespace
 
 TaskQueue::TaskQueue(const TaskProcessorConfig& config)
-    : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
+    : critical_tasks_priority_(config.critical_tasks_priority),
+      critical_tasks_weight_(config.critical_tasks_weight),
+      queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
 
 void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
     UASSERT(context);
@@ -19,13 +25,36 @@ void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
     context.detach();
 }
 
+void TaskQueue::PushBulk(utils::span<impl::TaskContext*> contexts) {
+    if (contexts.empty()) return;
+
+    std::size_t normal_count = contexts.size();
+    if (critical_tasks_priority_ != CriticalTasksPriority::kNone) {
+        // Move the normal tasks to the front preserving their order
+        normal_count = 0;
+        for (auto* context : contexts) {
+            UASSERT(context);
+            if (context->WasStartedAsCritical()) {
+                critical_queue_.enqueue(context);
+            } else {
+                contexts[normal_count++] = context;
+            }
+        }
+    }
+    if (normal_count != 0) queue_.enqueue_bulk(contexts.data(), normal_count);
+
+    // A single semaphore operation for the whole batch
+    queue_semaphore_.signal(static_cast<moodycamel::LightweightSemaphore::ssize_t>(contexts.size()));
+}
+
 boost::intrusive_ptr<impl::TaskContext> TaskQueue::PopBlocking() {
     // Current thread handles only a single TaskProcessor, so it's safe to store
     // a token for the task processor in a thread-local variable.
     thread_local moodycamel::ConsumerToken token(queue_);
+    thread_local moodycamel::ConsumerToken critical_token(critical_queue_);
 
     boost::intrusive_ptr<impl::TaskContext> context{
-        DoPopBlocking(token),
+        DoPopBlocking(token, critical_token),
         /* add_ref= */ false};
 
     if (!context) {
@@ -38,24 +67,31 @@ boost::intrusive_ptr<impl::TaskContext> TaskQueue::PopBlocking() {
 
 void TaskQueue::StopProcessing() { DoPush(nullptr); }
 
-std::size_t TaskQueue::GetSizeApproximate() const noexcept { return queue_.size_approx(); }
+std::size_t TaskQueue::GetSizeApproximate() const noexcept {
+    return queue_.size_approx() + critical_queue_.size_approx();
+}
 
 void TaskQueue::PrepareWorker(std::size_t) {}
 
 void TaskQueue::DoPush(impl::TaskContext* context) {
     // This piece of code is copy-pasted from
     // moodycamel::BlockingConcurrentQueue::enqueue
-    queue_.enqueue(context);
+    if (critical_tasks_priority_ != CriticalTasksPriority::kNone && context && context->WasStartedAsCritical()) {
+        critical_queue_.enqueue(context);
+    } else {
+        queue_.enqueue(context);
+    }
     queue_semaphore_.signal();
 }
 
-impl::TaskContext* TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token) {
+impl::TaskContext*
+TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token, moodycamel::ConsumerToken& critical_token) {
     impl::TaskContext* context{};
 
     // This piece of code is copy-pasted from
     // moodycamel::BlockingConcurrentQueue::wait_dequeue
     queue_semaphore_.wait();
-    while (!queue_.try_dequeue(token, context)) {
+    while (!TryPopAny(token, critical_token, context)) {
         // Can happen when another consumer steals our item in exchange for another
         // item in a Moodycamel sub-queue that we have already passed.
     }
@@ -63,6 +99,32 @@ impl::TaskContext* TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token) {
     return context;
 }
 
+bool TaskQueue::TryPopAny(
+    moodycamel::ConsumerToken& token,
+    moodycamel::ConsumerToken& critical_token,
+    impl::TaskContext*& context
+) {
+    switch (critical_tasks_priority_) {
+        case CriticalTasksPriority::kNone:
+            return queue_.try_dequeue(token, context);
+        case CriticalTasksPriority::kStrict:
+            return critical_queue_.try_dequeue(critical_token, context) || queue_.try_dequeue(token, context);
+        case CriticalTasksPriority::kWeighted:
+            if (critical_tasks_in_row < critical_tasks_weight_ && critical_queue_.try_dequeue(critical_token, context)) {
+                ++critical_tasks_in_row;
+                return true;
+            }
+            if (queue_.try_dequeue(token, context)) {
+                critical_tasks_in_row = 0;
+                return true;
+            }
+            // No normal tasks, do not let the weight starve critical ones
+            return critical_queue_.try_dequeue(critical_token, context);
+    }
+
+    UINVARIANT(false, "Unexpected value of CriticalTasksPriority enum");
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include <engine/task/task_processor_config.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,12 +15,18 @@ namespace impl {
 class TaskContext;
 }  // namespace impl
 
+// Tasks that were started as critical may go to a separate lane, see
+// CriticalTasksPriority. Both lanes share a single semaphore, so the semaphore
+// count is always equal to the total number of queued tasks.
 class TaskQueue final {
 public:
     explicit TaskQueue(const TaskProcessorConfig& config);
 
     void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
 
+    // Takes ownership of the contexts, may reorder them within the span
+    void PushBulk(utils::span<impl::TaskContext*> contexts);
+
     // Returns nullptr as a stop signal
     boost::intrusive_ptr<impl::TaskContext> PopBlocking();
 
@@ -32,9 +39,19 @@ public:
 private:
     void DoPush(impl::TaskContext* context);
 
-    impl::TaskContext* DoPopBlocking(moodycamel::ConsumerToken& token);
+    impl::TaskContext* DoPopBlocking(moodycamel::ConsumerToken& token, moodycamel::ConsumerToken& critical_token);
+
+    bool TryPopAny(
+        moodycamel::ConsumerToken& token,
+        moodycamel::ConsumerToken& critical_token,
+        impl::TaskContext*& context
+    );
+
+    const CriticalTasksPriority critical_tasks_priority_;
+    const std::size_t critical_tasks_weight_;
 
     moodycamel::ConcurrentQueue<impl::TaskContext*> queue_;
+    moodycamel::ConcurrentQueue<impl::TaskContext*> critical_queue_;
     moodycamel::LightweightSemaphore queue_semaphore_;
 };
 
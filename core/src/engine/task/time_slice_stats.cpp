@@ -0,0 +1,49 @@
+#include <engine/task/time_slice_stats.hpp>
+
+#include <algorithm>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+void TimeSliceOverruns::Account(std::chrono::microseconds duration) noexcept {
+    ++count;
+    max_duration = std::max(max_duration, duration);
+    total_duration += duration;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const TimeSliceOverruns& overruns) {
+    writer["count"] = overruns.count;
+    writer["max-us"] = overruns.max_duration.count();
+    writer["total-us"] = overruns.total_duration.count();
+}
+
+void TimeSliceStats::Account(std::string_view span_name, std::chrono::microseconds duration) {
+    std::lock_guard lock(mutex_);
+    total_.Account(duration);
+    if (span_name.empty()) return;
+
+    if (auto* overruns = utils::impl::FindTransparentOrNullptr(by_span_, span_name)) {
+        overruns->Account(duration);
+    } else if (by_span_.size() < kMaxTrackedSpans) {
+        by_span_[std::string{span_name}].Account(duration);
+    } else {
+        other_.Account(duration);
+    }
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const TimeSliceStats& stats) {
+    std::lock_guard lock(stats.mutex_);
+    writer["total"] = stats.total_;
+    if (!stats.by_span_.empty() || stats.other_.count != 0) {
+        auto by_span = writer["by-span"];
+        for (const auto& [name, overruns] : stats.by_span_) {
+            by_span.ValueWithLabels(overruns, utils::statistics::LabelView{"span_name", name});
+        }
+        if (stats.other_.count != 0) by_span.ValueWithLabels(stats.other_, utils::statistics::LabelView{"span_name", "other"});
+    }
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include <userver/utils/impl/transparent_hash.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+struct TimeSliceOverruns final {
+    std::uint64_t count{0};
+    std::chrono::microseconds max_duration{0};
+    std::chrono::microseconds total_duration{0};
+
+    void Account(std::chrono::microseconds duration) noexcept;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const TimeSliceOverruns& overruns);
+
+// Runs of tasks without a context switch that took longer than the time
+// slice of the task processor, grouped by the name of the current span.
+class TimeSliceStats final {
+public:
+    // Empty `span_name` is accounted only in the total
+    void Account(std::string_view span_name, std::chrono::microseconds duration);
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const TimeSliceStats& stats);
+
+private:
+    // Bounds the metrics cardinality, the rest go to `other`
+    static constexpr std::size_t kMaxTrackedSpans = 64;
+
+    mutable std::mutex mutex_;
+    TimeSliceOverruns total_;
+    TimeSliceOverruns other_;
+    utils::impl::TransparentMap<std::string, TimeSliceOverruns> by_span_;
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
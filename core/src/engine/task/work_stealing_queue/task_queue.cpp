@@ -1,5 +1,7 @@
 #include <engine/task/work_stealing_queue/task_queue.hpp>
 
+#include <algorithm>
+
 #include <userver/utils/assert.hpp>
 #include <userver/utils/rand.hpp>
 
@@ -31,6 +33,32 @@ void WorkStealingTaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& conte
     context.detach();
 }
 
+void WorkStealingTaskQueue::PushBulk(utils::span<impl::TaskContext*> contexts) {
+    if (contexts.empty()) return;
+
+    Consumer* consumer = GetConsumer();
+    if (consumer != nullptr && consumer->GetOwner() == this) {
+        for (auto* context : contexts) consumer->Push(context);
+    } else {
+        // Move the foreground tasks to the front preserving their order
+        std::size_t foreground_count = 0;
+        for (auto* context : contexts) {
+            UASSERT(context);
+            if (context->IsBackground()) {
+                background_queue_.Push(context);
+            } else {
+                contexts[foreground_count++] = context;
+            }
+        }
+        if (foreground_count != 0) global_queue_.PushBulk(contexts.first(foreground_count));
+    }
+
+    // Woken up consumers steal the rest of the batch, no need to wake up
+    // more consumers than there are tasks
+    const auto wakeups = std::min(contexts.size(), consumers_count_);
+    for (std::size_t i = 0; i < wakeups; ++i) consumers_manager_.NotifyNewTask();
+}
+
 boost::intrusive_ptr<impl::TaskContext> WorkStealingTaskQueue::PopBlocking() {
     boost::intrusive_ptr<impl::TaskContext> context{
         DoPopBlocking(),
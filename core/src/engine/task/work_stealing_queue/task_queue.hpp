@@ -8,6 +8,7 @@
 #include <engine/task/work_stealing_queue/consumer.hpp>
 #include <engine/task/work_stealing_queue/consumers_manager.hpp>
 #include <engine/task/work_stealing_queue/global_queue.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -24,6 +25,10 @@ public:
     explicit WorkStealingTaskQueue(const TaskProcessorConfig& config);
 
     void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
+
+    // Takes ownership of the contexts, may reorder them within the span
+    void PushBulk(utils::span<impl::TaskContext*> contexts);
+
     // Returns nullptr as a stop signal
     boost::intrusive_ptr<impl::TaskContext> PopBlocking();
 
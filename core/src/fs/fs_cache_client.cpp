@@ -1,13 +1,22 @@
 #include <userver/fs/fs_cache_client.hpp>
 
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
 
+#include <compression/gzip.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/fs/read.hpp>
 #include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/periodic_task.hpp>
+#include <userver/utils/text_light.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -29,6 +38,22 @@ std::string GetNormalizeDirectory(std::string_view dir) {
 
 namespace fs {
 
+namespace {
+
+// The files are compressed once per version, so the best ratio is worth it
+constexpr int kGzipLevel = 9;
+constexpr int kZstdLevel = 19;
+
+bool IsEncodingSupported(std::string_view encoding) { return encoding == "gzip" || encoding == "zstd"; }
+
+std::string Compress(std::string_view encoding, std::string_view data) {
+    if (encoding == "gzip") return compression::gzip::Compress(data, kGzipLevel);
+    UASSERT(encoding == "zstd");
+    return compression::zstd::Compress(data, kZstdLevel);
+}
+
+}  // namespace
+
 #ifdef __linux__
 namespace {
 
@@ -40,8 +65,24 @@ bool IsFilepathHidden(const std::string& path) {
 }  // namespace
 #endif  // __linux__
 
-FsCacheClient::FsCacheClient(std::string_view dir, std::chrono::milliseconds update_period, engine::TaskProcessor& tp)
-    : dir_(GetNormalizeDirectory(dir)), update_period_(update_period), tp_(tp) {
+FsCacheClient::FsCacheClient(
+    std::string_view dir,
+    std::chrono::milliseconds update_period,
+    engine::TaskProcessor& tp,
+    std::size_t max_in_memory_file_size,
+    PrecompressSettings precompress
+)
+    : dir_(GetNormalizeDirectory(dir)),
+      update_period_(update_period),
+      tp_(tp),
+      max_in_memory_file_size_(max_in_memory_file_size),
+      precompress_(std::move(precompress)) {
+    for (const auto& encoding : precompress_.encodings) {
+        if (!IsEncodingSupported(encoding)) {
+            throw std::runtime_error("Unsupported precompress encoding '" + encoding + '\'');
+        }
+    }
+
     UpdateCache();
 
     if (update_period_ == std::chrono::milliseconds(0)) {
@@ -56,10 +97,31 @@ FsCacheClient::FsCacheClient(std::string_view dir, std::chrono::milliseconds upd
 }
 
 void FsCacheClient::UpdateCache() {
-    auto map = fs::ReadRecursiveFilesInfoWithData(tp_, dir_, {fs::SettingsReadFile::kSkipHidden});
+    auto map =
+        fs::ReadRecursiveFilesInfoWithData(tp_, dir_, {fs::SettingsReadFile::kSkipHidden}, max_in_memory_file_size_);
+    if (!precompress_.encodings.empty()) {
+        engine::AsyncNoSpan(tp_, [this, &map] {
+            for (auto& [path, info] : map) {
+                auto precompressed_info = *info;
+                PrecompressBlocking(precompressed_info);
+                info = std::make_shared<const FileInfoWithData>(std::move(precompressed_info));
+            }
+        }).Get();
+    }
     data_.Assign(std::move(map));
 }
 
+void FsCacheClient::PrecompressBlocking(FileInfoWithData& info) const {
+    if (info.file || info.data.size() < precompress_.min_size) return;
+
+    for (const auto& encoding : precompress_.encodings) {
+        auto compressed = Compress(encoding, info.data);
+        // Incompressible data
+        if (compressed.size() >= info.data.size()) continue;
+        info.precompressed.push_back({encoding, std::move(compressed)});
+    }
+}
+
 #ifdef __linux__
 void FsCacheClient::InotifyWork() {
     namespace sys_linux = engine::io::sys_linux;
@@ -80,8 +142,10 @@ void FsCacheClient::InotifyWork() {
             }
         }
 
+        // The modified files are reloaded once the writer closes them, not on
+        // each write
         if (event->mask & sys_linux::EventType::kMovedTo || event->mask & sys_linux::EventType::kCreate ||
-            event->mask & sys_linux::EventType::kModify) {
+            event->mask & sys_linux::EventType::kCloseWrite) {
             if (!(event->mask & sys_linux::EventType::kIsDir)) {
                 HandleCreate(event->path);
             } else {
@@ -94,16 +158,30 @@ void FsCacheClient::InotifyWork() {
 void FsCacheClient::HandleDelete(const std::string& path) { data_.Erase(GetLexicallyRelative(path, dir_)); }
 
 void FsCacheClient::HandleDeleteDirectory(engine::io::sys_linux::Inotify& inotify, const std::string& path) {
-    LOG_INFO() << "HandleDeleteDirectory()";
-    inotify.RmWatch(path);
+    LOG_INFO() << "HandleDeleteDirectory(" << path << ")";
+
+    const auto prefix = GetLexicallyRelative(path, dir_) + '/';
+    std::vector<std::string> removed_files;
+    for (const auto& [file_path, info] : data_) {
+        if (utils::text::StartsWith(file_path, prefix)) removed_files.push_back(file_path);
+    }
+    for (const auto& file_path : removed_files) data_.Erase(file_path);
+
+    try {
+        inotify.RmWatch(path);
+    } catch (const std::system_error& ex) {
+        // The kernel drops the watches of the deleted directories by itself
+        LOG_DEBUG() << "Failed to remove the watch of " << path << ": " << ex;
+    }
 }
 
 void FsCacheClient::HandleCreate(const std::string& path) {
     if (IsFilepathHidden(path)) return;
 
-    FileInfoWithData info{};
-    info.extension = boost::filesystem::path(path).extension().string();
-    info.data = ReadFileContents(tp_, path);
+    auto info = ReadFileInfoWithData(tp_, path, max_in_memory_file_size_);
+    if (!precompress_.encodings.empty()) {
+        engine::AsyncNoSpan(tp_, [this, &info] { PrecompressBlocking(info); }).Get();
+    }
     data_.InsertOrAssign(GetLexicallyRelative(path, dir_), std::make_shared<const FileInfoWithData>(std::move(info)));
 }
 
@@ -117,7 +195,7 @@ void FsCacheClient::HandleCreateDirectoryBlocking(engine::io::sys_linux::Inotify
     inotify.AddWatch(
         path,
         {
-            sys_linux::EventType::kModify,
+            sys_linux::EventType::kCloseWrite,
             sys_linux::EventType::kMovedFrom,
             sys_linux::EventType::kMovedTo,
             sys_linux::EventType::kDelete,
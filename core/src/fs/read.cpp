@@ -6,6 +6,8 @@
 #include <userver/fs/blocking/read.hpp>
 #include <userver/utils/async.hpp>
 
+#include <engine/io/sys_linux/uring.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace fs {
@@ -18,6 +20,24 @@ bool IsHiddenFile(const boost::filesystem::path& path) {
     return name != ".." && name != "." && name[0] == '.';
 }
 
+FileInfoWithData ReadFileInfoWithDataBlocking(const std::string& path, std::size_t max_in_memory_file_size) {
+    FileInfoWithData info{};
+    info.extension = boost::filesystem::path(path).extension().string();
+
+    if (max_in_memory_file_size != kUnlimitedInMemoryFileSize) {
+        auto file = blocking::FileDescriptor::Open(path, blocking::OpenFlag::kRead);
+        info.size = file.GetSize();
+        if (info.size > max_in_memory_file_size) {
+            info.file = std::make_shared<const blocking::FileDescriptor>(std::move(file));
+            return info;
+        }
+    }
+
+    info.data = blocking::ReadFileContents(path);
+    info.size = info.data.size();
+    return info;
+}
+
 }  // namespace
 
 std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
@@ -28,13 +48,27 @@ std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
 }
 
 std::string ReadFileContents(engine::TaskProcessor& async_tp, const std::string& path) {
+#ifdef USERVER_IMPL_HAS_URING
+    if (auto* uring = engine::io::sys_linux::Uring::GetInstanceOrNull()) {
+        return uring->ReadFileContents(path);
+    }
+#endif
     return engine::AsyncNoSpan(async_tp, &fs::blocking::ReadFileContents, path).Get();
 }
 
+FileInfoWithData ReadFileInfoWithData(
+    engine::TaskProcessor& async_tp,
+    const std::string& path,
+    std::size_t max_in_memory_file_size
+) {
+    return engine::AsyncNoSpan(async_tp, &ReadFileInfoWithDataBlocking, path, max_in_memory_file_size).Get();
+}
+
 FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     engine::TaskProcessor& async_tp,
     const std::string& path,
-    utils::Flags<SettingsReadFile> flags
+    utils::Flags<SettingsReadFile> flags,
+    std::size_t max_in_memory_file_size
 ) {
     FileInfoWithDataMap data{};
     for (auto it = utils::Async(
@@ -45,9 +79,7 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
         // only files
         if (it->status().type() != boost::filesystem::regular_file) continue;
         if ((flags & SettingsReadFile::kSkipHidden) && IsHiddenFile(it->path())) continue;
-        FileInfoWithData info{};
-        info.extension = it->path().extension().string();
-        info.data = ReadFileContents(async_tp, it->path().string());
+        auto info = ReadFileInfoWithData(async_tp, it->path().string(), max_in_memory_file_size);
         data[GetLexicallyRelative(it->path().string(), path)] =
             std::make_shared<const FileInfoWithData>(std::move(info));
     }
@@ -1,5 +1,7 @@
 #include <userver/fs/write.hpp>
 
+#include <sys/stat.h>
+
 #include <fmt/format.h>
 
 #include <boost/filesystem/operations.hpp>
@@ -7,6 +9,8 @@
 #include <userver/engine/async.hpp>
 #include <userver/fs/blocking/write.hpp>
 
+#include <engine/io/sys_linux/uring.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace fs {
@@ -20,6 +24,13 @@ void CreateDirectories(engine::TaskProcessor& async_tp, std::string_view path) {
 }
 
 void RewriteFileContents(engine::TaskProcessor& async_tp, const std::string& path, std::string_view contents) {
+#ifdef USERVER_IMPL_HAS_URING
+    if (auto* uring = engine::io::sys_linux::Uring::GetInstanceOrNull()) {
+        // same permissions as in fs::blocking::FileDescriptor::Open
+        uring->RewriteFileContents(path, contents, S_IRUSR | S_IWUSR);
+        return;
+    }
+#endif
     engine::AsyncNoSpan(async_tp, &fs::blocking::RewriteFileContents, path, contents).Get();
 }
 
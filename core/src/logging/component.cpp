@@ -96,6 +96,7 @@ void Logging::Init(const ComponentConfig& config, const ComponentContext& contex
             socket_sink_ = logging::impl::GetTcpSocketSink(*logger);
         }
 
+        logger->SetPerThreadQueues(logger_config.per_thread_queues);
         logger->StartConsumerTask(
             context.GetTaskProcessor(tp_name), logger_config.message_queue_size, logger_config.queue_overflow_behavior
         );
@@ -297,6 +298,13 @@ properties:
                     enum:
                       - discard
                       - block
+                per-thread-queues:
+                    type: boolean
+                    description: |
+                        put the messages into per-thread queues that are written out in batches.
+                        Reduces the contention of the logging threads, but the messages of a task
+                        that migrated between threads may be written out of order
+                    defaultDescription: false
                 fs-task-processor:
                     type: string
                     description: task processor for disk I/O operations for this logger
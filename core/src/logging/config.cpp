@@ -44,6 +44,8 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Logg
     config.queue_overflow_behavior =
         value["overflow_behavior"].As<QueueOverflowBehavior>(config.queue_overflow_behavior);
 
+    config.per_thread_queues = value["per-thread-queues"].As<bool>(config.per_thread_queues);
+
     config.fs_task_processor = value["fs-task-processor"].As<std::optional<std::string>>();
 
     config.testsuite_capture = value["testsuite-capture"].As<std::optional<TestsuiteCaptureConfig>>();
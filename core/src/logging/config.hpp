@@ -37,6 +37,7 @@ struct LoggerConfig final {
     // must be a power of 2
     size_t message_queue_size = kDefaultMessageQueueSize;
     QueueOverflowBehavior queue_overflow_behavior = QueueOverflowBehavior::kDiscard;
+    bool per_thread_queues = false;
 
     std::optional<std::string> fs_task_processor;
 
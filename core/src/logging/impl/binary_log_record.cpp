@@ -0,0 +1,155 @@
+#include <logging/impl/binary_log_record.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+// Most of the records fit without reallocations
+constexpr std::size_t kInitialRecordCapacity = 512;
+
+enum class EntryType : std::uint8_t {
+    kString,
+    kSigned,
+    kUnsigned,
+    kFloat,
+    kDouble,
+    kText,
+};
+
+template <typename T>
+void Append(std::string& data, T value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void AppendString(std::string& data, std::string_view value) {
+    Append(data, static_cast<std::uint32_t>(value.size()));
+    data.append(value);
+}
+
+class Reader final {
+public:
+    explicit Reader(std::string_view data) noexcept : data_(data) {}
+
+    bool IsEmpty() const noexcept { return data_.empty(); }
+
+    template <typename T>
+    T Read() noexcept {
+        UASSERT(data_.size() >= sizeof(T));
+        T value;
+        std::memcpy(&value, data_.data(), sizeof(value));
+        data_.remove_prefix(sizeof(value));
+        return value;
+    }
+
+    std::string_view ReadString() noexcept {
+        const auto size = Read<std::uint32_t>();
+        UASSERT(data_.size() >= size);
+        const auto result = data_.substr(0, size);
+        data_.remove_prefix(size);
+        return result;
+    }
+
+private:
+    std::string_view data_;
+};
+
+}  // namespace
+
+BinaryFormatter::BinaryFormatter(Level level, const utils::impl::SourceLocation& location) {
+    item_.record.level = level;
+    item_.record.location = location;
+    item_.record.time = std::chrono::system_clock::now();
+    item_.record.data.reserve(kInitialRecordCapacity);
+}
+
+void BinaryFormatter::AddTag(std::string_view key, const LogExtra::Value& value) {
+    auto& data = item_.record.data;
+    std::visit(
+        [&](const auto& x) {
+            using T = std::decay_t<decltype(x)>;
+            if constexpr (std::is_same_v<T, std::string>) {
+                Append(data, EntryType::kString);
+                AppendString(data, key);
+                AppendString(data, x);
+            } else if constexpr (std::is_same_v<T, float>) {
+                // Stored separately to keep the shortest float representation
+                Append(data, EntryType::kFloat);
+                AppendString(data, key);
+                Append(data, x);
+            } else if constexpr (std::is_same_v<T, double>) {
+                Append(data, EntryType::kDouble);
+                AppendString(data, key);
+                Append(data, x);
+            } else if constexpr (std::is_signed_v<T>) {
+                Append(data, EntryType::kSigned);
+                AppendString(data, key);
+                Append(data, static_cast<long long>(x));
+            } else {
+                static_assert(std::is_unsigned_v<T>);
+                Append(data, EntryType::kUnsigned);
+                AppendString(data, key);
+                Append(data, static_cast<unsigned long long>(x));
+            }
+        },
+        value
+    );
+}
+
+void BinaryFormatter::AddTag(std::string_view key, std::string_view value) {
+    auto& data = item_.record.data;
+    Append(data, EntryType::kString);
+    AppendString(data, key);
+    AppendString(data, value);
+}
+
+void BinaryFormatter::SetText(std::string_view text) {
+    auto& data = item_.record.data;
+    Append(data, EntryType::kText);
+    AppendString(data, text);
+}
+
+void ReplayBinaryLogRecord(const BinaryLogRecord& record, formatters::Base& formatter) {
+    Reader reader{record.data};
+    while (!reader.IsEmpty()) {
+        const auto type = reader.Read<EntryType>();
+        if (type == EntryType::kText) {
+            formatter.SetText(reader.ReadString());
+            continue;
+        }
+
+        const auto key = reader.ReadString();
+        switch (type) {
+            case EntryType::kString:
+                formatter.AddTag(key, reader.ReadString());
+                break;
+            case EntryType::kSigned:
+                formatter.AddTag(key, LogExtra::Value{reader.Read<long long>()});
+                break;
+            case EntryType::kUnsigned:
+                formatter.AddTag(key, LogExtra::Value{reader.Read<unsigned long long>()});
+                break;
+            case EntryType::kFloat:
+                formatter.AddTag(key, LogExtra::Value{reader.Read<float>()});
+                break;
+            case EntryType::kDouble:
+                formatter.AddTag(key, LogExtra::Value{reader.Read<double>()});
+                break;
+            case EntryType::kText:
+                UASSERT(false);
+                break;
+        }
+    }
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <string_view>
+
+#include <userver/logging/impl/formatters/base.hpp>
+#include <userver/logging/level.hpp>
+#include <userver/utils/impl/source_location.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// @brief A log record captured without formatting
+///
+/// Tags are stored with their types, the text formatting (escaping,
+/// timestamps, numbers) is done later by ReplayBinaryLogRecord.
+struct BinaryLogRecord final {
+    Level level{Level::kNone};
+    // File and function names of the LOG_* locations have static storage
+    utils::impl::SourceLocation location{utils::impl::SourceLocation::Custom(0, {}, {})};
+    std::chrono::system_clock::time_point time{};
+    // Tags and text in the order they were added
+    std::string data;
+};
+
+struct BinaryLogItem final : formatters::LoggerItemBase {
+    BinaryLogRecord record;
+};
+
+/// Captures the tags and the text of a log record into a BinaryLogItem
+class BinaryFormatter final : public formatters::Base {
+public:
+    BinaryFormatter(Level level, const utils::impl::SourceLocation& location);
+
+    void AddTag(std::string_view key, const LogExtra::Value& value) override;
+
+    void AddTag(std::string_view key, std::string_view value) override;
+
+    void SetText(std::string_view text) override;
+
+    formatters::LoggerItemRef ExtractLoggerItem() override { return item_; }
+
+private:
+    BinaryLogItem item_;
+};
+
+/// Adds the tags and the text of the record to the formatter in the
+/// original order
+void ReplayBinaryLogRecord(const BinaryLogRecord& record, formatters::Base& formatter);
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#include <logging/impl/binary_log_record.hpp>
+
+#include <gtest/gtest.h>
+
+#include <logging/impl/formatters/json.hpp>
+#include <logging/impl/formatters/tskv.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void AddTags(logging::impl::formatters::Base& formatter) {
+    formatter.AddTag("string", std::string_view{"with\ttab\nand newline"});
+    formatter.AddTag("extra_string", logging::LogExtra::Value{std::string{"value"}});
+    formatter.AddTag("int", logging::LogExtra::Value{-42});
+    formatter.AddTag("long_long", logging::LogExtra::Value{-42LL});
+    formatter.AddTag("unsigned_long", logging::LogExtra::Value{42UL});
+    formatter.AddTag("float", logging::LogExtra::Value{0.1F});
+    formatter.AddTag("double", logging::LogExtra::Value{0.1});
+    formatter.AddTag("escaped.key", std::string_view{""});
+    formatter.SetText("some text=\\ with escaping");
+}
+
+template <typename Formatter>
+std::string FormatDirectly(logging::Format format, const logging::impl::BinaryLogRecord& record) {
+    Formatter formatter{record.level, format, record.location, record.time};
+    AddTags(formatter);
+    return std::string{static_cast<logging::impl::TextLogItem&>(formatter.ExtractLoggerItem()).log_line};
+}
+
+template <typename Formatter>
+std::string FormatReplayed(logging::Format format, const logging::impl::BinaryLogRecord& record) {
+    Formatter formatter{record.level, format, record.location, record.time};
+    logging::impl::ReplayBinaryLogRecord(record, formatter);
+    return std::string{static_cast<logging::impl::TextLogItem&>(formatter.ExtractLoggerItem()).log_line};
+}
+
+logging::impl::BinaryLogRecord Capture() {
+    logging::impl::BinaryFormatter formatter{logging::Level::kWarning, utils::impl::SourceLocation::Current()};
+    AddTags(formatter);
+    return std::move(static_cast<logging::impl::BinaryLogItem&>(formatter.ExtractLoggerItem()).record);
+}
+
+}  // namespace
+
+TEST(BinaryLogRecord, Capture) {
+    const auto record = Capture();
+    EXPECT_EQ(record.level, logging::Level::kWarning);
+    EXPECT_EQ(record.location.GetFunctionName(), "Capture");
+    EXPECT_NE(record.time, std::chrono::system_clock::time_point{});
+    EXPECT_FALSE(record.data.empty());
+}
+
+TEST(BinaryLogRecord, SameAsTskv) {
+    const auto record = Capture();
+    for (const auto format : {logging::Format::kTskv, logging::Format::kLtsv, logging::Format::kRaw}) {
+        const auto expected = FormatDirectly<logging::impl::formatters::Tskv>(format, record);
+        EXPECT_EQ(FormatReplayed<logging::impl::formatters::Tskv>(format, record), expected);
+        EXPECT_EQ(expected.find("0.10000000149011612"), std::string::npos) << expected;
+    }
+}
+
+TEST(BinaryLogRecord, SameAsJson) {
+    const auto record = Capture();
+    for (const auto format : {logging::Format::kJson, logging::Format::kJsonYaDeploy}) {
+        EXPECT_EQ(
+            FormatReplayed<logging::impl::formatters::Json>(format, record),
+            FormatDirectly<logging::impl::formatters::Json>(format, record)
+        );
+    }
+}
+
+USERVER_NAMESPACE_END
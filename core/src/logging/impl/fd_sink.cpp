@@ -1,13 +1,63 @@
 #include "fd_sink.hpp"
 
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <system_error>
+
+#include <boost/container/small_vector.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+// Always below IOV_MAX
+constexpr std::size_t kMaxIovecCount = 256;
+
+void WriteV(int fd, utils::span<const std::string_view> logs) {
+    boost::container::small_vector<::iovec, kMaxIovecCount> iovecs;
+    while (!logs.empty()) {
+        const auto count = std::min(logs.size(), kMaxIovecCount);
+        iovecs.clear();
+        for (const auto log : logs.first(count)) {
+            iovecs.push_back({const_cast<char*>(log.data()), log.size()});
+        }
+        logs = logs.subspan(count);
+
+        auto* iov = iovecs.data();
+        auto* const iov_end = iov + iovecs.size();
+        while (iov != iov_end) {
+            ::ssize_t s = ::writev(fd, iov, static_cast<int>(iov_end - iov));
+            if (s < 0) {
+                if (errno == EAGAIN || errno == EINTR) continue;
+
+                const auto code = std::make_error_code(std::errc{errno});
+                throw std::system_error(code, "calling ::writev");
+            }
+
+            // Skip the written buffers and adjust a partially written one
+            for (; iov != iov_end && static_cast<std::size_t>(s) >= iov->iov_len; ++iov) {
+                s -= iov->iov_len;
+            }
+            if (iov != iov_end) {
+                iov->iov_base = static_cast<char*>(iov->iov_base) + s;
+                iov->iov_len -= s;
+            }
+        }
+    }
+}
+
+}  // namespace
+
 FdSink::FdSink(fs::blocking::FileDescriptor fd) : fd_{std::move(fd)} {}
 
 void FdSink::Write(std::string_view log) { fd_.Write(log); }
 
+void FdSink::WriteBatch(utils::span<const std::string_view> logs) { WriteV(fd_.GetNative(), logs); }
+
 void FdSink::Flush() {
     if (fd_.IsOpen()) {
         fd_.FSync();
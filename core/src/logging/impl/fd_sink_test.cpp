@@ -1,5 +1,9 @@
 #include "fd_sink.hpp"
 
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
 #include <gmock/gmock.h>
 
 #include <userver/engine/async.hpp>
@@ -72,4 +76,34 @@ UTEST(FdSink, PipeSinkLogMulti) {
     read_task.Get();
 }
 
+UTEST(FdSink, PipeSinkLogBatch) {
+    // More than fits into a single writev call
+    constexpr std::size_t kMessagesCount = 1000;
+
+    std::vector<std::string> payloads;
+    std::vector<std::string> expected;
+    for (std::size_t i = 0; i < kMessagesCount; ++i) {
+        payloads.push_back(fmt::format("message {}\n", i));
+        if (i % 3 != 0) expected.push_back(fmt::format("message {}", i));
+    }
+
+    std::vector<logging::impl::LogMessage> messages;
+    for (std::size_t i = 0; i < kMessagesCount; ++i) {
+        messages.push_back({payloads[i], i % 3 == 0 ? logging::Level::kDebug : logging::Level::kWarning});
+    }
+
+    engine::io::Pipe fd_pipe{};
+
+    auto read_task = engine::AsyncNoSpan([&fd_pipe, &expected] {
+        const auto result = test::ReadFromFd(fs::blocking::FileDescriptor::AdoptFd(fd_pipe.reader.Release()));
+        EXPECT_EQ(result, expected);
+    });
+    {
+        auto sink = logging::impl::FdSink{fs::blocking::FileDescriptor::AdoptFd(fd_pipe.writer.Release())};
+        sink.SetLevel(logging::Level::kInfo);
+        EXPECT_NO_THROW(sink.Log(messages));
+    }
+    read_task.Get();
+}
+
 USERVER_NAMESPACE_END
@@ -7,6 +7,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/logging/logger.hpp>
 
+#include <logging/impl/binary_log_record.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -20,7 +21,17 @@ public:
     void Flush() override {}
 };
 
-class PrependedTagLogger final : public NoopLogger {
+// Captures records without formatting, like TpLogger does
+class NoopDeferredLogger : public NoopLogger {
+public:
+    logging::impl::formatters::BasePtr
+    MakeFormatter(logging::Level level, logging::LogClass, const utils::impl::SourceLocation& location) override {
+        return std::make_unique<logging::impl::BinaryFormatter>(level, location);
+    }
+};
+
+template <typename Base>
+class PrependedTagLogger final : public Base {
 public:
     void PrependCommonTags(logging::impl::TagWriter writer) const override {
         writer.PutTag("aaaaaaaaaaaaaaaaaa", "value");
@@ -139,14 +150,28 @@ BENCHMARK_REGISTER_F(LogHelperBenchmark, LogMultipleStrings)
     ->RangeMultiplier(2)
     ->Ranges({{4, 32}, {4, 32}});
 
+template <typename Logger>
 void LogPrependedTags(benchmark::State& state) {
-    const logging::DefaultLoggerGuard guard{std::make_shared<PrependedTagLogger>()};
+    const logging::DefaultLoggerGuard guard{std::make_shared<PrependedTagLogger<Logger>>()};
 
     for ([[maybe_unused]] auto _ : state) {
         LOG_INFO() << "";
     }
 }
-BENCHMARK(LogPrependedTags);
+BENCHMARK_TEMPLATE(LogPrependedTags, NoopLogger);
+BENCHMARK_TEMPLATE(LogPrependedTags, NoopDeferredLogger);
+
+template <typename Logger>
+void LogStringWithTags(benchmark::State& state) {
+    const logging::DefaultLoggerGuard guard{std::make_shared<Logger>()};
+    const auto msg = Launder(std::string(state.range(0), '*'));
+
+    for ([[maybe_unused]] auto _ : state) {
+        LOG_INFO() << msg << logging::LogExtra{{"id", 42}, {"name", "value\twith\tescaping"}, {"ratio", 0.5}};
+    }
+}
+BENCHMARK_TEMPLATE(LogStringWithTags, NoopLogger)->Arg(8)->Arg(1024);
+BENCHMARK_TEMPLATE(LogStringWithTags, NoopDeferredLogger)->Arg(8)->Arg(1024);
 
 }  // namespace
 
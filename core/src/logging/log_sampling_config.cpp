@@ -0,0 +1,83 @@
+#include "log_sampling_config.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/logging/level_serialization.hpp>
+#include <userver/tracing/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging {
+
+namespace {
+
+// Trace ids are random hex strings, the last digits are enough
+constexpr std::size_t kTraceIdDigits = 4;
+constexpr std::uint32_t kTraceIdBuckets = 1 << (4 * kTraceIdDigits);
+
+std::optional<std::uint32_t> ParseHexSuffix(std::string_view trace_id) noexcept {
+    if (trace_id.size() < kTraceIdDigits) return std::nullopt;
+
+    std::uint32_t result = 0;
+    for (const char c : trace_id.substr(trace_id.size() - kTraceIdDigits)) {
+        std::uint32_t digit = 0;
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            digit = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            digit = c - 'A' + 10;
+        } else {
+            return std::nullopt;
+        }
+        result = result * 16 + digit;
+    }
+    return result;
+}
+
+}  // namespace
+
+bool operator==(const LogSamplingConfig& a, const LogSamplingConfig& b) {
+    return a.enabled == b.enabled && a.settings == b.settings;
+}
+
+LogSamplingConfig Parse(const formats::json::Value& value, formats::parse::To<LogSamplingConfig>) {
+    LogSamplingConfig result;
+    auto& settings = result.settings;
+
+    result.enabled = value["enabled"].As<bool>(result.enabled);
+    settings.max_level = value["max-level"].As<logging::Level>(settings.max_level);
+    settings.burst = value["per-location-burst"].As<std::size_t>(settings.burst);
+    settings.per_second = value["per-location-rps"].As<std::size_t>(settings.per_second);
+    settings.traces_percent = value["sampled-traces-percent"].As<double>(settings.traces_percent);
+    settings.queue_pressure_threshold =
+        value["queue-pressure-threshold"].As<double>(settings.queue_pressure_threshold);
+
+    // You can not sample out WARNING and ERROR logs
+    if (settings.max_level > logging::Level::kInfo) {
+        settings.max_level = logging::Level::kInfo;
+    }
+
+    return result;
+}
+
+bool IsTraceSampledIn(std::string_view trace_id, double traces_percent) noexcept {
+    if (traces_percent <= 0) return false;
+    if (traces_percent >= 100) return true;
+
+    const auto suffix = ParseHexSuffix(trace_id);
+    const std::uint32_t bucket = suffix ? *suffix : std::hash<std::string_view>{}(trace_id) % kTraceIdBuckets;
+    return bucket < traces_percent / 100 * kTraceIdBuckets;
+}
+
+bool IsCurrentTraceSampledIn(double traces_percent) noexcept {
+    const auto* const span = tracing::Span::CurrentSpanUnchecked();
+    return span && IsTraceSampledIn(span->GetTraceId(), traces_percent);
+}
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
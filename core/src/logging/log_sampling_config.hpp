@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string_view>
+
+#include <userver/formats/parse/to.hpp>
+
+#include <logging/log_sampling.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+class Value;
+}
+
+namespace logging {
+
+struct LogSamplingConfig {
+    bool enabled{false};
+    impl::LogSamplingSettings settings;
+};
+
+bool operator==(const LogSamplingConfig& a, const LogSamplingConfig& b);
+
+LogSamplingConfig Parse(const formats::json::Value&, formats::parse::To<LogSamplingConfig>);
+
+// Depends only on the trace id, so all the services sample in the same traces
+bool IsTraceSampledIn(std::string_view trace_id, double traces_percent) noexcept;
+
+bool IsCurrentTraceSampledIn(double traces_percent) noexcept;
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,126 @@
+#include <logging/log_sampling_config.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+#include <logging/logging_test.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::size_t CountSubstrings(std::string_view text, std::string_view substr) {
+    std::size_t result = 0;
+    for (auto pos = text.find(substr); pos != std::string_view::npos; pos = text.find(substr, pos + 1)) {
+        ++result;
+    }
+    return result;
+}
+
+logging::impl::LogSamplingSettings MakeSettings(std::size_t burst, double traces_percent) {
+    logging::impl::LogSamplingSettings settings;
+    settings.burst = burst;
+    settings.per_second = 0;
+    settings.traces_percent = traces_percent;
+    return settings;
+}
+
+}  // namespace
+
+TEST(LogSampling, Parse) {
+    const auto config = formats::json::FromString(R"({
+        "enabled": true,
+        "max-level": "debug",
+        "per-location-burst": 5,
+        "per-location-rps": 2,
+        "sampled-traces-percent": 0.5,
+        "queue-pressure-threshold": 0.8
+    })")
+                            .As<logging::LogSamplingConfig>();
+
+    EXPECT_TRUE(config.enabled);
+    EXPECT_EQ(config.settings.max_level, logging::Level::kDebug);
+    EXPECT_EQ(config.settings.burst, 5);
+    EXPECT_EQ(config.settings.per_second, 2);
+    EXPECT_EQ(config.settings.traces_percent, 0.5);
+    EXPECT_EQ(config.settings.queue_pressure_threshold, 0.8);
+
+    const auto defaults = formats::json::FromString(R"({"max-level": "error"})").As<logging::LogSamplingConfig>();
+    EXPECT_FALSE(defaults.enabled);
+    EXPECT_EQ(defaults.settings.max_level, logging::Level::kInfo);
+}
+
+TEST(LogSampling, TraceSampledIn) {
+    std::size_t sampled_in = 0;
+    for (unsigned i = 0; i < 0x10000; ++i) {
+        const auto trace_id = fmt::format("{:032x}", i);
+        EXPECT_FALSE(logging::IsTraceSampledIn(trace_id, 0));
+        EXPECT_TRUE(logging::IsTraceSampledIn(trace_id, 100));
+        EXPECT_EQ(logging::IsTraceSampledIn(trace_id, 1), logging::IsTraceSampledIn(trace_id, 1));
+        if (logging::IsTraceSampledIn(trace_id, 1)) ++sampled_in;
+    }
+    EXPECT_EQ(sampled_in, 656);
+}
+
+TEST(LogSampling, QueuePressure) {
+    logging::impl::EnableLogSampling(MakeSettings(0, 0));
+    const utils::FastScopeGuard disable_guard([]() noexcept { logging::impl::DisableLogSampling(); });
+
+    EXPECT_FALSE(logging::impl::IsDroppedUnderQueuePressure(logging::Level::kDebug, 0.4));
+    EXPECT_TRUE(logging::impl::IsDroppedUnderQueuePressure(logging::Level::kDebug, 0.5));
+    EXPECT_FALSE(logging::impl::IsDroppedUnderQueuePressure(logging::Level::kInfo, 0.5));
+    EXPECT_TRUE(logging::impl::IsDroppedUnderQueuePressure(logging::Level::kInfo, 0.75));
+    EXPECT_FALSE(logging::impl::IsDroppedUnderQueuePressure(logging::Level::kWarning, 1.0));
+}
+
+TEST_F(LoggingTest, LogSamplingPerLocation) {
+    SetDefaultLoggerLevel(logging::Level::kInfo);
+    logging::impl::SetTraceSampledInHook(nullptr);
+    logging::impl::EnableLogSampling(MakeSettings(3, 0));
+    const utils::FastScopeGuard disable_guard([]() noexcept { logging::impl::DisableLogSampling(); });
+
+    for (int i = 0; i < 10; ++i) {
+        LOG_INFO() << "sampled info";
+        LOG_WARNING() << "never sampled warning";
+    }
+    logging::impl::DisableLogSampling();
+    LOG_INFO() << "sampled info";
+
+    logging::LogFlush();
+    EXPECT_EQ(CountSubstrings(GetStreamString(), "sampled info"), 4);
+    EXPECT_EQ(CountSubstrings(GetStreamString(), "never sampled warning"), 10);
+}
+
+UTEST_F(LoggingTest, LogSamplingTraces) {
+    SetDefaultLoggerLevel(logging::Level::kInfo);
+    logging::impl::SetTraceSampledInHook(&logging::IsCurrentTraceSampledIn);
+    const utils::FastScopeGuard hook_guard([]() noexcept { logging::impl::SetTraceSampledInHook(nullptr); });
+
+    logging::impl::EnableLogSampling(MakeSettings(1, 100));
+    const utils::FastScopeGuard disable_guard([]() noexcept { logging::impl::DisableLogSampling(); });
+
+    {
+        const tracing::Span span{"sampled_in"};
+        for (int i = 0; i < 10; ++i) {
+            LOG_INFO() << "trace-in info";
+        }
+    }
+
+    logging::impl::EnableLogSampling(MakeSettings(1, 0));
+    {
+        const tracing::Span span{"sampled_out"};
+        for (int i = 0; i < 10; ++i) {
+            LOG_INFO() << "trace-out info";
+        }
+    }
+
+    logging::LogFlush();
+    EXPECT_EQ(CountSubstrings(GetStreamString(), "trace-in info"), 10);
+    EXPECT_EQ(CountSubstrings(GetStreamString(), "trace-out info"), 1);
+}
+
+USERVER_NAMESPACE_END
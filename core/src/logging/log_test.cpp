@@ -51,6 +51,23 @@ TEST_F(LoggingTest, LogExtraExtendType) {
     EXPECT_EQ(log_contents.find("key1=value3"), std::string::npos);
 }
 
+TEST_F(LoggingTest, LogExtraExtendWithLogExtra) {
+    SetDefaultLoggerLevel(logging::Level::kTrace);
+
+    logging::LogExtra log_extra{{"frozen", "old"}, {"normal", "old"}};
+    log_extra.SetFrozen("frozen");
+
+    const logging::LogExtra other{{"frozen", "new"}, {"normal", "new"}, {"added", "new"}};
+    log_extra.Extend(other);
+    LOG_TRACE() << log_extra;
+
+    logging::LogFlush();
+    const auto log_contents = GetStreamString();
+    EXPECT_NE(log_contents.find("frozen=old"), std::string::npos);
+    EXPECT_NE(log_contents.find("normal=new"), std::string::npos);
+    EXPECT_NE(log_contents.find("added=new"), std::string::npos);
+}
+
 TEST_F(LoggingTest, MultipleFlushes) {
     SetDefaultLoggerLevel(logging::Level::kTrace);
 
@@ -1,8 +1,13 @@
 #include "tp_logger.hpp"
 
+#include <iterator>
+#include <new>
+#include <typeinfo>
+
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
+#include <logging/log_sampling.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
@@ -10,16 +15,34 @@
 #include <userver/tracing/span.hpp>
 #include <userver/utils/enumerate.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/overloaded.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+constexpr std::size_t kMaxBatchSize = 128;
+
+std::string_view GetText(formatters::LoggerItemRef item) {
+    UASSERT(dynamic_cast<impl::TextLogItem*>(&item));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    return static_cast<impl::TextLogItem&>(item).log_line;
+}
+
+}  // namespace
+
 struct TpLogger::ActionVisitor final {
     TpLogger& logger;
 
     void operator()(impl::async::Log&& log) const {
-        logger.AccountLogConsumed();
+        logger.AccountLogsConsumed(1);
+        logger.BackendLog(log.level, log.payload);
+    }
+
+    void operator()(impl::async::DeferredLog&& log) const {
+        logger.AccountLogsConsumed(1);
         logger.BackendLog(std::move(log));
     }
 
@@ -27,6 +50,10 @@ struct TpLogger::ActionVisitor final {
         // The consumer thread will check state_ later.
     }
 
+    void operator()(impl::async::Wakeup&&) const noexcept {
+        // The records are consumed before each action.
+    }
+
     void operator()(impl::async::ReopenCoro&& reopen) const noexcept {
         try {
             logger.BackendReopen(reopen.reopen_mode);
@@ -48,6 +75,9 @@ struct TpLogger::ActionVisitor final {
 TpLogger::TpLogger(Format format, std::string logger_name)
     : impl::TextLogger(format), logger_name_(std::move(logger_name)) {
     SetLevel(logging::Level::kInfo);
+    batch_records_.reserve(kMaxBatchSize);
+    batch_entries_.reserve(kMaxBatchSize);
+    batch_messages_.reserve(kMaxBatchSize);
 }
 
 void TpLogger::StartConsumerTask(
@@ -88,6 +118,11 @@ TpLogger::~TpLogger() {
     );
 }
 
+void TpLogger::SetPerThreadQueues(bool enabled) noexcept {
+    UASSERT_MSG(state_.load() == State::kSync, "SetPerThreadQueues must be called before StartConsumerTask");
+    per_thread_queues_ = enabled;
+}
+
 void TpLogger::StopConsumerTask() {
     auto expected = State::kAsync;
     if (!state_.compare_exchange_strong(expected, State::kStoppingAsync)) {
@@ -126,37 +161,41 @@ void TpLogger::Flush() {
 
 impl::LogStatistics& TpLogger::GetStatistics() noexcept { return stats_; }
 
+formatters::BasePtr
+TpLogger::MakeFormatter(Level level, LogClass, const utils::impl::SourceLocation& location) {
+    return std::make_unique<BinaryFormatter>(level, location);
+}
+
 void TpLogger::Log(Level level, impl::formatters::LoggerItemRef item) {
-    UASSERT(dynamic_cast<impl::TextLogItem*>(&item));
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-    auto& msg = static_cast<impl::TextLogItem&>(item);
     ++stats_.by_level[static_cast<std::size_t>(level)];
 
     if (GetSinks().empty()) {
         return;
     }
 
-    if (TryWaitFreeQueueCapacity()) {
-        // The queue might have concurrently become full, in which case the size
-        // will temporarily go over the max size. The actual number of log actions
-        // in queue_ will not typically go over max_size + n_threads.
-        produced_->fetch_add(1);
-
-        try {
-            Push(impl::async::Log{level, std::string{msg.log_line}});
-        } catch (const std::exception&) {
-            // failed to construct a Log action or a node in Push
-            produced_->fetch_sub(1);
-            throw;
-        }
+    // Both classes are final, so the check is cheaper than a dynamic_cast
+    if (typeid(item) == typeid(BinaryLogItem)) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+        auto& binary = static_cast<BinaryLogItem&>(item);
+        PushLog(impl::async::DeferredLog{level, std::move(binary.record)});
     } else {
-        ++stats_.dropped;
+        // Preformatted records, for example access logs
+        UASSERT(dynamic_cast<impl::TextLogItem*>(&item));
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+        auto& msg = static_cast<impl::TextLogItem&>(item);
+        PushLog(impl::async::Log{level, std::string{msg.log_line}});
     }
 }
 
 void TpLogger::PrependCommonTags(TagWriter writer) const { impl::default_::PrependCommonTags(writer); }
 
-bool TpLogger::DoShouldLog(Level level) const noexcept { return impl::default_::DoShouldLog(level); }
+bool TpLogger::DoShouldLog(Level level) const noexcept {
+    if (impl::IsLogSamplingEnabled() && impl::IsDroppedUnderQueuePressure(level, GetQueueFillRatio())) {
+        ++stats_.dropped;
+        return false;
+    }
+    return impl::default_::DoShouldLog(level);
+}
 
 void TpLogger::AddSink(impl::SinkPtr&& sink) {
     UASSERT(sink);
@@ -187,13 +226,22 @@ void TpLogger::ProcessingLoop() {
 
     while (true) {
         ConsumeQueueOnce(queue_consumer_);
+        ConsumeRecords();
         if (state_ != State::kAsync) {
             UASSERT(state_ == State::kStoppingAsync);
             break;
         }
-        queue_.WaitWhileEmpty(queue_consumer_);
+
+        consumer_sleeping_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (records_.size_approx() == 0) {
+            queue_.WaitWhileEmpty(queue_consumer_);
+        }
+        consumer_sleeping_.store(false, std::memory_order_relaxed);
     }
 
+    // Records enqueued before the state change
+    ConsumeRecords();
     CleanUpQueue(std::move(queue_consumer_));
 }
 
@@ -205,6 +253,11 @@ void TpLogger::BackendPerform(impl::async::Action&& action) noexcept {
     }
 }
 
+double TpLogger::GetQueueFillRatio() const noexcept {
+    const auto queue_size = produced_->load(std::memory_order_relaxed) - consumed_->load(std::memory_order_relaxed);
+    return static_cast<double>(queue_size) / max_queue_size_.load(std::memory_order_relaxed);
+}
+
 bool TpLogger::HasFreeQueueCapacity() noexcept {
     return produced_->load() - consumed_->load() < max_queue_size_.load();
 }
@@ -226,6 +279,48 @@ bool TpLogger::TryWaitFreeQueueCapacity() {
     return true;
 }
 
+void TpLogger::PushLog(impl::async::LogRecord&& record) {
+    if (TryWaitFreeQueueCapacity()) {
+        // The queue might have concurrently become full, in which case the size
+        // will temporarily go over the max size. The actual number of log actions
+        // in queue_ will not typically go over max_size + n_threads.
+        produced_->fetch_add(1);
+
+        bool needs_wakeup = false;
+        try {
+            if (state_.load() == State::kAsync && per_thread_queues_) {
+                needs_wakeup = EnqueueRecord(std::move(record));
+            } else {
+                Push(std::visit([](auto&& log) -> impl::async::Action { return std::move(log); }, std::move(record)));
+            }
+        } catch (const std::exception&) {
+            // failed to construct a node in Push or a block of records_
+            produced_->fetch_sub(1);
+            throw;
+        }
+
+        if (needs_wakeup) {
+            Push(impl::async::Wakeup{});
+        }
+    } else {
+        ++stats_.dropped;
+    }
+}
+
+bool TpLogger::EnqueueRecord(impl::async::LogRecord&& record) {
+    if (!records_.enqueue(std::move(record))) {
+        throw std::bad_alloc();
+    }
+
+    // Pairs with the fence in ProcessingLoop: either the consumer sees the
+    // record before falling asleep, or we see that it is asleep. A record
+    // enqueued concurrently with StopConsumerTask is consumed by whoever
+    // consumes the Wakeup.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return state_.load(std::memory_order_relaxed) != State::kAsync ||
+           (consumer_sleeping_.load(std::memory_order_relaxed) && consumer_sleeping_.exchange(false));
+}
+
 void TpLogger::Push(impl::async::Action&& action) {
     auto node = std::make_unique<impl::async::ActionNode>();
     node->action = std::move(action);
@@ -239,8 +334,8 @@ void TpLogger::DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
     }
 }
 
-void TpLogger::AccountLogConsumed() noexcept {
-    consumed_->store(consumed_->load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+void TpLogger::AccountLogsConsumed(QueueSize count) noexcept {
+    consumed_->store(consumed_->load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
     if (overflow_policy_.load() == QueueOverflowBehavior::kBlock) {
         {
             // Atomic consumed_ mutation doesn't need to be protected by lock.
@@ -250,13 +345,20 @@ void TpLogger::AccountLogConsumed() noexcept {
             //    not fall asleep
             const std::lock_guard lock{capacity_waiters_mutex_};
         }
-        capacity_waiters_cv_.NotifyOne();
+        if (count == 1) {
+            capacity_waiters_cv_.NotifyOne();
+        } else {
+            capacity_waiters_cv_.NotifyAll();
+        }
     }
 }
 
 void TpLogger::ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
     auto& action_node = static_cast<impl::async::ActionNode&>(node);
+
+    // The records were logged before the action
+    ConsumeRecords();
     if (&action_node == &stop_node_) return;
 
     BackendPerform(std::move(action_node.action));
@@ -269,14 +371,83 @@ void TpLogger::ConsumeQueueOnce(Queue::Consumer& consumer) noexcept {
     }
 }
 
+void TpLogger::ConsumeRecords() noexcept {
+    while (true) {
+        batch_records_.clear();
+        const auto count = records_.try_dequeue_bulk(std::back_inserter(batch_records_), kMaxBatchSize);
+        if (count == 0) return;
+
+        BackendLogBatch();
+        AccountLogsConsumed(static_cast<QueueSize>(count));
+    }
+}
+
 void TpLogger::CleanUpQueue(Queue::Consumer&& consumer) noexcept {
     std::move(consumer).ConsumeAndStop([this](auto& node) noexcept { ConsumeNode(node); });
 }
 
-void TpLogger::BackendLog(impl::async::Log&& action) const {
+formatters::BasePtr TpLogger::MakeRecordFormatter(const BinaryLogRecord& record) const {
+    auto formatter = MakeTextFormatter(record.level, record.location, record.time);
+    ReplayBinaryLogRecord(record, *formatter);
+    return formatter;
+}
+
+void TpLogger::BackendLog(impl::async::DeferredLog&& action) const {
+    const auto formatter = MakeRecordFormatter(action.record);
+    BackendLog(action.level, GetText(formatter->ExtractLoggerItem()));
+}
+
+void TpLogger::BackendLogBatch() noexcept {
+    batch_buffer_.clear();
+    batch_entries_.clear();
+    bool should_flush = false;
+
+    const auto append = [&](Level level, std::string_view payload) {
+        batch_entries_.push_back({batch_buffer_.size(), payload.size(), level});
+        batch_buffer_.append(payload);
+        should_flush = should_flush || ShouldFlush(level);
+    };
+
+    for (auto& record : batch_records_) {
+        try {
+            std::visit(
+                utils::Overloaded{
+                    [&](impl::async::Log& log) { append(log.level, log.payload); },
+                    [&](impl::async::DeferredLog& log) {
+                        const auto formatter = MakeRecordFormatter(log.record);
+                        append(log.level, GetText(formatter->ExtractLoggerItem()));
+                    },
+                },
+                record
+            );
+        } catch (const std::exception& e) {
+            UASSERT_MSG(false, fmt::format("Exception while formatting a log message: {}", e.what()));
+        }
+    }
+
+    // The buffer does not grow anymore, views into it stay valid
+    batch_messages_.clear();
+    for (const auto& entry : batch_entries_) {
+        batch_messages_.push_back({std::string_view{batch_buffer_}.substr(entry.offset, entry.size), entry.level});
+    }
+
+    for (const auto& sink : GetSinks()) {
+        try {
+            sink->Log(batch_messages_);
+        } catch (const std::exception& e) {
+            UASSERT_MSG(false, "While writing a log message caught an exception: " + std::string(e.what()));
+        }
+    }
+
+    if (should_flush) {
+        BackendFlush();
+    }
+}
+
+void TpLogger::BackendLog(Level level, std::string_view payload) const {
     LogMessage message;
-    message.payload = action.payload;
-    message.level = action.level;
+    message.payload = payload;
+    message.level = level;
 
     for (const auto& sink : GetSinks()) {
         try {
@@ -9,6 +9,8 @@
 #include <variant>
 #include <vector>
 
+#include <moodycamel/concurrentqueue.h>
+
 #include <userver/engine/condition_variable.hpp>
 #include <userver/engine/future.hpp>
 #include <userver/engine/mutex.hpp>
@@ -19,6 +21,7 @@
 #include <engine/impl/async_flat_combining_queue.hpp>
 #include <logging/config.hpp>
 #include <logging/impl/base_sink.hpp>
+#include <logging/impl/binary_log_record.hpp>
 #include <logging/impl/reopen_mode.hpp>
 #include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/concurrent/impl/intrusive_hooks.hpp>
@@ -38,6 +41,12 @@ struct Log {
     std::chrono::system_clock::time_point time{std::chrono::system_clock::now()};
 };
 
+// Formatted on the consumer side
+struct DeferredLog {
+    Level level{};
+    BinaryLogRecord record;
+};
+
 struct FlushCoro {
     engine::Promise<void> promise;
 };
@@ -53,7 +62,12 @@ struct ReopenCoro {
 
 struct Stop {};
 
-using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, ReopenCoro>;
+// Notifies the consumer about new records in the worker queues
+struct Wakeup {};
+
+using Action = std::variant<Stop, Wakeup, Log, DeferredLog, FlushCoro, FlushThreaded, ReopenCoro>;
+
+using LogRecord = std::variant<Log, DeferredLog>;
 
 struct ActionNode final : public concurrent::impl::SinglyLinkedBaseHook {
     Action action{Stop{}};
@@ -62,6 +76,16 @@ struct ActionNode final : public concurrent::impl::SinglyLinkedBaseHook {
 }  // namespace async
 
 /// @brief Asynchronous logger that logs into a specific TaskProcessor.
+///
+/// Records of LogHelper are captured in a binary form and are formatted into
+/// text by the consumer task, not by the logging coroutine.
+///
+/// With SetPerThreadQueues(true), records logged in async mode go to
+/// per-thread lock-free queues and the consumer task drains them in batches,
+/// a batch is written to each sink at once. Records of a single thread keep
+/// their order, but records of a task that migrated between threads may be
+/// written out of order. Flushes, reopens, records logged in sync mode and all
+/// the records by default go through the common queue in the logging order.
 class TpLogger final : public TextLogger {
 public:
     TpLogger(Format format, std::string logger_name);
@@ -75,6 +99,12 @@ public:
 
     void StopConsumerTask();
 
+    /// Must be called before StartConsumerTask
+    void SetPerThreadQueues(bool enabled) noexcept;
+
+    formatters::BasePtr MakeFormatter(Level level, LogClass log_class, const utils::impl::SourceLocation& location)
+        override;
+
     void Log(Level level, impl::formatters::LoggerItemRef msg) override;
     void Flush() override;
     void PrependCommonTags(TagWriter writer) const override;
@@ -102,17 +132,31 @@ private:
     using Queue = engine::impl::AsyncFlatCombiningQueue;
     using QueueSize = std::int64_t;
 
+    struct BatchEntry {
+        std::size_t offset{0};
+        std::size_t size{0};
+        Level level{};
+    };
+
     void ProcessingLoop();
     bool HasFreeQueueCapacity() noexcept;
+    double GetQueueFillRatio() const noexcept;
     bool TryWaitFreeQueueCapacity();
+    void PushLog(impl::async::LogRecord&& record);
+    // Returns true if the consumer has to be woken up
+    bool EnqueueRecord(impl::async::LogRecord&& record);
     void Push(impl::async::Action&& action);
     void DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
     void ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
     void ConsumeQueueOnce(Queue::Consumer& consumer) noexcept;
+    void ConsumeRecords() noexcept;
     void CleanUpQueue(Queue::Consumer&& consumer) noexcept;
-    void AccountLogConsumed() noexcept;
+    void AccountLogsConsumed(QueueSize count) noexcept;
     void BackendPerform(impl::async::Action&& action) noexcept;
-    void BackendLog(impl::async::Log&& action) const;
+    formatters::BasePtr MakeRecordFormatter(const BinaryLogRecord& record) const;
+    void BackendLog(Level level, std::string_view payload) const;
+    void BackendLog(impl::async::DeferredLog&& action) const;
+    void BackendLogBatch() noexcept;
     void BackendFlush() const;
     void BackendReopen(ReopenMode reopen_mode) const;
 
@@ -130,8 +174,20 @@ private:
     Queue::Consumer queue_consumer_;
     // A dummy action used for notifying the async task during stopping.
     impl::async::ActionNode stop_node_;
+    std::atomic<bool> consumer_sleeping_{false};
+    // Written before the consumer is started, read only in async mode
+    bool per_thread_queues_{false};
+
+    // Used only by the current consumer of queue_
+    std::vector<impl::async::LogRecord> batch_records_;
+    std::string batch_buffer_;
+    std::vector<BatchEntry> batch_entries_;
+    std::vector<LogMessage> batch_messages_;
 
     Queue queue_;
+    // Implicit producers of the queue are per-thread, so the task processor
+    // workers do not contend on enqueue
+    moodycamel::ConcurrentQueue<impl::async::LogRecord> records_;
     concurrent::impl::InterferenceShield<std::atomic<QueueSize>> produced_{0};
     concurrent::impl::InterferenceShield<std::atomic<QueueSize>> consumed_{0};
 };
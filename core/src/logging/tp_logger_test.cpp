@@ -44,7 +44,8 @@ public:
 
     std::shared_ptr<logging::impl::TpLogger> StartAsyncLogger(
         std::size_t queue_size_max = 10,
-        QueueOverflowBehavior on_overflow = QueueOverflowBehavior::kDiscard
+        QueueOverflowBehavior on_overflow = QueueOverflowBehavior::kDiscard,
+        bool per_thread_queues = false
     ) {
         UASSERT_MSG(
             engine::current_task::IsTaskProcessorThread(), "Misconfigured test. Should be run in coroutine environment"
@@ -56,6 +57,7 @@ public:
             writer = logger->GetStatistics();
         });
 
+        logger->SetPerThreadQueues(per_thread_queues);
         logger->StartConsumerTask(engine::current_task::GetTaskProcessor(), queue_size_max, on_overflow);
 
         // Tracing should not break the TpLogger
@@ -564,6 +566,29 @@ UTEST_F(LoggingTestCoro, TpLoggerFlush) {
     EXPECT_EQ(GetRecordsCount(), 4);
 }
 
+UTEST_F(LoggingTestCoro, TpLoggerAsyncBatchesKeepOrder) {
+    // More than a single batch of the consumer
+    constexpr std::size_t kRecordsCount = 1000;
+    auto logger = StartAsyncLogger(kRecordsCount, QueueOverflowBehavior::kDiscard, /* per_thread_queues= */ true);
+
+    for (std::size_t i = 0; i < kRecordsCount; ++i) {
+        LOG_INFO_TO(logger) << "record-" << i << "-end";
+    }
+    logger->Flush();
+
+    const auto logs = GetStreamString();
+    std::size_t position = 0;
+    for (std::size_t i = 0; i < kRecordsCount; ++i) {
+        const auto next = logs.find(fmt::format("text=record-{}-end", i), position);
+        ASSERT_NE(next, std::string::npos) << "record " << i << " is missing or out of order";
+        position = next;
+    }
+    EXPECT_EQ(GetRecordsCount(), kRecordsCount);
+
+    logger->StopConsumerTask();
+    EXPECT_EQ(GetMetric("dropped"), 0);
+}
+
 UTEST_F(LoggingTestCoro, TpLoggerFlushMultiple) {
     constexpr std::size_t kQueueSize = 16;
     auto logger = StartAsyncLogger(kQueueSize);
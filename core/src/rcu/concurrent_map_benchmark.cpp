@@ -0,0 +1,61 @@
+#include <userver/rcu/concurrent_map.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::uint64_t kKeyCount = 1000;
+
+// Arguments: thread count, the percentage of writes. Each write is an erase
+// and an insert of a key, the rest of the operations are lookups.
+template <typename Map>
+void concurrent_map_mixed(benchmark::State& state) {
+    const auto write_percent = static_cast<std::uint64_t>(state.range(1));
+
+    engine::RunStandalone(state.range(0), [&] {
+        Map map;
+        for (std::uint64_t key = 0; key < kKeyCount; ++key) {
+            map.Emplace(key, key);
+        }
+
+        std::atomic<std::uint64_t> thread_index{0};
+        RunParallelBenchmark(state, [&](auto& range) {
+            // Different threads write different keys in the same order
+            std::uint64_t i = thread_index++ * 7919;
+            for ([[maybe_unused]] auto _ : range) {
+                const auto key = i % kKeyCount;
+                if (i % 100 < write_percent) {
+                    map.Erase(key);
+                    map.Emplace(key, key);
+                } else {
+                    benchmark::DoNotOptimize(map.Get(key));
+                }
+                ++i;
+            }
+        });
+    });
+}
+
+void Arguments(benchmark::internal::Benchmark* benchmark) {
+    for (const auto threads : {1, 4}) {
+        for (const auto write_percent : {0, 1, 10, 50}) {
+            benchmark->Args({threads, write_percent});
+        }
+    }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(concurrent_map_mixed, rcu::RcuMap<std::uint64_t, std::uint64_t>)->Apply(Arguments);
+BENCHMARK_TEMPLATE(concurrent_map_mixed, rcu::ConcurrentMap<std::uint64_t, std::uint64_t>)->Apply(Arguments);
+
+USERVER_NAMESPACE_END
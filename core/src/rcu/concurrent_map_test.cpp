@@ -0,0 +1,210 @@
+#include <userver/rcu/concurrent_map.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(ConcurrentMap, Modify) {
+    rcu::ConcurrentMap<std::string, int> map;
+    const auto& cmap = map;
+
+    EXPECT_EQ(0, map.SizeApprox());
+    EXPECT_FALSE(map.Get("any"));
+    EXPECT_FALSE(cmap.Get("any"));
+    EXPECT_FALSE(map.Erase("any"));
+    EXPECT_FALSE(map.Pop("any"));
+
+    EXPECT_TRUE(map.Insert("any", std::make_shared<int>(3)).inserted);
+    EXPECT_FALSE(map.Insert("any", std::make_shared<int>(0)).inserted);
+    EXPECT_EQ(*map.Insert("any", std::make_shared<int>(0)).value, 3);
+    EXPECT_EQ(*cmap.Get("any"), 3);
+    EXPECT_EQ(1, map.SizeApprox());
+    EXPECT_EQ(*map.Pop("any"), 3);
+    EXPECT_EQ(0, map.SizeApprox());
+
+    EXPECT_TRUE(map.Emplace("any", 4).inserted);
+    EXPECT_FALSE(map.Emplace("any", 0).inserted);
+    EXPECT_EQ(*map.Emplace("any", 0).value, 4);
+    EXPECT_TRUE(map.Erase("any"));
+    EXPECT_FALSE(map.Erase("any"));
+
+    EXPECT_TRUE(map.TryEmplace("any", 5).inserted);
+    EXPECT_FALSE(map.TryEmplace("any", 0).inserted);
+    EXPECT_EQ(*map.TryEmplace("any", 0).value, 5);
+
+    map.InsertOrAssign("any", std::make_shared<int>(6));
+    EXPECT_EQ(*map.Get("any"), 6);
+    EXPECT_EQ(1, map.SizeApprox());
+
+    map.Clear();
+    EXPECT_FALSE(map.Get("any"));
+    EXPECT_EQ(0, map.SizeApprox());
+}
+
+UTEST(ConcurrentMap, Snapshot) {
+    rcu::ConcurrentMap<int, int> map;
+    EXPECT_TRUE(map.GetSnapshot().empty());
+
+    map.Emplace(1, 10);
+    map.Emplace(2, 20);
+    const auto snapshot = map.GetSnapshot();
+
+    map.InsertOrAssign(1, std::make_shared<int>(11));
+    map.Erase(2);
+
+    EXPECT_EQ(snapshot.size(), 2);
+    EXPECT_EQ(*snapshot.at(1), 10);
+    EXPECT_EQ(*snapshot.at(2), 20);
+    EXPECT_EQ(map.GetSnapshot().size(), 1);
+}
+
+UTEST(ConcurrentMap, Grow) {
+    constexpr int kSize = 10'000;
+    rcu::ConcurrentMap<int, int> map;
+
+    for (int i = 0; i < kSize; ++i) {
+        EXPECT_TRUE(map.Emplace(i, i).inserted);
+    }
+    EXPECT_EQ(map.SizeApprox(), kSize);
+
+    for (int i = 0; i < kSize; ++i) {
+        ASSERT_TRUE(map.Get(i));
+        EXPECT_EQ(*map.Get(i), i);
+    }
+
+    // Tombstones are dropped on rehash, so the table does not grow forever
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < kSize; ++i) {
+            EXPECT_TRUE(map.Erase(i));
+            EXPECT_TRUE(map.Emplace(i, i + round).inserted);
+        }
+    }
+    EXPECT_EQ(map.SizeApprox(), kSize);
+    EXPECT_EQ(*map.Get(kSize - 1), kSize - 1 + 9);
+}
+
+UTEST(ConcurrentMap, Lifetime) {
+    struct Counted {
+        explicit Counted(std::atomic<int>& counter) : counter(counter) { ++counter; }
+        ~Counted() { --counter; }
+
+        std::atomic<int>& counter;
+    };
+
+    std::atomic<int> counter{0};
+    {
+        rcu::ConcurrentMap<int, Counted> map;
+        const auto value = map.Emplace(1, counter).value;
+        EXPECT_TRUE(map.Erase(1));
+        EXPECT_EQ(counter, 1);
+
+        for (int i = 0; i < 100; ++i) {
+            map.Emplace(i, counter);
+            map.Erase(i);
+        }
+        map.Cleanup();
+        EXPECT_EQ(counter, 1);  // held by 'value'
+
+        map.Emplace(2, counter);
+        map.Emplace(3, counter);
+    }
+    EXPECT_EQ(counter, 0);
+}
+
+UTEST_MT(ConcurrentMap, ConcurrentUpdates, 4) {
+    constexpr std::size_t kWriters = 3;
+    constexpr int kKeysPerWriter = 1000;
+
+    rcu::ConcurrentMap<int, int> map;
+    std::atomic<bool> keep_running{true};
+
+    auto reader = engine::AsyncNoSpan([&] {
+        while (keep_running) {
+            for (int key = 0; key < static_cast<int>(kWriters) * kKeysPerWriter; ++key) {
+                // Values always match the keys they are stored by
+                if (const auto value = map.Get(key)) {
+                    EXPECT_EQ(*value, key);
+                }
+            }
+            engine::Yield();
+        }
+    });
+
+    std::vector<engine::TaskWithResult<void>> writers;
+    for (std::size_t i = 0; i < kWriters; ++i) {
+        writers.push_back(engine::AsyncNoSpan([&map, i] {
+            const int first_key = static_cast<int>(i) * kKeysPerWriter;
+            for (int round = 0; round < 5; ++round) {
+                for (int key = first_key; key < first_key + kKeysPerWriter; ++key) {
+                    EXPECT_TRUE(map.Emplace(key, key).inserted);
+                }
+                for (int key = first_key; key < first_key + kKeysPerWriter; key += 2) {
+                    EXPECT_EQ(*map.Pop(key), key);
+                }
+                for (int key = first_key + 1; key < first_key + kKeysPerWriter; key += 2) {
+                    map.InsertOrAssign(key, std::make_shared<int>(key));
+                    EXPECT_TRUE(map.Erase(key));
+                }
+            }
+        }));
+    }
+
+    for (auto& writer : writers) writer.Get();
+    keep_running = false;
+    reader.Get();
+
+    EXPECT_EQ(map.SizeApprox(), 0);
+    EXPECT_TRUE(map.GetSnapshot().empty());
+}
+
+UTEST_MT(ConcurrentMap, ConcurrentTryEmplace, 8) {
+    constexpr std::size_t kTasks = 16;
+    rcu::ConcurrentMap<std::string, std::size_t> map;
+    std::atomic<std::size_t> insertions = 0;
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i < kTasks; i++) {
+        tasks.push_back(engine::AsyncNoSpan([&map, &insertions, i] {
+            auto res = map.TryEmplace(std::string(20 + i / 2, 'x'), i);
+            if (res.inserted) ++insertions;
+            EXPECT_EQ(*res.value / 2, i / 2);
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    EXPECT_EQ(insertions, kTasks / 2);
+}
+
+UTEST(ConcurrentMap, Sample) {
+    /// [Sample rcu::ConcurrentMap usage]
+    struct Session {
+        std::atomic<int> requests{0};
+    };
+
+    rcu::ConcurrentMap<std::string, Session> sessions;
+
+    // Keys are inserted without copying the map
+    sessions.TryEmplace("alice");
+    sessions.TryEmplace("bob");
+
+    if (const auto session = sessions.Get("alice")) {
+        ++session->requests;
+    }
+
+    // The removed value stays alive as long as someone holds it
+    const auto bob = sessions.Pop("bob");
+    EXPECT_EQ(bob->requests, 0);
+    EXPECT_FALSE(sessions.Get("bob"));
+    /// [Sample rcu::ConcurrentMap usage]
+
+    EXPECT_EQ(sessions.Get("alice")->requests, 1);
+}
+
+USERVER_NAMESPACE_END
@@ -14,10 +14,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
-template <int VariableCount>
+template <int VariableCount, typename RcuTraits = rcu::DefaultRcuTraits>
 void rcu_read(benchmark::State& state) {
     engine::RunStandalone([&] {
-        rcu::Variable<std::uint64_t> vars[VariableCount];
+        rcu::Variable<std::uint64_t, RcuTraits> vars[VariableCount];
         {
             std::uint64_t i = 0;
             for (auto& var : vars) {
@@ -37,11 +37,12 @@ void rcu_read(benchmark::State& state) {
 BENCHMARK_TEMPLATE(rcu_read, 1);
 BENCHMARK_TEMPLATE(rcu_read, 2);
 BENCHMARK_TEMPLATE(rcu_read, 4);
+BENCHMARK_TEMPLATE(rcu_read, 1, rcu::EpochRcuTraits);
 
-template <int VariableCount>
+template <int VariableCount, typename RcuTraits = rcu::DefaultRcuTraits>
 void rcu_write(benchmark::State& state) {
     engine::RunStandalone([&] {
-        rcu::Variable<std::uint64_t> vars[VariableCount];
+        rcu::Variable<std::uint64_t, RcuTraits> vars[VariableCount];
 
         std::uint64_t i = 0;
         for ([[maybe_unused]] auto _ : state) {
@@ -53,7 +54,9 @@ void rcu_write(benchmark::State& state) {
 BENCHMARK_TEMPLATE(rcu_write, 1);
 BENCHMARK_TEMPLATE(rcu_write, 2);
 BENCHMARK_TEMPLATE(rcu_write, 4);
+BENCHMARK_TEMPLATE(rcu_write, 1, rcu::EpochRcuTraits);
 
+template <typename RcuTraits>
 void rcu_contention(benchmark::State& state) {
     const std::size_t readers_count = state.range(0);
     const std::size_t writers_count = state.range(1);
@@ -63,14 +66,14 @@ void rcu_contention(benchmark::State& state) {
 
     engine::RunStandalone(thread_count, [&] {
         std::atomic<bool> run{true};
-        rcu::Variable<std::uint64_t> var{0};
+        rcu::Variable<std::uint64_t, RcuTraits> var{0};
 
         std::vector<engine::TaskWithResult<void>> tasks;
         tasks.reserve(readers_count - 1 + writers_count);
 
         for (std::size_t j = 0; j < readers_count - 1; j++) {
             tasks.push_back(utils::Async("reader", [&] {
-                std::vector<rcu::ReadablePtr<std::uint64_t>> pointers;
+                std::vector<rcu::ReadablePtr<std::uint64_t, RcuTraits>> pointers;
                 pointers.reserve(kept_readable_pointers_count);
 
                 while (run) {
@@ -94,7 +97,7 @@ void rcu_contention(benchmark::State& state) {
         }
 
         {
-            std::queue<rcu::ReadablePtr<std::uint64_t>> pointers;
+            std::queue<rcu::ReadablePtr<std::uint64_t, RcuTraits>> pointers;
             for (std::size_t i = 0; i < kept_readable_pointers_count; i++) {
                 pointers.push(var.Read());
             }
@@ -112,7 +115,11 @@ void rcu_contention(benchmark::State& state) {
         }
     });
 }
-BENCHMARK(rcu_contention)
+BENCHMARK_TEMPLATE(rcu_contention, rcu::DefaultRcuTraits)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 16}, {0, 1}, {1, 4}})
+    ->Ranges({{2048, 2048}, {0, 1}, {1, 4}});
+BENCHMARK_TEMPLATE(rcu_contention, rcu::EpochRcuTraits)
     ->RangeMultiplier(2)
     ->Ranges({{1, 16}, {0, 1}, {1, 4}})
     ->Ranges({{2048, 2048}, {0, 1}, {1, 4}});
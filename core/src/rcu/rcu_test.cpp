@@ -1,9 +1,13 @@
 #include <userver/rcu/rcu.hpp>
 
 #include <atomic>
+#include <cstdint>
 #include <future>
+#include <optional>
 #include <stdexcept>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include <engine/task/task_context.hpp>
 #include <userver/engine/sleep.hpp>
@@ -315,6 +319,105 @@ UTEST(Rcu, ParallelCleanup) {
     }
 }
 
+UTEST(Rcu, EpochReadWrite) {
+    rcu::Variable<std::pair<int, int>, rcu::EpochRcuTraits> ptr(std::make_pair(1, 2));
+
+    auto reader = ptr.Read();
+    {
+        auto writer = ptr.StartWrite();
+        writer->second = 3;
+        writer.Commit();
+    }
+    EXPECT_EQ(std::make_pair(1, 2), *reader);
+    EXPECT_EQ(std::make_pair(1, 3), ptr.ReadCopy());
+
+    ptr.Assign(std::make_pair(4, 5));
+    EXPECT_EQ(std::make_pair(1, 2), *reader);
+    EXPECT_EQ(std::make_pair(4, 5), ptr.ReadCopy());
+}
+
+UTEST(Rcu, EpochLifetime) {
+    using Counted = Counted<struct EpochLifetimeTag>;
+
+    {
+        rcu::Variable<Counted, rcu::EpochRcuTraits> ptr;
+        EXPECT_EQ(1, Counted::counter);
+
+        std::optional<rcu::ReadablePtr<Counted, rcu::EpochRcuTraits>> reader;
+        reader.emplace(ptr.Read());
+        for (int i = 0; i < 100; ++i) {
+            ptr.Emplace();
+        }
+
+        // The reader holds back the epoch, so the retired values are kept
+        EXPECT_GT(Counted::counter, 2);
+        EXPECT_EQ(1, (*reader)->value);
+
+        ptr.Cleanup();
+        EXPECT_GT(Counted::counter, 2);
+
+        reader.reset();
+        ptr.Cleanup();
+        EXPECT_EQ(1, Counted::counter);
+
+        // Writes free the retired values in batches
+        for (int i = 0; i < 100; ++i) {
+            ptr.Emplace();
+        }
+        EXPECT_LE(Counted::counter, 1 + 2 * rcu::impl::kEpochRetireBatchSize);
+    }
+    EXPECT_EQ(0, Counted::counter);
+}
+
+UTEST_MT(Rcu, EpochConcurrentReadWrite, 4) {
+    constexpr int kReaders = 2;
+    constexpr int kWriters = 2;
+    constexpr int kIterations = 10000;
+
+    // A value with an invariant that breaks if a reader sees a freed value
+    struct Pair {
+        std::uint64_t first;
+        std::uint64_t second;
+    };
+    rcu::Variable<Pair, rcu::EpochRcuTraits> ptr(Pair{0, 0});
+
+    std::atomic<bool> keep_running{true};
+    std::vector<engine::TaskWithResult<void>> tasks;
+
+    for (int i = 0; i < kReaders; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&] {
+            while (keep_running) {
+                const auto reader = ptr.Read();
+                const auto value = *reader;
+                EXPECT_EQ(value.first, value.second);
+                engine::Yield();
+                EXPECT_EQ(reader->first, value.first);
+                EXPECT_EQ(reader->second, value.second);
+            }
+        }));
+    }
+
+    std::vector<engine::TaskWithResult<void>> writers;
+    for (int i = 0; i < kWriters; ++i) {
+        writers.push_back(engine::AsyncNoSpan([&] {
+            for (int j = 0; j < kIterations; ++j) {
+                auto writer = ptr.StartWrite();
+                ++writer->first;
+                ++writer->second;
+                writer.Commit();
+            }
+        }));
+    }
+
+    for (auto& writer : writers) writer.Get();
+    keep_running = false;
+    for (auto& task : tasks) task.Get();
+
+    const auto result = ptr.ReadCopy();
+    EXPECT_EQ(result.first, std::uint64_t{kIterations * kWriters});
+    EXPECT_EQ(result.second, result.first);
+}
+
 UTEST_MT(Rcu, CopyReadablePtr, 4) {
     constexpr int kThreads = 4;
 
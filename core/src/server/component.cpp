@@ -37,9 +37,15 @@ Server::Server(
         statistics_storage.RegisterWriter("http.handler.total", [this](utils::statistics::Writer& writer) {
             return server_->WriteTotalHandlerStatistics(writer);
         });
+
+    auto* secdist = component_context.FindComponentOptional<components::Secdist>();
+    if (secdist) {
+        secdist_subscription_ = secdist->GetStorage().UpdateAndListen(this, kName, &Server::OnSecdistUpdate);
+    }
 }
 
 Server::~Server() {
+    secdist_subscription_.Unsubscribe();
     server_statistics_holder_.Unregister();
     handler_statistics_holder_.Unregister();
 }
@@ -65,6 +71,10 @@ void Server::AddHandler(const server::handlers::HttpHandlerBase& handler, engine
 
 void Server::WriteStatistics(utils::statistics::Writer& writer) { server_->WriteMonitorData(writer); }
 
+void Server::OnSecdistUpdate(const storages::secdist::SecdistConfig& secdist) {
+    server_->UpdateTlsSessionTicketKeys(secdist);
+}
+
 yaml_config::Schema Server::GetStaticConfigSchema() {
     return yaml_config::MergeSchemas<ComponentBase>(R"(
 type: object
@@ -112,6 +122,37 @@ properties:
                 type: integer
                 description: max count of new connections pending acceptance
                 defaultDescription: 1024
+            accept-shedding:
+                type: object
+                description: shedding of new connections while the listener task processor is overloaded
+                additionalProperties: false
+                properties:
+                    mode:
+                        type: string
+                        description: what to do with new connections under overload
+                        defaultDescription: none
+                        enum:
+                          - none
+                          - pause
+                          - reset
+                          - defer-tls
+                    overload-percent:
+                        type: number
+                        description: percent of tasks that waited in queue longer than the task processor sensor_wait_queue_time_limit to consider it overloaded
+                        defaultDescription: 5
+                    check-interval:
+                        type: string
+                        description: how often the overload state is refreshed
+                        defaultDescription: 100ms
+                    overload-backlog:
+                        type: integer
+                        description: listen backlog to use while accepting is paused
+                        defaultDescription: 16
+                        minimum: 1
+                    max-tls-defer:
+                        type: string
+                        description: max time to postpone a TLS handshake for
+                        defaultDescription: 1s
             tls: &ports-tls
                 type: object
                 description: TLS settings
@@ -132,6 +173,10 @@ properties:
                     private-key-passphrase-name:
                         type: string
                         description: passphrase name located in secdist
+                    kernel-offload:
+                        type: boolean
+                        description: hand the TLS encryption to the kernel (kTLS) after the handshake
+                        defaultDescription: false
             ports:
                description: settings of listener ports
                type: array
@@ -200,6 +245,11 @@ properties:
                         type: integer
                         description: drop requests from handlers that allow throttling if there's more pending requests than allowed by this value
                         defaultDescription: 100
+                    max_pipelined_requests_in_flight:
+                        type: integer
+                        description: max number of pipelined HTTP/1.1 requests of a connection that are handled concurrently
+                        defaultDescription: 1
+                        minimum: 1
                     keepalive_timeout:
                         type: integer
                         description: timeout in seconds to drop connection if there's not data received from it
@@ -231,9 +281,21 @@ properties:
                                 type: integer
                                 description: the initial window size of the server
                                 defaultDescription: 65536
+                            connection_window_size:
+                                type: integer
+                                description: the flow-control window of the whole connection
+                                defaultDescription: 65535
+                            rfc9218_priorities:
+                                type: boolean
+                                description: prioritize streams by the RFC 9218 'priority' header and PRIORITY_UPDATE frames instead of the deprecated RFC 7540 priorities
+                                defaultDescription: false
             shards:
                 type: integer
                 description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+            thread-per-core:
+                type: boolean
+                description: run each shard with its connections and requests on a dedicated single-threaded task processor bound to its own ev thread
+                defaultDescription: false
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
@@ -52,6 +52,44 @@ Sensor::Data Sensor::FetchCurrent() {
     };
 }
 
+QueueWaitSensor::QueueWaitSensor(engine::TaskProcessor& tp) : tp_(tp) {
+    // Enables the queue wait time sampling in the task processor
+    [[maybe_unused]] const auto ignored = tp_.CollectMinQueueWaitTime();
+}
+
+void QueueWaitSensor::RegisterRequestsSource(RequestsSource& source) {
+    auto requests_sources = requests_sources_.StartWrite();
+    requests_sources->push_back(&source);
+    requests_sources.Commit();
+}
+
+QueueWaitSensor::Data QueueWaitSensor::GetCurrent() {
+    const bool first_fetch = last_fetch_tp_ == std::chrono::steady_clock::time_point{};
+    auto now = std::chrono::steady_clock::now();
+    auto duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - last_fetch_tp_);
+    if (duration_ms.count() == 0) duration_ms = std::chrono::milliseconds(1);
+
+    std::uint64_t requests{0};
+    auto requests_sources = requests_sources_.Read();
+    for (const auto& source : *requests_sources) requests += source->GetTotalRequests();
+    const auto total = requests - last_requests_;
+    const auto rps = total * kSecond / duration_ms;
+
+    // No sampled tasks means that the task processor is idle
+    const auto min_queue_wait_time = tp_.CollectMinQueueWaitTime().value_or(std::chrono::microseconds{0});
+
+    last_fetch_tp_ = now;
+    last_requests_ = requests;
+
+    Data result;
+    if (!first_fetch) {
+        result.total = total;
+        result.current_load = rps;
+        result.min_queue_wait_time = min_queue_wait_time;
+    }
+    return result;
+}
+
 }  // namespace server::congestion_control
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,80 @@
+#include <userver/server/handlers/cpu_profiler.hpp>
+
+#include <chrono>
+
+#include <userver/components/component_config.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+#include <utils/cpu_profiler.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::chrono::seconds kCollectInterval{1};
+
+}  // namespace
+
+CpuProfiler::CpuProfiler(const components::ComponentConfig& config, const components::ComponentContext& context)
+    : HttpHandlerBase(config, context, /*is_monitor = */ true),
+      sampling_frequency_(config["sampling-frequency"].As<std::size_t>(utils::cpu_profiler::Settings{}.frequency)),
+      max_samples_(config["max-samples"].As<std::size_t>(utils::cpu_profiler::Settings{}.max_samples)) {
+    collect_task_.Start(
+        "cpu_profiler_collector",
+        utils::PeriodicTask::Settings(kCollectInterval, {}, logging::Level::kTrace),
+        [] { utils::cpu_profiler::Collect(); }
+    );
+}
+
+CpuProfiler::~CpuProfiler() {
+    collect_task_.Stop();
+    utils::cpu_profiler::Stop();
+}
+
+std::string CpuProfiler::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const {
+    const auto& command = request.GetPathArg("command");
+    if (command == "start") {
+        if (!utils::cpu_profiler::Start({sampling_frequency_, max_samples_})) {
+            request.SetResponseStatus(server::http::HttpStatus::kConflict);
+            return "CPU profiler is already running\n";
+        }
+        LOG_INFO() << "CPU profiler started";
+        return "OK\n";
+    }
+    if (command == "stop") {
+        utils::cpu_profiler::Stop();
+        LOG_INFO() << "CPU profiler stopped";
+        return "OK\n";
+    }
+    if (command == "dump") {
+        return utils::cpu_profiler::GetFoldedStacks();
+    }
+
+    request.SetResponseStatus(server::http::HttpStatus::kNotFound);
+    return "Unsupported command. Supported commands are: start, stop, dump\n";
+}
+
+yaml_config::Schema CpuProfiler::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
+type: object
+description: handler-cpu-profiler config
+additionalProperties: false
+properties:
+    sampling-frequency:
+        type: integer
+        description: samples per second of CPU time consumed by the process
+        defaultDescription: 100
+        minimum: 1
+    max-samples:
+        type: integer
+        description: samples buffered between the aggregations done once a second, the rest are dropped
+        defaultDescription: 5000
+        minimum: 1
+)");
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
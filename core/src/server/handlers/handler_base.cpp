@@ -95,6 +95,14 @@ properties:
         type: integer
         description: integer to limit RPS to this handler
         defaultDescription: <no limit>
+    max_rate_limited_clients:
+        type: integer
+        description: |
+            enables the per-client limits of USERVER_HANDLER_CLIENT_RATE_LIMITS
+            dynamic config for this handler, the value is the approximate max
+            count of the clients tracked at once
+        minimum: 1
+        defaultDescription: <per-client limits are disabled>
     decompress_request:
         type: boolean
         description: allow decompression of the requests
@@ -111,6 +119,10 @@ properties:
         type: boolean
         description: TODO
         defaultDescription: false
+    request-body-stream:
+        type: boolean
+        description: pass the HTTP/1.1 request body to the handler in chunks as it arrives, see server::http::HttpRequest::GetRequestBodyStream()
+        defaultDescription: false
     monitor-handler:
         type: boolean
         description: overrides the in-code `is_monitor` flag that makes the handler run either on 'server.listener' or on 'server.listener-monitor'
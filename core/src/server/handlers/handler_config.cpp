@@ -72,11 +72,13 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
     config.response_data_size_log_limit =
         value["response_data_size_log_limit"].As<size_t>(handler_defaults.response_data_size_log_limit);
     config.max_requests_per_second = value["max_requests_per_second"].As<std::optional<size_t>>();
+    config.max_rate_limited_clients = value["max_rate_limited_clients"].As<std::optional<size_t>>();
     config.decompress_request = value["decompress_request"].As<bool>(true);
     config.throttling_enabled = value["throttling_enabled"].As<bool>(true);
     config.set_response_server_hostname = value["set-response-server-hostname"].As<std::optional<bool>>();
 
     config.response_body_stream = value["response-body-stream"].As<bool>(false);
+    config.request_body_stream = value["request-body-stream"].As<bool>(false);
 
     if (config.max_requests_per_second && config.max_requests_per_second.value() <= 0) {
         throw std::runtime_error(
@@ -5,6 +5,7 @@
 #include <boost/container/small_vector.hpp>
 
 #include <server/handlers/http_handler_base_statistics.hpp>
+#include <server/middlewares/flat_pipeline.hpp>
 #include <server/middlewares/handler_adapter.hpp>
 #include <server/request/internal_request_context.hpp>
 #include <server/server_config.hpp>
@@ -262,8 +263,8 @@ void HttpHandlerBase::PrepareAndHandleRequest(http::HttpRequest& http_request, r
 
     context.GetInternalContext().SetConfigSnapshot(config_source_.GetSnapshot());
     try {
-        UASSERT(first_middleware_);
-        first_middleware_->HandleRequest(http_request, context);
+        UASSERT(middlewares_pipeline_);
+        middlewares_pipeline_->HandleRequest(http_request, context);
     } catch (const std::exception& ex) {
         UASSERT_MSG(
             false,
@@ -491,12 +492,18 @@ void HttpHandlerBase::BuildMiddlewarePipeline(
 
     ValidateMiddlewaresConfiguration(middlewares_config, handler_middlewares);
 
-    auto* next_middleware_ptr_{&first_middleware_};
-    const auto add_middleware = [this, &middlewares_config, &context, &next_middleware_ptr_](std::string_view name) {
-        *next_middleware_ptr_ = context.FindComponent<middlewares::HttpMiddlewareFactoryBase>(name).CreateChecked(
+    middlewares_pipeline_ = std::make_unique<middlewares::FlatPipeline>();
+    middlewares_pipeline_->Reserve(handler_middlewares.size() + 1);
+    const auto add_middleware = [this, &middlewares_config, &context](std::string_view name) {
+        auto middleware = context.FindComponent<middlewares::HttpMiddlewareFactoryBase>(name).CreateChecked(
             *this, middlewares_config[name]
         );
-        next_middleware_ptr_ = &(*next_middleware_ptr_)->next_;
+        // Settings of the handler are static, a no-op middleware stays no-op
+        // for every request and is not worth a call
+        if (!middlewares_pipeline_->Append(std::move(middleware))) {
+            LOG_DEBUG() << "Middleware '" << name << "' is a no-op for handler '" << handler_name_
+                        << "', excluding it from the pipeline";
+        }
     };
 
     for (const auto& middleware_name : handler_middlewares) {
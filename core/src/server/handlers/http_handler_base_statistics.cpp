@@ -2,6 +2,7 @@
 
 #include <algorithm>
 
+#include <userver/engine/cached_steady_clock.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -21,9 +22,24 @@ void DumpMetric(utils::statistics::Writer& writer, HttpHandlerStatisticsHelper h
     writer["in-flight"] = stats.in_flight;
     writer["too-many-requests-in-flight"] = stats.too_many_requests_in_flight;
     writer["rate-limit-reached"] = stats.rate_limit_reached;
+    writer["congestion-control-limited"] = stats.congestion_control_limited;
     writer["deadline-received"] = stats.deadline_received;
     writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
     writer["timings"] = stats.timings;
+    if (stats.task_timings_accounted) {
+        // Totals over all the requests, divide by `requests` for the average
+        auto task_timings = writer["task-timings"];
+        task_timings["requests"] = stats.task_timings_accounted;
+        task_timings["queue-wait-us"] = stats.task_queue_wait_us;
+        task_timings["running-us"] = stats.task_running_us;
+        task_timings["suspended-us"] = stats.task_suspended_us;
+    }
+}
+
+utils::statistics::Rate ToMicroseconds(std::chrono::nanoseconds duration) noexcept {
+    return {static_cast<utils::statistics::Rate::ValueType>(
+        std::chrono::duration_cast<std::chrono::microseconds>(duration).count()
+    )};
 }
 
 }  // namespace
@@ -33,6 +49,12 @@ void HttpHandlerMethodStatistics::Account(const HttpHandlerStatisticsEntry& stat
     timings_.GetCurrentCounter().Account(stats.timing.count());
     if (stats.deadline.IsReachable()) ++deadline_received_;
     if (stats.cancelled_by_deadline) ++cancelled_by_deadline_;
+    if (stats.task_timings) {
+        ++task_timings_accounted_;
+        task_queue_wait_us_.Add(ToMicroseconds(stats.task_timings->queue_wait));
+        task_running_us_.Add(ToMicroseconds(stats.task_timings->running));
+        task_suspended_us_.Add(ToMicroseconds(stats.task_timings->suspended));
+    }
 }
 
 std::size_t HttpHandlerMethodStatistics::GetInFlight() const noexcept {
@@ -52,8 +74,13 @@ HttpHandlerStatisticsSnapshot::HttpHandlerStatisticsSnapshot(const HttpHandlerMe
       finished(stats.finished_.Load()),
       too_many_requests_in_flight(stats.too_many_requests_in_flight_.Load()),
       rate_limit_reached(stats.rate_limit_reached_.Load()),
+      congestion_control_limited(stats.congestion_control_limited_.Load()),
       deadline_received(stats.deadline_received_.Load()),
-      cancelled_by_deadline(stats.cancelled_by_deadline_.Load()) {}
+      cancelled_by_deadline(stats.cancelled_by_deadline_.Load()),
+      task_timings_accounted(stats.task_timings_accounted_.Load()),
+      task_queue_wait_us(stats.task_queue_wait_us_.Load()),
+      task_running_us(stats.task_running_us_.Load()),
+      task_suspended_us(stats.task_suspended_us_.Load()) {}
 
 void HttpHandlerStatisticsSnapshot::Add(const HttpHandlerStatisticsSnapshot& other) {
     timings.Add(other.timings);
@@ -62,8 +89,13 @@ void HttpHandlerStatisticsSnapshot::Add(const HttpHandlerStatisticsSnapshot& oth
     finished += other.finished;
     too_many_requests_in_flight += other.too_many_requests_in_flight;
     rate_limit_reached += other.rate_limit_reached;
+    congestion_control_limited += other.congestion_control_limited;
     deadline_received += other.deadline_received;
     cancelled_by_deadline += other.cancelled_by_deadline;
+    task_timings_accounted += other.task_timings_accounted;
+    task_queue_wait_us += other.task_queue_wait_us;
+    task_running_us += other.task_running_us;
+    task_suspended_us += other.task_suspended_us;
 }
 
 void DumpMetric(utils::statistics::Writer& writer, const HttpHandlerStatisticsSnapshot& stats) {
@@ -88,7 +120,7 @@ HttpHandlerStatisticsScope::HttpHandlerStatisticsScope(
     http::HttpMethod method,
     server::http::HttpResponse& response
 )
-    : stats_(stats), method_(method), start_time_(std::chrono::steady_clock::now()), response_(response) {
+    : stats_(stats), method_(method), start_time_(engine::CachedSteadyClock::now()), response_(response) {
     stats_.ForMethod(method).IncrementInFlight();
 }
 
@@ -101,6 +133,7 @@ HttpHandlerStatisticsScope::~HttpHandlerStatisticsScope() {
     stats.timing = std::chrono::duration_cast<std::chrono::milliseconds>(finish_time - start_time_);
     stats.deadline = data ? data->deadline : engine::Deadline{};
     stats.cancelled_by_deadline = cancelled_by_deadline_;
+    stats.task_timings = engine::current_task::GetTimings();
     stats_.ForMethod(method_).Account(stats);
     stats_.ForMethod(method_).DecrementInFlight();
 }
@@ -3,16 +3,19 @@
 #include <array>
 #include <chrono>
 #include <cstddef>
+#include <optional>
 #include <type_traits>
 
 #include <server/http/handler_methods.hpp>
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/task/current_task.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_status.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/rate.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/striped_rate_counter.hpp>
 #include <utils/statistics/http_codes.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -25,6 +28,8 @@ struct HttpHandlerStatisticsEntry final {
     std::chrono::milliseconds timing{};
     engine::Deadline deadline{};
     bool cancelled_by_deadline{false};
+    // Of the whole request task, including its wait in the queue before start
+    std::optional<engine::TaskTimings> task_timings{};
 };
 
 struct HttpHandlerStatisticsSnapshot;
@@ -45,6 +50,8 @@ public:
 
     void IncrementRateLimitReached() noexcept { ++rate_limit_reached_; }
 
+    void IncrementCongestionControlLimited() noexcept { ++congestion_control_limited_; }
+
 private:
     friend struct HttpHandlerStatisticsSnapshot;
 
@@ -53,12 +60,18 @@ private:
 
     RecentPeriod timings_;
     utils::statistics::HttpCodes reply_codes_;
-    utils::statistics::RateCounter started_;
-    utils::statistics::RateCounter finished_;
+    // Bumped by each request
+    utils::statistics::StripedRateCounter started_;
+    utils::statistics::StripedRateCounter finished_;
     utils::statistics::RateCounter too_many_requests_in_flight_;
     utils::statistics::RateCounter rate_limit_reached_;
-    utils::statistics::RateCounter deadline_received_;
+    utils::statistics::RateCounter congestion_control_limited_;
+    utils::statistics::StripedRateCounter deadline_received_;
     utils::statistics::RateCounter cancelled_by_deadline_;
+    utils::statistics::StripedRateCounter task_timings_accounted_;
+    utils::statistics::StripedRateCounter task_queue_wait_us_;
+    utils::statistics::StripedRateCounter task_running_us_;
+    utils::statistics::StripedRateCounter task_suspended_us_;
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const HttpHandlerMethodStatistics& stats);
@@ -76,8 +89,13 @@ struct HttpHandlerStatisticsSnapshot final {
     utils::statistics::Rate finished;
     utils::statistics::Rate too_many_requests_in_flight;
     utils::statistics::Rate rate_limit_reached;
+    utils::statistics::Rate congestion_control_limited;
     utils::statistics::Rate deadline_received;
     utils::statistics::Rate cancelled_by_deadline;
+    utils::statistics::Rate task_timings_accounted;
+    utils::statistics::Rate task_queue_wait_us;
+    utils::statistics::Rate task_running_us;
+    utils::statistics::Rate task_suspended_us;
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const HttpHandlerStatisticsSnapshot& stats);
@@ -1,5 +1,6 @@
 #include <userver/server/handlers/http_handler_json_base.hpp>
 
+#include <userver/components/component_config.hpp>
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/http/content_type.hpp>
@@ -10,7 +11,7 @@
 #include <userver/server/handlers/legacy_json_error_builder.hpp>
 #include <userver/server/http/http_error.hpp>
 #include <userver/server/http/http_status.hpp>
-#include <userver/yaml_config/schema.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -19,11 +20,18 @@ namespace server::handlers {
 namespace {
 
 const std::string kRequestDataName = "__request_json";
+const std::string kRequestLazyDataName = "__request_lazy_json";
 const std::string kResponseDataName = "__response_json";
 const std::string kSerializeJson = "serialize_json";
 
 const formats::json::Value kEmptyJson{};
 
+[[noreturn]] void ThrowInvalidJsonBody(const formats::json::Exception& e) {
+    throw RequestParseError(
+        InternalMessage{"Invalid JSON body"}, ExternalBody{std::string("Invalid JSON body: ") + e.what()}
+    );
+}
+
 }  // namespace
 
 HttpHandlerJsonBase::HttpHandlerJsonBase(
@@ -31,27 +39,52 @@ HttpHandlerJsonBase::HttpHandlerJsonBase(
     const components::ComponentContext& component_context,
     bool is_monitor
 )
-    : HttpHandlerBase(config, component_context, is_monitor) {}
+    : HttpHandlerBase(config, component_context, is_monitor),
+      lazy_request_json_(config["lazy-request-json"].As<bool>(false)) {}
 
 std::string HttpHandlerJsonBase::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext& context)
     const {
-    const auto& request_json = context.GetData<const formats::json::Value&>(kRequestDataName);
-
     auto& response = request.GetHttpResponse();
     response.SetContentType(USERVER_NAMESPACE::http::content_type::kApplicationJson);
 
-    const auto& response_json = context.SetData<formats::json::Value>(
-        kResponseDataName, HandleRequestJsonThrow(request, request_json, context)
-    );
+    formats::json::Value* response_json = nullptr;
+    if (lazy_request_json_) {
+        const auto& request_json = context.GetData<const formats::json::LazyValue&>(kRequestLazyDataName);
+        try {
+            response_json = &context.SetData<formats::json::Value>(
+                kResponseDataName, HandleRequestLazyJsonThrow(request, request_json, context)
+            );
+        } catch (const formats::json::ParseException& e) {
+            // Values are validated on access only
+            ThrowInvalidJsonBody(e);
+        }
+    } else {
+        const auto& request_json = context.GetData<const formats::json::Value&>(kRequestDataName);
+        response_json = &context.SetData<formats::json::Value>(
+            kResponseDataName, HandleRequestJsonThrow(request, request_json, context)
+        );
+    }
 
     const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime(kSerializeJson);
-    return formats::json::ToString(response_json);
+    return formats::json::ToString(*response_json);
+}
+
+formats::json::Value HttpHandlerJsonBase::HandleRequestLazyJsonThrow(
+    const http::HttpRequest& request,
+    const formats::json::LazyValue& request_json,
+    request::RequestContext& context
+) const {
+    return HandleRequestJsonThrow(request, request_json.As<formats::json::Value>(), context);
 }
 
 const formats::json::Value* HttpHandlerJsonBase::GetRequestJson(const request::RequestContext& context) {
     return context.GetDataOptional<const formats::json::Value>(kRequestDataName);
 }
 
+const formats::json::LazyValue* HttpHandlerJsonBase::GetRequestLazyJson(const request::RequestContext& context) {
+    return context.GetDataOptional<const formats::json::LazyValue>(kRequestLazyDataName);
+}
+
 const formats::json::Value* HttpHandlerJsonBase::GetResponseJson(const request::RequestContext& context) {
     return context.GetDataOptional<const formats::json::Value>(kResponseDataName);
 }
@@ -65,6 +98,22 @@ FormattedErrorData HttpHandlerJsonBase::GetFormattedExternalErrorBody(const Cust
 }
 
 void HttpHandlerJsonBase::ParseRequestData(const http::HttpRequest& request, request::RequestContext& context) const {
+    if (lazy_request_json_) {
+        if (request.RequestBody().empty()) {
+            context.SetData<formats::json::LazyValue>(kRequestLazyDataName, formats::json::LazyValue{});
+            return;
+        }
+
+        try {
+            context.SetData<formats::json::LazyValue>(
+                kRequestLazyDataName, formats::json::FromStringLazy(request.RequestBody())
+            );
+        } catch (const formats::json::Exception& e) {
+            ThrowInvalidJsonBody(e);
+        }
+        return;
+    }
+
     if (request.RequestBody().empty()) {
         context.SetData<formats::json::Value>(kRequestDataName, kEmptyJson);
         return;
@@ -73,16 +122,21 @@ void HttpHandlerJsonBase::ParseRequestData(const http::HttpRequest& request, req
     try {
         context.SetData<formats::json::Value>(kRequestDataName, formats::json::FromString(request.RequestBody()));
     } catch (const formats::json::Exception& e) {
-        throw RequestParseError(
-            InternalMessage{"Invalid JSON body"}, ExternalBody{std::string("Invalid JSON body: ") + e.what()}
-        );
+        ThrowInvalidJsonBody(e);
     }
 }
 
 yaml_config::Schema HttpHandlerJsonBase::GetStaticConfigSchema() {
-    auto schema = HttpHandlerBase::GetStaticConfigSchema();
-    schema.UpdateDescription("HTTP handler JSON base config");
-    return schema;
+    return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
+type: object
+description: HTTP handler JSON base config
+additionalProperties: false
+properties:
+    lazy-request-json:
+        type: boolean
+        description: index the body with formats::json::FromStringLazy() and pass it to HandleRequestLazyJsonThrow() instead of parsing it fully
+        defaultDescription: false
+)");
 }
 
 }  // namespace server::handlers
@@ -1,9 +1,11 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <server/middlewares/content_coding.hpp>
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -51,6 +53,27 @@ std::string HttpHandlerStatic::HandleRequestThrow(const http::HttpRequest& reque
     if (file) {
         const auto config = config_.GetSnapshot();
         request.GetHttpResponse().SetContentType(config[kContentTypeMap][file->extension]);
+        if (file->file) {
+            request.GetHttpResponse().SetFileBody(file->file, file->size);
+            return {};
+        }
+        if (!file->precompressed.empty()) {
+            // The response depends on the request's Accept-Encoding, caches
+            // should know
+            auto& response = request.GetHttpResponse();
+            middlewares::content_coding::AddVaryAcceptEncoding(response);
+
+            const auto& precompressed = file->precompressed;
+            const auto index = middlewares::content_coding::Select(
+                request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding),
+                precompressed.size(),
+                [&precompressed](std::size_t i) -> std::string_view { return precompressed[i].encoding; }
+            );
+            if (index) {
+                response.SetContentEncoding(precompressed[*index].encoding);
+                return precompressed[*index].data;
+            }
+        }
         return file->data;
     }
     request.GetHttpResponse().SetStatusNotFound();
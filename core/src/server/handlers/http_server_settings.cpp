@@ -33,6 +33,19 @@ const dynamic_config::Key<CcCustomStatus> kCcCustomStatus{
 
 const dynamic_config::Key<bool> kStreamApiEnabled{"USERVER_HANDLER_STREAM_API_ENABLED", false};
 
+ClientRateLimit Parse(const formats::json::Value& value, formats::parse::To<ClientRateLimit>) {
+    return ClientRateLimit{
+        value["max-requests-per-second"].As<std::size_t>(),
+        value["burst"].As<std::optional<std::size_t>>(),
+        value["client-header"].As<std::string>(""),
+    };
+}
+
+const dynamic_config::Key<dynamic_config::ValueDict<ClientRateLimit>> kClientRateLimits{
+    "USERVER_HANDLER_CLIENT_RATE_LIMITS",
+    dynamic_config::DefaultAsJsonString{"{}"},
+};
+
 }  // namespace server::handlers
 
 USERVER_NAMESPACE_END
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
+#include <string>
 #include <unordered_set>
 
 #include <userver/dynamic_config/snapshot.hpp>
+#include <userver/dynamic_config/value.hpp>
 #include <userver/server/http/http_status.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -31,6 +34,17 @@ extern const dynamic_config::Key<CcCustomStatus> kCcCustomStatus;
 
 extern const dynamic_config::Key<bool> kStreamApiEnabled;
 
+struct ClientRateLimit final {
+    std::size_t max_requests_per_second{0};
+    std::optional<std::size_t> burst;
+    // The remote IP is used if empty
+    std::string client_header;
+};
+
+ClientRateLimit Parse(const formats::json::Value& value, formats::parse::To<ClientRateLimit>);
+
+extern const dynamic_config::Key<dynamic_config::ValueDict<ClientRateLimit>> kClientRateLimits;
+
 }  // namespace server::handlers
 
 USERVER_NAMESPACE_END
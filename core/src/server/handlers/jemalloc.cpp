@@ -32,7 +32,9 @@ constexpr utils::TrivialBiMap kStrToCommand = [](auto selector) {
         .Case("dump", Command::kDump)
         .Case("bg_threads_set_max", Command::kBgThreadsSetMax)
         .Case("bg_threads_enable", Command::kBgThreadsEnable)
-        .Case("bg_threads_disable", Command::kBgThreadsDisable);
+        .Case("bg_threads_disable", Command::kBgThreadsDisable)
+        .Case("arenas", Command::kArenas)
+        .Case("span_heap", Command::kSpanHeap);
 };
 
 }  // namespace
@@ -65,6 +67,9 @@ std::string Jemalloc::HandleRequestThrow(const http::HttpRequest& request, reque
                 return "'jemalloc' profiling is not available because the service was not started with a 'MALLOC_CONF' "
                        "environment variable that contain 'prof:true'";
             }
+            if (const auto ec = utils::jemalloc::EnableSpanHeapProfile()) {
+                LOG_WARNING() << "Span heap profile is not available: " << ec.message();
+            }
             return HandleRc(request, utils::jemalloc::ProfActivate());
         case Command::kDisable:
             return HandleRc(request, utils::jemalloc::ProfDeactivate());
@@ -88,6 +93,10 @@ std::string Jemalloc::HandleRequestThrow(const http::HttpRequest& request, reque
             return HandleRc(request, utils::jemalloc::EnableBgThreads());
         case Command::kBgThreadsDisable:
             return HandleRc(request, utils::jemalloc::StopBgThreads());
+        case Command::kArenas:
+            return utils::jemalloc::ArenasStats();
+        case Command::kSpanHeap:
+            return utils::jemalloc::SpanHeapProfile();
     }
 
     UINVARIANT(false, "Unsupported command");
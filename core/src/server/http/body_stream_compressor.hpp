@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+// Compresses the chunks of a streamed response body, see
+// http::ResponseBodyStream
+class BodyStreamCompressor {
+public:
+    virtual ~BodyStreamCompressor() = default;
+
+    // Returns the compressed chunk, that is ready to be sent
+    virtual std::string Compress(std::string_view chunk) = 0;
+
+    // Returns the end of the compressed body
+    virtual std::string Finish() = 0;
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
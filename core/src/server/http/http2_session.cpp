@@ -1,11 +1,14 @@
 #include <server/http/http2_session.hpp>
 
+#include <boost/container/small_vector.hpp>
+
 #include <server/http/http_request_parser.hpp>
 #include <server/net/connection_config.hpp>
 
 #include <userver/crypto/base64.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -77,13 +80,25 @@ Http2Session::Http2Session(
     UASSERT(session);
     session_ = SessionPtr(session, nghttp2_session_del);
 
-    std::array<nghttp2_settings_entry, 3> settings{
+    boost::container::small_vector<nghttp2_settings_entry, 4> settings{
         nghttp2_settings_entry{NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, config.max_concurrent_streams},
         nghttp2_settings_entry{NGHTTP2_SETTINGS_MAX_FRAME_SIZE, config.max_frame_size},
         nghttp2_settings_entry{NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, config.initial_window_size}};
+    if (config.rfc9218_priorities) {
+#if NGHTTP2_VERSION_NUM >= 0x013100
+        // nghttp2 schedules the streams by their urgency on its own then
+        settings.push_back(nghttp2_settings_entry{NGHTTP2_SETTINGS_NO_RFC7540_PRIORITIES, 1});
+#else
+        LOG_LIMITED_WARNING() << "RFC 9218 priorities require nghttp2 1.49 or later, ignoring the option";
+#endif
+    }
 
     auto rv = nghttp2_submit_settings(session_.get(), NGHTTP2_FLAG_NONE, settings.data(), settings.size());
     ThrowIfErr(rv, "Error when submit settings");
+    rv = nghttp2_session_set_local_window_size(
+        session_.get(), NGHTTP2_FLAG_NONE, 0, static_cast<std::int32_t>(config.connection_window_size)
+    );
+    ThrowIfErr(rv, "Error when set connection window size");
     rv = nghttp2_session_send(session_.get());
     ThrowIfErr(rv, "Error when session send");
 }
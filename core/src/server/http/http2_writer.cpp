@@ -101,7 +101,7 @@ public:
     Http2ResponseWriter(HttpResponse& response, Http2Session& session) : response_(response), http2_session_(session) {}
 
     void WriteHttpResponse() {
-        auto data = response_.ExtractData();
+        auto data = response_.file_body_ ? response_.ReadFileBody() : response_.ExtractData();
 
         auto headers = GetHeaders();
         const bool is_body_forbidden = IsBodyForbiddenForStatus(response_.status_);
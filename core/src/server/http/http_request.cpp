@@ -229,6 +229,15 @@ const std::string& HttpRequest::RequestBody() const { return pimpl_->request_bod
 
 std::string HttpRequest::ExtractRequestBody() { return std::move(pimpl_->request_body_); }
 
+RequestBodyStream& HttpRequest::GetRequestBodyStream() {
+    if (!pimpl_->request_body_stream_) {
+        pimpl_->request_body_stream_ = std::make_unique<RequestBodyStream>(std::move(pimpl_->request_body_));
+    }
+    return *pimpl_->request_body_stream_;
+}
+
+bool HttpRequest::IsRequestBodyStreamed() const { return pimpl_->is_request_body_streamed_; }
+
 void HttpRequest::SetRequestBody(std::string body) { pimpl_->request_body_ = std::move(body); }
 
 void HttpRequest::ParseArgsFromBody() {
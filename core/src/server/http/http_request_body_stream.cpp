@@ -0,0 +1,53 @@
+#include <userver/server/http/http_request_body_stream.hpp>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+RequestBodyStream::RequestBodyStream(Queue::Consumer&& consumer) : consumer_(std::move(consumer)) {}
+
+RequestBodyStream::RequestBodyStream(std::string&& body) : body_(std::move(body)) {}
+
+RequestBodyStream::RequestBodyStream(RequestBodyStream&&) noexcept = default;
+
+RequestBodyStream::~RequestBodyStream() = default;
+
+bool RequestBodyStream::ReadChunk(std::string& chunk) {
+    if (is_finished_) return false;
+
+    if (!consumer_) {
+        is_finished_ = true;
+        if (body_.empty()) return false;
+        read_size_ += body_.size();
+        chunk = std::move(body_);
+        return true;
+    }
+
+    std::string data;
+    if (!consumer_->Pop(data)) {
+        if (engine::current_task::ShouldCancel()) {
+            throw engine::WaitInterruptedException(engine::current_task::CancellationReason());
+        }
+        is_finished_ = true;
+        throw handlers::RequestParseError(handlers::InternalMessage{"The client has not sent the whole request body"});
+    }
+
+    if (data.empty()) {
+        is_finished_ = true;
+        consumer_.reset();
+        return false;
+    }
+    read_size_ += data.size();
+    chunk = std::move(data);
+    return true;
+}
+
+std::size_t RequestBodyStream::GetReadSize() const noexcept { return read_size_; }
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,67 @@
+#include <userver/server/http/http_request_body_stream.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/server/http/http_request_builder.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(HttpRequestBodyStream, WholeBody) {
+    auto request = server::http::HttpRequestBuilder{}.SetBody("body").Build();
+    EXPECT_FALSE(request->IsRequestBodyStreamed());
+
+    auto& stream = request->GetRequestBodyStream();
+    std::string chunk;
+    ASSERT_TRUE(stream.ReadChunk(chunk));
+    EXPECT_EQ(chunk, "body");
+    EXPECT_FALSE(stream.ReadChunk(chunk));
+    EXPECT_EQ(stream.GetReadSize(), 4);
+}
+
+UTEST(HttpRequestBodyStream, EmptyBody) {
+    auto request = server::http::HttpRequestBuilder{}.Build();
+
+    std::string chunk;
+    EXPECT_FALSE(request->GetRequestBodyStream().ReadChunk(chunk));
+}
+
+UTEST_MT(HttpRequestBodyStream, Chunks, 2) {
+    auto queue = server::http::RequestBodyStream::Queue::Create(4);
+    auto request = server::http::HttpRequestBuilder{}.SetRequestBodyStream(queue->GetConsumer()).Build();
+    EXPECT_TRUE(request->IsRequestBodyStreamed());
+
+    auto producer_task = engine::AsyncNoSpan([producer = queue->GetProducer()] {
+        for (const auto* chunk : {"ab", "cd", "ef"}) {
+            ASSERT_TRUE(producer.Push(chunk));
+        }
+        ASSERT_TRUE(producer.Push({}));
+    });
+
+    auto& stream = request->GetRequestBodyStream();
+    std::string body;
+    std::string chunk;
+    while (stream.ReadChunk(chunk)) body += chunk;
+    EXPECT_EQ(body, "abcdef");
+    EXPECT_EQ(stream.GetReadSize(), 6);
+    EXPECT_FALSE(stream.ReadChunk(chunk));
+
+    producer_task.Get();
+}
+
+UTEST(HttpRequestBodyStream, Truncated) {
+    auto queue = server::http::RequestBodyStream::Queue::Create(4);
+    auto request = server::http::HttpRequestBuilder{}.SetRequestBodyStream(queue->GetConsumer()).Build();
+    {
+        const auto producer = queue->GetProducer();
+        ASSERT_TRUE(producer.Push("ab"));
+    }
+
+    auto& stream = request->GetRequestBodyStream();
+    std::string chunk;
+    ASSERT_TRUE(stream.ReadChunk(chunk));
+    EXPECT_EQ(chunk, "ab");
+    EXPECT_THROW(stream.ReadChunk(chunk), server::handlers::RequestParseError);
+}
+
+USERVER_NAMESPACE_END
@@ -49,6 +49,12 @@ HttpRequestBuilder& HttpRequestBuilder::SetBody(std::string&& body) {
     return *this;
 }
 
+HttpRequestBuilder& HttpRequestBuilder::SetRequestBodyStream(RequestBodyStream::Queue::Consumer&& consumer) {
+    request_->pimpl_->request_body_stream_ = std::make_unique<RequestBodyStream>(std::move(consumer));
+    request_->pimpl_->is_request_body_streamed_ = true;
+    return *this;
+}
+
 HttpRequestBuilder& HttpRequestBuilder::AddHeader(std::string&& header, std::string&& value) {
     request_->pimpl_->headers_.InsertOrAppend(std::move(header), std::move(value));
     return *this;
@@ -112,6 +112,7 @@ void HttpRequestConstructor::ParseUrl() {
         config_.max_headers_size = handler_config.request_config.max_headers_size;
         config_.parse_args_from_body = handler_config.request_config.parse_args_from_body;
         if (handler_config.decompress_request) config_.decompress_request = true;
+        is_body_stream_enabled_ = handler_config.request_body_stream;
 
         builder_.SetTaskProcessor(handler_info->task_processor);
         builder_.SetHttpHandler(handler_info->handler);
@@ -161,6 +162,16 @@ void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
     body_ += std::string_view{data, size};
 }
 
+bool HttpRequestConstructor::IsBodyStreamEnabled() const { return is_body_stream_enabled_ && status_ == Status::kOk; }
+
+std::size_t HttpRequestConstructor::GetMaxRequestSize() const { return config_.max_request_size; }
+
+void HttpRequestConstructor::SetBodyStream(RequestBodyStream::Queue::Consumer&& consumer) {
+    UASSERT(IsBodyStreamEnabled());
+    builder_.SetRequestBodyStream(std::move(consumer));
+    is_body_streamed_ = true;
+}
+
 void HttpRequestConstructor::SetIsFinal(bool is_final) { builder_.SetIsFinal(is_final); }
 
 void HttpRequestConstructor::SetResponseStreamId(std::int32_t stream_id) { builder_.SetResponseStreamId(stream_id); }
@@ -193,7 +204,7 @@ void HttpRequestConstructor::FinalizeImpl() {
 
     try {
         ParseArgs(*parsed_url_pimpl_);
-        if (config_.parse_args_from_body) {
+        if (config_.parse_args_from_body && !is_body_streamed_) {
             if (!config_.decompress_request || !request.IsBodyCompressed())
                 ParseArgs(request.RequestBody().data(), request.RequestBody().size());
         }
@@ -203,6 +214,9 @@ void HttpRequestConstructor::FinalizeImpl() {
         return;
     }
 
+    // the handler reads the body itself
+    if (is_body_streamed_) return;
+
     // TODO: split logic
     const auto& content_type = request.GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
     if (IsMultipartFormDataContentType(content_type)) {
@@ -5,6 +5,7 @@
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/http/http_request_builder.hpp>
 #include <userver/server/request/request_config.hpp>
 
@@ -56,6 +57,11 @@ public:
 
     void SetIsFinal(bool is_final);
 
+    // HTTP/1.1 only:
+    bool IsBodyStreamEnabled() const;
+    std::size_t GetMaxRequestSize() const;
+    void SetBodyStream(RequestBodyStream::Queue::Consumer&& consumer);
+
     // HTTP/2.0 only:
     void SetStreamProducer(impl::Http2StreamEventProducer&& producer);
     void SetResponseStreamId(std::int32_t stream_id);
@@ -91,6 +97,8 @@ private:
     size_t url_size_ = 0;
     size_t headers_size_ = 0;
     bool url_parsed_ = false;
+    bool is_body_stream_enabled_ = false;
+    bool is_body_streamed_ = false;
     Status status_ = Status::kOk;
 
     std::string url_;
@@ -10,6 +10,7 @@
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/task/current_task.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/logging/component.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -92,6 +93,10 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(std::shared_pt
         // by HttpRequestConstructor::CheckStatus
         return StartFailsafeTask(std::move(http_request));
     }
+    if (task_processor == thread_per_core_task_processor_) {
+        // Stay on the shard that owns the connection
+        task_processor = &engine::current_task::GetTaskProcessor();
+    }
     auto throttling_enabled = handler->GetConfig().throttling_enabled;
 
     if (throttling_enabled && http_response.IsLimitReached()) {
@@ -129,6 +134,7 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(std::shared_pt
 
         http_response.SetStatus(status);
         http_response.SetReady();
+        handler->GetHandlerStatistics().ForMethod(http_request->GetMethod()).IncrementCongestionControlLimited();
 
         LOG_LIMITED_ERROR() << "Request throttled (congestion control, "
                                "limit via USERVER_RPS_CCONTROL and USERVER_RPS_CCONTROL_ENABLED), "
@@ -172,6 +178,11 @@ void HttpRequestHandler::DisableAddHandler() {
     UASSERT(was_enabled);
 }
 
+void HttpRequestHandler::SetThreadPerCoreTaskProcessor(engine::TaskProcessor& task_processor) {
+    UASSERT(!IsAddHandlerDisabled());
+    thread_per_core_task_processor_ = &task_processor;
+}
+
 void HttpRequestHandler::AddHandler(const handlers::HttpHandlerBase& handler, engine::TaskProcessor& task_processor) {
     UASSERT_MSG(!add_handler_disabled_, "handler adding disabled");
     if (is_monitor_ != handler.IsMonitor()) {
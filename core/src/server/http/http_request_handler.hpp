@@ -45,6 +45,10 @@ public:
 
     void SetRpsRatelimitStatusCode(HttpStatus status_code);
 
+    // Requests of the handlers bound to `task_processor` are processed on the
+    // task processor of the connection instead. Must be called before start.
+    void SetThreadPerCoreTaskProcessor(engine::TaskProcessor& task_processor);
+
 private:
     engine::TaskWithResult<void> StartFailsafeTask(std::shared_ptr<http::HttpRequest> http_request) const;
 
@@ -58,6 +62,7 @@ private:
     HandlerInfoIndex handler_info_index_;
 
     std::atomic<bool> add_handler_disabled_;
+    engine::TaskProcessor* thread_per_core_task_processor_{nullptr};
     const bool is_monitor_;
     const std::string server_name_;
     NewRequestHook new_request_hook_;
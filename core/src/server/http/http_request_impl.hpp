@@ -1,6 +1,9 @@
 #pragma once
 
+#include <memory>
+
 #include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -39,6 +42,7 @@ struct HttpRequest::Impl {
     std::string url_;
     std::string request_path_;
     std::string request_body_;
+    std::unique_ptr<RequestBodyStream> request_body_stream_;
     utils::impl::TransparentMap<std::string, std::vector<std::string>, utils::StrCaseHash> request_args_;
     utils::impl::TransparentMap<std::string, std::vector<FormDataArg>, utils::StrCaseHash> form_data_args_;
     std::vector<std::string> path_args_;
@@ -46,6 +50,7 @@ struct HttpRequest::Impl {
     HeadersMap headers_;
     CookiesMap cookies_;
     bool is_final_{false};
+    bool is_request_body_streamed_{false};
 #ifndef NDEBUG
     mutable bool args_referenced_{false};
 #endif
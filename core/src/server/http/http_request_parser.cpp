@@ -1,5 +1,7 @@
 #include "http_request_parser.hpp"
 
+#include <utility>
+
 #include <userver/logging/log.hpp>
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -12,6 +14,9 @@ namespace server::http {
 
 namespace {
 
+// Body bytes that wait for the handler before the socket reads are paused
+constexpr std::size_t kBodyStreamBufferSize = 256 * 1024;
+
 constexpr std::string_view kWebsocketUpgradeHeaderName = "Upgrade:";
 constexpr std::string_view kWebsocketUpgradeHeaderValue = "websocket\r\n";
 
@@ -101,6 +106,11 @@ HttpRequestParser::HttpRequestParser(
 
 bool HttpRequestParser::Parse(std::string_view req) {
     const auto err = llhttp_execute(&parser_, req.data(), req.size());
+    if (err == HPE_PAUSED) {
+        unparsed_.assign(llhttp_get_error_pos(&parser_), req.data() + req.size());
+        llhttp_resume(&parser_);
+        return true;
+    }
     if (parser_.upgrade && err == HPE_PAUSED_UPGRADE) {
         FinalizeRequest();
         // returns true iff it is an HTTP/2 upgrade request
@@ -110,12 +120,26 @@ bool HttpRequestParser::Parse(std::string_view req) {
         const auto parsed = static_cast<size_t>(llhttp_get_error_pos(&parser_) - req.data() + 1);
         LOG_WARNING() << "parsed=" << parsed << " size=" << req.size()
                       << " error_description=" << llhttp_errno_name(err);
+        if (is_streaming_body_) {
+            // the request has been passed to the handler already
+            AbortBodyStream();
+            return false;
+        }
         FinalizeRequest();
         return false;
     }
     return true;
 }
 
+bool HttpRequestParser::IsStreamingBody() const noexcept { return is_streaming_body_; }
+
+std::string HttpRequestParser::TakeUnparsed() noexcept { return std::exchange(unparsed_, {}); }
+
+void HttpRequestParser::AbortBodyStream() noexcept {
+    is_streaming_body_ = false;
+    body_producer_.reset();
+}
+
 int HttpRequestParser::OnMessageBegin(llhttp_t* p) {
     auto* http_request_parser = static_cast<HttpRequestParser*>(p->data);
     UASSERT(http_request_parser != nullptr);
@@ -213,10 +237,14 @@ int HttpRequestParser::OnHeadersCompleteImpl(llhttp_t* p) {
         return -1;
     }
     LOG_TRACE() << "headers complete";
+    if (request_constructor_->IsBodyStreamEnabled() && ((p->flags & F_CHUNKED) || p->content_length > 0)) {
+        return StartBodyStream(p) ? HPE_PAUSED : -1;
+    }
     return 0;
 }
 
 int HttpRequestParser::OnBodyImpl(llhttp_t* p, const char* data, size_t size) {
+    if (is_streaming_body_) return PushBodyChunk({data, size}) ? 0 : -1;
     UASSERT(request_constructor_);
     if (!CheckUrlComplete(p)) return -1;
     LOG_TRACE() << "body: '" << std::string_view(data, size) << "'";
@@ -230,6 +258,11 @@ int HttpRequestParser::OnBodyImpl(llhttp_t* p, const char* data, size_t size) {
 }
 
 int HttpRequestParser::OnMessageCompleteImpl(llhttp_t* p) {
+    if (is_streaming_body_) {
+        LOG_TRACE() << "streamed body complete";
+        FinishBodyStream();
+        return HPE_PAUSED;
+    }
     UASSERT(request_constructor_);
     if (p->upgrade) {
         return 0;
@@ -281,6 +314,47 @@ bool HttpRequestParser::FinalizeRequestImpl() {
     return true;
 }
 
+bool HttpRequestParser::StartBodyStream(llhttp_t* p) {
+    LOG_TRACE() << "streaming the body to the handler";
+    const auto queue = concurrent::StringStreamQueue::Create(kBodyStreamBufferSize);
+    body_producer_.emplace(queue->GetProducer());
+    request_constructor_->SetBodyStream(queue->GetConsumer());
+    request_constructor_->SetIsFinal(!llhttp_should_keep_alive(p));
+    body_size_left_ = request_constructor_->GetMaxRequestSize();
+    is_streaming_body_ = true;
+    return FinalizeRequest();
+}
+
+bool HttpRequestParser::PushBodyChunk(std::string_view data) {
+    if (data.size() > body_size_left_) {
+        LOG_WARNING() << "streamed request body is too large (enforced by 'max_request_size' handler limit in "
+                         "config.yaml)";
+        return false;
+    }
+    body_size_left_ -= data.size();
+
+    while (body_producer_ && !data.empty()) {
+        const auto part = data.substr(0, kBodyStreamBufferSize);
+        data.remove_prefix(part.size());
+        // Blocks while the handler lags behind, so that no more data is read
+        // from the socket until it catches up
+        if (!body_producer_->Push(std::string{part})) {
+            LOG_DEBUG() << "handler has stopped reading the request body, skipping the rest of it";
+            body_producer_.reset();
+        }
+    }
+    return true;
+}
+
+void HttpRequestParser::FinishBodyStream() {
+    if (body_producer_) {
+        // an empty chunk marks the end of the body
+        [[maybe_unused]] const bool pushed = body_producer_->Push({});
+        body_producer_.reset();
+    }
+    is_streaming_body_ = false;
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
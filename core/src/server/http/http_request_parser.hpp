@@ -4,11 +4,13 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <string>
 
 #include <llhttp.h>
 
 #include <server/net/stats.hpp>
 #include <server/request/request_parser.hpp>
+#include <userver/concurrent/queue.hpp>
 #include <userver/engine/io/sockaddr.hpp>
 
 #include <userver/server/request/request_config.hpp>
@@ -37,6 +39,18 @@ public:
 
     bool Parse(std::string_view request) override;
 
+    // Returns true once Parse() has produced a request which body is streamed
+    // to its handler, until the whole body is parsed. Parse() pauses after the
+    // headers of such request, so that its handler could be started before the
+    // body is pushed to it, and after the end of the body.
+    bool IsStreamingBody() const noexcept;
+
+    // Returns the data left unparsed by the last pause
+    std::string TakeUnparsed() noexcept;
+
+    // Makes the handler of the streamed request body get an error
+    void AbortBodyStream() noexcept;
+
 private:
     static int OnMessageBegin(llhttp_t* p);
     static int OnUrl(llhttp_t* p, const char* data, size_t size);
@@ -61,6 +75,10 @@ private:
     bool FinalizeRequest();
     bool FinalizeRequestImpl();
 
+    bool StartBodyStream(llhttp_t* p);
+    bool PushBodyChunk(std::string_view data);
+    void FinishBodyStream();
+
     const HandlerInfoIndex& handler_info_index_;
     const HttpRequestConstructor::Config request_constructor_config_;
 
@@ -71,6 +89,12 @@ private:
     llhttp_t parser_{};
     std::optional<HttpRequestConstructor> request_constructor_;
 
+    bool is_streaming_body_ = false;
+    std::size_t body_size_left_ = 0;
+    // Is reset once the handler stops reading the body
+    std::optional<concurrent::StringStreamQueue::Producer> body_producer_;
+    std::string unparsed_;
+
     static const llhttp_settings_t parser_settings;
     net::ParserStats& stats_;
     request::ResponseDataAccounter& data_accounter_;
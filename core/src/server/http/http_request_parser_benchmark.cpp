@@ -17,6 +17,18 @@ constexpr std::string_view kHttpRequestDataMiddle =
     "Content-type: application/json\r\nContent-Length: 18\r\n\r\n"
     "{\"hello\": \"world\"}";
 
+constexpr std::string_view kHttpRequestDataRealistic =
+    "GET /v1/profile?id=42 HTTP/1.1\r\n"
+    "Host: api.example.com\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:126.0) Gecko/20100101 Firefox/126.0\r\n"
+    "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8\r\n"
+    "Accept-Language: en-US,en;q=0.5\r\n"
+    "Accept-Encoding: gzip, deflate, br\r\n"
+    "Connection: keep-alive\r\n"
+    "Cookie: session=0123456789abcdef0123456789abcdef; theme=dark; lang=en\r\n"
+    "X-Request-Id: 5a4f1d0e2b7c4e8f9a0b1c2d3e4f5a6b\r\n"
+    "traceparent: 00-0af7651916cd43dd8448eb211c80319c-b7ad6b7169203331-01\r\n\r\n";
+
 constexpr size_t kEntryCount = 1024;
 
 inline server::http::HttpRequestParser CreateBenchmarkParser(server::http::HttpRequestParser::OnNewRequestCb&& cb) {
@@ -110,10 +122,34 @@ void http_request_parser_parse_benchmark_many_headers(benchmark::State& state) {
     }
 }
 
+void http_request_parser_parse_benchmark_realistic(benchmark::State& state) {
+    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::http::HttpRequest>&&) {});
+
+    for ([[maybe_unused]] auto _ : state) {
+        parser.Parse(kHttpRequestDataRealistic);
+    }
+}
+
+void http_request_parser_parse_benchmark_realistic_split(benchmark::State& state) {
+    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::http::HttpRequest>&&) {});
+
+    // Headers torn between two reads from the socket
+    const auto split_pos = kHttpRequestDataRealistic.find("Cookie") + 10;
+    const auto first_piece = kHttpRequestDataRealistic.substr(0, split_pos);
+    const auto second_piece = kHttpRequestDataRealistic.substr(split_pos);
+
+    for ([[maybe_unused]] auto _ : state) {
+        parser.Parse(first_piece);
+        parser.Parse(second_piece);
+    }
+}
+
 BENCHMARK(http_request_parser_parse_benchmark_small);
 BENCHMARK(http_request_parser_parse_benchmark_middle);
 BENCHMARK(http_request_parser_parse_benchmark_large_url);
 BENCHMARK(http_request_parser_parse_benchmark_large_body);
 BENCHMARK(http_request_parser_parse_benchmark_many_headers);
+BENCHMARK(http_request_parser_parse_benchmark_realistic);
+BENCHMARK(http_request_parser_parse_benchmark_realistic_split);
 
 USERVER_NAMESPACE_END
@@ -1,12 +1,17 @@
 #include <userver/server/http/http_response.hpp>
 
+#include <unistd.h>
+
 #include <array>
 
 #include <cctz/time_zone.h>
 #include <fmt/compile.h>
+#include <fmt/format.h>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/engine/io/tls_wrapper.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/hostinfo/blocking/get_hostname.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/content_type.hpp>
@@ -18,7 +23,9 @@
 #include <userver/utils/overloaded.hpp>
 #include <userver/utils/small_string.hpp>
 
+#include <server/http/body_stream_compressor.hpp>
 #include <server/http/http_cached_date.hpp>
+#include <utils/check_syscall.hpp>
 
 #include <userver/server/http/http_request.hpp>
 
@@ -304,21 +311,30 @@ HttpResponse::SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::
     const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
     const bool is_head_request = request_.GetMethod() == HttpMethod::kHead;
     const auto& data = GetData();
+    const auto body_size = file_body_ ? file_body_size_ : data.size();
 
     if (!is_body_forbidden) {
+        const fmt::format_int content_length{body_size};
         impl::OutputHeader(
-            header, USERVER_NAMESPACE::http::headers::kContentLength, fmt::format(FMT_COMPILE("{}"), data.size())
+            header,
+            USERVER_NAMESPACE::http::headers::kContentLength,
+            std::string_view{content_length.data(), content_length.size()}
         );
     }
     header.append(kCrlf);
 
-    if (is_body_forbidden && !data.empty()) {
+    if (is_body_forbidden && body_size != 0) {
         LOG_LIMITED_WARNING() << "Non-empty body provided for response with HTTP code " << static_cast<int>(status_)
                               << " which does not allow one, it will be dropped";
     }
 
     ssize_t sent_bytes = 0;
-    if (!is_head_request && !is_body_forbidden) {
+    if (file_body_ && !is_head_request && !is_body_forbidden) {
+        sent_bytes = socket.WriteAll(header.data(), header.size(), engine::Deadline{});
+        sent_bytes += SendFileBody(socket);
+    } else if (!is_head_request && !is_body_forbidden) {
+        // The body is never copied into the header buffer, both are sent with a
+        // single vectored write
         sent_bytes = socket.WriteAll({{header.data(), header.size()}, {data.data(), data.size()}}, engine::Deadline{});
     } else {
         sent_bytes = socket.WriteAll(header.data(), header.size(), engine::Deadline{});
@@ -327,6 +343,63 @@ HttpResponse::SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::
     return sent_bytes;
 }
 
+std::size_t HttpResponse::SendFileBody(engine::io::RwBase& socket) {
+    UASSERT(file_body_);
+    const int fd = file_body_->GetNative();
+
+    if (auto* plain_socket = dynamic_cast<engine::io::Socket*>(&socket)) {
+        return plain_socket->SendFile(fd, 0, file_body_size_, engine::Deadline{});
+    }
+    if (auto* tls_socket = dynamic_cast<engine::io::TlsWrapper*>(&socket)) {
+        if (tls_socket->IsSendOffloadedToKernel()) {
+            return tls_socket->SendFile(fd, 0, file_body_size_, engine::Deadline{});
+        }
+    }
+
+    // TLS has to encrypt the data in userspace anyway
+    constexpr std::size_t kChunkSize = 64 * 1024;
+    std::string chunk(std::min(file_body_size_, kChunkSize), '\0');
+    std::size_t sent_bytes = 0;
+    while (sent_bytes < file_body_size_) {
+        const auto read_bytes = utils::CheckSyscall(
+            ::pread(fd, chunk.data(), std::min(file_body_size_ - sent_bytes, chunk.size()), sent_bytes),
+            "reading the file body, fd={}",
+            fd
+        );
+        if (read_bytes == 0) {
+            LOG_LIMITED_WARNING() << "The file body was truncated while sending the response";
+            break;
+        }
+        sent_bytes += socket.WriteAll(chunk.data(), read_bytes, engine::Deadline{});
+    }
+    return sent_bytes;
+}
+
+std::string HttpResponse::ReadFileBody() const {
+    UASSERT(file_body_);
+    const int fd = file_body_->GetNative();
+
+    std::string result(file_body_size_, '\0');
+    std::size_t read_total = 0;
+    while (read_total < result.size()) {
+        const auto read_bytes = utils::CheckSyscall(
+            ::pread(fd, result.data() + read_total, result.size() - read_total, read_total),
+            "reading the file body, fd={}",
+            fd
+        );
+        if (read_bytes == 0) break;
+        read_total += read_bytes;
+    }
+    result.resize(read_total);
+    return result;
+}
+
+void HttpResponse::SetFileBody(std::shared_ptr<const fs::blocking::FileDescriptor> file, std::size_t size) {
+    UASSERT(file);
+    file_body_ = std::move(file);
+    file_body_size_ = size;
+}
+
 std::size_t
 HttpResponse::SetBodyStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header) {
     const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
@@ -356,10 +429,17 @@ HttpResponse::SetBodyStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::htt
             continue;
         }
 
-        auto size = first_chunk_processed ? fmt::format("\r\n{:x}\r\n", body_part.size())
-                                          : fmt::format("{:x}\r\n", body_part.size());
-        sent_bytes +=
-            socket.WriteAll({{size.data(), size.size()}, {body_part.data(), body_part.size()}}, engine::Deadline{});
+        // "\r\n" + 16 hex digits + "\r\n"
+        std::array<char, 20> chunk_header;
+        const auto chunk_header_end =
+            first_chunk_processed
+                ? fmt::format_to(chunk_header.data(), FMT_COMPILE("\r\n{:x}\r\n"), body_part.size())
+                : fmt::format_to(chunk_header.data(), FMT_COMPILE("{:x}\r\n"), body_part.size());
+        sent_bytes += socket.WriteAll(
+            {{chunk_header.data(), static_cast<std::size_t>(chunk_header_end - chunk_header.data())},
+             {body_part.data(), body_part.size()}},
+            engine::Deadline{}
+        );
 
         first_chunk_processed = true;
     }
@@ -415,6 +495,11 @@ HttpResponse::Producer HttpResponse::GetBodyProducer() {
     return res;
 }
 
+void HttpResponse::SetBodyStreamCompressor(std::unique_ptr<impl::BodyStreamCompressor> compressor) {
+    UASSERT(is_stream_body_);
+    body_stream_compressor_ = std::move(compressor);
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
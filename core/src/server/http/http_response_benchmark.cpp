@@ -1,8 +1,14 @@
 #include <benchmark/benchmark.h>
 
-#include <fmt/compile.h>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <array>
 #include <sstream>
 
+#include <fmt/compile.h>
+
 #include <userver/http/common_headers.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/http/http_status.hpp>
@@ -135,11 +141,61 @@ void HttpResponseSetHeaderBenchmark(benchmark::State& state) {
     }
 }
 
+// Header block of a typical response, the body size goes to Content-Length
+std::string MakeResponseHeader(std::size_t body_size) {
+    std::string header = "HTTP/1.1 200 OK\r\n";
+    for (const auto& [key, value] : kHeaders) {
+        OutputHeader(header, key, value);
+    }
+    OutputHeader(header, USERVER_NAMESPACE::http::headers::kContentLength, fmt::to_string(body_size));
+    header.append(kCrlf);
+    return header;
+}
+
+// /dev/null consumes the data without copying it, so only the serialization
+// cost and the syscall are measured
+void http_response_send_contiguous(benchmark::State& state) {
+    const std::string body(state.range(0), 'x');
+    const auto header = MakeResponseHeader(body.size());
+    const int fd = ::open("/dev/null", O_WRONLY);
+
+    for ([[maybe_unused]] auto _ : state) {
+        std::string response;
+        response.reserve(header.size() + body.size());
+        response.append(header);
+        response.append(body);
+        benchmark::DoNotOptimize(::write(fd, response.data(), response.size()));
+    }
+
+    ::close(fd);
+    state.SetBytesProcessed(state.iterations() * (header.size() + body.size()));
+}
+
+void http_response_send_vectored(benchmark::State& state) {
+    const std::string body(state.range(0), 'x');
+    const auto header = MakeResponseHeader(body.size());
+    const int fd = ::open("/dev/null", O_WRONLY);
+
+    for ([[maybe_unused]] auto _ : state) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        const std::array<::iovec, 2> list{{
+            {const_cast<char*>(header.data()), header.size()},
+            {const_cast<char*>(body.data()), body.size()},
+        }};
+        benchmark::DoNotOptimize(::writev(fd, list.data(), list.size()));
+    }
+
+    ::close(fd);
+    state.SetBytesProcessed(state.iterations() * (header.size() + body.size()));
+}
+
 }  // namespace
 
 BENCHMARK(http_headers_serialization_inplace);
 BENCHMARK(http_headers_serialization_no_ostreams);
 BENCHMARK(http_headers_serialization_ostreams);
 BENCHMARK(HttpResponseSetHeaderBenchmark);
+BENCHMARK(http_response_send_contiguous)->RangeMultiplier(4)->Range(64 << 10, 10 << 20);
+BENCHMARK(http_response_send_vectored)->RangeMultiplier(4)->Range(64 << 10, 10 << 20);
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <userver/server/http/http_response_body_stream.hpp>
 
+#include <server/http/body_stream_compressor.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/overloaded.hpp>
 
@@ -11,9 +13,24 @@ ResponseBodyStream::ResponseBodyStream(
     server::http::HttpResponse::Producer&& queue_producer,
     server::http::HttpResponse& http_response
 )
-    : queue_producer_(std::move(queue_producer)), http_response_(http_response) {}
+    : queue_producer_(std::move(queue_producer)),
+      http_response_(http_response),
+      compressor_(std::move(http_response.body_stream_compressor_)) {}
+
+ResponseBodyStream::ResponseBodyStream(ResponseBodyStream&&) noexcept = default;
 
 ResponseBodyStream::~ResponseBodyStream() {
+    if (compressor_) {
+        try {
+            // The push may fail if the task is cancelled, the client will get
+            // a truncated body anyway
+            auto tail = compressor_->Finish();
+            if (!tail.empty()) DoPushBodyChunk(std::move(tail), {});
+        } catch (const std::exception& e) {
+            LOG_ERROR() << "Failed to finish the compressed response body: " << e;
+        }
+    }
+
     if (http_response_.GetStreamId().has_value()) {
         UASSERT(queue_producer_.index() == 2);
         std::get<impl::Http2StreamEventProducer>(queue_producer_).CloseStream(*http_response_.GetStreamId());
@@ -22,17 +39,26 @@ ResponseBodyStream::~ResponseBodyStream() {
 
 void ResponseBodyStream::PushBodyChunk(std::string&& chunk, engine::Deadline deadline) {
     UASSERT_MSG(headers_ended_, "SetEndOfHeaders() was not called before PushBodyChunk()");
-    std::visit(
+    if (compressor_) {
+        chunk = compressor_->Compress(chunk);
+        if (chunk.empty()) return;
+    }
+    const bool success = DoPushBodyChunk(std::move(chunk), deadline);
+    UASSERT(success);
+}
+
+bool ResponseBodyStream::DoPushBodyChunk(std::string&& chunk, engine::Deadline deadline) {
+    return std::visit(
         utils::Overloaded{
             [&chunk, &deadline](HttpResponse::Queue::Producer& queue_producer) mutable {
-                const bool success = queue_producer.Push(std::move(chunk), deadline);
-                UASSERT(success);
+                return queue_producer.Push(std::move(chunk), deadline);
             },
             [this, &chunk, &deadline](impl::Http2StreamEventProducer& queue_producer) mutable {
                 UASSERT(http_response_.GetStreamId().has_value());
                 queue_producer.PushEvent({*http_response_.GetStreamId(), std::move(chunk)}, deadline);
+                return true;
             },
-            [](std::monostate) { UINVARIANT(false, "unreachable"); }},
+            [](std::monostate) -> bool { UINVARIANT(false, "unreachable"); }},
         queue_producer_
     );
 }
@@ -5,7 +5,9 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <algorithm>
 #include <array>
+#include <functional>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -247,38 +249,45 @@ bool ParseMultipartFormDataHeaders(std::string_view& body, FormDataArgInfo& arg_
     return SkipCrLf(body, crlf);
 }
 
-size_t FindBoundaryEnd(std::string_view body, std::string_view boundary, std::string_view crlf) {
-    size_t pos = 0;
-    while (pos < body.size()) {
-        if (body[pos] == crlf.front()) {
-            if (pos + crlf.size() < body.size() && body.substr(pos, crlf.size()) == crlf) {
-                pos += crlf.size();
-                if (pos < body.size() && body[pos] == '-') {
-                    ++pos;
-                    if (pos < body.size() && body[pos] == '-') {
-                        ++pos;
-                        size_t idx = 0;
-                        while (idx < boundary.size() && pos + idx < body.size() && body[pos + idx] == boundary[idx])
-                            ++idx;
-                        pos += idx;
-                        if (idx == boundary.size()) return pos;
-                    }
-                }
-            } else
-                ++pos;
-        } else
-            ++pos;
+// Finds the delimiter line break followed by "--" and the boundary. The
+// search table is built once per body, so that long parts are skipped by
+// whole delimiter lengths instead of being scanned byte by byte.
+class BoundarySearcher final {
+public:
+    BoundarySearcher(std::string_view boundary, std::string_view crlf)
+        : delimiter_(MakeDelimiter(boundary, crlf)), searcher_(delimiter_.begin(), delimiter_.end()) {}
+
+    BoundarySearcher(const BoundarySearcher&) = delete;
+    BoundarySearcher& operator=(const BoundarySearcher&) = delete;
+
+    // Returns the position right after the boundary or npos
+    size_t FindEnd(std::string_view body) const {
+        const auto it = std::search(body.begin(), body.end(), searcher_);
+        if (it == body.end()) return std::string_view::npos;
+        return static_cast<size_t>(it - body.begin()) + delimiter_.size();
+    }
+
+    // Returns the size of the part value delimiter
+    size_t GetDelimiterSize() const noexcept { return delimiter_.size(); }
+
+private:
+    static std::string MakeDelimiter(std::string_view boundary, std::string_view crlf) {
+        std::string delimiter;
+        delimiter.reserve(crlf.size() + 2 + boundary.size());
+        delimiter.append(crlf).append("--").append(boundary);
+        return delimiter;
     }
-    return std::string_view::npos;
-}
+
+    const std::string delimiter_;
+    const std::boyer_moore_horspool_searcher<std::string::const_iterator> searcher_;
+};
 
 bool ParseMultipartFormDataValue(
     std::string_view& body,
-    std::string_view boundary,
+    const BoundarySearcher& boundary_searcher,
     FormDataArgInfo&& arg_info,
     std::optional<std::string>& charset,
-    FormDataArgs& form_data_args,
-    std::string_view crlf
+    FormDataArgs& form_data_args
 ) {
     static const std::string kCharset = "_charset_";
 
@@ -287,12 +296,12 @@ bool ParseMultipartFormDataValue(
         return false;
     }
 
-    size_t pos = FindBoundaryEnd(body, boundary, crlf);
+    size_t pos = boundary_searcher.FindEnd(body);
     if (pos == std::string_view::npos) {
         LOG_WARNING() << "Unexpected end of form-data part value";
         return false;
     }
-    arg_info.arg.value = body.substr(0, pos - boundary.size() - 2 - crlf.size());
+    arg_info.arg.value = body.substr(0, pos - boundary_searcher.GetDelimiterSize());
     if (arg_info.name == kCharset) {
         charset = arg_info.arg.value;
     } else {
@@ -313,14 +322,18 @@ bool ParseMultipartFormDataBody(
 ) {
     LOG_TRACE() << "body=" << body << ", body.size()=" << body.size();
     std::string_view crlf = "\r\n";
-    if (boundary.size() + 2 <= body.size() && body[0] == '-' && body[1] == '-' &&
-        body.substr(2, boundary.size()) == boundary) {
+    const bool starts_with_boundary = boundary.size() + 2 <= body.size() && body[0] == '-' && body[1] == '-' &&
+                                      body.substr(2, boundary.size()) == boundary;
+    if (starts_with_boundary) {
         body.remove_prefix(2 + boundary.size());
-        if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
     } else {
         while (!body.empty() && body.front() != kCr && body.front() != kLf) body.remove_prefix(1);
-        if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
-        size_t pos = FindBoundaryEnd(body, boundary, crlf);
+    }
+    if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
+
+    const BoundarySearcher boundary_searcher{boundary, crlf};
+    if (!starts_with_boundary) {
+        size_t pos = boundary_searcher.FindEnd(body);
         if (pos == std::string_view::npos) {
             LOG_WARNING() << "Unexpected request body end";
             return false;
@@ -362,7 +375,7 @@ bool ParseMultipartFormDataBody(
 
         if (!ParseMultipartFormDataHeaders(body, arg_info, crlf)) return false;
         LOG_TRACE() << "ParseMultipartFormDataHeaders finished, body=" << body << ", body.size()=" << body.size();
-        if (!ParseMultipartFormDataValue(body, boundary, std::move(arg_info), charset, form_data_args, crlf)) {
+        if (!ParseMultipartFormDataValue(body, boundary_searcher, std::move(arg_info), charset, form_data_args)) {
             return false;
         }
     }
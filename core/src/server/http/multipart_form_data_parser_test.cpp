@@ -511,4 +511,31 @@ TEST(MultipartFormDataParser, ParseErrors) {
     EXPECT_TRUE(form_data_args.empty());
 }
 
+TEST(MultipartFormDataParser, ParseLargeValueWithBoundaryPrefixes) {
+    namespace sh = server::http;
+    const std::string kContentType = "multipart/form-data; boundary=zzz";
+    std::string value;
+    for (int i = 0; i < 10000; ++i) value += "line\r\n--zz\r\n-zzz\r\n--zzy";
+    const std::string kBody =
+        "--zzz\r\n"
+        "Content-Disposition: form-data; name=\"file\"; filename=\"a.txt\"\r\n"
+        "\r\n" +
+        value +
+        "\r\n"
+        "--zzz\r\n"
+        "Content-Disposition: form-data; name=\"text\"\r\n"
+        "\r\n"
+        "--zz\r\n"
+        "--zzz--\r\n";
+
+    sh::FormDataArgs form_data_args;
+    ASSERT_TRUE(ParseMultipartFormData(kContentType, kBody, form_data_args));
+    ASSERT_EQ(form_data_args["file"].size(), 1);
+    EXPECT_EQ(form_data_args["file"].front().value, value);
+    // the value refers to the request body
+    EXPECT_EQ(form_data_args["file"].front().value.data(), kBody.data() + kBody.find("line"));
+    ASSERT_EQ(form_data_args["text"].size(), 1);
+    EXPECT_EQ(form_data_args["text"].front().value, "--zz");
+}
+
 USERVER_NAMESPACE_END
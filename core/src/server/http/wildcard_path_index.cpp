@@ -20,6 +20,18 @@ std::vector<std::string> SplitBySlash(const std::string& path) {
     return path_vec;
 }
 
+// Same as SplitBySlash, but does not allocate for typical paths
+WildcardPathIndex::PathSegments SplitBySlashToViews(std::string_view path) {
+    WildcardPathIndex::PathSegments segments;
+    while (true) {
+        const auto pos = path.find('/');
+        segments.push_back(path.substr(0, pos));
+        if (pos == std::string_view::npos) break;
+        path.remove_prefix(pos + 1);
+    }
+    return segments;
+}
+
 std::string ExtractWildcardName(const std::string& str) {
     if (str.empty() || str.front() != kWildcardStart || str.back() != kWildcardFinish) {
         throw std::runtime_error("Incorrect wildcard '" + str + '\'');
@@ -31,7 +43,7 @@ std::string ExtractWildcardName(const std::string& str) {
 bool GetFromHandlerMethodIndex(
     const WildcardPathIndex::Node& node,
     HttpMethod method,
-    const std::vector<std::string>& path,
+    const WildcardPathIndex::PathSegments& path,
     MatchRequestResult& match_result,
     bool limit_path_length
 ) {
@@ -60,7 +72,9 @@ bool GetFromHandlerMethodIndex(
                 "matched path from handler has length greater than path from "
                 "request"
             );
-        match_result.args_from_path.emplace_back(arg.name, arg.index == path.size() ? std::string{} : path[arg.index]);
+        match_result.args_from_path.emplace_back(
+            arg.name, arg.index == path.size() ? std::string{} : std::string{path[arg.index]}
+        );
     }
     match_result.status = MatchRequestResult::Status::kOk;
     return true;
@@ -104,7 +118,7 @@ void WildcardPathIndex::AddHandler(const handlers::HttpHandlerBase& handler, eng
 
 bool WildcardPathIndex::MatchRequest(HttpMethod method, const std::string& path, MatchRequestResult& match_result)
     const {
-    return MatchRequest(root_, method, SplitBySlash(path), path.size(), match_result);
+    return MatchRequest(root_, method, SplitBySlashToViews(path), path.size(), match_result);
 }
 
 void WildcardPathIndex::AddHandler(
@@ -147,7 +161,7 @@ void WildcardPathIndex::AddPath(
 bool WildcardPathIndex::MatchRequest(
     const Node& node,
     HttpMethod method,
-    const std::vector<std::string>& path,
+    const PathSegments& path,
     size_t path_string_length,
     MatchRequestResult& match_result
 ) const {
@@ -178,7 +192,7 @@ bool WildcardPathIndex::MatchRequest(
                     match_result.matched_path_length += path[i].size();
                 }
                 for (size_t i = asterisk_pos; i < path.size(); i++) {
-                    match_result.args_from_path.emplace_back(std::string{}, path[i]);
+                    match_result.args_from_path.emplace_back(std::string{}, std::string{path[i]});
                 }
                 return true;
             }
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <functional>
 #include <map>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
+
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <server/http/handler_info_index.hpp>
@@ -22,12 +26,15 @@ class WildcardPathIndex final {
 public:
     struct Node {
         // ordered by position in path
-        std::map<size_t, std::map<std::string, Node>> next;
+        std::map<size_t, std::map<std::string, Node, std::less<>>> next;
 
         // by path length
         std::map<size_t, HandlerMethodIndex> handler_method_index_map;
     };
 
+    // Path segments of a request, point into the request path
+    using PathSegments = boost::container::small_vector<std::string_view, 16>;
+
     void AddHandler(const handlers::HttpHandlerBase& handler, engine::TaskProcessor& task_processor);
 
     bool MatchRequest(HttpMethod method, const std::string& path, MatchRequestResult& match_result) const;
@@ -49,7 +56,7 @@ private:
     bool MatchRequest(
         const Node& node,
         HttpMethod method,
-        const std::vector<std::string>& path,
+        const PathSegments& path,
         size_t path_string_length,
         MatchRequestResult& match_result
     ) const;
@@ -28,6 +28,9 @@ void Auth::HandleRequest(http::HttpRequest& request, request::RequestContext& co
     }
 }
 
+// Without checkers the request is always authorized
+bool Auth::IsNoop() const { return auth_checkers_.empty(); }
+
 bool Auth::CheckAuth(const http::HttpRequest& request, request::RequestContext& context) const {
     const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime("http_check_auth");
     if (!handler_.NeedCheckAuth()) {
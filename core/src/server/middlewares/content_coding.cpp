@@ -0,0 +1,94 @@
+#include <server/middlewares/content_coding.hpp>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares::content_coding {
+
+namespace {
+
+std::string_view Trim(std::string_view str) {
+    const auto begin = str.find_first_not_of(" \t");
+    if (begin == std::string_view::npos) return {};
+    const auto end = str.find_last_not_of(" \t");
+    return str.substr(begin, end - begin + 1);
+}
+
+// Returns the `q` parameter of an Accept-Encoding item, 1 if not specified
+double ParseQuality(std::string_view params) {
+    while (!params.empty()) {
+        const auto pos = params.find(';');
+        const auto param = Trim(params.substr(0, pos));
+        if (param.size() > 2 && (param[0] == 'q' || param[0] == 'Q') && param[1] == '=') {
+            return std::strtod(std::string{param.substr(2)}.c_str(), nullptr);
+        }
+        if (pos == std::string_view::npos) break;
+        params.remove_prefix(pos + 1);
+    }
+    return 1;
+}
+
+}  // namespace
+
+// RFC 9110, 12.5.3. The client preference wins, the server order breaks ties.
+// Missing header means that the client does not care, but compressing the
+// responses for such clients is not safe.
+std::optional<std::size_t> Select(
+    std::string_view accept_encoding,
+    std::size_t coding_count,
+    utils::function_ref<std::string_view(std::size_t)> get_coding
+) {
+    std::vector<std::optional<double>> qualities(coding_count);
+    std::optional<double> any_quality;
+
+    while (!accept_encoding.empty()) {
+        const auto item_end = accept_encoding.find(',');
+        const auto item = accept_encoding.substr(0, item_end);
+        const auto params_begin = item.find(';');
+        const auto coding = Trim(item.substr(0, params_begin));
+        const auto quality =
+            params_begin == std::string_view::npos ? 1.0 : ParseQuality(item.substr(params_begin + 1));
+
+        if (coding == "*") {
+            any_quality = quality;
+        } else {
+            for (std::size_t i = 0; i < coding_count; ++i) {
+                if (utils::StrIcaseEqual{}(coding, get_coding(i))) qualities[i] = quality;
+            }
+        }
+
+        if (item_end == std::string_view::npos) break;
+        accept_encoding.remove_prefix(item_end + 1);
+    }
+
+    std::optional<std::size_t> result;
+    double best_quality = 0;
+    for (std::size_t i = 0; i < coding_count; ++i) {
+        const auto quality = qualities[i].value_or(any_quality.value_or(0));
+        if (quality > best_quality) {
+            best_quality = quality;
+            result = i;
+        }
+    }
+    return result;
+}
+
+void AddVaryAcceptEncoding(http::HttpResponse& response) {
+    const auto& vary = response.GetHeader(USERVER_NAMESPACE::http::headers::kVary);
+    if (vary.find("Accept-Encoding") != std::string::npos) return;
+
+    response.SetHeader(
+        USERVER_NAMESPACE::http::headers::kVary,
+        vary.empty() ? std::string{"Accept-Encoding"} : vary + ", Accept-Encoding"
+    );
+}
+
+}  // namespace server::middlewares::content_coding
+
+USERVER_NAMESPACE_END
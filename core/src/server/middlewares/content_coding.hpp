@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#include <userver/server/http/http_response.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares::content_coding {
+
+/// Returns the index of the content coding out of `get_coding(0)`, ...,
+/// `get_coding(coding_count - 1)` that the client prefers according to the
+/// `Accept-Encoding` header, std::nullopt if none of them is acceptable.
+std::optional<std::size_t> Select(
+    std::string_view accept_encoding,
+    std::size_t coding_count,
+    utils::function_ref<std::string_view(std::size_t)> get_coding
+);
+
+/// Adds `Accept-Encoding` to the `Vary` header of the response
+void AddVaryAcceptEncoding(http::HttpResponse& response);
+
+}  // namespace server::middlewares::content_coding
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,34 @@
+#include <server/middlewares/content_coding.hpp>
+
+#include <array>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::array<std::string_view, 2> kCodings{"zstd", "gzip"};
+
+std::optional<std::size_t> Select(std::string_view accept_encoding) {
+    return server::middlewares::content_coding::Select(accept_encoding, kCodings.size(), [](std::size_t i) {
+        return kCodings[i];
+    });
+}
+
+}  // namespace
+
+TEST(ContentCoding, Select) {
+    EXPECT_EQ(Select(""), std::nullopt);
+    EXPECT_EQ(Select("identity"), std::nullopt);
+    EXPECT_EQ(Select("gzip"), 1);
+    EXPECT_EQ(Select("GZIP, br"), 1);
+    EXPECT_EQ(Select("gzip, zstd"), 0);
+    EXPECT_EQ(Select("gzip;q=1.0, zstd;q=0.5"), 1);
+    EXPECT_EQ(Select("zstd;q=0, gzip;q=0.1"), 1);
+    EXPECT_EQ(Select("*"), 0);
+    EXPECT_EQ(Select("zstd;q=0, *;q=0.3"), 1);
+    EXPECT_EQ(Select("gzip;q=0, zstd;q=0"), std::nullopt);
+}
+
+USERVER_NAMESPACE_END
@@ -159,7 +159,7 @@ void DeadlinePropagation::SetupInheritedDeadline(
     const auto deadline = engine::Deadline::FromTimePoint(request.GetStartTime() + *timeout);
     inherited_data.deadline = deadline;
 
-    if (deadline.IsSurelyReachedApprox()) {
+    if (deadline.IsSurelyReachedCached()) {
         HandleDeadlineExpired(request, dp_scope, "Immediate timeout (deadline propagation)");
         return;
     }
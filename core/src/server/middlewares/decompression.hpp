@@ -25,6 +25,8 @@ public:
 private:
     void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
 
+    bool IsNoop() const override;
+
     bool DecompressRequestBody(http::HttpRequest& request) const;
 
     const bool decompress_request_;
@@ -45,6 +47,8 @@ public:
 private:
     void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
 
+    bool IsNoop() const override;
+
     void SetResponseAcceptEncoding(http::HttpResponse& response) const;
 
     const bool decompress_request_;
@@ -0,0 +1,31 @@
+#include <server/middlewares/flat_pipeline.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+FlatPipeline::FlatPipeline() = default;
+
+FlatPipeline::~FlatPipeline() = default;
+
+void FlatPipeline::Reserve(std::size_t size) { middlewares_.reserve(size); }
+
+bool FlatPipeline::Append(std::unique_ptr<HttpMiddlewareBase> middleware) {
+    UASSERT(middleware);
+    if (middleware->IsNoop()) return false;
+
+    if (!middlewares_.empty()) middlewares_.back()->next_ = middleware.get();
+    middlewares_.push_back(std::move(middleware));
+    return true;
+}
+
+void FlatPipeline::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
+    UASSERT(!middlewares_.empty());
+    middlewares_.front()->HandleRequest(request, context);
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
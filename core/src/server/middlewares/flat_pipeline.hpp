@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <userver/server/middlewares/http_middleware_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+// Middlewares of a handler in the order of invocation, each one calls the next
+// directly. No-op middlewares are dropped when appended.
+class FlatPipeline final {
+public:
+    FlatPipeline();
+    ~FlatPipeline();
+
+    void Reserve(std::size_t size);
+
+    // Returns false if the middleware is a no-op and was dropped
+    bool Append(std::unique_ptr<HttpMiddlewareBase> middleware);
+
+    std::size_t Size() const noexcept { return middlewares_.size(); }
+
+    void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const;
+
+private:
+    std::vector<std::unique_ptr<HttpMiddlewareBase>> middlewares_;
+};
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
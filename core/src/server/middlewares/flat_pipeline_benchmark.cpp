@@ -0,0 +1,60 @@
+#include <server/middlewares/flat_pipeline.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/request/request_context.hpp>
+#include <userver/server/request/response_base.hpp>
+#include <userver/utils/impl/internal_tag.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class PassThrough final : public server::middlewares::HttpMiddlewareBase {
+public:
+    explicit PassThrough(bool is_noop) : is_noop_(is_noop) {}
+
+private:
+    void HandleRequest(server::http::HttpRequest& request, server::request::RequestContext& context) const override {
+        Next(request, context);
+    }
+
+    bool IsNoop() const override { return is_noop_; }
+
+    const bool is_noop_;
+};
+
+class Terminal final : public server::middlewares::HttpMiddlewareBase {
+private:
+    void HandleRequest(server::http::HttpRequest&, server::request::RequestContext& context) const override {
+        benchmark::DoNotOptimize(&context);
+    }
+};
+
+// `state.range(0)` middlewares, `state.range(1)` of them are no-op
+void http_middlewares_pipeline(benchmark::State& state) {
+    const auto total = static_cast<std::size_t>(state.range(0));
+    const auto noop = static_cast<std::size_t>(state.range(1));
+
+    server::middlewares::FlatPipeline pipeline;
+    for (std::size_t i = 0; i < total; ++i) {
+        // Spread no-op middlewares over the pipeline
+        pipeline.Append(std::make_unique<PassThrough>(i * noop / total != (i + 1) * noop / total));
+    }
+    pipeline.Append(std::make_unique<Terminal>());
+
+    server::request::ResponseDataAccounter accounter;
+    server::http::HttpRequest request{accounter, utils::impl::InternalTag{}};
+    server::request::RequestContext context;
+
+    for ([[maybe_unused]] auto _ : state) {
+        pipeline.HandleRequest(request, context);
+    }
+    state.counters["calls"] = static_cast<double>(pipeline.Size());
+}
+BENCHMARK(http_middlewares_pipeline)->Args({12, 0})->Args({12, 4})->Args({32, 0});
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -13,18 +13,24 @@ USERVER_NAMESPACE_BEGIN
 namespace server::middlewares {
 
 HeadersPropagator::HeadersPropagator(const handlers::HttpHandlerBase&, std::vector<std::string> headers)
-    : headers_(std::move(headers)) {}
+    : headers_(std::move(headers)) {
+    prehashed_headers_.reserve(headers_.size());
+    for (const auto& header_name : headers_) {
+        prehashed_headers_.emplace_back(header_name);
+    }
+}
 
 void HeadersPropagator::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
     USERVER_NAMESPACE::server::request::HeadersToPropagate headers_to_propagate;
-    for (const auto& header_name : headers_) {
-        const auto* header_value = utils::FindOrNullptr(request.GetHeaders(), header_name);
+    const auto& request_headers = request.GetHeaders();
+    for (std::size_t i = 0; i < headers_.size(); ++i) {
+        const auto* header_value = utils::FindOrNullptr(request_headers, prehashed_headers_[i]);
         if (!header_value) {
             continue;
         }
-        headers_to_propagate.emplace_back(header_name, *header_value);
+        headers_to_propagate.emplace_back(headers_[i], *header_value);
     }
-    USERVER_NAMESPACE::server::request::SetPropagatedHeaders(headers_to_propagate);
+    USERVER_NAMESPACE::server::request::SetPropagatedHeaders(std::move(headers_to_propagate));
     Next(request, context);
 }
 
@@ -1,7 +1,6 @@
 #include <userver/server/middlewares/http_middleware_base.hpp>
 
 #include <userver/components/component_config.hpp>
-#include <userver/utils/assert.hpp>
 #include <userver/yaml_config/impl/validate_static_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -12,11 +11,6 @@ HttpMiddlewareBase::HttpMiddlewareBase() = default;
 
 HttpMiddlewareBase::~HttpMiddlewareBase() = default;
 
-void HttpMiddlewareBase::Next(http::HttpRequest& request, request::RequestContext& context) const {
-    UASSERT(next_);
-    next_->HandleRequest(request, context);
-}
-
 HttpMiddlewareFactoryBase::HttpMiddlewareFactoryBase(
     const components::ComponentConfig& config,
     const components::ComponentContext& context
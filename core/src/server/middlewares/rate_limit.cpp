@@ -1,22 +1,64 @@
 #include <server/middlewares/rate_limit.hpp>
 
+#include <netinet/in.h>
+
 #include <server/handlers/http_handler_base_statistics.hpp>
+#include <server/handlers/http_server_settings.hpp>
+#include <server/request/internal_request_context.hpp>
 
 #include <userver/http/common_headers.hpp>
 #include <userver/server/handlers/exceptions.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_status.hpp>
+#include <userver/server/request/request_context.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::middlewares {
 
+namespace {
+
+std::string_view GetRemoteIp(const http::HttpRequest& request) {
+    const auto& address = request.GetRemoteAddress();
+    switch (address.Domain()) {
+        case engine::io::AddrDomain::kInet: {
+            const auto& ip = address.As<sockaddr_in>()->sin_addr;
+            return {reinterpret_cast<const char*>(&ip), sizeof(ip)};
+        }
+        case engine::io::AddrDomain::kInet6: {
+            const auto& ip = address.As<sockaddr_in6>()->sin6_addr;
+            return {reinterpret_cast<const char*>(&ip), sizeof(ip)};
+        }
+        default:
+            return {};
+    }
+}
+
+// Clients without the header are limited by their IPs
+std::string_view GetClientKey(const http::HttpRequest& request, const handlers::ClientRateLimit& limit) {
+    if (!limit.client_header.empty()) {
+        const auto& client = request.GetHeader(limit.client_header);
+        if (!client.empty()) return client;
+    }
+    return GetRemoteIp(request);
+}
+
+}  // namespace
+
 RateLimit::RateLimit(const handlers::HttpHandlerBase& handler)
     : rate_limit_{utils::TokenBucket::MakeUnbounded()},
       statistics_{handler.GetHandlerStatistics()},
       max_requests_per_second_{handler.GetConfig().max_requests_per_second},
       max_requests_in_flight_{handler.GetConfig().max_requests_in_flight},
       handler_{handler} {
+    if (const auto max_clients = handler.GetConfig().max_rate_limited_clients) {
+        const auto* path = std::get_if<std::string>(&handler.GetConfig().path);
+        UINVARIANT(path, "max_rate_limited_clients is not supported for fallback handlers");
+        client_rate_limit_ = std::make_unique<utils::KeyedTokenBucket>(*max_clients);
+        path_ = *path;
+    }
+
     if (max_requests_per_second_.has_value()) {
         const auto max_rps = *max_requests_per_second_;
         UASSERT_MSG(max_rps > 0, "max_requests_per_second option was not verified in config parsing");
@@ -26,12 +68,16 @@ RateLimit::RateLimit(const handlers::HttpHandlerBase& handler)
 }
 
 void RateLimit::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
-    if (CheckRateLimit(request)) {
+    if (CheckRateLimit(request, context)) {
         Next(request, context);
     }
 }
 
-bool RateLimit::CheckRateLimit(const http::HttpRequest& request) const {
+bool RateLimit::IsNoop() const {
+    return !max_requests_per_second_ && !max_requests_in_flight_ && !client_rate_limit_;
+}
+
+bool RateLimit::CheckRateLimit(const http::HttpRequest& request, request::RequestContext& context) const {
     auto& statistics = statistics_.ForMethod(request.GetMethod());
 
     const bool success = rate_limit_.Obtain();
@@ -49,9 +95,9 @@ bool RateLimit::CheckRateLimit(const http::HttpRequest& request) const {
         return false;
     }
 
-    auto max_requests_in_flight = max_requests_in_flight_;
-    auto requests_in_flight = statistics.GetInFlight();
-    if (max_requests_in_flight && (requests_in_flight > *max_requests_in_flight)) {
+    // Reading the in-flight counters sums up their per-CPU values
+    const auto max_requests_in_flight = max_requests_in_flight_;
+    if (max_requests_in_flight && (statistics.GetInFlight() > *max_requests_in_flight)) {
         auto& http_response = request.GetHttpResponse();
         auto log_reason = fmt::format("reached max_requests_in_flight={}", *max_requests_in_flight);
         SetThrottleReason(
@@ -66,7 +112,33 @@ bool RateLimit::CheckRateLimit(const http::HttpRequest& request) const {
         return false;
     }
 
-    return true;
+    return CheckClientRateLimit(request, context);
+}
+
+bool RateLimit::CheckClientRateLimit(const http::HttpRequest& request, request::RequestContext& context) const {
+    if (!client_rate_limit_) return true;
+
+    const auto& config_snapshot = context.GetInternalContext().GetConfigSnapshot();
+    const auto limit = config_snapshot[handlers::kClientRateLimits].GetOptional(path_);
+    if (!limit || limit->max_requests_per_second == 0) return true;
+
+    const auto burst = limit->burst.value_or(limit->max_requests_per_second);
+    const utils::KeyedTokenBucket::Limit bucket_limit{
+        burst, utils::KeyedTokenBucket::Duration{std::chrono::seconds{1}} / limit->max_requests_per_second};
+    if (client_rate_limit_->Obtain(GetClientKey(request, *limit), bucket_limit)) return true;
+
+    auto& response = request.GetHttpResponse();
+    auto log_reason = fmt::format(
+        "reached max-requests-per-second={} for the client in USERVER_HANDLER_CLIENT_RATE_LIMITS",
+        limit->max_requests_per_second
+    );
+    SetThrottleReason(
+        response, std::move(log_reason), std::string{USERVER_NAMESPACE::http::headers::ratelimit_reason::kClient}
+    );
+    statistics_.ForMethod(request.GetMethod()).IncrementRateLimitReached();
+
+    FailProcessingAndSetResponse(request);
+    return false;
 }
 
 void RateLimit::FailProcessingAndSetResponse(const http::HttpRequest& request) const {
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <memory>
 #include <optional>
+#include <string>
 
 #include <userver/server/middlewares/builtin.hpp>
 #include <userver/server/middlewares/http_middleware_base.hpp>
+#include <userver/utils/keyed_token_bucket.hpp>
 #include <userver/utils/token_bucket.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -23,7 +26,11 @@ public:
 private:
     void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
 
-    bool CheckRateLimit(const http::HttpRequest& request) const;
+    bool IsNoop() const override;
+
+    bool CheckRateLimit(const http::HttpRequest& request, request::RequestContext& context) const;
+
+    bool CheckClientRateLimit(const http::HttpRequest& request, request::RequestContext& context) const;
 
     void FailProcessingAndSetResponse(const http::HttpRequest& request) const;
 
@@ -33,6 +40,10 @@ private:
     std::optional<std::size_t> max_requests_per_second_;
     std::optional<std::size_t> max_requests_in_flight_;
 
+    // Per-client limits of USERVER_HANDLER_CLIENT_RATE_LIMITS, null if disabled
+    std::unique_ptr<utils::KeyedTokenBucket> client_rate_limit_;
+    std::string path_;
+
     const handlers::HttpHandlerBase& handler_;
 };
 
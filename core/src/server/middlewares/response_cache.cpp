@@ -0,0 +1,274 @@
+#include <userver/server/middlewares/response_cache.hpp>
+
+#include <string_view>
+#include <utility>
+
+#include <userver/cache/nway_lru_cache.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/crypto/hash.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text_light.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace {
+
+struct CachedResponse final {
+    using Headers = std::vector<std::pair<std::string, std::string>>;
+
+    http::HttpStatus status{http::HttpStatus::kOk};
+    Headers headers;
+    // The subset of the headers that a 304 response repeats, RFC 9110 15.4.5
+    Headers not_modified_headers;
+    std::string body;
+    std::string etag;
+    std::chrono::steady_clock::time_point expires_at;
+};
+
+using CachedResponsePtr = std::shared_ptr<const CachedResponse>;
+
+constexpr std::string_view kWhitespace = " \t";
+
+std::string_view TrimView(std::string_view value) {
+    const auto begin = value.find_first_not_of(kWhitespace);
+    if (begin == std::string_view::npos) return {};
+    const auto end = value.find_last_not_of(kWhitespace);
+    return value.substr(begin, end - begin + 1);
+}
+
+// Weak comparison of the entity tags, RFC 9110 13.1.2
+std::string_view StripWeakPrefix(std::string_view etag) {
+    if (etag.size() > 2 && etag.substr(0, 2) == "W/") etag.remove_prefix(2);
+    return etag;
+}
+
+bool MatchesIfNoneMatch(std::string_view if_none_match, std::string_view etag) {
+    etag = StripWeakPrefix(etag);
+    for (const auto tag : utils::text::SplitIntoStringViewVector(if_none_match, ",")) {
+        const auto trimmed = TrimView(tag);
+        if (trimmed == "*" || StripWeakPrefix(trimmed) == etag) return true;
+    }
+    return false;
+}
+
+bool IsStorable(const http::HttpResponse& response) {
+    if (response.GetStatus() != http::HttpStatus::kOk || response.IsBodyStreamed()) return false;
+    // Cookies are personal, never serve them to someone else
+    if (response.GetCookieNames().begin() != response.GetCookieNames().end()) return false;
+
+    const auto& cache_control = response.GetHeader(USERVER_NAMESPACE::http::headers::kCacheControl);
+    for (const auto directive : utils::text::SplitIntoStringViewVector(cache_control, ",")) {
+        const auto trimmed = TrimView(directive);
+        if (utils::text::ICaseStartsWith(trimmed, "no-store") || utils::text::ICaseStartsWith(trimmed, "private")) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool IsRepeatedByNotModified(std::string_view header) {
+    namespace headers = USERVER_NAMESPACE::http::headers;
+    const utils::StrIcaseEqual equal;
+    return equal(header, headers::kETag) || equal(header, headers::kCacheControl) || equal(header, headers::kVary) ||
+           equal(header, headers::kExpires) || equal(header, headers::kContentLocation);
+}
+
+void SetHeaders(http::HttpResponse& response, const CachedResponse::Headers& headers) {
+    for (const auto& [name, value] : headers) response.SetHeader(std::string_view{name}, value);
+}
+
+}  // namespace
+
+}  // namespace server::middlewares
+
+template <>
+struct cache::EntryCost<std::string, server::middlewares::CachedResponsePtr> final {
+    std::size_t operator()(const std::string& key, const server::middlewares::CachedResponsePtr& response)
+        const noexcept {
+        std::size_t cost = sizeof(server::middlewares::CachedResponse) + key.size() + response->body.size() +
+                           response->etag.size();
+        for (const auto& headers : {&response->headers, &response->not_modified_headers}) {
+            for (const auto& [name, value] : *headers) {
+                cost += sizeof(name) + name.size() + sizeof(value) + value.size();
+            }
+        }
+        return cost;
+    }
+};
+
+namespace server::middlewares {
+
+class ResponseCacheStorage final {
+public:
+    ResponseCacheStorage(std::size_t max_bytes, std::size_t ways, std::size_t max_body_size)
+        : cache_(ways, max_bytes / ways + 1), max_body_size_(max_body_size) {
+        cache_.UpdateWayMaxBytes(max_bytes / ways + 1);
+    }
+
+    CachedResponsePtr Get(const std::string& key) {
+        const auto now = utils::datetime::SteadyNow();
+        auto response =
+            cache_.Get(key, [now](const CachedResponsePtr& response) { return response->expires_at > now; });
+        return response ? std::move(*response) : nullptr;
+    }
+
+    void Put(const std::string& key, CachedResponsePtr response) { cache_.Put(key, std::move(response)); }
+
+    std::size_t GetMaxBodySize() const { return max_body_size_; }
+
+private:
+    cache::NWayLRU<std::string, CachedResponsePtr> cache_;
+    const std::size_t max_body_size_;
+};
+
+ResponseCacheSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ResponseCacheSettings>) {
+    ResponseCacheSettings settings;
+    settings.ttl = value["ttl"].As<std::chrono::milliseconds>(settings.ttl);
+    settings.vary_headers = value["vary-headers"].As<std::vector<std::string>>(settings.vary_headers);
+    return settings;
+}
+
+ResponseCache::ResponseCache(
+    const handlers::HttpHandlerBase&,
+    ResponseCacheStorage& storage,
+    ResponseCacheSettings settings
+)
+    : storage_(storage), settings_(std::move(settings)) {}
+
+bool ResponseCache::IsNoop() const { return settings_.ttl <= std::chrono::milliseconds::zero(); }
+
+std::string ResponseCache::MakeKey(const http::HttpRequest& request) const {
+    std::string key = http::ToString(request.GetMethod());
+    key += ' ';
+    key += request.GetUrl();
+    // The compression middleware may run after this one
+    key += '\n';
+    key += request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding);
+    for (const auto& header : settings_.vary_headers) {
+        key += '\n';
+        key += request.GetHeader(header);
+    }
+    return key;
+}
+
+void ResponseCache::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
+    const auto method = request.GetMethod();
+    if (method != http::HttpMethod::kGet && method != http::HttpMethod::kHead) {
+        Next(request, context);
+        return;
+    }
+
+    auto& response = request.GetHttpResponse();
+    const auto& if_none_match = request.GetHeader(USERVER_NAMESPACE::http::headers::kIfNoneMatch);
+    const auto key = MakeKey(request);
+
+    if (const auto cached = storage_.Get(key)) {
+        if (!if_none_match.empty() && MatchesIfNoneMatch(if_none_match, cached->etag)) {
+            response.SetStatus(http::HttpStatus::kNotModified);
+            SetHeaders(response, cached->not_modified_headers);
+            return;
+        }
+        response.SetStatus(cached->status);
+        SetHeaders(response, cached->headers);
+        response.SetData(cached->body);
+        return;
+    }
+
+    Next(request, context);
+
+    if (!IsStorable(response) || response.GetData().size() > storage_.GetMaxBodySize()) return;
+
+    if (!response.HasHeader(USERVER_NAMESPACE::http::headers::kETag)) {
+        response.SetHeader(
+            USERVER_NAMESPACE::http::headers::kETag, '"' + crypto::hash::Sha1(response.GetData()) + '"'
+        );
+    }
+
+    auto cached = std::make_shared<CachedResponse>();
+    cached->status = response.GetStatus();
+    for (const auto& name : response.GetHeaderNames()) {
+        auto header = std::make_pair(name, response.GetHeader(name));
+        if (IsRepeatedByNotModified(name)) cached->not_modified_headers.push_back(header);
+        cached->headers.push_back(std::move(header));
+    }
+    cached->body = response.GetData();
+    cached->etag = response.GetHeader(USERVER_NAMESPACE::http::headers::kETag);
+    cached->expires_at = utils::datetime::SteadyNow() + settings_.ttl;
+    storage_.Put(key, cached);
+
+    if (!if_none_match.empty() && MatchesIfNoneMatch(if_none_match, cached->etag)) {
+        response.SetStatus(http::HttpStatus::kNotModified);
+        response.SetData({});
+    }
+}
+
+ResponseCacheFactory::ResponseCacheFactory(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context
+)
+    : HttpMiddlewareFactoryBase(config, context),
+      storage_(std::make_unique<ResponseCacheStorage>(
+          config["max-bytes"].As<std::size_t>(64 * 1024 * 1024),
+          config["ways"].As<std::size_t>(16),
+          config["max-body-size"].As<std::size_t>(1024 * 1024)
+      )) {}
+
+ResponseCacheFactory::~ResponseCacheFactory() = default;
+
+std::unique_ptr<HttpMiddlewareBase>
+ResponseCacheFactory::Create(const handlers::HttpHandlerBase& handler, yaml_config::YamlConfig middleware_config)
+    const {
+    return std::make_unique<ResponseCache>(handler, *storage_, middleware_config.As<ResponseCacheSettings>({}));
+}
+
+yaml_config::Schema ResponseCacheFactory::GetMiddlewareConfigSchema() const {
+    return yaml_config::impl::SchemaFromString(R"(
+type: object
+description: response cache settings of the handler
+additionalProperties: false
+properties:
+    ttl:
+        type: string
+        description: for how long the response is served from the cache
+        defaultDescription: 0
+    vary-headers:
+        type: array
+        description: request headers that the response depends on
+        defaultDescription: '[]'
+        items:
+            type: string
+            description: header name
+)");
+}
+
+yaml_config::Schema ResponseCacheFactory::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<ComponentBase>(R"(
+type: object
+description: Http response cache middleware
+additionalProperties: false
+properties:
+    max-bytes:
+        type: integer
+        description: memory budget of the cached responses of all the handlers, in bytes
+        defaultDescription: 67108864
+    ways:
+        type: integer
+        description: number of the independently locked shards of the cache
+        defaultDescription: 16
+    max-body-size:
+        type: integer
+        description: maximal size of the body to cache, in bytes
+        defaultDescription: 1048576
+)");
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,190 @@
+#include <userver/server/middlewares/response_compression.hpp>
+
+#include <optional>
+#include <string_view>
+
+#include <compression/gzip.hpp>
+#include <server/http/body_stream_compressor.hpp>
+#include <server/middlewares/content_coding.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/tracing/scope_time.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace {
+
+constexpr utils::TrivialBiMap kEncodingNames = [](auto selector) {
+    return selector().Case(ResponseEncoding::kGzip, "gzip").Case(ResponseEncoding::kZstd, "zstd");
+};
+
+std::string_view ToString(ResponseEncoding encoding) { return *kEncodingNames.TryFind(encoding); }
+
+std::optional<ResponseEncoding>
+SelectEncoding(std::string_view accept_encoding, const std::vector<ResponseEncoding>& encodings) {
+    const auto index = content_coding::Select(accept_encoding, encodings.size(), [&encodings](std::size_t i) {
+        return ToString(encodings[i]);
+    });
+    if (!index) return std::nullopt;
+    return encodings[*index];
+}
+
+template <typename Compressor>
+class BodyStreamCompressor final : public http::impl::BodyStreamCompressor {
+public:
+    explicit BodyStreamCompressor(int level) : compressor_(level) {}
+
+    std::string Compress(std::string_view chunk) override { return compressor_.Compress(chunk); }
+
+    std::string Finish() override { return compressor_.Finish(); }
+
+private:
+    Compressor compressor_;
+};
+
+std::unique_ptr<http::impl::BodyStreamCompressor>
+MakeBodyStreamCompressor(ResponseEncoding encoding, const ResponseCompressionSettings& settings) {
+    switch (encoding) {
+        case ResponseEncoding::kGzip:
+            return std::make_unique<BodyStreamCompressor<compression::gzip::StreamCompressor>>(settings.gzip_level);
+        case ResponseEncoding::kZstd:
+            return std::make_unique<BodyStreamCompressor<compression::zstd::StreamCompressor>>(settings.zstd_level);
+    }
+    UINVARIANT(false, "Unexpected response encoding");
+}
+
+void SetEncodingHeaders(http::HttpResponse& response, ResponseEncoding encoding) {
+    response.SetContentEncoding(std::string{ToString(encoding)});
+
+    // The response depends on the request's Accept-Encoding, caches should know
+    content_coding::AddVaryAcceptEncoding(response);
+}
+
+bool IsBodyAllowed(http::HttpStatus status) {
+    const auto code = static_cast<int>(status);
+    return code >= 200 && code != 204 && code != 304;
+}
+
+}  // namespace
+
+ResponseEncoding Parse(const yaml_config::YamlConfig& value, formats::parse::To<ResponseEncoding>) {
+    return utils::ParseFromValueString(value, kEncodingNames);
+}
+
+ResponseCompressionSettings
+Parse(const yaml_config::YamlConfig& value, formats::parse::To<ResponseCompressionSettings>) {
+    ResponseCompressionSettings settings;
+    settings.encodings = value["encodings"].As<std::vector<ResponseEncoding>>(settings.encodings);
+    settings.min_size = value["min-size"].As<std::size_t>(settings.min_size);
+    settings.max_size = value["max-size"].As<std::size_t>(settings.max_size);
+    settings.gzip_level = value["gzip-level"].As<int>(settings.gzip_level);
+    settings.zstd_level = value["zstd-level"].As<int>(settings.zstd_level);
+    settings.compress_streams = value["compress-streams"].As<bool>(settings.compress_streams);
+    return settings;
+}
+
+ResponseCompression::ResponseCompression(const handlers::HttpHandlerBase&, const ResponseCompressionSettings& settings)
+    : settings_(settings) {}
+
+void ResponseCompression::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
+    const auto encoding =
+        request.GetMethod() == http::HttpMethod::kHead
+            ? std::nullopt
+            : SelectEncoding(request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding), settings_.encodings);
+
+    auto& response = request.GetHttpResponse();
+    if (encoding && response.IsBodyStreamed()) {
+        // The size of the body is unknown, the stream is compressed as the
+        // handler pushes the chunks
+        if (settings_.compress_streams) {
+            SetEncodingHeaders(response, *encoding);
+            response.SetBodyStreamCompressor(MakeBodyStreamCompressor(*encoding, settings_));
+        }
+        Next(request, context);
+        return;
+    }
+
+    Next(request, context);
+    if (encoding) CompressBody(response, *encoding);
+}
+
+void ResponseCompression::CompressBody(http::HttpResponse& response, ResponseEncoding encoding) const {
+    const auto& body = response.GetData();
+    if (body.size() < settings_.min_size || body.size() > settings_.max_size) return;
+    if (!IsBodyAllowed(response.GetStatus())) return;
+    // Already encoded by the handler
+    if (response.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding)) return;
+
+    const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime("http_compress_response_body");
+
+    auto compressed = encoding == ResponseEncoding::kGzip
+                          ? compression::gzip::Compress(body, settings_.gzip_level)
+                          : compression::zstd::Compress(body, settings_.zstd_level);
+    // Incompressible data
+    if (compressed.size() >= body.size()) return;
+
+    response.SetData(std::move(compressed));
+    SetEncodingHeaders(response, encoding);
+}
+
+ResponseCompressionFactory::ResponseCompressionFactory(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context
+)
+    : HttpMiddlewareFactoryBase(config, context), settings_(config.As<ResponseCompressionSettings>()) {}
+
+std::unique_ptr<HttpMiddlewareBase>
+ResponseCompressionFactory::Create(const handlers::HttpHandlerBase& handler, yaml_config::YamlConfig) const {
+    return std::make_unique<ResponseCompression>(handler, settings_);
+}
+
+yaml_config::Schema ResponseCompressionFactory::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<ComponentBase>(R"(
+type: object
+description: Http response compression middleware
+additionalProperties: false
+properties:
+    encodings:
+        type: array
+        description: content codings in the order of preference
+        defaultDescription: '[zstd, gzip]'
+        items:
+            type: string
+            description: content coding
+            enum:
+              - zstd
+              - gzip
+    min-size:
+        type: integer
+        description: minimal size of the body to compress, in bytes
+        defaultDescription: 1024
+    max-size:
+        type: integer
+        description: maximal size of the body to compress, in bytes; limits the CPU time spent on a single response
+        defaultDescription: 8388608
+    gzip-level:
+        type: integer
+        description: gzip compression level
+        defaultDescription: 6
+    zstd-level:
+        type: integer
+        description: zstd compression level
+        defaultDescription: 3
+    compress-streams:
+        type: boolean
+        description: whether to compress the stream'ed responses
+        defaultDescription: true
+)");
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
@@ -13,6 +13,7 @@
 #include <userver/server/http/http_request.hpp>
 #include <userver/server/request/request_context.hpp>
 #include <userver/tracing/manager_component.hpp>
+#include <userver/tracing/sampler.hpp>
 #include <userver/tracing/span_builder.hpp>
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
@@ -91,6 +92,9 @@ tracing::Span Tracing::MakeSpan(const http::HttpRequest& http_request, std::stri
     tracing_manager_.TryFillSpanBuilderFromRequest(http_request, span_builder);
     auto span = std::move(span_builder).Build();
 
+    if (const auto* sampler = tracing_manager_.GetSampler()) {
+        span.SetSampling(sampler->Sample(span), sampler->GetTailSamplingSettings(), utils::impl::InternalTag{});
+    }
     span.SetLocalLogLevel(log_level_);
 
     span.AddNonInheritableTag(tracing::kHttpMetaType, std::string{meta_type});
@@ -0,0 +1,69 @@
+#include <server/net/accept_shedding.hpp>
+
+#include <stdexcept>
+#include <string>
+
+#include <userver/logging/log.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+namespace {
+
+AcceptSheddingMode ParseMode(const yaml_config::YamlConfig& value) {
+    const auto mode = value.As<std::string>("none");
+    if (mode == "none") return AcceptSheddingMode::kNone;
+    if (mode == "pause") return AcceptSheddingMode::kPause;
+    if (mode == "reset") return AcceptSheddingMode::kReset;
+    if (mode == "defer-tls") return AcceptSheddingMode::kDeferTls;
+    throw std::runtime_error("Unknown accept shedding mode '" + mode + "' in " + value.GetPath());
+}
+
+}  // namespace
+
+AcceptSheddingConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<AcceptSheddingConfig>) {
+    AcceptSheddingConfig config;
+    config.mode = ParseMode(value["mode"]);
+    config.overload_percent = value["overload-percent"].As<double>(config.overload_percent);
+    config.check_interval = value["check-interval"].As<std::chrono::milliseconds>(config.check_interval);
+    config.overload_backlog = value["overload-backlog"].As<int>(config.overload_backlog);
+    config.max_tls_defer = value["max-tls-defer"].As<std::chrono::milliseconds>(config.max_tls_defer);
+
+    if (config.check_interval <= std::chrono::milliseconds::zero()) {
+        throw std::runtime_error("Invalid check-interval value in " + value.GetPath());
+    }
+    if (config.overload_backlog <= 0) {
+        throw std::runtime_error("Invalid overload-backlog value in " + value.GetPath());
+    }
+    return config;
+}
+
+OverloadDetector::OverloadDetector(engine::TaskProcessor& task_processor, const AcceptSheddingConfig& config)
+    : overload_percent_(config.overload_percent), check_interval_(config.check_interval), sensor_(task_processor) {}
+
+bool OverloadDetector::IsOverloaded() {
+    // Concurrent callers just use the previous verdict
+    std::unique_lock lock{sensor_mutex_, std::try_to_lock};
+    if (lock.owns_lock()) {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= next_check_) {
+            next_check_ = now + check_interval_;
+
+            const auto load_percent = sensor_.FetchCurrent().GetLoadPercent();
+            const bool is_overloaded = load_percent >= overload_percent_;
+            if (is_overloaded != is_overloaded_.load(std::memory_order_relaxed)) {
+                LOG_WARNING() << (is_overloaded ? "Task processor is overloaded" : "Task processor overload is gone")
+                              << " (" << load_percent << "% of tasks waited too long in queue), "
+                              << (is_overloaded ? "shedding" : "accepting") << " new connections";
+                is_overloaded_.store(is_overloaded, std::memory_order_relaxed);
+            }
+        }
+    }
+    return is_overloaded_.load(std::memory_order_relaxed);
+}
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
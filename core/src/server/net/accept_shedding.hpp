@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/server/congestion_control/sensor.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+enum class AcceptSheddingMode {
+    // accept connections regardless of the overload
+    kNone,
+    // stop accepting and shrink the listen backlog, the kernel sheds the rest
+    kPause,
+    // accept and immediately reset the connection
+    kReset,
+    // accept, but postpone the TLS handshake until the overload is gone
+    kDeferTls,
+};
+
+struct AcceptSheddingConfig {
+    AcceptSheddingMode mode{AcceptSheddingMode::kNone};
+    // Share of the tasks of the listener task processor that waited in queue
+    // longer than its `sensor_wait_queue_time_limit`
+    double overload_percent{5.0};
+    std::chrono::milliseconds check_interval{100};
+    int overload_backlog{16};
+    std::chrono::milliseconds max_tls_defer{1000};
+};
+
+AcceptSheddingConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<AcceptSheddingConfig>);
+
+// Tells whether the task processor is overloaded according to the congestion
+// control sensor. The sensor is fetched at most once per check_interval.
+// Thread-safe.
+class OverloadDetector final {
+public:
+    OverloadDetector(engine::TaskProcessor& task_processor, const AcceptSheddingConfig& config);
+
+    bool IsOverloaded();
+
+private:
+    const double overload_percent_;
+    const std::chrono::steady_clock::duration check_interval_;
+
+    std::mutex sensor_mutex_;
+    congestion_control::Sensor sensor_;
+    std::chrono::steady_clock::time_point next_check_;
+
+    std::atomic<bool> is_overloaded_{false};
+};
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #include "connection.hpp"
 
+#include <algorithm>
 #include <array>
+#include <optional>
 #include <system_error>
 #include <vector>
 
@@ -30,8 +32,64 @@ namespace server::net {
 namespace {
 constexpr std::string_view kHttp2Preface = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
 constexpr std::string_view kPrefaceBegin = kHttp2Preface.substr(0, 2);
+
+// Responses are flushed once this much data is accumulated in the batch
+constexpr std::size_t kMaxResponseBatchSize = 64 * 1024;
 }  // namespace
 
+// Accumulates the pipelined HTTP/1.1 responses that are ready in order, so
+// that they are sent to the peer with a single write
+class Connection::ResponseBatch final : public engine::io::RwBase {
+public:
+    explicit ResponseBatch(engine::io::RwBase& socket) : socket_(socket) {}
+
+    bool IsEmpty() const noexcept { return buffer_.empty(); }
+
+    bool IsValid() const override { return socket_.IsValid(); }
+
+    bool WaitReadable(engine::Deadline deadline) override { return socket_.WaitReadable(deadline); }
+
+    size_t ReadSome(void* buf, size_t len, engine::Deadline deadline) override {
+        return socket_.ReadSome(buf, len, deadline);
+    }
+
+    size_t ReadAll(void* buf, size_t len, engine::Deadline deadline) override {
+        return socket_.ReadAll(buf, len, deadline);
+    }
+
+    bool WaitWriteable(engine::Deadline deadline) override { return socket_.WaitWriteable(deadline); }
+
+    size_t WriteAll(const void* buf, size_t len, engine::Deadline deadline) override {
+        return WriteAll({{buf, len}}, deadline);
+    }
+
+    size_t WriteAll(std::initializer_list<engine::io::IoData> list, engine::Deadline deadline) override {
+        std::size_t len = 0;
+        for (const auto& io_data : list) len += io_data.len;
+
+        if (buffer_.size() + len > kMaxResponseBatchSize) {
+            Flush();
+            if (len >= kMaxResponseBatchSize) return socket_.WriteAll(list, deadline);
+        }
+        for (const auto& io_data : list) {
+            buffer_.append(static_cast<const char*>(io_data.data), io_data.len);
+        }
+        return len;
+    }
+
+    void Flush() {
+        if (buffer_.empty()) return;
+        // the responses are accounted as sent already, so a short write is only
+        // noticed by the peer
+        [[maybe_unused]] const auto sent = socket_.WriteAll(buffer_.data(), buffer_.size(), engine::Deadline{});
+        buffer_.clear();
+    }
+
+private:
+    engine::io::RwBase& socket_;
+    std::string buffer_;
+};
+
 Connection::Connection(
     const ConnectionConfig& config,
     const request::HttpRequestConfig& handler_defaults_config,
@@ -124,9 +182,7 @@ void Connection::ListenForRequests() noexcept {
             }
             pending_data_size_ = 0;
 
-            for (auto&& request : pending_requests_) {
-                ProcessRequest(std::move(request));
-            }
+            ProcessPendingRequests();
             pending_requests_.resize(0);
             if (should_stop_accepting_requests) is_accepting_requests_ = false;
         }
@@ -203,17 +259,86 @@ bool Connection::WaitOnSocket(engine::Deadline deadline) {
     return true;
 }
 
-void Connection::ProcessRequest(std::shared_ptr<http::HttpRequest>&& request_ptr) {
-    if (request_ptr->IsFinal()) {
+void Connection::ProcessPendingRequests() {
+    if (pending_requests_.empty()) return;
+
+    // Up to max_pipelined_requests_in_flight handlers run concurrently, no new
+    // data is read from the socket until all the responses are sent.
+    std::vector<engine::TaskWithResult<void>> request_tasks;
+    request_tasks.reserve(pending_requests_.size());
+    std::optional<ResponseBatch> batch;
+    if (peer_socket_) batch.emplace(*peer_socket_);
+
+    // The parser stops after the headers of a request with a streamed body, it
+    // is the last pending one
+    auto* body_stream_parser = dynamic_cast<http::HttpRequestParser*>(parser_.get());
+    if (body_stream_parser && !body_stream_parser->IsStreamingBody()) body_stream_parser = nullptr;
+
+    for (std::size_t i = 0; i < pending_requests_.size(); ++i) {
+        while (request_tasks.size() < pending_requests_.size() &&
+               request_tasks.size() - i < config_.max_pipelined_requests_in_flight) {
+            request_tasks.push_back(StartRequestTask(pending_requests_[request_tasks.size()]));
+        }
+
+        const auto& request_ptr = pending_requests_[i];
+        auto task = std::move(request_tasks[i]);
+        if (body_stream_parser && i + 1 == pending_requests_.size() && !ForwardRequestBody(*body_stream_parser)) {
+            LOG_DEBUG() << "Failed to receive the streamed request body from " << Getpeername() << " on fd " << Fd();
+            is_accepting_requests_ = false;
+        }
+        HandleQueueItem(request_ptr, task);
+
+        const bool is_next_ready = batch && i + 1 < request_tasks.size() && request_tasks[i + 1].IsFinished();
+        SendResponse(*request_ptr, (batch && (is_next_ready || !batch->IsEmpty())) ? &*batch : nullptr);
+        if (batch && !is_next_ready) FlushResponses(*batch);
+
+        if (request_ptr->IsUpgradeWebsocket()) {
+            request_ptr->DoUpgrade(std::move(peer_socket_), std::move(remote_address_));
+        }
+    }
+}
+
+bool Connection::ForwardRequestBody(http::HttpRequestParser& parser) {
+    // The body is pushed to the handler while it runs. The parser blocks once
+    // the handler lags behind, so the socket is not read until it catches up.
+    bool res = false;
+    try {
+        res = parser.Parse(parser.TakeUnparsed());
+        while (res && parser.IsStreamingBody()) {
+            const auto deadline = engine::Deadline::FromDuration(config_.keepalive_timeout);
+            if (pending_data_size_ == 0 && !WaitOnSocket(deadline)) {
+                parser.AbortBodyStream();
+                return false;
+            }
+            res = parser.Parse({pending_data_.data(), pending_data_size_});
+            pending_data_size_ = 0;
+        }
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "Error while receiving the request body from " << Getpeername() << " on fd " << Fd() << ": "
+                      << ex;
+        parser.AbortBodyStream();
+        return false;
+    }
+
+    // Requests that follow the body are parsed by ListenForRequests()
+    auto rest = parser.TakeUnparsed();
+    if (!rest.empty()) {
+        rest.append(pending_data_.data(), pending_data_size_);
+        if (rest.size() > pending_data_.size()) pending_data_.resize(rest.size());
+        std::copy(rest.begin(), rest.end(), pending_data_.begin());
+        pending_data_size_ = rest.size();
+    }
+    return res;
+}
+
+engine::TaskWithResult<void> Connection::StartRequestTask(const std::shared_ptr<http::HttpRequest>& request) {
+    if (request->IsFinal()) {
         is_accepting_requests_ = false;
     }
 
     stats_->active_request_count.Add(1);
 
-    auto task = HandleQueueItem(request_ptr);
-    SendResponse(*request_ptr);
-
-    if (request_ptr->IsUpgradeWebsocket()) request_ptr->DoUpgrade(std::move(peer_socket_), std::move(remote_address_));
+    return request_handler_.StartRequestTask(request);
 }
 
 bool Connection::ReadSome() {
@@ -239,16 +364,17 @@ bool Connection::ReadSome() {
     return true;
 }
 
-engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<http::HttpRequest>& request) noexcept {
-    auto request_task = request_handler_.StartRequestTask(request);
-
+void Connection::HandleQueueItem(
+    const std::shared_ptr<http::HttpRequest>& request,
+    engine::TaskWithResult<void>& request_task
+) noexcept {
     if (engine::current_task::IsCancelRequested()) {
         // We could've packed all remaining requests into a vector and cancel them
         // in parallel. But pipelining is almost never used so why bother.
         request_task.SyncCancel();
         LOG_DEBUG() << "Request processing interrupted";
         is_response_chain_valid_ = false;
-        return request_task;  // avoids throwing and catching exception down below
+        return;  // avoids throwing and catching exception down below
     }
 
     try {
@@ -303,10 +429,9 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<h
         LOG_WARNING() << "Request failed with unhandled exception: " << e;
         request->MarkAsInternalServerError();
     }
-    return request_task;
 }
 
-void Connection::SendResponse(http::HttpRequest& request) {
+void Connection::SendResponse(http::HttpRequest& request, ResponseBatch* batch) {
     auto& response = request.GetHttpResponse();
     UASSERT(!response.IsSent());
     request.SetStartSendResponseTime();
@@ -337,7 +462,7 @@ void Connection::SendResponse(http::HttpRequest& request) {
                     http::WriteHttp2ResponseToSocket(http_response, *http2_session);
                     parser_ = std::move(parser);
                 } else if (request.GetHttpMajor() == 1) {
-                    response.SendResponse(*peer_socket_);
+                    SendHttp1Response(request, batch);
                 } else {
                     UASSERT(dynamic_cast<http::Http2Session*>(parser_.get()));
                     auto http2_session =
@@ -346,7 +471,7 @@ void Connection::SendResponse(http::HttpRequest& request) {
                     http::WriteHttp2ResponseToSocket(http_response, *http2_session);
                 }
             } else {
-                response.SendResponse(*peer_socket_);
+                SendHttp1Response(request, batch);
             }
         } catch (const engine::io::IoSystemError& ex) {
             // working with raw values because std::errc compares error_category
@@ -369,6 +494,32 @@ void Connection::SendResponse(http::HttpRequest& request) {
     request.WriteAccessLogs(request_handler_.LoggerAccess(), request_handler_.LoggerAccessTskv(), peer_name_);
 }
 
+void Connection::SendHttp1Response(http::HttpRequest& request, ResponseBatch* batch) {
+    auto& response = request.GetHttpResponse();
+    if (batch && !response.IsBodyStreamed() && !request.IsUpgradeWebsocket()) {
+        response.SendResponse(*batch);
+        return;
+    }
+
+    if (batch) batch->Flush();
+    response.SendResponse(*peer_socket_);
+}
+
+void Connection::FlushResponses(ResponseBatch& batch) noexcept {
+    if (batch.IsEmpty()) return;
+    try {
+        batch.Flush();
+    } catch (const engine::io::IoSystemError& ex) {
+        auto log_level = ex.Code().value() == static_cast<int>(std::errc::broken_pipe) ? logging::Level::kWarning
+                                                                                       : logging::Level::kError;
+        LOG(log_level) << "I/O error while sending pipelined responses: " << ex;
+        is_response_chain_valid_ = false;
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "Error while sending pipelined responses: " << ex;
+        is_response_chain_valid_ = false;
+    }
+}
+
 std::string Connection::Getpeername() const { return peer_name_; }
 
 std::unique_ptr<request::RequestParser> Connection::MakeParser(USERVER_NAMESPACE::http::HttpVersion ver) {
@@ -40,16 +40,25 @@ public:
     int Fd() const;
 
 private:
+    class ResponseBatch;
+
     void Shutdown() noexcept;
 
     bool IsRequestTasksEmpty() const noexcept;
 
     void ListenForRequests() noexcept;
-    void ProcessRequest(std::shared_ptr<http::HttpRequest>&& request_ptr);
+    void ProcessPendingRequests();
+    bool ForwardRequestBody(http::HttpRequestParser& parser);
     bool WaitOnSocket(engine::Deadline deadline);
 
-    engine::TaskWithResult<void> HandleQueueItem(const std::shared_ptr<http::HttpRequest>& request) noexcept;
-    void SendResponse(http::HttpRequest& request);
+    engine::TaskWithResult<void> StartRequestTask(const std::shared_ptr<http::HttpRequest>& request);
+    void HandleQueueItem(
+        const std::shared_ptr<http::HttpRequest>& request,
+        engine::TaskWithResult<void>& request_task
+    ) noexcept;
+    void SendResponse(http::HttpRequest& request, ResponseBatch* batch);
+    void SendHttp1Response(http::HttpRequest& request, ResponseBatch* batch);
+    void FlushResponses(ResponseBatch& batch) noexcept;
 
     std::string Getpeername() const;
 
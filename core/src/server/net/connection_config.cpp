@@ -1,5 +1,7 @@
 #include <server/net/connection_config.hpp>
 
+#include <stdexcept>
+
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -11,6 +13,8 @@ Http2SessionConfig Parse(const yaml_config::YamlConfig& value, formats::parse::T
     conf.max_concurrent_streams = value["max_concurrent_streams"].As<std::uint32_t>(conf.max_concurrent_streams);
     conf.max_frame_size = value["max_frame_size"].As<std::uint32_t>(conf.max_frame_size);
     conf.initial_window_size = value["initial_window_size"].As<std::uint32_t>(conf.initial_window_size);
+    conf.connection_window_size = value["connection_window_size"].As<std::uint32_t>(conf.connection_window_size);
+    conf.rfc9218_priorities = value["rfc9218_priorities"].As<bool>(conf.rfc9218_priorities);
     return conf;
 }
 
@@ -20,6 +24,11 @@ ConnectionConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<
     config.in_buffer_size = value["in_buffer_size"].As<size_t>(config.in_buffer_size);
     config.requests_queue_size_threshold =
         value["requests_queue_size_threshold"].As<size_t>(config.requests_queue_size_threshold);
+    config.max_pipelined_requests_in_flight =
+        value["max_pipelined_requests_in_flight"].As<size_t>(config.max_pipelined_requests_in_flight);
+    if (config.max_pipelined_requests_in_flight == 0) {
+        throw std::runtime_error("connection.max_pipelined_requests_in_flight must be positive");
+    }
     config.keepalive_timeout = value["keepalive_timeout"].As<std::chrono::seconds>(config.keepalive_timeout);
 
     if (!value["stream_close_check_delay"].IsMissing()) {
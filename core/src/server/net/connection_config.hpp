@@ -22,11 +22,15 @@ struct Http2SessionConfig final {
     std::uint32_t max_concurrent_streams = 100;
     std::uint32_t max_frame_size = 1 << 14;
     std::uint32_t initial_window_size = 1 << 16;
+    // RFC 9113 default
+    std::uint32_t connection_window_size = (1 << 16) - 1;
+    bool rfc9218_priorities = false;
 };
 
 struct ConnectionConfig {
     size_t in_buffer_size = 32 * 1024;
     size_t requests_queue_size_threshold = 100;
+    size_t max_pipelined_requests_in_flight = 1;
     std::chrono::seconds keepalive_timeout{10 * 60};
     std::chrono::milliseconds abort_check_delay{kDefaultAbortCheckDelay};
     USERVER_NAMESPACE::http::HttpVersion http_version = USERVER_NAMESPACE::http::HttpVersion::k11;
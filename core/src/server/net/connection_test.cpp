@@ -1,5 +1,11 @@
 #include <server/net/connection.hpp>
 
+#include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include <fmt/format.h>
 
 #include <server/handlers/http_handler_base_statistics.hpp>
@@ -23,7 +29,9 @@ constexpr auto kAcceptTimeout = utest::kMaxTestWaitTime;
 
 class TestHttprequestHandler : public server::http::RequestHandlerBase {
 public:
-    enum class Behaviors { kNoop, kHang };
+    // kEchoPath sleeps for the number of milliseconds in the path, e.g. `/20`,
+    // and responds with the path
+    enum class Behaviors { kNoop, kHang, kEchoPath };
 
     explicit TestHttprequestHandler(Behaviors behavior = Behaviors::kNoop) : behavior_(behavior) {}
 
@@ -40,6 +48,14 @@ public:
                     ASSERT_TRUE(engine::current_task::IsCancelRequested());
                     ++asyncs_finished;
                 });
+            case Behaviors::kEchoPath:
+                return engine::AsyncNoSpan([this, http_request = std::move(http_request)]() {
+                    const auto& path = http_request->GetRequestPath();
+                    engine::SleepFor(std::chrono::milliseconds{std::stoi(path.substr(1))});
+                    http_request->SetResponseStatus(server::http::HttpStatus::kOk);
+                    http_request->GetHttpResponse().SetData(path);
+                    ++asyncs_finished;
+                });
         }
 
         UINVARIANT(false, "Unexpected behavior");
@@ -59,6 +75,32 @@ private:
     server::http::HandlerInfoIndex handler_info_index_;
 };
 
+// Returns the bodies of the HTTP/1.1 responses with the status 200
+std::vector<std::string> ParseOkResponseBodies(std::string_view responses) {
+    constexpr std::string_view kStatusLine = "HTTP/1.1 200 OK\r\n";
+    constexpr std::string_view kContentLength = "\r\nContent-Length: ";
+    constexpr std::string_view kHeadersEnd = "\r\n\r\n";
+
+    std::vector<std::string> bodies;
+    while (!responses.empty()) {
+        if (responses.substr(0, kStatusLine.size()) != kStatusLine) {
+            ADD_FAILURE() << "Unexpected response: " << responses;
+            break;
+        }
+        const auto headers_end = responses.find(kHeadersEnd);
+        const auto length_pos = responses.find(kContentLength);
+        if (headers_end == std::string_view::npos || length_pos == std::string_view::npos || length_pos > headers_end) {
+            ADD_FAILURE() << "Unexpected response: " << responses;
+            break;
+        }
+        const auto body_size = std::stoul(std::string{responses.substr(length_pos + kContentLength.size())});
+        const auto body_pos = headers_end + kHeadersEnd.size();
+        bodies.emplace_back(responses.substr(body_pos, body_size));
+        responses.remove_prefix(std::min(responses.size(), body_pos + body_size));
+    }
+    return bodies;
+}
+
 std::string HttpConnectionUriFromSocket(engine::io::Socket& sock) {
     return fmt::format("http://localhost:{}", sock.Getsockname().Port());
 }
@@ -355,4 +397,57 @@ UTEST_P(ServerNetConnection, CancelMultipleInFlight) {
     FAIL() << "Failed to simulate cancellation of multiple requests";
 }
 
+UTEST(ServerNetConnectionPipelining, ResponsesInOrder) {
+    // The handlers of the later requests complete first
+    const std::vector<std::string> paths{"/100", "/80", "/60", "/40", "/20"};
+    const auto kRequests = paths.size();
+    net::ListenerConfig config = CreateConfig();
+    config.connection_config.max_pipelined_requests_in_flight = 3;
+    auto request_socket = net::CreateSocket(config, config.ports[0]);
+
+    auto addr = engine::io::Sockaddr::MakeLoopbackAddress();
+    addr.SetPort(request_socket.Getsockname().Port());
+    engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+    client.Connect(addr, Deadline::FromDuration(kAcceptTimeout));
+
+    auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+    ASSERT_TRUE(peer.IsValid());
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kEchoPath};
+
+    auto task = engine::AsyncNoSpan([&] {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(peer)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+
+    std::string requests;
+    for (std::size_t i = 0; i < kRequests; ++i) {
+        requests += fmt::format("GET {} HTTP/1.1\r\nHost: localhost\r\n", paths[i]);
+        requests += (i + 1 == kRequests ? "Connection: close\r\n\r\n" : "\r\n");
+    }
+    ASSERT_EQ(client.SendAll(requests.data(), requests.size(), Deadline::FromDuration(kAcceptTimeout)), requests.size());
+
+    std::string responses;
+    std::array<char, 4096> buf{};
+    while (const auto len = client.RecvSome(buf.data(), buf.size(), Deadline::FromDuration(kAcceptTimeout))) {
+        responses.append(buf.data(), len);
+    }
+
+    EXPECT_EQ(ParseOkResponseBodies(responses), paths);
+    EXPECT_EQ(handler.asyncs_finished, kRequests);
+
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(task.IsFinished());
+}
+
 USERVER_NAMESPACE_END
@@ -2,6 +2,8 @@
 
 #include <atomic>
 
+#include <userver/engine/io/tls_session.hpp>
+
 #include <server/http/http_request_handler.hpp>
 #include <server/net/connection.hpp>
 #include <server/net/listener_config.hpp>
@@ -16,6 +18,8 @@ struct EndpointInfo {
     const ListenerConfig& listener_config;
     http::HttpRequestHandler& request_handler;
     Connection::Type connection_type{Connection::Type::kRequest};
+    // Shared by all the TLS connections of the endpoint, owned by the server
+    engine::io::TlsSessionTicketKeys* tls_session_ticket_keys{nullptr};
 
     std::atomic<size_t> connection_count{0};
 };
@@ -49,6 +49,7 @@ PortConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PortCo
         auto contents = fs::blocking::ReadFileContents(ca_path);
         config.tls_certificate_authorities.push_back(crypto::Certificate::LoadFromString(contents));
     }
+    config.tls_kernel_offload = value["tls"]["kernel-offload"].As<bool>(false);
 
     return config;
 }
@@ -60,8 +61,10 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Li
     config.handler_defaults = value["handler-defaults"].As<request::HttpRequestConfig>();
     config.max_connections = value["max_connections"].As<size_t>(config.max_connections);
     config.shards = value["shards"].As<std::optional<size_t>>(config.shards);
+    config.thread_per_core = value["thread-per-core"].As<bool>(config.thread_per_core);
     config.task_processor = value["task_processor"].As<std::string>();
     config.backlog = value["backlog"].As<int>(config.backlog);
+    config.accept_shedding = value["accept-shedding"].As<AcceptSheddingConfig>(config.accept_shedding);
 
     config.ports = value["ports"].As<std::vector<PortConfig>>({});
     if (value.HasMember("port") || value.HasMember("unix-socket")) {
@@ -71,6 +74,10 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Li
         throw std::runtime_error("No port/unix socket is set in listener config");
     }
 
+    if (config.thread_per_core && config.shards == 0) {
+        throw std::runtime_error("'thread-per-core' requires at least one shard in " + value.GetPath());
+    }
+
     if (config.backlog <= 0) {
         throw std::runtime_error("Invalid backlog value in " + value.GetPath());
     }
@@ -9,6 +9,7 @@
 #include <userver/storages/secdist/secdist.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
+#include "accept_shedding.hpp"
 #include "connection_config.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -26,6 +27,7 @@ struct PortConfig {
     std::string tls_private_key_passphrase_name;
     crypto::PrivateKey tls_private_key;
     std::vector<crypto::Certificate> tls_certificate_authorities;
+    bool tls_kernel_offload{false};
 
     void ReadTlsSettings(const storages::secdist::SecdistConfig& secdist);
 };
@@ -36,7 +38,9 @@ struct ListenerConfig {
     int backlog = 1024;  // truncated to net.core.somaxconn
     size_t max_connections = 32768;
     std::optional<size_t> shards;
+    bool thread_per_core{false};
     std::string task_processor;
+    AcceptSheddingConfig accept_shedding;
 
     std::vector<PortConfig> ports;
 };
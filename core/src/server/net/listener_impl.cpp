@@ -1,6 +1,7 @@
 #include "listener_impl.hpp"
 
 #include <netinet/tcp.h>
+#include <sys/socket.h>
 
 #include <cstdint>
 #include <cstring>
@@ -20,6 +21,8 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 
+#include <utils/check_syscall.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
@@ -33,6 +36,10 @@ ListenerImpl::ListenerImpl(
       endpoint_info_(std::move(endpoint_info)),
       stats_(std::make_shared<Stats>()),
       data_accounter_(data_accounter) {
+    if (endpoint_info_->listener_config.accept_shedding.mode != AcceptSheddingMode::kNone) {
+        overload_detector_.emplace(task_processor_, endpoint_info_->listener_config.accept_shedding);
+    }
+
     for (const auto& port : endpoint_info_->listener_config.ports) {
         socket_listener_tasks.push_back(engine::CriticalAsyncNoSpan(
             task_processor_,
@@ -67,8 +74,27 @@ ListenerImpl::~ListenerImpl() {
 StatsAggregation ListenerImpl::GetStats() const { return StatsAggregation{*stats_}; }
 
 void ListenerImpl::AcceptConnection(engine::io::Socket& request_socket, const PortConfig& port_config) {
+    const auto shedding_mode = endpoint_info_->listener_config.accept_shedding.mode;
+    if (shedding_mode == AcceptSheddingMode::kPause) {
+        PauseAcceptWhileOverloaded(request_socket);
+    }
+
     auto peer_socket = request_socket.Accept({});
 
+    if (shedding_mode == AcceptSheddingMode::kReset && overload_detector_->IsOverloaded()) {
+        // Zero linger timeout makes close() send RST instead of FIN, so that the
+        // client does not wait for the response and retries elsewhere
+        const ::linger linger{/*l_onoff=*/1, /*l_linger=*/0};
+        utils::CheckSyscall(
+            ::setsockopt(peer_socket.Fd(), SOL_SOCKET, SO_LINGER, &linger, sizeof(linger)),
+            "setting SO_LINGER, fd={}",
+            peer_socket.Fd()
+        );
+        ++stats_->connections_shed;
+        LOG_LIMITED_WARNING() << "Task processor is overloaded, resetting a new connection";
+        return;
+    }
+
     const auto new_connection_count = ++endpoint_info_->connection_count;
     utils::FastScopeGuard guard{[this]() noexcept { --endpoint_info_->connection_count; }};
 
@@ -104,12 +130,18 @@ void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket, const PortC
     std::unique_ptr<engine::io::RwBase> socket;
     auto remote_address = peer_socket.Getpeername();
     if (port_config.tls) {
+        if (endpoint_info_->listener_config.accept_shedding.mode == AcceptSheddingMode::kDeferTls) {
+            DeferTlsWhileOverloaded();
+        }
         socket = std::make_unique<engine::io::TlsWrapper>(engine::io::TlsWrapper::StartTlsServer(
             std::move(peer_socket),
             port_config.tls_cert_chain,
             port_config.tls_private_key,
             {},
-            port_config.tls_certificate_authorities
+            port_config.tls_certificate_authorities,
+            port_config.tls_kernel_offload ? engine::io::TlsWrapper::KernelOffload::kEnabled
+                                           : engine::io::TlsWrapper::KernelOffload::kDisabled,
+            endpoint_info_->tls_session_ticket_keys
         ));
     } else {
         socket = std::make_unique<engine::io::Socket>(std::move(peer_socket));
@@ -130,6 +162,27 @@ void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket, const PortC
     LOG_TRACE() << "Finishing connection for fd " << fd;
 }
 
+void ListenerImpl::PauseAcceptWhileOverloaded(engine::io::Socket& request_socket) {
+    if (!overload_detector_->IsOverloaded()) return;
+
+    // Connections that wait in a long accept queue are likely to time out
+    // anyway, let the kernel refuse them early
+    const auto& config = endpoint_info_->listener_config;
+    request_socket.Listen(config.accept_shedding.overload_backlog);
+    while (overload_detector_->IsOverloaded() && !engine::current_task::ShouldCancel()) {
+        engine::InterruptibleSleepFor(config.accept_shedding.check_interval);
+    }
+    request_socket.Listen(config.backlog);
+}
+
+void ListenerImpl::DeferTlsWhileOverloaded() {
+    const auto& shedding = endpoint_info_->listener_config.accept_shedding;
+    const auto deadline = engine::Deadline::FromDuration(shedding.max_tls_defer);
+    while (overload_detector_->IsOverloaded() && !deadline.IsReached() && !engine::current_task::ShouldCancel()) {
+        engine::InterruptibleSleepFor(shedding.check_interval);
+    }
+}
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
@@ -1,12 +1,14 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 
+#include "accept_shedding.hpp"
 #include "connection.hpp"
 #include "endpoint_info.hpp"
 #include "stats.hpp"
@@ -29,6 +31,8 @@ public:
 private:
     void AcceptConnection(engine::io::Socket& request_socket, const PortConfig& port_config);
     void ProcessConnection(engine::io::Socket peer_socket, const PortConfig& port_config);
+    void PauseAcceptWhileOverloaded(engine::io::Socket& request_socket);
+    void DeferTlsWhileOverloaded();
 
     engine::TaskProcessor& task_processor_;
     std::shared_ptr<EndpointInfo> endpoint_info_;
@@ -38,6 +42,8 @@ private:
 
     concurrent::BackgroundTaskStorageCore connections_;
 
+    std::optional<OverloadDetector> overload_detector_;
+
     std::vector<engine::TaskWithResult<void>> socket_listener_tasks;
 };
 
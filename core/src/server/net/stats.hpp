@@ -61,6 +61,7 @@ struct Stats {
     std::atomic<size_t> active_connections{0};
     std::atomic<size_t> connections_created{0};
     std::atomic<size_t> connections_closed{0};
+    std::atomic<size_t> connections_shed{0};
 
     // per connection
     ParserStats parser_stats;
@@ -75,6 +76,7 @@ struct StatsAggregation final {
         : active_connections{stats.active_connections.load()},
           connections_created{stats.connections_created.load()},
           connections_closed{stats.connections_closed.load()},
+          connections_shed{stats.connections_shed.load()},
           parser_stats{stats.parser_stats},
           active_request_count{stats.active_request_count.NonNegativeRead()},
           requests_processed_count{stats.requests_processed_count.Read()} {}
@@ -83,6 +85,7 @@ struct StatsAggregation final {
         active_connections += other.active_connections;
         connections_created += other.connections_created;
         connections_closed += other.connections_closed;
+        connections_shed += other.connections_shed;
 
         parser_stats += other.parser_stats;
         active_request_count += other.active_request_count;
@@ -94,6 +97,7 @@ struct StatsAggregation final {
     std::size_t active_connections{0};
     std::size_t connections_created{0};
     std::size_t connections_closed{0};
+    std::size_t connections_shed{0};
 
     // per connection
     ParserStatsAggregation parser_stats;
@@ -24,7 +24,11 @@ public:
 
     impl::InternalRequestContext& GetInternalContext();
 
+    utils::Arena& GetArena() { return arena_; }
+
 private:
+    // Declared first to outlive the data that may use it
+    utils::Arena arena_;
     utils::AnyMovable user_data_;
     utils::impl::TransparentMap<std::string, utils::AnyMovable> named_datum_;
     impl::InternalRequestContext internal_context_;
@@ -104,6 +108,8 @@ void RequestContext::EraseAnyData(std::string_view name) { return impl_->EraseAn
 
 impl::InternalRequestContext& RequestContext::GetInternalContext() { return impl_->GetInternalContext(); }
 
+utils::Arena& RequestContext::GetArena() { return impl_->GetArena(); }
+
 }  // namespace server::request
 
 USERVER_NAMESPACE_END
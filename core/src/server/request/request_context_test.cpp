@@ -3,6 +3,7 @@
 #include <userver/utest/assert_macros.hpp>
 
 #include <memory>
+#include <vector>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -158,4 +159,17 @@ TEST(RequestContext, MoveOnlyByConst) {
     EXPECT_EQ(*context.GetData<std::unique_ptr<int>>(kKey), 42);
 }
 
+TEST(RequestContext, Arena) {
+    using Allocator = utils::ArenaAllocator<int>;
+    using ArenaVector = std::vector<int, Allocator>;
+
+    server::request::RequestContext context;
+    EXPECT_EQ(context.GetArena().GetAllocatedBytes(), 0);
+
+    auto& data = context.EmplaceData<ArenaVector>(std::string{kKey}, Allocator{context.GetArena()});
+    data.assign(100, 42);
+    EXPECT_GE(context.GetArena().GetAllocatedBytes(), 100 * sizeof(int));
+    EXPECT_EQ(context.GetData<ArenaVector>(kKey).back(), 42);
+}
+
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/server/server.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <shared_mutex>
 #include <stdexcept>
@@ -9,6 +10,7 @@
 
 #include <engine/ev/thread_pool.hpp>
 #include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
 #include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/http/http_request_handler.hpp>
 #include <server/net/endpoint_info.hpp>
@@ -16,6 +18,9 @@
 #include <server/net/stats.hpp>
 #include <server/requests_view.hpp>
 #include <server/server_config.hpp>
+#include <server/tls_session_ticket_keys_config.hpp>
+#include <userver/engine/io/tls_session.hpp>
+#include <userver/engine/task/single_threaded_task_processors_pool.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/server/http/http_request.hpp>
 #include <userver/server/middlewares/configuration.hpp>
@@ -31,6 +36,7 @@ struct PortInfo final {
         const ServerConfig& config,
         const net::ListenerConfig& listener_config,
         const components::ComponentContext& component_context,
+        engine::io::TlsSessionTicketKeys& tls_session_ticket_keys,
         bool is_monitor
     );
 
@@ -43,6 +49,8 @@ struct PortInfo final {
     std::optional<http::HttpRequestHandler> request_handler_;
     std::shared_ptr<net::EndpointInfo> endpoint_info_;
     request::ResponseDataAccounter data_accounter_;
+    // One processor per listener shard in the thread-per-core mode
+    std::optional<engine::SingleThreadedTaskProcessorsPool> shard_task_processors_;
     std::vector<net::Listener> listeners_;
 };
 
@@ -50,6 +58,7 @@ void PortInfo::Init(
     const ServerConfig& config,
     const net::ListenerConfig& listener_config,
     const components::ComponentContext& component_context,
+    engine::io::TlsSessionTicketKeys& tls_session_ticket_keys,
     bool is_monitor
 ) {
     LOG_DEBUG() << "Creating listener" << (is_monitor ? " (monitor)" : "");
@@ -61,11 +70,28 @@ void PortInfo::Init(
     );
 
     endpoint_info_ = std::make_shared<net::EndpointInfo>(listener_config, *request_handler_);
+    endpoint_info_->tls_session_ticket_keys = &tls_session_ticket_keys;
 
     const auto& event_thread_pool = task_processor.EventThreadPool();
     size_t listener_shards = listener_config.shards ? *listener_config.shards : event_thread_pool.GetSize();
 
     listeners_.reserve(listener_shards);
+    if (listener_config.thread_per_core) {
+        // Every shard owns an accept socket (SO_REUSEPORT), a worker thread and
+        // an ev thread, so that connections and requests never migrate
+        auto shard_config = task_processor.GetConfig();
+        shard_config.name = listener_config.task_processor + (is_monitor ? "-monitor-shard" : "-shard");
+        shard_config.thread_name = is_monitor ? "mon-shard" : "srv-shard";
+        shard_config.worker_threads = listener_shards;
+        shard_task_processors_.emplace(shard_config, engine::SingleThreadedTaskProcessorsPool::kPinEvThreads);
+        request_handler_->SetThreadPerCoreTaskProcessor(task_processor);
+
+        for (std::size_t i = 0; i < listener_shards; ++i) {
+            listeners_.emplace_back(endpoint_info_, shard_task_processors_->At(i), data_accounter_);
+        }
+        return;
+    }
+
     while (listener_shards--) {
         listeners_.emplace_back(endpoint_info_, task_processor, data_accounter_);
     }
@@ -82,6 +108,7 @@ void PortInfo::Start() {
 void PortInfo::Stop() {
     LOG_TRACE() << "Stopping listeners";
     listeners_.clear();
+    shard_task_processors_.reset();
     LOG_TRACE() << "Stopped listeners";
 
     if (endpoint_info_) {
@@ -125,7 +152,14 @@ public:
     void SetRpsRatelimit(std::optional<size_t> rps);
     std::uint64_t GetTotalRequests() const;
 
+    bool HasTls() const;
+    void UpdateTlsSessionTicketKeys(const storages::secdist::SecdistConfig& secdist);
+    const engine::io::TlsHandshakeStatistics& GetTlsHandshakeStatistics() const;
+
 private:
+    // Must outlive the listeners
+    engine::io::TlsSessionTicketKeys tls_session_ticket_keys_;
+
     PortInfo main_port_info_;
     PortInfo monitor_port_info_;
 
@@ -151,12 +185,12 @@ ServerImpl::ServerImpl(
 
     for (auto& port : config_.listener.ports) port.ReadTlsSettings(secdist);
 
-    main_port_info_.Init(config_, config_.listener, component_context, false);
+    main_port_info_.Init(config_, config_.listener, component_context, tls_session_ticket_keys_, false);
     if (config_.max_response_size_in_flight) {
         main_port_info_.data_accounter_.SetMaxLevel(*config_.max_response_size_in_flight);
     }
     if (config_.monitor_listener) {
-        monitor_port_info_.Init(config_, *config_.monitor_listener, component_context, true);
+        monitor_port_info_.Init(config_, *config_.monitor_listener, component_context, tls_session_ticket_keys_, true);
     }
 
     middlewares_ = component_context.FindComponent<middlewares::PipelineBuilder>(config_.middleware_pipeline_builder)
@@ -311,6 +345,28 @@ std::uint64_t ServerImpl::GetTotalRequests() const {
     return stats.active_request_count + stats.requests_processed_count;
 }
 
+bool ServerImpl::HasTls() const {
+    const auto has_tls = [](const net::ListenerConfig& listener) {
+        return std::any_of(listener.ports.begin(), listener.ports.end(), [](const auto& port) { return port.tls; });
+    };
+    return has_tls(config_.listener) || (config_.monitor_listener && has_tls(*config_.monitor_listener));
+}
+
+void ServerImpl::UpdateTlsSessionTicketKeys(const storages::secdist::SecdistConfig& secdist) {
+    if (!HasTls()) return;
+
+    const auto& keys = secdist.Get<TlsSessionTicketKeysConfig>().GetKeys();
+    // the random key generated at startup is kept if there are no keys
+    if (keys.empty()) return;
+
+    tls_session_ticket_keys_.SetKeys(keys);
+    LOG_INFO() << "TLS session ticket keys are updated, keys count: " << keys.size();
+}
+
+const engine::io::TlsHandshakeStatistics& ServerImpl::GetTlsHandshakeStatistics() const {
+    return tls_session_ticket_keys_.GetStatistics();
+}
+
 Server::Server(
     ServerConfig config,
     const storages::secdist::SecdistConfig& secdist,
@@ -330,6 +386,7 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
         conn_stats["active"] = server_stats.active_connections;
         conn_stats["opened"] = server_stats.connections_created;
         conn_stats["closed"] = server_stats.connections_closed;
+        conn_stats["shed"] = server_stats.connections_shed;
     }
 
     if (auto request_stats = writer["requests"]) {
@@ -344,6 +401,8 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
         http2_request_stats["reset-streams"] = server_stats.parser_stats.reset_streams;
         http2_request_stats["goaway"] = server_stats.parser_stats.goaway;
     }
+
+    if (pimpl->HasTls()) writer["tls"] = pimpl->GetTlsHandshakeStatistics();
 }
 
 void Server::WriteTotalHandlerStatistics(utils::statistics::Writer& writer) const {
@@ -370,6 +429,10 @@ void Server::Start() {
 
 void Server::Stop() { pimpl->Stop(); }
 
+void Server::UpdateTlsSessionTicketKeys(const storages::secdist::SecdistConfig& secdist) {
+    pimpl->UpdateTlsSessionTicketKeys(secdist);
+}
+
 RequestsView& Server::GetRequestsView() { return pimpl->GetRequestsView(); }
 
 void Server::SetRpsRatelimit(std::optional<size_t> rps) { pimpl->SetRpsRatelimit(rps); }
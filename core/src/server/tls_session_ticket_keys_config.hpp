@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <userver/crypto/base64.hpp>
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server {
+
+/// Base64 encoded TLS session ticket keys from the secdist
+/// 'tls_session_ticket_keys' entry, the first one encrypts the new tickets
+class TlsSessionTicketKeysConfig final {
+public:
+    explicit TlsSessionTicketKeysConfig(const formats::json::Value& doc) {
+        for (const auto& key : doc["tls_session_ticket_keys"].As<std::vector<std::string>>({})) {
+            keys_.push_back(crypto::base64::Base64Decode(key));
+        }
+    }
+
+    const std::vector<std::string>& GetKeys() const { return keys_; }
+
+private:
+    std::vector<std::string> keys_;
+};
+
+}  // namespace server
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,188 @@
+#include <server/websocket/permessage_deflate.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/from_string.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+namespace {
+
+constexpr std::string_view kExtensionName = "permessage-deflate";
+
+// RFC 7692, 7.2.1. The sender strips the tail of the final empty block
+constexpr std::string_view kEmptyBlockTail{"\x00\x00\xff\xff", 4};
+
+// zlib does not support raw deflate streams with 256-byte windows
+constexpr int kMinWindowBits = 9;
+
+constexpr int kCompressionLevel = 6;
+constexpr int kMemLevel = 8;
+constexpr std::size_t kBufferChunkSize = 4 * 1024;
+
+std::string_view Trim(std::string_view str) {
+    const auto begin = str.find_first_not_of(" \t");
+    if (begin == std::string_view::npos) return {};
+    const auto end = str.find_last_not_of(" \t");
+    return str.substr(begin, end - begin + 1);
+}
+
+// Splits `str` by `separator`, returns the first part and removes it from `str`
+std::string_view PopToken(std::string_view& str, char separator) {
+    const auto pos = str.find(separator);
+    const auto token = Trim(str.substr(0, pos));
+    str.remove_prefix(pos == std::string_view::npos ? str.size() : pos + 1);
+    return token;
+}
+
+std::optional<int> ParseWindowBits(std::string_view value) {
+    if (value.size() >= 2 && value.front() == '"' && value.back() == '"') value = value.substr(1, value.size() - 2);
+    try {
+        const auto bits = utils::FromString<int>(value);
+        if (bits < 8 || bits > MAX_WBITS) return std::nullopt;
+        return bits;
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+// RFC 7692, 7.1. Returns std::nullopt if the offer has unknown, duplicate or
+// invalid parameters, or parameters that zlib can not satisfy
+std::optional<DeflateParams> ParseOffer(std::string_view params_str) {
+    DeflateParams params;
+    bool has_server_no_context_takeover = false;
+    bool has_client_no_context_takeover = false;
+    bool has_server_max_window_bits = false;
+    bool has_client_max_window_bits = false;
+
+    while (!params_str.empty()) {
+        auto value = PopToken(params_str, ';');
+        const auto name = PopToken(value, '=');
+        const bool has_value = !value.empty();
+
+        if (name == "server_no_context_takeover" && !has_value && !has_server_no_context_takeover) {
+            has_server_no_context_takeover = true;
+        } else if (name == "client_no_context_takeover" && !has_value && !has_client_no_context_takeover) {
+            has_client_no_context_takeover = true;
+        } else if (name == "server_max_window_bits" && has_value && !has_server_max_window_bits) {
+            has_server_max_window_bits = true;
+            const auto bits = ParseWindowBits(value);
+            if (!bits || *bits < kMinWindowBits) return std::nullopt;
+            params.server_max_window_bits = *bits;
+        } else if (name == "client_max_window_bits" && !has_client_max_window_bits) {
+            // Messages from the client are inflated with the maximum window
+            has_client_max_window_bits = true;
+            if (has_value && !ParseWindowBits(value)) return std::nullopt;
+        } else {
+            return std::nullopt;
+        }
+    }
+    return params;
+}
+
+void CheckError(int ret, std::string_view what) {
+    if (ret != Z_OK && ret != Z_BUF_ERROR) {
+        throw std::runtime_error(fmt::format("permessage-deflate {} failed: zlib error {}", what, ret));
+    }
+}
+
+}  // namespace
+
+std::optional<DeflateParams> NegotiatePermessageDeflate(std::string_view extensions) {
+    while (!extensions.empty()) {
+        auto offer = PopToken(extensions, ',');
+        if (PopToken(offer, ';') != kExtensionName) continue;
+        if (auto params = ParseOffer(offer)) return params;
+    }
+    return std::nullopt;
+}
+
+std::string MakePermessageDeflateResponse(const DeflateParams& params) {
+    std::string response = fmt::format("{}; server_no_context_takeover; client_no_context_takeover", kExtensionName);
+    if (params.server_max_window_bits != MAX_WBITS) {
+        response += fmt::format("; server_max_window_bits={}", params.server_max_window_bits);
+    }
+    return response;
+}
+
+MessageDeflater::MessageDeflater(int window_bits) : window_bits_(window_bits) {
+    UASSERT(window_bits >= kMinWindowBits && window_bits <= MAX_WBITS);
+    // Negative window bits make zlib write a raw deflate stream
+    CheckError(
+        deflateInit2(&stream_, kCompressionLevel, Z_DEFLATED, -window_bits, kMemLevel, Z_DEFAULT_STRATEGY), "init"
+    );
+}
+
+MessageDeflater::~MessageDeflater() { deflateEnd(&stream_); }
+
+std::string MessageDeflater::Deflate(std::string_view data) {
+    // No context takeover, each message starts with an empty window
+    CheckError(deflateReset(&stream_), "reset");
+
+    // zlib does not modify the input
+    stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream_.avail_in = static_cast<uInt>(data.size());
+
+    std::string result;
+    std::size_t size = 0;
+    do {
+        result.resize(std::max(result.size() * 2, deflateBound(&stream_, data.size()) + kEmptyBlockTail.size()));
+        stream_.next_out = reinterpret_cast<Bytef*>(result.data() + size);
+        stream_.avail_out = static_cast<uInt>(result.size() - size);
+        CheckError(deflate(&stream_, Z_SYNC_FLUSH), "deflate");
+        size = result.size() - stream_.avail_out;
+    } while (stream_.avail_out == 0);
+    result.resize(size);
+
+    UASSERT(std::string_view{result}.substr(result.size() - kEmptyBlockTail.size()) == kEmptyBlockTail);
+    result.resize(result.size() - kEmptyBlockTail.size());
+    return result;
+}
+
+MessageInflater::MessageInflater() { CheckError(inflateInit2(&stream_, -MAX_WBITS), "init"); }
+
+MessageInflater::~MessageInflater() { inflateEnd(&stream_); }
+
+CloseStatus MessageInflater::Inflate(std::string& compressed, std::size_t max_size, std::string& result) {
+    // No context takeover, each message starts with an empty window
+    CheckError(inflateReset(&stream_), "reset");
+
+    compressed.append(kEmptyBlockTail);
+    stream_.next_in = reinterpret_cast<Bytef*>(compressed.data());
+    stream_.avail_in = static_cast<uInt>(compressed.size());
+
+    result.resize(0);  // do not call .clear() to keep the allocated memory
+    std::size_t size = 0;
+    while (true) {
+        if (size == result.size()) {
+            if (size > max_size) return CloseStatus::kTooBigData;
+            result.resize(std::min(std::max({result.capacity(), size * 2, kBufferChunkSize}), max_size + 1));
+        }
+        stream_.next_out = reinterpret_cast<Bytef*>(result.data() + size);
+        stream_.avail_out = static_cast<uInt>(result.size() - size);
+
+        const auto ret = inflate(&stream_, Z_SYNC_FLUSH);
+        size = result.size() - stream_.avail_out;
+
+        // The message has ended with a final block, the rest is ignored
+        if (ret == Z_STREAM_END) break;
+        if (ret != Z_OK && ret != Z_BUF_ERROR) return CloseStatus::kBadMessageData;
+        if (stream_.avail_in == 0 && stream_.avail_out != 0) break;
+        // No progress is possible while there is both input and output space
+        if (ret == Z_BUF_ERROR && stream_.avail_out != 0) return CloseStatus::kBadMessageData;
+    }
+
+    result.resize(size);
+    if (size > max_size) return CloseStatus::kTooBigData;
+    return CloseStatus::kNone;
+}
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <zlib.h>
+
+#include <userver/server/websocket/server.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+/// Parameters of the negotiated permessage-deflate extension, RFC 7692.
+///
+/// Both directions are negotiated without context takeover, so every message
+/// is compressed independently and a compressed frame may be sent to any
+/// connection with the same window size.
+struct DeflateParams final {
+    int server_max_window_bits{MAX_WBITS};
+};
+
+/// Returns the parameters of the first acceptable permessage-deflate offer
+/// from the `Sec-WebSocket-Extensions` header of a handshake request
+std::optional<DeflateParams> NegotiatePermessageDeflate(std::string_view extensions);
+
+/// Returns the `Sec-WebSocket-Extensions` header of the handshake response
+std::string MakePermessageDeflateResponse(const DeflateParams& params);
+
+class MessageDeflater final {
+public:
+    explicit MessageDeflater(int window_bits = MAX_WBITS);
+
+    MessageDeflater(const MessageDeflater&) = delete;
+    MessageDeflater& operator=(const MessageDeflater&) = delete;
+    ~MessageDeflater();
+
+    int GetWindowBits() const noexcept { return window_bits_; }
+
+    /// Returns the payload of a compressed message
+    std::string Deflate(std::string_view data);
+
+private:
+    z_stream stream_{};
+    const int window_bits_;
+};
+
+class MessageInflater final {
+public:
+    MessageInflater();
+
+    MessageInflater(const MessageInflater&) = delete;
+    MessageInflater& operator=(const MessageInflater&) = delete;
+    ~MessageInflater();
+
+    /// Decompresses the payload of a message into `result`. `compressed` is
+    /// modified, the empty block that the sender has stripped is appended to it.
+    /// @returns CloseStatus::kNone on success
+    CloseStatus Inflate(std::string& compressed, std::size_t max_size, std::string& result);
+
+private:
+    z_stream stream_{};
+};
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
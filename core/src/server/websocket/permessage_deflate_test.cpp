@@ -0,0 +1,103 @@
+#include <server/websocket/permessage_deflate.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::websocket::CloseStatus;
+namespace impl = server::websocket::impl;
+
+std::string MakeData(std::size_t size) {
+    std::string data(size, '\0');
+    for (std::size_t i = 0; i < size; ++i) data[i] = static_cast<char>('a' + (i * 7 + i / 100) % 26);
+    return data;
+}
+
+}  // namespace
+
+TEST(WebsocketPermessageDeflate, Negotiate) {
+    EXPECT_FALSE(impl::NegotiatePermessageDeflate(""));
+    EXPECT_FALSE(impl::NegotiatePermessageDeflate("x-webkit-deflate-frame"));
+
+    auto params = impl::NegotiatePermessageDeflate("permessage-deflate; client_max_window_bits");
+    ASSERT_TRUE(params);
+    EXPECT_EQ(params->server_max_window_bits, MAX_WBITS);
+    EXPECT_EQ(
+        impl::MakePermessageDeflateResponse(*params),
+        "permessage-deflate; server_no_context_takeover; client_no_context_takeover"
+    );
+
+    params =
+        impl::NegotiatePermessageDeflate("permessage-deflate; server_max_window_bits=10; client_no_context_takeover");
+    ASSERT_TRUE(params);
+    EXPECT_EQ(params->server_max_window_bits, 10);
+    EXPECT_EQ(
+        impl::MakePermessageDeflateResponse(*params),
+        "permessage-deflate; server_no_context_takeover; client_no_context_takeover; server_max_window_bits=10"
+    );
+
+    // zlib can not compress with 256-byte windows, the next offer is accepted
+    params = impl::NegotiatePermessageDeflate(
+        "permessage-deflate; server_max_window_bits=8, permessage-deflate; server_max_window_bits=\"12\""
+    );
+    ASSERT_TRUE(params);
+    EXPECT_EQ(params->server_max_window_bits, 12);
+
+    EXPECT_FALSE(impl::NegotiatePermessageDeflate("permessage-deflate; unknown"));
+    EXPECT_FALSE(impl::NegotiatePermessageDeflate("permessage-deflate; server_max_window_bits=16"));
+    EXPECT_FALSE(impl::NegotiatePermessageDeflate("permessage-deflate; server_max_window_bits"));
+    EXPECT_FALSE(impl::NegotiatePermessageDeflate("permessage-deflate; client_max_window_bits=abc"));
+    EXPECT_FALSE(impl::NegotiatePermessageDeflate(
+        "permessage-deflate; server_no_context_takeover; server_no_context_takeover"
+    ));
+}
+
+TEST(WebsocketPermessageDeflate, RoundTrip) {
+    impl::MessageDeflater deflater;
+    impl::MessageInflater inflater;
+    std::string result;
+
+    for (const std::size_t size : {0, 1, 1000, 100'000, 1'000'000}) {
+        const auto data = MakeData(size);
+        auto compressed = deflater.Deflate(data);
+        if (size >= 1000) {
+            EXPECT_LT(compressed.size(), data.size());
+        }
+
+        EXPECT_EQ(inflater.Inflate(compressed, data.size(), result), CloseStatus::kNone);
+        EXPECT_EQ(result, data);
+    }
+}
+
+TEST(WebsocketPermessageDeflate, SmallWindow) {
+    impl::MessageDeflater deflater{9};
+    impl::MessageInflater inflater;
+    std::string result;
+
+    const auto data = MakeData(10'000);
+    auto compressed = deflater.Deflate(data);
+    EXPECT_EQ(inflater.Inflate(compressed, data.size(), result), CloseStatus::kNone);
+    EXPECT_EQ(result, data);
+}
+
+TEST(WebsocketPermessageDeflate, Errors) {
+    impl::MessageDeflater deflater;
+    impl::MessageInflater inflater;
+    std::string result;
+
+    const auto data = MakeData(100'000);
+    auto compressed = deflater.Deflate(data);
+    EXPECT_EQ(inflater.Inflate(compressed, data.size() - 1, result), CloseStatus::kTooBigData);
+
+    std::string corrupted = "\xff\xff\xff\xff";
+    EXPECT_EQ(inflater.Inflate(corrupted, data.size(), result), CloseStatus::kBadMessageData);
+
+    // The inflater is usable after errors
+    compressed = deflater.Deflate(data);
+    EXPECT_EQ(inflater.Inflate(compressed, data.size(), result), CloseStatus::kNone);
+    EXPECT_EQ(result, data);
+}
+
+USERVER_NAMESPACE_END
@@ -55,14 +55,18 @@ union Mask32 {
     uint8_t mask8[4];
 };
 
-void XorMaskInplace(uint8_t* dest, size_t len, Mask32 mask) {
-    auto* dest32 = reinterpret_cast<uint32_t*>(dest);
-    while (len >= sizeof(uint32_t)) {
-        *(dest32++) ^= mask.mask32;
-        len -= sizeof(uint32_t);
+// Unmasks the payload of a single frame. The independent 8-byte word
+// operations are vectorized by the compiler.
+void XorMaskInplace(char* dest, size_t len, Mask32 mask) {
+    const auto mask64 = (std::uint64_t{mask.mask32} << 32) | mask.mask32;
+    std::size_t i = 0;
+    for (; i + sizeof(mask64) <= len; i += sizeof(mask64)) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, dest + i, sizeof(word));
+        word ^= mask64;
+        std::memcpy(dest + i, &word, sizeof(word));
     }
-    auto* dest8 = reinterpret_cast<uint8_t*>(dest32);
-    for (unsigned i = 0; i < len; ++i) *(dest8++) ^= mask.mask8[i];
+    for (; i < len; ++i) dest[i] ^= static_cast<char>(mask.mask8[i % sizeof(mask.mask8)]);
 }
 
 template <class T, class V>
@@ -75,8 +79,13 @@ void PushRaw(const T& value, V& data) {
 
 namespace frames {
 
-boost::container::small_vector<char, impl::kMaxFrameHeaderSize>
-DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is_continuation, Final is_final) {
+boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
+    utils::span<const std::byte> data,
+    bool is_text,
+    Continuation is_continuation,
+    Final is_final,
+    Compressed is_compressed
+) {
     boost::container::small_vector<char, impl::kMaxFrameHeaderSize> frame;
 
     frame.resize(sizeof(WSHeader));
@@ -87,12 +96,16 @@ DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is
     hdr->bits.fin = is_final == Final::kYes ? 1 : 0;
     hdr->bits.opcode = is_text ? kText : kBinary;
     if (is_continuation == Continuation::kYes) hdr->bits.opcode = kContinuation;
+    // RSV1 is set only on the first frame of a compressed message
+    if (is_compressed == Compressed::kYes && is_continuation == Continuation::kNo) {
+        hdr->bits.reserved = kReservedCompressed;
+    }
 
     if (data.size() <= 125) {
         hdr->bits.payloadLen = data.size();
-    } else if (data.size() <= INT16_MAX) {
+    } else if (data.size() <= UINT16_MAX) {
         hdr->bits.payloadLen = 126;
-        PushRaw(boost::endian::native_to_big(static_cast<std::int16_t>(data.size())), frame);
+        PushRaw(boost::endian::native_to_big(static_cast<std::uint16_t>(data.size())), frame);
     } else {
         hdr->bits.payloadLen = 127;
         PushRaw(boost::endian::native_to_big(data.size()), frame);
@@ -164,7 +177,18 @@ CloseStatus ReadWSFrameImpl(
     // we assume that the WSHeader has been read a while ago
     if (engine::current_task::ShouldCancel()) return CloseStatus::kGoingAway;
 
-    const bool isDataFrame = (hdr.bits.opcode & (kText | kBinary)) || hdr.bits.opcode == kContinuation;
+    const bool isDataFrame = hdr.bits.opcode == kText || hdr.bits.opcode == kBinary || hdr.bits.opcode == kContinuation;
+
+    // RSV2 and RSV3 are not used by any extension, RSV1 marks the first frame of
+    // a compressed message
+    if (hdr.bits.reserved & ~kReservedCompressed) return CloseStatus::kProtocolError;
+    if (hdr.bits.reserved & kReservedCompressed) {
+        if (!frame.permessage_deflate || !isDataFrame || hdr.bits.opcode == kContinuation) {
+            return CloseStatus::kProtocolError;
+        }
+        frame.is_compressed = true;
+    }
+
     if (hdr.bits.payloadLen <= 125) {
         payload_len = hdr.bits.payloadLen;
     } else if (hdr.bits.payloadLen == 126) {
@@ -203,7 +227,7 @@ CloseStatus ReadWSFrameImpl(
         RecvExactly(io, MakeSpan(frame.payload->data() + newPayloadOffset, payload_len), {});
         if (engine::current_task::ShouldCancel()) return CloseStatus::kGoingAway;
 
-        if (mask.mask32) XorMaskInplace(reinterpret_cast<uint8_t*>(frame.payload->data()), frame.payload->size(), mask);
+        if (mask.mask32) XorMaskInplace(frame.payload->data() + newPayloadOffset, payload_len, mask);
     }
     char opcode = hdr.bits.opcode;
     char fin = hdr.bits.fin;
@@ -222,9 +246,9 @@ CloseStatus ReadWSFrameImpl(
                     boost::endian::big_to_native(*(reinterpret_cast<CloseStatusInt const*>(frame.payload->data())));
             break;
         case kText:
-            frame.is_text = true;
-            [[fallthrough]];
         case kBinary:
+            frame.is_text = opcode == kText;
+            [[fallthrough]];
         case kContinuation:
             frame.waiting_continuation = !fin;
             break;
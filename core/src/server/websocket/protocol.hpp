@@ -2,6 +2,7 @@
 
 #include <userver/server/websocket/server.hpp>
 
+#include <memory>
 #include <optional>
 #include <string>
 
@@ -11,6 +12,8 @@
 #include <userver/tracing/span.hpp>
 #include <userver/utils/span.hpp>
 
+#include <server/websocket/permessage_deflate.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::websocket::impl {
@@ -63,6 +66,10 @@ static_assert(sizeof(WSHeader) == 2);
 
 constexpr inline unsigned int kMaxFrameHeaderSize = sizeof(WSHeader) + sizeof(uint64_t);
 
+// RSV1 in WSHeader::bits::reserved, marks the compressed messages of the
+// permessage-deflate extension
+constexpr inline unsigned char kReservedCompressed = 0x4;
+
 namespace frames {
 
 enum class Continuation {
@@ -75,8 +82,18 @@ enum class Final {
     kNo,
 };
 
-boost::container::small_vector<char, impl::kMaxFrameHeaderSize>
-DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is_continuation, Final is_final);
+enum class Compressed {
+    kYes,
+    kNo,
+};
+
+boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
+    utils::span<const std::byte> data,
+    bool is_text,
+    Continuation is_continuation,
+    Final is_final,
+    Compressed is_compressed = Compressed::kNo
+);
 std::array<char, sizeof(WSHeader)> MakeControlFrame(WSOpcodes opcode, utils::span<const std::byte> data = {});
 std::string CloseFrame(CloseStatusInt status_code);
 
@@ -92,6 +109,10 @@ struct FrameParserState {
     bool pong_received = false;
     bool waiting_continuation = false;
     bool is_text = false;
+    // the message is compressed by the permessage-deflate extension
+    bool is_compressed = false;
+    // the permessage-deflate extension is negotiated
+    bool permessage_deflate = false;
     CloseStatusInt remote_close_status = 0;
     size_t offset_when_noblock = 0;
 
@@ -108,6 +129,13 @@ std::optional<CloseStatus> ReadWSFrameDontWaitForHeader(
     std::size_t& payload_len
 );
 
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name,
+    const Config& config,
+    const std::optional<DeflateParams>& deflate_params
+);
+
 }  // namespace server::websocket::impl
 
 USERVER_NAMESPACE_END
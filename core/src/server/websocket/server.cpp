@@ -7,6 +7,7 @@
 #include <userver/utils/fast_scope_guard.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
+#include "permessage_deflate.hpp"
 #include "protocol.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -23,6 +24,9 @@ SendExactly(engine::io::WritableBase& writable, utils::span<const char> data1, u
 
 Message CloseMessage(CloseStatus status) { return {{}, status, false}; }
 
+// Smaller messages are not worth compressing
+constexpr std::size_t kMinDeflateSize = 128;
+
 utils::span<const std::byte> MakeBinarySpan(utils::span<const char> span) { return utils::as_bytes(span); }
 
 }  // namespace
@@ -31,9 +35,29 @@ Config Parse(const yaml_config::YamlConfig& config, formats::parse::To<Config>)
     return {
         config["max-remote-payload"].As<unsigned>(65536),
         config["fragment-size"].As<unsigned>(65536),
+        config["permessage-deflate"].As<bool>(false),
     };
 }
 
+PreparedMessage::PreparedMessage(std::string_view data, bool is_text, bool compress) : size_(data.size()) {
+    const auto make_frame = [is_text](std::string_view payload, impl::frames::Compressed is_compressed) {
+        const auto header = impl::frames::DataFrameHeader(
+            MakeBinarySpan(payload), is_text, impl::frames::Continuation::kNo, impl::frames::Final::kYes, is_compressed
+        );
+        std::string frame;
+        frame.reserve(header.size() + payload.size());
+        frame.append(header.data(), header.size());
+        frame.append(payload);
+        return std::make_shared<const std::string>(std::move(frame));
+    };
+
+    frame_ = make_frame(data, impl::frames::Compressed::kNo);
+    if (compress && data.size() >= kMinDeflateSize) {
+        const auto compressed = impl::MessageDeflater{}.Deflate(data);
+        if (compressed.size() < data.size()) compressed_frame_ = make_frame(compressed, impl::frames::Compressed::kYes);
+    }
+}
+
 class WebSocketConnectionImpl final : public WebSocketConnection {
 public:
 private:
@@ -59,13 +83,25 @@ private:
 
     Config config;
 
+    // Set if the permessage-deflate extension is negotiated
+    std::optional<impl::MessageDeflater> deflater_;
+    std::optional<impl::MessageInflater> inflater_;
+    std::string inflate_buffer_;
+
 public:
     WebSocketConnectionImpl(
         std::unique_ptr<engine::io::RwBase> io_,
         const engine::io::Sockaddr& remote_addr,
-        const Config& server_config
+        const Config& server_config,
+        const std::optional<impl::DeflateParams>& deflate_params
     )
-        : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {}
+        : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {
+        if (deflate_params) {
+            deflater_.emplace(deflate_params->server_max_window_bits);
+            inflater_.emplace();
+            frame_.permessage_deflate = true;
+        }
+    }
 
     ~WebSocketConnectionImpl() override { LOG_TRACE() << "Websocket connection closed"; }
 
@@ -73,6 +109,22 @@ public:
         stats_.msg_sent++;
         stats_.bytes_sent += message.data.size();
 
+        // Compressed outside of the lock, the reading coroutine may need it
+        // to send a pong
+        std::string compressed;
+        auto is_compressed = impl::frames::Compressed::kNo;
+        const bool is_data =
+            message.opcode == impl::WSOpcodes::kText || message.opcode == impl::WSOpcodes::kBinary;
+        if (deflater_ && is_data && !message.close_status && message.data.size() >= kMinDeflateSize) {
+            compressed = deflater_->Deflate(
+                std::string_view{reinterpret_cast<const char*>(message.data.data()), message.data.size()}
+            );
+            if (compressed.size() < message.data.size()) {
+                message.data = MakeBinarySpan(compressed);
+                is_compressed = impl::frames::Compressed::kYes;
+            }
+        }
+
         const std::unique_lock lock(write_mutex_);
 
         LOG_TRACE() << "Write message " << message.data.size() << " bytes";
@@ -92,14 +144,19 @@ public:
                     data_to_send.first(config.fragment_size),
                     message.opcode == impl::WSOpcodes::kText,
                     continuation,
-                    impl::frames::Final::kNo
+                    impl::frames::Final::kNo,
+                    is_compressed
                 );
                 SendExactly(*io, data_frame_header, data_to_send.first(config.fragment_size));
                 continuation = impl::frames::Continuation::kYes;
                 data_to_send = data_to_send.last(data_to_send.size() - config.fragment_size);
             }
             const auto data_frame_header = impl::frames::DataFrameHeader(
-                data_to_send, message.opcode == impl::WSOpcodes::kText, continuation, impl::frames::Final::kYes
+                data_to_send,
+                message.opcode == impl::WSOpcodes::kText,
+                continuation,
+                impl::frames::Final::kYes,
+                is_compressed
             );
             SendExactly(*io, data_frame_header, data_to_send);
         }
@@ -123,6 +180,20 @@ public:
         SendExtended(mext);
     }
 
+    void SendPrepared(const PreparedMessage& message) override {
+        stats_.msg_sent++;
+        stats_.bytes_sent += message.GetSize();
+
+        // The shared frame is compressed with the default window size
+        const bool use_compressed = message.compressed_frame_ && deflater_ &&
+                                    deflater_->GetWindowBits() == impl::DeflateParams{}.server_max_window_bits;
+        const auto& frame = use_compressed ? *message.compressed_frame_ : *message.frame_;
+
+        const std::unique_lock lock(write_mutex_);
+        LOG_TRACE() << "Write prepared message " << frame.size() << " bytes";
+        SendExactly(*io, frame, {});
+    }
+
     bool RecvImpl(Message& msg, bool do_not_wait_for_message_header) {
         msg.data.resize(0);  // do not call .clear() to keep the allocated memory
         frame_.payload = &msg.data;
@@ -165,7 +236,9 @@ public:
             }
 
             if (frame_.ping_received) {
-                MessageExtended pongMsg{MakeBinarySpan(*frame_.payload), impl::WSOpcodes::kPong, {}};
+                // The ping payload follows the data of an unfinished message
+                MessageExtended pongMsg{
+                    MakeBinarySpan(*frame_.payload).last(payload_len), impl::WSOpcodes::kPong, {}};
                 SendExtended(pongMsg);
                 frame_.payload->resize(frame_.payload->size() - payload_len);
                 frame_.ping_received = false;
@@ -177,6 +250,19 @@ public:
             }
             if (frame_.waiting_continuation) continue;
 
+            if (frame_.is_compressed) {
+                frame_.is_compressed = false;
+                const auto inflate_status = inflater_->Inflate(msg.data, config.max_remote_payload, inflate_buffer_);
+                if (inflate_status != CloseStatus::kNone) {
+                    MessageExtended close_msg{{}, impl::WSOpcodes::kClose, inflate_status};
+                    SendExtended(close_msg);
+                    msg = CloseMessage(inflate_status);
+                    return true;
+                }
+                // keeps both buffers allocated for the next messages
+                std::swap(msg.data, inflate_buffer_);
+            }
+
             msg.is_text = frame_.is_text;
             stats_.msg_recv++;
             stats_.bytes_recv += msg.data.size();
@@ -219,9 +305,22 @@ WebSocketConnection::~WebSocketConnection() = default;
 
 std::shared_ptr<WebSocketConnection>
 MakeWebSocket(std::unique_ptr<engine::io::RwBase>&& socket, engine::io::Sockaddr&& peer_name, const Config& config) {
-    return std::make_shared<WebSocketConnectionImpl>(std::move(socket), std::move(peer_name), config);
+    return impl::MakeWebSocket(std::move(socket), std::move(peer_name), config, std::nullopt);
+}
+
+namespace impl {
+
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name,
+    const Config& config,
+    const std::optional<DeflateParams>& deflate_params
+) {
+    return std::make_shared<WebSocketConnectionImpl>(std::move(socket), std::move(peer_name), config, deflate_params);
 }
 
+}  // namespace impl
+
 }  // namespace server::websocket
 
 USERVER_NAMESPACE_END
@@ -68,10 +68,24 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
         USERVER_NAMESPACE::http::headers::kWebsocketAccept, websocket::impl::WebsocketSecAnswer(secWebsocketKey)
     );
 
+    std::optional<impl::DeflateParams> deflate_params;
+    if (config_.permessage_deflate) {
+        deflate_params = impl::NegotiatePermessageDeflate(
+            request.GetHeader(USERVER_NAMESPACE::http::headers::kWebsocketExtensions)
+        );
+        if (deflate_params) {
+            response.SetHeader(
+                USERVER_NAMESPACE::http::headers::kWebsocketExtensions,
+                impl::MakePermessageDeflateResponse(*deflate_params)
+            );
+        }
+    }
+
     request.SetUpgradeWebsocket([context = std::make_shared<server::request::RequestContext>(std::move(context)),
+                                 deflate_params,
                                  this](std::unique_ptr<engine::io::RwBase> socket, engine::io::Sockaddr&& peer_name) {
         tracing::Span span("ws/" + HandlerName());
-        auto ws = websocket::MakeWebSocket(std::move(socket), std::move(peer_name), config_);
+        auto ws = impl::MakeWebSocket(std::move(socket), std::move(peer_name), config_, deflate_params);
         try {
             Handle(*ws, *context);
         } catch (const std::exception& e) {
@@ -106,6 +120,10 @@ properties:
         type: integer
         description: max output fragment size
         defaultDescription: 65536
+    permessage-deflate:
+        type: boolean
+        description: accept the permessage-deflate extension (RFC 7692) offered by clients
+        defaultDescription: false
 )");
 }
 
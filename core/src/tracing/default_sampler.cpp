@@ -0,0 +1,64 @@
+#include <tracing/default_sampler.hpp>
+
+#include <chrono>
+#include <stdexcept>
+
+#include <logging/log_sampling_config.hpp>
+#include <userver/tracing/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+DefaultSamplerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<DefaultSamplerConfig>) {
+    DefaultSamplerConfig config;
+    config.sampled_traces_percent = value["sampled-traces-percent"].As<double>(config.sampled_traces_percent);
+    config.per_endpoint_rps = value["per-endpoint-rps"].As<std::size_t>(config.per_endpoint_rps);
+
+    const auto tail = value["tail"];
+    config.tail_sampling = tail["enabled"].As<bool>(config.tail_sampling);
+    config.tail_settings.latency_threshold =
+        tail["latency-threshold"].As<std::chrono::milliseconds>(config.tail_settings.latency_threshold);
+    config.tail_settings.max_spans = tail["max-spans"].As<std::size_t>(config.tail_settings.max_spans);
+
+    if (config.sampled_traces_percent < 0 || config.sampled_traces_percent > 100) {
+        throw std::runtime_error("Invalid sampled-traces-percent value in " + value.GetPath());
+    }
+    return config;
+}
+
+DefaultSampler::DefaultSampler(const DefaultSamplerConfig& config) : config_(config) {}
+
+SamplingDecision DefaultSampler::Sample(const Span& span) const {
+    if (logging::IsTraceSampledIn(span.GetTraceId(), config_.sampled_traces_percent)) {
+        return SamplingDecision::kRecord;
+    }
+    if (config_.per_endpoint_rps != 0 && ObtainEndpointToken(span.GetName())) {
+        return SamplingDecision::kRecord;
+    }
+    return config_.tail_sampling ? SamplingDecision::kDefer : SamplingDecision::kDrop;
+}
+
+TailSamplingSettings DefaultSampler::GetTailSamplingSettings() const { return config_.tail_settings; }
+
+bool DefaultSampler::ObtainEndpointToken(const std::string& endpoint) const {
+    auto bucket = endpoint_buckets_.Get(endpoint);
+    if (!bucket) {
+        bucket = endpoint_buckets_
+                     .TryEmplace(
+                         endpoint,
+                         config_.per_endpoint_rps,
+                         utils::TokenBucket::RefillPolicy{
+                             1,
+                             std::chrono::duration_cast<utils::TokenBucket::Duration>(std::chrono::seconds{1}) /
+                                 config_.per_endpoint_rps,
+                         }
+                     )
+                     .value;
+    }
+    return bucket->Obtain();
+}
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
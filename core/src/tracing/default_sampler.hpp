@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/tracing/sampler.hpp>
+#include <userver/utils/token_bucket.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+struct DefaultSamplerConfig {
+    // Requests of these traces are recorded, same selection as in the log
+    // sampling, so the logs and the spans of a trace are kept together
+    double sampled_traces_percent{100};
+    // Additionally records up to this many requests per second of each
+    // endpoint, 0 disables
+    std::size_t per_endpoint_rps{0};
+    // Defer the rest of the requests instead of dropping them
+    bool tail_sampling{false};
+    TailSamplingSettings tail_settings;
+};
+
+DefaultSamplerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<DefaultSamplerConfig>);
+
+// Thread-safe
+class DefaultSampler final : public Sampler {
+public:
+    explicit DefaultSampler(const DefaultSamplerConfig& config);
+
+    SamplingDecision Sample(const Span& span) const override;
+
+    TailSamplingSettings GetTailSamplingSettings() const override;
+
+private:
+    bool ObtainEndpointToken(const std::string& endpoint) const;
+
+    const DefaultSamplerConfig config_;
+    // Endpoints are span names of the handlers, so the map is bounded
+    mutable rcu::RcuMap<std::string, utils::TokenBucket> endpoint_buckets_;
+};
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
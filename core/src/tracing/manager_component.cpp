@@ -5,6 +5,8 @@
 #include <userver/tracing/span_builder.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <tracing/default_sampler.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace tracing {
@@ -13,6 +15,11 @@ namespace {
 
 using FlagsFormat = utils::Flags<tracing::Format>;
 
+std::shared_ptr<const Sampler> MakeSampler(const components::ComponentConfig& config) {
+    if (!config.HasMember("sampling")) return nullptr;
+    return std::make_shared<DefaultSampler>(config["sampling"].As<DefaultSamplerConfig>());
+}
+
 }  // namespace
 
 const TracingManagerBase& GetTracingManagerFromConfig(
@@ -55,7 +62,11 @@ DefaultTracingManagerLocator::DefaultTracingManagerLocator(
     const components::ComponentContext& context
 )
     : components::ComponentBase(config, context),
-      default_manager_(config["incoming-format"].As<FlagsFormat>(), config["new-requests-format"].As<FlagsFormat>()),
+      default_manager_(
+          config["incoming-format"].As<FlagsFormat>(),
+          config["new-requests-format"].As<FlagsFormat>(),
+          MakeSampler(config)
+      ),
       tracing_manager_(GetTracingManagerFromConfig(default_manager_, config, context)) {}
 
 const TracingManagerBase& DefaultTracingManagerLocator::GetTracingManager() const { return tracing_manager_; }
@@ -84,6 +95,40 @@ properties:
         type: array
         description: Send tracing data in those formats
         items: *format_items
+    sampling:
+        type: object
+        description: sampling of the spans of the incoming requests, all the spans are logged if missing
+        additionalProperties: false
+        properties:
+            sampled-traces-percent:
+                type: number
+                description: percent of the traces with all the spans logged, selected by trace id
+                defaultDescription: 100
+                minimum: 0
+                maximum: 100
+            per-endpoint-rps:
+                type: integer
+                description: additionally log all the spans of up to this many requests per second of each handler
+                defaultDescription: 0
+                minimum: 0
+            tail:
+                type: object
+                description: keep the spans of the rest of the requests until they finish and log them only for slow or failed requests
+                additionalProperties: false
+                properties:
+                    enabled:
+                        type: boolean
+                        description: drop the spans of the rest of the requests if false
+                        defaultDescription: false
+                    latency-threshold:
+                        type: string
+                        description: log the requests that take at least this long
+                        defaultDescription: 1s
+                    max-spans:
+                        type: integer
+                        description: max number of the kept spans of a single request
+                        defaultDescription: 256
+                        minimum: 1
 )");
 }
 
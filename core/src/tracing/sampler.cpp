@@ -0,0 +1,13 @@
+#include <userver/tracing/sampler.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+Sampler::~Sampler() = default;
+
+TailSamplingSettings Sampler::GetTailSamplingSettings() const { return {}; }
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
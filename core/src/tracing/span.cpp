@@ -1,15 +1,21 @@
 #include <tracing/span_impl.hpp>
 
+#include <array>
+#include <mutex>
 #include <type_traits>
+#include <variant>
+#include <vector>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
 #include <logging/log_helper_impl.hpp>
+#include <userver/compiler/thread_local.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
+#include <userver/tracing/sampler.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
@@ -28,6 +34,11 @@ using RealMilliseconds = std::chrono::duration<double, std::milli>;
 
 constexpr std::string_view kStopWatchTag = "stopwatch_name";
 constexpr std::string_view kTotalTimeTag = "total_time";
+
+// Written as `<key>_time` tags by the impl::TimeStorage
+const std::string kTaskQueueWaitKey = "task_queue_wait";
+const std::string kTaskRunningKey = "task_running";
+const std::string kTaskSuspendedKey = "task_suspended";
 constexpr std::string_view kTimeUnitsTag = "stopwatch_units";
 constexpr std::string_view kStartTimestampTag = "start_timestamp";
 
@@ -60,6 +71,25 @@ TsBuffer StartTsToString(std::chrono::system_clock::time_point start) {
 // Maintain coro-local span stack to identify "current span" in O(1).
 engine::TaskLocalVariable<SpanStack> task_local_spans;
 
+constexpr std::size_t kMaxCachedImplStorages = 16;
+
+struct ImplStorageCache final {
+    ImplStorageCache() = default;
+    ImplStorageCache(const ImplStorageCache&) = delete;
+    ImplStorageCache& operator=(const ImplStorageCache&) = delete;
+
+    ~ImplStorageCache() {
+        for (std::size_t i = 0; i < size; ++i) {
+            ::operator delete(storages[i]);
+        }
+    }
+
+    std::array<void*, kMaxCachedImplStorages> storages{};
+    std::size_t size{0};
+};
+
+compiler::ThreadLocal local_impl_storages = [] { return ImplStorageCache{}; };
+
 std::string GenerateSpanId() {
     std::uniform_int_distribution<std::uint64_t> dist;
     const auto random_value = utils::WithDefaultRandom(dist);
@@ -70,6 +100,92 @@ std::string GenerateSpanId() {
 
 }  // namespace
 
+namespace impl {
+
+// Spans of a request with SamplingDecision::kDefer that wait for the end of
+// the request span to be logged or dropped
+class DeferredSpans final {
+public:
+    explicit DeferredSpans(const TailSamplingSettings& settings) : settings_(settings) {}
+
+    // Returns false if the span should be logged right away
+    bool TryDefer(Span::Impl& span) {
+        const std::lock_guard lock{mutex_};
+        switch (state_) {
+            case State::kRecorded:
+                return false;
+            case State::kDropped:
+                return true;
+            case State::kDeferring:
+                break;
+        }
+
+        has_error_ = has_error_ || span.HasErrorFlag();
+        if (spans_.size() < settings_.max_spans) {
+            // The request span still holds a reference to *this
+            auto deferred = std::make_unique<Span::Impl>(std::move(span));
+            deferred->deferred_spans_.reset();
+            deferred->finish_steady_time_ = std::chrono::steady_clock::now();
+            spans_.push_back(std::move(deferred));
+        }
+        return true;
+    }
+
+    // Called by the request span, returns true if the request should be logged
+    bool Finish(const Span::Impl& request_span) {
+        const auto duration = std::chrono::steady_clock::now() - request_span.start_steady_time_;
+
+        std::vector<std::unique_ptr<Span::Impl>> spans;
+        bool record = false;
+        {
+            const std::lock_guard lock{mutex_};
+            record = has_error_ || request_span.HasErrorFlag() || duration >= settings_.latency_threshold;
+            state_ = record ? State::kRecorded : State::kDropped;
+            spans.swap(spans_);
+        }
+
+        if (!record) {
+            for (auto& span : spans) span->sampled_out_ = true;
+        }
+        // The destructors log the recorded spans
+        spans.clear();
+        return record;
+    }
+
+private:
+    enum class State { kDeferring, kRecorded, kDropped };
+
+    const TailSamplingSettings settings_;
+
+    std::mutex mutex_;
+    State state_{State::kDeferring};
+    bool has_error_{false};
+    std::vector<std::unique_ptr<Span::Impl>> spans_;
+};
+
+}  // namespace impl
+
+void* AllocateImplStorage() {
+    {
+        auto cache = local_impl_storages.Use();
+        if (cache->size != 0) {
+            return cache->storages[--cache->size];
+        }
+    }
+    return ::operator new(sizeof(Span::Impl));
+}
+
+void DeallocateImplStorage(void* storage) noexcept {
+    {
+        auto cache = local_impl_storages.Use();
+        if (cache->size != cache->storages.size()) {
+            cache->storages[cache->size++] = storage;
+            return;
+        }
+    }
+    ::operator delete(storage);
+}
+
 Span::Impl::Impl(
     std::string name,
     ReferenceType reference_type,
@@ -107,10 +223,30 @@ Span::Impl::Impl(
     if (parent) {
         log_extra_inheritable_ = parent->log_extra_inheritable_;
         local_log_level_ = parent->local_log_level_;
+        sampled_out_ = parent->sampled_out_;
+        deferred_spans_ = parent->deferred_spans_;
+    }
+
+    if (auto* const context = engine::current_task::GetCurrentTaskContextUnchecked()) {
+        if (const auto timings = context->GetTimings()) {
+            start_task_ = context;
+            start_task_timings_ = *timings;
+        }
     }
 }
 
 Span::Impl::~Impl() {
+    // The deferred copies have already accounted them
+    if (start_task_ && !finish_steady_time_ && ShouldLog()) AccountTaskTimings();
+
+    if (deferred_spans_) {
+        if (is_sampling_root_) {
+            if (!deferred_spans_->Finish(*this)) return;
+        } else if (ShouldLog() && deferred_spans_->TryDefer(*this)) {
+            return;
+        }
+    }
+
     if (!ShouldLog()) {
         return;
     }
@@ -123,8 +259,7 @@ Span::Impl::~Impl() {
 }
 
 void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
-    const auto steady_now = std::chrono::steady_clock::now();
-    const auto duration = steady_now - start_steady_time_;
+    const auto duration = GetFinishSteadyTime() - start_steady_time_;
     const auto total_time_ms = std::chrono::duration_cast<RealMilliseconds>(duration).count();
     const auto timestamp_buffer = StartTsToString(start_system_time_);
     const auto ref_type = GetReferenceType() == ReferenceType::kChild ? kReferenceTypeChild : kReferenceTypeFollows;
@@ -189,7 +324,53 @@ std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
     return {};
 }
 
+void Span::Impl::SetSampling(SamplingDecision decision, const TailSamplingSettings& tail_settings) {
+    sampled_out_ = decision == SamplingDecision::kDrop;
+    is_sampling_root_ = decision == SamplingDecision::kDefer;
+    deferred_spans_ = is_sampling_root_ ? std::make_shared<impl::DeferredSpans>(tail_settings) : nullptr;
+}
+
+logging::LogExtra* Span::Impl::GetLocalTagsForWrite() {
+    if (is_no_log_span_ || sampled_out_) return nullptr;
+    if (!log_extra_local_) log_extra_local_.emplace();
+    return &*log_extra_local_;
+}
+
+bool Span::Impl::HasErrorFlag() const {
+    const auto is_set = [](const logging::LogExtra::Value& value) {
+        return std::visit(
+            [](const auto& x) {
+                if constexpr (std::is_same_v<std::decay_t<decltype(x)>, std::string>) {
+                    return x == "true" || x == "1";
+                } else {
+                    return x != 0;
+                }
+            },
+            value
+        );
+    };
+    return is_set(log_extra_inheritable_.GetValue(kErrorFlag)) ||
+           (log_extra_local_ && is_set(log_extra_local_->GetValue(kErrorFlag)));
+}
+
+void Span::Impl::AccountTaskTimings() {
+    auto* const context = engine::current_task::GetCurrentTaskContextUnchecked();
+    if (context != start_task_) return;
+    const auto timings = context->GetTimings();
+    if (!timings) return;
+
+    time_storage_.PushLap(kTaskQueueWaitKey, timings->queue_wait - start_task_timings_.queue_wait);
+    time_storage_.PushLap(kTaskRunningKey, timings->running - start_task_timings_.running);
+    time_storage_.PushLap(kTaskSuspendedKey, timings->suspended - start_task_timings_.suspended);
+}
+
+std::chrono::steady_clock::time_point Span::Impl::GetFinishSteadyTime() const {
+    return finish_steady_time_.value_or(std::chrono::steady_clock::now());
+}
+
 bool Span::Impl::ShouldLog() const {
+    if (sampled_out_) return false;
+
     /* We must honour default log level, but use span's level from ourselves,
      * not the previous span's.
      */
@@ -198,8 +379,9 @@ bool Span::Impl::ShouldLog() const {
 }
 
 void Span::OptionalDeleter::operator()(Span::Impl* impl) const noexcept {
-    if (do_delete) {
-        std::default_delete<Impl>{}(impl);
+    if (do_delete && impl) {
+        impl->~Impl();
+        DeallocateImplStorage(impl);
     }
 }
 
@@ -324,13 +506,15 @@ tracing::ScopeTime Span::CreateScopeTime() { return ScopeTime(pimpl_->GetTimeSto
 tracing::ScopeTime Span::CreateScopeTime(std::string name) { return {pimpl_->GetTimeStorage(), std::move(name)}; }
 
 void Span::AddNonInheritableTag(std::string key, logging::LogExtra::Value value) {
-    if (!pimpl_->log_extra_local_) pimpl_->log_extra_local_.emplace();
-    pimpl_->log_extra_local_->Extend(std::move(key), std::move(value));
+    if (auto* const tags = pimpl_->GetLocalTagsForWrite()) {
+        tags->Extend(std::move(key), std::move(value));
+    }
 }
 
 void Span::AddNonInheritableTags(const logging::LogExtra& log_extra) {
-    if (!pimpl_->log_extra_local_) pimpl_->log_extra_local_.emplace();
-    pimpl_->log_extra_local_->Extend(log_extra);
+    if (auto* const tags = pimpl_->GetLocalTagsForWrite()) {
+        tags->Extend(log_extra);
+    }
 }
 
 void Span::SetLogLevel(logging::Level log_level) {
@@ -377,6 +561,14 @@ std::string Span::GetParentLink() const { return GetTag(kParentLinkTag); }
 
 void Span::LogTo(logging::impl::TagWriter writer) const& { pimpl_->LogTo(writer); }
 
+void Span::SetSampling(
+    SamplingDecision decision,
+    const TailSamplingSettings& tail_settings,
+    utils::impl::InternalTag
+) {
+    pimpl_->SetSampling(decision, tail_settings);
+}
+
 bool Span::ShouldLogDefault() const noexcept { return pimpl_->ShouldLog(); }
 
 void Span::DetachFromCoroStack() {
@@ -391,6 +583,8 @@ const std::string& Span::GetTraceId() const { return pimpl_->GetTraceId(); }
 
 const std::string& Span::GetSpanId() const { return pimpl_->GetSpanId(); }
 
+const std::string& Span::GetName() const { return pimpl_->GetName(); }
+
 const std::string& Span::GetParentId() const { return pimpl_->GetParentId(); }
 
 ScopeTime::Duration Span::GetTotalDuration(const std::string& scope_name) const {
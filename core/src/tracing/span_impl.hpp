@@ -2,17 +2,21 @@
 
 #include <chrono>
 #include <list>
+#include <memory>
+#include <new>
 #include <optional>
 #include <string>
 #include <string_view>
 
 #include <boost/intrusive/list.hpp>
 
+#include <userver/engine/task/current_task.hpp>
 #include <userver/formats/json/string_builder.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/logging/log_extra.hpp>
 #include <userver/logging/log_filepath.hpp>
 #include <userver/logging/log_helper.hpp>
+#include <userver/tracing/sampler.hpp>
 #include <userver/tracing/scope_time.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tracer.hpp>
@@ -27,6 +31,10 @@ namespace tracing {
 inline const std::string kLinkTag = "link";
 inline const std::string kParentLinkTag = "parent_link";
 
+namespace impl {
+class DeferredSpans;
+}  // namespace impl
+
 class Span::Impl : public boost::intrusive::list_base_hook<boost::intrusive::link_mode<boost::intrusive::auto_unlink>> {
 public:
     explicit Impl(
@@ -58,6 +66,7 @@ public:
     // Add the context of this Span a non-Span-specific log record
     void LogTo(logging::impl::TagWriter writer);
 
+    const std::string& GetName() const noexcept { return name_; }
     const std::string& GetTraceId() const& noexcept { return trace_id_; }
     const std::string& GetSpanId() const& noexcept { return span_id_; }
     const std::string& GetParentId() const& noexcept { return parent_id_; }
@@ -75,6 +84,8 @@ public:
     void DetachFromCoroStack();
     void AttachToCoroStack();
 
+    void SetSampling(SamplingDecision decision, const TailSamplingSettings& tail_settings);
+
 private:
     void LogOpenTracing() const;
     void DoLogOpenTracing(logging::impl::TagWriter writer) const;
@@ -83,6 +94,15 @@ private:
     static std::string GetParentIdForLogging(const Span::Impl* parent);
     bool ShouldLog() const;
 
+    // Tags that are only written to the span log record are not stored for
+    // the spans that are never logged
+    logging::LogExtra* GetLocalTagsForWrite();
+
+    bool HasErrorFlag() const;
+    std::chrono::steady_clock::time_point GetFinishSteadyTime() const;
+
+    void AccountTaskTimings();
+
     const std::string name_;
     const bool is_no_log_span_;
     logging::Level log_level_;
@@ -99,15 +119,29 @@ private:
     const std::chrono::system_clock::time_point start_system_time_;
     const std::chrono::steady_clock::time_point start_steady_time_;
 
+    // Set if the task processor accounts the task timings, the span may be
+    // finished in another task
+    const void* start_task_{nullptr};
+    engine::TaskTimings start_task_timings_;
+
     std::string trace_id_;
     std::string span_id_;
     std::string parent_id_;
     const ReferenceType reference_type_;
     utils::impl::SourceLocation source_location_;
 
+    // Sampling of the request is inherited from the parent span
+    bool sampled_out_{false};
+    bool is_sampling_root_{false};
+    std::shared_ptr<impl::DeferredSpans> deferred_spans_;
+    // Set for the copies of the finished spans that wait for the end of the
+    // request in impl::DeferredSpans
+    std::optional<std::chrono::steady_clock::time_point> finish_steady_time_;
+
     friend class Span;
     friend class SpanBuilder;
     friend class TagScope;
+    friend class impl::DeferredSpans;
 };
 
 // Use list instead of stack to avoid UB in case of "pop non-last item"
@@ -116,9 +150,20 @@ using SpanStack = boost::intrusive::list<Span::Impl, boost::intrusive::constant_
 
 const Span::Impl* GetParentSpanImpl();
 
+// Span::Impl is large because of the inline tag storage of LogExtra, so the
+// memory of the destroyed spans is reused by the next spans of the thread
+void* AllocateImplStorage();
+void DeallocateImplStorage(void* storage) noexcept;
+
 template <typename... Args>
 Span::Impl* AllocateImpl(Args&&... args) {
-    return new Span::Impl(std::forward<Args>(args)...);
+    void* const storage = AllocateImplStorage();
+    try {
+        return new (storage) Span::Impl(std::forward<Args>(args)...);
+    } catch (...) {
+        DeallocateImplStorage(storage);
+        throw;
+    }
 }
 
 }  // namespace tracing
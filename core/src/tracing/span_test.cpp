@@ -7,7 +7,9 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/tracing/opentelemetry.hpp>
+#include <userver/tracing/sampler.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/regex.hpp>
@@ -555,6 +557,109 @@ UTEST_F(Span, NoLogWithSetLogLevel) {
     tracing::Tracer::SetNoLogSpans(tracing::NoLogSpans());
 }
 
+UTEST_F(Span, NoLogSpanTags) {
+    constexpr const char* kIgnoreSpan = "span_to_ignore";
+
+    tracing::NoLogSpans no_logs;
+    no_logs.names = {kIgnoreSpan};
+    tracing::Tracer::SetNoLogSpans(std::move(no_logs));
+
+    {
+        tracing::Span span(kIgnoreSpan);
+        span.AddTag("inherited_key", "inherited_value");
+        span.AddNonInheritableTag("local_key", "local_value");
+
+        tracing::Span child("child_span");
+        LOG_INFO() << "inside";
+    }
+
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(kIgnoreSpan)));
+    EXPECT_THAT(GetStreamString(), HasSubstr("inherited_key=inherited_value"));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("local_key")));
+
+    tracing::Tracer::SetNoLogSpans(tracing::NoLogSpans());
+}
+
+UTEST_F(Span, SamplingDrop) {
+    {
+        tracing::Span span("dropped_span");
+        span.SetSampling(tracing::SamplingDecision::kDrop, {}, utils::impl::InternalTag{});
+        span.AddNonInheritableTag("local_key", "local_value");
+        EXPECT_FALSE(span.ShouldLogDefault());
+
+        tracing::Span child("dropped_child");
+        LOG_INFO() << "inside dropped";
+    }
+
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("dropped_span")));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("dropped_child")));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("local_key")));
+    EXPECT_THAT(GetStreamString(), HasSubstr("inside dropped"));
+}
+
+UTEST_F(Span, SamplingDeferFast) {
+    {
+        tracing::Span span("fast_span");
+        span.SetSampling(tracing::SamplingDecision::kDefer, {}, utils::impl::InternalTag{});
+        { tracing::Span child("fast_child"); }
+    }
+
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("fast_span")));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("fast_child")));
+}
+
+UTEST_F(Span, SamplingDeferSlow) {
+    tracing::TailSamplingSettings settings;
+    settings.latency_threshold = std::chrono::milliseconds{10};
+    settings.max_spans = 1;
+    {
+        tracing::Span span("slow_span");
+        span.SetSampling(tracing::SamplingDecision::kDefer, settings, utils::impl::InternalTag{});
+        {
+            tracing::Span child("slow_child");
+            engine::SleepFor(std::chrono::milliseconds{20});
+        }
+        { tracing::Span child("over_limit_child"); }
+        logging::LogFlush();
+        EXPECT_THAT(GetStreamString(), Not(HasSubstr("slow_child")));
+    }
+
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), HasSubstr("slow_span"));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("over_limit_child")));
+
+    // The deferred span keeps its own duration
+    const auto child_record = GetStreamString().substr(GetStreamString().find("stopwatch_name=slow_child"));
+    const auto total_time_pos = child_record.find("total_time=");
+    ASSERT_NE(total_time_pos, std::string::npos);
+    EXPECT_GE(std::stod(child_record.substr(total_time_pos + std::string_view{"total_time="}.size())), 20);
+}
+
+UTEST_F(Span, SamplingDeferError) {
+    {
+        tracing::Span span("failed_span");
+        span.SetSampling(tracing::SamplingDecision::kDefer, {}, utils::impl::InternalTag{});
+        {
+            tracing::Span child("failed_child");
+            child.AddNonInheritableTag(tracing::kErrorFlag, true);
+        }
+        { tracing::Span child("other_child"); }
+    }
+
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), HasSubstr("failed_span"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("failed_child"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("other_child"));
+}
+
 UTEST_F(Span, ForeignSpan) {
     auto tracer = tracing::MakeTracer("test_service", {});
 
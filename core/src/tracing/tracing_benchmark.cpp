@@ -3,8 +3,11 @@
 #include <userver/engine/run_standalone.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/null_logger.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 
+#include <tracing/no_log_spans.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -51,6 +54,41 @@ void tracing_opentracing_ctr(benchmark::State& state) {
 }
 BENCHMARK(tracing_opentracing_ctr);
 
+void tracing_child_span_ctr(benchmark::State& state) {
+    auto logger = logging::MakeNullLogger();
+    engine::RunStandalone([&] {
+        auto tracer = tracing::MakeTracer("test_service", logger);
+        auto parent = GetSpanWithOpentracingHttpTags(tracer);
+        for ([[maybe_unused]] auto _ : state) {
+            auto span = parent.CreateChild("child");
+            span.AddNonInheritableTag(tracing::kDatabaseType, tracing::kDatabasePostgresType);
+            span.AddNonInheritableTag(tracing::kDatabaseStatementName, "select_something");
+            benchmark::DoNotOptimize(span);
+        }
+    });
+}
+BENCHMARK(tracing_child_span_ctr);
+
+void tracing_no_log_span_ctr(benchmark::State& state) {
+    auto logger = logging::MakeNullLogger();
+    engine::RunStandalone([&] {
+        tracing::NoLogSpans no_logs;
+        no_logs.names = {"no_log"};
+        tracing::Tracer::SetNoLogSpans(std::move(no_logs));
+
+        auto tracer = tracing::MakeTracer("test_service", logger);
+        for ([[maybe_unused]] auto _ : state) {
+            auto span = tracer->CreateSpanWithoutParent("no_log");
+            span.AddNonInheritableTag(tracing::kDatabaseType, tracing::kDatabasePostgresType);
+            span.AddNonInheritableTag(tracing::kDatabaseStatementName, "select_something");
+            benchmark::DoNotOptimize(span);
+        }
+
+        tracing::Tracer::SetNoLogSpans(tracing::NoLogSpans{});
+    });
+}
+BENCHMARK(tracing_no_log_span_ctr);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,121 @@
+#include <userver/utils/adaptive_hedging.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::hedging {
+
+namespace {
+
+constexpr std::chrono::steady_clock::duration kUpdatePeriod = std::chrono::seconds{1};
+
+}  // namespace
+
+AdaptiveHedgingSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<AdaptiveHedgingSettings>) {
+    AdaptiveHedgingSettings result;
+    result.percentile = value["percentile"].As<double>(result.percentile);
+    result.default_delay = value["default-delay"].As<std::chrono::milliseconds>(result.default_delay);
+    result.min_delay = value["min-delay"].As<std::chrono::milliseconds>(result.min_delay);
+    result.max_delay = value["max-delay"].As<std::chrono::milliseconds>(result.max_delay);
+    result.min_samples = value["min-samples"].As<std::size_t>(result.min_samples);
+    result.budget.max_tokens = value["budget-max-tokens"].As<float>(result.budget.max_tokens);
+    result.budget.token_ratio = value["budget-token-ratio"].As<float>(result.budget.token_ratio);
+    result.budget.enabled = value["budget-enabled"].As<bool>(result.budget.enabled);
+
+    if (result.percentile <= 0 || result.percentile > 100 || result.min_delay > result.max_delay) {
+        throw std::runtime_error(fmt::format(
+            "Invalid adaptive hedging settings in '{}': 0 < percentile <= 100 and min-delay <= max-delay are "
+            "expected",
+            value.GetPath()
+        ));
+    }
+    if (result.budget.max_tokens <= 0 || result.budget.token_ratio <= 0) {
+        throw std::runtime_error(fmt::format(
+            "Invalid hedges budget in '{}': positive budget-max-tokens and budget-token-ratio are expected",
+            value.GetPath()
+        ));
+    }
+    return result;
+}
+
+AdaptiveHedging::AdaptiveHedging(const AdaptiveHedgingSettings& settings)
+    : settings_(settings),
+      budget_(settings.budget),
+      hedging_delay_(std::clamp(settings.default_delay, settings.min_delay, settings.max_delay)) {}
+
+void AdaptiveHedging::AccountReply(std::chrono::milliseconds latency) noexcept {
+    latencies_.GetCurrentCounter().Account(std::max<std::int64_t>(latency.count(), 0));
+    budget_.AccountOk();
+}
+
+bool AdaptiveHedging::TryStartHedge() noexcept {
+    if (!budget_.CanRetry()) {
+        ++hedges_throttled_;
+        return false;
+    }
+    budget_.AccountFail();
+    ++hedges_;
+    return true;
+}
+
+std::chrono::milliseconds AdaptiveHedging::GetHedgingDelay() const noexcept {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    auto next_update = next_update_.load(std::memory_order_relaxed);
+    // Only one of the concurrent callers recomputes the percentile
+    if (now >= next_update &&
+        next_update_.compare_exchange_strong(next_update, now + kUpdatePeriod.count(), std::memory_order_relaxed)) {
+        UpdateHedgingDelay();
+    }
+    return hedging_delay_.load(std::memory_order_relaxed);
+}
+
+HedgingSettings AdaptiveHedging::MakeSettings(HedgingSettings settings) const noexcept {
+    settings.hedging_delay = GetHedgingDelay();
+    return settings;
+}
+
+void AdaptiveHedging::UpdateHedgingDelay() const noexcept {
+    const auto latencies = latencies_.GetStatsForPeriod(Latencies::Duration::min(), true);
+
+    auto delay = settings_.default_delay;
+    if (latencies.Count() >= settings_.min_samples) {
+        delay = std::chrono::milliseconds{latencies.GetPercentile(settings_.percentile)};
+    }
+    hedging_delay_.store(std::clamp(delay, settings_.min_delay, settings_.max_delay), std::memory_order_relaxed);
+}
+
+void DumpMetric(statistics::Writer& writer, const AdaptiveHedging& hedging) {
+    writer["delay-ms"] = hedging.hedging_delay_.load(std::memory_order_relaxed).count();
+    writer["hedges"] = hedging.hedges_.load(std::memory_order_relaxed);
+    writer["hedges-throttled"] = hedging.hedges_throttled_.load(std::memory_order_relaxed);
+    writer["budget"] = hedging.budget_;
+}
+
+AdaptiveHedgingSet::AdaptiveHedgingSet(const AdaptiveHedgingSettings& settings) : settings_(settings) {}
+
+AdaptiveHedgingSet::~AdaptiveHedgingSet() = default;
+
+AdaptiveHedging& AdaptiveHedgingSet::GetHedging(std::string_view destination) {
+    const std::lock_guard lock{mutex_};
+    auto& hedging = trackers_[std::string{destination}];
+    if (!hedging) hedging = std::make_unique<AdaptiveHedging>(settings_);
+    return *hedging;
+}
+
+void DumpMetric(statistics::Writer& writer, const AdaptiveHedgingSet& set) {
+    const std::lock_guard lock{set.mutex_};
+    for (const auto& [destination, hedging] : set.trackers_) {
+        writer.ValueWithLabels(*hedging, {"destination", destination});
+    }
+}
+
+}  // namespace utils::hedging
+
+USERVER_NAMESPACE_END
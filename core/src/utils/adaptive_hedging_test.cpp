@@ -0,0 +1,168 @@
+#include <userver/utils/adaptive_hedging.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+utils::hedging::AdaptiveHedgingSettings MakeSettings() {
+    utils::hedging::AdaptiveHedgingSettings settings;
+    settings.default_delay = 20ms;
+    settings.min_delay = 5ms;
+    settings.max_delay = 200ms;
+    settings.min_samples = 10;
+    return settings;
+}
+
+}  // namespace
+
+TEST(AdaptiveHedging, DefaultDelay) {
+    utils::hedging::AdaptiveHedging hedging{MakeSettings()};
+    EXPECT_EQ(hedging.GetHedgingDelay(), 20ms);
+
+    // Too few samples to trust the percentile
+    for (int i = 0; i < 5; ++i) hedging.AccountReply(100ms);
+    EXPECT_EQ(hedging.MakeSettings({}).hedging_delay, 20ms);
+}
+
+TEST(AdaptiveHedging, PercentileDelay) {
+    utils::hedging::AdaptiveHedging hedging{MakeSettings()};
+    EXPECT_EQ(hedging.GetHedgingDelay(), 20ms);
+
+    for (int i = 0; i < 96; ++i) hedging.AccountReply(10ms);
+    for (int i = 0; i < 4; ++i) hedging.AccountReply(150ms);
+
+    // The delay is recomputed once a second
+    EXPECT_EQ(hedging.GetHedgingDelay(), 20ms);
+    std::this_thread::sleep_for(1100ms);
+    EXPECT_EQ(hedging.GetHedgingDelay(), 10ms);
+}
+
+TEST(AdaptiveHedging, DelayIsClamped) {
+    utils::hedging::AdaptiveHedging hedging{MakeSettings()};
+    for (int i = 0; i < 100; ++i) hedging.AccountReply(1000ms);
+    std::this_thread::sleep_for(1100ms);
+    EXPECT_EQ(hedging.GetHedgingDelay(), 200ms);
+}
+
+TEST(AdaptiveHedging, Budget) {
+    auto settings = MakeSettings();
+    settings.budget.max_tokens = 10;
+    settings.budget.token_ratio = 0.5;
+    utils::hedging::AdaptiveHedging hedging{settings};
+
+    // A half of the tokens may be spent
+    for (int i = 0; i < 5; ++i) EXPECT_TRUE(hedging.TryStartHedge()) << i;
+    EXPECT_FALSE(hedging.TryStartHedge());
+
+    // Two replies return a token
+    hedging.AccountReply(10ms);
+    hedging.AccountReply(10ms);
+    EXPECT_TRUE(hedging.TryStartHedge());
+    EXPECT_FALSE(hedging.TryStartHedge());
+}
+
+TEST(AdaptiveHedging, Set) {
+    utils::hedging::AdaptiveHedgingSet set{MakeSettings()};
+    auto& first = set.GetHedging("first");
+    EXPECT_EQ(&first, &set.GetHedging("first"));
+    EXPECT_NE(&first, &set.GetHedging("second"));
+}
+
+TEST(AdaptiveHedging, ParseSettings) {
+    const auto parse = [](const std::string& yaml) {
+        return yaml_config::YamlConfig(formats::yaml::FromString(yaml), {})
+            .As<utils::hedging::AdaptiveHedgingSettings>();
+    };
+
+    const auto settings = parse(R"(
+percentile: 99
+max-delay: 50ms
+budget-token-ratio: 0.2
+)");
+    EXPECT_EQ(settings.percentile, 99);
+    EXPECT_EQ(settings.max_delay, 50ms);
+    EXPECT_EQ(settings.min_delay, 1ms);
+    EXPECT_FLOAT_EQ(settings.budget.token_ratio, 0.2);
+
+    EXPECT_ANY_THROW(parse("percentile: 0"));
+    EXPECT_ANY_THROW(parse("min-delay: 10ms\nmax-delay: 5ms"));
+}
+
+UTEST(AdaptiveHedging, HedgeRequest) {
+    utils::hedging::AdaptiveHedging hedging{MakeSettings()};
+    std::atomic<int> attempts{0};
+
+    // The first attempt hangs, the hedge is sent after the default delay
+    const auto reply = utils::hedging::HedgeRequestAdaptive(
+        [&attempts] {
+            const auto delay = attempts++ == 0 ? 10s : 1ms;
+            return utils::Async("test", [delay] {
+                engine::InterruptibleSleepFor(delay);
+                return std::string{"reply"};
+            });
+        },
+        hedging,
+        {}
+    );
+    EXPECT_EQ(reply, "reply");
+    EXPECT_EQ(attempts.load(), 2);
+}
+
+UTEST(AdaptiveHedging, HedgeRequestRetriesFailures) {
+    utils::hedging::AdaptiveHedging hedging{MakeSettings()};
+    std::atomic<int> attempts{0};
+
+    const auto reply = utils::hedging::HedgeRequestAdaptive(
+        [&attempts] {
+            const bool fail = attempts++ == 0;
+            return utils::Async("test", [fail] {
+                if (fail) throw std::runtime_error("failure");
+                return 42;
+            });
+        },
+        hedging,
+        {}
+    );
+    EXPECT_EQ(reply, 42);
+    EXPECT_EQ(attempts.load(), 2);
+}
+
+UTEST(AdaptiveHedging, HedgeRequestWithoutBudget) {
+    auto settings = MakeSettings();
+    settings.budget.max_tokens = 2;
+    utils::hedging::AdaptiveHedging hedging{settings};
+    ASSERT_TRUE(hedging.TryStartHedge());
+    ASSERT_FALSE(hedging.TryStartHedge());
+
+    std::atomic<int> attempts{0};
+    const auto reply = utils::hedging::HedgeRequestAdaptive(
+        [&attempts] {
+            ++attempts;
+            return utils::Async("test", [] {
+                engine::InterruptibleSleepFor(50ms);
+                return 1;
+            });
+        },
+        hedging,
+        {}
+    );
+    EXPECT_EQ(reply, 1);
+    EXPECT_EQ(attempts.load(), 1);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,256 @@
+#include <utils/cpu_profiler.hpp>
+
+#include <sys/time.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+#include <fmt/format.h>
+#include <boost/stacktrace/frame.hpp>
+#include <boost/stacktrace/safe_dump_to.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/logging/stacktrace_cache.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::cpu_profiler {
+
+namespace {
+
+using FramePtr = boost::stacktrace::frame::native_frame_ptr_t;
+
+constexpr std::size_t kMaxDepth = 64;
+constexpr std::size_t kMaxNameLength = 48;
+
+// The signal handler and the signal trampoline
+constexpr std::size_t kSkipFrames = 2;
+
+constexpr int kInactive = -1;
+
+struct Name final {
+    std::array<char, kMaxNameLength> data;
+    std::size_t size;
+};
+
+struct Sample final {
+    // +1 for the terminating zero frame
+    std::array<FramePtr, kMaxDepth + 1> frames;
+    std::size_t depth;
+    Name task_processor;
+    Name span;
+};
+
+struct SampleBuffer final {
+    std::unique_ptr<Sample[]> samples;
+    std::atomic<std::size_t> size{0};
+    // Signal handlers that may still write into the buffer
+    std::atomic<std::size_t> writers{0};
+};
+
+// All the members are constant-initialized, so the signal handler never sees
+// the state before its construction
+struct State final {
+    // Index of the buffer the signal handlers write into, or kInactive
+    std::atomic<int> active{kInactive};
+    std::array<SampleBuffer, 2> buffers;
+    std::size_t capacity{0};
+    std::atomic<std::size_t> dropped{0};
+
+    std::mutex mutex;
+    bool handler_installed{false};
+    std::unordered_map<std::string, std::uint64_t> folded_stacks;
+};
+
+State state;
+
+void CopyName(std::string_view from, Name& to) noexcept {
+    to.size = std::min(from.size(), to.data.size());
+    std::memcpy(to.data.data(), from.data(), to.size);
+}
+
+std::string_view ToStringView(const Name& name, std::string_view placeholder) noexcept {
+    return name.size == 0 ? placeholder : std::string_view{name.data.data(), name.size};
+}
+
+// Only reads the state of the interrupted thread and does not allocate
+void RecordSample(Sample& sample) noexcept {
+    const auto count = boost::stacktrace::safe_dump_to(kSkipFrames, sample.frames.data(), sizeof(sample.frames));
+    sample.depth = count == 0 ? 0 : count - 1;
+
+    sample.task_processor.size = 0;
+    sample.span.size = 0;
+    auto* context = engine::current_task::GetCurrentTaskContextUnchecked();
+    if (!context) return;
+
+    CopyName(context->GetTaskProcessor().Name(), sample.task_processor);
+    if (const auto* span = tracing::Span::CurrentSpanUnchecked()) {
+        CopyName(span->GetName(), sample.span);
+    }
+}
+
+void OnProfilingSignal(int /*signum*/) noexcept {
+    const auto saved_errno = errno;
+
+    const auto index = state.active.load();
+    if (index != kInactive) {
+        auto& buffer = state.buffers[index];
+        buffer.writers.fetch_add(1);
+        // Pairs with the switch of the active buffer in DrainBuffer()
+        if (state.active.load() == index) {
+            const auto slot = buffer.size.fetch_add(1);
+            if (slot < state.capacity) {
+                RecordSample(buffer.samples[slot]);
+            } else {
+                state.dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        buffer.writers.fetch_sub(1);
+    }
+
+    errno = saved_errno;
+}
+
+void SetTimer(std::size_t frequency) {
+    itimerval timer{};
+    if (frequency != 0) {
+        const auto interval_us = std::max<long>(1'000'000 / static_cast<long>(frequency), 1);
+        timer.it_interval.tv_sec = interval_us / 1'000'000;
+        timer.it_interval.tv_usec = interval_us % 1'000'000;
+        timer.it_value = timer.it_interval;
+    }
+    utils::CheckSyscall(::setitimer(ITIMER_PROF, &timer, nullptr), "setting ITIMER_PROF");
+}
+
+void WaitForWriters(const SampleBuffer& buffer) noexcept {
+    while (buffer.writers.load() != 0) std::this_thread::yield();
+}
+
+std::string MakeFoldedStack(const Sample& sample) {
+    std::string result{ToStringView(sample.task_processor, "[no task processor]")};
+    result += ';';
+    result += ToStringView(sample.span, "[no span]");
+
+    // The frames are stored leaf first, the coroutine startup frames are
+    // replaced with an empty name and are of no interest
+    std::size_t depth = 0;
+    std::array<std::string, kMaxDepth> names;
+    for (; depth < sample.depth; ++depth) {
+        names[depth] = logging::stacktrace_cache::frame_name(boost::stacktrace::frame{sample.frames[depth]});
+        if (names[depth].empty()) break;
+    }
+    for (std::size_t i = depth; i > 0; --i) {
+        result += ';';
+        result += names[i - 1];
+    }
+    return result;
+}
+
+// Must be called with state.mutex locked
+void DrainBuffer(int index) {
+    auto& buffer = state.buffers[index];
+    WaitForWriters(buffer);
+
+    const auto size = std::min(buffer.size.load(), state.capacity);
+    for (std::size_t i = 0; i < size; ++i) {
+        ++state.folded_stacks[MakeFoldedStack(buffer.samples[i])];
+    }
+    buffer.size = 0;
+
+    const auto dropped = state.dropped.exchange(0);
+    if (dropped != 0) {
+        LOG_WARNING() << "CPU profiler dropped " << dropped
+                      << " samples, increase the maximum number of samples or decrease the frequency";
+    }
+}
+
+}  // namespace
+
+bool Start(const Settings& settings) {
+    UINVARIANT(settings.frequency != 0, "CPU profiler frequency should be positive");
+    UINVARIANT(settings.max_samples != 0, "CPU profiler should buffer at least one sample");
+
+    const std::lock_guard lock{state.mutex};
+    if (state.active.load() != kInactive) return false;
+
+    if (!state.handler_installed) {
+        // Warm up the unwinder, it may allocate on the first use
+        std::array<FramePtr, kMaxDepth + 1> frames{};
+        boost::stacktrace::safe_dump_to(0, frames.data(), sizeof(frames));
+
+        struct sigaction action {};
+        action.sa_handler = &OnProfilingSignal;
+        action.sa_flags = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        utils::CheckSyscall(::sigaction(SIGPROF, &action, nullptr), "setting SIGPROF handler");
+        // The handler is never removed: the default action for a late SIGPROF
+        // is to terminate the process
+        state.handler_installed = true;
+    }
+
+    state.folded_stacks.clear();
+    state.capacity = settings.max_samples;
+    for (auto& buffer : state.buffers) {
+        buffer.samples = std::make_unique<Sample[]>(settings.max_samples);
+        buffer.size = 0;
+    }
+    state.dropped = 0;
+    state.active = 0;
+
+    SetTimer(settings.frequency);
+    return true;
+}
+
+void Stop() {
+    const std::lock_guard lock{state.mutex};
+    const auto index = state.active.exchange(kInactive);
+    if (index == kInactive) return;
+
+    SetTimer(0);
+    WaitForWriters(state.buffers[1 - index]);
+    DrainBuffer(index);
+
+    for (auto& buffer : state.buffers) {
+        buffer.samples.reset();
+    }
+}
+
+bool IsRunning() noexcept { return state.active.load() != kInactive; }
+
+void Collect() {
+    const std::lock_guard lock{state.mutex};
+    const auto index = state.active.load();
+    if (index == kInactive) return;
+
+    state.active = 1 - index;
+    DrainBuffer(index);
+}
+
+std::string GetFoldedStacks() {
+    Collect();
+
+    const std::lock_guard lock{state.mutex};
+    std::string result;
+    for (const auto& [stack, count] : state.folded_stacks) {
+        fmt::format_to(std::back_inserter(result), "{} {}\n", stack, count);
+    }
+    return result;
+}
+
+}  // namespace utils::cpu_profiler
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+USERVER_NAMESPACE_BEGIN
+
+// Process-wide sampling CPU profiler. SIGPROF is delivered to the threads that
+// consume CPU, the signal handler records the stack of the interrupted thread
+// along with the names of the current task processor and span.
+namespace utils::cpu_profiler {
+
+struct Settings final {
+    // Samples per second of CPU time consumed by the process
+    std::size_t frequency{100};
+    // Samples that are buffered between the Collect() calls, the rest are
+    // dropped
+    std::size_t max_samples{5000};
+};
+
+// Resets the collected profile and starts sampling,
+// returns false if the profiler is already running
+bool Start(const Settings& settings);
+
+// Stops sampling, the collected profile is kept
+void Stop();
+
+bool IsRunning() noexcept;
+
+// Symbolizes and aggregates the samples recorded since the previous call
+void Collect();
+
+// Returns the profile collected since Start() in the folded stacks format:
+// `task_processor;span;root_function;...;leaf_function count` per line
+std::string GetFoldedStacks();
+
+}  // namespace utils::cpu_profiler
+
+USERVER_NAMESPACE_END
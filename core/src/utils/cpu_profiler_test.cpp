@@ -0,0 +1,49 @@
+#include <utils/cpu_profiler.hpp>
+
+#include <chrono>
+
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+[[gnu::noinline]] std::uint64_t BurnCpu(std::chrono::milliseconds duration) {
+    std::uint64_t result = 0;
+    const auto deadline = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < deadline) {
+        for (std::uint64_t i = 0; i < 1000; ++i) result = result * 31 + i;
+    }
+    return result;
+}
+
+}  // namespace
+
+UTEST(CpuProfiler, FoldedStacks) {
+    EXPECT_TRUE(utils::cpu_profiler::Start({1000, 5000}));
+    EXPECT_TRUE(utils::cpu_profiler::IsRunning());
+    EXPECT_FALSE(utils::cpu_profiler::Start({1000, 5000}));
+
+    {
+        const tracing::Span span{"cpu_profiler_test_span"};
+        EXPECT_NE(BurnCpu(std::chrono::milliseconds{300}), 42);
+    }
+
+    utils::cpu_profiler::Stop();
+    EXPECT_FALSE(utils::cpu_profiler::IsRunning());
+
+    const auto folded = utils::cpu_profiler::GetFoldedStacks();
+    EXPECT_NE(folded.find(";cpu_profiler_test_span;"), std::string::npos) << folded;
+
+    // The profile is kept after the stop
+    EXPECT_EQ(utils::cpu_profiler::GetFoldedStacks(), folded);
+}
+
+UTEST(CpuProfiler, StopWithoutStart) {
+    utils::cpu_profiler::Stop();
+    utils::cpu_profiler::Collect();
+    EXPECT_FALSE(utils::cpu_profiler::IsRunning());
+}
+
+USERVER_NAMESPACE_END
@@ -6,7 +6,21 @@
 #include <cerrno>
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
 #include <userver/engine/subprocess/environment_variables.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/utils/thread_name.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -36,11 +50,121 @@ std::error_code MallCtl(const char* name) {
     return MakeErrorCode(rc);
 }
 
+template <typename T>
+std::error_code MallCtlRead(const char* name, T& value) {
+    std::size_t size = sizeof(value);
+    int rc = mallctl(name, &value, &size, nullptr, 0);
+    return MakeErrorCode(rc);
+}
+
 void MallocStatPrintCb(void* data, const char* msg) {
     auto* s = static_cast<std::string*>(data);
     *s += msg;
 }
 
+// The statistics are cached by jemalloc until the epoch is advanced
+std::error_code RefreshStats() {
+    std::uint64_t epoch = 1;
+    std::size_t size = sizeof(epoch);
+    int rc = mallctl("epoch", &epoch, &size, &epoch, size);
+    return MakeErrorCode(rc);
+}
+
+struct ArenasRegistry final {
+    std::mutex mutex;
+    std::vector<std::pair<unsigned, std::string>> arenas{{0, "default"}};
+};
+
+ArenasRegistry& GetArenasRegistry() {
+    static ArenasRegistry registry;
+    return registry;
+}
+
+/* The span heap profile is gathered by the jemalloc sampling hooks, which are
+ * called from within malloc and free. So no allocations and no locks here,
+ * only the fixed-size tables below.
+ */
+constexpr std::size_t kMaxSpanNames = 1024;
+constexpr std::size_t kMaxSpanNameLength = 63;
+constexpr std::size_t kMaxSampledAllocations = 1 << 16;
+constexpr std::size_t kMaxProbes = 64;
+
+// The allocations outside of the spans and of the spans that did not fit
+constexpr std::size_t kOtherSlot = kMaxSpanNames;
+
+struct SpanSlot final {
+    // 0 for an empty slot
+    std::atomic<std::size_t> name_hash{0};
+    std::atomic<bool> has_name{false};
+    char name[kMaxSpanNameLength + 1]{};
+    std::atomic<std::int64_t> bytes{0};
+    std::atomic<std::int64_t> count{0};
+};
+
+struct SampledAllocation final {
+    std::atomic<const void*> ptr{nullptr};
+    std::atomic<std::size_t> slot{0};
+};
+
+SpanSlot span_slots[kMaxSpanNames + 1];
+SampledAllocation sampled_allocations[kMaxSampledAllocations];
+
+std::size_t GetSpanSlot() noexcept {
+    const auto* const span = tracing::Span::CurrentSpanUnchecked();
+    if (!span) return kOtherSlot;
+
+    const std::string_view name = span->GetName();
+    const auto name_hash = std::hash<std::string_view>{}(name) | 1;
+    for (std::size_t i = 0; i < kMaxProbes; ++i) {
+        auto& slot = span_slots[(name_hash + i) % kMaxSpanNames];
+        auto slot_hash = slot.name_hash.load(std::memory_order_acquire);
+        if (slot_hash == 0 && slot.name_hash.compare_exchange_strong(slot_hash, name_hash)) {
+            const auto length = std::min(name.size(), kMaxSpanNameLength);
+            std::memcpy(slot.name, name.data(), length);
+            slot.has_name.store(true, std::memory_order_release);
+            return &slot - span_slots;
+        }
+        if (slot_hash == name_hash) return &slot - span_slots;
+    }
+    return kOtherSlot;
+}
+
+std::size_t GetAllocationIndex(const void* ptr, std::size_t probe) noexcept {
+    return (std::hash<const void*>{}(ptr) + probe) % kMaxSampledAllocations;
+}
+
+void OnSampledAlloc(const void* ptr, std::size_t size, void**, unsigned) noexcept {
+    const auto slot = GetSpanSlot();
+    for (std::size_t i = 0; i < kMaxProbes; ++i) {
+        auto& allocation = sampled_allocations[GetAllocationIndex(ptr, i)];
+        const void* expected = nullptr;
+        if (allocation.ptr.compare_exchange_strong(expected, ptr)) {
+            allocation.slot.store(slot, std::memory_order_relaxed);
+            span_slots[slot].bytes.fetch_add(size, std::memory_order_relaxed);
+            span_slots[slot].count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    // The table is full, the allocation is not accounted
+}
+
+void OnSampledFree(const void* ptr, std::size_t size) noexcept {
+    for (std::size_t i = 0; i < kMaxProbes; ++i) {
+        auto& allocation = sampled_allocations[GetAllocationIndex(ptr, i)];
+        if (allocation.ptr.load(std::memory_order_relaxed) != ptr) continue;
+
+        const auto slot = allocation.slot.load(std::memory_order_relaxed);
+        allocation.ptr.store(nullptr, std::memory_order_relaxed);
+        span_slots[slot].bytes.fetch_sub(size, std::memory_order_relaxed);
+        span_slots[slot].count.fetch_sub(1, std::memory_order_relaxed);
+        return;
+    }
+}
+
+// jemalloc's prof_sample_hook_t and prof_sample_free_hook_t
+using ProfSampleHook = void (*)(const void*, std::size_t, void**, unsigned);
+using ProfSampleFreeHook = void (*)(const void*, std::size_t);
+
 }  // namespace
 
 bool IsProfilingEnabledViaEnv() {
@@ -72,6 +196,114 @@ std::error_code EnableBgThreads() {
 
 std::error_code StopBgThreads() { return MallCtl<bool>("background_thread", false); }
 
+std::error_code CreateArena(std::string_view name, unsigned& arena) {
+    if (auto ec = MallCtlRead("arenas.create", arena)) return ec;
+
+    auto& registry = GetArenasRegistry();
+    const std::lock_guard lock{registry.mutex};
+    registry.arenas.emplace_back(arena, std::string{name});
+    return {};
+}
+
+std::error_code BindCurrentThreadToArena(unsigned arena) { return MallCtl<unsigned>("thread.arena", arena); }
+
+std::error_code GetArenaStats(unsigned arena, ArenaStats& stats) {
+    if (auto ec = RefreshStats()) return ec;
+
+    std::size_t page_size = 0;
+    std::size_t small_allocated = 0;
+    std::size_t large_allocated = 0;
+    std::size_t active_pages = 0;
+    ArenaStats result;
+
+    const auto prefix = fmt::format("stats.arenas.{}.", arena);
+    const auto read = [&prefix](std::string_view name, std::size_t& value) {
+        return MallCtlRead(fmt::format("{}{}", prefix, name).c_str(), value);
+    };
+    if (auto ec = MallCtlRead("arenas.page", page_size)) return ec;
+    for (auto [name, value] : {
+             std::pair{"small.allocated", &small_allocated},
+             std::pair{"large.allocated", &large_allocated},
+             std::pair{"pactive", &active_pages},
+             std::pair{"resident", &result.resident},
+             std::pair{"mapped", &result.mapped},
+         }) {
+        if (auto ec = read(name, *value)) return ec;
+    }
+
+    result.allocated = small_allocated + large_allocated;
+    result.active = active_pages * page_size;
+    stats = result;
+    return {};
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const ArenaStats& stats) {
+    writer["allocated"] = stats.allocated;
+    writer["active"] = stats.active;
+    writer["resident"] = stats.resident;
+    writer["mapped"] = stats.mapped;
+}
+
+std::string ArenasStats() {
+    std::vector<std::pair<unsigned, std::string>> arenas;
+    {
+        auto& registry = GetArenasRegistry();
+        const std::lock_guard lock{registry.mutex};
+        arenas = registry.arenas;
+    }
+
+    std::string result;
+    for (const auto& [arena, name] : arenas) {
+        ArenaStats stats;
+        if (const auto ec = GetArenaStats(arena, stats)) {
+            result += fmt::format("arena {} ({}): error: {}\n", arena, name, ec.message());
+            continue;
+        }
+        result += fmt::format(
+            "arena {} ({}): allocated={} active={} resident={} mapped={}\n",
+            arena,
+            name,
+            stats.allocated,
+            stats.active,
+            stats.resident,
+            stats.mapped
+        );
+    }
+    return result;
+}
+
+std::error_code EnableSpanHeapProfile() {
+    if (auto ec = MallCtl<ProfSampleHook>("experimental.hooks.prof_sample", &OnSampledAlloc)) return ec;
+    return MallCtl<ProfSampleFreeHook>("experimental.hooks.prof_sample_free", &OnSampledFree);
+}
+
+std::string SpanHeapProfile() {
+    std::vector<std::tuple<std::int64_t, std::int64_t, std::string_view>> spans;
+    for (const auto& slot : span_slots) {
+        const auto bytes = slot.bytes.load(std::memory_order_relaxed);
+        const auto count = slot.count.load(std::memory_order_relaxed);
+        if (count <= 0) continue;
+
+        const auto is_other = &slot == &span_slots[kOtherSlot];
+        if (!is_other && !slot.has_name.load(std::memory_order_acquire)) continue;
+        spans.emplace_back(bytes, count, is_other ? std::string_view{"(no span)"} : std::string_view{slot.name});
+    }
+    std::sort(spans.begin(), spans.end(), std::greater<>{});
+
+    std::size_t lg_sample = 0;
+    MallCtlRead("opt.lg_prof_sample", lg_sample);
+
+    std::string result = fmt::format(
+        "Live sampled allocations by span, one sample per {} allocated bytes on average\n"
+        "bytes\tcount\tspan\n",
+        std::size_t{1} << lg_sample
+    );
+    for (const auto& [bytes, count, name] : spans) {
+        result += fmt::format("{}\t{}\t{}\n", bytes, count, name);
+    }
+    return result;
+}
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
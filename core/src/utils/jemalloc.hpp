@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <system_error>
 
+#include <userver/utils/statistics/fwd.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::jemalloc {
@@ -24,6 +28,33 @@ std::error_code EnableBgThreads();
 // blocking
 std::error_code StopBgThreads();
 
+// Creates a new arena and remembers its name for ArenasStats()
+std::error_code CreateArena(std::string_view name, unsigned& arena);
+
+// The allocations of the current thread go to the arena from now on
+std::error_code BindCurrentThreadToArena(unsigned arena);
+
+struct ArenaStats final {
+    std::size_t allocated{0};
+    std::size_t active{0};
+    std::size_t resident{0};
+    std::size_t mapped{0};
+};
+
+std::error_code GetArenaStats(unsigned arena, ArenaStats& stats);
+
+void DumpMetric(utils::statistics::Writer& writer, const ArenaStats& stats);
+
+// Stats of the default arena and of the ones created by CreateArena()
+std::string ArenasStats();
+
+// Makes the sampled allocations of ProfActivate() be attributed to the
+// current tracing::Span names. Requires jemalloc 5.3+.
+std::error_code EnableSpanHeapProfile();
+
+// Live sampled bytes by the span names, since EnableSpanHeapProfile()
+std::string SpanHeapProfile();
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <utils/statistics/http_codes.hpp>
 
+#include <memory>
+
 #include <fmt/format.h>
 
 #include <userver/formats/json/value_builder.hpp>
@@ -17,21 +19,39 @@ bool IsForcedStatusCode(HttpCodes::Code status) noexcept {
     return status == 200 || status == 400 || status == 401 || status == 500;
 }
 
+StripedRateCounter& GetOrCreateCounter(std::atomic<StripedRateCounter*>& slot) {
+    auto* counter = slot.load(std::memory_order_acquire);
+    if (counter) return *counter;
+
+    auto new_counter = std::make_unique<StripedRateCounter>();
+    if (slot.compare_exchange_strong(counter, new_counter.get(), std::memory_order_acq_rel)) {
+        return *new_counter.release();
+    }
+    return *counter;
+}
+
 }  // namespace
 
 HttpCodes::HttpCodes() = default;
 
+HttpCodes::~HttpCodes() {
+    for (auto& slot : codes_) {
+        delete slot.load(std::memory_order_acquire);
+    }
+}
+
 void HttpCodes::Account(Code code) noexcept {
     if (code < kMinHttpStatus || code >= kMaxHttpStatus) {
         LOG_ERROR() << "Invalid HTTP code encountered: " << code << ", skipping statistics accounting";
         return;
     }
-    ++codes_[code - kMinHttpStatus];
+    ++GetOrCreateCounter(codes_[code - kMinHttpStatus]);
 }
 
 HttpCodes::Snapshot::Snapshot(const HttpCodes& other) noexcept {
     for (std::size_t i = 0; i < codes_.size(); ++i) {
-        codes_[i] = other.codes_[i].Load();
+        const auto* const counter = other.codes_[i].load(std::memory_order_acquire);
+        codes_[i] = counter ? counter->Load() : Rate{};
     }
 }
 
@@ -1,13 +1,14 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <unordered_map>
 
 #include <userver/utils/statistics/fwd.hpp>
 #include <userver/utils/statistics/rate.hpp>
-#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/striped_rate_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -24,11 +25,15 @@ public:
     HttpCodes();
     HttpCodes(const HttpCodes&) = delete;
     HttpCodes& operator=(const HttpCodes&) = delete;
+    ~HttpCodes();
 
     void Account(Code code) noexcept;
 
 private:
-    std::array<RateCounter, kMaxHttpStatus - kMinHttpStatus> codes_{};
+    // All the requests bump the same few codes, so the counters are striped.
+    // They are created on the first use of a code to spend memory only on the
+    // codes that are actually seen.
+    std::array<std::atomic<StripedRateCounter*>, kMaxHttpStatus - kMinHttpStatus> codes_{};
 };
 
 class HttpCodes::Snapshot final {
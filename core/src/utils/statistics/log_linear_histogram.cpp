@@ -0,0 +1,88 @@
+#include <userver/utils/statistics/log_linear_histogram.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/impl/histogram_bucket.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <utils/statistics/impl/histogram_view_utils.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace {
+
+std::vector<double> MakeBounds(double lowest_bound, std::size_t powers_of_two, std::size_t sub_buckets) {
+    std::vector<double> bounds;
+    bounds.reserve(1 + powers_of_two * sub_buckets);
+    bounds.push_back(lowest_bound);
+    for (std::size_t k = 0; k < powers_of_two; ++k) {
+        const auto power = std::ldexp(lowest_bound, static_cast<int>(k));
+        for (std::size_t j = 1; j <= sub_buckets; ++j) {
+            bounds.push_back(power + power * static_cast<double>(j) / static_cast<double>(sub_buckets));
+        }
+    }
+    return bounds;
+}
+
+}  // namespace
+
+LogLinearHistogram::LogLinearHistogram(double lowest_bound, std::size_t powers_of_two, std::size_t sub_buckets)
+    : lowest_bound_(lowest_bound),
+      powers_of_two_(powers_of_two),
+      sub_buckets_(sub_buckets),
+      bucket_count_(1 + powers_of_two * sub_buckets),
+      buckets_(std::make_unique<impl::histogram::Bucket[]>(bucket_count_ + 1)) {
+    UINVARIANT(sub_buckets != 0, "LogLinearHistogram needs at least one sub-bucket");
+    UINVARIANT(powers_of_two < 1000, "Too many powers of two for LogLinearHistogram");
+    impl::histogram::CopyBounds(buckets_.get(), MakeBounds(lowest_bound, powers_of_two, sub_buckets));
+}
+
+LogLinearHistogram::LogLinearHistogram(LogLinearHistogram&&) noexcept = default;
+
+LogLinearHistogram& LogLinearHistogram::operator=(LogLinearHistogram&&) noexcept = default;
+
+LogLinearHistogram::~LogLinearHistogram() = default;
+
+std::size_t LogLinearHistogram::FindBucketIndex(double value) const noexcept {
+    // Also catches NaN
+    if (!(value > lowest_bound_)) return 0;
+    if (std::isinf(value)) return bucket_count_;
+
+    // value / lowest_bound_ == mantissa * 2^exponent, mantissa is in [0.5, 1)
+    int exponent = 0;
+    const auto mantissa = std::frexp(value / lowest_bound_, &exponent);
+    const auto power = static_cast<std::size_t>(exponent - 1);
+    // Values on the bucket borders fall into the lower bucket
+    auto index = bucket_count_;
+    if (power < powers_of_two_) {
+        const auto sub_bucket =
+            static_cast<std::size_t>(std::ceil((mantissa * 2 - 1) * static_cast<double>(sub_buckets_)));
+        index = power * sub_buckets_ + sub_bucket;
+    }
+
+    // Fix up the rounding errors of the bounds, the 0th bucket is not a bound
+    const auto bound = [this](std::size_t i) { return buckets_[i + 1].upper_bound.bound; };
+    while (index < bucket_count_ && value > bound(index)) ++index;
+    while (index > 0 && value <= bound(index - 1)) --index;
+    return index;
+}
+
+void LogLinearHistogram::Account(double value, std::uint64_t count) noexcept {
+    const auto index = FindBucketIndex(value);
+    // 0th bucket is the "infinity" bucket
+    auto& bucket = buckets_[index == bucket_count_ ? 0 : index + 1];
+    bucket.counter.fetch_add(count, std::memory_order_relaxed);
+}
+
+void ResetMetric(LogLinearHistogram& histogram) noexcept { impl::histogram::ResetMetric(histogram.buckets_.get()); }
+
+HistogramView LogLinearHistogram::GetView() const& noexcept { return impl::histogram::MakeView(buckets_.get()); }
+
+void DumpMetric(Writer& writer, const LogLinearHistogram& histogram) { writer = histogram.GetView(); }
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
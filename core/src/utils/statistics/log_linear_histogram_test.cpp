@@ -0,0 +1,70 @@
+#include <userver/utils/statistics/log_linear_histogram.hpp>
+
+#include <vector>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/fmt.hpp>
+#include <userver/utils/statistics/histogram_aggregator.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(StatisticsLogLinearHistogram, Bounds) {
+    const utils::statistics::LogLinearHistogram histogram{1, 3, 2};
+    EXPECT_EQ(
+        fmt::to_string(histogram.GetView()),
+        "[1]=0,[1.5]=0,[2]=0,[3]=0,[4]=0,[6]=0,[8]=0,[inf]=0"
+    );
+}
+
+TEST(StatisticsLogLinearHistogram, Account) {
+    utils::statistics::LogLinearHistogram histogram{1, 3, 2};
+    histogram.Account(0);
+    histogram.Account(1);
+    histogram.Account(1.2);
+    histogram.Account(1.5);
+    histogram.Account(2);
+    histogram.Account(2.5, 3);
+    histogram.Account(4);
+    histogram.Account(7.9);
+    histogram.Account(8);
+    histogram.Account(8.1);
+    histogram.Account(1e9);
+    EXPECT_EQ(
+        fmt::to_string(histogram.GetView()),
+        "[1]=2,[1.5]=2,[2]=1,[3]=3,[4]=1,[6]=0,[8]=2,[inf]=2"
+    );
+
+    ResetMetric(histogram);
+    EXPECT_EQ(
+        fmt::to_string(histogram.GetView()),
+        "[1]=0,[1.5]=0,[2]=0,[3]=0,[4]=0,[6]=0,[8]=0,[inf]=0"
+    );
+}
+
+TEST(StatisticsLogLinearHistogram, MatchesBounds) {
+    utils::statistics::LogLinearHistogram histogram{0.1, 12, 4};
+    const auto view = histogram.GetView();
+    for (std::size_t i = 0; i < view.GetBucketCount(); ++i) {
+        const auto bound = view.GetUpperBoundAt(i);
+        histogram.Account(bound);
+        histogram.Account(bound * (1 + 1e-9));
+        EXPECT_EQ(view.GetValueAt(i), i == 0 ? 1 : 2) << "bound=" << bound;
+    }
+    EXPECT_EQ(view.GetValueAtInf(), 1);
+}
+
+TEST(StatisticsLogLinearHistogram, Mergeable) {
+    utils::statistics::LogLinearHistogram first{1, 12, 4};
+    utils::statistics::LogLinearHistogram second{1, 12, 4};
+    first.Account(3);
+    second.Account(3);
+    second.Account(5000);
+
+    utils::statistics::HistogramAggregator aggregator{std::vector<double>{3, 4096}};
+    aggregator.Add(first.GetView());
+    aggregator.Add(second.GetView());
+    const auto view = aggregator.GetView();
+    EXPECT_EQ(fmt::to_string(view), "[3]=2,[4096]=0,[inf]=1");
+}
+
+USERVER_NAMESPACE_END
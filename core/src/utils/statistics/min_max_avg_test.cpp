@@ -4,12 +4,14 @@
 #include <chrono>
 #include <cstdint>
 #include <future>
+#include <limits>
 #include <thread>
 #include <vector>
 
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/utils/rand.hpp>
 #include <userver/utils/statistics/min_max_avg.hpp>
+#include <userver/utils/statistics/striped_min_max_avg.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -17,6 +19,7 @@ constexpr size_t kStressNumThreads = 2;
 constexpr auto kStressTestDuration = std::chrono::milliseconds{500};
 
 static_assert(utils::statistics::kHasWriterSupport<utils::statistics::MinMaxAvg<int>>);
+static_assert(utils::statistics::kHasWriterSupport<utils::statistics::StripedMinMaxAvg<int>>);
 
 template <int... values>
 auto GetFilledMma() {
@@ -120,4 +123,64 @@ TEST(MinMaxAvg, Stress) {
     EXPECT_EQ(sum_locals_final.average, shared_final.average);
 }
 
+TEST(StripedMinMaxAvg, Simple) {
+    utils::statistics::StripedMinMaxAvg<int> mma;
+    EXPECT_TRUE(mma.IsEmpty());
+    EXPECT_EQ(mma.GetCurrent().minimum, 0);
+    EXPECT_EQ(mma.GetCurrent().maximum, 0);
+
+    for (const int value : {-2, 1, 2, 7}) mma.Account(value);
+    EXPECT_FALSE(mma.IsEmpty());
+    const auto current = mma.GetCurrent();
+    EXPECT_EQ(current.minimum, -2);
+    EXPECT_EQ(current.maximum, 7);
+    EXPECT_EQ(current.average, 2);
+
+    mma.Reset();
+    EXPECT_TRUE(mma.IsEmpty());
+    mma.Account(5);
+    EXPECT_EQ(mma.GetCurrent().minimum, 5);
+    EXPECT_EQ(mma.GetCurrent().maximum, 5);
+}
+
+TEST(StripedMinMaxAvg, NoSumOverflow) {
+    utils::statistics::StripedMinMaxAvg<std::uint32_t, double> mma;
+    mma.Account(std::numeric_limits<std::uint32_t>::max());
+    mma.Account(std::numeric_limits<std::uint32_t>::max());
+    EXPECT_EQ(mma.GetCurrent().average, std::numeric_limits<std::uint32_t>::max());
+}
+
+TEST(StripedMinMaxAvg, Stress) {
+    using MmaType = utils::statistics::MinMaxAvg<int64_t>;
+
+    std::atomic<bool> is_running{true};
+    utils::statistics::StripedMinMaxAvg<int64_t> shared;
+    const auto work = [&] {
+        MmaType local;
+        while (is_running) {
+            const auto x = static_cast<int64_t>(utils::Rand() % 1000000);
+            local.Account(x);
+            shared.Account(x);
+        }
+        return local;
+    };
+
+    std::vector<std::future<MmaType>> futures;
+    for (size_t i = 0; i < kStressNumThreads; ++i) futures.push_back(std::async(std::launch::async, work));
+
+    std::this_thread::sleep_for(kStressTestDuration);
+    is_running = false;
+
+    MmaType sum_locals;
+    for (auto& f : futures) {
+        sum_locals.Add(f.get());
+    }
+
+    const auto sum_locals_final = sum_locals.GetCurrent();
+    const auto shared_final = shared.GetCurrent();
+    EXPECT_EQ(sum_locals_final.minimum, shared_final.minimum);
+    EXPECT_EQ(sum_locals_final.maximum, shared_final.maximum);
+    EXPECT_EQ(sum_locals_final.average, shared_final.average);
+}
+
 USERVER_NAMESPACE_END
@@ -1,7 +1,10 @@
 #include <userver/utils/statistics/prometheus.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <type_traits>
 #include <unordered_map>
 
 #include <fmt/compile.h>
@@ -41,20 +44,22 @@ public:
     std::string Release() { return fmt::to_string(buf_); }
 
 private:
+    template <typename UpperBound>
     void AppendHistogramMetric(
         std::string_view metric_suffix,
         std::string_view path,
-        const std::string_view& upper_bound,
-        std::string_view value,
+        const UpperBound& upper_bound,
+        std::uint64_t value,
         utils::statistics::LabelsSpan labels
     ) {
+        constexpr bool kHasUpperBound = !std::is_same_v<UpperBound, std::nullptr_t>;
         fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}_{}{{"), path, metric_suffix);
-        if (!upper_bound.empty()) {
+        if constexpr (kHasUpperBound) {
             fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("le=\"{}\""), upper_bound);
         }
         if (!labels.empty()) {
-            if (!upper_bound.empty()) {
-                fmt::format_to(std::back_inserter(buf_), ",");
+            if constexpr (kHasUpperBound) {
+                buf_.push_back(',');
             }
             DumpLabelsRaw(labels);
         }
@@ -64,7 +69,7 @@ private:
     void HandleHistogram(std::string_view path, utils::statistics::LabelsSpan labels, const MetricValue& value) {
         static constexpr std::string_view kBucket = "bucket";
 
-        const auto prometheus_name = impl::ToPrometheusName(path);
+        const auto& prometheus_name = GetConvertedName(histogram_names_, path);
         DumpMetricType(prometheus_name, value);
 
         auto histogram = value.AsHistogram();
@@ -72,23 +77,11 @@ private:
         std::uint64_t cumulative_sum = 0;
         for (std::size_t i = 0; i < bucket_count; ++i) {
             cumulative_sum += histogram.GetValueAt(i);
-            AppendHistogramMetric(
-                kBucket,
-                prometheus_name,
-                fmt::to_string(histogram.GetUpperBoundAt(i)),
-                fmt::to_string(cumulative_sum),
-                labels
-            );
+            AppendHistogramMetric(kBucket, prometheus_name, histogram.GetUpperBoundAt(i), cumulative_sum, labels);
         }
         cumulative_sum += histogram.GetValueAtInf();
-        AppendHistogramMetric(kBucket, prometheus_name, "+Inf", fmt::to_string(cumulative_sum), labels);
-        AppendHistogramMetric(
-            "count",
-            prometheus_name,
-            /* upper_bound */ "",
-            fmt::to_string(histogram.GetTotalCount()),
-            labels
-        );
+        AppendHistogramMetric(kBucket, prometheus_name, std::string_view{"+Inf"}, cumulative_sum, labels);
+        AppendHistogramMetric("count", prometheus_name, nullptr, histogram.GetTotalCount(), labels);
     }
 
     void DumpMetricNameAndType(std::string_view name, const MetricValue& value) {
@@ -129,7 +122,8 @@ private:
             if (sep) {
                 buf_.push_back(',');
             }
-            fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}=\""), impl::ToPrometheusLabel(label.Name()));
+            buf_.append(GetConvertedLabelName(label.Name()));
+            buf_.append(std::string_view{"=\""});
             const auto& value = label.Value();
             std::replace_copy(value.cbegin(), value.cend(), std::back_inserter(buf_), '"', '\'');
             buf_.push_back('"');
@@ -143,8 +137,27 @@ private:
         buf_.push_back('}');
     }
 
+    // The same few names are repeated for all the time series, so they are
+    // converted once per scrape
+    static const std::string&
+    GetConvertedName(utils::impl::TransparentMap<std::string, std::string>& cache, std::string_view name) {
+        if (const auto* const converted = utils::impl::FindTransparentOrNullptr(cache, name)) {
+            return *converted;
+        }
+        return cache.emplace(name, impl::ToPrometheusName(name)).first->second;
+    }
+
+    const std::string& GetConvertedLabelName(std::string_view name) {
+        if (const auto* const converted = utils::impl::FindTransparentOrNullptr(label_names_, name)) {
+            return *converted;
+        }
+        return label_names_.emplace(name, impl::ToPrometheusLabel(name)).first->second;
+    }
+
     fmt::memory_buffer buf_;
     utils::impl::TransparentMap<std::string, std::string> metrics_;
+    utils::impl::TransparentMap<std::string, std::string> histogram_names_;
+    utils::impl::TransparentMap<std::string, std::string> label_names_;
 };
 
 }  // namespace
@@ -0,0 +1,84 @@
+#include <userver/utils/statistics/prometheus.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr double kHistogramBounds[] = {1, 5, 10, 50, 100, 500};
+
+// Writes `series_count` time series split between a few metric names, like
+// the per-handler or per-host metrics of a large service do
+void WriteLargeMetrics(utils::statistics::Writer& writer, std::int64_t series_count) {
+    constexpr std::int64_t kMetricsPerLabelSet = 10;
+    for (std::int64_t i = 0; i < series_count / kMetricsPerLabelSet; ++i) {
+        const auto handler = "/v1/handler-" + std::to_string(i % 1000);
+        const auto shard = std::to_string(i / 1000);
+        const std::string_view method = i % 2 == 0 ? "GET" : "POST";
+        for (std::int64_t j = 0; j < kMetricsPerLabelSet; ++j) {
+            writer["metric-" + std::to_string(j)].ValueWithLabels(
+                utils::statistics::Rate{static_cast<std::uint64_t>(i + j)},
+                {{"http_path", handler}, {"http_method", method}, {"shard", shard}}
+            );
+        }
+    }
+}
+
+void WriteHistograms(utils::statistics::Writer& writer, const utils::statistics::Histogram& histogram) {
+    for (int i = 0; i < 1000; ++i) {
+        const auto handler = "/v1/handler-" + std::to_string(i);
+        writer["timings"].ValueWithLabels(histogram.GetView(), {"http_path", handler});
+    }
+}
+
+}  // namespace
+
+void StatisticsPrometheusLargeStorage(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        utils::statistics::Storage storage;
+        const auto series_count = state.range(0);
+        const auto entry = storage.RegisterWriter("large", [series_count](utils::statistics::Writer& writer) {
+            WriteLargeMetrics(writer, series_count);
+        });
+
+        std::size_t bytes = 0;
+        for ([[maybe_unused]] auto _ : state) {
+            const auto result = utils::statistics::ToPrometheusFormat(storage);
+            bytes += result.size();
+            benchmark::DoNotOptimize(result);
+        }
+        state.SetBytesProcessed(bytes);
+        state.counters["series"] = series_count;
+    });
+}
+BENCHMARK(StatisticsPrometheusLargeStorage)->RangeMultiplier(10)->Range(1000, 200000)->Unit(benchmark::kMillisecond);
+
+void StatisticsPrometheusHistograms(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        utils::statistics::Storage storage;
+        utils::statistics::Histogram histogram{kHistogramBounds};
+        for (int i = 0; i < 100; ++i) histogram.Account(i);
+
+        const auto entry = storage.RegisterWriter("histograms", [&histogram](utils::statistics::Writer& writer) {
+            WriteHistograms(writer, histogram);
+        });
+
+        for ([[maybe_unused]] auto _ : state) {
+            benchmark::DoNotOptimize(utils::statistics::ToPrometheusFormat(storage));
+        }
+    });
+}
+BENCHMARK(StatisticsPrometheusHistograms)->Unit(benchmark::kMillisecond);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,49 @@
+#include <userver/utils/statistics/striped_histogram.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+StripedHistogram::StripedHistogram(utils::span<const double> upper_bounds)
+    : upper_bounds_(upper_bounds.begin(), upper_bounds.end()),
+      buckets_(std::make_unique<StripedRateCounter[]>(upper_bounds_.size() + 1)) {
+    UINVARIANT(std::is_sorted(upper_bounds_.begin(), upper_bounds_.end()), "Histogram bounds must be sorted");
+}
+
+StripedHistogram::~StripedHistogram() = default;
+
+void StripedHistogram::Account(double value, std::uint64_t count) noexcept {
+    // Values on the bucket borders fall into the lower bucket
+    const auto bucket_index =
+        std::lower_bound(upper_bounds_.begin(), upper_bounds_.end(), value) - upper_bounds_.begin();
+    buckets_[bucket_index].Add(Rate{count});
+}
+
+HistogramAggregator StripedHistogram::GetSnapshot() const {
+    HistogramAggregator snapshot{upper_bounds_};
+    for (std::size_t i = 0; i < upper_bounds_.size(); ++i) {
+        snapshot.AccountAt(i, buckets_[i].Load().value);
+    }
+    snapshot.AccountInf(buckets_[upper_bounds_.size()].Load().value);
+    return snapshot;
+}
+
+void ResetMetric(StripedHistogram& histogram) noexcept {
+    for (std::size_t i = 0; i <= histogram.upper_bounds_.size(); ++i) {
+        histogram.buckets_[i].Store(Rate{});
+    }
+}
+
+void DumpMetric(Writer& writer, const StripedHistogram& histogram) {
+    const auto snapshot = histogram.GetSnapshot();
+    writer = snapshot.GetView();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
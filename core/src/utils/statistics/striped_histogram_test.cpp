@@ -0,0 +1,56 @@
+#include <userver/utils/statistics/striped_histogram.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/fmt.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+auto Bounds() { return std::vector<double>{1.5, 5, 42, 60}; }
+
+}  // namespace
+
+TEST(StatisticsStripedHistogram, Account) {
+    utils::statistics::StripedHistogram histogram{Bounds()};
+    histogram.Account(10);
+    histogram.Account(1.2);
+    histogram.Account(1.8);
+    histogram.Account(100);
+    histogram.Account(30, 4);
+    histogram.Account(5);
+
+    const auto snapshot = histogram.GetSnapshot();
+    EXPECT_EQ(fmt::to_string(snapshot.GetView()), "[1.5]=1,[5]=2,[42]=5,[60]=0,[inf]=1");
+
+    ResetMetric(histogram);
+    const auto reset_snapshot = histogram.GetSnapshot();
+    EXPECT_EQ(fmt::to_string(reset_snapshot.GetView()), "[1.5]=0,[5]=0,[42]=0,[60]=0,[inf]=0");
+}
+
+TEST(StatisticsStripedHistogram, Concurrent) {
+    constexpr std::size_t kThreads = 4;
+    constexpr std::size_t kIterations = 10000;
+
+    utils::statistics::StripedHistogram histogram{Bounds()};
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&histogram] {
+            for (std::size_t j = 0; j < kIterations; ++j) {
+                histogram.Account(3);
+                histogram.Account(1000);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    const auto snapshot = histogram.GetSnapshot();
+    const auto view = snapshot.GetView();
+    EXPECT_EQ(view.GetValueAt(1), kThreads * kIterations);
+    EXPECT_EQ(view.GetValueAtInf(), kThreads * kIterations);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::bench {
+
+/// Number of the global operator new calls made by all the threads of the
+/// process, including the completion queue threads
+std::uint64_t GetAllocationsCount() noexcept;
+
+}  // namespace ugrpc::bench
+
+USERVER_NAMESPACE_END
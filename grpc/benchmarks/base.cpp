@@ -1,3 +1,5 @@
+#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -78,6 +80,44 @@ public:
     }
 };
 
+constexpr std::size_t kStreamMessageSize = 100;
+constexpr int kStreamMessagesCount = 1000;
+constexpr std::string_view kBufferedWrites = "buffered";
+
+// Streams small messages, with buffered writes if requested
+class StreamingService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    ReadManyResult ReadMany(
+        CallContext& /*context*/,
+        sample::ugrpc::StreamGreetingRequest&& request,
+        ReadManyWriter& writer
+    ) override {
+        const bool buffered = request.name() == kBufferedWrites;
+        sample::ugrpc::StreamGreetingResponse response;
+        response.set_name(std::string(kStreamMessageSize, 'x'));
+        for (int i = 0; i < request.number(); ++i) {
+            response.set_number(i);
+            if (buffered) {
+                writer.WriteBuffered(response);
+            } else {
+                writer.Write(response);
+            }
+        }
+        return grpc::Status::OK;
+    }
+
+    WriteManyResult WriteMany(CallContext& /*context*/, WriteManyReader& reader) override {
+        sample::ugrpc::StreamGreetingRequest request;
+        int count = 0;
+        while (reader.Read(request)) {
+            ++count;
+        }
+        sample::ugrpc::StreamGreetingResponse response;
+        response.set_number(count);
+        return response;
+    }
+};
+
 template <typename GrpcService, bool Logging>
 class TestService : public tests::ServiceBase {
 public:
@@ -110,6 +150,7 @@ private:
 
 using GrpcClientTest = TestService<UnitTestService, false>;
 using GrpcClientTestWithLogging = TestService<UnitTestService, true>;
+using GrpcStreamingTest = TestService<StreamingService, false>;
 
 std::unique_ptr<grpc::ClientContext> PrepareClientContext() {
     auto context = std::make_unique<grpc::ClientContext>();
@@ -220,6 +261,96 @@ void BatchOfUnaryRPC(benchmark::State& state) {
 
 BENCHMARK(BatchOfUnaryRPC)->DenseRange(1, 8)->Unit(benchmark::kMillisecond);
 
+// Unary RPC throughput per worker thread for various numbers of completion
+// queues. Each completion queue is served by a separate QueueRunner thread,
+// which forwards events to the coroutines on the task processor.
+void UnaryRPCPerCore(benchmark::State& state) {
+    const logging::DefaultLoggerGuard logger_guard{std::make_shared<NoopLogger>()};
+    const auto worker_threads = state.range(0);
+
+    engine::RunStandalone(
+        worker_threads,
+        engine::TaskProcessorPoolsConfig{10000, 100000, 256 * 1024ULL, 1, "ev", false},
+        [&] {
+            static constexpr std::size_t kBatchSize = 16;
+            server::ServerConfig server_config;
+            server_config.completion_queue_num = state.range(1);
+            GrpcClientTest client_factory{std::move(server_config)};
+            auto clients = utils::GenerateFixedArray(kBatchSize, [&client_factory](auto) {
+                return client_factory.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+            });
+
+            for (auto _ : state) {
+                auto tasks = utils::GenerateFixedArray(kBatchSize, [&clients](auto i) {
+                    return engine::AsyncNoSpan(UnaryRPCPayloadRepeated, std::ref(clients[i]));
+                });
+                engine::GetAll(tasks);
+            }
+
+            const auto rpcs =
+                static_cast<std::size_t>(state.iterations()) * kBatchSize * kUnaryRPCPayloadRepeatedRepetitions;
+            state.counters["rps"] = benchmark::Counter(rpcs, benchmark::Counter::kIsRate);
+            state.counters["rps_per_core"] = benchmark::Counter(rpcs / worker_threads, benchmark::Counter::kIsRate);
+        }
+    );
+}
+
+BENCHMARK(UnaryRPCPerCore)->ArgsProduct({{1, 2, 4, 8}, {1, 2, 4}})->Unit(benchmark::kMillisecond);
+
+// Server stream of small messages, state.range(0) enables buffered writes
+void ServerStreamThroughput(benchmark::State& state) {
+    engine::RunStandalone(2, [&] {
+        GrpcStreamingTest client_factory;
+        auto client = client_factory.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+        sample::ugrpc::StreamGreetingRequest request;
+        request.set_name(state.range(0) ? std::string{kBufferedWrites} : std::string{});
+        request.set_number(kStreamMessagesCount);
+
+        sample::ugrpc::StreamGreetingResponse response;
+        for (auto _ : state) {
+            auto stream = client.ReadMany(request);
+            int count = 0;
+            while (stream.Read(response)) ++count;
+            UINVARIANT(count == kStreamMessagesCount, "Behavior broken");
+        }
+
+        const auto messages = state.iterations() * kStreamMessagesCount;
+        state.SetItemsProcessed(messages);
+        state.SetBytesProcessed(messages * kStreamMessageSize);
+    });
+}
+
+BENCHMARK(ServerStreamThroughput)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Client stream of small messages, state.range(0) enables buffered writes
+void ClientStreamThroughput(benchmark::State& state) {
+    engine::RunStandalone(2, [&] {
+        GrpcStreamingTest client_factory;
+        auto client = client_factory.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+        const bool buffered = state.range(0);
+
+        sample::ugrpc::StreamGreetingRequest request;
+        request.set_name(std::string(kStreamMessageSize, 'x'));
+
+        for (auto _ : state) {
+            auto stream = client.WriteMany();
+            for (int i = 0; i < kStreamMessagesCount; ++i) {
+                request.set_number(i);
+                const bool success = buffered ? stream.WriteBuffered(request) : stream.Write(request);
+                UINVARIANT(success, "Behavior broken");
+            }
+            UINVARIANT(stream.Finish().number() == kStreamMessagesCount, "Behavior broken");
+        }
+
+        const auto messages = state.iterations() * kStreamMessagesCount;
+        state.SetItemsProcessed(messages);
+        state.SetBytesProcessed(messages * kStreamMessageSize);
+    });
+}
+
+BENCHMARK(ClientStreamThroughput)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
 void BatchOfUnaryRPCNewClient(benchmark::State& state) {
     engine::RunStandalone(
         state.range(0),
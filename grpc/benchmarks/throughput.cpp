@@ -0,0 +1,260 @@
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/logging/null_logger.hpp>
+#include <userver/ugrpc/tests/service.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "allocation_counter.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::bench {
+
+namespace {
+
+constexpr std::size_t kConcurrency = 16;
+constexpr std::size_t kCallsPerTask = 64;
+constexpr int kStreamMessagesCount = 100;
+
+// Echoes the payload of the requests back
+class EchoService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& /*context*/, sample::ugrpc::GreetingRequest&& request) override {
+        sample::ugrpc::GreetingResponse response;
+        response.set_name(std::move(*request.mutable_name()));
+        return response;
+    }
+
+    ReadManyResult ReadMany(
+        CallContext& /*context*/,
+        sample::ugrpc::StreamGreetingRequest&& request,
+        ReadManyWriter& writer
+    ) override {
+        sample::ugrpc::StreamGreetingResponse response;
+        response.set_name(request.name());
+        for (int i = 0; i < request.number(); ++i) {
+            response.set_number(i);
+            writer.Write(response);
+        }
+        return grpc::Status::OK;
+    }
+
+    WriteManyResult WriteMany(CallContext& /*context*/, WriteManyReader& reader) override {
+        sample::ugrpc::StreamGreetingRequest request;
+        int count = 0;
+        while (reader.Read(request)) {
+            ++count;
+        }
+        sample::ugrpc::StreamGreetingResponse response;
+        response.set_number(count);
+        return response;
+    }
+
+    ChatResult Chat(CallContext& /*context*/, ChatReaderWriter& stream) override {
+        sample::ugrpc::StreamGreetingRequest request;
+        sample::ugrpc::StreamGreetingResponse response;
+        while (stream.Read(request)) {
+            response.set_number(request.number());
+            response.set_name(std::move(*request.mutable_name()));
+            stream.Write(response);
+        }
+        return grpc::Status::OK;
+    }
+};
+
+struct FixtureParams final {
+    std::size_t completion_queues{2};
+    std::size_t channels{1};
+    bool middlewares{false};
+};
+
+server::ServerConfig MakeServerConfig(std::size_t completion_queues) {
+    server::ServerConfig config;
+    config.completion_queue_num = completion_queues;
+    return config;
+}
+
+// In-process server and client factory, with the default middlewares on both
+// sides if requested
+class EchoFixture final : public tests::ServiceBase {
+public:
+    explicit EchoFixture(const FixtureParams& params) : tests::ServiceBase(MakeServerConfig(params.completion_queues)) {
+        if (params.middlewares) {
+            SetServerMiddlewares(tests::GetDefaultServerMiddlewares());
+            SetClientMiddlewareFactories(tests::GetDefaultClientMiddlewareFactories());
+        }
+        RegisterService(service_);
+        client::ClientFactorySettings client_factory_settings;
+        client_factory_settings.channel_count = params.channels;
+        StartServer(std::move(client_factory_settings));
+    }
+
+    ~EchoFixture() override { StopServer(); }
+
+private:
+    EchoService service_;
+};
+
+void ReportCalls(benchmark::State& state, std::uint64_t calls, std::uint64_t allocations_before) {
+    state.counters["rps"] = benchmark::Counter(static_cast<double>(calls), benchmark::Counter::kIsRate);
+    state.counters["allocs_per_call"] =
+        static_cast<double>(GetAllocationsCount() - allocations_before) / static_cast<double>(calls);
+}
+
+// kConcurrency tasks make kCallsPerTask unary calls each per iteration
+void RunUnary(benchmark::State& state, const FixtureParams& params, std::size_t payload_size) {
+    const logging::DefaultLoggerGuard logger_guard{logging::MakeNullLogger()};
+
+    engine::RunStandalone(4, [&] {
+        EchoFixture fixture{params};
+        auto client = fixture.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+        sample::ugrpc::GreetingRequest request;
+        request.set_name(std::string(payload_size, 'x'));
+
+        const auto allocations_before = GetAllocationsCount();
+        for (auto _ : state) {
+            auto tasks = utils::GenerateFixedArray(kConcurrency, [&](std::size_t) {
+                return engine::AsyncNoSpan([&] {
+                    for (std::size_t i = 0; i < kCallsPerTask; ++i) {
+                        const auto response = client.SayHello(request);
+                        UINVARIANT(response.name().size() == payload_size, "Behavior broken");
+                    }
+                });
+            });
+            engine::GetAll(tasks);
+        }
+
+        ReportCalls(state, state.iterations() * kConcurrency * kCallsPerTask, allocations_before);
+        state.SetBytesProcessed(state.iterations() * kConcurrency * kCallsPerTask * payload_size);
+    });
+}
+
+}  // namespace
+
+// Payload size x middlewares on/off
+void UnaryPayload(benchmark::State& state) {
+    RunUnary(state, FixtureParams{2, 1, state.range(1) != 0}, state.range(0));
+}
+
+BENCHMARK(UnaryPayload)->ArgsProduct({{16, 1024, 64 * 1024}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+// Client channels x completion queues
+void UnaryChannelsAndQueues(benchmark::State& state) {
+    const FixtureParams params{static_cast<std::size_t>(state.range(1)), static_cast<std::size_t>(state.range(0))};
+    RunUnary(state, params, 16);
+}
+
+BENCHMARK(UnaryChannelsAndQueues)->ArgsProduct({{1, 2, 4}, {1, 2, 4}})->Unit(benchmark::kMillisecond);
+
+// Server streaming of kStreamMessagesCount messages per call, payload size x
+// middlewares on/off
+void ServerStreamPayload(benchmark::State& state) {
+    const logging::DefaultLoggerGuard logger_guard{logging::MakeNullLogger()};
+    const auto payload_size = state.range(0);
+
+    engine::RunStandalone(2, [&] {
+        EchoFixture fixture{FixtureParams{2, 1, state.range(1) != 0}};
+        auto client = fixture.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+        sample::ugrpc::StreamGreetingRequest request;
+        request.set_name(std::string(payload_size, 'x'));
+        request.set_number(kStreamMessagesCount);
+
+        sample::ugrpc::StreamGreetingResponse response;
+        const auto allocations_before = GetAllocationsCount();
+        for (auto _ : state) {
+            auto stream = client.ReadMany(request);
+            int count = 0;
+            while (stream.Read(response)) ++count;
+            UINVARIANT(count == kStreamMessagesCount, "Behavior broken");
+        }
+
+        ReportCalls(state, state.iterations(), allocations_before);
+        state.SetItemsProcessed(state.iterations() * kStreamMessagesCount);
+        state.SetBytesProcessed(state.iterations() * kStreamMessagesCount * payload_size);
+    });
+}
+
+BENCHMARK(ServerStreamPayload)->ArgsProduct({{16, 1024, 64 * 1024}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+// Client streaming of kStreamMessagesCount messages per call, payload size x
+// middlewares on/off
+void ClientStreamPayload(benchmark::State& state) {
+    const logging::DefaultLoggerGuard logger_guard{logging::MakeNullLogger()};
+    const auto payload_size = state.range(0);
+
+    engine::RunStandalone(2, [&] {
+        EchoFixture fixture{FixtureParams{2, 1, state.range(1) != 0}};
+        auto client = fixture.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+        sample::ugrpc::StreamGreetingRequest request;
+        request.set_name(std::string(payload_size, 'x'));
+
+        const auto allocations_before = GetAllocationsCount();
+        for (auto _ : state) {
+            auto stream = client.WriteMany();
+            for (int i = 0; i < kStreamMessagesCount; ++i) {
+                request.set_number(i);
+                UINVARIANT(stream.Write(request), "Behavior broken");
+            }
+            UINVARIANT(stream.Finish().number() == kStreamMessagesCount, "Behavior broken");
+        }
+
+        ReportCalls(state, state.iterations(), allocations_before);
+        state.SetItemsProcessed(state.iterations() * kStreamMessagesCount);
+        state.SetBytesProcessed(state.iterations() * kStreamMessagesCount * payload_size);
+    });
+}
+
+BENCHMARK(ClientStreamPayload)->ArgsProduct({{16, 1024, 64 * 1024}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+// Bidirectional ping-pong of kStreamMessagesCount messages per call, payload
+// size x middlewares on/off
+void BidiStreamPayload(benchmark::State& state) {
+    const logging::DefaultLoggerGuard logger_guard{logging::MakeNullLogger()};
+    const auto payload_size = state.range(0);
+
+    engine::RunStandalone(2, [&] {
+        EchoFixture fixture{FixtureParams{2, 1, state.range(1) != 0}};
+        auto client = fixture.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+        sample::ugrpc::StreamGreetingRequest request;
+        request.set_name(std::string(payload_size, 'x'));
+        sample::ugrpc::StreamGreetingResponse response;
+
+        const auto allocations_before = GetAllocationsCount();
+        for (auto _ : state) {
+            auto stream = client.Chat();
+            for (int i = 0; i < kStreamMessagesCount; ++i) {
+                request.set_number(i);
+                UINVARIANT(stream.Write(request), "Behavior broken");
+                UINVARIANT(stream.Read(response) && response.number() == i, "Behavior broken");
+            }
+            UINVARIANT(stream.WritesDone(), "Behavior broken");
+            UINVARIANT(!stream.Read(response), "Behavior broken");
+        }
+
+        ReportCalls(state, state.iterations(), allocations_before);
+        state.SetItemsProcessed(state.iterations() * kStreamMessagesCount);
+        state.SetBytesProcessed(state.iterations() * kStreamMessagesCount * payload_size);
+    });
+}
+
+BENCHMARK(BidiStreamPayload)->ArgsProduct({{16, 1024, 64 * 1024}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+}  // namespace ugrpc::bench
+
+USERVER_NAMESPACE_END
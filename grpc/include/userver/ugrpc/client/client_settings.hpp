@@ -3,9 +3,11 @@
 /// @file userver/ugrpc/client/client_settings.hpp
 /// @brief @copybrief ugrpc::client::ClientSettings
 
+#include <chrono>
 #include <cstddef>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <userver/dynamic_config/snapshot.hpp>
 
@@ -18,6 +20,25 @@ namespace ugrpc::client {
 // rpc method name -> count of channels
 using DedicatedMethodsConfig = std::unordered_map<std::string, std::size_t>;
 
+/// Ejection of failing endpoints for the client-side balancing over
+/// ClientSettings::endpoints
+struct OutlierDetectionSettings final {
+    /// Consecutive failed calls after which the endpoint is ejected. Network
+    /// errors and UNAVAILABLE, DEADLINE_EXCEEDED, INTERNAL, UNKNOWN and DATA_LOSS
+    /// statuses are considered failures.
+    std::size_t consecutive_failures{5};
+
+    /// How long the endpoint stays ejected, multiplied by the number of
+    /// ejections in a row
+    std::chrono::milliseconds base_ejection_time{std::chrono::seconds{30}};
+
+    /// Upper bound for the ejection time
+    std::chrono::milliseconds max_ejection_time{std::chrono::minutes{5}};
+
+    /// Max percentage of the endpoints that may be ejected at the same time
+    std::size_t max_ejection_percent{50};
+};
+
 /// Settings relating to creation of a code-generated client
 struct ClientSettings final {
     /// **(Required)**
@@ -31,6 +52,21 @@ struct ClientSettings final {
     /// https://grpc.github.io/grpc/cpp/md_doc_naming.html
     std::string endpoint;
 
+    /// **(Optional)**
+    /// Endpoints of the replicas of the service, used instead of `endpoint`.
+    ///
+    /// Each endpoint gets its own channels, and the calls are balanced over the
+    /// endpoints by userver rather than by the gRPC resolver: a weighted
+    /// least-request balancer picks the less loaded of two random endpoints,
+    /// with the load scaled by the observed latency of the endpoint. So the slow
+    /// endpoints receive less calls, and the failing ones are ejected, see
+    /// `outlier_detection`.
+    std::vector<std::string> endpoints{};
+
+    /// **(Optional)**
+    /// Ejection of failing `endpoints`
+    OutlierDetectionSettings outlier_detection{};
+
     /// **(Optional)**
     /// The name of the QOS
     /// @ref scripts/docs/en/userver/dynamic_config.md "dynamic config"
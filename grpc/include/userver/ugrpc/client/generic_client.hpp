@@ -12,6 +12,7 @@
 #include <userver/ugrpc/client/impl/client_data.hpp>
 #include <userver/ugrpc/client/qos.hpp>
 #include <userver/ugrpc/client/response_future.hpp>
+#include <userver/ugrpc/client/rpc.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -35,6 +36,9 @@ struct GenericOptions {
     std::optional<std::string_view> metrics_call_name{"Generic/Generic"};
 };
 
+/// @brief A raw bidirectional stream of a @ref GenericClient call
+using GenericStream = BidirectionalStream<grpc::ByteBuffer, grpc::ByteBuffer>;
+
 /// @ingroup userver_clients
 ///
 /// @brief Allows to talk to gRPC services (generic and normal) using dynamic
@@ -57,6 +61,12 @@ struct GenericOptions {
 /// There are no per-call-name metrics by default,
 /// for details see @ref GenericOptions::metrics_call_name.
 ///
+/// Copies of `grpc::ByteBuffer` share the underlying slices, so passing
+/// a buffer received from a @ref ugrpc::server::GenericServiceBase call
+/// straight to @ref GenericClient (and back) neither copies nor parses
+/// the payload. Avoid flattening the buffers, e.g. via `DumpToSingleSlice`,
+/// unless the message has to be inspected.
+///
 /// ## Example GenericClient usage with known message types
 ///
 /// @snippet grpc/tests/generic_client_test.cpp  sample
@@ -83,6 +93,23 @@ public:
         const GenericOptions& options = {}
     ) const;
 
+    /// @brief Initiate an RPC of any kind with the given name as
+    /// a bidirectional stream of raw messages.
+    ///
+    /// On the wire, unary and single-direction streaming RPCs are
+    /// indistinguishable from bidirectional streams with exactly one message
+    /// in the corresponding direction, so a proxy may forward any RPC through
+    /// this method message by message, e.g. from a
+    /// @ref ugrpc::server::GenericServiceBase handler.
+    ///
+    /// Metadata is rewritten as usual: fill `context` before the call, read
+    /// the server metadata from `GetContext()` afterwards.
+    GenericStream Stream(
+        std::string_view call_name,
+        std::unique_ptr<grpc::ClientContext> context = std::make_unique<grpc::ClientContext>(),
+        const GenericOptions& options = {}
+    ) const;
+
     /// @cond
     // For internal use only.
     explicit GenericClient(impl::ClientDependencies&&);
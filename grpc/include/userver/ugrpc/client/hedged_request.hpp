@@ -0,0 +1,51 @@
+#pragma once
+
+/// @file userver/ugrpc/client/hedged_request.hpp
+/// @brief Hedged unary RPCs with the delay that follows the latencies of
+/// the destination.
+///
+/// Example:
+/// @code
+/// utils::hedging::AdaptiveHedgingSet hedgings{settings};
+/// ...
+/// auto response = ugrpc::client::HedgeRequest(
+///     [&] { return client.AsyncSayHello(request); },
+///     hedgings.GetHedging("greeter"), hedging_settings);
+/// @endcode
+
+#include <optional>
+#include <utility>
+
+#include <userver/ugrpc/client/response_future.hpp>
+#include <userver/utils/adaptive_hedging.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+/// @brief Performs the unary RPC started by `gen_call`, starts hedges after
+/// the percentile-based delay of `hedging` and within its budget.
+///
+/// Any ugrpc::client::RpcError starts the next attempt, the attempts left
+/// in flight are cancelled once a response is received.
+/// @returns the first response or std::nullopt if all the attempts have
+/// failed
+template <typename GenF>
+auto HedgeRequest(GenF&& gen_call, utils::hedging::AdaptiveHedging& hedging, utils::hedging::HedgingSettings settings) {
+    return utils::hedging::HedgeRequestAdaptive(std::forward<GenF>(gen_call), hedging, std::move(settings));
+}
+
+/// @brief Asynchronous version of ugrpc::client::HedgeRequest, `hedging`
+/// should outlive the returned future.
+template <typename GenF>
+auto HedgeRequestAsync(
+    GenF&& gen_call,
+    utils::hedging::AdaptiveHedging& hedging,
+    utils::hedging::HedgingSettings settings
+) {
+    return utils::hedging::HedgeRequestAdaptiveAsync(std::forward<GenF>(gen_call), hedging, std::move(settings));
+}
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
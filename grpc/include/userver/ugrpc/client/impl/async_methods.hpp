@@ -13,6 +13,7 @@
 #include <grpcpp/impl/codegen/async_unary_call.h>
 #include <grpcpp/impl/codegen/status.h>
 
+#include <userver/congestion_control/client_limiter.hpp>
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/tracing/in_place_span.hpp>
 #include <userver/tracing/span.hpp>
@@ -110,6 +111,10 @@ public:
 
     void SetDeadlinePropagated() noexcept;
 
+    void SetConcurrencyToken(congestion_control::ClientLimiter::Token&& token) noexcept;
+
+    std::optional<congestion_control::ClientLimiter::Token> ExtractConcurrencyToken() noexcept;
+
     // please read comments for 'invocation_' private member on why
     // we use two different invocation types
     void EmplaceAsyncMethodInvocation();
@@ -166,6 +171,7 @@ private:
 
     std::optional<tracing::InPlaceSpan> span_;
     ugrpc::impl::RpcStatisticsScope stats_scope_;
+    std::optional<congestion_control::ClientLimiter::Token> concurrency_token_;
     grpc::CompletionQueue& queue_;
     RpcConfigValues config_values_;
     const Middlewares& mws_;
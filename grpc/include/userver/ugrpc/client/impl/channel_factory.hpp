@@ -37,6 +37,8 @@ public:
             .Get();
     }
 
+    const grpc::string& GetEndpoint() const { return endpoint_; }
+
 private:
     engine::TaskProcessor& blocking_task_processor_;
     grpc::string endpoint_;
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include <grpcpp/completion_queue.h>
 
@@ -11,7 +13,9 @@
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/rcu/rcu.hpp>
 #include <userver/testsuite/grpc_control.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 #include <userver/ugrpc/client/client_factory_settings.hpp>
 #include <userver/ugrpc/client/client_settings.hpp>
@@ -35,7 +39,8 @@ namespace ugrpc::client::impl {
 /// Contains all non-code-generated dependencies for creating a gRPC client
 struct ClientDependencies final {
     std::string client_name;
-    std::string endpoint;
+    std::vector<std::string> endpoints;
+    OutlierDetectionSettings outlier_detection;
     Middlewares mws;
     ugrpc::impl::CompletionQueuePoolBase& completion_queues;
     ugrpc::impl::StatisticsStorage& statistics_storage;
@@ -60,24 +65,54 @@ public:
         utils::FixedArray<StubPool> dedicated_stubs;
     };
 
+    /// Holds the channel for the whole duration of a call, so that the call
+    /// is accounted in the channel load
     class StubHandle {
     public:
-        StubHandle(rcu::ReadablePtr<StubState>&& state, StubAny& stub) : state_{std::move(state)}, stub_{stub} {}
-
-        StubHandle(StubHandle&&) noexcept = default;
+        StubHandle(rcu::ReadablePtr<StubState>&& state, const StubPool& pool)
+            : state_{std::move(state)},
+              pool_{&pool},
+              index_{pool.AcquireStub()},
+              start_{std::chrono::steady_clock::now()} {}
+
+        StubHandle(StubHandle&& other) noexcept
+            : state_{std::move(other.state_)},
+              pool_{std::exchange(other.pool_, nullptr)},
+              index_{other.index_},
+              start_{other.start_} {}
         StubHandle& operator=(StubHandle&&) = delete;
 
         StubHandle(const StubHandle&) = delete;
         StubHandle& operator=(const StubHandle&) = delete;
 
+        ~StubHandle() {
+            if (pool_) pool_->ReleaseStub(index_);
+        }
+
         template <typename Stub>
         Stub& Get() {
-            return StubCast<Stub>(stub_);
+            UASSERT(pool_);
+            return StubCast<Stub>(pool_->GetStub(index_));
+        }
+
+        /// Accounts the outcome of the call in the balancing over the endpoints.
+        /// The latency is only meaningful for unary calls.
+        void AccountResult(bool failed, bool account_latency) noexcept {
+            UASSERT(pool_);
+            std::optional<std::chrono::microseconds> latency;
+            if (account_latency) {
+                latency = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start_
+                );
+            }
+            pool_->AccountResult(index_, failed, latency);
         }
 
     private:
         rcu::ReadablePtr<StubState> state_;
-        StubAny& stub_;
+        const StubPool* pool_;
+        std::size_t index_;
+        std::chrono::steady_clock::time_point start_;
     };
 
     ClientData() = delete;
@@ -87,8 +122,9 @@ public:
         : dependencies_(std::move(dependencies)),
           metadata_(metadata),
           service_statistics_(&GetServiceStatistics()),
-          channel_factory_(CreateChannelFactory(dependencies_)),
-          stub_state_(std::make_unique<rcu::Variable<StubState>>()) {
+          channel_factories_(CreateChannelFactories(dependencies_)),
+          stub_state_(std::make_unique<rcu::Variable<StubState>>()),
+          channels_statistics_holder_(RegisterChannelsStatistics()) {
         if (dependencies_.qos) {
             SubscribeOnConfigUpdate<Service>(*dependencies_.qos);
         } else {
@@ -99,8 +135,9 @@ public:
     template <typename Service>
     ClientData(ClientDependencies&& dependencies, GenericClientTag, std::in_place_type_t<Service>)
         : dependencies_(std::move(dependencies)),
-          channel_factory_(CreateChannelFactory(dependencies_)),
-          stub_state_(std::make_unique<rcu::Variable<StubState>>()) {
+          channel_factories_(CreateChannelFactories(dependencies_)),
+          stub_state_(std::make_unique<rcu::Variable<StubState>>()),
+          channels_statistics_holder_(RegisterChannelsStatistics()) {
         ConstructStubState<typename Service::Stub>();
     }
 
@@ -115,15 +152,14 @@ public:
     StubHandle NextStubFromMethodId(std::size_t method_id) const {
         auto stub_state = stub_state_->Read();
         auto& dedicated_stubs = stub_state->dedicated_stubs[method_id];
-        auto& stubs = dedicated_stubs.Size() ? dedicated_stubs : stub_state->stubs;
-        auto& stub = stubs.NextStub();
-        return StubHandle{std::move(stub_state), stub};
+        const auto& stubs = dedicated_stubs.Size() ? dedicated_stubs : stub_state->stubs;
+        return StubHandle{std::move(stub_state), stubs};
     }
 
     StubHandle NextStub() const {
         auto stub_state = stub_state_->Read();
-        auto& stub = stub_state->stubs.NextStub();
-        return StubHandle{std::move(stub_state), stub};
+        const auto& stubs = stub_state->stubs;
+        return StubHandle{std::move(stub_state), stubs};
     }
 
     grpc::CompletionQueue& NextQueue() const;
@@ -147,23 +183,26 @@ public:
     rcu::ReadablePtr<StubState> GetStubState() const { return stub_state_->Read(); }
 
 private:
-    static ChannelFactory CreateChannelFactory(const ClientDependencies& dependencies);
+    static utils::FixedArray<ChannelFactory> CreateChannelFactories(const ClientDependencies& dependencies);
 
     template <typename Stub>
     static utils::FixedArray<StubPool> MakeDedicatedStubs(
-        const ChannelFactory& channel_factory,
+        const utils::FixedArray<ChannelFactory>& channel_factories,
+        const OutlierDetectionSettings& outlier_detection,
         const ugrpc::impl::StaticServiceMetadata& metadata,
         const DedicatedMethodsConfig& dedicated_methods_config
     ) {
         return utils::GenerateFixedArray(GetMethodsCount(metadata), [&](std::size_t method_id) {
             const auto method_channel_count =
                 GetMethodChannelCount(dedicated_methods_config, GetMethodName(metadata, method_id));
-            return StubPool::Create<Stub>(method_channel_count, channel_factory);
+            return StubPool::Create<Stub>(method_channel_count, channel_factories, outlier_detection);
         });
     }
 
     ugrpc::impl::ServiceStatistics& GetServiceStatistics();
 
+    utils::statistics::Entry RegisterChannelsStatistics();
+
     template <typename Service>
     void SubscribeOnConfigUpdate(const dynamic_config::Key<ClientQos>& qos) {
         config_subscription_ = dependencies_.config_source.UpdateAndListen(
@@ -178,12 +217,16 @@ private:
 
     template <typename Stub>
     void ConstructStubState() {
-        auto stubs = StubPool::Create<Stub>(dependencies_.client_factory_settings.channel_count, channel_factory_);
+        auto stubs = StubPool::Create<Stub>(
+            dependencies_.client_factory_settings.channel_count, channel_factories_, dependencies_.outlier_detection
+        );
 
-        auto dedicated_stubs =
-            metadata_.has_value()
-                ? MakeDedicatedStubs<Stub>(channel_factory_, *metadata_, dependencies_.dedicated_methods_config)
-                : utils::FixedArray<StubPool>{};
+        utils::FixedArray<StubPool> dedicated_stubs;
+        if (metadata_.has_value()) {
+            dedicated_stubs = MakeDedicatedStubs<Stub>(
+                channel_factories_, dependencies_.outlier_detection, *metadata_, dependencies_.dedicated_methods_config
+            );
+        }
 
         stub_state_->Assign({std::move(stubs), std::move(dedicated_stubs)});
     }
@@ -192,9 +235,12 @@ private:
     std::optional<ugrpc::impl::StaticServiceMetadata> metadata_{std::nullopt};
     ugrpc::impl::ServiceStatistics* service_statistics_{nullptr};
 
-    ChannelFactory channel_factory_;
+    // One per endpoint
+    utils::FixedArray<ChannelFactory> channel_factories_;
     std::unique_ptr<rcu::Variable<StubState>> stub_state_;
 
+    utils::statistics::Entry channels_statistics_holder_;
+
     // These fields must be the last ones
     concurrent::AsyncEventSubscriberScope config_subscription_;
 };
@@ -1,9 +1,16 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
 #include <grpcpp/channel.h>
 
 #include <userver/utils/fixed_array.hpp>
 
+#include <userver/ugrpc/client/client_settings.hpp>
 #include <userver/ugrpc/client/impl/channel_factory.hpp>
 #include <userver/ugrpc/client/impl/stub_any.hpp>
 
@@ -17,30 +24,105 @@ public:
 
     std::size_t Size() const { return stubs_.size(); }
 
-    StubAny& NextStub() const;
+    /// Picks the channel with the least calls in flight and accounts a new
+    /// call on it. Must be paired with ReleaseStub.
+    ///
+    /// With multiple endpoints the endpoint is picked first, out of two random
+    /// endpoints that are not ejected, by the calls in flight weighted with the
+    /// latency of the endpoint.
+    std::size_t AcquireStub() const;
+
+    void ReleaseStub(std::size_t index) const noexcept;
+
+    /// Accounts the outcome of a call in the outlier detection and the latency
+    /// of the endpoint of the channel
+    void AccountResult(std::size_t index, bool failed, std::optional<std::chrono::microseconds> latency)
+        const noexcept;
+
+    StubAny& GetStub(std::size_t index) const { return stubs_[index]; }
+
+    std::size_t GetInFlight(std::size_t index) const { return in_flight_[index].load(std::memory_order_relaxed); }
 
     const utils::FixedArray<std::shared_ptr<grpc::Channel>>& GetChannels() const { return channels_; }
 
     const utils::FixedArray<StubAny>& GetStubs() const { return stubs_; }
 
+    std::size_t GetEndpointsCount() const { return endpoints_.size(); }
+
+    const std::string& GetEndpoint(std::size_t endpoint) const { return endpoints_[endpoint].name; }
+
+    std::size_t GetEndpointInFlight(std::size_t endpoint) const;
+
+    bool IsEndpointEjected(std::size_t endpoint) const;
+
+    std::chrono::microseconds GetEndpointLatency(std::size_t endpoint) const {
+        return std::chrono::microseconds{endpoints_[endpoint].latency_us.load(std::memory_order_relaxed)};
+    }
+
     template <typename Stub>
-    static StubPool Create(std::size_t size, const ChannelFactory& channel_factory) {
-        auto channels = utils::GenerateFixedArray(size, [&channel_factory](std::size_t) {
-            return channel_factory.CreateChannel();
+    static StubPool Create(
+        std::size_t size,
+        const utils::FixedArray<ChannelFactory>& channel_factories,
+        const OutlierDetectionSettings& outlier_detection
+    ) {
+        // Channels of the endpoint `i` are [i * size, (i + 1) * size)
+        auto channels = utils::GenerateFixedArray(size * channel_factories.size(), [&](std::size_t index) {
+            return channel_factories[index / size].CreateChannel();
         });
         auto stubs = utils::GenerateFixedArray(channels.size(), [&channels](std::size_t index) {
             return MakeStub<Stub>(channels[index]);
         });
-        return StubPool{std::move(channels), std::move(stubs)};
+        auto endpoints = utils::GenerateFixedArray(channel_factories.size(), [&](std::size_t index) {
+            return EndpointState{channel_factories[index].GetEndpoint()};
+        });
+        return StubPool{std::move(channels), std::move(stubs), std::move(endpoints), size, outlier_detection};
     }
 
 private:
-    StubPool(utils::FixedArray<std::shared_ptr<grpc::Channel>>&& channels, utils::FixedArray<StubAny>&& stubs)
-        : channels_{std::move(channels)}, stubs_{std::move(stubs)} {}
+    struct EndpointState final {
+        explicit EndpointState(const std::string& name) : name(name) {}
+
+        std::string name;
+        std::atomic<std::size_t> consecutive_failures{0};
+        std::atomic<std::size_t> ejections{0};
+        // steady_clock ticks
+        std::atomic<std::int64_t> ejected_until{0};
+        // exponentially weighted moving average, 0 until the first call
+        std::atomic<std::int64_t> latency_us{0};
+    };
+
+    StubPool(
+        utils::FixedArray<std::shared_ptr<grpc::Channel>>&& channels,
+        utils::FixedArray<StubAny>&& stubs,
+        utils::FixedArray<EndpointState>&& endpoints,
+        std::size_t channels_per_endpoint,
+        const OutlierDetectionSettings& outlier_detection
+    )
+        : channels_{std::move(channels)},
+          stubs_{std::move(stubs)},
+          in_flight_{stubs_.size(), std::size_t{0}},
+          endpoints_{std::move(endpoints)},
+          channels_per_endpoint_{channels_per_endpoint},
+          outlier_detection_{outlier_detection} {}
+
+    std::size_t PickEndpoint() const;
+
+    bool IsEndpointEjected(std::size_t endpoint, std::int64_t now) const;
+
+    bool CanEject(std::int64_t now) const;
+
+    void Eject(std::size_t endpoint, std::int64_t now) const;
 
     utils::FixedArray<std::shared_ptr<grpc::Channel>> channels_;
 
     mutable utils::FixedArray<StubAny> stubs_;
+
+    // Calls in flight per channel, including long-lived streams
+    mutable utils::FixedArray<std::atomic<std::size_t>> in_flight_;
+
+    mutable utils::FixedArray<EndpointState> endpoints_;
+    std::size_t channels_per_endpoint_{0};
+    OutlierDetectionSettings outlier_detection_;
 };
 
 }  // namespace ugrpc::client::impl
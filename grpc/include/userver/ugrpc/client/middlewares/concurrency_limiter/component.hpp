@@ -0,0 +1,67 @@
+#pragma once
+
+/// @file userver/ugrpc/client/middlewares/concurrency_limiter/component.hpp
+/// @brief @copybrief ugrpc::client::middlewares::concurrency_limiter::Component
+
+#include <memory>
+
+#include <userver/ugrpc/client/middlewares/base.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control {
+class ClientLimiters;
+}  // namespace congestion_control
+
+/// Client concurrency limiter middleware
+namespace ugrpc::client::middlewares::concurrency_limiter {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component for gRPC client adaptive concurrency limit
+///
+/// Each client gets its own congestion_control::ClientLimiter. The limit
+/// follows the latency gradient of the calls, calls above the limit fail
+/// immediately with ugrpc::client::ResourceExhaustedError without being sent.
+/// `DEADLINE_EXCEEDED`, `UNAVAILABLE` and `RESOURCE_EXHAUSTED` statuses
+/// decrease the limit.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// initial-limit | limit that is used before any latency is measured | 20
+/// min-limit | the limit is never decreased below this value | 1
+/// max-limit | the limit is never increased above this value | 1000
+/// smoothing | part of the new estimate applied to the limit on each call | 0.2
+/// rtt-tolerance | latency increase relative to the long-term latency that is not treated as queueing | 1.5
+/// long-window | number of calls in the long-term latency moving average | 600
+/// queue-size | number of calls allowed to queue at the destination | 4
+
+// clang-format on
+
+class Component final : public MiddlewareComponentBase {
+public:
+    /// @ingroup userver_component_names
+    /// @brief The default name of
+    /// ugrpc::client::middlewares::concurrency_limiter::Component
+    static constexpr std::string_view kName = "grpc-client-concurrency-limiter";
+
+    Component(const components::ComponentConfig& config, const components::ComponentContext& context);
+
+    ~Component() override;
+
+    std::shared_ptr<const MiddlewareFactoryBase> GetMiddlewareFactory() override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    const std::shared_ptr<congestion_control::ClientLimiters> limiters_;
+    utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace ugrpc::client::middlewares::concurrency_limiter
+
+USERVER_NAMESPACE_END
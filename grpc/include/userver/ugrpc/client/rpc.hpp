@@ -21,6 +21,7 @@
 #include <userver/ugrpc/client/impl/async_methods.hpp>
 #include <userver/ugrpc/client/impl/call_params.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
+#include <userver/ugrpc/impl/buffered_writes.hpp>
 #include <userver/ugrpc/impl/deadline_timepoint.hpp>
 #include <userver/ugrpc/impl/internal_tag_fwd.hpp>
 #include <userver/ugrpc/impl/statistics_scope.hpp>
@@ -278,6 +279,24 @@ public:
     ///         and the error details can be fetched from Finish
     [[nodiscard]] bool Write(const Request& request);
 
+    /// @brief Write the next outgoing message, allowing gRPC to coalesce it
+    /// with the following ones
+    ///
+    /// The message may be held in the gRPC buffers until the next `Write`,
+    /// `WriteAndCheck`, `WritesDone` or `Finish`, which flush it along with
+    /// themselves. At most ugrpc::impl::kMaxBufferedWrites consecutive messages
+    /// are held. Suitable for high-rate streams of small messages, where
+    /// waiting for every message to reach the wire would bound the throughput.
+    ///
+    /// `WriteBuffered` doesn't store any references to `request`, so it can be
+    /// deallocated right after the call.
+    ///
+    /// @param request the next message to write
+    /// @return true if the data is going to the wire; false if the write
+    ///         operation failed (including due to task cancellation),
+    ///         in which case no more writes will be accepted
+    [[nodiscard]] bool WriteBuffered(const Request& request);
+
     /// @brief Write the next outgoing message and check result
     ///
     /// `WriteAndCheck` doesn't store any references to `request`, so it can be
@@ -320,6 +339,7 @@ public:
 private:
     std::unique_ptr<Response> final_response_;
     impl::RawWriter<Request> stream_;
+    ugrpc::impl::BufferedWrites buffered_writes_;
 };
 
 /// @brief Controls a request stream -> response stream RPC
@@ -388,6 +408,24 @@ public:
     ///         but Read may still have some data and status code available
     [[nodiscard]] bool Write(const Request& request);
 
+    /// @brief Write the next outgoing message, allowing gRPC to coalesce it
+    /// with the following ones
+    ///
+    /// The message may be held in the gRPC buffers until the next `Write`,
+    /// `WriteAndCheck`, `WritesDone` or `Finish`, which flush it along with
+    /// themselves. At most ugrpc::impl::kMaxBufferedWrites consecutive messages
+    /// are held. Suitable for high-rate streams of small messages, where
+    /// waiting for every message to reach the wire would bound the throughput.
+    ///
+    /// `WriteBuffered` doesn't store any references to `request`, so it can be
+    /// deallocated right after the call.
+    ///
+    /// @param request the next message to write
+    /// @return true if the data is going to the wire; false if the write
+    ///         operation failed (including due to task cancellation),
+    ///         in which case no more writes will be accepted
+    [[nodiscard]] bool WriteBuffered(const Request& request);
+
     /// @brief Write the next outgoing message and check result
     ///
     /// `WriteAndCheck` doesn't store any references to `request`, so it can be
@@ -424,6 +462,7 @@ public:
 
 private:
     impl::RawReaderWriter<Request, Response> stream_;
+    ugrpc::impl::BufferedWrites buffered_writes_;
 };
 
 template <typename RPC>
@@ -592,7 +631,15 @@ bool OutputStream<Request, Response>::Write(const Request& request) {
 
     // Don't buffer writes, otherwise in an event subscription scenario, events
     // may never actually be delivered
-    grpc::WriteOptions write_options{};
+    const auto write_options = buffered_writes_.MakeWriteOptions(false);
+    return impl::Write(*stream_, request, write_options, GetData());
+}
+
+template <typename Request, typename Response>
+bool OutputStream<Request, Response>::WriteBuffered(const Request& request) {
+    impl::MiddlewarePipeline::PreSendMessage(GetData(), request);
+
+    const auto write_options = buffered_writes_.MakeWriteOptions(true);
     return impl::Write(*stream_, request, write_options, GetData());
 }
 
@@ -602,7 +649,7 @@ void OutputStream<Request, Response>::WriteAndCheck(const Request& request) {
 
     // Don't buffer writes, otherwise in an event subscription scenario, events
     // may never actually be delivered
-    grpc::WriteOptions write_options{};
+    const auto write_options = buffered_writes_.MakeWriteOptions(false);
     if (!impl::Write(*stream_, request, write_options, GetData())) {
         auto post_finish = [](impl::RpcData& data, const grpc::Status& status) {
             impl::MiddlewarePipeline::PostFinish(data, status);
@@ -647,7 +694,12 @@ StreamReadFuture<BidirectionalStream<Request, Response>> BidirectionalStream<Req
 ) noexcept {
     impl::ReadAsync(*stream_, response, GetData());
     auto post_recv_message = [&response](impl::RpcData& data) {
-        impl::MiddlewarePipeline::PostRecvMessage(data, response);
+        if constexpr (std::is_base_of_v<google::protobuf::Message, Response>) {
+            impl::MiddlewarePipeline::PostRecvMessage(data, response);
+        } else {
+            (void)data;
+            (void)response;
+        }
     };
     auto post_finish = [](impl::RpcData& data, const grpc::Status& status) {
         impl::MiddlewarePipeline::PostFinish(data, status);
@@ -664,19 +716,33 @@ bool BidirectionalStream<Request, Response>::Read(Response& response) {
 
 template <typename Request, typename Response>
 bool BidirectionalStream<Request, Response>::Write(const Request& request) {
-    impl::MiddlewarePipeline::PreSendMessage(GetData(), request);
+    if constexpr (std::is_base_of_v<google::protobuf::Message, Request>) {
+        impl::MiddlewarePipeline::PreSendMessage(GetData(), request);
+    }
 
     // Don't buffer writes, optimize for ping-pong-style interaction
-    grpc::WriteOptions write_options{};
+    const auto write_options = buffered_writes_.MakeWriteOptions(false);
+    return impl::Write(*stream_, request, write_options, GetData());
+}
+
+template <typename Request, typename Response>
+bool BidirectionalStream<Request, Response>::WriteBuffered(const Request& request) {
+    if constexpr (std::is_base_of_v<google::protobuf::Message, Request>) {
+        impl::MiddlewarePipeline::PreSendMessage(GetData(), request);
+    }
+
+    const auto write_options = buffered_writes_.MakeWriteOptions(true);
     return impl::Write(*stream_, request, write_options, GetData());
 }
 
 template <typename Request, typename Response>
 void BidirectionalStream<Request, Response>::WriteAndCheck(const Request& request) {
-    impl::MiddlewarePipeline::PreSendMessage(GetData(), request);
+    if constexpr (std::is_base_of_v<google::protobuf::Message, Request>) {
+        impl::MiddlewarePipeline::PreSendMessage(GetData(), request);
+    }
 
     // Don't buffer writes, optimize for ping-pong-style interaction
-    grpc::WriteOptions write_options{};
+    const auto write_options = buffered_writes_.MakeWriteOptions(false);
     impl::WriteAndCheck(*stream_, request, write_options, GetData());
 }
 
@@ -63,6 +63,11 @@ protected:
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// endpoint | URL of the gRPC service | --
+/// endpoints | URLs of the replicas of the gRPC service, balanced and ejected by userver instead of `endpoint`, see ugrpc::client::ClientSettings::endpoints | []
+/// outlier-detection.consecutive-failures | consecutive failed calls after which the endpoint is ejected | 5
+/// outlier-detection.base-ejection-time | ejection time, multiplied by the number of ejections in a row | 30s
+/// outlier-detection.max-ejection-time | upper bound for the ejection time | 5m
+/// outlier-detection.max-ejection-percent | max percentage of the endpoints that may be ejected at the same time | 50
 /// client-name | name of the gRPC server we talk to, for diagnostics | <uses the component name>
 /// dedicated-channel-counts | a map of rpc method names to channel counts. Used for high-load methods | -
 /// factory-component | ClientFactoryComponent name to use for client creation | --
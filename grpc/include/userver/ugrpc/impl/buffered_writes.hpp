@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+
+#include <grpcpp/impl/codegen/async_stream.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+/// The maximum number of consecutive buffered writes, the next write after
+/// them is flushed to the wire regardless
+inline constexpr std::size_t kMaxBufferedWrites = 64;
+
+/// Produces write options for a stream, tracking consecutive buffered writes
+class BufferedWrites final {
+public:
+    grpc::WriteOptions MakeWriteOptions(bool buffered) noexcept {
+        grpc::WriteOptions write_options{};
+        if (buffered && ++buffered_count_ < kMaxBufferedWrites) {
+            write_options.set_buffer_hint();
+        } else {
+            buffered_count_ = 0;
+        }
+        return write_options;
+    }
+
+private:
+    std::size_t buffered_count_{0};
+};
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -33,6 +34,12 @@ public:
 
     std::uint64_t GetStartedRequests() const;
 
+    /// Registers a writer of per-channel metrics of a single client.
+    utils::statistics::Entry RegisterChannelsWriter(
+        std::string_view client_name,
+        std::function<void(utils::statistics::Writer&)> writer
+    );
+
 private:
     // Pointer to service name from its metadata is used as a unique service ID
     using ServiceId = const char*;
@@ -79,6 +86,7 @@ private:
 
     void ExtendStatistics(utils::statistics::Writer& writer);
 
+    utils::statistics::Storage& statistics_storage_;
     const StatisticsDomain domain_;
     utils::statistics::StripedRateCounter global_started_;
     concurrent::Variable<
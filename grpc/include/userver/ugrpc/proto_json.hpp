@@ -4,11 +4,15 @@
 /// @brief Utilities for conversion Protobuf -> Json
 /// @ingroup userver_formats_serialize userver_formats_parse
 
+#include <string_view>
+#include <type_traits>
+
 #include <google/protobuf/struct.pb.h>
 #include <google/protobuf/util/json_util.h>
 
 #include <userver/formats/json.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -25,8 +29,40 @@ std::string ToString(const google::protobuf::Message& message);
 /// @throws formats::json::Exception
 std::string ToJsonString(const google::protobuf::Message& message);
 
+/// @brief Writes Json representation of protobuf message directly into the
+/// builder, without intermediate strings and formats::json::Value.
+///
+/// Follows the protobuf JSON mapping: fields are named by their `json_name`,
+/// 64-bit integers are written as strings, enums by names, bytes as base64.
+/// Fields without presence are always printed, just like in ToJsonString.
+/// Well-known types (google.protobuf.*) are delegated to the protobuf
+/// JSON printer.
+/// @throws formats::json::Exception
+void WriteJson(const google::protobuf::Message& message, formats::json::StringBuilder& sw);
+
+/// @brief Parses Json into the protobuf message with a SAX parser, without
+/// building formats::json::Value for the input.
+///
+/// Both `json_name` and the original field names are accepted, as well as
+/// the string representations of numbers and enums of the protobuf JSON
+/// mapping. Unknown fields are an error. Well-known types (google.protobuf.*)
+/// are delegated to the protobuf JSON parser.
+/// @throws formats::json::Exception
+void ParseJson(std::string_view json, google::protobuf::Message& message);
+
 }  // namespace ugrpc
 
+namespace formats::json {
+
+/// @brief SAX serialization of protobuf messages, see ugrpc::WriteJson
+template <typename Message>
+std::enable_if_t<std::is_base_of_v<google::protobuf::Message, Message>>
+WriteToStream(const Message& message, StringBuilder& sw) {
+    ugrpc::WriteJson(message, sw);
+}
+
+}  // namespace formats::json
+
 namespace formats::serialize {
 
 json::Value Serialize(const google::protobuf::Message& message, To<json::Value>);
@@ -7,6 +7,7 @@
 #include <type_traits>
 #include <utility>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/server_context.h>
@@ -111,6 +112,12 @@ public:
     explicit CallData(const MethodData<GrpcppService, CallTraits>& method_data)
         : wait_token_(method_data.service_data.wait_tokens.GetToken()), method_data_(method_data) {
         UASSERT(method_data.method_id < GetMethodsCount(method_data.service_data.metadata));
+
+        if constexpr (std::is_base_of_v<google::protobuf::Message, InitialRequest>) {
+            if (method_data.service_data.settings.use_arena) {
+                initial_request_ = google::protobuf::Arena::Create<InitialRequest>(&arena_.emplace());
+            }
+        }
     }
 
     void operator()() && {
@@ -127,7 +134,7 @@ public:
 
         // the request for an incoming RPC must be performed synchronously
         method_data_.service_data.async_service.template Prepare<CallTraits>(
-            method_data_.method_id, context_, initial_request_, raw_responder_, queue, queue, prepare_.GetTag()
+            method_data_.method_id, context_, *initial_request_, raw_responder_, queue, queue, prepare_.GetTag()
         );
 
         // Note: we ignore task cancellations here. Even if notify_when_done has
@@ -211,7 +218,7 @@ private:
                 CallContext context{responder};
                 if constexpr (CallTraits::kCallCategory == CallCategory::kUnary) {
                     auto result =
-                        (method_data_.service.*(method_data_.service_method))(context, std::move(initial_request_));
+                        (method_data_.service.*(method_data_.service_method))(context, std::move(*initial_request_));
                     Finalize(responder, std::move(result));
                 } else if constexpr (CallTraits::kCallCategory == CallCategory::kInputStream) {
                     auto result = (method_data_.service.*(method_data_.service_method))(context, responder);
@@ -219,7 +226,7 @@ private:
                 } else if constexpr (CallTraits::kCallCategory == CallCategory::kOutputStream) {
                     auto result =
                         (method_data_.service.*(method_data_.service_method)
-                        )(context, std::move(initial_request_), responder);
+                        )(context, std::move(*initial_request_), responder);
                     Finalize(responder, std::move(result));
                 } else if constexpr (CallTraits::kCallCategory == CallCategory::kBidirectionalStream) {
                     auto result = (method_data_.service.*(method_data_.service_method))(context, responder);
@@ -233,7 +240,7 @@ private:
         try {
             ::google::protobuf::Message* initial_request = nullptr;
             if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
-                initial_request = &initial_request_;
+                initial_request = initial_request_;
             }
 
             MiddlewareCallContext middleware_context(
@@ -264,7 +271,11 @@ private:
     MethodData<GrpcppService, CallTraits> method_data_;
 
     typename CallTraits::ContextType context_{};
-    InitialRequest initial_request_{};
+    // Request and all of its nested messages are allocated in the arena, if
+    // enabled, and are freed at once along with the call
+    std::optional<google::protobuf::Arena> arena_;
+    InitialRequest initial_request_storage_{};
+    InitialRequest* initial_request_{&initial_request_storage_};
     RawCall raw_responder_{&context_};
     ugrpc::impl::AsyncMethodInvocation prepare_;
     std::optional<tracing::InPlaceSpan> span_{};
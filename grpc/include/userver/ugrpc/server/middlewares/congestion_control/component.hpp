@@ -17,9 +17,27 @@ class Middleware;
 
 /// @ingroup userver_components userver_base_classes
 ///
-/// @brief Component for gRPC server logging
+/// @brief Component for gRPC server congestion control
 ///
-/// The component does **not** have any options for service config.
+/// Besides the global rate limit set by the congestion control, the calls
+/// may be limited per method:
+///
+/// - the number of concurrent calls of a method is limited by
+///   `max-concurrency-per-method`, the excess calls are rejected with
+///   `RESOURCE_EXHAUSTED`;
+/// - with `deadline-aware-rejection`, a call is rejected with
+///   `DEADLINE_EXCEEDED` right away if its remaining deadline is less than
+///   the expected service time, that is a percentile of the recent timings
+///   of the method.
+///
+/// The rejection happens before the handler and the request hooks run.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// max-concurrency-per-method | full method name (`package.Service/Method`) -> max number of concurrent calls map | {}
+/// deadline-aware-rejection | reject calls whose remaining deadline is less than the expected service time | false
+/// expected-service-time-percentile | percentile of the recent method timings used as the expected service time | 50
 ///
 /// ## Static configuration example:
 ///
@@ -38,6 +56,8 @@ public:
 
     std::shared_ptr<MiddlewareBase> GetMiddleware() override;
 
+    static yaml_config::Schema GetStaticConfigSchema();
+
 private:
     std::shared_ptr<Middleware> middleware_;
 };
@@ -29,6 +29,10 @@ struct Settings;
 /// msg-log-level | log level to use for request and response messages themselves | debug
 /// msg-size-log-limit | max message size to log, the rest will be truncated | 512
 /// trim-secrets | trim the secrets from logs as marked by the protobuf option | true (*)
+/// msg-sampling-period | log bodies of every N-th message of each method, the others are hidden | 1
+///
+/// Message bodies are formatted only if the record is going to be written, and the formatting stops
+/// as soon as `msg-size-log-limit` is reached.
 ///
 /// @warning * Trimming secrets causes a segmentation fault for messages that contain
 /// optional fields in protobuf versions prior to 3.13. You should set trim-secrets to false
@@ -7,6 +7,7 @@
 
 #include <userver/utils/assert.hpp>
 
+#include <userver/ugrpc/impl/buffered_writes.hpp>
 #include <userver/ugrpc/impl/deadline_timepoint.hpp>
 #include <userver/ugrpc/impl/internal_tag_fwd.hpp>
 #include <userver/ugrpc/impl/span.hpp>
@@ -140,6 +141,22 @@ public:
     /// @throws ugrpc::server::RpcError on an RPC error
     void Write(Response&& response) override;
 
+    /// @brief Write the next outgoing message, allowing gRPC to coalesce it
+    /// with the following ones
+    ///
+    /// The message may be held in the gRPC buffers until the next `Write`,
+    /// `Finish` or `WriteAndFinish`, which flush it along with themselves.
+    /// At most ugrpc::impl::kMaxBufferedWrites consecutive messages are held.
+    /// Suitable for high-rate streams of small messages, where waiting for
+    /// every message to reach the wire would bound the throughput.
+    ///
+    /// @param response the next message to write
+    /// @throws ugrpc::server::RpcError on an RPC error
+    void WriteBuffered(Response& response) override;
+
+    /// @copydoc WriteBuffered
+    void WriteBuffered(Response&& response) override;
+
     /// @brief Complete the RPC successfully
     ///
     /// `Finish` must not be called multiple times.
@@ -187,8 +204,11 @@ public:
 private:
     enum class State { kNew, kOpen, kFinished };
 
+    void DoWrite(Response& response, bool buffered);
+
     impl::RawWriter<Response>& stream_;
     State state_{State::kNew};
+    ugrpc::impl::BufferedWrites buffered_writes_;
 };
 
 /// @brief Controls a request stream -> response stream RPC
@@ -222,6 +242,22 @@ public:
     /// @throws ugrpc::server::RpcError on an RPC error
     void Write(Response&& response) override;
 
+    /// @brief Write the next outgoing message, allowing gRPC to coalesce it
+    /// with the following ones
+    ///
+    /// The message may be held in the gRPC buffers until the next `Write`,
+    /// `Finish` or `WriteAndFinish`, which flush it along with themselves.
+    /// At most ugrpc::impl::kMaxBufferedWrites consecutive messages are held.
+    /// Suitable for high-rate streams of small messages, where waiting for
+    /// every message to reach the wire would bound the throughput.
+    ///
+    /// @param response the next message to write
+    /// @throws ugrpc::server::RpcError on an RPC error
+    void WriteBuffered(Response& response) override;
+
+    /// @copydoc WriteBuffered
+    void WriteBuffered(Response&& response) override;
+
     /// @brief Complete the RPC successfully
     ///
     /// `Finish` must not be called multiple times.
@@ -267,9 +303,12 @@ public:
     bool IsFinished() const override;
 
 private:
+    void DoWrite(Response& response, bool buffered);
+
     impl::RawReaderWriter<Request, Response>& stream_;
     bool are_reads_done_{false};
     bool is_finished_{false};
+    ugrpc::impl::BufferedWrites buffered_writes_;
 };
 
 template <typename Response>
@@ -400,6 +439,23 @@ void OutputStream<Response>::Write(Response&& response) {
 
 template <typename Response>
 void OutputStream<Response>::Write(Response& response) {
+    // Don't buffer writes, otherwise in an event subscription scenario, events
+    // may never actually be delivered
+    DoWrite(response, false);
+}
+
+template <typename Response>
+void OutputStream<Response>::WriteBuffered(Response&& response) {
+    WriteBuffered(response);
+}
+
+template <typename Response>
+void OutputStream<Response>::WriteBuffered(Response& response) {
+    DoWrite(response, true);
+}
+
+template <typename Response>
+void OutputStream<Response>::DoWrite(Response& response, bool buffered) {
     UINVARIANT(state_ != State::kFinished, "'Write' called on a finished stream");
     ApplyResponseHook(&response);
 
@@ -407,10 +463,7 @@ void OutputStream<Response>::Write(Response& response) {
     // streams
     impl::SendInitialMetadataIfNew(stream_, GetCallName(), state_);
 
-    // Don't buffer writes, otherwise in an event subscription scenario, events
-    // may never actually be delivered
-    grpc::WriteOptions write_options{};
-
+    const auto write_options = buffered_writes_.MakeWriteOptions(buffered);
     impl::Write(stream_, response, write_options, GetCallName());
 }
 
@@ -505,13 +558,28 @@ void BidirectionalStream<Request, Response>::Write(Response&& response) {
 
 template <typename Request, typename Response>
 void BidirectionalStream<Request, Response>::Write(Response& response) {
+    // Don't buffer writes, optimize for ping-pong-style interaction
+    DoWrite(response, false);
+}
+
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::WriteBuffered(Response&& response) {
+    WriteBuffered(response);
+}
+
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::WriteBuffered(Response& response) {
+    DoWrite(response, true);
+}
+
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::DoWrite(Response& response, bool buffered) {
     UINVARIANT(!is_finished_, "'Write' called on a finished stream");
     if constexpr (std::is_base_of_v<google::protobuf::Message, Response>) {
         ApplyResponseHook(&response);
     }
 
-    // Don't buffer writes, optimize for ping-pong-style interaction
-    grpc::WriteOptions write_options{};
+    const auto write_options = buffered_writes_.MakeWriteOptions(buffered);
 
     try {
         impl::Write(stream_, response, write_options, GetCallName());
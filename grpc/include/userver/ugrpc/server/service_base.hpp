@@ -20,6 +20,12 @@ struct ServiceConfig final {
 
     /// Server middlewares to use for the gRPC service.
     Middlewares middlewares;
+
+    /// Allocate the request messages of RPCs in a per-call protobuf Arena, so
+    /// that the nested messages and strings of a request are freed at once at
+    /// the end of the call. Moving out of such a request copies it, handlers
+    /// should use it by reference.
+    bool use_arena{false};
 };
 
 /// @brief The type-erased base class for all gRPC service implementations
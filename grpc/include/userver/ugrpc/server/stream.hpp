@@ -3,6 +3,8 @@
 /// @file userver/ugrpc/server/stream.hpp
 /// @brief Server streaming interfaces
 
+#include <utility>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server {
@@ -20,6 +22,17 @@ public:
     /// @endcond
 
     /// @brief Await and read the next incoming message
+    ///
+    /// The previous contents of `request` are cleared before parsing, while
+    /// the memory allocated by its fields is kept. Reusing a single message
+    /// for all the reads of a stream avoids allocating the nested and
+    /// repeated fields anew for each message:
+    ///
+    /// @code
+    /// Request request;
+    /// while (reader.Read(request)) Process(request);
+    /// @endcode
+    ///
     /// @param request where to put the request on success
     /// @returns `true` on success, `false` on end-of-input
     /// @throws ugrpc::server::RpcError on an RPC error
@@ -47,6 +60,18 @@ public:
     /// @param response the next message to write
     /// @throws ugrpc::server::RpcError on an RPC error
     virtual void Write(Response&& response) = 0;
+
+    /// @brief Write the next outgoing message, allowing it to be coalesced
+    /// with the following ones
+    ///
+    /// By default, equivalent to `Write`.
+    ///
+    /// @param response the next message to write
+    /// @throws ugrpc::server::RpcError on an RPC error
+    virtual void WriteBuffered(Response& response) { Write(response); }
+
+    /// @copydoc WriteBuffered
+    virtual void WriteBuffered(Response&& response) { Write(std::move(response)); }
 };
 
 /// @brief Interface to both read and write messages.
@@ -66,6 +66,10 @@ public:
     /// Client middlewares can be modified before the first RegisterService call.
     void SetClientMiddlewareFactories(client::MiddlewareFactories middleware_factories);
 
+    /// Per-call arena for request messages, see server::ServiceConfig::use_arena.
+    /// Can be modified before the first RegisterService call.
+    void SetUseArena(bool use_arena);
+
     /// Modifies the internal dynamic configs storage. It is used by the server
     /// and clients, and is accessible through @ref GetConfigSource.
     /// Initially, the configs are filled with compile-time defaults.
@@ -94,6 +98,7 @@ private:
     server::Server server_;
     server::Middlewares server_middlewares_;
     client::MiddlewareFactories client_middleware_factories_;
+    bool use_arena_{false};
     bool middlewares_change_allowed_{true};
     testsuite::GrpcControl testsuite_;
     std::optional<std::string> endpoint_;
@@ -28,11 +28,18 @@ ClientFactory::ClientFactory(
 
 impl::ClientDependencies ClientFactory::MakeClientDependencies(ClientSettings&& settings) {
     UINVARIANT(!settings.client_name.empty(), "Client name is empty");
-    UINVARIANT(!settings.endpoint.empty(), "Client endpoint is empty");
+    if (settings.endpoints.empty()) {
+        UINVARIANT(!settings.endpoint.empty(), "Client endpoint is empty");
+        settings.endpoints.push_back(std::move(settings.endpoint));
+    }
+    for (const auto& endpoint : settings.endpoints) {
+        UINVARIANT(!endpoint.empty(), "Client endpoint is empty");
+    }
 
     return impl::ClientDependencies{
         settings.client_name,
-        settings.endpoint,
+        std::move(settings.endpoints),
+        settings.outlier_detection,
         impl::InstantiateMiddlewares(mws_, settings.client_name),
         completion_queues_,
         client_statistics_storage_,
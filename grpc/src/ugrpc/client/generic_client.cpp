@@ -44,6 +44,22 @@ client::ResponseFuture<grpc::ByteBuffer> GenericClient::AsyncUnaryCall(
     };
 }
 
+GenericStream GenericClient::Stream(
+    std::string_view call_name,
+    std::unique_ptr<grpc::ClientContext> context,
+    const GenericOptions& generic_options
+) const {
+    auto method_name = utils::StrCat<grpc::string>("/", call_name);
+    return {
+        impl::CreateGenericCallParams(
+            impl_, call_name, std::move(context), generic_options.qos, generic_options.metrics_call_name
+        ),
+        [&method_name](impl::ClientData::StubHandle& stub, grpc::ClientContext* context, grpc::CompletionQueue* cq) {
+            return stub.Get<grpc::GenericStub>().PrepareCall(context, method_name, cq);
+        },
+    };
+}
+
 grpc::ByteBuffer GenericClient::UnaryCall(
     std::string_view call_name,
     const grpc::ByteBuffer& request,
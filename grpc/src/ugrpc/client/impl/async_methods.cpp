@@ -73,6 +73,20 @@ void SetStatusDetailsForSpan(
     }
 }
 
+// Statuses that tell about the health of the endpoint rather than of the call
+bool IsEndpointFailure(grpc::StatusCode code) {
+    switch (code) {
+        case grpc::StatusCode::UNAVAILABLE:
+        case grpc::StatusCode::DEADLINE_EXCEEDED:
+        case grpc::StatusCode::INTERNAL:
+        case grpc::StatusCode::UNKNOWN:
+        case grpc::StatusCode::DATA_LOSS:
+            return true;
+        default:
+            return false;
+    }
+}
+
 }  // namespace
 
 RpcConfigValues::RpcConfigValues(const dynamic_config::Snapshot& config)
@@ -194,6 +208,14 @@ bool RpcData::IsDeadlinePropagated() const noexcept {
     return is_deadline_propagated_;
 }
 
+void RpcData::SetConcurrencyToken(congestion_control::ClientLimiter::Token&& token) noexcept {
+    concurrency_token_.emplace(std::move(token));
+}
+
+std::optional<congestion_control::ClientLimiter::Token> RpcData::ExtractConcurrencyToken() noexcept {
+    return std::exchange(concurrency_token_, std::nullopt);
+}
+
 void RpcData::SetWritesFinished() noexcept {
     UASSERT(context_);
     UASSERT(!writes_finished_);
@@ -273,6 +295,7 @@ void CheckOk(RpcData& data, AsyncMethodInvocation::WaitStatus status, std::strin
         data.SetFinished();
         data.GetStatsScope().OnNetworkError();
         data.GetStatsScope().Flush();
+        data.GetStub().AccountResult(/*failed=*/true, /*account_latency=*/false);
         SetErrorAndResetSpan(data, fmt::format("Network error at '{}'", stage));
         throw RpcInterruptedError(data.GetCallName(), stage);
     } else if (status == impl::AsyncMethodInvocation::WaitStatus::kCancelled) {
@@ -293,6 +316,9 @@ void ProcessFinish(RpcData& data, utils::function_ref<void(RpcData& data, const
 
     data.GetStatsScope().OnExplicitFinish(status.error_code());
     data.GetStatsScope().Flush();
+    data.GetStub().AccountResult(
+        IsEndpointFailure(status.error_code()), data.GetCallKind() == CallKind::kUnaryCall
+    );
 
     post_finish(data, status);
 
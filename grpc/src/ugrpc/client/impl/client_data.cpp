@@ -1,6 +1,9 @@
 #include <userver/ugrpc/client/impl/client_data.hpp>
 
+#include <string>
+
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <userver/ugrpc/client/client_qos.hpp>
 #include <userver/ugrpc/client/impl/completion_queue_pool.hpp>
@@ -10,7 +13,37 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client::impl {
 
-ClientData::~ClientData() { config_subscription_.Unsubscribe(); }
+namespace {
+
+void DumpChannelsInFlight(utils::statistics::Writer& writer, const StubPool& stubs, std::string_view method_name) {
+    for (std::size_t i = 0; i < stubs.Size(); ++i) {
+        const auto channel = std::to_string(i);
+        if (method_name.empty()) {
+            writer.ValueWithLabels(stubs.GetInFlight(i), utils::statistics::LabelView{"grpc_channel", channel});
+        } else {
+            writer.ValueWithLabels(stubs.GetInFlight(i), {{"grpc_channel", channel}, {"grpc_method", method_name}});
+        }
+    }
+}
+
+void DumpEndpoints(utils::statistics::Writer& writer, const StubPool& stubs) {
+    // A single endpoint is balanced by the gRPC resolver
+    if (stubs.GetEndpointsCount() < 2) return;
+
+    for (std::size_t i = 0; i < stubs.GetEndpointsCount(); ++i) {
+        const utils::statistics::LabelView label{"grpc_endpoint", stubs.GetEndpoint(i)};
+        writer["in-flight"].ValueWithLabels(stubs.GetEndpointInFlight(i), label);
+        writer["ejected"].ValueWithLabels(stubs.IsEndpointEjected(i) ? 1 : 0, label);
+        writer["latency-us"].ValueWithLabels(stubs.GetEndpointLatency(i).count(), label);
+    }
+}
+
+}  // namespace
+
+ClientData::~ClientData() {
+    channels_statistics_holder_.Unregister();
+    config_subscription_.Unsubscribe();
+}
 
 grpc::CompletionQueue& ClientData::NextQueue() const { return dependencies_.completion_queues.NextQueue(); }
 
@@ -34,15 +67,34 @@ ugrpc::impl::ServiceStatistics& ClientData::GetServiceStatistics() {
     return dependencies_.statistics_storage.GetServiceStatistics(GetMetadata(), dependencies_.client_name);
 }
 
-ChannelFactory ClientData::CreateChannelFactory(const ClientDependencies& dependencies) {
+utils::statistics::Entry ClientData::RegisterChannelsStatistics() {
+    return dependencies_.statistics_storage.RegisterChannelsWriter(
+        dependencies_.client_name,
+        [stub_state = stub_state_.get(), metadata = metadata_](utils::statistics::Writer& writer) {
+            const auto state = stub_state->Read();
+            auto in_flight = writer["in-flight"];
+            DumpChannelsInFlight(in_flight, state->stubs, {});
+            for (std::size_t method_id = 0; method_id < state->dedicated_stubs.size(); ++method_id) {
+                UASSERT(metadata);
+                DumpChannelsInFlight(in_flight, state->dedicated_stubs[method_id], GetMethodName(*metadata, method_id));
+            }
+            auto endpoints = writer["endpoints"];
+            DumpEndpoints(endpoints, state->stubs);
+        }
+    );
+}
+
+utils::FixedArray<ChannelFactory> ClientData::CreateChannelFactories(const ClientDependencies& dependencies) {
     auto credentials = dependencies.testsuite_grpc.IsTlsEnabled()
                            ? GetClientCredentials(dependencies.client_factory_settings, dependencies.client_name)
                            : grpc::InsecureChannelCredentials();
-    return ChannelFactory{
-        dependencies.channel_task_processor,
-        dependencies.endpoint,
-        std::move(credentials),
-        dependencies.client_factory_settings.channel_args};
+    return utils::GenerateFixedArray(dependencies.endpoints.size(), [&](std::size_t index) {
+        return ChannelFactory{
+            dependencies.channel_task_processor,
+            dependencies.endpoints[index],
+            credentials,
+            dependencies.client_factory_settings.channel_args};
+    });
 }
 
 }  // namespace ugrpc::client::impl
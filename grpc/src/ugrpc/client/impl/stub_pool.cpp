@@ -1,12 +1,153 @@
 #include <userver/ugrpc/client/impl/stub_pool.hpp>
 
+#include <algorithm>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
 #include <userver/utils/rand.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client::impl {
 
-StubAny& StubPool::NextStub() const { return stubs_[utils::RandRange(stubs_.size())]; }
+namespace {
+
+// New latency sample contributes 1/8 to the moving average
+constexpr std::int64_t kLatencyDecay = 8;
+
+std::int64_t SteadyTicks(std::chrono::steady_clock::time_point time_point) {
+    return std::chrono::duration_cast<std::chrono::steady_clock::duration>(time_point.time_since_epoch()).count();
+}
+
+}  // namespace
+
+std::size_t StubPool::AcquireStub() const {
+    UASSERT(stubs_.size() != 0);
+    const auto size = channels_per_endpoint_;
+    const auto first = (endpoints_.size() > 1 ? PickEndpoint() : 0) * size;
+
+    // Start from a random channel, so that equally loaded channels are picked
+    // uniformly
+    const auto start = utils::RandRange(size);
+    auto best = first + start;
+    auto best_in_flight = in_flight_[best].load(std::memory_order_relaxed);
+    for (std::size_t i = 1; i < size && best_in_flight != 0; ++i) {
+        const auto index = first + (start + i) % size;
+        const auto in_flight = in_flight_[index].load(std::memory_order_relaxed);
+        if (in_flight < best_in_flight) {
+            best = index;
+            best_in_flight = in_flight;
+        }
+    }
+
+    in_flight_[best].fetch_add(1, std::memory_order_relaxed);
+    return best;
+}
+
+void StubPool::ReleaseStub(std::size_t index) const noexcept {
+    UASSERT(in_flight_[index].load() != 0);
+    in_flight_[index].fetch_sub(1, std::memory_order_relaxed);
+}
+
+void StubPool::AccountResult(std::size_t index, bool failed, std::optional<std::chrono::microseconds> latency)
+    const noexcept {
+    // Nothing to balance over
+    if (endpoints_.size() < 2) return;
+
+    const auto endpoint = index / channels_per_endpoint_;
+    auto& state = endpoints_[endpoint];
+
+    if (latency) {
+        const auto sample = std::max<std::int64_t>(latency->count(), 1);
+        const auto average = state.latency_us.load(std::memory_order_relaxed);
+        state.latency_us.store(
+            average == 0 ? sample : average + (sample - average) / kLatencyDecay, std::memory_order_relaxed
+        );
+    }
+
+    if (!failed) {
+        state.consecutive_failures.store(0, std::memory_order_relaxed);
+        state.ejections.store(0, std::memory_order_relaxed);
+        return;
+    }
+
+    const auto threshold = std::max<std::size_t>(outlier_detection_.consecutive_failures, 1);
+    if (state.consecutive_failures.fetch_add(1, std::memory_order_relaxed) + 1 < threshold) return;
+    // Only one of the concurrently failed calls ejects the endpoint
+    if (state.consecutive_failures.exchange(0, std::memory_order_relaxed) < threshold) return;
+
+    const auto now = SteadyTicks(utils::datetime::SteadyNow());
+    if (IsEndpointEjected(endpoint, now) || !CanEject(now)) return;
+    Eject(endpoint, now);
+}
+
+std::size_t StubPool::GetEndpointInFlight(std::size_t endpoint) const {
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < channels_per_endpoint_; ++i) {
+        result += in_flight_[endpoint * channels_per_endpoint_ + i].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+bool StubPool::IsEndpointEjected(std::size_t endpoint) const {
+    return IsEndpointEjected(endpoint, SteadyTicks(utils::datetime::SteadyNow()));
+}
+
+std::size_t StubPool::PickEndpoint() const {
+    const auto size = endpoints_.size();
+    const auto now = SteadyTicks(utils::datetime::SteadyNow());
+
+    const auto first = utils::RandRange(size);
+    const auto second = (first + 1 + utils::RandRange(size - 1)) % size;
+    const auto first_ejected = IsEndpointEjected(first, now);
+    const auto second_ejected = IsEndpointEjected(second, now);
+
+    if (first_ejected && second_ejected) {
+        for (std::size_t i = 0; i < size; ++i) {
+            if (!IsEndpointEjected(i, now)) return i;
+        }
+        // Everything is ejected, the ejection gives nothing
+        return first;
+    }
+    if (first_ejected) return second;
+    if (second_ejected) return first;
+
+    // Weighted least request: the endpoint that is both less loaded and faster
+    // wins. Endpoints without calls yet have the minimal weight.
+    const auto score = [this](std::size_t endpoint) {
+        const auto latency = std::max<std::int64_t>(endpoints_[endpoint].latency_us.load(std::memory_order_relaxed), 1);
+        return (GetEndpointInFlight(endpoint) + 1) * static_cast<std::uint64_t>(latency);
+    };
+    return score(second) < score(first) ? second : first;
+}
+
+bool StubPool::IsEndpointEjected(std::size_t endpoint, std::int64_t now) const {
+    return endpoints_[endpoint].ejected_until.load(std::memory_order_relaxed) > now;
+}
+
+bool StubPool::CanEject(std::int64_t now) const {
+    std::size_t ejected = 0;
+    for (std::size_t i = 0; i < endpoints_.size(); ++i) {
+        if (IsEndpointEjected(i, now)) ++ejected;
+    }
+    return (ejected + 1) * 100 <= endpoints_.size() * outlier_detection_.max_ejection_percent;
+}
+
+void StubPool::Eject(std::size_t endpoint, std::int64_t now) const {
+    auto& state = endpoints_[endpoint];
+    const auto ejections = state.ejections.fetch_add(1, std::memory_order_relaxed) + 1;
+    const auto ejection_time = std::min(
+        outlier_detection_.base_ejection_time * static_cast<std::int64_t>(ejections),
+        outlier_detection_.max_ejection_time
+    );
+    state.ejected_until.store(
+        now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(ejection_time).count(),
+        std::memory_order_relaxed
+    );
+    LOG_WARNING() << "gRPC endpoint '" << state.name << "' is ejected for " << ejection_time.count()
+                  << "ms after " << outlier_detection_.consecutive_failures << " consecutive failures";
+}
 
 }  // namespace ugrpc::client::impl
 
@@ -0,0 +1,75 @@
+#include <userver/ugrpc/client/middlewares/concurrency_limiter/component.hpp>
+
+#include <ugrpc/client/middlewares/concurrency_limiter/middleware.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::middlewares::concurrency_limiter {
+
+Component::Component(const components::ComponentConfig& config, const components::ComponentContext& context)
+    : MiddlewareComponentBase(config, context),
+      limiters_(std::make_shared<congestion_control::ClientLimiters>(config.As<congestion_control::ClientLimiterConfig>())
+      ) {
+    auto& storage = context.FindComponent<components::StatisticsStorage>().GetStorage();
+    statistics_holder_ = storage.RegisterWriter(
+        "grpc.client.concurrency-limiter",
+        [this](utils::statistics::Writer& writer) { DumpMetric(writer, *limiters_); }
+    );
+}
+
+Component::~Component() { statistics_holder_.Unregister(); }
+
+std::shared_ptr<const MiddlewareFactoryBase> Component::GetMiddlewareFactory() {
+    return std::make_shared<MiddlewareFactory>(limiters_);
+}
+
+yaml_config::Schema Component::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<MiddlewareComponentBase>(R"(
+type: object
+description: gRPC client adaptive concurrency limiter component
+additionalProperties: false
+properties:
+    initial-limit:
+        type: integer
+        description: limit that is used before any latency is measured
+        defaultDescription: 20
+        minimum: 1
+    min-limit:
+        type: integer
+        description: the limit is never decreased below this value
+        defaultDescription: 1
+        minimum: 1
+    max-limit:
+        type: integer
+        description: the limit is never increased above this value
+        defaultDescription: 1000
+        minimum: 1
+    smoothing:
+        type: number
+        description: part of the new estimate applied to the limit on each call, (0, 1]
+        defaultDescription: 0.2
+    rtt-tolerance:
+        type: number
+        description: latency increase relative to the long-term latency that is not treated as queueing, >= 1
+        defaultDescription: 1.5
+    long-window:
+        type: integer
+        description: number of calls in the long-term latency moving average
+        defaultDescription: 600
+        minimum: 1
+    queue-size:
+        type: integer
+        description: number of calls allowed to queue at the destination
+        defaultDescription: 4
+        minimum: 0
+)");
+}
+
+}  // namespace ugrpc::client::middlewares::concurrency_limiter
+
+USERVER_NAMESPACE_END
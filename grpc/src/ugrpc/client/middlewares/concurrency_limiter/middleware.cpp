@@ -0,0 +1,57 @@
+#include "middleware.hpp"
+
+#include <ugrpc/impl/internal_tag.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/ugrpc/client/impl/async_methods.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::middlewares::concurrency_limiter {
+
+Middleware::Middleware(congestion_control::ClientLimiter& limiter) : limiter_(limiter) {}
+
+void Middleware::PreStartCall(MiddlewareCallContext& context) const {
+    auto token = limiter_.TryAcquire();
+    if (!token) {
+        context.GetSpan().AddTag("concurrency_limited", 1);
+        throw ResourceExhaustedError(
+            context.GetCallName(),
+            grpc::Status{grpc::StatusCode::RESOURCE_EXHAUSTED, "client concurrency limit exceeded"},
+            std::nullopt,
+            std::nullopt
+        );
+    }
+    context.GetData(ugrpc::impl::InternalTag{}).SetConcurrencyToken(std::move(*token));
+}
+
+void Middleware::PostFinish(MiddlewareCallContext& context, const grpc::Status& status) const {
+    // If the call is interrupted, PostFinish is not called and the token is
+    // released with the call without updating the limit
+    auto token = context.GetData(ugrpc::impl::InternalTag{}).ExtractConcurrencyToken();
+    if (!token) return;
+
+    switch (status.error_code()) {
+        case grpc::StatusCode::CANCELLED:
+            // Says nothing about the destination, release without updating the limit
+            break;
+        case grpc::StatusCode::DEADLINE_EXCEEDED:
+        case grpc::StatusCode::UNAVAILABLE:
+        case grpc::StatusCode::RESOURCE_EXHAUSTED:
+            token->OnDropped();
+            break;
+        default:
+            token->OnSuccess();
+            break;
+    }
+}
+
+MiddlewareFactory::MiddlewareFactory(std::shared_ptr<congestion_control::ClientLimiters> limiters)
+    : limiters_(std::move(limiters)) {}
+
+std::shared_ptr<const MiddlewareBase> MiddlewareFactory::GetMiddleware(std::string_view client_name) const {
+    return std::make_shared<Middleware>(limiters_->GetLimiter(client_name));
+}
+
+}  // namespace ugrpc::client::middlewares::concurrency_limiter
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+
+#include <userver/congestion_control/client_limiter.hpp>
+#include <userver/ugrpc/client/middlewares/base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::middlewares::concurrency_limiter {
+
+/// @brief middleware for gRPC client adaptive concurrency limit
+class Middleware final : public MiddlewareBase {
+public:
+    explicit Middleware(congestion_control::ClientLimiter& limiter);
+
+    void PreStartCall(MiddlewareCallContext& context) const override;
+
+    void PostFinish(MiddlewareCallContext& context, const grpc::Status& status) const override;
+
+private:
+    congestion_control::ClientLimiter& limiter_;
+};
+
+/// @cond
+class MiddlewareFactory final : public MiddlewareFactoryBase {
+public:
+    explicit MiddlewareFactory(std::shared_ptr<congestion_control::ClientLimiters> limiters);
+
+    std::shared_ptr<const MiddlewareBase> GetMiddleware(std::string_view client_name) const override;
+
+private:
+    const std::shared_ptr<congestion_control::ClientLimiters> limiters_;
+};
+/// @endcond
+
+}  // namespace ugrpc::client::middlewares::concurrency_limiter
+
+USERVER_NAMESPACE_END
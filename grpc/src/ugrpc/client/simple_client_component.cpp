@@ -19,6 +19,37 @@ properties:
     endpoint:
         type: string
         description: URL of the gRPC service
+    endpoints:
+        type: array
+        description: URLs of the replicas of the gRPC service, balanced and ejected by userver instead of 'endpoint'
+        defaultDescription: '[]'
+        items:
+            type: string
+            description: URL of a replica of the gRPC service
+    outlier-detection:
+        type: object
+        description: ejection of the failing 'endpoints'
+        additionalProperties: false
+        properties:
+            consecutive-failures:
+                type: integer
+                description: consecutive failed calls after which the endpoint is ejected
+                defaultDescription: 5
+                minimum: 1
+            base-ejection-time:
+                type: string
+                description: ejection time, multiplied by the number of ejections in a row
+                defaultDescription: 30s
+            max-ejection-time:
+                type: string
+                description: upper bound for the ejection time
+                defaultDescription: 5m
+            max-ejection-percent:
+                type: integer
+                description: max percentage of the endpoints that may be ejected at the same time
+                defaultDescription: 50
+                minimum: 0
+                maximum: 100
     client-name:
         type: string
         description: name of the gRPC server we talk to, for diagnostics
@@ -53,7 +84,21 @@ ClientSettings SimpleClientComponentAny::MakeClientSettings(
 ) {
     ClientSettings client_settings;
     client_settings.client_name = config["client-name"].As<std::string>(config.Name());
-    client_settings.endpoint = config["endpoint"].As<std::string>();
+    client_settings.endpoints = config["endpoints"].As<std::vector<std::string>>({});
+    if (client_settings.endpoints.empty()) {
+        client_settings.endpoint = config["endpoint"].As<std::string>();
+    }
+
+    const auto outlier_config = config["outlier-detection"];
+    auto& outlier_detection = client_settings.outlier_detection;
+    outlier_detection.consecutive_failures =
+        outlier_config["consecutive-failures"].As<std::size_t>(outlier_detection.consecutive_failures);
+    outlier_detection.base_ejection_time =
+        outlier_config["base-ejection-time"].As<std::chrono::milliseconds>(outlier_detection.base_ejection_time);
+    outlier_detection.max_ejection_time =
+        outlier_config["max-ejection-time"].As<std::chrono::milliseconds>(outlier_detection.max_ejection_time);
+    outlier_detection.max_ejection_percent =
+        outlier_config["max-ejection-percent"].As<std::size_t>(outlier_detection.max_ejection_percent);
     client_settings.client_qos = client_qos;
     client_settings.dedicated_methods_config =
         config["dedicated-channel-counts"].As<DedicatedMethodsConfig>(client_settings.dedicated_methods_config);
@@ -1,9 +1,16 @@
 #include <ugrpc/impl/logging.hpp>
 
+#include <algorithm>
 #include <memory>
 
+#include <fmt/compile.h>
+#include <fmt/format.h>
+#include <google/protobuf/io/zero_copy_stream.h>
+#include <google/protobuf/text_format.h>
+
 #include <userver/logging/log.hpp>
 #include <userver/utils/log.hpp>
+#include <userver/utils/text_light.hpp>
 
 #include <ugrpc/impl/protobuf_utils.hpp>
 
@@ -13,8 +20,61 @@ namespace ugrpc::impl {
 
 namespace {
 
+constexpr std::size_t kMinChunkSize = 64;
+
+// Refuses to provide buffers past the limit, which makes the printer drop
+// the rest of the output instead of formatting the whole message
+class LimitedStringOutputStream final : public google::protobuf::io::ZeroCopyOutputStream {
+public:
+    LimitedStringOutputStream(std::string& output, std::size_t limit) : output_(output), limit_(limit) {}
+
+    bool Next(void** data, int* size) override {
+        const auto old_size = output_.size();
+        if (old_size >= limit_) {
+            truncated_ = true;
+            return false;
+        }
+
+        output_.resize(std::min(limit_, std::max(old_size * 2, kMinChunkSize)));
+        *data = output_.data() + old_size;
+        *size = static_cast<int>(output_.size() - old_size);
+        return true;
+    }
+
+    void BackUp(int count) override { output_.resize(output_.size() - count); }
+
+    int64_t ByteCount() const override { return static_cast<int64_t>(output_.size()); }
+
+    bool IsTruncated() const { return truncated_; }
+
+private:
+    std::string& output_;
+    const std::size_t limit_;
+    bool truncated_{false};
+};
+
 std::string ToLimitedString(const google::protobuf::Message& message, std::size_t max_size) {
-    return utils::log::ToLimitedUtf8(message.Utf8DebugString(), max_size);
+    std::string result;
+    bool truncated = false;
+    {
+        LimitedStringOutputStream stream{result, max_size};
+        google::protobuf::TextFormat::Printer printer;
+        printer.SetUseUtf8StringEscaping(true);
+        printer.SetExpandAny(true);
+        printer.Print(message, &stream);
+        truncated = stream.IsTruncated();
+    }
+
+    if (!truncated) {
+        return utils::log::ToLimitedUtf8(result, max_size);
+    }
+
+    std::string_view view{result};
+    utils::text::utf8::TrimViewTruncatedEnding(view);
+    if (!utils::text::IsUtf8(view)) {
+        return "<Non utf-8>";
+    }
+    return fmt::format(FMT_COMPILE("{}...(truncated)"), view);
 }
 
 }  // namespace
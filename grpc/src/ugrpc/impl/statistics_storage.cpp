@@ -22,7 +22,7 @@ std::string_view ToString(StatisticsDomain domain) {
 }
 
 StatisticsStorage::StatisticsStorage(utils::statistics::Storage& statistics_storage, StatisticsDomain domain)
-    : domain_(domain) {
+    : statistics_storage_(statistics_storage), domain_(domain) {
     statistics_holder_ = statistics_storage.RegisterWriter(
         fmt::format("grpc.{}", ToString(domain)),
         [this](utils::statistics::Writer& writer) { ExtendStatistics(writer); }
@@ -75,6 +75,17 @@ StatisticsStorage::GetGenericStatistics(std::string_view call_name, std::optiona
     return iter->second;
 }
 
+utils::statistics::Entry StatisticsStorage::RegisterChannelsWriter(
+    std::string_view client_name,
+    std::function<void(utils::statistics::Writer&)> writer
+) {
+    return statistics_storage_.RegisterWriter(
+        fmt::format("grpc.{}.channels", ToString(domain_)),
+        std::move(writer),
+        {{"grpc_client", std::string{client_name}}}
+    );
+}
+
 void StatisticsStorage::ExtendStatistics(utils::statistics::Writer& writer) {
     MethodStatisticsSnapshot total{domain_};
 
@@ -1,9 +1,24 @@
 #include <userver/ugrpc/proto_json.hpp>
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <variant>
+
+#include <fmt/format.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
 #include <grpcpp/support/config.h>
 #include <boost/container/small_vector.hpp>
 
+#include <userver/crypto/base64.hpp>
+#include <userver/formats/json/parser/parser_json.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/numeric_cast.hpp>
+#include <userver/utils/overloaded.hpp>
+#include <userver/utils/text_light.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -20,6 +35,564 @@ const google::protobuf::util::JsonPrintOptions kOptions = []() {
 #endif
     return options;
 }();
+
+using google::protobuf::FieldDescriptor;
+using formats::json::parser::InternalParseError;
+
+bool IsWellKnownType(const google::protobuf::Descriptor& descriptor) {
+    return utils::text::StartsWith(descriptor.file()->name(), "google/protobuf/");
+}
+
+void WriteFloatingPoint(double value, formats::json::StringBuilder& sw) {
+    if (std::isnan(value)) {
+        sw.WriteString("NaN");
+    } else if (std::isinf(value)) {
+        sw.WriteString(value > 0 ? "Infinity" : "-Infinity");
+    } else {
+        sw.WriteDouble(value);
+    }
+}
+
+void WriteFloatingPoint(float value, formats::json::StringBuilder& sw) {
+    if (std::isfinite(value)) {
+        // Shortest representation that round-trips to the same float
+        sw.WriteRawString(fmt::format("{}", value));
+    } else {
+        WriteFloatingPoint(static_cast<double>(value), sw);
+    }
+}
+
+void WriteEnum(const FieldDescriptor& field, int number, formats::json::StringBuilder& sw) {
+    if (field.enum_type()->full_name() == "google.protobuf.NullValue") {
+        sw.WriteNull();
+        return;
+    }
+
+    const auto* value = field.enum_type()->FindValueByNumber(number);
+    if (value) {
+        sw.WriteString(value->name());
+    } else {
+        sw.WriteInt64(number);
+    }
+}
+
+void WriteMessage(const google::protobuf::Message& message, formats::json::StringBuilder& sw);
+
+// `index` is only used for repeated fields
+void WriteFieldValue(
+    const google::protobuf::Message& message,
+    const FieldDescriptor& field,
+    int index,
+    formats::json::StringBuilder& sw
+) {
+    const auto& reflection = *message.GetReflection();
+    const bool repeated = field.is_repeated();
+
+    switch (field.cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32:
+            sw.WriteInt64(
+                repeated ? reflection.GetRepeatedInt32(message, &field, index) : reflection.GetInt32(message, &field)
+            );
+            break;
+        case FieldDescriptor::CPPTYPE_UINT32:
+            sw.WriteUInt64(
+                repeated ? reflection.GetRepeatedUInt32(message, &field, index) : reflection.GetUInt32(message, &field)
+            );
+            break;
+        case FieldDescriptor::CPPTYPE_INT64:
+            sw.WriteString(std::to_string(
+                repeated ? reflection.GetRepeatedInt64(message, &field, index) : reflection.GetInt64(message, &field)
+            ));
+            break;
+        case FieldDescriptor::CPPTYPE_UINT64:
+            sw.WriteString(std::to_string(
+                repeated ? reflection.GetRepeatedUInt64(message, &field, index) : reflection.GetUInt64(message, &field)
+            ));
+            break;
+        case FieldDescriptor::CPPTYPE_DOUBLE:
+            WriteFloatingPoint(
+                repeated ? reflection.GetRepeatedDouble(message, &field, index) : reflection.GetDouble(message, &field),
+                sw
+            );
+            break;
+        case FieldDescriptor::CPPTYPE_FLOAT:
+            WriteFloatingPoint(
+                repeated ? reflection.GetRepeatedFloat(message, &field, index) : reflection.GetFloat(message, &field),
+                sw
+            );
+            break;
+        case FieldDescriptor::CPPTYPE_BOOL:
+            sw.WriteBool(
+                repeated ? reflection.GetRepeatedBool(message, &field, index) : reflection.GetBool(message, &field)
+            );
+            break;
+        case FieldDescriptor::CPPTYPE_ENUM:
+            WriteEnum(
+                field,
+                repeated ? reflection.GetRepeatedEnumValue(message, &field, index)
+                         : reflection.GetEnumValue(message, &field),
+                sw
+            );
+            break;
+        case FieldDescriptor::CPPTYPE_STRING: {
+            const auto value =
+                repeated ? reflection.GetRepeatedString(message, &field, index) : reflection.GetString(message, &field);
+            if (field.type() == FieldDescriptor::TYPE_BYTES) {
+                sw.WriteString(crypto::base64::Base64Encode(value));
+            } else {
+                sw.WriteString(value);
+            }
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+            WriteMessage(
+                repeated ? reflection.GetRepeatedMessage(message, &field, index)
+                         : reflection.GetMessage(message, &field),
+                sw
+            );
+            break;
+    }
+}
+
+void WriteMapKey(
+    const google::protobuf::Message& entry,
+    const FieldDescriptor& field,
+    formats::json::StringBuilder& sw
+) {
+    const auto& reflection = *entry.GetReflection();
+    switch (field.cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32:
+            sw.Key(std::to_string(reflection.GetInt32(entry, &field)));
+            break;
+        case FieldDescriptor::CPPTYPE_UINT32:
+            sw.Key(std::to_string(reflection.GetUInt32(entry, &field)));
+            break;
+        case FieldDescriptor::CPPTYPE_INT64:
+            sw.Key(std::to_string(reflection.GetInt64(entry, &field)));
+            break;
+        case FieldDescriptor::CPPTYPE_UINT64:
+            sw.Key(std::to_string(reflection.GetUInt64(entry, &field)));
+            break;
+        case FieldDescriptor::CPPTYPE_BOOL:
+            sw.Key(reflection.GetBool(entry, &field) ? "true" : "false");
+            break;
+        case FieldDescriptor::CPPTYPE_STRING:
+            sw.Key(reflection.GetString(entry, &field));
+            break;
+        default:
+            UINVARIANT(false, "Invalid protobuf map key type");
+    }
+}
+
+void WriteMessage(const google::protobuf::Message& message, formats::json::StringBuilder& sw) {
+    const auto& descriptor = *message.GetDescriptor();
+    if (IsWellKnownType(descriptor)) {
+        // Any, Timestamp, Struct etc. have special representations
+        sw.WriteRawString(ToJsonString(message));
+        return;
+    }
+
+    const auto& reflection = *message.GetReflection();
+    const formats::json::StringBuilder::ObjectGuard guard{sw};
+    for (int i = 0; i < descriptor.field_count(); ++i) {
+        const auto& field = *descriptor.field(i);
+
+        if (field.is_map()) {
+            sw.Key(field.json_name());
+            const formats::json::StringBuilder::ObjectGuard map_guard{sw};
+            const auto& key_field = *field.message_type()->field(0);
+            const auto& value_field = *field.message_type()->field(1);
+            for (int j = 0; j < reflection.FieldSize(message, &field); ++j) {
+                const auto& entry = reflection.GetRepeatedMessage(message, &field, j);
+                WriteMapKey(entry, key_field, sw);
+                WriteFieldValue(entry, value_field, -1, sw);
+            }
+        } else if (field.is_repeated()) {
+            sw.Key(field.json_name());
+            const formats::json::StringBuilder::ArrayGuard array_guard{sw};
+            for (int j = 0; j < reflection.FieldSize(message, &field); ++j) {
+                WriteFieldValue(message, field, j, sw);
+            }
+        } else if (!field.has_presence() || reflection.HasField(message, &field)) {
+            sw.Key(field.json_name());
+            WriteFieldValue(message, field, -1, sw);
+        }
+    }
+}
+
+using Scalar = std::variant<bool, std::int64_t, std::uint64_t, double, std::string_view>;
+
+template <typename T>
+T ToInteger(const Scalar& value) {
+    return std::visit(
+        utils::Overloaded{
+            [](bool) -> T { throw InternalParseError("integer was expected, but bool found"); },
+            [](std::int64_t number) -> T { return utils::numeric_cast<T>(number); },
+            [](std::uint64_t number) -> T { return utils::numeric_cast<T>(number); },
+            [](double number) -> T {
+                // 1e3 and 1.0 are valid integers in protobuf JSON mapping
+                if (std::trunc(number) != number || std::abs(number) >= 0x1p63) {
+                    throw InternalParseError("integer was expected, but " + std::to_string(number) + " found");
+                }
+                return utils::numeric_cast<T>(static_cast<std::int64_t>(number));
+            },
+            [](std::string_view str) -> T { return utils::FromString<T>(str); },
+        },
+        value
+    );
+}
+
+double ToFloatingPoint(const Scalar& value) {
+    return std::visit(
+        utils::Overloaded{
+            [](bool) -> double { throw InternalParseError("number was expected, but bool found"); },
+            [](std::string_view str) -> double {
+                if (str == "NaN") return std::numeric_limits<double>::quiet_NaN();
+                if (str == "Infinity") return std::numeric_limits<double>::infinity();
+                if (str == "-Infinity") return -std::numeric_limits<double>::infinity();
+                return utils::FromString<double>(str);
+            },
+            [](auto number) -> double { return static_cast<double>(number); },
+        },
+        value
+    );
+}
+
+bool ToBool(const Scalar& value) {
+    if (const auto* boolean = std::get_if<bool>(&value)) return *boolean;
+
+    // Map keys are always strings
+    const auto* str = std::get_if<std::string_view>(&value);
+    if (str && (*str == "true" || *str == "false")) return *str == "true";
+    throw InternalParseError("bool was expected");
+}
+
+std::string_view ToStringView(const Scalar& value) {
+    const auto* str = std::get_if<std::string_view>(&value);
+    if (!str) throw InternalParseError("string was expected");
+    return *str;
+}
+
+int ToEnumValue(const FieldDescriptor& field, const Scalar& value) {
+    if (const auto* str = std::get_if<std::string_view>(&value)) {
+        const auto* enum_value = field.enum_type()->FindValueByName(std::string{*str});
+        if (!enum_value) {
+            throw InternalParseError(
+                fmt::format("unknown value '{}' of enum {}", *str, field.enum_type()->full_name())
+            );
+        }
+        return enum_value->number();
+    }
+    return ToInteger<int>(value);
+}
+
+std::string ToBytes(const Scalar& value) {
+    const auto str = ToStringView(value);
+    // Both standard and URL-safe alphabets are allowed
+    if (str.find_first_of("-_") != std::string_view::npos) return crypto::base64::Base64UrlDecode(str);
+    return crypto::base64::Base64Decode(str);
+}
+
+// Sets a singular field or appends to a repeated one
+void SetField(google::protobuf::Message& message, const FieldDescriptor& field, const Scalar& value) {
+    const auto& reflection = *message.GetReflection();
+    const auto set = [&](auto setter, auto adder, auto converted) {
+        if (field.is_repeated()) {
+            (reflection.*adder)(&message, &field, converted);
+        } else {
+            (reflection.*setter)(&message, &field, converted);
+        }
+    };
+    using Reflection = google::protobuf::Reflection;
+
+    switch (field.cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32:
+            set(&Reflection::SetInt32, &Reflection::AddInt32, ToInteger<std::int32_t>(value));
+            break;
+        case FieldDescriptor::CPPTYPE_UINT32:
+            set(&Reflection::SetUInt32, &Reflection::AddUInt32, ToInteger<std::uint32_t>(value));
+            break;
+        case FieldDescriptor::CPPTYPE_INT64:
+            set(&Reflection::SetInt64, &Reflection::AddInt64, ToInteger<std::int64_t>(value));
+            break;
+        case FieldDescriptor::CPPTYPE_UINT64:
+            set(&Reflection::SetUInt64, &Reflection::AddUInt64, ToInteger<std::uint64_t>(value));
+            break;
+        case FieldDescriptor::CPPTYPE_DOUBLE:
+            set(&Reflection::SetDouble, &Reflection::AddDouble, ToFloatingPoint(value));
+            break;
+        case FieldDescriptor::CPPTYPE_FLOAT:
+            set(&Reflection::SetFloat, &Reflection::AddFloat, static_cast<float>(ToFloatingPoint(value)));
+            break;
+        case FieldDescriptor::CPPTYPE_BOOL:
+            set(&Reflection::SetBool, &Reflection::AddBool, ToBool(value));
+            break;
+        case FieldDescriptor::CPPTYPE_ENUM:
+            set(&Reflection::SetEnumValue, &Reflection::AddEnumValue, ToEnumValue(field, value));
+            break;
+        case FieldDescriptor::CPPTYPE_STRING: {
+            auto str = field.type() == FieldDescriptor::TYPE_BYTES ? ToBytes(value) : std::string{ToStringView(value)};
+            if (field.is_repeated()) {
+                reflection.AddString(&message, &field, std::move(str));
+            } else {
+                reflection.SetString(&message, &field, std::move(str));
+            }
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+            throw InternalParseError("object was expected");
+    }
+}
+
+const FieldDescriptor* FindField(const google::protobuf::Descriptor& descriptor, std::string_view key) {
+    for (int i = 0; i < descriptor.field_count(); ++i) {
+        const auto* field = descriptor.field(i);
+        if (field->json_name() == key || field->name() == key) return field;
+    }
+    return nullptr;
+}
+
+/// SAX parser that fills a protobuf message in place. Nested messages are
+/// parsed by child parsers, one per nesting level.
+class MessageParser final : public formats::json::parser::BaseParser,
+                            public formats::json::parser::Subscriber<formats::json::Value> {
+public:
+    void Reset(google::protobuf::Message& message) {
+        message_ = &message;
+        field_ = nullptr;
+        state_ = State::kStart;
+    }
+
+    void Null() override;
+    void Bool(bool value) override;
+    void Int64(std::int64_t value) override;
+    void Uint64(std::uint64_t value) override;
+    void Double(double value) override;
+    void String(std::string_view value) override;
+    void StartObject() override;
+    void Key(std::string_view key) override;
+    void EndObject() override;
+    void StartArray() override;
+    void EndArray() override;
+
+    void OnSend(formats::json::Value&& value) override;
+
+    std::string GetPathItem() const override { return field_ ? std::string{field_->json_name()} : std::string{}; }
+
+protected:
+    std::string Expected() const override;
+
+private:
+    enum class State { kStart, kKey, kValue, kArray, kMapKey, kMapValue };
+
+    const FieldDescriptor* GetValueField() const;
+    google::protobuf::Message& StartMessageValue();
+    formats::json::parser::BaseParser* PushWellKnownParser(bool is_null);
+    void SetScalar(const Scalar& value, std::string_view found);
+
+    google::protobuf::Message* message_{nullptr};
+    const FieldDescriptor* field_{nullptr};
+    google::protobuf::Message* map_entry_{nullptr};
+    const FieldDescriptor* map_value_field_{nullptr};
+    State state_{State::kStart};
+
+    std::unique_ptr<MessageParser> child_;
+    std::unique_ptr<formats::json::parser::JsonValueParser> well_known_parser_;
+    google::protobuf::Message* well_known_message_{nullptr};
+};
+
+void MessageParser::Null() {
+    if (auto* parser = PushWellKnownParser(true)) return parser->Null();
+
+    // null means the default value for a field, but not for an array item
+    if (state_ == State::kValue) {
+        state_ = State::kKey;
+        return;
+    }
+    Throw("null");
+}
+
+void MessageParser::Bool(bool value) {
+    if (auto* parser = PushWellKnownParser(false)) return parser->Bool(value);
+    SetScalar(value, "bool");
+}
+
+void MessageParser::Int64(std::int64_t value) {
+    if (auto* parser = PushWellKnownParser(false)) return parser->Int64(value);
+    SetScalar(value, "integer");
+}
+
+void MessageParser::Uint64(std::uint64_t value) {
+    if (auto* parser = PushWellKnownParser(false)) return parser->Uint64(value);
+    SetScalar(value, "integer");
+}
+
+void MessageParser::Double(double value) {
+    if (auto* parser = PushWellKnownParser(false)) return parser->Double(value);
+    SetScalar(value, "double");
+}
+
+void MessageParser::String(std::string_view value) {
+    if (auto* parser = PushWellKnownParser(false)) return parser->String(value);
+    SetScalar(value, "string");
+}
+
+void MessageParser::StartObject() {
+    if (auto* parser = PushWellKnownParser(false)) return parser->StartObject();
+
+    if (state_ == State::kStart) {
+        state_ = State::kKey;
+        return;
+    }
+    if (state_ == State::kValue && field_->is_map()) {
+        state_ = State::kMapKey;
+        return;
+    }
+
+    const auto* field = GetValueField();
+    if (!field || field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) Throw("object");
+
+    auto& message = StartMessageValue();
+    if (!child_) child_ = std::make_unique<MessageParser>();
+    child_->Reset(message);
+    parser_state_->PushParser(*child_);
+    child_->StartObject();
+}
+
+void MessageParser::Key(std::string_view key) {
+    if (state_ == State::kKey) {
+        field_ = FindField(*message_->GetDescriptor(), key);
+        if (!field_) throw InternalParseError(fmt::format("unknown field '{}'", key));
+        state_ = State::kValue;
+    } else if (state_ == State::kMapKey) {
+        map_entry_ = message_->GetReflection()->AddMessage(message_, field_);
+        const auto& entry_descriptor = *map_entry_->GetDescriptor();
+        SetField(*map_entry_, *entry_descriptor.field(0), key);
+        map_value_field_ = entry_descriptor.field(1);
+        state_ = State::kMapValue;
+    } else {
+        Throw(fmt::format("field '{}'", key));
+    }
+}
+
+void MessageParser::EndObject() {
+    if (state_ == State::kKey) {
+        parser_state_->PopMe(*this);
+    } else if (state_ == State::kMapKey) {
+        state_ = State::kKey;
+    } else {
+        Throw("'}'");
+    }
+}
+
+void MessageParser::StartArray() {
+    if (auto* parser = PushWellKnownParser(false)) return parser->StartArray();
+
+    if (state_ != State::kValue || !field_->is_repeated() || field_->is_map()) Throw("array");
+    state_ = State::kArray;
+}
+
+void MessageParser::EndArray() {
+    if (state_ != State::kArray) Throw("']'");
+    state_ = State::kKey;
+}
+
+void MessageParser::OnSend(formats::json::Value&& value) {
+    UASSERT(well_known_message_);
+    const auto status =
+        google::protobuf::util::JsonStringToMessage(formats::json::ToString(value), well_known_message_);
+    if (!status.ok()) throw InternalParseError(status.ToString());
+}
+
+std::string MessageParser::Expected() const {
+    switch (state_) {
+        case State::kStart:
+            return "object";
+        case State::kKey:
+            return "field name";
+        case State::kValue:
+            return "field value";
+        case State::kArray:
+            return "array item";
+        case State::kMapKey:
+            return "map key";
+        case State::kMapValue:
+            return "map value";
+    }
+    UINVARIANT(false, "Unexpected parser state");
+}
+
+// Returns the field whose value is expected next, if any
+const FieldDescriptor* MessageParser::GetValueField() const {
+    switch (state_) {
+        case State::kValue:
+            // Values of repeated fields are handled in kArray
+            return field_->is_repeated() ? nullptr : field_;
+        case State::kArray:
+            return field_;
+        case State::kMapValue:
+            return map_value_field_;
+        default:
+            return nullptr;
+    }
+}
+
+// Returns the message to fill in at the current position and switches to
+// waiting for the next key or item
+google::protobuf::Message& MessageParser::StartMessageValue() {
+    const auto& reflection = *message_->GetReflection();
+    switch (state_) {
+        case State::kValue:
+            state_ = State::kKey;
+            return *reflection.MutableMessage(message_, field_);
+        case State::kArray:
+            return *reflection.AddMessage(message_, field_);
+        case State::kMapValue:
+            state_ = State::kMapKey;
+            return *map_entry_->GetReflection()->MutableMessage(map_entry_, map_value_field_);
+        default:
+            UINVARIANT(false, "Unexpected parser state");
+    }
+}
+
+// Well-known types have special JSON representations, they are collected into
+// formats::json::Value and handed over to the protobuf JSON parser
+formats::json::parser::BaseParser* MessageParser::PushWellKnownParser(bool is_null) {
+    const auto* field = GetValueField();
+    if (!field || field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE ||
+        !IsWellKnownType(*field->message_type())) {
+        return nullptr;
+    }
+    // Only google.protobuf.Value has a meaningful null
+    if (is_null && field->message_type()->full_name() != "google.protobuf.Value") return nullptr;
+
+    well_known_message_ = &StartMessageValue();
+    well_known_parser_ = std::make_unique<formats::json::parser::JsonValueParser>();
+    well_known_parser_->Subscribe(*this);
+    parser_state_->PushParser(*well_known_parser_);
+    return well_known_parser_.get();
+}
+
+void MessageParser::SetScalar(const Scalar& value, std::string_view found) {
+    switch (state_) {
+        case State::kValue:
+            if (field_->is_repeated() || field_->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) break;
+            SetField(*message_, *field_, value);
+            state_ = State::kKey;
+            return;
+        case State::kArray:
+            SetField(*message_, *field_, value);
+            return;
+        case State::kMapValue:
+            SetField(*map_entry_, *map_value_field_, value);
+            state_ = State::kMapKey;
+            return;
+        default:
+            break;
+    }
+    Throw(std::string{found});
+}
+
 }  // namespace
 
 formats::json::Value MessageToJson(const google::protobuf::Message& message) {
@@ -40,6 +613,27 @@ std::string ToJsonString(const google::protobuf::Message& message) {
     return result;
 }
 
+void WriteJson(const google::protobuf::Message& message, formats::json::StringBuilder& sw) {
+    WriteMessage(message, sw);
+}
+
+void ParseJson(std::string_view json, google::protobuf::Message& message) {
+    message.Clear();
+
+    if (IsWellKnownType(*message.GetDescriptor())) {
+        const auto status = google::protobuf::util::JsonStringToMessage(std::string{json}, &message);
+        if (!status.ok()) throw formats::json::ParseException(status.ToString());
+        return;
+    }
+
+    MessageParser parser;
+    parser.Reset(message);
+
+    formats::json::parser::ParserState state;
+    state.PushParser(parser);
+    state.ProcessInput(json);
+}
+
 }  // namespace ugrpc
 
 namespace formats::serialize {
@@ -71,6 +71,7 @@ server::ServiceConfig ParseServiceConfig(
             value[kTaskProcessorKey], defaults.task_processor, context, ParseTaskProcessor
         ),
         /*middlewares=*/{},
+        /*use_arena=*/value["use-arena"].As<bool>(false),
     };
 }
 
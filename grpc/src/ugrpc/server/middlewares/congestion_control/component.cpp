@@ -1,5 +1,7 @@
 #include <userver/ugrpc/server/middlewares/congestion_control/component.hpp>
 
+#include <unordered_map>
+
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/congestion_control/component.hpp>
@@ -14,9 +16,20 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server::middlewares::congestion_control {
 
+Settings Parse(const yaml_config::YamlConfig& config, formats::parse::To<Settings>) {
+    Settings settings;
+    settings.max_concurrency_per_method =
+        config["max-concurrency-per-method"].As<std::unordered_map<std::string, std::size_t>>({});
+    settings.deadline_aware_rejection =
+        config["deadline-aware-rejection"].As<bool>(settings.deadline_aware_rejection);
+    settings.expected_service_time_percentile =
+        config["expected-service-time-percentile"].As<double>(settings.expected_service_time_percentile);
+    return settings;
+}
+
 Component::Component(const components::ComponentConfig& config, const components::ComponentContext& context)
     : MiddlewareComponentBase(config, context, MiddlewareDependencyBuilder().InGroup<groups::Core>()),
-      middleware_(std::make_shared<Middleware>()) {
+      middleware_(std::make_shared<Middleware>(config.As<Settings>())) {
     auto& cc_component = context.FindComponent<USERVER_NAMESPACE::congestion_control::Component>();
 
     auto& server_limiter = cc_component.GetServerLimiter();
@@ -29,6 +42,33 @@ Component::Component(const components::ComponentConfig& config, const components
 
 std::shared_ptr<MiddlewareBase> Component::GetMiddleware() { return middleware_; }
 
+yaml_config::Schema Component::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<MiddlewareComponentBase>(R"(
+type: object
+description: gRPC server congestion control middleware component
+additionalProperties: false
+properties:
+    max-concurrency-per-method:
+        type: object
+        properties: {}
+        additionalProperties:
+            type: integer
+            minimum: 1
+            description: max number of concurrent calls of the method
+        description: full method name (package.Service/Method) -> max number of concurrent calls map
+    deadline-aware-rejection:
+        type: boolean
+        description: |
+            reject calls whose remaining deadline is less than the expected
+            service time of the method
+    expected-service-time-percentile:
+        type: number
+        minimum: 0
+        maximum: 100
+        description: percentile of the recent method timings used as the expected service time
+)");
+}
+
 }  // namespace ugrpc::server::middlewares::congestion_control
 
 USERVER_NAMESPACE_END
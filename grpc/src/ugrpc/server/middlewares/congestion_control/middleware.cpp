@@ -1,5 +1,8 @@
 #include "middleware.hpp"
 
+#include <userver/logging/log.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
 #include <ugrpc/impl/rpc_metadata.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -8,6 +11,9 @@ namespace ugrpc::server::middlewares::congestion_control {
 
 namespace {
 
+// The expected service time is recomputed from the timings at most this often
+constexpr std::chrono::seconds kExpectedTimeUpdatePeriod{1};
+
 bool CheckRatelimit(utils::TokenBucket& rate_limit, std::string_view call_name) {
     if (rate_limit.Obtain()) {
         return true;
@@ -21,8 +27,49 @@ bool CheckRatelimit(utils::TokenBucket& rate_limit, std::string_view call_name)
     return false;
 }
 
+void AddRatelimitMetadata(CallAnyBase& call) {
+    auto& server_context = call.GetContext();
+    server_context.AddInitialMetadata(ugrpc::impl::kXYaTaxiRatelimitedBy, ugrpc::impl::kHostname);
+    server_context.AddInitialMetadata(
+        ugrpc::impl::kXYaTaxiRatelimitReason, ugrpc::impl::kCongestionControlRatelimitReason
+    );
+}
+
 }  // namespace
 
+struct Middleware::MethodState final {
+    using Percentile = utils::statistics::Percentile<2000, std::uint32_t, 256, 100>;
+
+    explicit MethodState(std::optional<std::size_t> max_concurrency) : max_concurrency(max_concurrency) {}
+
+    std::chrono::milliseconds GetExpectedTime(double percentile) {
+        const auto now = std::chrono::steady_clock::now();
+        auto updated_at = expected_time_updated_at.load(std::memory_order_relaxed);
+        if (now - updated_at >= kExpectedTimeUpdatePeriod &&
+            expected_time_updated_at.compare_exchange_strong(updated_at, now)) {
+            const auto stats = timings.GetStatsForPeriod(decltype(timings)::Duration::min(), true);
+            expected_time.store(std::chrono::milliseconds{stats.GetPercentile(percentile)}, std::memory_order_relaxed);
+        }
+        return expected_time.load(std::memory_order_relaxed);
+    }
+
+    const std::optional<std::size_t> max_concurrency;
+    std::atomic<std::size_t> in_flight{0};
+
+    utils::statistics::RecentPeriod<Percentile, Percentile> timings;
+    std::atomic<std::chrono::milliseconds> expected_time{std::chrono::milliseconds{0}};
+    std::atomic<std::chrono::steady_clock::time_point> expected_time_updated_at{{}};
+};
+
+Middleware::Middleware(Settings settings) : settings_(std::move(settings)) {
+    auto method_states = method_states_.Lock();
+    for (const auto& [call_name, max_concurrency] : settings_.max_concurrency_per_method) {
+        method_states->emplace(call_name, std::make_unique<MethodState>(max_concurrency));
+    }
+}
+
+Middleware::~Middleware() = default;
+
 void Middleware::SetLimit(std::optional<size_t> new_limit) {
     if (new_limit) {
         const auto rps_val = *new_limit;
@@ -42,21 +89,89 @@ void Middleware::Handle(MiddlewareCallContext& context) const {
     auto& call = context.GetCall();
 
     if (!CheckRatelimit(rate_limit_, context.GetCall().GetCallName())) {
-        auto& server_context = context.GetCall().GetContext();
-
-        server_context.AddInitialMetadata(ugrpc::impl::kXYaTaxiRatelimitedBy, ugrpc::impl::kHostname);
-        server_context.AddInitialMetadata(
-            ugrpc::impl::kXYaTaxiRatelimitReason, ugrpc::impl::kCongestionControlRatelimitReason
-        );
-
+        AddRatelimitMetadata(call);
         call.FinishWithError(grpc::Status{
             grpc::StatusCode::RESOURCE_EXHAUSTED, "Congestion control: rate limit exceeded"});
         return;
     }
 
+    auto* state = GetMethodState(call.GetCallName());
+    if (!state) {
+        context.Next();
+        return;
+    }
+
+    if (!CheckDeadline(context, *state) || !CheckConcurrency(context, *state)) {
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const utils::FastScopeGuard guard{[state, start]() noexcept {
+        state->in_flight.fetch_sub(1, std::memory_order_relaxed);
+        const auto timing = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start
+        );
+        state->timings.GetCurrentCounter().Account(timing.count());
+    }};
+
     context.Next();
 }
 
+Middleware::MethodState* Middleware::GetMethodState(std::string_view call_name) const {
+    {
+        const auto method_states = method_states_.SharedLock();
+        if (const auto* state = utils::impl::FindTransparentOrNullptr(*method_states, call_name)) {
+            return state->get();
+        }
+    }
+
+    // Timings of all the methods are required for deadline-aware rejection
+    if (!settings_.deadline_aware_rejection) return nullptr;
+
+    auto method_states = method_states_.Lock();
+    const auto [iter, is_new] =
+        method_states->try_emplace(std::string{call_name}, std::make_unique<MethodState>(std::nullopt));
+    return iter->second.get();
+}
+
+bool Middleware::CheckConcurrency(MiddlewareCallContext& context, MethodState& state) const {
+    const auto in_flight = state.in_flight.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (!state.max_concurrency || in_flight <= *state.max_concurrency) {
+        return true;
+    }
+    state.in_flight.fetch_sub(1, std::memory_order_relaxed);
+
+    auto& call = context.GetCall();
+    LOG_LIMITED_WARNING() << "Request throttled (congestion control, method concurrency limit), "
+                          << "limit=" << *state.max_concurrency << ", "
+                          << "service/method=" << call.GetCallName();
+
+    AddRatelimitMetadata(call);
+    call.FinishWithError(grpc::Status{
+        grpc::StatusCode::RESOURCE_EXHAUSTED, "Congestion control: method concurrency limit exceeded"});
+    return false;
+}
+
+bool Middleware::CheckDeadline(MiddlewareCallContext& context, MethodState& state) const {
+    if (!settings_.deadline_aware_rejection) return true;
+
+    auto& call = context.GetCall();
+    const auto deadline = call.GetContext().deadline();
+    if (deadline == std::chrono::system_clock::time_point::max()) return true;
+
+    const auto expected_time = state.GetExpectedTime(settings_.expected_service_time_percentile);
+    const auto time_left = deadline - std::chrono::system_clock::now();
+    if (time_left >= expected_time) return true;
+
+    LOG_LIMITED_WARNING() << "Request rejected (congestion control, deadline is shorter than the expected "
+                             "service time), expected_time="
+                          << expected_time.count() << "ms, service/method=" << call.GetCallName();
+
+    call.FinishWithError(grpc::Status{
+        grpc::StatusCode::DEADLINE_EXCEEDED, "Congestion control: deadline is shorter than the expected service time"});
+    return false;
+}
+
 }  // namespace ugrpc::server::middlewares::congestion_control
 
 USERVER_NAMESPACE_END
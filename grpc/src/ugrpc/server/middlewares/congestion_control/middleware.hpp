@@ -1,21 +1,61 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/shared_mutex.hpp>
 #include <userver/server/congestion_control/limiter.hpp>
 #include <userver/ugrpc/server/middlewares/base.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
 #include <userver/utils/token_bucket.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server::middlewares::congestion_control {
 
+struct Settings final {
+    // Full method name -> max number of concurrent calls of the method
+    std::unordered_map<std::string, std::size_t> max_concurrency_per_method;
+
+    // Reject calls whose remaining deadline is less than the expected service
+    // time of the method
+    bool deadline_aware_rejection{false};
+
+    // Percentile of the recent method timings used as the expected service time
+    double expected_service_time_percentile{50};
+};
+
 class Middleware final : public MiddlewareBase, public USERVER_NAMESPACE::server::congestion_control::Limitee {
 public:
+    explicit Middleware(Settings settings = {});
+    ~Middleware() override;
+
     void Handle(MiddlewareCallContext& context) const override;
 
     void SetLimit(std::optional<size_t> new_limit) override;
 
 private:
+    struct MethodState;
+
+    MethodState* GetMethodState(std::string_view call_name) const;
+
+    bool CheckConcurrency(MiddlewareCallContext& context, MethodState& state) const;
+
+    bool CheckDeadline(MiddlewareCallContext& context, MethodState& state) const;
+
+    const Settings settings_;
     mutable utils::TokenBucket rate_limit_{utils::TokenBucket::MakeUnbounded()};
+    mutable concurrent::Variable<
+        utils::impl::TransparentMap<std::string, std::unique_ptr<MethodState>>,
+        engine::SharedMutex>
+        method_states_;
 };
 
 }  // namespace ugrpc::server::middlewares::congestion_control
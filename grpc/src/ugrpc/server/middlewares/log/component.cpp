@@ -19,6 +19,7 @@ Settings Parse(const yaml_config::YamlConfig& config, formats::parse::To<Setting
     settings.msg_log_level = config["msg-log-level"].As<logging::Level>(settings.msg_log_level);
     settings.max_msg_size = config["msg-size-log-limit"].As<std::size_t>(settings.max_msg_size);
     settings.trim_secrets = config["trim-secrets"].As<bool>(settings.trim_secrets);
+    settings.msg_sampling_period = config["msg-sampling-period"].As<std::size_t>(settings.msg_sampling_period);
     return settings;
 }
 
@@ -51,6 +52,10 @@ properties:
             trim the secrets from logs as marked by the protobuf option.
             you should set this to false if the responses contain
             optional fields and you are using protobuf prior to 3.13
+    msg-sampling-period:
+        type: integer
+        description: log bodies of every N-th message of each method, the others are hidden
+        minimum: 1
 )");
 }
 
@@ -1,6 +1,7 @@
 #include "middleware.hpp"
 
 #include <userver/logging/level_serialization.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/logging/log_extra.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
@@ -22,13 +23,6 @@ bool IsResponseStream(CallKind kind) {
     return kind == CallKind::kResponseStream || kind == CallKind::kBidirectionalStream;
 }
 
-std::string GetMessageForLogging(const google::protobuf::Message& message, const Settings& settings) {
-    return ugrpc::impl::GetMessageForLogging(
-        message,
-        ugrpc::impl::MessageLoggingOptions{settings.msg_log_level, settings.max_msg_size, settings.trim_secrets}
-    );
-}
-
 }  // namespace
 
 Middleware::Middleware(const Settings& settings) : settings_(settings) {}
@@ -36,15 +30,22 @@ Middleware::Middleware(const Settings& settings) : settings_(settings) {}
 void Middleware::CallRequestHook(const MiddlewareCallContext& context, google::protobuf::Message& request) {
     auto& storage = context.GetCall().GetStorageContext();
     auto& span = context.GetCall().GetSpan();
-    logging::LogExtra log_extra{{"grpc_type", "request"}, {"body", GetMessageForLogging(request, settings_)}};
 
-    if (storage.Get(kIsFirstRequest)) {
+    const bool is_first_request = storage.Get(kIsFirstRequest);
+    if (is_first_request) {
         storage.Set(kIsFirstRequest, false);
+    }
 
-        const auto call_kind = context.GetCall().GetCallKind();
-        if (!IsRequestStream(call_kind)) {
-            log_extra.Extend("type", "request");
-        }
+    // Formatting the body is the expensive part, skip it if the record is dropped anyway
+    if (!logging::ShouldLog(span.GetLogLevel())) return;
+
+    const auto call_name = context.GetCall().GetCallName();
+    logging::LogExtra log_extra{
+        {"grpc_type", "request"},
+        {"body", GetMessageForLogging(call_name, MessageKind::kRequest, request)},
+    };
+    if (is_first_request && !IsRequestStream(context.GetCall().GetCallKind())) {
+        log_extra.Extend("type", "request");
     }
     LOG(span.GetLogLevel()) << "gRPC request message" << std::move(log_extra);
 }
@@ -52,12 +53,18 @@ void Middleware::CallRequestHook(const MiddlewareCallContext& context, google::p
 void Middleware::CallResponseHook(const MiddlewareCallContext& context, google::protobuf::Message& response) {
     auto& span = context.GetCall().GetSpan();
     const auto call_kind = context.GetCall().GetCallKind();
+    const auto call_name = context.GetCall().GetCallName();
 
     if (!IsResponseStream(call_kind)) {
         span.AddTag("grpc_type", "response");
-        span.AddNonInheritableTag("body", GetMessageForLogging(response, settings_));
-    } else {
-        logging::LogExtra log_extra{{"grpc_type", "response"}, {"body", GetMessageForLogging(response, settings_)}};
+        if (span.ShouldLogDefault()) {
+            span.AddNonInheritableTag("body", GetMessageForLogging(call_name, MessageKind::kResponse, response));
+        }
+    } else if (logging::ShouldLog(span.GetLogLevel())) {
+        logging::LogExtra log_extra{
+            {"grpc_type", "response"},
+            {"body", GetMessageForLogging(call_name, MessageKind::kResponse, response)},
+        };
         LOG(span.GetLogLevel()) << "gRPC response message" << std::move(log_extra);
     }
 }
@@ -100,6 +107,47 @@ void Middleware::Handle(MiddlewareCallContext& context) const {
     context.Next();
 }
 
+std::string Middleware::GetMessageForLogging(
+    std::string_view call_name,
+    MessageKind kind,
+    const google::protobuf::Message& message
+) const {
+    if (!logging::ShouldLog(settings_.msg_log_level)) {
+        return "hidden by log level";
+    }
+    if (!IsSampled(call_name, kind)) {
+        return "hidden by sampling";
+    }
+
+    return ugrpc::impl::GetMessageForLogging(
+        message,
+        ugrpc::impl::MessageLoggingOptions{settings_.msg_log_level, settings_.max_msg_size, settings_.trim_secrets}
+    );
+}
+
+// Bodies of every msg_sampling_period-th message are logged, separately for each method,
+// so that rarely called methods are not drowned out by the frequent ones
+bool Middleware::IsSampled(std::string_view call_name, MessageKind kind) const {
+    if (settings_.msg_sampling_period <= 1) return true;
+
+    MethodCounters* counters = nullptr;
+    {
+        const auto message_counters = message_counters_.SharedLock();
+        if (const auto* found = utils::impl::FindTransparentOrNullptr(*message_counters, call_name)) {
+            counters = found->get();
+        }
+    }
+    if (!counters) {
+        auto message_counters = message_counters_.Lock();
+        const auto [iter, is_new] =
+            message_counters->try_emplace(std::string{call_name}, std::make_unique<MethodCounters>());
+        counters = iter->second.get();
+    }
+
+    auto& counter = kind == MessageKind::kRequest ? counters->requests : counters->responses;
+    return counter.fetch_add(1, std::memory_order_relaxed) % settings_.msg_sampling_period == 0;
+}
+
 }  // namespace ugrpc::server::middlewares::log
 
 USERVER_NAMESPACE_END
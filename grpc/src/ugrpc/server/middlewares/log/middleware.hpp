@@ -1,12 +1,20 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
 
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/shared_mutex.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/ugrpc/server/middlewares/base.hpp>
 #include <userver/ugrpc/server/storage_context.hpp>
 #include <userver/utils/any_storage.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -20,6 +28,7 @@ struct Settings final {
     logging::Level msg_log_level{logging::Level::kDebug};
     std::size_t max_msg_size{512};
     bool trim_secrets{true};
+    std::size_t msg_sampling_period{1};
 };
 
 Settings Parse(const yaml_config::YamlConfig& config, formats::parse::To<Settings>);
@@ -35,7 +44,25 @@ public:
     void CallResponseHook(const MiddlewareCallContext& context, google::protobuf::Message& response) override;
 
 private:
+    enum class MessageKind { kRequest, kResponse };
+
+    struct MethodCounters final {
+        std::atomic<std::uint64_t> requests{0};
+        std::atomic<std::uint64_t> responses{0};
+    };
+
+    using MessageCounters = utils::impl::TransparentMap<std::string, std::unique_ptr<MethodCounters>>;
+
+    std::string GetMessageForLogging(
+        std::string_view call_name,
+        MessageKind kind,
+        const google::protobuf::Message& message
+    ) const;
+
+    bool IsSampled(std::string_view call_name, MessageKind kind) const;
+
     Settings settings_;
+    mutable concurrent::Variable<MessageCounters, engine::SharedMutex> message_counters_;
 };
 
 }  // namespace ugrpc::server::middlewares::log
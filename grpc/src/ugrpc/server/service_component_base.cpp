@@ -50,6 +50,12 @@ properties:
         type: string
         description: the task processor to use for responses
         defaultDescription: uses grpc-server.service-defaults.task-processor
+    use-arena:
+        type: boolean
+        description: |
+            allocate request messages of each RPC in a protobuf Arena that is
+            destroyed at the end of the call
+        defaultDescription: false
     disable-user-pipeline-middlewares:
         type: boolean
         description: flag to disable groups::User middlewares from pipeline
@@ -34,6 +34,7 @@ server::ServiceConfig ServiceBase::MakeServiceConfig() {
     return server::ServiceConfig{
         engine::current_task::GetTaskProcessor(),
         server_middlewares_,
+        use_arena_,
     };
 }
 
@@ -90,6 +91,11 @@ void ServiceBase::SetClientMiddlewareFactories(client::MiddlewareFactories middl
     client_middleware_factories_ = std::move(middleware_factories);
 }
 
+void ServiceBase::SetUseArena(bool use_arena) {
+    UINVARIANT(middlewares_change_allowed_, "Set use arena after RegisterService call is not allowed");
+    use_arena_ = use_arena;
+}
+
 client::ClientFactory& ServiceBase::GetClientFactory() {
     UINVARIANT(client_factory_, "Server is not either not yet started, or already stopped");
     return *client_factory_;
@@ -0,0 +1,82 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string GetAllocation(const google::protobuf::Message& message) {
+    return message.GetArena() ? "arena" : "heap";
+}
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& /*context*/, sample::ugrpc::GreetingRequest&& request) override {
+        sample::ugrpc::GreetingResponse response;
+        response.set_name(GetAllocation(request));
+        return response;
+    }
+
+    ReadManyResult ReadMany(
+        CallContext& /*context*/,
+        sample::ugrpc::StreamGreetingRequest&& request,
+        ReadManyWriter& writer
+    ) override {
+        sample::ugrpc::StreamGreetingResponse response;
+        response.set_name(GetAllocation(request));
+        writer.Write(response);
+        return grpc::Status::OK;
+    }
+};
+
+template <bool UseArena>
+class ArenaServiceFixture : public ugrpc::tests::ServiceFixtureBase {
+protected:
+    ArenaServiceFixture() {
+        SetUseArena(UseArena);
+        RegisterService(service_);
+        StartServer();
+    }
+
+    ~ArenaServiceFixture() override { StopServer(); }
+
+private:
+    UnitTestService service_;
+};
+
+using GrpcArenaTest = ArenaServiceFixture<true>;
+using GrpcNoArenaTest = ArenaServiceFixture<false>;
+
+}  // namespace
+
+UTEST_F(GrpcArenaTest, UnaryRequest) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::GreetingRequest request;
+    request.set_name("userver");
+    EXPECT_EQ(client.SayHello(request).name(), "arena");
+}
+
+UTEST_F(GrpcArenaTest, StreamInitialRequest) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::StreamGreetingRequest request;
+    request.set_name("userver");
+    auto stream = client.ReadMany(request);
+
+    sample::ugrpc::StreamGreetingResponse response;
+    ASSERT_TRUE(stream.Read(response));
+    EXPECT_EQ(response.name(), "arena");
+    EXPECT_FALSE(stream.Read(response));
+}
+
+UTEST_F(GrpcNoArenaTest, UnaryRequest) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::GreetingRequest request;
+    request.set_name("userver");
+    EXPECT_EQ(client.SayHello(request).name(), "heap");
+}
+
+USERVER_NAMESPACE_END
@@ -288,6 +288,27 @@ UTEST_F(GrpcClientTest, BidirectionalStreamWriteAndCheck) {
     CheckClientContext(bs.GetContext());
 }
 
+UTEST_F(GrpcClientTest, BidirectionalStreamReusedRequest) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    auto bs = client.Chat(PrepareClientContext());
+
+    sample::ugrpc::StreamGreetingRequest out;
+    out.set_name("userver");
+    sample::ugrpc::StreamGreetingResponse in;
+    EXPECT_TRUE(bs.Write(out));
+    EXPECT_TRUE(bs.Read(in));
+    EXPECT_EQ(in.name(), "Hello userver");
+
+    // The server reads into the same message, fields of the previous one must not leak
+    out.clear_name();
+    EXPECT_TRUE(bs.Write(out));
+    EXPECT_TRUE(bs.Read(in));
+    EXPECT_EQ(in.name(), "Hello ");
+
+    EXPECT_TRUE(bs.WritesDone());
+    EXPECT_FALSE(bs.Read(in));
+}
+
 UTEST_F(GrpcClientTest, EmptyBidirectionalStream) {
     auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
     auto bs = client.Chat(PrepareClientContext());
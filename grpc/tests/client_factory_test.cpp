@@ -1,7 +1,12 @@
 #include <userver/ugrpc/client/client_factory.hpp>
 
+#include <string>
+#include <vector>
+
+#include <userver/ugrpc/client/exceptions.hpp>
 #include <userver/ugrpc/client/impl/client_data.hpp>
 #include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/testing.hpp>
 
 #include <tests/service_multichannel.hpp>
 #include <tests/unit_test_client.usrv.pb.hpp>
@@ -18,6 +23,64 @@ UTEST_P(GrpcClientMultichannel, ChannelsCount) {
     ASSERT_EQ(stub_state->stubs.Size(), GetParam());
 }
 
+UTEST_P(GrpcClientMultichannel, LeastLoadedChannel) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    const auto& data = ugrpc::client::impl::GetClientData(client);
+
+    // Every stream holds its channel until it is destroyed, so the streams
+    // should be spread evenly across the channels
+    sample::ugrpc::StreamGreetingRequest request;
+    std::vector<decltype(client.ReadMany(request))> streams;
+    for (std::size_t i = 0; i < 2 * GetParam(); ++i) {
+        streams.push_back(client.ReadMany(request));
+    }
+
+    const auto stub_state = data.GetStubState();
+    const utils::statistics::Snapshot stats{GetStatisticsStorage(), "grpc.client.channels"};
+    for (std::size_t i = 0; i < GetParam(); ++i) {
+        EXPECT_EQ(stub_state->stubs.GetInFlight(i), 2);
+        EXPECT_EQ(stats.SingleMetric("in-flight", {{"grpc_channel", std::to_string(i)}}).AsInt(), 2);
+    }
+
+    streams.clear();
+    for (std::size_t i = 0; i < GetParam(); ++i) {
+        EXPECT_EQ(stub_state->stubs.GetInFlight(i), 0);
+    }
+}
+
+UTEST_P(GrpcClientMultichannel, EjectsFailingEndpoint) {
+    const std::string bad_endpoint = "unix:/nonexistent/grpc.sock";
+    ugrpc::client::ClientSettings settings;
+    settings.client_name = "test";
+    settings.endpoints = {GetEndpoint(), bad_endpoint};
+    settings.outlier_detection.consecutive_failures = 1;
+    auto client = GetClientFactory().MakeClient<sample::ugrpc::UnitTestServiceClient>(std::move(settings));
+
+    const auto& data = ugrpc::client::impl::GetClientData(client);
+    const auto stub_state = data.GetStubState();
+    ASSERT_EQ(stub_state->stubs.Size(), 2 * GetParam());
+    ASSERT_EQ(stub_state->stubs.GetEndpointsCount(), 2);
+
+    // The bad endpoint has no latency yet, so it is preferred until it fails,
+    // and then it is ejected
+    std::size_t failures = 0;
+    for (int i = 0; i < 10; ++i) {
+        try {
+            client.SayHello(sample::ugrpc::GreetingRequest{});
+        } catch (const ugrpc::client::UnimplementedError&) {
+        } catch (const ugrpc::client::UnavailableError&) {
+            ++failures;
+        }
+    }
+    EXPECT_EQ(failures, 1);
+
+    EXPECT_FALSE(stub_state->stubs.IsEndpointEjected(0));
+    EXPECT_TRUE(stub_state->stubs.IsEndpointEjected(1));
+    const utils::statistics::Snapshot stats{GetStatisticsStorage(), "grpc.client.channels"};
+    EXPECT_EQ(stats.SingleMetric("endpoints.ejected", {{"grpc_endpoint", bad_endpoint}}).AsInt(), 1);
+    EXPECT_EQ(stats.SingleMetric("endpoints.ejected", {{"grpc_endpoint", GetEndpoint()}}).AsInt(), 0);
+}
+
 INSTANTIATE_UTEST_SUITE_P(/*no prefix*/, GrpcClientMultichannel, testing::Values(std::size_t{1}, std::size_t{4}));
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,12 @@
 #include <userver/utest/utest.hpp>
 
+#include <chrono>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+
 #include <ugrpc/server/middlewares/congestion_control/middleware.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
 #include <userver/ugrpc/tests/service_fixtures.hpp>
 #include <userver/utils/algo.hpp>
 
@@ -38,8 +44,93 @@ private:
     UnitTestService service_;
 };
 
+constexpr std::string_view kSayHelloCallName = "sample.ugrpc.UnitTestService/SayHello";
+
+class BlockingUnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& /*context*/, sample::ugrpc::GreetingRequest&& request) override {
+        started.Send();
+        if (request.name() == "block") {
+            [[maybe_unused]] const bool released = release.WaitForEventFor(utest::kMaxTestWaitTime);
+        } else if (request.name() == "sleep") {
+            engine::SleepFor(std::chrono::milliseconds{200});
+        }
+        return sample::ugrpc::GreetingResponse{};
+    }
+
+    engine::SingleConsumerEvent started;
+    engine::SingleConsumerEvent release;
+};
+
+class PerMethodCongestionControlTest : public ugrpc::tests::ServiceFixtureBase {
+protected:
+    explicit PerMethodCongestionControlTest(ugrpc::server::middlewares::congestion_control::Settings settings) {
+        SetServerMiddlewares({std::make_shared<ugrpc::server::middlewares::congestion_control::Middleware>(
+            std::move(settings)
+        )});
+        RegisterService(service_);
+        StartServer();
+    }
+
+    ~PerMethodCongestionControlTest() override { StopServer(); }
+
+    BlockingUnitTestService& GetService() { return service_; }
+
+private:
+    BlockingUnitTestService service_;
+};
+
+class MethodConcurrencyTest : public PerMethodCongestionControlTest {
+protected:
+    MethodConcurrencyTest() : PerMethodCongestionControlTest({{{std::string{kSayHelloCallName}, 1}}, false, 50}) {}
+};
+
+class DeadlineAwareRejectionTest : public PerMethodCongestionControlTest {
+protected:
+    DeadlineAwareRejectionTest() : PerMethodCongestionControlTest({{}, true, 50}) {}
+};
+
+sample::ugrpc::GreetingRequest MakeRequest(std::string name) {
+    sample::ugrpc::GreetingRequest request;
+    request.set_name(std::move(name));
+    return request;
+}
+
 }  // namespace
 
+UTEST_F(MethodConcurrencyTest, Basic) {
+    const auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    auto blocked = client.AsyncSayHello(MakeRequest("block"));
+    ASSERT_TRUE(GetService().started.WaitForEventFor(utest::kMaxTestWaitTime));
+
+    auto future = client.AsyncSayHello(MakeRequest("pass"));
+    UEXPECT_THROW(future.Get(), ugrpc::client::ResourceExhaustedError);
+
+    GetService().release.Send();
+    UEXPECT_NO_THROW(blocked.Get());
+
+    // The slot is free again
+    UEXPECT_NO_THROW(client.SayHello(MakeRequest("pass")));
+}
+
+UTEST_F(DeadlineAwareRejectionTest, Basic) {
+    const auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    // Fills the method timings
+    UEXPECT_NO_THROW(client.SayHello(MakeRequest("sleep")));
+
+    auto context = std::make_unique<grpc::ClientContext>();
+    context->set_deadline(std::chrono::system_clock::now() + std::chrono::milliseconds{50});
+    // The handler itself is fast, so only the middleware may exceed the deadline
+    UEXPECT_THROW(client.SayHello(MakeRequest("pass"), std::move(context)), ugrpc::client::DeadlineExceededError);
+
+    // Calls with a sufficient deadline pass
+    context = std::make_unique<grpc::ClientContext>();
+    context->set_deadline(std::chrono::system_clock::now() + utest::kMaxTestWaitTime);
+    UEXPECT_NO_THROW(client.SayHello(MakeRequest("pass"), std::move(context)));
+}
+
 UTEST_F(CongestionControlTest, Basic) {
     const auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
 
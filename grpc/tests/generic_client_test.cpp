@@ -16,6 +16,7 @@ USERVER_NAMESPACE_BEGIN
 namespace {
 
 constexpr std::string_view kSayHelloCallName = "sample.ugrpc.UnitTestService/SayHello";
+constexpr std::string_view kChatCallName = "sample.ugrpc.UnitTestService/Chat";
 
 class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
 public:
@@ -24,6 +25,17 @@ public:
         response.set_name("Hello " + request.name());
         return response;
     }
+
+    ChatResult Chat(CallContext& context, ChatReaderWriter& stream) override {
+        sample::ugrpc::StreamGreetingRequest request;
+        sample::ugrpc::StreamGreetingResponse response;
+        while (stream.Read(request)) {
+            response.set_name("Hello " + request.name());
+            stream.Write(response);
+        }
+        context.GetServerContext().AddTrailingMetadata("chat-metadata", "trailing");
+        return grpc::Status::OK;
+    }
 };
 
 using GenericClientTest = ugrpc::tests::ServiceFixture<UnitTestService>;
@@ -94,6 +106,49 @@ UTEST_F(GenericClientTest, MetricsDefaultCallNameIsFake) {
         << testing::PrintToString(stats);
 }
 
+UTEST_F(GenericClientTest, StreamUnaryCall) {
+    const auto client = MakeClient<ugrpc::client::GenericClient>();
+
+    sample::ugrpc::GreetingRequest request;
+    request.set_name("generic");
+
+    auto stream = client.Stream(kSayHelloCallName);
+    ASSERT_TRUE(stream.Write(ugrpc::SerializeToByteBuffer(request)));
+    ASSERT_TRUE(stream.WritesDone());
+
+    grpc::ByteBuffer response_bytes;
+    ASSERT_TRUE(stream.Read(response_bytes));
+    sample::ugrpc::GreetingResponse response;
+    ASSERT_TRUE(ugrpc::ParseFromByteBuffer(std::move(response_bytes), response));
+    EXPECT_EQ(response.name(), "Hello generic");
+    EXPECT_FALSE(stream.Read(response_bytes));
+}
+
+UTEST_F(GenericClientTest, StreamBidirectional) {
+    const auto client = MakeClient<ugrpc::client::GenericClient>();
+
+    auto stream = client.Stream(kChatCallName);
+
+    sample::ugrpc::StreamGreetingRequest request;
+    grpc::ByteBuffer response_bytes;
+    sample::ugrpc::StreamGreetingResponse response;
+    for (const auto* name : {"first", "second"}) {
+        request.set_name(name);
+        ASSERT_TRUE(stream.Write(ugrpc::SerializeToByteBuffer(request)));
+        ASSERT_TRUE(stream.Read(response_bytes));
+        ASSERT_TRUE(ugrpc::ParseFromByteBuffer(std::move(response_bytes), response));
+        EXPECT_EQ(response.name(), std::string{"Hello "} + name);
+    }
+
+    ASSERT_TRUE(stream.WritesDone());
+    EXPECT_FALSE(stream.Read(response_bytes));
+
+    const auto& trailing_metadata = stream.GetContext().GetServerTrailingMetadata();
+    const auto it = trailing_metadata.find("chat-metadata");
+    ASSERT_NE(it, trailing_metadata.end());
+    EXPECT_EQ(it->second, "trailing");
+}
+
 namespace {
 
 using GenericClientLoggingTest = utest::LogCaptureFixture<ugrpc::tests::ServiceFixture<UnitTestService>>;
@@ -7,6 +7,7 @@
 #include <userver/utest/log_capture_fixture.hpp>
 #include <userver/utils/regex.hpp>
 
+#include <ugrpc/server/middlewares/log/middleware.hpp>
 #include <tests/unit_test_client.usrv.pb.hpp>
 #include <tests/unit_test_service.usrv.pb.hpp>
 #include <userver/ugrpc/tests/service_fixtures.hpp>
@@ -42,6 +43,25 @@ public:
           ugrpc::tests::Service<GrpcService>(MakeServerConfig(member.GetLogger())) {}
 };
 
+class LogMiddlewareServiceFixture : public ugrpc::tests::ServiceFixtureBase {
+protected:
+    LogMiddlewareServiceFixture() {
+        ugrpc::server::middlewares::log::Settings settings;
+        settings.msg_log_level = logging::Level::kInfo;
+        settings.max_msg_size = 20;
+        settings.msg_sampling_period = 2;
+        SetServerMiddlewares({std::make_shared<ugrpc::server::middlewares::log::Middleware>(settings)});
+
+        RegisterService(service_);
+        StartServer();
+    }
+
+    ~LogMiddlewareServiceFixture() override { StopServer(); }
+
+private:
+    UnitTestService service_;
+};
+
 }  // namespace
 
 using GrpcAccessLog = ServiceWithAccessLogFixture<UnitTestService>;
@@ -69,4 +89,32 @@ UTEST_F(GrpcAccessLog, Test) {
     EXPECT_TRUE(utils::regex_match(logs.GetLogRaw(), utils::regex(kExpectedPattern))) << logs;
 }
 
+using GrpcServerLogMiddleware = utest::LogCaptureFixture<LogMiddlewareServiceFixture>;
+
+UTEST_F(GrpcServerLogMiddleware, SampledTruncatedBodies) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::GreetingRequest request;
+    request.set_name(std::string(100, 'x'));
+    for (int i = 0; i < 4; ++i) {
+        client.SayHello(request);
+    }
+
+    // Ensure that server logs get written.
+    GetServer().StopServing();
+
+    const auto requests = GetLogCapture().Filter("gRPC request message");
+    ASSERT_EQ(requests.size(), 4);
+
+    std::size_t hidden = 0;
+    for (const auto& record : requests) {
+        const auto& body = record.GetTag("body");
+        if (body == "hidden by sampling") {
+            ++hidden;
+            continue;
+        }
+        EXPECT_EQ(body, R"(name: "xxxxxxxxxxxxx...(truncated))");
+    }
+    EXPECT_EQ(hidden, 2);
+}
+
 USERVER_NAMESPACE_END
@@ -1,8 +1,12 @@
 #include <userver/ugrpc/proto_json.hpp>
 
+#include <google/protobuf/util/message_differencer.h>
+
 #include <userver/utest/parameter_names.hpp>
 #include <userver/utest/utest.hpp>
 
+#include <tests/protobuf.pb.h>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -167,6 +171,17 @@ TEST_P(SerializationTest, JsonTest) {
     EXPECT_EQ(param.to_cast, result);
 }
 
+TEST_P(SerializationTest, SaxJsonTest) {
+    auto param = GetParam();
+
+    google::protobuf::Value proto_struct;
+    ugrpc::ParseJson(formats::json::ToString(param.to_cast), proto_struct);
+
+    formats::json::StringBuilder sw;
+    ugrpc::WriteJson(proto_struct, sw);
+    EXPECT_EQ(param.to_cast, formats::json::FromString(sw.GetStringView()));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     /*no prefix*/,
     SerializationTest,
@@ -174,4 +189,70 @@ INSTANTIATE_TEST_SUITE_P(
     utest::PrintTestName()
 );
 
+namespace {
+
+sample::ugrpc::MessageWithDifferentTypes MakeMessage() {
+    sample::ugrpc::MessageWithDifferentTypes message;
+    message.set_required_string("required");
+    message.set_optional_int(42);
+    message.mutable_required_nested()->set_required_string("nested");
+    message.mutable_optional_recursive()->set_required_int(7);
+    message.add_repeated_primitive("first");
+    message.add_repeated_primitive("second");
+    message.add_repeated_message()->set_optional_string("item");
+    (*message.mutable_primitives_map())["key"] = "value";
+    (*message.mutable_nested_map())["nested"].set_required_int(5);
+    (*message.mutable_weird_map())[true].set_required_string("weird");
+    message.set_oneof_int(3);
+    message.mutable_google_value()->mutable_list_value()->add_values()->set_string_value("value");
+    return message;
+}
+
+}  // namespace
+
+TEST(ProtoJson, WriteJson) {
+    const auto message = MakeMessage();
+
+    formats::json::StringBuilder sw;
+    WriteToStream(message, sw);
+    EXPECT_EQ(formats::json::FromString(sw.GetStringView()), ugrpc::MessageToJson(message));
+
+    const sample::ugrpc::MessageWithDifferentTypes empty;
+    formats::json::StringBuilder empty_sw;
+    ugrpc::WriteJson(empty, empty_sw);
+    EXPECT_EQ(formats::json::FromString(empty_sw.GetStringView()), ugrpc::MessageToJson(empty));
+}
+
+TEST(ProtoJson, ParseJson) {
+    const auto message = MakeMessage();
+
+    sample::ugrpc::MessageWithDifferentTypes parsed;
+    ugrpc::ParseJson(ugrpc::ToJsonString(message), parsed);
+    EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equals(message, parsed)) << parsed.DebugString();
+}
+
+TEST(ProtoJson, ParseJsonLenient) {
+    sample::ugrpc::MessageWithDifferentTypes parsed;
+    ugrpc::ParseJson(
+        R"({"required_string":"original name","requiredInt":"12","optionalInt":1e1,)"
+        R"("requiredNested":null,"repeatedPrimitive":[],"weirdMap":{"false":{}}})",
+        parsed
+    );
+    EXPECT_EQ(parsed.required_string(), "original name");
+    EXPECT_EQ(parsed.required_int(), 12);
+    EXPECT_EQ(parsed.optional_int(), 10);
+    EXPECT_FALSE(parsed.has_required_nested());
+    EXPECT_EQ(parsed.weird_map().count(false), 1);
+}
+
+TEST(ProtoJson, ParseJsonErrors) {
+    sample::ugrpc::MessageWithDifferentTypes parsed;
+    EXPECT_THROW(ugrpc::ParseJson(R"({"unknownField":1})", parsed), formats::json::Exception);
+    EXPECT_THROW(ugrpc::ParseJson(R"({"requiredInt":-1})", parsed), formats::json::Exception);
+    EXPECT_THROW(ugrpc::ParseJson(R"({"requiredString":1})", parsed), formats::json::Exception);
+    EXPECT_THROW(ugrpc::ParseJson(R"({"repeatedPrimitive":"value"})", parsed), formats::json::Exception);
+    EXPECT_THROW(ugrpc::ParseJson(R"({"requiredNested":[]})", parsed), formats::json::Exception);
+    EXPECT_THROW(ugrpc::ParseJson(R"({"googleValue":{)", parsed), formats::json::Exception);
+}
+
 USERVER_NAMESPACE_END
@@ -24,6 +24,20 @@ public:
     }
 };
 
+class UnitTestServiceBufferedEcho final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    ChatResult Chat(CallContext& /*context*/, ChatReaderWriter& stream) override {
+        sample::ugrpc::StreamGreetingRequest request;
+        sample::ugrpc::StreamGreetingResponse response{};
+        while (stream.Read(request)) {
+            response.set_number(request.number());
+            stream.WriteBuffered(response);
+        }
+        // Buffered messages are flushed on Finish
+        return grpc::Status::OK;
+    }
+};
+
 }  // namespace
 
 using GrpcBidirectionalStream = ugrpc::tests::ServiceFixture<UnitTestServiceEcho>;
@@ -58,4 +72,35 @@ UTEST_F_MT(GrpcBidirectionalStream, BidirectionalStreamTest, 2) {
     ASSERT_EQ(responses.size(), kMessagesCount);
 }
 
+using GrpcBufferedBidirectionalStream = ugrpc::tests::ServiceFixture<UnitTestServiceBufferedEcho>;
+
+UTEST_F_MT(GrpcBufferedBidirectionalStream, BufferedWrites, 2) {
+    constexpr int kMessagesCount = 200;
+
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    auto stream = client.Chat();
+
+    auto write_task = engine::AsyncNoSpan([&stream] {
+        sample::ugrpc::StreamGreetingRequest request;
+        for (int i = 0; i < kMessagesCount; ++i) {
+            request.set_number(i);
+            if (!stream.WriteBuffered(request)) return false;
+        }
+        // Flushes the buffered messages
+        return stream.WritesDone();
+    });
+
+    std::vector<int> numbers;
+    sample::ugrpc::StreamGreetingResponse response;
+    while (stream.Read(response)) {
+        numbers.push_back(response.number());
+    }
+
+    ASSERT_TRUE(write_task.Get());
+    ASSERT_EQ(numbers.size(), static_cast<std::size_t>(kMessagesCount));
+    for (int i = 0; i < kMessagesCount; ++i) {
+        EXPECT_EQ(numbers[i], i);
+    }
+}
+
 USERVER_NAMESPACE_END
@@ -88,6 +88,26 @@ public:
     /// message for unpredictable amount of time.
     void Start(Callback callback);
 
+    /// @brief Same as ConsumerScope::Start, but each polled batch is split by
+    /// topic partitions, and the partitions are processed concurrently: the
+    /// `callback` is invoked once per partition, in a separate task, with the
+    /// messages of that partition only. The order of the messages within a
+    /// partition is kept.
+    ///
+    /// Suits CPU-bound processing of topics with many partitions, that does
+    /// not scale with ConsumerScope::Start.
+    ///
+    /// The offsets of each successfully processed partition are committed
+    /// automatically, so ConsumerScope::AsyncCommit is not needed (and should
+    /// not be called from the callback, because it commits the offsets of all
+    /// the polled messages, including the ones of other partitions that are
+    /// still being processed).
+    ///
+    /// @note If `callback` throws for some partition, the other partitions are
+    /// processed and committed anyway, then the consumer restarts, and only
+    /// the messages of the failed partitions come again.
+    void StartPerPartition(Callback callback);
+
     /// @brief Revokes all topic partition consumer was subscribed on. Also closes
     /// the consumer, leaving the consumer balanced group.
     ///
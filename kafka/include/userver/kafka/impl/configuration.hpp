@@ -63,6 +63,14 @@ struct ProducerConfiguration final {
     std::uint32_t message_send_max_retries{2147483647};
     std::chrono::milliseconds retry_backoff{100};
     std::chrono::milliseconds retry_backoff_max{1000};
+    std::string compression_codec{"none"};
+    std::uint32_t batch_size{1000000};  // ~ 1 MiB
+    std::uint32_t batch_num_messages{10000};
+    /// Zero disables `librdkafka` statistics and the batching metrics
+    std::chrono::milliseconds statistics_interval{0};
+
+    /// Topic name -> compression codec, overrides `compression_codec`
+    std::unordered_map<std::string, std::string> topics_compression_codecs;
 
     RdKafkaOptions rd_kafka_options;
 };
@@ -95,6 +103,10 @@ public:
 
     std::string GetOption(const char* option) const;
 
+    /// @brief Topic name -> topic level `librdkafka` options, which must be
+    /// set with `rd_kafka_topic_conf_set` before the topic is first used.
+    const std::unordered_map<std::string, RdKafkaOptions>& GetTopicsOptions() const;
+
     /// @brief Releases stored conf to be passed as a
     /// parameter of `rd_kafka_new` function that takes ownership on
     /// configuration.
@@ -122,6 +134,7 @@ private:
     std::string name_;
 
     ConfHolder conf_;
+    std::unordered_map<std::string, RdKafkaOptions> topics_options_;
 };
 
 }  // namespace kafka::impl
@@ -100,9 +100,17 @@ public:
 private:
     friend class kafka::ConsumerScope;
 
+    enum class ProcessingMode {
+        /// The whole polled batch is passed to a single callback call
+        kBatch,
+        /// The polled batch is split by topic partitions, which are processed
+        /// concurrently and committed independently
+        kPartitionsConcurrently,
+    };
+
     /// @brief Subscribes for `topics_` and starts the `poll_task_`, in which
     /// periodically polls the message batches.
-    void StartMessageProcessing(ConsumerScope::Callback callback);
+    void StartMessageProcessing(ConsumerScope::Callback callback, ProcessingMode mode = ProcessingMode::kBatch);
 
     /// @brief Calls `poll_task_.SyncCancel()` and waits until consumer stopped.
     void Stop() noexcept;
@@ -116,7 +124,13 @@ private:
     void ExtendCurrentSpan() const;
 
     /// @brief Subscribes for configured topics and starts polling loop.
-    void RunConsuming(ConsumerScope::Callback callback);
+    void RunConsuming(ConsumerScope::Callback callback, ProcessingMode mode);
+
+    /// @brief Processes each topic partition of the `polled_messages` in a
+    /// separate task and commits the offsets of the succeeded partitions.
+    /// @throws the exception of the first failed partition callback after all
+    /// the partitions are processed
+    void ProcessPartitionsConcurrently(const ConsumerScope::Callback& callback, std::vector<Message>&& polled_messages);
 
 private:
     std::atomic<bool> processing_{false};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 #include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/statistics/min_max_avg.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
@@ -18,14 +20,31 @@ struct MessagesCounts final {
     utils::statistics::RelaxedCounter<uint64_t> messages_error = 0;
 };
 
+/// Producer batching statistics, retrieved from `librdkafka` statistics for
+/// the last `statistics_interval`
+struct BatchingStats final {
+    std::atomic<bool> reported{false};
+    std::atomic<double> batch_size_bytes{0};
+    std::atomic<double> batch_messages{0};
+    /// Estimated as the average delivered message size multiplied by the
+    /// average number of messages in batch and divided by the average
+    /// (compressed) batch size
+    std::atomic<double> compression_ratio{0};
+};
+
 struct TopicStats final {
     MessagesCounts messages_counts;
+    utils::statistics::RelaxedCounter<uint64_t> delivered_bytes = 0;
+    BatchingStats batching;
     utils::statistics::RecentPeriod<MinMaxAvg, MinMaxAvg, utils::datetime::SteadyClock> avg_ms_spent_time;
 };
 
 struct Stats final {
     rcu::RcuMap<std::string, TopicStats> topics_stats;
     utils::statistics::RelaxedCounter<uint64_t> connections_error = 0;
+    /// Maximum among brokers of the average time the messages wait in the
+    /// producer queue
+    std::atomic<std::int64_t> queue_latency_us{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const Stats& stats);
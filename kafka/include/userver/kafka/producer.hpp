@@ -1,11 +1,16 @@
 #pragma once
 
 #include <cstdint>
+#include <exception>
+#include <optional>
+#include <string_view>
+#include <vector>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/kafka/exceptions.hpp>
 #include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/span.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -22,6 +27,14 @@ struct Secret;
 
 }  // namespace impl
 
+/// @brief Message to send with Producer::SendBatch. The data is not copied and
+/// must outlive the call.
+struct ProducerMessage final {
+    std::string_view key;
+    std::string_view payload;
+    std::optional<std::uint32_t> partition{std::nullopt};
+};
+
 /// @ingroup userver_clients
 ///
 /// @brief Apache Kafka Producer Client.
@@ -114,6 +127,27 @@ public:
         std::optional<std::uint32_t> partition = std::nullopt
     ) const;
 
+    /// @brief Sends the batch of messages to topic `topic_name` and
+    /// asynchronously waits until all of them are delivered or failed.
+    ///
+    /// Unlike a series of Producer::SendAsync, the messages are enqueued with a
+    /// single `librdkafka` call and are awaited by a single task, so large
+    /// volumes of messages do not spawn a task per message.
+    ///
+    /// No payload data is copied. The messages must live until the method
+    /// returns.
+    ///
+    /// Thread-safe and can be called from any number of threads
+    /// concurrently.
+    ///
+    /// @returns per-message results in the order of `messages`: nullptr for the
+    /// delivered messages, SendException or its descendant for the failed ones.
+    /// Use SendException::IsRetryable to decide whether to resend a message.
+    std::vector<std::exception_ptr> SendBatch(
+        const std::string& topic_name,
+        utils::span<const ProducerMessage> messages
+    ) const;
+
     /// @brief Dumps per topic messages produce statistics. No expected to be
     /// called manually.
     /// @see kafka/impl/stats.hpp
@@ -41,6 +41,11 @@ namespace kafka {
 /// message_send_max_retries     | maximum number of send request retries until `delivery_timeout` reached | 2147483647
 /// retry_backoff                | backoff time before retrying send request, exponentially increases after each retry | 100
 /// retry_backoff_max            | backoff upper bound | 1000
+/// compression_codec            | compression codec of the messages batches | none
+/// topics_compression_codecs    | a map of topic names to compression codecs, overrides `compression_codec` | '{}'
+/// batch_size                   | maximum size of the messages batch in bytes | 1000000
+/// batch_num_messages           | maximum number of messages in the batch | 10000
+/// statistics_interval          | interval of the `librdkafka` statistics collection, enables the batching metrics | 0ms
 /// security_protocol            | protocol used to communicate with brokers | --
 /// sasl_mechanisms              | SASL mechanism to use for authentication | none
 /// ssl_ca_location              | file or directory path to CA certificate(s) for verifying the broker's key | none
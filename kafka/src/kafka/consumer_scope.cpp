@@ -12,6 +12,10 @@ ConsumerScope::~ConsumerScope() { Stop(); }
 
 void ConsumerScope::Start(Callback callback) { consumer_.StartMessageProcessing(std::move(callback)); }
 
+void ConsumerScope::StartPerPartition(Callback callback) {
+    consumer_.StartMessageProcessing(std::move(callback), impl::Consumer::ProcessingMode::kPartitionsConcurrently);
+}
+
 void ConsumerScope::Stop() noexcept { consumer_.Stop(); }
 
 void ConsumerScope::AsyncCommit() { consumer_.AsyncCommit(); }
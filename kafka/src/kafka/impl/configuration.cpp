@@ -91,6 +91,14 @@ std::string ResolveGroupId(const ConsumerConfiguration& configuration) {
     return group_id;
 }
 
+void VerifyCompressionCodec(const std::string& codec) {
+    static constexpr std::array kSupportedCompressionCodecs{"none", "gzip", "snappy", "lz4", "zstd"};
+
+    if (!IsSupportedOption(kSupportedCompressionCodecs, codec)) {
+        ThrowUnsupportedOption("compression codec", codec, kSupportedCompressionCodecs);
+    }
+}
+
 }  // namespace
 
 CommonConfiguration Parse(const yaml_config::YamlConfig& config, formats::parse::To<CommonConfiguration>) {
@@ -167,6 +175,17 @@ ProducerConfiguration Parse(const yaml_config::YamlConfig& config, formats::pars
         config["message_send_max_retries"].As<std::uint32_t>(producer.message_send_max_retries);
     producer.retry_backoff = config["retry_backoff"].As<std::chrono::milliseconds>(producer.retry_backoff);
     producer.retry_backoff_max = config["retry_backoff_max"].As<std::chrono::milliseconds>(producer.retry_backoff_max);
+    producer.compression_codec = config["compression_codec"].As<std::string>(producer.compression_codec);
+    VerifyCompressionCodec(producer.compression_codec);
+    producer.batch_size = config["batch_size"].As<std::uint32_t>(producer.batch_size);
+    producer.batch_num_messages = config["batch_num_messages"].As<std::uint32_t>(producer.batch_num_messages);
+    producer.statistics_interval =
+        config["statistics_interval"].As<std::chrono::milliseconds>(producer.statistics_interval);
+    producer.topics_compression_codecs =
+        config["topics_compression_codecs"].As<std::unordered_map<std::string, std::string>>({});
+    for (const auto& [topic, codec] : producer.topics_compression_codecs) {
+        VerifyCompressionCodec(codec);
+    }
 
     return producer;
 }
@@ -215,6 +234,10 @@ std::string Configuration::GetOption(const char* option) const {
     return result_data;
 }
 
+const std::unordered_map<std::string, RdKafkaOptions>& Configuration::GetTopicsOptions() const {
+    return topics_options_;
+}
+
 ConfHolder Configuration::Release() && { return std::move(conf_); }
 
 void Configuration::SetCommon(const CommonConfiguration& common) {
@@ -279,7 +302,28 @@ void Configuration::SetProducer(const ProducerConfiguration& configuration) {
     SetOption("message.send.max.retries", configuration.message_send_max_retries);
     SetOption("retry.backoff.ms", configuration.retry_backoff);
     SetOption("retry.backoff.max.ms", configuration.retry_backoff_max);
-    rd_kafka_conf_set_events(conf_.GetHandle(), RD_KAFKA_EVENT_LOG | RD_KAFKA_EVENT_ERROR | RD_KAFKA_EVENT_DR);
+    /// Batching options were previously available only as custom options, do
+    /// not override them with the defaults
+    const auto& custom_options = configuration.rd_kafka_options;
+    if (!custom_options.count("compression.codec") && !custom_options.count("compression.type")) {
+        SetOption("compression.codec", configuration.compression_codec);
+    }
+    if (!custom_options.count("batch.size")) {
+        SetOption("batch.size", configuration.batch_size);
+    }
+    if (!custom_options.count("batch.num.messages")) {
+        SetOption("batch.num.messages", configuration.batch_num_messages);
+    }
+    for (const auto& [topic, codec] : configuration.topics_compression_codecs) {
+        topics_options_[topic]["compression.codec"] = codec;
+    }
+
+    int events = RD_KAFKA_EVENT_LOG | RD_KAFKA_EVENT_ERROR | RD_KAFKA_EVENT_DR;
+    if (configuration.statistics_interval.count() > 0) {
+        SetOption("statistics.interval.ms", configuration.statistics_interval);
+        events |= RD_KAFKA_EVENT_STATS;
+    }
+    rd_kafka_conf_set_events(conf_.GetHandle(), events);
 }
 
 template <class T>
@@ -1,6 +1,10 @@
 #include <userver/kafka/impl/consumer.hpp>
 
+#include <algorithm>
+#include <exception>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -47,6 +51,37 @@ std::function<void()> CreateDurationNotifier(std::chrono::milliseconds max_callb
     };
 }
 
+/// Regroups the messages so that the messages of each topic partition are
+/// adjacent, keeping their order within the partition.
+/// @returns the regrouped messages and the ends of the groups
+std::pair<std::vector<Message>, std::vector<std::size_t>> GroupByPartition(std::vector<Message>&& messages) {
+    std::vector<std::pair<const Message*, std::vector<std::size_t>>> partitions;
+    for (std::size_t index{0}; index < messages.size(); ++index) {
+        const auto& message = messages[index];
+        const auto it = std::find_if(partitions.begin(), partitions.end(), [&message](const auto& partition) {
+            return partition.first->GetPartition() == message.GetPartition() &&
+                   partition.first->GetTopic() == message.GetTopic();
+        });
+        if (it == partitions.end()) {
+            partitions.push_back({&message, {index}});
+        } else {
+            it->second.push_back(index);
+        }
+    }
+
+    std::vector<Message> grouped;
+    grouped.reserve(messages.size());
+    std::vector<std::size_t> group_ends;
+    group_ends.reserve(partitions.size());
+    for (const auto& [first_message, indices] : partitions) {
+        for (const auto index : indices) {
+            grouped.push_back(std::move(messages[index]));
+        }
+        group_ends.push_back(grouped.size());
+    }
+    return {std::move(grouped), std::move(group_ends)};
+}
+
 }  // namespace
 
 Consumer::Consumer(
@@ -89,7 +124,7 @@ void Consumer::DumpMetric(utils::statistics::Writer& writer) const {
     USERVER_NAMESPACE::kafka::impl::DumpMetric(writer, stats_);
 }
 
-void Consumer::RunConsuming(ConsumerScope::Callback callback) {
+void Consumer::RunConsuming(ConsumerScope::Callback callback, ProcessingMode mode) {
     // note: Consumer must be recreated after each stop,
     // because stop invalidates some internal consumer state (in librdkafka).
     // Nevertheless, it is possible to use blocking consumer methods after stop.
@@ -116,6 +151,12 @@ void Consumer::RunConsuming(ConsumerScope::Callback callback) {
 
         TESTPOINT(fmt::format("tp_{}_polled", name_), {});
 
+        if (mode == ProcessingMode::kPartitionsConcurrently) {
+            ProcessPartitionsConcurrently(callback, std::move(polled_messages));
+            TESTPOINT(fmt::format("tp_{}", name_), {});
+            continue;
+        }
+
         auto batch_processing_task =
             utils::Async(main_task_processor_, "messages_processing", callback, utils::span{polled_messages});
         const utils::ScopeGuard callback_duration_notifier{
@@ -133,16 +174,67 @@ void Consumer::RunConsuming(ConsumerScope::Callback callback) {
     }
 }
 
-void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
+void Consumer::ProcessPartitionsConcurrently(
+    const ConsumerScope::Callback& callback,
+    std::vector<Message>&& polled_messages
+) {
+    const auto [messages, group_ends] = GroupByPartition(std::move(polled_messages));
+    const utils::ScopeGuard callback_duration_notifier{CreateDurationNotifier(execution_params.max_callback_duration)};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(group_ends.size());
+    std::size_t group_begin{0};
+    for (const auto group_end : group_ends) {
+        const MessageBatchView partition_messages{messages.data() + group_begin, messages.data() + group_end};
+        tasks.push_back(utils::Async(
+            main_task_processor_,
+            "partition_messages_processing",
+            [&callback, partition_messages] { callback(partition_messages); }
+        ));
+        group_begin = group_end;
+    }
+
+    std::exception_ptr first_error;
+    group_begin = 0;
+    for (std::size_t group{0}; group < tasks.size(); ++group) {
+        const MessageBatchView partition_messages{messages.data() + group_begin, messages.data() + group_ends[group]};
+        group_begin = group_ends[group];
+        try {
+            tasks[group].Get();
+
+            consumer_->AccountMessageBatchProcessingSucceeded(partition_messages);
+            consumer_->AsyncCommitPartition(partition_messages[partition_messages.size() - 1]);
+        } catch (const std::exception& e) {
+            consumer_->AccountMessageBatchProcessingFailed(partition_messages);
+            LOG_WARNING() << fmt::format(
+                "Messages processing failed for topic '{}' partition {}: {}",
+                partition_messages[0].GetTopic(),
+                partition_messages[0].GetPartition(),
+                e.what()
+            );
+            if (!first_error) {
+                first_error = std::current_exception();
+            }
+        }
+    }
+
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
+void Consumer::StartMessageProcessing(ConsumerScope::Callback callback, ProcessingMode mode) {
     UINVARIANT(!processing_.exchange(true), "Message processing already started");
 
-    poll_task_ =
-        utils::CriticalAsync(consumer_task_processor_, "consumer_polling", [this, callback = std::move(callback)] {
+    poll_task_ = utils::CriticalAsync(
+        consumer_task_processor_,
+        "consumer_polling",
+        [this, callback = std::move(callback), mode] {
             ExtendCurrentSpan();
 
             while (!engine::current_task::ShouldCancel()) {
                 try {
-                    RunConsuming(callback);
+                    RunConsuming(callback, mode);
                 } catch (const std::exception& e) {
                     LOG_ERROR() << fmt::format("Messages processing failed in consumer: {}", e.what());
 
@@ -158,7 +250,8 @@ void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
                 );
                 engine::InterruptibleSleepFor(execution_params.restart_after_failure_delay);
             }
-        });
+        }
+    );
 }
 
 void Consumer::AsyncCommit() {
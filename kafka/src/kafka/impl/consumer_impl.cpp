@@ -1,6 +1,7 @@
 #include <kafka/impl/consumer_impl.hpp>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <iostream>
 
@@ -105,12 +106,9 @@ namespace impl {
 
 namespace {
 
-void EventCallbackProxy([[maybe_unused]] rd_kafka_t* kafka_client, void* opaque_ptr) {
-    UASSERT(kafka_client);
-    UASSERT(opaque_ptr);
-
-    static_cast<ConsumerImpl*>(opaque_ptr)->EventCallback();
-}
+/// Any single byte, `librdkafka` writes it to the queue events pipe
+constexpr char kQueueEventPayload{'1'};
+constexpr std::size_t kQueueEventsDrainSize{64};
 
 void PrintTopicPartitionsList(
     const rd_kafka_topic_partition_list_t* list,
@@ -257,7 +255,9 @@ ConsumerImpl::ConsumerImpl(
 const Stats& ConsumerImpl::GetStats() const { return stats_; }
 
 void ConsumerImpl::StartConsuming() {
-    rd_kafka_queue_cb_event_enable(consumer_.GetQueue(), &EventCallbackProxy, this);
+    rd_kafka_queue_io_event_enable(
+        consumer_.GetQueue(), queue_events_pipe_.writer.Fd(), &kQueueEventPayload, sizeof(kQueueEventPayload)
+    );
 
     TopicPartitionsListHolder topic_partitions_list{rd_kafka_topic_partition_list_new(topics_.size())};
     for (const auto& topic : topics_) {
@@ -274,8 +274,8 @@ void ConsumerImpl::StartConsuming() {
 }
 
 void ConsumerImpl::StopConsuming() {
-    // disable EventCallback
-    rd_kafka_queue_cb_event_enable(consumer_.GetQueue(), nullptr, nullptr);
+    // stop queue events forwarding
+    rd_kafka_queue_io_event_enable(consumer_.GetQueue(), -1, nullptr, 0);
 
     // launch closing process
     ErrorHolder error{rd_kafka_consumer_close_queue(consumer_.GetHandle(), consumer_.GetQueue())};
@@ -298,6 +298,17 @@ void ConsumerImpl::Commit() { rd_kafka_commit(consumer_.GetHandle(), nullptr, /*
 
 void ConsumerImpl::AsyncCommit() { rd_kafka_commit(consumer_.GetHandle(), nullptr, /*async=*/1); }
 
+void ConsumerImpl::AsyncCommitPartition(const Message& message) {
+    /// `rd_kafka_commit` copies the list, so it may be destroyed right after
+    /// the commit is scheduled
+    const TopicPartitionsListHolder offsets{rd_kafka_topic_partition_list_new(/*size=*/1)};
+    auto* topic_partition =
+        rd_kafka_topic_partition_list_add(offsets.GetHandle(), message.GetTopic().c_str(), message.GetPartition());
+    topic_partition->offset = message.GetOffset() + 1;
+
+    rd_kafka_commit(consumer_.GetHandle(), offsets.GetHandle(), /*async=*/1);
+}
+
 OffsetRange ConsumerImpl::GetOffsetRange(
     const std::string& topic,
     std::uint32_t partition,
@@ -400,13 +411,20 @@ void ConsumerImpl::DispatchEvent(const EventHolder& event_holder) {
     }
 }
 
-void ConsumerImpl::EventCallback() {
-    /// The callback is called from internal librdkafka thread, i.e. not in
-    /// coroutine environment, therefore not all synchronization
-    /// primitives can be used in the callback body.
+bool ConsumerImpl::WaitQueueBecameNonEmpty(engine::Deadline deadline) {
+    auto& reader = queue_events_pipe_.reader;
+    if (!reader.WaitReadable(deadline)) {
+        return false;
+    }
+
+    /// The queue may be signaled several times before the wake up, the pipe is
+    /// drained, so that it does not wake up the poller for nothing later.
+    /// Signals that are not drained only cause a spurious wake up
+    std::array<char, kQueueEventsDrainSize> buffer{};
+    [[maybe_unused]] const auto read = reader.ReadSome(buffer.data(), buffer.size(), deadline);
 
-    LOG_INFO() << "Consumer events queue became non-empty. Waking up message poller";
-    queue_became_non_empty_event_.Send();
+    LOG_DEBUG() << "Consumer events queue became non-empty. Waking up message poller";
+    return true;
 }
 
 std::optional<Message> ConsumerImpl::TakeEventMessage(EventHolder&& event_holder) {
@@ -457,7 +475,7 @@ std::optional<Message> ConsumerImpl::PollMessage(engine::Deadline deadline) {
                 time_left_ms
             );
 
-            if (!queue_became_non_empty_event_.WaitForEventUntil(deadline)) {
+            if (!WaitQueueBecameNonEmpty(deadline)) {
                 LOG_DEBUG() << fmt::format(
                     "No messages still available after {}ms (or polling task was "
                     "canceled)",
@@ -513,7 +531,7 @@ void ConsumerImpl::AccountMessageProcessingSucceeded(const Message& message) {
     ++GetTopicStats(message.GetTopic())->messages_counts.messages_success;
 }
 
-void ConsumerImpl::AccountMessageBatchProcessingSucceeded(const MessageBatch& batch) {
+void ConsumerImpl::AccountMessageBatchProcessingSucceeded(MessageBatchView batch) {
     for (const auto& message : batch) {
         AccountMessageProcessingSucceeded(message);
     }
@@ -522,7 +540,7 @@ void ConsumerImpl::AccountMessageProcessingFailed(const Message& message) {
     ++GetTopicStats(message.GetTopic())->messages_counts.messages_error;
 }
 
-void ConsumerImpl::AccountMessageBatchProcessingFailed(const MessageBatch& batch) {
+void ConsumerImpl::AccountMessageBatchProcessingFailed(MessageBatchView batch) {
     for (const auto& message : batch) {
         AccountMessageProcessingFailed(message);
     }
@@ -6,7 +6,7 @@
 #include <librdkafka/rdkafka.h>
 
 #include <userver/engine/deadline.hpp>
-#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/kafka/impl/holders.hpp>
 #include <userver/kafka/message.hpp>
 #include <userver/kafka/offset_range.hpp>
@@ -38,6 +38,10 @@ public:
     /// @brief Schedules the commitment task.
     void AsyncCommit();
 
+    /// @brief Schedules the commitment of the offset next to the `message`
+    /// within its topic partition.
+    void AsyncCommitPartition(const Message& message);
+
     /// @brief Retrieves the low and high offsets for the specified topic and partition.
     OffsetRange GetOffsetRange(
         const std::string& topic,
@@ -54,11 +58,9 @@ public:
     MessageBatch PollBatch(std::size_t max_batch_size, engine::Deadline deadline);
 
     void AccountMessageProcessingSucceeded(const Message& message);
-    void AccountMessageBatchProcessingSucceeded(const MessageBatch& batch);
+    void AccountMessageBatchProcessingSucceeded(MessageBatchView batch);
     void AccountMessageProcessingFailed(const Message& message);
-    void AccountMessageBatchProcessingFailed(const MessageBatch& batch);
-
-    void EventCallback();
+    void AccountMessageBatchProcessingFailed(MessageBatchView batch);
 
     /// @brief Revokes all subscribed topics partitions and leaves the consumer
     /// group.
@@ -80,6 +82,11 @@ private:
     /// @brief Poll a delivery or error event from producer's queue.
     EventHolder PollEvent();
 
+    /// @brief Suspends the current task until `librdkafka` signals that the
+    /// consumer queue became non-empty or `deadline` is reached.
+    /// @returns false if the deadline is reached (or the task is cancelled)
+    bool WaitQueueBecameNonEmpty(engine::Deadline deadline);
+
     /// @brief Retrieves a message from the event, accounts statistics.
     /// @returns std::nullopt if event's messages contains an error.
     std::optional<Message> TakeEventMessage(EventHolder&& event_holder);
@@ -119,7 +126,10 @@ private:
 
     const std::vector<std::string> topics_;
 
-    engine::SingleConsumerEvent queue_became_non_empty_event_;
+    /// `librdkafka` writes to the pipe each time the consumer queue becomes
+    /// non-empty, so the poller waits for the events in the ev loop, without
+    /// any callbacks in `librdkafka` threads
+    engine::io::Pipe queue_events_pipe_;
 
     ConsumerHolder consumer_;
 };
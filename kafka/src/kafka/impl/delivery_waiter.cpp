@@ -1,5 +1,7 @@
 #include <kafka/impl/delivery_waiter.hpp>
 
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace kafka::impl {
@@ -20,6 +22,44 @@ void DeliveryWaiter::SetDeliveryResult(DeliveryResult delivery_result) {
     wait_handle_.set_value(std::move(delivery_result));
 }
 
+void DeliveryWaiter::OnDeliveryReport(DeliveryResult delivery_result) {
+    SetDeliveryResult(std::move(delivery_result));
+    delete this;
+}
+
+BatchDeliveryWaiter::BatchDeliveryWaiter(std::size_t messages_count)
+    : results_(messages_count), remaining_(messages_count) {
+    UASSERT(messages_count > 0);
+    handlers_.reserve(messages_count);
+    for (std::size_t index{0}; index < messages_count; ++index) {
+        handlers_.emplace_back(*this, index);
+    }
+}
+
+engine::Future<std::vector<DeliveryResult>> BatchDeliveryWaiter::GetFuture() { return wait_handle_.get_future(); }
+
+DeliveryReportHandler& BatchDeliveryWaiter::GetHandler(std::size_t index) { return handlers_[index]; }
+
+void BatchDeliveryWaiter::SetDeliveryResult(std::size_t index, DeliveryResult delivery_result) {
+    UASSERT(!results_[index].has_value());
+    results_[index].emplace(std::move(delivery_result));
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    std::vector<DeliveryResult> results;
+    results.reserve(results_.size());
+    for (auto& result : results_) {
+        results.push_back(std::move(*result));
+    }
+    wait_handle_.set_value(std::move(results));
+    delete this;
+}
+
+void BatchDeliveryWaiter::MessageHandler::OnDeliveryReport(DeliveryResult delivery_result) {
+    waiter_.SetDeliveryResult(index_, std::move(delivery_result));
+}
+
 }  // namespace kafka::impl
 
 USERVER_NAMESPACE_END
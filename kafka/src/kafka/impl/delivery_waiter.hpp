@@ -1,5 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <optional>
+#include <vector>
+
 #include <librdkafka/rdkafka.h>
 
 #include <userver/engine/future.hpp>
@@ -26,9 +30,21 @@ private:
     std::optional<rd_kafka_msg_status_t> message_status_;
 };
 
+/// @brief Receiver of the message delivery report. Passed to `librdkafka` as
+/// the message opaque.
+class DeliveryReportHandler {
+public:
+    /// @brief Called exactly once per message. The handler owns itself and may
+    /// be destroyed inside.
+    virtual void OnDeliveryReport(DeliveryResult delivery_result) = 0;
+
+protected:
+    ~DeliveryReportHandler() = default;
+};
+
 /// @brief State for waiting delivery callback invoked after producer send
 /// called
-class DeliveryWaiter final {
+class DeliveryWaiter final : public DeliveryReportHandler {
 public:
     DeliveryWaiter() = default;
 
@@ -36,10 +52,51 @@ public:
 
     void SetDeliveryResult(DeliveryResult delivery_result);
 
+    /// @brief Sets the result and destroys the waiter.
+    void OnDeliveryReport(DeliveryResult delivery_result) override;
+
 private:
     engine::Promise<DeliveryResult> wait_handle_;
 };
 
+/// @brief State for waiting delivery callbacks of a batch of messages with a
+/// single future. Destroys itself after the last message result is set.
+class BatchDeliveryWaiter final {
+public:
+    explicit BatchDeliveryWaiter(std::size_t messages_count);
+
+    BatchDeliveryWaiter(BatchDeliveryWaiter&&) = delete;
+    BatchDeliveryWaiter& operator=(BatchDeliveryWaiter&&) = delete;
+
+    /// @returns the future for the results of all messages in the batch order
+    engine::Future<std::vector<DeliveryResult>> GetFuture();
+
+    /// @returns the handler to pass as an opaque of the `index`-th message
+    DeliveryReportHandler& GetHandler(std::size_t index);
+
+    /// @brief Sets the result of the `index`-th message. Thread-safe for
+    /// different indices. The last call fulfills the future and destroys the
+    /// waiter.
+    void SetDeliveryResult(std::size_t index, DeliveryResult delivery_result);
+
+private:
+    class MessageHandler final : public DeliveryReportHandler {
+    public:
+        MessageHandler(BatchDeliveryWaiter& waiter, std::size_t index) : waiter_(waiter), index_(index) {}
+
+        void OnDeliveryReport(DeliveryResult delivery_result) override;
+
+    private:
+        BatchDeliveryWaiter& waiter_;
+        std::size_t index_;
+    };
+
+    std::vector<MessageHandler> handlers_;
+    std::vector<std::optional<DeliveryResult>> results_;
+    std::atomic<std::size_t> remaining_;
+    engine::Promise<std::vector<DeliveryResult>> wait_handle_;
+};
+
 }  // namespace kafka::impl
 
 USERVER_NAMESPACE_END
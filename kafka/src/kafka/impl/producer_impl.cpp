@@ -1,15 +1,20 @@
 #include <kafka/impl/producer_impl.hpp>
 
+#include <algorithm>
 #include <string>
 #include <utility>
 
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/wait_any.hpp>
+#include <userver/formats/common/items.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
 #include <userver/kafka/impl/configuration.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/trivial_map.hpp>
 
+#include <kafka/impl/error_buffer.hpp>
 #include <kafka/impl/log_level.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -31,6 +36,32 @@ void EventCallbackProxy(rd_kafka_t* producer, void* opaque_ptr) {
     static_cast<ProducerImpl*>(opaque_ptr)->EventCallback();
 }
 
+TopicHolder CreateConfiguredTopic(rd_kafka_t* producer, const std::string& topic, const RdKafkaOptions& options) {
+    auto* topic_conf = rd_kafka_topic_conf_new();
+    for (const auto& [option, value] : options) {
+        ErrorBuffer err_buf;
+        if (rd_kafka_topic_conf_set(topic_conf, option.c_str(), value.c_str(), err_buf.data(), err_buf.size()) !=
+            RD_KAFKA_CONF_OK) {
+            rd_kafka_topic_conf_destroy(topic_conf);
+            PrintErrorAndThrow(fmt::format("set topic '{}' config option", topic), err_buf);
+        }
+        LOG_INFO() << fmt::format("Kafka topic '{}' conf option: '{}' -> '{}'", topic, option, value);
+    }
+
+    /// `rd_kafka_topic_new` takes the ownership on `topic_conf`
+    TopicHolder topic_holder{rd_kafka_topic_new(producer, topic.c_str(), topic_conf)};
+    if (!topic_holder) {
+        throw std::runtime_error{
+            fmt::format("Failed to create topic '{}': {}", topic, rd_kafka_err2str(rd_kafka_last_error()))};
+    }
+
+    return topic_holder;
+}
+
+double GetHistogramAverage(const formats::json::Value& histogram) {
+    return histogram["avg"].As<double>(0.0);
+}
+
 }  // namespace
 
 void ProducerImpl::ErrorCallback(rd_kafka_resp_err_t error, const char* reason, bool is_fatal) const {
@@ -64,7 +95,7 @@ void ProducerImpl::DeliveryReportCallback(const rd_kafka_message_t* message) con
 
     const char* topic_name = rd_kafka_topic_name(message->rkt);
 
-    auto* complete_handle = static_cast<DeliveryWaiter*>(message->_private);
+    auto* complete_handle = static_cast<DeliveryReportHandler*>(message->_private);
 
     auto& topic_stats = stats_.topics_stats[topic_name];
     ++topic_stats->messages_counts.messages_total;
@@ -84,6 +115,7 @@ void ProducerImpl::DeliveryReportCallback(const rd_kafka_message_t* message) con
 
     if (delivery_result.IsSuccess()) {
         ++topic_stats->messages_counts.messages_success;
+        topic_stats->delivered_bytes += message->len + message->key_len;
 
         LOG_INFO() << fmt::format(
             "Message to topic '{}' delivered successfully to "
@@ -101,8 +133,39 @@ void ProducerImpl::DeliveryReportCallback(const rd_kafka_message_t* message) con
         ) << fmt::format("Failed to delivery message to topic '{}': {}", topic_name, rd_kafka_err2str(message->err));
     }
 
-    complete_handle->SetDeliveryResult(std::move(delivery_result));
-    delete complete_handle;
+    complete_handle->OnDeliveryReport(std::move(delivery_result));
+}
+
+void ProducerImpl::StatisticsCallback(std::string_view json) const {
+    const auto statistics = formats::json::FromString(json);
+
+    for (const auto& [topic_name, topic] : formats::common::Items(statistics["topics"])) {
+        const auto batch_size_bytes = GetHistogramAverage(topic["batchsize"]);
+        const auto batch_messages = GetHistogramAverage(topic["batchcnt"]);
+        if (batch_messages == 0.0) {
+            /// Nothing was sent during the statistics interval
+            continue;
+        }
+
+        auto& topic_stats = stats_.topics_stats[topic_name];
+        auto& batching = topic_stats->batching;
+        batching.batch_size_bytes = batch_size_bytes;
+        batching.batch_messages = batch_messages;
+
+        const auto delivered_messages = topic_stats->messages_counts.messages_success.Load();
+        if (delivered_messages != 0 && batch_size_bytes != 0.0) {
+            const auto average_message_bytes =
+                static_cast<double>(topic_stats->delivered_bytes.Load()) / static_cast<double>(delivered_messages);
+            batching.compression_ratio = average_message_bytes * batch_messages / batch_size_bytes;
+        }
+        batching.reported = true;
+    }
+
+    double queue_latency_us{0};
+    for (const auto& [broker_name, broker] : formats::common::Items(statistics["brokers"])) {
+        queue_latency_us = std::max(queue_latency_us, GetHistogramAverage(broker["int_latency"]));
+    }
+    stats_.queue_latency_us = static_cast<std::int64_t>(queue_latency_us);
 }
 
 ProducerImpl::ProducerImpl(Configuration&& configuration)
@@ -114,6 +177,12 @@ ProducerImpl::ProducerImpl(Configuration&& configuration)
     /// one.
     rd_kafka_queue_cb_event_enable(producer_.GetQueue(), &EventCallbackProxy, this);
 
+    /// `configuration` still holds the topics options after the release of
+    /// the `librdkafka` configuration
+    for (const auto& [topic, options] : configuration.GetTopicsOptions()) {
+        configured_topics_.push_back(CreateConfiguredTopic(producer_.GetHandle(), topic, options));
+    }
+
     utils::PeriodicTask::Settings settings{std::chrono::seconds{1}};
     log_events_handler_.Start("kafka_producer_log_events_handler", settings, [this] {
         HandleEvents("log events handler");
@@ -136,6 +205,22 @@ DeliveryResult ProducerImpl::Send(
     return delivery_result_future.get();
 }
 
+std::vector<DeliveryResult> ProducerImpl::SendBatch(
+    const std::string& topic_name,
+    utils::span<const ProducerMessage> messages
+) const {
+    LOG_INFO() << fmt::format("Batch of {} messages to topic '{}' is requested to send", messages.size(), topic_name);
+    if (messages.empty()) {
+        return {};
+    }
+
+    auto delivery_results_future = ScheduleBatchDelivery(topic_name, messages);
+
+    WaitUntilDeliveryReported(delivery_results_future);
+
+    return delivery_results_future.get();
+}
+
 engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
     const std::string& topic_name,
     std::string_view key,
@@ -181,7 +266,7 @@ engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
         RD_KAFKA_V_VALUE(const_cast<char*>(message.data()), message.size()),
         RD_KAFKA_V_MSGFLAGS(0),
         RD_KAFKA_V_PARTITION(partition.value_or(RD_KAFKA_PARTITION_UA)),
-        RD_KAFKA_V_OPAQUE(waiter.get()),
+        RD_KAFKA_V_OPAQUE(static_cast<DeliveryReportHandler*>(waiter.get())),
         RD_KAFKA_V_END
     );
     // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks,cppcoreguidelines-pro-type-const-cast)
@@ -201,6 +286,70 @@ engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
     return wait_handle;
 }
 
+engine::Future<std::vector<DeliveryResult>> ProducerImpl::ScheduleBatchDelivery(
+    const std::string& topic_name,
+    utils::span<const ProducerMessage> messages
+) const {
+    UASSERT(!messages.empty());
+
+    /// The waiter is owned by `librdkafka` and the enqueue errors handling
+    /// below, it is destroyed after the last message result is set
+    auto* waiter = new BatchDeliveryWaiter{messages.size()};
+    auto wait_handle = waiter->GetFuture();
+
+    /// Same as in ScheduleMessageDelivery, 0 msgflags implies no message
+    /// copying, the data lives till the delivery callbacks are invoked.
+    /// RD_KAFKA_MSG_F_PARTITION makes `librdkafka` respect the per-message
+    /// partitions, RD_KAFKA_PARTITION_UA ones are assigned by the partitioner
+    std::vector<rd_kafka_message_t> batch(messages.size());
+    for (std::size_t index{0}; index < messages.size(); ++index) {
+        const auto& message = messages[index];
+        auto& batch_message = batch[index];
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+        batch_message.payload = const_cast<char*>(message.payload.data());
+        batch_message.len = message.payload.size();
+        batch_message.key = const_cast<char*>(message.key.data());
+        batch_message.key_len = message.key.size();
+        // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+        batch_message.partition = message.partition.value_or(RD_KAFKA_PARTITION_UA);
+        batch_message._private = &waiter->GetHandler(index);
+    }
+
+    const TopicHolder topic{rd_kafka_topic_new(producer_.GetHandle(), topic_name.c_str(), nullptr)};
+    if (!topic) {
+        const auto error = rd_kafka_last_error();
+        LOG_WARNING() << fmt::format("Failed to create topic handle for batch send: {}", rd_kafka_err2str(error));
+        for (std::size_t index{0}; index < batch.size(); ++index) {
+            waiter->SetDeliveryResult(index, DeliveryResult{error});
+        }
+        return wait_handle;
+    }
+
+    const int enqueued = rd_kafka_produce_batch(
+        topic.GetHandle(),
+        RD_KAFKA_PARTITION_UA,
+        RD_KAFKA_MSG_F_PARTITION,
+        batch.data(),
+        static_cast<int>(batch.size())
+    );
+
+    /// Messages that are not enqueued never get delivery reports. The waiter
+    /// stays alive until the last of them is handled here, because their
+    /// results are still unset.
+    if (static_cast<std::size_t>(enqueued) != batch.size()) {
+        LOG_WARNING() << fmt::format(
+            "Failed to enqueue {} of {} messages to Kafka local queue", batch.size() - enqueued, batch.size()
+        );
+        for (std::size_t index{0}; index < batch.size(); ++index) {
+            if (batch[index].err != RD_KAFKA_RESP_ERR_NO_ERROR) {
+                waiter->SetDeliveryResult(index, DeliveryResult{batch[index].err});
+            }
+        }
+    }
+
+    return wait_handle;
+}
+
 EventHolder ProducerImpl::PollEvent() const {
     /// zero `timeout_ms` means no logical blocking wait for new events in
     /// producer queue. Actually, `rd_kafka_queue_poll` locks some pthread
@@ -240,6 +389,13 @@ void ProducerImpl::DispatchEvent(const EventHolder& event_holder) const {
             rd_kafka_event_log(event, &facility, &message, &log_level);
             LogCallback(facility, message, log_level);
         } break;
+        case RD_KAFKA_EVENT_STATS: {
+            try {
+                StatisticsCallback(rd_kafka_event_stats(event));
+            } catch (const std::exception& e) {
+                LOG_WARNING() << fmt::format("Failed to parse librdkafka statistics: {}", e.what());
+            }
+        } break;
     }
 }
 
@@ -255,7 +411,8 @@ std::size_t ProducerImpl::HandleEvents(std::string_view context) const {
     return handled;
 }
 
-void ProducerImpl::WaitUntilDeliveryReported(engine::Future<DeliveryResult>& delivery_result) const {
+template <typename DeliveryResultFuture>
+void ProducerImpl::WaitUntilDeliveryReported(DeliveryResultFuture& delivery_result) const {
     /// While this task is waiting for corresponding message delivery, it can
     /// handle other messages delivery reports and errors.
     /// Waiting strategy is as follows:
@@ -3,10 +3,13 @@
 #include <chrono>
 #include <cstdint>
 #include <optional>
+#include <vector>
 
 #include <librdkafka/rdkafka.h>
 
 #include <userver/kafka/impl/stats.hpp>
+#include <userver/kafka/producer.hpp>
+#include <userver/utils/span.hpp>
 #include <userver/utils/periodic_task.hpp>
 
 #include <kafka/impl/concurrent_event_waiter.hpp>
@@ -34,6 +37,14 @@ public:
         std::optional<std::uint32_t> partition
     ) const;
 
+    /// @brief Sends the messages with a single `rd_kafka_produce_batch` call
+    /// and waits for the delivery of all of them.
+    /// @returns delivery results in the order of `messages`
+    [[nodiscard]] std::vector<DeliveryResult> SendBatch(
+        const std::string& topic_name,
+        utils::span<const ProducerMessage> messages
+    ) const;
+
     /// @brief Waits until scheduled messages are delivered for
     /// at most 2 x `delivery_timeout`.
     ///
@@ -54,6 +65,13 @@ private:
         std::optional<std::uint32_t> partition
     ) const;
 
+    /// @brief Schedules the delivery of the messages batch.
+    /// @returns the future for delivery results, which must be awaited.
+    [[nodiscard]] engine::Future<std::vector<DeliveryResult>> ScheduleBatchDelivery(
+        const std::string& topic_name,
+        utils::span<const ProducerMessage> messages
+    ) const;
+
     /// @brief Poll a delivery or error event from producer's queue.
     EventHolder PollEvent() const;
 
@@ -68,7 +86,8 @@ private:
 
     /// @brief Waits until message delivery status reported by `librdkafka`.
     /// Suspends for no more than `delivery_timeout` milliseconds.
-    void WaitUntilDeliveryReported(engine::Future<DeliveryResult>& delivery_result) const;
+    template <typename DeliveryResultFuture>
+    void WaitUntilDeliveryReported(DeliveryResultFuture& delivery_result) const;
 
     /// @brief Callback called on error in `librdkafka` work.
     void ErrorCallback(rd_kafka_resp_err_t error, const char* reason, bool is_fatal) const;
@@ -76,11 +95,16 @@ private:
     /// @brief Callback called on debug `librdkafka` messages.
     void LogCallback(const char* facility, const char* message, int log_level) const;
 
+    /// @brief Callback called each `statistics_interval` with `librdkafka`
+    /// statistics JSON. Updates the batching statistics.
+    /// @see https://github.com/confluentinc/librdkafka/blob/master/STATISTICS.md
+    void StatisticsCallback(std::string_view json) const;
+
     /// @brief Callback called on each succeeded/failed message delivery.
     /// @param message represents the delivered (or not) message. Its `_private`
     /// field contains and `opaque` argument, which was passed to
-    /// `rd_kafka_producev`, i.e. the Promise which must be set to notify
-    /// waiter about the delivery.
+    /// `rd_kafka_producev` or `rd_kafka_produce_batch`, i.e. the
+    /// DeliveryReportHandler which must be notified about the delivery.
     void DeliveryReportCallback(const rd_kafka_message_s* message) const;
 
 private:
@@ -91,6 +115,11 @@ private:
     ConcurrentEventWaiters waiters_;
     ProducerHolder producer_;
 
+    /// Topics with non-default topic level options. They are created once on
+    /// start, so that `rd_kafka_producev` uses them instead of creating the
+    /// topics with the default options.
+    std::vector<TopicHolder> configured_topics_;
+
     /// If no messages are send, some errors may occurred and we want to log them anyway.
     utils::PeriodicTask log_events_handler_;
 };
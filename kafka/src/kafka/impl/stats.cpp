@@ -24,8 +24,19 @@ void DumpMetric(utils::statistics::Writer& writer, const Stats& stats) {
         writer[topic]["messages_total"].ValueWithLabels(topic_stats->messages_counts.messages_total.Load(), label);
         writer[topic]["messages_success"].ValueWithLabels(topic_stats->messages_counts.messages_success.Load(), label);
         writer[topic]["messages_error"].ValueWithLabels(topic_stats->messages_counts.messages_error.Load(), label);
+
+        const auto& batching = topic_stats->batching;
+        if (batching.reported.load(std::memory_order_relaxed)) {
+            writer[topic]["delivered_bytes"].ValueWithLabels(topic_stats->delivered_bytes.Load(), label);
+            writer[topic]["batch_size_bytes"].ValueWithLabels(batching.batch_size_bytes.load(), label);
+            writer[topic]["batch_messages"].ValueWithLabels(batching.batch_messages.load(), label);
+            writer[topic]["compression_ratio"].ValueWithLabels(batching.compression_ratio.load(), label);
+        }
     }
     writer["connections_error"].ValueWithLabels(stats.connections_error.Load(), {kSolomonLabel, "component_name"});
+    if (const auto queue_latency_us = stats.queue_latency_us.load(); queue_latency_us != 0) {
+        writer["queue_latency_us"].ValueWithLabels(queue_latency_us, {kSolomonLabel, "component_name"});
+    }
 }
 
 }  // namespace kafka::impl
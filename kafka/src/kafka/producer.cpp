@@ -64,6 +64,14 @@ void SendToTestPoint(
     UASSERT(false);
 }
 
+std::exception_ptr MakeSendError(const impl::DeliveryResult& delivery_result) {
+    try {
+        ThrowSendError(delivery_result);
+    } catch (const SendException&) {
+        return std::current_exception();
+    }
+}
+
 }  // namespace
 
 Producer::Producer(
@@ -108,6 +116,29 @@ engine::TaskWithResult<void> Producer::SendAsync(
     );
 }
 
+std::vector<std::exception_ptr> Producer::SendBatch(
+    const std::string& topic_name,
+    utils::span<const ProducerMessage> messages
+) const {
+    return utils::Async(producer_task_processor_, "producer_send_batch", [this, &topic_name, messages] {
+        tracing::Span::CurrentSpan().AddTag("kafka_producer", name_);
+
+        const auto delivery_results = producer_->SendBatch(topic_name, messages);
+        UASSERT(delivery_results.size() == messages.size());
+
+        std::vector<std::exception_ptr> results(delivery_results.size());
+        for (std::size_t index{0}; index < delivery_results.size(); ++index) {
+            if (!delivery_results[index].IsSuccess()) {
+                results[index] = MakeSendError(delivery_results[index]);
+                continue;
+            }
+            const auto& message = messages[index];
+            SendToTestPoint(name_, topic_name, message.key, message.payload, message.partition);
+        }
+        return results;
+    }).Get();
+}
+
 void Producer::DumpMetric(utils::statistics::Writer& writer) const { impl::DumpMetric(writer, producer_->GetStats()); }
 
 void Producer::SendImpl(
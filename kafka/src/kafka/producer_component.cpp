@@ -101,6 +101,50 @@ properties:
             backoff upper bound.
             The backoff must fit in [1ms; 300000ms]
         defaultDescription: 1000ms
+    compression_codec:
+        type: string
+        description: |
+            compression codec to use for compressing the messages batches.
+            The messages are compressed on the producer side, so the larger
+            batches (see `queue_buffering_max` and `batch_size`) compress better
+        defaultDescription: none
+        enum:
+          - none
+          - gzip
+          - snappy
+          - lz4
+          - zstd
+    topics_compression_codecs:
+        type: object
+        description: |
+            a map of topic names to compression codecs of the topics,
+            overrides `compression_codec` for the listed topics
+        properties: {}
+        additionalProperties:
+            type: string
+            description: compression codec of the topic
+        defaultDescription: '{}'
+    batch_size:
+        type: integer
+        description: |
+            maximum size (in bytes) of all messages batched in one request
+            to the broker
+        minimum: 1
+        maximum: 2147483647
+        defaultDescription: 1000000
+    batch_num_messages:
+        type: integer
+        description: maximum number of messages batched in one request to the broker
+        minimum: 1
+        maximum: 1000000
+        defaultDescription: 10000
+    statistics_interval:
+        type: string
+        description: |
+            interval of the `librdkafka` statistics collection. If not zero,
+            the batch size, batch messages count, compression ratio and
+            queue latency metrics are reported
+        defaultDescription: 0ms
     security_protocol:
         type: string
         description: protocol used to communicate with brokers
@@ -52,6 +52,10 @@ UTEST_F(ConfigurationTest, Producer) {
     EXPECT_EQ(
         configuration->GetOption("retry.backoff.max.ms"), std::to_string(default_producer.retry_backoff_max.count())
     );
+    EXPECT_EQ(configuration->GetOption("compression.codec"), default_producer.compression_codec);
+    EXPECT_EQ(configuration->GetOption("batch.size"), std::to_string(default_producer.batch_size));
+    EXPECT_EQ(configuration->GetOption("batch.num.messages"), std::to_string(default_producer.batch_num_messages));
+    EXPECT_TRUE(configuration->GetTopicsOptions().empty());
 }
 
 UTEST_F(ConfigurationTest, ProducerNonDefault) {
@@ -68,6 +72,11 @@ UTEST_F(ConfigurationTest, ProducerNonDefault) {
     producer_configuration.message_send_max_retries = 3;
     producer_configuration.retry_backoff = 200ms;
     producer_configuration.retry_backoff_max = 2000ms;
+    producer_configuration.compression_codec = "lz4";
+    producer_configuration.batch_size = 4444;
+    producer_configuration.batch_num_messages = 44;
+    producer_configuration.statistics_interval = 5000ms;
+    producer_configuration.topics_compression_codecs["topic-zstd"] = "zstd";
     producer_configuration.rd_kafka_options["session.timeout.ms"] = "3600000";
 
     std::optional<kafka::impl::Configuration> configuration;
@@ -86,7 +95,15 @@ UTEST_F(ConfigurationTest, ProducerNonDefault) {
     EXPECT_EQ(configuration->GetOption("message.send.max.retries"), "3");
     EXPECT_EQ(configuration->GetOption("retry.backoff.ms"), "200");
     EXPECT_EQ(configuration->GetOption("retry.backoff.max.ms"), "2000");
+    EXPECT_EQ(configuration->GetOption("compression.codec"), "lz4");
+    EXPECT_EQ(configuration->GetOption("batch.size"), "4444");
+    EXPECT_EQ(configuration->GetOption("batch.num.messages"), "44");
+    EXPECT_EQ(configuration->GetOption("statistics.interval.ms"), "5000");
     EXPECT_EQ(configuration->GetOption("session.timeout.ms"), "3600000");
+
+    const auto& topics_options = configuration->GetTopicsOptions();
+    ASSERT_EQ(topics_options.size(), 1u);
+    EXPECT_EQ(topics_options.at("topic-zstd").at("compression.codec"), "zstd");
 }
 
 UTEST_F(ConfigurationTest, Consumer) {
@@ -1,6 +1,7 @@
 #include <userver/kafka/utest/kafka_fixture.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <unordered_set>
 #include <vector>
@@ -216,6 +217,36 @@ UTEST_F(ConsumerTest, LargeBatch) {
     EXPECT_LT(callback_calls.load(), kMessagesCount) << callback_calls.load();
 }
 
+UTEST_F_MT(ConsumerTest, PartitionsConcurrently, 2) {
+    constexpr std::size_t kMessagesCount{2 * 2 * kNumPartitionsLargeTopic};
+    const auto messages = utils::GenerateFixedArray(kMessagesCount, [](std::size_t i) {
+        return kafka::utest::Message{
+            kLargeTopic1, fmt::format("key-{}", i), fmt::format("msg-{}", i), i % kNumPartitionsLargeTopic};
+    });
+    SendMessages(messages);
+
+    auto consumer = MakeConsumer("kafka-consumer", /*topics=*/{kLargeTopic1});
+    auto consumer_scope = consumer.MakeConsumerScope();
+
+    std::atomic<std::size_t> consumed{0};
+    std::atomic<bool> mixed_partitions{false};
+    engine::SingleUseEvent consumed_event;
+    consumer_scope.StartPerPartition([&](kafka::MessageBatchView batch) {
+        for (const auto& message : batch) {
+            if (message.GetPartition() != batch[0].GetPartition()) {
+                mixed_partitions = true;
+            }
+        }
+        const auto consumed_before = consumed.fetch_add(batch.size());
+        if (consumed_before < kMessagesCount && consumed_before + batch.size() >= kMessagesCount) {
+            consumed_event.Send();
+        }
+    });
+
+    UEXPECT_NO_THROW(consumed_event.Wait());
+    EXPECT_FALSE(mixed_partitions.load());
+}
+
 UTEST_F_MT(ConsumerTest, OneConsumerPartitionOffsets, 2) {
     constexpr std::size_t kMessagesCount{kNumPartitionsBlockingTopic + 1};
     constexpr std::uint32_t kFirstPartition{0};
@@ -1,6 +1,7 @@
 #include <userver/kafka/utest/kafka_fixture.hpp>
 
 #include <deque>
+#include <string>
 #include <vector>
 
 #include <fmt/format.h>
@@ -80,6 +81,35 @@ UTEST_F(ProducerTest, UnknownPartition) {
     );
 }
 
+UTEST_F(ProducerTest, SendBatch) {
+    constexpr std::size_t kSendCount{100};
+
+    auto producer = MakeProducer("kafka-producer");
+    const std::string topic = GenerateTopic();
+
+    std::vector<std::string> keys;
+    std::vector<std::string> payloads;
+    for (std::size_t send{0}; send < kSendCount; ++send) {
+        keys.push_back(fmt::format("test-key-{}", send));
+        payloads.push_back(fmt::format("test-msg-{}", send));
+    }
+
+    std::vector<kafka::ProducerMessage> messages;
+    for (std::size_t send{0}; send < kSendCount; ++send) {
+        messages.push_back({keys[send], payloads[send]});
+    }
+    messages.push_back({"test-key", "test-msg", /*partition=*/100500});
+
+    const auto results = producer.SendBatch(topic, messages);
+    ASSERT_EQ(results.size(), kSendCount + 1);
+    for (std::size_t send{0}; send < kSendCount; ++send) {
+        EXPECT_FALSE(results[send]) << send;
+    }
+    UEXPECT_THROW(std::rethrow_exception(results.back()), kafka::UnknownPartitionException);
+
+    EXPECT_TRUE(producer.SendBatch(topic, {}).empty());
+}
+
 UTEST_F(ProducerTest, FullQueue) {
     constexpr std::uint32_t kMaxQueueMessages{7};
 
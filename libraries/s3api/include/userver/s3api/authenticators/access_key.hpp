@@ -16,13 +16,17 @@ namespace s3api::authenticators {
 class AccessKey : public Authenticator {
 public:
     AccessKey(std::string access_key, Secret secret_key)
-        : access_key_{std::move(access_key)}, secret_key_{std::move(secret_key)} {}
+        : access_key_{std::move(access_key)},
+          secret_key_{std::move(secret_key)},
+          authorization_prefix_{"AWS " + access_key_ + ":"} {}
     std::unordered_map<std::string, std::string> Auth(const Request& request) const override;
     std::unordered_map<std::string, std::string> Sign(const Request& request, time_t expires) const override;
 
 private:
     std::string access_key_;
     Secret secret_key_;
+    // "AWS <access_key>:", the Authorization header without the signature
+    std::string authorization_prefix_;
 };
 
 }  // namespace s3api::authenticators
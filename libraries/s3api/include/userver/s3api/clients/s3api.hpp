@@ -39,6 +39,10 @@ class ListBucketError : public std::runtime_error {
     using runtime_error::runtime_error;
 };
 
+class MultipartUploadError : public std::runtime_error {
+    using runtime_error::runtime_error;
+};
+
 /// Connection settings - retries, timeouts, and so on
 struct ConnectionCfg {
     explicit ConnectionCfg(
@@ -61,12 +65,19 @@ struct ObjectMeta {
     std::string last_modified;
 };
 
+/// https://docs.aws.amazon.com/AmazonS3/latest/API/API_CompletedPart.html
+struct MultipartUploadPart {
+    int part_number;
+    std::string etag;
+};
+
 /// Represents a connection to s3 api. This object is only forward-declared,
 /// with private implementation (mostly because it is very very ugly)
 class S3Connection;
 
 /// Create an S3Connection object. By itself, it does nothing, but you need
-/// one to create S3 client
+/// one to create S3 client. Clients for the different buckets of the same
+/// endpoint may share a single connection object.
 std::shared_ptr<S3Connection> MakeS3Connection(
     clients::http::Client& http_client,
     S3ConnectionType connection_type,
@@ -156,6 +167,31 @@ public:
     virtual std::string
     CopyObject(std::string_view key_from, std::string_view key_to, const std::optional<Meta>& meta = std::nullopt) = 0;
 
+    /// @brief Starts a multipart upload, returns the upload id
+    /// @throws MultipartUploadError if the response has no upload id
+    virtual std::string CreateMultipartUpload(
+        std::string_view path,
+        const std::optional<Meta>& meta = std::nullopt,
+        std::string_view content_type = "application/octet-stream"
+    ) const = 0;
+
+    /// @brief Uploads a part of a multipart upload, parts are numbered from 1
+    /// @note All the parts except the last one should be at least 5MiB
+    virtual MultipartUploadPart
+    UploadPart(std::string_view path, std::string_view upload_id, int part_number, std::string data) const = 0;
+
+    /// @brief Assembles the object from the uploaded parts
+    /// @param parts the parts in the ascending order of part numbers
+    /// @throws MultipartUploadError if S3 reports an error
+    virtual std::string CompleteMultipartUpload(
+        std::string_view path,
+        std::string_view upload_id,
+        const std::vector<MultipartUploadPart>& parts
+    ) const = 0;
+
+    /// Drops the uploaded parts of the multipart upload
+    virtual void AbortMultipartUpload(std::string_view path, std::string_view upload_id) const = 0;
+
     virtual std::optional<HeadersDataResponse>
     GetObjectHead(std::string_view path, const HeaderDataRequest& request = HeaderDataRequest()) const = 0;
 
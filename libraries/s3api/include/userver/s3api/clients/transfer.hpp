@@ -0,0 +1,112 @@
+#pragma once
+
+/// @file userver/s3api/clients/transfer.hpp
+/// @brief Multipart uploads and parallel ranged downloads of large objects
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/engine/task/task_with_result.hpp>
+
+#include <userver/s3api/clients/s3api.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace s3api {
+
+/// Settings of s3api::MultipartUploader and the parallel downloads
+struct TransferSettings {
+    /// Size of a single uploaded part or downloaded range. S3 requires the
+    /// parts of a multipart upload to be at least 5MiB.
+    std::size_t part_size{8 * 1024 * 1024};
+
+    /// Limit for the concurrent part requests, no more than
+    /// `part_size * max_parallel_parts` bytes are kept in memory
+    std::size_t max_parallel_parts{4};
+};
+
+/// @brief Streams an object into S3 with a multipart upload
+///
+/// Data is buffered until `part_size` is accumulated, and the full parts are
+/// uploaded concurrently in the background. Objects smaller than `part_size`
+/// are uploaded with a single Client::PutObject.
+///
+/// If Finish was not called or failed, the upload is aborted in the
+/// destructor, so the uploaded parts are not left in the bucket.
+///
+/// ## Example usage:
+///
+/// @code
+/// s3api::MultipartUploader uploader{*client, "path/to/object"};
+/// for (const auto& chunk : source) uploader.Write(chunk);
+/// uploader.Finish();
+/// @endcode
+class MultipartUploader final {
+public:
+    /// @param client client to upload with, must outlive the uploader
+    MultipartUploader(
+        const Client& client,
+        std::string path,
+        TransferSettings settings = {},
+        std::string content_type = "application/octet-stream"
+    );
+
+    MultipartUploader(MultipartUploader&&) = delete;
+    MultipartUploader& operator=(MultipartUploader&&) = delete;
+
+    ~MultipartUploader();
+
+    /// @brief Appends the data to the object, uploads the full parts
+    /// @throws std::exception if uploading of a previous part failed
+    void Write(std::string_view data);
+
+    /// @brief Uploads the rest of the data and assembles the object
+    /// @returns the response of the last request
+    std::string Finish();
+
+private:
+    void StartPart();
+    void WaitParts(std::size_t max_in_flight);
+    void Abort() noexcept;
+
+    const Client& client_;
+    const std::string path_;
+    const TransferSettings settings_;
+    const std::string content_type_;
+
+    std::string buffer_;
+    std::optional<std::string> upload_id_;
+    int next_part_number_{1};
+    std::vector<MultipartUploadPart> uploaded_parts_;
+    bool is_finished_{false};
+
+    // This should be the last member
+    std::deque<engine::TaskWithResult<MultipartUploadPart>> in_flight_;
+};
+
+/// @brief Downloads the object with concurrent ranged GETs, invoking the
+/// callback for the consecutive chunks of the object in order
+///
+/// No more than `max_parallel_parts` chunks are kept in memory. The object
+/// should not be modified during the download.
+///
+/// @throws std::runtime_error if the object size can not be retrieved
+void ForEachObjectChunk(
+    const Client& client,
+    std::string_view path,
+    const std::function<void(std::string_view)>& callback,
+    const TransferSettings& settings = {}
+);
+
+/// @brief Downloads the whole object with concurrent ranged GETs
+/// @see s3api::ForEachObjectChunk
+std::string GetObjectParallel(const Client& client, std::string_view path, const TransferSettings& settings = {});
+
+}  // namespace s3api
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/s3api/authenticators/utils.hpp>
 
+#include <functional>
 #include <map>
 #include <optional>
 #include <set>
@@ -8,6 +9,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include <userver/clients/http/request.hpp>
+#include <userver/compiler/thread_local.hpp>
 #include <userver/crypto/hash.hpp>
 #include <userver/utils/datetime.hpp>
 
@@ -51,12 +53,18 @@ std::string RemoveExcessiveSpaces(std::string value) {
     return result;
 }
 
-std::string MakeHeaderDate() {
+namespace {
+
+struct HeaderDateCache final {
+    time_t last_time{-1};
+    std::string last_header_date;
+};
+
+std::string FormatHeaderDate(time_t time) {
     static constexpr int kHeaderDateLength{64};
 
     std::string header_date(kHeaderDateLength, '\0');
 
-    auto time = std::chrono::system_clock::to_time_t(utils::datetime::Now());
     std::tm ptm{};
     gmtime_r(&time, &ptm);
     auto result_len = std::strftime(&header_date.front(), header_date.size(), "%a, %d %b %Y %T %z", &ptm);
@@ -71,6 +79,21 @@ std::string MakeHeaderDate() {
     return header_date;
 }
 
+}  // namespace
+
+std::string MakeHeaderDate() {
+    // The date has a precision of a second, so it is formatted once per second
+    static compiler::ThreadLocal local_cache = [] { return HeaderDateCache{}; };
+    auto cache = local_cache.Use();
+
+    const auto time = std::chrono::system_clock::to_time_t(utils::datetime::Now());
+    if (time != cache->last_time) {
+        cache->last_header_date = FormatHeaderDate(time);
+        cache->last_time = time;
+    }
+    return cache->last_header_date;
+}
+
 std::string MakeHeaderContentMd5(const std::string& data) {
     return crypto::hash::weak::Md5(data, crypto::hash::OutputEncoding::kBase64);
 }
@@ -144,7 +167,7 @@ std::string MakeStringToSign(
             signature << '/' + request.bucket;
         }
 
-        auto actual_subresources = std::set<std::string>{
+        static const std::set<std::string, std::less<>> kActualSubresources{
             "acl",
             "lifecycle",
             "location",
@@ -177,7 +200,7 @@ std::string MakeStringToSign(
                     subresource.resize(eq_pos);
                 }
 
-                if (actual_subresources.count(subresource) != 0) {
+                if (kActualSubresources.count(subresource) != 0) {
                     subresources.emplace(std::move(subresource), std::move(parameter_value));
                 }
             }
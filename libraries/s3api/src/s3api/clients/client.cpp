@@ -147,6 +147,45 @@ std::vector<std::string> ParseS3DirectoriesListResponse(std::string_view s3_resp
     return result;
 }
 
+std::string ParseInitiateMultipartUploadResponse(std::string_view s3_response) {
+    pugi::xml_document xml;
+    const pugi::xml_parse_result parse_result = xml.load_buffer(s3_response.data(), s3_response.size());
+    if (parse_result.status != pugi::status_ok) {
+        throw MultipartUploadError(fmt::format(
+            "Failed to parse S3 initiate multipart upload response as xml, error: {}, response: {}",
+            parse_result.description(),
+            s3_response
+        ));
+    }
+    std::string upload_id = xml.child("InitiateMultipartUploadResult").child("UploadId").child_value();
+    if (upload_id.empty()) {
+        throw MultipartUploadError(
+            fmt::format("No UploadId in S3 initiate multipart upload response: {}", s3_response)
+        );
+    }
+    return upload_id;
+}
+
+// S3 may report an error with 200 status code after it started responding
+void CheckCompleteMultipartUploadResponse(std::string_view s3_response) {
+    pugi::xml_document xml;
+    const pugi::xml_parse_result parse_result = xml.load_buffer(s3_response.data(), s3_response.size());
+    if (parse_result.status != pugi::status_ok) {
+        throw MultipartUploadError(fmt::format(
+            "Failed to parse S3 complete multipart upload response as xml, error: {}, response: {}",
+            parse_result.description(),
+            s3_response
+        ));
+    }
+    if (const auto error = xml.child("Error")) {
+        throw MultipartUploadError(fmt::format(
+            "S3 failed to complete multipart upload, code: {}, message: {}",
+            error.child("Code").child_value(),
+            error.child("Message").child_value()
+        ));
+    }
+}
+
 }  // namespace
 
 void ClientImpl::UpdateConfig(ConnectionCfg&& config) { conn_->UpdateConfig(std::move(config)); }
@@ -266,6 +305,50 @@ std::string ClientImpl::TryGetPartialObject(
     return RequestApi(req, "get_object", headers_data, headers_request);
 }
 
+std::string ClientImpl::CreateMultipartUpload(
+    std::string_view path,
+    const std::optional<Meta>& meta,
+    std::string_view content_type
+) const {
+    auto req = api_methods::CreateMultipartUpload(bucket_, path, content_type);
+    if (meta.has_value()) {
+        SaveMeta(req.headers, meta.value());
+    }
+    return ParseInitiateMultipartUploadResponse(RequestApi(req, "create_multipart_upload"));
+}
+
+MultipartUploadPart
+ClientImpl::UploadPart(std::string_view path, std::string_view upload_id, int part_number, std::string data) const {
+    auto req = api_methods::UploadPart(bucket_, path, upload_id, part_number, std::move(data));
+
+    HeadersDataResponse headers_data;
+    const HeaderDataRequest headers_request{
+        std::unordered_set<std::string>{std::string{USERVER_NAMESPACE::http::headers::kETag}}, false};
+    RequestApi(req, "upload_part", &headers_data, headers_request);
+
+    const auto etag = headers_data.headers->find(USERVER_NAMESPACE::http::headers::kETag);
+    if (etag == headers_data.headers->end()) {
+        throw MultipartUploadError(fmt::format("No ETag in S3 upload part response, part: {}", part_number));
+    }
+    return MultipartUploadPart{part_number, etag->second};
+}
+
+std::string ClientImpl::CompleteMultipartUpload(
+    std::string_view path,
+    std::string_view upload_id,
+    const std::vector<MultipartUploadPart>& parts
+) const {
+    auto req = api_methods::CompleteMultipartUpload(bucket_, path, upload_id, parts);
+    auto response = RequestApi(req, "complete_multipart_upload");
+    CheckCompleteMultipartUploadResponse(response);
+    return response;
+}
+
+void ClientImpl::AbortMultipartUpload(std::string_view path, std::string_view upload_id) const {
+    auto req = api_methods::AbortMultipartUpload(bucket_, path, upload_id);
+    RequestApi(req, "abort_multipart_upload");
+}
+
 std::optional<ClientImpl::HeadersDataResponse>
 ClientImpl::GetObjectHead(std::string_view path, const HeaderDataRequest& headers_request) const {
     HeadersDataResponse headers_data;
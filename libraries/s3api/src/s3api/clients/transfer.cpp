@@ -0,0 +1,162 @@
+#include <userver/s3api/clients/transfer.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <unordered_set>
+
+#include <fmt/format.h>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/exception.hpp>
+#include <userver/utils/from_string.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace s3api {
+
+namespace {
+
+std::size_t GetObjectSize(const Client& client, std::string_view path) {
+    const Client::HeaderDataRequest request{
+        std::unordered_set<std::string>{std::string{USERVER_NAMESPACE::http::headers::kContentLength}}, false};
+    const auto head = client.GetObjectHead(path, request);
+    if (!head || !head->headers) {
+        USERVER_NAMESPACE::utils::LogErrorAndThrow(fmt::format("S3Api : Failed to get object head: {}", path));
+    }
+
+    const auto it = head->headers->find(USERVER_NAMESPACE::http::headers::kContentLength);
+    if (it == head->headers->end()) {
+        USERVER_NAMESPACE::utils::LogErrorAndThrow(fmt::format("S3Api : No Content-Length in object head: {}", path));
+    }
+    return utils::FromString<std::size_t>(it->second);
+}
+
+}  // namespace
+
+MultipartUploader::MultipartUploader(
+    const Client& client,
+    std::string path,
+    TransferSettings settings,
+    std::string content_type
+)
+    : client_(client), path_(std::move(path)), settings_(settings), content_type_(std::move(content_type)) {
+    UINVARIANT(settings_.part_size > 0, "part_size should be positive");
+    UINVARIANT(settings_.max_parallel_parts > 0, "max_parallel_parts should be positive");
+}
+
+MultipartUploader::~MultipartUploader() {
+    if (!is_finished_) Abort();
+}
+
+void MultipartUploader::Write(std::string_view data) {
+    UINVARIANT(!is_finished_, "Write after Finish");
+
+    while (!data.empty()) {
+        const auto size = std::min(data.size(), settings_.part_size - buffer_.size());
+        buffer_.append(data.substr(0, size));
+        data.remove_prefix(size);
+
+        if (buffer_.size() == settings_.part_size) StartPart();
+    }
+}
+
+std::string MultipartUploader::Finish() {
+    UINVARIANT(!is_finished_, "Finish is called twice");
+
+    if (!upload_id_) {
+        // The whole object fits into a single part
+        auto response = client_.PutObject(path_, std::move(buffer_), std::nullopt, content_type_);
+        is_finished_ = true;
+        return response;
+    }
+
+    if (!buffer_.empty()) StartPart();
+    WaitParts(0);
+
+    auto response = client_.CompleteMultipartUpload(path_, *upload_id_, uploaded_parts_);
+    is_finished_ = true;
+    return response;
+}
+
+void MultipartUploader::StartPart() {
+    if (!upload_id_) upload_id_ = client_.CreateMultipartUpload(path_, std::nullopt, content_type_);
+
+    // Backpressure: no more than max_parallel_parts are kept in memory
+    WaitParts(settings_.max_parallel_parts - 1);
+
+    in_flight_.push_back(utils::Async(
+        "s3_upload_part",
+        [this, part_number = next_part_number_++, data = std::move(buffer_)]() mutable {
+            return client_.UploadPart(path_, *upload_id_, part_number, std::move(data));
+        }
+    ));
+    buffer_.clear();
+}
+
+void MultipartUploader::WaitParts(std::size_t max_in_flight) {
+    // Parts are started in the ascending order, so the uploaded parts stay
+    // sorted as required by CompleteMultipartUpload
+    while (in_flight_.size() > max_in_flight) {
+        uploaded_parts_.push_back(in_flight_.front().Get());
+        in_flight_.pop_front();
+    }
+}
+
+void MultipartUploader::Abort() noexcept {
+    // Cancels and waits for the parts in flight
+    in_flight_.clear();
+    if (!upload_id_) return;
+
+    try {
+        client_.AbortMultipartUpload(path_, *upload_id_);
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to abort multipart upload of " << path_ << ": " << ex;
+    }
+}
+
+void ForEachObjectChunk(
+    const Client& client,
+    std::string_view path,
+    const std::function<void(std::string_view)>& callback,
+    const TransferSettings& settings
+) {
+    UINVARIANT(settings.part_size > 0, "part_size should be positive");
+    UINVARIANT(settings.max_parallel_parts > 0, "max_parallel_parts should be positive");
+
+    const auto object_size = GetObjectSize(client, path);
+
+    std::size_t next_offset = 0;
+    std::deque<engine::TaskWithResult<std::string>> in_flight;
+    const auto start_range = [&] {
+        const auto begin = next_offset;
+        const auto end = std::min(begin + settings.part_size, object_size);
+        next_offset = end;
+        auto range = fmt::format("bytes={}-{}", begin, end - 1);
+        in_flight.push_back(utils::Async("s3_get_range", [&client, path, range = std::move(range)] {
+            return client.TryGetPartialObject(path, range);
+        }));
+    };
+
+    while (next_offset < object_size && in_flight.size() < settings.max_parallel_parts) start_range();
+
+    while (!in_flight.empty()) {
+        const auto chunk = in_flight.front().Get();
+        in_flight.pop_front();
+        if (next_offset < object_size) start_range();
+
+        callback(chunk);
+    }
+}
+
+std::string GetObjectParallel(const Client& client, std::string_view path, const TransferSettings& settings) {
+    std::string result;
+    ForEachObjectChunk(client, path, [&result](std::string_view chunk) { result.append(chunk); }, settings);
+    return result;
+}
+
+}  // namespace s3api
+
+USERVER_NAMESPACE_END
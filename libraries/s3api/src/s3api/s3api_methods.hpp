@@ -2,9 +2,11 @@
 
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <userver/http/predefined_header.hpp>
 
+#include <userver/s3api/clients/s3api.hpp>
 #include <userver/s3api/models/request.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -30,6 +32,25 @@ GetObject(std::string_view bucket, std::string_view path, std::optional<std::str
 
 Request GetObjectHead(std::string_view bucket, std::string_view path);
 
+Request CreateMultipartUpload(std::string_view bucket, std::string_view path, std::string_view content_type);
+
+Request UploadPart(
+    std::string_view bucket,
+    std::string_view path,
+    std::string_view upload_id,
+    int part_number,
+    std::string data
+);
+
+Request CompleteMultipartUpload(
+    std::string_view bucket,
+    std::string_view path,
+    std::string_view upload_id,
+    const std::vector<MultipartUploadPart>& parts
+);
+
+Request AbortMultipartUpload(std::string_view bucket, std::string_view path, std::string_view upload_id);
+
 void SetRange(Request& req, size_t begin, size_t end);
 
 void SetRange(Request& req, std::string_view range);
@@ -40,6 +40,37 @@ TEST(S3ApiMethods, GetObjectWithRange) {
     );
 }
 
+TEST(S3ApiMethods, MultipartUpload) {
+    const std::string bucket = "bucket";
+    const std::string path = "path";
+    const std::string upload_id = "upload-id";
+
+    const Request create = CreateMultipartUpload(bucket, path, "application/octet-stream");
+    EXPECT_EQ(create.method, USERVER_NAMESPACE::clients::http::HttpMethod::kPost);
+    EXPECT_EQ(create.req, "path?uploads");
+
+    const Request upload = UploadPart(bucket, path, upload_id, 2, "data");
+    EXPECT_EQ(upload.method, USERVER_NAMESPACE::clients::http::HttpMethod::kPut);
+    EXPECT_NE(upload.req.find("partNumber=2"), std::string::npos);
+    EXPECT_NE(upload.req.find("uploadId=upload-id"), std::string::npos);
+    EXPECT_EQ(upload.body, "data");
+
+    const Request complete = CompleteMultipartUpload(bucket, path, upload_id, {{1, "\"etag1\""}, {2, "\"etag2\""}});
+    EXPECT_EQ(complete.method, USERVER_NAMESPACE::clients::http::HttpMethod::kPost);
+    EXPECT_EQ(complete.req, "path?uploadId=upload-id");
+    EXPECT_EQ(
+        complete.body,
+        "<CompleteMultipartUpload>"
+        "<Part><PartNumber>1</PartNumber><ETag>\"etag1\"</ETag></Part>"
+        "<Part><PartNumber>2</PartNumber><ETag>\"etag2\"</ETag></Part>"
+        "</CompleteMultipartUpload>"
+    );
+
+    const Request abort = AbortMultipartUpload(bucket, path, upload_id);
+    EXPECT_EQ(abort.method, USERVER_NAMESPACE::clients::http::HttpMethod::kDelete);
+    EXPECT_EQ(abort.req, "path?uploadId=upload-id");
+}
+
 }  // namespace s3api::api_methods
 
 USERVER_NAMESPACE_END
@@ -82,6 +82,29 @@ public:
         (override)
     );
 
+    MOCK_METHOD(
+        std::string,
+        CreateMultipartUpload,
+        (std::string_view path, const std::optional<Meta>& meta, std::string_view content_type),
+        (const, override)
+    );
+
+    MOCK_METHOD(
+        MultipartUploadPart,
+        UploadPart,
+        (std::string_view path, std::string_view upload_id, int part_number, std::string data),
+        (const, override)
+    );
+
+    MOCK_METHOD(
+        std::string,
+        CompleteMultipartUpload,
+        (std::string_view path, std::string_view upload_id, const std::vector<MultipartUploadPart>& parts),
+        (const, override)
+    );
+
+    MOCK_METHOD(void, AbortMultipartUpload, (std::string_view path, std::string_view upload_id), (const, override));
+
     MOCK_METHOD(
         std::optional<HeadersDataResponse>,
         GetObjectHead,
@@ -89,6 +89,10 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 ///   static ObjectType DeserializeObject(const formats::bson::Document& doc) {
 ///     return doc["value"].As<ObjectType>();
 ///   }
+///   // or, to parse without building the tree of formats::bson::Value nodes
+///   static ObjectType DeserializeObject(const formats::bson::Document& doc) {
+///     return formats::bson::ValueView{doc}["value"].As<ObjectType>();
+///   }
 ///   // (default implementation calls doc.As<ObjectType>())
 ///   // For using default implementation
 ///   static constexpr bool kUseDefaultDeserializeObject = true;
@@ -104,7 +108,8 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 ///     return find_op;
 ///   }
 ///   // (default implementation queries kMongoUpdateFieldName: {$gt: last_update}
-///   // for incremental updates, and {} for full updates)
+///   // for incremental updates, and {} for full updates, the latter with
+///   // mongo::options::CursorPrefetch)
 ///   // For using default implementation
 ///   static constexpr bool kUseDefaultFindOperation = true;
 ///
@@ -303,7 +308,12 @@ storages::mongo::operations::Find MongoCache<MongoCacheTraits>::GetFindOperation
                         bson::MakeDoc("$gt", last_update - correction);
                 }
             }
-            return sm::operations::Find(query_builder.ExtractValue());
+            sm::operations::Find find_op(query_builder.ExtractValue());
+            if (type == cache::UpdateType::kFull) {
+                // Full updates read the whole collection, fetch ahead of the parsing
+                find_op.SetOption(sm::options::CursorPrefetch{});
+            }
+            return find_op;
         }
         UASSERT_MSG(false, "No find operation defined but GetFindOperation invoked");
     }();
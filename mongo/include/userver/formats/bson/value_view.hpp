@@ -0,0 +1,266 @@
+#pragma once
+
+/// @file userver/formats/bson/value_view.hpp
+/// @brief @copybrief formats::bson::ValueView
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <bson/bson.h>
+
+#include <userver/formats/bson/exception.hpp>
+#include <userver/formats/bson/types.hpp>
+#include <userver/formats/common/meta.hpp>
+#include <userver/formats/parse/common.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+
+class Document;
+class Value;
+
+// clang-format off
+
+/// @brief Non-owning read-only view of a BSON value
+///
+/// Unlike formats::bson::Value, which builds a tree of nodes on member access,
+/// ValueView walks the underlying buffer with `bson_iter_t` and never
+/// allocates. Member lookups scan the parent document, so it is the best fit
+/// for the parse-once access patterns, e.g. parsing of the cursor results:
+///
+/// @code
+/// for (const auto& doc : cursor) {
+///   auto object = formats::bson::ValueView{doc}.As<MyObject>();
+/// }
+/// @endcode
+///
+/// Any `Parse(const Value&, formats::parse::To<T>)` templated on `Value` works
+/// with ValueView. Strings may be parsed as `std::string_view`, which points
+/// into the buffer.
+///
+/// @warning The viewed document must outlive the view and everything parsed
+/// into `std::string_view`.
+/// @note Exceptions contain the name of the element instead of the full path,
+/// as the view does not know its parents.
+
+// clang-format on
+class ValueView final {
+public:
+    class const_iterator;
+
+    using Exception = formats::bson::BsonException;
+    using ParseException = formats::bson::ParseException;
+    using ExceptionWithPath = formats::bson::ExceptionWithPath;
+
+    /// Constructs a missing value
+    ValueView() noexcept = default;
+
+    /// Views the whole document
+    explicit ValueView(const Document& document) noexcept;
+    explicit ValueView(Document&&) = delete;
+
+    /// Views the whole document stored in the raw buffer
+    ValueView(const uint8_t* data, size_t size) noexcept;
+
+    /// @brief Selects a document field by name, missing fields produce
+    /// missing values
+    /// @throws TypeMismatchException if the value is not a missing, null or
+    /// a document
+    ValueView operator[](std::string_view name) const;
+
+    /// @brief Selects an array element by index
+    /// @throws TypeMismatchException if the value is not an array
+    /// @throws OutOfBoundsException if the index is greater than the size
+    ValueView operator[](uint32_t index) const;
+
+    /// @brief Checks whether the document has a field
+    /// @throws TypeMismatchException if the value is not a missing, null or
+    /// a document
+    bool HasMember(std::string_view name) const;
+
+    /// @brief Returns an iterator over the array elements or document fields
+    /// @throws TypeMismatchException if the value is not an array or a document
+    const_iterator begin() const;
+
+    /// Returns the end iterator
+    const_iterator end() const;
+
+    /// @brief Returns whether the array or the document is empty
+    /// @throws TypeMismatchException if the value is not an array or a document
+    bool IsEmpty() const;
+
+    /// @brief Returns the number of array elements or document fields
+    /// @throws TypeMismatchException if the value is not an array or a document
+    /// @note Has linear complexity.
+    uint32_t GetSize() const;
+
+    /// Returns the name of the element, empty for the root document
+    std::string GetPath() const;
+
+    /// @brief Returns the name of the element, empty for the root document
+    /// @note Points into the viewed buffer.
+    std::string_view GetName() const;
+
+    /// @name Type checking
+    /// @{
+    bool IsMissing() const { return kind_ == Kind::kMissing; }
+    bool IsArray() const { return GetType() == BSON_TYPE_ARRAY; }
+    bool IsDocument() const { return GetType() == BSON_TYPE_DOCUMENT; }
+    bool IsNull() const { return GetType() == BSON_TYPE_NULL; }
+    bool IsBool() const { return GetType() == BSON_TYPE_BOOL; }
+    bool IsInt32() const { return GetType() == BSON_TYPE_INT32; }
+    bool IsInt64() const { return GetType() == BSON_TYPE_INT64; }
+    bool IsDouble() const { return GetType() == BSON_TYPE_DOUBLE; }
+    bool IsString() const { return GetType() == BSON_TYPE_UTF8; }
+    bool IsDateTime() const { return GetType() == BSON_TYPE_DATE_TIME; }
+    bool IsOid() const { return GetType() == BSON_TYPE_OID; }
+    bool IsBinary() const { return GetType() == BSON_TYPE_BINARY; }
+    bool IsDecimal128() const { return GetType() == BSON_TYPE_DECIMAL128; }
+    bool IsTimestamp() const { return GetType() == BSON_TYPE_TIMESTAMP; }
+
+    bool IsObject() const { return IsDocument(); }
+    /// @}
+
+    /// @brief Extracts the specified type with strict type checks
+    /// @throws MemberMissingException if the value is missing
+    /// @throws TypeMismatchException if the value has a different type
+    template <typename T>
+    auto As() const {
+        static_assert(
+            formats::common::impl::kHasParse<ValueView, T>,
+            "There is no `Parse(const ValueView&, formats::parse::To<T>)` in "
+            "namespace of `T` or `formats::parse`. "
+            "Probably you have not provided a `Parse` function overload."
+        );
+
+        return Parse(*this, formats::parse::To<T>{});
+    }
+
+    /// Extracts the specified type with strict type checks, or constructs the
+    /// default value when the field is missing or null
+    template <typename T, typename First, typename... Rest>
+    auto As(First&& default_arg, Rest&&... more_default_args) const {
+        if (IsMissing() || IsNull()) {
+            // intended raw ctor call, sometimes casts
+            // NOLINTNEXTLINE(google-readability-casting)
+            return decltype(As<T>())(std::forward<First>(default_arg), std::forward<Rest>(more_default_args)...);
+        }
+        return As<T>();
+    }
+
+    /// @brief Copies the viewed value into formats::bson::Value
+    /// @note Allocates, intended for the rare cases when a part of
+    /// the document is needed as a tree.
+    Value ToValue() const;
+
+    /// @throws MemberMissingException if the value is missing
+    void CheckNotMissing() const;
+
+    /// @throws TypeMismatchException if the value is not an array or null
+    void CheckArrayOrNull() const;
+
+    /// @throws TypeMismatchException if the value is not a document or null
+    void CheckDocumentOrNull() const;
+
+    void CheckObjectOrNull() const { CheckDocumentOrNull(); }
+
+    /// @cond
+    // Value type, BSON_TYPE_EOD for missing values, internal use only
+    bson_type_t GetType() const;
+
+    // Iterator positioned at the element, internal use only
+    const bson_iter_t& GetNativeIter() const;
+    /// @endcond
+
+private:
+    enum class Kind : uint8_t { kMissing, kRoot, kElement };
+
+    explicit ValueView(const bson_iter_t& element) noexcept;
+
+    // Initializes the iterator over the array elements or document fields
+    bool InitChildren(bson_iter_t& children) const;
+
+    void CheckContainer() const;
+
+    Kind kind_{Kind::kMissing};
+    // The whole document for kRoot
+    const uint8_t* data_{nullptr};
+    size_t size_{0};
+    // The element for kElement
+    bson_iter_t element_{};
+};
+
+/// Iterator over the elements of the viewed array or document
+class ValueView::const_iterator final {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = ptrdiff_t;
+    using value_type = ValueView;
+    using reference = const ValueView&;
+    using pointer = const ValueView*;
+
+    /// Constructs the end iterator
+    const_iterator() noexcept = default;
+
+    const_iterator operator++(int);
+    const_iterator& operator++();
+    reference operator*() const { return current_; }
+    pointer operator->() const { return &current_; }
+
+    bool operator==(const const_iterator& other) const;
+    bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    /// Returns the name of the current document field
+    std::string GetName() const { return std::string{current_.GetName()}; }
+
+    /// Returns the index of the current array element
+    uint32_t GetIndex() const { return index_; }
+
+private:
+    friend class ValueView;
+
+    explicit const_iterator(const bson_iter_t& children);
+
+    void Advance();
+
+    bson_iter_t children_{};
+    ValueView current_;
+    uint32_t index_{0};
+};
+
+bool Parse(const ValueView& value, parse::To<bool>);
+
+int64_t Parse(const ValueView& value, parse::To<int64_t>);
+
+uint64_t Parse(const ValueView& value, parse::To<uint64_t>);
+
+double Parse(const ValueView& value, parse::To<double>);
+
+std::string Parse(const ValueView& value, parse::To<std::string>);
+
+/// Points into the viewed buffer
+std::string_view Parse(const ValueView& value, parse::To<std::string_view>);
+
+std::chrono::system_clock::time_point Parse(const ValueView& value, parse::To<std::chrono::system_clock::time_point>);
+
+Oid Parse(const ValueView& value, parse::To<Oid>);
+
+Binary Parse(const ValueView& value, parse::To<Binary>);
+
+Decimal128 Parse(const ValueView& value, parse::To<Decimal128>);
+
+Timestamp Parse(const ValueView& value, parse::To<Timestamp>);
+
+/// Copies the viewed document
+Document Parse(const ValueView& value, parse::To<Document>);
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
@@ -33,6 +33,7 @@ public:
     void SetOption(options::WriteConcern::Level);
     void SetOption(const options::WriteConcern&);
     void SetOption(options::SuppressServerExceptions);
+    void SetOption(const options::ParallelBulk&);
 
     /// Inserts a single document
     template <typename... Options>
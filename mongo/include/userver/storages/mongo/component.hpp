@@ -60,6 +60,7 @@ namespace components {
 /// max_size | limit for total connections number | 128
 /// idle_limit | limit for idle connections number | 64
 /// connecting_limit | limit for establishing connections number | 8
+/// min_idle | number of idle connections kept ready by the pool maintenance | 0
 /// local_threshold | latency window for instance selection | mongodb default
 /// max_replication_lag | replication lag limit for usable secondaries, min. 90s | -
 /// maintenance_period | pool maintenance period (idle connections pruning etc.) | 15s
@@ -163,6 +164,7 @@ inline constexpr bool kHasValidate<Mongo> = true;
 /// max_size | limit for total connections number (per database) | 128
 /// idle_limit | limit for idle connections number (per database) | 64
 /// connecting_limit | limit for establishing connections number (per database) | 8
+/// min_idle | number of idle connections kept ready by the pool maintenance (per database) | 0
 /// local_threshold | latency window for instance selection | mongodb default
 /// max_replication_lag | replication lag limit for usable secondaries, min. 90s | -
 /// stats_verbosity | changes the granularity of reported metrics | 'terse'
@@ -98,6 +98,7 @@ public:
     void SetOption(options::Tailable);
     void SetOption(const options::Comment&);
     void SetOption(const options::MaxServerTime&);
+    void SetOption(const options::CursorPrefetch&);
 
 private:
     friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
@@ -121,6 +121,32 @@ private:
 /// Disables ordering on bulk operations causing them to continue after an error
 class Unordered {};
 
+/// @brief Splits an unordered bulk into chunks of a limited size, which are
+/// executed concurrently over separate connections
+/// @note Has no effect on ordered bulks. Should be set before any operation is
+/// appended. Indices in the merged WriteResult refer to the whole bulk.
+class ParallelBulk {
+public:
+    static constexpr size_t kDefaultMaxChunkBytes = 4 * 1024 * 1024;
+    static constexpr size_t kDefaultMaxConcurrency = 4;
+
+    explicit ParallelBulk(
+        size_t max_chunk_bytes = kDefaultMaxChunkBytes,
+        size_t max_concurrency = kDefaultMaxConcurrency
+    )
+        : max_chunk_bytes_(max_chunk_bytes), max_concurrency_(max_concurrency) {}
+
+    /// Total BSON size of the operations in a single chunk
+    size_t MaxChunkBytes() const { return max_chunk_bytes_; }
+
+    /// Maximum number of chunks being executed at the same time
+    size_t MaxConcurrency() const { return max_concurrency_; }
+
+private:
+    size_t max_chunk_bytes_;
+    size_t max_concurrency_;
+};
+
 /// Enables insertion of a new document when update selector matches nothing
 class Upsert {};
 
@@ -299,6 +325,23 @@ private:
     std::chrono::milliseconds value_;
 };
 
+/// @brief Fetches the next part of the cursor results in background, while
+/// the current one is being consumed
+/// @note The server batch size is tuned by the sizes of the received documents
+/// so that a batch holds about `target_batch_bytes`.
+class CursorPrefetch {
+public:
+    static constexpr size_t kDefaultTargetBatchBytes = 4 * 1024 * 1024;
+
+    explicit CursorPrefetch(size_t target_batch_bytes = kDefaultTargetBatchBytes)
+        : target_batch_bytes_(target_batch_bytes) {}
+
+    size_t TargetBatchBytes() const { return target_batch_bytes_; }
+
+private:
+    size_t target_batch_bytes_;
+};
+
 }  // namespace storages::mongo::options
 
 USERVER_NAMESPACE_END
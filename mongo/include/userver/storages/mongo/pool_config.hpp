@@ -33,6 +33,8 @@ struct PoolSettings final {
     static constexpr size_t kDefaultIdleLimit = 64;
     /// Default establishing connections limit
     static constexpr size_t kDefaultConnectingLimit = 8;
+    /// Default count of idle connections kept ready
+    static constexpr size_t kDefaultMinIdle = 0;
 
     /// Initial connection count
     size_t initial_size = kDefaultInitialSize;
@@ -42,6 +44,8 @@ struct PoolSettings final {
     size_t idle_limit = kDefaultIdleLimit;
     /// Establishing connections limit
     size_t connecting_limit = kDefaultConnectingLimit;
+    /// Count of idle connections that the pool maintenance keeps ready
+    size_t min_idle = kDefaultMinIdle;
 
     /// @throws InvalidConfigException if pool settings are invalid
     void Validate(const std::string& pool_id) const;
@@ -115,4 +115,18 @@ void bson_path_first_access(benchmark::State& state) {
 }
 BENCHMARK(bson_path_first_access);
 
+void bson_view_path_access(benchmark::State& state) {
+    const auto bson = formats::bson::FromJsonString(bench_bson_data);
+    for (auto _ : state) {
+        const formats::bson::ValueView view{bson};
+        const auto res =
+            (view["nested_very_long_long_long_long_path"]["deeply"]["deeply"]["nested"]["bson"]["value"]["with"]["some"]
+                 ["data"]
+                     .As<std::string_view>() == "4");
+        benchmark::DoNotOptimize(res);
+        if (!res) throw std::runtime_error("unexpected");
+    }
+}
+BENCHMARK(bson_view_path_access);
+
 USERVER_NAMESPACE_END
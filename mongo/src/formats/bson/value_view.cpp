@@ -0,0 +1,286 @@
+#include <userver/formats/bson/value_view.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include <userver/formats/bson/binary.hpp>
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/value.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/algo.hpp>
+
+#include <formats/bson/wrappers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+namespace {
+
+constexpr std::int64_t kMaxIntDouble{std::int64_t{1} << std::numeric_limits<double>::digits};
+
+[[noreturn]] void ThrowTypeMismatch(const ValueView& value, bson_type_t expected) {
+    value.CheckNotMissing();
+    throw TypeMismatchException(value.GetType(), expected, value.GetPath());
+}
+
+std::string_view GetString(const ValueView& value) {
+    uint32_t length = 0;
+    const char* data = bson_iter_utf8(&value.GetNativeIter(), &length);
+    return {data, length};
+}
+
+}  // namespace
+
+ValueView::ValueView(const Document& document) noexcept {
+    const auto* native = document.GetBson().get();
+    kind_ = Kind::kRoot;
+    data_ = bson_get_data(native);
+    size_ = native->len;
+}
+
+ValueView::ValueView(const uint8_t* data, size_t size) noexcept : kind_(Kind::kRoot), data_(data), size_(size) {}
+
+ValueView::ValueView(const bson_iter_t& element) noexcept : kind_(Kind::kElement), element_(element) {}
+
+ValueView ValueView::operator[](std::string_view name) const {
+    if (IsMissing() || IsNull()) return {};
+    if (!IsDocument()) ThrowTypeMismatch(*this, BSON_TYPE_DOCUMENT);
+
+    bson_iter_t children;
+    if (!InitChildren(children)) return {};
+    while (bson_iter_next(&children)) {
+        if (std::string_view{bson_iter_key(&children), bson_iter_key_len(&children)} == name) {
+            return ValueView{children};
+        }
+    }
+    return {};
+}
+
+ValueView ValueView::operator[](uint32_t index) const {
+    if (IsNull()) throw OutOfBoundsException(index, 0, GetPath());
+    if (!IsArray()) ThrowTypeMismatch(*this, BSON_TYPE_ARRAY);
+
+    bson_iter_t children;
+    uint32_t size = 0;
+    if (InitChildren(children)) {
+        for (; bson_iter_next(&children); ++size) {
+            if (size == index) return ValueView{children};
+        }
+    }
+    throw OutOfBoundsException(index, size, GetPath());
+}
+
+bool ValueView::HasMember(std::string_view name) const { return !(*this)[name].IsMissing(); }
+
+ValueView::const_iterator ValueView::begin() const {
+    if (IsNull()) return end();
+    CheckContainer();
+
+    bson_iter_t children;
+    if (!InitChildren(children)) return end();
+    return const_iterator{children};
+}
+
+ValueView::const_iterator ValueView::end() const { return {}; }
+
+bool ValueView::IsEmpty() const { return begin() == end(); }
+
+uint32_t ValueView::GetSize() const {
+    uint32_t size = 0;
+    for (auto it = begin(); it != end(); ++it) ++size;
+    return size;
+}
+
+std::string ValueView::GetPath() const { return std::string{GetName()}; }
+
+std::string_view ValueView::GetName() const {
+    if (kind_ != Kind::kElement) return {};
+    return {bson_iter_key(&element_), bson_iter_key_len(&element_)};
+}
+
+Value ValueView::ToValue() const {
+    CheckNotMissing();
+    if (kind_ == Kind::kRoot) {
+        return Document(impl::MutableBson(data_, size_).Extract());
+    }
+
+    impl::MutableBson wrapper;
+    bson_append_iter(wrapper.Get(), "", 0, &element_);
+    return Document(wrapper.Extract())[""];
+}
+
+void ValueView::CheckNotMissing() const {
+    if (IsMissing()) throw MemberMissingException(GetPath());
+}
+
+void ValueView::CheckArrayOrNull() const {
+    if (!IsArray() && !IsNull()) ThrowTypeMismatch(*this, BSON_TYPE_ARRAY);
+}
+
+void ValueView::CheckDocumentOrNull() const {
+    if (!IsDocument() && !IsNull()) ThrowTypeMismatch(*this, BSON_TYPE_DOCUMENT);
+}
+
+bson_type_t ValueView::GetType() const {
+    switch (kind_) {
+        case Kind::kMissing:
+            return BSON_TYPE_EOD;
+        case Kind::kRoot:
+            return BSON_TYPE_DOCUMENT;
+        case Kind::kElement:
+            return bson_iter_type(&element_);
+    }
+    UINVARIANT(false, "Unexpected value view kind");
+}
+
+const bson_iter_t& ValueView::GetNativeIter() const {
+    UASSERT(kind_ == Kind::kElement);
+    return element_;
+}
+
+bool ValueView::InitChildren(bson_iter_t& children) const {
+    if (kind_ == Kind::kRoot) return bson_iter_init_from_data(&children, data_, size_);
+    return bson_iter_recurse(&element_, &children);
+}
+
+void ValueView::CheckContainer() const {
+    if (!IsDocument() && !IsArray()) ThrowTypeMismatch(*this, BSON_TYPE_DOCUMENT);
+}
+
+ValueView::const_iterator::const_iterator(const bson_iter_t& children) : children_(children) { Advance(); }
+
+ValueView::const_iterator ValueView::const_iterator::operator++(int) {
+    auto result = *this;
+    ++*this;
+    return result;
+}
+
+ValueView::const_iterator& ValueView::const_iterator::operator++() {
+    UASSERT(!current_.IsMissing());
+    ++index_;
+    Advance();
+    return *this;
+}
+
+bool ValueView::const_iterator::operator==(const const_iterator& other) const {
+    if (current_.IsMissing() || other.current_.IsMissing()) {
+        return current_.IsMissing() == other.current_.IsMissing();
+    }
+    return bson_iter_offset(&children_) == bson_iter_offset(&other.children_) &&
+           bson_iter_key(&children_) == bson_iter_key(&other.children_);
+}
+
+void ValueView::const_iterator::Advance() {
+    current_ = bson_iter_next(&children_) ? ValueView{children_} : ValueView{};
+}
+
+bool Parse(const ValueView& value, parse::To<bool>) {
+    if (value.IsBool()) return bson_iter_bool(&value.GetNativeIter());
+    ThrowTypeMismatch(value, BSON_TYPE_BOOL);
+}
+
+int64_t Parse(const ValueView& value, parse::To<int64_t>) {
+    if (value.IsInt32()) return bson_iter_int32(&value.GetNativeIter());
+    if (value.IsInt64()) return bson_iter_int64(&value.GetNativeIter());
+    if (value.IsDouble()) {
+        const auto as_double = bson_iter_double(&value.GetNativeIter());
+        double int_part = 0.0;
+        const auto frac_part = std::modf(as_double, &int_part);
+        if (frac_part || std::abs(as_double) >= kMaxIntDouble) {
+            throw ConversionException(
+                utils::StrCat("Conversion ", std::to_string(as_double), " to integer causes precision change"),
+                value.GetPath()
+            );
+        }
+        return static_cast<int64_t>(as_double);
+    }
+    ThrowTypeMismatch(value, BSON_TYPE_INT64);
+}
+
+uint64_t Parse(const ValueView& value, parse::To<uint64_t>) {
+    const auto as_int = value.As<int64_t>();
+    if (as_int < 0) {
+        throw ConversionException(
+            utils::StrCat("Cannot convert to unsigned value from negative value ", std::to_string(as_int)),
+            value.GetPath()
+        );
+    }
+    return static_cast<uint64_t>(as_int);
+}
+
+double Parse(const ValueView& value, parse::To<double>) {
+    if (value.IsDouble()) return bson_iter_double(&value.GetNativeIter());
+    if (value.IsInt32()) return bson_iter_int32(&value.GetNativeIter());
+    if (value.IsInt64()) {
+        const auto as_int = bson_iter_int64(&value.GetNativeIter());
+        if (as_int == std::numeric_limits<int64_t>::min() || std::abs(as_int) > kMaxIntDouble) {
+            throw ConversionException(
+                utils::StrCat("Conversion of ", std::to_string(as_int), " to double causes precision loss"),
+                value.GetPath()
+            );
+        }
+        return static_cast<double>(as_int);
+    }
+    ThrowTypeMismatch(value, BSON_TYPE_DOUBLE);
+}
+
+std::string Parse(const ValueView& value, parse::To<std::string>) {
+    return std::string{value.As<std::string_view>()};
+}
+
+std::string_view Parse(const ValueView& value, parse::To<std::string_view>) {
+    if (value.IsString()) return GetString(value);
+    ThrowTypeMismatch(value, BSON_TYPE_UTF8);
+}
+
+std::chrono::system_clock::time_point Parse(const ValueView& value, parse::To<std::chrono::system_clock::time_point>) {
+    if (value.IsDateTime()) {
+        return std::chrono::system_clock::time_point{
+            std::chrono::milliseconds{bson_iter_date_time(&value.GetNativeIter())}};
+    }
+    ThrowTypeMismatch(value, BSON_TYPE_DATE_TIME);
+}
+
+Oid Parse(const ValueView& value, parse::To<Oid>) {
+    if (value.IsOid()) return *bson_iter_oid(&value.GetNativeIter());
+    ThrowTypeMismatch(value, BSON_TYPE_OID);
+}
+
+Binary Parse(const ValueView& value, parse::To<Binary>) {
+    if (value.IsBinary()) {
+        bson_subtype_t subtype{};
+        uint32_t length = 0;
+        const uint8_t* data = nullptr;
+        bson_iter_binary(&value.GetNativeIter(), &subtype, &length, &data);
+        return Binary(std::string(reinterpret_cast<const char*>(data), length));
+    }
+    ThrowTypeMismatch(value, BSON_TYPE_BINARY);
+}
+
+Decimal128 Parse(const ValueView& value, parse::To<Decimal128>) {
+    if (value.IsDecimal128()) {
+        bson_decimal128_t decimal{};
+        bson_iter_decimal128(&value.GetNativeIter(), &decimal);
+        return decimal;
+    }
+    ThrowTypeMismatch(value, BSON_TYPE_DECIMAL128);
+}
+
+Timestamp Parse(const ValueView& value, parse::To<Timestamp>) {
+    if (value.IsTimestamp()) {
+        uint32_t timestamp = 0;
+        uint32_t increment = 0;
+        bson_iter_timestamp(&value.GetNativeIter(), &timestamp, &increment);
+        return {timestamp, increment};
+    }
+    ThrowTypeMismatch(value, BSON_TYPE_TIMESTAMP);
+}
+
+Document Parse(const ValueView& value, parse::To<Document>) {
+    if (!value.IsDocument()) ThrowTypeMismatch(value, BSON_TYPE_DOCUMENT);
+    return value.ToValue();
+}
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/formats/bson.hpp>
+#include <userver/formats/bson/value_view.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fb = formats::bson;
+
+namespace {
+
+struct Item {
+    std::string name;
+    int count{0};
+    std::optional<double> price;
+    std::vector<std::string> tags;
+};
+
+template <typename Value>
+Item Parse(const Value& value, formats::parse::To<Item>) {
+    return {
+        value["name"].template As<std::string>(),
+        value["count"].template As<int>(),
+        value["price"].template As<std::optional<double>>(),
+        value["tags"].template As<std::vector<std::string>>(),
+    };
+}
+
+}  // namespace
+
+TEST(BsonValueView, Scalars) {
+    const auto now = std::chrono::system_clock::time_point{std::chrono::milliseconds{1'600'000'000'000}};
+    const fb::Oid oid;
+    const auto doc = fb::MakeDoc(
+        "bool", true, "int32", 1, "int64", int64_t{1} << 40, "double", 1.5, "string", "text", "date", now, "oid", oid
+    );
+    const fb::ValueView view{doc};
+
+    EXPECT_TRUE(view.IsDocument());
+    EXPECT_EQ(7, view.GetSize());
+    EXPECT_TRUE(view["bool"].As<bool>());
+    EXPECT_EQ(1, view["int32"].As<int>());
+    EXPECT_EQ(int64_t{1} << 40, view["int64"].As<int64_t>());
+    EXPECT_EQ(1.5, view["double"].As<double>());
+    EXPECT_EQ(1.0, view["int32"].As<double>());
+    EXPECT_EQ("text", view["string"].As<std::string>());
+    EXPECT_EQ("text", view["string"].As<std::string_view>());
+    EXPECT_EQ(now, view["date"].As<std::chrono::system_clock::time_point>());
+    EXPECT_EQ(oid, view["oid"].As<fb::Oid>());
+    EXPECT_EQ("string", view["string"].GetName());
+
+    UEXPECT_THROW(view["double"].As<int64_t>(), fb::ConversionException);
+    UEXPECT_THROW(view["string"].As<int>(), fb::TypeMismatchException);
+    UEXPECT_THROW(view["int32"]["field"], fb::TypeMismatchException);
+}
+
+TEST(BsonValueView, Missing) {
+    const auto doc = fb::MakeDoc("a", fb::MakeArray(), "b", fb::MakeDoc(), "n", nullptr);
+    const fb::ValueView view{doc};
+
+    EXPECT_TRUE(view["c"].IsMissing());
+    EXPECT_TRUE(view["b"]["c"].IsMissing());
+    EXPECT_TRUE(view["c"]["d"].IsMissing());
+    EXPECT_TRUE(view["n"]["d"].IsMissing());
+    EXPECT_FALSE(view.HasMember("c"));
+    EXPECT_TRUE(view.HasMember("n"));
+    EXPECT_EQ(42, view["c"].As<int>(42));
+    EXPECT_EQ(42, view["n"].As<int>(42));
+
+    UEXPECT_THROW(view["c"].As<int>(), fb::MemberMissingException);
+    UEXPECT_THROW(view["c"].As<std::string>(), fb::MemberMissingException);
+    UEXPECT_THROW(view["a"][0], fb::OutOfBoundsException);
+    UEXPECT_THROW(view["b"][0], fb::TypeMismatchException);
+}
+
+TEST(BsonValueView, Containers) {
+    const auto doc = fb::MakeDoc(
+        "array", fb::MakeArray(1, 2, 3), "object", fb::MakeDoc("a", 1, "b", 2), "nested", fb::MakeArray(fb::MakeArray())
+    );
+    const fb::ValueView view{doc};
+
+    EXPECT_TRUE(view["array"].IsArray());
+    EXPECT_EQ(3, view["array"].GetSize());
+    EXPECT_EQ(2, view["array"][1].As<int>());
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), view["array"].As<std::vector<int>>());
+    EXPECT_EQ((std::map<std::string, int>{{"a", 1}, {"b", 2}}), (view["object"].As<std::map<std::string, int>>()));
+    EXPECT_TRUE(view["nested"][0].IsEmpty());
+
+    std::vector<std::string> names;
+    for (auto it = view.begin(); it != view.end(); ++it) names.push_back(it.GetName());
+    EXPECT_EQ((std::vector<std::string>{"array", "object", "nested"}), names);
+
+    uint32_t index = 0;
+    for (auto it = view["array"].begin(); it != view["array"].end(); ++it, ++index) {
+        EXPECT_EQ(index, it.GetIndex());
+        EXPECT_EQ(static_cast<int>(index) + 1, it->As<int>());
+    }
+}
+
+TEST(BsonValueView, SameAsValue) {
+    const auto doc = fb::FromJsonString(R"({
+        "name": "item",
+        "count": 5,
+        "tags": ["a", "b"]
+    })");
+
+    const auto from_view = fb::ValueView{doc}.As<Item>();
+    const auto from_value = doc.As<Item>();
+    EXPECT_EQ(from_value.name, from_view.name);
+    EXPECT_EQ(from_value.count, from_view.count);
+    EXPECT_EQ(from_value.price, from_view.price);
+    EXPECT_EQ(from_value.tags, from_view.tags);
+}
+
+TEST(BsonValueView, ToValue) {
+    const auto doc = fb::MakeDoc("sub", fb::MakeDoc("a", 1), "array", fb::MakeArray(1, 2));
+    const fb::ValueView view{doc};
+
+    EXPECT_EQ(doc, view.ToValue());
+    EXPECT_EQ(doc["sub"], view["sub"].ToValue());
+    EXPECT_EQ(doc["array"], view["array"].ToValue());
+    EXPECT_EQ(fb::MakeDoc("a", 1), view["sub"].As<fb::Document>());
+}
+
+USERVER_NAMESPACE_END
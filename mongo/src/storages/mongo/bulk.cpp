@@ -3,6 +3,7 @@
 #include <mongoc/mongoc.h>
 
 #include <userver/storages/mongo/mongo_error.hpp>
+#include <userver/utils/assert.hpp>
 
 #include <storages/mongo/bulk_ops_impl.hpp>
 #include <storages/mongo/operations_common.hpp>
@@ -13,12 +14,41 @@ USERVER_NAMESPACE_BEGIN
 namespace storages::mongo::operations {
 namespace {
 
-auto EnsureBulk(impl::cdriver::BulkOperationPtr& bulk_ptr, Bulk::Mode mode) {
-    if (!bulk_ptr) {
-        const bool is_ordered = (mode == Bulk::Mode::kOrdered);
-        bulk_ptr.reset(mongoc_bulk_operation_new(is_ordered));
+template <typename BulkImpl>
+mongoc_bulk_operation_t* EnsureBulk(BulkImpl& impl) {
+    if (!impl.bulk) {
+        const bool is_ordered = (impl.mode == Bulk::Mode::kOrdered);
+        impl.bulk.reset(mongoc_bulk_operation_new(is_ordered));
+        if (impl.write_concern) mongoc_bulk_operation_set_write_concern(impl.bulk.get(), impl.write_concern.get());
     }
-    return bulk_ptr.get();
+    return impl.bulk.get();
+}
+
+template <typename BulkImpl>
+void SetWriteConcern(BulkImpl& impl, impl::cdriver::WriteConcernPtr write_concern) {
+    impl.write_concern = std::move(write_concern);
+    mongoc_bulk_operation_set_write_concern(EnsureBulk(impl), impl.write_concern.get());
+    if (!impl.chunks) return;
+    for (const auto& chunk : impl.chunks->filled) {
+        mongoc_bulk_operation_set_write_concern(chunk.bulk.get(), impl.write_concern.get());
+    }
+}
+
+// Starts a new chunk if the operation does not fit into the current one
+template <typename BulkImpl>
+mongoc_bulk_operation_t* EnsureBulkFor(BulkImpl& impl, size_t op_bytes) {
+    ++impl.ops_count;
+    auto& chunks = impl.chunks;
+    if (chunks) {
+        if (chunks->current_ops && chunks->current_bytes + op_bytes > chunks->options.MaxChunkBytes()) {
+            chunks->filled.push_back({std::move(impl.bulk), chunks->current_ops});
+            chunks->current_bytes = 0;
+            chunks->current_ops = 0;
+        }
+        chunks->current_bytes += op_bytes;
+        ++chunks->current_ops;
+    }
+    return EnsureBulk(impl);
 }
 
 }  // namespace
@@ -32,24 +62,27 @@ Bulk& Bulk::operator=(Bulk&&) noexcept = default;
 bool Bulk::IsEmpty() const { return !impl_->bulk; }
 
 void Bulk::SetOption(options::WriteConcern::Level level) {
-    mongoc_bulk_operation_set_write_concern(
-        EnsureBulk(impl_->bulk, impl_->mode), impl::MakeCDriverWriteConcern(level).get()
-    );
+    SetWriteConcern(*impl_, impl::MakeCDriverWriteConcern(level));
 }
 
 void Bulk::SetOption(const options::WriteConcern& write_concern) {
-    mongoc_bulk_operation_set_write_concern(
-        EnsureBulk(impl_->bulk, impl_->mode), impl::MakeCDriverWriteConcern(write_concern).get()
-    );
+    SetWriteConcern(*impl_, impl::MakeCDriverWriteConcern(write_concern));
 }
 
 void Bulk::SetOption(options::SuppressServerExceptions) { impl_->should_throw = false; }
 
+void Bulk::SetOption(const options::ParallelBulk& parallel) {
+    if (impl_->mode == Mode::kOrdered) return;
+    UINVARIANT(!impl_->ops_count, "ParallelBulk must be set before appending operations");
+    impl_->chunks = std::make_unique<BulkChunks>(parallel);
+}
+
 void Bulk::Append(const bulk_ops::InsertOne& insert_subop) {
     MongoError error;
     const bson_t* native_bson_ptr = insert_subop.impl_->document.GetBson().get();
+    const size_t op_bytes = native_bson_ptr->len;
     if (!mongoc_bulk_operation_insert_with_opts(
-            EnsureBulk(impl_->bulk, impl_->mode), native_bson_ptr, nullptr, error.GetNative()
+            EnsureBulkFor(*impl_, op_bytes), native_bson_ptr, nullptr, error.GetNative()
         )) {
         error.Throw("Error appending insert to bulk");
     }
@@ -59,8 +92,9 @@ void Bulk::Append(const bulk_ops::ReplaceOne& replace_subop) {
     MongoError error;
     const bson_t* native_selector_bson_ptr = replace_subop.impl_->selector.GetBson().get();
     const bson_t* native_replacement_bson_ptr = replace_subop.impl_->replacement.GetBson().get();
+    const size_t op_bytes = native_selector_bson_ptr->len + native_replacement_bson_ptr->len;
     if (!mongoc_bulk_operation_replace_one_with_opts(
-            EnsureBulk(impl_->bulk, impl_->mode),
+            EnsureBulkFor(*impl_, op_bytes),
             native_selector_bson_ptr,
             native_replacement_bson_ptr,
             impl::GetNative(replace_subop.impl_->options),
@@ -74,11 +108,12 @@ void Bulk::Append(const bulk_ops::Update& update_subop) {
     MongoError error;
     const bson_t* native_selector_bson_ptr = update_subop.impl_->selector.GetBson().get();
     const bson_t* native_update_bson_ptr = update_subop.impl_->update.GetBson().get();
+    const size_t op_bytes = native_selector_bson_ptr->len + native_update_bson_ptr->len;
     bool has_succeeded = false;
     switch (update_subop.impl_->mode) {
         case bulk_ops::Update::Mode::kSingle:
             has_succeeded = mongoc_bulk_operation_update_one_with_opts(
-                EnsureBulk(impl_->bulk, impl_->mode),
+                EnsureBulkFor(*impl_, op_bytes),
                 native_selector_bson_ptr,
                 native_update_bson_ptr,
                 impl::GetNative(update_subop.impl_->options),
@@ -88,7 +123,7 @@ void Bulk::Append(const bulk_ops::Update& update_subop) {
 
         case bulk_ops::Update::Mode::kMulti:
             has_succeeded = mongoc_bulk_operation_update_many_with_opts(
-                EnsureBulk(impl_->bulk, impl_->mode),
+                EnsureBulkFor(*impl_, op_bytes),
                 native_selector_bson_ptr,
                 native_update_bson_ptr,
                 impl::GetNative(update_subop.impl_->options),
@@ -102,17 +137,18 @@ void Bulk::Append(const bulk_ops::Update& update_subop) {
 void Bulk::Append(const bulk_ops::Delete& delete_subop) {
     MongoError error;
     const bson_t* native_selector_bson_ptr = delete_subop.impl_->selector.GetBson().get();
+    const size_t op_bytes = native_selector_bson_ptr->len;
     bool has_succeeded = false;
     switch (delete_subop.impl_->mode) {
         case bulk_ops::Delete::Mode::kSingle:
             has_succeeded = mongoc_bulk_operation_remove_one_with_opts(
-                EnsureBulk(impl_->bulk, impl_->mode), native_selector_bson_ptr, nullptr, error.GetNative()
+                EnsureBulkFor(*impl_, op_bytes), native_selector_bson_ptr, nullptr, error.GetNative()
             );
             break;
 
         case bulk_ops::Delete::Mode::kMulti:
             has_succeeded = mongoc_bulk_operation_remove_many_with_opts(
-                EnsureBulk(impl_->bulk, impl_->mode), native_selector_bson_ptr, nullptr, error.GetNative()
+                EnsureBulkFor(*impl_, op_bytes), native_selector_bson_ptr, nullptr, error.GetNative()
             );
             break;
     }
@@ -265,4 +265,50 @@ UTEST_F(Bulk, Mixed) {
     EXPECT_TRUE(upserted_ids[5].IsOid());
 }
 
+UTEST_F(Bulk, Parallel) {
+    auto coll = GetDefaultPool().GetCollection("parallel");
+
+    // Every operation gets a chunk of its own
+    const mongo::options::ParallelBulk parallel{1, 2};
+    {
+        auto bulk = coll.MakeUnorderedBulk(parallel, mongo::options::SuppressServerExceptions{});
+        bulk.InsertOne(bson::MakeDoc("_id", 1));
+        bulk.InsertOne(bson::MakeDoc("_id", 2));
+        bulk.InsertOne(bson::MakeDoc("_id", 1));
+        bulk.InsertOne(bson::MakeDoc("_id", 3));
+        bulk.InsertOne(bson::MakeDoc("_id", 1));
+        bulk.UpdateOne(bson::MakeDoc("x", 1), bson::MakeDoc("$set", bson::MakeDoc("y", 1)), mongo::options::Upsert{});
+        auto result = coll.Execute(std::move(bulk));
+
+        EXPECT_EQ(3, result.InsertedCount());
+        EXPECT_EQ(0, result.MatchedCount());
+        EXPECT_EQ(1, result.UpsertedCount());
+        EXPECT_TRUE(result.WriteConcernErrors().empty());
+
+        auto errors = result.ServerErrors();
+        ASSERT_EQ(2, errors.size());
+        EXPECT_EQ(11000, errors[2].Code());
+        EXPECT_EQ(11000, errors[4].Code());
+
+        auto upserted_ids = result.UpsertedIds();
+        ASSERT_EQ(1, upserted_ids.size());
+        EXPECT_TRUE(upserted_ids[5].IsOid());
+    }
+    {
+        auto bulk = coll.MakeUnorderedBulk(parallel);
+        bulk.InsertOne(bson::MakeDoc("_id", 4));
+        bulk.InsertOne(bson::MakeDoc("_id", 1));
+        bulk.InsertOne(bson::MakeDoc("_id", 5));
+        UEXPECT_THROW(coll.Execute(std::move(bulk)), mongo::DuplicateKeyException);
+        EXPECT_EQ(6, coll.Count({}));
+    }
+    {
+        // Ordered bulks are never split
+        auto bulk = coll.MakeOrderedBulk(parallel);
+        bulk.InsertOne(bson::MakeDoc("_id", 6));
+        bulk.InsertOne(bson::MakeDoc("_id", 7));
+        EXPECT_EQ(2, coll.Execute(std::move(bulk)).InsertedCount());
+    }
+}
+
 USERVER_NAMESPACE_END
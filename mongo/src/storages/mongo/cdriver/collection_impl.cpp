@@ -1,16 +1,26 @@
 #include <storages/mongo/cdriver/collection_impl.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <string_view>
+#include <vector>
+
 #include <bson/bson.h>
 #include <mongoc/mongoc.h>
 
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_all_checked.hpp>
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/inline.hpp>
+#include <userver/formats/bson/value_builder.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/storages/mongo/mongo_error.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/impl/userver_experiments.hpp>
 #include <userver/utils/text.hpp>
 
@@ -34,12 +44,68 @@ class WriteResultHelper {
 public:
     bson_t* GetNative() { return bson_.Get(); }
 
-    WriteResult Extract() { return WriteResult(formats::bson::Document(bson_.Extract())); }
+    WriteResult Extract() { return WriteResult(ExtractDocument()); }
+
+    formats::bson::Document ExtractDocument() { return formats::bson::Document(bson_.Extract()); }
 
 private:
     formats::bson::impl::UninitializedBson bson_;
 };
 
+constexpr std::array<std::string_view, 5> kBulkCounters = {
+    "nInserted",
+    "nMatched",
+    "nModified",
+    "nRemoved",
+    "nUpserted",
+};
+
+// Combines replies of bulk chunks into a reply of the whole bulk
+class BulkReplyMerger {
+public:
+    // index_offset is the index of the first chunk operation in the whole bulk
+    void Append(const formats::bson::Document& reply, size_t index_offset) {
+        for (size_t i = 0; i < kBulkCounters.size(); ++i) {
+            counters_[i] += reply[std::string{kBulkCounters[i]}].As<int64_t>(0);
+        }
+        AppendIndexed(upserted_, reply["upserted"], index_offset);
+        AppendIndexed(write_errors_, reply["writeErrors"], index_offset);
+        const auto write_concern_errors = reply["writeConcernErrors"];
+        if (write_concern_errors.IsMissing()) return;
+        for (const auto& error : write_concern_errors) write_concern_errors_.PushBack(error);
+    }
+
+    WriteResult Extract() {
+        formats::bson::ValueBuilder builder;
+        for (size_t i = 0; i < kBulkCounters.size(); ++i) {
+            builder[std::string{kBulkCounters[i]}] = counters_[i];
+        }
+        builder["upserted"] = std::move(upserted_);
+        builder["writeErrors"] = std::move(write_errors_);
+        builder["writeConcernErrors"] = std::move(write_concern_errors_);
+        return WriteResult(builder.ExtractValue());
+    }
+
+private:
+    static void AppendIndexed(
+        formats::bson::ValueBuilder& target,
+        const formats::bson::Value& items,
+        size_t index_offset
+    ) {
+        if (items.IsMissing()) return;
+        for (const auto& item : items) {
+            formats::bson::ValueBuilder shifted{item};
+            shifted["index"] = static_cast<int64_t>(item["index"].As<size_t>() + index_offset);
+            target.PushBack(std::move(shifted));
+        }
+    }
+
+    std::array<int64_t, kBulkCounters.size()> counters_{};
+    formats::bson::ValueBuilder upserted_{formats::common::Type::kArray};
+    formats::bson::ValueBuilder write_errors_{formats::common::Type::kArray};
+    formats::bson::ValueBuilder write_concern_errors_{formats::common::Type::kArray};
+};
+
 std::optional<std::string> GetCurrentSpanLink() {
     auto* span = tracing::Span::CurrentSpanUnchecked();
     if (span) return span->GetLink();
@@ -264,7 +330,7 @@ Cursor CDriverCollectionImpl::Execute(const operations::Find& operation) const {
         context.collection.get(), native_filter_bson_ptr, impl::GetNative(options), operation.impl_->read_prefs.Get()
     ));
     return Cursor(std::make_unique<impl::cdriver::CDriverCursorImpl>(
-        std::move(context.client), std::move(cdriver_cursor), std::move(context.stats)
+        std::move(context.client), std::move(cdriver_cursor), std::move(context.stats), operation.impl_->prefetch
     ));
 }
 
@@ -503,21 +569,13 @@ WriteResult CDriverCollectionImpl::Execute(const operations::FindAndRemove& oper
 WriteResult CDriverCollectionImpl::Execute(operations::Bulk&& operation) {
     if (operation.IsEmpty()) return {};
 
-    auto context = MakeRequestContext("mongo_bulk", operation);
-
     UASSERT(operation.impl_->bulk);
-    mongoc_bulk_operation_set_database(operation.impl_->bulk.get(), GetDatabaseName().c_str());
-    mongoc_bulk_operation_set_collection(operation.impl_->bulk.get(), GetCollectionName().c_str());
-
-    mongoc_bulk_operation_set_client(operation.impl_->bulk.get(), context.client.get());
+    const auto& chunks = operation.impl_->chunks;
+    if (chunks && !chunks->filled.empty()) return ExecuteChunkedBulk(std::move(operation));
 
     MongoError error;
     WriteResultHelper write_result;
-    stats::OperationStopwatch stopwatch(std::move(context.stats));
-    if (mongoc_bulk_operation_execute(operation.impl_->bulk.get(), write_result.GetNative(), error.GetNative())) {
-        stopwatch.AccountSuccess();
-    } else {
-        stopwatch.AccountError(error.GetKind());
+    if (!ExecuteBulk(operation.impl_->bulk.get(), operation.impl_->op_key, write_result.GetNative(), error)) {
         if (operation.impl_->should_throw || !error.IsServerError()) {
             error.Throw("Error running bulk operation");
         }
@@ -614,6 +672,76 @@ RequestContext CDriverCollectionImpl::MakeRequestContext(std::string&& span_name
     };
 }
 
+bool CDriverCollectionImpl::ExecuteBulk(
+    mongoc_bulk_operation_t* bulk,
+    const stats::OperationKey& stats_key,
+    bson_t* reply,
+    MongoError& error
+) const {
+    auto context = MakeRequestContext("mongo_bulk", stats_key);
+
+    mongoc_bulk_operation_set_database(bulk, GetDatabaseName().c_str());
+    mongoc_bulk_operation_set_collection(bulk, GetCollectionName().c_str());
+
+    mongoc_bulk_operation_set_client(bulk, context.client.get());
+
+    stats::OperationStopwatch stopwatch(std::move(context.stats));
+    if (mongoc_bulk_operation_execute(bulk, reply, error.GetNative())) {
+        stopwatch.AccountSuccess();
+        return true;
+    }
+    stopwatch.AccountError(error.GetKind());
+    return false;
+}
+
+WriteResult CDriverCollectionImpl::ExecuteChunkedBulk(operations::Bulk&& operation) const {
+    auto& impl = *operation.impl_;
+    auto& chunks = *impl.chunks;
+    chunks.filled.push_back({std::move(impl.bulk), chunks.current_ops});
+
+    struct ChunkResult {
+        WriteResultHelper reply;
+        MongoError error;
+        bool has_succeeded{false};
+    };
+    std::vector<ChunkResult> results(chunks.filled.size());
+
+    // Every task picks the next chunk until none are left
+    std::atomic<size_t> next_chunk{0};
+    const auto execute_chunks = [&] {
+        for (auto i = next_chunk++; i < results.size(); i = next_chunk++) {
+            auto& result = results[i];
+            result.has_succeeded =
+                ExecuteBulk(chunks.filled[i].bulk.get(), impl.op_key, result.reply.GetNative(), result.error);
+        }
+    };
+
+    const auto concurrency = std::clamp<size_t>(chunks.options.MaxConcurrency(), 1, results.size());
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(concurrency - 1);
+    for (size_t i = 1; i < concurrency; ++i) {
+        tasks.push_back(utils::Async("mongo_bulk_chunk", execute_chunks));
+    }
+    execute_chunks();
+    engine::WaitAllChecked(tasks);
+
+    BulkReplyMerger merger;
+    const MongoError* server_error = nullptr;
+    size_t index_offset = 0;
+    for (size_t i = 0; i < results.size(); ++i) {
+        auto& result = results[i];
+        if (!result.has_succeeded) {
+            if (!result.error.IsServerError()) result.error.Throw("Error running bulk operation");
+            if (!server_error) server_error = &result.error;
+        }
+        merger.Append(result.reply.ExtractDocument(), index_offset);
+        index_offset += chunks.filled[i].ops_count;
+    }
+
+    if (server_error && impl.should_throw) server_error->Throw("Error running bulk operation");
+    return merger.Extract();
+}
+
 template <typename Operation>
 RequestContext CDriverCollectionImpl::MakeRequestContext(std::string&& span_name, const Operation& operation) const {
     return MakeRequestContext(std::move(span_name), operation.impl_->op_key);
@@ -8,6 +8,7 @@
 #include <storages/mongo/collection_impl.hpp>
 #include <storages/mongo/stats.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
+#include <userver/storages/mongo/mongo_error.hpp>
 #include <userver/tracing/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -46,6 +47,16 @@ private:
 
     RequestContext MakeRequestContext(std::string&& span_name, const stats::OperationKey& stats_key) const;
 
+    // Returns whether the bulk succeeded, the reply is filled in either case
+    bool ExecuteBulk(
+        mongoc_bulk_operation_t* bulk,
+        const stats::OperationKey& stats_key,
+        bson_t* reply,
+        MongoError& error
+    ) const;
+
+    WriteResult ExecuteChunkedBulk(operations::Bulk&&) const;
+
     template <typename Operation>
     RequestContext MakeRequestContext(std::string&& span_name, const Operation& operation) const;
 
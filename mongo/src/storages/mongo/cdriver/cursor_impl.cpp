@@ -1,25 +1,38 @@
 #include <storages/mongo/cdriver/cursor_impl.hpp>
 
+#include <algorithm>
 #include <stdexcept>
+#include <utility>
 
 #include <bson/bson.h>
 #include <mongoc/mongoc.h>
 
 #include <userver/storages/mongo/mongo_error.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 
 #include <formats/bson/wrappers.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::mongo::impl::cdriver {
+namespace {
+
+constexpr size_t kMinTunedBatchSize = 16;
+constexpr size_t kMaxTunedBatchSize = 100'000;
+
+}  // namespace
 
 CDriverCursorImpl::CDriverCursorImpl(
     cdriver::CDriverPoolImpl::BoundClientPtr client,
     cdriver::CursorPtr cursor,
-    std::shared_ptr<stats::OperationStatisticsItem> find_stats
+    std::shared_ptr<stats::OperationStatisticsItem> find_stats,
+    std::optional<options::CursorPrefetch> prefetch
 )
-    : client_(std::move(client)), cursor_(std::move(cursor)), find_stats_(std::move(find_stats)) {
+    : client_(std::move(client)),
+      cursor_(std::move(cursor)),
+      find_stats_(std::move(find_stats)),
+      prefetch_(std::move(prefetch)) {
     if (cursor_) {
         // Precondition: we've got a valid cursor (it could be errored-out right
         // away due to stream selection error, for example).
@@ -44,6 +57,10 @@ const formats::bson::Document& CDriverCursorImpl::Current() const {
 
 void CDriverCursorImpl::Next() {
     if (!IsValid()) throw std::logic_error("Advancing cursor past the end");
+    if (prefetch_) {
+        NextPrefetched();
+        return;
+    }
 
     current_ = std::nullopt;
     if (!HasMore()) {
@@ -79,6 +96,71 @@ void CDriverCursorImpl::Next() {
     }
 }
 
+void CDriverCursorImpl::NextPrefetched() {
+    current_ = std::nullopt;
+    while (fetched_.empty()) {
+        if (fetch_error_) {
+            const auto error = *std::exchange(fetch_error_, std::nullopt);
+            cursor_.reset();
+            client_.reset();
+            error.Throw("Error iterating over query results");
+        }
+        if (!cursor_) return;
+
+        auto batch = prefetch_task_.IsValid() ? prefetch_task_.Get() : FetchBatch();
+        fetched_ = std::move(batch.documents);
+        fetch_error_ = std::move(batch.error);
+        if (batch.is_exhausted && !fetch_error_) {
+            cursor_.reset();
+            client_.reset();
+        }
+    }
+
+    current_ = std::move(fetched_.front());
+    fetched_.pop_front();
+    StartPrefetch();
+}
+
+CDriverCursorImpl::Batch CDriverCursorImpl::FetchBatch() {
+    UASSERT(client_ && cursor_);
+    const auto before_stats = client_.GetEventStatsSnapshot();
+    stats::OperationStopwatch cursor_next_sw(find_stats_, "find");
+
+    Batch batch;
+    const auto target_bytes = prefetch_->TargetBatchBytes();
+    size_t batch_bytes = 0;
+    const bson_t* current_bson = nullptr;
+    MongoError error;
+    while (batch_bytes < target_bytes && !mongoc_cursor_error(cursor_.get(), error.GetNative()) && HasMore()) {
+        if (mongoc_cursor_next(cursor_.get(), &current_bson)) {
+            batch_bytes += current_bson->len;
+            batch.documents.emplace_back(formats::bson::impl::MutableBson::CopyNative(current_bson).Extract());
+        }
+    }
+    if (before_stats == client_.GetEventStatsSnapshot()) {
+        cursor_next_sw.Discard();
+    } else if (!error) {
+        cursor_next_sw.AccountSuccess();
+    } else {
+        cursor_next_sw.AccountError(error.GetKind());
+    }
+
+    if (error) batch.error = error;
+    batch.is_exhausted = !HasMore();
+    if (!batch.is_exhausted && !batch.documents.empty()) {
+        // Next getMore should bring about target_bytes of documents
+        const auto average_bytes = std::max<size_t>(batch_bytes / batch.documents.size(), 1);
+        const auto batch_size = std::clamp(target_bytes / average_bytes, kMinTunedBatchSize, kMaxTunedBatchSize);
+        mongoc_cursor_set_batch_size(cursor_.get(), static_cast<uint32_t>(batch_size));
+    }
+    return batch;
+}
+
+void CDriverCursorImpl::StartPrefetch() {
+    if (!cursor_ || fetch_error_ || prefetch_task_.IsValid()) return;
+    prefetch_task_ = utils::Async("mongo_cursor_prefetch", [this] { return FetchBatch(); });
+}
+
 }  // namespace storages::mongo::impl::cdriver
 
 USERVER_NAMESPACE_END
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <optional>
 
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/formats/bson/document.hpp>
+#include <userver/storages/mongo/mongo_error.hpp>
+#include <userver/storages/mongo/options.hpp>
 
 #include <storages/mongo/cdriver/pool_impl.hpp>
 #include <storages/mongo/cdriver/wrappers.hpp>
@@ -20,7 +24,8 @@ public:
     CDriverCursorImpl(
         cdriver::CDriverPoolImpl::BoundClientPtr,
         cdriver::CursorPtr,
-        std::shared_ptr<stats::OperationStatisticsItem> find_stats
+        std::shared_ptr<stats::OperationStatisticsItem> find_stats,
+        std::optional<options::CursorPrefetch> prefetch = std::nullopt
     );
 
     bool IsValid() const override;
@@ -30,10 +35,27 @@ public:
     void Next() override;
 
 private:
+    // Documents read from the cursor at once
+    struct Batch {
+        std::deque<formats::bson::Document> documents;
+        std::optional<MongoError> error;
+        bool is_exhausted{false};
+    };
+
+    void NextPrefetched();
+    Batch FetchBatch();
+    void StartPrefetch();
+
     std::optional<formats::bson::Document> current_;
     cdriver::CDriverPoolImpl::BoundClientPtr client_;
     cdriver::CursorPtr cursor_;
     const std::shared_ptr<stats::OperationStatisticsItem> find_stats_;
+
+    const std::optional<options::CursorPrefetch> prefetch_;
+    std::deque<formats::bson::Document> fetched_;
+    std::optional<MongoError> fetch_error_;
+    // Owns the cursor while running, should be the last member
+    engine::TaskWithResult<Batch> prefetch_task_;
 };
 
 }  // namespace storages::mongo::impl::cdriver
@@ -160,14 +160,21 @@ stats::ConnStats& GetStats(void* stats_ptr) {
     return *reinterpret_cast<stats::ConnStats*>(stats_ptr);
 }
 
+void AccountCommandDuration(stats::ConnStats& stats, int64_t duration_us) {
+    const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::microseconds{duration_us});
+    stats.apm_stats_->command_timings_agg.GetCurrentCounter().Account(duration.count());
+}
+
 void CommandSucceeded(const mongoc_apm_command_succeeded_t* event) {
     auto& stats = GetStats(mongoc_apm_command_succeeded_get_context(event));
     stats.event_stats_.success += utils::statistics::Rate{1};
+    AccountCommandDuration(stats, mongoc_apm_command_succeeded_get_duration(event));
 }
 
 void CommandFailed(const mongoc_apm_command_failed_t* event) {
     auto& stats = GetStats(mongoc_apm_command_failed_get_context(event));
     stats.event_stats_.failed += utils::statistics::Rate{1};
+    AccountCommandDuration(stats, mongoc_apm_command_failed_get_duration(event));
 }
 
 void HeartbeatStarted(const mongoc_apm_server_heartbeat_started_t* event) {
@@ -304,6 +311,7 @@ CDriverPoolImpl::CDriverPoolImpl(
       init_data_{dns_resolver, {}, {}},
       max_size_(config.pool_settings.max_size),
       idle_limit_(config.pool_settings.idle_limit),
+      min_idle_(config.pool_settings.min_idle),
       queue_timeout_(config.queue_timeout),
       size_(0),
       in_use_semaphore_(config.pool_settings.max_size),
@@ -383,6 +391,7 @@ const std::string& CDriverPoolImpl::DefaultDatabaseName() const { return default
 void CDriverPoolImpl::SetPoolSettings(const PoolSettings& pool_settings) {
     SetMaxSize(pool_settings.max_size);
     idle_limit_ = pool_settings.idle_limit;
+    min_idle_ = pool_settings.min_idle;
     in_use_semaphore_.SetCapacity(pool_settings.max_size);
     connecting_semaphore_.SetCapacity(pool_settings.connecting_limit);
 }
@@ -574,9 +583,33 @@ void CDriverPoolImpl::DoMaintenance() {
         LOG_TRACE() << "Trying to drop idle connection";
         Drop(TryGetIdle());
     }
+    WarmUp();
     LOG_DEBUG() << "Finished mongo pool '" << Id() << "' maintenance";
 }
 
+void CDriverPoolImpl::WarmUp() {
+    // Connections are established in the background to keep them off the
+    // request path, requests take priority over the warmup for the limits
+    std::size_t created = 0;
+    try {
+        while (queue_.size_approx() < min_idle_.load() && SizeApprox() < MaxSize()) {
+            engine::SemaphoreLock in_use_lock(in_use_semaphore_, std::try_to_lock);
+            if (!in_use_lock) break;
+            const engine::SemaphoreLock connecting_lock(connecting_semaphore_, std::try_to_lock);
+            if (!connecting_lock) break;
+
+            Push(Create());
+            in_use_lock.Release();
+            ++created;
+        }
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to warm up mongo pool '" << Id() << "': " << ex;
+    }
+    if (created) {
+        LOG_DEBUG() << "Created " << created << " idle connections in mongo pool '" << Id() << '\'';
+    }
+}
+
 }  // namespace storages::mongo::impl::cdriver
 
 USERVER_NAMESPACE_END
@@ -131,6 +131,7 @@ private:
     ConnPtr Create();
 
     void DoMaintenance();
+    void WarmUp();
 
     const std::string app_name_;
     std::string default_database_;
@@ -143,6 +144,7 @@ private:
 
     std::atomic<size_t> max_size_;
     std::atomic<size_t> idle_limit_;
+    std::atomic<size_t> min_idle_;
     const std::chrono::milliseconds queue_timeout_;
     std::atomic<size_t> size_;
     engine::Semaphore in_use_semaphore_;
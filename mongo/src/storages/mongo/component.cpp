@@ -165,6 +165,10 @@ properties:
         type: integer
         description: limit for establishing connections number (per database)
         defaultDescription: 8
+    min_idle:
+        type: integer
+        description: number of idle connections kept ready by the pool maintenance (per database)
+        defaultDescription: 0
     local_threshold:
         type: string
         description: latency window for instance selection
@@ -268,6 +268,8 @@ void Find::SetOption(const options::MaxServerTime& max_server_time) {
     AppendMaxServerTime(impl_->max_server_time, max_server_time);
 }
 
+void Find::SetOption(const options::CursorPrefetch& prefetch) { impl_->prefetch = prefetch; }
+
 InsertOne::InsertOne(formats::bson::Document document) : impl_(std::move(document)) {}
 
 InsertOne::~InsertOne() = default;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -54,6 +55,7 @@ public:
     std::optional<formats::bson::impl::BsonBuilder> options;
     bool has_comment_option{false};
     std::chrono::milliseconds max_server_time{kNoMaxServerTime};
+    std::optional<options::CursorPrefetch> prefetch;
 };
 
 class InsertOne::Impl {
@@ -136,11 +138,31 @@ public:
     std::chrono::milliseconds max_server_time{kNoMaxServerTime};
 };
 
+// State of an unordered bulk that is split by options::ParallelBulk
+struct BulkChunks {
+    struct Chunk {
+        impl::cdriver::BulkOperationPtr bulk;
+        size_t ops_count{0};
+    };
+
+    explicit BulkChunks(const options::ParallelBulk& options_) : options(options_) {}
+
+    options::ParallelBulk options;
+    // Filled chunks, the current one is kept in Bulk::Impl::bulk
+    std::vector<Chunk> filled;
+    size_t current_bytes{0};
+    size_t current_ops{0};
+};
+
 class Bulk::Impl {
 public:
     explicit Impl(Mode mode_) : mode(mode_) {}
 
     impl::cdriver::BulkOperationPtr bulk;
+    // Applied to every chunk of the bulk
+    impl::cdriver::WriteConcernPtr write_concern;
+    std::unique_ptr<BulkChunks> chunks;
+    size_t ops_count{0};
     stats::OperationKey op_key{stats::OpType::kBulk};
     Mode mode;
     bool should_throw{true};
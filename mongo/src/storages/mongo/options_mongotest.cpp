@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <chrono>
 #include <string>
+#include <vector>
 
 #include <storages/mongo/dynamic_config.hpp>
 #include <storages/mongo/util_mongotest.hpp>
@@ -623,6 +624,30 @@ UTEST_F(Options, Comment) {
     UEXPECT_NO_THROW(coll.FindOne({}, mongo::options::Comment{"snarky comment"}));
 }
 
+UTEST_F(Options, CursorPrefetch) {
+    auto coll = GetDefaultPool().GetCollection("cursor_prefetch");
+
+    constexpr int kDocsCount = 1000;
+    std::vector<formats::bson::Document> docs;
+    for (int i = 0; i < kDocsCount; ++i) docs.push_back(bson::MakeDoc("_id", i, "s", std::string(100, 'x')));
+    coll.InsertMany(std::move(docs));
+
+    // Small batches to go through many prefetches
+    const mongo::options::CursorPrefetch prefetch{1024};
+    int expected_id = 0;
+    for (const auto& doc : coll.Find({}, prefetch, mongo::options::Sort{{"_id", mongo::options::Sort::kAscending}})) {
+        EXPECT_EQ(expected_id++, doc["_id"].As<int>());
+    }
+    EXPECT_EQ(kDocsCount, expected_id);
+
+    // Cursor is dropped while the next batch is being fetched
+    auto cursor = coll.Find({}, prefetch);
+    ASSERT_TRUE(cursor.HasMore());
+    EXPECT_TRUE(cursor.begin()->HasMember("_id"));
+
+    EXPECT_TRUE(coll.FindOne({}, prefetch));
+}
+
 UTEST_F(Options, MaxServerTime) {
     auto coll = GetDefaultPool().GetCollection("max_server_time");
 
@@ -75,6 +75,7 @@ void DumpMetric(utils::statistics::Writer& writer, const Pool& pool) {
         apm_metrics["heartbeats-start"] = apm.heartbeats.start;
         apm_metrics["heartbeats-success"] = apm.heartbeats.success;
         apm_metrics["heartbeats-failed"] = apm.heartbeats.failed;
+        apm_metrics["command-timings-1min"] = apm.command_timings_agg;
     }
 }
 
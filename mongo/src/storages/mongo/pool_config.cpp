@@ -54,6 +54,8 @@ PoolSettings ParsePoolSettings(const ConfigType& config) {
     auto user_initial_size = config["initial_size"].template As<std::optional<size_t>>();
     result.initial_size = user_initial_size.value_or(std::min(result.initial_size, result.idle_limit));
 
+    result.min_idle = config["min_idle"].template As<size_t>(result.min_idle);
+
     return result;
 }
 
@@ -105,6 +107,10 @@ void PoolSettings::Validate(const std::string& pool_id) const {
         throw InvalidConfigException("invalid initial connections count in ") << pool_id << " pool config";
     }
 
+    if (min_idle > idle_limit) {
+        throw InvalidConfigException("invalid min idle connections count in ") << pool_id << " pool config";
+    }
+
     if (!connecting_limit) {
         throw InvalidConfigException("invalid establishing connections limit in ") << pool_id << " pool config";
     }
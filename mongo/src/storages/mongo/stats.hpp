@@ -132,6 +132,10 @@ struct HeartbeatsStatistics final {
 struct ApmStats final {
     TopologyStatistics topology;
     HeartbeatsStatistics heartbeats;
+
+    // Time spent by the server and the network on the commands, excluding the
+    // wait for a connection
+    AggregatedTimingsPercentile command_timings_agg;
 };
 
 struct EventStats final {
@@ -15,7 +15,9 @@
 #include <userver/storages/mysql/cluster_host_type.hpp>
 #include <userver/storages/mysql/command_result_set.hpp>
 #include <userver/storages/mysql/cursor_result_set.hpp>
+#include <userver/storages/mysql/execution_result.hpp>
 #include <userver/storages/mysql/impl/bind_helper.hpp>
+#include <userver/storages/mysql/impl/bulk_chunks.hpp>
 #include <userver/storages/mysql/options.hpp>
 #include <userver/storages/mysql/query.hpp>
 #include <userver/storages/mysql/statement_result_set.hpp>
@@ -150,6 +152,49 @@ public:
         const Container& params
     ) const;
 
+    /// Default limit for the estimated size of a single chunk of
+    /// ExecuteBulkChunked, well below the default `max_allowed_packet`
+    static constexpr std::size_t kDefaultMaxChunkBytes = 16 * 1024 * 1024;
+
+    /// @brief Executes a statement on a host of host_type with default deadline,
+    /// splitting params into chunks that fit into `max_chunk_bytes`.
+    /// See ExecuteBulkChunked with CommandControl for details.
+    template <typename Container>
+    ExecutionResult ExecuteBulkChunked(
+        ClusterHostType host_type,
+        const Query& query,
+        const Container& params,
+        std::size_t max_chunk_bytes = kDefaultMaxChunkBytes
+    ) const;
+
+    /// @brief Executes a statement on a host of host_type with provided
+    /// CommandControl, splitting params into chunks that fit into
+    /// `max_chunk_bytes`.
+    ///
+    /// Same as ExecuteBulk, but for the containers that don't fit into a
+    /// single packet: the size of each row is estimated, and the rows are sent
+    /// with a series of bulk executions of the same prepared statement, which
+    /// is reused via the statements cache of the connection. `max_chunk_bytes`
+    /// should be below the `max_allowed_packet` of the server.
+    ///
+    /// @note Requires MariaDB 10.2.6+ as a server
+    /// @warning The chunks are executed separately and are not atomic as a
+    /// whole, use a transaction if you need all-or-nothing semantics.
+    ///
+    /// Returns the sum of the affected rows of all the chunks and the
+    /// LastInsertId of the first chunk.
+    ///
+    /// UINVARIANTs on params count mismatch, doesn't validate types.
+    /// UINVARIANTs on empty params container.
+    template <typename Container>
+    ExecutionResult ExecuteBulkChunked(
+        OptionalCommandControl command_control,
+        ClusterHostType host_type,
+        const Query& query,
+        const Container& params,
+        std::size_t max_chunk_bytes = kDefaultMaxChunkBytes
+    ) const;
+
     // TODO : don't require Container to be const, so Convert can move
     // clang-format off
   /// @brief Executes a statement on a host of host_type with default deadline,
@@ -339,6 +384,42 @@ StatementResultSet Cluster::ExecuteBulk(
     return DoExecute(command_control, host_type, query.GetStatement(), params_binder, std::nullopt);
 }
 
+template <typename Container>
+ExecutionResult Cluster::ExecuteBulkChunked(
+    ClusterHostType host_type,
+    const Query& query,
+    const Container& params,
+    std::size_t max_chunk_bytes
+) const {
+    return ExecuteBulkChunked(std::nullopt, host_type, query, params, max_chunk_bytes);
+}
+
+template <typename Container>
+ExecutionResult Cluster::ExecuteBulkChunked(
+    OptionalCommandControl command_control,
+    ClusterHostType host_type,
+    const Query& query,
+    const Container& params,
+    std::size_t max_chunk_bytes
+) const {
+    UINVARIANT(!params.empty(), "Empty params in bulk execution");
+
+    ExecutionResult result{};
+    bool is_first_chunk = true;
+    impl::ForEachChunk(params, max_chunk_bytes, [&](const auto& chunk) {
+        auto params_binder = impl::BindHelper::BindContainerAsParams(chunk);
+        const auto chunk_result =
+            DoExecute(command_control, host_type, query.GetStatement(), params_binder, std::nullopt)
+                .AsExecutionResult();
+
+        result.rows_affected += chunk_result.rows_affected;
+        if (is_first_chunk) result.last_insert_id = chunk_result.last_insert_id;
+        is_first_chunk = false;
+    });
+
+    return result;
+}
+
 template <typename MapTo, typename Container>
 StatementResultSet Cluster::ExecuteBulkMapped(ClusterHostType host_type, const Query& query, const Container& params)
     const {
@@ -2,6 +2,13 @@
 
 /// @file userver/storages/mysql/cursor_result_set.hpp
 
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
+
 #include <userver/storages/mysql/statement_result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -26,6 +33,9 @@ public:
     ///
     /// Usable when the result set is expected to be big enough to put too
     /// much memory pressure if fetched as a whole.
+    /// The next batch is fetched in a separate task while row_callback is
+    /// invoked for the rows of the current one, so at most two batches are
+    /// kept in memory.
     // TODO : deadline?
     template <typename RowCallback>
     void ForEach(RowCallback&& row_callback, engine::Deadline deadline) &&;
@@ -52,18 +62,29 @@ void CursorResultSet<T>::ForEach(
 ) && {
     using IntermediateStorage = std::vector<T>;
 
-    bool keep_going = true;
     auto extractor = impl::io::TypedExtractor<IntermediateStorage, T, RowTag>{};
-
-    while (keep_going) {
-        tracing::ScopeTime fetch{impl::tracing::kFetchScope};
-        keep_going = result_set_.FetchResult(extractor);
-
-        fetch.Reset(impl::tracing::kForEachScope);
-        IntermediateStorage data{extractor.ExtractData()};
-        for (auto&& row : data) {
-            row_callback(std::move(row));
+    const auto fetch_batch = [this, &extractor] {
+        const tracing::ScopeTime fetch{impl::tracing::kFetchScope};
+        const bool has_more = result_set_.FetchResult(extractor);
+        return std::pair<bool, IntermediateStorage>{has_more, extractor.ExtractData()};
+    };
+
+    auto [keep_going, data] = fetch_batch();
+    while (true) {
+        // The next batch is fetched from the server while the current one is
+        // being processed
+        engine::TaskWithResult<std::pair<bool, IntermediateStorage>> next_batch;
+        if (keep_going) next_batch = utils::Async("mysql_cursor_fetch", fetch_batch);
+
+        {
+            const tracing::ScopeTime for_each{impl::tracing::kForEachScope};
+            for (auto&& row : data) {
+                row_callback(std::move(row));
+            }
         }
+
+        if (!next_batch.IsValid()) break;
+        std::tie(keep_going, data) = next_batch.Get();
     }
 }
 
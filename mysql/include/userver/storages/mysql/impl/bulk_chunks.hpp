@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+
+#include <boost/pfr/core.hpp>
+
+#include <userver/formats/json_fwd.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::impl {
+
+// Non-owning view of a contiguous range of rows of a container, satisfies
+// the requirements of io::InsertBinder
+template <typename Container>
+class ContainerSlice final {
+public:
+    using value_type = typename Container::value_type;
+    using const_iterator = typename Container::const_iterator;
+
+    ContainerSlice(const_iterator begin, const_iterator end, std::size_t size)
+        : begin_{begin}, end_{end}, size_{size} {}
+
+    const_iterator begin() const { return begin_; }
+    const_iterator end() const { return end_; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+private:
+    const_iterator begin_;
+    const_iterator end_;
+    std::size_t size_;
+};
+
+std::size_t EstimateJsonBytes(const formats::json::Value& value);
+
+// Upper estimate of the size of the field in the COM_STMT_EXECUTE packet
+template <typename Field>
+std::size_t EstimateFieldBytes(const Field& field) {
+    // length-encoded size prefix and the indicator byte
+    constexpr std::size_t kOverhead = 10;
+
+    if constexpr (meta::kIsOptional<Field>) {
+        return field.has_value() ? EstimateFieldBytes(*field) : 1;
+    } else if constexpr (std::is_same_v<Field, formats::json::Value>) {
+        return EstimateJsonBytes(field) + kOverhead;
+    } else if constexpr (meta::kIsSizable<Field>) {
+        return std::size(field) + kOverhead;
+    } else {
+        return sizeof(Field) + 1;
+    }
+}
+
+template <typename Row>
+std::size_t EstimateRowBytes(const Row& row) {
+    std::size_t bytes = 0;
+    boost::pfr::for_each_field(row, [&bytes](const auto& field) { bytes += EstimateFieldBytes(field); });
+    return bytes;
+}
+
+// Calls chunk_callback with slices of rows, each of them fitting into
+// max_chunk_bytes, unless a single row is bigger than that
+template <typename Container, typename ChunkCallback>
+void ForEachChunk(const Container& rows, std::size_t max_chunk_bytes, ChunkCallback&& chunk_callback) {
+    auto chunk_begin = rows.begin();
+    std::size_t chunk_size = 0;
+    std::size_t chunk_bytes = 0;
+
+    for (auto it = rows.begin(); it != rows.end(); ++it) {
+        const auto row_bytes = EstimateRowBytes(*it);
+        if (chunk_size != 0 && chunk_bytes + row_bytes > max_chunk_bytes) {
+            chunk_callback(ContainerSlice<Container>{chunk_begin, it, chunk_size});
+            chunk_begin = it;
+            chunk_size = 0;
+            chunk_bytes = 0;
+        }
+        ++chunk_size;
+        chunk_bytes += row_bytes;
+    }
+
+    if (chunk_size != 0) {
+        chunk_callback(ContainerSlice<Container>{chunk_begin, rows.end(), chunk_size});
+    }
+}
+
+}  // namespace storages::mysql::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,14 @@
+#include <userver/storages/mysql/impl/bulk_chunks.hpp>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::impl {
+
+std::size_t EstimateJsonBytes(const formats::json::Value& value) { return formats::json::ToString(value).size(); }
+
+}  // namespace storages::mysql::impl
+
+USERVER_NAMESPACE_END
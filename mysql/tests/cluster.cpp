@@ -76,6 +76,34 @@ UTEST(Cluster, InsertMany) {
     EXPECT_EQ(db_rows, rows_to_insert);
 }
 
+UTEST(Cluster, InsertManyChunked) {
+    ClusterWrapper cluster{};
+    TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+    const std::string long_string_to_avoid_sso{"hi i am some long string that doesn't fit in sso"};
+
+    constexpr int kRowsCount = 100;
+
+    std::vector<Row> rows_to_insert;
+    rows_to_insert.reserve(kRowsCount);
+    for (int i = 0; i < kRowsCount; ++i) {
+        rows_to_insert.push_back({i, fmt::format("{}: {}", i, long_string_to_avoid_sso)});
+    }
+
+    // a few rows per chunk
+    constexpr std::size_t kMaxChunkBytes = 256;
+    const auto result = cluster->ExecuteBulkChunked(
+        ClusterHostType::kPrimary,
+        table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"),
+        rows_to_insert,
+        kMaxChunkBytes
+    );
+    EXPECT_EQ(result.rows_affected, kRowsCount);
+
+    const auto db_rows = table.DefaultExecute("SELECT Id, Value FROM {}").AsVector<Row>();
+    EXPECT_EQ(db_rows, rows_to_insert);
+}
+
 UTEST(Cluster, UpdateMany) {
     ClusterWrapper cluster{};
     TmpTable table{cluster, "Id INT PRIMARY KEY, Value TEXT NOT NULL"};
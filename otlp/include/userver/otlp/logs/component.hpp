@@ -29,6 +29,12 @@ class Logger;
 /// endpoint | URI of otel collector (e.g. 127.0.0.1:4317) | -
 /// max-queue-size | Maximum async queue size | 65535
 /// max-batch-delay | Maximum batch delay | 100ms
+/// max-batch-records | Maximum number of logs and spans in a batch | 8192
+/// max-batch-bytes | Maximum serialized size of logs and spans in a batch | 2097152
+/// max-concurrent-exports | Maximum number of batches being sent at once | 1
+/// compression | gRPC compression of the batches (none|gzip|deflate) | none
+/// export-timeout | Timeout of sending a batch | no timeout
+/// task-processor | Task processor to send the batches from | the task processor of the component system
 /// service-name | Service name | unknown_service
 /// attributes | Extra attributes for OTLP, object of key/value strings | -
 /// sinks | List of sinks | -
@@ -39,6 +45,12 @@ class Logger;
 /// * `otlp`: OTLP exporter
 /// * `default`: _default_ logger from the `logging` component
 /// * `both`: _default_ logger and OTLP exporter
+///
+/// Logs and spans are sent in batches of at most `max-batch-records` records
+/// and `max-batch-bytes` bytes, up to `max-concurrent-exports` batches at once.
+/// When all the sends are in progress, new records wait in the queue of
+/// `max-queue-size` records. Records that do not fit into the queue are
+/// dropped and accounted in the `dropped` metric of the logger.
 
 // clang-format on
 class LoggerComponent final : public components::RawComponentBase {
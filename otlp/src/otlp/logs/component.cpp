@@ -1,5 +1,6 @@
 #include <userver/otlp/logs/component.hpp>
 
+#include <optional>
 #include <string>
 
 #include <userver/components/component_config.hpp>
@@ -39,6 +40,15 @@ LoggerComponent::LoggerComponent(const components::ComponentConfig& config, cons
     LoggerConfig logger_config;
     logger_config.max_queue_size = config["max-queue-size"].As<size_t>(65535);
     logger_config.max_batch_delay = config["max-batch-delay"].As<std::chrono::milliseconds>(100);
+    logger_config.max_batch_records = config["max-batch-records"].As<size_t>(logger_config.max_batch_records);
+    logger_config.max_batch_bytes = config["max-batch-bytes"].As<size_t>(logger_config.max_batch_bytes);
+    logger_config.max_concurrent_exports =
+        config["max-concurrent-exports"].As<size_t>(logger_config.max_concurrent_exports);
+    logger_config.compression = config["compression"].As<Compression>(Compression::kNone);
+    logger_config.export_timeout = config["export-timeout"].As<std::optional<std::chrono::milliseconds>>();
+    if (config.HasMember("task-processor")) {
+        logger_config.task_processor = &context.GetTaskProcessor(config["task-processor"].As<std::string>());
+    }
     logger_config.service_name = config["service-name"].As<std::string>("unknown_service");
     logger_config.log_level = config["log-level"].As<USERVER_NAMESPACE::logging::Level>();
     logger_config.extra_attributes = config["extra-attributes"].As<std::unordered_map<std::string, std::string>>({});
@@ -119,6 +129,34 @@ properties:
     max-batch-delay:
         type: string
         description: max delay between send batches (e.g. 100ms or 1s)
+    max-batch-records:
+        type: integer
+        description: max number of logs and spans in a send batch
+        defaultDescription: 8192
+        minimum: 1
+    max-batch-bytes:
+        type: integer
+        description: max serialized size of logs and spans in a send batch
+        defaultDescription: 2097152
+        minimum: 1
+    max-concurrent-exports:
+        type: integer
+        description: max number of batches being sent at once
+        defaultDescription: 1
+        minimum: 1
+    compression:
+        type: string
+        enum: [none, gzip, deflate]
+        description: gRPC compression of the send batches
+        defaultDescription: none
+    export-timeout:
+        type: string
+        description: timeout of sending a batch (e.g. 5s)
+        defaultDescription: no timeout
+    task-processor:
+        type: string
+        description: task processor to send batches from
+        defaultDescription: the task processor of the component system
     service-name:
         type: string
         description: service name
@@ -2,12 +2,16 @@
 
 #include <chrono>
 
+#include <grpcpp/client_context.h>
+
 #include <userver/engine/async.hpp>
+#include <userver/engine/task/current_task.hpp>
 #include <userver/formats/parse/common_containers.hpp>
 #include <userver/formats/parse/to.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/logging/logger.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/ugrpc/client/qos.hpp>
 #include <userver/utils/algo.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/hex.hpp>
@@ -25,6 +29,19 @@ constexpr std::string_view kTelemetrySdkName = "telemetry.sdk.name";
 constexpr std::string_view kServiceName = "service.name";
 
 const std::string kTimestampFormat = "%Y-%m-%dT%H:%M:%E*S";
+
+grpc_compression_algorithm ToGrpcCompression(Compression compression) {
+    switch (compression) {
+        case Compression::kNone:
+            return GRPC_COMPRESS_NONE;
+        case Compression::kGzip:
+            return GRPC_COMPRESS_GZIP;
+        case Compression::kDeflate:
+            return GRPC_COMPRESS_DEFLATE;
+    }
+    UINVARIANT(false, "Unexpected OTLP compression");
+}
+
 }  // namespace
 
 Formatter::Formatter(
@@ -147,6 +164,20 @@ SinkType Parse(const yaml_config::YamlConfig& value, formats::parse::To<SinkType
     throw std::runtime_error("OTLP logger: unknown sink type:" + destination);
 }
 
+Compression Parse(const yaml_config::YamlConfig& value, formats::parse::To<Compression>) {
+    auto compression = value.As<std::string>("none");
+    if (compression == "none") {
+        return Compression::kNone;
+    }
+    if (compression == "gzip") {
+        return Compression::kGzip;
+    }
+    if (compression == "deflate") {
+        return Compression::kDeflate;
+    }
+    throw std::runtime_error("OTLP logger: unknown compression:" + compression);
+}
+
 Logger::Logger(
     opentelemetry::proto::collector::logs::v1::LogsServiceClient client,
     opentelemetry::proto::collector::trace::v1::TraceServiceClient trace_client,
@@ -158,13 +189,17 @@ Logger::Logger(
     SetLevel(config_.log_level);
     std::cerr << "OTLP logger has started\n";
 
-    sender_task_ = engine::CriticalAsyncNoSpan([this,
-                                                consumer = queue_->GetConsumer(),
-                                                log_client = std::move(client),
-                                                trace_client = std::move(trace_client)]() mutable {
-        SendingLoop(consumer, log_client, trace_client);
-    });
-    ;
+    UINVARIANT(config_.max_concurrent_exports > 0, "OTLP logger: max concurrent exports must be positive");
+
+    auto& task_processor =
+        config_.task_processor ? *config_.task_processor : engine::current_task::GetTaskProcessor();
+    sender_task_ = engine::CriticalAsyncNoSpan(
+        task_processor,
+        [this,
+         consumer = queue_->GetConsumer(),
+         log_client = std::move(client),
+         trace_client = std::move(trace_client)]() mutable { SendingLoop(consumer, log_client, trace_client); }
+    );
 }
 
 Logger::~Logger() { Stop(); }
@@ -241,35 +276,49 @@ void Logger::SendingLoop(Queue::Consumer& consumer, LogClient& log_client, Trace
     auto scope_spans = resource_spans->add_scope_spans();
     FillAttributes(*resource_spans->mutable_resource());
 
+    std::deque<ExportFuture> exports;
+
     Action action{};
     while (consumer.Pop(action)) {
         scope_logs->clear_log_records();
         scope_spans->clear_spans();
 
         auto deadline = engine::Deadline::FromDuration(config_.max_batch_delay);
+        std::size_t batch_records = 0;
+        std::size_t batch_bytes = 0;
 
         do {
-            std::visit(
+            batch_bytes += std::visit(
                 utils::Overloaded{
-                    [&scope_spans](const opentelemetry::proto::trace::v1::Span& action) {
+                    [&scope_spans](opentelemetry::proto::trace::v1::Span& action) {
                         auto span = scope_spans->add_spans();
-                        *span = action;
+                        *span = std::move(action);
+                        return span->ByteSizeLong();
                     },
-                    [&scope_logs](const opentelemetry::proto::logs::v1::LogRecord& action) {
+                    [&scope_logs](opentelemetry::proto::logs::v1::LogRecord& action) {
                         auto log_records = scope_logs->add_log_records();
-                        *log_records = action;
+                        *log_records = std::move(action);
+                        return log_records->ByteSizeLong();
                     }},
                 action
             );
-        } while (consumer.Pop(action, deadline));
+            ++batch_records;
+        } while (batch_records < config_.max_batch_records && batch_bytes < config_.max_batch_bytes &&
+                 consumer.Pop(action, deadline));
 
-        if (utils::UnderlyingValue(config_.logs_sink) & utils::UnderlyingValue(SinkType::kOtlp)) {
-            DoLog(log_request, log_client);
+        if ((utils::UnderlyingValue(config_.logs_sink) & utils::UnderlyingValue(SinkType::kOtlp)) &&
+            scope_logs->log_records_size() != 0) {
+            StartExport(exports, log_client, log_request);
         }
-        if (utils::UnderlyingValue(config_.tracing_sink) & utils::UnderlyingValue(SinkType::kOtlp)) {
-            DoTrace(trace_request, trace_client);
+        if ((utils::UnderlyingValue(config_.tracing_sink) & utils::UnderlyingValue(SinkType::kOtlp)) &&
+            scope_spans->spans_size() != 0) {
+            StartExport(exports, trace_client, trace_request);
         }
     }
+
+    for (auto& future : exports) {
+        FinishExport(future);
+    }
 }
 
 void Logger::FillAttributes(::opentelemetry::proto::resource::v1::Resource& resource) {
@@ -298,32 +347,32 @@ void Logger::FillAttributes(::opentelemetry::proto::resource::v1::Resource& reso
     }
 }
 
-void Logger::DoLog(
-    const opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest& request,
-    LogClient& client
-) {
-    try {
-        auto response = client.Export(request);
-    } catch (const ugrpc::client::RpcCancelledError&) {
-        std::cerr << "Stopping OTLP sender task\n";
-        throw;
-    } catch (const std::exception& e) {
-        std::cerr << "Failed to write down OTLP log(s): " << e.what() << typeid(e).name() << "\n";
+template <typename Client, typename Request>
+void Logger::StartExport(std::deque<ExportFuture>& exports, Client& client, const Request& request) {
+    if (exports.size() >= config_.max_concurrent_exports) {
+        FinishExport(exports.front());
+        exports.pop_front();
     }
-    // TODO: count exceptions
+
+    auto context = std::make_unique<grpc::ClientContext>();
+    context->set_compression_algorithm(ToGrpcCompression(config_.compression));
+    ugrpc::client::Qos qos;
+    qos.timeout = config_.export_timeout;
+
+    // The request is serialized on start, so it is reused for the next batch
+    exports.emplace_back(client.AsyncExport(request, std::move(context), qos));
 }
 
-void Logger::DoTrace(
-    const opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest& request,
-    TraceClient& trace_client
-) {
+void Logger::FinishExport(ExportFuture& future) {
+    const std::string_view kind =
+        std::holds_alternative<LogClient::ExportResponseFuture>(future) ? "log(s)" : "trace(s)";
     try {
-        auto response = trace_client.Export(request);
+        std::visit([](auto& future) { future.Get(); }, future);
     } catch (const ugrpc::client::RpcCancelledError&) {
         std::cerr << "Stopping OTLP sender task\n";
         throw;
     } catch (const std::exception& e) {
-        std::cerr << "Failed to write down OTLP trace(s): " << e.what() << typeid(e).name() << "\n";
+        std::cerr << "Failed to write down OTLP " << kind << ": " << e.what() << typeid(e).name() << "\n";
     }
     // TODO: count exceptions
 }
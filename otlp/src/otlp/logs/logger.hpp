@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <optional>
 #include <variant>
 
 #include <opentelemetry/proto/collector/logs/v1/logs_service_client.usrv.pb.hpp>
@@ -27,9 +29,25 @@ enum class SinkType : std::uint8_t {
 
 SinkType Parse(const yaml_config::YamlConfig& value, formats::parse::To<SinkType>);
 
+// gRPC message compression, zstd is not supported by gRPC
+enum class Compression {
+    kNone,
+    kGzip,
+    kDeflate,
+};
+
+Compression Parse(const yaml_config::YamlConfig& value, formats::parse::To<Compression>);
+
 struct LoggerConfig {
     size_t max_queue_size{10000};
     std::chrono::milliseconds max_batch_delay{};
+    size_t max_batch_records{8192};
+    size_t max_batch_bytes{2 * 1024 * 1024};
+    size_t max_concurrent_exports{1};
+    Compression compression{Compression::kNone};
+    std::optional<std::chrono::milliseconds> export_timeout;
+    // Runs the sending task, the current task processor if null
+    engine::TaskProcessor* task_processor{nullptr};
     SinkType logs_sink{SinkType::kOtlp};
     SinkType tracing_sink{SinkType::kOtlp};
     std::string service_name;
@@ -98,17 +116,17 @@ protected:
 private:
     using Action = std::variant<::opentelemetry::proto::logs::v1::LogRecord, ::opentelemetry::proto::trace::v1::Span>;
     using Queue = concurrent::NonFifoMpscQueue<Action>;
+    using ExportFuture = std::variant<LogClient::ExportResponseFuture, TraceClient::ExportResponseFuture>;
 
     void SendingLoop(Queue::Consumer& consumer, LogClient& log_client, TraceClient& trace_client);
 
     void FillAttributes(::opentelemetry::proto::resource::v1::Resource& resource);
 
-    void DoLog(const opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest& request, LogClient& client);
+    // Waits for the oldest exports if there are too many of them in flight
+    template <typename Client, typename Request>
+    void StartExport(std::deque<ExportFuture>& exports, Client& client, const Request& request);
 
-    void DoTrace(
-        const opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest& request,
-        TraceClient& trace_client
-    );
+    void FinishExport(ExportFuture& future);
 
     logging::impl::LogStatistics stats_;
     const LoggerConfig config_;
@@ -1,5 +1,7 @@
 #include <userver/utest/utest.hpp>
 
+#include <algorithm>
+#include <string>
 #include <vector>
 
 #include <otlp/logs/logger.hpp>
@@ -47,6 +49,7 @@ public:
         // Don't emit new traces to avoid recursive traces/logs
         tracing::Span::CurrentSpan().SetLogLevel(logging::Level::kNone);
 
+        ++requests;
         for (const auto& rl : request.resource_logs()) {
             for (const auto& sl : rl.scope_logs()) {
                 for (const auto& lr : sl.log_records()) {
@@ -60,6 +63,7 @@ public:
 
     // no sync as there is only a single grpc client
     std::vector<::opentelemetry::proto::logs::v1::LogRecord> logs;
+    std::size_t requests{0};
 };
 
 class TraceService final : public opentelemetry::proto::collector::trace::v1::TraceServiceBase {
@@ -89,8 +93,7 @@ public:
 // NOLINTNEXTLINE(fuchsia-multiple-inheritance)
 class LogServiceTest : public Service<LogService, TraceService>, public utest::DefaultLoggerFixture<::testing::Test> {
 public:
-    LogServiceTest() : Service({}) {
-        otlp::LoggerConfig config;
+    explicit LogServiceTest(otlp::LoggerConfig config = {}) : Service({}) {
         config.logs_sink = otlp::SinkType::kBoth;
         logger_ = std::make_shared<otlp::Logger>(
             MakeClient<opentelemetry::proto::collector::logs::v1::LogsServiceClient>(),
@@ -108,6 +111,19 @@ private:
     std::shared_ptr<otlp::Logger> logger_;
 };
 
+otlp::LoggerConfig MakeBatchConfig() {
+    otlp::LoggerConfig config;
+    config.max_batch_delay = std::chrono::seconds{10};
+    config.max_batch_records = 3;
+    config.compression = otlp::Compression::kGzip;
+    return config;
+}
+
+class LogServiceBatchTest : public LogServiceTest {
+public:
+    LogServiceBatchTest() : LogServiceTest(MakeBatchConfig()) {}
+};
+
 }  // namespace
 
 UTEST_F(LogServiceTest, NoInfiniteLogsInTrace) {
@@ -165,4 +181,26 @@ UTEST_F(LogServiceTest, SmokeTrace) {
     EXPECT_LE(span.end_time_unix_nano(), timestamp2.count());
 }
 
+UTEST_F(LogServiceBatchTest, BatchRecordsLimit) {
+    for (int i = 0; i < 9; ++i) {
+        LOG_INFO() << "log " << i;
+    }
+
+    // Full batches are sent without waiting for max-batch-delay
+    while (GetService1().logs.size() < 9) {
+        engine::SleepFor(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_EQ(GetService1().requests, 3);
+
+    std::vector<std::string> bodies;
+    for (const auto& log : GetService1().logs) {
+        bodies.push_back(log.body().string_value());
+    }
+    std::sort(bodies.begin(), bodies.end());
+    for (int i = 0; i < 9; ++i) {
+        EXPECT_EQ(bodies[i], "log " + std::to_string(i));
+    }
+}
+
 USERVER_NAMESPACE_END
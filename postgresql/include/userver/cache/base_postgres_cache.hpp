@@ -7,9 +7,11 @@
 
 #include <chrono>
 #include <map>
+#include <optional>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -23,9 +25,11 @@
 #include <userver/storages/postgres/io/chrono.hpp>
 
 #include <userver/compiler/demangle.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/meta.hpp>
 #include <userver/utils/void_t.hpp>
@@ -66,6 +70,7 @@ namespace components {
 /// incremental-update-op-timeout | timeout for an incremental update | 1s
 /// update-correction | incremental update window adjustment | - (0 for caches with defined GetLastKnownUpdated)
 /// chunk-size | number of rows to request from PostgreSQL via portals, 0 to fetch all rows in one request without portals | 1000
+/// full-update-parallelism | number of partitions that a full update is split into, each fetched and parsed concurrently over its own connection; values above 1 require `kPartitionField` in the policy | 1
 ///
 /// @section pg_cc_cache_policy Cache policy
 ///
@@ -91,6 +96,14 @@ namespace components {
 ///
 /// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Custom Updated Example
 ///
+/// Full updates of large tables may be split into `full-update-parallelism`
+/// partitions by the remainder of the integer `kPartitionField` expression of
+/// the policy. Each partition is fetched over its own connection and parsed
+/// into a separate container concurrently, then the containers are merged
+/// without copying the elements. The mode is supported for `std::map` and
+/// `std::unordered_map` containers. With portals (`chunk-size` above 0) the
+/// next chunk is always fetched while the current one is being parsed.
+///
 /// In case one provides a custom CacheContainer within Policy, it is notified
 /// of Update completion via its public member function OnWritesDone, if any.
 /// See the following code snippet for an example of usage:
@@ -160,6 +173,12 @@ using HasWhere = decltype(T::kWhere);
 template <typename T>
 inline constexpr bool kHasWhere = meta::kIsDetected<HasWhere, T>;
 
+// Partition field for parallel full updates
+template <typename T>
+using HasPartitionField = decltype(T::kPartitionField);
+template <typename T>
+inline constexpr bool kHasPartitionField = meta::kIsDetected<HasPartitionField, T>;
+
 // Update field
 template <typename T>
 using HasUpdatedField = decltype(T::kUpdatedField);
@@ -224,6 +243,23 @@ CopyContainer(const T& container, [[maybe_unused]] std::size_t cpu_relax_iterati
     }
 }
 
+// Moves the elements of `from` into `to` without reallocating them. Like in
+// CacheInsertOrAssign, the elements of `from` replace the ones with equal keys.
+template <typename T>
+void MergeContainers(T& to, T&& from) {
+    static_assert(kIsContainerCopiedByElement<T>);
+    if (to.empty()) {
+        to.swap(from);
+        return;
+    }
+    while (!from.empty()) {
+        auto result = to.insert(from.extract(from.begin()));
+        if (!result.inserted) {
+            result.position->second = std::move(result.node.mapped());
+        }
+    }
+}
+
 template <typename Container, typename Value, typename KeyMember, typename... Args>
 void CacheInsertOrAssign(Container& container, Value&& value, const KeyMember& key_member, Args&&... /*args*/) {
     // Args are only used to de-prioritize this default overload.
@@ -370,6 +406,7 @@ inline constexpr std::string_view kFetchStage = "fetch";
 inline constexpr std::string_view kParseStage = "parse";
 
 inline constexpr std::size_t kDefaultChunkSize = 1000;
+inline constexpr std::size_t kDefaultFullUpdateParallelism = 1;
 }  // namespace pg_cache::detail
 
 /// @ingroup userver_components
@@ -414,6 +451,20 @@ private:
     bool MayReturnNull() const override;
 
     CachedData GetDataSnapshot(cache::UpdateType type, tracing::ScopeTime& scope);
+    std::size_t FetchAndCache(
+        storages::postgres::Cluster& cluster,
+        const storages::postgres::Query& query,
+        std::chrono::milliseconds timeout,
+        std::chrono::system_clock::time_point last_update,
+        CachedData& data_cache,
+        cache::UpdateStatisticsScope& stats_scope,
+        tracing::ScopeTime& scope
+    );
+    std::size_t FetchAndCachePartitioned(
+        std::chrono::system_clock::time_point last_update,
+        CachedData& data_cache,
+        cache::UpdateStatisticsScope& stats_scope
+    );
     void CacheResults(
         storages::postgres::ResultSet res,
         CachedData& data_cache,
@@ -423,6 +474,7 @@ private:
 
     static storages::postgres::Query GetAllQuery();
     static storages::postgres::Query GetDeltaQuery();
+    static storages::postgres::Query GetPartitionQuery(std::size_t partition, std::size_t partitions);
 
     std::chrono::milliseconds ParseCorrection(const ComponentConfig& config);
 
@@ -432,6 +484,7 @@ private:
     const std::chrono::milliseconds full_update_timeout_;
     const std::chrono::milliseconds incremental_update_timeout_;
     const std::size_t chunk_size_;
+    const std::size_t full_update_parallelism_;
     std::size_t cpu_relax_iterations_parse_{0};
     std::size_t cpu_relax_iterations_copy_{0};
 };
@@ -448,7 +501,9 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config, co
       incremental_update_timeout_{config["incremental-update-op-timeout"].As<std::chrono::milliseconds>(
           pg_cache::detail::kDefaultIncrementalUpdateTimeout
       )},
-      chunk_size_{config["chunk-size"].As<size_t>(pg_cache::detail::kDefaultChunkSize)} {
+      chunk_size_{config["chunk-size"].As<size_t>(pg_cache::detail::kDefaultChunkSize)},
+      full_update_parallelism_{
+          config["full-update-parallelism"].As<size_t>(pg_cache::detail::kDefaultFullUpdateParallelism)} {
     UINVARIANT(
         !chunk_size_ || storages::postgres::Portal::IsSupportedByDriver(),
         "Either set 'chunk-size' to 0, or enable PostgreSQL portals by building "
@@ -462,6 +517,24 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config, co
             config.Name() + "' cache"
         );
     }
+    if (full_update_parallelism_ == 0) {
+        throw std::logic_error("'full-update-parallelism' must be positive in config of '" + config.Name() + "' cache");
+    }
+    if (full_update_parallelism_ > 1) {
+        if (!pg_cache::detail::kHasPartitionField<PostgreCachePolicy>) {
+            throw std::logic_error(
+                "'full-update-parallelism' above 1 is requested in config but no "
+                "partition field is specified in traits of '" +
+                config.Name() + "' cache"
+            );
+        }
+        if (!pg_cache::detail::kIsContainerCopiedByElement<DataType>) {
+            throw std::logic_error(
+                "'full-update-parallelism' above 1 is requested in config of '" + config.Name() +
+                "' cache, but it is supported only for std::map and std::unordered_map containers"
+            );
+        }
+    }
     if (correction_.count() < 0) {
         throw std::logic_error(
             "Refusing to set forward (negative) update correction requested in "
@@ -524,6 +597,28 @@ storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetDeltaQuery() {
     }
 }
 
+template <typename PostgreCachePolicy>
+storages::postgres::Query
+PostgreCache<PostgreCachePolicy>::GetPartitionQuery(std::size_t partition, std::size_t partitions) {
+    if constexpr (pg_cache::detail::kHasPartitionField<PostgreCachePolicy>) {
+        storages::postgres::Query query = PolicyCheckerType::GetQuery();
+        // abs() after mod() assigns negative keys to partitions too and cannot overflow
+        const auto condition =
+            fmt::format("abs(mod({}, {})) = {}", PostgreCachePolicy::kPartitionField, partitions, partition);
+
+        if constexpr (pg_cache::detail::kHasWhere<PostgreCachePolicy>) {
+            return {
+                fmt::format("{} where ({}) and {}", query.Statement(), PostgreCachePolicy::kWhere, condition),
+                query.GetName()};
+        } else {
+            return {fmt::format("{} where {}", query.Statement(), condition), query.GetName()};
+        }
+    } else {
+        UINVARIANT(partitions == 1 && partition == 0, "No kPartitionField in the cache policy");
+        return GetAllQuery();
+    }
+}
+
 template <typename PostgreCachePolicy>
 std::chrono::milliseconds PostgreCache<PostgreCachePolicy>::ParseCorrection(const ComponentConfig& config) {
     static constexpr std::string_view kUpdateCorrection = "update-correction";
@@ -554,7 +649,6 @@ void PostgreCache<PostgreCachePolicy>::Update(
     const std::chrono::system_clock::time_point& /*now*/,
     cache::UpdateStatisticsScope& stats_scope
 ) {
-    namespace pg = storages::postgres;
     if constexpr (!kIncrementalUpdates) {
         type = cache::UpdateType::kFull;
     }
@@ -570,43 +664,12 @@ void PostgreCache<PostgreCachePolicy>::Update(
     scope.Reset(std::string{pg_cache::detail::kFetchStage});
 
     size_t changes = 0;
-    // Iterate clusters
-    for (auto& cluster : clusters_) {
-        if (chunk_size_ > 0) {
-            auto trx = cluster->Begin(
-                kClusterHostTypeFlags,
-                pg::Transaction::RO,
-                pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff}
-            );
-            auto portal = trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
-            while (portal) {
-                scope.Reset(std::string{pg_cache::detail::kFetchStage});
-                auto res = portal.Fetch(chunk_size_);
-                stats_scope.IncreaseDocumentsReadCount(res.Size());
-
-                scope.Reset(std::string{pg_cache::detail::kParseStage});
-                CacheResults(res, data_cache, stats_scope, scope);
-                changes += res.Size();
-            }
-            trx.Commit();
-        } else {
-            bool has_parameter = query.Statement().find('$') != std::string::npos;
-            auto res = has_parameter ? cluster->Execute(
-                                           kClusterHostTypeFlags,
-                                           pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff},
-                                           query,
-                                           GetLastUpdated(last_update, *data_cache)
-                                       )
-                                     : cluster->Execute(
-                                           kClusterHostTypeFlags,
-                                           pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff},
-                                           query
-                                       );
-            stats_scope.IncreaseDocumentsReadCount(res.Size());
-
-            scope.Reset(std::string{pg_cache::detail::kParseStage});
-            CacheResults(res, data_cache, stats_scope, scope);
-            changes += res.Size();
+    if (type == cache::UpdateType::kFull && full_update_parallelism_ > 1) {
+        changes = FetchAndCachePartitioned(last_update, data_cache, stats_scope);
+    } else {
+        // Iterate clusters
+        for (auto& cluster : clusters_) {
+            changes += FetchAndCache(*cluster, query, timeout, last_update, data_cache, stats_scope, scope);
         }
     }
 
@@ -652,6 +715,125 @@ bool PostgreCache<PostgreCachePolicy>::MayReturnNull() const {
     return pg_cache::detail::MayReturnNull<PolicyType>();
 }
 
+template <typename PostgreCachePolicy>
+std::size_t PostgreCache<PostgreCachePolicy>::FetchAndCache(
+    storages::postgres::Cluster& cluster,
+    const storages::postgres::Query& query,
+    std::chrono::milliseconds timeout,
+    std::chrono::system_clock::time_point last_update,
+    CachedData& data_cache,
+    cache::UpdateStatisticsScope& stats_scope,
+    tracing::ScopeTime& scope
+) {
+    namespace pg = storages::postgres;
+    std::size_t changes = 0;
+
+    if (chunk_size_ > 0) {
+        auto trx = cluster.Begin(
+            kClusterHostTypeFlags,
+            pg::Transaction::RO,
+            pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff}
+        );
+        auto portal = trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
+
+        scope.Reset(std::string{pg_cache::detail::kFetchStage});
+        std::optional<pg::ResultSet> chunk;
+        if (portal) chunk.emplace(portal.Fetch(chunk_size_));
+
+        while (chunk) {
+            stats_scope.IncreaseDocumentsReadCount(chunk->Size());
+
+            // Fetch the next chunk while parsing the current one
+            engine::TaskWithResult<pg::ResultSet> next_chunk;
+            if (portal) {
+                next_chunk = utils::Async("pg-cache-fetch", [&portal, chunk_size = chunk_size_] {
+                    return portal.Fetch(chunk_size);
+                });
+            }
+
+            scope.Reset(std::string{pg_cache::detail::kParseStage});
+            CacheResults(*chunk, data_cache, stats_scope, scope);
+            changes += chunk->Size();
+            chunk.reset();
+
+            if (next_chunk.IsValid()) {
+                scope.Reset(std::string{pg_cache::detail::kFetchStage});
+                chunk.emplace(next_chunk.Get());
+            }
+        }
+        trx.Commit();
+    } else {
+        bool has_parameter = query.Statement().find('$') != std::string::npos;
+        auto res = has_parameter ? cluster.Execute(
+                                       kClusterHostTypeFlags,
+                                       pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff},
+                                       query,
+                                       GetLastUpdated(last_update, *data_cache)
+                                   )
+                                 : cluster.Execute(
+                                       kClusterHostTypeFlags,
+                                       pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff},
+                                       query
+                                   );
+        stats_scope.IncreaseDocumentsReadCount(res.Size());
+
+        scope.Reset(std::string{pg_cache::detail::kParseStage});
+        CacheResults(res, data_cache, stats_scope, scope);
+        changes += res.Size();
+    }
+
+    return changes;
+}
+
+template <typename PostgreCachePolicy>
+std::size_t PostgreCache<PostgreCachePolicy>::FetchAndCachePartitioned(
+    std::chrono::system_clock::time_point last_update,
+    CachedData& data_cache,
+    cache::UpdateStatisticsScope& stats_scope
+) {
+    if constexpr (pg_cache::detail::kIsContainerCopiedByElement<DataType>) {
+        struct PartitionResult {
+            CachedData data;
+            std::size_t changes;
+        };
+
+        std::vector<engine::TaskWithResult<PartitionResult>> tasks;
+        tasks.reserve(clusters_.size() * full_update_parallelism_);
+        for (auto& cluster : clusters_) {
+            for (std::size_t partition = 0; partition < full_update_parallelism_; ++partition) {
+                auto fetch_partition = [this, &cluster, &stats_scope, last_update, partition] {
+                    auto scope =
+                        tracing::Span::CurrentSpan().CreateScopeTime(std::string{pg_cache::detail::kFetchStage});
+                    auto data = std::make_unique<DataType>();
+                    const auto changes = FetchAndCache(
+                        *cluster,
+                        GetPartitionQuery(partition, full_update_parallelism_),
+                        full_update_timeout_,
+                        last_update,
+                        data,
+                        stats_scope,
+                        scope
+                    );
+                    return PartitionResult{std::move(data), changes};
+                };
+                tasks.push_back(utils::Async("pg-cache-fetch-partition", std::move(fetch_partition)));
+            }
+        }
+
+        // Merging in order keeps the precedence of the later clusters
+        std::size_t changes = 0;
+        for (auto& task : tasks) {
+            auto result = task.Get();
+            pg_cache::detail::MergeContainers(*data_cache, std::move(*result.data));
+            changes += result.changes;
+        }
+        return changes;
+    } else {
+        UINVARIANT(false, "Partitioned full updates are not supported for the cache container");
+        return 0;
+    }
+}
+
 template <typename PostgreCachePolicy>
 void PostgreCache<PostgreCachePolicy>::CacheResults(
     storages::postgres::ResultSet res,
@@ -18,6 +18,7 @@
 #include <userver/storages/postgres/detail/non_transaction.hpp>
 #include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
 #include <userver/storages/postgres/query.hpp>
 #include <userver/storages/postgres/query_queue.hpp>
 #include <userver/storages/postgres/statistics.hpp>
@@ -217,9 +218,30 @@ public:
 
     /// @brief Listen for notifications on channel
     /// @warning Each NotifyScope owns a single connection taken from the pool,
-    /// which effectively decreases the number of usable connections
+    /// which effectively decreases the number of usable connections. Consider
+    /// Subscribe() when listening to many channels
     NotifyScope Listen(std::string_view channel, OptionalCommandControl = {});
 
+    /// @brief Subscribe to notifications on channel
+    ///
+    /// All the subscriptions of the cluster share a single connection to the
+    /// master, so it is the preferred way to listen to many channels.
+    /// Returns after the channel is listened to, the execute timeout of the
+    /// command control limits the wait.
+    NotifySubscription Subscribe(std::string_view channel, OptionalCommandControl = {});
+
+    /// @brief Enables caching of the results of the named query.
+    ///
+    /// Results are cached by the statement and the parameters for
+    /// Cluster::Execute() calls with built-in parameter types only, the
+    /// transactions are not affected. Concurrent executions with the same
+    /// parameters that miss the cache run the statement once. Replaces the
+    /// previous cache of the query, if any.
+    void SetQueryResultCache(const std::string& query_name, QueryResultCacheSettings settings);
+
+    /// Disables caching of the results of the named query
+    void ResetQueryResultCache(const std::string& query_name);
+
     /// Replaces globally updated command control with a static user-provided one
     void SetDefaultCommandControl(CommandControl);
 
@@ -254,6 +276,8 @@ private:
     OptionalCommandControl GetQueryCmdCtl(const std::string& query_name) const;
     OptionalCommandControl GetHandlersCmdCtl(OptionalCommandControl cmd_ctl) const;
 
+    bool HasQueryResultCache(const Query& query) const;
+
     detail::ClusterImplPtr pimpl_;
 };
 
@@ -273,6 +297,13 @@ ResultSet Cluster::Execute(
         statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
     }
     statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+    if constexpr ((... && (io::IsTypeMappedToSystem<Args>() || io::IsTypeMappedToSystemArray<Args>()))) {
+        if (HasQueryResultCache(query)) {
+            ParameterStore store;
+            (store.PushBack(args), ...);
+            return Execute(flags, statement_cmd_ctl, query, store);
+        }
+    }
     auto ntrx = Start(flags, statement_cmd_ctl);
     return ntrx.Execute(statement_cmd_ctl, query, args...);
 }
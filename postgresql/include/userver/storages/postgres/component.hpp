@@ -129,9 +129,11 @@ namespace components {
 /// ignore_unused_query_params| disable check for not-NULL query params that are not used in query          | false
 /// monitoring-dbalias      | name of the database for monitorings                                          | calculated from dbalias or dbconnection options
 /// max_prepared_cache_size | prepared statements cache size limit                                          | 200
+/// prepared-statements-warmup | number of the hottest prepared statements to prepare on a new connection   | 0
 /// max_statement_metrics   | limit of exported metrics for named statements                                | 0
 /// min_pool_size           | number of connections created initially                                       | 4
 /// max_pool_size           | maximum number of created connections for "connlimit_mode: manual"            | 15
+/// min_idle_pool_size      | number of idle connections kept ready by opening new ones in background       | 0
 /// max_queue_size          | maximum number of clients waiting for a connection                            | 200
 /// connecting_limit        | limit for concurrent establishing connections number per pool (0 - unlimited) | 0
 /// connlimit_mode          | max_connections setup mode (manual or auto), also see @ref scripts/docs/en/userver/pg_connlimit_mode_auto.md | auto
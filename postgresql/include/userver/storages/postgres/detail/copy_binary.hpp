@@ -0,0 +1,84 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/type_mapping.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Helpers for the binary format of `COPY`, see
+/// https://www.postgresql.org/docs/current/sql-copy.html#id-1.9.3.55.9.4
+
+/// Appends the signature, the flags and the header extension length
+void WriteCopyBinaryHeader(std::string& buffer);
+
+/// Appends the file trailer
+void WriteCopyBinaryTrailer(std::string& buffer);
+
+/// Returns the data past the header
+/// @throws InvalidInputFormat if the data does not start with a valid header
+std::string_view SkipCopyBinaryHeader(std::string_view data);
+
+/// Appends a tuple, a row type is written field by field, a column type is
+/// written as a single field
+template <typename Row>
+void WriteCopyBinaryRow(const UserTypes& types, std::string& buffer, const Row& row) {
+    if constexpr (io::traits::kIsRowType<Row>) {
+        using RowType = io::RowType<Row>;
+        io::WriteBuffer(types, buffer, static_cast<Smallint>(RowType::size));
+        std::apply(
+            [&types, &buffer](const auto&... fields) { (io::WriteRawBinary(types, buffer, fields), ...); },
+            RowType::GetTuple(row)
+        );
+    } else {
+        io::WriteBuffer(types, buffer, static_cast<Smallint>(1));
+        io::WriteRawBinary(types, buffer, row);
+    }
+}
+
+template <typename T>
+void ReadCopyBinaryField(const UserTypes& types, io::FieldBuffer& buffer, T& value) {
+    const auto& categories = types.GetTypeBufferCategories();
+    const auto category = io::GetTypeBufferCategory(categories, io::CppToPg<T>::GetOid(types));
+    buffer.ReadRaw(value, categories, category);
+}
+
+/// Reads a tuple from the data of a single `COPY` message.
+/// @returns false if the data is the file trailer
+template <typename Row>
+bool ReadCopyBinaryRow(const UserTypes& types, std::string_view data, Row& row) {
+    io::FieldBuffer buffer{
+        false, io::BufferCategory::kPlainBuffer, data.size(), reinterpret_cast<const std::uint8_t*>(data.data())};
+    Smallint field_count{0};
+    buffer.Read(field_count, io::BufferCategory::kPlainBuffer);
+    if (field_count == -1) return false;
+
+    if constexpr (io::traits::kIsRowType<Row>) {
+        using RowType = io::RowType<Row>;
+        if (field_count != static_cast<Smallint>(RowType::size)) {
+            throw InvalidInputFormat{fmt::format("COPY tuple has {} fields, expected {}", field_count, RowType::size)};
+        }
+        std::apply(
+            [&types, &buffer](auto&... fields) { (ReadCopyBinaryField(types, buffer, fields), ...); },
+            RowType::GetTuple(row)
+        );
+    } else {
+        if (field_count != 1) {
+            throw InvalidInputFormat{fmt::format("COPY tuple has {} fields, expected 1", field_count)};
+        }
+        ReadCopyBinaryField(types, buffer, row);
+    }
+    return true;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include <userver/storages/postgres/options.hpp>
@@ -11,15 +12,24 @@
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres::detail {
 
+/// Writes the query parameters using the user types of the connection that
+/// executes the query
+using QueryParametersWriter = USERVER_NAMESPACE::utils::function_ref<QueryParameters(const UserTypes&)>;
+
 class NonTransaction {
 public:
     explicit NonTransaction(ConnectionPtr&& conn, SteadyClock::time_point start_time = detail::SteadyClock::now());
 
+    /// The statements are sent over a shared pipelined connection of the pool
+    /// together with the statements of other coroutines
+    explicit NonTransaction(std::shared_ptr<ConnectionPool>&& pool);
+
     NonTransaction(NonTransaction&&) noexcept;
     NonTransaction& operator=(NonTransaction&&) noexcept;
 
@@ -45,6 +55,16 @@ public:
     template <typename... Args>
     ResultSet Execute(OptionalCommandControl statement_cmd_ctl, const Query& query, const Args&... args) {
         detail::StaticQueryParameters<sizeof...(args)> params;
+        if (!conn_) {
+            return DoExecutePipelined(
+                query,
+                [&params, &args...](const UserTypes& types) {
+                    params.Write(types, args...);
+                    return detail::QueryParameters{params};
+                },
+                statement_cmd_ctl
+            );
+        }
         params.Write(GetConnectionUserTypes(), args...);
         return DoExecute(query, detail::QueryParameters{params}, statement_cmd_ctl);
     }
@@ -65,9 +85,12 @@ public:
 private:
     ResultSet
     DoExecute(const Query& query, const detail::QueryParameters& params, OptionalCommandControl statement_cmd_ctl);
+    ResultSet
+    DoExecutePipelined(const Query& query, QueryParametersWriter params_writer, OptionalCommandControl statement_cmd_ctl);
     const UserTypes& GetConnectionUserTypes() const;
 
     detail::ConnectionPtr conn_;
+    std::shared_ptr<ConnectionPool> pool_;
 };
 
 }  // namespace storages::postgres::detail
@@ -4,6 +4,7 @@
 /// @brief storages::postgres::Bytea I/O support
 /// @ingroup userver_postgres_parse_and_format
 
+#include <cstddef>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -12,6 +13,7 @@
 #include <userver/storages/postgres/io/buffer_io.hpp>
 #include <userver/storages/postgres/io/buffer_io_base.hpp>
 #include <userver/storages/postgres/io/type_mapping.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -26,6 +28,8 @@ template <>
 struct IsByteaCompatible<std::string> : std::true_type {};
 template <>
 struct IsByteaCompatible<std::string_view> : std::true_type {};
+template <>
+struct IsByteaCompatible<USERVER_NAMESPACE::utils::span<const std::byte>> : std::true_type {};
 template <typename... VectorArgs>
 struct IsByteaCompatible<std::vector<char, VectorArgs...>> : std::true_type {};
 template <typename... VectorArgs>
@@ -77,6 +81,10 @@ detail::ByteaRefWrapper<const ByteContainer&> Bytea(const ByteContainer& bytes)
 /// @snippet postgresql/src/storages/postgres/tests/bytea_pgtest.cpp bytea_simple
 /// @snippet postgresql/src/storages/postgres/tests/bytea_pgtest.cpp bytea_string
 /// @snippet postgresql/src/storages/postgres/tests/bytea_pgtest.cpp bytea_vector
+///
+/// `std::string_view` and `utils::span<const std::byte>` are parsed without
+/// copying and point into the result buffer, they are valid only while the
+/// storages::postgres::ResultSet is alive.
 // clang-format on
 
 template <typename ByteContainer>
@@ -113,6 +121,10 @@ struct BufferParser<
     void operator()(const FieldBuffer& buffer) {
         if constexpr (std::is_same<typename ByteaType::BytesType, std::string_view>{}) {
             this->value.bytes = std::string_view{reinterpret_cast<const char*>(buffer.buffer), buffer.length};
+        } else if constexpr (std::is_same<
+                                 typename ByteaType::BytesType,
+                                 USERVER_NAMESPACE::utils::span<const std::byte>>{}) {
+            this->value.bytes = {reinterpret_cast<const std::byte*>(buffer.buffer), buffer.length};
         } else {
             this->value.bytes.resize(buffer.length);
             std::copy(buffer.buffer, buffer.buffer + buffer.length, this->value.bytes.begin());
@@ -140,7 +152,12 @@ struct BufferFormatter<
     template <typename Buffer>
     void operator()(const UserTypes&, Buffer& buf) const {
         buf.reserve(buf.size() + this->value.bytes.size());
-        buf.insert(buf.end(), this->value.bytes.begin(), this->value.bytes.end());
+        if constexpr (std::is_same<std::decay_t<ByteContainer>, USERVER_NAMESPACE::utils::span<const std::byte>>{}) {
+            const auto* data = reinterpret_cast<const char*>(this->value.bytes.data());
+            buf.insert(buf.end(), data, data + this->value.bytes.size());
+        } else {
+            buf.insert(buf.end(), this->value.bytes.begin(), this->value.bytes.end());
+        }
     }
 };
 
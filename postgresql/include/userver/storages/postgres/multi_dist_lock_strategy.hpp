@@ -0,0 +1,58 @@
+#pragma once
+
+/// @file userver/storages/postgres/multi_dist_lock_strategy.hpp
+/// @brief @copybrief storages::postgres::MultiDistLockStrategy
+
+#include <userver/dist_lock/dist_lock_settings.hpp>
+#include <userver/dist_lock/multi_dist_lock_strategy.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/storages/postgres/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Postgres strategy for dist_lock::MultiDistLocker
+///
+/// Acquires and prolongs all the locks with a single query. The table must
+/// have the following schema:
+///
+/// @code
+/// CREATE TABLE IF NOT EXISTS scheme.multi_distlocks (
+///     key TEXT PRIMARY KEY,
+///     owner TEXT,
+///     expiration_time TIMESTAMPTZ,
+///     fencing_token BIGINT NOT NULL DEFAULT 1
+/// );
+/// @endcode
+///
+/// Released locks are expired rather than deleted, so the fencing token of a
+/// lock only grows.
+class MultiDistLockStrategy final : public dist_lock::MultiDistLockStrategyBase {
+public:
+    MultiDistLockStrategy(ClusterPtr cluster, const std::string& table, const dist_lock::DistLockSettings& settings);
+
+    std::vector<std::optional<dist_lock::FencingToken>> AcquireMany(
+        std::chrono::milliseconds lock_ttl,
+        const std::string& locker_id,
+        USERVER_NAMESPACE::utils::span<const std::string> lock_names
+    ) override;
+
+    void ReleaseMany(
+        const std::string& locker_id,
+        USERVER_NAMESPACE::utils::span<const std::string> lock_names
+    ) override;
+
+    void UpdateCommandControl(CommandControl cc);
+
+private:
+    ClusterPtr cluster_;
+    rcu::Variable<CommandControl> cc_;
+    const std::string acquire_query_;
+    const std::string release_query_;
+    const std::string owner_prefix_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,9 @@
 /// @file userver/storages/postgres/notify.hpp
 /// @brief Asynchronous notifications
 
+#include <memory>
+
+#include <userver/engine/deadline.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
@@ -12,7 +15,8 @@ namespace storages::postgres {
 
 namespace detail {
 class ConnectionPtr;
-}
+class NotifyDispatcher;
+}  // namespace detail
 
 struct Notification {
     std::string channel;
@@ -54,6 +58,50 @@ private:
     USERVER_NAMESPACE::utils::FastPimpl<Impl, 80, 8> pimpl_;
 };
 
+/// @brief RAII subscription for receiving notifications over a connection
+/// shared by all the subscriptions of a cluster.
+///
+/// Created by calling storages::postgres::Cluster::Subscribe(). Unlike
+/// NotifyScope it does not hold a connection of its own: a single connection
+/// to the master listens to all the subscribed channels and the notifications
+/// are queued for each subscription. The channels are listened to again after
+/// a reconnect or a master switch, the notifications sent in between are lost.
+///
+/// Non-copyable.
+///
+/// @par Usage synopsis
+/// @code
+/// auto subscription = cluster.Subscribe("channel");
+/// cluster.Execute(pg::ClusterHostType::kMaster,
+///                 "select pg_notify('channel', NULL)");
+/// auto ntf = subscription.WaitNotify(engine::Deadline::FromDuration(100ms));
+/// @endcode
+class [[nodiscard]] NotifySubscription final {
+public:
+    NotifySubscription(
+        std::shared_ptr<detail::NotifyDispatcher> dispatcher,
+        std::string_view channel,
+        engine::Deadline deadline
+    );
+
+    ~NotifySubscription();
+
+    NotifySubscription(NotifySubscription&&) noexcept;
+    NotifySubscription& operator=(NotifySubscription&&) noexcept;
+
+    NotifySubscription(const NotifySubscription&) = delete;
+    NotifySubscription& operator=(const NotifySubscription&) = delete;
+
+    /// Wait for notification on the channel
+    /// @throws ConnectionTimeoutError if there was no notification before the
+    /// deadline
+    Notification WaitNotify(engine::Deadline deadline);
+
+private:
+    struct Impl;
+    USERVER_NAMESPACE::utils::FastPimpl<Impl, 80, 8> pimpl_;
+};
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
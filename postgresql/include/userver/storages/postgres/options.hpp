@@ -154,10 +154,25 @@ inline constexpr std::size_t kDefaultConnectingLimit = 0;
 /// @brief PostgreSQL topology options
 ///
 /// Dynamic option @ref POSTGRES_TOPOLOGY_SETTINGS
+/// Replica selection for the requests to slaves without an explicit strategy
+///
+/// Dynamic option @ref POSTGRES_TOPOLOGY_SETTINGS
+enum class ReplicaBalancing {
+    /// Chooses the replicas in turns
+    kRoundRobin,
+    /// Chooses the less loaded of two random replicas, the load accounts for
+    /// the measured query latency, the number of connections in use and the
+    /// replication lag of the replica
+    kLeastLoaded,
+};
+
 struct TopologySettings {
     /// Maximum replication lag. Once the replica lag exceeds this value it will be automatically disabled.
     std::chrono::milliseconds max_replication_lag{kDefaultMaxReplicationLag};
 
+    /// How to choose a replica for the requests to slaves
+    ReplicaBalancing replica_balancing{ReplicaBalancing::kRoundRobin};
+
     /// List of manually disabled replicas (FQDNs).
     std::unordered_set<std::string, USERVER_NAMESPACE::utils::StrIcaseHash, USERVER_NAMESPACE::utils::StrIcaseEqual>
         disabled_replicas{};
@@ -179,9 +194,13 @@ struct PoolSettings {
     /// Limits number of concurrent establishing connections (0 - unlimited)
     std::size_t connecting_limit{kDefaultConnectingLimit};
 
+    /// Number of idle connections the pool keeps ready for the new requests by
+    /// opening connections in background (0 - none)
+    std::size_t min_idle_size{0};
+
     bool operator==(const PoolSettings& rhs) const {
         return min_size == rhs.min_size && max_size == rhs.max_size && max_queue_size == rhs.max_queue_size &&
-               connecting_limit == rhs.connecting_limit;
+               connecting_limit == rhs.connecting_limit && min_idle_size == rhs.min_idle_size;
     }
 };
 
@@ -193,6 +212,14 @@ inline constexpr std::size_t kDefaultMaxPreparedCacheSize = 200;
 /// Dynamic option @ref POSTGRES_CONNECTION_PIPELINE_EXPERIMENT
 enum class PipelineMode { kDisabled, kEnabled };
 
+/// Whether to send the single statements of storages::postgres::Cluster::Execute
+/// from different coroutines together over a shared pipelined connection.
+/// Takes effect only if the pipeline mode and the prepared statements are
+/// enabled.
+///
+/// Dynamic option @ref POSTGRES_CONNECTION_SETTINGS
+enum class AutoPipelineMode { kDisabled, kEnabled };
+
 /// Whether to omit excessive D(escribe) message
 /// when executing prepared statements
 ///
@@ -249,11 +276,21 @@ struct ConnectionSettings {
     /// Execute discard all after establishing a new connection
     DiscardOnConnectOptions discard_on_connect = kDiscardAll;
 
+    /// Turns on multiplexing of the single statements onto a shared pipelined
+    /// connection
+    AutoPipelineMode auto_pipeline_mode = AutoPipelineMode::kDisabled;
+
+    /// This many statements prepared by the most connections of the pool are
+    /// prepared on a new connection before it is used, 0 disables the warmup
+    std::size_t prepared_statements_warmup = 0;
+
     /// Helps keep track of the changes in settings
     SettingsVersion version{0U};
 
     bool operator==(const ConnectionSettings& rhs) const {
-        return !RequiresConnectionReset(rhs) && recent_errors_threshold == rhs.recent_errors_threshold;
+        return !RequiresConnectionReset(rhs) && recent_errors_threshold == rhs.recent_errors_threshold &&
+               auto_pipeline_mode == rhs.auto_pipeline_mode &&
+               prepared_statements_warmup == rhs.prepared_statements_warmup;
     }
 
     bool operator!=(const ConnectionSettings& rhs) const { return !(*this == rhs); }
@@ -278,6 +315,18 @@ struct StatementMetricsSettings final {
     bool operator==(const StatementMetricsSettings& other) const { return max_statements == other.max_statements; }
 };
 
+/// @brief Settings of the result cache of a query
+///
+/// See storages::postgres::Cluster::SetQueryResultCache
+struct QueryResultCacheSettings final {
+    /// Time a result is served from the cache for
+    std::chrono::milliseconds ttl{1000};
+    /// Max number of the cached results of the query
+    std::size_t max_size{1000};
+    /// A notification on this channel drops all the cached results of the query
+    std::optional<std::string> invalidation_channel;
+};
+
 /// Initialization modes
 enum class InitMode {
     kSync = 0,
@@ -21,6 +21,17 @@ namespace storages::postgres {
 
 using PortalName = USERVER_NAMESPACE::utils::StrongTypedef<struct PortalNameTag, std::string>;
 
+/// @brief Chunk sizing for Portal::FetchPrefetched
+struct PortalPrefetchSettings {
+    /// Approximate size of a chunk of rows, the number of rows in the
+    /// following chunks is adjusted to the row size of the previous chunk
+    std::size_t chunk_bytes = 1024 * 1024;
+    /// Number of rows in the first chunk
+    std::uint32_t initial_chunk_rows = 1024;
+    /// Upper limit of the number of rows in a chunk
+    std::uint32_t max_chunk_rows = 100'000;
+};
+
 class Portal {
 public:
     Portal(
@@ -47,6 +58,16 @@ public:
 
     ResultSet Fetch(std::uint32_t n_rows);
 
+    /// @brief Fetches the next chunk of rows, requesting the following chunk
+    /// before returning the current one.
+    ///
+    /// The following chunk is transferred while the current one is processed,
+    /// at most one chunk is in flight. Until the portal is Done() or destroyed
+    /// the transaction can not be used for other statements and Fetch() can
+    /// not be mixed in. With the pipeline mode enabled the chunks are fetched
+    /// one by one without the prefetch.
+    ResultSet FetchPrefetched(const PortalPrefetchSettings& settings = {});
+
     bool Done() const;
     std::size_t FetchedSoFar() const;
 
@@ -57,7 +78,7 @@ public:
     static bool IsSupportedByDriver() noexcept;
 
 private:
-    static constexpr std::size_t kImplSize = 88;
+    static constexpr std::size_t kImplSize = 96;
     static constexpr std::size_t kImplAlign = 8;
 
     struct Impl;
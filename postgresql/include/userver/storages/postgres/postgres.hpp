@@ -46,7 +46,8 @@
 ///   in case of multiple unrelated select statements;
 /// - Mapping PostgreSQL user types to C++ types;
 /// - Transaction error injection via pytest_userver.sql.RegisteredTrx;
-/// - LISTEN/NOTIFY support via storages::postgres::Cluster::Listen();
+/// - LISTEN/NOTIFY support via storages::postgres::Cluster::Listen() and
+///   storages::postgres::Cluster::Subscribe();
 /// - @ref scripts/docs/en/userver/deadline_propagation.md .
 ///
 /// @section toc More information
@@ -692,6 +692,18 @@ public:
     template <typename Container>
     Container AsContainer(RowTag) const;
 
+    /// @brief Extract the result set column by column, the N-th container
+    /// receives the values of the N-th field of every row.
+    ///
+    /// Each column is parsed contiguously, which is friendlier to the cache
+    /// than row-wise extraction for wide results of trivial types.
+    /// `std::string_view` and `utils::span<const std::byte>` values point into
+    /// the result buffer and are valid only while the ResultSet is alive.
+    /// @throws InvalidTupleSizeRequested if there are more containers than
+    /// fields in the result set
+    template <typename... Containers>
+    std::tuple<Containers...> AsColumns() const;
+
     /// @brief Extract first row into user type.
     /// A single row result set is expected, will throw an exception when result
     /// set size != 1
@@ -718,6 +730,9 @@ private:
     void FillBufferCategories(const UserTypes& types);
     void SetBufferCategoriesFrom(const ResultSet&);
 
+    template <typename Container>
+    void ExtractColumn(size_type field_index, Container& column) const;
+
     template <typename T, typename Tag>
     friend class TypedResultSet;
     friend class ConnectionImpl;
@@ -987,6 +1002,41 @@ Container ResultSet::AsContainer(RowTag) const {
     return c;
 }
 
+template <typename... Containers>
+std::tuple<Containers...> ResultSet::AsColumns() const {
+    detail::AssertSaneTypeToDeserialize<Containers...>();
+    (detail::AssertRowTypeIsMappedToPgOrIsCompositeType<typename Containers::value_type>(), ...);
+    if (sizeof...(Containers) > FieldCount()) {
+        throw InvalidTupleSizeRequested(FieldCount(), sizeof...(Containers));
+    }
+
+    std::tuple<Containers...> columns;
+    std::apply(
+        [this](auto&... column) {
+            size_type field_index = 0;
+            (ExtractColumn(field_index++, column), ...);
+        },
+        columns
+    );
+    return columns;
+}
+
+template <typename Container>
+void ResultSet::ExtractColumn(size_type field_index, Container& column) const {
+    using ValueType = typename Container::value_type;
+    const auto size = Size();
+    if constexpr (io::traits::kCanReserve<Container>) {
+        column.reserve(size);
+    }
+
+    auto inserter = io::traits::Inserter(column);
+    for (size_type row_index = 0; row_index < size; ++row_index, ++inserter) {
+        ValueType value{};
+        FieldView{*pimpl_, row_index, field_index}.To(value);
+        *inserter = std::move(value);
+    }
+}
+
 template <typename T>
 auto ResultSet::AsSingleRow() const {
     return AsSingleRow<T>(kFieldTag);
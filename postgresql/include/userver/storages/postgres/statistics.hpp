@@ -87,9 +87,15 @@ struct ConnectionStatistics {
     Counter error_timeout = 0;
     /// Number of maximum allowed waiting requests
     Counter max_queue_size = 0;
+    /// Number of connections being established
+    Counter connecting = 0;
 
     /// Prepared statements count min-max-avg
     MmaAccumulator prepared_statements;
+    /// Number of prepared statements evicted from the connection caches
+    Counter prepared_statements_evicted = 0;
+    /// Number of prepared statements prepared on the new connections in advance
+    Counter prepared_statements_warmed_up = 0;
 };
 
 /// @brief Template instance topology statistics storage
@@ -166,7 +172,10 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
         connection.error_total = stats.connection.error_total;
         connection.error_timeout = stats.connection.error_timeout;
         connection.prepared_statements = stats.connection.prepared_statements.GetStatsForPeriod();
+        connection.prepared_statements_evicted = stats.connection.prepared_statements_evicted;
+        connection.prepared_statements_warmed_up = stats.connection.prepared_statements_warmed_up;
         connection.max_queue_size = stats.connection.max_queue_size;
+        connection.connecting = stats.connection.connecting;
 
         transaction.total = stats.transaction.total;
         transaction.commit_total = stats.transaction.commit_total;
@@ -218,6 +227,22 @@ struct InstanceStatsDescriptor {
     InstanceStatisticsNonatomic stats;
 };
 
+/// @brief Query result cache statistics
+struct QueryResultCacheStatistics {
+    /// Number of results served from the cache
+    std::size_t hits{0};
+    /// Number of results not found in the cache
+    std::size_t misses{0};
+    /// Number of results found in the cache, but expired
+    std::size_t stale{0};
+    /// Ratio of hits over the last minute
+    double hit_ratio{0};
+    /// Number of invalidations of the whole cache
+    std::size_t invalidations{0};
+    /// Number of cached results
+    std::size_t size{0};
+};
+
 /// @brief Cluster statistics storage
 struct ClusterStatistics {
     /// Connlimit mode auto is on
@@ -230,6 +255,8 @@ struct ClusterStatistics {
     std::vector<InstanceStatsDescriptor> slaves;
     /// Unknown/unreachable instances statistics
     std::vector<InstanceStatsDescriptor> unknown;
+    /// Query result caches statistics by query name
+    std::unordered_map<std::string, QueryResultCacheStatistics> query_result_caches;
 };
 
 // InstanceStatisticsNonatomic values support for utils::statistics::Writer
@@ -238,6 +265,10 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Inst
 /// @brief InstanceStatsDescriptor values support for utils::statistics::Writer
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const InstanceStatsDescriptor& value);
 
+/// @brief QueryResultCacheStatistics values support for
+/// utils::statistics::Writer
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const QueryResultCacheStatistics& value);
+
 /// @brief ClusterStatistics values support for utils::statistics::Writer
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const ClusterStatistics& value);
 
@@ -5,8 +5,11 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/detail/copy_binary.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/options.hpp>
@@ -15,6 +18,7 @@
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/storages/postgres/query.hpp>
 #include <userver/storages/postgres/result_set.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -146,6 +150,7 @@ public:
     //@}
 
     static constexpr std::size_t kDefaultRowsInChunk = 1024;
+    static constexpr std::size_t kCopyChunkBytes = 64 * 1024;
 
     /// @cond
     explicit Transaction(
@@ -293,6 +298,67 @@ public:
     /// and per-statement command control.
     Portal MakePortal(OptionalCommandControl statement_cmd_ctl, const Query& query, const ParameterStore& store);
 
+    /// Load rows into a table with `COPY ... FROM STDIN` in the binary format.
+    ///
+    /// Much faster than INSERTs for large amounts of data. The rows are
+    /// serialized with the same io formatters as the query parameters and are
+    /// sent in chunks while being serialized.
+    ///
+    /// `Container::value_type` is either a row type (a tuple, an aggregate or a
+    /// type with an Introspect method) with a field per each of the `columns`
+    /// in the same order, or a single column type. The C++ types must match
+    /// the column types exactly, as COPY does no type conversions.
+    ///
+    /// `table` may be qualified with a schema name, `table` and `columns` are
+    /// escaped as identifiers. Empty `columns` mean all the columns of
+    /// the table.
+    ///
+    /// The network timeout applies to the whole COPY, set it accordingly.
+    ///
+    /// Suspends coroutine for execution.
+    /// @returns the number of loaded rows
+    ///
+    /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyIn
+    template <typename Container>
+    std::size_t CopyIn(std::string_view table, const std::vector<std::string>& columns, const Container& rows) {
+        return CopyIn(OptionalCommandControl{}, table, columns, rows);
+    }
+
+    /// Load rows into a table with `COPY ... FROM STDIN` in the binary format
+    /// with per-statement command control, see the overload above.
+    template <typename Container>
+    std::size_t CopyIn(
+        OptionalCommandControl statement_cmd_ctl,
+        std::string_view table,
+        const std::vector<std::string>& columns,
+        const Container& rows
+    );
+
+    /// Stream the results of a query with `COPY (query) TO STDOUT` in
+    /// the binary format.
+    ///
+    /// `consumer` is called with each row as `Row&&` while the rows are being
+    /// received, so the memory usage does not depend on the number of rows.
+    /// `Row` is either a row type or a single column type, like for
+    /// storages::postgres::ResultSet::AsContainer.
+    ///
+    /// The query can not have parameters. The network timeout applies to
+    /// the whole COPY, set it accordingly.
+    ///
+    /// Suspends coroutine for execution.
+    ///
+    /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyOut
+    template <typename Row, typename Consumer>
+    void CopyOut(const Query& query, Consumer&& consumer) {
+        CopyOut<Row>(OptionalCommandControl{}, query, std::forward<Consumer>(consumer));
+    }
+
+    /// Stream the results of a query with `COPY (query) TO STDOUT` in
+    /// the binary format with per-statement command control, see the overload
+    /// above.
+    template <typename Row, typename Consumer>
+    void CopyOut(OptionalCommandControl statement_cmd_ctl, const Query& query, Consumer&& consumer);
+
     /// Set a connection parameter
     /// https://www.postgresql.org/docs/current/sql-set.html
     /// The parameter is set for this transaction only
@@ -324,6 +390,18 @@ private:
         OptionalCommandControl statement_cmd_ctl
     );
 
+    std::size_t DoCopyIn(
+        std::string_view table,
+        const std::vector<std::string>& columns,
+        USERVER_NAMESPACE::utils::function_ref<bool(std::string&)> source,
+        OptionalCommandControl statement_cmd_ctl
+    );
+    void DoCopyOut(
+        const Query& query,
+        USERVER_NAMESPACE::utils::function_ref<void(std::string_view)> sink,
+        OptionalCommandControl statement_cmd_ctl
+    );
+
     const UserTypes& GetConnectionUserTypes() const;
 
     std::string name_;
@@ -370,6 +448,51 @@ void Transaction::ExecuteDecomposeBulk(
     });
 }
 
+template <typename Container>
+std::size_t Transaction::CopyIn(
+    OptionalCommandControl statement_cmd_ctl,
+    std::string_view table,
+    const std::vector<std::string>& columns,
+    const Container& rows
+) {
+    const auto& types = GetConnectionUserTypes();
+    auto it = std::begin(rows);
+    const auto end = std::end(rows);
+    bool header_written = false;
+    const auto source = [&](std::string& buffer) {
+        if (!header_written) {
+            detail::WriteCopyBinaryHeader(buffer);
+            header_written = true;
+        }
+        for (; it != end && buffer.size() < kCopyChunkBytes; ++it) {
+            detail::WriteCopyBinaryRow(types, buffer, *it);
+        }
+        if (it != end) return true;
+
+        detail::WriteCopyBinaryTrailer(buffer);
+        return false;
+    };
+    return DoCopyIn(table, columns, source, std::move(statement_cmd_ctl));
+}
+
+template <typename Row, typename Consumer>
+void Transaction::CopyOut(OptionalCommandControl statement_cmd_ctl, const Query& query, Consumer&& consumer) {
+    const auto& types = GetConnectionUserTypes();
+    bool header_read = false;
+    const auto sink = [&](std::string_view data) {
+        // The header comes along with the first row or the trailer
+        if (!header_read) {
+            data = detail::SkipCopyBinaryHeader(data);
+            header_read = true;
+        }
+        Row row{};
+        if (detail::ReadCopyBinaryRow(types, data, row)) {
+            consumer(std::move(row));
+        }
+    };
+    DoCopyOut(query, sink, std::move(statement_cmd_ctl));
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -28,6 +28,11 @@ properties:
         type: integer
         description: number of rows to request from PostgreSQL, 0 to fetch all rows in one request
         defaultDescription: 1000
+    full-update-parallelism:
+        type: integer
+        description: number of partitions that a full update is split into, each fetched and parsed concurrently
+        defaultDescription: 1
+        minimum: 1
     pgcomponent:
         type: string
         description: PostgreSQL component name
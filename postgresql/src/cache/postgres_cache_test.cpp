@@ -71,6 +71,12 @@ struct PostgresExamplePolicy {
     // Required: no
     static constexpr const char* kWhere = "id > 10";
 
+    // Integer expression by which a full update is split into
+    // `full-update-parallelism` partitions that are fetched concurrently.
+    //
+    // Required: only if `full-update-parallelism` is above 1
+    static constexpr const char* kPartitionField = "id";
+
     // Cache container type.
     //
     // It can be of any map type. The default is `unordered_map`, it is not
@@ -60,6 +60,16 @@ NotifyScope Cluster::Listen(std::string_view channel, OptionalCommandControl cmd
     return pimpl_->Listen(channel, cmd_ctl);
 }
 
+NotifySubscription Cluster::Subscribe(std::string_view channel, OptionalCommandControl cmd_ctl) {
+    return pimpl_->Subscribe(channel, cmd_ctl);
+}
+
+void Cluster::SetQueryResultCache(const std::string& query_name, QueryResultCacheSettings settings) {
+    pimpl_->SetQueryResultCache(query_name, settings);
+}
+
+void Cluster::ResetQueryResultCache(const std::string& query_name) { pimpl_->ResetQueryResultCache(query_name); }
+
 QueryQueue Cluster::CreateQueryQueue(ClusterHostTypeFlags flags) {
     return CreateQueryQueue(flags, pimpl_->GetDefaultCommandControl().execute);
 }
@@ -124,8 +134,20 @@ ResultSet Cluster::Execute(
         statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
     }
     statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
-    auto ntrx = Start(flags, statement_cmd_ctl);
-    return ntrx.Execute(statement_cmd_ctl, query.Statement(), store);
+    const auto execute = [&] {
+        auto ntrx = Start(flags, statement_cmd_ctl);
+        return ntrx.Execute(statement_cmd_ctl, query.Statement(), store);
+    };
+    if (query.GetName()) {
+        if (auto cache = pimpl_->FindQueryResultCache(query.GetName()->GetUnderlying())) {
+            return cache->Get(query, store.GetInternalData(), execute);
+        }
+    }
+    return execute();
+}
+
+bool Cluster::HasQueryResultCache(const Query& query) const {
+    return query.GetName() && pimpl_->FindQueryResultCache(query.GetName()->GetUnderlying());
 }
 
 }  // namespace storages::postgres
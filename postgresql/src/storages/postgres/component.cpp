@@ -231,6 +231,10 @@ properties:
         type: integer
         description: limit of connections count
         defaultDescription: 15
+    min_idle_pool_size:
+        type: integer
+        description: number of idle connections kept ready by opening new ones in background
+        defaultDescription: 0
     sync-start:
         type: boolean
         description: perform initial connections synchronously
@@ -268,6 +272,20 @@ properties:
         type: boolean
         description: execute discard all on new connections
         defaultDescription: true
+    auto-pipelining:
+        type: boolean
+        description: |
+            send the single statements of Cluster::Execute from different
+            coroutines together over a shared pipelined connection, requires
+            pipeline_enabled
+        defaultDescription: false
+    prepared-statements-warmup:
+        type: integer
+        minimum: 0
+        description: |
+            number of the statements prepared by the most connections of the
+            pool to prepare on a new connection before using it
+        defaultDescription: 0
     monitoring-dbalias:
         type: string
         description: name of the database for monitorings
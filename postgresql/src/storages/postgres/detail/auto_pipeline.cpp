@@ -0,0 +1,235 @@
+#include <storages/postgres/detail/auto_pipeline.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <optional>
+#include <variant>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/pool.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Bounds the latency of a batch and the amount of data sent at once
+constexpr std::size_t kMaxBatchSize = 128;
+
+constexpr std::string_view kBatchSpanName = "pg_auto_pipeline";
+constexpr std::string_view kBatchSizeTag = "batch_size";
+
+CommandControl GetCommandControl(const Connection& conn, const OptionalCommandControl& cmd_ctl, const Query& query) {
+    if (cmd_ctl) return *cmd_ctl;
+    return conn.GetQueryCmdCtl(query.GetName()).value_or(conn.GetDefaultCommandControl());
+}
+
+CommandControl LimitByDeadline(CommandControl cmd_ctl, engine::Deadline deadline) {
+    if (!deadline.IsReachable()) return cmd_ctl;
+    const auto time_left = std::chrono::duration_cast<TimeoutDuration>(deadline.TimeLeft());
+    return cmd_ctl.WithExecuteTimeout(std::min(cmd_ctl.execute, time_left));
+}
+
+}  // namespace
+
+AutoPipeline::AutoPipeline(ConnectionPool& pool) : pool_{pool} {}
+
+ResultSet AutoPipeline::Execute(
+    const Query& query,
+    QueryParametersWriter params_writer,
+    OptionalCommandControl statement_cmd_ctl,
+    engine::Deadline deadline
+) {
+    Request request{query, params_writer, std::move(statement_cmd_ctl), deadline};
+    {
+        auto queue = queue_.Lock();
+        queue->push_back(&request);
+    }
+
+    if (!batch_mutex_.try_lock_until(deadline)) {
+        {
+            auto queue = queue_.Lock();
+            const auto it = std::find(queue->begin(), queue->end(), &request);
+            if (it != queue->end()) {
+                queue->erase(it);
+                if (engine::current_task::ShouldCancel()) {
+                    throw PoolError("Task was cancelled while waiting for the pipelined connection");
+                }
+                throw PoolError("Deadline reached while waiting for the pipelined connection");
+            }
+        }
+        // The request was taken into a batch by another task, which references
+        // the request until the results are received. The statement is skipped
+        // if it was not sent yet.
+        request.abandoned = true;
+        batch_mutex_.lock();
+    }
+    const std::unique_lock lock{batch_mutex_, std::adopt_lock};
+
+    if (!request.IsDone()) {
+        // The batch carries the statements of other tasks, they must not be
+        // interrupted by the cancellation of the current one
+        const engine::TaskCancellationBlocker cancel_blocker;
+        RunBatch(request);
+    }
+    UASSERT(request.IsDone());
+
+    if (request.error) std::rethrow_exception(request.error);
+    return std::move(*request.result);
+}
+
+bool AutoPipeline::Request::SetErrorIfAbandoned() {
+    // The leader runs the batch with the cancellation blocked
+    if (is_leader && engine::current_task::IsCancelRequested()) abandoned = true;
+
+    if (!abandoned && !deadline.IsReached()) return false;
+    error = std::make_exception_ptr(
+        PoolError("Task was cancelled or its deadline was reached before the pipelined statement was sent")
+    );
+    return true;
+}
+
+void AutoPipeline::RunBatch(Request& own_request) {
+    own_request.is_leader = true;
+    auto batch = TakeBatch(own_request);
+
+    // The connection is needed for as long as any of the statements waits
+    auto deadline = own_request.deadline;
+    for (const auto* request : batch) deadline = std::max(deadline, request->deadline);
+
+    std::optional<ConnectionPtr> conn;
+    try {
+        conn.emplace(pool_.Acquire(deadline));
+    } catch (const std::exception&) {
+        for (auto* request : batch) request->error = std::current_exception();
+        return;
+    }
+
+    const USERVER_NAMESPACE::utils::ScopeGuard unfinished_guard{[&batch] {
+        for (auto* request : batch) {
+            if (!request->IsDone()) {
+                request->error = std::make_exception_ptr(RuntimeError{"Pipelined statement was not executed"});
+            }
+        }
+    }};
+
+    auto& connection = **conn;
+    connection.Start(SteadyClock::now());
+    const USERVER_NAMESPACE::utils::ScopeGuard finish_guard{[&connection] { connection.Finish(); }};
+
+    if (batch.size() == 1 || !connection.IsPipelineActive() || !connection.ArePreparedStatementsEnabled()) {
+        ExecuteOneByOne(connection, batch);
+    } else {
+        ExecutePipelined(connection, batch);
+    }
+}
+
+std::vector<AutoPipeline::Request*> AutoPipeline::TakeBatch(Request& own_request) {
+    auto queue = queue_.Lock();
+    const auto own_it = std::find(queue->begin(), queue->end(), &own_request);
+    UASSERT(own_it != queue->end());
+    queue->erase(own_it);
+
+    const auto count = std::min(queue->size(), kMaxBatchSize - 1);
+    std::vector<Request*> batch;
+    batch.reserve(count + 1);
+    batch.push_back(&own_request);
+    batch.insert(batch.end(), queue->begin(), queue->begin() + count);
+    queue->erase(queue->begin(), queue->begin() + count);
+    return batch;
+}
+
+void AutoPipeline::ExecuteOneByOne(Connection& conn, const std::vector<Request*>& batch) {
+    for (auto* request : batch) {
+        if (request->SetErrorIfAbandoned()) continue;
+        try {
+            const auto cmd_ctl =
+                LimitByDeadline(GetCommandControl(conn, request->cmd_ctl, request->query), request->deadline);
+            request->params = request->params_writer(conn.GetUserTypes());
+            request->result.emplace(conn.Execute(request->query, request->params, OptionalCommandControl{cmd_ctl}));
+        } catch (const std::exception&) {
+            request->error = std::current_exception();
+        }
+    }
+}
+
+void AutoPipeline::ExecutePipelined(Connection& conn, const std::vector<Request*>& batch) {
+    tracing::Span span{std::string{kBatchSpanName}};
+    span.AddTag(std::string{kBatchSizeTag}, batch.size());
+    auto scope = span.CreateScopeTime();
+
+    struct PreparedRequest final {
+        Request& request;
+        CommandControl cmd_ctl;
+        Connection::PreparedStatementMeta meta;
+    };
+
+    // Preparing waits for the server response, so it is done before anything
+    // is put into the pipeline
+    std::vector<PreparedRequest> prepared;
+    prepared.reserve(batch.size());
+    for (auto* request : batch) {
+        if (request->SetErrorIfAbandoned()) continue;
+        try {
+            const auto cmd_ctl =
+                LimitByDeadline(GetCommandControl(conn, request->cmd_ctl, request->query), request->deadline);
+            request->params = request->params_writer(conn.GetUserTypes());
+            auto meta = conn.PrepareStatement(request->query, request->params, cmd_ctl.execute);
+            prepared.push_back({*request, cmd_ctl, std::move(meta)});
+        } catch (const std::exception&) {
+            request->error = std::current_exception();
+        }
+    }
+
+    std::vector<Request*> sent;
+    std::vector<ResultSet> descriptions;
+    sent.reserve(prepared.size());
+    descriptions.reserve(prepared.size());
+    TimeoutDuration timeout{0};
+    for (auto& [request, cmd_ctl, meta] : prepared) {
+        if (request.SetErrorIfAbandoned()) continue;
+        try {
+            conn.AddIntoPipeline(cmd_ctl, meta.statement_name, request.params, meta.description, scope);
+        } catch (const std::exception&) {
+            request.error = std::current_exception();
+            continue;
+        }
+        sent.push_back(&request);
+        descriptions.push_back(std::move(meta.description));
+        timeout = std::max(timeout, cmd_ctl.execute);
+    }
+    if (sent.empty()) return;
+
+    std::vector<PipelineResult> results;
+    try {
+        results = conn.GatherIsolatedPipeline(timeout, descriptions);
+    } catch (const std::exception&) {
+        span.AddTag(tracing::kErrorFlag, true);
+        for (auto* request : sent) {
+            request->error = std::current_exception();
+        }
+        return;
+    }
+
+    for (std::size_t i = 0; i < sent.size(); ++i) {
+        if (i >= results.size()) {
+            sent[i]->error = std::make_exception_ptr(RuntimeError{"No result for a pipelined statement"});
+        } else if (auto* result = std::get_if<ResultSet>(&results[i])) {
+            sent[i]->result.emplace(std::move(*result));
+        } else {
+            sent[i]->error = std::get<std::exception_ptr>(results[i]);
+        }
+    }
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
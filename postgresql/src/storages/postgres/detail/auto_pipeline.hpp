@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <optional>
+#include <vector>
+
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+
+#include <userver/storages/postgres/detail/non_transaction.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+class Connection;
+class ConnectionPool;
+
+/// @brief Multiplexes the single statements of different coroutines onto
+/// a shared pipelined connection.
+///
+/// The statements are queued and the first of the waiting coroutines that gets
+/// hold of the connection sends all the queued statements as a single batch.
+/// While the batch is in flight, the next one is queued. Each statement is
+/// followed by a sync, so the statements run in separate implicit transactions
+/// and an error of a statement does not affect the others.
+///
+/// The batch is not interrupted by the cancellation of the task that sends it,
+/// instead each statement is skipped if its own task was cancelled or its
+/// deadline was reached before the statement was sent.
+class AutoPipeline final {
+public:
+    explicit AutoPipeline(ConnectionPool& pool);
+
+    ResultSet Execute(
+        const Query& query,
+        QueryParametersWriter params_writer,
+        OptionalCommandControl statement_cmd_ctl,
+        engine::Deadline deadline
+    );
+
+private:
+    struct Request final {
+        const Query& query;
+        QueryParametersWriter params_writer;
+        OptionalCommandControl cmd_ctl;
+        engine::Deadline deadline;
+        QueryParameters params{};
+        std::optional<ResultSet> result{};
+        std::exception_ptr error{};
+        // Set by the task that gave up waiting for the batch
+        std::atomic<bool> abandoned{false};
+        bool is_leader{false};
+
+        bool IsDone() const { return result.has_value() || error; }
+
+        // Sets the error if the statement should not be sent anymore
+        bool SetErrorIfAbandoned();
+    };
+
+    void RunBatch(Request& own_request);
+    std::vector<Request*> TakeBatch(Request& own_request);
+
+    static void ExecuteOneByOne(Connection& conn, const std::vector<Request*>& batch);
+    static void ExecutePipelined(Connection& conn, const std::vector<Request*>& batch);
+
+    ConnectionPool& pool_;
+    // Held by the task that sends a batch and receives its results
+    engine::Mutex batch_mutex_;
+    concurrent::Variable<std::vector<Request*>> queue_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
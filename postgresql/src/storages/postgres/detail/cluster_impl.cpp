@@ -15,6 +15,7 @@
 #include <userver/storages/postgres/exceptions.hpp>
 #include <userver/testsuite/testpoint.hpp>
 #include <userver/utils/impl/userver_experiments.hpp>
+#include <userver/utils/rand.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -64,6 +65,38 @@ size_t SelectDsnIndex(
     return indices[idx_pos];
 }
 
+double GetHostLoad(const ConnectionPool& pool, std::chrono::milliseconds replication_lag) {
+    // Hosts without measurements yet are considered fast to let them get some
+    const auto latency = std::max(pool.GetQueryLatencyEwma(), std::chrono::microseconds{1});
+    // Each second of the replication lag doubles the load
+    const auto lag_factor = 1.0 + std::chrono::duration<double>(replication_lag).count();
+    return static_cast<double>(latency.count()) * static_cast<double>(pool.GetUsedConnectionsCount() + 1) * lag_factor;
+}
+
+// Power of two choices: the less loaded of two random hosts
+size_t SelectLeastLoadedDsnIndex(
+    const topology::TopologyBase::DsnIndices& indices,
+    const std::vector<std::shared_ptr<ConnectionPool>>& host_pools,
+    const topology::TopologyBase& topology
+) {
+    UASSERT(!indices.empty());
+    if (indices.empty()) {
+        throw ClusterError("Cannot select host from an empty list");
+    }
+    if (indices.size() == 1) return indices.front();
+
+    const auto first_pos = USERVER_NAMESPACE::utils::RandRange(indices.size());
+    auto second_pos = USERVER_NAMESPACE::utils::RandRange(indices.size() - 1);
+    if (second_pos >= first_pos) ++second_pos;
+
+    const auto first = indices[first_pos];
+    const auto second = indices[second_pos];
+    UASSERT(first < host_pools.size() && second < host_pools.size());
+    const auto first_load = GetHostLoad(*host_pools[first], topology.GetReplicationLag(first));
+    const auto second_load = GetHostLoad(*host_pools[second], topology.GetReplicationLag(second));
+    return first_load <= second_load ? first : second;
+}
+
 }  // namespace
 
 ClusterImpl::ClusterImpl(
@@ -86,7 +119,10 @@ ClusterImpl::ClusterImpl(
       testsuite_pg_ctl_(testsuite_pg_ctl),
       ei_settings_(ei_settings),
       rr_host_idx_(0),
-      connlimit_watchdog_(*this, testsuite_tasks, shard_number, [this]() { OnConnlimitChanged(); }) {
+      connlimit_watchdog_(*this, testsuite_tasks, shard_number, [this]() { OnConnlimitChanged(); }),
+      notify_dispatcher_(std::make_shared<NotifyDispatcher>(bg_task_processor, [this] {
+          return FindPool(ClusterHostType::kMaster);
+      })) {
     CreateTopology(dsns);
 
     // Do not use IsConnlimitModeAuto() here because we don't care about
@@ -169,7 +205,15 @@ void ClusterImpl::CreateTopology(const DsnList& dsns) {
     *existing_td = std::move(data);
 }
 
-ClusterImpl::~ClusterImpl() { connlimit_watchdog_.Stop(); }
+ClusterImpl::~ClusterImpl() {
+    const auto caches = query_result_caches_.Read();
+    for (const auto& [_, cache] : *caches) {
+        cache->StopInvalidationListener();
+    }
+    // Subscriptions may outlive the cluster, but the listener must not
+    notify_dispatcher_->Stop();
+    connlimit_watchdog_.Stop();
+}
 
 ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     auto cluster_stats = std::make_unique<ClusterStatistics>();
@@ -241,6 +285,11 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
         cluster_stats->unknown.push_back(std::move(desc));
     }
 
+    const auto caches = query_result_caches_.Read();
+    for (const auto& [query_name, cache] : *caches) {
+        cluster_stats->query_result_caches.emplace(query_name, cache->GetStatistics());
+    }
+
     return cluster_stats;
 }
 
@@ -260,13 +309,20 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(ClusterHostTypeFlags flags)
     auto& topology = td->topology;
     auto& host_pools = td->host_pools;
 
+    const bool least_loaded = !(flags & kClusterHostStrategyMask) && (role_flags & ClusterHostType::kSlave) &&
+                              topology->GetTopologySettings().replica_balancing == ReplicaBalancing::kLeastLoaded;
+    const auto select_dsn_index = [&](const topology::TopologyBase::DsnIndices& indices) {
+        return least_loaded ? SelectLeastLoadedDsnIndex(indices, host_pools, *topology)
+                            : SelectDsnIndex(indices, flags, rr_host_idx_);
+    };
+
     if ((role_flags & ClusterHostType::kMaster) && (role_flags & ClusterHostType::kSlave)) {
         LOG_TRACE() << "Starting transaction on " << role_flags;
         auto alive_dsn_indices = topology->GetAliveDsnIndices();
         if (alive_dsn_indices->empty()) {
             throw ClusterUnavailable("None of cluster hosts are available");
         }
-        dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_);
+        dsn_index = select_dsn_index(*alive_dsn_indices);
     } else {
         auto host_role = static_cast<ClusterHostType>(role_flags.GetValue());
         auto dsn_indices_by_type = topology->GetDsnIndicesByType();
@@ -285,7 +341,7 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(ClusterHostTypeFlags flags)
             );
         }
         LOG_TRACE() << "Starting transaction on " << host_role;
-        dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_);
+        dsn_index = select_dsn_index(dsn_indices_it->second);
     }
 
     UASSERT(dsn_index < host_pools.size());
@@ -321,6 +377,41 @@ NotifyScope ClusterImpl::Listen(std::string_view channel, OptionalCommandControl
     return FindPool(ClusterHostType::kMaster)->Listen(channel, cmd_ctl);
 }
 
+NotifySubscription ClusterImpl::Subscribe(std::string_view channel, OptionalCommandControl cmd_ctl) {
+    const auto timeout = cmd_ctl ? cmd_ctl->execute : GetDefaultCommandControl().execute;
+    return NotifySubscription{notify_dispatcher_, channel, testsuite_pg_ctl_.MakeExecuteDeadline(timeout)};
+}
+
+void ClusterImpl::SetQueryResultCache(const std::string& query_name, const QueryResultCacheSettings& settings) {
+    auto cache = std::make_shared<QueryResultCache>(settings);
+    if (settings.invalidation_channel) {
+        cache->StartInvalidationListener(bg_task_processor_, [this, channel = *settings.invalidation_channel] {
+            return Subscribe(channel, {});
+        });
+    }
+
+    auto caches = query_result_caches_.StartWrite();
+    auto& entry = (*caches)[query_name];
+    if (entry) entry->StopInvalidationListener();
+    entry = std::move(cache);
+    caches.Commit();
+}
+
+void ClusterImpl::ResetQueryResultCache(const std::string& query_name) {
+    auto caches = query_result_caches_.StartWrite();
+    const auto it = caches->find(query_name);
+    if (it == caches->end()) return;
+    it->second->StopInvalidationListener();
+    caches->erase(it);
+    caches.Commit();
+}
+
+std::shared_ptr<QueryResultCache> ClusterImpl::FindQueryResultCache(const std::string& query_name) const {
+    const auto caches = query_result_caches_.Read();
+    const auto it = caches->find(query_name);
+    return it == caches->end() ? nullptr : it->second;
+}
+
 QueryQueue ClusterImpl::CreateQueryQueue(ClusterHostTypeFlags flags, TimeoutDuration acquire_timeout) {
     return QueryQueue{
         GetDefaultCommandControl(), FindPool(flags)->Acquire(engine::Deadline::FromDuration(acquire_timeout))};
@@ -12,8 +12,10 @@
 #include <userver/testsuite/tasks.hpp>
 
 #include <storages/postgres/connlimit_watchdog.hpp>
+#include <storages/postgres/detail/notify_dispatcher.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
 #include <storages/postgres/detail/pool.hpp>
+#include <storages/postgres/detail/query_result_cache.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
 #include <storages/postgres/detail/topology/base.hpp>
 #include <userver/storages/postgres/cluster_types.hpp>
@@ -53,6 +55,12 @@ public:
 
     NotifyScope Listen(std::string_view channel, OptionalCommandControl);
 
+    NotifySubscription Subscribe(std::string_view channel, OptionalCommandControl);
+
+    void SetQueryResultCache(const std::string& query_name, const QueryResultCacheSettings& settings);
+    void ResetQueryResultCache(const std::string& query_name);
+    std::shared_ptr<QueryResultCache> FindQueryResultCache(const std::string& query_name) const;
+
     QueryQueue CreateQueryQueue(ClusterHostTypeFlags flags, TimeoutDuration acquire_timeout);
 
     void SetDefaultCommandControl(CommandControl, DefaultCommandControlSource);
@@ -106,6 +114,8 @@ private:
     std::atomic<uint32_t> rr_host_idx_;
     std::atomic<bool> connlimit_mode_auto_enabled_;
     ConnlimitWatchdog connlimit_watchdog_;
+    std::shared_ptr<NotifyDispatcher> notify_dispatcher_;
+    rcu::Variable<std::unordered_map<std::string, std::shared_ptr<QueryResultCache>>> query_result_caches_;
 };
 
 }  // namespace storages::postgres::detail
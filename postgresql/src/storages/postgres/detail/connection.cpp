@@ -91,6 +91,8 @@ void Connection::UpdateDefaultCommandControl() { pimpl_->UpdateDefaultCommandCon
 
 Connection::Statistics Connection::GetStatsAndReset() { return pimpl_->GetStatsAndReset(); }
 
+std::vector<PreparedStatementSample> Connection::TakeNewlyPrepared() { return pimpl_->TakeNewlyPrepared(); }
+
 void Connection::Begin(
     const TransactionOptions& options,
     SteadyClock::time_point trx_start_time,
@@ -136,6 +138,11 @@ std::vector<ResultSet> Connection::GatherPipeline(TimeoutDuration timeout, const
     return pimpl_->GatherPipeline(timeout, descriptions);
 }
 
+std::vector<PipelineResult>
+Connection::GatherIsolatedPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
+    return pimpl_->GatherIsolatedPipeline(timeout, descriptions);
+}
+
 ResultSet Connection::Execute(const Query& query, const ParameterStore& store) {
     return Execute(query, detail::QueryParameters{store.GetInternalData()});
 }
@@ -162,6 +169,32 @@ ResultSet Connection::PortalExecute(
     return pimpl_->PortalExecute(statement_id, portal_name, n_rows, std::move(statement_cmd_ctl));
 }
 
+void Connection::PortalSendExecute(
+    StatementId statement_id,
+    const std::string& portal_name,
+    std::uint32_t n_rows,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    pimpl_->PortalSendExecute(statement_id, portal_name, n_rows, std::move(statement_cmd_ctl));
+}
+
+ResultSet Connection::PortalWaitExecute(StatementId statement_id, OptionalCommandControl statement_cmd_ctl) {
+    return pimpl_->PortalWaitExecute(statement_id, std::move(statement_cmd_ctl));
+}
+
+std::size_t Connection::CopyIn(
+    std::string_view table,
+    const std::vector<std::string>& columns,
+    CopyInDataSource source,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    return pimpl_->CopyIn(table, columns, source, std::move(statement_cmd_ctl));
+}
+
+void Connection::CopyOut(const Query& query, CopyOutDataSink sink, OptionalCommandControl statement_cmd_ctl) {
+    pimpl_->CopyOut(query, sink, std::move(statement_cmd_ctl));
+}
+
 void Connection::CancelAndCleanup(TimeoutDuration timeout) { pimpl_->CancelAndCleanup(timeout); }
 
 bool Connection::Cleanup(TimeoutDuration timeout) { return pimpl_->Cleanup(timeout); }
@@ -2,7 +2,11 @@
 
 #include <atomic>
 #include <chrono>
+#include <exception>
 #include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -10,6 +14,7 @@
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/error_injection/settings.hpp>
 #include <userver/testsuite/postgres_control.hpp>
+#include <userver/utils/function_ref.hpp>
 #include <userver/utils/statistics/min_max_avg.hpp>
 #include <userver/utils/strong_typedef.hpp>
 
@@ -40,6 +45,18 @@ namespace detail {
 
 class ConnectionImpl;
 
+/// Result of a statement of a pipeline, where an error of a statement does not
+/// affect the other statements
+using PipelineResult = std::variant<ResultSet, std::exception_ptr>;
+
+/// Statement prepared by a connection, allows preparing the same statement on
+/// the other connections of the pool
+struct PreparedStatementSample final {
+    std::size_t id{0};
+    std::string statement;
+    std::vector<Oid> param_types;
+};
+
 /// @brief PostreSQL connection class
 /// Handles connecting to Postgres, sending commands, processing command results
 /// and closing Postgres connection.
@@ -91,6 +108,8 @@ public:
         /// Number of duplicate prepared statements errors,
         /// probably caused by timeout while preparing
         Counter duplicate_prepared_statements{0};
+        /// Number of prepared statements evicted from the cache
+        Counter prepared_statements_evicted{0};
 
         /// Current number of prepared statements
         CurrentValue prepared_statements_current{0};
@@ -184,6 +203,11 @@ public:
     /// @note May only be called when connection is not in transaction
     Statistics GetStatsAndReset();
 
+    /// Get the statements prepared since the previous call, they are collected
+    /// only if ConnectionSettings::prepared_statements_warmup is set
+    /// @note May only be called when connection is not in transaction
+    std::vector<PreparedStatementSample> TakeNewlyPrepared();
+
     //@{
     /// Begin a transaction in Postgres with specific start time point
     /// Suspends coroutine for execution
@@ -230,6 +254,11 @@ public:
 
     std::vector<ResultSet> GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
 
+    /// Like GatherPipeline, but the errors are returned for each of the
+    /// statements instead of being thrown
+    std::vector<PipelineResult>
+    GatherIsolatedPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+
     template <typename... T>
     ResultSet Execute(const Query& query, const T&... args) {
         detail::StaticQueryParameters<sizeof...(args)> params;
@@ -255,6 +284,29 @@ public:
         OptionalCommandControl
     );
     ResultSet PortalExecute(StatementId, const std::string& portal_name, std::uint32_t n_rows, OptionalCommandControl);
+    /// Sends the portal execution request without waiting for the result, the
+    /// connection can not be used until PortalWaitExecute() is called
+    void PortalSendExecute(StatementId, const std::string& portal_name, std::uint32_t n_rows, OptionalCommandControl);
+    /// Receives the result of a PortalSendExecute() request
+    ResultSet PortalWaitExecute(StatementId, OptionalCommandControl);
+
+    /// Appends the next chunk of `COPY` data to the empty buffer, returns false
+    /// when there is no more data
+    using CopyInDataSource = USERVER_NAMESPACE::utils::function_ref<bool(std::string& buffer)>;
+    /// Consumes a single row of `COPY` data
+    using CopyOutDataSink = USERVER_NAMESPACE::utils::function_ref<void(std::string_view data)>;
+
+    /// Runs `COPY table (columns) FROM STDIN` in binary format,
+    /// returns the number of copied rows
+    std::size_t CopyIn(
+        std::string_view table,
+        const std::vector<std::string>& columns,
+        CopyInDataSource source,
+        OptionalCommandControl statement_cmd_ctl
+    );
+
+    /// Runs `COPY (query) TO STDOUT` in binary format
+    void CopyOut(const Query& query, CopyOutDataSink sink, OptionalCommandControl statement_cmd_ctl);
 
     /// Send cancel to the database backend
     /// Try to return connection to idle state discarding all results.
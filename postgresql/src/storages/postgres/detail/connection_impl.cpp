@@ -39,6 +39,7 @@ constexpr std::string_view kStatementTimeoutParameter = "statement_timeout";
 constexpr std::string_view kStatementVacuum = "vacuum";
 constexpr std::string_view kStatementListen = "listen {}";
 constexpr std::string_view kStatementUnlisten = "unlisten {}";
+constexpr std::string_view kStatementCopyOut = "COPY ({}) TO STDOUT (FORMAT binary)";
 
 const Query kSetConfigQuery{fmt::format("SELECT set_config($1, $2, $3) as {}", kSetConfigQueryResultName)};
 
@@ -360,6 +361,11 @@ Connection::Statistics ConnectionImpl::GetStatsAndReset() {
     return std::exchange(stats_, Connection::Statistics{});
 }
 
+std::vector<PreparedStatementSample> ConnectionImpl::TakeNewlyPrepared() {
+    UASSERT_MSG(!IsInTransaction(), "TakeNewlyPrepared should be called outside of transaction");
+    return std::exchange(newly_prepared_, {});
+}
+
 ResultSet ConnectionImpl::ExecuteCommand(
     const Query& query,
     const QueryParameters& params,
@@ -513,6 +519,158 @@ ResultSet ConnectionImpl::PortalExecute(
     );
 }
 
+void ConnectionImpl::PortalSendExecute(
+    Connection::StatementId statement_id,
+    const std::string& portal_name,
+    std::uint32_t n_rows,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    UINVARIANT(!IsPipelineActive(), "Sending a portal execution ahead is not supported in pipeline mode");
+    const TimeoutDuration network_timeout = ExecuteTimeout(statement_cmd_ctl);
+
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+    SetStatementTimeout(std::move(statement_cmd_ctl));
+
+    const auto* prepared_info = prepared_.Get(statement_id);
+    UASSERT_MSG(
+        prepared_info,
+        "Portal execute uses statement id that is absent in prepared "
+        "statements"
+    );
+    tracing::Span span{FindQueryShortInfo(scopes::kExec, prepared_info->statement)};
+    conn_wrapper_.FillSpanTags(span, {network_timeout, GetStatementTimeout()});
+    span.AddTag(tracing::kDatabaseStatement, prepared_info->statement);
+    if (deadline.IsReached()) {
+        ++stats_.execute_timeout;
+        LOG_LIMITED_WARNING() << "Deadline was reached before starting to execute portal `" << portal_name << "`";
+        throw ConnectionTimeoutError{"Deadline reached before executing"};
+    }
+    auto scope = span.CreateScopeTime(scopes::kExec);
+    conn_wrapper_.SendPortalExecute(portal_name, n_rows, scope);
+    // Let the server start producing the rows while the previous ones are processed
+    conn_wrapper_.Flush(deadline);
+}
+
+ResultSet ConnectionImpl::PortalWaitExecute(
+    Connection::StatementId statement_id,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    const TimeoutDuration network_timeout = ExecuteTimeout(statement_cmd_ctl);
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+
+    auto* prepared_info = prepared_.Get(statement_id);
+    UASSERT_MSG(
+        prepared_info,
+        "Portal execute uses statement id that is absent in prepared "
+        "statements"
+    );
+    tracing::Span span{FindQueryShortInfo(scopes::kExec, prepared_info->statement)};
+    conn_wrapper_.FillSpanTags(span, {network_timeout, GetStatementTimeout()});
+    span.AddTag(tracing::kDatabaseStatement, prepared_info->statement);
+    auto scope = span.CreateScopeTime(scopes::kExec);
+    CountExecute count_execute(stats_);
+
+    return WaitResult(
+        prepared_info->statement, deadline, network_timeout, count_execute, span, scope, &prepared_info->description
+    );
+}
+
+std::size_t ConnectionImpl::CopyIn(
+    std::string_view table,
+    const std::vector<std::string>& columns,
+    Connection::CopyInDataSource source,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    CheckBusy();
+
+    // COPY is not allowed in pipeline mode
+    auto pipeline_guard = std::optional<ScopeGuard>{};
+    if (IsPipelineActive()) {
+        conn_wrapper_.ExitPipelineMode();
+        pipeline_guard.emplace([this]() { conn_wrapper_.EnterPipelineMode(); });
+    }
+
+    const Query query{MakeCopyInStatement(table, columns)};
+    const auto& statement = query.Statement();
+    const TimeoutDuration network_timeout = ExecuteTimeout(statement_cmd_ctl);
+    auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+    SetStatementTimeout(std::move(statement_cmd_ctl));
+    CheckDeadlineReached(deadline);
+    auto span = MakeQuerySpan(query, {network_timeout, GetStatementTimeout()});
+    auto scope = span.CreateScopeTime();
+    CountExecute count_execute(stats_);
+
+    try {
+        conn_wrapper_.SendQuery(statement, scope);
+        conn_wrapper_.WaitCopyStart(deadline, scope, PGRES_COPY_IN);
+    } catch (const std::exception&) {
+        span.AddTag(tracing::kErrorFlag, true);
+        throw;
+    }
+
+    try {
+        std::string buffer;
+        for (bool has_more = true; has_more;) {
+            buffer.clear();
+            has_more = source(buffer);
+            if (!buffer.empty()) {
+                conn_wrapper_.PutCopyData(buffer, deadline, scope);
+            }
+        }
+    } catch (const std::exception& e) {
+        span.AddTag(tracing::kErrorFlag, true);
+        AbortCopyIn(e.what(), deadline);
+        throw;
+    }
+
+    conn_wrapper_.PutCopyEnd(nullptr, deadline);
+    return WaitResult(statement, deadline, network_timeout, count_execute, span, scope, nullptr).RowsAffected();
+}
+
+void ConnectionImpl::CopyOut(
+    const Query& query,
+    Connection::CopyOutDataSink sink,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    CheckBusy();
+
+    // COPY is not allowed in pipeline mode
+    auto pipeline_guard = std::optional<ScopeGuard>{};
+    if (IsPipelineActive()) {
+        conn_wrapper_.ExitPipelineMode();
+        pipeline_guard.emplace([this]() { conn_wrapper_.EnterPipelineMode(); });
+    }
+
+    const Query copy_query{fmt::format(kStatementCopyOut, query.Statement()), query.GetName()};
+    const auto& statement = copy_query.Statement();
+    const TimeoutDuration network_timeout = ExecuteTimeout(statement_cmd_ctl);
+    auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+    SetStatementTimeout(std::move(statement_cmd_ctl));
+    CheckDeadlineReached(deadline);
+    auto span = MakeQuerySpan(copy_query, {network_timeout, GetStatementTimeout()});
+    auto scope = span.CreateScopeTime();
+    CountExecute count_execute(stats_);
+
+    try {
+        conn_wrapper_.SendQuery(statement, scope);
+        conn_wrapper_.WaitCopyStart(deadline, scope, PGRES_COPY_OUT);
+    } catch (const std::exception&) {
+        span.AddTag(tracing::kErrorFlag, true);
+        throw;
+    }
+
+    try {
+        while (conn_wrapper_.GetCopyData(deadline, scope, sink)) {
+        }
+    } catch (const std::exception&) {
+        span.AddTag(tracing::kErrorFlag, true);
+        AbortCopyOut(deadline, scope);
+        throw;
+    }
+
+    WaitResult(statement, deadline, network_timeout, count_execute, span, scope, nullptr);
+}
+
 void ConnectionImpl::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) {
     ExecuteCommandNoPrepare(
         fmt::format(kStatementListen, conn_wrapper_.EscapeIdentifier(channel)),
@@ -738,6 +896,7 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
         UASSERT(statement_info);
         DiscardPreparedStatement(*statement_info, deadline);
         prepared_.Erase(statement_info->id);
+        ++stats_.prepared_statements_evicted;
     }
 
     scope.Reset(scopes::kPrepare);
@@ -787,6 +946,10 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
     if (!statement_info) {
         prepared_.Put(query_id, {query_id, statement, statement_name, std::move(res)});
         statement_info = prepared_.Get(query_id);
+        if (settings_.prepared_statements_warmup && newly_prepared_.size() < settings_.max_prepared_cache_size) {
+            const auto* types = params.ParamTypesBuffer();
+            newly_prepared_.push_back({query_hash, statement, {types, types + params.Size()}});
+        }
     } else {
         statement_info->description = std::move(res);
     }
@@ -893,22 +1056,41 @@ ConnectionImpl::GatherPipeline(TimeoutDuration timeout, const std::vector<Result
     const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
     CheckDeadlineReached(deadline);
 
-    std::vector<const PGresult*> native_descriptions(descriptions.size(), nullptr);
-    if (IsOmitDescribeInExecuteEnabled()) {
-        for (std::size_t i = 0; i < descriptions.size(); ++i) {
-            native_descriptions[i] = descriptions[i].pimpl_->handle_.get();
-        }
+    auto result = conn_wrapper_.GatherPipeline(deadline, GetNativeDescriptions(descriptions));
+
+    for (auto& single_result : result) {
+        FillBufferCategories(single_result);
     }
 
-    auto result = conn_wrapper_.GatherPipeline(deadline, native_descriptions);
+    return result;
+}
+
+std::vector<PipelineResult>
+ConnectionImpl::GatherIsolatedPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
+    CheckDeadlineReached(deadline);
+
+    auto result = conn_wrapper_.GatherIsolatedPipeline(deadline, GetNativeDescriptions(descriptions));
 
     for (auto& single_result : result) {
-        FillBufferCategories(single_result);
+        if (auto* result_set = std::get_if<ResultSet>(&single_result)) {
+            FillBufferCategories(*result_set);
+        }
     }
 
     return result;
 }
 
+std::vector<const PGresult*> ConnectionImpl::GetNativeDescriptions(const std::vector<ResultSet>& descriptions) const {
+    std::vector<const PGresult*> native_descriptions(descriptions.size(), nullptr);
+    if (IsOmitDescribeInExecuteEnabled()) {
+        for (std::size_t i = 0; i < descriptions.size(); ++i) {
+            native_descriptions[i] = descriptions[i].pimpl_->handle_.get();
+        }
+    }
+    return native_descriptions;
+}
+
 ResultSet ConnectionImpl::ExecuteCommandNoPrepare(const Query& query, engine::Deadline deadline) {
     static const QueryParameters kNoParams;
     return ExecuteCommandNoPrepare(query, kNoParams, deadline);
@@ -1074,6 +1256,50 @@ ResultSet ConnectionImpl::WaitResult(
 
 void ConnectionImpl::Cancel() { conn_wrapper_.Cancel().Wait(); }
 
+std::string ConnectionImpl::MakeCopyInStatement(std::string_view table, const std::vector<std::string>& columns) {
+    std::string statement = "COPY ";
+    // The table name may be qualified with a schema name
+    for (auto pos = table.find('.'); pos != std::string_view::npos; pos = table.find('.')) {
+        statement += conn_wrapper_.EscapeIdentifier(table.substr(0, pos));
+        statement += '.';
+        table.remove_prefix(pos + 1);
+    }
+    statement += conn_wrapper_.EscapeIdentifier(table);
+
+    if (!columns.empty()) {
+        statement += " (";
+        for (const auto& column : columns) {
+            if (&column != &columns.front()) statement += ", ";
+            statement += conn_wrapper_.EscapeIdentifier(column);
+        }
+        statement += ')';
+    }
+    statement += " FROM STDIN (FORMAT binary)";
+    return statement;
+}
+
+void ConnectionImpl::AbortCopyIn(const char* reason, engine::Deadline deadline) noexcept {
+    try {
+        conn_wrapper_.PutCopyEnd(reason, deadline);
+        conn_wrapper_.DiscardInput(deadline);
+    } catch (const std::exception& e) {
+        LOG_LIMITED_WARNING() << "Failed to abort COPY FROM STDIN, the connection will be closed: " << e;
+        conn_wrapper_.MarkAsBroken();
+    }
+}
+
+void ConnectionImpl::AbortCopyOut(engine::Deadline deadline, tracing::ScopeTime& scope) noexcept {
+    try {
+        Cancel();
+        while (conn_wrapper_.GetCopyData(deadline, scope, [](std::string_view) {})) {
+        }
+        conn_wrapper_.DiscardInput(deadline);
+    } catch (const std::exception& e) {
+        LOG_LIMITED_WARNING() << "Failed to abort COPY TO STDOUT, the connection will be closed: " << e;
+        conn_wrapper_.MarkAsBroken();
+    }
+}
+
 void ConnectionImpl::ReportStatement(const std::string& name) {
     // Only report statement usage once.
     {
@@ -76,6 +76,7 @@ public:
     OptionalCommandControl GetNamedQueryCommandControl(const std::optional<Query::Name>& query_name) const;
 
     Connection::Statistics GetStatsAndReset();
+    std::vector<PreparedStatementSample> TakeNewlyPrepared();
 
     ResultSet
     ExecuteCommand(const Query& query, const detail::QueryParameters& params, OptionalCommandControl statement_cmd_ctl);
@@ -91,6 +92,9 @@ public:
     );
     std::vector<ResultSet> GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
 
+    std::vector<PipelineResult>
+    GatherIsolatedPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+
     void Begin(
         const TransactionOptions& options,
         SteadyClock::time_point trx_start_time,
@@ -116,6 +120,24 @@ public:
         OptionalCommandControl statement_cmd_ctl
     );
 
+    void PortalSendExecute(
+        Connection::StatementId statement_id,
+        const std::string& portal_name,
+        std::uint32_t n_rows,
+        OptionalCommandControl statement_cmd_ctl
+    );
+
+    ResultSet PortalWaitExecute(Connection::StatementId statement_id, OptionalCommandControl statement_cmd_ctl);
+
+    std::size_t CopyIn(
+        std::string_view table,
+        const std::vector<std::string>& columns,
+        Connection::CopyInDataSource source,
+        OptionalCommandControl statement_cmd_ctl
+    );
+
+    void CopyOut(const Query& query, Connection::CopyOutDataSink sink, OptionalCommandControl statement_cmd_ctl);
+
     void Listen(std::string_view channel, OptionalCommandControl);
     void Unlisten(std::string_view channel, OptionalCommandControl);
     Notification WaitNotify(engine::Deadline deadline);
@@ -186,6 +208,7 @@ private:
 
     void LoadUserTypes(engine::Deadline deadline);
     void FillBufferCategories(ResultSet& res);
+    std::vector<const PGresult*> GetNativeDescriptions(const std::vector<ResultSet>& descriptions) const;
 
     template <typename Counter>
     ResultSet WaitResult(
@@ -200,6 +223,14 @@ private:
 
     void Cancel();
 
+    std::string MakeCopyInStatement(std::string_view table, const std::vector<std::string>& columns);
+
+    // Makes the server fail the COPY and waits for it
+    void AbortCopyIn(const char* reason, engine::Deadline deadline) noexcept;
+
+    // Cancels the COPY and skips the rest of the data
+    void AbortCopyOut(engine::Deadline deadline, tracing::ScopeTime& scope) noexcept;
+
     void ReportStatement(const std::string& name);
 
     bool IsOmitDescribeInExecuteEnabled() const;
@@ -208,6 +239,7 @@ private:
     Connection::Statistics stats_;
     PGConnectionWrapper conn_wrapper_;
     PreparedStatements prepared_;
+    std::vector<PreparedStatementSample> newly_prepared_;
     UserTypes db_types_;
     bool is_in_recovery_ = true;
     bool is_read_only_ = true;
@@ -0,0 +1,47 @@
+#include <userver/storages/postgres/detail/copy_binary.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+constexpr std::string_view kCopyBinarySignature{"PGCOPY\n\377\r\n\0", 11};
+
+}  // namespace
+
+void WriteCopyBinaryHeader(std::string& buffer) {
+    static const UserTypes kNoUserTypes;
+    buffer.append(kCopyBinarySignature);
+    // Flags
+    io::WriteBuffer(kNoUserTypes, buffer, Integer{0});
+    // Header extension length
+    io::WriteBuffer(kNoUserTypes, buffer, Integer{0});
+}
+
+void WriteCopyBinaryTrailer(std::string& buffer) {
+    static const UserTypes kNoUserTypes;
+    io::WriteBuffer(kNoUserTypes, buffer, Smallint{-1});
+}
+
+std::string_view SkipCopyBinaryHeader(std::string_view data) {
+    if (data.substr(0, kCopyBinarySignature.size()) != kCopyBinarySignature) {
+        throw InvalidInputFormat{"COPY data does not start with the binary format signature"};
+    }
+    data.remove_prefix(kCopyBinarySignature.size());
+
+    io::FieldBuffer buffer{
+        false, io::BufferCategory::kPlainBuffer, data.size(), reinterpret_cast<const std::uint8_t*>(data.data())};
+    Integer flags{0};
+    buffer.Read(flags, io::BufferCategory::kPlainBuffer);
+    Integer extension_length{0};
+    buffer.Read(extension_length, io::BufferCategory::kPlainBuffer);
+    if (extension_length < 0 || static_cast<std::size_t>(extension_length) > buffer.length) {
+        throw InvalidInputFormat{"COPY data has an invalid header extension length"};
+    }
+    return data.substr(2 * sizeof(Integer) + extension_length);
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -2,19 +2,54 @@
 #include <userver/testsuite/testpoint.hpp>
 
 #include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/pool.hpp>
 #include <storages/postgres/detail/statement_stats.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres::detail {
 
+namespace {
+
+void InjectTestpointFailure(const Query& query) {
+    if (!query.GetName().has_value()) return;
+
+    TESTPOINT_CALLBACK(
+        fmt::format("pg_ntrx_execute::{}", query.GetName().value()),
+        formats::json::Value(),
+        [](const formats::json::Value& data) {
+            if (data["inject_failure"].As<bool>()) {
+                auto type = data["failure_type"].As<std::string>();
+                LOG_WARNING() << "Failing statement "
+                                 "due to Testpoint response with "
+                              << type;
+                if (type == "Error")
+                    throw Error("Statement error");
+                else if (type == "RuntimeError")
+                    throw RuntimeError("Runtime statement error");
+                else if (type == "LogicError")
+                    throw LogicError("Logic statement error");
+                else if (type == "ConnectionError")
+                    throw ConnectionError{"Statement connection failed"};
+            }
+        }
+    );
+}
+
+}  // namespace
+
 NonTransaction::NonTransaction(ConnectionPtr&& conn, detail::SteadyClock::time_point start_time)
     : conn_{std::move(conn)} {
     conn_->Start(start_time);
 }
 
+NonTransaction::NonTransaction(std::shared_ptr<ConnectionPool>&& pool)
+    : conn_{std::unique_ptr<Connection>{}}, pool_{std::move(pool)} {}
+
 NonTransaction::NonTransaction(NonTransaction&&) noexcept = default;
-NonTransaction::~NonTransaction() { conn_->Finish(); }
+NonTransaction::~NonTransaction() {
+    if (conn_) conn_->Finish();
+}
 
 NonTransaction& NonTransaction::operator=(NonTransaction&&) noexcept = default;
 
@@ -23,6 +58,13 @@ ResultSet NonTransaction::Execute(
     const std::string& statement,
     const ParameterStore& store
 ) {
+    if (!conn_) {
+        return DoExecutePipelined(
+            statement,
+            [&store](const UserTypes&) { return detail::QueryParameters{store.GetInternalData()}; },
+            statement_cmd_ctl
+        );
+    }
     return DoExecute(statement, detail::QueryParameters{store.GetInternalData()}, statement_cmd_ctl);
 }
 
@@ -31,28 +73,7 @@ ResultSet NonTransaction::DoExecute(
     const detail::QueryParameters& params,
     OptionalCommandControl statement_cmd_ctl
 ) {
-    if (query.GetName().has_value()) {
-        TESTPOINT_CALLBACK(
-            fmt::format("pg_ntrx_execute::{}", query.GetName().value()),
-            formats::json::Value(),
-            [](const formats::json::Value& data) {
-                if (data["inject_failure"].As<bool>()) {
-                    auto type = data["failure_type"].As<std::string>();
-                    LOG_WARNING() << "Failing statement "
-                                     "due to Testpoint response with "
-                                  << type;
-                    if (type == "Error")
-                        throw Error("Statement error");
-                    else if (type == "RuntimeError")
-                        throw RuntimeError("Runtime statement error");
-                    else if (type == "LogicError")
-                        throw LogicError("Logic statement error");
-                    else if (type == "ConnectionError")
-                        throw ConnectionError{"Statement connection failed"};
-                }
-            }
-        );
-    }
+    InjectTestpointFailure(query);
 
     StatementStats stats{query, conn_};
     try {
@@ -65,6 +86,25 @@ ResultSet NonTransaction::DoExecute(
     }
 }
 
+ResultSet NonTransaction::DoExecutePipelined(
+    const Query& query,
+    QueryParametersWriter params_writer,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    UASSERT(pool_);
+    InjectTestpointFailure(query);
+
+    StatementStats stats{query, &pool_->GetStatementStatsStorage()};
+    try {
+        auto res = pool_->ExecutePipelined(query, params_writer, std::move(statement_cmd_ctl));
+        stats.AccountStatementExecution();
+        return res;
+    } catch (const std::exception& e) {
+        stats.AccountStatementError();
+        throw;
+    }
+}
+
 const UserTypes& NonTransaction::GetConnectionUserTypes() const { return conn_->GetUserTypes(); }
 
 }  // namespace storages::postgres::detail
@@ -0,0 +1,185 @@
+#include <storages/postgres/detail/notify_dispatcher.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/pool.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Bounds the delay of LISTEN for a new channel, as the connection can not be
+// used for anything else while waiting for notifications
+constexpr std::chrono::milliseconds kPollInterval{100};
+constexpr std::chrono::seconds kRetryInterval{1};
+
+// A subscriber that does not consume its notifications starts losing them
+// instead of making the others wait
+constexpr std::size_t kMaxQueuedNotifications = 10000;
+
+}  // namespace
+
+NotifyDispatcher::NotifyDispatcher(engine::TaskProcessor& bg_task_processor, MasterPoolGetter get_master_pool)
+    : bg_task_processor_{bg_task_processor}, get_master_pool_{std::move(get_master_pool)} {}
+
+NotifyDispatcher::~NotifyDispatcher() { Stop(); }
+
+NotifyDispatcher::Subscription NotifyDispatcher::Subscribe(std::string_view channel, engine::Deadline deadline) {
+    auto queue = Queue::Create(kMaxQueuedNotifications);
+
+    std::unique_lock lock{mutex_};
+    UINVARIANT(!stopped_, "Subscribing to notifications of a stopped cluster");
+
+    const auto id = ++next_id_;
+    channels_[std::string{channel}].emplace(id, queue->GetProducer());
+    const auto version = ++version_;
+    if (!listener_task_.IsValid()) {
+        listener_task_ = engine::CriticalAsyncNoSpan(bg_task_processor_, [this] { Run(); });
+    }
+
+    if (!synced_cv_.WaitUntil(lock, deadline, [this, version] { return synced_version_ >= version; })) {
+        lock.unlock();
+        Unsubscribe(channel, id);
+        throw ConnectionTimeoutError{fmt::format("Timed out while subscribing to notifications on '{}'", channel)};
+    }
+    return {id, queue->GetConsumer()};
+}
+
+void NotifyDispatcher::Unsubscribe(std::string_view channel, std::uint64_t id) {
+    const std::lock_guard lock{mutex_};
+    const auto it = channels_.find(std::string{channel});
+    if (it == channels_.end()) return;
+
+    it->second.erase(id);
+    if (it->second.empty()) {
+        channels_.erase(it);
+        ++version_;
+    }
+}
+
+void NotifyDispatcher::Stop() {
+    {
+        const std::lock_guard lock{mutex_};
+        stopped_ = true;
+        // Destroys the producers, so the waiting subscribers wake up
+        channels_.clear();
+    }
+    if (listener_task_.IsValid()) listener_task_.SyncCancel();
+}
+
+void NotifyDispatcher::Run() {
+    ListenerState state;
+    while (!engine::current_task::ShouldCancel()) {
+        try {
+            auto master_pool = get_master_pool_();
+            if (state.conn && (master_pool != state.pool || (*state.conn)->IsBroken())) {
+                LOG_INFO() << "Reconnecting the notifications listener to " << DsnCutPassword(master_pool->GetDsn());
+                DropConnection(state);
+            }
+            if (!state.conn) {
+                const auto timeout = master_pool->GetDefaultCommandControl().execute;
+                state.conn.emplace(master_pool->Acquire(engine::Deadline::FromDuration(timeout)));
+                state.pool = std::move(master_pool);
+            }
+
+            SyncChannels(state);
+            WaitAndDispatch(**state.conn);
+        } catch (const std::exception& e) {
+            if (engine::current_task::ShouldCancel()) break;
+            LOG_LIMITED_WARNING() << "Notifications listener failed: " << e;
+            DropConnection(state);
+            engine::InterruptibleSleepFor(kRetryInterval);
+        }
+    }
+    DropConnection(state);
+}
+
+void NotifyDispatcher::SyncChannels(ListenerState& state) {
+    std::vector<std::string> channels;
+    std::uint64_t version = 0;
+    {
+        const std::lock_guard lock{mutex_};
+        version = version_;
+        if (state.version == version) return;
+
+        channels.reserve(channels_.size());
+        for (const auto& [channel, _] : channels_) channels.push_back(channel);
+    }
+
+    auto& conn = **state.conn;
+    for (auto it = state.channels.begin(); it != state.channels.end();) {
+        if (std::find(channels.begin(), channels.end(), *it) != channels.end()) {
+            ++it;
+            continue;
+        }
+        LOG_DEBUG() << "Stop listening on channel '" << *it << "'";
+        conn.Unlisten(*it, {});
+        it = state.channels.erase(it);
+    }
+    for (auto& channel : channels) {
+        if (state.channels.count(channel)) continue;
+        LOG_DEBUG() << "Start listening on channel '" << channel << "'";
+        conn.Listen(channel, {});
+        state.channels.insert(std::move(channel));
+    }
+
+    state.version = version;
+    {
+        const std::lock_guard lock{mutex_};
+        synced_version_ = std::max(synced_version_, version);
+    }
+    synced_cv_.NotifyAll();
+}
+
+void NotifyDispatcher::WaitAndDispatch(Connection& conn) {
+    std::optional<Notification> notification;
+    try {
+        notification.emplace(conn.WaitNotify(engine::Deadline::FromDuration(kPollInterval)));
+    } catch (const ConnectionTimeoutError&) {
+        // No notifications, time to look for the new channels
+        return;
+    }
+    Dispatch(std::move(*notification));
+}
+
+void NotifyDispatcher::Dispatch(Notification&& notification) {
+    const std::lock_guard lock{mutex_};
+    const auto it = channels_.find(notification.channel);
+    // Everyone has unsubscribed while the notification was in flight
+    if (it == channels_.end()) return;
+
+    for (const auto& [_, producer] : it->second) {
+        if (!producer.PushNoblock(Notification{notification})) {
+            LOG_LIMITED_WARNING() << "Dropped a notification on channel '" << notification.channel
+                                  << "', the subscriber does not keep up";
+        }
+    }
+}
+
+void NotifyDispatcher::DropConnection(ListenerState& state) {
+    if (!state.conn) return;
+    // The connection listens to the channels, it must not get back to the pool
+    (*state.conn)->MarkAsBroken();
+    state.conn.reset();
+    state.pool.reset();
+    state.channels.clear();
+    state.version.reset();
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
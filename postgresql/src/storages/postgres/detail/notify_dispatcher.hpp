@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/notify.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+class Connection;
+class ConnectionPool;
+
+/// @brief Multiplexes the notification channels of a cluster over a single
+/// connection to the master.
+///
+/// A background task holds the listening connection, executes LISTEN/UNLISTEN
+/// as the set of subscribed channels changes and fans out the received
+/// notifications to the queues of the subscribers. If the connection breaks
+/// or the master changes, the task reconnects to the current master and
+/// listens to all the subscribed channels again. Notifications sent while
+/// the listener is reconnecting are lost.
+class NotifyDispatcher final {
+public:
+    using Queue = concurrent::SpscQueue<Notification>;
+    using MasterPoolGetter = std::function<std::shared_ptr<ConnectionPool>()>;
+
+    struct Subscription final {
+        std::uint64_t id;
+        Queue::Consumer consumer;
+    };
+
+    NotifyDispatcher(engine::TaskProcessor& bg_task_processor, MasterPoolGetter get_master_pool);
+    ~NotifyDispatcher();
+
+    /// Returns after the channel is listened to on the shared connection
+    /// @throws ConnectionTimeoutError if that did not happen before deadline
+    Subscription Subscribe(std::string_view channel, engine::Deadline deadline);
+    void Unsubscribe(std::string_view channel, std::uint64_t id);
+
+    /// Stops the listener, subscribers get no more notifications
+    void Stop();
+
+private:
+    struct ListenerState {
+        std::shared_ptr<ConnectionPool> pool;
+        std::optional<ConnectionPtr> conn;
+        std::unordered_set<std::string> channels;
+        std::optional<std::uint64_t> version;
+    };
+
+    void Run();
+    void SyncChannels(ListenerState& state);
+    void WaitAndDispatch(Connection& conn);
+    void Dispatch(Notification&& notification);
+
+    static void DropConnection(ListenerState& state);
+
+    engine::TaskProcessor& bg_task_processor_;
+    const MasterPoolGetter get_master_pool_;
+
+    engine::Mutex mutex_;
+    engine::ConditionVariable synced_cv_;
+    std::unordered_map<std::string, std::unordered_map<std::uint64_t, Queue::Producer>> channels_;
+    std::uint64_t next_id_{0};
+    // Incremented on each change of the set of channels
+    std::uint64_t version_{0};
+    // The last version of the set of channels that has been listened to
+    std::uint64_t synced_version_{0};
+    bool stopped_{false};
+
+    engine::TaskWithResult<void> listener_task_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -578,8 +578,37 @@ Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
 }
 
 std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
-    [[maybe_unused]] Deadline deadline,
+    Deadline deadline,
+    const std::vector<const PGresult*>& descriptions
+) {
+    std::vector<ResultSet> result{};
+    result.reserve(descriptions.size());
+    DoGatherPipeline(deadline, descriptions, [this, &result](ResultHandle&& handle) {
+        result.push_back(MakeResult(std::move(handle)));
+    });
+    return result;
+}
+
+std::vector<PipelineResult> PGConnectionWrapper::GatherIsolatedPipeline(
+    Deadline deadline,
     const std::vector<const PGresult*>& descriptions
+) {
+    std::vector<PipelineResult> result{};
+    result.reserve(descriptions.size());
+    DoGatherPipeline(deadline, descriptions, [this, &result](ResultHandle&& handle) {
+        try {
+            result.emplace_back(MakeResult(std::move(handle)));
+        } catch (const Error&) {
+            result.emplace_back(std::current_exception());
+        }
+    });
+    return result;
+}
+
+void PGConnectionWrapper::DoGatherPipeline(
+    [[maybe_unused]] Deadline deadline,
+    const std::vector<const PGresult*>& descriptions,
+    [[maybe_unused]] USERVER_NAMESPACE::utils::function_ref<void(ResultHandle&&)> consumer
 ) {
     UASSERT(!descriptions.empty());
 
@@ -588,7 +617,7 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
 #else
     Flush(deadline);
 
-    std::vector<ResultSet> result{};
+    std::size_t results_count{0};
     const PGresult* current_description = descriptions.front();
 
     std::size_t null_res_counter{0};
@@ -623,7 +652,8 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
                 return first_field_name != nullptr && std::string_view{first_field_name} == kSetConfigQueryResultName;
             }();
             if (!is_set_config_response) {
-                result.push_back(MakeResult(std::move(handle)));
+                consumer(std::move(handle));
+                ++results_count;
             }
         }
 
@@ -633,13 +663,97 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
         // We do it this way instead of 1:1 matching because we need to feed
         // something into the last ReadResult call, which is expected to just return
         // null right away. And if it doesn't -- we get an error, as we should.
-        current_description = result.size() < descriptions.size() ? descriptions[result.size()] : nullptr;
+        current_description = results_count < descriptions.size() ? descriptions[results_count] : nullptr;
     }
-
-    return result;
 #endif
 }
 
+void PGConnectionWrapper::WaitCopyStart(
+    Deadline deadline,
+    tracing::ScopeTime& scope,
+    ExecStatusType expected_status
+) {
+    scope.Reset(scopes::kLibpqWaitResult);
+    Flush(deadline);
+    auto handle = MakeResultHandle(ReadResult(deadline, nullptr));
+    if (handle && PQresultStatus(handle.get()) == expected_status) {
+        return;
+    }
+
+    // The statement failed, read the rest of the results to get the connection
+    // back to idle state
+    while (auto* pg_res = ReadResult(deadline, nullptr)) {
+        handle = MakeResultHandle(pg_res);
+    }
+    MakeResult(std::move(handle));
+    throw LogicError{"Statement has not started a COPY"};
+}
+
+void PGConnectionWrapper::PutCopyData(std::string_view data, Deadline deadline, tracing::ScopeTime& scope) {
+    scope.Reset(scopes::kLibpqPutCopyData);
+    while (true) {
+        const int put_res = PQputCopyData(conn_, data.data(), data.size());
+        if (put_res > 0) break;
+        if (put_res < 0) {
+            HandleSocketPostClose();
+            throw CommandError(PQerrorMessage(conn_));
+        }
+        // The data was not queued because the output buffer is full
+        Flush(deadline);
+    }
+    UpdateLastUse();
+}
+
+void PGConnectionWrapper::PutCopyEnd(const char* error_message, Deadline deadline) {
+    while (true) {
+        const int end_res = PQputCopyEnd(conn_, error_message);
+        if (end_res > 0) break;
+        if (end_res < 0) {
+            HandleSocketPostClose();
+            throw CommandError(PQerrorMessage(conn_));
+        }
+        // The request was not queued because the output buffer is full
+        Flush(deadline);
+    }
+    Flush(deadline);
+    UpdateLastUse();
+}
+
+bool PGConnectionWrapper::GetCopyData(
+    Deadline deadline,
+    tracing::ScopeTime& scope,
+    USERVER_NAMESPACE::utils::function_ref<void(std::string_view)> consumer
+) {
+    scope.Reset(scopes::kLibpqGetCopyData);
+    while (true) {
+        char* buffer = nullptr;
+        const int size = PQgetCopyData(conn_, &buffer, /* async = */ 1);
+        if (size > 0) {
+            const std::unique_ptr<char, decltype(&PQfreemem)> buffer_guard{buffer, &PQfreemem};
+            consumer(std::string_view{buffer, static_cast<std::size_t>(size)});
+            return true;
+        }
+        if (size == -1) {
+            return false;
+        }
+        if (size < -1) {
+            HandleSocketPostClose();
+            throw CommandError(PQerrorMessage(conn_));
+        }
+
+        // No complete row is available yet
+        if (!WaitSocketReadable(deadline)) {
+            if (engine::current_task::ShouldCancel()) {
+                throw ConnectionInterrupted("Task cancelled while reading COPY data");
+            }
+            PGCW_LOG_LIMITED_WARNING() << "Timeout while reading COPY data from PostgreSQL connection";
+            throw ConnectionTimeoutError("Timed out while reading COPY data");
+        }
+        CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+        UpdateLastUse();
+    }
+}
+
 void PGConnectionWrapper::DiscardInput(Deadline deadline) {
     Flush(deadline);
     auto handle = MakeResultHandle(nullptr);
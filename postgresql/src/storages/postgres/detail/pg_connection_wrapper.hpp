@@ -17,6 +17,7 @@
 #include <userver/engine/semaphore.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/notify.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -116,8 +117,31 @@ public:
     /// @brief Wait for notification
     Notification WaitNotify(Deadline deadline);
 
+    /// @brief Wait for the result that starts a COPY with the given status
+    /// (PGRES_COPY_IN or PGRES_COPY_OUT).
+    /// Will throw an exception if the statement failed or is not a COPY
+    void WaitCopyStart(Deadline deadline, tracing::ScopeTime&, ExecStatusType expected_status);
+
+    /// @brief Wrapper for PQputCopyData
+    void PutCopyData(std::string_view data, Deadline deadline, tracing::ScopeTime&);
+
+    /// @brief Wrapper for PQputCopyEnd, a non-null error message makes
+    /// the server fail the COPY. The result should be read with WaitResult
+    void PutCopyEnd(const char* error_message, Deadline deadline);
+
+    /// @brief Wrapper for PQgetCopyData, passes a single row of data to the
+    /// consumer. Returns false when the COPY is done, the result should be read
+    /// with WaitResult
+    bool GetCopyData(Deadline deadline, tracing::ScopeTime&, USERVER_NAMESPACE::utils::function_ref<void(std::string_view)> consumer);
+
     std::vector<ResultSet> GatherPipeline(Deadline deadline, const std::vector<const PGresult*>& descriptions);
 
+    /// @brief Like GatherPipeline, but an error of a statement does not prevent
+    /// reading the results of the rest of the statements, as long as each
+    /// statement is followed by a sync
+    std::vector<PipelineResult>
+    GatherIsolatedPipeline(Deadline deadline, const std::vector<const PGresult*>& descriptions);
+
     /// Consume input from connection
     void ConsumeInput(Deadline deadline, const PGresult* description);
 
@@ -148,6 +172,9 @@ public:
 
     void PutPipelineSync();
 
+    /// Sends out the buffered requests, in pipeline mode puts a sync first
+    void Flush(Deadline deadline);
+
 private:
     PGTransactionStatusType GetTransactionStatus() const;
 
@@ -165,8 +192,6 @@ private:
     /// @return true if wait was successful, false if was awakened by the deadline
     [[nodiscard]] bool WaitSocketReadable(Deadline deadline);
 
-    void Flush(Deadline deadline);
-
     PGresult* ReadResult(Deadline deadline, const PGresult* description);
 
     ResultSet MakeResult(ResultHandle&& handle);
@@ -178,6 +203,12 @@ private:
 
     void HandlePipelineSync();
 
+    void DoGatherPipeline(
+        Deadline deadline,
+        const std::vector<const PGresult*>& descriptions,
+        USERVER_NAMESPACE::utils::function_ref<void(ResultHandle&&)> consumer
+    );
+
     template <typename ExceptionType>
     [[noreturn]] void CloseWithError(ExceptionType&& ex);
 
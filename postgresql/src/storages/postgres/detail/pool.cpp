@@ -43,6 +43,13 @@ constexpr auto kIdleDropLimit = 1;
 // Practically unlimited number on concurrent establishing connections
 constexpr auto kUnlimitedConnecting = std::numeric_limits<std::size_t>::max();
 
+// Limits the rate of opening the idle spare connections
+constexpr std::size_t kSpareConnectBurst = 4;
+constexpr std::chrono::milliseconds kSpareConnectPeriod{100};
+
+// Weight of the new sample in the query latency moving average is 1/kLatencyEwmaFactor
+constexpr auto kLatencyEwmaFactor = 8;
+
 class Stopwatch {
 public:
     using Accumulator =
@@ -99,6 +106,7 @@ ConnectionPool::ConnectionPool(
       testsuite_pg_ctl_{testsuite_pg_ctl},
       ei_settings_(std::move(ei_settings)),
       cancel_limit_{std::max(std::size_t{1}, settings.max_size / kCancelRatio), {1, kCancelPeriod}},
+      spare_connect_limit_{kSpareConnectBurst, {1, kSpareConnectPeriod}},
       sts_{statement_metrics_settings},
       config_source_(config_source),
       cc_sensor_(*this),
@@ -111,7 +119,8 @@ ConnectionPool::ConnectionPool(
           cc_config,
           config_source,
           [](const dynamic_config::Snapshot& config) { return config[kCcConfig]; }
-      ) {
+      ),
+      auto_pipeline_{*this} {
     if (USERVER_NAMESPACE::utils::impl::kPgCcExperiment.IsEnabled()) {
         cc_controller_.Start();
     }
@@ -229,6 +238,7 @@ ConnectionPtr ConnectionPool::Acquire(engine::Deadline deadline) {
     CheckDeadlineIsExpired(config);
     ConnectionPtr connection{Pop(deadline), std::move(shared_this)};
     ++stats_.connection.used;
+    CheckMinIdleSizeUnderflow();
     CheckDeadlineIsExpired(config);
 
     connection->UpdateDefaultCommandControl();
@@ -239,6 +249,17 @@ void ConnectionPool::AccountConnectionStats(Connection::Statistics conn_stats) {
     auto now = SteadyClock::now();
 
     stats_.connection.prepared_statements.GetCurrentCounter().Account(conn_stats.prepared_statements_current);
+    stats_.connection.prepared_statements_evicted += conn_stats.prepared_statements_evicted;
+
+    if (conn_stats.execute_total) {
+        // Concurrent updates may lose a sample, which is fine for an estimate
+        const auto sample =
+            std::chrono::duration_cast<std::chrono::microseconds>(conn_stats.sum_query_duration) / conn_stats.execute_total;
+        const auto average = query_latency_ewma_.load(std::memory_order_relaxed);
+        query_latency_ewma_.store(
+            average.count() ? average + (sample - average) / kLatencyEwmaFactor : sample, std::memory_order_relaxed
+        );
+    }
 
     stats_.transaction.total += conn_stats.trx_total;
     stats_.transaction.commit_total += conn_stats.commit_total;
@@ -278,9 +299,11 @@ void ConnectionPool::Release(Connection* connection) {
     DecGuard dg{stats_.connection.used, DecGuard::DontIncrement{}};
 
     std::optional<Connection::Statistics> connection_stats{};
+    std::vector<PreparedStatementSample> newly_prepared;
     // Grab stats only if connection is not in transaction
     if (!connection->IsInTransaction()) {
         connection_stats.emplace(connection->GetStatsAndReset());
+        newly_prepared = connection->TakeNewlyPrepared();
     }
 
     if (!connection->IsConnected() || connection->IsBroken()) {
@@ -306,6 +329,9 @@ void ConnectionPool::Release(Connection* connection) {
     if (connection_stats.has_value()) {
         AccountConnectionStats(std::move(*connection_stats));
     }
+    if (!newly_prepared.empty()) {
+        prepared_warmup_.Account(std::move(newly_prepared));
+    }
 }
 
 const InstanceStatistics& ConnectionPool::GetStatistics() const {
@@ -314,9 +340,16 @@ const InstanceStatistics& ConnectionPool::GetStatistics() const {
     stats_.connection.waiting = wait_count_.load(std::memory_order_relaxed);
     stats_.connection.maximum = settings->max_size;
     stats_.connection.max_queue_size = settings->max_queue_size;
+    stats_.connection.connecting = connect_task_storage_.ActiveTasksApprox();
     return stats_;
 }
 
+std::chrono::microseconds ConnectionPool::GetQueryLatencyEwma() const {
+    return query_latency_ewma_.load(std::memory_order_relaxed);
+}
+
+std::size_t ConnectionPool::GetUsedConnectionsCount() const { return stats_.connection.used.Load(); }
+
 Transaction ConnectionPool::Begin(const TransactionOptions& options, OptionalCommandControl trx_cmd_ctl) {
     const auto trx_start_time = detail::SteadyClock::now();
     const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(trx_cmd_ctl));
@@ -326,6 +359,10 @@ Transaction ConnectionPool::Begin(const TransactionOptions& options, OptionalCom
 }
 
 NonTransaction ConnectionPool::Start(OptionalCommandControl cmd_ctl) {
+    if (IsAutoPipelineEnabled()) {
+        return NonTransaction{shared_from_this()};
+    }
+
     const auto start_time = detail::SteadyClock::now();
     const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
     auto conn = Acquire(deadline);
@@ -333,6 +370,15 @@ NonTransaction ConnectionPool::Start(OptionalCommandControl cmd_ctl) {
     return NonTransaction{std::move(conn), start_time};
 }
 
+ResultSet ConnectionPool::ExecutePipelined(
+    const Query& query,
+    QueryParametersWriter params_writer,
+    OptionalCommandControl cmd_ctl
+) {
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
+    return auto_pipeline_.Execute(query, params_writer, std::move(cmd_ctl), deadline);
+}
+
 NotifyScope ConnectionPool::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) {
     const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
     auto conn = Acquire(deadline);
@@ -346,6 +392,13 @@ TimeoutDuration ConnectionPool::GetExecuteTimeout(OptionalCommandControl cmd_ctl
     return GetDefaultCommandControl().execute;
 }
 
+bool ConnectionPool::IsAutoPipelineEnabled() const {
+    const auto conn_settings = conn_settings_.Read();
+    return conn_settings->auto_pipeline_mode == AutoPipelineMode::kEnabled &&
+           conn_settings->pipeline_mode == PipelineMode::kEnabled &&
+           conn_settings->prepared_statements == ConnectionSettings::kCachePreparedStatements;
+}
+
 CommandControl ConnectionPool::GetDefaultCommandControl() const { return default_cmd_ctls_.GetDefaultCmdCtl(); }
 
 void ConnectionPool::SetSettings(const PoolSettings& settings) {
@@ -444,8 +497,13 @@ bool ConnectionPool::DoConnect(engine::SemaphoreLock size_lock, ConnectionSettin
     }
     LOG_TRACE() << "PostgreSQL connection created";
 
+    stats_.connection.prepared_statements_warmed_up += prepared_warmup_.Warmup(
+        *connection, connection->GetSettings().prepared_statements_warmup, default_cmd_ctls_.GetDefaultCmdCtl().execute
+    );
+
     // Clean up the statistics and not account it
     [[maybe_unused]] const auto& stats = connection->GetStatsAndReset();
+    [[maybe_unused]] const auto& warmed_up = connection->TakeNewlyPrepared();
 
     Push(connection.release());
     return true;
@@ -475,6 +533,29 @@ void ConnectionPool::CheckMinPoolSizeUnderflow() {
     }
 }
 
+void ConnectionPool::CheckMinIdleSizeUnderflow() {
+    const auto settings = settings_.Read();
+    if (!settings->min_idle_size) return;
+
+    const auto size = size_semaphore_.UsedApprox();
+    const auto used = stats_.connection.used.Load();
+    const auto idle = size > used ? size - used : 0;
+    if (idle >= settings->min_idle_size || size >= settings->max_size) return;
+
+    // Connections being established are counted as idle, as they hold a place
+    // in the pool
+    LOG_DEBUG() << "Number of idle connections is less than min_idle_size (" << idle << " < "
+                << settings->min_idle_size << "). Create new connections.";
+    auto missing = std::min(settings->min_idle_size - idle, settings->max_size - size);
+    for (; missing > 0; --missing) {
+        if (!spare_connect_limit_.Obtain()) {
+            LOG_DEBUG() << "Too many spare connections are being opened";
+            break;
+        }
+        TryCreateConnectionAsync();
+    }
+}
+
 void ConnectionPool::Push(Connection* connection) {
     // However unlikely, this could happen when we return connection after
     // asynchronous cleanup routine.
@@ -693,6 +774,7 @@ void ConnectionPool::MaintainConnections() {
 
     // Check and maintain minimum count of connections
     CheckMinPoolSizeUnderflow();
+    CheckMinIdleSizeUnderflow();
 }
 
 void ConnectionPool::StartMaintainTask() {
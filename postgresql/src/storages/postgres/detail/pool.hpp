@@ -30,8 +30,10 @@
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
+#include <storages/postgres/detail/auto_pipeline.hpp>
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/detail/prepared_warmup.hpp>
 #include <storages/postgres/detail/size_guard.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
 
@@ -81,10 +83,22 @@ public:
     void Release(Connection* connection);
 
     const InstanceStatistics& GetStatistics() const;
+
+    /// Moving average of the query execution time on the connections of the pool
+    std::chrono::microseconds GetQueryLatencyEwma() const;
+
+    /// Number of connections acquired from the pool at the moment
+    std::size_t GetUsedConnectionsCount() const;
+
     [[nodiscard]] Transaction Begin(const TransactionOptions& options, OptionalCommandControl trx_cmd_ctl = {});
 
     [[nodiscard]] NonTransaction Start(OptionalCommandControl cmd_ctl = {});
 
+    /// Executes a single statement over a shared pipelined connection, see
+    /// AutoPipelineMode
+    ResultSet
+    ExecutePipelined(const Query& query, QueryParametersWriter params_writer, OptionalCommandControl cmd_ctl);
+
     NotifyScope Listen(std::string_view channel, OptionalCommandControl cmd_ctl = {});
 
     CommandControl GetDefaultCommandControl() const;
@@ -110,11 +124,14 @@ private:
 
     TimeoutDuration GetExecuteTimeout(OptionalCommandControl) const;
 
+    bool IsAutoPipelineEnabled() const;
+
     [[nodiscard]] engine::TaskWithResult<bool> Connect(engine::SemaphoreLock, ConnectionSettings&&);
     bool DoConnect(engine::SemaphoreLock, ConnectionSettings&&);
 
     void TryCreateConnectionAsync();
     void CheckMinPoolSizeUnderflow();
+    void CheckMinIdleSizeUnderflow();
 
     void Push(Connection* connection);
     Connection* Pop(engine::Deadline);
@@ -156,12 +173,15 @@ private:
     engine::Semaphore size_semaphore_;
     engine::Semaphore connecting_semaphore_;
     std::atomic<size_t> wait_count_;
+    std::atomic<std::chrono::microseconds> query_latency_ewma_{std::chrono::microseconds::zero()};
     DefaultCommandControls default_cmd_ctls_;
     testsuite::PostgresControl testsuite_pg_ctl_;
     const error_injection::Settings ei_settings_;
     RecentCounter recent_conn_errors_;
     USERVER_NAMESPACE::utils::TokenBucket cancel_limit_;
+    USERVER_NAMESPACE::utils::TokenBucket spare_connect_limit_;
     detail::StatementStatsStorage sts_;
+    PreparedStatementsWarmup prepared_warmup_;
     dynamic_config::Source config_source_;
 
     // Congestion control stuff
@@ -169,6 +189,8 @@ private:
     cc::Limiter cc_limiter_;
     congestion_control::v2::LinearController cc_controller_;
     std::atomic<std::size_t> cc_max_connections_{0};
+
+    AutoPipeline auto_pipeline_;
 };
 
 }  // namespace storages::postgres::detail
@@ -0,0 +1,89 @@
+#include <storages/postgres/detail/prepared_warmup.hpp>
+
+#include <algorithm>
+
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Bounds the memory spent on the statement texts
+constexpr std::size_t kMaxTrackedStatements = 1000;
+
+// Provides the parameter types for Parse, the values are not needed
+class ParamTypesHolder final {
+public:
+    explicit ParamTypesHolder(const std::vector<Oid>& types) : types_{types} {}
+
+    std::size_t Size() const { return types_.size(); }
+    const char* const* ParamBuffers() const { return nullptr; }
+    const Oid* ParamTypesBuffer() const { return types_.empty() ? nullptr : types_.data(); }
+    const int* ParamLengthsBuffer() const { return nullptr; }
+    const int* ParamFormatsBuffer() const { return nullptr; }
+
+private:
+    const std::vector<Oid>& types_;
+};
+
+}  // namespace
+
+PreparedStatementsWarmup::PreparedStatementsWarmup() : statements_{kMaxTrackedStatements} {}
+
+void PreparedStatementsWarmup::Account(std::vector<PreparedStatementSample>&& samples) {
+    auto statements = statements_.Lock();
+    for (auto& sample : samples) {
+        auto* entry = statements->Get(sample.id);
+        if (entry) {
+            ++entry->prepares;
+        } else {
+            const auto id = sample.id;
+            statements->Put(id, Entry{std::move(sample), 1});
+        }
+    }
+}
+
+std::size_t PreparedStatementsWarmup::Warmup(Connection& connection, std::size_t count, TimeoutDuration timeout) const {
+    if (!count || !connection.ArePreparedStatementsEnabled()) return 0;
+
+    std::size_t prepared = 0;
+    for (const auto& sample : GetHottest(count)) {
+        ParamTypesHolder holder{sample.param_types};
+        try {
+            connection.PrepareStatement(Query{sample.statement}, QueryParameters{holder}, timeout);
+            ++prepared;
+        } catch (const Error& e) {
+            LOG_WARNING() << "Failed to warm up a prepared statement: " << e;
+            if (connection.IsBroken()) break;
+        }
+    }
+    LOG_DEBUG() << "Warmed up " << prepared << " prepared statements";
+    return prepared;
+}
+
+std::vector<PreparedStatementSample> PreparedStatementsWarmup::GetHottest(std::size_t count) const {
+    std::vector<const Entry*> entries;
+    std::vector<PreparedStatementSample> result;
+
+    auto statements = statements_.Lock();
+    entries.reserve(statements->GetSize());
+    statements->VisitAll([&entries](const std::size_t&, const Entry& entry) { entries.push_back(&entry); });
+
+    count = std::min(count, entries.size());
+    std::partial_sort(entries.begin(), entries.begin() + count, entries.end(), [](const Entry* lhs, const Entry* rhs) {
+        return lhs->prepares > rhs->prepares;
+    });
+
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        result.push_back(entries[i]->sample);
+    }
+    return result;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
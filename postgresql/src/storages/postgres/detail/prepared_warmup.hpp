@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/concurrent/variable.hpp>
+
+#include <userver/storages/postgres/detail/time_types.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// @brief Remembers the statements prepared by the connections of a pool and
+/// prepares the most popular of them on the new connections.
+///
+/// A statement is considered hot if many connections had to prepare it, so
+/// after a failover the new connections do not parse and plan the hot
+/// statements on the first requests.
+class PreparedStatementsWarmup final {
+public:
+    PreparedStatementsWarmup();
+
+    void Account(std::vector<PreparedStatementSample>&& samples);
+
+    /// Prepares up to `count` hottest statements on the connection
+    /// @returns the number of statements prepared
+    std::size_t Warmup(Connection& connection, std::size_t count, TimeoutDuration timeout) const;
+
+private:
+    struct Entry final {
+        PreparedStatementSample sample;
+        std::size_t prepares{0};
+    };
+    using Statements = USERVER_NAMESPACE::cache::LruMap<std::size_t, Entry>;
+
+    std::vector<PreparedStatementSample> GetHottest(std::size_t count) const;
+
+    mutable USERVER_NAMESPACE::concurrent::Variable<Statements> statements_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,109 @@
+#include <storages/postgres/detail/query_result_cache.hpp>
+
+#include <algorithm>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+constexpr std::size_t kCacheWays = 16;
+constexpr std::chrono::seconds kResubscribeInterval{1};
+
+template <typename T>
+void AppendBytes(std::string& key, const T& value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::string MakeKey(std::uint64_t generation, const std::string& statement, const DynamicQueryParameters& params) {
+    std::string key;
+    key.reserve(sizeof(generation) + sizeof(std::size_t) + statement.size() + params.Size() * 16);
+    AppendBytes(key, generation);
+    AppendBytes(key, statement.size());
+    key.append(statement);
+    for (std::size_t i = 0; i < params.Size(); ++i) {
+        const auto* buffer = params.ParamBuffers()[i];
+        const int length = buffer ? params.ParamLengthsBuffer()[i] : -1;
+        AppendBytes(key, params.ParamTypesBuffer()[i]);
+        AppendBytes(key, length);
+        if (length > 0) key.append(buffer, length);
+    }
+    return key;
+}
+
+}  // namespace
+
+QueryResultCache::QueryResultCache(const QueryResultCacheSettings& settings)
+    : cache_(kCacheWays, std::max<std::size_t>(settings.max_size / kCacheWays, 1)) {
+    cache_.SetMaxLifetime(settings.ttl);
+}
+
+QueryResultCache::~QueryResultCache() { StopInvalidationListener(); }
+
+ResultSet QueryResultCache::Get(const Query& query, const DynamicQueryParameters& params, Fetcher fetch) {
+    const auto key = MakeKey(generation_.load(std::memory_order_acquire), query.Statement(), params);
+    return cache_.Get(key, [fetch](const std::string&) { return fetch(); });
+}
+
+void QueryResultCache::Invalidate() {
+    // Results of the queries in flight are put under the keys of the previous
+    // generation and are never found
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+    cache_.Invalidate();
+    ++invalidations_;
+}
+
+void QueryResultCache::StartInvalidationListener(engine::TaskProcessor& task_processor, Subscriber subscribe) {
+    UASSERT(!invalidation_task_.IsValid());
+    invalidation_task_ = engine::CriticalAsyncNoSpan(task_processor, [this, subscribe = std::move(subscribe)] {
+        RunInvalidationListener(subscribe);
+    });
+}
+
+void QueryResultCache::StopInvalidationListener() {
+    if (invalidation_task_.IsValid()) invalidation_task_.SyncCancel();
+}
+
+QueryResultCacheStatistics QueryResultCache::GetStatistics() const {
+    const auto& stats = cache_.GetStatistics();
+    const auto recent = stats.recent.GetStatsForPeriod();
+    const auto recent_hits = recent.hits.load();
+    const auto recent_total = recent_hits + recent.misses.load();
+
+    QueryResultCacheStatistics result;
+    result.hits = stats.total.hits.load();
+    result.misses = stats.total.misses.load();
+    result.stale = stats.total.stale.load();
+    result.hit_ratio = static_cast<double>(recent_hits) / static_cast<double>(recent_total ? recent_total : 1);
+    result.invalidations = invalidations_.Load();
+    result.size = cache_.GetSizeApproximate();
+    return result;
+}
+
+void QueryResultCache::RunInvalidationListener(const Subscriber& subscribe) {
+    while (!engine::current_task::ShouldCancel()) {
+        try {
+            auto subscription = subscribe();
+            // Notifications sent while there was no subscription are lost
+            Invalidate();
+            while (true) {
+                subscription.WaitNotify(engine::Deadline{});
+                Invalidate();
+            }
+        } catch (const std::exception& e) {
+            if (engine::current_task::ShouldCancel()) break;
+            LOG_LIMITED_WARNING() << "Query result cache invalidation listener failed: " << e;
+            engine::InterruptibleSleepFor(kResubscribeInterval);
+        }
+    }
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include <userver/cache/expirable_lru_cache.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/function_ref.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/notify.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+#include <userver/storages/postgres/statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// @brief Cache of the results of a query, keyed by the statement and the
+/// binary representation of the parameters.
+///
+/// Concurrent misses on the same key execute the query once. Invalidation
+/// makes the results cached so far unreachable, including the ones of the
+/// queries that are in flight at the moment.
+class QueryResultCache final {
+public:
+    using Subscriber = std::function<NotifySubscription()>;
+    using Fetcher = USERVER_NAMESPACE::utils::function_ref<ResultSet()>;
+
+    explicit QueryResultCache(const QueryResultCacheSettings& settings);
+    ~QueryResultCache();
+
+    ResultSet Get(const Query& query, const DynamicQueryParameters& params, Fetcher fetch);
+
+    void Invalidate();
+
+    /// Starts a task that invalidates the cache on each notification received
+    /// through the subscription
+    void StartInvalidationListener(engine::TaskProcessor& task_processor, Subscriber subscribe);
+    void StopInvalidationListener();
+
+    QueryResultCacheStatistics GetStatistics() const;
+
+private:
+    void RunInvalidationListener(const Subscriber& subscribe);
+
+    cache::ExpirableLruCache<std::string, ResultSet> cache_;
+    std::atomic<std::uint64_t> generation_{0};
+    USERVER_NAMESPACE::utils::statistics::RelaxedCounter<std::size_t> invalidations_;
+    engine::TaskWithResult<void> invalidation_task_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
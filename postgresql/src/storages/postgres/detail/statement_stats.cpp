@@ -8,9 +8,10 @@ USERVER_NAMESPACE_BEGIN
 namespace storages::postgres::detail {
 
 StatementStats::StatementStats(const Query& query, const ConnectionPtr& conn)
-    : query_{query},
-      sts_{conn.GetStatementStatsStorage()},
-      start_{sts_ != nullptr ? Now() : SteadyClock::time_point{}} {}
+    : StatementStats{query, conn.GetStatementStatsStorage()} {}
+
+StatementStats::StatementStats(const Query& query, const StatementStatsStorage* sts)
+    : query_{query}, sts_{sts}, start_{sts_ != nullptr ? Now() : SteadyClock::time_point{}} {}
 
 void StatementStats::AccountStatementExecution() { AccountImpl(StatementStatsStorage::ExecutionResult::kSuccess); }
 
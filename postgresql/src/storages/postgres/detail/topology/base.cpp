@@ -38,6 +38,8 @@ const TopologySettings& TopologyBase::GetTopologySettings() const { return topol
 
 void TopologyBase::SetTopologySettings(const TopologySettings& settings) { topology_settings_ = settings; }
 
+std::chrono::milliseconds TopologyBase::GetReplicationLag(DsnIndex) const { return std::chrono::milliseconds::zero(); }
+
 const testsuite::PostgresControl& TopologyBase::GetTestsuiteControl() const { return testsuite_pg_ctl_; }
 
 std::unique_ptr<Connection> TopologyBase::MakeTopologyConnection(DsnIndex idx) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -53,6 +54,9 @@ public:
     // Returns statistics for each DSN in DsnList
     virtual const std::vector<decltype(InstanceStatistics::topology)>& GetDsnStatistics() const = 0;
 
+    /// Last measured replication lag of the host, zero for the master
+    virtual std::chrono::milliseconds GetReplicationLag(DsnIndex) const;
+
 protected:
     std::unique_ptr<Connection> MakeTopologyConnection(DsnIndex);
 
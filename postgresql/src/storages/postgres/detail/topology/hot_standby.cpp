@@ -153,7 +153,8 @@ HotStandby::HotStandby(
           std::move(ei_settings)
       ),
       host_states_{GetDsnList().begin(), GetDsnList().end()},
-      dsn_stats_(GetDsnList().size()) {
+      dsn_stats_(GetDsnList().size()),
+      replication_lags_(GetDsnList().size()) {
     RunDiscovery();
 
     discovery_task_.Start(
@@ -173,6 +174,11 @@ rcu::ReadablePtr<TopologyBase::DsnIndices> HotStandby::GetAliveDsnIndices() cons
 
 const std::vector<decltype(InstanceStatistics::topology)>& HotStandby::GetDsnStatistics() const { return dsn_stats_; }
 
+std::chrono::milliseconds HotStandby::GetReplicationLag(DsnIndex idx) const {
+    UASSERT(idx < replication_lags_.size());
+    return replication_lags_[idx].load(std::memory_order_relaxed);
+}
+
 void HotStandby::RunDiscovery() {
     std::vector<engine::TaskWithResult<void>> tasks;
     tasks.reserve(GetDsnList().size());
@@ -205,7 +211,10 @@ void HotStandby::RunDiscovery() {
     // slaves.
     for (DsnIndex i = 0; i < host_states_.size(); ++i) {
         auto& slave = host_states_[i];
-        if (slave.role != ClusterHostType::kSlave) continue;
+        if (slave.role != ClusterHostType::kSlave) {
+            replication_lags_[i].store(std::chrono::milliseconds::zero(), std::memory_order_relaxed);
+            continue;
+        }
 
         // xact timestamp can become stale when there are no writes.
         // - In normal case we compare against local slave time to avoid distributed
@@ -226,6 +235,9 @@ void HotStandby::RunDiscovery() {
         dsn_stats_[i].replication_lag.GetCurrentCounter().Account(
             std::chrono::duration_cast<std::chrono::milliseconds>(slave_lag).count()
         );
+        replication_lags_[i].store(
+            std::chrono::duration_cast<std::chrono::milliseconds>(slave_lag), std::memory_order_relaxed
+        );
 
         const auto& topology_settings = GetTopologySettings();
         if (topology_settings.max_replication_lag > std::chrono::milliseconds{0} &&
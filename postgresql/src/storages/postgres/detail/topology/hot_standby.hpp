@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -32,6 +33,7 @@ public:
     rcu::ReadablePtr<DsnIndicesByType> GetDsnIndicesByType() const override;
     rcu::ReadablePtr<DsnIndices> GetAliveDsnIndices() const override;
     const std::vector<decltype(InstanceStatistics::topology)>& GetDsnStatistics() const override;
+    std::chrono::milliseconds GetReplicationLag(DsnIndex) const override;
 
 private:
     struct HostState;
@@ -43,6 +45,7 @@ private:
     rcu::Variable<DsnIndicesByType> dsn_indices_by_type_;
     rcu::Variable<DsnIndices> alive_dsn_indices_;
     std::vector<decltype(InstanceStatistics::topology)> dsn_stats_;
+    std::vector<std::atomic<std::chrono::milliseconds>> replication_lags_;
     USERVER_NAMESPACE::utils::PeriodicTask discovery_task_;
 };
 
@@ -5,6 +5,7 @@
 #include <string_view>
 
 #include <boost/algorithm/string/trim.hpp>
+#include <boost/container/small_vector.hpp>
 
 #include <storages/postgres/io/pg_type_parsers.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
@@ -51,6 +52,12 @@ const std::uint16_t kDscaleMask = 0x3fff;
 // Number of decimal digits in
 const int kDigitWidth = 4;
 
+// Enough binary digits for any value representable by decimal64, so that
+// the conversions to and from it do not allocate
+constexpr std::size_t kInlineDigits = 12;
+
+using BinaryDigits = boost::container::small_vector<std::int16_t, kInlineDigits>;
+
 void WriteDigit(std::string& res, std::uint16_t bin_dgt, bool truncate_leading_zeros) {
     std::array<char, 8> buffer{'0', '0', '0', '0', '0', '0', '0', '0'};
 
@@ -89,7 +96,7 @@ std::int16_t GetPaddedDigit(std::string_view str, int idx) {
     return val;
 }
 
-void ConvertDecimalToBinary(std::string_view dec_digits, int left_padding, std::vector<std::int16_t>& target) {
+void ConvertDecimalToBinary(std::string_view dec_digits, int left_padding, BinaryDigits& target) {
     for (auto dec_pos = left_padding; dec_pos < static_cast<std::int32_t>(dec_digits.size()); dec_pos += kDigitWidth) {
         target.push_back(GetPaddedDigit(dec_digits, dec_pos));
     }
@@ -105,7 +112,7 @@ int Log10(std::int64_t number) {
     return kMaxPowerOfTen;
 }
 
-void IntegralToBinary(std::int64_t integral_part, Smallint digits, std::vector<std::int16_t>& target) {
+void IntegralToBinary(std::int64_t integral_part, Smallint digits, BinaryDigits& target) {
     // Left pad
     if (digits % kDigitWidth) {
         digits += kDigitWidth - digits % kDigitWidth;
@@ -152,7 +159,7 @@ void IntegralToBinary(std::int64_t integral_part, Smallint digits, std::vector<s
 ///            decimal positions
 struct NumericData {
     using Digit = std::int16_t;
-    using Digits = std::vector<Digit>;
+    using Digits = BinaryDigits;
 
     std::uint16_t ndigits = 0;
     Smallint weight = 0;
@@ -202,6 +209,7 @@ void NumericData::ReadBuffer(FieldBuffer fb) {
 std::string NumericData::GetBuffer() const {
     static const UserTypes types;
     std::string buff;
+    buff.reserve(sizeof(ndigits) + sizeof(weight) + sizeof(sign) + sizeof(dscale) + digits.size() * sizeof(Digit));
     io::WriteBuffer(types, buff, ndigits);
     io::WriteBuffer(types, buff, weight);
     io::WriteBuffer(types, buff, sign);
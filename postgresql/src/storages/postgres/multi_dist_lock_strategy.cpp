@@ -0,0 +1,117 @@
+#include <userver/storages/postgres/multi_dist_lock_strategy.hpp>
+
+#include <string_view>
+#include <unordered_map>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/hostinfo/blocking/get_hostname.hpp>
+#include <userver/storages/postgres/cluster.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+// keys - $1
+// owner - $2
+// timeout in seconds - $3
+std::string MakeAcquireQuery(const std::string& table) {
+    static constexpr std::string_view kAcquireQueryFmt = R"(
+    INSERT INTO {} AS t (key, owner, expiration_time, fencing_token)
+    SELECT key, $2, current_timestamp + make_interval(secs => $3), 1
+    FROM UNNEST($1::text[]) AS key
+    ON CONFLICT (key) DO UPDATE
+    SET owner = $2, expiration_time = current_timestamp + make_interval(secs => $3),
+    fencing_token = CASE WHEN t.owner = $2 THEN t.fencing_token ELSE t.fencing_token + 1 END
+    WHERE (t.owner = $2) OR
+    (t.expiration_time <= current_timestamp) RETURNING key, fencing_token;
+)";
+    return fmt::format(FMT_COMPILE(kAcquireQueryFmt), table);
+}
+
+// keys - $1
+// owner - $2
+std::string MakeReleaseQuery(const std::string& table) {
+    static constexpr std::string_view kReleaseQueryFmt = R"(
+    UPDATE {}
+    SET expiration_time = current_timestamp
+    WHERE key = ANY($1)
+    AND owner = $2;
+)";
+    return fmt::format(FMT_COMPILE(kReleaseQueryFmt), table);
+}
+
+std::string MakeOwnerId(const std::string& prefix, const std::string& locker) {
+    return fmt::format(FMT_COMPILE("{}:{}"), prefix, locker);
+}
+
+}  // namespace
+
+MultiDistLockStrategy::MultiDistLockStrategy(
+    ClusterPtr cluster,
+    const std::string& table,
+    const dist_lock::DistLockSettings& settings
+)
+    : cluster_(std::move(cluster)),
+      cc_(settings.forced_stop_margin, settings.forced_stop_margin),
+      acquire_query_(MakeAcquireQuery(table)),
+      release_query_(MakeReleaseQuery(table)),
+      owner_prefix_(hostinfo::blocking::GetRealHostName()) {}
+
+void MultiDistLockStrategy::UpdateCommandControl(CommandControl cc) {
+    auto cc_ptr = cc_.StartWrite();
+    *cc_ptr = cc;
+    cc_ptr.Commit();
+}
+
+std::vector<std::optional<dist_lock::FencingToken>> MultiDistLockStrategy::AcquireMany(
+    std::chrono::milliseconds lock_ttl,
+    const std::string& locker_id,
+    USERVER_NAMESPACE::utils::span<const std::string> lock_names
+) {
+    double timeout_seconds = lock_ttl.count() / 1000.0;
+    auto cc_ptr = cc_.Read();
+    auto result = cluster_->Execute(
+        ClusterHostType::kMaster,
+        *cc_ptr,
+        acquire_query_,
+        std::vector<std::string>(lock_names.begin(), lock_names.end()),
+        MakeOwnerId(owner_prefix_, locker_id),
+        timeout_seconds
+    );
+
+    std::unordered_map<std::string, dist_lock::FencingToken> tokens;
+    tokens.reserve(result.Size());
+    for (const auto& row : result) {
+        tokens.emplace(row["key"].As<std::string>(), row["fencing_token"].As<dist_lock::FencingToken>());
+    }
+
+    std::vector<std::optional<dist_lock::FencingToken>> acquired;
+    acquired.reserve(lock_names.size());
+    for (const auto& name : lock_names) {
+        const auto it = tokens.find(name);
+        acquired.push_back(it == tokens.end() ? std::nullopt : std::make_optional(it->second));
+    }
+    return acquired;
+}
+
+void MultiDistLockStrategy::ReleaseMany(
+    const std::string& locker_id,
+    USERVER_NAMESPACE::utils::span<const std::string> lock_names
+) {
+    auto cc_ptr = cc_.Read();
+    cluster_->Execute(
+        ClusterHostType::kMaster,
+        *cc_ptr,
+        release_query_,
+        std::vector<std::string>(lock_names.begin(), lock_names.end()),
+        MakeOwnerId(owner_prefix_, locker_id)
+    );
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,10 @@
 #include <userver/storages/postgres/notify.hpp>
 
+#include <utility>
+
 #include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/notify_dispatcher.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
 #include <userver/logging/log.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -61,6 +65,69 @@ NotifyScope& NotifyScope::operator=(NotifyScope&&) noexcept = default;
 
 Notification NotifyScope::WaitNotify(engine::Deadline deadline) { return pimpl_->WaitNotify(deadline); }
 
+struct NotifySubscription::Impl {
+    std::shared_ptr<detail::NotifyDispatcher> dispatcher_;
+    std::string channel_;
+    std::uint64_t id_;
+    detail::NotifyDispatcher::Queue::Consumer consumer_;
+
+    Impl(std::shared_ptr<detail::NotifyDispatcher> dispatcher, std::string_view channel, engine::Deadline deadline)
+        : Impl{dispatcher, channel, dispatcher->Subscribe(channel, deadline)} {}
+
+    Impl(
+        std::shared_ptr<detail::NotifyDispatcher> dispatcher,
+        std::string_view channel,
+        detail::NotifyDispatcher::Subscription&& subscription
+    )
+        : dispatcher_{std::move(dispatcher)},
+          channel_{channel},
+          id_{subscription.id},
+          consumer_{std::move(subscription.consumer)} {}
+
+    ~Impl() {
+        if (!dispatcher_) return;
+        dispatcher_->Unsubscribe(channel_, id_);
+    }
+
+    Impl(Impl&&) = default;
+
+    // The previous subscription is dropped along with the moved-from object
+    Impl& operator=(Impl&& other) noexcept {
+        std::swap(dispatcher_, other.dispatcher_);
+        std::swap(channel_, other.channel_);
+        std::swap(id_, other.id_);
+        std::swap(consumer_, other.consumer_);
+        return *this;
+    }
+
+    Impl(const Impl&) = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    Notification WaitNotify(engine::Deadline deadline) {
+        UINVARIANT(dispatcher_, "Called WaitNotify on empty NotifySubscription");
+        Notification notification;
+        if (!consumer_.Pop(notification, deadline)) {
+            throw ConnectionTimeoutError("No notification on channel '" + channel_ + "' before the deadline");
+        }
+        return notification;
+    }
+};
+
+NotifySubscription::NotifySubscription(
+    std::shared_ptr<detail::NotifyDispatcher> dispatcher,
+    std::string_view channel,
+    engine::Deadline deadline
+)
+    : pimpl_{std::move(dispatcher), channel, deadline} {}
+
+NotifySubscription::~NotifySubscription() = default;
+
+NotifySubscription::NotifySubscription(NotifySubscription&&) noexcept = default;
+
+NotifySubscription& NotifySubscription::operator=(NotifySubscription&&) noexcept = default;
+
+Notification NotifySubscription::WaitNotify(engine::Deadline deadline) { return pimpl_->WaitNotify(deadline); }
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+
+#include <storages/postgres/tests/test_buffers.hpp>
+#include <userver/storages/postgres/io/decimal64.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+namespace io = pg::io;
+
+using Decimal = decimal64::Decimal<6>;
+
+const pg::UserTypes types;
+
+void PgDecimal64BinaryFormat(benchmark::State& state) {
+    const Decimal value{"-123456789.123456"};
+    pg::test::Buffer buffer;
+    for (auto _ : state) {
+        io::WriteBuffer(types, buffer, value);
+        buffer.clear();
+    }
+}
+
+void PgDecimal64BinaryParse(benchmark::State& state) {
+    Decimal value{"-123456789.123456"};
+    pg::test::Buffer buffer;
+    io::WriteBuffer(types, buffer, value);
+    auto fb = pg::test::MakeFieldBuffer(buffer);
+    for (auto _ : state) {
+        io::ReadBuffer(fb, value);
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+BENCHMARK(PgDecimal64BinaryFormat);
+BENCHMARK(PgDecimal64BinaryParse);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,10 @@
 #include <userver/storages/postgres/portal.hpp>
 
+#include <algorithm>
+#include <utility>
+
 #include <storages/postgres/detail/connection.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
 
@@ -8,13 +12,31 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
+namespace {
+
+std::uint32_t GetNextChunkRows(const ResultSet& chunk, const PortalPrefetchSettings& settings) {
+    if (chunk.IsEmpty()) return settings.initial_chunk_rows;
+
+    std::size_t chunk_bytes = 0;
+    for (auto row : chunk) {
+        for (auto field : row) chunk_bytes += field.Length();
+    }
+    const auto row_bytes = std::max<std::size_t>(chunk_bytes / chunk.Size(), 1);
+    return std::clamp<std::size_t>(settings.chunk_bytes / row_bytes, 1, std::max(settings.max_chunk_rows, 1U));
+}
+
+}  // namespace
+
 struct Portal::Impl {
     detail::Connection* conn_{nullptr};
     OptionalCommandControl cmd_ctl_;
     detail::Connection::StatementId statement_id_;
     PortalName name_;
     std::size_t fetched_so_far_{0};
+    // Number of rows of the next or the in flight prefetched chunk
+    std::uint32_t chunk_rows_{0};
     bool done_{false};
+    bool chunk_in_flight_{false};
 
     Impl(
         detail::Connection* conn,
@@ -32,7 +54,26 @@ struct Portal::Impl {
         }
     }
 
-    Impl(Impl&& rhs) noexcept = default;
+    ~Impl() {
+        if (!chunk_in_flight_) return;
+        try {
+            conn_->PortalWaitExecute(statement_id_, cmd_ctl_);
+        } catch (const std::exception& e) {
+            LOG_LIMITED_ERROR() << "Exception while discarding a prefetched portal chunk: " << e;
+            // The connection is out of sync with the server
+            conn_->MarkAsBroken();
+        }
+    }
+
+    Impl(Impl&& rhs) noexcept
+        : conn_{std::exchange(rhs.conn_, nullptr)},
+          cmd_ctl_{std::move(rhs.cmd_ctl_)},
+          statement_id_{rhs.statement_id_},
+          name_{std::move(rhs.name_)},
+          fetched_so_far_{rhs.fetched_so_far_},
+          chunk_rows_{rhs.chunk_rows_},
+          done_{rhs.done_},
+          chunk_in_flight_{std::exchange(rhs.chunk_in_flight_, false)} {}
     Impl& operator=(Impl&& rhs) noexcept {
         Impl{std::move(rhs)}.Swap(*this);
         return *this;
@@ -45,7 +86,9 @@ struct Portal::Impl {
         swap(statement_id_, rhs.statement_id_);
         swap(name_, rhs.name_);
         swap(fetched_so_far_, rhs.fetched_so_far_);
+        swap(chunk_rows_, rhs.chunk_rows_);
         swap(done_, rhs.done_);
+        swap(chunk_in_flight_, rhs.chunk_in_flight_);
     }
 
     void Bind(const std::string& statement, const detail::QueryParameters& params) {
@@ -53,6 +96,9 @@ struct Portal::Impl {
     }
 
     ResultSet Fetch(std::uint32_t n_rows) {
+        if (chunk_in_flight_) {
+            throw LogicError{"Portal has a prefetched chunk in flight, use FetchPrefetched"};
+        }
         if (!done_) {
             UASSERT(conn_);
             auto res = conn_->PortalExecute(statement_id_, name_.GetUnderlying(), n_rows, cmd_ctl_);
@@ -68,6 +114,38 @@ struct Portal::Impl {
             throw RuntimeError{"Portal is done, no more data to fetch"};
         }
     }
+
+    ResultSet FetchPrefetched(const PortalPrefetchSettings& settings) {
+        if (done_) {
+            throw RuntimeError{"Portal is done, no more data to fetch"};
+        }
+        UASSERT(conn_);
+        if (!chunk_rows_) chunk_rows_ = std::max(settings.initial_chunk_rows, 1U);
+
+        const auto requested = chunk_rows_;
+        auto res = chunk_in_flight_ ? WaitPrefetched()
+                                    : conn_->PortalExecute(statement_id_, name_.GetUnderlying(), requested, cmd_ctl_);
+        const auto fetched = res.Size();
+        fetched_so_far_ += fetched;
+        if (fetched != requested) {
+            done_ = true;
+            return res;
+        }
+
+        chunk_rows_ = GetNextChunkRows(res, settings);
+        // In pipeline mode the request is sent along with the wait for the result
+        if (!conn_->IsPipelineActive()) {
+            conn_->PortalSendExecute(statement_id_, name_.GetUnderlying(), chunk_rows_, cmd_ctl_);
+            chunk_in_flight_ = true;
+        }
+        return res;
+    }
+
+private:
+    ResultSet WaitPrefetched() {
+        chunk_in_flight_ = false;
+        return conn_->PortalWaitExecute(statement_id_, cmd_ctl_);
+    }
 };
 
 Portal::Portal(
@@ -94,6 +172,8 @@ Portal& Portal::operator=(Portal&&) noexcept = default;
 
 ResultSet Portal::Fetch(std::uint32_t n_rows) { return pimpl_->Fetch(n_rows); }
 
+ResultSet Portal::FetchPrefetched(const PortalPrefetchSettings& settings) { return pimpl_->FetchPrefetched(settings); }
+
 bool Portal::Done() const { return pimpl_->done_; }
 std::size_t Portal::FetchedSoFar() const { return pimpl_->fetched_so_far_; }
 
@@ -69,6 +69,12 @@ ConnectionSettings ParseConnectionSettings(const ConfigType& config) {
                                       ? ConnectionSettings::kDiscardAll
                                       : ConnectionSettings::kDiscardNone;
 
+    settings.auto_pipeline_mode =
+        config["auto-pipelining"].template As<bool>(false) ? AutoPipelineMode::kEnabled : AutoPipelineMode::kDisabled;
+
+    settings.prepared_statements_warmup =
+        config["prepared-statements-warmup"].template As<size_t>(settings.prepared_statements_warmup);
+
     return settings;
 }
 
@@ -101,9 +107,13 @@ PoolSettings ParsePoolSettings(const ConfigType& config) {
     result.max_size = config["max_pool_size"].template As<size_t>(result.max_size);
     result.max_queue_size = config["max_queue_size"].template As<size_t>(result.max_queue_size);
     result.connecting_limit = config["connecting_limit"].template As<size_t>(result.connecting_limit);
+    result.min_idle_size = config["min_idle_pool_size"].template As<size_t>(result.min_idle_size);
 
     if (result.max_size == 0) throw InvalidConfig{"max_pool_size must be greater than 0"};
     if (result.max_size < result.min_size) throw InvalidConfig{"max_pool_size cannot be less than min_pool_size"};
+    if (result.max_size < result.min_idle_size) {
+        throw InvalidConfig{"max_pool_size cannot be less than min_idle_pool_size"};
+    }
 
     return result;
 }
@@ -125,6 +135,15 @@ TopologySettings Parse(const formats::json::Value& config, formats::parse::To<To
         config["max_replication_lag_ms"].template As<std::chrono::milliseconds>(result.max_replication_lag);
     result.disabled_replicas = config["disabled_replicas"].template As<decltype(result.disabled_replicas)>({});
 
+    const auto balancing = config["replica_balancing"].template As<std::string>("round-robin");
+    if (balancing == "round-robin") {
+        result.replica_balancing = ReplicaBalancing::kRoundRobin;
+    } else if (balancing == "least-loaded") {
+        result.replica_balancing = ReplicaBalancing::kLeastLoaded;
+    } else {
+        throw InvalidConfig{"Unknown replica_balancing value: " + balancing};
+    }
+
     if (result.max_replication_lag < std::chrono::milliseconds{0})
         throw InvalidConfig{"max_replication_lag cannot be less than 0"};
 
@@ -13,6 +13,7 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Inst
         conn["max"] = stats.connection.maximum;
         conn["waiting"] = stats.connection.waiting;
         conn["max-queue-size"] = stats.connection.max_queue_size;
+        conn["connecting"] = stats.connection.connecting;
     }
     if (auto trx = writer["transactions"]) {
         trx["total"] = stats.transaction.total;
@@ -49,6 +50,10 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Inst
         errors.ValueWithLabels(stats.connection.error_timeout, {kPostgresqlError, "connection-timeout"});
     }
     writer["prepared-per-connection"] = stats.connection.prepared_statements;
+    if (auto prepared = writer["prepared"]) {
+        prepared["evicted"] = stats.connection.prepared_statements_evicted;
+        prepared["warmed-up"] = stats.connection.prepared_statements_warmed_up;
+    }
     writer["roundtrip-time"] = stats.topology.roundtrip_time;
     writer["replication-lag"] = stats.topology.replication_lag;
     if (!stats.per_statement_stats.empty()) {
@@ -66,6 +71,15 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Inst
     }
 }
 
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const QueryResultCacheStatistics& value) {
+    writer["hits"] = value.hits;
+    writer["misses"] = value.misses;
+    writer["stale"] = value.stale;
+    writer["hit_ratio"]["1min"] = value.hit_ratio;
+    writer["invalidations"] = value.invalidations;
+    writer["current-documents-count"] = value.size;
+}
+
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const ClusterStatistics& value) {
     constexpr std::string_view kPostgresqlClusterHostType = "postgresql_cluster_host_type";
     writer["connlimit-mode-auto-enabled"] = value.connlimit_mode_auto_on;
@@ -77,6 +91,9 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Clus
     for (const auto& item : value.unknown) {
         writer.ValueWithLabels(item, {kPostgresqlClusterHostType, "unknown"});
     }
+    for (const auto& [query_name, stats] : value.query_result_caches) {
+        writer["query-result-cache"].ValueWithLabels(stats, {"postgresql_query", query_name});
+    }
 }
 
 }  // namespace storages::postgres
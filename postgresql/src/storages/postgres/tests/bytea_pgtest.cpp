@@ -13,6 +13,7 @@ namespace static_test {
 
 static_assert(tt::kIsByteaCompatible<std::string>);
 static_assert(tt::kIsByteaCompatible<std::string_view>);
+static_assert(tt::kIsByteaCompatible<utils::span<const std::byte>>);
 static_assert(tt::kIsByteaCompatible<std::vector<char>>);
 static_assert(tt::kIsByteaCompatible<std::vector<unsigned char>>);
 static_assert(!tt::kIsByteaCompatible<std::vector<bool>>);
@@ -71,6 +72,17 @@ TEST(PostgreIO, Bytea) {
         UEXPECT_NO_THROW(io::ReadBuffer(fb, pg::Bytea(tgt_str)));
         EXPECT_EQ(bin_str, tgt_str);
     }
+    {
+        pg::test::Buffer buffer;
+        const utils::span<const std::byte> bin_str = utils::as_bytes(utils::span<const char>{kFooBar});
+        UEXPECT_NO_THROW(io::WriteBuffer(types, buffer, pg::Bytea(bin_str)));
+        EXPECT_EQ(kFooBar.size(), buffer.size());
+        auto fb = pg::test::MakeFieldBuffer(buffer, io::BufferCategory::kPlainBuffer);
+        utils::span<const std::byte> tgt_str;
+        UEXPECT_NO_THROW(io::ReadBuffer(fb, pg::Bytea(tgt_str)));
+        ASSERT_EQ(kFooBar.size(), tgt_str.size());
+        EXPECT_EQ(reinterpret_cast<const char*>(buffer.data()), reinterpret_cast<const char*>(tgt_str.data()));
+    }
 }
 
 UTEST_P(PostgreConnection, ByteaRoundtrip) {
@@ -7,9 +7,12 @@
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/postgres_config.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/wait_all_checked.hpp>
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utils/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -65,6 +68,12 @@ pg::Cluster CreateCluster(
     );
 }
 
+pg::ConnectionSettings MakeAutoPipelineSettings() {
+    auto settings = kPipelineEnabled;
+    settings.auto_pipeline_mode = pg::AutoPipelineMode::kEnabled;
+    return settings;
+}
+
 }  // namespace
 
 class PostgreCluster : public PostgreSQLBase {};
@@ -398,4 +407,157 @@ UTEST_F(PostgreCluster, ListenNotify) {
     );
 }
 
+UTEST_F(PostgreCluster, SubscribeNotify) {
+    constexpr auto kFooChannel = std::string_view{"foo"};
+    constexpr auto kBarChannel = std::string_view{"bar"};
+    constexpr auto kNotifyPayload = std::string_view{"baz"};
+    static const auto kNotifyDeadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 2, testsuite_tasks);
+
+    auto foo_first = cluster.Subscribe(kFooChannel);
+    auto foo_second = cluster.Subscribe(kFooChannel);
+    auto bar = cluster.Subscribe(kBarChannel);
+
+    UEXPECT_NO_THROW(
+        cluster.Execute(pg::ClusterHostType::kMaster, "select pg_notify($1, $2)", kFooChannel, kNotifyPayload)
+    );
+    UEXPECT_NO_THROW(cluster.Execute(pg::ClusterHostType::kMaster, "select pg_notify($1, NULL)", kBarChannel));
+
+    for (auto* subscription : {&foo_first, &foo_second}) {
+        auto ntf = subscription->WaitNotify(kNotifyDeadline);
+        EXPECT_EQ(ntf.channel, kFooChannel);
+        EXPECT_TRUE(ntf.payload && *ntf.payload == kNotifyPayload);
+    }
+
+    auto ntf = bar.WaitNotify(kNotifyDeadline);
+    EXPECT_EQ(ntf.channel, kBarChannel);
+    EXPECT_FALSE(ntf.payload);
+
+    {
+        // The rest of the subscribers of the channel are not affected
+        [[maybe_unused]] auto unsubscribed = std::move(foo_second);
+    }
+    UEXPECT_NO_THROW(cluster.Execute(pg::ClusterHostType::kMaster, "select pg_notify($1, NULL)", kFooChannel));
+    ntf = foo_first.WaitNotify(kNotifyDeadline);
+    EXPECT_EQ(ntf.channel, kFooChannel);
+
+    UEXPECT_THROW(
+        bar.WaitNotify(engine::Deadline::FromDuration(std::chrono::milliseconds{50})), pg::ConnectionTimeoutError
+    );
+}
+
+UTEST_F(PostgreCluster, QueryResultCache) {
+    static const pg::Query kQuery{
+        "select $1::integer + (random() * 1000000000)::integer", pg::Query::Name{"cached_random"}};
+    constexpr auto kInvalidationChannel = std::string_view{"cached_random_changed"};
+
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 2, testsuite_tasks);
+
+    pg::QueryResultCacheSettings settings;
+    settings.ttl = utest::kMaxTestWaitTime;
+    settings.invalidation_channel = std::string{kInvalidationChannel};
+    cluster.SetQueryResultCache("cached_random", settings);
+
+    const auto execute = [&cluster](int param) {
+        return cluster.Execute(pg::ClusterHostType::kMaster, kQuery, param).AsSingleRow<int>();
+    };
+
+    const auto first = execute(1);
+    EXPECT_EQ(first, execute(1));
+    EXPECT_NE(first, execute(2));
+
+    auto stats = cluster.GetStatistics();
+    ASSERT_EQ(1, stats->query_result_caches.count("cached_random"));
+    EXPECT_EQ(1, stats->query_result_caches.at("cached_random").hits);
+    EXPECT_EQ(2, stats->query_result_caches.at("cached_random").misses);
+
+    UEXPECT_NO_THROW(
+        cluster.Execute(pg::ClusterHostType::kMaster, "select pg_notify($1, NULL)", kInvalidationChannel)
+    );
+    const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    while (execute(1) == first && !deadline.IsReached()) {
+        engine::SleepFor(std::chrono::milliseconds{10});
+    }
+    EXPECT_NE(first, execute(1));
+
+    cluster.ResetQueryResultCache("cached_random");
+    EXPECT_EQ(0, cluster.GetStatistics()->query_result_caches.size());
+}
+
+UTEST_F_MT(PostgreCluster, AutoPipelining, 4) {
+    constexpr int kTasksCount = 200;
+
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster =
+        CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1, testsuite_tasks, MakeAutoPipelineSettings());
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kTasksCount);
+    for (int i = 0; i < kTasksCount; ++i) {
+        tasks.push_back(utils::Async("pipelined", [&cluster, i] {
+            if (i % 10 == 0) {
+                // Errors do not affect the other statements of a batch
+                UEXPECT_THROW(
+                    cluster.Execute(pg::ClusterHostType::kMaster, "select 1 / ($1 - $1)", i), pg::DataException
+                );
+                return;
+            }
+
+            const auto res = i % 2 ? cluster.Execute(pg::ClusterHostType::kMaster, "select $1::integer", i)
+                                   : cluster.Execute(
+                                         pg::ClusterHostType::kMaster,
+                                         "select $1::integer",
+                                         pg::ParameterStore{}.PushBack(i)
+                                     );
+            EXPECT_EQ(i, res.AsSingleRow<int>());
+        }));
+    }
+    UEXPECT_NO_THROW(engine::WaitAllChecked(tasks));
+
+    // The pool of a single connection is still usable
+    UEXPECT_NO_THROW(cluster.Execute(pg::ClusterHostType::kMaster, "select 1"));
+    CheckRwTransaction(cluster.Begin({}));
+}
+
+UTEST_F_MT(PostgreCluster, AutoPipeliningLeaderCancellation, 4) {
+    constexpr int kTasksCount = 5;
+
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster =
+        CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1, testsuite_tasks, MakeAutoPipelineSettings());
+
+    // Holds the pipelined connection while the next batch is queued
+    auto first =
+        utils::Async("first", [&cluster] { cluster.Execute(pg::ClusterHostType::kMaster, "select pg_sleep(0.2)"); });
+    engine::SleepFor(std::chrono::milliseconds{50});
+
+    // Queued first, so it is the first to get the connection and sends the
+    // statements of the others in its batch
+    auto leader =
+        utils::Async("leader", [&cluster] { cluster.Execute(pg::ClusterHostType::kMaster, "select pg_sleep(0.2)"); });
+    engine::SleepFor(std::chrono::milliseconds{20});
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kTasksCount);
+    for (int i = 0; i < kTasksCount; ++i) {
+        tasks.push_back(utils::Async("pipelined", [&cluster, i] {
+            const auto res = cluster.Execute(pg::ClusterHostType::kMaster, "select $1::integer", i);
+            EXPECT_EQ(i, res.AsSingleRow<int>());
+        }));
+    }
+
+    // The first batch is done, the batch of the leader is in flight
+    engine::SleepFor(std::chrono::milliseconds{250});
+    leader.RequestCancel();
+
+    UEXPECT_NO_THROW(first.Get());
+    leader.Wait();
+    UEXPECT_NO_THROW(engine::WaitAllChecked(tasks));
+
+    UEXPECT_NO_THROW(cluster.Execute(pg::ClusterHostType::kMaster, "select 1"));
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,130 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+/// [CopyIn]
+struct IdAndValue final {
+    int id{};
+    std::optional<std::string> value;
+};
+
+std::size_t LoadRows(pg::Transaction& trx, const std::vector<IdAndValue>& rows) {
+    return trx.CopyIn("copy_test", {"id", "value"}, rows);
+}
+/// [CopyIn]
+
+/// [CopyOut]
+std::vector<IdAndValue> UnloadRows(pg::Transaction& trx) {
+    std::vector<IdAndValue> result;
+    trx.CopyOut<IdAndValue>("select id, value from copy_test order by id", [&result](IdAndValue&& row) {
+        result.push_back(std::move(row));
+    });
+    return result;
+}
+/// [CopyOut]
+
+std::vector<IdAndValue> MakeRows(int count) {
+    std::vector<IdAndValue> rows;
+    rows.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        rows.push_back({i, i % 10 ? std::optional<std::string>{std::to_string(i)} : std::nullopt});
+    }
+    return rows;
+}
+
+UTEST_P(PostgreConnection, CopyInOut) {
+    CheckConnection(GetConn());
+    GetConn()->Execute("create temporary table copy_test(id integer, value text)");
+
+    // Several chunks of data
+    const auto rows = MakeRows(20000);
+
+    pg::Transaction trx{std::move(GetConn())};
+    std::size_t loaded = 0;
+    UEXPECT_NO_THROW(loaded = LoadRows(trx, rows));
+    EXPECT_EQ(rows.size(), loaded);
+
+    const auto res = trx.Execute("select count(*), count(value) from copy_test");
+    EXPECT_EQ(rows.size(), res.Front()[0].As<pg::Bigint>());
+    EXPECT_EQ(rows.size() - rows.size() / 10, res.Front()[1].As<pg::Bigint>());
+
+    std::vector<IdAndValue> unloaded;
+    UEXPECT_NO_THROW(unloaded = UnloadRows(trx));
+    ASSERT_EQ(rows.size(), unloaded.size());
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        EXPECT_EQ(rows[i].id, unloaded[i].id);
+        EXPECT_EQ(rows[i].value, unloaded[i].value);
+    }
+
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyEmpty) {
+    CheckConnection(GetConn());
+    GetConn()->Execute("create temporary table copy_test(id integer, value text)");
+
+    pg::Transaction trx{std::move(GetConn())};
+    EXPECT_EQ(0, trx.CopyIn("copy_test", {}, std::vector<IdAndValue>{}));
+
+    std::size_t consumed = 0;
+    UEXPECT_NO_THROW(trx.CopyOut<IdAndValue>("select id, value from copy_test", [&consumed](IdAndValue&&) {
+        ++consumed;
+    }));
+    EXPECT_EQ(0, consumed);
+
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopySingleColumn) {
+    CheckConnection(GetConn());
+    GetConn()->Execute("create temporary table copy_test(id bigint)");
+
+    pg::Transaction trx{std::move(GetConn())};
+    const std::vector<pg::Bigint> ids{1, 2, 3};
+    EXPECT_EQ(ids.size(), trx.CopyIn("pg_temp.copy_test", {"id"}, ids));
+
+    std::vector<std::tuple<pg::Bigint>> unloaded;
+    trx.CopyOut<std::tuple<pg::Bigint>>("select id from copy_test order by id", [&unloaded](auto&& row) {
+        unloaded.push_back(std::move(row));
+    });
+    ASSERT_EQ(ids.size(), unloaded.size());
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        EXPECT_EQ(ids[i], std::get<0>(unloaded[i]));
+    }
+
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyErrors) {
+    CheckConnection(GetConn());
+    GetConn()->Execute("create temporary table copy_test(id bigint, value text)");
+
+    pg::Transaction trx{std::move(GetConn())};
+    // No implicit conversions in the binary format
+    UEXPECT_THROW(trx.CopyIn("copy_test", {"id", "value"}, MakeRows(10)), pg::Error);
+    trx.Rollback();
+}
+
+UTEST_P(PostgreConnection, CopyUnknownTable) {
+    CheckConnection(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    UEXPECT_THROW(trx.CopyIn("copy_no_such_table", {}, MakeRows(1)), pg::Error);
+    trx.Rollback();
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -334,6 +334,37 @@ UTEST_P(PostgrePool, MinPool) {
     EXPECT_EQ(0, stats.connection.error_total);
 }
 
+UTEST_P(PostgrePool, MinIdlePool) {
+    auto pool = pg::detail::ConnectionPool::Create(
+        GetDsnFromEnv(),
+        nullptr,
+        GetTaskProcessor(),
+        "",
+        GetParam(),
+        {1, 10, 10, 0, 2},
+        kCachePreparedStatements,
+        {},
+        GetTestCmdCtls(),
+        testsuite::PostgresControl{},
+        error_injection::Settings{},
+        {},
+        dynamic_config::GetDefaultSource()
+    );
+
+    auto conn = pool->Acquire(MakeDeadline());
+    CheckConnection(conn);
+
+    // Spare connections are opened in background
+    const auto deadline = MakeDeadline();
+    while (pool->GetStatistics().connection.active < 3 && !deadline.IsReached()) {
+        engine::SleepFor(std::chrono::milliseconds{10});
+    }
+    const auto& stats = pool->GetStatistics();
+    EXPECT_GE(stats.connection.active, 3);
+    EXPECT_EQ(1, stats.connection.used);
+    EXPECT_EQ(0, stats.connection.error_total);
+}
+
 UTEST_P(PostgrePool, ConnectionCleanup) {
     auto pool = pg::detail::ConnectionPool::Create(
         GetDsnFromEnv(),
@@ -337,6 +337,46 @@ UTEST_F(PostgrePoolStats, MaxPreparedCacheSize) {
 
     auto new_stats = conn->GetStatsAndReset();
     EXPECT_EQ(new_stats.prepared_statements_current, conn_settings.max_prepared_cache_size);
+    EXPECT_EQ(new_stats.prepared_statements_evicted, old_stats.prepared_statements_current + 1);
+}
+
+UTEST_F(PostgrePoolStats, PreparedStatementsWarmup) {
+    pg::ConnectionSettings conn_settings;
+    conn_settings.prepared_statements_warmup = 10;
+
+    auto pool = pg::detail::ConnectionPool::Create(
+        GetDsnFromEnv(),
+        nullptr,
+        GetTaskProcessor(),
+        "",
+        storages::postgres::InitMode::kAsync,
+        {1, 10, 10},
+        conn_settings,
+        {},
+        GetTestCmdCtls(),
+        {},
+        {},
+        {},
+        dynamic_config::GetDefaultSource()
+    );
+
+    {
+        auto conn = pool->Acquire(MakeDeadline());
+        CheckConnection(conn);
+        UEXPECT_NO_THROW(conn->Execute("select 1"));
+        UEXPECT_NO_THROW(conn->Execute("select 2"));
+    }
+
+    // Keep the warm connection busy to make the pool open a new one
+    auto warm_conn = pool->Acquire(MakeDeadline());
+    auto new_conn = pool->Acquire(MakeDeadline());
+    CheckConnection(new_conn);
+    EXPECT_GE(pool->GetStatistics().connection.prepared_statements_warmed_up, 2);
+
+    UEXPECT_NO_THROW(new_conn->Execute("select 1"));
+    UEXPECT_NO_THROW(new_conn->Execute("select 2"));
+    const auto stats = new_conn->GetStatsAndReset();
+    EXPECT_EQ(stats.parse_total, 0);
 }
 
 }  // namespace
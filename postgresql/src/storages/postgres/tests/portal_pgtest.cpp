@@ -177,6 +177,41 @@ UTEST_P(PostgreConnection, PortalFetchAll) {
     UEXPECT_NO_THROW(trx.Commit());
 }
 
+UTEST_P(PostgreConnection, PortalFetchPrefetched) {
+    CheckConnection(GetConn());
+
+    pg::Transaction trx{std::move(GetConn()), pg::TransactionOptions{}};
+    auto cnt = trx.Execute("select count(*) from pg_catalog.pg_type t");
+    auto expectedCount = cnt.Front().As<pg::Bigint>();
+
+    pg::PortalPrefetchSettings settings;
+    settings.chunk_bytes = 1024;
+    settings.initial_chunk_rows = 10;
+
+    {
+        pg::Portal portal{nullptr, "", {}};
+        UEXPECT_NO_THROW(portal = trx.MakePortal(kGetPostgresTypesSQL));
+        std::size_t chunks = 0;
+        std::size_t fetched = 0;
+        while (portal) {
+            fetched += portal.FetchPrefetched(settings).Size();
+            ++chunks;
+        }
+        EXPECT_EQ(expectedCount, fetched);
+        EXPECT_EQ(expectedCount, portal.FetchedSoFar());
+        EXPECT_LT(1, chunks);
+        EXPECT_ANY_THROW(portal.FetchPrefetched(settings));
+    }
+    {
+        // A portal dropped with a chunk in flight leaves the transaction usable
+        auto portal = trx.MakePortal(kGetPostgresTypesSQL);
+        EXPECT_EQ(settings.initial_chunk_rows, portal.FetchPrefetched(settings).Size());
+    }
+
+    UEXPECT_NO_THROW(trx.Execute("select 1"));
+    UEXPECT_NO_THROW(trx.Commit());
+}
+
 UTEST_P(PostgreConnection, PortalStoredParams) {
     CheckConnection(GetConn());
 
@@ -1,5 +1,6 @@
 #include <storages/postgres/tests/util_pgtest.hpp>
 
+#include <userver/storages/postgres/io/bytea.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -155,4 +156,41 @@ UTEST_P(PostgreConnection, ResultAsOptionalSingleRow) {
     UEXPECT_THROW(res.AsOptionalSingleRow<int>(), pg::NonSingleRowResultSet);
 }
 
+UTEST_P(PostgreConnection, ResultAsColumns) {
+    CheckConnection(GetConn());
+
+    pg::ResultSet res{nullptr};
+    UEXPECT_NO_THROW(
+        res = GetConn()->Execute("select i::bigint, i::text, convert_to(i::text, 'UTF8') "
+                                 "from generate_series(1, 100) i")
+    );
+    ASSERT_EQ(100, res.Size());
+
+    using BytesColumn = std::vector<pg::ByteaWrapper<utils::span<const std::byte>>>;
+    auto [ids, texts, bytes] = res.AsColumns<std::vector<std::int64_t>, std::vector<std::string_view>, BytesColumn>();
+    ASSERT_EQ(100, ids.size());
+    ASSERT_EQ(100, texts.size());
+    ASSERT_EQ(100, bytes.size());
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        const auto expected = std::to_string(i + 1);
+        EXPECT_EQ(static_cast<std::int64_t>(i + 1), ids[i]);
+        EXPECT_EQ(expected, texts[i]);
+        EXPECT_EQ(
+            expected,
+            std::string_view(reinterpret_cast<const char*>(bytes[i].bytes.data()), bytes[i].bytes.size())
+        );
+    }
+
+    // Trailing fields may be skipped
+    UEXPECT_NO_THROW(res.AsColumns<std::vector<std::int64_t>>());
+    UEXPECT_THROW(
+        (res.AsColumns<
+            std::vector<std::int64_t>,
+            std::vector<std::string>,
+            std::vector<std::string>,
+            std::vector<std::string>>()),
+        pg::InvalidTupleSizeRequested
+    );
+}
+
 USERVER_NAMESPACE_END
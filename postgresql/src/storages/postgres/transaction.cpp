@@ -81,6 +81,40 @@ ResultSet Transaction::DoExecute(
     }
 }
 
+std::size_t Transaction::DoCopyIn(
+    std::string_view table,
+    const std::vector<std::string>& columns,
+    USERVER_NAMESPACE::utils::function_ref<bool(std::string&)> source,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "CopyIn called after transaction finished" << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    auto source_config = conn_.GetConfigSource();
+    if (source_config) CheckDeadlineIsExpired(source_config->GetSnapshot());
+
+    return conn_->CopyIn(table, columns, source, std::move(statement_cmd_ctl));
+}
+
+void Transaction::DoCopyOut(
+    const Query& query,
+    USERVER_NAMESPACE::utils::function_ref<void(std::string_view)> sink,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "CopyOut called after transaction finished" << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    if (!statement_cmd_ctl) {
+        statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+    }
+    auto source = conn_.GetConfigSource();
+    if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+
+    conn_->CopyOut(query, sink, std::move(statement_cmd_ctl));
+}
+
 Portal Transaction::MakePortal(
     const PortalName& portal_name,
     const Query& query,
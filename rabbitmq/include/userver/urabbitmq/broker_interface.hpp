@@ -4,6 +4,7 @@
 /// @brief A bunch of interface classes
 
 #include <string>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/utils/flags.hpp>
@@ -166,6 +167,25 @@ public:
         engine::Deadline deadline
     ) = 0;
 
+    /// @brief Publish the messages to an exchange and await confirmations
+    /// for all of them from the broker
+    ///
+    /// The messages are published one after another over the same channel
+    /// without waiting for the confirmations in between, so the whole batch
+    /// costs about a single round trip to the broker. The order of the messages
+    /// is kept.
+    ///
+    /// @param exchange the exchange to publish to
+    /// @param messages the messages to send
+    /// @param deadline execution deadline
+    /// @throws std::runtime_error if any of the messages is not confirmed
+    /// within the deadline. Some of the messages may be published anyway.
+    virtual void PublishReliableBatch(
+        const Exchange& exchange,
+        const std::vector<OutgoingMessage>& messages,
+        engine::Deadline deadline
+    ) = 0;
+
 protected:
     ~IReliableChannelInterface();
 };
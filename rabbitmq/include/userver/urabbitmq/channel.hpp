@@ -90,6 +90,12 @@ public:
         PublishReliable(exchange, routing_key, message, MessageType::kTransient, deadline);
     }
 
+    void PublishReliableBatch(
+        const Exchange& exchange,
+        const std::vector<OutgoingMessage>& messages,
+        engine::Deadline deadline
+    ) override;
+
 private:
     utils::FastPimpl<ConnectionPtr, 32, 8> impl_;
 };
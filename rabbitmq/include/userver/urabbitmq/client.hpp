@@ -113,6 +113,12 @@ public:
         PublishReliable(exchange, routing_key, message, MessageType::kTransient, deadline);
     }
 
+    void PublishReliableBatch(
+        const Exchange& exchange,
+        const std::vector<OutgoingMessage>& messages,
+        engine::Deadline deadline
+    ) override;
+
     /// @brief Get a reliable publisher interface for the broker
     /// (publisher-confirms)
     ///
@@ -38,6 +38,8 @@ namespace urabbitmq {
 /// rabbit_name      | Name of the RabbitMQ component to use for consumption
 /// queue            | Name of the queue to consume from
 /// prefetch_count   | prefetch_count for the consumer, limits the amount of in-flight messages
+/// concurrency      | limit for concurrently running message handlers, `prefetch_count` by default
+/// ack_batch_size   | number of processed messages to acknowledge at once, 1 by default
 ///
 // clang-format on
 class ConsumerComponentBase : public components::ComponentBase {
@@ -4,6 +4,7 @@
 /// @brief Consumer settings.
 
 #include <cstddef>
+#include <optional>
 
 #include <userver/urabbitmq/typedefs.hpp>
 
@@ -24,6 +25,23 @@ struct ConsumerSettings final {
     /// Settings this value to 1 basically makes a consumer synchronous, which
     /// could be of use for some workloads
     std::uint16_t prefetch_count;
+
+    /// Limit for concurrently running handlers, `prefetch_count` if not set.
+    ///
+    /// Acknowledging a message takes a round trip to the broker before the
+    /// next message arrives, so with slow handlers it pays off to set
+    /// `prefetch_count` above the concurrency (say, twice as much): the
+    /// messages wait locally and the handlers never stay idle.
+    std::optional<std::uint16_t> concurrency{};
+
+    /// Number of processed messages to acknowledge with a single `basic.ack`
+    /// (with the `multiple` flag). Acknowledgements are sent as soon as this
+    /// many messages in a row (by delivery order) are processed, or when no
+    /// messages are being processed. 1 acknowledges every message separately.
+    ///
+    /// Must not exceed `prefetch_count`. Note that a slow message holds the
+    /// acknowledgements of the messages delivered after it.
+    std::uint16_t ack_batch_size{1};
 };
 
 }  // namespace urabbitmq
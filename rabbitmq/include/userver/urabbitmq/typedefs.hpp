@@ -61,6 +61,14 @@ enum class MessageType {
     kTransient,
 };
 
+/// @brief A message to publish along with its routing key and storage type,
+/// used in batch publishing.
+struct OutgoingMessage {
+    std::string routing_key;
+    std::string message;
+    MessageType type{MessageType::kTransient};
+};
+
 /// @brief Structure holding an AMQP message body along with some of its
 /// metadata fields. This struct is used to pass messages to the end user,
 /// hiding the actual AMQP message object implementation.
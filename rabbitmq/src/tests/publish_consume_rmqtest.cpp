@@ -112,6 +112,27 @@ UTEST(Consumer, ConsumeWorks) {
     EXPECT_EQ(consumed[0], message);
 }
 
+UTEST(Consumer, PublishReliableBatchWorks) {
+    ClientWrapper client{};
+    client.SetupRmqEntities();
+    const urabbitmq::ConsumerSettings settings{client.GetQueue(), 10};
+
+    constexpr size_t kMessagesCount = 20;
+    std::vector<urabbitmq::OutgoingMessage> messages;
+    std::vector<std::string> expected;
+    for (size_t i = 0; i < kMessagesCount; ++i) {
+        expected.push_back(std::to_string(i));
+        messages.push_back({client.GetRoutingKey(), expected.back(), urabbitmq::MessageType::kTransient});
+    }
+    client->PublishReliableBatch(client.GetExchange(), messages, client.GetDeadline());
+
+    Consumer consumer{client.Get(), settings};
+    consumer.ExpectConsume(kMessagesCount);
+
+    consumer.Start();
+    EXPECT_EQ(consumer.Wait(), expected);
+}
+
 UTEST(Consumer, BasicGetWorks) {
     ClientWrapper client{};
     client.SetupRmqEntities();
@@ -153,6 +174,36 @@ UTEST(Consumer, ExhaustesQueue) {
     consumer.Wait();
 }
 
+UTEST(Consumer, BatchedAcksExhaustQueue) {
+    ClientWrapper client{};
+    client.SetupRmqEntities();
+    urabbitmq::ConsumerSettings settings{client.GetQueue(), 20};
+    settings.concurrency = 5;
+    settings.ack_batch_size = 10;
+
+    const size_t messages_count = 1003;
+    std::vector<urabbitmq::OutgoingMessage> messages;
+    for (size_t i = 0; i < messages_count; ++i) {
+        messages.push_back({client.GetRoutingKey(), std::to_string(i), urabbitmq::MessageType::kTransient});
+    }
+    client->PublishReliableBatch(client.GetExchange(), messages, client.GetDeadline());
+
+    {
+        Consumer consumer{client.Get(), settings};
+        consumer.ExpectConsume(messages_count);
+        consumer.Start();
+        ASSERT_EQ(consumer.Wait().size(), messages_count);
+        // The tail of the batch is acknowledged once the handlers are idle
+        engine::InterruptibleSleepFor(std::chrono::milliseconds{200});
+    }
+
+    // Nothing is requeued
+    Consumer consumer{client.Get(), settings};
+    consumer.Start();
+    engine::InterruptibleSleepFor(std::chrono::milliseconds{200});
+    EXPECT_TRUE(consumer.Get().empty());
+}
+
 UTEST(Consumer, ThrowsReturnsToQueue) {
     ClientWrapper client{};
     client.SetupRmqEntities();
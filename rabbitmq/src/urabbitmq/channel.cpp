@@ -45,6 +45,16 @@ void ReliableChannel::PublishReliable(
     ConnectionHelper::PublishReliable(*impl_, exchange, routing_key, message, type, deadline).Wait(deadline);
 }
 
+void ReliableChannel::PublishReliableBatch(
+    const Exchange& exchange,
+    const std::vector<OutgoingMessage>& messages,
+    engine::Deadline deadline
+) {
+    if (messages.empty()) return;
+
+    ConnectionHelper::PublishReliableBatch(*impl_, exchange, messages, deadline).Wait(deadline);
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
@@ -88,6 +88,18 @@ void Client::PublishReliable(
     awaiter.Wait(deadline);
 }
 
+void Client::PublishReliableBatch(
+    const Exchange& exchange,
+    const std::vector<OutgoingMessage>& messages,
+    engine::Deadline deadline
+) {
+    if (messages.empty()) return;
+
+    auto awaiter =
+        ConnectionHelper::PublishReliableBatch(impl_->GetConnection(deadline), exchange, messages, deadline);
+    awaiter.Wait(deadline);
+}
+
 AdminChannel Client::GetAdminChannel(engine::Deadline deadline) { return {impl_->GetConnection(deadline)}; }
 
 Channel Client::GetChannel(engine::Deadline deadline) { return {impl_->GetConnection(deadline)}; }
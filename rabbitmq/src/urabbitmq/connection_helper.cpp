@@ -85,6 +85,17 @@ impl::ResponseAwaiter ConnectionHelper::PublishReliable(
     });
 }
 
+impl::ResponseAwaiter ConnectionHelper::PublishReliableBatch(
+    const ConnectionPtr& connection,
+    const Exchange& exchange,
+    const std::vector<OutgoingMessage>& messages,
+    engine::Deadline deadline
+) {
+    return WithSpan("reliable_publish_batch", [&] {
+        return connection->GetReliableChannel().PublishBatch(exchange, messages, deadline);
+    });
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
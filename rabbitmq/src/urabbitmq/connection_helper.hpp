@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include <userver/engine/deadline.hpp>
 #include <userver/urabbitmq/typedefs.hpp>
 #include <userver/utils/flags.hpp>
@@ -75,6 +77,13 @@ public:
         engine::Deadline deadline
     );
 
+    [[nodiscard]] static impl::ResponseAwaiter PublishReliableBatch(
+        const ConnectionPtr& connection,
+        const Exchange& exchange,
+        const std::vector<OutgoingMessage>& messages,
+        engine::Deadline deadline
+    );
+
 private:
     template <typename Func>
     static impl::ResponseAwaiter WithSpan(const char* name, Func&& fn) {
@@ -1,13 +1,16 @@
 #include "consumer_base_impl.hpp"
 
+#include <algorithm>
 #include <string>
 
 #include <fmt/format.h>
 
+#include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/datetime.hpp>
 
 #include <urabbitmq/connection.hpp>
 #include <urabbitmq/impl/amqp_channel.hpp>
@@ -21,14 +24,28 @@ namespace {
 
 constexpr std::chrono::milliseconds kStartTimeout{2000};
 
+std::chrono::milliseconds ElapsedSince(std::chrono::steady_clock::time_point time_point) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(utils::datetime::SteadyNow() - time_point);
+}
+
+std::optional<std::chrono::milliseconds> GetQueueLag(const AMQP::Message& message) {
+    if (!message.hasTimestamp()) return std::nullopt;
+
+    // AMQP timestamp has a precision of seconds
+    const std::chrono::system_clock::time_point published_at{std::chrono::seconds{message.timestamp()}};
+    return std::chrono::duration_cast<std::chrono::milliseconds>(utils::datetime::Now() - published_at);
+}
+
 }  // namespace
 
 ConsumerBaseImpl::ConsumerBaseImpl(ConnectionPtr&& connection, const ConsumerSettings& settings)
     : dispatcher_{engine::current_task::GetTaskProcessor()},
       queue_name_{settings.queue.GetUnderlying()},
       prefetch_count_{settings.prefetch_count},
+      ack_batch_size_{std::clamp<std::size_t>(settings.ack_batch_size, 1, std::max<std::size_t>(prefetch_count_, 1))},
       connection_ptr_{std::move(connection)},
-      channel_{connection_ptr_->GetChannel()} {
+      channel_{connection_ptr_->GetChannel()},
+      handlers_semaphore_{std::max<std::size_t>(settings.concurrency.value_or(prefetch_count_), 1)} {
     // We take ownership of the connection, because if it remains pooled
     // things get messy with lifetimes and callbacks
     connection_ptr_.Adopt();
@@ -90,6 +107,12 @@ void ConsumerBaseImpl::Stop() {
 bool ConsumerBaseImpl::IsBroken() const { return broken_ || !connection_ptr_.IsUsable(); }
 
 void ConsumerBaseImpl::OnMessage(const AMQP::Message& message, uint64_t delivery_tag) {
+    const auto delivered_at = utils::datetime::SteadyNow();
+    const auto queue_lag = GetQueueLag(message);
+    if (ack_batch_size_ > 1) {
+        ack_state_.Lock()->unacked.emplace(delivery_tag, std::nullopt);
+    }
+
     std::string span_name{fmt::format("consume_{}_{}", queue_name_, consumer_tag_.value_or("ctag:unknown"))};
     std::string trace_id = message.headers().get("u-trace-id");
     std::string parent_span_id = message.headers().get("u-parent-span-id");
@@ -105,7 +128,16 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message, uint64_t delivery
          span_name = std::move(span_name),
          trace_id = std::move(trace_id),
          parent_span_id = std::move(parent_span_id),
-         delivery_tag]() mutable {
+         delivery_tag,
+         delivered_at,
+         queue_lag]() mutable {
+            const engine::SemaphoreLock handler_lock{handlers_semaphore_};
+            // The consumer is stopping, the message will be requeued
+            if (engine::current_task::ShouldCancel()) return;
+
+            const auto dispatch_lag = ElapsedSince(delivered_at);
+            const auto handler_start = utils::datetime::SteadyNow();
+
             auto span = tracing::Span::MakeSpan(std::move(span_name), trace_id, {parent_span_id});
             bool success = false;
             try {
@@ -114,22 +146,62 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message, uint64_t delivery
             } catch (const std::exception& ex) {
                 LOG_ERROR() << "Failed to process the consumed message, " << ex.what() << "; would requeue";
             }
+            channel_.GetStatistics().AccountMessageHandled(ElapsedSince(handler_start), dispatch_lag, queue_lag);
 
-            try {
-                if (success) {
-                    channel_.Ack(delivery_tag, {});
-                    channel_.AccountMessageConsumed();
-                } else {
-                    channel_.Reject(delivery_tag, true, {});
-                }
-            } catch (const std::exception& ex) {
-                LOG_WARNING() << "Failed to " << (success ? "ack" : "requeue")
-                              << " the message, it will be requeued by RabbitMQ at some point";
-            }
+            OnProcessed(delivery_tag, success);
         }
     ));
 }
 
+void ConsumerBaseImpl::OnProcessed(uint64_t delivery_tag, bool success) {
+    try {
+        if (!success) {
+            // Rejected before being marked as processed, so that a subsequent
+            // multiple ack doesn't cover it
+            channel_.Reject(delivery_tag, true, {});
+            channel_.GetStatistics().AccountMessageRequeued();
+        } else if (ack_batch_size_ == 1) {
+            channel_.Ack(delivery_tag, {});
+        }
+        if (ack_batch_size_ > 1) {
+            FlushAcks(delivery_tag, success);
+        }
+        if (success) {
+            channel_.AccountMessageConsumed();
+        }
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to " << (success ? "ack" : "requeue")
+                      << " the message, it will be requeued by RabbitMQ at some point";
+    }
+}
+
+void ConsumerBaseImpl::FlushAcks(uint64_t processed_tag, bool success) {
+    const std::lock_guard ack_lock{ack_mutex_};
+
+    std::optional<uint64_t> tag_to_ack;
+    {
+        auto state = ack_state_.Lock();
+        state->unacked[processed_tag] = success;
+        while (!state->unacked.empty() && state->unacked.begin()->second.has_value()) {
+            const auto [tag, succeeded] = *state->unacked.begin();
+            if (*succeeded) state->ack_candidate = tag;
+            ++state->pending_acks;
+            state->unacked.erase(state->unacked.begin());
+        }
+        // Nothing is being processed, no reason to hold the acks any longer
+        if (state->ack_candidate.has_value() &&
+            (state->pending_acks >= ack_batch_size_ || state->unacked.empty())) {
+            tag_to_ack = std::exchange(state->ack_candidate, std::nullopt);
+            state->pending_acks = 0;
+        }
+    }
+
+    // Rejected messages are already settled, the multiple ack skips them
+    if (tag_to_ack.has_value()) {
+        channel_.AckMultiple(*tag_to_ack, {});
+    }
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
@@ -1,8 +1,15 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
 
 #include <userver/concurrent/background_task_storage.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <urabbitmq/connection_ptr.hpp>
@@ -31,12 +38,24 @@ public:
     bool IsBroken() const;
 
 private:
+    // Delivery tags of the messages not acknowledged yet, in delivery order
+    struct AckState final {
+        // delivery tag -> whether the processing succeeded, if finished
+        std::map<uint64_t, std::optional<bool>> unacked;
+        // the highest succeeded tag that all the previous tags are finished up to
+        std::optional<uint64_t> ack_candidate;
+        std::size_t pending_acks{0};
+    };
+
     void OnMessage(const AMQP::Message& message, uint64_t delivery_tag);
+    void OnProcessed(uint64_t delivery_tag, bool success);
+    void FlushAcks(uint64_t processed_tag, bool success);
     void Stop();
 
     engine::TaskProcessor& dispatcher_;
     const std::string queue_name_;
     uint16_t prefetch_count_;
+    std::size_t ack_batch_size_;
 
     ConnectionPtr connection_ptr_;
     impl::AmqpChannel& channel_;
@@ -45,6 +64,12 @@ private:
 
     DispatchCallback dispatch_callback_;
 
+    engine::Semaphore handlers_semaphore_;
+    concurrent::Variable<AckState, std::mutex> ack_state_;
+    // Serializes multiple acks so that they are sent in ascending order.
+    // Never taken in the channel callbacks, those run under the connection lock
+    engine::Mutex ack_mutex_;
+
     std::atomic<bool> stopped_{false};
 
     // Underlying channel errored, just restart the consumer
@@ -18,7 +18,15 @@ ConsumerSettings Parse(const yaml_config::YamlConfig& config, formats::parse::To
     settings.queue = Queue{config["queue"].As<std::string>()};
     settings.prefetch_count = config["prefetch_count"].As<uint16_t>();
 
+    settings.concurrency = config["concurrency"].As<std::optional<uint16_t>>();
+    settings.ack_batch_size = config["ack_batch_size"].As<uint16_t>(settings.ack_batch_size);
+
     UINVARIANT(settings.prefetch_count > 0, "prefetch_count is set to zero");
+    UINVARIANT(settings.concurrency.value_or(1) > 0, "concurrency is set to zero");
+    UINVARIANT(
+        settings.ack_batch_size > 0 && settings.ack_batch_size <= settings.prefetch_count,
+        "ack_batch_size must be in [1; prefetch_count]"
+    );
 
     return settings;
 }
@@ -81,6 +89,16 @@ properties:
     prefetch_count:
         type: integer
         description: prefetch_count for the consumer
+    concurrency:
+        type: integer
+        description: limit for concurrently running message handlers
+        defaultDescription: prefetch_count
+        minimum: 1
+    ack_batch_size:
+        type: integer
+        description: number of processed messages to acknowledge at once
+        defaultDescription: 1
+        minimum: 1
 )");
 }
 
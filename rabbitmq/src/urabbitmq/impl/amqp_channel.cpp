@@ -1,5 +1,6 @@
 #include "amqp_channel.hpp"
 
+#include <chrono>
 #include <optional>
 
 #include <userver/engine/task/task.hpp>
@@ -59,6 +60,13 @@ int Convert(utils::Flags<Exchange::Flags> flags) {
     return result;
 }
 
+void SetPublishTimestamp(AMQP::Envelope& envelope) {
+    // AMQP timestamp has a precision of seconds
+    envelope.setTimestamp(
+        std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count()
+    );
+}
+
 AMQP::Table CreateHeaders() {
     UASSERT(engine::current_task::IsTaskProcessorThread());
 
@@ -172,6 +180,7 @@ void AmqpChannel::Publish(
     AMQP::Envelope envelope{message.data(), message.size()};
     envelope.setPersistent(type == MessageType::kPersistent);
     envelope.setHeaders(CreateHeaders());
+    SetPublishTimestamp(envelope);
 
     {
         auto channel = conn_.GetChannel(deadline);
@@ -191,6 +200,12 @@ void AmqpChannel::Ack(uint64_t delivery_tag, engine::Deadline deadline) {
     channel->ack(delivery_tag);
 }
 
+void AmqpChannel::AckMultiple(uint64_t delivery_tag, engine::Deadline deadline) {
+    // No way to acknowledge success, no way to handle synchronous errors
+    auto channel = conn_.GetChannel(deadline);
+    channel->ack(delivery_tag, AMQP::multiple);
+}
+
 void AmqpChannel::Reject(uint64_t delivery_tag, bool requeue, engine::Deadline deadline) {
     // No way to acknowledge success, no way to handle synchronous errors
     auto channel = conn_.GetChannel(deadline);
@@ -231,6 +246,8 @@ void AmqpChannel::CancelConsumer(const std::optional<std::string>& consumer_tag)
 
 void AmqpChannel::AccountMessageConsumed() { conn_.GetStatistics().AccountMessageConsumed(); }
 
+statistics::ConnectionStatistics& AmqpChannel::GetStatistics() { return conn_.GetStatistics(); }
+
 AmqpReliableChannel::AmqpReliableChannel(AmqpConnection& conn) : conn_{conn} {}
 
 AmqpReliableChannel::~AmqpReliableChannel() = default;
@@ -245,6 +262,7 @@ ResponseAwaiter AmqpReliableChannel::Publish(
     AMQP::Envelope envelope{message.data(), message.size()};
     envelope.setPersistent(type == MessageType::kPersistent);
     envelope.setHeaders(CreateHeaders());
+    SetPublishTimestamp(envelope);
 
     auto awaiter = conn_.GetAwaiter(deadline);
 
@@ -262,6 +280,41 @@ ResponseAwaiter AmqpReliableChannel::Publish(
     return awaiter;
 }
 
+ResponseAwaiter AmqpReliableChannel::PublishBatch(
+    const Exchange& exchange,
+    const std::vector<OutgoingMessage>& messages,
+    engine::Deadline deadline
+) {
+    UASSERT(!messages.empty());
+
+    const auto headers = CreateHeaders();
+    auto awaiter = conn_.GetAwaiter(deadline);
+    const auto& deferred = awaiter.GetWrapper();
+    deferred->ExpectOks(messages.size());
+
+    {
+        auto reliable = conn_.GetReliableChannel(deadline);
+
+        // Confirms are tracked by the delivery tags in AMQP::Reliable, so all
+        // the messages are in flight at once
+        for (const auto& message : messages) {
+            AMQP::Envelope envelope{message.message.data(), message.message.size()};
+            envelope.setPersistent(message.type == MessageType::kPersistent);
+            envelope.setHeaders(headers);
+            SetPublishTimestamp(envelope);
+
+            reliable->publish(exchange.GetUnderlying(), message.routing_key, envelope)
+                .onAck([this, deferred] {
+                    AccountMessagePublished();
+                    deferred->Ok();
+                })
+                .onError([deferred](const char* error) { deferred->Fail(error); });
+        }
+    }
+
+    return awaiter;
+}
+
 void AmqpReliableChannel::AccountMessagePublished() { conn_.GetStatistics().AccountMessagePublished(); }
 
 }  // namespace urabbitmq::impl
@@ -2,6 +2,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/utils/assert.hpp>
@@ -62,6 +63,9 @@ public:
 
     void Ack(uint64_t delivery_tag, engine::Deadline deadline);
 
+    /// Acknowledges all the messages up to and including `delivery_tag`
+    void AckMultiple(uint64_t delivery_tag, engine::Deadline deadline);
+
     void Reject(uint64_t delivery_tag, bool requeue, engine::Deadline deadline);
 
     void SetQos(uint16_t prefetch_count, engine::Deadline deadline);
@@ -81,6 +85,7 @@ public:
 
 private:
     void AccountMessageConsumed();
+    statistics::ConnectionStatistics& GetStatistics();
 
     friend class urabbitmq::ConsumerBaseImpl;
 
@@ -100,6 +105,11 @@ public:
         engine::Deadline deadline
     );
 
+    /// Publishes all the `messages` under a single channel lock, the returned
+    /// awaiter completes when all of them are confirmed or any of them fails
+    ResponseAwaiter
+    PublishBatch(const Exchange& exchange, const std::vector<OutgoingMessage>& messages, engine::Deadline deadline);
+
 private:
     void AccountMessagePublished();
 
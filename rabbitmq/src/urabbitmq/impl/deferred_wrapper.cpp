@@ -19,11 +19,17 @@ void DeferredWrapper::Fail(const char* message) {
 
 void DeferredWrapper::Ok() {
     if (is_signaled_) return;
+    if (pending_oks_.fetch_sub(1) != 1) return;
 
     is_signaled_.store(true);
     event_.Send();
 }
 
+void DeferredWrapper::ExpectOks(std::size_t count) {
+    UASSERT(count > 0);
+    pending_oks_.store(count);
+}
+
 void DeferredWrapper::Wait(engine::Deadline deadline) {
     if (!event_.WaitForEventUntil(deadline)) {
         throw std::runtime_error{"Operation timeout"};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <string>
@@ -25,6 +27,10 @@ public:
 
     void Ok();
 
+    /// Makes the wrapper signaled only after `count` calls to Ok() (or the
+    /// first Fail()). Must be called before the wrapper is handed out.
+    void ExpectOks(std::size_t count);
+
     void Wait(engine::Deadline deadline);
 
     void Wrap(AMQP::Deferred& deferred);
@@ -38,6 +44,7 @@ protected:
 
 private:
     std::atomic<bool> is_signaled_{false};
+    std::atomic<std::size_t> pending_oks_{1};
     engine::SingleConsumerEvent event_;
     std::optional<std::string> error_;
 };
@@ -1,5 +1,7 @@
 #include "connection_statistics.hpp"
 
+#include <algorithm>
+
 #include <userver/formats/json.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,6 +20,22 @@ void ConnectionStatistics::AccountMessagePublished() { ++messages_published_; }
 
 void ConnectionStatistics::AccountMessageConsumed() { ++messages_consumed_; }
 
+void ConnectionStatistics::AccountMessageRequeued() { ++messages_requeued_; }
+
+void ConnectionStatistics::AccountMessageHandled(
+    std::chrono::milliseconds handler_time,
+    std::chrono::milliseconds dispatch_lag,
+    std::optional<std::chrono::milliseconds> queue_lag
+) {
+    handler_time_ms_ += handler_time.count();
+    dispatch_lag_ms_ += dispatch_lag.count();
+    if (queue_lag.has_value()) {
+        // Clocks of the publisher and the consumer may differ
+        queue_lag_ms_ += std::max<std::chrono::milliseconds::rep>(queue_lag->count(), 0);
+        ++messages_with_queue_lag_;
+    }
+}
+
 ConnectionStatistics::Frozen ConnectionStatistics::Get() const {
     Frozen result{};
     result.connections_created = connections_created_.Load();
@@ -26,6 +44,11 @@ ConnectionStatistics::Frozen ConnectionStatistics::Get() const {
     result.bytes_read = bytes_read_.Load();
     result.messages_published = messages_published_.Load();
     result.messages_consumed = messages_consumed_.Load();
+    result.messages_requeued = messages_requeued_.Load();
+    result.handler_time_ms = handler_time_ms_.Load();
+    result.dispatch_lag_ms = dispatch_lag_ms_.Load();
+    result.queue_lag_ms = queue_lag_ms_.Load();
+    result.messages_with_queue_lag = messages_with_queue_lag_.Load();
 
     return result;
 }
@@ -37,6 +60,11 @@ ConnectionStatistics::Frozen& ConnectionStatistics::Frozen::operator+=(const Fro
     bytes_read += other.bytes_read;
     messages_published += other.messages_published;
     messages_consumed += other.messages_consumed;
+    messages_requeued += other.messages_requeued;
+    handler_time_ms += other.handler_time_ms;
+    dispatch_lag_ms += other.dispatch_lag_ms;
+    queue_lag_ms += other.queue_lag_ms;
+    messages_with_queue_lag += other.messages_with_queue_lag;
 
     return *this;
 }
@@ -48,6 +76,11 @@ void DumpMetric(utils::statistics::Writer& writer, const ConnectionStatistics::F
     writer["bytes_read"] = value.bytes_read;
     writer["messages_published"] = value.messages_published;
     writer["messages_consumed"] = value.messages_consumed;
+    writer["messages_requeued"] = value.messages_requeued;
+    writer["handler_time_ms"] = value.handler_time_ms;
+    writer["dispatch_lag_ms"] = value.dispatch_lag_ms;
+    writer["queue_lag_ms"] = value.queue_lag_ms;
+    writer["messages_with_queue_lag"] = value.messages_with_queue_lag;
 }
 
 }  // namespace urabbitmq::statistics
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <cstddef>
+#include <optional>
 
 #include <userver/utils/statistics/relaxed_counter.hpp>
 #include <userver/utils/statistics/writer.hpp>
@@ -19,6 +21,16 @@ public:
 
     void AccountMessagePublished();
     void AccountMessageConsumed();
+    void AccountMessageRequeued();
+
+    /// `dispatch_lag` is the time the delivered message waited for a free
+    /// handler, `queue_lag` is the time since the message was published (if
+    /// the publisher has set the timestamp)
+    void AccountMessageHandled(
+        std::chrono::milliseconds handler_time,
+        std::chrono::milliseconds dispatch_lag,
+        std::optional<std::chrono::milliseconds> queue_lag
+    );
 
     struct Frozen final {
         Frozen& operator+=(const Frozen& other);
@@ -31,6 +43,12 @@ public:
 
         size_t messages_published{0};
         size_t messages_consumed{0};
+        size_t messages_requeued{0};
+
+        size_t handler_time_ms{0};
+        size_t dispatch_lag_ms{0};
+        size_t queue_lag_ms{0};
+        size_t messages_with_queue_lag{0};
     };
     Frozen Get() const;
 
@@ -43,6 +61,12 @@ private:
 
     utils::statistics::RelaxedCounter<size_t> messages_published_{0};
     utils::statistics::RelaxedCounter<size_t> messages_consumed_{0};
+    utils::statistics::RelaxedCounter<size_t> messages_requeued_{0};
+
+    utils::statistics::RelaxedCounter<size_t> handler_time_ms_{0};
+    utils::statistics::RelaxedCounter<size_t> dispatch_lag_ms_{0};
+    utils::statistics::RelaxedCounter<size_t> queue_lag_ms_{0};
+    utils::statistics::RelaxedCounter<size_t> messages_with_queue_lag_{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const ConnectionStatistics::Frozen& value);
@@ -0,0 +1,37 @@
+#include "allocation_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::bench {
+
+namespace {
+
+std::atomic<std::uint64_t> allocations_count{0};
+
+}  // namespace
+
+std::uint64_t GetAllocationsCount() noexcept { return allocations_count.load(std::memory_order_relaxed); }
+
+}  // namespace storages::redis::bench
+
+USERVER_NAMESPACE_END
+
+// Replacements of the global allocation functions for counting the
+// allocations. The array and nothrow forms call these ones.
+void* operator new(std::size_t size) {
+    USERVER_NAMESPACE::storages::redis::bench::allocations_count.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) size = 1;
+    // NOLINTNEXTLINE(hicpp-no-malloc,cppcoreguidelines-no-malloc)
+    if (void* ptr = std::malloc(size)) return ptr;
+    throw std::bad_alloc{};
+}
+
+// NOLINTNEXTLINE(hicpp-no-malloc,cppcoreguidelines-no-malloc)
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+// NOLINTNEXTLINE(hicpp-no-malloc,cppcoreguidelines-no-malloc)
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::bench {
+
+/// Number of the global operator new calls made by all the threads of the
+/// process, including the driver event loop threads
+std::uint64_t GetAllocationsCount() noexcept;
+
+}  // namespace storages::redis::bench
+
+USERVER_NAMESPACE_END
@@ -1,14 +1,22 @@
+#include <atomic>
+#include <chrono>
 #include <deque>
 #include <string>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
 #include <storages/redis/client_impl.hpp>
-#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_all_checked.hpp>
 #include <userver/storages/redis/base.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/datetime.hpp>
 #include <userver/utils/rand.hpp>
 #include <utils/gbench_auxilary.hpp>
 
+#include "allocation_counter.hpp"
 #include "redis_fixture.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -19,57 +27,191 @@ using USERVER_NAMESPACE::storages::redis::CommandControl;
 
 namespace {
 
+constexpr int kKeysCount = 1000;
+constexpr std::chrono::seconds kDeliveryTimeout{10};
+constexpr std::size_t kSubscriptionQueueLength = 1'000'000;
+const std::string kChannel = "bench-channel";
+
+std::string MakeKey() { return "key" + std::to_string(utils::Rand() % kKeysCount); }
+
 struct Ping {
     using RequestType = RequestPing;
     ClientPtr client;
     CommandControl cc;
 
+    void Prepare(benchmark::State&) const {}
+
     RequestType operator()(benchmark::State&) const { return client->Ping(0, cc); }
 };
 
+// Value size is the second benchmark argument
 struct Set {
     using RequestType = RequestSet;
     ClientPtr client;
     CommandControl cc;
 
+    void Prepare(benchmark::State&) const {}
+
     RequestType operator()(benchmark::State& state) const {
-        auto key = "key" + std::to_string(utils::Rand() % state.range(0));
-        auto value = std::string(state.range(1), 'x');
-        return client->Set(std::move(key), std::move(value), cc);
+        return client->Set(MakeKey(), std::string(state.range(1), 'x'), cc);
     }
 };
 
-}  // namespace
+// Value size is the second benchmark argument
+struct Get {
+    using RequestType = RequestGet;
+    ClientPtr client;
+    CommandControl cc;
 
-BENCHMARK_DEFINE_TEMPLATE_F(Redis, PipelineGrind)(benchmark::State& state) {
-    RunStandalone([this, &state] {
-        auto request_generator = T{GetClient(), {}};
-        std::deque<typename T::RequestType> requests;
+    void Prepare(benchmark::State& state) const {
+        const auto value = std::string(state.range(1), 'x');
+        for (int i = 0; i < kKeysCount; ++i) client->Set("key" + std::to_string(i), value, cc).Get();
+    }
 
-        for (auto i = 0; i < state.range(0); ++i) {
-            requests.push_back(request_generator(state));
-        }
+    RequestType operator()(benchmark::State&) const { return client->Get(MakeKey(), cc); }
+};
 
-        for (auto _ : state) {
-            requests.front().Get();
-            requests.pop_front();
-            requests.push_back(request_generator(state));
-        }
+void ReportDriverStatistics(benchmark::State& state, const SentinelPtr& sentinel, std::uint64_t allocations_before) {
+    const auto stats = sentinel->GetStatistics({});
+    const auto total = stats.GetShardGroupTotalStatistics();
+    const auto& timings = total.timings_percentile;
+    for (auto p : {50, 95, 99, 100}) {
+        state.counters["p" + std::to_string(p)] = timings.GetPercentile(p);
+    }
+
+    state.counters["allocs_per_op"] = benchmark::Counter(
+        static_cast<double>(GetAllocationsCount() - allocations_before),
+        benchmark::Counter::kAvgIterations
+    );
+}
 
-        for (; !requests.empty(); requests.pop_front()) requests.front().Get();
+// Keeps state.range(0) requests in flight, a depth of 1 sends the requests
+// one by one
+template <typename Generator>
+void PipelineGrind(benchmark::State& state, const ClientPtr& client, const SentinelPtr& sentinel) {
+    auto request_generator = Generator{client, {}};
+    request_generator.Prepare(state);
+    std::deque<typename Generator::RequestType> requests;
+
+    const auto allocations_before = GetAllocationsCount();
+    for (auto i = 0; i < state.range(0); ++i) {
+        requests.push_back(request_generator(state));
+    }
+
+    for (auto _ : state) {
+        requests.front().Get();
+        requests.pop_front();
+        requests.push_back(request_generator(state));
+    }
 
-        const auto stats = GetSentinel()->GetStatistics({});
-        const auto total = stats.GetShardGroupTotalStatistics();
-        const auto& timings = total.timings_percentile;
-        for (auto p : {95, 99, 100}) {
-            state.counters["p" + std::to_string(p)] = timings.GetPercentile(p);
+    for (; !requests.empty(); requests.pop_front()) requests.front().Get();
+
+    ReportDriverStatistics(state, sentinel, allocations_before);
+}
+
+// Runs state.range(0) tasks, each of them waits for its request before
+// sending the next one
+template <typename Generator>
+void ConcurrentGrind(benchmark::State& state, const ClientPtr& client, const SentinelPtr& sentinel) {
+    auto request_generator = Generator{client, {}};
+    request_generator.Prepare(state);
+    const auto concurrency = state.range(0);
+
+    const auto allocations_before = GetAllocationsCount();
+    for (auto _ : state) {
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve(concurrency);
+        for (auto i = 0; i < concurrency; ++i) {
+            tasks.push_back(utils::Async("request", [&request_generator, &state] { request_generator(state).Get(); }));
         }
+        engine::WaitAllChecked(tasks);
+    }
+    state.SetItemsProcessed(state.iterations() * concurrency);
+
+    ReportDriverStatistics(state, sentinel, allocations_before);
+}
+
+// Publishes messages of state.range(0) bytes and waits for all of them to
+// reach the subscriber
+void SubscriptionThroughput(
+    benchmark::State& state,
+    const ClientPtr& client,
+    const SubscribeClientPtr& subscribe_client
+) {
+    const auto message = std::string(state.range(0), 'x');
+    std::atomic<std::size_t> received{0};
+    auto token = subscribe_client->Subscribe(kChannel, [&received](const std::string&, const std::string&) {
+        received.fetch_add(1, std::memory_order_relaxed);
     });
+    token.SetMaxQueueLength(kSubscriptionQueueLength);
+
+    // Subscription is asynchronous, wait for the first message to come through
+    while (received.load() == 0) {
+        client->Publish(kChannel, message, {});
+        engine::SleepFor(std::chrono::milliseconds{10});
+    }
+    received = 0;
+
+    const auto allocations_before = GetAllocationsCount();
+    std::size_t published = 0;
+    for (auto _ : state) {
+        client->Publish(kChannel, message, {});
+        ++published;
+    }
+
+    const auto deadline = utils::datetime::SteadyNow() + kDeliveryTimeout;
+    while (received.load() < published && utils::datetime::SteadyNow() < deadline) {
+        engine::SleepFor(std::chrono::milliseconds{1});
+    }
+    token.Unsubscribe();
+
+    state.SetItemsProcessed(received.load());
+    state.SetBytesProcessed(received.load() * message.size());
+    state.counters["lost"] = static_cast<double>(published - std::min<std::size_t>(received.load(), published));
+    state.counters["allocs_per_op"] = benchmark::Counter(
+        static_cast<double>(GetAllocationsCount() - allocations_before),
+        benchmark::Counter::kAvgIterations
+    );
 }
 
-BENCHMARK_INSTANTIATE_TEMPLATE_F(Redis, PipelineGrind, Ping)->RangeMultiplier(2)->Range(4, 32);
+}  // namespace
+
+BENCHMARK_DEFINE_TEMPLATE_F(Redis, PipelineGrind)(benchmark::State& state) {
+    RunStandalone([this, &state] { bench::PipelineGrind<T>(state, GetClient(), GetSentinel()); });
+}
+
+BENCHMARK_DEFINE_TEMPLATE_F(RedisCluster, PipelineGrind)(benchmark::State& state) {
+    RunStandalone([this, &state] { bench::PipelineGrind<T>(state, GetClient(), GetSentinel()); });
+}
+
+BENCHMARK_DEFINE_TEMPLATE_F(Redis, ConcurrentGrind)(benchmark::State& state) {
+    RunStandalone([this, &state] { bench::ConcurrentGrind<T>(state, GetClient(), GetSentinel()); });
+}
+
+BENCHMARK_DEFINE_TEMPLATE_F(RedisCluster, ConcurrentGrind)(benchmark::State& state) {
+    RunStandalone([this, &state] { bench::ConcurrentGrind<T>(state, GetClient(), GetSentinel()); });
+}
+
+BENCHMARK_DEFINE_F(Redis, SubscriptionThroughput)(benchmark::State& state) {
+    RunStandalone([this, &state] { bench::SubscriptionThroughput(state, GetClient(), GetSubscribeClient()); });
+}
+
+// Pipeline depth
+BENCHMARK_INSTANTIATE_TEMPLATE_F(Redis, PipelineGrind, Ping)->RangeMultiplier(2)->Range(1, 32);
+BENCHMARK_INSTANTIATE_TEMPLATE_F(RedisCluster, PipelineGrind, Ping)->RangeMultiplier(2)->Range(1, 32);
+
+// Pipeline depth x value size
+BENCHMARK_INSTANTIATE_TEMPLATE_F(Redis, PipelineGrind, Set)->ArgsProduct({{1, 16, 32}, {16, 1024, 64 * 1024}});
+BENCHMARK_INSTANTIATE_TEMPLATE_F(Redis, PipelineGrind, Get)->ArgsProduct({{1, 16, 32}, {16, 1024, 64 * 1024}});
+BENCHMARK_INSTANTIATE_TEMPLATE_F(RedisCluster, PipelineGrind, Set)->ArgsProduct({{1, 16, 32}, {16, 1024, 64 * 1024}});
+BENCHMARK_INSTANTIATE_TEMPLATE_F(RedisCluster, PipelineGrind, Get)->ArgsProduct({{1, 16, 32}, {16, 1024, 64 * 1024}});
+
+// Concurrent tasks x value size
+BENCHMARK_INSTANTIATE_TEMPLATE_F(Redis, ConcurrentGrind, Get)->ArgsProduct({{1, 8, 64}, {16, 1024}});
+BENCHMARK_INSTANTIATE_TEMPLATE_F(RedisCluster, ConcurrentGrind, Get)->ArgsProduct({{1, 8, 64}, {16, 1024}});
 
-BENCHMARK_INSTANTIATE_TEMPLATE_F(Redis, PipelineGrind, Set)->Args({16, 1024})->Args({32, 1024});
+// Message size
+BENCHMARK_REGISTER_F(Redis, SubscriptionThroughput)->RangeMultiplier(16)->Range(16, 64 * 1024);
 
 }  // namespace storages::redis::bench
 
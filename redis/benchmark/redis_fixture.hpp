@@ -2,11 +2,13 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 
 #include <benchmark/benchmark.h>
 
 #include <storages/redis/client_impl.hpp>
 #include <storages/redis/impl/sentinel.hpp>
+#include <storages/redis/utest/impl/redis_connection_state.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,18 +16,41 @@ namespace storages::redis::bench {
 
 using SentinelPtr = std::shared_ptr<storages::redis::impl::Sentinel>;
 
-class Redis : public benchmark::Fixture {
+/// Runs the payload in a coroutine environment with enough worker threads
+void RunInCoroutine(std::function<void()> payload);
+
+/// Flushes the databases of all the shards
+void FlushAll(storages::redis::impl::Sentinel& sentinel);
+
+template <typename ConnectionState>
+class RedisFixture : public benchmark::Fixture {
 protected:
-    ClientPtr GetClient() const noexcept { return client_; };
-    SentinelPtr GetSentinel() const noexcept { return sentinel_; };
+    ClientPtr GetClient() const noexcept { return state_->GetClient(); };
+    SubscribeClientPtr GetSubscribeClient() const noexcept { return state_->GetSubscribeClient(); };
+    SentinelPtr GetSentinel() const noexcept { return state_->GetSentinel(); };
+
+    void RunStandalone(std::function<void()> payload) {
+        RunInCoroutine([&] {
+            state_.emplace();
+            FlushAll(*GetSentinel());
 
-    void RunStandalone(std::function<void()> payload);
+            payload();
+
+            state_.reset();
+        });
+    }
 
 private:
-    ClientPtr client_;
-    SentinelPtr sentinel_;
+    struct State : ConnectionState {
+        using ConnectionState::GetSentinel;
+    };
+
+    std::optional<State> state_;
 };
 
+using Redis = RedisFixture<storages::redis::utest::impl::RedisConnectionState>;
+using RedisCluster = RedisFixture<storages::redis::utest::impl::RedisClusterConnectionState>;
+
 }  // namespace storages::redis::bench
 
 USERVER_NAMESPACE_END
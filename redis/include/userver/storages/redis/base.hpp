@@ -77,10 +77,12 @@ struct MetricsSettings {
         bool command_timings_enabled{false};
         bool request_sizes_enabled{false};
         bool reply_sizes_enabled{false};
+        bool batch_sizes_enabled{false};
 
         constexpr bool operator==(const DynamicSettings& rhs) const {
             return timings_enabled == rhs.timings_enabled && command_timings_enabled == rhs.command_timings_enabled &&
-                   request_sizes_enabled == rhs.request_sizes_enabled && reply_sizes_enabled == rhs.reply_sizes_enabled;
+                   request_sizes_enabled == rhs.request_sizes_enabled &&
+                   reply_sizes_enabled == rhs.reply_sizes_enabled && batch_sizes_enabled == rhs.batch_sizes_enabled;
         }
 
         constexpr bool operator!=(const DynamicSettings& rhs) const { return !(*this == rhs); }
@@ -116,6 +118,7 @@ struct MetricsSettings {
     bool IsCommandTimingsEnabled() const { return dynamic_settings.command_timings_enabled; }
     bool IsRequestSizesEnabled() const { return dynamic_settings.request_sizes_enabled; }
     bool IsReplySizesEnabled() const { return dynamic_settings.reply_sizes_enabled; }
+    bool IsBatchSizesEnabled() const { return dynamic_settings.batch_sizes_enabled; }
 };
 
 struct PubsubMetricsSettings {
@@ -239,8 +239,12 @@ public:
 
     virtual RequestLtrim Ltrim(std::string key, int64_t start, int64_t stop, const CommandControl& command_control) = 0;
 
+    /// Keys of different shards or cluster hash slots are requested in
+    /// parallel, one request per group, and the reply is in the order of keys.
     virtual RequestMget Mget(std::vector<std::string> keys, const CommandControl& command_control) = 0;
 
+    /// Pairs of different shards or cluster hash slots are set in parallel,
+    /// one request per group, so the command is atomic only within a group.
     virtual RequestMset
     Mset(std::vector<std::pair<std::string, std::string>> key_values, const CommandControl& command_control) = 0;
 
@@ -333,6 +337,44 @@ public:
 
     virtual RequestType Type(std::string key, const CommandControl& command_control) = 0;
 
+    /// `XACK key group id [id ...]`, returns the number of acknowledged entries
+    virtual RequestXack
+    Xack(std::string key, std::string group, std::vector<std::string> ids, const CommandControl& command_control) = 0;
+
+    /// `XAUTOCLAIM key group consumer min-idle-time start COUNT count`
+    virtual RequestXautoclaim Xautoclaim(
+        std::string key,
+        std::string group,
+        std::string consumer,
+        std::chrono::milliseconds min_idle_time,
+        std::string start,
+        size_t count,
+        const CommandControl& command_control
+    ) = 0;
+
+    /// `XGROUP CREATE key group id [MKSTREAM]`, an existing group is not an
+    /// error
+    virtual RequestXgroupCreate XgroupCreate(
+        std::string key,
+        std::string group,
+        std::string id,
+        bool mkstream,
+        const CommandControl& command_control
+    ) = 0;
+
+    /// `XREADGROUP GROUP group consumer COUNT count STREAMS key id`
+    ///
+    /// Never blocks on the server as that would stall the other commands
+    /// pipelined into the same connection, poll instead.
+    virtual RequestXreadgroup Xreadgroup(
+        std::string key,
+        std::string group,
+        std::string consumer,
+        size_t count,
+        std::string id,
+        const CommandControl& command_control
+    ) = 0;
+
     virtual RequestZadd
     Zadd(std::string key, double score, std::string member, const CommandControl& command_control) = 0;
 
@@ -0,0 +1,87 @@
+#pragma once
+
+/// @file userver/storages/redis/client_side_cache.hpp
+/// @brief @copybrief storages::redis::ClientSideCache
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_control.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+struct ClientSideCacheSettings {
+    /// Limit on the total size of the cached keys, fields and values
+    std::size_t max_bytes{16 * 1024 * 1024};
+
+    /// Limit on the number of the cached keys
+    std::size_t max_keys{100'000};
+
+    /// Upper bound on the staleness of a value if its invalidation is lost
+    std::chrono::milliseconds ttl{std::chrono::seconds{10}};
+
+    /// Only the keys starting with one of these prefixes are cached, all the
+    /// keys are cached if empty
+    std::vector<std::string> key_prefixes;
+};
+
+struct ClientSideCacheStatistics {
+    std::size_t hits{0};
+    std::size_t misses{0};
+    std::size_t invalidations{0};
+    std::size_t keys{0};
+    std::size_t bytes{0};
+};
+
+/// @ingroup userver_clients
+///
+/// @brief In-process cache of the `GET` and `HGET` results for the hot keys.
+///
+/// Cached results are returned without a round trip to Redis. A key is
+/// dropped from the cache when Redis publishes a keyspace notification about
+/// its modification, so the server must be configured to send them, e.g.
+/// with `notify-keyspace-events K$hgx`. Notifications are delivered through
+/// the subscribe client and may be lost on reconnects, that is why each value
+/// also expires after ClientSideCacheSettings::ttl.
+///
+/// Least recently used keys are evicted when the cache is over any of its
+/// limits.
+class ClientSideCache final {
+public:
+    /// Starts listening to the keyspace notifications
+    ClientSideCache(ClientPtr client, SubscribeClientPtr subscribe_client, ClientSideCacheSettings settings);
+    ~ClientSideCache();
+
+    ClientSideCache(ClientSideCache&&) = delete;
+    ClientSideCache& operator=(ClientSideCache&&) = delete;
+
+    /// `GET key`, served from the cache if possible
+    std::optional<std::string> Get(const std::string& key, const CommandControl& command_control);
+
+    /// `HGET key field`, served from the cache if possible
+    std::optional<std::string>
+    Hget(const std::string& key, const std::string& field, const CommandControl& command_control);
+
+    /// Drops the key along with all of its cached fields
+    void Invalidate(const std::string& key);
+
+    /// Drops everything
+    void Clear();
+
+    ClientSideCacheStatistics GetStatistics() const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
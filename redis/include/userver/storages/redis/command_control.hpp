@@ -81,6 +81,11 @@ struct CommandControl {
 
         /// Send requests to 'best_dc_count' Redis instances with the min ping
         kNearestServerPing,
+        /// Send requests to the instance with the lowest EWMA of the reply
+        /// latency multiplied by the number of the commands in flight. Requests
+        /// with non-zero `retry_counter`, e.g. the hedged ones, go to the next
+        /// best instances.
+        kNearestServerLatency,
     };
 
     /// Timeout for a single attempt to execute command
@@ -22,6 +22,9 @@
 ///         key, field);
 /// auto result = future.Get();
 ///
+/// With CommandControl::Strategy::kNearestServerLatency the hedged requests
+/// are sent to the next best replicas rather than to the slow one.
+///
 
 #include <optional>
 
@@ -63,6 +63,9 @@ ParseReplyDataArray(ReplyData&& array_data, const std::string& request_descripti
 std::vector<GeoPoint>
 ParseReplyDataArray(ReplyData&& array_data, const std::string& request_description, To<std::vector<GeoPoint>>);
 
+std::vector<StreamEntry>
+ParseReplyDataArray(ReplyData&& array_data, const std::string& request_description, To<std::vector<StreamEntry>>);
+
 std::string Parse(ReplyData&& reply_data, const std::string& request_description, To<std::string>);
 
 double Parse(ReplyData&& reply_data, const std::string& request_description, To<double>);
@@ -90,6 +93,13 @@ void Parse(ReplyData&& reply_data, const std::string& request_description, To<St
 
 SetReply Parse(ReplyData&& reply_data, const std::string& request_description, To<SetReply>);
 
+StreamReadReply Parse(ReplyData&& reply_data, const std::string& request_description, To<StreamReadReply>);
+
+StreamAutoclaimReply
+Parse(ReplyData&& reply_data, const std::string& request_description, To<StreamAutoclaimReply>);
+
+XgroupCreateReply Parse(ReplyData&& reply_data, const std::string& request_description, To<XgroupCreateReply>);
+
 std::unordered_set<std::string>
 Parse(ReplyData&& reply_data, const std::string& request_description, To<std::unordered_set<std::string>>);
 
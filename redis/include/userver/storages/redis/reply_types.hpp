@@ -94,6 +94,35 @@ enum class StatusOk { kOk };
 
 enum class StatusPong { kPong };
 
+/// An entry of a Redis stream
+struct StreamEntry final {
+    std::string id;
+    std::vector<std::pair<std::string, std::string>> fields;
+
+    bool operator==(const StreamEntry& rhs) const { return id == rhs.id && fields == rhs.fields; }
+
+    bool operator!=(const StreamEntry& rhs) const { return !(*this == rhs); }
+};
+
+/// Entries read by `XREADGROUP` from a single stream, empty if there were none
+struct StreamReadReply final {
+    std::vector<StreamEntry> entries;
+};
+
+/// Reply to `XAUTOCLAIM`
+struct StreamAutoclaimReply final {
+    /// Id to start the next `XAUTOCLAIM` from, "0-0" if the whole pending
+    /// entries list has been scanned
+    std::string next_id;
+
+    /// Claimed entries. Entries that were deleted from the stream while being
+    /// pending are returned with empty fields by Redis 6.2 and are skipped by
+    /// the newer servers.
+    std::vector<StreamEntry> entries;
+};
+
+enum class XgroupCreateReply { kCreated, kAlreadyExists };
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
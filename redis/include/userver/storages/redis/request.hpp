@@ -213,6 +213,10 @@ using RequestStrlen = Request<size_t>;
 using RequestTime = Request<std::chrono::system_clock::time_point>;
 using RequestTtl = Request<TtlReply>;
 using RequestType = Request<KeyType>;
+using RequestXack = Request<size_t>;
+using RequestXautoclaim = Request<StreamAutoclaimReply>;
+using RequestXgroupCreate = Request<XgroupCreateReply>;
+using RequestXreadgroup = Request<StreamReadReply>;
 using RequestZadd = Request<size_t>;
 using RequestZaddIncr = Request<double>;
 using RequestZaddIncrExisting = Request<std::optional<double>>;
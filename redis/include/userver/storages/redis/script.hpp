@@ -0,0 +1,55 @@
+#pragma once
+
+/// @file userver/storages/redis/script.hpp
+/// @brief @copybrief storages::redis::Script
+
+#include <string>
+#include <vector>
+
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/command_control.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// @brief Lua script executed by its SHA1 digest, so that its body is not
+/// sent to Redis on every call.
+///
+/// If the server has not cached the script yet, it replies with NOSCRIPT and
+/// the script is executed with EVAL, which also caches it on the server for
+/// the following calls. Load() uploads the script to all the shards
+/// beforehand to avoid those round trips.
+///
+/// @snippet storages/redis/client_redistest.cpp Sample Redis Script usage
+class Script final {
+public:
+    explicit Script(std::string body);
+
+    const std::string& GetBody() const noexcept { return body_; }
+    const std::string& GetSha1() const noexcept { return sha1_; }
+
+    /// EVALSHA falling back to EVAL on NOSCRIPT
+    template <typename ScriptResult, typename ReplyType = ScriptResult>
+    ReplyType Execute(
+        Client& client,
+        std::vector<std::string> keys,
+        std::vector<std::string> args,
+        const CommandControl& command_control
+    ) const {
+        auto result = client.EvalSha<ScriptResult, ReplyType>(sha1_, keys, args, command_control).Get();
+        if (!result.IsNoScriptError()) return result.Extract();
+        return client.Eval<ScriptResult, ReplyType>(body_, std::move(keys), std::move(args), command_control).Get();
+    }
+
+    /// Uploads the script with SCRIPT LOAD to the masters of all the shards
+    void Load(Client& client, const CommandControl& command_control) const;
+
+private:
+    std::string body_;
+    std::string sha1_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,96 @@
+#pragma once
+
+/// @file userver/storages/redis/stream_consumer.hpp
+/// @brief @copybrief storages::redis::StreamConsumer
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_control.hpp>
+#include <userver/storages/redis/reply_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+struct StreamConsumerSettings {
+    /// Consumer group, created along with the stream if missing
+    std::string group;
+
+    /// Name of this consumer within the group, must be unique among the
+    /// running instances
+    std::string consumer;
+
+    /// Max number of entries passed to the callback at once
+    std::size_t batch_size{100};
+
+    /// Delay before the next read if the previous one returned nothing
+    std::chrono::milliseconds poll_interval{100};
+
+    /// Entries that are pending for other consumers of the group for longer
+    /// than that are claimed with `XAUTOCLAIM`, zero disables claiming
+    std::chrono::milliseconds claim_min_idle_time{std::chrono::minutes{1}};
+
+    /// Delay between the scans of the pending entries list with `XAUTOCLAIM`
+    std::chrono::milliseconds claim_interval{std::chrono::seconds{10}};
+
+    CommandControl command_control;
+};
+
+/// @ingroup userver_clients
+///
+/// @brief Reads Redis streams as a member of a consumer group and passes the
+/// entries to the callback in batches.
+///
+/// A task per stream reads up to StreamConsumerSettings::batch_size entries
+/// with a single `XREADGROUP`, passes them to the callback and acknowledges
+/// them with a single `XACK` once the callback returns. If the callback
+/// throws, the batch is not acknowledged and is passed to the callback again.
+///
+/// On start each task first reads the entries left pending for this consumer
+/// by its previous run. Entries stuck in the pending lists of the other
+/// consumers, e.g. of the ones that are gone, are taken over with
+/// `XAUTOCLAIM`.
+///
+/// `XREADGROUP` is sent without `BLOCK` as a blocked command would stall the
+/// other requests pipelined into the same connection, so an empty stream is
+/// polled every StreamConsumerSettings::poll_interval.
+class StreamConsumer final {
+public:
+    /// Called with the stream key and a non-empty batch of its entries
+    using Callback = std::function<void(const std::string& key, std::vector<StreamEntry> entries)>;
+
+    StreamConsumer(ClientPtr client, std::vector<std::string> keys, StreamConsumerSettings settings);
+
+    /// Stops the consumption
+    ~StreamConsumer();
+
+    StreamConsumer(StreamConsumer&&) = delete;
+    StreamConsumer& operator=(StreamConsumer&&) = delete;
+
+    /// Starts a task per stream in the current task processor
+    void Start(Callback callback);
+
+    /// Cancels the tasks and waits for them to finish
+    void Stop() noexcept;
+
+private:
+    void RunLoop(const std::string& key);
+    void ProcessBatch(const std::string& key, std::vector<StreamEntry> entries);
+
+    const ClientPtr client_;
+    const std::vector<std::string> keys_;
+    const StreamConsumerSettings settings_;
+
+    Callback callback_;
+    std::vector<engine::TaskWithResult<void>> tasks_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
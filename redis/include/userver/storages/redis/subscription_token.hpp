@@ -3,6 +3,8 @@
 /// @file userver/storages/redis/subscription_token.hpp
 /// @brief @copybrief storages::redis::SubscriptionToken
 
+#include <chrono>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <string>
@@ -13,6 +15,15 @@ namespace storages::redis {
 
 struct CommandControl;
 
+/// @brief Statistics of the queue of messages of a subscription
+struct SubscriptionQueueStatistics {
+    /// Messages received but not yet passed to the callback
+    std::size_t queue_length{0};
+
+    /// Time that the last message passed to the callback spent in the queue
+    std::chrono::microseconds lag{0};
+};
+
 namespace impl {
 
 class SubscriptionTokenImplBase {
@@ -30,6 +41,8 @@ public:
     virtual void SetMaxQueueLength(size_t length) = 0;
 
     virtual void Unsubscribe() = 0;
+
+    virtual SubscriptionQueueStatistics GetQueueStatistics() const;
 };
 
 }  // namespace impl
@@ -60,6 +73,10 @@ public:
     /// its maximum length. If it overflows, new messages are discarded.
     void SetMaxQueueLength(size_t length);
 
+    /// Returns the length of the queue and the delay of the messages in it, a
+    /// growing lag means that the callback can not keep up with the channel.
+    SubscriptionQueueStatistics GetQueueStatistics() const;
+
     /// Unsubscribe from the channel. This method is synchronous, once it
     /// returned, no new calls to callback will be made.
     void Unsubscribe();
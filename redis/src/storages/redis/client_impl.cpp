@@ -566,30 +566,38 @@ RequestLtrim ClientImpl::Ltrim(std::string key, int64_t start, int64_t stop, con
 
 RequestMget ClientImpl::Mget(std::vector<std::string> keys, const CommandControl& command_control) {
     if (keys.empty()) return CreateDummyRequest<RequestMget>(std::make_shared<Reply>("mget", ReplyData::Array{}));
-    const auto shard = ShardByKey(keys.at(0), command_control);
-    auto max_chunk_size = CommandControlImpl{command_control}.chunk_size;
-    if (max_chunk_size == 0) {
-        max_chunk_size = keys.size();
-    }
-    auto make_request = [this, shard, cc = GetCommandControl(command_control)](auto keys) {
-        return MakeRequest(CmdArgs{"mget", std::move(keys)}, shard, false, cc);
-    };
-    if (max_chunk_size >= keys.size()) {
-        return CreateRequest<RequestMget>(make_request(std::move(keys)));
+    auto scattered = MakeScatteredRequests(
+        std::move(keys),
+        CommandControlImpl{command_control}.chunk_size,
+        command_control,
+        [](const std::string& key) -> const std::string& { return key; },
+        [this, cc = GetCommandControl(command_control)](std::vector<std::string>&& keys, size_t shard) {
+            return MakeRequest(CmdArgs{"mget", std::move(keys)}, shard, false, cc);
+        }
+    );
+    if (scattered.requests.size() == 1) {
+        return CreateRequest<RequestMget>(std::move(scattered.requests.front()));
     }
-    return CreateAggregateRequest<RequestMget>(MakeRequestChunks(
-        max_chunk_size, std::move(keys), [&make_request](auto keys) { return make_request(std::move(keys)); }
-    ));
+    return CreateScatteredRequest<RequestMget>(std::move(scattered.requests), std::move(scattered.positions));
 }
 
 RequestMset
 ClientImpl::Mset(std::vector<std::pair<std::string, std::string>> key_values, const CommandControl& command_control) {
     if (key_values.empty())
         return CreateDummyRequest<RequestMset>(std::make_shared<Reply>("mset", ReplyData::CreateStatus("OK")));
-    auto shard = ShardByKey(key_values.at(0).first, command_control);
-    return CreateRequest<RequestMset>(
-        MakeRequest(CmdArgs{"mset", std::move(key_values)}, shard, true, GetCommandControl(command_control))
+    auto scattered = MakeScatteredRequests(
+        std::move(key_values),
+        0,
+        command_control,
+        [](const std::pair<std::string, std::string>& key_value) -> const std::string& { return key_value.first; },
+        [this, cc = GetCommandControl(command_control)](
+            std::vector<std::pair<std::string, std::string>>&& key_values, size_t shard
+        ) { return MakeRequest(CmdArgs{"mset", std::move(key_values)}, shard, true, cc); }
     );
+    if (scattered.requests.size() == 1) {
+        return CreateRequest<RequestMset>(std::move(scattered.requests.front()));
+    }
+    return CreateScatteredRequest<RequestMset>(std::move(scattered.requests), std::move(scattered.positions));
 }
 
 TransactionPtr ClientImpl::Multi() { return std::make_unique<TransactionImpl>(shared_from_this()); }
@@ -886,6 +894,89 @@ RequestType ClientImpl::Type(std::string key, const CommandControl& command_cont
     );
 }
 
+RequestXack ClientImpl::Xack(
+    std::string key,
+    std::string group,
+    std::vector<std::string> ids,
+    const CommandControl& command_control
+) {
+    auto shard = ShardByKey(key, command_control);
+    if (ids.empty()) return CreateDummyRequest<RequestXack>(std::make_shared<Reply>("xack", 0));
+    return CreateRequest<RequestXack>(MakeRequest(
+        CmdArgs{"xack", std::move(key), std::move(group), std::move(ids)},
+        shard,
+        true,
+        GetCommandControl(command_control)
+    ));
+}
+
+RequestXautoclaim ClientImpl::Xautoclaim(
+    std::string key,
+    std::string group,
+    std::string consumer,
+    std::chrono::milliseconds min_idle_time,
+    std::string start,
+    size_t count,
+    const CommandControl& command_control
+) {
+    auto shard = ShardByKey(key, command_control);
+    return CreateRequest<RequestXautoclaim>(MakeRequest(
+        CmdArgs{
+            "xautoclaim",
+            std::move(key),
+            std::move(group),
+            std::move(consumer),
+            min_idle_time.count(),
+            std::move(start),
+            "COUNT",
+            count},
+        shard,
+        true,
+        GetCommandControl(command_control)
+    ));
+}
+
+RequestXgroupCreate ClientImpl::XgroupCreate(
+    std::string key,
+    std::string group,
+    std::string id,
+    bool mkstream,
+    const CommandControl& command_control
+) {
+    auto shard = ShardByKey(key, command_control);
+    auto cmd_args = mkstream ? CmdArgs{"xgroup", "CREATE", std::move(key), std::move(group), std::move(id), "MKSTREAM"}
+                             : CmdArgs{"xgroup", "CREATE", std::move(key), std::move(group), std::move(id)};
+    return CreateRequest<RequestXgroupCreate>(
+        MakeRequest(std::move(cmd_args), shard, true, GetCommandControl(command_control))
+    );
+}
+
+RequestXreadgroup ClientImpl::Xreadgroup(
+    std::string key,
+    std::string group,
+    std::string consumer,
+    size_t count,
+    std::string id,
+    const CommandControl& command_control
+) {
+    auto shard = ShardByKey(key, command_control);
+    return CreateRequest<RequestXreadgroup>(MakeRequest(
+        CmdArgs{
+            "xreadgroup",
+            "GROUP",
+            std::move(group),
+            std::move(consumer),
+            "COUNT",
+            count,
+            "STREAMS",
+            std::move(key),
+            std::move(id)},
+        shard,
+        true,
+        GetCommandControl(command_control)
+    ));
+}
+
 RequestZadd ClientImpl::Zadd(std::string key, double score, std::string member, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
     return CreateRequest<RequestZadd>(MakeRequest(
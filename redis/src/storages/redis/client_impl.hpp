@@ -1,12 +1,14 @@
 #pragma once
 
 #include <chrono>
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
 #include <storages/redis/impl/request.hpp>
+#include <userver/storages/redis/impl/keyshard.hpp>
 #include <userver/storages/redis/base.hpp>
 #include <userver/storages/redis/command_options.hpp>
 
@@ -322,6 +324,40 @@ public:
 
     RequestType Type(std::string key, const CommandControl& command_control) override;
 
+    RequestXack Xack(
+        std::string key,
+        std::string group,
+        std::vector<std::string> ids,
+        const CommandControl& command_control
+    ) override;
+
+    RequestXautoclaim Xautoclaim(
+        std::string key,
+        std::string group,
+        std::string consumer,
+        std::chrono::milliseconds min_idle_time,
+        std::string start,
+        size_t count,
+        const CommandControl& command_control
+    ) override;
+
+    RequestXgroupCreate XgroupCreate(
+        std::string key,
+        std::string group,
+        std::string id,
+        bool mkstream,
+        const CommandControl& command_control
+    ) override;
+
+    RequestXreadgroup Xreadgroup(
+        std::string key,
+        std::string group,
+        std::string consumer,
+        size_t count,
+        std::string id,
+        const CommandControl& command_control
+    ) override;
+
     RequestZadd Zadd(std::string key, double score, std::string member, const CommandControl& command_control) override;
 
     RequestZadd Zadd(
@@ -439,21 +475,45 @@ private:
         size_t replies_to_skip = 0
     );
 
-    template <typename T, typename Func>
-    auto MakeRequestChunks(size_t max_chunk_size, std::vector<T>&& args, Func&& func) {
+    struct ScatteredRequests {
         std::vector<impl::Request> requests;
-
-        auto chunk_size = static_cast<std::ptrdiff_t>(max_chunk_size);
-        // NOLINTNEXTLINE(readability-qualified-auto)
-        for (auto it = args.begin(); it < args.end(); it += chunk_size) {
-            chunk_size = std::min(chunk_size, args.end() - it);
-            std::vector<T> args_chunk;
-            args_chunk.reserve(chunk_size);
-            std::move(it, it + chunk_size, std::back_inserter(args_chunk));
-            requests.push_back(func(std::move(args_chunk)));
+        // Positions of the arguments of each request in the original command
+        std::vector<std::vector<size_t>> positions;
+    };
+
+    // Splits the arguments of a multi-key command between the shards and, in
+    // the cluster mode, between the hash slots, as the command fails on the
+    // keys of several slots. Groups larger than max_chunk_size are split
+    // further. All the requests are sent at once.
+    template <typename T, typename GetKey, typename Func>
+    ScatteredRequests MakeScatteredRequests(
+        std::vector<T>&& args,
+        size_t max_chunk_size,
+        const CommandControl& command_control,
+        GetKey&& get_key,
+        Func&& func
+    ) {
+        const bool by_slot = IsInClusterMode();
+        std::map<std::pair<size_t, size_t>, std::vector<size_t>> groups;
+        for (size_t i = 0; i < args.size(); ++i) {
+            const std::string& key = get_key(args[i]);
+            groups[{ShardByKey(key, command_control), by_slot ? impl::HashSlot(key) : 0}].push_back(i);
         }
-
-        return requests;
+        if (max_chunk_size == 0) max_chunk_size = args.size();
+
+        ScatteredRequests result;
+        for (auto& [shard_slot, positions] : groups) {
+            for (size_t begin = 0; begin < positions.size(); begin += max_chunk_size) {
+                const auto end = std::min(begin + max_chunk_size, positions.size());
+                std::vector<T> args_chunk;
+                args_chunk.reserve(end - begin);
+                for (size_t i = begin; i < end; ++i) args_chunk.push_back(std::move(args[positions[i]]));
+
+                result.requests.push_back(func(std::move(args_chunk), shard_slot.first));
+                result.positions.emplace_back(positions.begin() + begin, positions.begin() + end);
+            }
+        }
+        return result;
     }
 
     CommandControl GetCommandControl(const CommandControl& cc) const;
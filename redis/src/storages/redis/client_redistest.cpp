@@ -2,6 +2,7 @@
 
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/wait_any.hpp>
+#include <userver/storages/redis/script.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -29,6 +30,16 @@ std::optional<std::string> RedisClientCancelRequest(storages::redis::Client& cli
 }
 /// [Sample Redis Cancel request]
 
+/// [Sample Redis Script usage]
+std::string RedisScriptSampleUsage(storages::redis::Client& client) {
+    // The script is usually a long living object, e.g. a member of a component
+    static const storages::redis::Script kScript{"return redis.call('get', KEYS[1])"};
+
+    client.Set("script_key", "value", {}).Get();
+    return kScript.Execute<std::string>(client, {"script_key"}, {}, {});
+}
+/// [Sample Redis Script usage]
+
 }  // namespace
 
 UTEST_F(RedisClientTest, Sample) { RedisClientSampleUsage(*GetClient()); }
@@ -238,6 +249,24 @@ UTEST_F(RedisClientTest, EvalSha) {
     EXPECT_EQ(result_array[0], "key1");
 }
 
+UTEST_F(RedisClientTest, Script) {
+    auto client = GetClient();
+    const storages::redis::Script script{"return { KEYS[1], ARGV[1] }"};
+
+    // Falls back to EVAL if the server has not cached the script yet
+    auto result = script.Execute<std::vector<std::string>>(*client, {"key"}, {"arg"}, {});
+    EXPECT_EQ(result, (std::vector<std::string>{"key", "arg"}));
+
+    // Cached by the server now
+    EXPECT_TRUE(client->EvalSha<std::vector<std::string>>(script.GetSha1(), {"key"}, {"arg"}, {}).Get().HasValue());
+
+    const storages::redis::Script loaded_script{"return ARGV[1]"};
+    loaded_script.Load(*client, {});
+    EXPECT_TRUE(client->EvalSha<std::string>(loaded_script.GetSha1(), {"key"}, {"arg"}, {}).Get().HasValue());
+
+    EXPECT_EQ(RedisScriptSampleUsage(*client), "value");
+}
+
 UTEST_F(RedisClientTest, Exists) {
     auto client = GetClient();
     client->Set("key1", "Hello", {}).Get();
@@ -675,6 +704,35 @@ UTEST_F(RedisClientTest, Type) {
     EXPECT_EQ(client->Type("key2", {}).Get(), storages::redis::KeyType::kList);
 }
 
+UTEST_F(RedisClientTest, Xreadgroup) {
+    using storages::redis::XgroupCreateReply;
+    auto client = GetClient();
+
+    EXPECT_EQ(client->XgroupCreate("stream", "group", "$", true, {}).Get(), XgroupCreateReply::kCreated);
+    EXPECT_EQ(client->XgroupCreate("stream", "group", "$", true, {}).Get(), XgroupCreateReply::kAlreadyExists);
+
+    const std::string xadd_script = "return redis.call('XADD', KEYS[1], '*', ARGV[1], ARGV[2])";
+    const auto id = client->Eval<std::string>(xadd_script, {"stream"}, {"field", "value"}, {}).Get();
+
+    auto read = client->Xreadgroup("stream", "group", "consumer", 10, ">", {}).Get();
+    ASSERT_EQ(read.entries.size(), 1);
+    EXPECT_EQ(read.entries[0].id, id);
+    EXPECT_EQ(read.entries[0].fields, (std::vector<std::pair<std::string, std::string>>{{"field", "value"}}));
+    EXPECT_TRUE(client->Xreadgroup("stream", "group", "consumer", 10, ">", {}).Get().entries.empty());
+
+    // Not acknowledged yet
+    EXPECT_EQ(client->Xreadgroup("stream", "group", "consumer", 10, "0", {}).Get().entries.size(), 1);
+
+    auto claimed = client->Xautoclaim("stream", "group", "other", std::chrono::milliseconds{0}, "0-0", 10, {}).Get();
+    EXPECT_EQ(claimed.next_id, "0-0");
+    ASSERT_EQ(claimed.entries.size(), 1);
+    EXPECT_EQ(claimed.entries[0].id, id);
+
+    EXPECT_EQ(client->Xack("stream", "group", {id}, {}).Get(), 1);
+    EXPECT_EQ(client->Xack("stream", "group", {}, {}).Get(), 0);
+    EXPECT_TRUE(client->Xreadgroup("stream", "group", "other", 10, "0", {}).Get().entries.empty());
+}
+
 UTEST_F(RedisClientTest, Zadd) {
     auto client = GetClient();
 
@@ -0,0 +1,291 @@
+#include <userver/storages/redis/client_side_cache.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/subscribe_client.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+// Channels of the keyspace notifications are '__keyspace@<db>__:<key>'
+constexpr std::string_view kKeyspaceChannelPrefix = "__keyspace@";
+constexpr std::string_view kKeyspaceChannelSeparator = "__:";
+
+// Rough estimate of the memory taken by an entry besides its strings
+constexpr std::size_t kEntryOverhead = 128;
+
+std::string EscapeGlob(std::string_view str) {
+    std::string result;
+    result.reserve(str.size());
+    for (const char c : str) {
+        if (c == '*' || c == '?' || c == '[' || c == ']' || c == '\\') result.push_back('\\');
+        result.push_back(c);
+    }
+    return result;
+}
+
+std::size_t ValueBytes(const std::optional<std::string>& value) { return value ? value->size() : 0; }
+
+}  // namespace
+
+class ClientSideCache::Impl final {
+public:
+    Impl(ClientPtr client, SubscribeClientPtr subscribe_client, ClientSideCacheSettings settings);
+    ~Impl();
+
+    std::optional<std::string> Get(const std::string& key, const CommandControl& command_control);
+    std::optional<std::string>
+    Hget(const std::string& key, const std::string& field, const CommandControl& command_control);
+
+    void Invalidate(const std::string& key);
+    void Clear();
+
+    ClientSideCacheStatistics GetStatistics() const;
+
+private:
+    struct Entry {
+        // Outer optional is empty if GET has not been cached
+        std::optional<std::optional<std::string>> value;
+        std::unordered_map<std::string, std::optional<std::string>> fields;
+        std::chrono::steady_clock::time_point expires_at;
+        std::size_t bytes{0};
+    };
+
+    struct State {
+        explicit State(std::size_t max_keys) : entries(max_keys) {}
+
+        cache::LruMap<std::string, Entry> entries;
+        std::size_t bytes{0};
+    };
+
+    using Lookup = std::optional<std::optional<std::string>>;
+
+    bool IsCacheable(const std::string& key) const;
+    Lookup Find(const std::string& key, const std::string* field);
+    void Store(const std::string& key, const std::string* field, std::uint64_t epoch, std::optional<std::string> value);
+    void EraseLocked(State& state, const std::string& key);
+    void OnKeyspaceNotification(const std::string& channel);
+
+    const ClientPtr client_;
+    const ClientSideCacheSettings settings_;
+
+    concurrent::Variable<State, std::mutex> state_;
+    // Incremented on each invalidation, the replies to the requests sent
+    // before that may be stale and are not stored
+    std::atomic<std::uint64_t> epoch_{0};
+
+    USERVER_NAMESPACE::utils::statistics::RelaxedCounter<std::size_t> hits_;
+    USERVER_NAMESPACE::utils::statistics::RelaxedCounter<std::size_t> misses_;
+    USERVER_NAMESPACE::utils::statistics::RelaxedCounter<std::size_t> invalidations_;
+
+    std::vector<SubscriptionToken> subscriptions_;
+};
+
+ClientSideCache::Impl::Impl(ClientPtr client, SubscribeClientPtr subscribe_client, ClientSideCacheSettings settings)
+    : client_(std::move(client)), settings_(std::move(settings)), state_(std::max<std::size_t>(settings_.max_keys, 1)) {
+    UINVARIANT(client_ && subscribe_client, "Client side cache requires both the client and the subscribe client");
+
+    auto patterns = settings_.key_prefixes;
+    if (patterns.empty()) patterns.emplace_back();
+    subscriptions_.reserve(patterns.size());
+    for (const auto& prefix : patterns) {
+        subscriptions_.push_back(subscribe_client->Psubscribe(
+            fmt::format("{}*{}{}*", kKeyspaceChannelPrefix, kKeyspaceChannelSeparator, EscapeGlob(prefix)),
+            [this](const std::string&, const std::string& channel, const std::string&) {
+                OnKeyspaceNotification(channel);
+            }
+        ));
+    }
+}
+
+ClientSideCache::Impl::~Impl() {
+    for (auto& subscription : subscriptions_) subscription.Unsubscribe();
+}
+
+std::optional<std::string> ClientSideCache::Impl::Get(const std::string& key, const CommandControl& command_control) {
+    if (!IsCacheable(key)) return client_->Get(key, command_control).Get();
+
+    auto cached = Find(key, nullptr);
+    if (cached) return std::move(*cached);
+
+    const auto epoch = epoch_.load(std::memory_order_acquire);
+    auto value = client_->Get(key, command_control).Get();
+    Store(key, nullptr, epoch, value);
+    return value;
+}
+
+std::optional<std::string>
+ClientSideCache::Impl::Hget(const std::string& key, const std::string& field, const CommandControl& command_control) {
+    if (!IsCacheable(key)) return client_->Hget(key, field, command_control).Get();
+
+    auto cached = Find(key, &field);
+    if (cached) return std::move(*cached);
+
+    const auto epoch = epoch_.load(std::memory_order_acquire);
+    auto value = client_->Hget(key, field, command_control).Get();
+    Store(key, &field, epoch, value);
+    return value;
+}
+
+void ClientSideCache::Impl::Invalidate(const std::string& key) {
+    epoch_.fetch_add(1, std::memory_order_acq_rel);
+    ++invalidations_;
+    auto state = state_.Lock();
+    EraseLocked(*state, key);
+}
+
+void ClientSideCache::Impl::Clear() {
+    epoch_.fetch_add(1, std::memory_order_acq_rel);
+    auto state = state_.Lock();
+    state->entries.Clear();
+    state->bytes = 0;
+}
+
+ClientSideCacheStatistics ClientSideCache::Impl::GetStatistics() const {
+    ClientSideCacheStatistics result;
+    result.hits = hits_.Load();
+    result.misses = misses_.Load();
+    result.invalidations = invalidations_.Load();
+    {
+        const auto state = state_.Lock();
+        result.keys = state->entries.GetSize();
+        result.bytes = state->bytes;
+    }
+    return result;
+}
+
+bool ClientSideCache::Impl::IsCacheable(const std::string& key) const {
+    const auto& prefixes = settings_.key_prefixes;
+    return prefixes.empty() || std::any_of(prefixes.begin(), prefixes.end(), [&key](const std::string& prefix) {
+               return std::string_view{key}.substr(0, prefix.size()) == prefix;
+           });
+}
+
+ClientSideCache::Impl::Lookup ClientSideCache::Impl::Find(const std::string& key, const std::string* field) {
+    Lookup result;
+    {
+        auto state = state_.Lock();
+        auto* entry = state->entries.Get(key);
+        if (entry && entry->expires_at <= USERVER_NAMESPACE::utils::datetime::SteadyNow()) {
+            EraseLocked(*state, key);
+            entry = nullptr;
+        }
+        if (entry) {
+            if (!field) {
+                result = entry->value;
+            } else if (const auto it = entry->fields.find(*field); it != entry->fields.end()) {
+                result = it->second;
+            }
+        }
+    }
+
+    if (result) {
+        ++hits_;
+    } else {
+        ++misses_;
+    }
+    return result;
+}
+
+void ClientSideCache::Impl::Store(
+    const std::string& key,
+    const std::string* field,
+    std::uint64_t epoch,
+    std::optional<std::string> value
+) {
+    const auto value_bytes = ValueBytes(value) + (field ? field->size() : 0);
+
+    auto state = state_.Lock();
+    // Checked under the lock, as Invalidate() bumps the epoch before erasing
+    if (epoch_.load(std::memory_order_acquire) != epoch) return;
+
+    auto* entry = state->entries.Get(key);
+    if (!entry) {
+        Entry new_entry;
+        new_entry.expires_at = USERVER_NAMESPACE::utils::datetime::SteadyNow() + settings_.ttl;
+        new_entry.bytes = key.size() + kEntryOverhead;
+        state->bytes += new_entry.bytes;
+        if (state->entries.GetSize() == state->entries.GetCapacity()) {
+            const auto* evicted = state->entries.GetLeastUsed();
+            UASSERT(evicted);
+            state->bytes -= evicted->bytes;
+        }
+        entry = state->entries.Emplace(key, std::move(new_entry));
+    }
+
+    std::size_t replaced_bytes = 0;
+    if (!field) {
+        if (entry->value) replaced_bytes = ValueBytes(*entry->value);
+        entry->value = std::move(value);
+    } else {
+        auto [it, inserted] = entry->fields.try_emplace(*field);
+        if (!inserted) replaced_bytes = ValueBytes(it->second) + field->size();
+        it->second = std::move(value);
+    }
+    entry->bytes = entry->bytes + value_bytes - replaced_bytes;
+    state->bytes = state->bytes + value_bytes - replaced_bytes;
+
+    while (state->bytes > settings_.max_bytes && state->entries.GetSize()) {
+        const auto* least_used_key = state->entries.GetLeastUsedKey();
+        UASSERT(least_used_key);
+        EraseLocked(*state, std::string{*least_used_key});
+    }
+}
+
+void ClientSideCache::Impl::EraseLocked(State& state, const std::string& key) {
+    const auto* entry = state.entries.Get(key);
+    if (!entry) return;
+    state.bytes -= entry->bytes;
+    state.entries.Erase(key);
+}
+
+void ClientSideCache::Impl::OnKeyspaceNotification(const std::string& channel) {
+    const auto separator = channel.find(kKeyspaceChannelSeparator);
+    if (separator == std::string::npos) {
+        LOG_LIMITED_WARNING() << "Unexpected keyspace notification channel '" << channel << "'";
+        return;
+    }
+    Invalidate(channel.substr(separator + kKeyspaceChannelSeparator.size()));
+}
+
+ClientSideCache::ClientSideCache(ClientPtr client, SubscribeClientPtr subscribe_client, ClientSideCacheSettings settings)
+    : impl_(std::make_unique<Impl>(std::move(client), std::move(subscribe_client), std::move(settings))) {}
+
+ClientSideCache::~ClientSideCache() = default;
+
+std::optional<std::string> ClientSideCache::Get(const std::string& key, const CommandControl& command_control) {
+    return impl_->Get(key, command_control);
+}
+
+std::optional<std::string>
+ClientSideCache::Hget(const std::string& key, const std::string& field, const CommandControl& command_control) {
+    return impl_->Hget(key, field, command_control);
+}
+
+void ClientSideCache::Invalidate(const std::string& key) { impl_->Invalidate(key); }
+
+void ClientSideCache::Clear() { impl_->Clear(); }
+
+ClientSideCacheStatistics ClientSideCache::GetStatistics() const { return impl_->GetStatistics(); }
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,148 @@
+#include <userver/storages/redis/client_side_cache.hpp>
+
+#include <userver/storages/redis/mock_client_google.hpp>
+#include <userver/storages/redis/mock_request.hpp>
+#include <userver/storages/redis/mock_subscribe_client.hpp>
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using storages::redis::ClientSideCache;
+using storages::redis::ClientSideCacheSettings;
+using storages::redis::SubscriptionToken;
+using testing::_;
+
+struct Mocks {
+    std::shared_ptr<storages::redis::GMockClient> client = std::make_shared<storages::redis::GMockClient>();
+    std::shared_ptr<storages::redis::MockSubscribeClient> subscribe_client =
+        std::make_shared<storages::redis::MockSubscribeClient>();
+    SubscriptionToken::OnPmessageCb on_notification;
+
+    void ExpectPsubscribe(const std::string& pattern) {
+        EXPECT_CALL(*subscribe_client, Psubscribe(pattern, _, _))
+            .WillOnce([this](std::string, SubscriptionToken::OnPmessageCb cb, const storages::redis::CommandControl&) {
+                on_notification = std::move(cb);
+                return SubscriptionToken{};
+            });
+    }
+
+    void ExpectGet(const std::string& key, std::optional<std::string> value, int times) {
+        EXPECT_CALL(*client, Get(key, _))
+            .Times(times)
+            .WillRepeatedly([value](std::string, const storages::redis::CommandControl&) {
+                return storages::redis::CreateMockRequest<storages::redis::RequestGet>(value);
+            });
+    }
+
+    void Notify(const std::string& key) { on_notification("__keyspace@*__:*", "__keyspace@0__:" + key, "set"); }
+};
+
+}  // namespace
+
+TEST(ClientSideCache, Get) {
+    Mocks mocks;
+    mocks.ExpectPsubscribe("__keyspace@*__:*");
+    mocks.ExpectGet("key", "value", 1);
+    mocks.ExpectGet("missing", std::nullopt, 1);
+
+    ClientSideCache cache{mocks.client, mocks.subscribe_client, {}};
+    EXPECT_EQ(cache.Get("key", {}), "value");
+    EXPECT_EQ(cache.Get("key", {}), "value");
+    EXPECT_EQ(cache.Get("missing", {}), std::nullopt);
+    EXPECT_EQ(cache.Get("missing", {}), std::nullopt);
+
+    const auto stats = cache.GetStatistics();
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.keys, 2);
+}
+
+TEST(ClientSideCache, Hget) {
+    Mocks mocks;
+    mocks.ExpectPsubscribe("__keyspace@*__:*");
+    EXPECT_CALL(*mocks.client, Hget("key", _, _))
+        .Times(2)
+        .WillRepeatedly([](std::string, std::string field, const storages::redis::CommandControl&) {
+            return storages::redis::CreateMockRequest<storages::redis::RequestHget>(
+                std::optional<std::string>{"value-" + field}
+            );
+        });
+
+    ClientSideCache cache{mocks.client, mocks.subscribe_client, {}};
+    EXPECT_EQ(cache.Hget("key", "a", {}), "value-a");
+    EXPECT_EQ(cache.Hget("key", "b", {}), "value-b");
+    EXPECT_EQ(cache.Hget("key", "a", {}), "value-a");
+    EXPECT_EQ(cache.Hget("key", "b", {}), "value-b");
+    EXPECT_EQ(cache.GetStatistics().keys, 1);
+}
+
+TEST(ClientSideCache, KeyspaceNotification) {
+    Mocks mocks;
+    mocks.ExpectPsubscribe("__keyspace@*__:*");
+    mocks.ExpectGet("key", "value", 2);
+    mocks.ExpectGet("other", "value", 1);
+
+    ClientSideCache cache{mocks.client, mocks.subscribe_client, {}};
+    EXPECT_EQ(cache.Get("key", {}), "value");
+    EXPECT_EQ(cache.Get("other", {}), "value");
+
+    mocks.Notify("key");
+    EXPECT_EQ(cache.GetStatistics().invalidations, 1);
+    EXPECT_EQ(cache.Get("key", {}), "value");
+    EXPECT_EQ(cache.Get("other", {}), "value");
+}
+
+TEST(ClientSideCache, KeyPrefixes) {
+    Mocks mocks;
+    mocks.ExpectPsubscribe("__keyspace@*__:hot\\*:*");
+    mocks.ExpectGet("hot*:key", "value", 1);
+    mocks.ExpectGet("cold:key", "value", 2);
+
+    ClientSideCacheSettings settings;
+    settings.key_prefixes = {"hot*:"};
+    ClientSideCache cache{mocks.client, mocks.subscribe_client, settings};
+    for (int i = 0; i < 2; ++i) {
+        EXPECT_EQ(cache.Get("hot*:key", {}), "value");
+        EXPECT_EQ(cache.Get("cold:key", {}), "value");
+    }
+}
+
+TEST(ClientSideCache, Ttl) {
+    utils::datetime::MockNowSet({});
+    Mocks mocks;
+    mocks.ExpectPsubscribe("__keyspace@*__:*");
+    mocks.ExpectGet("key", "value", 2);
+
+    ClientSideCacheSettings settings;
+    settings.ttl = std::chrono::seconds{1};
+    ClientSideCache cache{mocks.client, mocks.subscribe_client, settings};
+    EXPECT_EQ(cache.Get("key", {}), "value");
+    utils::datetime::MockSleep(std::chrono::milliseconds{999});
+    EXPECT_EQ(cache.Get("key", {}), "value");
+    utils::datetime::MockSleep(std::chrono::milliseconds{1});
+    EXPECT_EQ(cache.Get("key", {}), "value");
+    utils::datetime::MockNowUnset();
+}
+
+TEST(ClientSideCache, ByteBudget) {
+    Mocks mocks;
+    mocks.ExpectPsubscribe("__keyspace@*__:*");
+    const std::string value(1000, 'x');
+    mocks.ExpectGet("first", value, 2);
+    mocks.ExpectGet("second", value, 1);
+
+    ClientSideCacheSettings settings;
+    settings.max_bytes = 1500;
+    ClientSideCache cache{mocks.client, mocks.subscribe_client, settings};
+    EXPECT_EQ(cache.Get("first", {}), value);
+    EXPECT_EQ(cache.Get("second", {}), value);
+    EXPECT_EQ(cache.GetStatistics().keys, 1);
+    EXPECT_LE(cache.GetStatistics().bytes, settings.max_bytes);
+
+    // The least recently used key has been evicted
+    EXPECT_EQ(cache.Get("first", {}), value);
+}
+
+USERVER_NAMESPACE_END
@@ -1,10 +1,12 @@
 #include "cluster_sentinel_impl.hpp"
 
+#include <array>
 #include <atomic>
+#include <charconv>
+#include <optional>
 
 #include <fmt/format.h>
 #include <boost/container_hash/hash.hpp>
-#include <boost/crc.hpp>
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/logging/log.hpp>
@@ -63,13 +65,6 @@ struct NodeAddressesHasher {
 using NodesAddressesSet = std::unordered_set<NodeAddresses, NodeAddressesHasher>;
 using HostPort = std::string;
 
-size_t HashSlot(const std::string& key) {
-    size_t start = 0;
-    size_t len = 0;
-    GetRedisKey(key, &start, &len);
-    return std::for_each(key.data() + start, key.data() + start + len, boost::crc_optimal<16, 0x1021>())() & 0x3fff;
-}
-
 std::string ParseMovedShard(const std::string& err_string) {
     static const auto kUnknownShard = std::string("");
     size_t pos = err_string.find(' ');  // skip "MOVED" or "ASK"
@@ -90,6 +85,17 @@ std::string ParseMovedShard(const std::string& err_string) {
     return err_string.substr(pos, colon_pos - pos) + ":" + std::to_string(port);
 }
 
+std::optional<size_t> ParseMovedSlot(const std::string& err_string) {
+    const size_t pos = err_string.find(' ');  // skip "MOVED"
+    if (pos == std::string::npos) return std::nullopt;
+    const char* first = err_string.data() + pos + 1;
+    const char* last = err_string.data() + err_string.size();
+    size_t slot = 0;
+    const auto [ptr, ec] = std::from_chars(first, last, slot);
+    if (ec != std::errc{} || ptr == first || slot >= kClusterHashSlots) return std::nullopt;
+    return slot;
+}
+
 struct CommandSpecialPrinter {
     const CommandPtr& command;
 };
@@ -298,6 +304,22 @@ public:
 
     void SendUpdateClusterTopology() { update_topology_watch_.Send(); }
 
+    /// Routes the slot to the shard of the node from a MOVED reply until the
+    /// next topology update, so that the following commands do not bounce
+    void ApplyMovedSlot(size_t slot, const HostPort& host_port) {
+        const auto topology = topology_.Read();
+        const auto shard = topology->GetShardByHostPort(host_port);
+        // The node is not in the topology yet, only the full update helps
+        if (!shard) return;
+        moved_slots_[slot].store(PackMovedSlot(topology->GetVersion(), *shard), std::memory_order_relaxed);
+    }
+
+    size_t GetShardIndexBySlot(const ClusterTopology& topology, size_t slot) const {
+        const auto moved = moved_slots_[slot].load(std::memory_order_relaxed);
+        if (moved && moved >> 32 == PackMovedSlot(topology.GetVersion(), 0) >> 32) return moved & 0xffffffff;
+        return topology.GetShardIndexBySlot(slot);
+    }
+
     std::shared_ptr<Redis> GetRedisInstance(const HostPort& host_port) const {
         const auto connection = nodes_.Get(host_port);
         if (connection) {
@@ -386,6 +408,13 @@ private:
     std::atomic_size_t current_topology_version_{0};
     rcu::Variable<ClusterTopology, rcu::BlockingRcuTraits> topology_;
 
+    // Shard of the slot from a MOVED reply along with the version of the
+    // topology the shard index belongs to, zero if there is none
+    static std::uint64_t PackMovedSlot(size_t topology_version, size_t shard) {
+        return (static_cast<std::uint64_t>(topology_version + 1) << 32) | (shard & 0xffffffff);
+    }
+    std::array<std::atomic<std::uint64_t>, kClusterHashSlots> moved_slots_{};
+
     /// Update cluster topology
     /// @{
     engine::ev::PeriodicWatcher update_topology_timer_;
@@ -893,10 +922,16 @@ void ClusterSentinelImpl::AsyncCommand(const SentinelCommand& scommand, size_t p
             const bool error_moved = reply->data.IsErrorMoved();
             if (error_moved) {
                 const auto& args = ccommand->args.args;
+                const auto& host_port = ParseMovedShard(reply->data.GetError());
                 LOG_DEBUG() << "MOVED" << reply->status_string << " c.instance_idx:" << ccommand->instance_idx
-                            << " shard: " << shard << " movedto:" << ParseMovedShard(reply->data.GetError())
-                            << " args:" << args;
+                            << " shard: " << shard << " movedto:" << host_port << " args:" << args;
+                ++statistics_internal_.cluster_moved_redirects;
+                if (const auto slot = ParseMovedSlot(reply->data.GetError())) {
+                    topology_holder_->ApplyMovedSlot(*slot, host_port);
+                }
                 this->topology_holder_->SendUpdateClusterTopology();
+            } else if (error_ask) {
+                ++statistics_internal_.cluster_ask_redirects;
             }
             const bool retry_to_master =
                 !master && reply->data.IsNil() && command->control.force_retries_to_master_on_nil_reply;
@@ -989,7 +1024,7 @@ void ClusterSentinelImpl::AsyncCommandToSentinel(CommandPtr /*command*/) {
 size_t ClusterSentinelImpl::ShardByKey(const std::string& key) const {
     const auto slot = HashSlot(key);
     const auto ptr = topology_holder_->GetTopology();
-    return ptr->GetShardIndexBySlot(slot);
+    return topology_holder_->GetShardIndexBySlot(*ptr, slot);
 }
 
 const std::string& ClusterSentinelImpl::GetAnyKeyForShard(size_t /*shard_idx*/) const {
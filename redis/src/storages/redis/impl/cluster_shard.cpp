@@ -1,5 +1,6 @@
 #include "cluster_shard.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -22,6 +23,7 @@ bool IsNearestServerPing(const CommandControlImpl& control) {
             return false;
         case CommandControl::Strategy::kLocalDcConductor:
         case CommandControl::Strategy::kNearestServerPing:
+        case CommandControl::Strategy::kNearestServerLatency:
             return true;
     }
     /* never reachable */
@@ -29,6 +31,10 @@ bool IsNearestServerPing(const CommandControlImpl& control) {
     return false;
 }
 
+bool IsNearestServerLatency(const CommandControlImpl& control) {
+    return control.strategy == CommandControl::Strategy::kNearestServerLatency;
+}
+
 }  // namespace
 
 ClusterShard& ClusterShard::operator=(const ClusterShard& other) {
@@ -81,7 +87,11 @@ bool ClusterShard::AsyncCommand(CommandPtr command) const {
         return false;
     }
 
-    const auto current = current_++;
+    // Servers are ordered by latency, the first one is the only one to try
+    // at the first attempt
+    const auto is_nearest_latency_server = IsNearestServerLatency(cc);
+    const auto current = is_nearest_latency_server ? 0 : current_++;
+    const auto best_dc_count = is_nearest_latency_server ? 1 : cc.best_dc_count;
     const auto& available_servers = GetAvailableServers(command->control);
     const auto servers_count = available_servers.size();
     const auto is_nearest_ping_server = IsNearestServerPing(cc);
@@ -96,7 +106,7 @@ bool ClusterShard::AsyncCommand(CommandPtr command) const {
 
         size_t idx = SentinelImpl::kDefaultPrevInstanceIdx;
         const auto instance = GetInstance(
-            available_servers, is_retry, start_idx, attempt, is_nearest_ping_server, cc.best_dc_count, &idx
+            available_servers, is_retry, start_idx, attempt, is_nearest_ping_server, best_dc_count, &idx
         );
         if (!instance) {
             continue;
@@ -160,6 +170,32 @@ void ClusterShard::GetNearestServersPing(
     );
 }
 
+/// Order instances by the latency cost, the hedged requests and manual retries
+/// start from the next best instances
+void ClusterShard::GetLowestLatencyServers(
+    const CommandControl& command_control,
+    std::vector<RedisConnectionPtr>& instances
+) {
+    if (instances.empty()) return;
+
+    const auto cost = [](const RedisConnectionPtr& connection) {
+        const auto instance = connection ? connection->Get() : nullptr;
+        return (instance && instance->IsAvailable()) ? instance->GetLatencyCost()
+                                                     : std::numeric_limits<double>::infinity();
+    };
+    std::vector<std::pair<double, RedisConnectionPtr>> sorted_by_cost;
+    sorted_by_cost.reserve(instances.size());
+    for (auto& instance : instances) sorted_by_cost.emplace_back(cost(instance), std::move(instance));
+    std::stable_sort(sorted_by_cost.begin(), sorted_by_cost.end(), [](const auto& l, const auto& r) {
+        return l.first < r.first;
+    });
+
+    const auto shift = command_control.retry_counter % sorted_by_cost.size();
+    for (size_t i = 0; i < sorted_by_cost.size(); ++i) {
+        instances[i] = std::move(sorted_by_cost[(i + shift) % sorted_by_cost.size()].second);
+    }
+}
+
 ClusterShard::RedisPtr ClusterShard::GetAvailableServer(const CommandControl& command_control, bool read_only) const {
     if (!read_only) {
         if (!master_) {
@@ -204,14 +240,16 @@ std::vector<ClusterShard::RedisConnectionPtr> ClusterShard::GetAvailableServers(
         return MakeReadonlyWithMasters();
     }
 
+    const auto order = IsNearestServerLatency(cc) ? &ClusterShard::GetLowestLatencyServers
+                                                  : &ClusterShard::GetNearestServersPing;
     if (cc.allow_reads_from_master) {
         auto ret = MakeReadonlyWithMasters();
-        ClusterShard::GetNearestServersPing(command_control, ret);
+        order(command_control, ret);
         return ret;
     }
 
     auto ret = replicas_;
-    ClusterShard::GetNearestServersPing(command_control, ret);
+    order(command_control, ret);
     ret.push_back(master_);
     return ret;
 }
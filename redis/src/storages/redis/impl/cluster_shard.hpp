@@ -45,6 +45,8 @@ public:
 private:
     static void
     GetNearestServersPing(const CommandControl& command_control, std::vector<RedisConnectionPtr>& instances);
+    static void
+    GetLowestLatencyServers(const CommandControl& command_control, std::vector<RedisConnectionPtr>& instances);
     /// Return suitable instance if it is the only suitable instance.
     /// If there no suitable or multiple suitable instances then method return
     /// nullptr
@@ -12,6 +12,8 @@
 USERVER_NAMESPACE_BEGIN
 
 namespace {
+using SharedMessage = storages::redis::impl::Sentinel::SharedMessage;
+
 storages::redis::ServerId MakeServerId(std::string description) {
     auto ret = storages::redis::ServerId::Generate();
     ret.SetDescription(std::move(description));
@@ -58,14 +60,17 @@ public:
     }
 
     void Subscribe(const std::string& channel_name) {
-        auto message_callback = [](const std::string& /*channel*/, const std::string& /*message*/) {
+        auto message_callback = [](const std::string& /*channel*/, const SharedMessage& /*message*/) {
             return storages::redis::impl::Sentinel::Outcome::kOk;
         };
-        auto token = storage_->Subscribe(channel_name, message_callback, {});
+        Subscribe(channel_name, message_callback);
+    }
+    void Subscribe(const std::string& channel_name, storages::redis::impl::Sentinel::UserMessageCallback callback) {
+        auto token = storage_->Subscribe(channel_name, std::move(callback), {});
         tokens_.push_back(std::move(token));
     }
     void Ssubscribe(const std::string& channel_name) {
-        auto message_callback = [](const std::string& /*channel*/, const std::string& /*message*/) {
+        auto message_callback = [](const std::string& /*channel*/, const SharedMessage& /*message*/) {
             return storages::redis::impl::Sentinel::Outcome::kOk;
         };
         auto token = storage_->Ssubscribe(channel_name, message_callback, {});
@@ -82,8 +87,22 @@ public:
             reply->server_id = server_ids[0];
             cmd->callback({}, reply);
         }
+        subscribed_cmds_.insert(subscribed_cmds_.end(), cmds_.begin(), cmds_.end());
         cmds_.clear();
     }
+    void Publish(const std::string& channel, const std::string& message) {
+        for (auto& cmd : subscribed_cmds_) {
+            if (cmd->args.args[0][1] != channel) continue;
+            storages::redis::ReplyData reply_data(storages::redis::ReplyData::Array{
+                storages::redis::ReplyData("message"),
+                storages::redis::ReplyData(channel),
+                storages::redis::ReplyData(message)}
+            );
+            auto reply = std::make_shared<storages::redis::Reply>("SUBSCRIBE", std::move(reply_data));
+            reply->server_id = server_ids[0];
+            cmd->callback({}, reply);
+        }
+    }
 
     void Rebalance(size_t shard) { storage_->DoRebalance(shard, weights); }
 
@@ -117,6 +136,7 @@ private:
     std::unordered_map<std::string, size_t> ssubscriptions_by_host_;
     std::vector<storages::redis::impl::SubscriptionToken> tokens_;
     std::vector<storages::redis::impl::CommandPtr> cmds_;
+    std::vector<storages::redis::impl::CommandPtr> subscribed_cmds_;
 };
 
 }  // namespace
@@ -181,4 +201,22 @@ TEST_F(SubscriptionTest, Sharded) {
     EXPECT_EQ(expected, subscriptions_by_host);
 }
 
+/// Test a message is not copied for each of the subscribers of the channel
+TEST_F(SubscriptionTest, SharedMessage) {
+    std::vector<SharedMessage> received;
+    const auto message_callback = [&received](const std::string& /*channel*/, const SharedMessage& message) {
+        received.push_back(message);
+        return storages::redis::impl::Sentinel::Outcome::kOk;
+    };
+    Subscribe("channel0", message_callback);
+    Subscribe("channel0", message_callback);
+    ProcessCommands();
+
+    Publish("channel0", "message");
+
+    ASSERT_EQ(received.size(), 2);
+    EXPECT_EQ(*received[0], "message");
+    EXPECT_EQ(received[0], received[1]);
+}
+
 USERVER_NAMESPACE_END
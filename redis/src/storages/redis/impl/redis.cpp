@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <deque>
 #include <mutex>
 #include <string>
@@ -28,6 +29,7 @@
 #include <storages/redis/impl/ev_wrapper.hpp>
 #include <storages/redis/impl/redis_info.hpp>
 #include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/resp_encoder.hpp>
 #include <storages/redis/impl/tcp_socket.hpp>
 #include <userver/storages/redis/reply.hpp>
 
@@ -40,6 +42,9 @@ namespace {
 
 const auto kPingLatencyExp = 0.7;
 const auto kInitialPingLatencyMs = 1000;
+// Time constant of the reply latency EWMA, an idle instance also forgets its
+// latency in about that time to get probed again
+const std::chrono::duration<double> kReplyLatencyDecay = std::chrono::seconds{10};
 const size_t kMissedPingStreakThresholdDefault = 3;
 
 // channel is used for periodic subscribe/unsubscribe to calculate actual RTT
@@ -165,6 +170,7 @@ public:
     bool IsAvailable() const { return GetState() == Redis::State::kConnected && !IsDestroying() && !IsSyncing(); }
     bool CanRetry() const;
     std::chrono::milliseconds GetPingLatency() const { return std::chrono::milliseconds(ping_latency_ms_); }
+    std::chrono::microseconds GetReplyLatency() const;
     void SetCommandsBufferingSettings(CommandsBufferingSettings commands_buffering_settings);
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings);
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings);
@@ -209,6 +215,7 @@ private:
     void CommandLoopImpl();
     void OnRedisReplyImpl(redisReply* redis_reply, void* privdata, int status, const char* errstr);
     void AccountPingLatency(std::chrono::milliseconds latency);
+    void AccountReplyLatency(std::chrono::steady_clock::duration latency);
     void AccountRtt();
     void OnTimerPingImpl();
     void OnTimerInfoImpl();
@@ -250,6 +257,8 @@ private:
     std::atomic<bool> destroying_{false};
 
     redisAsyncContext* context_ = nullptr;
+    // Wire format of the command being sent
+    std::string command_buffer_;
 #ifdef USERVER_FEATURE_REDIS_TLS
     SSLContextPtr ssl_context_;
 #endif
@@ -282,6 +291,10 @@ private:
     std::chrono::milliseconds ping_timeout_{4000};
     std::chrono::milliseconds info_replication_interval_{2000};
     std::atomic<double> ping_latency_ms_{kInitialPingLatencyMs};
+    // Peak EWMA of the reply latency, zero until the first reply so that the
+    // new instances are probed
+    std::atomic<double> reply_latency_us_{0};
+    std::atomic<std::chrono::steady_clock::rep> reply_latency_updated_{0};
     logging::LogExtra log_extra_;
     bool watch_command_timer_started_ = false;
     Statistics statistics_;
@@ -335,6 +348,12 @@ size_t Redis::GetRunningCommands() const { return impl_->GetRunningCommands(); }
 
 std::chrono::milliseconds Redis::GetPingLatency() const { return impl_->GetPingLatency(); }
 
+std::chrono::microseconds Redis::GetReplyLatency() const { return impl_->GetReplyLatency(); }
+
+double Redis::GetLatencyCost() const {
+    return static_cast<double>(GetReplyLatency().count()) * static_cast<double>(GetRunningCommands() + 1);
+}
+
 bool Redis::IsDestroying() const { return impl_->IsDestroying(); }
 
 bool Redis::IsSyncing() const { return impl_->IsSyncing(); }
@@ -502,6 +521,9 @@ void Redis::RedisImpl::InvokeCommand(const CommandPtr& command, ReplyPtr&& reply
 
     const CommandControlImpl cc{command->control};
     if (cc.account_in_statistics) statistics_.AccountReplyReceived(reply, command);
+    if (reply->status == ReplyStatus::kOk || reply->status == ReplyStatus::kTimeoutError) {
+        AccountReplyLatency(std::chrono::steady_clock::now() - command->GetStartHandlingTime());
+    }
     reply->server = server_;
     if (reply->status == ReplyStatus::kTimeoutError) {
         reply->log_extra.Extend("timeout_ms", cc.timeout_single.count());
@@ -623,6 +645,27 @@ void Redis::RedisImpl::AccountPingLatency(std::chrono::milliseconds latency) {
                 << ping_latency_ms_.load() << "ms" << log_extra;
 }
 
+std::chrono::microseconds Redis::RedisImpl::GetReplyLatency() const {
+    const std::chrono::steady_clock::duration since_update =
+        std::chrono::steady_clock::now().time_since_epoch() -
+        std::chrono::steady_clock::duration{reply_latency_updated_.load(std::memory_order_relaxed)};
+    const auto decay = std::exp(-std::max(since_update / kReplyLatencyDecay, 0.0));
+    return std::chrono::microseconds{
+        static_cast<std::chrono::microseconds::rep>(reply_latency_us_.load(std::memory_order_relaxed) * decay)};
+}
+
+void Redis::RedisImpl::AccountReplyLatency(std::chrono::steady_clock::duration latency) {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    const auto since_update = now - std::chrono::steady_clock::duration{reply_latency_updated_.load()};
+    const auto weight = std::exp(-std::max(since_update / kReplyLatencyDecay, 0.0));
+    const auto sample = std::chrono::duration<double, std::micro>(latency).count();
+    const auto current = reply_latency_us_.load();
+
+    // Peaks are taken at once to move the load away from a slowing instance
+    reply_latency_us_ = (sample > current) ? sample : current * weight + sample * (1 - weight);
+    reply_latency_updated_ = now.count();
+}
+
 void Redis::RedisImpl::AccountRtt() {
     auto rtt = GetSocketPeerRtt(context_->c.fd);
     if (rtt) {
@@ -879,6 +922,9 @@ void Redis::RedisImpl::CommandLoopImpl() {
         std::swap(commands_, commands);
     }
     LOG_TRACE() << "commands size=" << commands.size();
+    // hiredis accumulates the commands in its output buffer and writes them
+    // to the socket at once on the next loop iteration
+    if (!commands.empty()) statistics_.AccountCommandsBatch(commands.size());
     for (auto& command : commands) {
         ProcessCommand(command);
     }
@@ -1119,27 +1165,24 @@ void Redis::RedisImpl::ProcessCommand(const CommandPtr& command) {
             LOG_INFO() << "Process '" << fmt::to_string(fmt::join(args, " ")) << "' command" << log_extra_;
         }
 
-        std::vector<const char*> argv;
-        std::vector<size_t> argv_len;
-
-        argv.reserve(argc);
-        argv_len.reserve(argc);
-
-        for (const auto& arg : args) {
-            argv.push_back(arg.data());
-            argv_len.push_back(arg.size());
-        }
+        // The buffer keeps its capacity, so the encoding does not allocate
+        command_buffer_.clear();
+        AppendRespCommand(command_buffer_, args);
 
         {
             if (command->asking && (!multi || IsMultiCommand(args))) {
-                static const char* asking = "ASKING";
-                static const size_t asking_len = strlen(asking);
-                redisAsyncCommandArgv(context_, nullptr, nullptr, 1, &asking, &asking_len);
+                redisAsyncFormattedCommand(
+                    context_, nullptr, nullptr, kAskingRespCommand.data(), kAskingRespCommand.size()
+                );
             }
-            if (redisAsyncCommandArgv(
-                    context_, OnRedisReply, reinterpret_cast<void*>(cmd_counter_), argc, argv.data(), argv_len.data()
+            if (redisAsyncFormattedCommand(
+                    context_,
+                    OnRedisReply,
+                    reinterpret_cast<void*>(cmd_counter_),
+                    command_buffer_.data(),
+                    command_buffer_.size()
                 ) != REDIS_OK) {
-                LOG_ERROR() << log_extra_ << "redisAsyncCommandArgv() failed on command " << args[0];
+                LOG_ERROR() << log_extra_ << "redisAsyncFormattedCommand() failed on command " << args[0];
                 InvokeCommandError(command, args[0], ReplyStatus::kOtherError);
                 continue;
             }
@@ -36,6 +36,10 @@ public:
     bool AsyncCommand(const CommandPtr& command);
     size_t GetRunningCommands() const;
     std::chrono::milliseconds GetPingLatency() const;
+    /// Peak EWMA of the reply latency, decaying while there are no replies
+    std::chrono::microseconds GetReplyLatency() const;
+    /// Reply latency weighted by the commands in flight, lower is better
+    double GetLatencyCost() const;
     bool IsDestroying() const;
     std::string GetServerHost() const;
     uint16_t GetServerPort() const;
@@ -96,6 +96,10 @@ const std::string_view kCommandTypes[] = {
     "type",
     "unlink",
     "unsubscribe",
+    "xack",
+    "xautoclaim",
+    "xgroup",
+    "xreadgroup",
     "zadd",
     "zcard",
     "zcount",
@@ -160,6 +164,10 @@ void Statistics::AccountCommandSent(const CommandPtr& cmd) {
     }
 }
 
+void Statistics::AccountCommandsBatch(size_t commands) {
+    batch_size_percentile.GetCurrentCounter().Account(commands);
+}
+
 void Statistics::AccountReplyReceived(const ReplyPtr& reply, const CommandPtr& cmd) {
     reply_size_percentile.GetCurrentCounter().Account(reply->data.GetSize());
     auto start = cmd->GetStartHandlingTime();
@@ -198,6 +206,9 @@ void DumpMetric(utils::statistics::Writer& writer, const InstanceStatistics& sta
     if (stats.settings.IsReplySizesEnabled()) {
         writer["reply_sizes"] = stats.reply_size_percentile;
     }
+    if (stats.settings.IsBatchSizesEnabled()) {
+        writer["batch_sizes"] = stats.batch_size_percentile;
+    }
     if (stats.settings.IsTimingsEnabled()) {
         writer["timings"] = stats.timings_percentile;
     }
@@ -266,6 +277,12 @@ void DumpMetric(utils::statistics::Writer& writer, const SentinelStatistics& sta
         // because it will break dashboards/alerts for all current users.
         writer["cluster_topology_checks.v2"] = stats.internal.cluster_topology_checks.Load();
         writer["cluster_topology_updates.v2"] = stats.internal.cluster_topology_updates.Load();
+        writer["cluster_redirects"].ValueWithLabels(
+            stats.internal.cluster_moved_redirects.Load(), {"redis_redirect", "moved"}
+        );
+        writer["cluster_redirects"].ValueWithLabels(
+            stats.internal.cluster_ask_redirects.Load(), {"redis_redirect", "ask"}
+        );
     }
 
     ConnStateStatistic conn_stat_masters;
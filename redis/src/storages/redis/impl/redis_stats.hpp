@@ -32,6 +32,7 @@ public:
 
     void AccountStateChanged(RedisState new_state);
     void AccountCommandSent(const CommandPtr& cmd);
+    void AccountCommandsBatch(size_t commands);
     void AccountReplyReceived(const ReplyPtr& reply, const CommandPtr& cmd);
     void AccountPing(std::chrono::milliseconds ping);
     void AccountError(ReplyStatus code);
@@ -44,6 +45,7 @@ public:
     std::atomic<std::chrono::milliseconds> session_start_time{};
     RecentPeriod request_size_percentile;
     RecentPeriod reply_size_percentile;
+    RecentPeriod batch_size_percentile;
     RecentPeriod timings_percentile;
     std::unordered_map<std::string_view, RecentPeriod> command_timings_percentile;
     std::atomic_llong last_ping_ms{};
@@ -62,6 +64,7 @@ struct InstanceStatistics {
         session_start_time = other.session_start_time.load(std::memory_order_relaxed);
         request_size_percentile = other.request_size_percentile.GetStatsForPeriod();
         reply_size_percentile = other.reply_size_percentile.GetStatsForPeriod();
+        batch_size_percentile = other.batch_size_percentile.GetStatsForPeriod();
         timings_percentile = other.timings_percentile.GetStatsForPeriod();
         last_ping_ms = other.last_ping_ms.load(std::memory_order_relaxed);
         is_syncing = other.is_syncing.load(std::memory_order_relaxed);
@@ -78,6 +81,7 @@ struct InstanceStatistics {
         reconnects += other.reconnects;
         request_size_percentile.Add(other.request_size_percentile);
         reply_size_percentile.Add(other.reply_size_percentile);
+        batch_size_percentile.Add(other.batch_size_percentile);
         timings_percentile.Add(other.timings_percentile);
 
         for (size_t i = 0; i < error_count.size(); i++) error_count[i] += other.error_count[i];
@@ -92,6 +96,7 @@ struct InstanceStatistics {
     std::chrono::milliseconds session_start_time{};
     Statistics::Percentile request_size_percentile;
     Statistics::Percentile reply_size_percentile;
+    Statistics::Percentile batch_size_percentile;
     Statistics::Percentile timings_percentile;
     std::unordered_map<std::string, Statistics::Percentile> command_timings_percentile;
     long long last_ping_ms{};
@@ -115,12 +120,16 @@ struct SentinelStatisticsInternal {
     SentinelStatisticsInternal(const SentinelStatisticsInternal& other)
         : redis_not_ready(other.redis_not_ready),
           cluster_topology_checks(other.cluster_topology_checks),
-          cluster_topology_updates(other.cluster_topology_updates) {}
+          cluster_topology_updates(other.cluster_topology_updates),
+          cluster_moved_redirects(other.cluster_moved_redirects),
+          cluster_ask_redirects(other.cluster_ask_redirects) {}
 
     utils::statistics::RateCounter redis_not_ready{0};
     std::atomic_bool is_autotoplogy{false};
     utils::statistics::RateCounter cluster_topology_checks{0};
     utils::statistics::RateCounter cluster_topology_updates{0};
+    utils::statistics::RateCounter cluster_moved_redirects{0};
+    utils::statistics::RateCounter cluster_ask_redirects{0};
 };
 
 struct SentinelStatistics {
@@ -0,0 +1,38 @@
+#include <storages/redis/impl/resp_encoder.hpp>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+namespace {
+
+constexpr std::string_view kCrlf = "\r\n";
+
+void AppendHeader(std::string& buffer, char type, std::size_t size) {
+    const fmt::format_int size_str{size};
+    buffer.push_back(type);
+    buffer.append(size_str.data(), size_str.size());
+    buffer.append(kCrlf);
+}
+
+}  // namespace
+
+void AppendRespCommand(std::string& buffer, const CmdArgs::CmdArgsArray& args) {
+    // Header of a bulk string is at most 1 + 20 digits + CRLF
+    std::size_t size = 24;
+    for (const auto& arg : args) size += 24 + arg.size() + kCrlf.size();
+    buffer.reserve(buffer.size() + size);
+
+    AppendHeader(buffer, '*', args.size());
+    for (const auto& arg : args) {
+        AppendHeader(buffer, '$', arg.size());
+        buffer.append(arg);
+        buffer.append(kCrlf);
+    }
+}
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include <storages/redis/impl/cmd_args.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+/// ASKING command in the wire format
+inline constexpr std::string_view kAskingRespCommand = "*1\r\n$6\r\nASKING\r\n";
+
+/// Appends the command in the RESP wire format (an array of bulk strings) to
+/// the buffer, so that a reused buffer does not allocate
+void AppendRespCommand(std::string& buffer, const CmdArgs::CmdArgsArray& args);
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
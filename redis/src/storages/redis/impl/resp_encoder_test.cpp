@@ -0,0 +1,25 @@
+#include <storages/redis/impl/resp_encoder.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(RespEncoder, Command) {
+    std::string buffer;
+    storages::redis::impl::AppendRespCommand(buffer, {"SET", "key", ""});
+    EXPECT_EQ(buffer, "*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$0\r\n\r\n");
+}
+
+TEST(RespEncoder, BinaryArgs) {
+    std::string buffer = "prefix";
+    storages::redis::impl::AppendRespCommand(buffer, {"GET", std::string{"a\r\n\0b", 5}});
+    EXPECT_EQ(buffer, std::string("prefix*2\r\n$3\r\nGET\r\n$5\r\na\r\n\0b\r\n", 30));
+}
+
+TEST(RespEncoder, Asking) {
+    std::string buffer;
+    storages::redis::impl::AppendRespCommand(buffer, {"ASKING"});
+    EXPECT_EQ(buffer, storages::redis::impl::kAskingRespCommand);
+}
+
+USERVER_NAMESPACE_END
@@ -189,9 +189,13 @@ public:
 
     void UpdatePassword(const Password& password);
 
-    using UserMessageCallback = std::function<Outcome(const std::string& channel, const std::string& message)>;
+    /// Message received from a channel, it is shared by all the local
+    /// subscribers of the channel instead of being copied for each of them
+    using SharedMessage = std::shared_ptr<const std::string>;
+
+    using UserMessageCallback = std::function<Outcome(const std::string& channel, const SharedMessage& message)>;
     using UserPmessageCallback =
-        std::function<Outcome(const std::string& pattern, const std::string& channel, const std::string& message)>;
+        std::function<Outcome(const std::string& pattern, const std::string& channel, const SharedMessage& message)>;
 
     using MessageCallback =
         std::function<void(ServerId server_id, const std::string& channel, const std::string& message)>;
@@ -238,8 +238,6 @@ private:
         const ReadyChangeCallback& ready_callback
     );
 
-    static size_t HashSlot(const std::string& key);
-
     void ProcessWaitingCommands();
 
     Password GetPassword();
@@ -152,6 +152,42 @@ UTEST(Redis, SentinelMasterAndSlave) {
     }
 }
 
+UTEST(Redis, SentinelNearestServerLatency) {
+    const size_t master_count = 1;
+    const size_t slave_count = 2;
+    const size_t sentinel_count = 1;
+    const int magic_value_master = 238;
+    const int magic_value_slave = -238;
+    const size_t requests_count = 10;
+
+    SentinelTest sentinel_test(sentinel_count, master_count, slave_count, magic_value_master, magic_value_slave);
+    auto& sentinel = sentinel_test.SentinelClient();
+
+    EXPECT_TRUE(sentinel_test.Master().WaitForFirstPingReply(kSmallPeriod));
+    EXPECT_TRUE(sentinel_test.Slave(0).WaitForFirstPingReply(kSmallPeriod));
+    EXPECT_TRUE(sentinel_test.Slave(1).WaitForFirstPingReply(kSmallPeriod));
+
+    // The first slave replies with a status after a delay
+    sentinel_test.Slave(0).RegisterTimeoutHandler("GET", std::chrono::milliseconds{100});
+
+    storages::redis::CommandControl cc;
+    cc.strategy = storages::redis::CommandControl::Strategy::kNearestServerLatency;
+
+    // Each slave gets probed at most once
+    for (size_t i = 0; i < slave_count; ++i) MakeGetRequest(sentinel, "value", cc).Get();
+
+    for (size_t i = 0; i < requests_count; ++i) {
+        auto res = MakeGetRequest(sentinel, "value", cc).Get();
+        ASSERT_TRUE(res->data.IsInt());
+        EXPECT_EQ(res->data.GetInt(), magic_value_slave + 1);
+    }
+
+    // Hedged requests go to the next best slave
+    cc.retry_counter = 1;
+    auto res = MakeGetRequest(sentinel, "value", cc).Get();
+    EXPECT_TRUE(res->data.IsStatus());
+}
+
 UTEST(Redis, SentinelCcRetryToMasterOnNilReply) {
     const size_t master_count = 1;
     const size_t slave_count = 1;
@@ -113,6 +113,9 @@ Shard::GetAvailableServers(const CommandControl& command_control, bool with_mast
         case CommandControl::Strategy::kLocalDcConductor:
         case CommandControl::Strategy::kNearestServerPing:
             return GetNearestServersPing(command_control, with_masters, with_slaves);
+
+        case CommandControl::Strategy::kNearestServerLatency:
+            return GetLowestLatencyServers(command_control, with_masters, with_slaves);
     }
 
     /* never reachable */
@@ -152,6 +155,34 @@ Shard::GetNearestServersPing(const CommandControl& command_control, bool with_ma
     return result;
 }
 
+std::vector<unsigned char>
+Shard::GetLowestLatencyServers(const CommandControl& command_control, bool with_masters, bool with_slaves) const {
+    using PairCostNum = std::pair<double, size_t>;
+    std::vector<PairCostNum> sorted_by_cost;
+
+    sorted_by_cost.reserve(instances_.size());
+    for (size_t i = 0; i < instances_.size(); i++) {
+        const auto& cur_inst = instances_[i].instance;
+        const auto& info = instances_[i].info;
+        if (!cur_inst || !cur_inst->IsAvailable()) continue;
+        if ((with_slaves && info.IsReadOnly()) || (with_masters && !info.IsReadOnly())) {
+            sorted_by_cost.emplace_back(cur_inst->GetLatencyCost(), i);
+        }
+    }
+
+    auto result = std::vector<unsigned char>(instances_.size(), 0);
+    if (sorted_by_cost.empty()) return result;
+
+    std::sort(sorted_by_cost.begin(), sorted_by_cost.end());
+
+    // Hedged requests and manual retries go to the next best instances
+    const auto num = sorted_by_cost[command_control.retry_counter % sorted_by_cost.size()].second;
+    result[num] = 1;
+    LOG_DEBUG() << "Trying redis server with the lowest latency, server=" << instances_[num].instance->GetServerHost()
+                << ", latency_us=" << instances_[num].instance->GetReplyLatency().count();
+    return result;
+}
+
 std::shared_ptr<Redis> Shard::GetInstance(
     const std::vector<unsigned char>& available_servers,
     bool is_retry,
@@ -104,6 +104,8 @@ private:
     GetAvailableServers(const CommandControl& command_control, bool with_masters, bool with_slaves) const;
     std::vector<unsigned char>
     GetNearestServersPing(const CommandControl& command_control, bool with_masters, bool with_slaves) const;
+    std::vector<unsigned char>
+    GetLowestLatencyServers(const CommandControl& command_control, bool with_masters, bool with_slaves) const;
 
     std::vector<ConnectionInfoInt> GetConnectionInfosToCreate() const;
     bool UpdateCleanWaitQueue(std::vector<ConnectionStatus>&& add_clean_wait);
@@ -441,12 +441,14 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>
     size_t shard_idx
 ) {
     size_t discarded{0};
+    // A single copy is passed to all the subscribers of the channel
+    const auto shared_message = std::make_shared<const std::string>(message);
     try {
         const std::lock_guard<std::mutex> lock(mutex_);
         auto& m = callback_map_.at(channel);
         for (const auto& it : m.callbacks) {
             try {
-                const auto result = it.second(channel, message);
+                const auto result = it.second(channel, shared_message);
                 switch (result) {
                     case SubscribedCallbackOutcome::kOk:
                         break;  // do nothing
@@ -476,12 +478,13 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>
     size_t shard_idx
 ) {
     size_t discarded{0};
+    const auto shared_message = std::make_shared<const std::string>(message);
     try {
         const std::lock_guard<std::mutex> lock(mutex_);
         auto& m = pattern_callback_map_.at(pattern);
         for (const auto& it : m.callbacks) {
             try {
-                const auto result = it.second(pattern, channel, message);
+                const auto result = it.second(pattern, channel, shared_message);
                 switch (result) {
                     case SubscribedCallbackOutcome::kOk:
                         break;  // do nothing
@@ -510,12 +513,13 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>
     size_t shard_idx
 ) {
     size_t discarded{0};
+    const auto shared_message = std::make_shared<const std::string>(message);
     try {
         const std::lock_guard<std::mutex> lock(mutex_);
         auto& m = sharded_callback_map_.at(channel);
         for (const auto& it : m.callbacks) {
             try {
-                const auto result = it.second(channel, message);
+                const auto result = it.second(channel, shared_message);
                 switch (result) {
                     case SubscribedCallbackOutcome::kOk:
                         break;  // do nothing
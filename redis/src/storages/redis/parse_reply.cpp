@@ -1,5 +1,7 @@
 #include <userver/storages/redis/parse_reply.hpp>
 
+#include <iterator>
+
 #include <userver/storages/redis/reply.hpp>
 #include <userver/utils/from_string.hpp>
 
@@ -209,6 +211,34 @@ ParseReplyDataArray(ReplyData&& array_data, [[maybe_unused]] const std::string&
     return result;
 }
 
+std::vector<StreamEntry>
+ParseReplyDataArray(ReplyData&& array_data, const std::string& request_description, To<std::vector<StreamEntry>>) {
+    std::vector<StreamEntry> result;
+    result.reserve(array_data.GetArray().size());
+
+    for (auto& elem : array_data.GetArray()) {
+        elem.ExpectArray(request_description);
+        if (elem.GetArray().size() != 2) {
+            throw ParseReplyException(
+                "Unexpected reply to '" + request_description +
+                "'. Expected stream entry of 2 elements, got: " + elem.ToDebugString()
+            );
+        }
+
+        StreamEntry entry;
+        entry.id = ExtractStringElem(elem, 0, request_description);
+        auto& fields = elem.GetArray()[1];
+        if (!fields.IsNil()) {
+            fields.ExpectArray(request_description);
+            entry.fields = ParseReplyDataArray(
+                std::move(fields), request_description, To<std::vector<std::pair<std::string, std::string>>>{}
+            );
+        }
+        result.push_back(std::move(entry));
+    }
+    return result;
+}
+
 std::string Parse(ReplyData&& reply_data, const std::string& request_description, To<std::string>) {
     reply_data.ExpectString(request_description);
     return std::move(reply_data.GetString());
@@ -315,6 +345,57 @@ SetReply Parse(ReplyData&& reply_data, const std::string& request_description, T
     return SetReply::kSet;
 }
 
+StreamReadReply Parse(ReplyData&& reply_data, const std::string& request_description, To<StreamReadReply>) {
+    StreamReadReply result;
+    if (reply_data.IsNil()) return result;
+
+    // [[key, [entry, ...]], ...], a single stream is read at a time
+    reply_data.ExpectArray(request_description);
+    for (auto& stream : reply_data.GetArray()) {
+        stream.ExpectArray(request_description);
+        if (stream.GetArray().size() != 2) {
+            throw ParseReplyException(
+                "Unexpected reply to '" + request_description +
+                "'. Expected [key, entries] array, got: " + stream.ToDebugString()
+            );
+        }
+        auto& entries = stream.GetArray()[1];
+        entries.ExpectArray(request_description);
+        auto parsed = ParseReplyDataArray(std::move(entries), request_description, To<std::vector<StreamEntry>>{});
+        result.entries.insert(
+            result.entries.end(), std::make_move_iterator(parsed.begin()), std::make_move_iterator(parsed.end())
+        );
+    }
+    return result;
+}
+
+StreamAutoclaimReply
+Parse(ReplyData&& reply_data, const std::string& request_description, To<StreamAutoclaimReply>) {
+    // [next_id, [entry, ...]] or [next_id, [entry, ...], [deleted_id, ...]]
+    reply_data.ExpectArray(request_description);
+    if (reply_data.GetArray().size() < 2) {
+        throw ParseReplyException(
+            "Unexpected reply to '" + request_description +
+            "'. Expected at least 2 elements in array, got: " + reply_data.ToDebugString()
+        );
+    }
+
+    StreamAutoclaimReply result;
+    result.next_id = ExtractStringElem(reply_data, 0, request_description);
+    auto& entries = reply_data.GetArray()[1];
+    entries.ExpectArray(request_description);
+    result.entries = ParseReplyDataArray(std::move(entries), request_description, To<std::vector<StreamEntry>>{});
+    return result;
+}
+
+XgroupCreateReply Parse(ReplyData&& reply_data, const std::string& request_description, To<XgroupCreateReply>) {
+    if (reply_data.IsError() && !reply_data.GetError().compare(0, 10, "BUSYGROUP ")) {
+        return XgroupCreateReply::kAlreadyExists;
+    }
+    reply_data.ExpectStatusEqualTo(kOk, request_description);
+    return XgroupCreateReply::kCreated;
+}
+
 std::unordered_set<std::string>
 Parse(ReplyData&& reply_data, const std::string& request_description, To<std::unordered_set<std::string>>) {
     reply_data.ExpectArray(request_description);
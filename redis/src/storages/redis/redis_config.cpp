@@ -88,6 +88,7 @@ Parse(const formats::json::Value& elem, formats::parse::To<MetricsSettings::Dyna
     result.command_timings_enabled = elem["command-timings-enabled"].As<bool>(result.command_timings_enabled);
     result.request_sizes_enabled = elem["request-sizes-enabled"].As<bool>(result.request_sizes_enabled);
     result.reply_sizes_enabled = elem["reply-sizes-enabled"].As<bool>(result.reply_sizes_enabled);
+    result.batch_sizes_enabled = elem["batch-sizes-enabled"].As<bool>(result.batch_sizes_enabled);
     return result;
 }
 
@@ -2,9 +2,14 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include <storages/redis/impl/request.hpp>
 #include <userver/storages/redis/base.hpp>
+#include <userver/storages/redis/exception.hpp>
 #include <userver/utils/assert.hpp>
 
 #include <userver/storages/redis/client.hpp>
@@ -66,12 +71,18 @@ private:
     impl::Request request_;
 };
 
+/// Request of a multi-key command that has been split into several requests.
+/// Moves the elements of their replies back to the positions of the keys in
+/// the original command.
 template <typename Result, typename ReplyType>
-class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
+class ScatteredRequestDataImpl final : public RequestDataBase<ReplyType> {
     using RequestDataPtr = std::unique_ptr<RequestDataBase<ReplyType>>;
 
 public:
-    explicit AggregateRequestDataImpl(std::vector<RequestDataPtr>&& requests) : requests_(std::move(requests)) {}
+    ScatteredRequestDataImpl(std::vector<RequestDataPtr>&& requests, std::vector<std::vector<size_t>>&& positions)
+        : requests_(std::move(requests)), positions_(std::move(positions)) {
+        UASSERT(requests_.size() == positions_.size());
+    }
 
     void Wait() override {
         for (auto& request : requests_) {
@@ -80,12 +91,28 @@ public:
     }
 
     ReplyType Get(const std::string& request_description) override {
-        std::vector<typename ReplyType::value_type> result;
-        for (auto& request : requests_) {
-            auto data = request->Get(request_description);
-            std::move(data.begin(), data.end(), std::back_inserter(result));
+        if constexpr (std::is_void_v<ReplyType>) {
+            for (auto& request : requests_) request->Get(request_description);
+        } else {
+            size_t size = 0;
+            for (const auto& positions : positions_) size += positions.size();
+
+            ReplyType result(size);
+            for (size_t i = 0; i < requests_.size(); ++i) {
+                auto data = requests_[i]->Get(request_description);
+                const auto& positions = positions_[i];
+                if (data.size() != positions.size()) {
+                    throw ParseReplyException(fmt::format(
+                        "Unexpected number of elements in the reply of {}: {} instead of {}",
+                        request_description,
+                        data.size(),
+                        positions.size()
+                    ));
+                }
+                for (size_t j = 0; j < positions.size(); ++j) result[positions[j]] = std::move(data[j]);
+            }
+            return result;
         }
-        return result;
     }
 
     ReplyPtr GetRaw() override {
@@ -100,6 +127,7 @@ public:
 
 private:
     std::vector<RequestDataPtr> requests_;
+    std::vector<std::vector<size_t>> positions_;
 };
 
 template <typename Result, typename ReplyType>
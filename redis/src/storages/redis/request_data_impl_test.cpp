@@ -0,0 +1,42 @@
+#include <storages/redis/request_data_impl.hpp>
+
+#include <userver/storages/redis/reply.hpp>
+#include <userver/storages/redis/request.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using storages::redis::ReplyData;
+using MgetReply = storages::redis::RequestMget::Reply;
+using MgetResult = storages::redis::RequestMget::Result;
+
+std::unique_ptr<storages::redis::RequestDataBase<MgetReply>> MakeMgetData(ReplyData::Array&& values) {
+    return std::make_unique<storages::redis::DummyRequestDataImpl<MgetResult, MgetReply>>(
+        std::make_shared<storages::redis::Reply>("mget", ReplyData{std::move(values)})
+    );
+}
+
+}  // namespace
+
+TEST(ScatteredRequestData, RestoresOrder) {
+    std::vector<std::unique_ptr<storages::redis::RequestDataBase<MgetReply>>> requests;
+    requests.push_back(MakeMgetData({ReplyData{"b"}, ReplyData::CreateNil()}));
+    requests.push_back(MakeMgetData({ReplyData{"a"}, ReplyData{"c"}}));
+
+    storages::redis::ScatteredRequestDataImpl<MgetResult, MgetReply> data{std::move(requests), {{1, 3}, {0, 2}}};
+    const MgetReply expected{"a", "b", "c", std::nullopt};
+    EXPECT_EQ(data.Get("mget"), expected);
+}
+
+TEST(ScatteredRequestData, SizeMismatch) {
+    std::vector<std::unique_ptr<storages::redis::RequestDataBase<MgetReply>>> requests;
+    requests.push_back(MakeMgetData({ReplyData{"a"}}));
+    requests.push_back(MakeMgetData({ReplyData{"b"}}));
+
+    storages::redis::ScatteredRequestDataImpl<MgetResult, MgetReply> data{std::move(requests), {{0}, {1, 2}}};
+    EXPECT_THROW(data.Get("mget"), storages::redis::ParseReplyException);
+}
+
+USERVER_NAMESPACE_END
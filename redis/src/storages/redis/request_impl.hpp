@@ -18,16 +18,16 @@ Request CreateRequest(impl::Request&& request) {
 }
 
 template <typename Request>
-Request CreateAggregateRequest(std::vector<impl::Request>&& requests) {
+Request CreateScatteredRequest(std::vector<impl::Request>&& requests, std::vector<std::vector<size_t>>&& positions) {
     using ThisRequestDataImpl = RequestDataImpl<typename Request::Result, typename Request::Reply>;
-    using ThisAggregateRequestDataImpl = AggregateRequestDataImpl<typename Request::Result, typename Request::Reply>;
+    using ThisScatteredRequestDataImpl = ScatteredRequestDataImpl<typename Request::Result, typename Request::Reply>;
 
     std::vector<std::unique_ptr<RequestDataBase<typename Request::Reply>>> req_data;
     req_data.reserve(requests.size());
     for (auto& request : requests) {
         req_data.push_back(std::make_unique<ThisRequestDataImpl>(std::move(request)));
     }
-    return Request(std::make_unique<ThisAggregateRequestDataImpl>(std::move(req_data)));
+    return Request(std::make_unique<ThisScatteredRequestDataImpl>(std::move(req_data), std::move(positions)));
 }
 
 template <typename Request>
@@ -0,0 +1,30 @@
+#include <userver/storages/redis/script.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/crypto/hash.hpp>
+#include <userver/storages/redis/exception.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+Script::Script(std::string body) : body_(std::move(body)), sha1_(crypto::hash::Sha1(body_)) {}
+
+void Script::Load(Client& client, const CommandControl& command_control) const {
+    std::vector<RequestScriptLoad> requests;
+    requests.reserve(client.ShardsCount());
+    for (size_t shard = 0; shard < client.ShardsCount(); ++shard) {
+        requests.push_back(client.ScriptLoad(body_, shard, command_control));
+    }
+    for (auto& request : requests) {
+        const auto sha1 = request.Get("script load");
+        if (sha1 != sha1_) {
+            throw ParseReplyException(fmt::format("Unexpected SHA1 of a loaded script: {} instead of {}", sha1, sha1_));
+        }
+    }
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
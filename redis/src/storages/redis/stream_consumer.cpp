@@ -0,0 +1,150 @@
+#include <userver/storages/redis/stream_consumer.hpp>
+
+#include <algorithm>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+// Start of the pending entries list of this consumer
+const std::string kPendingStart = "0";
+// Entries that were never delivered to the consumers of the group
+const std::string kNewEntries = ">";
+// Start of the pending entries list of the whole group for XAUTOCLAIM, it is
+// also returned when the scan is over
+const std::string kClaimStart = "0-0";
+// Create the group so that it gets only the entries added after that
+const std::string kGroupStartId = "$";
+
+}  // namespace
+
+StreamConsumer::StreamConsumer(ClientPtr client, std::vector<std::string> keys, StreamConsumerSettings settings)
+    : client_(std::move(client)), keys_(std::move(keys)), settings_(std::move(settings)) {
+    UINVARIANT(client_, "Stream consumer requires a client");
+    UINVARIANT(!settings_.group.empty() && !settings_.consumer.empty(), "Stream consumer requires group and consumer");
+    UINVARIANT(settings_.batch_size > 0, "Stream consumer batch size must be positive");
+}
+
+StreamConsumer::~StreamConsumer() { Stop(); }
+
+void StreamConsumer::Start(Callback callback) {
+    UINVARIANT(tasks_.empty(), "Stream consumer is already started");
+    callback_ = std::move(callback);
+    tasks_.reserve(keys_.size());
+    for (const auto& key : keys_) {
+        tasks_.push_back(utils::CriticalAsync("redis-stream-consumer-" + key, [this, &key] { RunLoop(key); }));
+    }
+}
+
+void StreamConsumer::Stop() noexcept {
+    for (auto& task : tasks_) task.RequestCancel();
+    for (auto& task : tasks_) task.SyncCancel();
+    tasks_.clear();
+}
+
+void StreamConsumer::RunLoop(const std::string& key) {
+    const auto& cc = settings_.command_control;
+    const bool claim_enabled = settings_.claim_min_idle_time.count() > 0;
+
+    bool group_ready = false;
+    // The own pending entries are read first, as they were delivered to this
+    // consumer before but may have not been processed
+    bool read_pending = true;
+    std::string pending_id = kPendingStart;
+    std::string claim_id = kClaimStart;
+    auto next_claim = USERVER_NAMESPACE::utils::datetime::SteadyNow();
+
+    while (!engine::current_task::ShouldCancel()) {
+        try {
+            if (!group_ready) {
+                client_->XgroupCreate(key, settings_.group, kGroupStartId, true, cc).Get();
+                group_ready = true;
+            }
+
+            std::vector<StreamEntry> entries;
+            if (claim_enabled && USERVER_NAMESPACE::utils::datetime::SteadyNow() >= next_claim) {
+                auto reply = client_
+                                 ->Xautoclaim(
+                                     key,
+                                     settings_.group,
+                                     settings_.consumer,
+                                     settings_.claim_min_idle_time,
+                                     claim_id,
+                                     settings_.batch_size,
+                                     cc
+                                 )
+                                 .Get();
+                claim_id = std::move(reply.next_id);
+                if (claim_id == kClaimStart) {
+                    next_claim = USERVER_NAMESPACE::utils::datetime::SteadyNow() + settings_.claim_interval;
+                }
+                entries = std::move(reply.entries);
+            }
+
+            if (entries.empty()) {
+                auto reply = client_
+                                 ->Xreadgroup(
+                                     key,
+                                     settings_.group,
+                                     settings_.consumer,
+                                     settings_.batch_size,
+                                     read_pending ? pending_id : kNewEntries,
+                                     cc
+                                 )
+                                 .Get();
+                entries = std::move(reply.entries);
+                if (read_pending) {
+                    if (entries.empty()) {
+                        read_pending = false;
+                    } else {
+                        pending_id = entries.back().id;
+                    }
+                }
+            }
+
+            if (entries.empty()) {
+                engine::InterruptibleSleepFor(settings_.poll_interval);
+                continue;
+            }
+            ProcessBatch(key, std::move(entries));
+        } catch (const std::exception& e) {
+            if (engine::current_task::ShouldCancel()) break;
+            LOG_LIMITED_WARNING() << "Failed to consume redis stream '" << key << "': " << e;
+
+            // Unacknowledged entries stay in the pending list of this consumer
+            read_pending = true;
+            pending_id = kPendingStart;
+            engine::InterruptibleSleepFor(settings_.poll_interval);
+        }
+    }
+}
+
+void StreamConsumer::ProcessBatch(const std::string& key, std::vector<StreamEntry> entries) {
+    std::vector<std::string> ids;
+    ids.reserve(entries.size());
+    for (const auto& entry : entries) ids.push_back(entry.id);
+
+    // Entries deleted from the stream while being pending have no fields, they
+    // are acknowledged without being passed to the callback
+    entries.erase(
+        std::remove_if(entries.begin(), entries.end(), [](const StreamEntry& entry) { return entry.fields.empty(); }),
+        entries.end()
+    );
+    if (!entries.empty()) callback_(key, std::move(entries));
+
+    client_->Xack(key, settings_.group, std::move(ids), settings_.command_control).Get();
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,135 @@
+#include <userver/storages/redis/stream_consumer.hpp>
+
+#include <stdexcept>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/storages/redis/mock_client_google.hpp>
+#include <userver/storages/redis/mock_request.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using storages::redis::StreamEntry;
+using testing::_;
+
+constexpr std::chrono::seconds kWaitTimeout{10};
+
+using Entries = std::vector<StreamEntry>;
+
+StreamEntry MakeEntry(std::string id) { return {std::move(id), {{"field", "value"}}}; }
+
+auto ReadReply(Entries entries) {
+    return [entries = std::move(entries)](auto&&...) {
+        return storages::redis::CreateMockRequest<storages::redis::RequestXreadgroup>(
+            storages::redis::StreamReadReply{entries}
+        );
+    };
+}
+
+struct Mocks {
+    std::shared_ptr<storages::redis::GMockClient> client = std::make_shared<storages::redis::GMockClient>();
+    engine::SingleConsumerEvent acked;
+
+    Mocks() {
+        EXPECT_CALL(*client, XgroupCreate("stream", "group", "$", true, _)).WillOnce([](auto&&...) {
+            return storages::redis::CreateMockRequest<storages::redis::RequestXgroupCreate>(
+                storages::redis::XgroupCreateReply::kCreated
+            );
+        });
+    }
+
+    void ExpectRead(const std::string& id, std::vector<Entries> replies) {
+        auto& expectation = EXPECT_CALL(*client, Xreadgroup("stream", "group", "consumer", 10, id, _));
+        for (auto& reply : replies) expectation.WillOnce(ReadReply(std::move(reply)));
+        expectation.WillRepeatedly(ReadReply({}));
+    }
+
+    void ExpectAck(std::vector<std::string> ids) {
+        const auto size = ids.size();
+        EXPECT_CALL(*client, Xack("stream", "group", std::move(ids), _)).WillOnce([this, size](auto&&...) {
+            acked.Send();
+            return storages::redis::CreateMockRequest<storages::redis::RequestXack>(size);
+        });
+    }
+};
+
+storages::redis::StreamConsumerSettings MakeSettings() {
+    storages::redis::StreamConsumerSettings settings;
+    settings.group = "group";
+    settings.consumer = "consumer";
+    settings.batch_size = 10;
+    settings.poll_interval = std::chrono::milliseconds{1};
+    settings.claim_min_idle_time = std::chrono::milliseconds{0};
+    return settings;
+}
+
+}  // namespace
+
+UTEST(StreamConsumer, Batch) {
+    Mocks mocks;
+    mocks.ExpectRead("0", {});
+    mocks.ExpectRead(">", {{MakeEntry("1-0"), MakeEntry("2-0")}});
+    mocks.ExpectAck({"1-0", "2-0"});
+
+    Entries consumed;
+    storages::redis::StreamConsumer consumer{mocks.client, {"stream"}, MakeSettings()};
+    consumer.Start([&](const std::string& key, Entries entries) {
+        EXPECT_EQ(key, "stream");
+        consumed = std::move(entries);
+    });
+
+    ASSERT_TRUE(mocks.acked.WaitForEventFor(kWaitTimeout));
+    consumer.Stop();
+    EXPECT_EQ(consumed, (Entries{MakeEntry("1-0"), MakeEntry("2-0")}));
+}
+
+UTEST(StreamConsumer, CallbackFailure) {
+    Mocks mocks;
+    // The failed batch is read again from the pending entries list
+    mocks.ExpectRead("0", {{}, {MakeEntry("1-0")}});
+    mocks.ExpectRead("1-0", {});
+    mocks.ExpectRead(">", {{MakeEntry("1-0")}});
+    mocks.ExpectAck({"1-0"});
+
+    int calls = 0;
+    storages::redis::StreamConsumer consumer{mocks.client, {"stream"}, MakeSettings()};
+    consumer.Start([&](const std::string&, Entries entries) {
+        EXPECT_EQ(entries, Entries{MakeEntry("1-0")});
+        if (++calls == 1) throw std::runtime_error("processing failed");
+    });
+
+    ASSERT_TRUE(mocks.acked.WaitForEventFor(kWaitTimeout));
+    consumer.Stop();
+    EXPECT_EQ(calls, 2);
+}
+
+UTEST(StreamConsumer, Autoclaim) {
+    Mocks mocks;
+    mocks.ExpectRead("0", {});
+    mocks.ExpectRead(">", {});
+    EXPECT_CALL(*mocks.client, Xautoclaim("stream", "group", "consumer", std::chrono::milliseconds{1000}, "0-0", 10, _))
+        .WillOnce([](auto&&...) {
+            // The deleted entry is acknowledged, but is not passed to the callback
+            return storages::redis::CreateMockRequest<storages::redis::RequestXautoclaim>(
+                storages::redis::StreamAutoclaimReply{"0-0", {MakeEntry("1-0"), {"2-0", {}}}}
+            );
+        });
+    mocks.ExpectAck({"1-0", "2-0"});
+
+    Entries consumed;
+    auto settings = MakeSettings();
+    settings.claim_min_idle_time = std::chrono::seconds{1};
+    settings.claim_interval = std::chrono::hours{1};
+    storages::redis::StreamConsumer consumer{mocks.client, {"stream"}, settings};
+    consumer.Start([&](const std::string&, Entries entries) {
+        consumed = std::move(entries);
+    });
+
+    ASSERT_TRUE(mocks.acked.WaitForEventFor(kWaitTimeout));
+    consumer.Stop();
+    EXPECT_EQ(consumed, Entries{MakeEntry("1-0")});
+}
+
+USERVER_NAMESPACE_END
@@ -31,7 +31,18 @@ void SubscriptionQueue<Item>::SetMaxLength(size_t length) {
 
 template <typename Item>
 bool SubscriptionQueue<Item>::PopMessage(Item& msg_ptr) {
-    return consumer_.Pop(msg_ptr);
+    if (!consumer_.Pop(msg_ptr)) return false;
+    const auto lag = USERVER_NAMESPACE::utils::datetime::SteadyNow() - msg_ptr.enqueued_at;
+    lag_.store(std::chrono::duration_cast<std::chrono::microseconds>(lag), std::memory_order_relaxed);
+    return true;
+}
+
+template <typename Item>
+SubscriptionQueueStatistics SubscriptionQueue<Item>::GetStatistics() const {
+    SubscriptionQueueStatistics stats;
+    stats.queue_length = queue_->GetSizeApproximate();
+    stats.lag = lag_.load(std::memory_order_relaxed);
+    return stats;
 }
 
 template <typename Item>
@@ -49,12 +60,12 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
 ) {
     return subscribe_sentinel.Subscribe(
         channel,
-        [this](const std::string& channel, const std::string& message) {
+        [this](const std::string& channel, const SharedMessage& message) {
             Outcome result{Outcome::kOk};
             if (!producer_.PushNoblock(Item(message))) {
                 // Use SubscriptionQueue::SetMaxLength() or
                 // SubscriptionToken::SetMaxQueueLength() if limit is too low
-                LOG_ERROR() << "failed to push message '" << message << "' from channel '" << channel
+                LOG_ERROR() << "failed to push message '" << *message << "' from channel '" << channel
                             << "' into subscription queue due to overflow (max length=" << queue_->GetSoftMaxSize()
                             << ')';
                 // either this line
@@ -77,12 +88,12 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
 ) {
     return subscribe_sentinel.Psubscribe(
         pattern,
-        [this](const std::string& pattern, const std::string& channel, const std::string& message) {
+        [this](const std::string& pattern, const std::string& channel, const SharedMessage& message) {
             Outcome result{Outcome::kOk};
             if (!producer_.PushNoblock(Item(channel, message))) {
                 // Use SubscriptionQueue::SetMaxLength() or
                 // SubscriptionToken::SetMaxQueueLength() if limit is too low
-                LOG_ERROR() << "failed to push pmessage '" << message << "' from channel '" << channel
+                LOG_ERROR() << "failed to push pmessage '" << *message << "' from channel '" << channel
                             << "' from pattern '" << pattern
                             << "' into subscription queue due to overflow (max length=" << queue_->GetSoftMaxSize()
                             << ')';
@@ -106,12 +117,12 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
 ) {
     return subscribe_sentinel.Ssubscribe(
         channel,
-        [this](const std::string& channel, const std::string& message) {
+        [this](const std::string& channel, const SharedMessage& message) {
             Outcome result{Outcome::kOk};
             if (!producer_.PushNoblock(Item(message))) {
                 // Use SubscriptionQueue::SetMaxLength() or
                 // SubscriptionToken::SetMaxQueueLength() if limit is too low
-                LOG_ERROR() << "failed to push message '" << message << "' from channel '" << channel
+                LOG_ERROR() << "failed to push message '" << *message << "' from channel '" << channel
                             << "' into subscription queue due to overflow (max length=" << queue_->GetSoftMaxSize()
                             << ')';
                 // either this line
@@ -1,36 +1,49 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
 
 #include <storages/redis/impl/subscribe_sentinel.hpp>
 #include <userver/concurrent/queue.hpp>
+#include <userver/storages/redis/subscription_token.hpp>
+#include <userver/utils/datetime.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis {
 
+using SharedMessage = impl::Sentinel::SharedMessage;
+
 struct ChannelSubscriptionQueueItem {
-    std::string message;
+    SharedMessage message;
+    std::chrono::steady_clock::time_point enqueued_at;
 
     ChannelSubscriptionQueueItem() = default;
-    explicit ChannelSubscriptionQueueItem(std::string message) : message(std::move(message)) {}
+    explicit ChannelSubscriptionQueueItem(SharedMessage message)
+        : message(std::move(message)), enqueued_at(USERVER_NAMESPACE::utils::datetime::SteadyNow()) {}
 };
 
 struct PatternSubscriptionQueueItem {
     std::string channel;
-    std::string message;
+    SharedMessage message;
+    std::chrono::steady_clock::time_point enqueued_at;
 
     PatternSubscriptionQueueItem() = default;
-    PatternSubscriptionQueueItem(std::string channel, std::string message)
-        : channel(std::move(channel)), message(std::move(message)) {}
+    PatternSubscriptionQueueItem(std::string channel, SharedMessage message)
+        : channel(std::move(channel)),
+          message(std::move(message)),
+          enqueued_at(USERVER_NAMESPACE::utils::datetime::SteadyNow()) {}
 };
 
 struct ShardedSubscriptionQueueItem {
-    std::string message;
+    SharedMessage message;
+    std::chrono::steady_clock::time_point enqueued_at;
 
     ShardedSubscriptionQueueItem() = default;
-    explicit ShardedSubscriptionQueueItem(std::string message) : message(std::move(message)) {}
+    explicit ShardedSubscriptionQueueItem(SharedMessage message)
+        : message(std::move(message)), enqueued_at(USERVER_NAMESPACE::utils::datetime::SteadyNow()) {}
 };
 
 template <typename Item>
@@ -50,6 +63,8 @@ public:
 
     bool PopMessage(Item& msg_ptr);
 
+    SubscriptionQueueStatistics GetStatistics() const;
+
     void Unsubscribe();
 
 private:
@@ -85,6 +100,8 @@ private:
     typename Queue::Producer producer_;
     typename Queue::Consumer consumer_;
     std::unique_ptr<impl::SubscriptionToken> token_;
+    // Time spent in the queue by the last popped message
+    std::atomic<std::chrono::microseconds> lag_{};
 };
 
 extern template class SubscriptionQueue<ChannelSubscriptionQueueItem>;
@@ -14,6 +14,8 @@ namespace storages::redis {
 
 namespace impl {
 SubscriptionTokenImplBase::~SubscriptionTokenImplBase() = default;
+
+SubscriptionQueueStatistics SubscriptionTokenImplBase::GetQueueStatistics() const { return {}; }
 }
 
 SubscriptionToken::SubscriptionToken() = default;
@@ -32,6 +34,11 @@ void SubscriptionToken::SetMaxQueueLength(size_t length) {
     impl_->SetMaxQueueLength(length);
 }
 
+SubscriptionQueueStatistics SubscriptionToken::GetQueueStatistics() const {
+    if (!impl_) return {};
+    return impl_->GetQueueStatistics();
+}
+
 void SubscriptionToken::Unsubscribe() {
     if (!impl_) return;
     impl_->Unsubscribe();
@@ -35,11 +35,13 @@ void SubscriptionTokenImpl::Unsubscribe() {
     subscriber_task_.SyncCancel();
 }
 
+SubscriptionQueueStatistics SubscriptionTokenImpl::GetQueueStatistics() const { return queue_.GetStatistics(); }
+
 void SubscriptionTokenImpl::ProcessMessages() {
     ChannelSubscriptionQueueItem msg;
     while (queue_.PopMessage(msg)) {
         tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-        if (on_message_cb_) on_message_cb_(channel_, msg.message);
+        if (on_message_cb_) on_message_cb_(channel_, *msg.message);
     }
 }
 
@@ -63,11 +65,13 @@ void PsubscriptionTokenImpl::Unsubscribe() {
     subscriber_task_.SyncCancel();
 }
 
+SubscriptionQueueStatistics PsubscriptionTokenImpl::GetQueueStatistics() const { return queue_.GetStatistics(); }
+
 void PsubscriptionTokenImpl::ProcessMessages() {
     PatternSubscriptionQueueItem msg;
     while (queue_.PopMessage(msg)) {
         tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-        if (on_pmessage_cb_) on_pmessage_cb_(pattern_, msg.channel, msg.message);
+        if (on_pmessage_cb_) on_pmessage_cb_(pattern_, msg.channel, *msg.message);
     }
 }
 
@@ -91,11 +95,13 @@ void SsubscriptionTokenImpl::Unsubscribe() {
     subscriber_task_.SyncCancel();
 }
 
+SubscriptionQueueStatistics SsubscriptionTokenImpl::GetQueueStatistics() const { return queue_.GetStatistics(); }
+
 void SsubscriptionTokenImpl::ProcessMessages() {
     ShardedSubscriptionQueueItem msg;
     while (queue_.PopMessage(msg)) {
         tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-        if (on_message_cb_) on_message_cb_(channel_, msg.message);
+        if (on_message_cb_) on_message_cb_(channel_, *msg.message);
     }
 }
 
@@ -28,6 +28,8 @@ public:
 
     void Unsubscribe() override;
 
+    SubscriptionQueueStatistics GetQueueStatistics() const override;
+
 private:
     void ProcessMessages();
 
@@ -54,6 +56,8 @@ public:
 
     void Unsubscribe() override;
 
+    SubscriptionQueueStatistics GetQueueStatistics() const override;
+
 private:
     void ProcessMessages();
 
@@ -80,6 +84,8 @@ public:
 
     void Unsubscribe() override;
 
+    SubscriptionQueueStatistics GetQueueStatistics() const override;
+
 private:
     void ProcessMessages();
 
@@ -310,6 +310,40 @@ public:
 
     RequestType Type(std::string key, const CommandControl& command_control) override;
 
+    RequestXack Xack(
+        std::string key,
+        std::string group,
+        std::vector<std::string> ids,
+        const CommandControl& command_control
+    ) override;
+
+    RequestXautoclaim Xautoclaim(
+        std::string key,
+        std::string group,
+        std::string consumer,
+        std::chrono::milliseconds min_idle_time,
+        std::string start,
+        size_t count,
+        const CommandControl& command_control
+    ) override;
+
+    RequestXgroupCreate XgroupCreate(
+        std::string key,
+        std::string group,
+        std::string id,
+        bool mkstream,
+        const CommandControl& command_control
+    ) override;
+
+    RequestXreadgroup Xreadgroup(
+        std::string key,
+        std::string group,
+        std::string consumer,
+        size_t count,
+        std::string id,
+        const CommandControl& command_control
+    ) override;
+
     RequestZadd Zadd(std::string key, double score, std::string member, const CommandControl& command_control) override;
 
     RequestZadd Zadd(
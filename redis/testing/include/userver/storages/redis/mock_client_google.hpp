@@ -397,6 +397,45 @@ public:
 
     MOCK_METHOD(RequestType, Type, (std::string key, const CommandControl& command_control), (override));
 
+    MOCK_METHOD(
+        RequestXack,
+        Xack,
+        (std::string key, std::string group, std::vector<std::string> ids, const CommandControl& command_control),
+        (override)
+    );
+
+    MOCK_METHOD(
+        RequestXautoclaim,
+        Xautoclaim,
+        (std::string key,
+         std::string group,
+         std::string consumer,
+         std::chrono::milliseconds min_idle_time,
+         std::string start,
+         size_t count,
+         const CommandControl& command_control),
+        (override)
+    );
+
+    MOCK_METHOD(
+        RequestXgroupCreate,
+        XgroupCreate,
+        (std::string key, std::string group, std::string id, bool mkstream, const CommandControl& command_control),
+        (override)
+    );
+
+    MOCK_METHOD(
+        RequestXreadgroup,
+        Xreadgroup,
+        (std::string key,
+         std::string group,
+         std::string consumer,
+         size_t count,
+         std::string id,
+         const CommandControl& command_control),
+        (override)
+    );
+
     MOCK_METHOD(
         RequestZadd,
         Zadd,
@@ -55,6 +55,8 @@ public:
     MOCK_METHOD(void, SetMaxQueueLength, (size_t length), (override));
 
     MOCK_METHOD(void, Unsubscribe, (), (override));
+
+    MOCK_METHOD(SubscriptionQueueStatistics, GetQueueStatistics, (), (const, override));
 };
 
 }  // namespace storages::redis
@@ -3,10 +3,17 @@
 /// @file userver/storages/rocks/client.hpp
 /// @brief @copybrief storages::rocks::Client
 
+#include <cstddef>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <rocksdb/db.h>
+#include <rocksdb/write_batch.h>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
 
@@ -14,12 +21,114 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+/**
+ * @brief Settings of the storages::rocks::Client.
+ */
+struct ClientSettings final {
+    /// Size of the LRU block cache shared by all the column families, the
+    /// RocksDB default is used if zero
+    std::size_t block_cache_size_bytes{0};
+
+    /// Bits per key of the bloom filter, no filter is used if zero
+    int bloom_filter_bits_per_key{0};
+
+    /// Column families besides the default one, created if missing. All the
+    /// existing column families of the database should be listed.
+    std::vector<std::string> column_families;
+};
+
+/**
+ * @brief Handle of a column family, retrieved from
+ * storages::rocks::Client::GetColumnFamily.
+ *
+ * Valid while the client is alive.
+ */
+class ColumnFamily final {
+public:
+    /// @cond
+    explicit ColumnFamily(rocksdb::ColumnFamilyHandle* handle) : handle_(handle) {}
+
+    rocksdb::ColumnFamilyHandle* GetNative() const { return handle_; }
+    /// @endcond
+
+private:
+    rocksdb::ColumnFamilyHandle* handle_;
+};
+
+/**
+ * @brief A set of updates that is applied atomically by
+ * storages::rocks::Client::Write.
+ *
+ * Updates are buffered in memory, filling the batch does not touch the
+ * database.
+ */
+class WriteBatch final {
+public:
+    /// Puts a record into the default column family.
+    void Put(std::string_view key, std::string_view value);
+
+    /// Puts a record into the column family.
+    void Put(ColumnFamily column_family, std::string_view key, std::string_view value);
+
+    /// Deletes a record from the default column family.
+    void Delete(std::string_view key);
+
+    /// Deletes a record from the column family.
+    void Delete(ColumnFamily column_family, std::string_view key);
+
+    /// Returns the number of updates in the batch.
+    std::size_t GetSize() const;
+
+    /// @cond
+    rocksdb::WriteBatch& GetNative() { return batch_; }
+    /// @endcond
+
+private:
+    rocksdb::WriteBatch batch_;
+};
+
+/**
+ * @brief Read-only cursor over a range of keys, retrieved from
+ * storages::rocks::Client::Scan or storages::rocks::Client::ScanPrefix.
+ *
+ * Records are read in chunks on the blocking task processor, in the order of
+ * the keys. The cursor reads a consistent snapshot of the database, and the
+ * client must outlive it.
+ */
+class Cursor final {
+public:
+    using Record = std::pair<std::string, std::string>;
+
+    Cursor(Cursor&&) noexcept;
+    Cursor& operator=(Cursor&&) = delete;
+    ~Cursor();
+
+    /**
+     * @brief Reads the next chunk of records.
+     *
+     * @returns up to `chunk_size` records, empty if the range is exhausted.
+     */
+    std::vector<Record> NextChunk();
+
+private:
+    friend class Client;
+
+    class Impl;
+
+    explicit Cursor(std::unique_ptr<Impl> impl);
+
+    std::unique_ptr<Impl> impl_;
+};
+
 /**
  * @brief Client for working with RocksDB storage.
  *
  * This class provides an interface for interacting with the RocksDB database.
  * To use the class, you need to specify the database path when creating an
  * object.
+ *
+ * Each call is executed on the blocking task processor, so prefer the batched
+ * methods (Write, MultiGet, Scan) to a series of single-key calls.
  */
 class Client final {
 public:
@@ -32,6 +141,25 @@ public:
      */
     Client(const std::string& db_path, engine::TaskProcessor& blocking_task_processor);
 
+    /**
+     * @brief Constructor of the Client class.
+     *
+     * @param db_path The path to the RocksDB database.
+     * @param blocking_task_processor - task processor to execute blocking FS
+     * operations
+     * @param settings - cache, filter and column families settings
+     */
+    Client(const std::string& db_path, engine::TaskProcessor& blocking_task_processor, const ClientSettings& settings);
+
+    ~Client();
+
+    /**
+     * @brief Returns the handle of a column family listed in the settings.
+     *
+     * @throws storages::rocks::Exception if there is no such column family.
+     */
+    ColumnFamily GetColumnFamily(std::string_view name) const;
+
     /**
      * @brief Puts a record into the database.
      *
@@ -40,6 +168,11 @@ public:
      */
     void Put(std::string_view key, std::string_view value);
 
+    /**
+     * @brief Puts a record into the column family.
+     */
+    void Put(ColumnFamily column_family, std::string_view key, std::string_view value);
+
     /**
      * @brief Retrieves the value of a record from the database by key.
      *
@@ -47,6 +180,26 @@ public:
      */
     std::string Get(std::string_view key);
 
+    /**
+     * @brief Retrieves the value of a record from the column family by key.
+     */
+    std::string Get(ColumnFamily column_family, std::string_view key);
+
+    /**
+     * @brief Retrieves the values of records by keys in a single call.
+     *
+     * @param keys The keys of the records.
+     * @returns values in the order of the keys, std::nullopt for missing keys.
+     */
+    std::vector<std::optional<std::string>> MultiGet(const std::vector<std::string_view>& keys);
+
+    /**
+     * @brief Retrieves the values of records of the column family by keys in
+     * a single call.
+     */
+    std::vector<std::optional<std::string>>
+    MultiGet(ColumnFamily column_family, const std::vector<std::string_view>& keys);
+
     /**
      * @brief Deletes a record from the database by key.
      *
@@ -54,6 +207,48 @@ public:
      */
     void Delete(std::string_view key);
 
+    /**
+     * @brief Deletes a record from the column family by key.
+     */
+    void Delete(ColumnFamily column_family, std::string_view key);
+
+    /**
+     * @brief Atomically applies all the updates of the batch.
+     */
+    void Write(WriteBatch&& batch);
+
+    /**
+     * @brief Returns a cursor over the keys in the range [begin, end).
+     *
+     * @param begin The first key of the range.
+     * @param end The key after the last key of the range, std::nullopt to read
+     * to the end.
+     * @param chunk_size The number of records read by a single NextChunk call.
+     */
+    Cursor Scan(std::string_view begin, std::optional<std::string_view> end, std::size_t chunk_size);
+
+    /**
+     * @brief Returns a cursor over the keys of the column family in the range
+     * [begin, end).
+     */
+    Cursor Scan(
+        ColumnFamily column_family,
+        std::string_view begin,
+        std::optional<std::string_view> end,
+        std::size_t chunk_size
+    );
+
+    /**
+     * @brief Returns a cursor over the keys starting with the prefix.
+     */
+    Cursor ScanPrefix(std::string_view prefix, std::size_t chunk_size);
+
+    /**
+     * @brief Returns a cursor over the keys of the column family starting with
+     * the prefix.
+     */
+    Cursor ScanPrefix(ColumnFamily column_family, std::string_view prefix, std::size_t chunk_size);
+
     /**
      * Checks the status of an operation and handles any errors based on the given
      * method name.
@@ -64,7 +259,11 @@ public:
     void CheckStatus(rocksdb::Status status, std::string_view method_name);
 
 private:
+    ColumnFamily GetDefaultColumnFamily() const;
+
     std::unique_ptr<rocksdb::DB> db_;
+    std::vector<rocksdb::ColumnFamilyHandle*> column_family_handles_;
+    std::unordered_map<std::string, rocksdb::ColumnFamilyHandle*> column_families_;
     engine::TaskProcessor& blocking_task_processor_;
 };
 }  // namespace storages::rocks
@@ -23,6 +23,9 @@ namespace storages::rocks {
 /// ---------------------------------- | ------------------------------------------------ | ---------------
 /// task-processor                     | name of the task processor to run the blocking file operations | -
 /// db-path                            | path to database file                            | -
+/// block-cache-size                   | size of the LRU block cache in bytes, RocksDB default if zero | 0
+/// bloom-filter-bits-per-key          | bits per key of the bloom filter, no filter if zero | 0
+/// column-families                    | column families besides the default one, created if missing | []
 
 // clang-format on
 
@@ -0,0 +1,191 @@
+#pragma once
+
+/// @file userver/storages/rocks/lru_cache_component.hpp
+/// @brief @copybrief storages::rocks::PersistentLruCacheComponent
+
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <string>
+
+#include <userver/cache/lru_cache_component_base.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/dump/blocks.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/meta.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <userver/storages/rocks/client.hpp>
+#include <userver/storages/rocks/component.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+// clang-format off
+
+/// @ingroup userver_components userver_base_classes
+///
+/// @brief Base class for LRU-cache components with a persistent second tier
+/// in a local RocksDB storage
+///
+/// Works as cache::LruCacheComponent, but the values received from
+/// PersistentLruCacheComponent::DoGetByKeyFromOrigin are also stored in
+/// RocksDB in the background. On a miss of the in-memory cache the value is
+/// looked up in RocksDB on the blocking task processor before going to the
+/// origin, so the entries evicted from memory and the entries from the
+/// previous runs of the service are still served locally.
+///
+/// Keys and values are serialized with dump::Write and dump::Read, see
+/// @ref scripts/docs/en/userver/cache_dumps.md. Keys are prefixed with the
+/// component name, so a single storages::rocks::Component may be shared by
+/// several caches.
+///
+/// @note Invalidation of the cache does not affect the persistent tier, and
+/// the background updates of the in-memory tier read the persistent tier
+/// first, so set `persistent-lifetime` for the data that goes stale.
+///
+/// ## Static options:
+/// All the options of cache::LruCacheComponent and
+///
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// rocks-component | name of the storages::rocks::Component to store the entries in | --
+/// persistent-lifetime | TTL for the entries of the persistent tier (0 is unlimited) | 0
+
+// clang-format on
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+class PersistentLruCacheComponent : public cache::LruCacheComponent<Key, Value, Hash, Equal> {
+public:
+    PersistentLruCacheComponent(const components::ComponentConfig&, const components::ComponentContext&);
+
+    ~PersistentLruCacheComponent() override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+protected:
+    /// Invoked on a miss of both of the tiers
+    virtual Value DoGetByKeyFromOrigin(const Key& key) = 0;
+
+private:
+    using Base = cache::LruCacheComponent<Key, Value, Hash, Equal>;
+    using TimePoint = std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds>;
+
+    static_assert(
+        dump::kIsDumpable<Key> && dump::kIsDumpable<Value>,
+        "Key and Value should be serializable with dump::Write and dump::Read"
+    );
+
+    Value DoGetByKey(const Key& key) final;
+
+    std::string MakeStorageKey(const Key& key) const;
+    std::optional<Value> ReadPersistent(const std::string& storage_key);
+    void WritePersistent(std::string storage_key, const Value& value);
+
+    const std::string key_prefix_;
+    const std::chrono::milliseconds persistent_lifetime_;
+    const ClientPtr client_;
+
+    // Must be the last field
+    concurrent::BackgroundTaskStorage write_tasks_;
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+PersistentLruCacheComponent<Key, Value, Hash, Equal>::PersistentLruCacheComponent(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context
+)
+    : Base(config, context),
+      key_prefix_(components::GetCurrentComponentName(config) + ':'),
+      persistent_lifetime_(config["persistent-lifetime"].As<std::chrono::milliseconds>(0)),
+      client_(context.FindComponent<Component>(config["rocks-component"].As<std::string>()).MakeClient()) {}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+PersistentLruCacheComponent<Key, Value, Hash, Equal>::~PersistentLruCacheComponent() {
+    write_tasks_.CancelAndWait();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+yaml_config::Schema PersistentLruCacheComponent<Key, Value, Hash, Equal>::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<Base>(R"(
+type: object
+description: LRU cache component with a persistent tier in RocksDB
+additionalProperties: false
+properties:
+    rocks-component:
+        type: string
+        description: name of the storages::rocks::Component to store the entries in
+    persistent-lifetime:
+        type: string
+        description: TTL for the entries of the persistent tier (0 is unlimited)
+        defaultDescription: 0
+)");
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value PersistentLruCacheComponent<Key, Value, Hash, Equal>::DoGetByKey(const Key& key) {
+    auto storage_key = MakeStorageKey(key);
+    if (auto value = ReadPersistent(storage_key)) return std::move(*value);
+
+    auto value = DoGetByKeyFromOrigin(key);
+    WritePersistent(std::move(storage_key), value);
+    return value;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::string PersistentLruCacheComponent<Key, Value, Hash, Equal>::MakeStorageKey(const Key& key) const {
+    dump::impl::BufferWriter writer;
+    writer.Write(key);
+    return key_prefix_ + std::move(writer).Extract();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::optional<Value> PersistentLruCacheComponent<Key, Value, Hash, Equal>::ReadPersistent(
+    const std::string& storage_key
+) {
+    try {
+        auto data = client_->Get(storage_key);
+        if (data.empty()) return std::nullopt;
+
+        dump::impl::BufferReader reader{std::move(data)};
+        const auto written_at = reader.Read<TimePoint>();
+        if (persistent_lifetime_.count() != 0 && written_at + persistent_lifetime_ < std::chrono::system_clock::now()) {
+            return std::nullopt;
+        }
+        auto value = reader.Read<Value>();
+        reader.Finish();
+        return value;
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to read a cache entry from RocksDB, falling back to the origin: " << ex;
+        return std::nullopt;
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void PersistentLruCacheComponent<Key, Value, Hash, Equal>::WritePersistent(
+    std::string storage_key,
+    const Value& value
+) {
+    dump::impl::BufferWriter writer;
+    writer.Write(std::chrono::time_point_cast<TimePoint::duration>(std::chrono::system_clock::now()));
+    writer.Write(value);
+
+    write_tasks_.AsyncDetach(
+        "rocks_cache_write",
+        [this, storage_key = std::move(storage_key), data = std::move(writer).Extract()] {
+            try {
+                client_->Put(storage_key, data);
+            } catch (const std::exception& ex) {
+                LOG_WARNING() << "Failed to write a cache entry to RocksDB: " << ex;
+            }
+        }
+    );
+}
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
@@ -1,58 +1,286 @@
 #include <userver/storages/rocks/client.hpp>
 
 #include <fmt/format.h>
+#include <rocksdb/cache.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/table.h>
 
 #include <userver/storages/rocks/exception.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+namespace {
+
+void CheckStatusImpl(const rocksdb::Status& status, std::string_view method_name) {
+    if (!status.ok() && !status.IsNotFound()) {
+        throw USERVER_NAMESPACE::storages::rocks::RequestFailedException(method_name, status.ToString());
+    }
+}
+
+rocksdb::ColumnFamilyOptions MakeColumnFamilyOptions(const ClientSettings& settings) {
+    rocksdb::ColumnFamilyOptions options;
+    if (settings.block_cache_size_bytes == 0 && settings.bloom_filter_bits_per_key == 0) return options;
+
+    rocksdb::BlockBasedTableOptions table_options;
+    if (settings.block_cache_size_bytes != 0) {
+        table_options.block_cache = rocksdb::NewLRUCache(settings.block_cache_size_bytes);
+    }
+    if (settings.bloom_filter_bits_per_key != 0) {
+        table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(settings.bloom_filter_bits_per_key));
+    }
+    options.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+    return options;
+}
+
+// The smallest key that is greater than all the keys with the prefix
+std::optional<std::string> GetPrefixUpperBound(std::string_view prefix) {
+    std::string upper_bound{prefix};
+    while (!upper_bound.empty()) {
+        auto& last = reinterpret_cast<unsigned char&>(upper_bound.back());
+        if (last != 0xff) {
+            ++last;
+            return upper_bound;
+        }
+        upper_bound.pop_back();
+    }
+    return std::nullopt;
+}
+
+}  // namespace
+
+void WriteBatch::Put(std::string_view key, std::string_view value) { CheckStatusImpl(batch_.Put(key, value), "Put"); }
+
+void WriteBatch::Put(ColumnFamily column_family, std::string_view key, std::string_view value) {
+    CheckStatusImpl(batch_.Put(column_family.GetNative(), key, value), "Put");
+}
+
+void WriteBatch::Delete(std::string_view key) { CheckStatusImpl(batch_.Delete(key), "Delete"); }
+
+void WriteBatch::Delete(ColumnFamily column_family, std::string_view key) {
+    CheckStatusImpl(batch_.Delete(column_family.GetNative(), key), "Delete");
+}
+
+std::size_t WriteBatch::GetSize() const { return batch_.Count(); }
+
+class Cursor::Impl final {
+public:
+    Impl(
+        rocksdb::DB& db,
+        rocksdb::ColumnFamilyHandle* column_family,
+        std::string begin,
+        std::optional<std::string> end,
+        std::size_t chunk_size,
+        engine::TaskProcessor& blocking_task_processor
+    )
+        : begin_(std::move(begin)),
+          end_(std::move(end)),
+          chunk_size_(chunk_size),
+          blocking_task_processor_(blocking_task_processor) {
+        UINVARIANT(chunk_size_ > 0, "chunk_size should be positive");
+
+        rocksdb::ReadOptions read_options;
+        if (end_) {
+            end_slice_ = *end_;
+            read_options.iterate_upper_bound = &end_slice_;
+        }
+        // The iterator reads the implicit snapshot taken on its creation
+        iterator_.reset(db.NewIterator(read_options, column_family));
+    }
+
+    std::vector<Record> NextChunk() {
+        return engine::AsyncNoSpan(
+                   blocking_task_processor_,
+                   [this] {
+                       if (!is_started_) {
+                           iterator_->Seek(begin_);
+                           is_started_ = true;
+                       }
+
+                       std::vector<Record> chunk;
+                       chunk.reserve(chunk_size_);
+                       for (; iterator_->Valid() && chunk.size() < chunk_size_; iterator_->Next()) {
+                           chunk.emplace_back(iterator_->key().ToString(), iterator_->value().ToString());
+                       }
+                       CheckStatusImpl(iterator_->status(), "Scan");
+                       return chunk;
+                   }
+        ).Get();
+    }
+
+private:
+    const std::string begin_;
+    // should outlive the iterator
+    const std::optional<std::string> end_;
+    rocksdb::Slice end_slice_;
+    std::unique_ptr<rocksdb::Iterator> iterator_;
+    bool is_started_{false};
+    const std::size_t chunk_size_;
+    engine::TaskProcessor& blocking_task_processor_;
+};
+
+Cursor::Cursor(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+Cursor::Cursor(Cursor&&) noexcept = default;
+
+Cursor::~Cursor() = default;
+
+std::vector<Cursor::Record> Cursor::NextChunk() {
+    UINVARIANT(impl_, "Cursor is used after move");
+    return impl_->NextChunk();
+}
+
 Client::Client(const std::string& db_path, engine::TaskProcessor& blocking_task_processor)
+    : Client(db_path, blocking_task_processor, ClientSettings{}) {}
+
+Client::Client(
+    const std::string& db_path,
+    engine::TaskProcessor& blocking_task_processor,
+    const ClientSettings& settings
+)
     : blocking_task_processor_(blocking_task_processor) {
-    rocksdb::Options options;
+    const auto column_family_options = MakeColumnFamilyOptions(settings);
+
+    rocksdb::DBOptions options;
     options.create_if_missing = true;
+    options.create_missing_column_families = true;
+
+    std::vector<rocksdb::ColumnFamilyDescriptor> column_families;
+    column_families.emplace_back(rocksdb::kDefaultColumnFamilyName, column_family_options);
+    for (const auto& name : settings.column_families) {
+        if (name == rocksdb::kDefaultColumnFamilyName) continue;
+        column_families.emplace_back(name, column_family_options);
+    }
 
     rocksdb::DB* db{};
-    rocksdb::Status status = rocksdb::DB::Open(options, db_path, &db);
+    rocksdb::Status status = rocksdb::DB::Open(options, db_path, column_families, &column_family_handles_, &db);
     db_.reset(db);
     CheckStatus(status, "Create client");
+
+    for (auto* handle : column_family_handles_) {
+        column_families_.emplace(handle->GetName(), handle);
+    }
+}
+
+Client::~Client() {
+    if (!db_) return;
+
+    for (auto* handle : column_family_handles_) {
+        db_->DestroyColumnFamilyHandle(handle);
+    }
 }
 
-void Client::Put(std::string_view key, std::string_view value) {
-    engine::AsyncNoSpan(blocking_task_processor_, [this, key, value] {
-        rocksdb::Status status = db_->Put(rocksdb::WriteOptions(), key, value);
+ColumnFamily Client::GetColumnFamily(std::string_view name) const {
+    const auto it = column_families_.find(std::string{name});
+    if (it == column_families_.end()) {
+        throw Exception(fmt::format("Column family '{}' is not listed in the client settings", name));
+    }
+    return ColumnFamily{it->second};
+}
+
+ColumnFamily Client::GetDefaultColumnFamily() const { return ColumnFamily{db_->DefaultColumnFamily()}; }
+
+void Client::Put(std::string_view key, std::string_view value) { Put(GetDefaultColumnFamily(), key, value); }
+
+void Client::Put(ColumnFamily column_family, std::string_view key, std::string_view value) {
+    engine::AsyncNoSpan(blocking_task_processor_, [this, column_family, key, value] {
+        rocksdb::Status status = db_->Put(rocksdb::WriteOptions(), column_family.GetNative(), key, value);
         CheckStatus(status, "Put");
     }).Get();
 }
 
-std::string Client::Get(std::string_view key) {
+std::string Client::Get(std::string_view key) { return Get(GetDefaultColumnFamily(), key); }
+
+std::string Client::Get(ColumnFamily column_family, std::string_view key) {
     return engine::AsyncNoSpan(
                blocking_task_processor_,
-               [this, key] {
+               [this, column_family, key] {
                    std::string res;
-                   rocksdb::Status status = db_->Get(rocksdb::ReadOptions(), key, &res);
+                   rocksdb::Status status = db_->Get(rocksdb::ReadOptions(), column_family.GetNative(), key, &res);
                    CheckStatus(status, "Get");
                    return res;
                }
     ).Get();
 }
 
-void Client::Delete(std::string_view key) {
+std::vector<std::optional<std::string>> Client::MultiGet(const std::vector<std::string_view>& keys) {
+    return MultiGet(GetDefaultColumnFamily(), keys);
+}
+
+std::vector<std::optional<std::string>>
+Client::MultiGet(ColumnFamily column_family, const std::vector<std::string_view>& keys) {
     return engine::AsyncNoSpan(
                blocking_task_processor_,
-               [this, key] {
-                   rocksdb::Status status = db_->Delete(rocksdb::WriteOptions(), key);
+               [this, column_family, &keys] {
+                   const std::vector<rocksdb::ColumnFamilyHandle*> column_families(
+                       keys.size(), column_family.GetNative()
+                   );
+                   const std::vector<rocksdb::Slice> slices(keys.begin(), keys.end());
+                   std::vector<std::string> values;
+                   const auto statuses = db_->MultiGet(rocksdb::ReadOptions(), column_families, slices, &values);
+
+                   std::vector<std::optional<std::string>> res(keys.size());
+                   for (std::size_t i = 0; i < keys.size(); ++i) {
+                       CheckStatus(statuses[i], "MultiGet");
+                       if (statuses[i].ok()) res[i] = std::move(values[i]);
+                   }
+                   return res;
+               }
+    ).Get();
+}
+
+void Client::Delete(std::string_view key) { Delete(GetDefaultColumnFamily(), key); }
+
+void Client::Delete(ColumnFamily column_family, std::string_view key) {
+    return engine::AsyncNoSpan(
+               blocking_task_processor_,
+               [this, column_family, key] {
+                   rocksdb::Status status = db_->Delete(rocksdb::WriteOptions(), column_family.GetNative(), key);
                    CheckStatus(status, "Delete");
                }
     ).Get();
 }
 
+void Client::Write(WriteBatch&& batch) {
+    engine::AsyncNoSpan(blocking_task_processor_, [this, &batch] {
+        rocksdb::Status status = db_->Write(rocksdb::WriteOptions(), &batch.GetNative());
+        CheckStatus(status, "Write");
+    }).Get();
+}
+
+Cursor Client::Scan(std::string_view begin, std::optional<std::string_view> end, std::size_t chunk_size) {
+    return Scan(GetDefaultColumnFamily(), begin, end, chunk_size);
+}
+
+Cursor Client::Scan(
+    ColumnFamily column_family,
+    std::string_view begin,
+    std::optional<std::string_view> end,
+    std::size_t chunk_size
+) {
+    std::optional<std::string> end_key;
+    if (end) end_key.emplace(*end);
+    return Cursor{std::make_unique<Cursor::Impl>(
+        *db_, column_family.GetNative(), std::string{begin}, std::move(end_key), chunk_size, blocking_task_processor_
+    )};
+}
+
+Cursor Client::ScanPrefix(std::string_view prefix, std::size_t chunk_size) {
+    return ScanPrefix(GetDefaultColumnFamily(), prefix, chunk_size);
+}
+
+Cursor Client::ScanPrefix(ColumnFamily column_family, std::string_view prefix, std::size_t chunk_size) {
+    return Cursor{std::make_unique<Cursor::Impl>(
+        *db_, column_family.GetNative(), std::string{prefix}, GetPrefixUpperBound(prefix), chunk_size,
+        blocking_task_processor_
+    )};
+}
+
 void Client::CheckStatus(rocksdb::Status status, std::string_view method_name) {
-    if (!status.ok() && !status.IsNotFound()) {
-        throw USERVER_NAMESPACE::storages::rocks::RequestFailedException(method_name, status.ToString());
-    }
+    CheckStatusImpl(status, method_name);
 }
 }  // namespace storages::rocks
 
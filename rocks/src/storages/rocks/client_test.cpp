@@ -1,4 +1,6 @@
 #include <userver/storages/rocks/client.hpp>
+#include <userver/storages/rocks/exception.hpp>
+#include <userver/utest/assert_macros.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/async.hpp>
 
@@ -24,6 +26,76 @@ UTEST(Rocks, CheckCRUD) {
     EXPECT_EQ("", res);
 }
 
+UTEST(Rocks, WriteBatchAndMultiGet) {
+    storages::rocks::Client client{"/tmp/rocksdb_batch_example", engine::current_task::GetTaskProcessor()};
+
+    storages::rocks::WriteBatch batch;
+    batch.Put("key1", "value1");
+    batch.Put("key2", "value2");
+    batch.Put("key3", "value3");
+    batch.Delete("key3");
+    EXPECT_EQ(4, batch.GetSize());
+    client.Write(std::move(batch));
+
+    const auto values = client.MultiGet({"key1", "key2", "key3"});
+    ASSERT_EQ(3, values.size());
+    EXPECT_EQ("value1", values[0]);
+    EXPECT_EQ("value2", values[1]);
+    EXPECT_EQ(std::nullopt, values[2]);
+}
+
+UTEST(Rocks, ScanPrefix) {
+    storages::rocks::Client client{"/tmp/rocksdb_scan_example", engine::current_task::GetTaskProcessor()};
+
+    storages::rocks::WriteBatch batch;
+    batch.Put("a", "0");
+    for (int i = 0; i < 5; ++i) batch.Put("prefix" + std::to_string(i), std::to_string(i));
+    batch.Put("z", "0");
+    client.Write(std::move(batch));
+
+    auto cursor = client.ScanPrefix("prefix", 2);
+    std::vector<storages::rocks::Cursor::Record> records;
+    std::size_t chunks = 0;
+    for (auto chunk = cursor.NextChunk(); !chunk.empty(); chunk = cursor.NextChunk()) {
+        EXPECT_LE(chunk.size(), 2);
+        records.insert(records.end(), chunk.begin(), chunk.end());
+        ++chunks;
+    }
+    EXPECT_EQ(3, chunks);
+    ASSERT_EQ(5, records.size());
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ("prefix" + std::to_string(i), records[i].first);
+        EXPECT_EQ(std::to_string(i), records[i].second);
+    }
+
+    auto range_cursor = client.Scan("prefix1", "prefix3", 10);
+    EXPECT_EQ(2, range_cursor.NextChunk().size());
+    EXPECT_TRUE(range_cursor.NextChunk().empty());
+}
+
+UTEST(Rocks, ColumnFamilies) {
+    storages::rocks::ClientSettings settings;
+    settings.block_cache_size_bytes = 8 * 1024 * 1024;
+    settings.bloom_filter_bits_per_key = 10;
+    settings.column_families = {"first", "second"};
+    storages::rocks::Client client{
+        "/tmp/rocksdb_column_families_example", engine::current_task::GetTaskProcessor(), settings};
+
+    const auto first = client.GetColumnFamily("first");
+    const auto second = client.GetColumnFamily("second");
+    UEXPECT_THROW(client.GetColumnFamily("third"), storages::rocks::Exception);
+
+    client.Put(first, "key", "first");
+    client.Put(second, "key", "second");
+    EXPECT_EQ("first", client.Get(first, "key"));
+    EXPECT_EQ("second", client.Get(second, "key"));
+    EXPECT_EQ("", client.Get("key"));
+
+    client.Delete(first, "key");
+    EXPECT_EQ((std::vector<std::optional<std::string>>{std::nullopt}), client.MultiGet(first, {"key"}));
+    EXPECT_EQ("second", client.Get(second, "key"));
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
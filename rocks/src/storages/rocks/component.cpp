@@ -1,19 +1,36 @@
 #include <userver/storages/rocks/component.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/storages/rocks/client.hpp>
+#include <userver/formats/parse/common_containers.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+namespace {
+
+ClientSettings ParseClientSettings(const components::ComponentConfig& config) {
+    ClientSettings settings;
+    settings.block_cache_size_bytes = config["block-cache-size"].As<std::size_t>(settings.block_cache_size_bytes);
+    settings.bloom_filter_bits_per_key =
+        config["bloom-filter-bits-per-key"].As<int>(settings.bloom_filter_bits_per_key);
+    settings.column_families = config["column-families"].As<std::vector<std::string>>({});
+    return settings;
+}
+
+}  // namespace
+
 Component::Component(const components::ComponentConfig& config, const components::ComponentContext& context)
     : ComponentBase(config, context),
       client_ptr_(std::make_shared<storages::rocks::Client>(
           config["db-path"].As<std::string>(),
-          context.GetTaskProcessor(config["task-processor"].As<std::string>())
+          context.GetTaskProcessor(config["task-processor"].As<std::string>()),
+          ParseClientSettings(config)
       )) {}
 
 storages::rocks::ClientPtr Component::MakeClient() { return client_ptr_; }
@@ -30,6 +47,23 @@ properties:
     db-path:
         type: string
         description: path to database file
+    block-cache-size:
+        type: integer
+        description: size of the LRU block cache in bytes, RocksDB default if zero
+        defaultDescription: 0
+        minimum: 0
+    bloom-filter-bits-per-key:
+        type: integer
+        description: bits per key of the bloom filter, no filter if zero
+        defaultDescription: 0
+        minimum: 0
+    column-families:
+        type: array
+        description: column families besides the default one, created if missing
+        defaultDescription: '[]'
+        items:
+            type: string
+            description: column family name
 )");
 }
 }  // namespace storages::rocks
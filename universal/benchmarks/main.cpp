@@ -1,3 +1,11 @@
 #include <benchmark/benchmark.h>
 
-BENCHMARK_MAIN();
+#include <utils/gbench_perf_counters.hpp>
+
+int main(int argc, char** argv) {
+    const bool perf_counters_enabled = gbench_perf_counters::ConsumeFlag(argc, argv);
+
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    gbench_perf_counters::RunSpecifiedBenchmarks(perf_counters_enabled);
+}
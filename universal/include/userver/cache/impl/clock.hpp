@@ -0,0 +1,189 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+/// CLOCK approximation of LRU. A hit only sets the 'referenced' bit of the
+/// entry, so Get does not modify the structure and Get calls may run
+/// concurrently with each other. The eviction hand goes around the entries,
+/// clears the bits and evicts the first entry that was not referenced since
+/// the previous pass of the hand.
+template <typename T, typename U, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>>
+class ClockBase final {
+public:
+    explicit ClockBase(std::size_t max_size, const Hash& hash, const Equal& equal);
+
+    ClockBase(ClockBase&&) = default;
+    ClockBase& operator=(ClockBase&&) = default;
+
+    ClockBase(const ClockBase&) = delete;
+    ClockBase& operator=(const ClockBase&) = delete;
+
+    /// @returns true if key is a new one
+    bool Put(const T& key, U value);
+
+    void Erase(const T& key);
+
+    /// Marks the entry as recently used. Safe to call concurrently with
+    /// the other Get calls.
+    const U* Get(const T& key) const;
+
+    void SetMaxSize(std::size_t new_max_size);
+
+    void Clear() noexcept;
+
+    template <typename Function>
+    void VisitAll(Function&& func) const;
+
+    std::size_t GetSize() const noexcept { return slots_.size(); }
+
+private:
+    struct Slot final {
+        Slot(const T& key, U&& value) : key(key), value(std::move(value)) {}
+
+        Slot(Slot&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<U>)
+            : key(std::move(other.key)),
+              value(std::move(other.value)),
+              referenced(other.referenced.load(std::memory_order_relaxed)) {}
+
+        Slot& operator=(Slot&& other) {
+            key = std::move(other.key);
+            value = std::move(other.value);
+            referenced.store(other.referenced.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+
+        T key;
+        U value;
+        mutable std::atomic<bool> referenced{false};
+    };
+
+    std::size_t FindVictim() noexcept;
+    void EraseSlot(std::size_t pos);
+
+    std::unordered_map<T, std::size_t, Hash, Equal> index_;
+    std::vector<Slot> slots_;
+    std::size_t hand_{0};
+    std::size_t max_size_;
+};
+
+template <typename T, typename U, typename Hash, typename Equal>
+ClockBase<T, U, Hash, Equal>::ClockBase(std::size_t max_size, const Hash& hash, const Equal& equal)
+    : index_(0, hash, equal), max_size_(max_size ? max_size : 1) {
+    UASSERT(max_size > 0);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool ClockBase<T, U, Hash, Equal>::Put(const T& key, U value) {
+    if (const auto it = index_.find(key); it != index_.end()) {
+        auto& slot = slots_[it->second];
+        slot.value = std::move(value);
+        slot.referenced.store(true, std::memory_order_relaxed);
+        return false;
+    }
+
+    if (slots_.size() >= max_size_) {
+        // The new entry takes the slot of the evicted one
+        const auto pos = FindVictim();
+        auto& slot = slots_[pos];
+        index_.emplace(key, pos);
+        index_.erase(slot.key);
+        slot.key = key;
+        slot.value = std::move(value);
+        slot.referenced.store(false, std::memory_order_relaxed);
+        return true;
+    }
+
+    slots_.emplace_back(key, std::move(value));
+    try {
+        index_.emplace(key, slots_.size() - 1);
+    } catch (...) {
+        slots_.pop_back();
+        throw;
+    }
+    return true;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::Erase(const T& key) {
+    const auto it = index_.find(key);
+    if (it == index_.end()) return;
+    EraseSlot(it->second);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+const U* ClockBase<T, U, Hash, Equal>::Get(const T& key) const {
+    const auto it = index_.find(key);
+    if (it == index_.end()) return nullptr;
+
+    const auto& slot = slots_[it->second];
+    // Avoids the cache line bouncing between the readers of a hot entry
+    if (!slot.referenced.load(std::memory_order_relaxed)) {
+        slot.referenced.store(true, std::memory_order_relaxed);
+    }
+    return &slot.value;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::SetMaxSize(std::size_t new_max_size) {
+    UASSERT(new_max_size > 0);
+    if (!new_max_size) ++new_max_size;
+
+    max_size_ = new_max_size;
+    while (slots_.size() > max_size_) {
+        EraseSlot(FindVictim());
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::Clear() noexcept {
+    index_.clear();
+    slots_.clear();
+    hand_ = 0;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void ClockBase<T, U, Hash, Equal>::VisitAll(Function&& func) const {
+    for (const auto& slot : slots_) {
+        func(slot.key, slot.value);
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t ClockBase<T, U, Hash, Equal>::FindVictim() noexcept {
+    UASSERT(!slots_.empty());
+    // Terminates on the second pass at the latest, the first one clears the bits
+    while (true) {
+        if (hand_ >= slots_.size()) hand_ = 0;
+        const auto pos = hand_++;
+        auto& referenced = slots_[pos].referenced;
+        if (!referenced.load(std::memory_order_relaxed)) return pos;
+        referenced.store(false, std::memory_order_relaxed);
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::EraseSlot(std::size_t pos) {
+    index_.erase(slots_[pos].key);
+    if (pos + 1 != slots_.size()) {
+        slots_[pos] = std::move(slots_.back());
+        index_.find(slots_[pos].key)->second = pos;
+    }
+    slots_.pop_back();
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
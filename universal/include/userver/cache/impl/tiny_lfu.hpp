@@ -0,0 +1,217 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+
+#include <userver/cache/impl/lru.hpp>
+#include <userver/cache/impl/slru.hpp>
+#include <userver/utils/filter_bloom.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+/// W-TinyLFU: the new entries get into a small window LRU, the entries evicted
+/// from the window compete for a place in the main SLRU part with its
+/// least recently used entry. The entry that was accessed more frequently
+/// wins, the frequencies are estimated by a count-min sketch that is halved
+/// periodically.
+///
+/// Protects the cache from the keys that are accessed once, e.g. by scans,
+/// see https://arxiv.org/abs/1512.00727
+template <typename T, typename U, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>>
+class TinyLfuBase final {
+public:
+    explicit TinyLfuBase(std::size_t max_size, const Hash& hash, const Equal& equal);
+
+    TinyLfuBase(TinyLfuBase&&) = default;
+    TinyLfuBase& operator=(TinyLfuBase&&) = default;
+
+    TinyLfuBase(const TinyLfuBase&) = delete;
+    TinyLfuBase& operator=(const TinyLfuBase&) = delete;
+
+    /// @returns true if key is a new one
+    bool Put(const T& key, U value);
+
+    void Erase(const T& key);
+
+    U* Get(const T& key);
+
+    void SetMaxSize(std::size_t new_max_size);
+
+    void Clear() noexcept;
+
+    template <typename Function>
+    void VisitAll(Function&& func) const;
+
+    std::size_t GetSize() const { return window_.GetSize() + main_.GetSize(); }
+
+private:
+    // The sketch needs two independent hashes, while the keys often have
+    // trivial ones, e.g. the integers
+    template <std::uint64_t Seed>
+    struct MixedHash {
+        std::uint64_t operator()(const T& key) const {
+            // 64-bit finalizer of MurmurHash3
+            std::uint64_t x = static_cast<std::uint64_t>(hash(key)) ^ Seed;
+            x ^= x >> 33;
+            x *= 0xff51afd7ed558ccdULL;
+            x ^= x >> 33;
+            x *= 0xc4ceb9fe1a85ec53ULL;
+            x ^= x >> 33;
+            return x;
+        }
+
+        Hash hash;
+    };
+
+    using SketchHash1 = MixedHash<0>;
+    using SketchHash2 = MixedHash<0x9e3779b97f4a7c15ULL>;
+    using Sketch = utils::FilterBloom<T, std::uint8_t, SketchHash1, SketchHash2>;
+
+    static constexpr std::size_t kSketchCountersPerEntry = 8;
+    // The sketch is halved after that many accesses per entry
+    static constexpr std::size_t kAccessesPerEntryBeforeAging = 10;
+
+    struct Sizes {
+        explicit Sizes(std::size_t max_size);
+
+        std::size_t total;
+        std::size_t window;
+        std::size_t main;
+        std::size_t main_protected;
+    };
+
+    void RecordAccess(const T& key);
+    void EnforceMainSize();
+    void Admit(typename LruBase<T, U, Hash, Equal>::NodeType candidate);
+
+    Hash hash_;
+    Sizes sizes_;
+    LruBase<T, U, Hash, Equal> window_;
+    // The probation part takes the place of the protected part while it is
+    // not full, so it is sized for the whole main part
+    SlruBase<T, U, Hash, Equal> main_;
+    std::optional<Sketch> sketch_;
+    std::size_t accesses_{0};
+};
+
+template <typename T, typename U, typename Hash, typename Equal>
+TinyLfuBase<T, U, Hash, Equal>::Sizes::Sizes(std::size_t max_size) {
+    UASSERT(max_size > 0);
+    if (!max_size) ++max_size;
+
+    total = max_size;
+    window = max_size / 100 ? max_size / 100 : 1;
+    main = max_size - window;
+    main_protected = main * 8 / 10;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+TinyLfuBase<T, U, Hash, Equal>::TinyLfuBase(std::size_t max_size, const Hash& hash, const Equal& equal)
+    : hash_(hash),
+      sizes_(max_size),
+      window_(sizes_.window, hash, equal),
+      main_(sizes_.main ? sizes_.main : 1, sizes_.main_protected ? sizes_.main_protected : 1, hash, equal) {
+    sketch_.emplace(sizes_.total * kSketchCountersPerEntry, SketchHash1{hash}, SketchHash2{hash});
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool TinyLfuBase<T, U, Hash, Equal>::Put(const T& key, U value) {
+    RecordAccess(key);
+    if (auto* existing = window_.Get(key)) {
+        *existing = std::move(value);
+        return false;
+    }
+    if (auto* existing = main_.Get(key)) {
+        *existing = std::move(value);
+        return false;
+    }
+
+    if (window_.GetSize() < sizes_.window) {
+        window_.Put(key, std::move(value));
+        return true;
+    }
+
+    auto candidate = window_.ExtractLeastUsedNode();
+    window_.Put(key, std::move(value));
+    Admit(std::move(candidate));
+    return true;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Erase(const T& key) {
+    window_.Erase(key);
+    main_.Erase(key);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* TinyLfuBase<T, U, Hash, Equal>::Get(const T& key) {
+    RecordAccess(key);
+    if (auto* value = window_.Get(key)) return value;
+    return main_.Get(key);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::SetMaxSize(std::size_t new_max_size) {
+    sizes_ = Sizes{new_max_size};
+    window_.SetMaxSize(sizes_.window);
+    main_.SetMaxSize(sizes_.main ? sizes_.main : 1, sizes_.main_protected ? sizes_.main_protected : 1);
+    EnforceMainSize();
+    sketch_.emplace(sizes_.total * kSketchCountersPerEntry, SketchHash1{hash_}, SketchHash2{hash_});
+    accesses_ = 0;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Clear() noexcept {
+    window_.Clear();
+    main_.Clear();
+    sketch_->Clear();
+    accesses_ = 0;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void TinyLfuBase<T, U, Hash, Equal>::VisitAll(Function&& func) const {
+    window_.VisitAll(func);
+    main_.VisitAll(func);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::RecordAccess(const T& key) {
+    sketch_->Increment(key);
+    // Ages the frequencies, so that the formerly popular keys are evicted
+    if (++accesses_ >= sizes_.total * kAccessesPerEntryBeforeAging) {
+        sketch_->Halve();
+        accesses_ = 0;
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::EnforceMainSize() {
+    while (main_.GetSize() > sizes_.main) {
+        if (!main_.ExtractLeastUsedNode()) break;
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Admit(typename LruBase<T, U, Hash, Equal>::NodeType candidate) {
+    UASSERT(candidate);
+    if (main_.GetSize() < sizes_.main) {
+        main_.InsertNode(std::move(candidate));
+        return;
+    }
+
+    const auto* victim = main_.GetLeastUsedKey();
+    if (!victim || sketch_->Estimate(candidate->GetKey()) <= sketch_->Estimate(*victim)) return;
+
+    main_.ExtractLeastUsedNode();
+    main_.InsertNode(std::move(candidate));
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <userver/compiler/thread_local.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression::impl {
+
+/// Thread-local pool of the (de)compression contexts. The contexts are
+/// expensive to create, so they are reused by the calls from the same worker
+/// thread. Popping and pushing never switch coroutines.
+template <typename Context>
+class ContextPool final {
+public:
+    static std::unique_ptr<Context> Pop() {
+        {
+            auto pool = local_pool.Use();
+            if (!pool->empty()) {
+                auto context = std::move(pool->back());
+                pool->pop_back();
+                return context;
+            }
+        }
+        return std::make_unique<Context>();
+    }
+
+    static void Push(std::unique_ptr<Context> context) noexcept {
+        if (!context) return;
+
+        auto pool = local_pool.Use();
+        // The capacity is reserved, push_back does not throw
+        if (pool->size() < kMaxSize) pool->push_back(std::move(context));
+    }
+
+private:
+    // One context is enough if the contexts are not held across
+    // coroutine switches, streams hold them longer
+    static constexpr std::size_t kMaxSize = 4;
+
+    static inline compiler::ThreadLocal local_pool = [] {
+        std::vector<std::unique_ptr<Context>> pool;
+        pool.reserve(kMaxSize);
+        return pool;
+    };
+};
+
+}  // namespace compression::impl
+
+USERVER_NAMESPACE_END
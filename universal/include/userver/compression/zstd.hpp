@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
@@ -8,10 +10,48 @@ USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
 
+namespace impl {
+class CompressionContext;
+}  // namespace impl
+
+/// Default compression level of the zstd library
+inline constexpr int kDefaultLevel = 3;
+
 /// Decompresses the string.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string. The compression context is reused by the calls from
+/// the same thread.
+std::string Compress(std::string_view data, int level = kDefaultLevel);
+
+/// Compresses the string into a frame with a content checksum. The checksum
+/// is verified by Decompress.
+std::string CompressWithChecksum(std::string_view data, int level = kDefaultLevel);
+
+/// @brief Compresses a stream of chunks into a single zstd frame.
+///
+/// Output of each Compress() call is flushed, so the receiver may decompress
+/// the data received so far without waiting for the rest of the stream.
+class StreamCompressor final {
+public:
+    explicit StreamCompressor(int level = kDefaultLevel);
+
+    StreamCompressor(StreamCompressor&&) noexcept;
+    StreamCompressor& operator=(StreamCompressor&&) noexcept;
+    ~StreamCompressor();
+
+    /// @returns the compressed data of the chunk
+    std::string Compress(std::string_view chunk);
+
+    /// Ends the frame, no more chunks are accepted.
+    /// @returns the rest of the compressed data
+    std::string Finish();
+
+private:
+    std::unique_ptr<impl::CompressionContext> context_;
+};
+
 }  // namespace compression::zstd
 
 USERVER_NAMESPACE_END
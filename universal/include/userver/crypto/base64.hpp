@@ -4,6 +4,8 @@
 /// @brief @copybrief crypto::base64
 /// @ingroup userver_universal
 
+#include <cstddef>
+#include <string>
 #include <string_view>
 
 USERVER_NAMESPACE_BEGIN
@@ -13,26 +15,53 @@ namespace crypto::base64 {
 
 enum class Pad { kWith, kWithout };
 
+/// @brief Returns the length of `size` bytes of data after being encoded
+constexpr std::size_t Base64EncodedLength(std::size_t size, Pad pad = Pad::kWith) noexcept {
+    return pad == Pad::kWith ? (size + 2) / 3 * 4 : size / 3 * 4 + (size % 3 * 4 + 2) / 3;
+}
+
+/// @brief Returns the upper limit on the length of the data decoded from
+/// `size` characters, the exact length if all of them are from the alphabet
+constexpr std::size_t Base64DecodedUpperBound(std::size_t size) noexcept { return size / 4 * 3 + size % 4 * 3 / 4; }
+
 /// @brief Encodes data to Base64, add padding by default
 /// @param pad controls if pad should be added or not
-/// @throws CryptoException internal library exception
 std::string Base64Encode(std::string_view data, Pad pad = Pad::kWith);
 
-/// @brief Decodes data from Base64
-/// @throws CryptoException internal library exception
+/// @brief Encodes data to Base64 into `out`, reusing its allocated memory
+/// @param pad controls if pad should be added or not
+void Base64Encode(std::string_view data, std::string& out, Pad pad = Pad::kWith);
+
+/// @brief Decodes data from Base64.
+///
+/// Characters outside of the alphabet (including padding) are skipped,
+/// trailing bits that do not form a whole byte are discarded.
 std::string Base64Decode(std::string_view data);
 
+/// @brief Decodes data from Base64 into `out`, reusing its allocated memory
+void Base64Decode(std::string_view data, std::string& out);
+
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 
 /// @brief Encodes data to Base64 (using URL alphabet), add padding by default
 /// @param pad controls if pad should be added or not
-/// @throws CryptoException internal library exception
 std::string Base64UrlEncode(std::string_view data, Pad pad = Pad::kWith);
 
+/// @brief Encodes data to Base64 (using URL alphabet) into `out`, reusing its
+/// allocated memory
+/// @param pad controls if pad should be added or not
+void Base64UrlEncode(std::string_view data, std::string& out, Pad pad = Pad::kWith);
+
 /// @brief Decodes data from Base64 (using URL alphabet)
-/// @throws CryptoException internal library exception
+///
+/// Characters outside of the alphabet (including padding) are skipped,
+/// trailing bits that do not form a whole byte are discarded.
 std::string Base64UrlDecode(std::string_view data);
 
+/// @brief Decodes data from Base64 (using URL alphabet) into `out`, reusing its
+/// allocated memory
+void Base64UrlDecode(std::string_view data, std::string& out);
+
 #endif
 
 }  // namespace crypto::base64
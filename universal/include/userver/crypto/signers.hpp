@@ -20,6 +20,10 @@ USERVER_NAMESPACE_BEGIN
 
 namespace crypto {
 
+namespace impl {
+class HmacShaKey;
+}  // namespace impl
+
 /// Base signer class
 class Signer : public NamedAlgo {
 public:
@@ -51,7 +55,7 @@ public:
     std::string Sign(std::initializer_list<std::string_view> data) const override;
 
 private:
-    std::string secret_;
+    std::shared_ptr<const impl::HmacShaKey> key_;
 };
 
 /// @name Outputs HMAC SHA MAC.
@@ -19,6 +19,10 @@ USERVER_NAMESPACE_BEGIN
 
 namespace crypto {
 
+namespace impl {
+class HmacShaKey;
+}  // namespace impl
+
 /// Base verifier class
 class Verifier : public NamedAlgo {
 public:
@@ -50,7 +54,7 @@ public:
     void Verify(std::initializer_list<std::string_view> data, std::string_view raw_signature) const override;
 
 private:
-    std::string secret_;
+    std::shared_ptr<const impl::HmacShaKey> key_;
 };
 
 /// @name Verifies HMAC SHA MAC.
@@ -18,12 +18,17 @@
 // Licence:     BSD
 // ==================================================================
 
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <charconv>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <ios>
 #include <iosfwd>
 #include <istream>
+#include <iterator>
 #include <limits>
 #include <numeric>
 #include <optional>
@@ -127,19 +132,16 @@ constexpr int64_t Div(int64_t nominator, int64_t denominator, bool extra_odd_quo
     return RoundPolicy::DivRounded(nominator, denominator, extra_odd_quotient);
 }
 
-// result = (value1 * value2) / divisor
-template <typename RoundPolicy>
-constexpr int64_t MulDiv(int64_t value1, int64_t value2, int64_t divisor) {
-    if (divisor == 0) throw DivisionByZeroError();
-
 #if __x86_64__ || __ppc64__ || __aarch64__
-    using LongInt = __int128_t;
-    static_assert(sizeof(void*) == 8);
+using LongInt = __int128_t;
+static_assert(sizeof(void*) == 8);
 #else
-    using LongInt = int64_t;
-    static_assert(sizeof(void*) == 4);
+using LongInt = int64_t;
+static_assert(sizeof(void*) == 4);
 #endif
 
+// result = value1 * value2, throws on overflow of LongInt
+constexpr LongInt MulLong(int64_t value1, int64_t value2) {
     LongInt prod{};
     if constexpr (sizeof(void*) == 4) {
         if (__builtin_mul_overflow(static_cast<LongInt>(value1), static_cast<LongInt>(value2), &prod)) {
@@ -148,8 +150,16 @@ constexpr int64_t MulDiv(int64_t value1, int64_t value2, int64_t divisor) {
     } else {
         prod = static_cast<LongInt>(value1) * value2;
     }
-    const auto whole = prod / divisor;
-    const auto rem = static_cast<int64_t>(prod % divisor);
+    return prod;
+}
+
+// result = value / divisor
+template <typename RoundPolicy>
+constexpr int64_t DivLong(LongInt value, int64_t divisor) {
+    if (divisor == 0) throw DivisionByZeroError();
+
+    const auto whole = value / divisor;
+    const auto rem = static_cast<int64_t>(value % divisor);
 
     if (whole <= kMinInt64 || whole >= kMaxInt64) throw OutOfBoundsError();
 
@@ -161,6 +171,12 @@ constexpr int64_t MulDiv(int64_t value1, int64_t value2, int64_t divisor) {
     return whole64 + rem_divided;
 }
 
+// result = (value1 * value2) / divisor
+template <typename RoundPolicy>
+constexpr int64_t MulDiv(int64_t value1, int64_t value2, int64_t divisor) {
+    return DivLong<RoundPolicy>(MulLong(value1, value2), divisor);
+}
+
 constexpr int Sign(int64_t value) { return (value > 0) - (value < 0); }
 
 // Needed because std::abs is not constexpr
@@ -817,6 +833,136 @@ constexpr T decimal_cast(Decimal<OldPrec, OldRound> arg) {
 
 namespace impl {
 
+template <typename Range>
+using RangeValue = std::remove_cv_t<std::remove_pointer_t<decltype(std::data(std::declval<const Range&>()))>>;
+
+#if defined(__AVX2__)
+inline constexpr std::size_t kSumVectorSize = 32;
+#else
+inline constexpr std::size_t kSumVectorSize = 16;
+#endif
+
+// Lowered by the compiler to the SIMD registers of the target, if any
+typedef uint64_t SumVector __attribute__((vector_size(kSumVectorSize)));
+
+inline constexpr std::size_t kSumVectorLanes = kSumVectorSize / sizeof(uint64_t);
+
+// Keeps the sums of the 32-bit halves from overflowing
+inline constexpr std::size_t kMaxSumChunkSize = std::size_t{1} << 30;
+
+template <typename Dec>
+int64_t SumChunk(const Dec* values, std::size_t size) {
+    static_assert(sizeof(Dec) == sizeof(int64_t));
+
+    // Each value is biased to unsigned and split into the 32-bit halves, so
+    // that the sums fit in 64 bits and no overflow checks are done in the loop
+    constexpr uint64_t kBias = uint64_t{1} << 63;
+    constexpr uint64_t kLowMask = 0xffffffff;
+
+    // Two pairs of accumulators hide the latency of additions
+    SumVector high[2]{};
+    SumVector low[2]{};
+    std::size_t i = 0;
+    for (; i + 2 * kSumVectorLanes <= size; i += 2 * kSumVectorLanes) {
+        for (std::size_t j = 0; j < 2; ++j) {
+            SumVector biased;
+            std::memcpy(&biased, values + i + j * kSumVectorLanes, sizeof(biased));
+            biased ^= kBias;
+            high[j] += biased >> 32;
+            low[j] += biased & kLowMask;
+        }
+    }
+
+    uint64_t high_sum = 0;
+    uint64_t low_sum = 0;
+    for (std::size_t lane = 0; lane < kSumVectorLanes; ++lane) {
+        high_sum += high[0][lane] + high[1][lane];
+        low_sum += low[0][lane] + low[1][lane];
+    }
+    for (; i < size; ++i) {
+        const auto biased = static_cast<uint64_t>(values[i].AsUnbiased()) ^ kBias;
+        high_sum += biased >> 32;
+        low_sum += biased & kLowMask;
+    }
+
+    // sum = high_sum * 2^32 + low_sum - size * 2^63
+    const auto high_total =
+        static_cast<int64_t>(high_sum + (low_sum >> 32)) - static_cast<int64_t>(size) * (int64_t{1} << 31);
+    if (high_total < std::numeric_limits<int32_t>::min() || high_total > std::numeric_limits<int32_t>::max()) {
+        throw OutOfBoundsError();
+    }
+    return static_cast<int64_t>((static_cast<uint64_t>(high_total) << 32) | (low_sum & kLowMask));
+}
+
+}  // namespace impl
+
+/// @brief Sums a contiguous range of `Decimal`s of the same type
+///
+/// The sum is computed exactly in SIMD registers without per-element overflow
+/// checks, that is faster than summing with `operator+` for long ranges,
+/// about twice as fast with AVX2 enabled.
+///
+/// Usage example:
+///
+///     std::vector<Money> costs = ...;
+///     const Money total = decimal64::Sum(costs);
+///
+/// @throw decimal64::OutOfBoundsError if the sum does not fit in `Decimal`
+template <typename Range>
+auto Sum(const Range& values) {
+    using Dec = impl::RangeValue<Range>;
+    static_assert(kIsDecimal<Dec>, "decimal64::Sum requires a contiguous range of Decimal");
+
+    const Dec* data = std::data(values);
+    std::size_t size = std::size(values);
+    int64_t result = 0;
+    while (size > 0) {
+        const auto chunk_size = std::min(size, impl::kMaxSumChunkSize);
+        if (__builtin_add_overflow(result, impl::SumChunk(data, chunk_size), &result)) {
+            throw OutOfBoundsError();
+        }
+        data += chunk_size;
+        size -= chunk_size;
+    }
+    return Dec::FromUnbiased(result);
+}
+
+/// @brief Sums the products of the corresponding `Decimal`s of two contiguous
+/// ranges, e.g. prices and quantities
+///
+/// The products are summed exactly and the result is rounded once according
+/// to `RoundPolicy`, so it may differ from summing `lhs[i] * rhs[i]` that
+/// rounds each of the products; it is also faster. The result has the type of
+/// the `lhs` items.
+///
+/// @throw decimal64::OutOfBoundsError if the result does not fit in `Decimal`
+template <typename LhsRange, typename RhsRange>
+constexpr auto SumOfProducts(const LhsRange& lhs, const RhsRange& rhs) {
+    using Dec = impl::RangeValue<LhsRange>;
+    using RhsDec = impl::RangeValue<RhsRange>;
+    static_assert(
+        kIsDecimal<Dec> && kIsDecimal<RhsDec>, "decimal64::SumOfProducts requires contiguous ranges of Decimal"
+    );
+    static_assert(
+        std::is_same_v<typename Dec::RoundPolicy, typename RhsDec::RoundPolicy>,
+        "decimal64::SumOfProducts requires Decimals with the same RoundPolicy"
+    );
+    UINVARIANT(std::size(lhs) == std::size(rhs), "decimal64::SumOfProducts requires ranges of the same size");
+
+    const auto* lhs_data = std::data(lhs);
+    const auto* rhs_data = std::data(rhs);
+    impl::LongInt result = 0;
+    for (std::size_t i = 0; i < std::size(lhs); ++i) {
+        const auto product = impl::MulLong(lhs_data[i].AsUnbiased(), rhs_data[i].AsUnbiased());
+        if (__builtin_add_overflow(result, product, &result)) {
+            throw OutOfBoundsError();
+        }
+    }
+    return Dec::FromUnbiased(impl::DivLong<typename Dec::RoundPolicy>(result, RhsDec::kDecimalFactor));
+}
+
+namespace impl {
+
 // FromUnpacked<Decimal<4>>(12, 34) -> 12.0034
 // FromUnpacked<Decimal<4>>(-12, -34) -> -12.0034
 // FromUnpacked<Decimal<4>>(0, -34) -> -0.0034
@@ -1214,6 +1360,100 @@ void TrimTrailingZeros(int64_t& after, int& after_precision);
 
 std::string ToString(int64_t before, int64_t after, int precision, const FormatOptions& format_options);
 
+// Long enough for a sign, a dot and all the digits of int64_t prepended by "0."
+inline constexpr std::size_t kMaxStringSize = 24;
+
+constexpr std::array<char, 200> MakeDigitPairs() {
+    std::array<char, 200> pairs{};
+    for (int i = 0; i < 100; ++i) {
+        pairs[2 * i] = static_cast<char>('0' + i / 10);
+        pairs[2 * i + 1] = static_cast<char>('0' + i % 10);
+    }
+    return pairs;
+}
+
+inline constexpr auto kDigitPairs = MakeDigitPairs();
+
+// Writes exactly `digits` last digits of `value` backwards, returns the
+// first written char
+inline char* WriteDigitsBackwards(char* end, uint64_t value, int digits) noexcept {
+    for (; digits >= 2; digits -= 2) {
+        end -= 2;
+        std::memcpy(end, &kDigitPairs[2 * (value % 100)], 2);
+        value /= 100;
+    }
+    if (digits == 1) {
+        *--end = static_cast<char>('0' + value % 10);
+    }
+    return end;
+}
+
+// Writes all the digits of `value` backwards, returns the first written char
+inline char* WriteDigitsBackwards(char* end, uint64_t value) noexcept {
+    while (value >= 100) {
+        end -= 2;
+        std::memcpy(end, &kDigitPairs[2 * (value % 100)], 2);
+        value /= 100;
+    }
+    if (value >= 10) {
+        end -= 2;
+        std::memcpy(end, &kDigitPairs[2 * value], 2);
+        return end;
+    }
+    *--end = static_cast<char>('0' + value);
+    return end;
+}
+
+// Writes `ToString(dec)` or `ToStringTrailingZeros(dec)` backwards, returns
+// the first written char. `end` must be preceded by kMaxStringSize chars.
+template <int Prec, typename RoundPolicy>
+char* WriteBackwards(char* end, Decimal<Prec, RoundPolicy> dec, bool trailing_zeros) noexcept {
+    constexpr auto kDecimalFactor = static_cast<uint64_t>(kPow10<Prec>);
+
+    const int64_t unbiased = dec.AsUnbiased();
+    // Unsigned negation is well-defined for kMinInt64
+    const uint64_t abs = unbiased < 0 ? uint64_t{0} - static_cast<uint64_t>(unbiased) : static_cast<uint64_t>(unbiased);
+
+    char* begin = end;
+    if constexpr (Prec > 0) {
+        uint64_t after = abs % kDecimalFactor;
+        if (after != 0 || trailing_zeros) {
+            int after_digits = Prec;
+            while (!trailing_zeros && after % 10 == 0) {
+                after /= 10;
+                --after_digits;
+            }
+            begin = WriteDigitsBackwards(begin, after, after_digits);
+            *--begin = '.';
+        }
+    }
+    begin = WriteDigitsBackwards(begin, abs / kDecimalFactor);
+    if (unbiased < 0) {
+        *--begin = '-';
+    }
+    return begin;
+}
+
+// Formats `ToString(dec)` or `ToStringTrailingZeros(dec)` into a buffer on
+// stack
+template <typename Dec>
+class StringBuffer final {
+public:
+    explicit StringBuffer(Dec dec, bool trailing_zeros = false) noexcept
+        : begin_(WriteBackwards(buffer_ + kMaxStringSize, dec, trailing_zeros)) {}
+
+    StringBuffer(const StringBuffer&) = delete;
+    StringBuffer& operator=(const StringBuffer&) = delete;
+
+    std::string_view GetView() const noexcept {
+        return {begin_, static_cast<std::size_t>(buffer_ + kMaxStringSize - begin_)};
+    }
+
+private:
+    char buffer_[kMaxStringSize];
+    const char* begin_;
+};
+
 }  // namespace impl
 
 template <int Prec, typename RoundPolicy>
@@ -1249,7 +1489,32 @@ constexpr Decimal<Prec, RoundPolicy> Decimal<Prec, RoundPolicy>::FromStringPermi
 /// @see ToStringFixed
 template <int Prec, typename RoundPolicy>
 std::string ToString(Decimal<Prec, RoundPolicy> dec) {
-    return fmt::to_string(dec);
+    return std::string{impl::StringBuffer{dec}.GetView()};
+}
+
+/// @brief Writes the `Decimal` to `[first, last)` as `ToString` does, without
+/// any allocations
+///
+/// Usage example:
+///
+///     char buffer[32];
+///     const auto [ptr, ec] = decimal64::ToChars(buffer, buffer + 32, dec);
+///     if (ec == std::errc{}) {
+///       sw.WriteRawString({buffer, ptr - buffer});
+///     }
+///
+/// @returns `{ptr, std::errc{}}`, where `ptr` points past the written chars,
+/// or `{last, std::errc::value_too_large}` if the output does not fit
+/// @see ToString
+template <int Prec, typename RoundPolicy>
+std::to_chars_result ToChars(char* first, char* last, Decimal<Prec, RoundPolicy> dec) noexcept {
+    const impl::StringBuffer buffer{dec};
+    const auto view = buffer.GetView();
+    if (static_cast<std::size_t>(last - first) < view.size()) {
+        return {last, std::errc::value_too_large};
+    }
+    std::memcpy(first, view.data(), view.size());
+    return {first + view.size(), std::errc{}};
 }
 
 /// @brief Converts Decimal to a string
@@ -1283,7 +1548,7 @@ std::string ToString(const Decimal<Prec, RoundPolicy>& dec, const FormatOptions&
 /// @see ToStringFixed
 template <int Prec, typename RoundPolicy>
 std::string ToStringTrailingZeros(Decimal<Prec, RoundPolicy> dec) {
-    return fmt::format(FMT_COMPILE("{:f}"), dec);
+    return std::string{impl::StringBuffer{dec, true}.GetView()};
 }
 
 /// @brief Converts Decimal to a string with exactly `NewPrec` decimal digits
@@ -1334,7 +1599,7 @@ std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>&
 template <typename CharT, typename Traits, int Prec, typename RoundPolicy>
 std::basic_ostream<CharT, Traits>&
 operator<<(std::basic_ostream<CharT, Traits>& os, const Decimal<Prec, RoundPolicy>& d) {
-    os << ToString(d);
+    os << impl::StringBuffer{d}.GetView();
     return os;
 }
 
@@ -1342,7 +1607,7 @@ operator<<(std::basic_ostream<CharT, Traits>& os, const Decimal<Prec, RoundPolic
 /// @see ToString
 template <int Prec, typename RoundPolicy>
 logging::LogHelper& operator<<(logging::LogHelper& lh, const Decimal<Prec, RoundPolicy>& d) {
-    lh << ToString(d);
+    lh << impl::StringBuffer{d}.GetView();
     return lh;
 }
 
@@ -1373,7 +1638,7 @@ TargetType Serialize(const Decimal<Prec, RoundPolicy>& object, formats::serializ
 /// @see ToString
 template <int Prec, typename RoundPolicy, typename StringBuilder>
 void WriteToStream(const Decimal<Prec, RoundPolicy>& object, StringBuilder& sw) {
-    WriteToStream(ToString(object), sw);
+    WriteToStream(impl::StringBuffer{object}.GetView(), sw);
 }
 
 /// gtest formatter for decimal64::Decimal
@@ -1433,12 +1698,15 @@ public:
 
     template <typename FormatContext>
     auto format(const USERVER_NAMESPACE::decimal64::Decimal<Prec, RoundPolicy>& dec, FormatContext& ctx) const {
-        int after_digits = custom_precision_.value_or(Prec);
-        auto [before, after] = USERVER_NAMESPACE::decimal64::impl::AsUnpacked(dec, after_digits);
-        if (remove_trailing_zeros_) {
-            USERVER_NAMESPACE::decimal64::impl::TrimTrailingZeros(after, after_digits);
+        if (!custom_precision_) {
+            const USERVER_NAMESPACE::decimal64::impl::StringBuffer buffer{dec, !remove_trailing_zeros_};
+            const auto view = buffer.GetView();
+            return std::copy(view.begin(), view.end(), ctx.out());
         }
 
+        const int after_digits = *custom_precision_;
+        auto [before, after] = USERVER_NAMESPACE::decimal64::impl::AsUnpacked(dec, after_digits);
+
         if (after_digits > 0) {
             if (dec.Sign() == -1) {
                 return fmt::format_to(ctx.out(), FMT_COMPILE("-{}.{:0{}}"), -before, -after, after_digits);
@@ -0,0 +1,345 @@
+#pragma once
+
+/// @file userver/formats/json/lazy_value.hpp
+/// @brief @copybrief formats::json::LazyValue
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/formats/common/items.hpp>
+#include <userver/formats/common/meta.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace impl {
+
+struct LazyDocument;
+
+struct LazyLocation {
+    // Offset of the first char of the value
+    std::uint32_t begin;
+    // Index of the first structural char at or after `begin`
+    std::uint32_t structural;
+};
+
+}  // namespace impl
+
+class LazyValueIterator;
+
+/// @ingroup userver_universal userver_containers userver_formats
+///
+/// @brief Non-mutable JSON value that is parsed on demand.
+///
+/// formats::json::FromStringLazy() makes a single pass over the document that
+/// checks its structure and remembers the positions of brackets, colons,
+/// commas and strings. Member lookup and iteration walk over those positions
+/// skipping the nested objects and arrays at once, and only the values that are
+/// converted with `As<T>()` are actually parsed. That makes reading a few
+/// members of a big document several times cheaper than
+/// formats::json::FromString().
+///
+/// The interface mirrors formats::json::Value, so the `Parse` functions
+/// templated on the `Value` type (including the ones for the standard
+/// containers) work with LazyValue as is. Types that only have
+/// `Parse(const formats::json::Value&, formats::parse::To<T>)` are parsed
+/// from the formats::json::Value of the accessed subtree, with the paths in
+/// errors being the same as for the whole document.
+///
+/// Untouched parts of the document are not validated beyond their structure:
+/// malformed numbers, invalid escapes and duplicate keys are only reported
+/// if the containing value is accessed. For duplicate keys the first member
+/// is used.
+///
+/// The value shares the ownership of a copy of the document, so it may
+/// outlive the source string.
+///
+/// ## Example usage:
+///
+/// @snippet formats/json/lazy_value_test.cpp  Sample formats::json::LazyValue usage
+///
+/// @see @ref scripts/docs/en/userver/formats.md
+class LazyValue final {
+public:
+    struct DefaultConstructed {};
+
+    using const_iterator = LazyValueIterator;
+    using Exception = formats::json::Exception;
+    using ParseException = formats::json::ParseException;
+    using ExceptionWithPath = formats::json::ExceptionWithPath;
+
+    /// @brief Constructs a Value that holds a null.
+    LazyValue();
+
+    LazyValue(const LazyValue&) = default;
+    LazyValue(LazyValue&&) noexcept = default;
+    LazyValue& operator=(const LazyValue&) & = default;
+    LazyValue& operator=(LazyValue&&) & noexcept = default;
+
+    ~LazyValue();
+
+    /// @brief Access member by key for read.
+    /// @throw TypeMismatchException if not a missing value, an object or null.
+    /// @returns a missing value if there is no such member, the first one is
+    /// returned for the duplicate keys.
+    LazyValue operator[](std::string_view key) const;
+
+    /// @brief Access array member by index for read.
+    /// @throw TypeMismatchException if not an array value.
+    /// @throw OutOfBoundsException if index is greater or equal than size.
+    LazyValue operator[](std::size_t index) const;
+
+    /// @brief Returns an iterator to the beginning of the held array or map.
+    /// @throw TypeMismatchException if not an array, object, or null.
+    const_iterator begin() const;
+
+    /// @brief Returns an iterator to the end of the held array or map.
+    /// @throw TypeMismatchException if not an array, object, or null.
+    const_iterator end() const;
+
+    /// @brief Returns whether the array or object is empty, null is empty too.
+    /// @throw TypeMismatchException if not an array, object, or null.
+    bool IsEmpty() const;
+
+    /// @brief Returns array size or object members count, takes a walk over
+    /// the members.
+    /// @throw TypeMismatchException if not an array, object, or null.
+    std::size_t GetSize() const;
+
+    /// @brief Returns true if *this holds nothing. When `IsMissing()` returns
+    /// `true` any attempt to get the actual value or iterate over *this will
+    /// throw MemberMissingException.
+    bool IsMissing() const noexcept;
+
+    /// @brief Returns true if *this holds a null.
+    bool IsNull() const noexcept;
+
+    /// @brief Returns true if *this is convertible to `bool`.
+    bool IsBool() const noexcept;
+
+    /// @brief Returns true if *this is convertible to `int`.
+    bool IsInt() const noexcept;
+
+    /// @brief Returns true if *this is convertible to `std::int64_t`.
+    bool IsInt64() const noexcept;
+
+    /// @brief Returns true if *this is convertible to `std::uint64_t`.
+    bool IsUInt64() const noexcept;
+
+    /// @brief Returns true if *this holds a number.
+    bool IsDouble() const noexcept;
+
+    /// @brief Returns true if *this is convertible to `std::string`.
+    bool IsString() const noexcept;
+
+    /// @brief Returns true if *this is an array.
+    bool IsArray() const noexcept;
+
+    /// @brief Returns true if *this holds a map.
+    bool IsObject() const noexcept;
+
+    /// @brief Returns value of *this converted to the result type of
+    /// Parse(const LazyValue&, parse::To<T>) or, if there is none, of
+    /// Parse(const formats::json::Value&, parse::To<T>).
+    /// @throw Anything derived from std::exception.
+    template <typename T>
+    auto As() const;
+
+    /// @brief Returns value of *this converted to T or T(args) if
+    /// this->IsMissing() or this->IsNull().
+    /// @throw Anything derived from std::exception.
+    template <typename T, typename First, typename... Rest>
+    auto As(First&& default_arg, Rest&&... more_default_args) const;
+
+    /// @brief Returns value of *this converted to T or T() if
+    /// this->IsMissing() or this->IsNull().
+    /// @throw Anything derived from std::exception.
+    template <typename T>
+    auto As(DefaultConstructed) const;
+
+    /// @brief Returns true if *this holds a `key`.
+    /// @throw TypeMismatchException if `*this` is not a map or null.
+    bool HasMember(std::string_view key) const;
+
+    /// @brief Returns full path to this value. The path is found by walking
+    /// the document from the root, so it is only intended for diagnostics.
+    std::string GetPath() const;
+
+    /// @brief Returns the JSON text of the value, a view into the document.
+    /// @throw MemberMissingException if `this->IsMissing()`.
+    std::string_view GetRawJson() const;
+
+    /// @throw MemberMissingException if `this->IsMissing()`.
+    void CheckNotMissing() const;
+
+    /// @throw TypeMismatchException if `*this` is not an array or null.
+    void CheckArrayOrNull() const;
+
+    /// @throw TypeMismatchException if `*this` is not a map or null.
+    void CheckObjectOrNull() const;
+
+    /// @throw TypeMismatchException if `*this` is not a map.
+    void CheckObject() const;
+
+    /// @throw TypeMismatchException if `*this` is not a map, array or null.
+    void CheckObjectOrArrayOrNull() const;
+
+    /// @throw OutOfBoundsException if `index >= this->GetSize()`.
+    void CheckInBounds(std::size_t index) const;
+
+    /// @brief Returns true if *this is the root of the document.
+    bool IsRoot() const noexcept;
+
+private:
+    LazyValue(std::shared_ptr<const impl::LazyDocument> document, impl::LazyLocation location) noexcept;
+    LazyValue(const LazyValue& parent, std::string_view missing_key);
+
+    int GetExtendedType() const noexcept;
+    [[noreturn]] void ThrowTypeMismatch(int expected) const;
+
+    // Parses the JSON text of the value alone, paths in the errors are
+    // relative to the value
+    formats::json::Value ParseDetached() const;
+    bool IsDetached(bool (formats::json::Value::*predicate)() const noexcept) const noexcept;
+
+    template <typename T>
+    auto ParseAsJson() const;
+
+    std::shared_ptr<const impl::LazyDocument> document_;
+    impl::LazyLocation location_{};
+    // For the missing values: the closest existing ancestor is at
+    // `location_`, the keys lead from it to the value
+    std::vector<std::string> missing_keys_;
+
+    friend class LazyValueIterator;
+
+    friend bool Parse(const LazyValue& value, parse::To<bool>);
+    friend std::int64_t Parse(const LazyValue& value, parse::To<std::int64_t>);
+    friend std::uint64_t Parse(const LazyValue& value, parse::To<std::uint64_t>);
+    friend std::string Parse(const LazyValue& value, parse::To<std::string>);
+    friend formats::json::Value Parse(const LazyValue& value, parse::To<formats::json::Value>);
+
+    friend LazyValue FromStringLazy(std::string_view doc);
+};
+
+/// @brief Forward iterator over the formats::json::LazyValue array items or
+/// object members.
+///
+/// Each increment skips over the current item.
+class LazyValueIterator final {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = LazyValue;
+    using reference = const LazyValue&;
+    using pointer = const LazyValue*;
+
+    reference operator*() const noexcept { return current_; }
+    pointer operator->() const noexcept { return &current_; }
+
+    LazyValueIterator& operator++();
+    LazyValueIterator operator++(int);
+
+    bool operator==(const LazyValueIterator& other) const noexcept {
+        return current_.location_.begin == other.current_.location_.begin;
+    }
+    bool operator!=(const LazyValueIterator& other) const noexcept { return !(*this == other); }
+
+    /// @brief Returns name of the referenced object member.
+    /// @throw TypeMismatchException if the container is not an object.
+    std::string GetName() const;
+
+    /// @brief Returns index of the referenced array item.
+    /// @throw TypeMismatchException if the container is not an array.
+    std::size_t GetIndex() const;
+
+private:
+    friend class LazyValue;
+
+    LazyValueIterator(const LazyValue& container, LazyValue current);
+
+    // The iterated array or object
+    LazyValue container_;
+    LazyValue current_;
+    std::size_t index_{0};
+};
+
+/// @brief Indexes the JSON document for the on-demand parsing with
+/// formats::json::LazyValue, the document is copied.
+/// @throw formats::json::ParseException if the structure of the document is
+/// broken.
+LazyValue FromStringLazy(std::string_view doc);
+
+template <typename T>
+auto LazyValue::As() const {
+    if constexpr (formats::common::impl::kHasParse<LazyValue, T>) {
+        return Parse(*this, formats::parse::To<T>{});
+    } else {
+        static_assert(
+            formats::common::impl::kHasParse<formats::json::Value, T>,
+            "There is no `Parse(const Value&, formats::parse::To<T>)` "
+            "in namespace of `T` or `formats::parse`. "
+            "Probably you forgot to include the "
+            "<userver/formats/parse/common_containers.hpp> or you "
+            "have not provided a `Parse` function overload."
+        );
+        return ParseAsJson<T>();
+    }
+}
+
+template <typename T, typename First, typename... Rest>
+auto LazyValue::As(First&& default_arg, Rest&&... more_default_args) const {
+    if (IsMissing() || IsNull()) {
+        // intended raw ctor call, sometimes casts
+        // NOLINTNEXTLINE(google-readability-casting)
+        return decltype(As<T>())(std::forward<First>(default_arg), std::forward<Rest>(more_default_args)...);
+    }
+    return As<T>();
+}
+
+template <typename T>
+auto LazyValue::As(LazyValue::DefaultConstructed) const {
+    return (IsMissing() || IsNull()) ? decltype(As<T>())() : As<T>();
+}
+
+template <typename T>
+auto LazyValue::ParseAsJson() const {
+    if (!IsMissing()) {
+        // Parsing the subtree alone is cheaper than restoring its path within
+        // the document, which is only needed to report an error
+        try {
+            return ParseDetached().template As<T>();
+        } catch (const ExceptionWithPath&) {
+        }
+    }
+    return Parse(*this, formats::parse::To<formats::json::Value>{}).template As<T>();
+}
+
+bool Parse(const LazyValue& value, parse::To<bool>);
+
+std::int64_t Parse(const LazyValue& value, parse::To<std::int64_t>);
+
+std::uint64_t Parse(const LazyValue& value, parse::To<std::uint64_t>);
+
+std::string Parse(const LazyValue& value, parse::To<std::string>);
+
+inline LazyValue Parse(const LazyValue& value, parse::To<LazyValue>) { return value; }
+
+/// Parses the value into formats::json::Value, the paths of the result are the
+/// same as of `value`
+formats::json::Value Parse(const LazyValue& value, parse::To<formats::json::Value>);
+
+using formats::common::Items;
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -24,6 +26,12 @@ public:
 
     void ProcessInput(std::string_view sw);
 
+    /// @brief Parses the input that is provided in chunks, so that the whole
+    /// input is never kept in memory. `read_chunk` is called each time more data
+    /// is needed, it should replace the contents of `chunk` with the next piece
+    /// of the input and return false once there is no more input.
+    void ProcessChunkedInput(utils::function_ref<bool(std::string& chunk)> read_chunk);
+
     void PopMe(BaseParser& parser);
 
     [[noreturn]] void ThrowError(const std::string& err_msg);
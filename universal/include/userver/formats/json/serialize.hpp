@@ -24,9 +24,37 @@ namespace formats::json {
 
 constexpr inline std::size_t kDepthParseLimit = 128;
 
+/// Parser implementations of formats::json::FromString, all of them produce
+/// the same formats::json::Value
+enum class ParserBackend {
+    /// simdjson if userver is built with `USERVER_FEATURE_SIMDJSON`, rapidjson
+    /// otherwise
+    kDefault,
+    kRapidjson,
+    /// Several times faster on big documents; rapidjson is used if userver is
+    /// built without `USERVER_FEATURE_SIMDJSON`
+    kSimdjson,
+};
+
 /// Parse JSON from string
 formats::json::Value FromString(std::string_view doc);
 
+/// Parse JSON from string with the specified parser
+formats::json::Value FromStringWithBackend(std::string_view doc, ParserBackend backend);
+
+/// @brief Parse JSON from string into a document that is allocated in a
+/// single arena.
+///
+/// The nodes, the strings and the members of the objects are packed in the
+/// parse order and the whole document is released at once, so destruction
+/// of big documents (e.g. cache snapshots) takes O(1). Short keys are stored
+/// inline in the members, lookups on medium objects are a linear scan over
+/// contiguous memory.
+///
+/// The document is immutable: formats::json::ValueBuilder and the other
+/// consumers copy it instead of taking over its nodes.
+formats::json::Value FromStringToArena(std::string_view doc);
+
 /// Parse JSON from stream
 formats::json::Value FromStream(std::istream& is);
 
@@ -39,6 +39,7 @@ impl::Value MakeJsonStringViewValue(std::string_view view);
 class ValueBuilder;
 struct PrettyFormat;
 class Schema;
+enum class ParserBackend;
 
 namespace parser {
 class JsonValueParser;
@@ -333,6 +334,8 @@ private:
     friend std::string Parse(const Value& value, parse::To<std::string>);
 
     friend formats::json::Value FromString(std::string_view);
+    friend formats::json::Value FromStringWithBackend(std::string_view, ParserBackend);
+    friend formats::json::Value FromStringToArena(std::string_view);
     friend formats::json::Value FromStream(std::istream&);
     friend void Serialize(const formats::json::Value&, std::ostream&);
     friend std::string ToString(const formats::json::Value&);
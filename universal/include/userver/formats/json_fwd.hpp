@@ -13,6 +13,8 @@ namespace formats::json {
 
 class StringBuilder;
 
+class LazyValue;
+
 // NOLINTNEXTLINE(bugprone-forward-declaration-namespace)
 class Value;
 
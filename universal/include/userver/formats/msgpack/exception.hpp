@@ -0,0 +1,61 @@
+#pragma once
+
+/// @file userver/formats/msgpack/exception.hpp
+/// @brief Exception classes for the MessagePack module
+/// @ingroup userver_universal
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack {
+
+class Exception : public std::exception {
+public:
+    explicit Exception(std::string msg) : msg_(std::move(msg)) {}
+
+    const char* what() const noexcept final { return msg_.c_str(); }
+
+    std::string_view GetMessage() const noexcept { return msg_; }
+
+private:
+    std::string msg_;
+};
+
+/// Thrown on malformed or truncated MessagePack data and by the value parsers
+class ParseException : public Exception {
+public:
+    using Exception::Exception;
+};
+
+class ExceptionWithPath : public Exception {
+public:
+    explicit ExceptionWithPath(std::string_view msg, std::string_view path);
+
+    std::string_view GetPath() const noexcept;
+    std::string_view GetMessageWithoutPath() const noexcept;
+
+private:
+    std::size_t path_size_;
+};
+
+class TypeMismatchException : public ExceptionWithPath {
+public:
+    TypeMismatchException(std::string_view actual, std::string_view expected, std::string_view path);
+};
+
+class OutOfBoundsException : public ExceptionWithPath {
+public:
+    OutOfBoundsException(std::size_t index, std::size_t size, std::string_view path);
+};
+
+class MemberMissingException : public ExceptionWithPath {
+public:
+    explicit MemberMissingException(std::string_view path);
+};
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
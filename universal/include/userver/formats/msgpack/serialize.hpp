@@ -0,0 +1,31 @@
+#pragma once
+
+/// @file userver/formats/msgpack/serialize.hpp
+/// @brief Parsing and serialization of the MessagePack binary strings
+/// @ingroup userver_universal
+
+#include <string>
+#include <string_view>
+
+#include <userver/formats/json_fwd.hpp>
+#include <userver/formats/msgpack/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack {
+
+/// @brief Returns a view of the MessagePack encoded value, nothing is parsed
+/// or copied until accessed.
+///
+/// `binary` must outlive the returned value and all the values obtained from
+/// it. Only the first byte is checked, trailing data after the value is
+/// ignored.
+/// @throw ParseException if `binary` is empty
+Value FromBinaryString(std::string_view binary);
+
+/// Encodes the JSON value as MessagePack
+std::string ToBinaryString(const formats::json::Value& value);
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
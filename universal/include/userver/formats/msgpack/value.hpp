@@ -0,0 +1,311 @@
+#pragma once
+
+/// @file userver/formats/msgpack/value.hpp
+/// @brief @copybrief formats::msgpack::Value
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include <userver/formats/common/items.hpp>
+#include <userver/formats/common/meta.hpp>
+#include <userver/formats/json_fwd.hpp>
+#include <userver/formats/msgpack/exception.hpp>
+#include <userver/formats/parse/common.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack {
+
+namespace impl {
+struct Element;
+}  // namespace impl
+
+class Iterator;
+
+/// @ingroup userver_universal userver_containers userver_formats
+///
+/// @brief Non-mutable view of a MessagePack encoded value.
+///
+/// The value references the encoded buffer and decodes it lazily: member
+/// lookup and iteration walk over the encoded data without building a tree,
+/// strings are not copied unless parsed into std::string. The buffer must
+/// outlive the value and all the values obtained from it.
+///
+/// The interface mirrors formats::json::Value, so the `Parse` functions
+/// templated on the `Value` type (including the ones for the standard
+/// containers) work with MessagePack as is.
+///
+/// Malformed or truncated data is reported with formats::msgpack::ParseException
+/// when the corresponding part of the buffer is accessed.
+///
+/// ## Example usage:
+///
+/// @snippet formats/msgpack/value_test.cpp  Sample formats::msgpack::Value usage
+///
+/// @see @ref scripts/docs/en/userver/formats.md
+class Value final {
+public:
+    struct DefaultConstructed {};
+
+    using const_iterator = Iterator;
+    using Exception = formats::msgpack::Exception;
+    using ParseException = formats::msgpack::ParseException;
+    using ExceptionWithPath = formats::msgpack::ExceptionWithPath;
+
+    /// @brief Constructs a Value that holds a null.
+    Value() noexcept;
+
+    Value(const Value&) = default;
+    Value(Value&&) noexcept = default;
+    Value& operator=(const Value&) & = default;
+    Value& operator=(Value&&) & noexcept = default;
+
+    /// @brief Access member by key for read.
+    /// @throw TypeMismatchException if not a missing value, an object or null.
+    /// @returns a missing value if there is no such member, the first one is
+    /// returned for the duplicate keys.
+    Value operator[](std::string_view key) const;
+
+    /// @brief Access array member by index for read.
+    /// @throw TypeMismatchException if not an array value.
+    /// @throw OutOfBoundsException if index is greater or equal than size.
+    Value operator[](std::size_t index) const;
+
+    /// @brief Returns an iterator to the beginning of the held array or map.
+    /// @throw TypeMismatchException if not an array, object, or null.
+    const_iterator begin() const;
+
+    /// @brief Returns an iterator to the end of the held array or map.
+    /// @throw TypeMismatchException if not an array, object, or null.
+    const_iterator end() const;
+
+    /// @brief Returns whether the array or object is empty, null is empty too.
+    /// @throw TypeMismatchException if not an array, object, or null.
+    bool IsEmpty() const;
+
+    /// @brief Returns array size or object members count.
+    /// @throw TypeMismatchException if not an array, object, or null.
+    std::size_t GetSize() const;
+
+    /// @brief Returns true if *this holds nothing. When `IsMissing()` returns
+    /// `true` any attempt to get the actual value or iterate over *this will
+    /// throw MemberMissingException.
+    bool IsMissing() const noexcept;
+
+    /// @brief Returns true if *this holds a null (Nil).
+    bool IsNull() const noexcept;
+
+    /// @brief Returns true if *this is convertible to `bool`.
+    bool IsBool() const noexcept;
+
+    /// @brief Returns true if *this is convertible to `int`.
+    bool IsInt() const noexcept;
+
+    /// @brief Returns true if *this is convertible to `std::int64_t`.
+    bool IsInt64() const noexcept;
+
+    /// @brief Returns true if *this is convertible to `std::uint64_t`.
+    bool IsUInt64() const noexcept;
+
+    /// @brief Returns true if *this holds a number and is convertible to
+    /// `double`.
+    bool IsDouble() const noexcept;
+
+    /// @brief Returns true if *this is convertible to `std::string`, both str
+    /// and bin MessagePack types are strings.
+    bool IsString() const noexcept;
+
+    /// @brief Returns true if *this is an array.
+    bool IsArray() const noexcept;
+
+    /// @brief Returns true if *this holds a map.
+    bool IsObject() const noexcept;
+
+    /// @brief Returns value of *this converted to the result type of
+    /// Parse(const Value&, parse::To<T>). Almost always it is T.
+    /// @throw Anything derived from std::exception.
+    template <typename T>
+    auto As() const;
+
+    /// @brief Returns value of *this converted to T or T(args) if
+    /// this->IsMissing() or this->IsNull().
+    /// @throw Anything derived from std::exception.
+    template <typename T, typename First, typename... Rest>
+    auto As(First&& default_arg, Rest&&... more_default_args) const;
+
+    /// @brief Returns value of *this converted to T or T() if
+    /// this->IsMissing() or this->IsNull().
+    /// @throw Anything derived from std::exception.
+    template <typename T>
+    auto As(DefaultConstructed) const;
+
+    /// @brief Returns true if *this holds a `key`.
+    /// @throw TypeMismatchException if `*this` is not a map or null.
+    bool HasMember(std::string_view key) const;
+
+    /// @brief Returns full path to this value. The path is found by walking
+    /// the buffer from the root, so it is only intended for diagnostics.
+    std::string GetPath() const;
+
+    /// @brief Returns the encoded bytes of the value, a view into the buffer.
+    /// @throw MemberMissingException if `this->IsMissing()`.
+    std::string_view GetBinaryView() const;
+
+    /// @throw MemberMissingException if `this->IsMissing()`.
+    void CheckNotMissing() const;
+
+    /// @throw TypeMismatchException if `*this` is not an array or null.
+    void CheckArrayOrNull() const;
+
+    /// @throw TypeMismatchException if `*this` is not a map or null.
+    void CheckObjectOrNull() const;
+
+    /// @throw TypeMismatchException if `*this` is not a map.
+    void CheckObject() const;
+
+    /// @throw TypeMismatchException if `*this` is not a map, array or null.
+    void CheckObjectOrArrayOrNull() const;
+
+    /// @throw OutOfBoundsException if `index >= this->GetSize()`.
+    void CheckInBounds(std::size_t index) const;
+
+    /// @brief Returns true if *this is the root of the buffer.
+    bool IsRoot() const noexcept;
+
+private:
+    Value(const char* root, const char* end, const char* pos) noexcept;
+    Value(const Value& parent, std::string_view missing_key);
+
+    impl::Element GetElement() const;
+    std::string_view GetTypeName() const noexcept;
+    [[noreturn]] void ThrowTypeMismatch(std::string_view expected) const;
+    std::size_t GetContainerSize() const;
+
+    // The whole buffer, `root_` is the first byte of the root value
+    const char* root_{nullptr};
+    const char* end_{nullptr};
+    // The first byte of the value, nullptr for the missing values
+    const char* pos_{nullptr};
+
+    // For the missing values: the closest existing ancestor and the path of
+    // the missing value relative to it
+    const char* missing_parent_{nullptr};
+    std::string missing_path_;
+
+    friend class Iterator;
+
+    friend bool Parse(const Value& value, parse::To<bool>);
+    friend std::int64_t Parse(const Value& value, parse::To<std::int64_t>);
+    friend std::uint64_t Parse(const Value& value, parse::To<std::uint64_t>);
+    friend double Parse(const Value& value, parse::To<double>);
+    friend std::string Parse(const Value& value, parse::To<std::string>);
+    friend std::string_view Parse(const Value& value, parse::To<std::string_view>);
+    friend formats::json::Value Parse(const Value& value, parse::To<formats::json::Value>);
+
+    friend Value FromBinaryString(std::string_view binary);
+};
+
+/// @brief Forward iterator over the formats::msgpack::Value array items or
+/// map values.
+///
+/// Each increment skips over the encoded current item.
+class Iterator final {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Value;
+    using reference = const Value&;
+    using pointer = const Value*;
+
+    reference operator*() const noexcept { return current_; }
+    pointer operator->() const noexcept { return &current_; }
+
+    Iterator& operator++();
+    Iterator operator++(int);
+
+    bool operator==(const Iterator& other) const noexcept { return index_ == other.index_; }
+    bool operator!=(const Iterator& other) const noexcept { return index_ != other.index_; }
+
+    /// @brief Returns name of the referenced map member.
+    /// @throw TypeMismatchException if the container is not a map or the key
+    /// is not a string.
+    std::string GetName() const;
+
+    /// @brief Returns index of the referenced array item.
+    /// @throw TypeMismatchException if the container is not an array.
+    std::size_t GetIndex() const;
+
+private:
+    friend class Value;
+
+    Iterator(const Value& container, const char* first, std::size_t size, bool is_object);
+    Iterator(const Value& container, std::size_t size);
+
+    void Load(const char* pos);
+
+    // The first byte of the iterated array or map
+    const char* container_{nullptr};
+    Value current_;
+    // The key of the current member for maps
+    const char* key_{nullptr};
+    std::size_t index_{0};
+    std::size_t size_{0};
+    bool is_object_{false};
+};
+
+template <typename T>
+auto Value::As() const {
+    static_assert(
+        formats::common::impl::kHasParse<Value, T>,
+        "There is no `Parse(const Value&, formats::parse::To<T>)` "
+        "in namespace of `T` or `formats::parse`. "
+        "Probably you forgot to include the "
+        "<userver/formats/parse/common_containers.hpp> or you "
+        "have not provided a `Parse` function overload."
+    );
+
+    return Parse(*this, formats::parse::To<T>{});
+}
+
+template <typename T, typename First, typename... Rest>
+auto Value::As(First&& default_arg, Rest&&... more_default_args) const {
+    if (IsMissing() || IsNull()) {
+        // intended raw ctor call, sometimes casts
+        // NOLINTNEXTLINE(google-readability-casting)
+        return decltype(As<T>())(std::forward<First>(default_arg), std::forward<Rest>(more_default_args)...);
+    }
+    return As<T>();
+}
+
+template <typename T>
+auto Value::As(Value::DefaultConstructed) const {
+    return (IsMissing() || IsNull()) ? decltype(As<T>())() : As<T>();
+}
+
+bool Parse(const Value& value, parse::To<bool>);
+
+std::int64_t Parse(const Value& value, parse::To<std::int64_t>);
+
+std::uint64_t Parse(const Value& value, parse::To<std::uint64_t>);
+
+double Parse(const Value& value, parse::To<double>);
+
+std::string Parse(const Value& value, parse::To<std::string>);
+
+/// Returns a view into the buffer without copying the string
+std::string_view Parse(const Value& value, parse::To<std::string_view>);
+
+inline Value Parse(const Value& value, parse::To<Value>) { return value; }
+
+/// Converts the value into formats::json::Value, MessagePack extension types
+/// are not supported
+formats::json::Value Parse(const Value& value, parse::To<formats::json::Value>);
+
+using formats::common::Items;
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
@@ -119,6 +119,7 @@ inline constexpr PredefinedHeader kSetCookie{"Set-Cookie"};
 inline constexpr PredefinedHeader kWebsocketKey{"Sec-WebSocket-Key"};
 inline constexpr PredefinedHeader kWebsocketAccept{"Sec-WebSocket-Accept"};
 inline constexpr PredefinedHeader kWebsocketVersion{"Sec-WebSocket-Version"};
+inline constexpr PredefinedHeader kWebsocketExtensions{"Sec-WebSocket-Extensions"};
 /// @}
 
 /// @name Extra headers
@@ -183,6 +184,7 @@ inline constexpr std::string_view kMaxResponseSizeInFlight{"max-response-size-in
 inline constexpr std::string_view kMaxPendingResponses{"too-many-pending-responses"};
 inline constexpr std::string_view kGlobal{"global-ratelimit"};
 inline constexpr std::string_view kInFlight{"max-requests-in-flight"};
+inline constexpr std::string_view kClient{"client-ratelimit"};
 }  // namespace ratelimit_reason
 /// @}
 
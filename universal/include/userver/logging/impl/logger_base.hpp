@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 
 #include <boost/container/small_vector.hpp>
 
@@ -79,6 +80,15 @@ public:
     formatters::BasePtr MakeFormatter(Level level, LogClass log_class, const utils::impl::SourceLocation& location)
         override;
 
+protected:
+    /// Makes a text formatter of the logger format for a record that was
+    /// captured at `time`
+    formatters::BasePtr MakeTextFormatter(
+        Level level,
+        const utils::impl::SourceLocation& location,
+        std::chrono::system_clock::time_point time
+    ) const;
+
 private:
     const Format format_;
 };
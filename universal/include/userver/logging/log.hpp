@@ -4,6 +4,7 @@
 /// @brief Logging helpers
 
 #include <chrono>
+#include <cstdint>
 
 #include <userver/compiler/select.hpp>
 #include <userver/logging/fwd.hpp>
@@ -134,9 +135,9 @@ public:
     bool ShouldNotLog(const LoggerPtr& logger, Level level) const noexcept;
 
 private:
-    static constexpr std::size_t kContentSize = compiler::SelectSize().For64Bit(40).For32Bit(24);
+    static constexpr std::size_t kContentSize = compiler::SelectSize().For64Bit(80).For32Bit(56);
 
-    alignas(void*) std::byte content_[kContentSize];
+    alignas(std::uint64_t) std::byte content_[kContentSize];
 };
 
 template <class NameHolder, int Line>
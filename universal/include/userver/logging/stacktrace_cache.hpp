@@ -13,6 +13,11 @@ namespace logging::stacktrace_cache {
 /// @see GlobalEnableStacktrace
 std::string to_string(const boost::stacktrace::stacktrace& st);
 
+/// Get cached function name of the frame, without the source location.
+/// Returns an empty string for the frames that start a coroutine.
+/// @see GlobalEnableStacktrace
+std::string frame_name(const boost::stacktrace::frame& frame);
+
 /// Enable/disable stacktraces. If disabled, stacktrace_cache::to_string()
 /// returns with a const string.
 ///
@@ -0,0 +1,132 @@
+#pragma once
+
+/// @file userver/utils/arena.hpp
+/// @brief @copybrief utils::Arena
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Monotonic allocation arena that frees all of its memory at once.
+///
+/// Allocations are served by bumping a pointer inside blocks, individual
+/// deallocations are no-ops. All the memory is released on Reset() or on
+/// destruction. Blocks of the default size are recycled through a small
+/// thread-local cache, so that typical short-lived arenas (e.g. a request
+/// handling) avoid the global allocator altogether.
+///
+/// Not thread-safe.
+class Arena final {
+public:
+    Arena() noexcept = default;
+
+    Arena(Arena&& other) noexcept;
+    Arena& operator=(Arena&& other) noexcept;
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena();
+
+    /// @brief Allocates uninitialized memory of the given size and alignment.
+    /// @throws std::bad_alloc
+    void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+    /// @brief Constructs an object inside the arena. Its destructor is invoked
+    /// on Reset() or on destruction of the arena, in the reverse order.
+    template <typename T, typename... Args>
+    T& Emplace(Args&&... args);
+
+    /// @brief Runs destructors of the emplaced objects and frees all the memory.
+    void Reset() noexcept;
+
+    /// @returns total bytes allocated from the arena since the last Reset()
+    std::size_t GetAllocatedBytes() const noexcept { return allocated_bytes_; }
+
+private:
+    struct Block;
+    struct Destructor;
+
+    void* AllocateSlow(std::size_t size, std::size_t alignment);
+    void RegisterDestructor(void (*destroy)(void*) noexcept, void* object);
+
+    Block* blocks_{nullptr};
+    std::byte* current_{nullptr};
+    std::byte* end_{nullptr};
+    Destructor* destructors_{nullptr};
+    std::size_t allocated_bytes_{0};
+};
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief STL-compatible allocator over utils::Arena. Deallocation is a no-op,
+/// the memory is released together with the arena.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena& arena) noexcept : arena_(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_(&other.GetArena()) {}
+
+    T* allocate(std::size_t n) { return static_cast<T*>(arena_->Allocate(sizeof(T) * n, alignof(T))); }
+
+    void deallocate(T*, std::size_t) noexcept {}
+
+    Arena& GetArena() const noexcept { return *arena_; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena_ == &other.GetArena();
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+        return !(*this == other);
+    }
+
+private:
+    Arena* arena_;
+};
+
+inline void* Arena::Allocate(std::size_t size, std::size_t alignment) {
+    if (current_) {
+        const auto aligned = (reinterpret_cast<std::uintptr_t>(current_) + alignment - 1) & ~(alignment - 1);
+        const auto end = reinterpret_cast<std::uintptr_t>(end_);
+        if (aligned <= end && size <= end - aligned) {
+            current_ = reinterpret_cast<std::byte*>(aligned + size);
+            allocated_bytes_ += size;
+            return reinterpret_cast<void*>(aligned);
+        }
+    }
+    return AllocateSlow(size, alignment);
+}
+
+template <typename T, typename... Args>
+T& Arena::Emplace(Args&&... args) {
+    void* storage = Allocate(sizeof(T), alignof(T));
+    T* object = new (storage) T(std::forward<Args>(args)...);
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        try {
+            RegisterDestructor([](void* ptr) noexcept { static_cast<T*>(ptr)->~T(); }, object);
+        } catch (...) {
+            object->~T();
+            throw;
+        }
+    }
+    return *object;
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,63 @@
+#pragma once
+
+/// @file userver/utils/datetime/rfc3339.hpp
+/// @brief Fast fixed-format RFC 3339 converters that do not allocate.
+/// @ingroup userver_universal
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::datetime {
+
+/// Enough for "-292277-12-31T23:59:59.999999999+23:59"
+inline constexpr std::size_t kRfc3339MaxSize = 40;
+
+/// Caller-provided storage for FormatRfc3339() and FormatRfc3339Utc()
+using Rfc3339Buffer = std::array<char, kRfc3339MaxSize>;
+
+/// @brief Writes the time point as "YYYY-MM-DDTHH:MM:SS[.fraction]Z" into the
+/// buffer and returns the written part of it.
+///
+/// The fraction has no trailing zeros and is omitted for the whole seconds.
+///
+/// Example:
+/// @snippet utils/datetime/rfc3339_test.cpp FormatRfc3339 example
+std::string_view FormatRfc3339Utc(std::chrono::system_clock::time_point tp, Rfc3339Buffer& buffer) noexcept;
+
+/// @brief Writes the time point in the `utc_offset` timezone as
+/// "YYYY-MM-DDTHH:MM:SS[.fraction]+HH:MM" into the buffer and returns the
+/// written part of it.
+///
+/// The output is the same as the one of
+/// `utils::datetime::Timestring(tp, "UTC", kRfc3339Format)` for the zero
+/// offset.
+std::string_view FormatRfc3339(
+    std::chrono::system_clock::time_point tp,
+    std::chrono::minutes utc_offset,
+    Rfc3339Buffer& buffer
+) noexcept;
+
+/// @brief Parses "YYYY-MM-DDTHH:MM:SS[.fraction](Z|+HH:MM|-HH:MM)".
+///
+/// The fraction digits after the 9th are ignored.
+///
+/// @returns std::nullopt if the string is not in the format, the date does not
+/// exist or is out of the std::chrono::system_clock range.
+///
+/// Example:
+/// @snippet utils/datetime/rfc3339_test.cpp ParseRfc3339 example
+std::optional<std::chrono::system_clock::time_point> ParseRfc3339(std::string_view timestring) noexcept;
+
+/// @overload
+/// Also returns the UTC offset of the string, zero for "Z".
+std::optional<std::chrono::system_clock::time_point>
+ParseRfc3339(std::string_view timestring, std::chrono::minutes& utc_offset) noexcept;
+
+}  // namespace utils::datetime
+
+USERVER_NAMESPACE_END
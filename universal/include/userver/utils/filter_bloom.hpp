@@ -3,8 +3,10 @@
 /// @file userver/utils/filter_bloom.hpp
 /// @brief @copybrief utils::FilterBloom
 
+#include <algorithm>
 #include <array>
 #include <functional>
+#include <limits>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -45,7 +47,8 @@ public:
         UASSERT((std::is_same_v<std::invoke_result_t<Hash1, const T&>, std::invoke_result_t<Hash2, const T&>>));
     }
 
-    /// @brief Increments the smallest item counters
+    /// @brief Increments the smallest item counters, the counters saturate at
+    /// the maximum value of `Counter`
     void Increment(const T& item);
 
     /// @brief Returns the value of the smallest item counter
@@ -57,6 +60,10 @@ public:
     /// @brief Resets all counters
     void Clear();
 
+    /// @brief Divides all counters by two, e.g. to make the old increments
+    /// less significant than the new ones
+    void Halve();
+
 private:
     using HashedType = std::invoke_result_t<Hash1, const T&>;
 
@@ -106,12 +113,20 @@ template <typename T, typename Counter, typename Hash1, typename Hash2>
 void FilterBloom<T, Counter, Hash1, Hash2>::Increment(const T& item) {
     auto hash_value_1 = hasher_1(item);
     auto hash_value_2 = hasher_2(item);
-    Counter min_frequency = MinFrequency(hash_value_1, hash_value_2);
 
+    // The divisions are the most expensive part, the indices are computed once
+    std::array<Counter*, kHashFunctionsCount> counters{};
     for (std::size_t step = 0; step < kHashFunctionsCount; ++step) {
-        auto& current_count = counters_[GetHash(hash_value_1, hash_value_2, Coefficient(step)) % counters_.size()];
-        if (current_count == min_frequency) {
-            current_count++;
+        counters[step] = &counters_[GetHash(hash_value_1, hash_value_2, Coefficient(step)) % counters_.size()];
+    }
+    Counter min_frequency = *counters[0];
+    for (const auto* counter : counters) {
+        min_frequency = std::min(min_frequency, *counter);
+    }
+
+    for (auto* counter : counters) {
+        if (*counter == min_frequency && *counter != std::numeric_limits<Counter>::max()) {
+            ++*counter;
         }
     }
 }
@@ -135,6 +150,13 @@ void FilterBloom<T, Counter, Hash1, Hash2>::Clear() {
     }
 }
 
+template <typename T, typename Counter, typename Hash1, typename Hash2>
+void FilterBloom<T, Counter, Hash1, Hash2>::Halve() {
+    for (auto& counter : counters_) {
+        counter /= 2;
+    }
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
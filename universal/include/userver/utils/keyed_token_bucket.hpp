@@ -0,0 +1,67 @@
+#pragma once
+
+/// @file userver/utils/keyed_token_bucket.hpp
+/// @brief @copybrief utils::KeyedTokenBucket
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_universal userver_concurrency
+///
+/// @brief Thread safe ratelimiter with a separate token bucket for each key,
+/// e.g. for each tenant or client IP.
+///
+/// The buckets are kept in a fixed-size set-associative table, so the memory
+/// usage does not depend on the number of keys. Each bucket is a single atomic
+/// timestamp (GCRA, the "virtual scheduling" form of a token bucket), which is
+/// refilled lazily on Obtain() without any locks.
+///
+/// If there is no free room for a new key, the bucket with the oldest
+/// timestamp among the few candidate slots is evicted. That bucket is the one
+/// that was idle for the longest time and is usually already full, so the
+/// eviction is approximately LRU and rarely affects the limits. Keys that are
+/// being throttled have timestamps in the future and are evicted last.
+///
+/// Different keys with the same 64-bit hash share a bucket.
+class KeyedTokenBucket final {
+public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+    using Duration = std::chrono::steady_clock::duration;
+
+    /// Limit for a single key, may be different for each Obtain() call
+    struct Limit {
+        /// Token bucket size, the max burst of requests (zero forbids all)
+        std::size_t max_size{1};
+        /// One token is added each refill_interval (zero means "no limit")
+        Duration refill_interval{Duration::zero()};
+    };
+
+    /// Create a table for approximately `max_keys` keys
+    explicit KeyedTokenBucket(std::size_t max_keys);
+
+    KeyedTokenBucket(KeyedTokenBucket&&) = delete;
+    KeyedTokenBucket& operator=(KeyedTokenBucket&&) = delete;
+    ~KeyedTokenBucket();
+
+    /// @returns the number of buckets in the table
+    std::size_t GetMaxKeys() const noexcept;
+
+    /// @returns true if a token for the `key` was successfully obtained
+    [[nodiscard]] bool Obtain(std::string_view key, const Limit& limit);
+
+private:
+    struct Set;
+
+    std::size_t sets_mask_;
+    std::unique_ptr<Set[]> sets_;
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,486 @@
+#pragma once
+
+/// @file userver/utils/persistent_hash_map.hpp
+/// @brief @copybrief utils::PersistentHashMap
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace impl::persistent_hash_map {
+
+inline constexpr unsigned kBitsPerLevel = 5;
+inline constexpr unsigned kHashBits = std::numeric_limits<std::size_t>::digits;
+
+// Levels that consume the hash bits, and a level of nodes with the entries
+// that have the same hash
+inline constexpr std::size_t kMaxDepth = (kHashBits + kBitsPerLevel - 1) / kBitsPerLevel + 1;
+
+constexpr std::uint32_t GetBit(std::size_t hash, unsigned shift) noexcept {
+    return std::uint32_t{1} << ((hash >> shift) & ((1U << kBitsPerLevel) - 1));
+}
+
+// Index of the `bit` among the set bits of the `map`
+inline std::size_t GetIndex(std::uint32_t map, std::uint32_t bit) noexcept {
+    return __builtin_popcount(map & (bit - 1));
+}
+
+template <typename Entry>
+struct Node final {
+    // The entries and the children are ordered by the hash chunk of the
+    // level, the bits of the chunks are set in the maps. Nodes of the last
+    // level keep the entries unordered and have empty maps.
+    std::uint32_t entries_map{0};
+    std::uint32_t children_map{0};
+    std::vector<Entry> entries;
+    std::vector<std::shared_ptr<Node>> children;
+};
+
+}  // namespace impl::persistent_hash_map
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Unordered map with O(1) copying, the copies share the unchanged
+/// parts of the data.
+///
+/// The map is a hash array mapped trie (a CHAMP variant of it): a tree of
+/// nodes with up to 32 entries and children each, selected by the next 5 bits
+/// of the key hash. Copying the map copies a pointer to the root, modification
+/// copies the nodes on the path to the modified entry (at most
+/// `log32(size())` of them) unless they are not shared with the other copies.
+///
+/// It is meant for the caches with incremental updates: the new snapshot is
+/// made by copying the current one and applying the changes, which takes
+/// O(changes) time and memory instead of O(size()), while the readers keep
+/// using the old snapshot.
+///
+/// @snippet utils/persistent_hash_map_test.cpp  Sample utils::PersistentHashMap usage
+///
+/// Lookups and iteration take a few dependent memory loads per trie level, for
+/// the maps that do not fit into the CPU caches they are several times slower
+/// than with `std::unordered_map`. Prefer `std::unordered_map` for the data
+/// that is small or is fully rebuilt on each update anyway.
+///
+/// Different copies of the map may be used concurrently, the same copy
+/// may not be modified concurrently with any other access to it.
+/// `Key` and `Value` must be copyable.
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+class PersistentHashMap final {
+    using Node = impl::persistent_hash_map::Node<std::pair<Key, Value>>;
+    using NodePtr = std::shared_ptr<Node>;
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = Equal;
+
+    class const_iterator;
+    using iterator = const_iterator;
+
+    PersistentHashMap() = default;
+
+    explicit PersistentHashMap(const Hash& hash, const Equal& equal = Equal()) : hash_(hash), equal_(equal) {}
+
+    PersistentHashMap(std::initializer_list<value_type> values) {
+        for (const auto& [key, value] : values) {
+            insert_or_assign(key, value);
+        }
+    }
+
+    /// @brief O(1), the copies share the data
+    PersistentHashMap(const PersistentHashMap&) = default;
+    PersistentHashMap(PersistentHashMap&&) noexcept = default;
+    PersistentHashMap& operator=(const PersistentHashMap&) = default;
+    PersistentHashMap& operator=(PersistentHashMap&&) noexcept = default;
+
+    const_iterator begin() const noexcept { return const_iterator{root_.get()}; }
+    const_iterator end() const noexcept { return {}; }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    const_iterator find(const Key& key) const;
+
+    bool contains(const Key& key) const { return FindEntry(key) != nullptr; }
+
+    /// @throws std::out_of_range if there is no such key
+    const Value& at(const Key& key) const;
+
+    /// @brief Inserts the value or assigns it to the existing one.
+    /// @returns `true` if the value was inserted.
+    bool insert_or_assign(Key key, Value value);
+
+    /// @returns the number of erased elements, 0 or 1.
+    size_type erase(const Key& key);
+
+    void clear() noexcept {
+        root_.reset();
+        size_ = 0;
+    }
+
+    /// @brief Compares the maps by value, the shared nodes are skipped
+    friend bool operator==(const PersistentHashMap& lhs, const PersistentHashMap& rhs) {
+        if (lhs.size() != rhs.size()) return false;
+        if (lhs.root_ == rhs.root_) return true;
+        return std::all_of(lhs.begin(), lhs.end(), [&rhs](const value_type& entry) {
+            const auto* other = rhs.FindEntry(entry.first);
+            return other && other->second == entry.second;
+        });
+    }
+
+    friend bool operator!=(const PersistentHashMap& lhs, const PersistentHashMap& rhs) { return !(lhs == rhs); }
+
+private:
+    static Node& MakeMutable(NodePtr& node);
+
+    NodePtr MakeNode(value_type&& first, std::size_t first_hash, value_type&& second, std::size_t second_hash, unsigned shift)
+        const;
+
+    bool DoInsertOrAssign(NodePtr& node_ptr, std::size_t hash, unsigned shift, Key&& key, Value&& value);
+    void DoErase(NodePtr& node_ptr, std::size_t hash, unsigned shift, const Key& key);
+
+    const value_type* FindEntry(const Key& key) const;
+
+    NodePtr root_;
+    size_type size_{0};
+    Hash hash_;
+    Equal equal_;
+};
+
+/// @brief Forward iterator over the utils::PersistentHashMap entries, is not
+/// invalidated by the modification of the other copies of the map.
+template <typename Key, typename Value, typename Hash, typename Equal>
+class PersistentHashMap<Key, Value, Hash, Equal>::const_iterator final {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = PersistentHashMap::value_type;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+
+    const_iterator() = default;
+
+    reference operator*() const {
+        UASSERT(depth_ > 0);
+        return frames_[depth_ - 1].node->entries[entry_];
+    }
+    pointer operator->() const { return &**this; }
+
+    const_iterator& operator++() {
+        UASSERT(depth_ > 0);
+        if (++entry_ == frames_[depth_ - 1].node->entries.size()) {
+            SkipToNextEntries();
+        }
+        return *this;
+    }
+
+    const_iterator operator++(int) {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    bool operator==(const const_iterator& other) const noexcept {
+        return depth_ == other.depth_ &&
+               (depth_ == 0 || (frames_[depth_ - 1].node == other.frames_[depth_ - 1].node && entry_ == other.entry_));
+    }
+    bool operator!=(const const_iterator& other) const noexcept { return !(*this == other); }
+
+private:
+    friend class PersistentHashMap;
+
+    struct Frame {
+        const Node* node{nullptr};
+        // The children before it are visited already
+        std::size_t next_child{0};
+    };
+
+    explicit const_iterator(const Node* root) noexcept {
+        if (!root) return;
+        frames_[depth_++] = {root, 0};
+        if (root->entries.empty()) SkipToNextEntries();
+    }
+
+    // Visits the nodes in pre-order starting from the children of the
+    // current node until a node with entries is found
+    void SkipToNextEntries() noexcept {
+        entry_ = 0;
+        while (depth_ > 0) {
+            auto& frame = frames_[depth_ - 1];
+            if (frame.next_child == frame.node->children.size()) {
+                --depth_;
+                continue;
+            }
+            const Node* child = frame.node->children[frame.next_child++].get();
+            frames_[depth_++] = {child, 0};
+            if (!child->entries.empty()) return;
+        }
+    }
+
+    std::array<Frame, impl::persistent_hash_map::kMaxDepth> frames_{};
+    std::size_t depth_{0};
+    std::size_t entry_{0};
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::find(const Key& key) const -> const_iterator {
+    using impl::persistent_hash_map::GetBit;
+    using impl::persistent_hash_map::GetIndex;
+    using impl::persistent_hash_map::kBitsPerLevel;
+    using impl::persistent_hash_map::kHashBits;
+
+    const_iterator result;
+    const auto hash = hash_(key);
+    const Node* node = root_.get();
+    for (unsigned shift = 0; node; shift += kBitsPerLevel) {
+        result.frames_[result.depth_++] = {node, 0};
+        if (shift >= kHashBits) {
+            const auto it = std::find_if(node->entries.begin(), node->entries.end(), [&](const value_type& entry) {
+                return equal_(entry.first, key);
+            });
+            if (it == node->entries.end()) break;
+            result.entry_ = it - node->entries.begin();
+            return result;
+        }
+
+        const auto bit = GetBit(hash, shift);
+        if (node->entries_map & bit) {
+            const auto index = GetIndex(node->entries_map, bit);
+            if (!equal_(node->entries[index].first, key)) break;
+            result.entry_ = index;
+            return result;
+        }
+        if (!(node->children_map & bit)) break;
+
+        const auto index = GetIndex(node->children_map, bit);
+        result.frames_[result.depth_ - 1].next_child = index + 1;
+        node = node->children[index].get();
+    }
+    return end();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value& PersistentHashMap<Key, Value, Hash, Equal>::at(const Key& key) const {
+    const auto* entry = FindEntry(key);
+    if (!entry) throw std::out_of_range("utils::PersistentHashMap::at: no such key");
+    return entry->second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool PersistentHashMap<Key, Value, Hash, Equal>::insert_or_assign(Key key, Value value) {
+    if (!root_) root_ = std::make_shared<Node>();
+    const auto hash = hash_(key);
+    const bool inserted = DoInsertOrAssign(root_, hash, 0, std::move(key), std::move(value));
+    if (inserted) ++size_;
+    return inserted;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::erase(const Key& key) -> size_type {
+    // Avoids copying the nodes if there is nothing to erase
+    if (!contains(key)) return 0;
+
+    DoErase(root_, hash_(key), 0, key);
+    if (--size_ == 0) root_.reset();
+    return 1;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::MakeMutable(NodePtr& node) -> Node& {
+    if (node.use_count() != 1) {
+        node = std::make_shared<Node>(std::as_const(*node));
+    } else {
+        // Synchronizes with the release of the node by the other copies
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return *node;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::MakeNode(
+    value_type&& first,
+    std::size_t first_hash,
+    value_type&& second,
+    std::size_t second_hash,
+    unsigned shift
+) const -> NodePtr {
+    using impl::persistent_hash_map::GetBit;
+    using impl::persistent_hash_map::kBitsPerLevel;
+    using impl::persistent_hash_map::kHashBits;
+
+    auto node = std::make_shared<Node>();
+    if (shift >= kHashBits) {
+        node->entries.reserve(2);
+        node->entries.push_back(std::move(first));
+        node->entries.push_back(std::move(second));
+        return node;
+    }
+
+    const auto first_bit = GetBit(first_hash, shift);
+    const auto second_bit = GetBit(second_hash, shift);
+    if (first_bit == second_bit) {
+        node->children_map = first_bit;
+        node->children.push_back(
+            MakeNode(std::move(first), first_hash, std::move(second), second_hash, shift + kBitsPerLevel)
+        );
+        return node;
+    }
+
+    node->entries_map = first_bit | second_bit;
+    node->entries.reserve(2);
+    if (first_bit > second_bit) std::swap(first, second);
+    node->entries.push_back(std::move(first));
+    node->entries.push_back(std::move(second));
+    return node;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool PersistentHashMap<Key, Value, Hash, Equal>::DoInsertOrAssign(
+    NodePtr& node_ptr,
+    std::size_t hash,
+    unsigned shift,
+    Key&& key,
+    Value&& value
+) {
+    using impl::persistent_hash_map::GetBit;
+    using impl::persistent_hash_map::GetIndex;
+    using impl::persistent_hash_map::kBitsPerLevel;
+    using impl::persistent_hash_map::kHashBits;
+
+    Node& node = MakeMutable(node_ptr);
+    if (shift >= kHashBits) {
+        for (auto& entry : node.entries) {
+            if (equal_(entry.first, key)) {
+                entry.second = std::move(value);
+                return false;
+            }
+        }
+        node.entries.emplace_back(std::move(key), std::move(value));
+        return true;
+    }
+
+    const auto bit = GetBit(hash, shift);
+    if (node.children_map & bit) {
+        auto& child = node.children[GetIndex(node.children_map, bit)];
+        return DoInsertOrAssign(child, hash, shift + kBitsPerLevel, std::move(key), std::move(value));
+    }
+
+    const auto index = GetIndex(node.entries_map, bit);
+    if (!(node.entries_map & bit)) {
+        node.entries.emplace(node.entries.begin() + index, std::move(key), std::move(value));
+        node.entries_map |= bit;
+        return true;
+    }
+
+    auto& entry = node.entries[index];
+    if (equal_(entry.first, key)) {
+        entry.second = std::move(value);
+        return false;
+    }
+
+    // Both entries are moved to a new child
+    const auto entry_hash = hash_(entry.first);
+    auto child = MakeNode(
+        std::move(entry), entry_hash, value_type{std::move(key), std::move(value)}, hash, shift + kBitsPerLevel
+    );
+    node.entries.erase(node.entries.begin() + index);
+    node.entries_map &= ~bit;
+    node.children.insert(node.children.begin() + GetIndex(node.children_map, bit), std::move(child));
+    node.children_map |= bit;
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void PersistentHashMap<Key, Value, Hash, Equal>::DoErase(
+    NodePtr& node_ptr,
+    std::size_t hash,
+    unsigned shift,
+    const Key& key
+) {
+    using impl::persistent_hash_map::GetBit;
+    using impl::persistent_hash_map::GetIndex;
+    using impl::persistent_hash_map::kBitsPerLevel;
+    using impl::persistent_hash_map::kHashBits;
+
+    Node& node = MakeMutable(node_ptr);
+    if (shift >= kHashBits) {
+        const auto it = std::find_if(node.entries.begin(), node.entries.end(), [&](const value_type& entry) {
+            return equal_(entry.first, key);
+        });
+        UASSERT(it != node.entries.end());
+        node.entries.erase(it);
+        return;
+    }
+
+    const auto bit = GetBit(hash, shift);
+    if (node.entries_map & bit) {
+        node.entries.erase(node.entries.begin() + GetIndex(node.entries_map, bit));
+        node.entries_map &= ~bit;
+        return;
+    }
+
+    UASSERT(node.children_map & bit);
+    const auto child_index = GetIndex(node.children_map, bit);
+    auto& child = node.children[child_index];
+    DoErase(child, hash, shift + kBitsPerLevel, key);
+
+    // A child with a single entry is inlined to keep the lookups short
+    if (child->children.empty() && child->entries.size() == 1) {
+        auto entry = std::move(child->entries.front());
+        node.children.erase(node.children.begin() + child_index);
+        node.children_map &= ~bit;
+        node.entries.insert(node.entries.begin() + GetIndex(node.entries_map, bit), std::move(entry));
+        node.entries_map |= bit;
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::FindEntry(const Key& key) const -> const value_type* {
+    using impl::persistent_hash_map::GetBit;
+    using impl::persistent_hash_map::GetIndex;
+    using impl::persistent_hash_map::kBitsPerLevel;
+    using impl::persistent_hash_map::kHashBits;
+
+    const auto hash = hash_(key);
+    const Node* node = root_.get();
+    for (unsigned shift = 0; node; shift += kBitsPerLevel) {
+        if (shift >= kHashBits) {
+            for (const auto& entry : node->entries) {
+                if (equal_(entry.first, key)) return &entry;
+            }
+            return nullptr;
+        }
+
+        const auto bit = GetBit(hash, shift);
+        if (node->entries_map & bit) {
+            const auto& entry = node->entries[GetIndex(node->entries_map, bit)];
+            return equal_(entry.first, key) ? &entry : nullptr;
+        }
+        if (!(node->children_map & bit)) return nullptr;
+        node = node->children[GetIndex(node->children_map, bit)].get();
+    }
+    return nullptr;
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -5,7 +5,9 @@
 
 #include <cstddef>
 #include <exception>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include <userver/utils/fast_pimpl.hpp>
 
@@ -16,7 +18,7 @@ namespace utils {
 class match_results;
 struct Re2Replacement;
 
-/// Thrown from constructors of @ref utils::regex with an invalid pattern.
+/// Thrown from constructors of @ref utils::regex and @ref utils::RegexSet with an invalid pattern.
 class RegexError : public std::exception {};
 
 /// @ingroup userver_universal userver_containers
@@ -189,6 +191,59 @@ struct Re2Replacement final {
 /// @see utils::Re2Replacement
 std::string regex_replace(std::string_view str, const regex& pattern, Re2Replacement repl);
 
+/// @ingroup userver_universal userver_containers
+///
+/// @brief A set of regular expressions that is matched against a string in a single pass.
+///
+/// All the patterns are compiled into a single automaton, so matching a string against a set of N patterns is
+/// considerably faster than N calls of @ref utils::regex_search. Only the indices of the matched patterns are
+/// reported, capturing groups are ignored.
+///
+/// Unlike utils::regex, never falls back to boost::regex, so all the patterns must be supported by re2.
+///
+/// ## Example usage:
+/// @snippet utils/regex_test.cpp  regex set
+class RegexSet final {
+public:
+    /// How the patterns are matched against the target string.
+    enum class Mode {
+        kSearch,  ///< a pattern may match any substring, as in @ref utils::regex_search
+        kMatch,   ///< a pattern must match the whole string, as in @ref utils::regex_match
+    };
+
+    /// Constructs a null set, any usage except for copy/move is UB.
+    RegexSet();
+
+    /// @brief Compiles the patterns, the pattern at index `i` is reported as `i` by the matching functions.
+    /// @throws utils::RegexError if any of the patterns is invalid
+    explicit RegexSet(const std::vector<std::string>& patterns, Mode mode = Mode::kSearch);
+
+    RegexSet(const RegexSet&);
+    RegexSet(RegexSet&&) noexcept;
+    RegexSet& operator=(const RegexSet&);
+    RegexSet& operator=(RegexSet&&) noexcept;
+    ~RegexSet();
+
+    /// @returns the number of patterns in the set.
+    std::size_t size() const;
+
+    /// @returns a view to the pattern at @a index.
+    std::string_view GetPatternView(std::size_t index) const;
+
+    /// @returns the indices of all the patterns that match @a str, in ascending order.
+    /// @throws utils::RegexError if the automaton for the set does not fit into the re2 memory budget.
+    std::vector<std::size_t> Match(std::string_view str) const;
+
+    /// @returns `true` if at least one of the patterns matches @a str.
+    /// @note Faster than `!Match(str).empty()`, as the matching stops on the first match.
+    /// @throws utils::RegexError if the automaton for the set does not fit into the re2 memory budget.
+    bool MatchesAny(std::string_view str) const;
+
+private:
+    struct Impl;
+    utils::FastPimpl<Impl, 16, 8> impl_;
+};
+
 /// @cond
 bool IsImplicitBoostRegexFallbackAllowed() noexcept;
 void SetImplicitBoostRegexFallbackAllowed(bool) noexcept;
@@ -4,6 +4,9 @@
 /// @brief Functions to work with OS threads.
 /// @ingroup userver_universal
 
+#include <cstddef>
+#include <vector>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils {
@@ -19,6 +22,16 @@ void SetCurrentThreadIdleScheduling();
 /// @throws std::system_error
 void SetCurrentThreadLowPriorityScheduling();
 
+/// @brief Restrict the OS thread to run only on the specified CPUs
+/// @throws std::system_error if the CPUs could not be set or if the platform
+/// does not support thread CPU affinity
+void SetCurrentThreadCpuAffinity(const std::vector<std::size_t>& cpus);
+
+/// @brief Get the sorted list of CPUs the OS thread is allowed to run on
+/// @throws std::system_error if the CPUs could not be retrieved or if the
+/// platform does not support thread CPU affinity
+std::vector<std::size_t> GetCurrentThreadCpuAffinity();
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
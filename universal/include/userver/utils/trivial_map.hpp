@@ -3,7 +3,10 @@
 /// @file userver/utils/trivial_map.hpp
 /// @brief Bidirectional map|sets over string literals or other trivial types.
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -561,6 +564,184 @@ private:
     std::size_t index_ = 0;
 };
 
+template <typename First, typename Second>
+struct CaseEntry final {
+    First first{};
+    Second second{};
+};
+
+template <typename First>
+struct CaseEntry<First, void> final {
+    First first{};
+};
+
+template <typename First, typename Second, std::size_t Size>
+class CaseCollector final {
+public:
+    constexpr CaseCollector& Case(First first, Second second) noexcept {
+        entries_[size_++] = {first, second};
+        return *this;
+    }
+
+    template <typename T, typename U>
+    constexpr CaseCollector& Type() {
+        return *this;
+    }
+
+    [[nodiscard]] constexpr std::array<CaseEntry<First, Second>, Size> Extract() const noexcept { return entries_; }
+
+private:
+    std::array<CaseEntry<First, Second>, Size> entries_{};
+    std::size_t size_{0};
+};
+
+template <typename First, std::size_t Size>
+class CaseCollector<First, void, Size> final {
+public:
+    constexpr CaseCollector& Case(First first) noexcept {
+        entries_[size_++] = {first};
+        return *this;
+    }
+
+    template <typename T, typename U = void>
+    constexpr CaseCollector& Type() {
+        return *this;
+    }
+
+    [[nodiscard]] constexpr std::array<CaseEntry<First, void>, Size> Extract() const noexcept { return entries_; }
+
+private:
+    std::array<CaseEntry<First, void>, Size> entries_{};
+    std::size_t size_{0};
+};
+
+// Maps with more string Case's are searched in a hash table built at compile
+// time rather than with a chain of comparisons. Chains of integral and enum
+// comparisons are already turned into a switch by the compiler.
+inline constexpr std::size_t kMaxLinearSearchSize = 32;
+
+template <typename BuilderFunc>
+inline constexpr std::size_t kCasesCount = BuilderFunc{}([]() { return CaseCounter{}; }).Extract();
+
+// The table is built from a default constructed BuilderFunc, that works for
+// utils::MakeTrivialBiMap, utils::MakeTrivialSet and, since C++20, for the
+// lambdas without captures
+template <typename BuilderFunc, typename Key>
+constexpr bool UseHashedSearch() noexcept {
+    if constexpr (std::is_default_constructible_v<BuilderFunc> && std::is_same_v<Key, std::string_view>) {
+        return kCasesCount<BuilderFunc> > kMaxLinearSearchSize;
+    } else {
+        return false;
+    }
+}
+
+constexpr std::uint64_t GetByte(std::string_view value, std::size_t pos) noexcept {
+    return static_cast<unsigned char>(value[pos]);
+}
+
+// Little endian 8 bytes starting at `pos`
+constexpr std::uint64_t LoadWord(std::string_view value, std::size_t pos) noexcept {
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (!__builtin_is_constant_evaluated()) {
+        std::uint64_t word{};
+        std::memcpy(&word, value.data() + pos, sizeof(word));
+        return word;
+    }
+#endif
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < 8; ++i) {
+        word |= GetByte(value, pos + i) << (8 * i);
+    }
+    return word;
+}
+
+// Folded 128 bit product mixes all the bits of both multipliers
+constexpr std::uint64_t MultiplyFold(std::uint64_t x, std::uint64_t y) noexcept {
+    const auto product = static_cast<__uint128_t>(x) * y;
+    return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+}
+
+constexpr std::uint64_t HashForSearch(std::string_view value) noexcept {
+    constexpr std::uint64_t kMultiplier = 0x9e3779b97f4a7c15;
+    const auto size = value.size();
+
+    std::uint64_t hash = size;
+    if (size < 8) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            word |= GetByte(value, i) << (8 * i);
+        }
+        return MultiplyFold(hash ^ word, kMultiplier);
+    }
+
+    for (std::size_t pos = 0; pos + 8 < size; pos += 8) {
+        hash = MultiplyFold(hash ^ LoadWord(value, pos), kMultiplier);
+    }
+    return MultiplyFold(hash ^ LoadWord(value, size - 8), kMultiplier);
+}
+
+struct HashSlot final {
+    std::uint64_t hash{0};
+    // Index of the Case, or the count of Case's for an empty slot
+    std::size_t index{0};
+};
+
+constexpr std::size_t GetHashTableSize(std::size_t cases_count) noexcept {
+    std::size_t size = 1;
+    while (size < 2 * cases_count) size *= 2;
+    return size;
+}
+
+// Open addressing with linear probing, at most half of the slots are used
+template <auto Member, typename Entry, std::size_t Size>
+constexpr auto MakeHashTable(const std::array<Entry, Size>& entries) noexcept {
+    constexpr std::size_t kTableSize = GetHashTableSize(Size);
+    std::array<HashSlot, kTableSize> table{};
+    for (auto& slot : table) slot.index = Size;
+
+    for (std::size_t i = 0; i < Size; ++i) {
+        const std::string_view key = entries[i].*Member;
+        const auto hash = HashForSearch(key);
+        for (std::size_t slot = hash & (kTableSize - 1);; slot = (slot + 1) & (kTableSize - 1)) {
+            if (table[slot].index == Size) {
+                table[slot] = HashSlot{hash, i};
+                break;
+            }
+            // The first of the duplicate keys is found, as with a chain of
+            // comparisons
+            if (table[slot].hash == hash && entries[table[slot].index].*Member == key) break;
+        }
+    }
+    return table;
+}
+
+// Returns the index of the Case with the `key` or `Size` if there is none
+template <auto Member, typename Entry, std::size_t Size, std::size_t TableSize>
+constexpr std::size_t FindHashed(
+    const std::array<Entry, Size>& entries,
+    const std::array<HashSlot, TableSize>& table,
+    std::string_view key
+) noexcept {
+    const auto hash = HashForSearch(key);
+    for (std::size_t slot = hash & (TableSize - 1);; slot = (slot + 1) & (TableSize - 1)) {
+        const auto& candidate = table[slot];
+        if (candidate.index == Size) return Size;
+        if (candidate.hash == hash && entries[candidate.index].*Member == key) return candidate.index;
+    }
+}
+
+template <typename BuilderFunc, typename First, typename Second>
+inline constexpr auto kCaseEntries =
+    BuilderFunc{}([]() { return CaseCollector<First, Second, kCasesCount<BuilderFunc>>{}; }).Extract();
+
+template <typename BuilderFunc, typename First, typename Second>
+inline constexpr auto kCaseHashTableByFirst =
+    MakeHashTable<&CaseEntry<First, Second>::first>(kCaseEntries<BuilderFunc, First, Second>);
+
+template <typename BuilderFunc, typename First, typename Second>
+inline constexpr auto kCaseHashTableBySecond =
+    MakeHashTable<&CaseEntry<First, Second>::second>(kCaseEntries<BuilderFunc, First, Second>);
+
 }  // namespace impl
 
 /// @ingroup userver_universal userver_containers
@@ -575,6 +756,11 @@ private:
 /// * there's 32 or less elements in map/set
 /// * or keys are string literals and all of them differ in length.
 ///
+/// For the maps and sets with more than 32 string Case's made with
+/// utils::MakeTrivialBiMap or utils::MakeTrivialSet (or with any lambda since
+/// C++20) a hash table is built at compile time, and the exact match search
+/// takes O(1) regardless of the string lengths.
+///
 /// Implementation of string search is \b very efficient due to
 /// modern compilers optimize it to a switch by input string
 /// length and an integral comparison (rather than a std::memcmp call). In other
@@ -620,11 +806,27 @@ public:
     }
 
     constexpr std::optional<Second> TryFindByFirst(First value) const noexcept {
-        return func_([value]() { return impl::SwitchByFirst<First, Second>{value}; }).Extract();
+        if constexpr (impl::UseHashedSearch<BuilderFunc, First>()) {
+            using Entry = impl::CaseEntry<First, Second>;
+            constexpr const auto& kEntries = impl::kCaseEntries<BuilderFunc, First, Second>;
+            constexpr const auto& kTable = impl::kCaseHashTableByFirst<BuilderFunc, First, Second>;
+            const auto index = impl::FindHashed<&Entry::first>(kEntries, kTable, value);
+            return index != kEntries.size() ? std::optional{kEntries[index].second} : std::nullopt;
+        } else {
+            return func_([value]() { return impl::SwitchByFirst<First, Second>{value}; }).Extract();
+        }
     }
 
     constexpr std::optional<First> TryFindBySecond(Second value) const noexcept {
-        return func_([value]() { return impl::SwitchBySecond<First, Second>{value}; }).Extract();
+        if constexpr (impl::UseHashedSearch<BuilderFunc, Second>()) {
+            using Entry = impl::CaseEntry<First, Second>;
+            constexpr const auto& kEntries = impl::kCaseEntries<BuilderFunc, First, Second>;
+            constexpr const auto& kTable = impl::kCaseHashTableBySecond<BuilderFunc, First, Second>;
+            const auto index = impl::FindHashed<&Entry::second>(kEntries, kTable, value);
+            return index != kEntries.size() ? std::optional{kEntries[index].first} : std::nullopt;
+        } else {
+            return func_([value]() { return impl::SwitchBySecond<First, Second>{value}; }).Extract();
+        }
     }
 
     template <class T>
@@ -789,7 +991,14 @@ public:
     }
 
     constexpr bool Contains(First value) const noexcept {
-        return func_([value]() { return impl::SwitchByFirst<First, Second>{value}; }).Extract();
+        if constexpr (impl::UseHashedSearch<BuilderFunc, First>()) {
+            using Entry = impl::CaseEntry<First, Second>;
+            constexpr const auto& kEntries = impl::kCaseEntries<BuilderFunc, First, Second>;
+            constexpr const auto& kTable = impl::kCaseHashTableByFirst<BuilderFunc, First, Second>;
+            return impl::FindHashed<&Entry::first>(kEntries, kTable, value) != kEntries.size();
+        } else {
+            return func_([value]() { return impl::SwitchByFirst<First, Second>{value}; }).Extract();
+        }
     }
 
     constexpr bool ContainsICase(std::string_view value) const noexcept {
@@ -193,6 +193,18 @@ public:
     /// or Null.
     const_iterator end() const;
 
+    /// @brief Returns the same config with all the `$variable` substitutions,
+    /// `#env`, `#file` and `#fallback` applied at once.
+    ///
+    /// Member access on the result is a plain formats::yaml::Value lookup, so
+    /// resolve once the configs that are read many times, for example the whole
+    /// static config at startup. Paths of the values stay the same.
+    ///
+    /// Environment variables and files are read by this call, later changes to
+    /// them are not visible through the result. If an array has an item that
+    /// refers to a missing variable, a copy of *this is returned as is.
+    YamlConfig Resolve() const;
+
     /// @brief Get the plain Yaml without substitutions. It may contain raw references.
     /// @deprecated Either use the current `YamlConfig` as a formats value, or use `.As<formats::json::Value>()`
     /// to get the correct treatment for `$vars`, `#fallback`, `#env` and `#file`.
@@ -202,6 +214,8 @@ private:
     formats::yaml::Value yaml_;
     formats::yaml::Value config_vars_;
     Mode mode_{Mode::kSecure};
+    // All the special syntax is already applied to `yaml_`
+    bool is_resolved_{false};
 
     friend bool Parse(const YamlConfig& value, formats::parse::To<bool>);
     friend int64_t Parse(const YamlConfig& value, formats::parse::To<int64_t>);
@@ -0,0 +1,88 @@
+#include <userver/cache/impl/clock.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using Clock = cache::impl::ClockBase<int, std::string>;
+
+TEST(ClockBase, PutGet) {
+    Clock cache(2, {}, {});
+    EXPECT_TRUE(cache.Put(1, "1"));
+    EXPECT_TRUE(cache.Put(2, "2"));
+    EXPECT_FALSE(cache.Put(2, "two"));
+    EXPECT_EQ(cache.GetSize(), 2);
+
+    ASSERT_TRUE(cache.Get(2));
+    EXPECT_EQ(*cache.Get(2), "two");
+    EXPECT_EQ(cache.Get(3), nullptr);
+}
+
+TEST(ClockBase, EvictsNotReferenced) {
+    Clock cache(3, {}, {});
+    cache.Put(1, "1");
+    cache.Put(2, "2");
+    cache.Put(3, "3");
+    cache.Get(1);
+    cache.Get(3);
+
+    cache.Put(4, "4");
+    EXPECT_EQ(cache.GetSize(), 3);
+    EXPECT_EQ(cache.Get(2), nullptr);
+
+    // 4 took the slot of 2 and was not referenced since then, the hand
+    // clears the bits of 3 and 1 on the way to it
+    cache.Get(1);
+    cache.Put(5, "5");
+    EXPECT_EQ(cache.Get(4), nullptr);
+    EXPECT_TRUE(cache.Get(1));
+    EXPECT_TRUE(cache.Get(3));
+    EXPECT_TRUE(cache.Get(5));
+}
+
+TEST(ClockBase, HotKeysSurvive) {
+    Clock cache(100, {}, {});
+    for (int i = 0; i < 10000; ++i) {
+        cache.Put(i, std::to_string(i));
+        for (int hot = -10; hot < 0; ++hot) {
+            if (!cache.Get(hot)) cache.Put(hot, "hot");
+        }
+    }
+    EXPECT_EQ(cache.GetSize(), 100);
+    for (int hot = -10; hot < 0; ++hot) {
+        EXPECT_TRUE(cache.Get(hot)) << hot;
+    }
+}
+
+TEST(ClockBase, EraseAndResize) {
+    Clock cache(10, {}, {});
+    for (int i = 0; i < 10; ++i) cache.Put(i, std::to_string(i));
+
+    cache.Erase(0);
+    cache.Erase(5);
+    cache.Erase(42);
+    EXPECT_EQ(cache.GetSize(), 8);
+    std::size_t visited = 0;
+    cache.VisitAll([&visited](int key, const std::string& value) {
+        EXPECT_EQ(std::to_string(key), value);
+        EXPECT_TRUE(key != 0 && key != 5);
+        ++visited;
+    });
+    EXPECT_EQ(visited, 8);
+
+    cache.SetMaxSize(3);
+    EXPECT_EQ(cache.GetSize(), 3);
+    for (int i = 0; i < 10; ++i) {
+        if (const auto* value = cache.Get(i)) {
+            EXPECT_EQ(*value, std::to_string(i));
+        }
+    }
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetSize(), 0);
+    EXPECT_EQ(cache.Get(1), nullptr);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,80 @@
+#include <userver/cache/impl/tiny_lfu.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using TinyLfu = cache::impl::TinyLfuBase<int, std::string>;
+
+TEST(TinyLfuBase, PutGet) {
+    TinyLfu cache(100, {}, {});
+    EXPECT_TRUE(cache.Put(1, "1"));
+    EXPECT_TRUE(cache.Put(2, "2"));
+    EXPECT_FALSE(cache.Put(1, "one"));
+    EXPECT_EQ(cache.GetSize(), 2);
+
+    ASSERT_TRUE(cache.Get(1));
+    EXPECT_EQ(*cache.Get(1), "one");
+    EXPECT_EQ(cache.Get(3), nullptr);
+
+    cache.Erase(1);
+    EXPECT_EQ(cache.Get(1), nullptr);
+    EXPECT_EQ(cache.GetSize(), 1);
+}
+
+TEST(TinyLfuBase, SizeLimit) {
+    for (const std::size_t max_size : {1, 2, 3, 100, 1000}) {
+        TinyLfu cache(max_size, {}, {});
+        for (int i = 0; i < 5000; ++i) {
+            cache.Put(i % 1500, std::to_string(i));
+            cache.Get(i % 7);
+            EXPECT_LE(cache.GetSize(), max_size);
+        }
+        EXPECT_GE(cache.GetSize(), max_size / 2);
+    }
+}
+
+TEST(TinyLfuBase, ScanResistance) {
+    constexpr int kHotKeys = 50;
+    TinyLfu cache(100, {}, {});
+
+    int scanned = 1000;
+    for (int round = 0; round < 100; ++round) {
+        for (int key = 0; key < kHotKeys; ++key) {
+            if (!cache.Get(key)) cache.Put(key, "hot");
+        }
+        // Each scanned key is seen once
+        for (int i = 0; i < 200; ++i, ++scanned) {
+            if (!cache.Get(scanned)) cache.Put(scanned, "scan");
+        }
+    }
+
+    int hits = 0;
+    for (int key = 0; key < kHotKeys; ++key) {
+        if (cache.Get(key)) ++hits;
+    }
+    EXPECT_EQ(hits, kHotKeys);
+}
+
+TEST(TinyLfuBase, ResizeAndClear) {
+    TinyLfu cache(1000, {}, {});
+    for (int i = 0; i < 1000; ++i) cache.Put(i, std::to_string(i));
+    EXPECT_EQ(cache.GetSize(), 1000);
+
+    cache.SetMaxSize(100);
+    EXPECT_LE(cache.GetSize(), 100);
+    std::size_t visited = 0;
+    cache.VisitAll([&visited](int key, const std::string& value) {
+        EXPECT_EQ(std::to_string(key), value);
+        ++visited;
+    });
+    EXPECT_EQ(visited, cache.GetSize());
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetSize(), 0);
+    EXPECT_EQ(cache.Get(1), nullptr);
+}
+
+USERVER_NAMESPACE_END
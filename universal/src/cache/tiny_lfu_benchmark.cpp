@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <userver/cache/impl/lru.hpp>
+#include <userver/cache/impl/slru.hpp>
+#include <userver/cache/impl/tiny_lfu.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr unsigned kKeysCount = 100'000;
+constexpr std::size_t kRequestsCount = 500'000;
+
+// Zipf-distributed popular keys, every third request is a part of a scan over
+// the keys that are requested once
+std::vector<unsigned> MakeRequests() {
+    std::vector<double> cdf(kKeysCount);
+    double sum = 0;
+    for (unsigned i = 0; i < kKeysCount; ++i) {
+        sum += 1.0 / std::pow(i + 1, 0.9);
+        cdf[i] = sum;
+    }
+
+    std::minstd_rand rng{42};
+    std::uniform_real_distribution<double> distribution{0, sum};
+    std::vector<unsigned> requests;
+    requests.reserve(kRequestsCount);
+    unsigned scanned = kKeysCount;
+    for (std::size_t i = 0; i < kRequestsCount; ++i) {
+        if (i % 3 == 0) {
+            requests.push_back(scanned++);
+        } else {
+            requests.push_back(std::lower_bound(cdf.begin(), cdf.end(), distribution(rng)) - cdf.begin());
+        }
+    }
+    return requests;
+}
+
+const std::vector<unsigned>& GetRequests() {
+    static const auto kRequests = MakeRequests();
+    return kRequests;
+}
+
+struct LruPolicy {
+    using Cache = cache::impl::LruBase<unsigned, unsigned>;
+    static Cache Make(std::size_t size) { return Cache{size, {}, {}}; }
+};
+
+struct SlruPolicy {
+    using Cache = cache::impl::SlruBase<unsigned, unsigned>;
+    static Cache Make(std::size_t size) { return Cache{size - size * 8 / 10, size * 8 / 10}; }
+};
+
+struct TinyLfuPolicy {
+    using Cache = cache::impl::TinyLfuBase<unsigned, unsigned>;
+    static Cache Make(std::size_t size) { return Cache{size, {}, {}}; }
+};
+
+}  // namespace
+
+// Reports the hit rate of the caches of the same size
+template <typename Policy>
+void CacheHitRate(benchmark::State& state) {
+    const auto& requests = GetRequests();
+    std::size_t hits = 0;
+    std::size_t total = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        auto cache = Policy::Make(state.range(0));
+        for (const auto key : requests) {
+            if (cache.Get(key)) {
+                ++hits;
+            } else {
+                cache.Put(key, key);
+            }
+        }
+        total += requests.size();
+    }
+    state.counters["hit_rate"] = static_cast<double>(hits) / total;
+    state.SetItemsProcessed(total);
+}
+BENCHMARK_TEMPLATE(CacheHitRate, LruPolicy)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK_TEMPLATE(CacheHitRate, SlruPolicy)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK_TEMPLATE(CacheHitRate, TinyLfuPolicy)->RangeMultiplier(10)->Range(100, 10'000);
+
+USERVER_NAMESPACE_END
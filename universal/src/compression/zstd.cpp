@@ -1,17 +1,85 @@
 #include <userver/compression/zstd.hpp>
 
 #include <memory>
+#include <stdexcept>
 
 #include <zstd.h>
 #include <zstd_errors.h>
 
+#include <fmt/format.h>
+
+#include <userver/compression/impl/context_pool.hpp>
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
 
+namespace impl {
+
+class CompressionContext final {
+public:
+    CompressionContext() : context_(ZSTD_createCCtx()) {
+        if (context_ == nullptr) {
+            throw std::runtime_error("Couldn't create ZSTD compression context");
+        }
+    }
+
+    CompressionContext(const CompressionContext&) = delete;
+    CompressionContext& operator=(const CompressionContext&) = delete;
+
+    ~CompressionContext() { ZSTD_freeCCtx(context_); }
+
+    // Drops the state of the previous use
+    ZSTD_CCtx* Reset(int level) {
+        CheckError(ZSTD_CCtx_reset(context_, ZSTD_reset_session_and_parameters));
+        CheckError(ZSTD_CCtx_setParameter(context_, ZSTD_c_compressionLevel, level));
+        return context_;
+    }
+
+    ZSTD_CCtx* Get() noexcept { return context_; }
+
+    static void CheckError(std::size_t ret) {
+        if (ZSTD_isError(ret)) {
+            throw std::runtime_error(fmt::format("Compression failed: {}", ZSTD_getErrorName(ret)));
+        }
+    }
+
+private:
+    ZSTD_CCtx* context_;
+};
+
+}  // namespace impl
+
 namespace {
+
 // The same size as in ZSTD_DStreamOutSize();
 const size_t kDecompressBufferSize = ZSTD_DStreamOutSize();
+
+using ContextPool = compression::impl::ContextPool<impl::CompressionContext>;
+
+// Runs the stream until the whole input is consumed and the `directive` is
+// fulfilled
+std::string CompressStream(impl::CompressionContext& context, std::string_view input, ZSTD_EndDirective directive) {
+    std::string compressed;
+    ZSTD_inBuffer in{input.data(), input.size(), 0};
+    const auto buffer_size = ZSTD_CStreamOutSize();
+
+    while (true) {
+        const auto offset = compressed.size();
+        compressed.resize(offset + buffer_size);
+        ZSTD_outBuffer out{compressed.data() + offset, buffer_size, 0};
+
+        const auto remaining = ZSTD_compressStream2(context.Get(), &out, &in, directive);
+        impl::CompressionContext::CheckError(remaining);
+        compressed.resize(offset + out.pos);
+
+        if (remaining == 0 && in.pos == in.size) break;
+    }
+
+    return compressed;
+}
+
 }  // namespace
 
 std::string DecompressStream(std::string_view compressed, size_t max_size) {
@@ -80,5 +148,53 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
     return decompressed;
 }
 
+namespace {
+
+std::string CompressFrame(std::string_view data, int level, bool checksum) {
+    auto context = ContextPool::Pop();
+    auto* cctx = context->Reset(level);
+    if (checksum) {
+        impl::CompressionContext::CheckError(ZSTD_CCtx_setParameter(cctx, ZSTD_c_checksumFlag, 1));
+    }
+
+    std::string compressed(ZSTD_compressBound(data.size()), '\0');
+    const auto size = ZSTD_compress2(cctx, compressed.data(), compressed.size(), data.data(), data.size());
+    impl::CompressionContext::CheckError(size);
+    compressed.resize(size);
+
+    ContextPool::Push(std::move(context));
+    return compressed;
+}
+
+}  // namespace
+
+std::string Compress(std::string_view data, int level) { return CompressFrame(data, level, false); }
+
+std::string CompressWithChecksum(std::string_view data, int level) { return CompressFrame(data, level, true); }
+
+StreamCompressor::StreamCompressor(int level) : context_(ContextPool::Pop()) { context_->Reset(level); }
+
+StreamCompressor::StreamCompressor(StreamCompressor&&) noexcept = default;
+
+StreamCompressor& StreamCompressor::operator=(StreamCompressor&& other) noexcept {
+    ContextPool::Push(std::move(context_));
+    context_ = std::move(other.context_);
+    return *this;
+}
+
+StreamCompressor::~StreamCompressor() { ContextPool::Push(std::move(context_)); }
+
+std::string StreamCompressor::Compress(std::string_view chunk) {
+    UINVARIANT(context_, "Compress() is called after Finish()");
+    return CompressStream(*context_, chunk, ZSTD_e_flush);
+}
+
+std::string StreamCompressor::Finish() {
+    UINVARIANT(context_, "Finish() is called twice");
+    auto compressed = CompressStream(*context_, {}, ZSTD_e_end);
+    ContextPool::Push(std::move(context_));
+    return compressed;
+}
+
 }  // namespace compression::zstd
 USERVER_NAMESPACE_END
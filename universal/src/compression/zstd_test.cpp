@@ -60,4 +60,43 @@ TEST(Zstd, TestOverflow) {
     );
 }
 
+TEST(Zstd, Compress) {
+    const std::string str(16'000, 'a');
+
+    for (const int level : {1, compression::zstd::kDefaultLevel, 19}) {
+        const auto compressed = compression::zstd::Compress(str, level);
+        EXPECT_LT(compressed.size(), str.size());
+        EXPECT_EQ(compression::zstd::Decompress(compressed, str.size()), str);
+    }
+}
+
+TEST(Zstd, CompressWithChecksum) {
+    const std::string str(16'000, 'a');
+
+    auto compressed = compression::zstd::CompressWithChecksum(str);
+    EXPECT_EQ(compressed.size(), compression::zstd::Compress(str).size() + 4);
+    EXPECT_EQ(compression::zstd::Decompress(compressed, str.size()), str);
+
+    compressed.back() ^= 1;  // the checksum is stored at the end of the frame
+    EXPECT_THROW(compression::zstd::Decompress(compressed, str.size()), compression::DecompressionError);
+}
+
+TEST(Zstd, StreamCompress) {
+    std::string expected;
+    std::string compressed;
+
+    compression::zstd::StreamCompressor compressor;
+    for (int i = 0; i < 100; ++i) {
+        const auto chunk = "chunk #" + std::to_string(i) + '\n';
+        expected += chunk;
+
+        const auto compressed_chunk = compressor.Compress(chunk);
+        EXPECT_FALSE(compressed_chunk.empty()) << "Chunks are expected to be flushed";
+        compressed += compressed_chunk;
+    }
+    compressed += compressor.Finish();
+
+    EXPECT_EQ(compression::zstd::Decompress(compressed, expected.size()), expected);
+}
+
 USERVER_NAMESPACE_END
@@ -1,11 +1,11 @@
 #include <userver/crypto/base64.hpp>
 
-#include <cryptopp/base64.h>
+#include <array>
+#include <cstdint>
+#include <cstring>
 
-#include <userver/crypto/exception.hpp>
-
-#ifdef CRYPTOPP_NO_GLOBAL_BYTE
-using CryptoPP::byte;
+#ifdef __SSSE3__
+#include <tmmintrin.h>
 #endif
 
 USERVER_NAMESPACE_BEGIN
@@ -14,46 +14,238 @@ namespace crypto::base64 {
 
 namespace {
 
-template <typename Base64Encoder>
-std::string Base64Encode(std::string_view data, Pad pad) {
-    std::string response;
-    try {
-        Base64Encoder encoder(new CryptoPP::StringSink(response));
-        CryptoPP::AlgorithmParameters params = CryptoPP::MakeParameters(CryptoPP::Name::Pad(), Pad::kWith == pad)(
-            CryptoPP::Name::InsertLineBreaks(), false
-        );
-        encoder.IsolatedInitialize(params);
-        encoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()), data.size());
-    } catch (const CryptoPP::Exception& exc) {
-        throw crypto::CryptoException(exc.what());
+constexpr std::uint8_t kInvalid = 0xff;
+constexpr char kPadChar = '=';
+
+struct Alphabet final {
+    constexpr explicit Alphabet(char c62, char c63) : char62(c62), char63(c63) {
+        for (std::size_t i = 0; i < 26; ++i) {
+            encode[i] = static_cast<char>('A' + i);
+            encode[i + 26] = static_cast<char>('a' + i);
+        }
+        for (std::size_t i = 0; i < 10; ++i) encode[i + 52] = static_cast<char>('0' + i);
+        encode[62] = c62;
+        encode[63] = c63;
+
+        for (auto& value : decode) value = kInvalid;
+        for (std::size_t i = 0; i < encode.size(); ++i) {
+            decode[static_cast<unsigned char>(encode[i])] = static_cast<std::uint8_t>(i);
+        }
     }
-    return response;
+
+    char char62;
+    char char63;
+    std::array<char, 64> encode{};
+    std::array<std::uint8_t, 256> decode{};
+};
+
+constexpr Alphabet kStandard{'+', '/'};
+constexpr Alphabet kUrl{'-', '_'};
+
+#ifdef __SSSE3__
+// Encodes 12 bytes from the 16 loaded at `src` into 16 characters, see
+// W. Mula, D. Lemire "Faster Base64 Encoding and Decoding using AVX2 Instructions"
+template <const Alphabet& alphabet>
+void EncodeBlock(const char* src, char* dst) {
+    auto in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    // Every 3 bytes into 4 bytes of a 32-bit lane: b1, b0, b2, b1
+    in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+    // Move every 6 bits of a lane into a separate byte
+    const auto t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const auto t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const auto t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const auto t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const auto indices = _mm_or_si128(t1, t3);
+
+    // Index ranges [0, 26), [26, 52), [52, 62), 62, 63 are mapped to the
+    // distinct shift table positions 13, 0, [1, 11), 11, 12
+    auto reduced = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const auto is_upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    reduced = _mm_or_si128(reduced, _mm_and_si128(is_upper, _mm_set1_epi8(13)));
+
+    const auto shifts = _mm_setr_epi8(
+        'a' - 26,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        static_cast<char>(alphabet.char62 - 62),
+        static_cast<char>(alphabet.char63 - 63),
+        'A',
+        0,
+        0
+    );
+    const auto result = _mm_add_epi8(_mm_shuffle_epi8(shifts, reduced), indices);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), result);
 }
 
-template <typename Base64Decoder>
-std::string Base64Decode(std::string_view data) {
-    std::string response;
-    try {
-        Base64Decoder decoder(new CryptoPP::StringSink(response));
-        decoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()), data.size());
-    } catch (const CryptoPP::Exception& exc) {
-        throw crypto::CryptoException(exc.what());
+__m128i InRange(__m128i chars, char first, char last) {
+    return _mm_and_si128(
+        _mm_cmpgt_epi8(chars, _mm_set1_epi8(static_cast<char>(first - 1))),
+        _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(last + 1)), chars)
+    );
+}
+
+// Decodes 16 characters into 12 bytes, returns false without writing anything
+// if some of the characters are outside of the alphabet
+template <const Alphabet& alphabet>
+bool DecodeBlock(const char* src, char* dst) {
+    const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+    // Bytes >= 0x80 are negative and fail all the range checks
+    const auto is_upper = InRange(chars, 'A', 'Z');
+    const auto is_lower = InRange(chars, 'a', 'z');
+    const auto is_digit = InRange(chars, '0', '9');
+    const auto is_62 = _mm_cmpeq_epi8(chars, _mm_set1_epi8(alphabet.char62));
+    const auto is_63 = _mm_cmpeq_epi8(chars, _mm_set1_epi8(alphabet.char63));
+
+    const auto is_valid =
+        _mm_or_si128(_mm_or_si128(is_upper, is_lower), _mm_or_si128(is_digit, _mm_or_si128(is_62, is_63)));
+    if (_mm_movemask_epi8(is_valid) != 0xffff) return false;
+
+    const auto shifts = _mm_or_si128(
+        _mm_or_si128(
+            _mm_and_si128(is_upper, _mm_set1_epi8(-'A')),
+            _mm_and_si128(is_lower, _mm_set1_epi8(static_cast<char>(26 - 'a')))
+        ),
+        _mm_or_si128(
+            _mm_and_si128(is_digit, _mm_set1_epi8(52 - '0')),
+            _mm_or_si128(
+                _mm_and_si128(is_62, _mm_set1_epi8(static_cast<char>(62 - alphabet.char62))),
+                _mm_and_si128(is_63, _mm_set1_epi8(static_cast<char>(63 - alphabet.char63)))
+            )
+        )
+    );
+    const auto values = _mm_add_epi8(chars, shifts);
+
+    // Pack every four 6-bit values into 3 bytes of a 32-bit lane
+    const auto pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    const auto lanes = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    const auto packed =
+        _mm_shuffle_epi8(lanes, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+    alignas(16) std::array<char, 16> block;  // NOLINT(cppcoreguidelines-pro-type-member-init): performance
+    _mm_store_si128(reinterpret_cast<__m128i*>(block.data()), packed);
+    std::memcpy(dst, block.data(), 12);
+    return true;
+}
+#endif
+
+// The alphabet is a template parameter for the SIMD constants to be folded
+template <const Alphabet& alphabet>
+void Encode(std::string_view data, std::string& out, Pad pad) {
+    out.clear();
+    out.resize(Base64EncodedLength(data.size(), pad));
+    const auto* first = reinterpret_cast<const unsigned char*>(data.data());
+    const auto* last = first + data.size();
+    auto* dst = out.data();
+
+#ifdef __SSSE3__
+    // 16 bytes are loaded for every 12 encoded
+    while (last - first >= 16) {
+        EncodeBlock<alphabet>(reinterpret_cast<const char*>(first), dst);
+        first += 12;
+        dst += 16;
     }
-    return response;
+#endif
+
+    while (last - first >= 3) {
+        const std::uint32_t triple = (first[0] << 16) | (first[1] << 8) | first[2];
+        dst[0] = alphabet.encode[triple >> 18];
+        dst[1] = alphabet.encode[(triple >> 12) & 0x3f];
+        dst[2] = alphabet.encode[(triple >> 6) & 0x3f];
+        dst[3] = alphabet.encode[triple & 0x3f];
+        first += 3;
+        dst += 4;
+    }
+
+    if (first != last) {
+        const bool has_two = last - first == 2;
+        const std::uint32_t triple = (first[0] << 16) | (has_two ? first[1] << 8 : 0);
+        *(dst++) = alphabet.encode[triple >> 18];
+        *(dst++) = alphabet.encode[(triple >> 12) & 0x3f];
+        if (has_two) *(dst++) = alphabet.encode[(triple >> 6) & 0x3f];
+        if (pad == Pad::kWith) {
+            *(dst++) = kPadChar;
+            if (!has_two) *(dst++) = kPadChar;
+        }
+    }
+}
+
+template <const Alphabet& alphabet>
+void Decode(std::string_view data, std::string& out) {
+    out.clear();
+    out.resize(Base64DecodedUpperBound(data.size()));
+    const auto* first = data.data();
+    const auto* last = first + data.size();
+    auto* dst = out.data();
+
+#ifdef __SSSE3__
+    while (last - first >= 16 && DecodeBlock<alphabet>(first, dst)) {
+        first += 16;
+        dst += 12;
+    }
+#endif
+
+    // Blocks above decode whole bytes, the bit accumulator starts empty
+    std::uint32_t bits = 0;
+    int bits_count = 0;
+    for (; first != last; ++first) {
+        const auto value = alphabet.decode[static_cast<unsigned char>(*first)];
+        if (value == kInvalid) continue;
+
+        bits = (bits << 6) | value;
+        bits_count += 6;
+        if (bits_count >= 8) {
+            bits_count -= 8;
+            *(dst++) = static_cast<char>(bits >> bits_count);
+        }
+    }
+
+    out.resize(dst - out.data());
 }
 
 }  // namespace
 
-std::string Base64Encode(std::string_view data, Pad pad) { return Base64Encode<CryptoPP::Base64Encoder>(data, pad); }
+std::string Base64Encode(std::string_view data, Pad pad) {
+    std::string result;
+    Encode<kStandard>(data, result, pad);
+    return result;
+}
 
-std::string Base64Decode(std::string_view data) { return Base64Decode<CryptoPP::Base64Decoder>(data); }
+void Base64Encode(std::string_view data, std::string& out, Pad pad) { Encode<kStandard>(data, out, pad); }
+
+std::string Base64Decode(std::string_view data) {
+    std::string result;
+    Decode<kStandard>(data, result);
+    return result;
+}
+
+void Base64Decode(std::string_view data, std::string& out) { Decode<kStandard>(data, out); }
 
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 std::string Base64UrlEncode(std::string_view data, Pad pad) {
-    return Base64Encode<CryptoPP::Base64URLEncoder>(data, pad);
+    std::string result;
+    Encode<kUrl>(data, result, pad);
+    return result;
+}
+
+void Base64UrlEncode(std::string_view data, std::string& out, Pad pad) { Encode<kUrl>(data, out, pad); }
+
+std::string Base64UrlDecode(std::string_view data) {
+    std::string result;
+    Decode<kUrl>(data, result);
+    return result;
 }
 
-std::string Base64UrlDecode(std::string_view data) { return Base64Decode<CryptoPP::Base64URLDecoder>(data); }
+void Base64UrlDecode(std::string_view data, std::string& out) { Decode<kUrl>(data, out); }
 #endif
 
 }  // namespace crypto::base64
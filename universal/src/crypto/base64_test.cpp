@@ -2,6 +2,8 @@
 
 #include <userver/crypto/base64.hpp>
 
+#include <string>
+
 USERVER_NAMESPACE_BEGIN
 
 TEST(Crypto, Base64) {
@@ -15,12 +17,60 @@ TEST(Crypto, Base64) {
     EXPECT_EQ("U/8=", crypto::base64::Base64Encode("S\xff"));
 }
 
+TEST(Crypto, Base64Lengths) {
+    using crypto::base64::Pad;
+    for (std::size_t size = 0; size < 100; ++size) {
+        const std::string data(size, '\xa5');
+        const auto encoded = crypto::base64::Base64Encode(data);
+        EXPECT_EQ(encoded.size(), crypto::base64::Base64EncodedLength(size));
+        EXPECT_EQ(
+            crypto::base64::Base64Encode(data, Pad::kWithout).size(),
+            crypto::base64::Base64EncodedLength(size, Pad::kWithout)
+        );
+        EXPECT_GE(crypto::base64::Base64DecodedUpperBound(encoded.size()), size);
+        EXPECT_EQ(crypto::base64::Base64Decode(encoded), data);
+    }
+}
+
+TEST(Crypto, Base64Long) {
+    std::string data;
+    for (int i = 0; i < 1000; ++i) data.push_back(static_cast<char>(i * 37 + i / 7));
+
+    std::string encoded;
+    std::string decoded;
+    for (std::size_t size = 0; size <= data.size(); size += 37) {
+        const std::string_view part{data.data(), size};
+        crypto::base64::Base64Encode(part, encoded);
+        crypto::base64::Base64Decode(encoded, decoded);
+        EXPECT_EQ(decoded, part);
+    }
+
+    // Characters outside of the alphabet are skipped anywhere in the input
+    crypto::base64::Base64Encode(data, encoded, crypto::base64::Pad::kWithout);
+    std::string with_junk;
+    for (std::size_t i = 0; i < encoded.size(); ++i) {
+        if (i % 13 == 0) with_junk += (i % 2 ? "\n" : "=\x80");
+        with_junk += encoded[i];
+    }
+    EXPECT_EQ(crypto::base64::Base64Decode(with_junk), data);
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 TEST(Crypto, Base64Url) {
     EXPECT_EQ("U_8=", crypto::base64::Base64UrlEncode("S\xff"));
     EXPECT_EQ("U_8", crypto::base64::Base64UrlEncode("S\xff", crypto::base64::Pad::kWithout));
     EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U_8"));
     EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U_8="));
+
+    // Characters of the standard alphabet are not a part of the URL one
+    EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U+/_8"));
+
+    std::string data;
+    for (int i = 0; i < 300; ++i) data.push_back(static_cast<char>(i));
+    std::string encoded;
+    crypto::base64::Base64UrlEncode(data, encoded, crypto::base64::Pad::kWithout);
+    EXPECT_EQ(encoded.find_first_of("+/="), std::string::npos);
+    EXPECT_EQ(crypto::base64::Base64UrlDecode(encoded), data);
 }
 #endif
 
@@ -53,27 +53,18 @@ std::string EncodeArray(const byte* ptr, size_t length, crypto::hash::OutputEnco
     return response;
 }
 
-std::string EncodeString(std::string_view data, crypto::hash::OutputEncoding encoding) {
-    return EncodeArray(reinterpret_cast<const byte*>(data.data()), data.size(), encoding);
-}
-
 template <typename HashAlgorithm>
 std::string CalculateHmac(std::string_view key, std::string_view data, crypto::hash::OutputEncoding encoding) {
-    std::string mac;
-
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init): performance
+    std::array<byte, HashAlgorithm::DIGESTSIZE> mac;
     try {
         CryptoPP::HMAC<HashAlgorithm> hmac(reinterpret_cast<const byte*>(key.data()), key.size());
-        CryptoPP::StringSource ss_key(
-            reinterpret_cast<const byte*>(data.data()),
-            data.size(),
-            true,
-            new CryptoPP::HashFilter(hmac, new CryptoPP::StringSink(mac))
-        );
+        hmac.CalculateDigest(mac.data(), reinterpret_cast<const byte*>(data.data()), data.size());
     } catch (const CryptoPP::Exception& exc) {
         throw crypto::CryptoException(exc.what());
     }
 
-    return EncodeString(mac, encoding);
+    return EncodeArray(mac.data(), mac.size(), encoding);
 }
 
 template <typename HashAlgorithm>
@@ -0,0 +1,93 @@
+#include <crypto/hmac_sha_key.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <cryptopp/misc.h>
+#include <cryptopp/sha.h>
+
+#include <userver/crypto/exception.hpp>
+#include <userver/utils/assert.hpp>
+
+#ifdef CRYPTOPP_NO_GLOBAL_BYTE
+using CryptoPP::byte;
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace crypto::impl {
+namespace {
+
+constexpr byte kInnerPad = 0x36;
+constexpr byte kOuterPad = 0x5c;
+
+const byte* AsBytes(std::string_view data) { return reinterpret_cast<const byte*>(data.data()); }
+
+template <typename HashAlgorithm>
+class HmacShaKeyImpl final : public HmacShaKey {
+public:
+    explicit HmacShaKeyImpl(std::string_view secret) {
+        std::array<byte, HashAlgorithm::BLOCKSIZE> block{};
+        try {
+            if (secret.size() > block.size()) {
+                HashAlgorithm().CalculateDigest(block.data(), AsBytes(secret), secret.size());
+            } else {
+                std::copy(secret.begin(), secret.end(), reinterpret_cast<char*>(block.data()));
+            }
+
+            for (auto& b : block) b ^= kInnerPad;
+            inner_.Update(block.data(), block.size());
+            for (auto& b : block) b ^= kInnerPad ^ kOuterPad;
+            outer_.Update(block.data(), block.size());
+        } catch (const CryptoPP::Exception& exc) {
+            CryptoPP::SecureWipeArray(block.data(), block.size());
+            throw CryptoException(exc.what());
+        }
+        CryptoPP::SecureWipeArray(block.data(), block.size());
+    }
+
+    std::string Calculate(std::initializer_list<std::string_view> data) const override {
+        std::string mac(HashAlgorithm::DIGESTSIZE, '\0');
+        auto* mac_bytes = reinterpret_cast<byte*>(mac.data());
+        try {
+            // Hash states are fixed-size, copying them does not allocate
+            HashAlgorithm inner{inner_};
+            for (const auto& part : data) inner.Update(AsBytes(part), part.size());
+            inner.Final(mac_bytes);
+
+            HashAlgorithm outer{outer_};
+            outer.Update(mac_bytes, mac.size());
+            outer.Final(mac_bytes);
+        } catch (const CryptoPP::Exception& exc) {
+            throw CryptoException(exc.what());
+        }
+        return mac;
+    }
+
+private:
+    HashAlgorithm inner_;
+    HashAlgorithm outer_;
+};
+
+}  // namespace
+
+HmacShaKey::~HmacShaKey() = default;
+
+std::shared_ptr<const HmacShaKey> MakeHmacShaKey(DigestSize bits, std::string_view secret) {
+    switch (bits) {
+        case DigestSize::k160:
+            return std::make_shared<HmacShaKeyImpl<CryptoPP::SHA1>>(secret);
+        case DigestSize::k256:
+            return std::make_shared<HmacShaKeyImpl<CryptoPP::SHA256>>(secret);
+        case DigestSize::k384:
+            return std::make_shared<HmacShaKeyImpl<CryptoPP::SHA384>>(secret);
+        case DigestSize::k512:
+            return std::make_shared<HmacShaKeyImpl<CryptoPP::SHA512>>(secret);
+    }
+
+    UINVARIANT(false, "Unexpected DigestSize");
+}
+
+}  // namespace crypto::impl
+
+USERVER_NAMESPACE_END
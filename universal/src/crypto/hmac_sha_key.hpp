@@ -0,0 +1,31 @@
+#pragma once
+
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/crypto/basic_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace crypto::impl {
+
+/// HMAC key with the padded key blocks already hashed, RFC 2104.
+///
+/// The inner and outer hash states are computed once, every calculation copies
+/// them and hashes only the message, which saves two compression function
+/// calls and all the allocations of the one-shot hash::HmacSha* functions.
+class HmacShaKey {
+public:
+    virtual ~HmacShaKey();
+
+    /// Returns the binary HMAC of the concatenation of `data` parts
+    virtual std::string Calculate(std::initializer_list<std::string_view> data) const = 0;
+};
+
+std::shared_ptr<const HmacShaKey> MakeHmacShaKey(DigestSize bits, std::string_view secret);
+
+}  // namespace crypto::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <userver/crypto/hash.hpp>
+#include <userver/crypto/signers.hpp>
+#include <userver/crypto/verifiers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kSecret = "some-shared-secret-of-a-service";
+
+// Typical sizes of the JWT header and payload in base64url
+const std::string kHeader(36, 'h');
+const std::string kPayload(180, 'p');
+
+}  // namespace
+
+void hash_hmac_sha256(benchmark::State& state) {
+    const std::string message = kHeader + "." + kPayload;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(crypto::hash::HmacSha256(kSecret, message, crypto::hash::OutputEncoding::kBinary));
+    }
+}
+BENCHMARK(hash_hmac_sha256);
+
+void hash_sha256(benchmark::State& state) {
+    const std::string message(state.range(0), 'a');
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(crypto::hash::Sha256(message, crypto::hash::OutputEncoding::kBinary));
+    }
+}
+BENCHMARK(hash_sha256)->RangeMultiplier(8)->Range(8, 32 * 1024);
+
+void signer_hs256(benchmark::State& state) {
+    const crypto::SignerHs256 signer{std::string{kSecret}};
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(signer.Sign({kHeader, ".", kPayload}));
+    }
+}
+BENCHMARK(signer_hs256);
+
+void verifier_hs256(benchmark::State& state) {
+    const auto signature = crypto::SignerHs256{std::string{kSecret}}.Sign({kHeader, ".", kPayload});
+    const crypto::VerifierHs256 verifier{std::string{kSecret}};
+    for ([[maybe_unused]] auto _ : state) {
+        verifier.Verify({kHeader, ".", kPayload}, signature);
+    }
+}
+BENCHMARK(verifier_hs256);
+
+void signer_hs512_long_key(benchmark::State& state) {
+    const crypto::SignerHs512 signer{std::string(200, 'k')};
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(signer.Sign({kHeader, ".", kPayload}));
+    }
+}
+BENCHMARK(signer_hs512_long_key);
+
+USERVER_NAMESPACE_END
@@ -257,6 +257,45 @@ TEST(Crypto, SignatureHs256) {
     EXPECT_THROW(verifier.Verify({"test"}, bad_sig), crypto::VerificationError);
 }
 
+TEST(Crypto, SignatureHsMultipart) {
+    crypto::SignerHs256 signer("secret");
+    const auto sig = signer.Sign({"header", ".", "payload"});
+    EXPECT_EQ(sig, signer.Sign({"header.payload"}));
+    EXPECT_EQ("67a8bd4ba640d9a21689ff6c1137aa013f3a351612894bc1cf6c333c8eda3f4b", utils::encoding::ToHex(sig));
+
+    // Copies share the precomputed key
+    const auto signer_copy = signer;
+    EXPECT_EQ(sig, signer_copy.Sign({"header.", "", "payload"}));
+
+    crypto::VerifierHs256 verifier("secret");
+    EXPECT_NO_THROW(verifier.Verify({"header.", "payload"}, sig));
+    EXPECT_THROW(verifier.Verify({"header", "payload"}, sig), crypto::VerificationError);
+    EXPECT_THROW(verifier.Verify({"header.payload"}, sig.substr(1)), crypto::VerificationError);
+
+    EXPECT_EQ(
+        "4e54a97be947e471e89cdd22c25b8ff704f458fdfcebd8a79a366ff0e52b607fe3f1e52bd1a839f89396d1a4b2cbe570",
+        utils::encoding::ToHex(crypto::SignerHs384("secret").Sign({"te", "st"}))
+    );
+}
+
+TEST(Crypto, SignatureHsLongKey) {
+    // Keys longer than the hash block size are hashed first
+    const std::string secret(200, 'k');
+    EXPECT_EQ(
+        "051efe5097868224da86cf064aa37f650d01ed25e42a2527ea7db099c5a629c3",
+        utils::encoding::ToHex(crypto::SignerHs256(secret).Sign({"test"}))
+    );
+    EXPECT_EQ(
+        "5bf723c3440fbd1b812faa7d6949eb30c90e6228d31da2f54f40cb9efcfe4bde"
+        "808046a05ef62a1d338d66907ee4cac51a68a0e1dde3fb62344b29fc98b3f9b1",
+        utils::encoding::ToHex(crypto::SignerHs512(secret).Sign({"test"}))
+    );
+    EXPECT_EQ(
+        crypto::hash::HmacSha256(secret, "test", crypto::hash::OutputEncoding::kBinary),
+        crypto::SignerHs256(secret).Sign({"test"})
+    );
+}
+
 TEST(Crypto, SignatureCMSSignVerify) {
     using Signer = crypto::CmsSigner;
     using SFlags = Signer::Flags;
@@ -12,6 +12,7 @@
 #include <userver/utils/assert.hpp>
 
 #include <crypto/helpers.hpp>
+#include <crypto/hmac_sha_key.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -114,27 +115,16 @@ std::string SignerNone::Sign(std::initializer_list<std::string_view> /*data*/) c
 
 template <DigestSize bits>
 HmacShaSigner<bits>::HmacShaSigner(std::string secret)
-    : Signer("HS" + EnumValueToString(bits)), secret_(std::move(secret)) {}
+    : Signer("HS" + EnumValueToString(bits)), key_(impl::MakeHmacShaKey(bits, secret)) {
+    OPENSSL_cleanse(secret.data(), secret.size());
+}
 
 template <DigestSize bits>
-HmacShaSigner<bits>::~HmacShaSigner() {
-    OPENSSL_cleanse(secret_.data(), secret_.size());
-}
+HmacShaSigner<bits>::~HmacShaSigner() = default;
 
 template <DigestSize bits>
 std::string HmacShaSigner<bits>::Sign(std::initializer_list<std::string_view> data) const {
-    const auto hmac = GetHmacFuncByEnum(bits);
-
-    if (data.size() <= 1) {
-        std::string_view single_value{};
-        if (data.size()) {
-            single_value = *data.begin();
-        }
-
-        return hmac(secret_, single_value, crypto::hash::OutputEncoding::kBinary);
-    }
-
-    return hmac(secret_, InitListToString(data), crypto::hash::OutputEncoding::kBinary);
+    return key_->Calculate(data);
 }
 
 template class HmacShaSigner<DigestSize::k160>;
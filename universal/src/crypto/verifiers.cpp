@@ -14,6 +14,7 @@
 #include <userver/utils/assert.hpp>
 
 #include <crypto/helpers.hpp>
+#include <crypto/hmac_sha_key.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -109,29 +110,20 @@ void VerifierNone::Verify(std::initializer_list<std::string_view> /*data*/, std:
 
 template <DigestSize bits>
 HmacShaVerifier<bits>::HmacShaVerifier(std::string secret)
-    : Verifier("HS" + EnumValueToString(bits)), secret_(std::move(secret)) {}
+    : Verifier("HS" + EnumValueToString(bits)), key_(impl::MakeHmacShaKey(bits, secret)) {
+    OPENSSL_cleanse(secret.data(), secret.size());
+}
 
 template <DigestSize bits>
-HmacShaVerifier<bits>::~HmacShaVerifier() {
-    OPENSSL_cleanse(secret_.data(), secret_.size());
-}
+HmacShaVerifier<bits>::~HmacShaVerifier() = default;
 
 template <DigestSize bits>
 void HmacShaVerifier<bits>::Verify(std::initializer_list<std::string_view> data, std::string_view raw_signature) const {
-    const auto hmac = GetHmacFuncByEnum(bits);
-    std::string signature;
-    if (data.size() <= 1) {
-        std::string_view single_value{};
-        if (data.size() == 1) {
-            single_value = *data.begin();
-        }
-
-        signature = hmac(secret_, single_value, crypto::hash::OutputEncoding::kBinary);
-    } else {
-        signature = hmac(secret_, InitListToString(data), crypto::hash::OutputEncoding::kBinary);
-    }
+    const auto signature = key_->Calculate(data);
 
-    if (raw_signature != signature) {
+    // Constant-time comparison, so that the time does not leak the matching prefix length
+    if (raw_signature.size() != signature.size() ||
+        CRYPTO_memcmp(raw_signature.data(), signature.data(), signature.size()) != 0) {
         throw VerificationError("Invalid signature");
     }
 }
@@ -0,0 +1,135 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/decimal64/decimal64.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Money = decimal64::Decimal<4>;
+
+std::vector<Money> MakeValues(std::size_t size) {
+    std::vector<Money> values;
+    values.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        values.push_back(Money::FromUnbiased(static_cast<std::int64_t>(i * 1'234'567 % 100'000'000) - 50'000'000));
+    }
+    return values;
+}
+
+std::vector<std::string> MakeStrings(std::size_t size) {
+    std::vector<std::string> strings;
+    for (const auto value : MakeValues(size)) {
+        strings.push_back(decimal64::ToString(value));
+    }
+    return strings;
+}
+
+constexpr std::size_t kStringsCount = 1024;
+
+}  // namespace
+
+void DecimalSumOperatorPlus(benchmark::State& state) {
+    const auto values = MakeValues(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        Money sum{0};
+        for (const auto value : values) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(DecimalSumOperatorPlus)->RangeMultiplier(8)->Range(8, 32768);
+
+void DecimalSum(benchmark::State& state) {
+    const auto values = MakeValues(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(decimal64::Sum(values));
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(DecimalSum)->RangeMultiplier(8)->Range(8, 32768);
+
+void DecimalSumOfProductsOperators(benchmark::State& state) {
+    const auto prices = MakeValues(state.range(0));
+    const std::vector<Money> quantities(prices.size(), Money{"1.5"});
+    for ([[maybe_unused]] auto _ : state) {
+        Money sum{0};
+        for (std::size_t i = 0; i < prices.size(); ++i) {
+            sum += prices[i] * quantities[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * prices.size());
+}
+BENCHMARK(DecimalSumOfProductsOperators)->RangeMultiplier(8)->Range(8, 32768);
+
+void DecimalSumOfProducts(benchmark::State& state) {
+    const auto prices = MakeValues(state.range(0));
+    const std::vector<Money> quantities(prices.size(), Money{"1.5"});
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(decimal64::SumOfProducts(prices, quantities));
+    }
+    state.SetItemsProcessed(state.iterations() * prices.size());
+}
+BENCHMARK(DecimalSumOfProducts)->RangeMultiplier(8)->Range(8, 32768);
+
+void DecimalFromString(benchmark::State& state) {
+    const auto strings = MakeStrings(kStringsCount);
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(Money{strings[i++ % kStringsCount]});
+    }
+}
+BENCHMARK(DecimalFromString);
+
+void DecimalToString(benchmark::State& state) {
+    const auto values = MakeValues(kStringsCount);
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(decimal64::ToString(values[i++ % kStringsCount]));
+    }
+}
+BENCHMARK(DecimalToString);
+
+void DecimalToChars(benchmark::State& state) {
+    const auto values = MakeValues(kStringsCount);
+    char buffer[32];
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(decimal64::ToChars(buffer, buffer + sizeof(buffer), values[i++ % kStringsCount]));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(DecimalToChars);
+
+void DecimalFmtFormat(benchmark::State& state) {
+    const auto values = MakeValues(kStringsCount);
+    fmt::memory_buffer buffer;
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        buffer.clear();
+        fmt::format_to(std::back_inserter(buffer), "{}", values[i++ % kStringsCount]);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+}
+BENCHMARK(DecimalFmtFormat);
+
+void DecimalToStringTrailingZeros(benchmark::State& state) {
+    const auto values = MakeValues(kStringsCount);
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(decimal64::ToStringTrailingZeros(values[i++ % kStringsCount]));
+    }
+}
+BENCHMARK(DecimalToStringTrailingZeros);
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,9 @@
 #include <userver/decimal64/decimal64.hpp>
 
+#include <limits>
 #include <sstream>
+#include <string_view>
+#include <system_error>
 
 #include <gtest/gtest.h>
 
@@ -35,6 +38,31 @@ TEST(Decimal64, ToString) {
     EXPECT_EQ(decimal64::ToString(decimal64::Decimal<0>{"1"}), "1");
 }
 
+TEST(Decimal64, ToStringLimits) {
+    constexpr auto kMax = std::numeric_limits<int64_t>::max();
+    constexpr auto kMin = std::numeric_limits<int64_t>::min();
+    EXPECT_EQ(decimal64::ToString(Dec4::FromUnbiased(kMax)), "922337203685477.5807");
+    EXPECT_EQ(decimal64::ToString(Dec4::FromUnbiased(kMin)), "-922337203685477.5808");
+    EXPECT_EQ(decimal64::ToString(decimal64::Decimal<0>::FromUnbiased(kMin)), "-9223372036854775808");
+    EXPECT_EQ(decimal64::ToString(decimal64::Decimal<18>::FromUnbiased(kMin)), "-9.223372036854775808");
+    EXPECT_EQ(decimal64::ToString(decimal64::Decimal<18>::FromUnbiased(-1)), "-0.000000000000000001");
+    EXPECT_EQ(decimal64::ToString(decimal64::Decimal<18>::FromUnbiased(10)), "0.00000000000000001");
+    EXPECT_EQ(fmt::to_string(Dec4::FromUnbiased(kMin)), "-922337203685477.5808");
+    EXPECT_EQ(decimal64::ToStringTrailingZeros(decimal64::Decimal<18>::FromUnbiased(-10)), "-0.000000000000000010");
+    EXPECT_EQ(fmt::format("{:f}", Dec4::FromUnbiased(kMin + 1)), "-922337203685477.5807");
+}
+
+TEST(Decimal64, ToChars) {
+    char buffer[8];
+    const auto [ptr, ec] = decimal64::ToChars(buffer, buffer + sizeof(buffer), Dec4{"-12.3400"});
+    EXPECT_EQ(ec, std::errc{});
+    EXPECT_EQ(std::string_view(buffer, ptr - buffer), "-12.34");
+
+    const auto too_long = decimal64::ToChars(buffer, buffer + sizeof(buffer), Dec4{"-1234.5678"});
+    EXPECT_EQ(too_long.ec, std::errc::value_too_large);
+    EXPECT_EQ(too_long.ptr, buffer + sizeof(buffer));
+}
+
 TEST(Decimal64, ToStringFormatOptions) {
     // clang-format off
   Dec4 dec4{"1034.1234"};
@@ -2,10 +2,12 @@
 
 #include <limits>
 #include <unordered_map>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include <userver/utest/assert_macros.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -211,6 +213,44 @@ TEST(Decimal64, Overflow) {
     EXPECT_THROW(Dec4{std::numeric_limits<uint64_t>::max()}, decimal64::OutOfBoundsError);
 }
 
+TEST(Decimal64, Sum) {
+    EXPECT_EQ(decimal64::Sum(std::vector<Dec4>{}), Dec4{0});
+    EXPECT_EQ(decimal64::Sum(std::vector<Dec4>{Dec4{"1.5"}}), Dec4{"1.5"});
+
+    std::vector<Dec4> values;
+    Dec4 expected{0};
+    for (int i = 0; i < 1001; ++i) {
+        values.push_back(Dec4::FromUnbiased((i % 7 - 3) * 123'456'789'012LL + i));
+        expected += values.back();
+    }
+    EXPECT_EQ(decimal64::Sum(values), expected);
+    EXPECT_EQ(decimal64::Sum(utils::span<const Dec4>{values}.first(3)), values[0] + values[1] + values[2]);
+
+    // Only the result is checked for overflow
+    constexpr auto kMax = Dec4::FromUnbiased(std::numeric_limits<int64_t>::max());
+    constexpr auto kMin = Dec4::FromUnbiased(std::numeric_limits<int64_t>::min());
+    EXPECT_EQ(decimal64::Sum(std::vector<Dec4>{kMax, kMax, kMin, kMin, kMax}), kMax - Dec4{2} / 10000);
+    EXPECT_EQ(decimal64::Sum(std::vector<Dec4>{kMin, kMin, kMax, kMax, kMin, Dec4{1}}), kMin + Dec4{"0.9998"});
+    EXPECT_THROW(decimal64::Sum(std::vector<Dec4>{kMax, Dec4{"0.0001"}}), decimal64::OutOfBoundsError);
+    EXPECT_THROW(decimal64::Sum(std::vector<Dec4>(5, kMin)), decimal64::OutOfBoundsError);
+}
+
+TEST(Decimal64, SumOfProducts) {
+    const std::vector<Dec4> prices{Dec4{"10.25"}, Dec4{"0.3333"}, Dec4{"-2"}};
+    const std::vector<Dec2> quantities{Dec2{"1.5"}, Dec2{3}, Dec2{"0.01"}};
+    EXPECT_EQ(decimal64::SumOfProducts(prices, quantities), Dec4{"16.3549"});
+
+    // The result is rounded once
+    const std::vector<Dec2> halves(3, Dec2{"0.05"});
+    const std::vector<Dec2> tenths(3, Dec2{"0.1"});
+    EXPECT_EQ(decimal64::SumOfProducts(halves, tenths), Dec2{"0.02"});
+    EXPECT_EQ(halves[0] * tenths[0] + halves[1] * tenths[1] + halves[2] * tenths[2], Dec2{"0.03"});
+
+    EXPECT_EQ(decimal64::SumOfProducts(std::vector<Dec4>{}, std::vector<Dec4>{}), Dec4{0});
+    const std::vector<Dec4> big(2, Dec4{"1000000000"});
+    EXPECT_THROW(decimal64::SumOfProducts(big, big), decimal64::OutOfBoundsError);
+}
+
 TEST(Decimal64, DivisionByZero) {
     EXPECT_THROW(Dec4{1} / Dec4{0}, decimal64::DivisionByZeroError);
     EXPECT_THROW(Dec4{1} / Dec4::FromStringPermissive("0.00001"), decimal64::DivisionByZeroError);
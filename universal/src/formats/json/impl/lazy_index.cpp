@@ -0,0 +1,205 @@
+#include <formats/json/impl/lazy_index.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <fmt/format.h>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+namespace {
+
+enum class State {
+    kValue,
+    kFirstItemOrClose,
+    kKey,
+    kFirstKeyOrClose,
+    kColon,
+    kAfterValue,
+};
+
+enum CharClass : std::uint8_t {
+    kOther,
+    kWhitespace,
+    // Chars of numbers and of the true, false and null literals
+    kScalar,
+};
+
+constexpr std::array<CharClass, 256> MakeCharClasses() noexcept {
+    std::array<CharClass, 256> classes{};
+    for (const char c : {' ', '\n', '\r', '\t'}) classes[static_cast<unsigned char>(c)] = kWhitespace;
+    for (char c = '0'; c <= '9'; ++c) classes[static_cast<unsigned char>(c)] = kScalar;
+    for (char c = 'a'; c <= 'z'; ++c) classes[static_cast<unsigned char>(c)] = kScalar;
+    for (const char c : {'-', '+', '.', 'E'}) classes[static_cast<unsigned char>(c)] = kScalar;
+    return classes;
+}
+
+constexpr auto kCharClasses = MakeCharClasses();
+
+CharClass GetCharClass(char c) noexcept { return kCharClasses[static_cast<unsigned char>(c)]; }
+
+bool IsSpecialInString(char c) noexcept { return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20; }
+
+// Returns the offset of the first quote, backslash or control char at or after
+// `pos`, or `size` if there are none. Most of the bytes of a typical document
+// are inside strings, so they are scanned 16 bytes at a time where possible.
+std::size_t FindSpecialInString(const char* data, std::size_t pos, std::size_t size) noexcept {
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i max_control = _mm_set1_epi8(0x1f);
+    for (; pos + 16 <= size; pos += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        // unsigned `c <= 0x1f` is `min(c, 0x1f) == c`
+        const __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(chunk, max_control), chunk);
+        const __m128i special = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)), control
+        );
+        const int mask = _mm_movemask_epi8(special);
+        if (mask != 0) return pos + __builtin_ctz(mask);
+    }
+#endif
+    for (; pos < size; ++pos) {
+        if (IsSpecialInString(data[pos])) return pos;
+    }
+    return size;
+}
+
+[[noreturn]] void ThrowParseError(std::string_view json, std::size_t offset, std::string_view message) {
+    offset = std::min(offset, json.size());
+    const auto line = 1 + std::count(json.begin(), json.begin() + offset, '\n');
+    const auto from_pos = json.substr(0, offset).find_last_of('\n');
+    const auto column = offset > from_pos ? offset - from_pos : offset + 1;
+
+    throw ParseException(fmt::format("JSON parse error at line {} column {}: {}", line, column, message));
+}
+
+}  // namespace
+
+std::shared_ptr<const LazyDocument> BuildLazyDocument(std::string_view json) {
+    if (json.empty()) {
+        throw ParseException("JSON document is empty");
+    }
+    if (json.size() >= std::numeric_limits<std::uint32_t>::max()) {
+        throw ParseException(fmt::format("JSON document of {} bytes is too large for the lazy parsing", json.size()));
+    }
+
+    auto document = std::make_shared<LazyDocument>();
+    document->json.assign(json);
+    auto& structurals = document->structurals;
+    // Members of a typical object take a dozen bytes or more, each of them has
+    // a string key, a colon and a comma
+    structurals.reserve(json.size() / 4);
+
+    const char* data = document->json.data();
+    const std::size_t size = json.size();
+
+    // Indices of the open brackets
+    std::vector<std::uint32_t> open;
+    const auto in_object = [&] { return data[structurals[open.back()].pos] == '{'; };
+
+    auto state = State::kValue;
+    const auto fail = [&](std::size_t offset) {
+        if (open.empty() && state == State::kAfterValue) {
+            ThrowParseError(json, offset, "The document root must not be followed by other values.");
+        }
+        ThrowParseError(json, offset, "Unexpected character.");
+    };
+
+    for (std::size_t i = 0; i < size; ++i) {
+        const char c = data[i];
+        if (GetCharClass(c) == kWhitespace) continue;
+
+        switch (c) {
+            case '"': {
+                if (state == State::kKey || state == State::kFirstKeyOrClose) {
+                    state = State::kColon;
+                } else if (state == State::kValue || state == State::kFirstItemOrClose) {
+                    state = State::kAfterValue;
+                } else {
+                    fail(i);
+                }
+
+                const auto start = i;
+                for (i = FindSpecialInString(data, i + 1, size); i < size && data[i] != '"';
+                     i = FindSpecialInString(data, i, size)) {
+                    if (data[i] != '\\') ThrowParseError(json, i, "Control character in string.");
+                    i += 2;
+                }
+                if (i >= size) ThrowParseError(json, start, "Missing a closing quotation mark in string.");
+
+                structurals.push_back({static_cast<std::uint32_t>(start), static_cast<std::uint32_t>(i)});
+                break;
+            }
+            case '{':
+            case '[':
+                if (state != State::kValue && state != State::kFirstItemOrClose) fail(i);
+                if (open.size() >= kDepthParseLimit) {
+                    ThrowParseError(
+                        json, i, fmt::format("Exceeded maximum allowed JSON depth of: {}", kDepthParseLimit)
+                    );
+                }
+
+                open.push_back(static_cast<std::uint32_t>(structurals.size()));
+                structurals.push_back({static_cast<std::uint32_t>(i), 0});
+                state = (c == '{' ? State::kFirstKeyOrClose : State::kFirstItemOrClose);
+                break;
+            case '}':
+            case ']': {
+                const bool is_object = (c == '}');
+                if (open.empty() || in_object() != is_object) fail(i);
+                if (state != State::kAfterValue &&
+                    state != (is_object ? State::kFirstKeyOrClose : State::kFirstItemOrClose)) {
+                    fail(i);
+                }
+
+                const auto opening = open.back();
+                open.pop_back();
+                structurals[opening].match = static_cast<std::uint32_t>(structurals.size());
+                structurals.push_back({static_cast<std::uint32_t>(i), opening});
+                state = State::kAfterValue;
+                break;
+            }
+            case ':':
+                if (state != State::kColon) fail(i);
+                structurals.push_back({static_cast<std::uint32_t>(i), 0});
+                state = State::kValue;
+                break;
+            case ',':
+                if (state != State::kAfterValue || open.empty()) fail(i);
+                structurals.push_back({static_cast<std::uint32_t>(i), 0});
+                state = (in_object() ? State::kKey : State::kValue);
+                break;
+            default:
+                if (GetCharClass(c) != kScalar || (state != State::kValue && state != State::kFirstItemOrClose)) {
+                    fail(i);
+                }
+                while (i + 1 < size && GetCharClass(data[i + 1]) == kScalar) ++i;
+                state = State::kAfterValue;
+                break;
+        }
+    }
+
+    if (!open.empty()) {
+        const auto* message = in_object() ? "Missing a comma or '}' after an object member."
+                                          : "Missing a comma or ']' after an array element.";
+        ThrowParseError(json, size, message);
+    }
+    if (state != State::kAfterValue) ThrowParseError(json, size, "Invalid value.");
+
+    return document;
+}
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
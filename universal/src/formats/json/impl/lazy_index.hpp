@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+/// Structural char of a JSON document outside of strings: a bracket, a colon,
+/// a comma, or the opening quote of a string
+struct Structural final {
+    /// Offset of the char in the document
+    std::uint32_t pos;
+    /// Index of the paired bracket for brackets, offset of the closing quote
+    /// for strings, unused for colons and commas
+    std::uint32_t match;
+};
+
+/// Document for formats::json::LazyValue: the JSON text and the positions of
+/// its structural chars
+struct LazyDocument final {
+    std::string json;
+    std::vector<Structural> structurals;
+};
+
+/// @brief Checks the structure of the document and builds its index.
+///
+/// The placement of brackets, strings, colons and commas is fully validated,
+/// so the index may be walked without further checks. Scalars and escapes in
+/// strings are validated only when accessed.
+/// @throw formats::json::ParseException
+std::shared_ptr<const LazyDocument> BuildLazyDocument(std::string_view json);
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
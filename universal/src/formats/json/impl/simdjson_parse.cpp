@@ -0,0 +1,122 @@
+#include <formats/json/impl/simdjson_parse.hpp>
+
+#ifdef USERVER_IMPL_FEATURE_SIMDJSON
+
+#include <cstddef>
+
+#include <rapidjson/document.h>
+#include <simdjson.h>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/formats/json/serialize.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+namespace {
+
+// The parser keeps its buffers between the calls, parsing never switches
+// coroutines
+compiler::ThreadLocal local_parser = [] { return simdjson::dom::parser{}; };
+
+// simdjson saturates the stored sizes of huge containers
+constexpr std::size_t kSaturatedSize = 0xFFFFFF;
+
+template <typename Container>
+std::size_t GetSize(const Container& container) {
+    const std::size_t size = container.size();
+    if (size < kSaturatedSize) return size;
+    std::size_t count = 0;
+    for ([[maybe_unused]] const auto& item : container) ++count;
+    return count;
+}
+
+// The recursion is bounded by kDepthParseLimit, deeper documents are left to
+// rapidjson that reports them as errors
+bool Convert(simdjson::dom::element element, Value& out, Document::AllocatorType& allocator, std::size_t depth) {
+    switch (element.type()) {
+        case simdjson::dom::element_type::ARRAY: {
+            if (depth >= kDepthParseLimit) return false;
+            const simdjson::dom::array array = element.get_array().value_unsafe();
+            out.SetArray();
+            out.Reserve(GetSize(array), allocator);
+            for (const auto item : array) {
+                Value value;
+                if (!Convert(item, value, allocator, depth + 1)) return false;
+                out.PushBack(value, allocator);
+            }
+            return true;
+        }
+        case simdjson::dom::element_type::OBJECT: {
+            if (depth >= kDepthParseLimit) return false;
+            const simdjson::dom::object object = element.get_object().value_unsafe();
+            out.SetObject();
+            out.MemberReserve(GetSize(object), allocator);
+            for (const auto field : object) {
+                Value name{field.key.data(), static_cast<rapidjson::SizeType>(field.key.size()), allocator};
+                Value value;
+                if (!Convert(field.value, value, allocator, depth + 1)) return false;
+                out.AddMember(name, value, allocator);
+            }
+            return true;
+        }
+        case simdjson::dom::element_type::STRING: {
+            const std::string_view str = element.get_string().value_unsafe();
+            out.SetString(str.data(), static_cast<rapidjson::SizeType>(str.size()), allocator);
+            return true;
+        }
+        case simdjson::dom::element_type::INT64:
+            out.SetInt64(element.get_int64().value_unsafe());
+            return true;
+        case simdjson::dom::element_type::UINT64:
+            out.SetUint64(element.get_uint64().value_unsafe());
+            return true;
+        case simdjson::dom::element_type::DOUBLE:
+            out.SetDouble(element.get_double().value_unsafe());
+            return true;
+        case simdjson::dom::element_type::BOOL:
+            out.SetBool(element.get_bool().value_unsafe());
+            return true;
+        case simdjson::dom::element_type::NULL_VALUE:
+            out.SetNull();
+            return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+bool IsSimdjsonAvailable() noexcept { return true; }
+
+bool TryParseWithSimdjson(std::string_view doc, Document& json) {
+    auto parser = local_parser.Use();
+    simdjson::dom::element root;
+    if (parser->parse(doc.data(), doc.size()).get(root) != simdjson::SUCCESS) return false;
+
+    if (!Convert(root, json, json.GetAllocator(), 0)) {
+        json.SetNull();
+        return false;
+    }
+    return true;
+}
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
+
+#else
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+bool IsSimdjsonAvailable() noexcept { return false; }
+
+bool TryParseWithSimdjson(std::string_view, Document&) { return false; }
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
+
+#endif
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string_view>
+
+#include <userver/formats/json/impl/types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+/// Whether userver is built with USERVER_FEATURE_SIMDJSON
+bool IsSimdjsonAvailable() noexcept;
+
+/// Parses `doc` with simdjson into the rapidjson `json` tree. Returns false
+/// if simdjson is not available or fails to parse the document, the caller
+/// should parse it with rapidjson then, to report the error or to accept the
+/// inputs that simdjson refuses (integers beyond 64 bits, invalid UTF-8).
+bool TryParseWithSimdjson(std::string_view doc, Document& json);
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
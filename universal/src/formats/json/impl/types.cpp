@@ -1,5 +1,8 @@
 #include <formats/json/impl/types_impl.hpp>
 
+#include <cstring>
+#include <new>
+
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,6 +18,24 @@ VersionedValuePtr::Data::Data(Document&& doc) : Data(static_cast<Value&&>(doc))
     );
 }
 
+VersionedValuePtr::Data::Data(std::unique_ptr<ArenaAllocator>&& arena, ArenaDocument&& doc) : arena(std::move(arena)) {
+    // The allocator type does not affect the layout of a rapidjson value, it is
+    // only used to allocate and free the nodes. The tree is never modified or
+    // freed through `native`, see IsUnique() and ~Data().
+    ArenaDocument::ValueType& root = doc;
+    static_assert(sizeof(ArenaDocument::ValueType) == sizeof(Value));
+    std::memcpy(static_cast<void*>(&native), static_cast<const void*>(&root), sizeof(Value));
+    // Nothing is freed by the arena values
+    root.SetNull();
+}
+
+VersionedValuePtr::Data::~Data() {
+    if (arena) {
+        // Forget the nodes without visiting them, the arena frees its chunks
+        new (&native) Value();
+    }
+}
+
 VersionedValuePtr::VersionedValuePtr() noexcept = default;
 
 VersionedValuePtr::VersionedValuePtr(std::shared_ptr<Data>&& data) noexcept : data_(std::move(data)) {}
@@ -23,7 +44,10 @@ VersionedValuePtr::~VersionedValuePtr() = default;
 
 VersionedValuePtr::operator bool() const { return !!data_; }
 
-bool VersionedValuePtr::IsUnique() const { return data_.use_count() == 1; }
+bool VersionedValuePtr::IsUnique() const {
+    // Arena trees are immutable, they should be copied rather than stolen
+    return data_.use_count() == 1 && !data_->arena;
+}
 
 const Value* VersionedValuePtr::Get() const { return data_ ? &data_->native : nullptr; }
 
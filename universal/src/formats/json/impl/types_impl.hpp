@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
 
 #include <rapidjson/document.h>
 
@@ -10,6 +11,9 @@ USERVER_NAMESPACE_BEGIN
 
 namespace formats::json::impl {
 
+using ArenaAllocator = ::rapidjson::MemoryPoolAllocator<::rapidjson::CrtAllocator>;
+using ArenaDocument = ::rapidjson::GenericDocument<UTF8, ArenaAllocator, ::rapidjson::CrtAllocator>;
+
 struct VersionedValuePtr::Data {
     template <typename... Args>
     explicit Data(Args&&... args) : native(std::forward<Args>(args)...) {}
@@ -18,7 +22,10 @@ struct VersionedValuePtr::Data {
     // https://github.com/Tencent/rapidjson/issues/387
     explicit Data(Document&&);
 
-    ~Data() = default;
+    // Takes the tree of `doc` that is allocated in `arena`
+    Data(std::unique_ptr<ArenaAllocator>&& arena, ArenaDocument&& doc);
+
+    ~Data();
 
     // native rapidjson value
     Value native;
@@ -26,6 +33,10 @@ struct VersionedValuePtr::Data {
     // version of internal rapidjson structures (member arrays)
     // used in ValueBuilder to avoid UAF, ignored in read-only Value
     std::atomic<size_t> version{0};
+
+    // Nodes of the immutable `native` tree allocated in the arena are released
+    // all at once, nullptr for the trees allocated with CrtAllocator
+    std::unique_ptr<ArenaAllocator> arena;
 };
 
 template <typename... Args>
@@ -0,0 +1,42 @@
+#include <formats/json/impl/writer.hpp>
+
+#include <cmath>
+#include <cstring>
+
+#include <fmt/format.h>
+#include <rapidjson/internal/dtoa.h>
+#include <rapidjson/internal/itoa.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+namespace {
+
+// Same as of rapidjson::Writer, i.e. no truncation
+constexpr int kMaxDecimalPlaces = 324;
+
+}  // namespace
+
+char* WriteDouble(double value, char* buffer) noexcept {
+    if (value == 0) {
+        if (std::signbit(value)) *buffer++ = '-';
+        std::memcpy(buffer, "0.0", 3);
+        return buffer + 3;
+    }
+    if (value < 0) {
+        *buffer++ = '-';
+        value = -value;
+    }
+
+    // Dragonbox is not a part of the public fmt API, but it is available since
+    // fmt 7 and is exported from the compiled fmt library. It gives the
+    // shortest digits that round-trip, rapidjson is used for the layout.
+    const auto decimal = fmt::detail::dragonbox::to_decimal(value);
+    const auto length = static_cast<int>(rapidjson::internal::u64toa(decimal.significand, buffer) - buffer);
+    return rapidjson::internal::Prettify(buffer, length, decimal.exponent, kMaxDecimalPlaces);
+}
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
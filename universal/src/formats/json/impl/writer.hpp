@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#include <rapidjson/stream.h>
+#include <rapidjson/writer.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+/// Enough for any finite double written by WriteDouble
+inline constexpr std::size_t kMaxDoubleLength = 25;
+
+/// @brief Writes the shortest representation of a finite `value` in the same
+/// format as rapidjson does (`1.0`, `0.001`, `1e30`, `1.5e-7`).
+/// @returns the end of the written data
+char* WriteDouble(double value, char* buffer) noexcept;
+
+/// rapidjson::Writer that formats doubles with the fmt's Dragonbox instead of
+/// the slower Grisu2 of rapidjson, the output stays the same
+template <typename OutputStream>
+class Writer final : public rapidjson::Writer<OutputStream> {
+public:
+    using Base = rapidjson::Writer<OutputStream>;
+
+    using Base::Base;
+
+    bool Double(double value) {
+        // nan and inf are rejected by the base class
+        if (!std::isfinite(value)) return Base::Double(value);
+
+        this->Prefix(rapidjson::kNumberType);
+        char buffer[kMaxDoubleLength];
+        const char* const end = WriteDouble(value, buffer);
+        rapidjson::PutReserve(*this->os_, end - buffer);
+        for (const char* it = buffer; it != end; ++it) rapidjson::PutUnsafe(*this->os_, *it);
+        return this->EndValue(true);
+    }
+};
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
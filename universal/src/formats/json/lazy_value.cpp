@@ -0,0 +1,483 @@
+#include <userver/formats/json/lazy_value.hpp>
+
+#include <charconv>
+#include <limits>
+#include <optional>
+
+#include <userver/formats/common/path.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <formats/json/impl/exttypes.hpp>
+#include <formats/json/impl/lazy_index.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace {
+
+constexpr std::uint32_t kNoKey = std::numeric_limits<std::uint32_t>::max();
+
+// Step from a container to its child: the key string for objects
+struct PathItem {
+    std::uint32_t key_structural;
+    std::size_t index;
+};
+
+bool IsWhitespace(char c) noexcept { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+std::uint32_t SkipWhitespace(const impl::LazyDocument& document, std::uint32_t pos) noexcept {
+    while (pos < document.json.size() && IsWhitespace(document.json[pos])) ++pos;
+    return pos;
+}
+
+bool IsObjectAt(const impl::LazyDocument& document, impl::LazyLocation location) noexcept {
+    return document.json[location.begin] == '{';
+}
+
+bool IsContainerAt(const impl::LazyDocument& document, impl::LazyLocation location) noexcept {
+    const char c = document.json[location.begin];
+    return c == '{' || c == '[';
+}
+
+// Index of the structural char right after the value
+std::uint32_t GetStructuralAfter(const impl::LazyDocument& document, impl::LazyLocation location) noexcept {
+    const char c = document.json[location.begin];
+    if (c == '{' || c == '[') return document.structurals[location.structural].match + 1;
+    if (c == '"') return location.structural + 1;
+    return location.structural;
+}
+
+// Offset of the first char after the value
+std::uint32_t GetEnd(const impl::LazyDocument& document, impl::LazyLocation location) noexcept {
+    const auto& structurals = document.structurals;
+    const char c = document.json[location.begin];
+    if (c == '{' || c == '[') return structurals[structurals[location.structural].match].pos + 1;
+    if (c == '"') return structurals[location.structural].match + 1;
+
+    auto end = static_cast<std::uint32_t>(
+        location.structural < structurals.size() ? structurals[location.structural].pos : document.json.size()
+    );
+    while (IsWhitespace(document.json[end - 1])) --end;
+    return end;
+}
+
+// Location of the closing bracket of the container
+impl::LazyLocation GetClose(const impl::LazyDocument& document, impl::LazyLocation container) noexcept {
+    const auto close = document.structurals[container.structural].match;
+    return {document.structurals[close].pos, close};
+}
+
+// Location of the first item, or of the closing bracket if there are none
+impl::LazyLocation GetFirstItem(const impl::LazyDocument& document, impl::LazyLocation container) noexcept {
+    const auto& structurals = document.structurals;
+    const auto next = container.structural + 1;
+    if (IsObjectAt(document, container)) {
+        if (document.json[structurals[next].pos] == '}') return {structurals[next].pos, next};
+        // the next one after the key is a colon
+        return {SkipWhitespace(document, structurals[next + 1].pos + 1), next + 2};
+    }
+
+    // for an empty array that is the closing bracket
+    return {SkipWhitespace(document, structurals[container.structural].pos + 1), next};
+}
+
+// Moves to the next item, or to the closing bracket and returns false if there
+// are no more items
+bool MoveToNextItem(const impl::LazyDocument& document, bool is_object, impl::LazyLocation& item) noexcept {
+    const auto& structurals = document.structurals;
+    const auto after = GetStructuralAfter(document, item);
+    if (document.json[structurals[after].pos] != ',') {
+        item = {structurals[after].pos, after};
+        return false;
+    }
+
+    if (is_object) {
+        item = {SkipWhitespace(document, structurals[after + 2].pos + 1), after + 3};
+    } else {
+        item = {SkipWhitespace(document, structurals[after].pos + 1), after + 1};
+    }
+    return true;
+}
+
+bool IsEnd(const impl::LazyDocument& document, impl::LazyLocation item) noexcept {
+    const char c = document.json[item.begin];
+    return (c == '}' || c == ']') && item.begin == document.structurals[item.structural].pos;
+}
+
+// Key of the object member at `item`
+std::uint32_t GetKeyStructural(impl::LazyLocation item) noexcept { return item.structural - 2; }
+
+std::string_view GetEscapedKey(const impl::LazyDocument& document, std::uint32_t key_structural) noexcept {
+    const auto& key = document.structurals[key_structural];
+    return std::string_view{document.json}.substr(key.pos + 1, key.match - key.pos - 1);
+}
+
+std::string_view GetQuotedKey(const impl::LazyDocument& document, std::uint32_t key_structural) noexcept {
+    const auto& key = document.structurals[key_structural];
+    return std::string_view{document.json}.substr(key.pos, key.match - key.pos + 1);
+}
+
+std::string GetKey(const impl::LazyDocument& document, std::uint32_t key_structural) {
+    const auto escaped = GetEscapedKey(document, key_structural);
+    if (escaped.find('\\') == std::string_view::npos) return std::string{escaped};
+    return FromString(GetQuotedKey(document, key_structural)).As<std::string>();
+}
+
+bool KeyEquals(const impl::LazyDocument& document, std::uint32_t key_structural, std::string_view key) {
+    const auto escaped = GetEscapedKey(document, key_structural);
+    if (escaped.find('\\') == std::string_view::npos) return escaped == key;
+    return GetKey(document, key_structural) == key;
+}
+
+std::vector<PathItem> FindPath(const impl::LazyDocument& document, std::uint32_t target) {
+    std::vector<PathItem> path;
+    impl::LazyLocation current{SkipWhitespace(document, 0), 0};
+    while (current.begin != target) {
+        UASSERT(IsContainerAt(document, current));
+        const bool is_object = IsObjectAt(document, current);
+
+        auto item = GetFirstItem(document, current);
+        for (std::size_t index = 0;; ++index) {
+            UASSERT(!IsEnd(document, item));
+            if (target < GetEnd(document, item)) {
+                path.push_back({is_object ? GetKeyStructural(item) : kNoKey, index});
+                break;
+            }
+            MoveToNextItem(document, is_object, item);
+        }
+        current = item;
+    }
+    return path;
+}
+
+// JSON forbids the leading zeros and the plus sign
+template <typename Integer>
+std::optional<Integer> ParseInteger(std::string_view text) noexcept {
+    const auto digits = (!text.empty() && text[0] == '-') ? text.substr(1) : text;
+    if (digits.size() > 1 && digits[0] == '0') return std::nullopt;
+
+    Integer result{};
+    const auto* end = text.data() + text.size();
+    const auto [ptr, error] = std::from_chars(text.data(), end, result);
+    if (error != std::errc{} || ptr != end) return std::nullopt;
+    return result;
+}
+
+std::string_view GetText(const impl::LazyDocument& document, impl::LazyLocation location) noexcept {
+    return std::string_view{document.json}.substr(location.begin, GetEnd(document, location) - location.begin);
+}
+
+bool IsNumberStart(char c) noexcept { return c == '-' || (c >= '0' && c <= '9'); }
+
+std::shared_ptr<const impl::LazyDocument> GetNullDocument() {
+    static const auto document = impl::BuildLazyDocument("null");
+    return document;
+}
+
+}  // namespace
+
+LazyValue::LazyValue() : document_(GetNullDocument()) {}
+
+LazyValue::LazyValue(std::shared_ptr<const impl::LazyDocument> document, impl::LazyLocation location) noexcept
+    : document_(std::move(document)), location_(location) {}
+
+LazyValue::LazyValue(const LazyValue& parent, std::string_view missing_key)
+    : document_(parent.document_), location_(parent.location_), missing_keys_(parent.missing_keys_) {
+    missing_keys_.emplace_back(missing_key);
+}
+
+LazyValue::~LazyValue() = default;
+
+LazyValue LazyValue::operator[](std::string_view key) const {
+    if (IsMissing() || IsNull()) return LazyValue{*this, key};
+    CheckObject();
+
+    const auto& document = *document_;
+    auto item = GetFirstItem(document, location_);
+    if (IsEnd(document, item)) return LazyValue{*this, key};
+    do {
+        if (KeyEquals(document, GetKeyStructural(item), key)) return LazyValue{document_, item};
+    } while (MoveToNextItem(document, true, item));
+    return LazyValue{*this, key};
+}
+
+LazyValue LazyValue::operator[](std::size_t index) const {
+    CheckNotMissing();
+    if (!IsArray()) ThrowTypeMismatch(impl::arrayValue);
+
+    const auto& document = *document_;
+    auto item = GetFirstItem(document, location_);
+    std::size_t size = 0;
+    if (!IsEnd(document, item)) {
+        do {
+            if (size == index) return LazyValue{document_, item};
+            ++size;
+        } while (MoveToNextItem(document, false, item));
+    }
+    throw OutOfBoundsException(index, size, GetPath());
+}
+
+LazyValue::const_iterator LazyValue::begin() const {
+    CheckObjectOrArrayOrNull();
+    if (IsNull()) return const_iterator{*this, *this};
+    return const_iterator{*this, LazyValue{document_, GetFirstItem(*document_, location_)}};
+}
+
+LazyValue::const_iterator LazyValue::end() const {
+    CheckObjectOrArrayOrNull();
+    if (IsNull()) return const_iterator{*this, *this};
+    return const_iterator{*this, LazyValue{document_, GetClose(*document_, location_)}};
+}
+
+bool LazyValue::IsEmpty() const {
+    CheckObjectOrArrayOrNull();
+    return IsNull() || IsEnd(*document_, GetFirstItem(*document_, location_));
+}
+
+std::size_t LazyValue::GetSize() const {
+    CheckObjectOrArrayOrNull();
+    if (IsNull()) return 0;
+
+    const auto& document = *document_;
+    const bool is_object = IsObjectAt(document, location_);
+    auto item = GetFirstItem(document, location_);
+    if (IsEnd(document, item)) return 0;
+
+    std::size_t size = 1;
+    while (MoveToNextItem(document, is_object, item)) ++size;
+    return size;
+}
+
+bool LazyValue::IsMissing() const noexcept { return !missing_keys_.empty(); }
+
+bool LazyValue::IsNull() const noexcept { return !IsMissing() && GetText(*document_, location_) == "null"; }
+
+bool LazyValue::IsBool() const noexcept {
+    if (IsMissing()) return false;
+    const auto text = GetText(*document_, location_);
+    return text == "true" || text == "false";
+}
+
+bool LazyValue::IsInt() const noexcept {
+    if (IsMissing() || !IsNumberStart(document_->json[location_.begin])) return false;
+    if (ParseInteger<int>(GetText(*document_, location_))) return true;
+    return IsDetached(&formats::json::Value::IsInt);
+}
+
+bool LazyValue::IsInt64() const noexcept {
+    if (IsMissing() || !IsNumberStart(document_->json[location_.begin])) return false;
+    if (ParseInteger<std::int64_t>(GetText(*document_, location_))) return true;
+    return IsDetached(&formats::json::Value::IsInt64);
+}
+
+bool LazyValue::IsUInt64() const noexcept {
+    if (IsMissing() || !IsNumberStart(document_->json[location_.begin])) return false;
+    if (ParseInteger<std::uint64_t>(GetText(*document_, location_))) return true;
+    return IsDetached(&formats::json::Value::IsUInt64);
+}
+
+bool LazyValue::IsDouble() const noexcept {
+    if (IsMissing() || !IsNumberStart(document_->json[location_.begin])) return false;
+    if (ParseInteger<std::int64_t>(GetText(*document_, location_))) return true;
+    return IsDetached(&formats::json::Value::IsDouble);
+}
+
+bool LazyValue::IsString() const noexcept { return !IsMissing() && document_->json[location_.begin] == '"'; }
+
+bool LazyValue::IsArray() const noexcept { return !IsMissing() && document_->json[location_.begin] == '['; }
+
+bool LazyValue::IsObject() const noexcept { return !IsMissing() && document_->json[location_.begin] == '{'; }
+
+bool LazyValue::HasMember(std::string_view key) const {
+    CheckObjectOrNull();
+    return !(*this)[key].IsMissing();
+}
+
+std::string LazyValue::GetPath() const {
+    const auto& document = *document_;
+
+    std::string path;
+    for (const auto& item : FindPath(document, location_.begin)) {
+        if (item.key_structural == kNoKey) {
+            common::AppendPath(path, item.index);
+        } else {
+            common::AppendPath(path, GetKey(document, item.key_structural));
+        }
+    }
+    for (const auto& key : missing_keys_) common::AppendPath(path, key);
+
+    return path.empty() ? std::string{common::kPathRoot} : path;
+}
+
+std::string_view LazyValue::GetRawJson() const {
+    CheckNotMissing();
+    return GetText(*document_, location_);
+}
+
+void LazyValue::CheckNotMissing() const {
+    if (IsMissing()) throw MemberMissingException(GetPath());
+}
+
+void LazyValue::CheckArrayOrNull() const {
+    if (!IsNull() && !IsArray()) ThrowTypeMismatch(impl::arrayValue);
+}
+
+void LazyValue::CheckObjectOrNull() const {
+    if (!IsNull() && !IsObject()) ThrowTypeMismatch(impl::objectValue);
+}
+
+void LazyValue::CheckObject() const {
+    if (!IsObject()) ThrowTypeMismatch(impl::objectValue);
+}
+
+void LazyValue::CheckObjectOrArrayOrNull() const {
+    if (!IsNull() && !IsObject() && !IsArray()) ThrowTypeMismatch(impl::objectValue);
+}
+
+void LazyValue::CheckInBounds(std::size_t index) const {
+    CheckArrayOrNull();
+    const auto size = GetSize();
+    if (index >= size) throw OutOfBoundsException(index, size, GetPath());
+}
+
+bool LazyValue::IsRoot() const noexcept {
+    return !IsMissing() && location_.begin == SkipWhitespace(*document_, 0);
+}
+
+int LazyValue::GetExtendedType() const noexcept {
+    const char c = document_->json[location_.begin];
+    switch (c) {
+        case '{':
+            return impl::objectValue;
+        case '[':
+            return impl::arrayValue;
+        case '"':
+            return impl::stringValue;
+        case 't':
+        case 'f':
+            return impl::booleanValue;
+        case 'n':
+            return impl::nullValue;
+        default:
+            break;
+    }
+    if (!IsNumberStart(c)) return impl::errorValue;
+
+    const auto text = GetText(*document_, location_);
+    if (ParseInteger<std::int64_t>(text)) return impl::intValue;
+    if (ParseInteger<std::uint64_t>(text)) return impl::uintValue;
+    return impl::realValue;
+}
+
+void LazyValue::ThrowTypeMismatch(int expected) const {
+    CheckNotMissing();
+    throw TypeMismatchException(GetExtendedType(), expected, GetPath());
+}
+
+formats::json::Value LazyValue::ParseDetached() const { return FromString(GetRawJson()); }
+
+bool LazyValue::IsDetached(bool (formats::json::Value::*predicate)() const noexcept) const noexcept {
+    try {
+        return (ParseDetached().*predicate)();
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+LazyValueIterator::LazyValueIterator(const LazyValue& container, LazyValue current)
+    : container_(container), current_(std::move(current)) {}
+
+LazyValueIterator& LazyValueIterator::operator++() {
+    const auto& document = *container_.document_;
+    MoveToNextItem(document, IsObjectAt(document, container_.location_), current_.location_);
+    ++index_;
+    return *this;
+}
+
+LazyValueIterator LazyValueIterator::operator++(int) {
+    auto copy = *this;
+    ++*this;
+    return copy;
+}
+
+std::string LazyValueIterator::GetName() const {
+    if (!container_.IsObject()) container_.ThrowTypeMismatch(impl::objectValue);
+    return GetKey(*container_.document_, GetKeyStructural(current_.location_));
+}
+
+std::size_t LazyValueIterator::GetIndex() const {
+    if (!container_.IsArray()) container_.ThrowTypeMismatch(impl::arrayValue);
+    return index_;
+}
+
+LazyValue FromStringLazy(std::string_view doc) {
+    auto document = impl::BuildLazyDocument(doc);
+    const impl::LazyLocation root{SkipWhitespace(*document, 0), 0};
+    return LazyValue{std::move(document), root};
+}
+
+bool Parse(const LazyValue& value, parse::To<bool>) {
+    const auto text = value.GetRawJson();
+    if (text == "true") return true;
+    if (text == "false") return false;
+    return value.ParseAsJson<bool>();
+}
+
+std::int64_t Parse(const LazyValue& value, parse::To<std::int64_t>) {
+    if (const auto result = ParseInteger<std::int64_t>(value.GetRawJson())) return *result;
+    return value.ParseAsJson<std::int64_t>();
+}
+
+std::uint64_t Parse(const LazyValue& value, parse::To<std::uint64_t>) {
+    if (const auto result = ParseInteger<std::uint64_t>(value.GetRawJson())) return *result;
+    return value.ParseAsJson<std::uint64_t>();
+}
+
+std::string Parse(const LazyValue& value, parse::To<std::string>) {
+    const auto text = value.GetRawJson();
+    if (text.size() >= 2 && text.front() == '"' && text.find('\\') == std::string_view::npos) {
+        return std::string{text.substr(1, text.size() - 2)};
+    }
+    return value.ParseAsJson<std::string>();
+}
+
+formats::json::Value Parse(const LazyValue& value, parse::To<formats::json::Value>) {
+    const auto& document = *value.document_;
+    const auto path = FindPath(document, value.location_.begin);
+    if (path.empty() && value.missing_keys_.empty()) return FromString(value.GetRawJson());
+
+    // Paths in formats::json::Value are relative to its root, so the value is
+    // wrapped into the containers along its path in the document
+    std::string json;
+    for (const auto& item : path) {
+        if (item.key_structural == kNoKey) {
+            json += '[';
+            for (std::size_t i = 0; i < item.index; ++i) json += "0,";
+        } else {
+            json += '{';
+            json += GetQuotedKey(document, item.key_structural);
+            json += ':';
+        }
+    }
+    json += GetText(document, value.location_);
+    for (auto it = path.rbegin(); it != path.rend(); ++it) {
+        json += (it->key_structural == kNoKey ? ']' : '}');
+    }
+
+    auto result = FromString(json);
+    for (const auto& item : path) {
+        if (item.key_structural == kNoKey) {
+            result = result[item.index];
+        } else {
+            result = result[GetKey(document, item.key_structural)];
+        }
+    }
+    for (const auto& key : value.missing_keys_) result = result[key];
+    return result;
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <userver/formats/json/lazy_value.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// An object with `fields` members of different types, the requested members
+// are the last ones
+std::string BuildDocument(std::size_t fields) {
+    formats::json::ValueBuilder builder{formats::common::Type::kObject};
+    for (std::size_t i = 0; i < fields; ++i) {
+        const auto key = "field-" + std::to_string(i);
+        switch (i % 3) {
+            case 0:
+                builder[key] = "some string value " + std::to_string(i);
+                break;
+            case 1:
+                builder[key] = static_cast<double>(i) / 3;
+                break;
+            default:
+                builder[key]["nested"].PushBack(i);
+                builder[key]["other"] = true;
+                break;
+        }
+    }
+    builder["id"] = 42;
+    builder["name"] = "name";
+    builder["flags"].PushBack(false);
+    return formats::json::ToString(builder.ExtractValue());
+}
+
+template <typename Value>
+void ReadFewFields(const Value& json) {
+    benchmark::DoNotOptimize(json["id"].template As<int>());
+    benchmark::DoNotOptimize(json["name"].template As<std::string>());
+    benchmark::DoNotOptimize(json["flags"][0].template As<bool>());
+}
+
+}  // namespace
+
+void JsonLazyReadFewFields(benchmark::State& state) {
+    const auto data = BuildDocument(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        ReadFewFields(formats::json::FromStringLazy(data));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(JsonLazyReadFewFields)->RangeMultiplier(4)->Range(4, 1024);
+
+void JsonFromStringReadFewFields(benchmark::State& state) {
+    const auto data = BuildDocument(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        ReadFewFields(formats::json::FromString(data));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(JsonFromStringReadFewFields)->RangeMultiplier(4)->Range(4, 1024);
+
+void JsonLazyToValue(benchmark::State& state) {
+    const auto data = BuildDocument(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(formats::json::FromStringLazy(data).As<formats::json::Value>());
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(JsonLazyToValue)->RangeMultiplier(4)->Range(4, 1024);
+
+USERVER_NAMESPACE_END
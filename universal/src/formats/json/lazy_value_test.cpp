@@ -0,0 +1,239 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/lazy_value.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(FormatsJsonLazy, ExampleUsage) {
+    /// [Sample formats::json::LazyValue usage]
+    // #include <userver/formats/json/lazy_value.hpp>
+
+    // Only the structure of the document is checked here, no values are parsed
+    formats::json::LazyValue json = formats::json::FromStringLazy(R"({
+      "key1": 1,
+      "key2": {"key3": "val"},
+      "huge": [{"unused": true}, {"unused": false}]
+    })");
+
+    // Only "key1" and "key3" are parsed, "huge" is skipped at once
+    const auto key1 = json["key1"].As<int>();
+    ASSERT_EQ(key1, 1);
+
+    const auto key3 = json["key2"]["key3"].As<std::string>();
+    ASSERT_EQ(key3, "val");
+    /// [Sample formats::json::LazyValue usage]
+}
+
+namespace {
+
+struct MyKeyValue {
+    std::string field1;
+    int field2;
+};
+
+// Templated parser works for any of the formats
+template <typename Value>
+MyKeyValue Parse(const Value& value, formats::parse::To<MyKeyValue>) {
+    return MyKeyValue{
+        value["field1"].template As<std::string>(""),
+        value["field2"].template As<int>(1),
+    };
+}
+
+struct JsonOnly {
+    int field;
+};
+
+JsonOnly Parse(const formats::json::Value& value, formats::parse::To<JsonOnly>) {
+    return JsonOnly{value["field"].As<int>()};
+}
+
+}  // namespace
+
+TEST(FormatsJsonLazy, TemplatedParse) {
+    const auto json =
+        formats::json::FromStringLazy(R"({"a": {"field1": "one"}, "b": [{"field1": "two", "field2": 2}]})");
+
+    const auto a = json["a"].As<MyKeyValue>();
+    EXPECT_EQ(a.field1, "one");
+    EXPECT_EQ(a.field2, 1);
+
+    const auto b = json["b"].As<std::vector<MyKeyValue>>();
+    ASSERT_EQ(b.size(), 1u);
+    EXPECT_EQ(b[0].field1, "two");
+    EXPECT_EQ(b[0].field2, 2);
+}
+
+TEST(FormatsJsonLazy, JsonValueParse) {
+    const auto json = formats::json::FromStringLazy(R"({"items": [{"field": 1}, {"field": "str"}]})");
+
+    EXPECT_EQ(json["items"][0].As<JsonOnly>().field, 1);
+    UEXPECT_THROW_MSG(
+        json["items"][1].As<JsonOnly>(),
+        formats::json::TypeMismatchException,
+        "Error at path 'items[1].field': Wrong type. Expected: intValue, actual: stringValue"
+    );
+    UEXPECT_THROW_MSG(
+        json["items"].As<std::vector<JsonOnly>>(),
+        formats::json::TypeMismatchException,
+        "Error at path 'items[1].field'"
+    );
+
+    const auto items = json["items"].As<formats::json::Value>();
+    EXPECT_EQ(items, formats::json::FromString(R"([{"field": 1}, {"field": "str"}])"));
+    EXPECT_EQ(items[1]["field"].GetPath(), "items[1].field");
+    EXPECT_EQ(json.As<formats::json::Value>()["items"][0]["field"].As<int>(), 1);
+}
+
+TEST(FormatsJsonLazy, Types) {
+    const auto json = formats::json::FromStringLazy(
+        R"({"null": null, "bool": true, "int": -5, "uint": 18446744073709551615, "double": 1.5,)"
+        R"( "integral_double": 2.0, "string": "str", "escaped": "a\"b!", "array": [1, 2], "object": {}})"
+    );
+
+    EXPECT_TRUE(json.IsObject());
+    EXPECT_TRUE(json.IsRoot());
+    EXPECT_EQ(json.GetSize(), 10u);
+
+    EXPECT_TRUE(json["null"].IsNull());
+    EXPECT_TRUE(json["bool"].IsBool());
+    EXPECT_TRUE(json["bool"].As<bool>());
+    EXPECT_EQ(json["int"].As<int>(), -5);
+    EXPECT_TRUE(json["int"].IsInt64());
+    EXPECT_FALSE(json["int"].IsUInt64());
+    EXPECT_EQ(json["uint"].As<std::uint64_t>(), 18446744073709551615ULL);
+    EXPECT_FALSE(json["uint"].IsInt64());
+    EXPECT_TRUE(json["uint"].IsUInt64());
+    EXPECT_DOUBLE_EQ(json["double"].As<double>(), 1.5);
+    EXPECT_FALSE(json["double"].IsInt64());
+    EXPECT_TRUE(json["double"].IsDouble());
+    EXPECT_TRUE(json["integral_double"].IsInt64());
+    EXPECT_EQ(json["integral_double"].As<int>(), 2);
+    EXPECT_DOUBLE_EQ(json["int"].As<double>(), -5);
+    EXPECT_EQ(json["string"].As<std::string>(), "str");
+    EXPECT_EQ(json["escaped"].As<std::string>(), "a\"b!");
+    EXPECT_EQ(json["string"].GetRawJson(), R"("str")");
+    EXPECT_EQ(json["array"].As<std::vector<int>>(), (std::vector<int>{1, 2}));
+    EXPECT_TRUE(json["object"].IsEmpty());
+
+    EXPECT_TRUE(json["missing"].IsMissing());
+    EXPECT_EQ(json["missing"].As<int>(42), 42);
+    EXPECT_EQ(json["null"].As<std::optional<int>>(), std::nullopt);
+    EXPECT_FALSE(json.HasMember("missing"));
+    EXPECT_TRUE(json.HasMember("null"));
+
+    EXPECT_TRUE(formats::json::LazyValue{}.IsNull());
+    EXPECT_EQ(formats::json::FromStringLazy(" 42 ").As<int>(), 42);
+}
+
+TEST(FormatsJsonLazy, Containers) {
+    const auto json = formats::json::FromStringLazy(R"({"a": [[1], [], [2, 3]], "b": {"x": "1", "y\n": "2"}})");
+
+    const auto a = json["a"].As<std::vector<std::vector<int>>>();
+    EXPECT_EQ(a, (std::vector<std::vector<int>>{{1}, {}, {2, 3}}));
+    EXPECT_EQ(json["a"][2][1].As<int>(), 3);
+
+    const auto b = json["b"].As<std::map<std::string, std::string>>();
+    EXPECT_EQ(b, (std::map<std::string, std::string>{{"x", "1"}, {"y\n", "2"}}));
+    EXPECT_EQ(json["b"]["y\n"].As<std::string>(), "2");
+
+    std::vector<std::string> keys;
+    for (const auto& [key, item] : formats::common::Items(json)) {
+        keys.push_back(key);
+        EXPECT_FALSE(item.IsMissing());
+    }
+    EXPECT_EQ(keys, (std::vector<std::string>{"a", "b"}));
+
+    std::size_t index = 0;
+    for (auto it = json["a"].begin(); it != json["a"].end(); ++it, ++index) {
+        EXPECT_EQ(it.GetIndex(), index);
+    }
+    EXPECT_EQ(index, 3u);
+}
+
+TEST(FormatsJsonLazy, Paths) {
+    const auto json = formats::json::FromStringLazy(R"({"a": [{"b": 1}, {"c": "str"}]})");
+
+    EXPECT_EQ(json.GetPath(), "/");
+    EXPECT_EQ(json["a"][1]["c"].GetPath(), "a[1].c");
+    EXPECT_EQ(json["a"][0]["x"]["y"].GetPath(), "a[0].x.y");
+
+    UEXPECT_THROW_MSG(
+        json["a"][1]["c"].As<int>(),
+        formats::json::TypeMismatchException,
+        "Error at path 'a[1].c': Wrong type. Expected: intValue, actual: stringValue"
+    );
+    UEXPECT_THROW_MSG(json["a"][0]["x"].As<int>(), formats::json::MemberMissingException, "Error at path 'a[0].x'");
+    UEXPECT_THROW_MSG(json["a"][2], formats::json::OutOfBoundsException, "Index 2 of array of size 2 is out of bounds");
+    UEXPECT_THROW(json["a"]["b"], formats::json::TypeMismatchException);
+}
+
+TEST(FormatsJsonLazy, Malformed) {
+    using formats::json::FromStringLazy;
+    using ParseException = formats::json::LazyValue::ParseException;
+
+    for (const auto* json : {
+             "",
+             "{",
+             "[1, 2",
+             R"({"a": 1,})",
+             R"({"a" 1})",
+             R"({"a": 1 "b": 2})",
+             R"({1: 2})",
+             "[1 2]",
+             "[1,,2]",
+             "[1]]",
+             "{]",
+             R"(["unterminated])",
+             "{}{}",
+             "'a'",
+             "[\"\x01\"]",
+         }) {
+        UEXPECT_THROW(FromStringLazy(json), ParseException) << json;
+    }
+
+    // Scalars are validated on access only
+    const auto json = FromStringLazy(R"({"bad": 00, "good": 1, "bad_escape": "\x"})");
+    EXPECT_EQ(json["good"].As<int>(), 1);
+    UEXPECT_THROW(json["bad"].As<int>(), ParseException);
+    UEXPECT_THROW(json["bad_escape"].As<std::string>(), ParseException);
+    UEXPECT_THROW(json.As<formats::json::Value>(), ParseException);
+}
+
+TEST(FormatsJsonLazy, DeepNesting) {
+    const std::string shallow = std::string(100, '[') + std::string(100, ']');
+    const auto json = formats::json::FromStringLazy(shallow);
+    EXPECT_EQ(json.As<formats::json::Value>(), formats::json::FromString(shallow));
+
+    const std::string deep = std::string(100000, '[') + std::string(100000, ']');
+    UEXPECT_THROW(formats::json::FromStringLazy(deep), formats::json::ParseException);
+}
+
+TEST(FormatsJsonLazy, SameAsJson) {
+    const std::string data = R"({
+      "id": 123456789012,
+      "name": "long enough string to be scanned 16 bytes at a time \\ \"quoted\"",
+      "tags": ["a", "b", "c"],
+      "nested": {"x": [1.5, -2, 3e2], "y": null, "z": [{}, [], {"w": false}]}
+    })";
+    const auto json = formats::json::FromString(data);
+    const auto lazy = formats::json::FromStringLazy(data);
+
+    EXPECT_EQ(lazy.As<formats::json::Value>(), json);
+    EXPECT_EQ(lazy["name"].As<std::string>(), json["name"].As<std::string>());
+    EXPECT_EQ(lazy["nested"]["z"][2].As<formats::json::Value>(), json["nested"]["z"][2]);
+    EXPECT_EQ(lazy["nested"]["x"].As<std::vector<double>>(), json["nested"]["x"].As<std::vector<double>>());
+    EXPECT_EQ(lazy["nested"]["z"].GetSize(), 3u);
+}
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -70,4 +72,33 @@ TEST(FormatsJson, ParseHours) {
     UEXPECT_THROW(formats::json::FromString(R"( "42h" )").As<std::chrono::hours>(), formats::json::Exception);
 }
 
+TEST(FormatsJson, ParserBackends) {
+    using formats::json::ParserBackend;
+    constexpr std::string_view kDocs[] = {
+        R"({"a": [1, -2, 18446744073709551615, 1.5, "str", true, false, null], "b": {}})",
+        R"([123456789012345678901234567890, "\u0416"])",
+        "42",
+    };
+    for (const auto doc : kDocs) {
+        const auto expected = formats::json::FromStringWithBackend(doc, ParserBackend::kRapidjson);
+        EXPECT_EQ(formats::json::FromStringWithBackend(doc, ParserBackend::kSimdjson), expected) << doc;
+        EXPECT_EQ(formats::json::FromString(doc), expected) << doc;
+    }
+
+    for (const auto backend : {ParserBackend::kRapidjson, ParserBackend::kSimdjson}) {
+        UEXPECT_THROW(
+            formats::json::FromStringWithBackend(R"({"a": 1, "a": 2})", backend), formats::json::ParseException
+        );
+        UEXPECT_THROW_MSG(
+            formats::json::FromStringWithBackend("[1,\n2,]", backend),
+            formats::json::ParseException,
+            "JSON parse error at line 2 column 3"
+        );
+        UEXPECT_THROW(
+            formats::json::FromStringWithBackend(std::string(200, '[') + std::string(200, ']'), backend),
+            formats::json::ParseException
+        );
+    }
+}
+
 USERVER_NAMESPACE_END
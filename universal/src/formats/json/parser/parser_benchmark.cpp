@@ -97,6 +97,50 @@ BENCHMARK(JsonParseValueSax)->RangeMultiplier(2)->Range(1, 16);
 
 namespace {
 
+// An array of typical API objects, ~1MB for 4096 items
+std::string BuildRealisticDocument(std::size_t items) {
+    std::string r = "[";
+    for (std::size_t i = 0; i < items; ++i) {
+        if (i > 0) r += ',';
+        r += fmt::format(
+            R"({{"id": {}, "uuid": "3f2a7c1e-{:04x}-4b6d-9e8f-0a1b2c3d4e5f", "name": "item number {}", )"
+            R"("price": {}.{:02}, "available": {}, "tags": ["alpha", "beta", "gamma"], )"
+            R"("location": {{"lat": 55.75{}, "lon": 37.61{}, "address": null}}, )"
+            R"("description": "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod"}})",
+            i,
+            i % 0x10000,
+            i,
+            i % 1000,
+            i % 100,
+            i % 2 == 0 ? "true" : "false",
+            i,
+            i
+        );
+    }
+    r += ']';
+    return r;
+}
+
+}  // namespace
+
+void JsonParseRealisticDom(benchmark::State& state) {
+    const auto input = BuildRealisticDocument(state.range(0));
+    const auto backend = static_cast<formats::json::ParserBackend>(state.range(1));
+    for ([[maybe_unused]] auto _ : state) {
+        const auto res = formats::json::FromStringWithBackend(input, backend);
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(JsonParseRealisticDom)
+    ->ArgsProduct(
+        {{16, 256, 4096},
+         {static_cast<int>(formats::json::ParserBackend::kRapidjson),
+          static_cast<int>(formats::json::ParserBackend::kSimdjson)}}
+    );
+
+namespace {
+
 struct SomeValue final {
     std::size_t value;
 
@@ -1,5 +1,6 @@
 #include <userver/formats/json/parser/parser_state.hpp>
 
+#include <exception>
 #include <variant>
 #include <vector>
 
@@ -29,6 +30,65 @@ std::string ToLimited(std::string_view sw) {
         return std::string{sw};
 }
 
+// rapidjson input stream that pulls the data chunk by chunk
+class ChunkedStream final {
+public:
+    using Ch = char;
+
+    explicit ChunkedStream(utils::function_ref<bool(std::string& chunk)> read_chunk) : read_chunk_(read_chunk) {}
+
+    Ch Peek() { return EnsureData() ? chunk_[chunk_pos_] : '\0'; }
+
+    Ch Take() {
+        if (!EnsureData()) return '\0';
+        ++offset_;
+        return chunk_[chunk_pos_++];
+    }
+
+    std::size_t Tell() const { return offset_; }
+
+    // Errors of `read_chunk` are reported as the end of input to the parser and
+    // are rethrown after the parsing, instead of the truncated input error
+    void RethrowReadError() const {
+        if (read_error_) std::rethrow_exception(read_error_);
+    }
+
+    // Output is not supported, same as in rapidjson::MemoryStream
+    Ch* PutBegin() {
+        UASSERT(false);
+        return nullptr;
+    }
+    void Put(Ch) { UASSERT(false); }
+    void Flush() { UASSERT(false); }
+    std::size_t PutEnd(Ch*) {
+        UASSERT(false);
+        return 0;
+    }
+
+private:
+    bool EnsureData() {
+        while (chunk_pos_ == chunk_.size()) {
+            if (is_eof_) return false;
+            chunk_.clear();
+            chunk_pos_ = 0;
+            try {
+                if (!read_chunk_(chunk_)) is_eof_ = true;
+            } catch (const std::exception&) {
+                read_error_ = std::current_exception();
+                is_eof_ = true;
+            }
+        }
+        return true;
+    }
+
+    utils::function_ref<bool(std::string& chunk)> read_chunk_;
+    std::string chunk_;
+    std::size_t chunk_pos_{0};
+    std::size_t offset_{0};
+    bool is_eof_{false};
+    std::exception_ptr read_error_;
+};
+
 }  // namespace
 
 struct ParserState::Impl {
@@ -42,6 +102,9 @@ struct ParserState::Impl {
     void PushParser(BaseParser& parser, ParserState& parser_state);
 
     [[nodiscard]] std::string GetPath() const;
+
+    template <typename Stream>
+    void Parse(Stream& is, std::string_view sw);
 };
 
 void ParserState::Impl::PushParser(BaseParser& parser, ParserState& parser_state) {
@@ -49,35 +112,11 @@ void ParserState::Impl::PushParser(BaseParser& parser, ParserState& parser_state
     stack.push_back({&parser});
 }
 
-std::string ParserState::Impl::GetPath() const {
-    std::string result;
-
-    for (const auto& item : stack) {
-        const auto str = item.parser->GetPathItem();
-        if (str.empty()) continue;
-
-        if (!result.empty()) {
-            result += '.';
-        }
-        result += str;
-    }
-
-    return result;
-}
-
-ParserState::ParserState() = default;
-
-ParserState::~ParserState() = default;
-
-void ParserState::PushParser(BaseParser& parser) { impl_->PushParser(parser, *this); }
-
-void ParserState::ProcessInput(std::string_view sw) {
+template <typename Stream>
+void ParserState::Impl::Parse(Stream& is, std::string_view sw) {
     rapidjson::Reader reader;
-    rapidjson::MemoryStream is(sw.data(), sw.size());
     reader.IterativeParseInit();
 
-    auto& stack = impl_->stack;
-
     size_t pos = 0;
     try {
         while (!reader.IterativeParseComplete()) {
@@ -98,7 +137,7 @@ void ParserState::ProcessInput(std::string_view sw) {
             if (reader.HasParseError()) {
                 throw ParseError{
                     reader.GetErrorOffset(),
-                    impl_->GetPath(),
+                    GetPath(),
                     rapidjson::GetParseError_En(reader.GetParseErrorCode()),
                 };
             }
@@ -107,11 +146,13 @@ void ParserState::ProcessInput(std::string_view sw) {
         throw;
     } catch (const std::exception& e) {
         auto cur_pos = is.Tell();
-        auto msg =
-            (cur_pos == pos) ? "" : fmt::format(", the latest token was {}", ToLimited(sw.substr(pos, cur_pos - pos)));
+        // the latest token is only available if the whole input is in memory
+        auto msg = (cur_pos == pos || cur_pos > sw.size())
+                       ? ""
+                       : fmt::format(", the latest token was {}", ToLimited(sw.substr(pos, cur_pos - pos)));
         throw ParseError{
             cur_pos,
-            impl_->GetPath(),
+            GetPath(),
             e.what() + msg,
         };
     }
@@ -121,6 +162,44 @@ void ParserState::ProcessInput(std::string_view sw) {
     }
 }
 
+std::string ParserState::Impl::GetPath() const {
+    std::string result;
+
+    for (const auto& item : stack) {
+        const auto str = item.parser->GetPathItem();
+        if (str.empty()) continue;
+
+        if (!result.empty()) {
+            result += '.';
+        }
+        result += str;
+    }
+
+    return result;
+}
+
+ParserState::ParserState() = default;
+
+ParserState::~ParserState() = default;
+
+void ParserState::PushParser(BaseParser& parser) { impl_->PushParser(parser, *this); }
+
+void ParserState::ProcessInput(std::string_view sw) {
+    rapidjson::MemoryStream is(sw.data(), sw.size());
+    impl_->Parse(is, sw);
+}
+
+void ParserState::ProcessChunkedInput(utils::function_ref<bool(std::string& chunk)> read_chunk) {
+    ChunkedStream is{read_chunk};
+    try {
+        impl_->Parse(is, {});
+    } catch (const ParseError&) {
+        is.RethrowReadError();
+        throw;
+    }
+    is.RethrowReadError();
+}
+
 BaseParser& ParserState::GetTopParser() const {
     UASSERT(!impl_->stack.empty());
     return *impl_->stack.back().parser;
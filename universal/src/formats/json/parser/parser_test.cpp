@@ -255,6 +255,56 @@ TEST(JsonStringParser, ArrayArrayInt) {
     EXPECT_EQ(result, (std::vector<std::vector<int64_t>>{{1}, {}, {2, 3, 4}}));
 }
 
+TEST(JsonStringParser, ArrayArrayIntChunked) {
+    const std::string_view input("[[1],[],[2,3,-45678]]");
+    for (std::size_t chunk_size = 1; chunk_size <= input.size(); ++chunk_size) {
+        std::vector<std::vector<int64_t>> result{};
+
+        fjp::Int64Parser int_parser;
+        using Subparser = fjp::ArrayParser<int64_t, fjp::Int64Parser>;
+        Subparser subparser(int_parser);
+        fjp::ArrayParser<std::vector<int64_t>, Subparser> parser(subparser);
+        fjp::SubscriberSink<decltype(result)> sink(result);
+        parser.Reset();
+        parser.Subscribe(sink);
+
+        std::size_t pos = 0;
+        fjp::ParserState state;
+        state.PushParser(parser);
+        state.ProcessChunkedInput([&](std::string& chunk) {
+            if (pos == input.size()) return false;
+            chunk = std::string{input.substr(pos, chunk_size)};
+            pos += chunk.size();
+            return true;
+        });
+        EXPECT_EQ(result, (std::vector<std::vector<int64_t>>{{1}, {}, {2, 3, -45678}})) << chunk_size;
+    }
+}
+
+TEST(JsonStringParser, ChunkedReadError) {
+    std::vector<int64_t> result{};
+
+    fjp::Int64Parser int_parser;
+    fjp::ArrayParser<int64_t, fjp::Int64Parser> parser(int_parser);
+    fjp::SubscriberSink<decltype(result)> sink(result);
+    parser.Reset();
+    parser.Subscribe(sink);
+
+    bool is_first = true;
+    fjp::ParserState state;
+    state.PushParser(parser);
+    UEXPECT_THROW_MSG(
+        state.ProcessChunkedInput([&](std::string& chunk) {
+            if (!is_first) throw std::runtime_error("read failed");
+            is_first = false;
+            chunk = "[1,2";
+            return true;
+        }),
+        std::runtime_error,
+        "read failed"
+    );
+}
+
 TEST(JsonStringParser, ArrayBool) {
     std::string input{"[true, false, true]"};
     std::vector<bool> result;
@@ -17,7 +17,9 @@
 
 #include <formats/json/impl/accept.hpp>
 #include <formats/json/impl/json_tree.hpp>
+#include <formats/json/impl/simdjson_parse.hpp>
 #include <formats/json/impl/types_impl.hpp>
+#include <formats/json/impl/writer.hpp>
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/logging/log.hpp>
@@ -31,6 +33,8 @@ namespace {
 
 ::rapidjson::CrtAllocator g_allocator;
 
+constexpr std::size_t kMinArenaChunkSize = 4096;
+
 std::string_view AsStringView(const impl::Value& jval) { return {jval.GetString(), jval.GetStringLength()}; }
 
 void CheckKeyUniqueness(const impl::Value* root) {
@@ -95,16 +99,11 @@ impl::VersionedValuePtr EnsureValid(impl::Document&& json) {
     return impl::VersionedValuePtr::Create(std::move(json));
 }
 
-}  // namespace
-
-Value FromString(std::string_view doc) {
-    if (doc.empty()) {
-        throw ParseException("JSON document is empty");
-    }
-
-    impl::Document json{&g_allocator};
+template <typename Document>
+void ParseWithRapidjson(std::string_view doc, Document& json) {
     rapidjson::ParseResult ok =
-        json.Parse<rapidjson::kParseDefaultFlags | rapidjson::kParseIterativeFlag | rapidjson::kParseFullPrecisionFlag>(
+        json.template Parse<
+            rapidjson::kParseDefaultFlags | rapidjson::kParseIterativeFlag | rapidjson::kParseFullPrecisionFlag>(
             doc.data(), doc.size()
         );
     if (!ok) {
@@ -119,10 +118,43 @@ Value FromString(std::string_view doc) {
             "JSON parse error at line {} column {}: {}", line, column, rapidjson::GetParseError_En(ok.Code())
         ));
     }
+}
+
+}  // namespace
+
+Value FromString(std::string_view doc) { return FromStringWithBackend(doc, ParserBackend::kDefault); }
+
+Value FromStringWithBackend(std::string_view doc, ParserBackend backend) {
+    if (doc.empty()) {
+        throw ParseException("JSON document is empty");
+    }
 
+    impl::Document json{&g_allocator};
+    if (backend != ParserBackend::kRapidjson && impl::TryParseWithSimdjson(doc, json)) {
+        return Value{EnsureValid(std::move(json))};
+    }
+
+    // Also reports the errors of simdjson
+    ParseWithRapidjson(doc, json);
     return Value{EnsureValid(std::move(json))};
 }
 
+Value FromStringToArena(std::string_view doc) {
+    if (doc.empty()) {
+        throw ParseException("JSON document is empty");
+    }
+
+    // The tree usually takes up to twice the size of the text, so the arena
+    // is most likely a single chunk
+    auto arena = std::make_unique<impl::ArenaAllocator>(std::max(doc.size() * 2, kMinArenaChunkSize));
+    impl::ArenaDocument json{arena.get()};
+    ParseWithRapidjson(doc, json);
+
+    auto holder = impl::VersionedValuePtr::Create(std::move(arena), std::move(json));
+    CheckKeyUniqueness(holder.Get());
+    return Value{std::move(holder)};
+}
+
 Value FromStream(std::istream& is) {
     if (!is) {
         throw BadStreamException(is);
@@ -143,7 +175,7 @@ Value FromStream(std::istream& is) {
 
 void Serialize(const Value& doc, std::ostream& os) {
     rapidjson::OStreamWrapper out{os};
-    rapidjson::Writer writer(out);
+    impl::Writer<rapidjson::OStreamWrapper> writer(out);
     AcceptNoRecursion(doc.GetNative(), writer);
     if (!os) {
         throw BadStreamException(os);
@@ -152,7 +184,7 @@ void Serialize(const Value& doc, std::ostream& os) {
 
 std::string ToString(const Value& doc) {
     rapidjson::StringBuffer buffer;
-    rapidjson::Writer writer(buffer);
+    impl::Writer<rapidjson::StringBuffer> writer(buffer);
     AcceptNoRecursion(doc.GetNative(), writer);
     return std::string{buffer.GetString(), buffer.GetLength()};
 }
@@ -164,7 +196,7 @@ std::string ToStableString(Value&& doc) {
         Value value = std::move(doc);
 
         rapidjson::StringBuffer buffer;
-        rapidjson::Writer writer(buffer);
+        impl::Writer<rapidjson::StringBuffer> writer(buffer);
         AcceptNoRecursion<ObjectProcessing::kInplaceSorting>(value.GetNative(), writer);
         return std::string{buffer.GetString(), buffer.GetLength()};
     }
@@ -182,7 +214,7 @@ std::string ToPrettyString(const formats::json::Value& doc, PrettyFormat format)
 
 logging::LogHelper& operator<<(logging::LogHelper& lh, const Value& doc) {
     rapidjson::StringBuffer buffer;
-    rapidjson::Writer writer(buffer);
+    impl::Writer<rapidjson::StringBuffer> writer(buffer);
     AcceptNoRecursion(doc.GetNative(), writer);
     return lh << std::string_view{buffer.GetString(), buffer.GetLength()};
 }
@@ -207,7 +239,7 @@ struct StringBuffer::Impl final {
 };
 
 StringBuffer::StringBuffer(const formats::json::Value& value) {
-    rapidjson::Writer writer(pimpl_->buffer);
+    impl::Writer<rapidjson::StringBuffer> writer(pimpl_->buffer);
     AcceptNoRecursion(value.GetNative(), writer);
 }
 
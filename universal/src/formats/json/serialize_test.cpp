@@ -9,6 +9,7 @@
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/formats/parse/common_containers.hpp>
+#include <userver/utest/assert_macros.hpp>
 #include <userver/utils/fmt_compat.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -314,6 +315,36 @@ TEST(JsonToPrettyStringCycle, IsPretty) {
     EXPECT_EQ(kPrettyJson, formats::json::ToPrettyString(json, format));
 }
 
+TEST(FormatsJson, FromStringToArena) {
+    static constexpr std::string_view kJson =
+        R"({"b": [1, -2.5, "a long string that is not stored inline", null], "a": {"key": true}})";
+
+    const auto expected = formats::json::FromString(kJson);
+    auto json = formats::json::FromStringToArena(kJson);
+    EXPECT_EQ(json, expected);
+    EXPECT_EQ(json["b"][2].As<std::string>(), "a long string that is not stored inline");
+    EXPECT_EQ(
+        formats::json::ToStableString(std::move(json)),
+        R"({"a":{"key":true},"b":[1,-2.5,"a long string that is not stored inline",null]})"
+    );
+
+    // The builders copy the arena nodes
+    auto arena_json = formats::json::FromStringToArena(kJson);
+    formats::json::ValueBuilder builder{std::move(arena_json)};
+    builder["b"].PushBack(42);
+    builder["c"] = "new";
+    const auto built = builder.ExtractValue();
+    EXPECT_EQ(built["b"].GetSize(), 5);
+    EXPECT_EQ(built["c"].As<std::string>(), "new");
+
+    UEXPECT_THROW(formats::json::FromStringToArena(R"({"a": 1, "a": 2})"), formats::json::ParseException);
+    UEXPECT_THROW_MSG(
+        formats::json::FromStringToArena("[1,\n2,]"),
+        formats::json::ParseException,
+        "JSON parse error at line 2 column 3"
+    );
+}
+
 // TODO make ToPrettyString sort object keys and re-enable.
 TEST(JsonToPrettyStringCycle, DISABLED_SortsObjectKeys) {
     static constexpr std::string_view kInitialJson = R"({"c":1,"b":1,"a":1})";
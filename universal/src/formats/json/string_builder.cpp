@@ -8,10 +8,11 @@
 #include <rapidjson/writer.h>
 
 #include <formats/json/impl/accept.hpp>
+#include <formats/json/impl/writer.hpp>
 #include <userver/formats/common/validations.hpp>
 #include <userver/formats/json/impl/types.hpp>
 #include <userver/formats/json/value.hpp>
-#include <userver/utils/datetime.hpp>
+#include <userver/utils/datetime/rfc3339.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -20,7 +21,7 @@ namespace formats::json {
 
 struct StringBuilder::Impl {
     rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer{buffer};
+    impl::Writer<rapidjson::StringBuffer> writer{buffer};
 
     Impl() = default;
 };
@@ -84,7 +85,8 @@ void WriteToStream(const formats::json::Value& value, StringBuilder& sw) { sw.Wr
 void WriteToStream(const std::string& value, StringBuilder& sw) { WriteToStream(std::string_view{value}, sw); }
 
 void WriteToStream(std::chrono::system_clock::time_point tp, StringBuilder& sw) {
-    WriteToStream(utils::datetime::Timestring(tp, "UTC", utils::datetime::kRfc3339Format), sw);
+    utils::datetime::Rfc3339Buffer buffer;
+    WriteToStream(utils::datetime::FormatRfc3339(tp, std::chrono::minutes{0}, buffer), sw);
 }
 
 StringBuilder::ObjectGuard::ObjectGuard(StringBuilder& sw) : sw_(sw) { sw_.impl_->writer.StartObject(); }
@@ -1,5 +1,8 @@
 #include <benchmark/benchmark.h>
 
+#include <string>
+#include <vector>
+
 #include <userver/formats/json/string_builder.hpp>
 #include <userver/formats/json/value_builder.hpp>
 
@@ -74,4 +77,32 @@ void JsonStringBuilder(benchmark::State& state) {
 }
 BENCHMARK(JsonStringBuilder)->RangeMultiplier(4)->Range(1, 1024);
 
+void JsonStringBuilderDoubles(benchmark::State& state) {
+    std::vector<double> values;
+    for (int i = 0; i < state.range(0); ++i) values.push_back(i * 1.1 + i / 7.0);
+
+    for ([[maybe_unused]] auto _ : state) {
+        StringBuilder sw;
+        {
+            const StringBuilder::ArrayGuard guard(sw);
+            for (const auto value : values) sw.WriteDouble(value);
+        }
+        benchmark::DoNotOptimize(sw.GetStringView());
+    }
+}
+BENCHMARK(JsonStringBuilderDoubles)->RangeMultiplier(4)->Range(1, 1024);
+
+void JsonStringBuilderStrings(benchmark::State& state) {
+    // Mostly plain text with a rare char to escape, as in the logs
+    std::string value(state.range(0), 'a');
+    value[value.size() / 2] = '"';
+
+    for ([[maybe_unused]] auto _ : state) {
+        StringBuilder sw;
+        sw.WriteString(value);
+        benchmark::DoNotOptimize(sw.GetStringView());
+    }
+}
+BENCHMARK(JsonStringBuilderStrings)->RangeMultiplier(4)->Range(4, 4096);
+
 USERVER_NAMESPACE_END
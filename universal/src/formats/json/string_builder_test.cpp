@@ -127,6 +127,30 @@ TEST(JsonStringBuilder, Double) {
     EXPECT_EQ("12.3", sw.GetString());
 }
 
+TEST(JsonStringBuilder, DoubleFormat) {
+    const auto write = [](double value) {
+        StringBuilder sw;
+        sw.WriteDouble(value);
+        return sw.GetString();
+    };
+
+    EXPECT_EQ(write(0), "0.0");
+    EXPECT_EQ(write(-0.0), "-0.0");
+    EXPECT_EQ(write(1), "1.0");
+    EXPECT_EQ(write(-2.5), "-2.5");
+    EXPECT_EQ(write(100), "100.0");
+    EXPECT_EQ(write(0.000001), "0.000001");
+    EXPECT_EQ(write(1.5e-7), "1.5e-7");
+    EXPECT_EQ(write(1e21), "1e21");
+    EXPECT_EQ(write(1.23e22), "1.23e22");
+    EXPECT_EQ(write(5e-324), "5e-324");
+    EXPECT_EQ(write(1.7976931348623157e308), "1.7976931348623157e308");
+
+    // Same format for the values of DOM
+    EXPECT_EQ(ToString(ValueBuilder{1.23e22}.ExtractValue()), "1.23e22");
+    EXPECT_EQ(ToString(ValueBuilder{100.0}.ExtractValue()), "100.0");
+}
+
 TEST(JsonStringBuilder, Object) {
     StringBuilder sw;
     {
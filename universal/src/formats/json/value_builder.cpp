@@ -9,7 +9,7 @@
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/utils/assert.hpp>
-#include <userver/utils/datetime.hpp>
+#include <userver/utils/datetime/rfc3339.hpp>
 
 #include <formats/json/impl/types_impl.hpp>
 
@@ -260,7 +260,8 @@ impl::Value& ValueBuilder::AddMember(std::string_view key, CheckMemberExists che
 }
 
 Value Serialize(std::chrono::system_clock::time_point tp, formats::serialize::To<Value>) {
-    json::ValueBuilder builder = utils::datetime::Timestring(tp, "UTC", utils::datetime::kRfc3339Format);
+    utils::datetime::Rfc3339Buffer buffer;
+    json::ValueBuilder builder = utils::datetime::FormatRfc3339(tp, std::chrono::minutes{0}, buffer);
     return builder.ExtractValue();
 }
 
@@ -0,0 +1,43 @@
+#include <userver/formats/msgpack/exception.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/utils/algo.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kErrorAtPath1 = "Error at path '";
+constexpr std::string_view kErrorAtPath2 = "': ";
+
+}  // namespace
+
+namespace formats::msgpack {
+
+ExceptionWithPath::ExceptionWithPath(std::string_view msg, std::string_view path)
+    : Exception(utils::StrCat(kErrorAtPath1, path, kErrorAtPath2, msg)), path_size_(path.size()) {}
+
+std::string_view ExceptionWithPath::GetPath() const noexcept {
+    return GetMessage().substr(kErrorAtPath1.size(), path_size_);
+}
+
+std::string_view ExceptionWithPath::GetMessageWithoutPath() const noexcept {
+    return GetMessage().substr(path_size_ + kErrorAtPath1.size() + kErrorAtPath2.size());
+}
+
+TypeMismatchException::TypeMismatchException(
+    std::string_view actual,
+    std::string_view expected,
+    std::string_view path
+)
+    : ExceptionWithPath(fmt::format("Wrong type. Expected: {}, actual: {}", expected, actual), path) {}
+
+OutOfBoundsException::OutOfBoundsException(std::size_t index, std::size_t size, std::string_view path)
+    : ExceptionWithPath(fmt::format("Index {} of array of size {} is out of bounds", index, size), path) {}
+
+MemberMissingException::MemberMissingException(std::string_view path) : ExceptionWithPath("Field is missing", path) {}
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,276 @@
+#include <formats/msgpack/impl/reader.hpp>
+
+#include <cstring>
+#include <type_traits>
+
+#include <fmt/format.h>
+
+#include <userver/formats/msgpack/exception.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack::impl {
+
+namespace {
+
+template <typename T>
+T LoadBigEndian(const char* pos) noexcept {
+    std::uint64_t result = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        result = (result << 8) | static_cast<unsigned char>(pos[i]);
+    }
+    if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+        using Bits = std::conditional_t<std::is_same_v<T, float>, std::uint32_t, std::uint64_t>;
+        const auto bits = static_cast<Bits>(result);
+        T value{};
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    } else {
+        return static_cast<T>(result);
+    }
+}
+
+template <typename T>
+bool ReadNumber(const char* pos, const char* end, Element& element) noexcept {
+    if (end - pos < static_cast<std::ptrdiff_t>(sizeof(T))) return false;
+    const auto value = LoadBigEndian<T>(pos);
+    if constexpr (std::is_floating_point_v<T>) {
+        element.type = Type::kDouble;
+        element.double_value = value;
+    } else if constexpr (std::is_signed_v<T>) {
+        if (value < 0) {
+            element.type = Type::kInt;
+            element.int_value = value;
+        } else {
+            element.type = Type::kUInt;
+            element.uint_value = static_cast<std::uint64_t>(value);
+        }
+    } else {
+        element.type = Type::kUInt;
+        element.uint_value = value;
+    }
+    element.payload = pos + sizeof(T);
+    return true;
+}
+
+bool ReadData(Type type, std::size_t size, const char* pos, const char* end, Element& element) noexcept {
+    if (static_cast<std::size_t>(end - pos) < size) return false;
+    element.type = type;
+    element.size = size;
+    element.payload = pos;
+    return true;
+}
+
+template <typename Size>
+bool ReadSizedData(Type type, const char* pos, const char* end, Element& element) noexcept {
+    if (end - pos < static_cast<std::ptrdiff_t>(sizeof(Size))) return false;
+    return ReadData(type, LoadBigEndian<Size>(pos), pos + sizeof(Size), end, element);
+}
+
+// The extension type byte goes after the size and is skipped
+template <typename Size>
+bool ReadExtension(const char* pos, const char* end, Element& element) noexcept {
+    if (end - pos < static_cast<std::ptrdiff_t>(sizeof(Size) + 1)) return false;
+    return ReadData(Type::kExtension, LoadBigEndian<Size>(pos), pos + sizeof(Size) + 1, end, element);
+}
+
+bool ReadFixedExtension(std::size_t size, const char* pos, const char* end, Element& element) noexcept {
+    if (pos == end) return false;
+    return ReadData(Type::kExtension, size, pos + 1, end, element);
+}
+
+template <typename Size>
+bool ReadContainer(Type type, const char* pos, const char* end, Element& element) noexcept {
+    if (end - pos < static_cast<std::ptrdiff_t>(sizeof(Size))) return false;
+    element.type = type;
+    element.size = LoadBigEndian<Size>(pos);
+    element.payload = pos + sizeof(Size);
+    return true;
+}
+
+}  // namespace
+
+std::string_view NameForType(Type type) noexcept {
+    switch (type) {
+        case Type::kNull:
+            return "null";
+        case Type::kBool:
+            return "bool";
+        case Type::kInt:
+            return "int";
+        case Type::kUInt:
+            return "uint";
+        case Type::kDouble:
+            return "double";
+        case Type::kString:
+            return "string";
+        case Type::kArray:
+            return "array";
+        case Type::kObject:
+            return "object";
+        case Type::kExtension:
+            return "extension";
+    }
+    return "unknown";
+}
+
+std::optional<Element> TryReadElement(const char* pos, const char* end) noexcept {
+    if (pos >= end) return std::nullopt;
+
+    Element element;
+    const auto byte = static_cast<unsigned char>(*pos++);
+    element.payload = pos;
+
+    if (byte <= 0x7f) {
+        element.type = Type::kUInt;
+        element.uint_value = byte;
+        return element;
+    }
+    if (byte >= 0xe0) {
+        element.type = Type::kInt;
+        element.int_value = static_cast<std::int8_t>(byte);
+        return element;
+    }
+    if (byte <= 0x8f) {
+        element.type = Type::kObject;
+        element.size = byte & 0x0f;
+        return element;
+    }
+    if (byte <= 0x9f) {
+        element.type = Type::kArray;
+        element.size = byte & 0x0f;
+        return element;
+    }
+    if (byte <= 0xbf) {
+        if (!ReadData(Type::kString, byte & 0x1f, pos, end, element)) return std::nullopt;
+        return element;
+    }
+
+    bool ok = true;
+    switch (byte) {
+        case 0xc0:
+            element.type = Type::kNull;
+            break;
+        case 0xc2:
+        case 0xc3:
+            element.type = Type::kBool;
+            element.bool_value = (byte == 0xc3);
+            break;
+        case 0xc4:
+        case 0xd9:
+            ok = ReadSizedData<std::uint8_t>(Type::kString, pos, end, element);
+            break;
+        case 0xc5:
+        case 0xda:
+            ok = ReadSizedData<std::uint16_t>(Type::kString, pos, end, element);
+            break;
+        case 0xc6:
+        case 0xdb:
+            ok = ReadSizedData<std::uint32_t>(Type::kString, pos, end, element);
+            break;
+        case 0xc7:
+            ok = ReadExtension<std::uint8_t>(pos, end, element);
+            break;
+        case 0xc8:
+            ok = ReadExtension<std::uint16_t>(pos, end, element);
+            break;
+        case 0xc9:
+            ok = ReadExtension<std::uint32_t>(pos, end, element);
+            break;
+        case 0xca:
+            ok = ReadNumber<float>(pos, end, element);
+            break;
+        case 0xcb:
+            ok = ReadNumber<double>(pos, end, element);
+            break;
+        case 0xcc:
+            ok = ReadNumber<std::uint8_t>(pos, end, element);
+            break;
+        case 0xcd:
+            ok = ReadNumber<std::uint16_t>(pos, end, element);
+            break;
+        case 0xce:
+            ok = ReadNumber<std::uint32_t>(pos, end, element);
+            break;
+        case 0xcf:
+            ok = ReadNumber<std::uint64_t>(pos, end, element);
+            break;
+        case 0xd0:
+            ok = ReadNumber<std::int8_t>(pos, end, element);
+            break;
+        case 0xd1:
+            ok = ReadNumber<std::int16_t>(pos, end, element);
+            break;
+        case 0xd2:
+            ok = ReadNumber<std::int32_t>(pos, end, element);
+            break;
+        case 0xd3:
+            ok = ReadNumber<std::int64_t>(pos, end, element);
+            break;
+        case 0xd4:
+        case 0xd5:
+        case 0xd6:
+        case 0xd7:
+        case 0xd8:
+            ok = ReadFixedExtension(std::size_t{1} << (byte - 0xd4), pos, end, element);
+            break;
+        case 0xdc:
+            ok = ReadContainer<std::uint16_t>(Type::kArray, pos, end, element);
+            break;
+        case 0xdd:
+            ok = ReadContainer<std::uint32_t>(Type::kArray, pos, end, element);
+            break;
+        case 0xde:
+            ok = ReadContainer<std::uint16_t>(Type::kObject, pos, end, element);
+            break;
+        case 0xdf:
+            ok = ReadContainer<std::uint32_t>(Type::kObject, pos, end, element);
+            break;
+        default:  // 0xc1 is never used
+            ok = false;
+            break;
+    }
+    if (!ok) return std::nullopt;
+    return element;
+}
+
+Element ReadElement(const char* pos, const char* end) {
+    auto element = TryReadElement(pos, end);
+    if (!element) {
+        if (pos >= end) throw ParseException("Unexpected end of MessagePack data");
+        throw ParseException(fmt::format(
+            "Malformed or truncated MessagePack value with type byte {:#04x}", static_cast<unsigned char>(*pos)
+        ));
+    }
+    return *element;
+}
+
+const char* SkipElement(const char* pos, const char* end) {
+    // Arrays and maps are skipped by counting the values left, so malicious
+    // nesting can not overflow the stack
+    std::uint64_t values_left = 1;
+    while (values_left > 0) {
+        const auto element = ReadElement(pos, end);
+        --values_left;
+        pos = element.payload;
+        switch (element.type) {
+            case Type::kString:
+            case Type::kExtension:
+                pos += element.size;
+                break;
+            case Type::kArray:
+                values_left += element.size;
+                break;
+            case Type::kObject:
+                values_left += 2 * static_cast<std::uint64_t>(element.size);
+                break;
+            default:
+                break;
+        }
+    }
+    return pos;
+}
+
+}  // namespace formats::msgpack::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack::impl {
+
+enum class Type {
+    kNull,
+    kBool,
+    kInt,  // negative integers only
+    kUInt,
+    kDouble,
+    kString,
+    kArray,
+    kObject,
+    kExtension,
+};
+
+std::string_view NameForType(Type type) noexcept;
+
+/// Decoded header of a single MessagePack value
+struct Element final {
+    Type type{Type::kNull};
+    union {
+        bool bool_value;
+        std::int64_t int_value;
+        std::uint64_t uint_value;
+        double double_value{0};
+    };
+    // Bytes of a string or an extension, items of an array, members of a map
+    std::size_t size{0};
+    // Data of a string or an extension, the first item of an array or a map
+    const char* payload{nullptr};
+};
+
+/// Decodes the header at `pos`, std::nullopt on malformed or truncated data.
+/// The data of strings and extensions is checked to fit into the buffer.
+std::optional<Element> TryReadElement(const char* pos, const char* end) noexcept;
+
+/// @throws ParseException on malformed or truncated data
+Element ReadElement(const char* pos, const char* end);
+
+/// Returns the position right after the value at `pos`, does not recurse
+/// @throws ParseException on malformed or truncated data
+const char* SkipElement(const char* pos, const char* end);
+
+}  // namespace formats::msgpack::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,23 @@
+#include <userver/formats/msgpack/serialize.hpp>
+
+#include <userver/formats/msgpack/string_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack {
+
+Value FromBinaryString(std::string_view binary) {
+    if (binary.empty()) throw ParseException("Empty MessagePack document");
+    const char* data = binary.data();
+    return Value{data, data + binary.size(), data};
+}
+
+std::string ToBinaryString(const formats::json::Value& value) {
+    StringBuilder sw;
+    sw.WriteValue(value);
+    return sw.GetString();
+}
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
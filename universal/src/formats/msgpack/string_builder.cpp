@@ -0,0 +1,242 @@
+#include <userver/formats/msgpack/string_builder.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/msgpack/exception.hpp>
+#include <userver/formats/msgpack/value.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime/rfc3339.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack {
+
+namespace {
+
+// Placeholder of a map32/array32 header: type byte and 4 bytes of size
+constexpr std::size_t kContainerHeaderSize = 5;
+
+template <typename T>
+void StoreBigEndian(char* pos, T value) noexcept {
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        pos[i] = static_cast<char>(value >> (8 * (sizeof(T) - 1 - i)));
+    }
+}
+
+template <typename T>
+void Append(std::string& buffer, unsigned char type, T value) {
+    char data[1 + sizeof(T)];
+    data[0] = static_cast<char>(type);
+    StoreBigEndian(data + 1, value);
+    buffer.append(data, sizeof(data));
+}
+
+void AppendByte(std::string& buffer, unsigned char byte) { buffer.push_back(static_cast<char>(byte)); }
+
+void AppendString(std::string& buffer, std::string_view value) {
+    const auto size = value.size();
+    if (size <= 31) {
+        AppendByte(buffer, 0xa0 | size);
+    } else if (size <= std::numeric_limits<std::uint8_t>::max()) {
+        Append(buffer, 0xd9, static_cast<std::uint8_t>(size));
+    } else if (size <= std::numeric_limits<std::uint16_t>::max()) {
+        Append(buffer, 0xda, static_cast<std::uint16_t>(size));
+    } else if (size <= std::numeric_limits<std::uint32_t>::max()) {
+        Append(buffer, 0xdb, static_cast<std::uint32_t>(size));
+    } else {
+        throw Exception("String of " + std::to_string(size) + " bytes is too long for MessagePack");
+    }
+    buffer.append(value);
+}
+
+}  // namespace
+
+StringBuilder::StringBuilder() = default;
+
+StringBuilder::~StringBuilder() = default;
+
+std::string_view StringBuilder::GetStringView() const { return buffer_; }
+
+std::string StringBuilder::GetString() const { return buffer_; }
+
+void StringBuilder::WriteNull() {
+    OnValue();
+    AppendByte(buffer_, 0xc0);
+}
+
+void StringBuilder::WriteString(std::string_view value) {
+    OnValue();
+    AppendString(buffer_, value);
+}
+
+void StringBuilder::WriteBool(bool value) {
+    OnValue();
+    AppendByte(buffer_, value ? 0xc3 : 0xc2);
+}
+
+void StringBuilder::WriteInt64(int64_t value) {
+    if (value >= 0) {
+        WriteUInt64(static_cast<std::uint64_t>(value));
+        return;
+    }
+
+    OnValue();
+    if (value >= -32) {
+        AppendByte(buffer_, static_cast<unsigned char>(value));
+    } else if (value >= std::numeric_limits<std::int8_t>::min()) {
+        Append(buffer_, 0xd0, static_cast<std::int8_t>(value));
+    } else if (value >= std::numeric_limits<std::int16_t>::min()) {
+        Append(buffer_, 0xd1, static_cast<std::int16_t>(value));
+    } else if (value >= std::numeric_limits<std::int32_t>::min()) {
+        Append(buffer_, 0xd2, static_cast<std::int32_t>(value));
+    } else {
+        Append(buffer_, 0xd3, value);
+    }
+}
+
+void StringBuilder::WriteUInt64(uint64_t value) {
+    OnValue();
+    if (value <= 0x7f) {
+        AppendByte(buffer_, static_cast<unsigned char>(value));
+    } else if (value <= std::numeric_limits<std::uint8_t>::max()) {
+        Append(buffer_, 0xcc, static_cast<std::uint8_t>(value));
+    } else if (value <= std::numeric_limits<std::uint16_t>::max()) {
+        Append(buffer_, 0xcd, static_cast<std::uint16_t>(value));
+    } else if (value <= std::numeric_limits<std::uint32_t>::max()) {
+        Append(buffer_, 0xce, static_cast<std::uint32_t>(value));
+    } else {
+        Append(buffer_, 0xcf, value);
+    }
+}
+
+void StringBuilder::WriteDouble(double value) {
+    OnValue();
+    // float32 is used when it represents the value exactly
+    if (std::abs(value) <= std::numeric_limits<float>::max() && static_cast<float>(value) == value) {
+        const auto narrowed = static_cast<float>(value);
+        std::uint32_t bits = 0;
+        std::memcpy(&bits, &narrowed, sizeof(bits));
+        Append(buffer_, 0xca, bits);
+    } else {
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        Append(buffer_, 0xcb, bits);
+    }
+}
+
+void StringBuilder::Key(std::string_view key) {
+    UASSERT_MSG(!containers_.empty() && containers_.back().is_object, "Key() is only allowed inside an object");
+    ++containers_.back().size;
+    AppendString(buffer_, key);
+}
+
+void StringBuilder::WriteValue(const formats::json::Value& value) { WriteJson(value); }
+
+void StringBuilder::WriteValue(const formats::msgpack::Value& value) {
+    OnValue();
+    buffer_.append(value.GetBinaryView());
+}
+
+void StringBuilder::OnValue() {
+    if (!containers_.empty() && !containers_.back().is_object) ++containers_.back().size;
+}
+
+void StringBuilder::StartContainer(bool is_object) {
+    OnValue();
+    containers_.push_back({buffer_.size(), 0, is_object});
+    buffer_.append(kContainerHeaderSize, '\0');
+}
+
+void StringBuilder::EndContainer() {
+    UASSERT(!containers_.empty());
+    const auto container = containers_.back();
+    containers_.pop_back();
+
+    // Shrinking moves the container data, deep nesting of the large containers
+    // pays for it on each level
+    char* header = buffer_.data() + container.header_offset;
+    if (container.size <= 15) {
+        header[0] = static_cast<char>((container.is_object ? 0x80 : 0x90) | container.size);
+        buffer_.erase(container.header_offset + 1, kContainerHeaderSize - 1);
+    } else if (container.size <= std::numeric_limits<std::uint16_t>::max()) {
+        header[0] = static_cast<char>(container.is_object ? 0xde : 0xdc);
+        StoreBigEndian(header + 1, static_cast<std::uint16_t>(container.size));
+        buffer_.erase(container.header_offset + 3, kContainerHeaderSize - 3);
+    } else {
+        header[0] = static_cast<char>(container.is_object ? 0xdf : 0xdd);
+        StoreBigEndian(header + 1, static_cast<std::uint32_t>(container.size));
+    }
+}
+
+void StringBuilder::WriteJson(const formats::json::Value& value) {
+    // Integral doubles are written as integers, they are still parsed as
+    // doubles
+    if (value.IsNull()) {
+        WriteNull();
+    } else if (value.IsBool()) {
+        WriteBool(value.As<bool>());
+    } else if (value.IsInt64()) {
+        WriteInt64(value.As<std::int64_t>());
+    } else if (value.IsUInt64()) {
+        WriteUInt64(value.As<std::uint64_t>());
+    } else if (value.IsDouble()) {
+        WriteDouble(value.As<double>());
+    } else if (value.IsString()) {
+        WriteString(value.As<std::string>());
+    } else if (value.IsArray()) {
+        const ArrayGuard guard{*this};
+        for (const auto& item : value) WriteJson(item);
+    } else {
+        const ObjectGuard guard{*this};
+        for (auto it = value.begin(); it != value.end(); ++it) {
+            Key(it.GetName());
+            WriteJson(*it);
+        }
+    }
+}
+
+StringBuilder::ObjectGuard::ObjectGuard(StringBuilder& sw) : sw_(sw) { sw_.StartContainer(true); }
+
+StringBuilder::ObjectGuard::~ObjectGuard() { sw_.EndContainer(); }
+
+StringBuilder::ArrayGuard::ArrayGuard(StringBuilder& sw) : sw_(sw) { sw_.StartContainer(false); }
+
+StringBuilder::ArrayGuard::~ArrayGuard() { sw_.EndContainer(); }
+
+void WriteToStream(bool value, StringBuilder& sw) { sw.WriteBool(value); }
+
+void WriteToStream(long long value, StringBuilder& sw) { sw.WriteInt64(value); }
+
+void WriteToStream(unsigned long long value, StringBuilder& sw) { sw.WriteUInt64(value); }
+
+void WriteToStream(int value, StringBuilder& sw) { sw.WriteInt64(value); }
+
+void WriteToStream(unsigned value, StringBuilder& sw) { sw.WriteUInt64(value); }
+
+void WriteToStream(long value, StringBuilder& sw) { sw.WriteInt64(value); }
+
+void WriteToStream(unsigned long value, StringBuilder& sw) { sw.WriteUInt64(value); }
+
+void WriteToStream(double value, StringBuilder& sw) { sw.WriteDouble(value); }
+
+void WriteToStream(const char* value, StringBuilder& sw) { sw.WriteString(value); }
+
+void WriteToStream(std::string_view value, StringBuilder& sw) { sw.WriteString(value); }
+
+void WriteToStream(const formats::json::Value& value, StringBuilder& sw) { sw.WriteValue(value); }
+
+void WriteToStream(const formats::msgpack::Value& value, StringBuilder& sw) { sw.WriteValue(value); }
+
+void WriteToStream(const std::string& value, StringBuilder& sw) { sw.WriteString(value); }
+
+void WriteToStream(std::chrono::system_clock::time_point tp, StringBuilder& sw) {
+    utils::datetime::Rfc3339Buffer buffer;
+    WriteToStream(utils::datetime::FormatRfc3339(tp, std::chrono::minutes{0}, buffer), sw);
+}
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/msgpack.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// [Sample formats::msgpack::StringBuilder usage]
+namespace my_namespace {
+
+struct Data {
+    int id;
+    std::vector<std::string> tags;
+    std::optional<double> score;
+};
+
+// The same WriteToStream may be a template over the StringBuilder to serve
+// both JSON and MessagePack
+void WriteToStream(const Data& data, formats::msgpack::StringBuilder& sw) {
+    const formats::msgpack::StringBuilder::ObjectGuard guard{sw};
+    sw.Key("id");
+    WriteToStream(data.id, sw);
+    sw.Key("tags");
+    WriteToStream(data.tags, sw);
+    if (data.score) {
+        sw.Key("score");
+        WriteToStream(*data.score, sw);
+    }
+}
+
+Data Parse(const formats::msgpack::Value& value, formats::parse::To<Data>) {
+    return Data{
+        value["id"].As<int>(),
+        value["tags"].As<std::vector<std::string>>(),
+        value["score"].As<std::optional<double>>(),
+    };
+}
+
+}  // namespace my_namespace
+
+TEST(FormatsMsgpackStringBuilder, ExampleUsage) {
+    const my_namespace::Data data{42, {"a", "b"}, 0.5};
+
+    formats::msgpack::StringBuilder sw;
+    WriteToStream(data, sw);
+    const std::string binary = sw.GetString();
+
+    const auto parsed = formats::msgpack::FromBinaryString(binary).As<my_namespace::Data>();
+    EXPECT_EQ(parsed.id, 42);
+    EXPECT_EQ(parsed.tags, data.tags);
+    EXPECT_EQ(parsed.score, 0.5);
+}
+/// [Sample formats::msgpack::StringBuilder usage]
+
+namespace {
+
+struct SerializeOnly {
+    int value;
+};
+
+formats::json::Value Serialize(const SerializeOnly& data, formats::serialize::To<formats::json::Value>) {
+    formats::json::ValueBuilder builder;
+    builder["value"] = data.value;
+    return builder.ExtractValue();
+}
+
+}  // namespace
+
+TEST(FormatsMsgpackStringBuilder, SerializeFallback) {
+    formats::msgpack::StringBuilder sw;
+    WriteToStream(std::map<std::string, SerializeOnly>{{"x", {1}}, {"y", {2}}}, sw);
+
+    const auto value = formats::msgpack::FromBinaryString(sw.GetStringView());
+    EXPECT_EQ(value["x"]["value"].As<int>(), 1);
+    EXPECT_EQ(value["y"]["value"].As<int>(), 2);
+}
+
+TEST(FormatsMsgpackStringBuilder, CompactEncoding) {
+    const auto encode = [](const auto& data) {
+        formats::msgpack::StringBuilder sw;
+        WriteToStream(data, sw);
+        return sw.GetString();
+    };
+
+    EXPECT_EQ(encode(1), "\x01");
+    EXPECT_EQ(encode(-1), "\xff");
+    EXPECT_EQ(encode(200), "\xcc\xc8");
+    EXPECT_EQ(encode(-200), std::string_view("\xd1\xff\x38", 3));
+    EXPECT_EQ(encode(1.5), std::string_view("\xca\x3f\xc0\x00\x00", 5));
+    EXPECT_EQ(encode(0.1).size(), 9u);
+    EXPECT_EQ(encode(std::string{"abc"}), "\xa3" "abc");
+    EXPECT_EQ(encode(std::vector<bool>{true, false}), "\x92\xc3\xc2");
+    EXPECT_EQ(encode(std::vector<int>{}), "\x90");
+
+    const auto array16 = encode(std::vector<int>(16, 1));
+    EXPECT_EQ(array16.size(), 3u + 16);
+    EXPECT_EQ(array16.substr(0, 3), std::string_view("\xdc\x00\x10", 3));
+
+    const auto array32 = encode(std::vector<int>(70000, 1));
+    EXPECT_EQ(array32.size(), 5u + 70000);
+    EXPECT_EQ(formats::msgpack::FromBinaryString(array32).GetSize(), 70000u);
+}
+
+TEST(FormatsMsgpackStringBuilder, Nested) {
+    formats::msgpack::StringBuilder sw;
+    {
+        const formats::msgpack::StringBuilder::ObjectGuard guard{sw};
+        for (int i = 0; i < 20; ++i) {
+            sw.Key(std::to_string(i));
+            const formats::msgpack::StringBuilder::ArrayGuard array_guard{sw};
+            for (int j = 0; j < i; ++j) sw.WriteInt64(j);
+        }
+    }
+
+    const auto value = formats::msgpack::FromBinaryString(sw.GetStringView());
+    ASSERT_EQ(value.GetSize(), 20u);
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_EQ(value[std::to_string(i)].GetSize(), static_cast<std::size_t>(i));
+    }
+    EXPECT_EQ(value["19"][18].As<int>(), 18);
+}
+
+TEST(FormatsMsgpackStringBuilder, CopyValue) {
+    const auto binary = formats::msgpack::ToBinaryString(formats::json::FromString(R"({"a": {"b": [1, 2]}})"));
+    const auto value = formats::msgpack::FromBinaryString(binary);
+
+    formats::msgpack::StringBuilder sw;
+    {
+        const formats::msgpack::StringBuilder::ArrayGuard guard{sw};
+        sw.WriteValue(value["a"]);
+        sw.WriteNull();
+    }
+
+    const auto copy = formats::msgpack::FromBinaryString(sw.GetStringView());
+    EXPECT_EQ(copy.GetSize(), 2u);
+    EXPECT_EQ(copy[0]["b"].As<std::vector<int>>(), (std::vector<int>{1, 2}));
+    EXPECT_TRUE(copy[1].IsNull());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,431 @@
+#include <userver/formats/msgpack/value.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include <userver/formats/common/path.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+#include <formats/msgpack/impl/reader.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack {
+
+namespace {
+
+constexpr char kNullValue[] = {'\xc0'};
+
+bool IsIntegral(const double val) {
+    double integral_part = NAN;
+    return modf(val, &integral_part) == 0.0;
+}
+
+constexpr std::int64_t kMaxIntDouble{std::int64_t{1} << std::numeric_limits<double>::digits};
+
+template <typename Int>
+bool IsNonOverflowingIntegral(const double val) {
+    if constexpr (sizeof(Int) >= sizeof(double)) {
+        const double min = std::is_signed_v<Int> ? -kMaxIntDouble : 0;
+        return val >= min && val < kMaxIntDouble && IsIntegral(val);
+    } else {
+        return val >= std::numeric_limits<Int>::min() && val <= std::numeric_limits<Int>::max() && IsIntegral(val);
+    }
+}
+
+template <typename Int>
+bool FitsInto(const impl::Element& element) noexcept {
+    switch (element.type) {
+        case impl::Type::kUInt:
+            return element.uint_value <= static_cast<std::uint64_t>(std::numeric_limits<Int>::max());
+        case impl::Type::kInt:
+            return std::is_signed_v<Int> && element.int_value >= std::numeric_limits<Int>::min();
+        case impl::Type::kDouble:
+            return IsNonOverflowingIntegral<Int>(element.double_value);
+        default:
+            return false;
+    }
+}
+
+bool IsType(const std::optional<impl::Element>& element, impl::Type type) noexcept {
+    return element && element->type == type;
+}
+
+// Walks from `pos` down to `target`, the buffer was already read up to
+// `target`, so a malformed buffer only cuts the path
+std::string FindPath(const char* pos, const char* end, const char* target) {
+    std::string path;
+    try {
+        while (pos != target) {
+            const auto element = impl::ReadElement(pos, end);
+            const char* item = element.payload;
+            const char* child = nullptr;
+
+            if (element.type == impl::Type::kArray) {
+                for (std::size_t i = 0; i < element.size && !child; ++i) {
+                    const char* next = impl::SkipElement(item, end);
+                    if (target < next) {
+                        common::AppendPath(path, i);
+                        child = item;
+                    }
+                    item = next;
+                }
+            } else if (element.type == impl::Type::kObject) {
+                for (std::size_t i = 0; i < element.size && !child; ++i) {
+                    const auto key = impl::ReadElement(item, end);
+                    const char* value = impl::SkipElement(item, end);
+                    const char* next = impl::SkipElement(value, end);
+                    if (target < next) {
+                        common::AppendPath(
+                            path,
+                            key.type == impl::Type::kString ? std::string_view{key.payload, key.size}
+                                                            : std::string_view{"<non-string key>"}
+                        );
+                        child = value;
+                    }
+                    item = next;
+                }
+            }
+
+            if (!child) break;
+            pos = child;
+        }
+    } catch (const ParseException&) {
+        // the path is only used for diagnostics
+    }
+    return path.empty() ? std::string{common::kPathRoot} : path;
+}
+
+}  // namespace
+
+Value::Value() noexcept : root_(kNullValue), end_(kNullValue + 1), pos_(kNullValue) {}
+
+Value::Value(const char* root, const char* end, const char* pos) noexcept : root_(root), end_(end), pos_(pos) {}
+
+Value::Value(const Value& parent, std::string_view missing_key)
+    : root_(parent.root_),
+      end_(parent.end_),
+      missing_parent_(parent.IsMissing() ? parent.missing_parent_ : parent.pos_),
+      missing_path_(common::MakeChildPath(parent.missing_path_, missing_key)) {}
+
+Value Value::operator[](std::string_view key) const {
+    if (IsMissing()) return Value{*this, key};
+
+    const auto element = GetElement();
+    if (element.type == impl::Type::kNull) return Value{*this, key};
+    if (element.type != impl::Type::kObject) ThrowTypeMismatch(impl::NameForType(impl::Type::kObject));
+
+    const char* item = element.payload;
+    for (std::size_t i = 0; i < element.size; ++i) {
+        const auto key_element = impl::ReadElement(item, end_);
+        const bool is_string = (key_element.type == impl::Type::kString);
+        const char* value = is_string ? key_element.payload + key_element.size : impl::SkipElement(item, end_);
+        if (is_string && std::string_view{key_element.payload, key_element.size} == key) {
+            return Value{root_, end_, value};
+        }
+        item = impl::SkipElement(value, end_);
+    }
+    return Value{*this, key};
+}
+
+Value Value::operator[](std::size_t index) const {
+    const auto element = GetElement();
+    if (element.type != impl::Type::kArray) ThrowTypeMismatch(impl::NameForType(impl::Type::kArray));
+    if (index >= element.size) throw OutOfBoundsException(index, element.size, GetPath());
+
+    const char* item = element.payload;
+    for (std::size_t i = 0; i < index; ++i) item = impl::SkipElement(item, end_);
+    return Value{root_, end_, item};
+}
+
+Value::const_iterator Value::begin() const {
+    CheckObjectOrArrayOrNull();
+    const auto element = GetElement();
+    if (element.type == impl::Type::kNull) return const_iterator{*this, 0};
+    return const_iterator{*this, element.payload, element.size, element.type == impl::Type::kObject};
+}
+
+Value::const_iterator Value::end() const { return const_iterator{*this, GetContainerSize()}; }
+
+bool Value::IsEmpty() const { return GetContainerSize() == 0; }
+
+std::size_t Value::GetSize() const { return GetContainerSize(); }
+
+bool Value::IsMissing() const noexcept { return pos_ == nullptr; }
+
+bool Value::IsNull() const noexcept { return !IsMissing() && pos_ < end_ && *pos_ == kNullValue[0]; }
+
+bool Value::IsBool() const noexcept {
+    return !IsMissing() && IsType(impl::TryReadElement(pos_, end_), impl::Type::kBool);
+}
+
+bool Value::IsInt() const noexcept {
+    if (IsMissing()) return false;
+    const auto element = impl::TryReadElement(pos_, end_);
+    return element && FitsInto<int>(*element);
+}
+
+bool Value::IsInt64() const noexcept {
+    if (IsMissing()) return false;
+    const auto element = impl::TryReadElement(pos_, end_);
+    return element && FitsInto<std::int64_t>(*element);
+}
+
+bool Value::IsUInt64() const noexcept {
+    if (IsMissing()) return false;
+    const auto element = impl::TryReadElement(pos_, end_);
+    if (!element) return false;
+    return element->type == impl::Type::kUInt ||
+           (element->type == impl::Type::kDouble && IsNonOverflowingIntegral<std::uint64_t>(element->double_value));
+}
+
+bool Value::IsDouble() const noexcept {
+    if (IsMissing()) return false;
+    const auto element = impl::TryReadElement(pos_, end_);
+    if (!element) return false;
+    return element->type == impl::Type::kDouble || element->type == impl::Type::kInt ||
+           element->type == impl::Type::kUInt;
+}
+
+bool Value::IsString() const noexcept {
+    return !IsMissing() && IsType(impl::TryReadElement(pos_, end_), impl::Type::kString);
+}
+
+bool Value::IsArray() const noexcept {
+    return !IsMissing() && IsType(impl::TryReadElement(pos_, end_), impl::Type::kArray);
+}
+
+bool Value::IsObject() const noexcept {
+    return !IsMissing() && IsType(impl::TryReadElement(pos_, end_), impl::Type::kObject);
+}
+
+bool Value::HasMember(std::string_view key) const {
+    CheckObjectOrNull();
+    return !(*this)[key].IsMissing();
+}
+
+std::string Value::GetPath() const {
+    if (IsMissing()) {
+        return common::MakeChildPath(FindPath(root_, end_, missing_parent_), missing_path_);
+    }
+    return FindPath(root_, end_, pos_);
+}
+
+std::string_view Value::GetBinaryView() const {
+    CheckNotMissing();
+    const char* end = impl::SkipElement(pos_, end_);
+    return {pos_, static_cast<std::size_t>(end - pos_)};
+}
+
+void Value::CheckNotMissing() const {
+    if (IsMissing()) throw MemberMissingException(GetPath());
+}
+
+void Value::CheckArrayOrNull() const {
+    if (!IsArray() && !IsNull()) ThrowTypeMismatch(impl::NameForType(impl::Type::kArray));
+}
+
+void Value::CheckObjectOrNull() const {
+    if (!IsObject() && !IsNull()) ThrowTypeMismatch(impl::NameForType(impl::Type::kObject));
+}
+
+void Value::CheckObject() const {
+    if (!IsObject()) ThrowTypeMismatch(impl::NameForType(impl::Type::kObject));
+}
+
+void Value::CheckObjectOrArrayOrNull() const {
+    if (!IsObject() && !IsArray() && !IsNull()) ThrowTypeMismatch("array or object");
+}
+
+void Value::CheckInBounds(std::size_t index) const {
+    CheckArrayOrNull();
+    const auto size = GetContainerSize();
+    if (index >= size) throw OutOfBoundsException(index, size, GetPath());
+}
+
+bool Value::IsRoot() const noexcept { return pos_ == root_; }
+
+impl::Element Value::GetElement() const {
+    CheckNotMissing();
+    return impl::ReadElement(pos_, end_);
+}
+
+std::string_view Value::GetTypeName() const noexcept {
+    if (IsMissing()) return "missing";
+    const auto element = impl::TryReadElement(pos_, end_);
+    return element ? impl::NameForType(element->type) : "malformed";
+}
+
+void Value::ThrowTypeMismatch(std::string_view expected) const {
+    // Malformed data is reported as such rather than as a wrong type
+    static_cast<void>(GetElement());
+    throw TypeMismatchException(GetTypeName(), expected, GetPath());
+}
+
+std::size_t Value::GetContainerSize() const {
+    CheckObjectOrArrayOrNull();
+    const auto element = GetElement();
+    return element.type == impl::Type::kNull ? 0 : element.size;
+}
+
+Iterator::Iterator(const Value& container, const char* first, std::size_t size, bool is_object)
+    : container_(container.pos_),
+      current_(container.root_, container.end_, nullptr),
+      size_(size),
+      is_object_(is_object) {
+    if (size_ > 0) Load(first);
+}
+
+Iterator::Iterator(const Value& container, std::size_t size)
+    : container_(container.pos_), current_(container.root_, container.end_, nullptr), index_(size), size_(size) {}
+
+Iterator& Iterator::operator++() {
+    ++index_;
+    if (index_ < size_) Load(impl::SkipElement(current_.pos_, current_.end_));
+    return *this;
+}
+
+Iterator Iterator::operator++(int) {
+    auto copy = *this;
+    ++*this;
+    return copy;
+}
+
+std::string Iterator::GetName() const {
+    if (!is_object_) {
+        const Value container{current_.root_, current_.end_, container_};
+        container.ThrowTypeMismatch(impl::NameForType(impl::Type::kObject));
+    }
+
+    const auto key = impl::ReadElement(key_, current_.end_);
+    if (key.type != impl::Type::kString) {
+        throw TypeMismatchException(
+            impl::NameForType(key.type), impl::NameForType(impl::Type::kString), current_.GetPath()
+        );
+    }
+    return std::string{key.payload, key.size};
+}
+
+std::size_t Iterator::GetIndex() const {
+    if (is_object_) {
+        const Value container{current_.root_, current_.end_, container_};
+        container.ThrowTypeMismatch(impl::NameForType(impl::Type::kArray));
+    }
+    return index_;
+}
+
+void Iterator::Load(const char* pos) {
+    if (is_object_) {
+        key_ = pos;
+        pos = impl::SkipElement(pos, current_.end_);
+    }
+    current_.pos_ = pos;
+}
+
+bool Parse(const Value& value, parse::To<bool>) {
+    const auto element = value.GetElement();
+    if (element.type == impl::Type::kBool) return element.bool_value;
+    value.ThrowTypeMismatch(impl::NameForType(impl::Type::kBool));
+}
+
+std::int64_t Parse(const Value& value, parse::To<std::int64_t>) {
+    const auto element = value.GetElement();
+    if (FitsInto<std::int64_t>(element)) {
+        switch (element.type) {
+            case impl::Type::kInt:
+                return element.int_value;
+            case impl::Type::kUInt:
+                return static_cast<std::int64_t>(element.uint_value);
+            default:
+                return static_cast<std::int64_t>(element.double_value);
+        }
+    }
+    value.ThrowTypeMismatch(impl::NameForType(impl::Type::kInt));
+}
+
+std::uint64_t Parse(const Value& value, parse::To<std::uint64_t>) {
+    const auto element = value.GetElement();
+    if (element.type == impl::Type::kUInt) return element.uint_value;
+    if (element.type == impl::Type::kDouble && IsNonOverflowingIntegral<std::uint64_t>(element.double_value)) {
+        return static_cast<std::uint64_t>(element.double_value);
+    }
+    value.ThrowTypeMismatch(impl::NameForType(impl::Type::kUInt));
+}
+
+double Parse(const Value& value, parse::To<double>) {
+    const auto element = value.GetElement();
+    switch (element.type) {
+        case impl::Type::kDouble:
+            return element.double_value;
+        case impl::Type::kInt:
+            return static_cast<double>(element.int_value);
+        case impl::Type::kUInt:
+            return static_cast<double>(element.uint_value);
+        default:
+            value.ThrowTypeMismatch(impl::NameForType(impl::Type::kDouble));
+    }
+}
+
+std::string Parse(const Value& value, parse::To<std::string>) {
+    return std::string{Parse(value, parse::To<std::string_view>{})};
+}
+
+std::string_view Parse(const Value& value, parse::To<std::string_view>) {
+    const auto element = value.GetElement();
+    if (element.type == impl::Type::kString) return {element.payload, element.size};
+    value.ThrowTypeMismatch(impl::NameForType(impl::Type::kString));
+}
+
+namespace {
+
+formats::json::ValueBuilder ToJson(const Value& value, std::size_t depth) {
+    if (depth >= formats::json::kDepthParseLimit) {
+        throw ParseException(
+            "Exceeded maximum allowed JSON depth of: " + std::to_string(formats::json::kDepthParseLimit)
+        );
+    }
+
+    if (value.IsArray()) {
+        formats::json::ValueBuilder builder{formats::common::Type::kArray};
+        for (const auto& item : value) builder.PushBack(ToJson(item, depth + 1));
+        return builder;
+    }
+    if (value.IsObject()) {
+        formats::json::ValueBuilder builder{formats::common::Type::kObject};
+        for (auto it = value.begin(); it != value.end(); ++it) builder[it.GetName()] = ToJson(*it, depth + 1);
+        return builder;
+    }
+    return value.As<formats::json::Value>();
+}
+
+}  // namespace
+
+formats::json::Value Parse(const Value& value, parse::To<formats::json::Value>) {
+    const auto element = value.GetElement();
+    switch (element.type) {
+        case impl::Type::kNull:
+            return {};
+        case impl::Type::kBool:
+            return formats::json::ValueBuilder{element.bool_value}.ExtractValue();
+        case impl::Type::kInt:
+            return formats::json::ValueBuilder{element.int_value}.ExtractValue();
+        case impl::Type::kUInt:
+            return formats::json::ValueBuilder{element.uint_value}.ExtractValue();
+        case impl::Type::kDouble:
+            return formats::json::ValueBuilder{element.double_value}.ExtractValue();
+        case impl::Type::kString:
+            return formats::json::ValueBuilder{std::string_view{element.payload, element.size}}.ExtractValue();
+        case impl::Type::kArray:
+        case impl::Type::kObject:
+            return ToJson(value, 0).ExtractValue();
+        case impl::Type::kExtension:
+            break;
+    }
+    value.ThrowTypeMismatch("JSON compatible type");
+}
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/msgpack.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+formats::json::Value BuildDocument(std::size_t items) {
+    formats::json::ValueBuilder builder{formats::common::Type::kArray};
+    for (std::size_t i = 0; i < items; ++i) {
+        formats::json::ValueBuilder item;
+        item["id"] = i;
+        item["name"] = "item-" + std::to_string(i);
+        item["score"] = static_cast<double>(i) / 3;
+        item["tags"].PushBack("tag");
+        item["tags"].PushBack("other-tag");
+        builder.PushBack(std::move(item));
+    }
+    return builder.ExtractValue();
+}
+
+struct Item {
+    std::size_t id;
+    std::string name;
+    double score;
+    std::vector<std::string> tags;
+};
+
+template <typename Value>
+Item Parse(const Value& value, formats::parse::To<Item>) {
+    return Item{
+        value["id"].template As<std::size_t>(),
+        value["name"].template As<std::string>(),
+        value["score"].template As<double>(),
+        value["tags"].template As<std::vector<std::string>>(),
+    };
+}
+
+}  // namespace
+
+void MsgpackParseItems(benchmark::State& state) {
+    const auto binary = formats::msgpack::ToBinaryString(BuildDocument(state.range(0)));
+    for ([[maybe_unused]] auto _ : state) {
+        auto items = formats::msgpack::FromBinaryString(binary).As<std::vector<Item>>();
+        benchmark::DoNotOptimize(items);
+    }
+    state.SetBytesProcessed(state.iterations() * binary.size());
+}
+BENCHMARK(MsgpackParseItems)->RangeMultiplier(8)->Range(1, 4096);
+
+void JsonParseItems(benchmark::State& state) {
+    const auto json = formats::json::ToString(BuildDocument(state.range(0)));
+    for ([[maybe_unused]] auto _ : state) {
+        auto items = formats::json::FromString(json).As<std::vector<Item>>();
+        benchmark::DoNotOptimize(items);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(JsonParseItems)->RangeMultiplier(8)->Range(1, 4096);
+
+void MsgpackSingleMember(benchmark::State& state) {
+    const auto binary = formats::msgpack::ToBinaryString(BuildDocument(state.range(0)));
+    const auto last = static_cast<std::size_t>(state.range(0) - 1);
+    for ([[maybe_unused]] auto _ : state) {
+        auto name = formats::msgpack::FromBinaryString(binary)[last]["name"].As<std::string_view>();
+        benchmark::DoNotOptimize(name);
+    }
+}
+BENCHMARK(MsgpackSingleMember)->RangeMultiplier(8)->Range(1, 4096);
+
+void MsgpackSerializeItems(benchmark::State& state) {
+    const auto json = BuildDocument(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        auto binary = formats::msgpack::ToBinaryString(json);
+        benchmark::DoNotOptimize(binary);
+    }
+}
+BENCHMARK(MsgpackSerializeItems)->RangeMultiplier(8)->Range(1, 4096);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/msgpack.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string FromJsonString(std::string_view json) {
+    return formats::msgpack::ToBinaryString(formats::json::FromString(json));
+}
+
+}  // namespace
+
+TEST(FormatsMsgpack, ExampleUsage) {
+    const auto binary = FromJsonString(R"({"key1": 1, "key2": {"key3": "val"}})");
+
+    /// [Sample formats::msgpack::Value usage]
+    // #include <userver/formats/msgpack.hpp>
+
+    // `binary` must outlive the value, the data is not copied
+    formats::msgpack::Value value = formats::msgpack::FromBinaryString(binary);
+
+    const auto key1 = value["key1"].As<int>();
+    ASSERT_EQ(key1, 1);
+
+    const auto key3 = value["key2"]["key3"].As<std::string_view>();
+    ASSERT_EQ(key3, "val");
+    /// [Sample formats::msgpack::Value usage]
+}
+
+namespace my_namespace {
+
+struct MyKeyValue {
+    std::string field1;
+    int field2;
+};
+
+// Templated parser works for any of the formats
+template <typename Value>
+MyKeyValue Parse(const Value& value, formats::parse::To<MyKeyValue>) {
+    return MyKeyValue{
+        value["field1"].template As<std::string>(""),
+        value["field2"].template As<int>(1),
+    };
+}
+
+TEST(FormatsMsgpack, TemplatedParse) {
+    const auto binary = FromJsonString(R"({"a": {"field1": "one"}, "b": [{"field1": "two", "field2": 2}]})");
+    const auto value = formats::msgpack::FromBinaryString(binary);
+
+    const auto a = value["a"].As<MyKeyValue>();
+    EXPECT_EQ(a.field1, "one");
+    EXPECT_EQ(a.field2, 1);
+
+    const auto b = value["b"].As<std::vector<MyKeyValue>>();
+    ASSERT_EQ(b.size(), 1u);
+    EXPECT_EQ(b[0].field1, "two");
+    EXPECT_EQ(b[0].field2, 2);
+}
+
+}  // namespace my_namespace
+
+TEST(FormatsMsgpack, Types) {
+    const auto binary = FromJsonString(
+        R"({"null": null, "bool": true, "int": -5, "uint": 18446744073709551615, "double": 1.5,)"
+        R"( "string": "str", "array": [1, 2], "object": {}})"
+    );
+    const auto value = formats::msgpack::FromBinaryString(binary);
+
+    EXPECT_TRUE(value.IsObject());
+    EXPECT_TRUE(value.IsRoot());
+    EXPECT_EQ(value.GetSize(), 8u);
+
+    EXPECT_TRUE(value["null"].IsNull());
+    EXPECT_TRUE(value["bool"].As<bool>());
+    EXPECT_EQ(value["int"].As<int>(), -5);
+    EXPECT_TRUE(value["int"].IsInt64());
+    EXPECT_FALSE(value["int"].IsUInt64());
+    EXPECT_EQ(value["uint"].As<std::uint64_t>(), 18446744073709551615ULL);
+    EXPECT_FALSE(value["uint"].IsInt64());
+    EXPECT_DOUBLE_EQ(value["double"].As<double>(), 1.5);
+    EXPECT_FALSE(value["double"].IsInt64());
+    EXPECT_DOUBLE_EQ(value["int"].As<double>(), -5);
+    EXPECT_EQ(value["string"].As<std::string>(), "str");
+    EXPECT_EQ(value["array"].As<std::vector<int>>(), (std::vector<int>{1, 2}));
+    EXPECT_TRUE(value["object"].IsEmpty());
+
+    EXPECT_TRUE(value["missing"].IsMissing());
+    EXPECT_EQ(value["missing"].As<int>(42), 42);
+    EXPECT_EQ(value["null"].As<std::optional<int>>(), std::nullopt);
+    EXPECT_FALSE(value.HasMember("missing"));
+    EXPECT_TRUE(value.HasMember("null"));
+
+    EXPECT_TRUE(formats::msgpack::Value{}.IsNull());
+}
+
+TEST(FormatsMsgpack, Containers) {
+    const auto binary = FromJsonString(R"({"a": [[1], [2, 3]], "b": {"x": "1", "y": "2"}})");
+    const auto value = formats::msgpack::FromBinaryString(binary);
+
+    EXPECT_EQ(value["a"].As<std::vector<std::vector<int>>>(), (std::vector<std::vector<int>>{{1}, {2, 3}}));
+    EXPECT_EQ(value["a"][1][1].As<int>(), 3);
+
+    const auto b = value["b"].As<std::map<std::string, std::string_view>>();
+    EXPECT_EQ(b, (std::map<std::string, std::string_view>{{"x", "1"}, {"y", "2"}}));
+
+    std::vector<std::string> keys;
+    for (const auto& [key, item] : formats::common::Items(value)) {
+        keys.push_back(key);
+        EXPECT_FALSE(item.IsMissing());
+    }
+    EXPECT_EQ(keys, (std::vector<std::string>{"a", "b"}));
+}
+
+TEST(FormatsMsgpack, Paths) {
+    const auto binary = FromJsonString(R"({"a": [{"b": 1}, {"c": "str"}]})");
+    const auto value = formats::msgpack::FromBinaryString(binary);
+
+    EXPECT_EQ(value.GetPath(), "/");
+    EXPECT_EQ(value["a"][1]["c"].GetPath(), "a[1].c");
+    EXPECT_EQ(value["a"][0]["x"]["y"].GetPath(), "a[0].x.y");
+
+    UEXPECT_THROW_MSG(
+        value["a"][1]["c"].As<int>(),
+        formats::msgpack::TypeMismatchException,
+        "Error at path 'a[1].c': Wrong type. Expected: int, actual: string"
+    );
+    UEXPECT_THROW_MSG(
+        value["a"][0]["x"].As<int>(), formats::msgpack::MemberMissingException, "Error at path 'a[0].x'"
+    );
+    UEXPECT_THROW_MSG(
+        value["a"][2], formats::msgpack::OutOfBoundsException, "Index 2 of array of size 2 is out of bounds"
+    );
+}
+
+TEST(FormatsMsgpack, Malformed) {
+    const auto binary = FromJsonString(R"({"key": "long long string", "other": [1, 2, 3]})");
+
+    UEXPECT_THROW(formats::msgpack::FromBinaryString({}), formats::msgpack::ParseException);
+    for (std::size_t size = 1; size < binary.size(); ++size) {
+        const auto value = formats::msgpack::FromBinaryString(std::string_view{binary}.substr(0, size));
+        UEXPECT_THROW(value["other"].As<std::vector<int>>(), formats::msgpack::ParseException) << size;
+    }
+
+    // 0xc1 is never used
+    UEXPECT_THROW(formats::msgpack::FromBinaryString("\xc1").As<int>(), formats::msgpack::ParseException);
+}
+
+TEST(FormatsMsgpack, DeepNesting) {
+    std::string binary(100000, '\x91');  // arrays of one item
+    binary += '\xc0';
+
+    const auto value = formats::msgpack::FromBinaryString(binary);
+    EXPECT_EQ(value.GetBinaryView().size(), binary.size());
+    UEXPECT_THROW(value.As<formats::json::Value>(), formats::msgpack::ParseException);
+}
+
+TEST(FormatsMsgpack, ToJson) {
+    const auto json = formats::json::FromString(
+        R"({"a": [1, -2, 3.5, "s", null, true], "b": {"c": {}}, "d": 18446744073709551615})"
+    );
+    const auto binary = formats::msgpack::ToBinaryString(json);
+    EXPECT_EQ(formats::msgpack::FromBinaryString(binary).As<formats::json::Value>(), json);
+    EXPECT_LT(binary.size(), formats::json::ToString(json).size());
+}
+
+USERVER_NAMESPACE_END
@@ -7,6 +7,7 @@
 #include <boost/intrusive/set_hook.hpp>
 
 #include <userver/logging/log.hpp>
+#include <userver/utils/token_bucket.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -34,6 +35,8 @@ struct LogEntryContent {
     const int line;
     const char* const path;
     LogEntryContentHook hook;
+    // Limits the records of the location when log sampling is enabled
+    mutable utils::TokenBucket sampling_bucket;
 };
 
 bool operator<(const LogEntryContent& x, const LogEntryContent& y) noexcept;
@@ -11,9 +11,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl::formatters {
 
-Json::Json(Level level, Format format, const utils::impl::SourceLocation& location) : format_(format) {
-    const auto now = std::chrono::system_clock::now();
-
+Json::Json(Level level, Format format, const utils::impl::SourceLocation& location, TimePoint now)
+    : format_(format) {
     object_.emplace(sb_);
 
     sb_.Key((format_ == Format::kJson) ? "timestamp" : "@timestamp");
@@ -6,13 +6,15 @@
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/level.hpp>
 
+#include <logging/timestamp.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl::formatters {
 
 class Json final : public Base {
 public:
-    explicit Json(Level level, Format format, const utils::impl::SourceLocation& source_location) noexcept(false);
+    Json(Level level, Format format, const utils::impl::SourceLocation& source_location, TimePoint now) noexcept(false);
 
     Json(const Json&) = delete;
 
@@ -16,11 +16,11 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl::formatters {
 
-Tskv::Tskv(Level level, Format format, const utils::impl::SourceLocation& location) : format_(format) {
+Tskv::Tskv(Level level, Format format, const utils::impl::SourceLocation& location, TimePoint now)
+    : format_(format) {
     switch (format) {
         case Format::kTskv: {
             constexpr std::string_view kTemplate = "tskv\ttimestamp=0000-00-00T00:00:00.000000\tlevel=";
-            const auto now = std::chrono::system_clock::now();
             const auto level_string = logging::ToUpperCaseString(level);
             item_.log_line.resize(kTemplate.size() + level_string.size());
             fmt::format_to(
@@ -41,7 +41,6 @@ Tskv::Tskv(Level level, Format format, const utils::impl::SourceLocation& locati
         }
         case Format::kLtsv: {
             constexpr std::string_view kTemplate = "timestamp:0000-00-00T00:00:00.000000\tlevel:";
-            const auto now = TimePoint::clock::now();
             const auto level_string = logging::ToUpperCaseString(level);
             item_.log_line.resize(kTemplate.size() + level_string.size());
             fmt::format_to(
@@ -72,10 +71,15 @@ Tskv::Tskv(Level level, Format format, const utils::impl::SourceLocation& locati
 void Tskv::AddTag(std::string_view key, const LogExtra::Value& value) {
     std::visit(
         [&, this](const auto& x) {
-            if constexpr (std::is_same_v<decltype(x), const std::string&>)
+            if constexpr (std::is_same_v<decltype(x), const std::string&>) {
                 DoAddTag(key, std::string_view{x}, false);
-            else
-                DoAddTag(key, fmt::to_string(x), true);
+            } else {
+                // Numbers need no escaping, shortest floating point formatting
+                // of fmt is used
+                fmt::basic_memory_buffer<char, 32> buffer;
+                fmt::format_to(std::back_inserter(buffer), FMT_COMPILE("{}"), x);
+                DoAddTag(key, std::string_view{buffer.data(), buffer.size()}, true);
+            }
         },
         value
     );
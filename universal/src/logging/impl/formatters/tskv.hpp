@@ -6,13 +6,15 @@
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/level.hpp>
 
+#include <logging/timestamp.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl::formatters {
 
 class Tskv final : public Base {
 public:
-    Tskv(Level level, Format format, const utils::impl::SourceLocation& source_location);
+    Tskv(Level level, Format format, const utils::impl::SourceLocation& source_location, TimePoint now);
 
     void AddTag(std::string_view key, const LogExtra::Value& value) override;
 
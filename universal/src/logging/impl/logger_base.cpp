@@ -27,16 +27,24 @@ void LoggerBase::ForwardTo(LoggerBase*) {}
 bool LoggerBase::DoShouldLog(Level /*level*/) const noexcept { return true; }
 
 formatters::BasePtr TextLogger::MakeFormatter(Level level, LogClass, const utils::impl::SourceLocation& location) {
+    return MakeTextFormatter(level, location, std::chrono::system_clock::now());
+}
+
+formatters::BasePtr TextLogger::MakeTextFormatter(
+    Level level,
+    const utils::impl::SourceLocation& location,
+    std::chrono::system_clock::time_point time
+) const {
     auto format = GetFormat();
     switch (format) {
         case Format::kLtsv:
         case Format::kTskv:
         case Format::kRaw:
-            return std::make_unique<formatters::Tskv>(level, format, location);
+            return std::make_unique<formatters::Tskv>(level, format, location, time);
 
         case Format::kJson:
         case Format::kJsonYaDeploy:
-            return std::make_unique<formatters::Json>(level, format, location);
+            return std::make_unique<formatters::Json>(level, format, location, time);
 
         case Format::kStruct:
             UINVARIANT(false, "Invalid logger type");
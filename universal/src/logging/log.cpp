@@ -3,6 +3,7 @@
 #include <utility>
 
 #include <logging/dynamic_debug.hpp>
+#include <logging/log_sampling.hpp>
 #include <logging/rate_limit.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/null_logger.hpp>
@@ -136,6 +137,7 @@ LogHelper& operator<<(LogHelper& lh, const RateLimiter& rl) noexcept {
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
 StaticLogEntry::StaticLogEntry(const char* path, int line) noexcept {
     static_assert(sizeof(LogEntryContent) == sizeof(content_));
+    static_assert(alignof(LogEntryContent) <= alignof(StaticLogEntry));
     // static_assert(std::is_trivially_destructible_v<LogEntryContent>);
     auto* item = new (&content_) LogEntryContent(path, line);
     RegisterLogLocation(*item);
@@ -146,7 +148,9 @@ bool StaticLogEntry::ShouldNotLog(logging::LoggerRef logger, logging::Level leve
     const auto state = content.state.load();
     const bool force_disabled = level < state.force_disabled_level_plus_one;
     const bool force_enabled = level >= state.force_enabled_level && level != logging::Level::kNone;
-    return (!LoggerShouldLog(logger, level) || force_disabled) && !force_enabled;
+    if (force_enabled) return false;
+    if (force_disabled || !LoggerShouldLog(logger, level)) return true;
+    return IsLogSampledOut(content, level);
 }
 
 bool StaticLogEntry::ShouldNotLog(const logging::LoggerPtr& logger, logging::Level level) const noexcept {
@@ -60,6 +60,7 @@ LogExtra& LogExtra::operator=(LogExtra&&) = default;
 LogExtra& LogExtra::operator=(const LogExtra&) = default;
 
 LogExtra::LogExtra(std::initializer_list<Pair> initial, ExtendType extend_type) {
+    extra_->reserve(initial.size());
     ExtendRange(initial.begin(), initial.end(), extend_type);
 }
 
@@ -76,10 +77,21 @@ void LogExtra::Extend(std::initializer_list<Pair> extra, ExtendType extend_type)
 }
 
 void LogExtra::Extend(const LogExtra& extra) {
-    if (extra_->empty())
+    if (extra_->empty()) {
         extra_ = extra.extra_;
-    else
-        ExtendRange(extra.extra_->begin(), extra.extra_->end());
+        return;
+    }
+
+    // Keys of `extra` are already checked. Values are copy-assigned in place,
+    // reusing the memory of replaced strings, frozen ones are not copied at all.
+    for (const auto& [key, value] : *extra.extra_) {
+        auto* it = Find(key);
+        if (!it) {
+            extra_->emplace_back(key, value);
+        } else {
+            it->second = value;
+        }
+    }
 }
 
 void LogExtra::Extend(LogExtra&& extra) {
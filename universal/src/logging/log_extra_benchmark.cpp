@@ -0,0 +1,48 @@
+#include <userver/logging/log_extra.hpp>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Tags that a typical request span carries and passes to its children
+logging::LogExtra MakeSpanTags() {
+    return {
+        {"link", "0123456789abcdef0123456789abcdef"},
+        {"meta_type", "/v1/handler"},
+        {"http_url", "http://example.com/v1/handler?arg=value"},
+        {"method", "POST"},
+        {"meta_code", 200},
+    };
+}
+
+}  // namespace
+
+void log_extra_construct(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(MakeSpanTags());
+    }
+}
+BENCHMARK(log_extra_construct);
+
+void log_extra_copy(benchmark::State& state) {
+    const auto tags = MakeSpanTags();
+    for ([[maybe_unused]] auto _ : state) {
+        logging::LogExtra copy{tags};
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(log_extra_copy);
+
+void log_extra_extend_non_empty(benchmark::State& state) {
+    const auto tags = MakeSpanTags();
+    auto target = MakeSpanTags();
+    for ([[maybe_unused]] auto _ : state) {
+        target.Extend(tags);
+        benchmark::DoNotOptimize(target);
+    }
+}
+BENCHMARK(log_extra_extend_non_empty);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#include <logging/log_sampling.hpp>
+
+#include <atomic>
+#include <chrono>
+
+#include <logging/dynamic_debug.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+struct SamplingState final {
+    std::atomic<bool> enabled{false};
+    std::atomic<Level> max_level{Level::kInfo};
+    std::atomic<double> traces_percent{0};
+    std::atomic<double> queue_pressure_threshold{1};
+    std::atomic<TraceSampledInHook> trace_sampled_in_hook{nullptr};
+};
+
+SamplingState& GetSamplingState() noexcept {
+    static SamplingState state;
+    return state;
+}
+
+utils::TokenBucket::RefillPolicy MakeRefillPolicy(std::size_t per_second) {
+    if (per_second == 0) return {0, utils::TokenBucket::Duration::max()};
+    return {1, std::chrono::duration_cast<utils::TokenBucket::Duration>(std::chrono::seconds{1}) / per_second};
+}
+
+}  // namespace
+
+bool operator==(const LogSamplingSettings& a, const LogSamplingSettings& b) noexcept {
+    return a.max_level == b.max_level && a.burst == b.burst && a.per_second == b.per_second &&
+           a.traces_percent == b.traces_percent && a.queue_pressure_threshold == b.queue_pressure_threshold;
+}
+
+void SetTraceSampledInHook(TraceSampledInHook hook) noexcept { GetSamplingState().trace_sampled_in_hook = hook; }
+
+void EnableLogSampling(const LogSamplingSettings& settings) {
+    auto& state = GetSamplingState();
+    state.max_level = settings.max_level;
+    state.traces_percent = settings.traces_percent;
+    state.queue_pressure_threshold = settings.queue_pressure_threshold;
+
+    const auto refill_policy = MakeRefillPolicy(settings.per_second);
+    for (const auto& location : GetDynamicDebugLocations()) {
+        // Starts full
+        location.sampling_bucket = utils::TokenBucket{settings.burst, refill_policy};
+    }
+
+    state.enabled = true;
+}
+
+void DisableLogSampling() noexcept { GetSamplingState().enabled = false; }
+
+bool IsLogSamplingEnabled() noexcept { return GetSamplingState().enabled.load(std::memory_order_relaxed); }
+
+bool IsLogSampledOut(const LogEntryContent& location, Level level) noexcept {
+    const auto& state = GetSamplingState();
+    if (!state.enabled.load(std::memory_order_relaxed)) return false;
+    if (level > state.max_level.load(std::memory_order_relaxed)) return false;
+
+    const auto hook = state.trace_sampled_in_hook.load(std::memory_order_relaxed);
+    if (hook && hook(state.traces_percent.load(std::memory_order_relaxed))) return false;
+
+    return !location.sampling_bucket.Obtain();
+}
+
+bool IsDroppedUnderQueuePressure(Level level, double queue_fill_ratio) noexcept {
+    const auto& state = GetSamplingState();
+    if (!state.enabled.load(std::memory_order_relaxed)) return false;
+    if (level > state.max_level.load(std::memory_order_relaxed)) return false;
+
+    const auto threshold = state.queue_pressure_threshold.load(std::memory_order_relaxed);
+    if (queue_fill_ratio < threshold) return false;
+
+    // Lower levels go first
+    return level <= Level::kDebug || queue_fill_ratio >= (1 + threshold) / 2;
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging {
+
+struct LogEntryContent;
+
+namespace impl {
+
+struct LogSamplingSettings final {
+    // Records with a higher level are never sampled out
+    Level max_level{Level::kInfo};
+    // Each log location writes up to `burst` records at once and
+    // `per_second` records per second outside of the sampled in traces
+    std::size_t burst{100};
+    std::size_t per_second{10};
+    // All the records of the sampled in traces are written
+    double traces_percent{1.0};
+    // Queue fill ratio from which the async loggers drop DEBUG and TRACE
+    // records, records up to `max_level` are dropped from the half way between
+    // the threshold and the full queue
+    double queue_pressure_threshold{0.5};
+};
+
+bool operator==(const LogSamplingSettings& a, const LogSamplingSettings& b) noexcept;
+
+// Returns true if the current trace is selected to keep all of its logs
+using TraceSampledInHook = bool (*)(double traces_percent) noexcept;
+
+void SetTraceSampledInHook(TraceSampledInHook hook) noexcept;
+
+// Resets the per-location buckets of all the log locations
+void EnableLogSampling(const LogSamplingSettings& settings);
+
+void DisableLogSampling() noexcept;
+
+bool IsLogSamplingEnabled() noexcept;
+
+bool IsLogSampledOut(const LogEntryContent& location, Level level) noexcept;
+
+bool IsDroppedUnderQueuePressure(Level level, double queue_fill_ratio) noexcept;
+
+}  // namespace impl
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
@@ -50,6 +50,25 @@ const std::string& ToStringCachedFiltered(boost::stacktrace::frame frame) {
     return *ptr;
 }
 
+compiler::ThreadLocal local_function_name_cache = [] {
+    return cache::LruMap<boost::stacktrace::frame, std::string>{10000};
+};
+
+const std::string& FunctionNameCachedFiltered(boost::stacktrace::frame frame) {
+    auto function_name_cache = local_function_name_cache.Use();
+    auto* ptr = function_name_cache->Get(frame);
+    if (!ptr) {
+        auto name = frame.name();
+        if (name.empty()) {
+            name = fmt::format("{}", frame.address());
+        } else if (name.find(kStartOfCoroutine) != std::string::npos) {
+            name = {};
+        }
+        ptr = function_name_cache->Emplace(frame, std::move(name));
+    }
+    return *ptr;
+}
+
 }  // namespace
 
 std::string to_string(const boost::stacktrace::stacktrace& st) {
@@ -86,6 +105,14 @@ std::string to_string(const boost::stacktrace::stacktrace& st) {
     return res;
 }
 
+std::string frame_name(const boost::stacktrace::frame& frame) {
+    if (!stacktrace_enabled.load()) {
+        return "<unknown>";
+    }
+
+    return FunctionNameCachedFiltered(frame);
+}
+
 bool GlobalEnableStacktrace(bool enable) { return stacktrace_enabled.exchange(enable); }
 
 StacktraceGuard::StacktraceGuard(bool enabled) : old_(logging::stacktrace_cache::GlobalEnableStacktrace(enabled)) {}
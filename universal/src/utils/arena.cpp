@@ -0,0 +1,160 @@
+#include <userver/utils/arena.hpp>
+
+#include <new>
+#include <utility>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+struct Arena::Block final {
+    Block* next;
+    std::size_t size;
+};
+
+struct Arena::Destructor final {
+    void (*destroy)(void*) noexcept;
+    void* object;
+    Destructor* next;
+};
+
+namespace {
+
+constexpr std::size_t kDefaultBlockSize = 4096;
+
+// Allocations larger than that get a dedicated block, so that they do not
+// waste the rest of the current block
+constexpr std::size_t kMaxSmallAllocation = kDefaultBlockSize / 4;
+
+// Up to 256KiB per thread
+constexpr std::size_t kMaxCachedBlocks = 64;
+
+// Thread-local cache of free kDefaultBlockSize blocks
+class BlockCache final {
+public:
+    BlockCache() = default;
+
+    BlockCache(BlockCache&& other) noexcept
+        : head_(std::exchange(other.head_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+    ~BlockCache() {
+        while (void* block = TryPop()) ::operator delete(block);
+    }
+
+    void* TryPop() noexcept {
+        if (!head_) return nullptr;
+        --size_;
+        return std::exchange(head_, head_->next);
+    }
+
+    bool TryPush(void* block) noexcept {
+        if (size_ >= kMaxCachedBlocks) return false;
+        head_ = new (block) FreeBlock{head_};
+        ++size_;
+        return true;
+    }
+
+private:
+    struct FreeBlock final {
+        FreeBlock* next;
+    };
+
+    FreeBlock* head_{nullptr};
+    std::size_t size_{0};
+};
+
+compiler::ThreadLocal local_block_cache = [] { return BlockCache{}; };
+
+}  // namespace
+
+Arena::Arena(Arena&& other) noexcept
+    : blocks_(std::exchange(other.blocks_, nullptr)),
+      current_(std::exchange(other.current_, nullptr)),
+      end_(std::exchange(other.end_, nullptr)),
+      destructors_(std::exchange(other.destructors_, nullptr)),
+      allocated_bytes_(std::exchange(other.allocated_bytes_, 0)) {}
+
+Arena& Arena::operator=(Arena&& other) noexcept {
+    if (this == &other) return *this;
+
+    Reset();
+    blocks_ = std::exchange(other.blocks_, nullptr);
+    current_ = std::exchange(other.current_, nullptr);
+    end_ = std::exchange(other.end_, nullptr);
+    destructors_ = std::exchange(other.destructors_, nullptr);
+    allocated_bytes_ = std::exchange(other.allocated_bytes_, 0);
+    return *this;
+}
+
+Arena::~Arena() { Reset(); }
+
+void Arena::Reset() noexcept {
+    while (destructors_) {
+        auto* destructor = std::exchange(destructors_, destructors_->next);
+        destructor->destroy(destructor->object);
+    }
+
+    // Deallocation might happen on another thread than the allocation, it is
+    // fine: the blocks just migrate between the thread caches.
+    auto cache = local_block_cache.Use();
+    while (blocks_) {
+        auto* block = std::exchange(blocks_, blocks_->next);
+        if (block->size != kDefaultBlockSize || !cache->TryPush(block)) {
+            ::operator delete(block);
+        }
+    }
+
+    current_ = nullptr;
+    end_ = nullptr;
+    allocated_bytes_ = 0;
+}
+
+void* Arena::AllocateSlow(std::size_t size, std::size_t alignment) {
+    UASSERT_MSG(alignment != 0 && (alignment & (alignment - 1)) == 0, "alignment should be a power of 2");
+    UASSERT(alignment <= alignof(std::max_align_t));
+
+    static_assert(sizeof(Block) % alignof(std::max_align_t) == 0);
+
+    if (size > kMaxSmallAllocation) {
+        auto* block = new (::operator new(sizeof(Block) + size)) Block{nullptr, sizeof(Block) + size};
+        // Keep the current block first, so that the small allocations continue
+        // from it
+        if (blocks_) {
+            block->next = std::exchange(blocks_->next, block);
+        } else {
+            blocks_ = block;
+        }
+        allocated_bytes_ += size;
+        return reinterpret_cast<std::byte*>(block) + sizeof(Block);
+    }
+
+    void* memory = nullptr;
+    {
+        auto cache = local_block_cache.Use();
+        memory = cache->TryPop();
+    }
+    if (!memory) memory = ::operator new(kDefaultBlockSize);
+
+    auto* block = new (memory) Block{blocks_, kDefaultBlockSize};
+    blocks_ = block;
+    current_ = reinterpret_cast<std::byte*>(block) + sizeof(Block);
+    end_ = reinterpret_cast<std::byte*>(block) + kDefaultBlockSize;
+
+    // The new block is aligned to max_align_t, the fast path always succeeds
+    return Allocate(size, alignment);
+}
+
+void Arena::RegisterDestructor(void (*destroy)(void*) noexcept, void* object) {
+    auto* destructor = static_cast<Destructor*>(Allocate(sizeof(Destructor), alignof(Destructor)));
+    destructor->destroy = destroy;
+    destructor->object = object;
+    destructor->next = destructors_;
+    destructors_ = destructor;
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,99 @@
+#include <userver/utils/arena.hpp>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct DestructionRecorder final {
+    DestructionRecorder(std::vector<int>& destroyed, int id) : destroyed(destroyed), id(id) {}
+    ~DestructionRecorder() { destroyed.push_back(id); }
+
+    std::vector<int>& destroyed;
+    int id;
+};
+
+}  // namespace
+
+TEST(Arena, Allocate) {
+    utils::Arena arena;
+    EXPECT_EQ(arena.GetAllocatedBytes(), 0);
+
+    auto* small = static_cast<char*>(arena.Allocate(3, 1));
+    auto* aligned = arena.Allocate(8, 8);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 8, 0);
+    EXPECT_NE(static_cast<void*>(small), aligned);
+
+    // Larger than a block
+    auto* big = static_cast<char*>(arena.Allocate(100'000));
+    big[0] = 'a';
+    big[99'999] = 'z';
+    EXPECT_EQ(arena.GetAllocatedBytes(), 3 + 8 + 100'000);
+
+    // Small allocations continue in the current block
+    auto* after_big = arena.Allocate(8, 8);
+    EXPECT_EQ(static_cast<char*>(after_big), static_cast<char*>(aligned) + 8);
+
+    for (int i = 0; i < 10'000; ++i) {
+        auto* ptr = static_cast<std::uint64_t*>(arena.Allocate(sizeof(std::uint64_t), alignof(std::uint64_t)));
+        *ptr = i;
+    }
+
+    arena.Reset();
+    EXPECT_EQ(arena.GetAllocatedBytes(), 0);
+}
+
+TEST(Arena, EmplaceDestroysInReverseOrder) {
+    std::vector<int> destroyed;
+    {
+        utils::Arena arena;
+        arena.Emplace<DestructionRecorder>(destroyed, 1);
+        arena.Emplace<DestructionRecorder>(destroyed, 2);
+        auto& str = arena.Emplace<std::string>(1000, 'x');
+        EXPECT_EQ(str.size(), 1000);
+
+        arena.Reset();
+        EXPECT_EQ(destroyed, (std::vector<int>{2, 1}));
+
+        arena.Emplace<DestructionRecorder>(destroyed, 3);
+    }
+    EXPECT_EQ(destroyed, (std::vector<int>{2, 1, 3}));
+}
+
+TEST(Arena, Move) {
+    std::vector<int> destroyed;
+    utils::Arena first;
+    first.Emplace<DestructionRecorder>(destroyed, 1);
+
+    utils::Arena second{std::move(first)};
+    first.Reset();
+    EXPECT_TRUE(destroyed.empty());
+
+    first = std::move(second);
+    EXPECT_TRUE(destroyed.empty());
+    first.Reset();
+    EXPECT_EQ(destroyed, std::vector<int>{1});
+}
+
+TEST(Arena, Allocator) {
+    utils::Arena arena;
+    {
+        using Allocator = utils::ArenaAllocator<std::pair<const int, int>>;
+        std::map<int, int, std::less<>, Allocator> map{Allocator{arena}};
+        for (int i = 0; i < 1000; ++i) map.emplace(i, i * i);
+        EXPECT_EQ(map.at(30), 900);
+
+        std::vector<int, utils::ArenaAllocator<int>> vector{utils::ArenaAllocator<int>{arena}};
+        vector.assign(5000, 42);
+        EXPECT_EQ(vector.back(), 42);
+    }
+    EXPECT_GT(arena.GetAllocatedBytes(), 5000 * sizeof(int));
+}
+
+USERVER_NAMESPACE_END
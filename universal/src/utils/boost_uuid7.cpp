@@ -29,9 +29,19 @@ public:
               )
           ) {}
 
-    boost::uuids::uuid operator()() {
+    boost::uuids::uuid operator()() { return Generate(CurrentUnixTimestamp()); }
+
+    void operator()(utils::span<boost::uuids::uuid> uuids) {
+        // The clock is read once, the rest of the batch is ordered by the counter
+        const auto current_timestamp = CurrentUnixTimestamp();
+        for (auto& uuid : uuids) {
+            uuid = Generate(current_timestamp);
+        }
+    }
+
+private:
+    boost::uuids::uuid Generate(std::uint64_t current_timestamp) {
         boost::uuids::uuid uuid{};
-        auto current_timestamp = CurrentUnixTimestamp();
 
         if (current_timestamp <= previous_timestamp_) {
             ++sequence_counter_;
@@ -96,7 +106,6 @@ public:
         return uuid;
     }
 
-private:
     void GenerateRandomBlock(utils::span<std::uint8_t> block) {
         int i = 0;
         std::uint64_t random_value = random_generator_();
@@ -138,6 +147,11 @@ boost::uuids::uuid utils::generators::GenerateBoostUuidV7() {
     return (*generator)();
 }
 
+void utils::generators::GenerateBoostUuidV7(utils::span<boost::uuids::uuid> uuids) {
+    auto generator = local_uuid_v7_generator.Use();
+    (*generator)(uuids);
+}
+
 std::chrono::system_clock::time_point utils::ExtractTimestampFromUuidV7(boost::uuids::uuid uuid) {
     if ((uuid.data[6] & 0xF0) != 0x70) {
         throw std::runtime_error{"timestamp can be extracted only from uuid v7"};
@@ -48,6 +48,21 @@ TEST(UUIDv7, Ordered) {
     }
 }
 
+TEST(UUIDv7, Batch) {
+    std::vector<boost::uuids::uuid> uuids(100'000);
+    utils::generators::GenerateBoostUuidV7(uuids);
+    uuids.push_back(utils::generators::GenerateBoostUuidV7());
+
+    for (size_t i = 0; i < uuids.size() - 1; ++i) {
+        EXPECT_EQ(uuids[i].variant(), boost::uuids::uuid::variant_rfc_4122);
+        EXPECT_EQ(uuids[i].data[6] & 0xF0, 0x70);
+        EXPECT_LT(uuids[i], uuids[i + 1])
+            << "uuids[" << i << "]=" << uuids[i] << " should be less than uuids[" << i + 1 << "]=" << uuids[i + 1];
+    }
+
+    utils::generators::GenerateBoostUuidV7(utils::span<boost::uuids::uuid>{});
+}
+
 TEST(UUIDv7, MonoticTimestamp) {
     static constexpr auto kUuidsToGenerate = 1'000;
 
@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <vector>
+
 #include <userver/utils/boost_uuid4.hpp>
 #include <userver/utils/boost_uuid7.hpp>
 
@@ -17,9 +19,25 @@ void GenerateUuid(UuidGenerator generator, benchmark::State& state) {
 
 void GenerateUuidV4(benchmark::State& state) { GenerateUuid(&utils::generators::GenerateBoostUuid, state); }
 
-void GenerateUuidV7(benchmark::State& state) { GenerateUuid(&utils::generators::GenerateBoostUuidV7, state); }
+void GenerateUuidV7(benchmark::State& state) {
+    GenerateUuid([] { return utils::generators::GenerateBoostUuidV7(); }, state);
+}
+
+void GenerateUuidV7Batch(benchmark::State& state) {
+    std::vector<boost::uuids::uuid> uuids(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        utils::generators::GenerateBoostUuidV7(uuids);
+        benchmark::ClobberMemory();
+    }
+}
 
 BENCHMARK(GenerateUuidV4)->RangeMultiplier(2)->Range(1, 1 << 12);
 BENCHMARK(GenerateUuidV7)->RangeMultiplier(2)->Range(1, 1 << 12);
+BENCHMARK(GenerateUuidV7Batch)->RangeMultiplier(2)->Range(1, 1 << 12);
+
+// Generators are thread-local, the throughput should scale with the threads
+BENCHMARK(GenerateUuidV4)->Arg(1 << 10)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(GenerateUuidV7)->Arg(1 << 10)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(GenerateUuidV7Batch)->Arg(1 << 10)->ThreadRange(1, 8)->UseRealTime();
 
 USERVER_NAMESPACE_END
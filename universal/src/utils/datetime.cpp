@@ -9,6 +9,7 @@
 #include <cctz/time_zone.h>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/datetime/rfc3339.hpp>
 #include <userver/utils/from_string.hpp>
 #include <userver/utils/mock_now.hpp>
 #include <userver/utils/numeric_cast.hpp>
@@ -55,6 +56,11 @@ const cctz::time_zone& GetLocalTimezone() {
 
 std::optional<std::chrono::system_clock::time_point>
 OptionalStringtime(const std::string& timestring, const cctz::time_zone& timezone, const std::string& format) {
+    // The offset is in the string, so the timezone does not matter
+    if (format == kRfc3339Format) {
+        if (auto tp = ParseRfc3339(timestring)) return tp;
+    }
+
     std::chrono::system_clock::time_point tp;
     if (cctz::parse(format, timestring, timezone, &tp)) {
         return tp;
@@ -116,6 +122,10 @@ bool IsTimeBetween(
 
 std::string
 Timestring(std::chrono::system_clock::time_point tp, const std::string& timezone, const std::string& format) {
+    if (format == kRfc3339Format && timezone == kDefaultTimezone) {
+        Rfc3339Buffer buffer;
+        return std::string{FormatRfc3339(tp, std::chrono::minutes{0}, buffer)};
+    }
     return cctz::format(format, tp, GetTimezone(timezone));
 }
 
@@ -0,0 +1,215 @@
+#include <userver/utils/datetime/rfc3339.hpp>
+
+#include <charconv>
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::datetime {
+
+namespace {
+
+constexpr std::int64_t kSecondsPerDay = 24 * 60 * 60;
+
+// http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+constexpr std::int64_t DaysFromCivil(std::int64_t year, int month, int day) noexcept {
+    year -= month <= 2;
+    const std::int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const auto year_of_era = year - era * 400;
+    const std::int64_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const auto day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + day_of_era - 719468;
+}
+
+struct CivilDate final {
+    std::int64_t year;
+    int month;
+    int day;
+};
+
+// http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+constexpr CivilDate CivilFromDays(std::int64_t days) noexcept {
+    days += 719468;
+    const std::int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const auto day_of_era = days - era * 146097;
+    const auto year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    const auto day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    const auto shifted_month = (5 * day_of_year + 2) / 153;
+    const auto day = static_cast<int>(day_of_year - (153 * shifted_month + 2) / 5 + 1);
+    const auto month = static_cast<int>(shifted_month < 10 ? shifted_month + 3 : shifted_month - 9);
+    return {year_of_era + era * 400 + (month <= 2), month, day};
+}
+
+static_assert(DaysFromCivil(1970, 1, 1) == 0);
+static_assert(DaysFromCivil(2000, 3, 1) == 11017);
+static_assert(CivilFromDays(11016).month == 2 && CivilFromDays(11016).day == 29);
+
+constexpr bool IsLeapYear(std::int64_t year) noexcept {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+constexpr int DaysInMonth(std::int64_t year, int month) noexcept {
+    constexpr int kDays[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    return month == 2 && IsLeapYear(year) ? 29 : kDays[month - 1];
+}
+
+char* WriteTwoDigits(char* out, int value) noexcept {
+    out[0] = static_cast<char>('0' + value / 10);
+    out[1] = static_cast<char>('0' + value % 10);
+    return out + 2;
+}
+
+char* WriteYear(char* out, std::int64_t year) noexcept {
+    if (year < 0 || year > 9999) {
+        return std::to_chars(out, out + 8, year).ptr;
+    }
+    out = WriteTwoDigits(out, static_cast<int>(year / 100));
+    return WriteTwoDigits(out, static_cast<int>(year % 100));
+}
+
+// The same as the cctz "%E*S" fraction: no trailing zeros, no dot for zero
+char* WriteFraction(char* out, std::int64_t nanoseconds) noexcept {
+    if (nanoseconds == 0) return out;
+
+    *out++ = '.';
+    int digits = 9;
+    while (nanoseconds % 10 == 0) {
+        nanoseconds /= 10;
+        --digits;
+    }
+    for (int i = digits - 1; i >= 0; --i) {
+        out[i] = static_cast<char>('0' + nanoseconds % 10);
+        nanoseconds /= 10;
+    }
+    return out + digits;
+}
+
+char* WriteDateTime(std::chrono::system_clock::time_point tp, std::chrono::minutes utc_offset, char* out) noexcept {
+    const auto since_epoch = tp.time_since_epoch();
+    const auto seconds = std::chrono::floor<std::chrono::seconds>(since_epoch);
+    const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch - seconds).count();
+
+    const auto local_seconds = seconds.count() + std::chrono::seconds{utc_offset}.count();
+    auto days = local_seconds / kSecondsPerDay;
+    auto day_seconds = local_seconds % kSecondsPerDay;
+    if (day_seconds < 0) {
+        --days;
+        day_seconds += kSecondsPerDay;
+    }
+    const auto date = CivilFromDays(days);
+
+    out = WriteYear(out, date.year);
+    *out++ = '-';
+    out = WriteTwoDigits(out, date.month);
+    *out++ = '-';
+    out = WriteTwoDigits(out, date.day);
+    *out++ = 'T';
+    out = WriteTwoDigits(out, static_cast<int>(day_seconds / 3600));
+    *out++ = ':';
+    out = WriteTwoDigits(out, static_cast<int>(day_seconds / 60 % 60));
+    *out++ = ':';
+    out = WriteTwoDigits(out, static_cast<int>(day_seconds % 60));
+    return WriteFraction(out, nanoseconds);
+}
+
+// Returns -1 if the characters are not digits
+int ParseDigits(const char* in, std::size_t count) noexcept {
+    int result = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto digit = static_cast<unsigned>(static_cast<unsigned char>(in[i])) - '0';
+        if (digit > 9) return -1;
+        result = result * 10 + static_cast<int>(digit);
+    }
+    return result;
+}
+
+}  // namespace
+
+std::string_view FormatRfc3339Utc(std::chrono::system_clock::time_point tp, Rfc3339Buffer& buffer) noexcept {
+    char* out = WriteDateTime(tp, std::chrono::minutes{0}, buffer.data());
+    *out++ = 'Z';
+    return {buffer.data(), static_cast<std::size_t>(out - buffer.data())};
+}
+
+std::string_view FormatRfc3339(
+    std::chrono::system_clock::time_point tp,
+    std::chrono::minutes utc_offset,
+    Rfc3339Buffer& buffer
+) noexcept {
+    char* out = WriteDateTime(tp, utc_offset, buffer.data());
+
+    auto offset = utc_offset.count();
+    *out++ = offset < 0 ? '-' : '+';
+    if (offset < 0) offset = -offset;
+    out = WriteTwoDigits(out, static_cast<int>(offset / 60 % 100));
+    *out++ = ':';
+    out = WriteTwoDigits(out, static_cast<int>(offset % 60));
+    return {buffer.data(), static_cast<std::size_t>(out - buffer.data())};
+}
+
+std::optional<std::chrono::system_clock::time_point> ParseRfc3339(std::string_view timestring) noexcept {
+    std::chrono::minutes utc_offset{};
+    return ParseRfc3339(timestring, utc_offset);
+}
+
+std::optional<std::chrono::system_clock::time_point>
+ParseRfc3339(std::string_view timestring, std::chrono::minutes& utc_offset) noexcept {
+    // "YYYY-MM-DDTHH:MM:SS" and at least "Z"
+    constexpr std::size_t kDateTimeSize = 19;
+    if (timestring.size() < kDateTimeSize + 1) return std::nullopt;
+
+    const char* in = timestring.data();
+    if (in[4] != '-' || in[7] != '-' || in[10] != 'T' || in[13] != ':' || in[16] != ':') return std::nullopt;
+
+    const int year = ParseDigits(in, 4);
+    const int month = ParseDigits(in + 5, 2);
+    const int day = ParseDigits(in + 8, 2);
+    const int hour = ParseDigits(in + 11, 2);
+    const int minute = ParseDigits(in + 14, 2);
+    // 60 is a leap second, it is normalized to the next minute
+    const int second = ParseDigits(in + 17, 2);
+    if (year < 0 || month < 1 || month > 12 || day < 1 || day > DaysInMonth(year, month) || hour < 0 || hour > 23 ||
+        minute < 0 || minute > 59 || second < 0 || second > 60) {
+        return std::nullopt;
+    }
+
+    std::size_t pos = kDateTimeSize;
+    std::int64_t nanoseconds = 0;
+    if (in[pos] == '.') {
+        const auto fraction_begin = ++pos;
+        while (pos < timestring.size() && in[pos] >= '0' && in[pos] <= '9') {
+            if (pos - fraction_begin < 9) nanoseconds = nanoseconds * 10 + (in[pos] - '0');
+            ++pos;
+        }
+        const auto digits = pos - fraction_begin;
+        if (digits == 0) return std::nullopt;
+        for (auto i = digits; i < 9; ++i) nanoseconds *= 10;
+    }
+
+    const auto rest = timestring.substr(pos);
+    if (rest == "Z") {
+        utc_offset = std::chrono::minutes{0};
+    } else {
+        if (rest.size() != 6 || (rest[0] != '+' && rest[0] != '-') || rest[3] != ':') return std::nullopt;
+        const int offset_hours = ParseDigits(rest.data() + 1, 2);
+        const int offset_minutes = ParseDigits(rest.data() + 4, 2);
+        if (offset_hours < 0 || offset_hours > 23 || offset_minutes < 0 || offset_minutes > 59) return std::nullopt;
+        const auto offset = offset_hours * 60 + offset_minutes;
+        utc_offset = std::chrono::minutes{rest[0] == '-' ? -offset : offset};
+    }
+
+    const auto seconds = DaysFromCivil(year, month, day) * kSecondsPerDay + hour * 3600 + minute * 60 + second -
+                         std::chrono::seconds{utc_offset}.count();
+
+    using Duration = std::chrono::system_clock::duration;
+    constexpr auto kMaxSeconds = std::chrono::duration_cast<std::chrono::seconds>(Duration::max()).count();
+    constexpr auto kMinSeconds = std::chrono::duration_cast<std::chrono::seconds>(Duration::min()).count();
+    if (seconds >= kMaxSeconds || seconds <= kMinSeconds) return std::nullopt;
+
+    return std::chrono::system_clock::time_point{
+        std::chrono::seconds{seconds} + std::chrono::duration_cast<Duration>(std::chrono::nanoseconds{nanoseconds})};
+}
+
+}  // namespace utils::datetime
+
+USERVER_NAMESPACE_END
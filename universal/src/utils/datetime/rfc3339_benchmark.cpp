@@ -0,0 +1,53 @@
+#include <userver/utils/datetime/rfc3339.hpp>
+
+#include <chrono>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <cctz/time_zone.h>
+
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const auto kTimePoint = std::chrono::system_clock::time_point{std::chrono::microseconds{1'394'984'827'123'456}};
+const std::string kTimestring = "2014-03-17T18:47:07.123456+03:00";
+
+}  // namespace
+
+void rfc3339_format_cctz(benchmark::State& state) {
+    const auto tz = cctz::utc_time_zone();
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(cctz::format(utils::datetime::kRfc3339Format, kTimePoint, tz));
+    }
+}
+BENCHMARK(rfc3339_format_cctz);
+
+void rfc3339_format_fast(benchmark::State& state) {
+    utils::datetime::Rfc3339Buffer buffer;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::datetime::FormatRfc3339(kTimePoint, std::chrono::minutes{0}, buffer));
+    }
+}
+BENCHMARK(rfc3339_format_fast);
+
+void rfc3339_parse_cctz(benchmark::State& state) {
+    const auto tz = cctz::utc_time_zone();
+    std::chrono::system_clock::time_point tp;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(cctz::parse(utils::datetime::kRfc3339Format, kTimestring, tz, &tp));
+        benchmark::DoNotOptimize(tp);
+    }
+}
+BENCHMARK(rfc3339_parse_cctz);
+
+void rfc3339_parse_fast(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::datetime::ParseRfc3339(kTimestring));
+    }
+}
+BENCHMARK(rfc3339_parse_fast);
+
+USERVER_NAMESPACE_END
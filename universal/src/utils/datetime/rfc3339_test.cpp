@@ -0,0 +1,125 @@
+#include <userver/utils/datetime/rfc3339.hpp>
+
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/rand.hpp>
+
+#include <cctz/time_zone.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using std::chrono::system_clock;
+
+system_clock::time_point RandomTimePoint() {
+    // 1900-01-01 .. 2200-01-01
+    const std::chrono::seconds seconds{utils::RandRange<std::int64_t>(-2208988800, 7258118400)};
+
+    // Whole seconds and round fractions are the special cases of the formatting
+    switch (utils::RandRange(3)) {
+        case 0:
+            return system_clock::time_point{seconds};
+        case 1:
+            return system_clock::time_point{seconds + std::chrono::milliseconds{utils::RandRange(1000)}};
+        default:
+            return system_clock::time_point{seconds + std::chrono::microseconds{utils::RandRange(1'000'000)}};
+    }
+}
+
+}  // namespace
+
+TEST(Rfc3339, Format) {
+    /// [FormatRfc3339 example]
+    const auto tp = utils::datetime::Stringtime("2014-03-17T02:47:07+00:00", "UTC", utils::datetime::kRfc3339Format);
+
+    utils::datetime::Rfc3339Buffer buffer;
+    EXPECT_EQ(utils::datetime::FormatRfc3339Utc(tp, buffer), "2014-03-17T02:47:07Z");
+    EXPECT_EQ(utils::datetime::FormatRfc3339(tp, std::chrono::hours{3}, buffer), "2014-03-17T05:47:07+03:00");
+    EXPECT_EQ(
+        utils::datetime::FormatRfc3339Utc(tp + std::chrono::milliseconds{120}, buffer), "2014-03-17T02:47:07.12Z"
+    );
+    /// [FormatRfc3339 example]
+
+    EXPECT_EQ(utils::datetime::FormatRfc3339(tp, -std::chrono::minutes{30}, buffer), "2014-03-17T02:17:07-00:30");
+    EXPECT_EQ(utils::datetime::FormatRfc3339Utc(system_clock::time_point{}, buffer), "1970-01-01T00:00:00Z");
+    EXPECT_EQ(
+        utils::datetime::FormatRfc3339Utc(system_clock::time_point{} - std::chrono::microseconds{1}, buffer),
+        "1969-12-31T23:59:59.999999Z"
+    );
+}
+
+TEST(Rfc3339, Parse) {
+    /// [ParseRfc3339 example]
+    const auto tp = utils::datetime::Stringtime("2014-03-17T02:47:07+00:00", "UTC", utils::datetime::kRfc3339Format);
+
+    EXPECT_EQ(utils::datetime::ParseRfc3339("2014-03-17T02:47:07Z"), tp);
+    EXPECT_EQ(utils::datetime::ParseRfc3339("2014-03-17T05:47:07+03:00"), tp);
+    EXPECT_EQ(utils::datetime::ParseRfc3339("2014-03-17T02:47:07.5Z"), tp + std::chrono::milliseconds{500});
+    EXPECT_EQ(utils::datetime::ParseRfc3339("2014-03-17T02:47:07"), std::nullopt);
+    /// [ParseRfc3339 example]
+
+    std::chrono::minutes offset{};
+    EXPECT_EQ(utils::datetime::ParseRfc3339("2014-03-17T02:17:07-00:30", offset), tp);
+    EXPECT_EQ(offset, -std::chrono::minutes{30});
+    EXPECT_EQ(utils::datetime::ParseRfc3339("2014-03-17T02:47:07Z", offset), tp);
+    EXPECT_EQ(offset, std::chrono::minutes{0});
+
+    EXPECT_EQ(
+        utils::datetime::ParseRfc3339("2014-03-17T02:47:07.1234567891234Z"), tp + std::chrono::nanoseconds{123456789}
+    );
+    EXPECT_EQ(
+        utils::datetime::ParseRfc3339("2016-12-31T23:59:60Z"), utils::datetime::ParseRfc3339("2017-01-01T00:00:00Z")
+    );
+    EXPECT_EQ(
+        utils::datetime::ParseRfc3339("1969-12-31T23:59:59Z"), system_clock::time_point{} - std::chrono::seconds{1}
+    );
+}
+
+TEST(Rfc3339, ParseInvalid) {
+    for (const std::string_view str : {
+             "",
+             "2014-03-17",
+             "2014-03-17 02:47:07Z",
+             "2014-03-17T02:47:07+0300",
+             "2014-03-17T02:47:07+03:00 ",
+             "2014-03-17T02:47:07.Z",
+             "2014-03-17T02:47:07z",
+             "2014-13-17T02:47:07Z",
+             "2014-02-29T02:47:07Z",
+             "2014-03-00T02:47:07Z",
+             "2014-03-17T24:47:07Z",
+             "2014-03-17T02:60:07Z",
+             "2014-03-17T02:47:61Z",
+             "2014-03-17T02:47:07+24:00",
+             "2O14-03-17T02:47:07Z",
+         }) {
+        EXPECT_EQ(utils::datetime::ParseRfc3339(str), std::nullopt) << str;
+    }
+    if constexpr (std::is_same_v<system_clock::duration, std::chrono::nanoseconds>) {
+        EXPECT_EQ(utils::datetime::ParseRfc3339("9999-12-31T23:59:59Z"), std::nullopt);
+    }
+    EXPECT_NE(utils::datetime::ParseRfc3339("2016-02-29T02:47:07Z"), std::nullopt);
+}
+
+TEST(Rfc3339, SameAsCctz) {
+    utils::datetime::Rfc3339Buffer buffer;
+    for (int i = 0; i < 10000; ++i) {
+        const auto tp = RandomTimePoint();
+        const std::chrono::minutes offset{utils::RandRange(-23 * 60, 23 * 60)};
+
+        const auto cctz_utc = cctz::format(utils::datetime::kRfc3339Format, tp, cctz::utc_time_zone());
+        ASSERT_EQ(utils::datetime::FormatRfc3339(tp, std::chrono::minutes{0}, buffer), cctz_utc);
+
+        const auto cctz_local = cctz::format(utils::datetime::kRfc3339Format, tp, cctz::fixed_time_zone(offset));
+        ASSERT_EQ(utils::datetime::FormatRfc3339(tp, offset, buffer), cctz_local);
+
+        ASSERT_EQ(utils::datetime::ParseRfc3339(cctz_local), tp) << cctz_local;
+        ASSERT_EQ(utils::datetime::ParseRfc3339(utils::datetime::FormatRfc3339Utc(tp, buffer)), tp);
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -92,4 +92,21 @@ TEST(FilterBloom, Clear) {
     EXPECT_EQ(false, filter.Has(2));
 }
 
+TEST(FilterBloom, SaturationAndHalving) {
+    utils::FilterBloom<int, uint8_t> filter_bloom(1024);
+    for (int i = 0; i < 1000; ++i) {
+        filter_bloom.Increment(1);
+    }
+    for (int i = 0; i < 10; ++i) {
+        filter_bloom.Increment(2);
+    }
+    EXPECT_EQ(filter_bloom.Estimate(1), 255);
+    EXPECT_LE(10, filter_bloom.Estimate(2));
+
+    filter_bloom.Halve();
+    EXPECT_EQ(filter_bloom.Estimate(1), 127);
+    EXPECT_LE(5, filter_bloom.Estimate(2));
+    EXPECT_GT(10, filter_bloom.Estimate(2));
+}
+
 USERVER_NAMESPACE_END
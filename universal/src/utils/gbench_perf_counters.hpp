@@ -0,0 +1,205 @@
+#pragma once
+
+// Hardware performance counters for google benchmark, enabled with the
+// `--userver_perf_counters` command line flag of the benchmark executables.
+//
+// Counters are collected with perf_event_open(2) through the MemoryManager
+// hook of google benchmark, i.e. on a separate short run of each benchmark,
+// and are reported per iteration as user counters: CPU cycles, instructions,
+// branch misses and last level cache read misses. The short run includes the
+// benchmark and fixture setup, so the values are best used to compare
+// revisions of the same benchmark rather than as absolute numbers.
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace gbench_perf_counters {
+
+inline constexpr std::string_view kFlag = "--userver_perf_counters";
+
+// google benchmark runs at most this many iterations with a MemoryManager
+inline constexpr std::int64_t kMaxMeasuredIterations = 16;
+
+/// Removes the flag from the command line, @returns true if it was present
+inline bool ConsumeFlag(int& argc, char** argv) {
+    bool enabled = false;
+    int out = 1;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg{argv[i]};
+        if (arg == kFlag || arg == std::string(kFlag) + "=true") {
+            enabled = true;
+        } else if (arg == std::string(kFlag) + "=false") {
+            enabled = false;
+        } else {
+            argv[out++] = argv[i];
+        }
+    }
+    argc = out;
+    return enabled;
+}
+
+class Collector final : public benchmark::MemoryManager {
+public:
+    using Values = std::map<std::string, double>;
+
+    Collector() {
+#ifdef __linux__
+        Open("cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        Open("instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        Open("branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+        Open(
+            "llc_misses",
+            PERF_TYPE_HW_CACHE,
+            PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+        );
+#else
+        std::cerr << "Performance counters are only supported on Linux\n";
+#endif
+    }
+
+    ~Collector() override {
+#ifdef __linux__
+        for (const auto& counter : counters_) ::close(counter.fd);
+#endif
+    }
+
+    Collector(Collector&&) = delete;
+    Collector& operator=(Collector&&) = delete;
+
+    bool IsAvailable() const noexcept { return !counters_.empty(); }
+
+    void Start() override {
+#ifdef __linux__
+        for (const auto& counter : counters_) {
+            ::ioctl(counter.fd, PERF_EVENT_IOC_RESET, 0);
+            ::ioctl(counter.fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    // No `override` for the Stop() overloads, as their set differs between
+    // google benchmark versions.
+    void Stop(Result* result) { Stop(*result); }
+
+    void Stop(Result& result) {
+        Values values;
+#ifdef __linux__
+        for (const auto& counter : counters_) ::ioctl(counter.fd, PERF_EVENT_IOC_DISABLE, 0);
+        for (const auto& counter : counters_) {
+            // value, time_enabled, time_running
+            std::uint64_t data[3]{};
+            if (::read(counter.fd, data, sizeof(data)) != sizeof(data) || data[2] == 0) continue;
+            // Scale the value if the counter was multiplexed with others
+            values[counter.name] = static_cast<double>(data[0]) * data[1] / data[2];
+        }
+#endif
+        results_[&result] = std::move(values);
+    }
+
+    /// @returns the values for the run, nullptr if there are none
+    const Values* Find(const Result* result) const {
+        const auto it = results_.find(result);
+        return it == results_.end() ? nullptr : &it->second;
+    }
+
+private:
+#ifdef __linux__
+    struct Counter {
+        std::string name;
+        int fd;
+    };
+
+    void Open(std::string name, std::uint32_t type, std::uint64_t config) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        // Count the threads started by the benchmark, e.g. engine workers
+        attr.inherit = 1;
+        // Allowed for unprivileged users with the default perf_event_paranoid
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        const auto fd = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+        if (fd < 0) {
+            std::cerr << "Performance counter '" << name << "' is not available: " << std::strerror(errno) << '\n';
+            return;
+        }
+        counters_.push_back({std::move(name), fd});
+    }
+
+    std::vector<Counter> counters_;
+#endif
+    std::map<const Result*, Values> results_;
+};
+
+/// Adds the counters from Collector to the runs and passes them to the
+/// default display reporter. The `--benchmark_out` file gets no counters.
+class Reporter final : public benchmark::BenchmarkReporter {
+public:
+    explicit Reporter(const Collector& collector)
+        : collector_(collector), reporter_(benchmark::CreateDefaultDisplayReporter()) {}
+
+    bool ReportContext(const Context& context) override { return reporter_->ReportContext(context); }
+
+    void ReportRuns(const std::vector<Run>& runs) override {
+        auto runs_with_counters = runs;
+        for (auto& run : runs_with_counters) {
+            const auto* values = collector_.Find(run.memory_result);
+            if (!values || run.run_type != Run::RT_Iteration || run.iterations <= 0) continue;
+
+            const auto iterations = std::min(run.iterations, kMaxMeasuredIterations);
+            for (const auto& [name, value] : *values) {
+                run.counters[name] = benchmark::Counter{value / static_cast<double>(iterations)};
+            }
+        }
+        reporter_->ReportRuns(runs_with_counters);
+    }
+
+    void Finalize() override { reporter_->Finalize(); }
+
+private:
+    const Collector& collector_;
+    std::unique_ptr<benchmark::BenchmarkReporter> reporter_;
+};
+
+/// Runs the benchmarks, with the performance counters if the flag was given
+inline void RunSpecifiedBenchmarks(bool perf_counters_enabled) {
+    if (!perf_counters_enabled) {
+        benchmark::RunSpecifiedBenchmarks();
+        return;
+    }
+
+    Collector collector;
+    if (!collector.IsAvailable()) {
+        benchmark::RunSpecifiedBenchmarks();
+        return;
+    }
+
+    Reporter reporter{collector};
+    benchmark::RegisterMemoryManager(&collector);
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    benchmark::RegisterMemoryManager(nullptr);
+}
+
+}  // namespace gbench_perf_counters
@@ -2,6 +2,8 @@
 
 #ifdef __SSE2__
 #include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
 #endif
 
 #include <array>
@@ -163,6 +165,53 @@ private:
         return _mm_or_si128(value, lowercase_mask);
     }
 };
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+struct CaseInsensitiveNeonFetcher final {
+    static inline std::uint64_t Fetch8(const std::uint8_t* data) noexcept {
+        return vget_lane_u64(vreinterpret_u64_u8(DoLowercaseBytes(vld1_u8(data))), 0);
+    }
+
+    static inline std::pair<std::uint64_t, std::uint64_t> Fetch16(const uint8_t* data) noexcept {
+        const auto lowercase = vreinterpretq_u64_u8(DoLowercaseBytes(vld1q_u8(data)));
+        return {vgetq_lane_u64(lowercase, 0), vgetq_lane_u64(lowercase, 1)};
+    }
+
+    static inline std::uint64_t FetchN(const std::uint8_t* data, std::size_t n) noexcept {
+        const auto value = CaseFetcher::FetchN(data, n);
+        return vget_lane_u64(vreinterpret_u64_u8(DoLowercaseBytes(vcreate_u8(value))), 0);
+    }
+
+    static inline bool FailFastCompare8(const std::uint8_t* lhs, const std::uint8_t* rhs) noexcept {
+        return FailFastCompare(vcombine_u8(vld1_u8(lhs), vdup_n_u8(0)), vcombine_u8(vld1_u8(rhs), vdup_n_u8(0)));
+    }
+
+    static inline bool FailFastCompare16(const std::uint8_t* lhs, const std::uint8_t* rhs) noexcept {
+        return FailFastCompare(vld1q_u8(lhs), vld1q_u8(rhs));
+    }
+
+private:
+    static inline bool FailFastCompare(uint8x16_t lhs, uint8x16_t rhs) noexcept {
+        // Same idea as in CaseInsensitiveSSEFetcher::FailFastCompare: bail out
+        // before lower-casing if the values differ in any bit other than 32.
+        const auto diff = veorq_u8(lhs, rhs);
+        if (vmaxvq_u8(vandq_u8(diff, vdupq_n_u8(~32))) != 0) {
+            return false;
+        }
+
+        return vmaxvq_u8(veorq_u8(DoLowercaseBytes(lhs), DoLowercaseBytes(rhs))) == 0;
+    }
+
+    static inline uint8x16_t DoLowercaseBytes(uint8x16_t value) noexcept {
+        // unsigned (c - 'A') < 26 <=> c is in ['A'; 'Z']
+        const auto is_upper = vcltq_u8(vsubq_u8(value, vdupq_n_u8('A')), vdupq_n_u8(26));
+        return vorrq_u8(value, vandq_u8(is_upper, vdupq_n_u8(32)));
+    }
+
+    static inline uint8x8_t DoLowercaseBytes(uint8x8_t value) noexcept {
+        const auto is_upper = vclt_u8(vsub_u8(value, vdup_n_u8('A')), vdup_n_u8(26));
+        return vorr_u8(value, vand_u8(is_upper, vdup_n_u8(32)));
+    }
+};
 #endif
 
 struct CaseInsensitiveFetcher final {
@@ -374,6 +423,8 @@ CaseInsensitiveSipHasher::CaseInsensitiveSipHasher(std::uint64_t k0, std::uint64
 std::uint64_t CaseInsensitiveSipHasher::operator()(std::string_view data) const noexcept {
 #ifdef __SSE2__
     return SipHash13<CaseInsensitiveSSEFetcher>(k0_, k1_, data);
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    return SipHash13<CaseInsensitiveNeonFetcher>(k0_, k1_, data);
 #else
     return CaseInsensitiveSipHasherNoSse{k0_, k1_}(data);
 #endif
@@ -389,6 +440,8 @@ std::uint64_t CaseInsensitiveSipHasherNoSse::operator()(std::string_view data) c
 bool CaseInsensitiveEqual::operator()(std::string_view lhs, std::string_view rhs) const noexcept {
 #ifdef __SSE2__
     return NoCaseEqual<CaseInsensitiveSSEFetcher>(lhs, rhs);
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    return NoCaseEqual<CaseInsensitiveNeonFetcher>(lhs, rhs);
 #else
     return CaseInsensitiveEqualNoSse{}(lhs, rhs);
 #endif
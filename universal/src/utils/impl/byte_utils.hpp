@@ -34,7 +34,7 @@ private:
 
 // SipHash13 implementation with uppercase ASCII symbols ('A' - 'Z') being
 // treated as their lowercase counterpart.
-// Same as CaseInsensitiveSipHasher, but doesn't explicitly use SSE2
+// Same as CaseInsensitiveSipHasher, but doesn't explicitly use SSE2 or NEON
 // even if it's available.
 class CaseInsensitiveSipHasherNoSse final {
 public:
@@ -0,0 +1,123 @@
+#include <userver/utils/keyed_token_bucket.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace {
+
+// A set fills one cache line, so that the lookup touches a single line
+constexpr std::size_t kWays = 4;
+
+constexpr std::uint64_t kEmptyKey = 0;
+
+// Any timestamp in the past means a full bucket
+constexpr std::int64_t kFullBucket = std::numeric_limits<std::int64_t>::min();
+
+constexpr std::int64_t kMaxTime = std::numeric_limits<std::int64_t>::max();
+
+std::uint64_t HashKey(std::string_view key) noexcept {
+    return static_cast<std::uint64_t>(std::hash<std::string_view>{}(key)) | 1;
+}
+
+std::size_t GetSetsCount(std::size_t max_keys) noexcept {
+    const auto min_sets = std::max<std::size_t>((max_keys + kWays - 1) / kWays, 1);
+    std::size_t sets = 1;
+    while (sets < min_sets) sets *= 2;
+    return sets;
+}
+
+std::int64_t SaturatingAdd(std::int64_t lhs, std::int64_t rhs) noexcept {
+    UASSERT(rhs >= 0);
+    return lhs > kMaxTime - rhs ? kMaxTime : lhs + rhs;
+}
+
+std::int64_t SaturatingMultiply(std::int64_t lhs, std::size_t rhs) noexcept {
+    UASSERT(lhs >= 0);
+    if (rhs != 0 && static_cast<std::uint64_t>(lhs) > static_cast<std::uint64_t>(kMaxTime) / rhs) return kMaxTime;
+    return lhs * static_cast<std::int64_t>(rhs);
+}
+
+}  // namespace
+
+struct alignas(64) KeyedTokenBucket::Set final {
+    struct Slot final {
+        std::atomic<std::uint64_t> key_hash{kEmptyKey};
+        // "Theoretical arrival time" of GCRA: the bucket is full at this time
+        std::atomic<std::int64_t> full_at{kFullBucket};
+    };
+
+    std::atomic<std::int64_t>& FindOrInsert(std::uint64_t key_hash) noexcept {
+        for (auto& slot : slots) {
+            if (slot.key_hash.load(std::memory_order_acquire) == key_hash) return slot.full_at;
+        }
+
+        // Empty slots have the smallest timestamp, so they are taken first
+        auto* victim = &slots[0];
+        auto victim_full_at = victim->full_at.load(std::memory_order_relaxed);
+        for (auto& slot : slots) {
+            const auto full_at = slot.full_at.load(std::memory_order_relaxed);
+            if (full_at < victim_full_at) {
+                victim = &slot;
+                victim_full_at = full_at;
+            }
+        }
+
+        auto victim_key_hash = victim->key_hash.load(std::memory_order_relaxed);
+        if (victim_key_hash != key_hash &&
+            victim->key_hash.compare_exchange_strong(victim_key_hash, key_hash, std::memory_order_acq_rel)) {
+            // Concurrent Obtain() for the evicted key may still update the
+            // timestamp, it only makes the new key a bit more limited.
+            victim->full_at.store(kFullBucket, std::memory_order_relaxed);
+        }
+        // If someone else has replaced the victim concurrently, share the slot
+        // with that key for this call rather than retrying.
+        return victim->full_at;
+    }
+
+    Slot slots[kWays];
+};
+
+KeyedTokenBucket::KeyedTokenBucket(std::size_t max_keys)
+    : sets_mask_(GetSetsCount(max_keys) - 1), sets_(std::make_unique<Set[]>(sets_mask_ + 1)) {}
+
+KeyedTokenBucket::~KeyedTokenBucket() = default;
+
+std::size_t KeyedTokenBucket::GetMaxKeys() const noexcept { return (sets_mask_ + 1) * kWays; }
+
+bool KeyedTokenBucket::Obtain(std::string_view key, const Limit& limit) {
+    if (limit.refill_interval <= Duration::zero()) return true;
+    if (limit.max_size == 0) return false;
+
+    const auto key_hash = HashKey(key);
+    // The low bit is always set by HashKey
+    auto& full_at = sets_[(key_hash >> 1) & sets_mask_].FindOrInsert(key_hash);
+
+    const auto now = std::chrono::duration_cast<Duration>(datetime::SteadyNow().time_since_epoch()).count();
+    const auto interval = limit.refill_interval.count();
+    // How far the timestamp may be ahead of now for a token to be available
+    const auto max_ahead = SaturatingMultiply(interval, limit.max_size) - interval;
+
+    auto current = full_at.load(std::memory_order_relaxed);
+    while (true) {
+        const auto from = std::max(current, now);
+        if (from - now > max_ahead) return false;
+        if (full_at.compare_exchange_weak(current, SaturatingAdd(from, interval), std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,37 @@
+#include <userver/utils/keyed_token_bucket.hpp>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kKeys = 1 << 16;
+
+const std::vector<std::string> kKeyNames = [] {
+    std::vector<std::string> result;
+    result.reserve(kKeys);
+    for (std::size_t i = 0; i < kKeys; ++i) result.push_back("tenant-" + std::to_string(i));
+    return result;
+}();
+
+}  // namespace
+
+// Half of the keys fit into the table, so about a half of the lookups evict
+void keyed_token_bucket_obtain(benchmark::State& state) {
+    static utils::KeyedTokenBucket buckets{kKeys / 2};
+    const utils::KeyedTokenBucket::Limit limit{100, std::chrono::milliseconds{10}};
+
+    std::size_t i = utils::RandRange(kKeys);
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(buckets.Obtain(kKeyNames[i++ % kKeys], limit));
+    }
+}
+BENCHMARK(keyed_token_bucket_obtain)->UseRealTime()->ThreadRange(1, 16);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#include <userver/utils/keyed_token_bucket.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr utils::KeyedTokenBucket::Limit kLimit{3, std::chrono::seconds{1}};
+
+}  // namespace
+
+TEST(KeyedTokenBucket, Obtain) {
+    utils::datetime::MockNowSet(std::chrono::system_clock::time_point{std::chrono::hours{1}});
+
+    utils::KeyedTokenBucket buckets{100};
+    EXPECT_GE(buckets.GetMaxKeys(), 100);
+
+    EXPECT_TRUE(buckets.Obtain("a", kLimit));
+    EXPECT_TRUE(buckets.Obtain("a", kLimit));
+    EXPECT_TRUE(buckets.Obtain("a", kLimit));
+    EXPECT_FALSE(buckets.Obtain("a", kLimit));
+
+    // Other keys have their own buckets
+    EXPECT_TRUE(buckets.Obtain("b", kLimit));
+
+    utils::datetime::MockSleep(std::chrono::seconds{1});
+    EXPECT_TRUE(buckets.Obtain("a", kLimit));
+    EXPECT_FALSE(buckets.Obtain("a", kLimit));
+
+    // The bucket is refilled up to its size only
+    utils::datetime::MockSleep(std::chrono::seconds{100});
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(buckets.Obtain("a", kLimit));
+    }
+    EXPECT_FALSE(buckets.Obtain("a", kLimit));
+}
+
+TEST(KeyedTokenBucket, SpecialLimits) {
+    utils::KeyedTokenBucket buckets{1};
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(buckets.Obtain("a", {1, utils::KeyedTokenBucket::Duration::zero()}));
+    }
+    EXPECT_FALSE(buckets.Obtain("a", {0, std::chrono::seconds{1}}));
+
+    EXPECT_TRUE(buckets.Obtain("a", {1, utils::KeyedTokenBucket::Duration::max()}));
+    EXPECT_FALSE(buckets.Obtain("a", {1, utils::KeyedTokenBucket::Duration::max()}));
+    EXPECT_TRUE(buckets.Obtain("b", {100, utils::KeyedTokenBucket::Duration::max()}));
+}
+
+TEST(KeyedTokenBucket, EvictsIdleKeys) {
+    utils::datetime::MockNowSet(std::chrono::system_clock::time_point{std::chrono::hours{1}});
+
+    utils::KeyedTokenBucket buckets{4};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(buckets.Obtain("throttled", kLimit));
+    }
+    EXPECT_FALSE(buckets.Obtain("throttled", kLimit));
+
+    // Flooding with new keys evicts the idle ones, not the throttled one
+    for (int i = 0; i < 100; ++i) {
+        utils::datetime::MockSleep(std::chrono::milliseconds{1});
+        EXPECT_TRUE(buckets.Obtain(std::to_string(i), kLimit));
+    }
+    EXPECT_FALSE(buckets.Obtain("throttled", kLimit));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include <userver/utils/persistent_hash_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kChangesCount = 16;
+
+template <typename Map>
+Map MakeMap(std::size_t size) {
+    Map map;
+    for (std::size_t i = 0; i < size; ++i) {
+        map.insert_or_assign(i, std::to_string(i));
+    }
+    return map;
+}
+
+// Makes a new snapshot of the cache data with a few changes, the old snapshot
+// is kept intact
+template <typename Map>
+void ApplyChanges(benchmark::State& state) {
+    const auto size = state.range(0);
+    const auto snapshot = MakeMap<Map>(size);
+    std::uint64_t key = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        auto next_snapshot = snapshot;
+        for (std::size_t i = 0; i < kChangesCount; ++i) {
+            key = (key + 7919) % size;
+            next_snapshot.insert_or_assign(key, "changed");
+            next_snapshot.erase((key + 1) % size);
+        }
+        benchmark::DoNotOptimize(next_snapshot);
+    }
+}
+
+template <typename Map>
+void Find(benchmark::State& state) {
+    const auto size = state.range(0);
+    const auto map = MakeMap<Map>(size);
+    std::uint64_t key = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        key = (key + 7919) % size;
+        benchmark::DoNotOptimize(map.find(key));
+    }
+}
+
+template <typename Map>
+void Iterate(benchmark::State& state) {
+    const auto map = MakeMap<Map>(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        std::size_t total = 0;
+        for (const auto& [key, value] : map) {
+            total += value.size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * map.size());
+}
+
+using StdMap = std::unordered_map<std::uint64_t, std::string>;
+using PersistentMap = utils::PersistentHashMap<std::uint64_t, std::string>;
+
+}  // namespace
+
+void PersistentHashMapApplyChangesStd(benchmark::State& state) { ApplyChanges<StdMap>(state); }
+BENCHMARK(PersistentHashMapApplyChangesStd)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+void PersistentHashMapApplyChanges(benchmark::State& state) { ApplyChanges<PersistentMap>(state); }
+BENCHMARK(PersistentHashMapApplyChanges)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+void PersistentHashMapFindStd(benchmark::State& state) { Find<StdMap>(state); }
+BENCHMARK(PersistentHashMapFindStd)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+void PersistentHashMapFind(benchmark::State& state) { Find<PersistentMap>(state); }
+BENCHMARK(PersistentHashMapFind)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+void PersistentHashMapIterateStd(benchmark::State& state) { Iterate<StdMap>(state); }
+BENCHMARK(PersistentHashMapIterateStd)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+void PersistentHashMapIterate(benchmark::State& state) { Iterate<PersistentMap>(state); }
+BENCHMARK(PersistentHashMapIterate)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+USERVER_NAMESPACE_END
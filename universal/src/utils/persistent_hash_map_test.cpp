@@ -0,0 +1,172 @@
+#include <userver/utils/persistent_hash_map.hpp>
+
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = utils::PersistentHashMap<int, std::string>;
+
+// All the keys collide, forcing the deepest levels of nodes
+struct BadHash {
+    std::size_t operator()(int key) const noexcept { return key % 2; }
+};
+
+template <typename PersistentMap>
+std::map<int, std::string> ToStdMap(const PersistentMap& map) {
+    std::map<int, std::string> result;
+    for (const auto& [key, value] : map) {
+        EXPECT_TRUE(result.emplace(key, value).second) << "duplicate key " << key;
+    }
+    EXPECT_EQ(result.size(), map.size());
+    return result;
+}
+
+}  // namespace
+
+TEST(PersistentHashMap, Sample) {
+    /// [Sample utils::PersistentHashMap usage]
+    utils::PersistentHashMap<std::string, int> snapshot;
+    snapshot.insert_or_assign("a", 1);
+    snapshot.insert_or_assign("b", 2);
+
+    // O(1), the data is shared
+    auto next_snapshot = snapshot;
+    // O(log(size)), the old snapshot is not changed
+    next_snapshot.insert_or_assign("a", 10);
+    next_snapshot.erase("b");
+
+    EXPECT_EQ(snapshot.at("a"), 1);
+    EXPECT_EQ(snapshot.at("b"), 2);
+    EXPECT_EQ(next_snapshot.at("a"), 10);
+    EXPECT_FALSE(next_snapshot.contains("b"));
+    /// [Sample utils::PersistentHashMap usage]
+}
+
+TEST(PersistentHashMap, Empty) {
+    const Map map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_EQ(map.find(1), map.end());
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_THROW(map.at(1), std::out_of_range);
+}
+
+TEST(PersistentHashMap, InsertFindErase) {
+    Map map;
+    EXPECT_TRUE(map.insert_or_assign(1, "one"));
+    EXPECT_TRUE(map.insert_or_assign(2, "two"));
+    EXPECT_FALSE(map.insert_or_assign(1, "uno"));
+    EXPECT_EQ(map.size(), 2);
+
+    const auto it = map.find(1);
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->first, 1);
+    EXPECT_EQ(it->second, "uno");
+    EXPECT_EQ(map.at(2), "two");
+
+    EXPECT_EQ(map.erase(3), 0);
+    EXPECT_EQ(map.erase(1), 1);
+    EXPECT_EQ(map.erase(1), 0);
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_EQ(map.find(1), map.end());
+
+    EXPECT_EQ(map.erase(2), 1);
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(PersistentHashMap, CopiesAreIndependent) {
+    Map original;
+    for (int i = 0; i < 1000; ++i) {
+        original.insert_or_assign(i, std::to_string(i));
+    }
+    const auto expected = ToStdMap(original);
+
+    auto copy = original;
+    EXPECT_EQ(copy, original);
+    for (int i = 0; i < 1000; i += 3) {
+        copy.erase(i);
+    }
+    for (int i = 1; i < 1000; i += 3) {
+        copy.insert_or_assign(i, "changed");
+    }
+    copy.insert_or_assign(5000, "new");
+
+    EXPECT_EQ(ToStdMap(original), expected);
+    EXPECT_NE(copy, original);
+    EXPECT_EQ(copy.size(), 1000 - 334 + 1);
+    EXPECT_EQ(copy.at(1), "changed");
+    EXPECT_EQ(copy.at(2), "2");
+    EXPECT_FALSE(copy.contains(3));
+    EXPECT_FALSE(original.contains(5000));
+}
+
+TEST(PersistentHashMap, FindContinuesIteration) {
+    Map map;
+    for (int i = 0; i < 500; ++i) {
+        map.insert_or_assign(i, std::to_string(i));
+    }
+
+    std::size_t position = 0;
+    for (auto it = map.begin(); it != map.end(); ++it, ++position) {
+        const auto found = map.find(it->first);
+        ASSERT_EQ(found, it);
+        EXPECT_EQ(static_cast<std::size_t>(std::distance(found, map.end())), map.size() - position);
+    }
+}
+
+TEST(PersistentHashMap, HashCollisions) {
+    utils::PersistentHashMap<int, std::string, BadHash> map;
+    for (int i = 0; i < 100; ++i) {
+        map.insert_or_assign(i, std::to_string(i));
+    }
+    auto copy = map;
+    for (int i = 0; i < 100; i += 2) {
+        EXPECT_EQ(copy.erase(i), 1);
+    }
+
+    EXPECT_EQ(ToStdMap(map).size(), 100);
+    EXPECT_EQ(ToStdMap(copy).size(), 50);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(map.at(i), std::to_string(i));
+        EXPECT_EQ(copy.contains(i), i % 2 == 1);
+        EXPECT_EQ(copy.find(i) != copy.end(), i % 2 == 1);
+    }
+}
+
+TEST(PersistentHashMap, RandomOperations) {
+    std::minstd_rand rng{42};
+    Map map;
+    std::unordered_map<int, std::string> expected;
+    std::vector<std::pair<Map, std::map<int, std::string>>> snapshots;
+
+    for (int i = 0; i < 20000; ++i) {
+        const int key = rng() % 3000;
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(map.erase(key), expected.erase(key));
+        } else {
+            const auto value = std::to_string(i);
+            EXPECT_EQ(map.insert_or_assign(key, value), expected.insert_or_assign(key, value).second);
+        }
+        if (i % 2000 == 0) {
+            snapshots.emplace_back(map, std::map<int, std::string>(expected.begin(), expected.end()));
+        }
+    }
+
+    const std::map<int, std::string> expected_sorted(expected.begin(), expected.end());
+    EXPECT_EQ(ToStdMap(map), expected_sorted);
+    for (const auto& [snapshot, snapshot_expected] : snapshots) {
+        EXPECT_EQ(ToStdMap(snapshot), snapshot_expected);
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/utils/regex.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <iterator>
 #include <memory>
@@ -9,6 +10,7 @@
 
 #include <fmt/format.h>
 #include <re2/re2.h>
+#include <re2/set.h>
 #include <boost/container/small_vector.hpp>
 #include <boost/regex.hpp>
 
@@ -333,6 +335,94 @@ std::string regex_replace(std::string_view str, const regex& pattern, Re2Replace
     return res;
 }
 
+////////////////////////////////////////////////////////////////
+
+struct RegexSet::Impl {
+    struct Data {
+        explicit Data(Mode mode)
+            : set(MakeRE2Options(),
+                  mode == Mode::kMatch ? re2::RE2::Anchor::ANCHOR_BOTH : re2::RE2::Anchor::UNANCHORED) {}
+
+        re2::RE2::Set set;
+        std::vector<std::string> patterns;
+    };
+
+    Impl() = default;
+
+    Impl(const std::vector<std::string>& patterns, Mode mode) {
+        auto new_data = std::make_shared<Data>(mode);
+        for (const auto& pattern : patterns) {
+            std::string error;
+            if (new_data->set.Add(pattern, &error) < 0) {
+                throw RegexErrorImpl(fmt::format("Failed to add pattern '{}' to regex set: {}", pattern, error));
+            }
+        }
+        // re2 versions differ in handling of empty sets, they are never matched anyway
+        if (!patterns.empty() && !new_data->set.Compile()) {
+            throw RegexErrorImpl(
+                fmt::format("Failed to compile regex set of {} patterns: out of memory", patterns.size())
+            );
+        }
+        new_data->patterns = patterns;
+        data = std::move(new_data);
+    }
+
+    bool DoMatch(std::string_view str, std::vector<int>* indices) const {
+        UASSERT(data);
+        if (data->patterns.empty()) return false;
+
+        re2::RE2::Set::ErrorInfo error_info{};
+        const bool success = data->set.Match(str, indices, &error_info);
+        if (!success && error_info.kind != re2::RE2::Set::ErrorKind::kNoError) {
+            throw RegexErrorImpl(fmt::format(
+                "Failed to match regex set of {} patterns: re2 error {}",
+                data->patterns.size(),
+                static_cast<int>(error_info.kind)
+            ));
+        }
+        return success;
+    }
+
+    std::shared_ptr<const Data> data;
+};
+
+RegexSet::RegexSet() = default;
+
+RegexSet::RegexSet(const std::vector<std::string>& patterns, Mode mode) : impl_(patterns, mode) {}
+
+RegexSet::RegexSet(const RegexSet&) = default;
+
+RegexSet::RegexSet(RegexSet&&) noexcept = default;
+
+RegexSet& RegexSet::operator=(const RegexSet&) = default;
+
+RegexSet& RegexSet::operator=(RegexSet&&) noexcept = default;
+
+RegexSet::~RegexSet() = default;
+
+std::size_t RegexSet::size() const {
+    UASSERT(impl_->data);
+    return impl_->data->patterns.size();
+}
+
+std::string_view RegexSet::GetPatternView(std::size_t index) const {
+    UASSERT(impl_->data);
+    UASSERT(index < impl_->data->patterns.size());
+    return impl_->data->patterns[index];
+}
+
+std::vector<std::size_t> RegexSet::Match(std::string_view str) const {
+    std::vector<int> indices;
+    if (!impl_->DoMatch(str, &indices)) return {};
+
+    std::sort(indices.begin(), indices.end());
+    return std::vector<std::size_t>(indices.begin(), indices.end());
+}
+
+bool RegexSet::MatchesAny(std::string_view str) const { return impl_->DoMatch(str, nullptr); }
+
+////////////////////////////////////////////////////////////////
+
 bool IsImplicitBoostRegexFallbackAllowed() noexcept { return implicit_boost_regex_fallback_allowed.load(); }
 
 void SetImplicitBoostRegexFallbackAllowed(bool allowed) noexcept { implicit_boost_regex_fallback_allowed = allowed; }
@@ -1,6 +1,10 @@
 #include <userver/utils/regex.hpp>
 
+#include <string>
+#include <vector>
+
 #include <benchmark/benchmark.h>
+#include <fmt/format.h>
 
 #include <utils/gbench_auxilary.hpp>
 
@@ -44,6 +48,39 @@ void UtilsRegexUse(benchmark::State& state) {
 }
 BENCHMARK(UtilsRegexUse)->Apply(SetupRegexBenchmark);
 
+std::vector<std::string> MakeRoutePatterns(std::size_t count) {
+    std::vector<std::string> patterns;
+    patterns.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        patterns.push_back(fmt::format(R"(^/v1/service{}/[a-z]+/\d+(/|$))", i));
+    }
+    return patterns;
+}
+
+constexpr std::string_view kRouteTarget = "/v1/service0/items/12345/details";
+
+void UtilsRegexSearchEach(benchmark::State& state) {
+    std::vector<utils::regex> regexes;
+    for (const auto& pattern : MakeRoutePatterns(state.range(0))) regexes.emplace_back(pattern);
+
+    for ([[maybe_unused]] auto _ : state) {
+        std::size_t matches = 0;
+        for (const auto& regex : regexes) matches += utils::regex_search(kRouteTarget, regex);
+        benchmark::DoNotOptimize(matches);
+    }
+}
+BENCHMARK(UtilsRegexSearchEach)->RangeMultiplier(4)->Range(8, 512);
+
+void UtilsRegexSetMatch(benchmark::State& state) {
+    const utils::RegexSet set{MakeRoutePatterns(state.range(0))};
+
+    for ([[maybe_unused]] auto _ : state) {
+        const auto matches = set.Match(kRouteTarget);
+        benchmark::DoNotOptimize(matches);
+    }
+}
+BENCHMARK(UtilsRegexSetMatch)->RangeMultiplier(4)->Range(8, 512);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
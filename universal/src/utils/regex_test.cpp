@@ -345,4 +345,51 @@ TEST(Regex, ReplaceRe2) {
     EXPECT_EQ(utils::regex_replace("ab0ef1", group_regex, utils::Re2Replacement{"(\\2-\\1)"}), "(0-ab)(1-ef)");
 }
 
+TEST(RegexSet, Search) {
+    /// [regex set]
+    const utils::RegexSet set({"^/api/", "\\.php$", "select\\s+\\*", "admin"});
+    EXPECT_EQ(set.size(), 4);
+    EXPECT_EQ(set.GetPatternView(1), "\\.php$");
+
+    EXPECT_THAT(set.Match("/api/admin/index.php"), testing::ElementsAre(0, 1, 3));
+    EXPECT_THAT(set.Match("/static/select  *"), testing::ElementsAre(2));
+    EXPECT_THAT(set.Match("/static/index.html"), testing::IsEmpty());
+
+    EXPECT_TRUE(set.MatchesAny("/admin"));
+    EXPECT_FALSE(set.MatchesAny("/static/index.html"));
+    /// [regex set]
+}
+
+TEST(RegexSet, Match) {
+    const utils::RegexSet set({"[a-z]+", "\\d+", "[a-z0-9]+"}, utils::RegexSet::Mode::kMatch);
+    EXPECT_THAT(set.Match("abc"), testing::ElementsAre(0, 2));
+    EXPECT_THAT(set.Match("123"), testing::ElementsAre(1, 2));
+    EXPECT_THAT(set.Match("abc123"), testing::ElementsAre(2));
+    EXPECT_THAT(set.Match("abc-123"), testing::IsEmpty());
+    EXPECT_FALSE(set.MatchesAny(""));
+}
+
+TEST(RegexSet, ManyPatterns) {
+    std::vector<std::string> patterns;
+    for (int i = 0; i < 500; ++i) patterns.push_back(fmt::format("^/v1/handler{}(/|$)", i));
+    const utils::RegexSet set(patterns);
+
+    EXPECT_THAT(set.Match("/v1/handler42/foo"), testing::ElementsAre(42));
+    EXPECT_THAT(set.Match("/v1/handler499"), testing::ElementsAre(499));
+    EXPECT_FALSE(set.MatchesAny("/v1/handler500"));
+}
+
+TEST(RegexSet, Empty) {
+    const utils::RegexSet set(std::vector<std::string>{});
+    EXPECT_EQ(set.size(), 0);
+    EXPECT_THAT(set.Match("foo"), testing::IsEmpty());
+    EXPECT_FALSE(set.MatchesAny("foo"));
+}
+
+TEST(RegexSet, InvalidPattern) {
+    UEXPECT_THROW(utils::RegexSet({"foo", "regex***"}), utils::RegexError);
+    // Never falls back to boost::regex
+    UEXPECT_THROW(utils::RegexSet({"foo(?!bar)"}), utils::RegexError);
+}
+
 USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <userver/utils/str_icase.hpp>
 
 #include <algorithm>  // for std::min
+#include <cstring>
 
 #include <userver/compiler/thread_local.hpp>
 #include <userver/utils/rand.hpp>
@@ -59,7 +60,19 @@ std::size_t StrCaseHash::operator()(std::string_view s) const& noexcept {
 
 int StrIcaseCompareThreeWay::operator()(std::string_view lhs, std::string_view rhs) const noexcept {
     const auto min_len = std::min(lhs.size(), rhs.size());
-    for (std::size_t i = 0; i < min_len; ++i) {
+
+    // Skip the byte-exact common prefix a word at a time, case folding is only
+    // needed from the first differing word on.
+    std::size_t i = 0;
+    for (; i + sizeof(std::uint64_t) <= min_len; i += sizeof(std::uint64_t)) {
+        std::uint64_t a{};
+        std::uint64_t b{};
+        std::memcpy(&a, lhs.data() + i, sizeof(a));
+        std::memcpy(&b, rhs.data() + i, sizeof(b));
+        if (a != b) break;
+    }
+
+    for (; i < min_len; ++i) {
         unsigned char a = lhs[i];
         unsigned char b = rhs[i];
 
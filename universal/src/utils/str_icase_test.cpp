@@ -92,6 +92,17 @@ TEST(StrIcases, CompareLess) {
     EXPECT_TRUE(utils::StrIcaseLess{}(std::string_view("\0bc", 3), std::string_view("ab", 2)));
 }
 
+TEST(StrIcases, CompareLessLongCommonPrefix) {
+    const utils::StrIcaseCompareThreeWay compare;
+
+    EXPECT_EQ(compare("x-common-prefix-abc", "x-common-prefix-ABC"), 0);
+    EXPECT_LT(compare("x-common-prefix-abc", "x-common-prefix-ABD"), 0);
+    EXPECT_GT(compare("x-common-prefix-ABD", "x-common-prefix-abc"), 0);
+    EXPECT_LT(compare("x-common-prefix", "x-common-prefix-"), 0);
+    EXPECT_GT(compare("x-coMMon-prefiy", "x-common-prefix-"), 0);
+    EXPECT_LT(compare("12345678", "12345679"), 0);
+}
+
 TEST(StrIcases, CompareLessMany) {
     std::vector<std::string> v;
     for (size_t i = 0; i < 26; i++) {
@@ -8,6 +8,7 @@
 #include <pthread.h>
 #elif defined(BSD)
 #include <pthread_np.h>
+#include <sys/cpuset.h>
 #include <sys/time.h>
 #include <unistd.h>
 #else
@@ -17,6 +18,7 @@
 #endif
 
 #include <algorithm>
+#include <system_error>
 
 #include <fmt/format.h>
 
@@ -74,6 +76,69 @@ void SetCurrentThreadLowPriorityScheduling() {
     utils::CheckSyscall(::setpriority(PRIO_PROCESS, 0, kLowPriority), "setting thread scheduling parameters");
 }
 
+void SetCurrentThreadCpuAffinity(const std::vector<std::size_t>& cpus) {
+#if defined(__APPLE__)
+    (void)cpus;
+    throw std::system_error(
+        std::make_error_code(std::errc::function_not_supported), "setting thread CPU affinity is not supported"
+    );
+#else
+#if defined(BSD)
+    ::cpuset_t cpu_set;
+#else
+    ::cpu_set_t cpu_set;
+#endif
+    CPU_ZERO(&cpu_set);
+    for (const auto cpu : cpus) {
+        if (cpu >= CPU_SETSIZE) {
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                fmt::format("CPU index {} exceeds the maximum of {}", cpu, CPU_SETSIZE - 1)
+            );
+        }
+        CPU_SET(cpu, &cpu_set);
+    }
+
+#if defined(BSD)
+    const auto error_code = ::pthread_setaffinity_np(::pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (error_code != 0) {
+        throw std::system_error(error_code, std::generic_category(), "setting thread CPU affinity");
+    }
+#else
+    static constexpr ::pid_t kThisThreadPid = 0;
+    utils::CheckSyscall(::sched_setaffinity(kThisThreadPid, sizeof(cpu_set), &cpu_set), "setting thread CPU affinity");
+#endif
+#endif
+}
+
+std::vector<std::size_t> GetCurrentThreadCpuAffinity() {
+#if defined(__APPLE__)
+    throw std::system_error(
+        std::make_error_code(std::errc::function_not_supported), "getting thread CPU affinity is not supported"
+    );
+#else
+#if defined(BSD)
+    ::cpuset_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    const auto error_code = ::pthread_getaffinity_np(::pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (error_code != 0) {
+        throw std::system_error(error_code, std::generic_category(), "getting thread CPU affinity");
+    }
+#else
+    ::cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    static constexpr ::pid_t kThisThreadPid = 0;
+    utils::CheckSyscall(::sched_getaffinity(kThisThreadPid, sizeof(cpu_set), &cpu_set), "getting thread CPU affinity");
+#endif
+
+    std::vector<std::size_t> cpus;
+    for (std::size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &cpu_set)) cpus.push_back(cpu);
+    }
+    return cpus;
+#endif
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,10 @@
 #include <userver/utils/threads.hpp>
 
+#include <sched.h>
+#include <sched.h>
 #include <sys/resource.h>
+#include <algorithm>
+#include <system_error>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -28,4 +32,40 @@ TEST(Threads, NotMainThreadLowPriority) {
     EXPECT_EQ(main_priority, ::getpriority(PRIO_PROCESS, 0));
 }
 
+#ifdef __linux__
+TEST(Threads, CpuAffinity) {
+    ::cpu_set_t initial_set;
+    ASSERT_EQ(::sched_getaffinity(0, sizeof(initial_set), &initial_set), 0);
+
+    std::size_t some_allowed_cpu = 0;
+    while (!CPU_ISSET(some_allowed_cpu, &initial_set)) ++some_allowed_cpu;
+
+    std::thread another_thread([some_allowed_cpu] {
+        utils::SetCurrentThreadCpuAffinity({some_allowed_cpu});
+
+        ::cpu_set_t new_set;
+        ASSERT_EQ(::sched_getaffinity(0, sizeof(new_set), &new_set), 0);
+        EXPECT_EQ(CPU_COUNT(&new_set), 1);
+        EXPECT_TRUE(CPU_ISSET(some_allowed_cpu, &new_set));
+    });
+    another_thread.join();
+
+    ::cpu_set_t main_set;
+    ASSERT_EQ(::sched_getaffinity(0, sizeof(main_set), &main_set), 0);
+    EXPECT_TRUE(CPU_EQUAL(&initial_set, &main_set)) << "affinity of other threads must not change";
+
+    EXPECT_THROW(utils::SetCurrentThreadCpuAffinity({CPU_SETSIZE}), std::system_error);
+}
+
+TEST(Threads, GetCpuAffinity) {
+    ::cpu_set_t initial_set;
+    ASSERT_EQ(::sched_getaffinity(0, sizeof(initial_set), &initial_set), 0);
+
+    const auto cpus = utils::GetCurrentThreadCpuAffinity();
+    EXPECT_EQ(cpus.size(), static_cast<std::size_t>(CPU_COUNT(&initial_set)));
+    EXPECT_TRUE(std::is_sorted(cpus.begin(), cpus.end()));
+    for (const auto cpu : cpus) EXPECT_TRUE(CPU_ISSET(cpu, &initial_set));
+}
+#endif
+
 USERVER_NAMESPACE_END
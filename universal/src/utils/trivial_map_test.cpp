@@ -158,6 +158,68 @@ TEST(TrivialBiMap, MakeTrivialSet) {
     EXPECT_EQ(kSet.GetIndex("ten"), std::nullopt);
 }
 
+// More Case's than utils::impl::kMaxLinearSearchSize, so the search is hashed
+constexpr std::string_view kStatusNames[] = {
+    "Continue",           "Switching Protocols",
+    "OK",                 "Created",
+    "Accepted",           "Non-Authoritative Information",
+    "No Content",         "Reset Content",
+    "Partial Content",    "Multiple Choices",
+    "Moved Permanently",  "Found",
+    "See Other",          "Not Modified",
+    "Temporary Redirect", "Permanent Redirect",
+    "Bad Request",        "Unauthorized",
+    "Payment Required",   "Forbidden",
+    "Not Found",          "Method Not Allowed",
+    "Not Acceptable",     "Proxy Authentication Required",
+    "Request Timeout",    "Conflict",
+    "Gone",               "Length Required",
+    "Precondition Failed", "Content Too Large",
+    "URI Too Long",       "Unsupported Media Type",
+    "Range Not Satisfiable", "Expectation Failed",
+    "Too Many Requests",  "Internal Server Error",
+    "Not Implemented",    "Bad Gateway",
+    "Service Unavailable", "Gateway Timeout",
+    // Duplicates are ignored, the first Case wins
+    "OK",
+};
+constexpr int kStatusCodes[] = {
+    100, 101, 200, 201, 202, 203, 204, 205, 206, 300, 301, 302, 303, 304, 307, 308, 400, 401, 402, 403, 404,
+    405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 429, 500, 501, 502, 503, 504, 0,
+};
+
+TEST(TrivialBiMap, MakeTrivialBiMapBig) {
+    static constexpr auto kMap = utils::MakeTrivialBiMap<kStatusNames, kStatusCodes>();
+    static_assert(kMap.size() > utils::impl::kMaxLinearSearchSize);
+    static_assert(kMap.TryFind(404) == "Not Found");
+    static_assert(kMap.TryFind("Not Found") == 404);
+
+    for (std::size_t i = 0; i + 1 < std::size(kStatusCodes); ++i) {
+        EXPECT_EQ(kMap.TryFind(kStatusNames[i]), kStatusCodes[i]);
+        EXPECT_EQ(kMap.TryFind(kStatusCodes[i]), kStatusNames[i]);
+    }
+
+    EXPECT_EQ(kMap.TryFind("OK"), 200);
+    EXPECT_EQ(kMap.TryFind(0), "OK");
+    EXPECT_EQ(kMap.TryFind("Unknown"), std::nullopt);
+    EXPECT_EQ(kMap.TryFind(""), std::nullopt);
+    EXPECT_EQ(kMap.TryFind("Z"), std::nullopt);
+    EXPECT_EQ(kMap.TryFind(42), std::nullopt);
+    EXPECT_EQ(kMap.TryFind(-1), std::nullopt);
+    EXPECT_EQ(kMap.TryFind(1000), std::nullopt);
+}
+
+TEST(TrivialBiMap, MakeTrivialSetBig) {
+    static constexpr auto kSet = utils::MakeTrivialSet<kStatusNames>();
+
+    for (const auto name : kStatusNames) {
+        EXPECT_TRUE(kSet.Contains(name));
+    }
+    EXPECT_FALSE(kSet.Contains("Unknown"));
+    EXPECT_FALSE(kSet.Contains(""));
+    EXPECT_EQ(kSet.GetIndex("OK"), 2);
+}
+
 TEST(TrivialBiMap, FindICaseBySecond) {
     static constexpr utils::TrivialBiMap kNumToGerman = [](auto selector) {
         return selector().Case(0, "null").Case(1, "eins").Case(2, "zwei").Case(3, "drei");
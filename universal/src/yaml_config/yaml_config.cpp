@@ -166,6 +166,37 @@ std::optional<YamlConfig> GetYamlConfig(
     );
 }
 
+// Returns std::nullopt if the value can not be represented without the special
+// syntax
+std::optional<formats::yaml::ValueBuilder> ResolveImpl(const YamlConfig& value) {
+    if (value.IsObject()) {
+        formats::yaml::ValueBuilder builder{formats::common::Type::kObject};
+        for (const auto& [name, member] : Items(value)) {
+            // Keys with a missing variable and without a fallback are missing
+            if (member.IsMissing()) continue;
+
+            auto resolved = ResolveImpl(member);
+            if (!resolved) return std::nullopt;
+            builder[name] = std::move(*resolved);
+        }
+        return builder;
+    }
+
+    if (value.IsArray()) {
+        formats::yaml::ValueBuilder builder{formats::common::Type::kArray};
+        for (const auto& item : value) {
+            if (item.IsMissing()) return std::nullopt;
+
+            auto resolved = ResolveImpl(item);
+            if (!resolved) return std::nullopt;
+            builder.PushBack(std::move(*resolved));
+        }
+        return builder;
+    }
+
+    return formats::yaml::ValueBuilder{value.As<formats::yaml::Value>()};
+}
+
 }  // namespace
 
 YamlConfig::YamlConfig(formats::yaml::Value yaml, formats::yaml::Value config_vars, Mode mode)
@@ -178,6 +209,12 @@ YamlConfig YamlConfig::operator[](std::string_view key) const {
         return MakeMissingConfig(*this, key);
     }
 
+    if (is_resolved_) {
+        YamlConfig result{yaml_[key], {}};
+        result.is_resolved_ = true;
+        return result;
+    }
+
     auto yaml_config = GetYamlConfig(yaml_, config_vars_, mode_, key);
     if (yaml_config) {
         return std::move(*yaml_config);
@@ -189,6 +226,12 @@ YamlConfig YamlConfig::operator[](std::string_view key) const {
 YamlConfig YamlConfig::operator[](size_t index) const {
     auto value = yaml_[index];
 
+    if (is_resolved_) {
+        YamlConfig result{std::move(value), {}};
+        result.is_resolved_ = true;
+        return result;
+    }
+
     if (IsSubstitution(value)) {
         const auto var_name = GetSubstitutionVarName(value);
 
@@ -266,6 +309,22 @@ YamlConfig::const_iterator YamlConfig::end() const { return const_iterator{*this
 
 formats::yaml::Value YamlConfig::GetRawYamlWithoutConfigVars() const { return yaml_; }
 
+YamlConfig YamlConfig::Resolve() const {
+    if (is_resolved_ || IsMissing()) return *this;
+
+    auto resolved = ResolveImpl(*this);
+    if (!resolved) return *this;
+
+    auto yaml = resolved->ExtractValue();
+    if (!yaml_.IsRoot()) {
+        yaml = yaml.CloneWithReplacedPath(yaml_.GetPath());
+    }
+
+    YamlConfig result{std::move(yaml), {}};
+    result.is_resolved_ = true;
+    return result;
+}
+
 bool Parse(const YamlConfig& value, formats::parse::To<bool>) { return value.yaml_.As<bool>(); }
 
 int64_t Parse(const YamlConfig& value, formats::parse::To<int64_t>) { return value.yaml_.As<int64_t>(); }
@@ -854,4 +854,75 @@ array:
     ::unsetenv("ANOTHER_ENV_VARIABLE");
 }
 
+TEST(YamlConfig, Resolve) {
+    const auto node = formats::yaml::FromString(R"(
+root:
+    foo: $variable
+    bar#env: SOME_ENV_VARIABLE
+    missing: $missing-variable
+    fallback: $missing-variable
+    fallback#fallback: 5
+    array:
+      - $another-variable
+      - $oh-a-string
+)");
+
+    const auto vars = formats::yaml::FromString(R"(
+variable: 42
+another-variable#env: ANOTHER_ENV_VARIABLE
+oh-a-string: $not-a-substitution
+)");
+
+    const auto expected = formats::yaml::FromString(R"(
+foo: 42
+bar: baz
+fallback: 5
+array:
+  - qux
+  - $not-a-substitution
+)");
+
+    // NOLINTNEXTLINE(concurrency-mt-unsafe)
+    ::setenv("SOME_ENV_VARIABLE", "baz", 1);
+    // NOLINTNEXTLINE(concurrency-mt-unsafe)
+    ::setenv("ANOTHER_ENV_VARIABLE", "qux", 1);
+
+    const yaml_config::YamlConfig yaml{node, vars, yaml_config::YamlConfig::Mode::kEnvAllowed};
+    const auto resolved = yaml["root"].Resolve();
+
+    // NOLINTNEXTLINE(concurrency-mt-unsafe)
+    ::unsetenv("SOME_ENV_VARIABLE");
+    // NOLINTNEXTLINE(concurrency-mt-unsafe)
+    ::unsetenv("ANOTHER_ENV_VARIABLE");
+
+    EXPECT_EQ(resolved.As<formats::yaml::Value>(), expected);
+    EXPECT_EQ(resolved["foo"].As<int>(), 42);
+    EXPECT_EQ(resolved["bar"].As<std::string>(), "baz");
+    EXPECT_TRUE(resolved["missing"].IsMissing());
+    EXPECT_EQ(resolved["array"][1].As<std::string>(), "$not-a-substitution");
+    EXPECT_EQ(resolved["array"][0].GetPath(), "root.array[0]");
+    EXPECT_EQ(resolved["missing"].GetPath(), "root.missing");
+    EXPECT_EQ(resolved.GetSize(), 4);
+
+    std::vector<std::string> keys;
+    for (const auto& [key, value] : Items(resolved)) {
+        keys.push_back(key);
+        EXPECT_EQ(value.GetPath(), "root." + key);
+    }
+    EXPECT_EQ(keys, (std::vector<std::string>{"foo", "bar", "fallback", "array"}));
+}
+
+TEST(YamlConfig, ResolveMissingArrayItem) {
+    const auto node = formats::yaml::FromString(R"(
+array:
+  - $missing-variable
+  - $variable
+)");
+    const auto vars = formats::yaml::FromString("variable: 42");
+
+    const auto resolved = yaml_config::YamlConfig{node, vars}.Resolve();
+    EXPECT_TRUE(resolved["array"][0].IsMissing());
+    EXPECT_EQ(resolved["array"][1].As<int>(), 42);
+}
+
 USERVER_NAMESPACE_END
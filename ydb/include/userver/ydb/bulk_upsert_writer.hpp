@@ -0,0 +1,156 @@
+#pragma once
+
+/// @file userver/ydb/bulk_upsert_writer.hpp
+/// @brief @copybrief ydb::BulkUpsertWriter
+
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <ydb-cpp-sdk/v2/client/value/value.h>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+#include <userver/ydb/io/traits.hpp>
+#include <userver/ydb/settings.hpp>
+#include <userver/ydb/table.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb {
+
+/// @brief Streams rows into a table with a series of BulkUpsert requests
+///
+/// Rows are serialized into the current chunk as they are written, so the
+/// whole range never has to be kept in memory. A full chunk is sent in the
+/// background while the next one is being built. Write waits for the previous
+/// chunk to be upserted before sending the next one, so no more than two
+/// chunks are kept in memory at a time.
+///
+/// `Row` is expected to be a struct supported by ydb::ValueTraits, e.g. one
+/// that is used with ydb::TableClient::BulkUpsert.
+///
+/// ## Example usage:
+///
+/// @code
+/// ydb::BulkUpsertWriter<MyRow> writer{table_client, "my_table"};
+/// for (const auto& row : source) writer.Write(row);
+/// writer.Finish();
+/// @endcode
+template <typename Row>
+class BulkUpsertWriter final {
+public:
+    /// Number of rows that are sent in a single BulkUpsert by default
+    static constexpr std::size_t kDefaultChunkRows = 10'000;
+
+    /// @param table_client client to send the rows with, must outlive the writer
+    /// @param table the table path relative to the database
+    /// @param chunk_rows number of rows that are sent in a single BulkUpsert
+    /// @param settings settings for each of the BulkUpsert requests
+    BulkUpsertWriter(
+        TableClient& table_client,
+        std::string table,
+        std::size_t chunk_rows = kDefaultChunkRows,
+        OperationSettings settings = {}
+    );
+
+    BulkUpsertWriter(BulkUpsertWriter&&) = delete;
+    BulkUpsertWriter& operator=(BulkUpsertWriter&&) = delete;
+
+    /// Waits for the chunk in flight. Buffered rows are dropped if Finish was
+    /// not called.
+    ~BulkUpsertWriter();
+
+    /// @brief Serializes the row into the current chunk, sends the chunk if it
+    /// is full
+    /// @throws ydb::YdbResponseError if the previous chunk failed
+    void Write(const Row& row);
+
+    /// @brief Sends the remaining rows and waits for all the chunks
+    /// @throws ydb::YdbResponseError if any of the chunks failed
+    void Finish();
+
+private:
+    void SendChunk();
+    void WaitInFlight();
+
+    TableClient& table_client_;
+    const std::string table_;
+    const std::size_t chunk_rows_;
+    const OperationSettings settings_;
+
+    std::optional<NYdb::TValueBuilder> builder_;
+    std::size_t rows_{0};
+
+    // This should be the last member
+    engine::TaskWithResult<void> in_flight_;
+};
+
+template <typename Row>
+BulkUpsertWriter<Row>::BulkUpsertWriter(
+    TableClient& table_client,
+    std::string table,
+    std::size_t chunk_rows,
+    OperationSettings settings
+)
+    : table_client_(table_client), table_(std::move(table)), chunk_rows_(chunk_rows), settings_(std::move(settings)) {
+    UINVARIANT(chunk_rows_ > 0, "chunk_rows should be positive");
+}
+
+template <typename Row>
+BulkUpsertWriter<Row>::~BulkUpsertWriter() {
+    if (!in_flight_.IsValid()) return;
+
+    try {
+        in_flight_.Get();
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "Failed to bulk upsert a chunk into '" << table_ << "': " << ex;
+    }
+}
+
+template <typename Row>
+void BulkUpsertWriter<Row>::Write(const Row& row) {
+    if (!builder_) {
+        builder_.emplace();
+        builder_->BeginList();
+    }
+    builder_->AddListItem();
+    ydb::Write(*builder_, row);
+
+    if (++rows_ >= chunk_rows_) SendChunk();
+}
+
+template <typename Row>
+void BulkUpsertWriter<Row>::Finish() {
+    if (rows_ != 0) SendChunk();
+    WaitInFlight();
+}
+
+template <typename Row>
+void BulkUpsertWriter<Row>::SendChunk() {
+    UASSERT(builder_ && rows_ != 0);
+    builder_->EndList();
+    auto rows = builder_->Build();
+    builder_.reset();
+    rows_ = 0;
+
+    // Backpressure: the next chunk is not sent until the previous one is done
+    WaitInFlight();
+    in_flight_ = utils::Async("ydb_bulk_upsert_chunk", [this, rows = std::move(rows)]() mutable {
+        table_client_.BulkUpsert(table_, std::move(rows), settings_);
+    });
+}
+
+template <typename Row>
+void BulkUpsertWriter<Row>::WaitInFlight() {
+    if (in_flight_.IsValid()) in_flight_.Get();
+}
+
+}  // namespace ydb
+
+USERVER_NAMESPACE_END
@@ -52,6 +52,7 @@ class Driver;
 /// databases.<dbname>.prefer_local_dc | prefer making requests to local DataCenter | false
 /// databases.<dbname>.aliases | list of alias names for this database | []
 /// databases.<dbname>.sync_start | fail on boot time if YDB is not accessible | true
+/// databases.<dbname>.warmup-sessions | create `min_pool_size` sessions on boot, requires `sync_start` | true
 /// databases.<dbname>.by-database-timings-buckets-ms | histogram bounds for by-database timing metrics | 40 buckets with +20% increment per step
 /// databases.<dbname>.by-query-timings-buckets-ms | histogram bounds for by-query timing metrics | 15 buckets with +100% increment per step
 
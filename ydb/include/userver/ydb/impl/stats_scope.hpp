@@ -26,6 +26,8 @@ public:
     void OnTransportError() noexcept;
     void OnCancelled() noexcept;
 
+    StatsCounters& GetCounters() noexcept { return stats_; }
+
 private:
     explicit StatsScope(StatsCounters&);
 
@@ -198,6 +198,8 @@ private:
 
     void Select1();
 
+    void WarmUpSessions(std::uint32_t sessions_count);
+
     NYdb::NTable::TExecDataQuerySettings ToExecQuerySettings(QuerySettings query_settings) const;
 
     template <typename... Args>
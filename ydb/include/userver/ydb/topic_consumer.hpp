@@ -0,0 +1,126 @@
+#pragma once
+
+/// @file userver/ydb/topic_consumer.hpp
+/// @brief @copybrief ydb::TopicConsumerScope
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+#include <ydb-cpp-sdk/v2/client/topic/client.h>
+
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb {
+
+class TopicClient;
+class TopicReadSession;
+
+/// Message of a topic, the payload is available via `GetData()`
+using TopicMessage = NYdb::NTopic::TReadSessionEvent::TDataReceivedEvent::TMessage;
+
+/// @brief Messages of a single partition received in one read
+///
+/// The messages are not copied, they point into the events of the read session
+/// and are only valid during the callback.
+struct TopicPartitionBatch final {
+    std::string_view topic_path;
+    std::uint64_t partition_id{0};
+    /// Messages in the order of the offsets
+    std::vector<std::reference_wrapper<const TopicMessage>> messages;
+};
+
+/// Settings of ydb::TopicConsumerScope
+struct TopicConsumerSettings final {
+    /// Limit for the data that is read ahead and not yet processed
+    std::size_t max_memory_usage_bytes{64 * 1024 * 1024};
+
+    /// Limit for the partitions that are processed concurrently
+    std::size_t max_concurrent_partitions{8};
+
+    /// Delay before recreating the read session after an error
+    std::chrono::milliseconds restart_delay{1000};
+
+    /// How long to wait for the commit acknowledgements on stop
+    std::chrono::milliseconds close_timeout{3000};
+};
+
+// clang-format off
+
+/// @brief Reads topics in a background task and processes the partitions
+/// concurrently
+///
+/// The read session reads ahead up to `max_memory_usage_bytes` of data.
+/// Each read is split by partitions, and the callback is invoked once per
+/// partition in a separate task, no more than `max_concurrent_partitions` at
+/// a time. The order of the messages within a partition is kept.
+///
+/// Offsets of the whole read are committed with a single commit after the
+/// callback succeeds for all of the partitions. If the callback throws, the
+/// read session is recreated after `restart_delay`, and the uncommitted
+/// messages are received again, so the processing should be idempotent.
+///
+/// Partition sessions are confirmed automatically.
+///
+/// ## Example usage:
+///
+/// @code
+/// ydb::TopicConsumerScope consumer{topic_client, read_session_settings, {}};
+/// consumer.Start([](const ydb::TopicPartitionBatch& batch) {
+///   for (const ydb::TopicMessage& message : batch.messages) {
+///     Process(message.GetData());
+///   }
+/// });
+/// @endcode
+
+// clang-format on
+class TopicConsumerScope final {
+public:
+    /// Invoked for each of the partitions of a read, concurrently
+    using Callback = std::function<void(const TopicPartitionBatch&)>;
+
+    /// @param topic_client client to read with, must outlive the scope
+    /// @param read_settings topics and consumer name to read with
+    /// @param settings prefetch and processing settings
+    TopicConsumerScope(
+        TopicClient& topic_client,
+        NYdb::NTopic::TReadSessionSettings read_settings,
+        TopicConsumerSettings settings
+    );
+
+    TopicConsumerScope(TopicConsumerScope&&) = delete;
+    TopicConsumerScope& operator=(TopicConsumerScope&&) = delete;
+
+    /// Stops the consumer
+    ~TopicConsumerScope();
+
+    /// Starts reading in the background
+    void Start(Callback callback);
+
+    /// @brief Stops reading and closes the read session
+    /// @warning Waits for the running callbacks
+    void Stop() noexcept;
+
+private:
+    using DataEvents = std::vector<NYdb::NTopic::TReadSessionEvent::TDataReceivedEvent*>;
+
+    void Run(const Callback& callback);
+    void RunSession(TopicReadSession& session, const Callback& callback);
+    void ProcessData(DataEvents& data_events, const Callback& callback);
+
+    TopicClient& topic_client_;
+    NYdb::NTopic::TReadSessionSettings read_settings_;
+    const TopicConsumerSettings settings_;
+
+    // This should be the last member
+    engine::TaskWithResult<void> task_;
+};
+
+}  // namespace ydb
+
+USERVER_NAMESPACE_END
@@ -251,6 +251,10 @@ properties:
                     type: boolean
                     defaultDescription: true
                     description: fail to boot if YDB is not available
+                warmup-sessions:
+                    type: boolean
+                    defaultDescription: true
+                    description: create min_pool_size sessions on synchronous start
                 aliases:
                     description: list of aliases for this database
                     type: array
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 
 #include <fmt/format.h>
@@ -48,10 +49,15 @@ public:
     RetryHandler(
         TClient& client,
         utils::RetryBudget& retry_budget,
+        StatsCounters& stats,
         const NYdb::NRetry::TRetryOperationSettings& retry_settings,
         Fn&& fn
     )
-        : client_{client}, retry_budget_{retry_budget}, retry_settings_{retry_settings}, fn_{std::move(fn)} {}
+        : client_{client},
+          retry_budget_{retry_budget},
+          stats_{stats},
+          retry_settings_{retry_settings},
+          fn_{std::move(fn)} {}
 
     AsyncResultType Execute() {
         auto internal_retry_status = RetryOperation(
@@ -69,11 +75,17 @@ public:
 
 private:
     NYdb::TAsyncStatus InternalRetryIteration(ArgType arg) {
+        // Attempts are made one after another, no need for synchronization
+        const bool is_retry = attempts_++ != 0;
+        const auto attempt_start = std::chrono::steady_clock::now();
         const auto async_result = fn_(std::forward<ArgType>(arg));
 
-        return async_result.Apply([handler = this->shared_from_this()](const auto& async_result) {
-            return handler->HandleResult(async_result);
-        });
+        return async_result.Apply(
+            [handler = this->shared_from_this(), is_retry, attempt_start](const auto& async_result) {
+                AccountAttempt(handler->stats_, std::chrono::steady_clock::now() - attempt_start, is_retry);
+                return handler->HandleResult(async_result);
+            }
+        );
     }
 
     NYdb::TStatus HandleResult(const AsyncResultType& async_result) {
@@ -114,9 +126,12 @@ private:
 
     TClient& client_;
     utils::RetryBudget& retry_budget_;
+    // References to the counters are stable, see GetCountersForQuery
+    StatsCounters& stats_;
     NYdb::NRetry::TRetryOperationSettings retry_settings_;
     Fn fn_;
 
+    std::size_t attempts_{0};
     std::optional<ResultType> result_;
 };
 
@@ -133,6 +148,7 @@ auto RetryOperation(impl::RequestContext& request_context, Fn&& fn) {
     auto retry_handler = std::make_shared<RetryHandler<NYdb::NTable::TTableClient, Fn>>(
         client,
         retry_budget,
+        request_context.stats_scope.GetCounters(),
         PrepareRetrySettings(request_context.settings, retry_budget, request_context.deadline),
         std::forward<Fn>(fn)
     );
@@ -152,6 +168,7 @@ auto RetryQuery(impl::RequestContext& request_context, Fn&& fn) {
     auto retry_handler = std::make_shared<RetryHandler<NYdb::NQuery::TQueryClient, Fn>>(
         client,
         retry_budget,
+        request_context.stats_scope.GetCounters(),
         PrepareRetrySettings(request_context.settings, retry_budget, request_context.deadline),
         std::forward<Fn>(fn)
     );
@@ -45,6 +45,9 @@ void DoDumpMetric(utils::statistics::Writer& writer, const T& stats) {
     writer["timings"] = stats.timings;
 
     writer["cancelled"] = stats.cancelled;
+
+    writer["retries"] = stats.retries;
+    writer["attempt-timings"] = stats.attempt_timings;
 }
 
 }  // namespace
@@ -52,11 +55,18 @@ void DoDumpMetric(utils::statistics::Writer& writer, const T& stats) {
 constexpr utils::span<const double> kDefaultPerDatabaseBounds{kDefaultPerDatabaseBoundsArray};
 constexpr utils::span<const double> kDefaultPerQueryBounds{kDefaultPerQueryBoundsArray};
 
-StatsCounters::StatsCounters(utils::span<const double> histogram_bounds) : timings(histogram_bounds) {}
+StatsCounters::StatsCounters(utils::span<const double> histogram_bounds)
+    : timings(histogram_bounds), attempt_timings(histogram_bounds) {}
 
 void DumpMetric(utils::statistics::Writer& writer, const StatsCounters& stats) { DoDumpMetric(writer, stats); }
 
-StatsAggregator::StatsAggregator(utils::span<const double> histogram_bounds) : timings(histogram_bounds) {}
+void AccountAttempt(StatsCounters& stats, std::chrono::steady_clock::duration attempt_time, bool is_retry) noexcept {
+    if (is_retry) ++stats.retries;
+    stats.attempt_timings.Account(std::chrono::duration<double, std::milli>(attempt_time).count());
+}
+
+StatsAggregator::StatsAggregator(utils::span<const double> histogram_bounds)
+    : timings(histogram_bounds), attempt_timings(histogram_bounds) {}
 
 void StatsAggregator::Add(const StatsCounters& other) {
     success += other.success.Load();
@@ -64,6 +74,8 @@ void StatsAggregator::Add(const StatsCounters& other) {
     transport_error += other.transport_error.Load();
     timings.Add(other.timings.GetView());
     cancelled += other.cancelled.Load();
+    retries += other.retries.Load();
+    attempt_timings.Add(other.attempt_timings.GetView());
 }
 
 void StatsAggregator::Assign(const StatsCounters& other) {
@@ -73,6 +85,9 @@ void StatsAggregator::Assign(const StatsCounters& other) {
     timings.Reset();
     timings.Add(other.timings.GetView());
     cancelled = other.cancelled.Load();
+    retries = other.retries.Load();
+    attempt_timings.Reset();
+    attempt_timings.Add(other.attempt_timings.GetView());
 }
 
 void DumpMetric(utils::statistics::Writer& writer, const StatsAggregator& stats) { DoDumpMetric(writer, stats); }
@@ -25,10 +25,15 @@ struct StatsCounters final {
     utils::statistics::RateCounter transport_error;
     utils::statistics::Histogram timings;
     utils::statistics::RateCounter cancelled;
+    utils::statistics::RateCounter retries;
+    // Timings of the separate attempts, including the retried ones
+    utils::statistics::Histogram attempt_timings;
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const StatsCounters& stats);
 
+void AccountAttempt(StatsCounters& stats, std::chrono::steady_clock::duration attempt_time, bool is_retry) noexcept;
+
 struct StatsAggregator final {
     explicit StatsAggregator(utils::span<const double> histogram_bounds);
 
@@ -41,6 +46,8 @@ struct StatsAggregator final {
     utils::statistics::Rate transport_error;
     utils::statistics::HistogramAggregator timings;
     utils::statistics::Rate cancelled;
+    utils::statistics::Rate retries;
+    utils::statistics::HistogramAggregator attempt_timings;
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const StatsAggregator& stats);
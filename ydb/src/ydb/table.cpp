@@ -1,5 +1,7 @@
 #include <userver/ydb/table.hpp>
 
+#include <vector>
+
 #include <userver/engine/deadline.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
@@ -86,6 +88,7 @@ TableClient::TableClient(
     if (settings.sync_start) {
         LOG_DEBUG() << "Synchronously starting ydb client with name '" << driver_->GetDbName() << "'";
         Select1();
+        if (settings.warmup_sessions) WarmUpSessions(settings.min_pool_size);
     }
 }
 
@@ -190,6 +193,40 @@ void TableClient::Select1() {
     }
 }
 
+void TableClient::WarmUpSessions(std::uint32_t sessions_count) {
+    const tracing::Span span{"ydb_warmup_sessions"};
+
+    std::vector<NYdb::NTable::TAsyncCreateSessionResult> table_futures;
+    std::vector<NYdb::NQuery::TAsyncCreateSessionResult> query_futures;
+    table_futures.reserve(sessions_count);
+    query_futures.reserve(sessions_count);
+    for (std::uint32_t i = 0; i < sessions_count; ++i) {
+        table_futures.push_back(table_client_->GetSession());
+        query_futures.push_back(query_client_->GetSession());
+    }
+
+    // Sessions are held until all of them are created, otherwise the pool
+    // would hand out the same session again and again
+    std::vector<NYdb::NTable::TCreateSessionResult> table_sessions;
+    std::vector<NYdb::NQuery::TCreateSessionResult> query_sessions;
+    table_sessions.reserve(sessions_count);
+    query_sessions.reserve(sessions_count);
+    std::size_t failed = 0;
+    for (auto& future : table_futures) {
+        table_sessions.push_back(impl::GetFutureValueUnchecked(std::move(future)));
+        if (!table_sessions.back().IsSuccess()) ++failed;
+    }
+    for (auto& future : query_futures) {
+        query_sessions.push_back(impl::GetFutureValueUnchecked(std::move(future)));
+        if (!query_sessions.back().IsSuccess()) ++failed;
+    }
+
+    if (failed) {
+        LOG_WARNING() << "Failed to create " << failed << " sessions while warming up ydb client with name '"
+                      << driver_->GetDbName() << "'";
+    }
+}
+
 NYdb::NTable::TTableClient& TableClient::GetNativeTableClient() { return *table_client_; }
 
 NYdb::NQuery::TQueryClient& TableClient::GetNativeQueryClient() { return *query_client_; }
@@ -0,0 +1,174 @@
+#include <userver/ydb/topic_consumer.hpp>
+
+#include <unordered_map>
+#include <variant>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/overloaded.hpp>
+#include <userver/utils/underlying_value.hpp>
+#include <userver/ydb/exceptions.hpp>
+#include <userver/ydb/topic.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb {
+
+namespace {
+
+using TReadSessionEvent = NYdb::NTopic::TReadSessionEvent;
+
+// Returns whether the session is closed
+bool HandleControlEvent(TReadSessionEvent::TEvent& event) {
+    return std::visit(
+        utils::Overloaded{
+            [](TReadSessionEvent::TDataReceivedEvent&) -> bool {
+                UINVARIANT(false, "Data events are processed separately");
+                return false;
+            },
+            [](TReadSessionEvent::TStartPartitionSessionEvent& e) {
+                LOG_DEBUG() << "Starting partition session [TopicPath=" << e.GetPartitionSession()->GetTopicPath()
+                            << ", PartitionId=" << e.GetPartitionSession()->GetPartitionId() << "]";
+                e.Confirm();
+                return false;
+            },
+            [](TReadSessionEvent::TStopPartitionSessionEvent& e) {
+                LOG_DEBUG() << "Stopping partition session [TopicPath=" << e.GetPartitionSession()->GetTopicPath()
+                            << ", PartitionId=" << e.GetPartitionSession()->GetPartitionId() << "]";
+                e.Confirm();
+                return false;
+            },
+            [](TReadSessionEvent::TPartitionSessionClosedEvent& e) {
+                if (e.GetReason() != TReadSessionEvent::TPartitionSessionClosedEvent::EReason::StopConfirmedByUser) {
+                    LOG_WARNING() << "Partition session lost [TopicPath=" << e.GetPartitionSession()->GetTopicPath()
+                                  << ", PartitionId=" << e.GetPartitionSession()->GetPartitionId()
+                                  << ", Reason=" << utils::UnderlyingValue(e.GetReason()) << "]";
+                }
+                return false;
+            },
+            [](NYdb::NTopic::TSessionClosedEvent& e) -> bool {
+                if (!e.IsSuccess()) {
+                    throw BaseError("Topic read session closed unsuccessfully: " + e.GetIssues().ToString());
+                }
+                return true;
+            },
+            [](auto&) { return false; },
+        },
+        event
+    );
+}
+
+}  // namespace
+
+TopicConsumerScope::TopicConsumerScope(
+    TopicClient& topic_client,
+    NYdb::NTopic::TReadSessionSettings read_settings,
+    TopicConsumerSettings settings
+)
+    : topic_client_(topic_client), read_settings_(std::move(read_settings)), settings_(settings) {
+    UINVARIANT(settings_.max_concurrent_partitions > 0, "max_concurrent_partitions should be positive");
+    read_settings_.MaxMemoryUsageBytes(settings_.max_memory_usage_bytes);
+}
+
+TopicConsumerScope::~TopicConsumerScope() { Stop(); }
+
+void TopicConsumerScope::Start(Callback callback) {
+    UINVARIANT(!task_.IsValid(), "Topic consumer is already started");
+    task_ = utils::CriticalAsync("ydb_topic_consumer", [this, callback = std::move(callback)] { Run(callback); });
+}
+
+void TopicConsumerScope::Stop() noexcept {
+    if (!task_.IsValid()) return;
+
+    task_.SyncCancel();
+    task_ = {};
+}
+
+void TopicConsumerScope::Run(const Callback& callback) {
+    while (!engine::current_task::ShouldCancel()) {
+        try {
+            auto session = topic_client_.CreateReadSession(read_settings_);
+            RunSession(session, callback);
+        } catch (const OperationCancelledError&) {
+            break;
+        } catch (const engine::WaitInterruptedException&) {
+            break;
+        } catch (const std::exception& ex) {
+            LOG_ERROR() << "Topic read session failed, restarting in " << settings_.restart_delay.count()
+                        << "ms: " << ex;
+        }
+        engine::InterruptibleSleepFor(settings_.restart_delay);
+    }
+}
+
+void TopicConsumerScope::RunSession(TopicReadSession& session, const Callback& callback) {
+    bool is_closed = false;
+    const utils::FastScopeGuard close_guard{[&]() noexcept {
+        if (!is_closed) session.Close(settings_.close_timeout);
+    }};
+
+    DataEvents data_events;
+    while (!is_closed) {
+        auto events = session.GetEvents();
+
+        // Data is processed in batches, the order relative to the control
+        // events is kept
+        for (auto& event : events) {
+            if (auto* data_event = std::get_if<TReadSessionEvent::TDataReceivedEvent>(&event)) {
+                data_events.push_back(data_event);
+                continue;
+            }
+            ProcessData(data_events, callback);
+            is_closed = HandleControlEvent(event);
+        }
+        ProcessData(data_events, callback);
+    }
+}
+
+void TopicConsumerScope::ProcessData(DataEvents& data_events, const Callback& callback) {
+    if (data_events.empty()) return;
+
+    std::vector<TopicPartitionBatch> batches;
+    std::unordered_map<std::uint64_t, std::size_t> batch_indices;
+    for (auto* data_event : data_events) {
+        const auto& partition_session = data_event->GetPartitionSession();
+        const auto [it, inserted] =
+            batch_indices.try_emplace(partition_session->GetPartitionSessionId(), batches.size());
+        if (inserted) {
+            batches.push_back({partition_session->GetTopicPath(), partition_session->GetPartitionId(), {}});
+        }
+        auto& messages = batches[it->second].messages;
+        for (const auto& message : data_event->GetMessages()) messages.emplace_back(message);
+    }
+
+    if (batches.size() == 1) {
+        callback(batches.front());
+    } else {
+        engine::Semaphore semaphore{settings_.max_concurrent_partitions};
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve(batches.size());
+        for (const auto& batch : batches) {
+            tasks.push_back(utils::Async("ydb_topic_partition", [&callback, &semaphore, &batch] {
+                const engine::SemaphoreLock lock{semaphore};
+                callback(batch);
+            }));
+        }
+        engine::WaitAllChecked(tasks);
+    }
+
+    NYdb::NTopic::TDeferredCommit commit;
+    for (auto* data_event : data_events) commit.Add(*data_event);
+    commit.Commit();
+    data_events.clear();
+}
+
+}  // namespace ydb
+
+USERVER_NAMESPACE_END
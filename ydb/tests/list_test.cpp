@@ -6,6 +6,7 @@
 #include <boost/range/irange.hpp>
 
 #include <userver/utest/utest.hpp>
+#include <userver/ydb/bulk_upsert_writer.hpp>
 
 #include "small_table.hpp"
 #include "test_utils.hpp"
@@ -74,4 +75,25 @@ UTEST_F(YdbListIO, BulkUpsertEmptyRangeOfStructs) {
     AssertArePreFilledRows(result.GetSingleCursor(), {});
 }
 
+UTEST_F(YdbListIO, BulkUpsertWriter) {
+    CreateTable("test_table", false);
+
+    ydb::BulkUpsertWriter<tests::RowValue> writer{GetTableClient(), "test_table", /*chunk_rows=*/2};
+    for (const auto& row : kPreFilledRows) writer.Write(row);
+    writer.Finish();
+
+    auto result = GetTableClient().ExecuteDataQuery(kSelectAllRows);
+    AssertArePreFilledRows(result.GetSingleCursor(), {1, 2, 3});
+}
+
+UTEST_F(YdbListIO, BulkUpsertWriterNoRows) {
+    CreateTable("test_table", false);
+
+    ydb::BulkUpsertWriter<tests::RowValue> writer{GetTableClient(), "test_table"};
+    writer.Finish();
+
+    auto result = GetTableClient().ExecuteDataQuery(kSelectAllRows);
+    AssertArePreFilledRows(result.GetSingleCursor(), {});
+}
+
 USERVER_NAMESPACE_END
@@ -1,8 +1,13 @@
 #include <userver/utest/utest.hpp>
 
+#include <atomic>
+
 #include <userver/engine/async.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/utils/overloaded.hpp>
 #include <userver/ydb/impl/cast.hpp>
+#include <userver/ydb/topic_consumer.hpp>
 
 #include "test_utils.hpp"
 
@@ -170,4 +175,42 @@ UTEST_F(YdbTopicFixture, DescribeTopic) {
     DropConsumer(kTopicPath, kConsumerName);
 }
 
+UTEST_F(YdbTopicFixture, TopicConsumerScope) {
+    AddConsumer(kTopicPath, kConsumerName);
+
+    NYdb::NTopic::TReadSessionSettings read_session_settings;
+    read_session_settings.AppendTopics(ydb::impl::ToString(kTopicPath));
+    read_session_settings.ConsumerName(ydb::impl::ToString(kConsumerName));
+
+    std::atomic<std::size_t> messages_count{0};
+    {
+        ydb::TopicConsumerScope consumer{GetTopicClient(), read_session_settings, {}};
+        consumer.Start([&messages_count](const ydb::TopicPartitionBatch& batch) {
+            EXPECT_EQ(kTopicPath, batch.topic_path);
+            for (const ydb::TopicMessage& message : batch.messages) {
+                EXPECT_FALSE(message.GetData().empty());
+                ++messages_count;
+            }
+        });
+
+        GetTableClient().ExecuteDataQuery(fmt::format(
+            R"-(
+          INSERT INTO {} (key, value)
+          VALUES
+            (123, "qwe"),
+            (321, "xyz");
+        )-",
+            kTable
+        ));
+
+        const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+        while (messages_count < 2 && !deadline.IsReached()) {
+            engine::SleepFor(std::chrono::milliseconds{10});
+        }
+    }
+    EXPECT_EQ(2, messages_count);
+
+    DropConsumer(kTopicPath, kConsumerName);
+}
+
 USERVER_NAMESPACE_END